@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.14.2026
+///
+/// @file              BinaryLogDecoder.c
+///
+/// @brief             Renders a binary log written by LoggingLib as text
+///
+/// @details
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+
+#include "LoggingLib.h"
+
+/// @fn int main(int argc, char **argv)
+///
+/// @brief Decode a log written with loggingSetBinaryMode(true) and print it as
+/// the text log it would have been.  Usage:  BinaryLogDecoder <binaryLog>
+///
+/// @param argc The number of command line arguments.
+/// @param argv The command line arguments.
+///
+/// @return Returns 0 on success, 1 on failure.
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage:  %s <binaryLog>\n", argv[0]);
+    return 1;
+  }
+  
+  FILE *binaryLog = fopen(argv[1], "rb");
+  if (binaryLog == NULL) {
+    fprintf(stderr, "Could not open \"%s\".\n", argv[1]);
+    return 1;
+  }
+  
+  int returnValue = 0;
+  if (loggingDecodeBinaryLog(binaryLog, stdout) != 0) {
+    fprintf(stderr, "\"%s\" is not a complete binary log.\n", argv[1]);
+    returnValue = 1;
+  }
+  fclose(binaryLog);
+  
+  return returnValue;
+}
@@ -0,0 +1,1048 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              ConcurrencyBenchmark.c
+///
+/// @brief             Latency benchmarks for coroutines, thread messages and
+///                    logging.
+///
+/// @details           Measures coroutineResume/coroutineYield round trips,
+///                    comutex and cocondition handoffs between coroutines,
+///                    thrd_msg_q_push to thrd_msg_q_wait latency for a range
+///                    of producer threads, and printLog call latency and
+///                    throughput with the logging thread draining the queue.
+///                    Every sample goes into a log-linear histogram in the
+///                    style of HdrHistogram.  A summary of each histogram is
+///                    printed as one line of CSV (the default) or JSON.  The
+///                    full histograms can also be written to a file.  Built
+///                    with Cnext.a and run by `make bench-concurrency`.  Run
+///                    with -h for the options.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "CThreads.h"
+#include "CThreadsMessages.h"
+#include "Coroutines.h"
+#include "LoggingLib.h"
+
+#define BENCH_DEFAULT_ITERATIONS 100000
+#define BENCH_DEFAULT_PRODUCERS "1,2,4,8,16,32,64"
+#define BENCH_DEFAULT_LOG_THREADS "1,2,4,8"
+#define BENCH_DEFAULT_LOG_FILE "ConcurrencyBenchmark.log"
+
+/// @def BENCH_MAX_VALUES
+///
+/// @brief The maximum number of values that can be given in one of the
+/// comma-separated command line lists.
+#define BENCH_MAX_VALUES 16
+
+/// @def BENCH_HISTOGRAM_LINEAR_BITS
+///
+/// @brief Values below 2^BENCH_HISTOGRAM_LINEAR_BITS nanoseconds are counted
+/// exactly.  Above that, each power of two is split into
+/// 2^(BENCH_HISTOGRAM_LINEAR_BITS - 1) buckets, so a value is known to within
+/// about 1.6%.
+#define BENCH_HISTOGRAM_LINEAR_BITS 7
+#define BENCH_HISTOGRAM_LINEAR_SIZE (1 << BENCH_HISTOGRAM_LINEAR_BITS)
+#define BENCH_HISTOGRAM_HALF_SIZE (BENCH_HISTOGRAM_LINEAR_SIZE / 2)
+#define BENCH_HISTOGRAM_NUM_BUCKETS \
+  (BENCH_HISTOGRAM_LINEAR_SIZE \
+    + ((64 - BENCH_HISTOGRAM_LINEAR_BITS) * BENCH_HISTOGRAM_HALF_SIZE))
+
+/// @struct BenchHistogram
+///
+/// @brief A log-linear histogram of latencies in nanoseconds.
+///
+/// @param counts The number of samples in each bucket.
+/// @param count The total number of samples.
+/// @param min The smallest sample.
+/// @param max The largest sample.
+/// @param sum The sum of all the samples.
+typedef struct BenchHistogram {
+  u64 counts[BENCH_HISTOGRAM_NUM_BUCKETS];
+  u64 count;
+  u64 min;
+  u64 max;
+  double sum;
+} BenchHistogram;
+
+/// @struct BenchOptions
+///
+/// @brief The settings given on the command line.
+///
+/// @param iterations The number of samples each benchmark takes.
+/// @param producers The numbers of producer threads to run the thread message
+///   benchmark with.
+/// @param numProducerCounts The number of values in producers.
+/// @param logThreads The numbers of threads to run the logging benchmark with.
+/// @param numLogThreadCounts The number of values in logThreads.
+/// @param benchmarks The comma-separated names of the benchmarks to run, or
+///   NULL for all of them.
+/// @param logFile The file the logging benchmark logs to.  It is removed when
+///   the benchmark is done.
+/// @param histogramFile The file to write the full histograms to, or NULL.
+/// @param histogramStream The open histogramFile, or NULL.
+/// @param json Whether to print JSON lines instead of CSV.
+typedef struct BenchOptions {
+  u64 iterations;
+  u64 producers[BENCH_MAX_VALUES];
+  u32 numProducerCounts;
+  u64 logThreads[BENCH_MAX_VALUES];
+  u32 numLogThreadCounts;
+  const char *benchmarks;
+  const char *logFile;
+  const char *histogramFile;
+  FILE *histogramStream;
+  bool json;
+} BenchOptions;
+
+/// @fn static i64 benchNow(void)
+///
+/// @brief Get the current time of a monotonic clock.
+///
+/// @return Returns the current time in nanoseconds.
+static i64 benchNow(void) {
+  struct timespec now;
+#ifdef CLOCK_MONOTONIC
+  clock_gettime(CLOCK_MONOTONIC, &now);
+#else
+  timespec_get(&now, TIME_UTC);
+#endif
+  return (((i64) now.tv_sec) * ((i64) 1000000000)) + ((i64) now.tv_nsec);
+}
+
+/// @fn static int benchHighestBit(u64 value)
+///
+/// @brief Get the index of the most significant set bit of a non-zero value.
+///
+/// @param value The value to examine.
+///
+/// @return Returns the bit index, 0 through 63.
+static int benchHighestBit(u64 value) {
+#if defined(__GNUC__) || defined(__clang__)
+  return 63 - __builtin_clzll(value);
+#else
+  int bit = 0;
+  while (value >>= 1) {
+    bit++;
+  }
+  return bit;
+#endif
+}
+
+/// @fn static void benchHistogramInit(BenchHistogram *histogram)
+///
+/// @brief Clear a BenchHistogram.
+///
+/// @param histogram The BenchHistogram to clear.
+static void benchHistogramInit(BenchHistogram *histogram) {
+  memset(histogram, 0, sizeof(*histogram));
+  histogram->min = (u64) -1;
+}
+
+/// @fn static int benchHistogramIndex(u64 value)
+///
+/// @brief Get the bucket a value is counted in.
+///
+/// @param value The value in nanoseconds.
+///
+/// @return Returns the index of the bucket.
+static int benchHistogramIndex(u64 value) {
+  if (value < BENCH_HISTOGRAM_LINEAR_SIZE) {
+    return (int) value;
+  }
+
+  // value >> shift is in [BENCH_HISTOGRAM_HALF_SIZE, BENCH_HISTOGRAM_LINEAR_SIZE).
+  int shift = benchHighestBit(value) - (BENCH_HISTOGRAM_LINEAR_BITS - 1);
+  return BENCH_HISTOGRAM_LINEAR_SIZE
+    + ((shift - 1) * BENCH_HISTOGRAM_HALF_SIZE)
+    + ((int) (value >> shift) - BENCH_HISTOGRAM_HALF_SIZE);
+}
+
+/// @fn static u64 benchHistogramLowest(int index)
+///
+/// @brief Get the smallest value that is counted in a bucket.
+///
+/// @param index The index of the bucket.
+///
+/// @return Returns the smallest value of the bucket in nanoseconds.
+static u64 benchHistogramLowest(int index) {
+  if (index < BENCH_HISTOGRAM_LINEAR_SIZE) {
+    return (u64) index;
+  }
+
+  int offset = index - BENCH_HISTOGRAM_LINEAR_SIZE;
+  int shift = (offset / BENCH_HISTOGRAM_HALF_SIZE) + 1;
+  u64 mantissa
+    = (u64) ((offset % BENCH_HISTOGRAM_HALF_SIZE) + BENCH_HISTOGRAM_HALF_SIZE);
+  return mantissa << shift;
+}
+
+/// @fn static u64 benchHistogramHighest(int index)
+///
+/// @brief Get the largest value that is counted in a bucket.
+///
+/// @param index The index of the bucket.
+///
+/// @return Returns the largest value of the bucket in nanoseconds.
+static u64 benchHistogramHighest(int index) {
+  if (index + 1 >= BENCH_HISTOGRAM_NUM_BUCKETS) {
+    return (u64) -1;
+  }
+  return benchHistogramLowest(index + 1) - 1;
+}
+
+/// @fn static void benchHistogramRecord(BenchHistogram *histogram, i64 value)
+///
+/// @brief Add a sample to a BenchHistogram.
+///
+/// @param histogram The BenchHistogram to add to.
+/// @param value The sample in nanoseconds.  Negative values are counted as 0.
+static void benchHistogramRecord(BenchHistogram *histogram, i64 value) {
+  u64 sample = (value > 0) ? (u64) value : 0;
+  histogram->counts[benchHistogramIndex(sample)]++;
+  histogram->count++;
+  histogram->sum += (double) sample;
+  if (sample < histogram->min) {
+    histogram->min = sample;
+  }
+  if (sample > histogram->max) {
+    histogram->max = sample;
+  }
+}
+
+/// @fn static void benchHistogramMerge(BenchHistogram *destination, const BenchHistogram *source)
+///
+/// @brief Add all the samples of one BenchHistogram to another.
+///
+/// @param destination The BenchHistogram to add to.
+/// @param source The BenchHistogram to add from.
+static void benchHistogramMerge(BenchHistogram *destination,
+  const BenchHistogram *source
+) {
+  for (int ii = 0; ii < BENCH_HISTOGRAM_NUM_BUCKETS; ii++) {
+    destination->counts[ii] += source->counts[ii];
+  }
+  destination->count += source->count;
+  destination->sum += source->sum;
+  if (source->min < destination->min) {
+    destination->min = source->min;
+  }
+  if (source->max > destination->max) {
+    destination->max = source->max;
+  }
+}
+
+/// @fn static u64 benchHistogramPercentile(const BenchHistogram *histogram, double percentile)
+///
+/// @brief Get the value at a percentile of a BenchHistogram.  As with
+/// HdrHistogram, this is the largest value of the bucket the percentile falls
+/// in, but never more than the largest sample.
+///
+/// @param histogram The BenchHistogram to examine.
+/// @param percentile The percentile, 0.0 through 100.0.
+///
+/// @return Returns the value at the percentile in nanoseconds, 0 if the
+/// histogram is empty.
+static u64 benchHistogramPercentile(const BenchHistogram *histogram,
+  double percentile
+) {
+  if (histogram->count == 0) {
+    return 0;
+  }
+
+  u64 target = (u64) ((percentile / 100.0) * ((double) histogram->count));
+  if (target == 0) {
+    target = 1;
+  } else if (target > histogram->count) {
+    target = histogram->count;
+  }
+  u64 seen = 0;
+  for (int ii = 0; ii < BENCH_HISTOGRAM_NUM_BUCKETS; ii++) {
+    seen += histogram->counts[ii];
+    if (seen >= target) {
+      u64 value = benchHistogramHighest(ii);
+      return (value < histogram->max) ? value : histogram->max;
+    }
+  }
+
+  return histogram->max;
+}
+
+/// @fn static void benchReport(BenchOptions *options, const char *benchmark, const char *variant, u64 threads, const BenchHistogram *histogram, i64 elapsed)
+///
+/// @brief Print the summary of a BenchHistogram and, if a histogram file was
+/// given, write the non-empty buckets to it.
+///
+/// @param options The BenchOptions the program is running with.
+/// @param benchmark The name of the benchmark.
+/// @param variant The variant of the benchmark.
+/// @param threads The number of threads the benchmark was run with.
+/// @param histogram The samples of the benchmark.
+/// @param elapsed The wall clock time of the whole benchmark in nanoseconds.
+///   Used for the throughput.
+static void benchReport(BenchOptions *options, const char *benchmark,
+  const char *variant, u64 threads, const BenchHistogram *histogram,
+  i64 elapsed
+) {
+  double mean = (histogram->count > 0)
+    ? histogram->sum / ((double) histogram->count) : 0.0;
+  double opsPerSecond = (elapsed > 0)
+    ? (((double) histogram->count) * 1.0e9) / ((double) elapsed) : 0.0;
+  u64 min = (histogram->count > 0) ? histogram->min : 0;
+
+  if (options->json) {
+    printf("{\"benchmark\":\"%s\",\"variant\":\"%s\",\"threads\":%llu,"
+      "\"samples\":%llu,\"minNs\":%llu,\"meanNs\":%.1f,\"p50Ns\":%llu,"
+      "\"p90Ns\":%llu,\"p99Ns\":%llu,\"p999Ns\":%llu,\"maxNs\":%llu,"
+      "\"opsPerSec\":%.0f}\n",
+      benchmark, variant, llu(threads), llu(histogram->count), llu(min),
+      mean,
+      llu(benchHistogramPercentile(histogram, 50.0)),
+      llu(benchHistogramPercentile(histogram, 90.0)),
+      llu(benchHistogramPercentile(histogram, 99.0)),
+      llu(benchHistogramPercentile(histogram, 99.9)),
+      llu(histogram->max), opsPerSecond);
+  } else {
+    printf("%s,%s,%llu,%llu,%llu,%.1f,%llu,%llu,%llu,%llu,%llu,%.0f\n",
+      benchmark, variant, llu(threads), llu(histogram->count), llu(min),
+      mean,
+      llu(benchHistogramPercentile(histogram, 50.0)),
+      llu(benchHistogramPercentile(histogram, 90.0)),
+      llu(benchHistogramPercentile(histogram, 99.0)),
+      llu(benchHistogramPercentile(histogram, 99.9)),
+      llu(histogram->max), opsPerSecond);
+  }
+  fflush(stdout);
+
+  if (options->histogramStream != NULL) {
+    for (int ii = 0; ii < BENCH_HISTOGRAM_NUM_BUCKETS; ii++) {
+      if (histogram->counts[ii] > 0) {
+        fprintf(options->histogramStream, "%s,%s,%llu,%llu,%llu,%llu\n",
+          benchmark, variant, llu(threads),
+          llu(benchHistogramLowest(ii)), llu(benchHistogramHighest(ii)),
+          llu(histogram->counts[ii]));
+      }
+    }
+  }
+}
+
+// Coroutines
+
+/// @struct BenchCoroutineState
+///
+/// @brief The state shared by the coroutines of the comutex and cocondition
+/// benchmarks.
+///
+/// @param comutex The comutex that is handed off.
+/// @param cocondition The cocondition that is signaled.
+/// @param releasedAt The time the last holder released the comutex or the
+///   time the cocondition was signaled.  0 if there was no release yet.
+/// @param signaled Whether or not the cocondition's predicate is true.
+/// @param done Whether or not the coroutines should return.
+/// @param histogram The handoff latencies.
+typedef struct BenchCoroutineState {
+  Comutex comutex;
+  Cocondition cocondition;
+  i64 releasedAt;
+  bool signaled;
+  bool done;
+  BenchHistogram *histogram;
+} BenchCoroutineState;
+
+/// @fn static void* benchYieldLoop(void *arg)
+///
+/// @brief Coroutine that yields back to its caller every time it is resumed
+/// until it is resumed with a non-NULL argument.
+///
+/// @param arg Ignored.
+///
+/// @return Returns NULL.
+static void* benchYieldLoop(void *arg) {
+  while (arg == NULL) {
+    arg = coroutineYield(NULL);
+  }
+  return NULL;
+}
+
+/// @fn static void* benchComutexHandoff(void *arg)
+///
+/// @brief Coroutine that takes the comutex, yields while holding it, and then
+/// releases it.  Run two of these and the comutex passes back and forth
+/// between them.  The time from one releasing the comutex to the other one
+/// getting it is recorded.
+///
+/// @param arg A pointer to the BenchCoroutineState.
+///
+/// @return Returns NULL.
+static void* benchComutexHandoff(void *arg) {
+  BenchCoroutineState *state = (BenchCoroutineState*) arg;
+  while (!state->done) {
+    comutexLock(&state->comutex);
+    if (state->releasedAt != 0) {
+      benchHistogramRecord(state->histogram, benchNow() - state->releasedAt);
+      state->releasedAt = 0;
+    }
+    coroutineYield(NULL);
+    state->releasedAt = benchNow();
+    comutexUnlock(&state->comutex);
+    coroutineYield(NULL);
+  }
+  return NULL;
+}
+
+/// @fn static void* benchCoconditionWaiter(void *arg)
+///
+/// @brief Coroutine that waits on the cocondition and records the time from
+/// the signal to when it wakes up.
+///
+/// @param arg A pointer to the BenchCoroutineState.
+///
+/// @return Returns NULL.
+static void* benchCoconditionWaiter(void *arg) {
+  BenchCoroutineState *state = (BenchCoroutineState*) arg;
+  comutexLock(&state->comutex);
+  while (!state->done) {
+    while ((!state->signaled) && (!state->done)) {
+      coconditionWait(&state->cocondition, &state->comutex);
+    }
+    if (state->signaled) {
+      benchHistogramRecord(state->histogram, benchNow() - state->releasedAt);
+      state->signaled = false;
+    }
+  }
+  comutexUnlock(&state->comutex);
+  return NULL;
+}
+
+/// @fn static void* benchCoconditionSignaler(void *arg)
+///
+/// @brief Coroutine that signals the cocondition each time it is resumed.
+///
+/// @param arg A pointer to the BenchCoroutineState.
+///
+/// @return Returns NULL.
+static void* benchCoconditionSignaler(void *arg) {
+  BenchCoroutineState *state = (BenchCoroutineState*) arg;
+  while (!state->done) {
+    comutexLock(&state->comutex);
+    state->signaled = true;
+    state->releasedAt = benchNow();
+    coconditionSignal(&state->cocondition);
+    comutexUnlock(&state->comutex);
+    coroutineYield(NULL);
+  }
+  return NULL;
+}
+
+/// @fn static bool benchRunCoroutinePair(BenchOptions *options, const char *variant, CoroutineFunction first, CoroutineFunction second)
+///
+/// @brief Run two coroutines that share a BenchCoroutineState, resuming them
+/// alternately, and report the handoff latencies they record.
+///
+/// @param options The BenchOptions the program is running with.
+/// @param variant The name of the benchmark variant.
+/// @param first The function of the first coroutine.
+/// @param second The function of the second coroutine.
+///
+/// @return Returns true on success, false on failure.
+static bool benchRunCoroutinePair(BenchOptions *options, const char *variant,
+  CoroutineFunction first, CoroutineFunction second
+) {
+  BenchHistogram *histogram
+    = (BenchHistogram*) malloc(sizeof(BenchHistogram));
+  BenchCoroutineState *state
+    = (BenchCoroutineState*) calloc(1, sizeof(BenchCoroutineState));
+  if ((histogram == NULL) || (state == NULL)) {
+    free(histogram);
+    free(state);
+    return false;
+  }
+  benchHistogramInit(histogram);
+  state->histogram = histogram;
+  comutexInit(&state->comutex, comutexPlain);
+  coconditionInit(&state->cocondition);
+
+  bool returnValue = false;
+  Coroutine *coroutines[2] = { NULL, NULL };
+  if ((coroutineCreate(&coroutines[0], first, state) != coroutineSuccess)
+    || (coroutineCreate(&coroutines[1], second, state) != coroutineSuccess)
+  ) {
+    fprintf(stderr, "Could not create the %s coroutines.\n", variant);
+  } else {
+    i64 start = benchNow();
+    while (histogram->count < options->iterations) {
+      coroutineResume(coroutines[0], NULL);
+      coroutineResume(coroutines[1], NULL);
+    }
+    i64 elapsed = benchNow() - start;
+
+    state->done = true;
+    coconditionBroadcast(&state->cocondition);
+    for (int ii = 0; ii < 4; ii++) {
+      for (int jj = 0; jj < 2; jj++) {
+        if (coroutineResumable(coroutines[jj])
+          && (!coroutineFinished(coroutines[jj]))
+        ) {
+          coroutineResume(coroutines[jj], NULL);
+        }
+      }
+    }
+
+    benchReport(options, "coroutine", variant, 1, histogram, elapsed);
+    returnValue = true;
+  }
+
+  coconditionDestroy(&state->cocondition);
+  comutexDestroy(&state->comutex);
+  free(state);
+  free(histogram);
+  return returnValue;
+}
+
+/// @fn static bool benchCoroutines(BenchOptions *options)
+///
+/// @brief Run the coroutine benchmarks:  resume/yield round trips, comutex
+/// handoffs and cocondition signal-to-wake latency.
+///
+/// @param options The BenchOptions the program is running with.
+///
+/// @return Returns true on success, false on failure.
+static bool benchCoroutines(BenchOptions *options) {
+  // The coroutine this thread runs as.  It has to outlive every coroutine the
+  // benchmarks create.
+  static Coroutine mainCoroutine;
+  if (coroutineConfig(&mainCoroutine, COROUTINE_DEFAULT_STACK_SIZE,
+    NULL, NULL, NULL) != coroutineSuccess
+  ) {
+    fprintf(stderr, "Could not configure coroutines.\n");
+    return false;
+  }
+
+  BenchHistogram *histogram
+    = (BenchHistogram*) malloc(sizeof(BenchHistogram));
+  if (histogram == NULL) {
+    return false;
+  }
+  benchHistogramInit(histogram);
+
+  Coroutine *coroutine = NULL;
+  if (coroutineCreate(&coroutine, benchYieldLoop, NULL) != coroutineSuccess) {
+    fprintf(stderr, "Could not create the resume/yield coroutine.\n");
+    free(histogram);
+    return false;
+  }
+  i64 start = benchNow();
+  for (u64 ii = 0; ii < options->iterations; ii++) {
+    i64 before = benchNow();
+    coroutineResume(coroutine, NULL);
+    benchHistogramRecord(histogram, benchNow() - before);
+  }
+  i64 elapsed = benchNow() - start;
+  coroutineResume(coroutine, (void*) coroutine);
+  benchReport(options, "coroutine", "resumeYield", 1, histogram, elapsed);
+  free(histogram);
+
+  return benchRunCoroutinePair(options, "comutexHandoff",
+      benchComutexHandoff, benchComutexHandoff)
+    && benchRunCoroutinePair(options, "coconditionSignal",
+      benchCoconditionWaiter, benchCoconditionSignaler);
+}
+
+// Thread messages
+
+/// @struct BenchProducer
+///
+/// @brief The arguments of a thread message producer.
+///
+/// @param consumer The thread to send messages to.
+/// @param numMessages The number of messages to send.
+typedef struct BenchProducer {
+  thrd_t consumer;
+  u64 numMessages;
+} BenchProducer;
+
+/// @struct BenchConsumer
+///
+/// @brief The arguments and results of a thread message consumer.
+///
+/// @param numProducers The number of producer threads to start.
+/// @param numMessages The total number of messages the producers send.
+/// @param histogram The push-to-wait latencies.
+/// @param elapsed The wall clock time from starting the producers to receiving
+///   the last message, in nanoseconds.
+typedef struct BenchConsumer {
+  u64 numProducers;
+  u64 numMessages;
+  BenchHistogram *histogram;
+  i64 elapsed;
+} BenchConsumer;
+
+/// @fn static int benchProducerMain(void *arg)
+///
+/// @brief Thread function that sends messages stamped with the time they were
+/// pushed.
+///
+/// @param arg A pointer to the thread's BenchProducer.
+///
+/// @return Returns 0 on success, 1 if a message could not be sent.
+static int benchProducerMain(void *arg) {
+  BenchProducer *producer = (BenchProducer*) arg;
+  for (u64 ii = 0; ii < producer->numMessages; ii++) {
+    thrd_msg_t *msg = thrd_msg_create();
+    if ((msg == NULL)
+      || (thrd_msg_init(msg, 0, NULL, 0, false) != thrd_success)
+    ) {
+      msg = thrd_msg_destroy(msg);
+      return 1;
+    }
+    msg->data = (void*) (intptr_t) benchNow();
+    if (thrd_msg_q_push(producer->consumer, msg) != thrd_success) {
+      msg = thrd_msg_destroy(msg);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/// @fn static int benchConsumerMain(void *arg)
+///
+/// @brief Thread function that starts the producers and records the time from
+/// each push until thrd_msg_q_wait returns the message.  This runs in its own
+/// thread because only threads started with thrd_create have a message queue.
+///
+/// @param arg A pointer to the BenchConsumer.
+///
+/// @return Returns 0 on success, 1 on failure.
+static int benchConsumerMain(void *arg) {
+  BenchConsumer *consumer = (BenchConsumer*) arg;
+  u64 numProducers = consumer->numProducers;
+  BenchProducer *producers
+    = (BenchProducer*) calloc(numProducers, sizeof(BenchProducer));
+  thrd_t *threads = (thrd_t*) calloc(numProducers, sizeof(thrd_t));
+  if ((producers == NULL) || (threads == NULL)) {
+    free(producers);
+    free(threads);
+    return 1;
+  }
+
+  int returnValue = 0;
+  u64 numMessages = 0;
+  u64 numStarted = 0;
+  i64 start = benchNow();
+  for (u64 ii = 0; ii < numProducers; ii++) {
+    producers[ii].consumer = thrd_current();
+    producers[ii].numMessages
+      = ((consumer->numMessages * (ii + 1)) / numProducers)
+      - ((consumer->numMessages * ii) / numProducers);
+    if (thrd_create(&threads[ii], benchProducerMain, &producers[ii])
+      != thrd_success
+    ) {
+      fprintf(stderr, "Could not start producer %llu.\n", llu(ii));
+      returnValue = 1;
+      break;
+    }
+    numMessages += producers[ii].numMessages;
+    numStarted++;
+  }
+
+  for (u64 ii = 0; ii < numMessages; ii++) {
+    thrd_msg_t *msg = thrd_msg_q_wait(NULL);
+    if (msg == NULL) {
+      fprintf(stderr, "thrd_msg_q_wait failed.\n");
+      returnValue = 1;
+      break;
+    }
+    benchHistogramRecord(consumer->histogram,
+      benchNow() - ((i64) (intptr_t) msg->data));
+    msg = thrd_msg_destroy(msg);
+  }
+  consumer->elapsed = benchNow() - start;
+
+  for (u64 ii = 0; ii < numStarted; ii++) {
+    int result = 0;
+    thrd_join(threads[ii], &result);
+    if (result != 0) {
+      returnValue = 1;
+    }
+  }
+
+  free(producers);
+  free(threads);
+  return returnValue;
+}
+
+/// @fn static bool benchThreadMessages(BenchOptions *options)
+///
+/// @brief Run the thread message benchmark.  For each producer count, that
+/// many threads push messages to a consumer thread, which records the time
+/// from each push until thrd_msg_q_wait returns the message.
+///
+/// @param options The BenchOptions the program is running with.
+///
+/// @return Returns true on success, false on failure.
+static bool benchThreadMessages(BenchOptions *options) {
+  BenchHistogram *histogram
+    = (BenchHistogram*) malloc(sizeof(BenchHistogram));
+  if (histogram == NULL) {
+    return false;
+  }
+
+  bool returnValue = true;
+  for (u32 pp = 0; (pp < options->numProducerCounts) && (returnValue); pp++) {
+    benchHistogramInit(histogram);
+    BenchConsumer consumer;
+    ZEROINIT(consumer);
+    consumer.numProducers = options->producers[pp];
+    consumer.numMessages = options->iterations;
+    consumer.histogram = histogram;
+
+    thrd_t thread;
+    int result = 1;
+    if (thrd_create(&thread, benchConsumerMain, &consumer) != thrd_success) {
+      fprintf(stderr, "Could not start the consumer.\n");
+    } else {
+      thrd_join(thread, &result);
+    }
+    if (result != 0) {
+      returnValue = false;
+    } else {
+      benchReport(options, "thrdMsg", "pushToWait", consumer.numProducers,
+        histogram, consumer.elapsed);
+    }
+  }
+
+  free(histogram);
+  return returnValue;
+}
+
+// Logging
+
+/// @struct BenchLogger
+///
+/// @brief The arguments of a logging thread.
+///
+/// @param numMessages The number of messages to log.
+/// @param histogram The latencies of the thread's printLog calls.
+typedef struct BenchLogger {
+  u64 numMessages;
+  BenchHistogram histogram;
+} BenchLogger;
+
+/// @fn static int benchLoggerMain(void *arg)
+///
+/// @brief Thread function that logs messages and records how long each
+/// printLog call takes.
+///
+/// @param arg A pointer to the thread's BenchLogger.
+///
+/// @return Returns 0.
+static int benchLoggerMain(void *arg) {
+  BenchLogger *logger = (BenchLogger*) arg;
+  for (u64 ii = 0; ii < logger->numMessages; ii++) {
+    i64 before = benchNow();
+    printLog(INFO, "Benchmark message %llu of %llu with some payload text.\n",
+      llu(ii), llu(logger->numMessages));
+    benchHistogramRecord(&logger->histogram, benchNow() - before);
+  }
+  return 0;
+}
+
+/// @fn static bool benchLogging(BenchOptions *options)
+///
+/// @brief Run the logging benchmark.  For each thread count and for both text
+/// and binary mode, that many threads call printLog while the logging thread
+/// writes the messages out.  The latency of each call is recorded and the
+/// throughput counts the time to flush everything to the log file.
+///
+/// @param options The BenchOptions the program is running with.
+///
+/// @return Returns true on success, false on failure.
+static bool benchLogging(BenchOptions *options) {
+  if (loggingStart(options->logFile) != 0) {
+    fprintf(stderr, "Could not start logging to \"%s\".\n", options->logFile);
+    return false;
+  }
+  // Keep everything in one file for the whole run.
+  loggingSetRolloverPolicy(0, 0, false, 0);
+
+  BenchHistogram *histogram
+    = (BenchHistogram*) malloc(sizeof(BenchHistogram));
+  if (histogram == NULL) {
+    loggingStop();
+    remove(options->logFile);
+    return false;
+  }
+
+  bool returnValue = true;
+  for (int binaryMode = 0; (binaryMode < 2) && (returnValue); binaryMode++) {
+    loggingSetBinaryMode(binaryMode != 0);
+    const char *variant = (binaryMode != 0) ? "printLogBinary" : "printLogText";
+    for (u32 tt = 0; tt < options->numLogThreadCounts; tt++) {
+      u64 numThreads = options->logThreads[tt];
+      BenchLogger *loggers
+        = (BenchLogger*) calloc(numThreads, sizeof(BenchLogger));
+      thrd_t *threads = (thrd_t*) calloc(numThreads, sizeof(thrd_t));
+      if ((loggers == NULL) || (threads == NULL)) {
+        free(loggers);
+        free(threads);
+        returnValue = false;
+        break;
+      }
+      benchHistogramInit(histogram);
+
+      u64 numStarted = 0;
+      i64 start = benchNow();
+      for (u64 ii = 0; ii < numThreads; ii++) {
+        loggers[ii].numMessages
+          = ((options->iterations * (ii + 1)) / numThreads)
+          - ((options->iterations * ii) / numThreads);
+        benchHistogramInit(&loggers[ii].histogram);
+        if (thrd_create(&threads[ii], benchLoggerMain, &loggers[ii])
+          != thrd_success
+        ) {
+          fprintf(stderr, "Could not start logging thread %llu.\n", llu(ii));
+          returnValue = false;
+          break;
+        }
+        numStarted++;
+      }
+      for (u64 ii = 0; ii < numStarted; ii++) {
+        thrd_join(threads[ii], NULL);
+        benchHistogramMerge(histogram, &loggers[ii].histogram);
+      }
+      loggingFlush();
+      i64 elapsed = benchNow() - start;
+
+      if (returnValue) {
+        benchReport(options, "logging", variant, numThreads, histogram,
+          elapsed);
+      }
+      free(loggers);
+      free(threads);
+      if (!returnValue) {
+        break;
+      }
+    }
+  }
+  loggingSetBinaryMode(false);
+
+  free(histogram);
+  loggingStop();
+  remove(options->logFile);
+  return returnValue;
+}
+
+/// @fn static bool benchSelected(const char *list, const char *name)
+///
+/// @brief Determine whether a name is in a comma-separated list.
+///
+/// @param list The comma-separated list, or NULL to select every name.
+/// @param name The name to look for.
+///
+/// @return Returns true if the name is selected, false if not.
+static bool benchSelected(const char *list, const char *name) {
+  if (list == NULL) {
+    return true;
+  }
+
+  size_t nameLength = strlen(name);
+  const char *cursor = list;
+  while (*cursor != '\0') {
+    const char *comma = strchr(cursor, ',');
+    size_t length = (comma != NULL)
+      ? (size_t) (comma - cursor) : strlen(cursor);
+    if ((length == nameLength) && (strncmp(cursor, name, length) == 0)) {
+      return true;
+    }
+    if (comma == NULL) {
+      break;
+    }
+    cursor = comma + 1;
+  }
+
+  return false;
+}
+
+/// @fn static u32 benchParseList(const char *list, u64 *values)
+///
+/// @brief Parse a comma-separated list of positive integers.
+///
+/// @param list The list to parse.
+/// @param values The array of BENCH_MAX_VALUES elements to parse into.
+///
+/// @return Returns the number of values parsed, 0 if the list was invalid.
+static u32 benchParseList(const char *list, u64 *values) {
+  u32 numValues = 0;
+  const char *cursor = list;
+  while (numValues < BENCH_MAX_VALUES) {
+    char *end = NULL;
+    unsigned long long value = strtoull(cursor, &end, 10);
+    if ((end == cursor) || (value == 0)) {
+      return 0;
+    }
+    values[numValues++] = (u64) value;
+    if (*end == '\0') {
+      return numValues;
+    } else if (*end != ',') {
+      return 0;
+    }
+    cursor = end + 1;
+  }
+
+  return 0;
+}
+
+/// @fn static void benchUsage(const char *programName)
+///
+/// @brief Print the command line options.
+///
+/// @param programName The name the program was run as.
+static void benchUsage(const char *programName) {
+  fprintf(stderr,
+    "Usage:  %s [options]\n"
+    "  -n <count>       Samples per benchmark (default %d)\n"
+    "  -p <producers>   Comma-separated thrd_msg producer counts\n"
+    "                   (default %s)\n"
+    "  -t <threads>     Comma-separated logging thread counts (default %s)\n"
+    "  -b <benchmarks>  Comma-separated benchmarks to run:  coroutine,\n"
+    "                   thrdMsg, logging (default all)\n"
+    "  -l <logFile>     File the logging benchmark writes (default %s)\n"
+    "  -H <file>        Write every non-empty histogram bucket to a CSV file\n"
+    "  -j               Print JSON lines instead of CSV\n",
+    programName, BENCH_DEFAULT_ITERATIONS, BENCH_DEFAULT_PRODUCERS,
+    BENCH_DEFAULT_LOG_THREADS, BENCH_DEFAULT_LOG_FILE);
+}
+
+/// @fn int main(int argc, char **argv)
+///
+/// @brief Run the benchmarks selected on the command line and print one line
+/// per benchmark with the latency percentiles and throughput.
+///
+/// @param argc The number of command line arguments.
+/// @param argv The command line arguments.
+///
+/// @return Returns 0 on success, 1 on failure.
+int main(int argc, char **argv) {
+  BenchOptions options;
+  ZEROINIT(options);
+  options.iterations = BENCH_DEFAULT_ITERATIONS;
+  options.numProducerCounts
+    = benchParseList(BENCH_DEFAULT_PRODUCERS, options.producers);
+  options.numLogThreadCounts
+    = benchParseList(BENCH_DEFAULT_LOG_THREADS, options.logThreads);
+  options.logFile = BENCH_DEFAULT_LOG_FILE;
+
+  for (int ii = 1; ii < argc; ii++) {
+    const char *argument = argv[ii];
+    const char *value = (ii + 1 < argc) ? argv[ii + 1] : NULL;
+    if (strcmp(argument, "-j") == 0) {
+      options.json = true;
+      continue;
+    } else if ((value == NULL) || (strlen(argument) != 2)
+      || (argument[0] != '-')
+    ) {
+      benchUsage(argv[0]);
+      return 1;
+    }
+    ii++;
+
+    switch (argument[1]) {
+      case 'n':
+        options.iterations = (u64) strtoull(value, NULL, 10);
+        break;
+      case 'p':
+        options.numProducerCounts = benchParseList(value, options.producers);
+        break;
+      case 't':
+        options.numLogThreadCounts = benchParseList(value, options.logThreads);
+        break;
+      case 'b':
+        options.benchmarks = value;
+        break;
+      case 'l':
+        options.logFile = value;
+        break;
+      case 'H':
+        options.histogramFile = value;
+        break;
+      default:
+        benchUsage(argv[0]);
+        return 1;
+    }
+  }
+  if ((options.iterations == 0) || (options.numProducerCounts == 0)
+    || (options.numLogThreadCounts == 0)
+  ) {
+    benchUsage(argv[0]);
+    return 1;
+  }
+
+  if (options.histogramFile != NULL) {
+    options.histogramStream = fopen(options.histogramFile, "w");
+    if (options.histogramStream == NULL) {
+      fprintf(stderr, "Could not open \"%s\".\n", options.histogramFile);
+      return 1;
+    }
+    fprintf(options.histogramStream,
+      "benchmark,variant,threads,lowNs,highNs,count\n");
+  }
+  if (!options.json) {
+    printf("benchmark,variant,threads,samples,minNs,meanNs,p50Ns,p90Ns,"
+      "p99Ns,p999Ns,maxNs,opsPerSec\n");
+  }
+
+  int returnValue = 0;
+  if ((benchSelected(options.benchmarks, "coroutine"))
+    && (!benchCoroutines(&options))
+  ) {
+    returnValue = 1;
+  }
+  if ((benchSelected(options.benchmarks, "thrdMsg"))
+    && (!benchThreadMessages(&options))
+  ) {
+    returnValue = 1;
+  }
+  if ((benchSelected(options.benchmarks, "logging"))
+    && (!benchLogging(&options))
+  ) {
+    returnValue = 1;
+  }
+
+  if (options.histogramStream != NULL) {
+    fclose(options.histogramStream);
+  }
+  return returnValue;
+}
+
@@ -0,0 +1,1472 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              ContainerBenchmark.c
+///
+/// @brief             Microbenchmarks for the container libraries.
+///
+/// @details           Times insert, lookup, iterate, copy, toBlob, fromBlob,
+///                    toJson, fromJson and remove on each container through
+///                    the type-safe APIs for several key types, sizes and
+///                    thread counts.  Keys are generated from a fixed seed so
+///                    that runs are repeatable.  Each measurement is printed
+///                    as one line of CSV (the default) or JSON so that runs
+///                    can be compared by a script.  Built and run by
+///                    `make bench`.  Run with -h for the options.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "CThreads.h"
+#include "HashTable.h"
+#include "List.h"
+#include "Queue.h"
+#include "RadixTree.h"
+#include "RedBlackTree.h"
+#include "Stack.h"
+#include "StringLib.h"
+#include "Vector.h"
+
+#define BENCH_DEFAULT_SIZES "1000,10000,100000"
+#define BENCH_DEFAULT_THREADS "1,2,4"
+#define BENCH_DEFAULT_REPETITIONS 3
+#define BENCH_DEFAULT_SEED 0x00c0ffee5eed1234ULL
+
+/// @def BENCH_MAX_VALUES
+///
+/// @brief The maximum number of values that can be given in one of the
+/// comma-separated command line lists.
+#define BENCH_MAX_VALUES 16
+
+/// @def BENCH_MAX_LINEAR_OPERATIONS
+///
+/// @brief The number of lookups or removes done on containers where each one
+/// takes time proportional to the size of the container.  Doing one per
+/// element would make the large sizes take quadratic time without saying
+/// anything more about the container.
+#define BENCH_MAX_LINEAR_OPERATIONS 100
+
+/// @def BENCH_MAX_RADIX_TREE_SIZE
+///
+/// @brief The largest size the RadixTree made of full RadixTreeNodes is run
+/// with.  Every node of that tree holds an entire array of children, so random
+/// keys use several kilobytes each.
+#define BENCH_MAX_RADIX_TREE_SIZE 1000
+
+/// @enum BenchKeyType
+///
+/// @brief The kinds of keys (or values, for the containers without keys) that
+/// the benchmarks are run with.
+typedef enum BenchKeyType {
+  BENCH_KEY_I64,
+  BENCH_KEY_DOUBLE,
+  BENCH_KEY_STRING,
+  NUM_BENCH_KEY_TYPES
+} BenchKeyType;
+
+static const char *benchKeyTypeNames[NUM_BENCH_KEY_TYPES] = {
+  "i64",
+  "double",
+  "string",
+};
+
+/// @enum BenchOperation
+///
+/// @brief The operations that are timed, in the order they are run.
+typedef enum BenchOperation {
+  BENCH_INSERT,
+  BENCH_LOOKUP,
+  BENCH_ITERATE,
+  BENCH_COPY,
+  BENCH_TO_BLOB,
+  BENCH_FROM_BLOB,
+  BENCH_TO_JSON,
+  BENCH_FROM_JSON,
+  BENCH_REMOVE,
+  NUM_BENCH_OPERATIONS
+} BenchOperation;
+
+static const char *benchOperationNames[NUM_BENCH_OPERATIONS] = {
+  "insert",
+  "lookup",
+  "iterate",
+  "copy",
+  "toBlob",
+  "fromBlob",
+  "toJson",
+  "fromJson",
+  "remove",
+};
+
+/// @struct BenchKeys
+///
+/// @brief The keys a benchmark is run with.
+///
+/// @param keyType The BenchKeyType of the keys.
+/// @param size The number of keys.
+/// @param i64Keys The keys when keyType is BENCH_KEY_I64.
+/// @param doubleKeys The keys when keyType is BENCH_KEY_DOUBLE.
+/// @param stringKeys The keys when keyType is BENCH_KEY_STRING.
+/// @param order A random permutation of the key indexes that lookups and
+///   removes are done in.
+typedef struct BenchKeys {
+  BenchKeyType keyType;
+  u64 size;
+  i64 *i64Keys;
+  double *doubleKeys;
+  char **stringKeys;
+  u64 *order;
+} BenchKeys;
+
+/// @typedef BenchPhaseFunction
+///
+/// @brief Function that does one operation for each of the keys with indexes
+/// in [begin, end) and returns the number that succeeded.
+typedef u64 (*BenchPhaseFunction)(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end);
+
+/// @struct BenchContainer
+///
+/// @brief The operations of one container.  Operations the container does not
+/// have are NULL and are not reported.
+///
+/// @param name The name of the container as it is reported.
+/// @param concurrentInsert Whether or not inserts are run on all the threads.
+///   Lookups always are.
+/// @param parallelTraversal Whether or not iterate and copy use the threads.
+/// @param linearLookup Whether or not a lookup takes linear time.
+/// @param linearRemove Whether or not a remove takes linear time.
+/// @param maxSize The largest size to run the container with, 0 for no limit.
+/// @param create Creates an empty container for a key type.
+/// @param insert Adds the keys to the container.
+/// @param lookup Looks up keys in the container.
+/// @param remove Removes keys from the container.
+/// @param iterate Visits every element and returns the number visited.
+/// @param copy Makes a copy of the container.
+/// @param toBlob Serializes the container to a blob.
+/// @param fromBlob Creates a container from a blob.
+/// @param toJson Serializes the container to JSON.
+/// @param fromJson Creates a container from JSON.
+/// @param destroy Destroys a container made by any of the functions above.
+typedef struct BenchContainer {
+  const char *name;
+  bool concurrentInsert;
+  bool parallelTraversal;
+  bool linearLookup;
+  bool linearRemove;
+  u64 maxSize;
+  void* (*create)(BenchKeyType keyType);
+  BenchPhaseFunction insert;
+  BenchPhaseFunction lookup;
+  BenchPhaseFunction remove;
+  u64 (*iterate)(void *dataStructure, u32 numThreads);
+  void* (*copy)(void *dataStructure, u32 numThreads);
+  Bytes (*toBlob)(void *dataStructure);
+  void* (*fromBlob)(Bytes blob);
+  Bytes (*toJson)(void *dataStructure);
+  void* (*fromJson)(const char *json);
+  void* (*destroy)(void *dataStructure);
+} BenchContainer;
+
+/// @struct BenchWorker
+///
+/// @brief The share of a phase run by one thread.
+///
+/// @param function The function that does the phase.
+/// @param dataStructure The container the phase is run on.
+/// @param keys The keys the phase is run with.
+/// @param begin The first key index of this thread's share.
+/// @param end One past the last key index of this thread's share.
+/// @param result The value function returned.
+typedef struct BenchWorker {
+  BenchPhaseFunction function;
+  void *dataStructure;
+  const BenchKeys *keys;
+  u64 begin;
+  u64 end;
+  u64 result;
+} BenchWorker;
+
+/// @struct BenchOptions
+///
+/// @brief The settings given on the command line.
+///
+/// @param sizes The numbers of elements to run with.
+/// @param numSizes The number of values in sizes.
+/// @param threads The numbers of threads to run with.
+/// @param numThreadCounts The number of values in threads.
+/// @param repetitions The number of times each measurement is repeated.
+/// @param seed The seed the keys are generated from.
+/// @param json Whether to print JSON lines instead of CSV.
+/// @param containers The comma-separated names of the containers to run, or
+///   NULL for all of them.
+/// @param keyTypes The comma-separated names of the key types to run, or NULL
+///   for all of them.
+typedef struct BenchOptions {
+  u64 sizes[BENCH_MAX_VALUES];
+  u32 numSizes;
+  u64 threads[BENCH_MAX_VALUES];
+  u32 numThreadCounts;
+  u32 repetitions;
+  u64 seed;
+  bool json;
+  const char *containers;
+  const char *keyTypes;
+} BenchOptions;
+
+/// @fn static i64 benchNow(void)
+///
+/// @brief Get the current time of a monotonic clock.
+///
+/// @return Returns the current time in nanoseconds.
+static i64 benchNow(void) {
+  struct timespec now;
+#ifdef CLOCK_MONOTONIC
+  clock_gettime(CLOCK_MONOTONIC, &now);
+#else
+  timespec_get(&now, TIME_UTC);
+#endif
+  return (((i64) now.tv_sec) * ((i64) 1000000000)) + ((i64) now.tv_nsec);
+}
+
+/// @fn static u64 benchMix(u64 value)
+///
+/// @brief Scramble the bits of a value.  The mapping is one to one, so
+/// distinct inputs always give distinct outputs.
+///
+/// @param value The value to scramble.
+///
+/// @return Returns the scrambled value.
+static u64 benchMix(u64 value) {
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+  return value ^ (value >> 31);
+}
+
+/// @fn static void benchShuffle(u64 *indexes, u64 size, u64 *state)
+///
+/// @brief Fill an array with a random permutation of [0, size).
+///
+/// @param indexes The array to fill.
+/// @param size The number of elements in indexes.
+/// @param state The state of the random number generator.
+static void benchShuffle(u64 *indexes, u64 size, u64 *state) {
+  for (u64 ii = 0; ii < size; ii++) {
+    indexes[ii] = ii;
+  }
+  for (u64 ii = size; ii > 1; ii--) {
+    *state += 0x9e3779b97f4a7c15ULL;
+    u64 jj = benchMix(*state) % ii;
+    u64 swap = indexes[ii - 1];
+    indexes[ii - 1] = indexes[jj];
+    indexes[jj] = swap;
+  }
+}
+
+/// @fn static BenchKeys* benchKeysDestroy(BenchKeys *keys)
+///
+/// @brief Free a BenchKeys and everything it holds.
+///
+/// @param keys The BenchKeys to free.
+///
+/// @return Returns NULL.
+static BenchKeys* benchKeysDestroy(BenchKeys *keys) {
+  if (keys == NULL) {
+    return NULL;
+  }
+
+  if (keys->stringKeys != NULL) {
+    for (u64 ii = 0; ii < keys->size; ii++) {
+      free(keys->stringKeys[ii]);
+    }
+  }
+  free(keys->stringKeys);
+  free(keys->doubleKeys);
+  free(keys->i64Keys);
+  free(keys->order);
+  free(keys);
+
+  return NULL;
+}
+
+/// @fn static BenchKeys* benchKeysCreate(BenchKeyType keyType, u64 size, u64 seed)
+///
+/// @brief Generate a set of distinct keys in a random order.  The same
+/// arguments always generate the same keys.
+///
+/// @param keyType The BenchKeyType of the keys to generate.
+/// @param size The number of keys to generate.
+/// @param seed The seed of the random number generator.
+///
+/// @return Returns a newly-allocated BenchKeys on success, NULL on failure.
+static BenchKeys* benchKeysCreate(BenchKeyType keyType, u64 size, u64 seed) {
+  BenchKeys *keys = (BenchKeys*) calloc(1, sizeof(BenchKeys));
+  if (keys == NULL) {
+    return NULL;
+  }
+  keys->keyType = keyType;
+  keys->size = size;
+
+  u64 state = seed;
+  keys->order = (u64*) malloc(size * sizeof(u64));
+  if (keys->order == NULL) {
+    return benchKeysDestroy(keys);
+  }
+
+  if (keyType == BENCH_KEY_I64) {
+    keys->i64Keys = (i64*) malloc(size * sizeof(i64));
+    if (keys->i64Keys == NULL) {
+      return benchKeysDestroy(keys);
+    }
+    for (u64 ii = 0; ii < size; ii++) {
+      keys->i64Keys[ii] = (i64) benchMix(seed + (ii * 0x9e3779b97f4a7c15ULL));
+    }
+  } else if (keyType == BENCH_KEY_DOUBLE) {
+    // Random doubles could collide, so use a shuffled range instead.
+    keys->doubleKeys = (double*) malloc(size * sizeof(double));
+    if (keys->doubleKeys == NULL) {
+      return benchKeysDestroy(keys);
+    }
+    benchShuffle(keys->order, size, &state);
+    for (u64 ii = 0; ii < size; ii++) {
+      keys->doubleKeys[ii] = ((double) keys->order[ii]) + 0.5;
+    }
+  } else {
+    keys->stringKeys = (char**) calloc(size, sizeof(char*));
+    if (keys->stringKeys == NULL) {
+      return benchKeysDestroy(keys);
+    }
+    for (u64 ii = 0; ii < size; ii++) {
+      keys->stringKeys[ii] = (char*) malloc(17);
+      if (keys->stringKeys[ii] == NULL) {
+        return benchKeysDestroy(keys);
+      }
+      snprintf(keys->stringKeys[ii], 17, "%016llx",
+        llu(benchMix(seed + (ii * 0x9e3779b97f4a7c15ULL))));
+    }
+  }
+  benchShuffle(keys->order, size, &state);
+
+  return keys;
+}
+
+/// @fn static const volatile void* benchKey(const BenchKeys *keys, u64 index)
+///
+/// @brief Get a pointer to one of the keys as the untyped APIs take it.
+///
+/// @param keys The BenchKeys to get the key from.
+/// @param index The index of the key.
+///
+/// @return Returns a pointer to the key.
+static const volatile void* benchKey(const BenchKeys *keys, u64 index) {
+  if (keys->keyType == BENCH_KEY_I64) {
+    return &keys->i64Keys[index];
+  } else if (keys->keyType == BENCH_KEY_DOUBLE) {
+    return &keys->doubleKeys[index];
+  }
+  return keys->stringKeys[index];
+}
+
+/// @fn static size_t benchKeySize(const BenchKeys *keys, u64 index)
+///
+/// @brief Get the number of bytes in one of the keys.
+///
+/// @param keys The BenchKeys to get the key from.
+/// @param index The index of the key.
+///
+/// @return Returns the size of the key in bytes.
+static size_t benchKeySize(const BenchKeys *keys, u64 index) {
+  if (keys->keyType == BENCH_KEY_I64) {
+    return sizeof(i64);
+  } else if (keys->keyType == BENCH_KEY_DOUBLE) {
+    return sizeof(double);
+  }
+  return strlen(keys->stringKeys[index]);
+}
+
+/// @fn static TypeDescriptor* benchTypeDescriptor(BenchKeyType keyType)
+///
+/// @brief Get the TypeDescriptor that containers of a key type are created
+/// with.
+///
+/// @param keyType The BenchKeyType of the keys.
+///
+/// @return Returns the TypeDescriptor for the key type.
+static TypeDescriptor* benchTypeDescriptor(BenchKeyType keyType) {
+  if (keyType == BENCH_KEY_I64) {
+    return typeI64;
+  } else if (keyType == BENCH_KEY_DOUBLE) {
+    return typeDouble;
+  }
+  return typeString;
+}
+
+/// @def BENCH_ADD
+///
+/// @brief Call one of the type-safe add functions with the key at an index in
+/// its native type, followed by any remaining arguments.  Evaluates to true if
+/// the add succeeded.
+#define BENCH_ADD(add, dataStructure, keys, index, ...) \
+  (((keys)->keyType == BENCH_KEY_I64) \
+    ? (add(dataStructure, (keys)->i64Keys[index], ##__VA_ARGS__) != NULL) \
+    : ((keys)->keyType == BENCH_KEY_DOUBLE) \
+    ? (add(dataStructure, (keys)->doubleKeys[index], ##__VA_ARGS__) != NULL) \
+    : (add(dataStructure, (const volatile char*) (keys)->stringKeys[index], \
+      ##__VA_ARGS__) != NULL))
+
+/// @fn static u64 benchCountNodes(const List *list)
+///
+/// @brief Walk the linked nodes of a List or of one of the structures that
+/// are compatible with it.
+///
+/// @param list The List to walk.
+///
+/// @return Returns the number of nodes with a value.
+static u64 benchCountNodes(const List *list) {
+  u64 count = 0;
+  for (ListNode *node = list->head; node != NULL; node = node->next) {
+    if (node->value != NULL) {
+      count++;
+    }
+  }
+  return count;
+}
+
+// List
+
+static void* benchListCreate(BenchKeyType keyType) {
+  return listCreate(benchTypeDescriptor(keyType));
+}
+
+static u64 benchListInsert(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += BENCH_ADD(listAddBack, (List*) dataStructure, keys, ii, (i64) ii);
+  }
+  return count;
+}
+
+static u64 benchListLookup(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += (listGetForward((List*) dataStructure,
+      benchKey(keys, keys->order[ii])) != NULL);
+  }
+  return count;
+}
+
+static u64 benchListRemove(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += (listRemove((List*) dataStructure,
+      benchKey(keys, keys->order[ii])) == 0);
+  }
+  return count;
+}
+
+static u64 benchListIterate(void *dataStructure, u32 numThreads) {
+  (void) numThreads;
+  return benchCountNodes((List*) dataStructure);
+}
+
+static void* benchListCopy(void *dataStructure, u32 numThreads) {
+  (void) numThreads;
+  return listCopy((List*) dataStructure);
+}
+
+static Bytes benchListToBlob(void *dataStructure) {
+  return listToBlob((List*) dataStructure);
+}
+
+static void* benchListFromBlob(Bytes blob) {
+  u64 length = bytesLength(blob);
+  return listFromBlob(blob, &length);
+}
+
+static Bytes benchListToJson(void *dataStructure) {
+  return listToJson((List*) dataStructure);
+}
+
+static void* benchListFromJson(const char *json) {
+  long long int position = 0;
+  return jsonToList(json, &position);
+}
+
+static void* benchListDestroy(void *dataStructure) {
+  return listDestroy((List*) dataStructure);
+}
+
+// Queue
+
+static void* benchQueueCreate(BenchKeyType keyType) {
+  return queueCreate(benchTypeDescriptor(keyType));
+}
+
+static u64 benchQueueInsert(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += BENCH_ADD(queuePush, (Queue*) dataStructure, keys, ii);
+  }
+  return count;
+}
+
+static u64 benchQueueRemove(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  (void) keys;
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    void *value = queuePop((Queue*) dataStructure);
+    count += (value != NULL);
+    free(value);
+  }
+  return count;
+}
+
+static u64 benchQueueIterate(void *dataStructure, u32 numThreads) {
+  (void) numThreads;
+  return benchCountNodes((List*) dataStructure);
+}
+
+static Bytes benchQueueToJson(void *dataStructure) {
+  return queueToJson((Queue*) dataStructure);
+}
+
+static void* benchQueueDestroy(void *dataStructure) {
+  return queueDestroy((Queue*) dataStructure);
+}
+
+// Stack
+
+static void* benchStackCreate(BenchKeyType keyType) {
+  return stackCreate(benchTypeDescriptor(keyType));
+}
+
+static u64 benchStackInsert(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += BENCH_ADD(stackPush, (Stack*) dataStructure, keys, ii);
+  }
+  return count;
+}
+
+static u64 benchStackRemove(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  (void) keys;
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    void *value = stackPop((Stack*) dataStructure);
+    count += (value != NULL);
+    free(value);
+  }
+  return count;
+}
+
+static u64 benchStackIterate(void *dataStructure, u32 numThreads) {
+  (void) numThreads;
+  return benchCountNodes((List*) dataStructure);
+}
+
+static Bytes benchStackToJson(void *dataStructure) {
+  return stackToJson((Stack*) dataStructure);
+}
+
+static void* benchStackDestroy(void *dataStructure) {
+  return stackDestroy((Stack*) dataStructure);
+}
+
+// Vector
+
+static void* benchVectorCreate(BenchKeyType keyType) {
+  return vectorCreate(benchTypeDescriptor(keyType));
+}
+
+static u64 benchVectorInsert(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  Vector *vector = (Vector*) dataStructure;
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    if (keys->keyType == BENCH_KEY_I64) {
+      count += (vectorSet(vector, ii, keys->i64Keys[ii]) != NULL);
+    } else if (keys->keyType == BENCH_KEY_DOUBLE) {
+      count += (vectorSet(vector, ii, keys->doubleKeys[ii]) != NULL);
+    } else {
+      count += (vectorSet(vector, ii,
+        (const volatile char*) keys->stringKeys[ii]) != NULL);
+    }
+  }
+  return count;
+}
+
+static u64 benchVectorLookup(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += (vectorGetValue((Vector*) dataStructure, keys->order[ii])
+      != NULL);
+  }
+  return count;
+}
+
+static u64 benchVectorRemove(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  // Remove from the back.  Removing from anywhere else moves everything after
+  // the index down, which vectorRemove documents as expensive.
+  (void) keys;
+  Vector *vector = (Vector*) dataStructure;
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += ((vector->size > 0)
+      && (vectorRemove(vector, vector->size - 1) == 0));
+  }
+  return count;
+}
+
+static void benchVectorVisit(VectorNode *node, void *context) {
+  (void) context;
+  volatile const void *value = node->value;
+  (void) value;
+}
+
+static u64 benchVectorIterate(void *dataStructure, u32 numThreads) {
+  Vector *vector = (Vector*) dataStructure;
+  if (vectorForEach(vector, benchVectorVisit, NULL, numThreads) != 0) {
+    return 0;
+  }
+  return vector->size;
+}
+
+static void* benchVectorCopy(void *dataStructure, u32 numThreads) {
+  return vectorCopyParallel((Vector*) dataStructure, numThreads);
+}
+
+static Bytes benchVectorToBlob(void *dataStructure) {
+  return vectorToBlob((Vector*) dataStructure);
+}
+
+static void* benchVectorFromBlob(Bytes blob) {
+  u64 length = bytesLength(blob);
+  return vectorFromBlob(blob, &length);
+}
+
+static Bytes benchVectorToJson(void *dataStructure) {
+  return vectorToJson((Vector*) dataStructure);
+}
+
+static void* benchVectorFromJson(const char *json) {
+  long long int position = 0;
+  return jsonToVector(json, &position);
+}
+
+static void* benchVectorDestroy(void *dataStructure) {
+  return vectorDestroy((Vector*) dataStructure);
+}
+
+// RedBlackTree
+
+static void* benchRbTreeCreate(BenchKeyType keyType) {
+  return rbTreeCreate(benchTypeDescriptor(keyType));
+}
+
+static u64 benchRbTreeInsert(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += BENCH_ADD(rbTreeAdd, (RedBlackTree*) dataStructure, keys, ii,
+      (i64) ii);
+  }
+  return count;
+}
+
+static u64 benchRbTreeLookup(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += (rbQuery((RedBlackTree*) dataStructure,
+      benchKey(keys, keys->order[ii])) != NULL);
+  }
+  return count;
+}
+
+static u64 benchRbTreeRemove(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += (rbTreeRemove((RedBlackTree*) dataStructure,
+      benchKey(keys, keys->order[ii])) == 0);
+  }
+  return count;
+}
+
+static u64 benchRbTreeIterate(void *dataStructure, u32 numThreads) {
+  (void) numThreads;
+  return benchCountNodes((List*) dataStructure);
+}
+
+static void* benchRbTreeCopy(void *dataStructure, u32 numThreads) {
+  (void) numThreads;
+  return rbTreeCopy((RedBlackTree*) dataStructure);
+}
+
+static Bytes benchRbTreeToBlob(void *dataStructure) {
+  return rbTreeToBlob((RedBlackTree*) dataStructure);
+}
+
+static void* benchRbTreeFromBlob(Bytes blob) {
+  u64 length = bytesLength(blob);
+  return rbTreeFromBlob(blob, &length);
+}
+
+static Bytes benchRbTreeToJson(void *dataStructure) {
+  return rbTreeToJson((RedBlackTree*) dataStructure);
+}
+
+static void* benchRbTreeFromJson(const char *json) {
+  long long int position = 0;
+  return jsonToRedBlackTree(json, &position);
+}
+
+static void* benchRbTreeDestroy(void *dataStructure) {
+  return rbTreeDestroy((RedBlackTree*) dataStructure);
+}
+
+// HashTable
+
+static void* benchHtCreate(BenchKeyType keyType) {
+  return htCreate(benchTypeDescriptor(keyType));
+}
+
+static u64 benchHtInsert(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += BENCH_ADD(htAdd, (HashTable*) dataStructure, keys, ii, (i64) ii);
+  }
+  return count;
+}
+
+static u64 benchHtLookup(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += (htGetEntry((HashTable*) dataStructure,
+      benchKey(keys, keys->order[ii])) != NULL);
+  }
+  return count;
+}
+
+static u64 benchHtRemove(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    count += (htRemoveEntry((HashTable*) dataStructure,
+      benchKey(keys, keys->order[ii])) == 0);
+  }
+  return count;
+}
+
+static u64 benchHtIterate(void *dataStructure, u32 numThreads) {
+  (void) numThreads;
+  return benchCountNodes((List*) dataStructure);
+}
+
+static void* benchHtCopy(void *dataStructure, u32 numThreads) {
+  (void) numThreads;
+  return htCopy((HashTable*) dataStructure);
+}
+
+static Bytes benchHtToBlob(void *dataStructure) {
+  return htToBlob((HashTable*) dataStructure);
+}
+
+static void* benchHtFromBlob(Bytes blob) {
+  u64 length = bytesLength(blob);
+  return htFromBlob(blob, &length);
+}
+
+static Bytes benchHtToJson(void *dataStructure) {
+  return htToJson((HashTable*) dataStructure);
+}
+
+static void* benchHtFromJson(const char *json) {
+  long long int position = 0;
+  return jsonToHashTable(json, &position);
+}
+
+static void* benchHtDestroy(void *dataStructure) {
+  return htDestroy((HashTable*) dataStructure);
+}
+
+// RadixTree
+
+static void* benchRadixTreeCreate(BenchKeyType keyType) {
+  (void) keyType;
+  return radixTreeCreate(NULL);
+}
+
+static void* benchAdaptiveRadixTreeCreate(BenchKeyType keyType) {
+  (void) keyType;
+  return radixTreeCreate(NULL, true);
+}
+
+static u64 benchRadixTreeInsert(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  // radixTreeSetValue returns the previous value, which is NULL for new keys,
+  // so there is no failure to count.
+  for (u64 ii = begin; ii < end; ii++) {
+    radixTreeSetValue((RadixTree*) dataStructure, benchKey(keys, ii),
+      benchKeySize(keys, ii), (void*) (uintptr_t) (ii + 1));
+  }
+  return end - begin;
+}
+
+static u64 benchRadixTreeLookup(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  RadixTree *tree = (RadixTree*) dataStructure;
+  u64 count = 0;
+  int64_t token = radixTreeReadBegin(tree);
+  for (u64 ii = begin; ii < end; ii++) {
+    u64 index = keys->order[ii];
+    count += (radixTreeGetValue(tree, benchKey(keys, index),
+      benchKeySize(keys, index)) != NULL);
+  }
+  radixTreeReadEnd(tree, token);
+  return count;
+}
+
+static u64 benchRadixTreeRemove(void *dataStructure, const BenchKeys *keys,
+  u64 begin, u64 end
+) {
+  u64 count = 0;
+  for (u64 ii = begin; ii < end; ii++) {
+    u64 index = keys->order[ii];
+    count += (radixTreeDeleteValue((RadixTree*) dataStructure,
+      benchKey(keys, index), benchKeySize(keys, index)) == 0);
+  }
+  return count;
+}
+
+static void* benchRadixTreeDestroy(void *dataStructure) {
+  return radixTreeDestroy((RadixTree*) dataStructure);
+}
+
+/// @var benchContainers
+///
+/// @brief The containers that are benchmarked.  Queue and Stack have no keyed
+/// lookup and no copy, blob or JSON parsing functions of their own, and the
+/// radix trees have no traversal or serialization, so those operations are not
+/// reported for them.
+static const BenchContainer benchContainers[] = {
+  {
+    "List", true, false, true, true, 0,
+    benchListCreate, benchListInsert, benchListLookup, benchListRemove,
+    benchListIterate, benchListCopy, benchListToBlob, benchListFromBlob,
+    benchListToJson, benchListFromJson, benchListDestroy,
+  },
+  {
+    "Queue", true, false, false, false, 0,
+    benchQueueCreate, benchQueueInsert, NULL, benchQueueRemove,
+    benchQueueIterate, NULL, NULL, NULL,
+    benchQueueToJson, NULL, benchQueueDestroy,
+  },
+  {
+    "Stack", true, false, false, false, 0,
+    benchStackCreate, benchStackInsert, NULL, benchStackRemove,
+    benchStackIterate, NULL, NULL, NULL,
+    benchStackToJson, NULL, benchStackDestroy,
+  },
+  {
+    // Every thread sets its own range of indexes.  vectorRemove moves every
+    // node between the index and the end of the allocated array, so even
+    // removing from the back takes linear time.
+    "Vector", true, true, false, true, 0,
+    benchVectorCreate, benchVectorInsert, benchVectorLookup, benchVectorRemove,
+    benchVectorIterate, benchVectorCopy, benchVectorToBlob, benchVectorFromBlob,
+    benchVectorToJson, benchVectorFromJson, benchVectorDestroy,
+  },
+  {
+    "RedBlackTree", true, false, false, false, 0,
+    benchRbTreeCreate, benchRbTreeInsert, benchRbTreeLookup, benchRbTreeRemove,
+    benchRbTreeIterate, benchRbTreeCopy, benchRbTreeToBlob, benchRbTreeFromBlob,
+    benchRbTreeToJson, benchRbTreeFromJson, benchRbTreeDestroy,
+  },
+  {
+    "HashTable", true, false, false, false, 0,
+    benchHtCreate, benchHtInsert, benchHtLookup, benchHtRemove,
+    benchHtIterate, benchHtCopy, benchHtToBlob, benchHtFromBlob,
+    benchHtToJson, benchHtFromJson, benchHtDestroy,
+  },
+  {
+    // Only the adaptive tree supports concurrent writers.
+    "RadixTree", false, false, false, false, BENCH_MAX_RADIX_TREE_SIZE,
+    benchRadixTreeCreate, benchRadixTreeInsert, benchRadixTreeLookup,
+    benchRadixTreeRemove,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, benchRadixTreeDestroy,
+  },
+  {
+    "AdaptiveRadixTree", true, false, false, false, 0,
+    benchAdaptiveRadixTreeCreate, benchRadixTreeInsert, benchRadixTreeLookup,
+    benchRadixTreeRemove,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, benchRadixTreeDestroy,
+  },
+};
+
+#define NUM_BENCH_CONTAINERS \
+  (sizeof(benchContainers) / sizeof(benchContainers[0]))
+
+/// @fn static int benchWorkerMain(void *arg)
+///
+/// @brief Thread function that runs one BenchWorker's share of a phase.
+///
+/// @param arg A pointer to the BenchWorker.
+///
+/// @return Returns 0.
+static int benchWorkerMain(void *arg) {
+  BenchWorker *worker = (BenchWorker*) arg;
+  worker->result = worker->function(worker->dataStructure, worker->keys,
+    worker->begin, worker->end);
+  return 0;
+}
+
+/// @fn static u64 benchRunPhase(BenchPhaseFunction function, void *dataStructure, const BenchKeys *keys, u64 count, u32 numThreads)
+///
+/// @brief Run a phase over the first count keys, split evenly across a number
+/// of threads.  The calling thread runs the first share.
+///
+/// @param function The function that does the phase.
+/// @param dataStructure The container to run the phase on.
+/// @param keys The keys to run the phase with.
+/// @param count The number of keys to run the phase with.
+/// @param numThreads The number of threads to run the phase on.
+///
+/// @return Returns the total number of operations that succeeded.
+static u64 benchRunPhase(BenchPhaseFunction function, void *dataStructure,
+  const BenchKeys *keys, u64 count, u32 numThreads
+) {
+  if (numThreads <= 1) {
+    return function(dataStructure, keys, 0, count);
+  }
+
+  BenchWorker *workers
+    = (BenchWorker*) calloc(numThreads, sizeof(BenchWorker));
+  thrd_t *threads = (thrd_t*) calloc(numThreads, sizeof(thrd_t));
+  bool *started = (bool*) calloc(numThreads, sizeof(bool));
+  if ((workers == NULL) || (threads == NULL) || (started == NULL)) {
+    free(workers);
+    free(threads);
+    free(started);
+    return 0;
+  }
+
+  for (u32 ii = 0; ii < numThreads; ii++) {
+    workers[ii].function = function;
+    workers[ii].dataStructure = dataStructure;
+    workers[ii].keys = keys;
+    workers[ii].begin = (count * ii) / numThreads;
+    workers[ii].end = (count * (ii + 1)) / numThreads;
+  }
+  for (u32 ii = 1; ii < numThreads; ii++) {
+    started[ii] = (thrd_create(&threads[ii], benchWorkerMain, &workers[ii])
+      == thrd_success);
+  }
+  benchWorkerMain(&workers[0]);
+
+  u64 result = workers[0].result;
+  for (u32 ii = 1; ii < numThreads; ii++) {
+    if (started[ii]) {
+      thrd_join(threads[ii], NULL);
+      result += workers[ii].result;
+    }
+  }
+
+  free(workers);
+  free(threads);
+  free(started);
+  return result;
+}
+
+/// @fn static bool benchRunOnce(const BenchContainer *container, const BenchKeys *keys, u32 numThreads, i64 *elapsed, u64 *numOperations)
+///
+/// @brief Run every operation of a container once.  With more than one thread
+/// only the operations that use the threads are run.
+///
+/// @param container The BenchContainer to run.
+/// @param keys The keys to run with.
+/// @param numThreads The number of threads to run with.
+/// @param elapsed The nanoseconds each operation took, or -1 for the ones that
+///   were not run.
+/// @param numOperations The number of elements each operation handled.
+///
+/// @return Returns true on success, false if an operation failed.
+static bool benchRunOnce(const BenchContainer *container,
+  const BenchKeys *keys, u32 numThreads, i64 *elapsed, u64 *numOperations
+) {
+  for (int ii = 0; ii < NUM_BENCH_OPERATIONS; ii++) {
+    elapsed[ii] = -1;
+    numOperations[ii] = 0;
+  }
+  bool singleThreaded = (numThreads <= 1);
+  u64 size = keys->size;
+  u64 lookupCount = size;
+  if ((container->linearLookup) && (lookupCount > BENCH_MAX_LINEAR_OPERATIONS)) {
+    lookupCount = BENCH_MAX_LINEAR_OPERATIONS;
+  }
+  u64 removeCount = size;
+  if ((container->linearRemove) && (removeCount > BENCH_MAX_LINEAR_OPERATIONS)) {
+    removeCount = BENCH_MAX_LINEAR_OPERATIONS;
+  }
+
+  void *dataStructure = container->create(keys->keyType);
+  if (dataStructure == NULL) {
+    fprintf(stderr, "Could not create a %s.\n", container->name);
+    return false;
+  }
+
+  bool returnValue = false;
+  i64 start = benchNow();
+  u64 count = benchRunPhase(container->insert, dataStructure, keys, size,
+    (container->concurrentInsert) ? numThreads : 1);
+  if ((singleThreaded) || (container->concurrentInsert)) {
+    elapsed[BENCH_INSERT] = benchNow() - start;
+    numOperations[BENCH_INSERT] = size;
+  }
+  if (count != size) {
+    fprintf(stderr, "%s insert:  %llu of %llu succeeded.\n",
+      container->name, llu(count), llu(size));
+    goto exit;
+  }
+
+  if (container->lookup != NULL) {
+    start = benchNow();
+    count = benchRunPhase(container->lookup, dataStructure, keys,
+      lookupCount, numThreads);
+    elapsed[BENCH_LOOKUP] = benchNow() - start;
+    numOperations[BENCH_LOOKUP] = lookupCount;
+    if (count != lookupCount) {
+      fprintf(stderr, "%s lookup:  %llu of %llu found.\n",
+        container->name, llu(count), llu(lookupCount));
+      goto exit;
+    }
+  }
+
+  if ((singleThreaded) || (container->parallelTraversal)) {
+    if (container->iterate != NULL) {
+      start = benchNow();
+      count = container->iterate(dataStructure, numThreads);
+      elapsed[BENCH_ITERATE] = benchNow() - start;
+      numOperations[BENCH_ITERATE] = size;
+      if (count != size) {
+        fprintf(stderr, "%s iterate:  visited %llu of %llu.\n",
+          container->name, llu(count), llu(size));
+        goto exit;
+      }
+    }
+
+    if (container->copy != NULL) {
+      start = benchNow();
+      void *copy = container->copy(dataStructure, numThreads);
+      elapsed[BENCH_COPY] = benchNow() - start;
+      numOperations[BENCH_COPY] = size;
+      if (copy == NULL) {
+        fprintf(stderr, "%s copy failed.\n", container->name);
+        goto exit;
+      }
+      container->destroy(copy);
+    }
+  }
+
+  if (singleThreaded) {
+    if (container->toBlob != NULL) {
+      start = benchNow();
+      Bytes blob = container->toBlob(dataStructure);
+      elapsed[BENCH_TO_BLOB] = benchNow() - start;
+      numOperations[BENCH_TO_BLOB] = size;
+      if (blob == NULL) {
+        fprintf(stderr, "%s toBlob failed.\n", container->name);
+        goto exit;
+      }
+
+      if (container->fromBlob != NULL) {
+        start = benchNow();
+        void *copy = container->fromBlob(blob);
+        elapsed[BENCH_FROM_BLOB] = benchNow() - start;
+        numOperations[BENCH_FROM_BLOB] = size;
+        if (copy == NULL) {
+          fprintf(stderr, "%s fromBlob failed.\n", container->name);
+          blob = bytesDestroy(blob);
+          goto exit;
+        }
+        container->destroy(copy);
+      }
+      blob = bytesDestroy(blob);
+    }
+
+    if (container->toJson != NULL) {
+      start = benchNow();
+      Bytes json = container->toJson(dataStructure);
+      elapsed[BENCH_TO_JSON] = benchNow() - start;
+      numOperations[BENCH_TO_JSON] = size;
+      if (json == NULL) {
+        fprintf(stderr, "%s toJson failed.\n", container->name);
+        goto exit;
+      }
+
+      if (container->fromJson != NULL) {
+        start = benchNow();
+        void *copy = container->fromJson((const char*) json);
+        elapsed[BENCH_FROM_JSON] = benchNow() - start;
+        numOperations[BENCH_FROM_JSON] = size;
+        if (copy == NULL) {
+          fprintf(stderr, "%s fromJson failed.\n", container->name);
+          json = bytesDestroy(json);
+          goto exit;
+        }
+        container->destroy(copy);
+      }
+      json = bytesDestroy(json);
+    }
+
+    if (container->remove != NULL) {
+      start = benchNow();
+      count = container->remove(dataStructure, keys, 0, removeCount);
+      elapsed[BENCH_REMOVE] = benchNow() - start;
+      numOperations[BENCH_REMOVE] = removeCount;
+      if (count != removeCount) {
+        fprintf(stderr, "%s remove:  %llu of %llu removed.\n",
+          container->name, llu(count), llu(removeCount));
+        goto exit;
+      }
+    }
+  }
+  returnValue = true;
+
+exit:
+  container->destroy(dataStructure);
+  return returnValue;
+}
+
+/// @fn static int benchCompareDoubles(const void *a, const void *b)
+///
+/// @brief qsort comparison function for doubles.
+static int benchCompareDoubles(const void *a, const void *b) {
+  double valueA = *((const double*) a);
+  double valueB = *((const double*) b);
+  return (valueA > valueB) - (valueA < valueB);
+}
+
+/// @fn static void benchReport(const BenchOptions *options, const char *container, BenchKeyType keyType, BenchOperation operation, u64 size, u32 numThreads, u64 numOperations, double *nsPerOperation)
+///
+/// @brief Print the result of one measurement.
+///
+/// @param options The BenchOptions the program is running with.
+/// @param container The name of the container that was measured.
+/// @param keyType The BenchKeyType that was measured.
+/// @param operation The BenchOperation that was measured.
+/// @param size The number of elements in the container.
+/// @param numThreads The number of threads the operation was run with.
+/// @param numOperations The number of elements the operation handled.
+/// @param nsPerOperation The nanoseconds per element of each repetition.
+///   This array is sorted by this function.
+static void benchReport(const BenchOptions *options, const char *container,
+  BenchKeyType keyType, BenchOperation operation, u64 size, u32 numThreads,
+  u64 numOperations, double *nsPerOperation
+) {
+  u32 repetitions = options->repetitions;
+  qsort(nsPerOperation, repetitions, sizeof(double), benchCompareDoubles);
+  double minimum = nsPerOperation[0];
+  double median = nsPerOperation[repetitions / 2];
+  if ((repetitions % 2) == 0) {
+    median = (median + nsPerOperation[(repetitions / 2) - 1]) / 2.0;
+  }
+
+  if (options->json) {
+    printf("{\"container\":\"%s\",\"keyType\":\"%s\",\"operation\":\"%s\","
+      "\"size\":%llu,\"threads\":%u,\"operations\":%llu,"
+      "\"repetitions\":%u,\"minNsPerOp\":%.2f,\"medianNsPerOp\":%.2f}\n",
+      container, benchKeyTypeNames[keyType], benchOperationNames[operation],
+      llu(size), numThreads, llu(numOperations), repetitions,
+      minimum, median);
+  } else {
+    printf("%s,%s,%s,%llu,%u,%llu,%u,%.2f,%.2f\n",
+      container, benchKeyTypeNames[keyType], benchOperationNames[operation],
+      llu(size), numThreads, llu(numOperations), repetitions,
+      minimum, median);
+  }
+  fflush(stdout);
+}
+
+/// @fn static bool benchSelected(const char *list, const char *name)
+///
+/// @brief Determine whether a name is in a comma-separated list.
+///
+/// @param list The comma-separated list, or NULL to select every name.
+/// @param name The name to look for.
+///
+/// @return Returns true if the name is selected, false if not.
+static bool benchSelected(const char *list, const char *name) {
+  if (list == NULL) {
+    return true;
+  }
+
+  size_t nameLength = strlen(name);
+  const char *cursor = list;
+  while (*cursor != '\0') {
+    const char *comma = strchr(cursor, ',');
+    size_t length = (comma != NULL)
+      ? (size_t) (comma - cursor) : strlen(cursor);
+    if ((length == nameLength) && (strncmp(cursor, name, length) == 0)) {
+      return true;
+    }
+    if (comma == NULL) {
+      break;
+    }
+    cursor = comma + 1;
+  }
+
+  return false;
+}
+
+/// @fn static u32 benchParseList(const char *list, u64 *values)
+///
+/// @brief Parse a comma-separated list of positive integers.
+///
+/// @param list The list to parse.
+/// @param values The array of BENCH_MAX_VALUES elements to parse into.
+///
+/// @return Returns the number of values parsed, 0 if the list was invalid.
+static u32 benchParseList(const char *list, u64 *values) {
+  u32 numValues = 0;
+  const char *cursor = list;
+  while (numValues < BENCH_MAX_VALUES) {
+    char *end = NULL;
+    unsigned long long value = strtoull(cursor, &end, 10);
+    if ((end == cursor) || (value == 0)) {
+      return 0;
+    }
+    values[numValues++] = (u64) value;
+    if (*end == '\0') {
+      return numValues;
+    } else if (*end != ',') {
+      return 0;
+    }
+    cursor = end + 1;
+  }
+
+  return 0;
+}
+
+/// @fn static void benchUsage(const char *programName)
+///
+/// @brief Print the command line options.
+///
+/// @param programName The name the program was run as.
+static void benchUsage(const char *programName) {
+  fprintf(stderr,
+    "Usage:  %s [options]\n"
+    "  -s <sizes>       Comma-separated numbers of elements (default %s)\n"
+    "  -t <threads>     Comma-separated thread counts (default %s)\n"
+    "  -r <count>       Repetitions of each measurement (default %d)\n"
+    "  -c <containers>  Comma-separated containers to run (default all)\n"
+    "  -k <keyTypes>    Comma-separated key types to run:  i64, double,\n"
+    "                   string (default all)\n"
+    "  -S <seed>        Seed for the generated keys\n"
+    "  -j               Print JSON lines instead of CSV\n",
+    programName, BENCH_DEFAULT_SIZES, BENCH_DEFAULT_THREADS,
+    BENCH_DEFAULT_REPETITIONS);
+  fprintf(stderr, "Containers: ");
+  for (size_t ii = 0; ii < NUM_BENCH_CONTAINERS; ii++) {
+    fprintf(stderr, " %s", benchContainers[ii].name);
+  }
+  fprintf(stderr, "\n");
+}
+
+/// @fn int main(int argc, char **argv)
+///
+/// @brief Run the benchmarks selected on the command line and print one line
+/// per measurement.  Each line gives the minimum and median nanoseconds per
+/// element across the repetitions.
+///
+/// @param argc The number of command line arguments.
+/// @param argv The command line arguments.
+///
+/// @return Returns 0 on success, 1 on failure.
+int main(int argc, char **argv) {
+  BenchOptions options;
+  ZEROINIT(options);
+  options.numSizes = benchParseList(BENCH_DEFAULT_SIZES, options.sizes);
+  options.numThreadCounts
+    = benchParseList(BENCH_DEFAULT_THREADS, options.threads);
+  options.repetitions = BENCH_DEFAULT_REPETITIONS;
+  options.seed = BENCH_DEFAULT_SEED;
+
+  for (int ii = 1; ii < argc; ii++) {
+    const char *argument = argv[ii];
+    const char *value = (ii + 1 < argc) ? argv[ii + 1] : NULL;
+    if (strcmp(argument, "-j") == 0) {
+      options.json = true;
+      continue;
+    } else if ((value == NULL) || (strlen(argument) != 2)
+      || (argument[0] != '-')
+    ) {
+      benchUsage(argv[0]);
+      return 1;
+    }
+    ii++;
+
+    switch (argument[1]) {
+      case 's':
+        options.numSizes = benchParseList(value, options.sizes);
+        break;
+      case 't':
+        options.numThreadCounts = benchParseList(value, options.threads);
+        break;
+      case 'r':
+        options.repetitions = (u32) strtoul(value, NULL, 10);
+        break;
+      case 'c':
+        options.containers = value;
+        break;
+      case 'k':
+        options.keyTypes = value;
+        break;
+      case 'S':
+        options.seed = (u64) strtoull(value, NULL, 0);
+        break;
+      default:
+        benchUsage(argv[0]);
+        return 1;
+    }
+  }
+  if ((options.numSizes == 0) || (options.numThreadCounts == 0)
+    || (options.repetitions == 0)
+  ) {
+    benchUsage(argv[0]);
+    return 1;
+  }
+
+  double *samples = (double*) calloc(
+    (size_t) NUM_BENCH_OPERATIONS * options.repetitions, sizeof(double));
+  if (samples == NULL) {
+    fprintf(stderr, "Could not allocate the samples.\n");
+    return 1;
+  }
+  if (!options.json) {
+    printf("container,keyType,operation,size,threads,operations,repetitions,"
+      "minNsPerOp,medianNsPerOp\n");
+  }
+
+  int returnValue = 0;
+  for (u32 sizeIndex = 0; sizeIndex < options.numSizes; sizeIndex++) {
+    u64 size = options.sizes[sizeIndex];
+    for (int keyType = 0; keyType < NUM_BENCH_KEY_TYPES; keyType++) {
+      if (!benchSelected(options.keyTypes, benchKeyTypeNames[keyType])) {
+        continue;
+      }
+      BenchKeys *keys
+        = benchKeysCreate((BenchKeyType) keyType, size, options.seed);
+      if (keys == NULL) {
+        fprintf(stderr, "Could not create %llu keys.\n", llu(size));
+        free(samples);
+        return 1;
+      }
+
+      for (size_t cc = 0; cc < NUM_BENCH_CONTAINERS; cc++) {
+        const BenchContainer *container = &benchContainers[cc];
+        if ((!benchSelected(options.containers, container->name))
+          || ((container->maxSize > 0) && (size > container->maxSize))
+        ) {
+          continue;
+        }
+
+        for (u32 tt = 0; tt < options.numThreadCounts; tt++) {
+          u32 numThreads = (u32) options.threads[tt];
+          i64 elapsed[NUM_BENCH_OPERATIONS];
+          u64 numOperations[NUM_BENCH_OPERATIONS];
+          bool success = true;
+          for (u32 rr = 0; (rr < options.repetitions) && (success); rr++) {
+            success = benchRunOnce(container, keys, numThreads,
+              elapsed, numOperations);
+            for (int op = 0; op < NUM_BENCH_OPERATIONS; op++) {
+              samples[(op * options.repetitions) + rr]
+                = (numOperations[op] > 0)
+                ? ((double) elapsed[op]) / ((double) numOperations[op])
+                : 0.0;
+            }
+          }
+          if (!success) {
+            returnValue = 1;
+            continue;
+          }
+
+          for (int op = 0; op < NUM_BENCH_OPERATIONS; op++) {
+            if (elapsed[op] >= 0) {
+              benchReport(&options, container->name, (BenchKeyType) keyType,
+                (BenchOperation) op, size, numThreads, numOperations[op],
+                &samples[op * options.repetitions]);
+            }
+          }
+        }
+      }
+
+      keys = benchKeysDestroy(keys);
+    }
+  }
+
+  free(samples);
+  return returnValue;
+}
+
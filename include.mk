@@ -35,6 +35,15 @@ OBJ_FILES := \
     $(OBJ_DIR)/miniz.o \
     $(OBJ_DIR)/RadixTree.o \
     $(OBJ_DIR)/CThreadsMessages.o \
+    $(OBJ_DIR)/FlatHashTable.o \
+    $(OBJ_DIR)/NodePool.o \
+    $(OBJ_DIR)/ThreadPool.o \
+    $(OBJ_DIR)/AsyncIo.o \
+    $(OBJ_DIR)/LockStats.o \
+    $(OBJ_DIR)/Allocator.o \
+    $(OBJ_DIR)/Cache.o \
+    $(OBJ_DIR)/TypedContainers.o \
+    $(OBJ_DIR)/PersistentTree.o \
 
 INCLUDES := \
     -Iinclude \
@@ -49,7 +58,7 @@ WARNINGS := \
 
 include defines.mk
 
-all: $(OBJ_DIR)/Cnext.a
+all: $(OBJ_DIR)/Cnext.a $(OBJ_DIR)/ConcurrencyBenchmark
 
 $(OBJ_DIR)/Cnext.a: $(OBJ_FILES) $(MAKEFILE) include.mk
 	$(ARCHIVE) $(OBJ_DIR)/Cnext.a $(OBJ_FILES)
@@ -58,5 +67,28 @@ $(OBJ_DIR)/%.o: $(SRC_DIR)/%.c $(INCLUDE_DIR)/%.h $(MAKEFILE) include.mk
 	$(MKDIR) $(OBJ_DIR)
 	$(CXX) $(FLAGS) $(INCLUDES) $(DEFINES) $(WARNINGS) -c $< -o $@
 
+# Container microbenchmarks.  Extra options can be passed with BENCH_ARGS,
+# e.g. make bench BENCH_ARGS="-s 1000 -c HashTable -j".
+# Glibc27CompatLib is left out because its strtoll and strtol wrappers call
+# themselves when they are linked into an executable instead of a library.
+BENCH_FLAGS := -O2
+BENCH_LINKS := -lpthread -lssl -lcrypto
+BENCH_OBJ_FILES := $(filter-out $(OBJ_DIR)/Glibc27CompatLib.o, $(OBJ_FILES))
+
+bench: $(OBJ_DIR)/ContainerBenchmark
+	$(OBJ_DIR)/ContainerBenchmark $(BENCH_ARGS)
+
+$(OBJ_DIR)/ContainerBenchmark: examples/ContainerBenchmark.c $(BENCH_OBJ_FILES) $(MAKEFILE) include.mk
+	$(CXX) $(FLAGS) $(BENCH_FLAGS) $(INCLUDES) $(DEFINES) $(WARNINGS) $< $(BENCH_OBJ_FILES) -o $@ $(BENCH_LINKS)
+
+# Coroutine, thread message and logging latency benchmarks.  Built with the
+# library; options are passed the same way, e.g.
+# make bench-concurrency BENCH_ARGS="-n 10000 -b thrdMsg -H histograms.csv".
+bench-concurrency: $(OBJ_DIR)/ConcurrencyBenchmark
+	$(OBJ_DIR)/ConcurrencyBenchmark $(BENCH_ARGS)
+
+$(OBJ_DIR)/ConcurrencyBenchmark: examples/ConcurrencyBenchmark.c $(BENCH_OBJ_FILES) $(MAKEFILE) include.mk
+	$(CXX) $(FLAGS) $(BENCH_FLAGS) $(INCLUDES) $(DEFINES) $(WARNINGS) $< $(BENCH_OBJ_FILES) -o $@ $(BENCH_LINKS)
+
 cleanall:
 	$(REMOVE) $(BUILD_DIR)
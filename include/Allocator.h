@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              Allocator.h
+///
+/// @brief             This library contains the definitions for the
+///                    pluggable allocator the containers get their memory
+///                    from and for optional allocation accounting.
+///
+/// @details           The containers allocate their structures, nodes and
+///                    arrays through allocatorMalloc and friends, which pass
+///                    the request on to the current Allocator.  The default
+///                    Allocator is the C library's.  Another one, such as an
+///                    arena of jemalloc or mimalloc, can be installed with
+///                    allocatorSet before any containers are created.
+///
+///                    When the library is built with ALLOCATOR_STATS_ENABLED
+///                    defined, every allocation and release is also counted
+///                    against the subsystem that made it and, when there is
+///                    one, the TypeDescriptor of the container's keys:  The
+///                    number of allocations and frees, the bytes allocated,
+///                    the bytes live and the peak live bytes.
+///                    allocatorStatsToJson reports the counters.
+///
+///                    Values copied into containers by a TypeDescriptor's
+///                    copy function are not allocated here.  Callers create
+///                    and free those with the C library directly.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+
+#include <stddef.h>
+
+#include "TypeDefinitions.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+struct TypeDescriptor;
+
+/// @enum AllocatorSubsystem
+///
+/// @brief The parts of the library allocations are counted against.
+///
+/// @var ALLOCATOR_OTHER Anything that isn't one of the subsystems below.
+/// @var ALLOCATOR_LIST Lists, including Queues and Stacks, and their nodes.
+/// @var ALLOCATOR_VECTOR Vectors and their arrays.
+/// @var ALLOCATOR_HASH_TABLE HashTables, their tree arrays and their entries.
+///   The red-black trees that make up the buckets count as
+///   ALLOCATOR_RED_BLACK_TREE.
+/// @var ALLOCATOR_RED_BLACK_TREE RedBlackTrees and their nodes.
+/// @var ALLOCATOR_FLAT_HASH_TABLE FlatHashTables and their entry arrays.
+/// @var ALLOCATOR_QUEUE RingQueues and their slots.
+/// @var ALLOCATOR_RADIX_TREE RadixTrees and their nodes.
+/// @var NUM_ALLOCATOR_SUBSYSTEMS The number of subsystems.
+typedef enum AllocatorSubsystem {
+  ALLOCATOR_OTHER,
+  ALLOCATOR_LIST,
+  ALLOCATOR_VECTOR,
+  ALLOCATOR_HASH_TABLE,
+  ALLOCATOR_RED_BLACK_TREE,
+  ALLOCATOR_FLAT_HASH_TABLE,
+  ALLOCATOR_QUEUE,
+  ALLOCATOR_RADIX_TREE,
+  NUM_ALLOCATOR_SUBSYSTEMS
+} AllocatorSubsystem;
+
+/// @struct Allocator
+///
+/// @brief The functions the library gets its memory from.
+///
+/// @param name The name of the allocator, for reports.
+/// @param malloc Allocate uninitialized memory.
+/// @param calloc Allocate zeroed memory for an array.
+/// @param realloc Resize an allocation.
+/// @param free Release an allocation.  The pointer may be NULL.
+/// @param usableSize Get the number of usable bytes of an allocation.  May be
+///   NULL, in which case only allocations and frees are counted, not bytes.
+/// @param context The value passed as the first argument to each function.
+typedef struct Allocator {
+  const char *name;
+  void* (*malloc)(void *context, size_t size);
+  void* (*calloc)(void *context, size_t count, size_t size);
+  void* (*realloc)(void *context, void *pointer, size_t size);
+  void  (*free)(void *context, void *pointer);
+  size_t (*usableSize)(void *context, void *pointer);
+  void *context;
+} Allocator;
+
+/// @struct AllocatorCounters
+///
+/// @brief The allocation counters of one subsystem or TypeDescriptor.
+///
+/// @param allocations The number of allocations, including reallocations.
+/// @param frees The number of releases, including reallocations.
+/// @param allocatedBytes The total number of bytes allocated.
+/// @param liveBytes The number of bytes allocated and not yet released.
+/// @param peakBytes The highest liveBytes has been.
+typedef struct AllocatorCounters {
+  u64 allocations;
+  u64 frees;
+  u64 allocatedBytes;
+  i64 liveBytes;
+  i64 peakBytes;
+} AllocatorCounters;
+
+int allocatorSet(const Allocator *allocator);
+const Allocator* allocatorGet(void);
+void* allocatorMalloc(AllocatorSubsystem subsystem,
+  const struct TypeDescriptor *type, size_t size);
+void* allocatorCalloc(AllocatorSubsystem subsystem,
+  const struct TypeDescriptor *type, size_t count, size_t size);
+void* allocatorRealloc(AllocatorSubsystem subsystem,
+  const struct TypeDescriptor *type, void *pointer, size_t size);
+void* allocatorFree(AllocatorSubsystem subsystem,
+  const struct TypeDescriptor *type, void *pointer);
+int allocatorSubsystemStats(AllocatorSubsystem subsystem,
+  AllocatorCounters *counters);
+char* allocatorStatsToJson(void);
+void allocatorStatsReset(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // ALLOCATOR_H
+
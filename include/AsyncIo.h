@@ -0,0 +1,167 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              AsyncIo.h
+///
+/// @brief             This library contains the definitions for batched,
+///                    asynchronous I/O.
+///
+/// @details           IoUring is a thin wrapper around a Linux io_uring
+///                    instance that talks to the kernel directly, without
+///                    liburing.  Operations are queued and then submitted
+///                    together in one system call, and their completions are
+///                    read back from shared memory.  It supports registered
+///                    buffers, provided buffer groups, and multishot accept
+///                    and receive.  On other systems, or where io_uring is
+///                    disabled, ioUringCreate returns NULL.
+///
+///                    AsyncIo is a portable asynchronous file API.  It uses
+///                    an IoUring when one is available and otherwise performs
+///                    the queued operations itself when they're submitted.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ASYNC_IO_H
+#define ASYNC_IO_H
+
+#include <stddef.h>
+
+#include "TypeDefinitions.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def IO_URING_COMPLETION_MORE
+///
+/// @brief Flag set in IoUringCompletion.flags when the multishot operation that
+/// produced the completion will produce more.
+#define IO_URING_COMPLETION_MORE   0x00000002
+
+/// @def IO_URING_COMPLETION_BUFFER
+///
+/// @brief Flag set in IoUringCompletion.flags when the operation picked a
+/// buffer from a provided buffer group.  The buffer's ID is in bufferId.
+#define IO_URING_COMPLETION_BUFFER 0x00000001
+
+typedef struct IoUring IoUring;
+
+/// @struct IoUringBuffer
+///
+/// @brief One buffer to register with ioUringRegisterBuffers.
+///
+/// @param base A pointer to the buffer.
+/// @param length The size of the buffer in bytes.
+typedef struct IoUringBuffer {
+  void *base;
+  size_t length;
+} IoUringBuffer;
+
+/// @struct IoUringCompletion
+///
+/// @brief The completion of one queued operation.
+///
+/// @param userData The value passed when the operation was queued.
+/// @param result The operation's result:  A byte count, a file descriptor for
+///   an accept, or a negated errno value on failure.
+/// @param flags IO_URING_COMPLETION_MORE and/or IO_URING_COMPLETION_BUFFER.
+/// @param bufferId The ID of the provided buffer the operation used, if flags
+///   has IO_URING_COMPLETION_BUFFER set.
+typedef struct IoUringCompletion {
+  u64 userData;
+  i32 result;
+  u32 flags;
+  u16 bufferId;
+} IoUringCompletion;
+
+IoUring* ioUringCreate(u32 numEntries);
+IoUring* ioUringDestroy(IoUring *ring);
+int ioUringRegisterBuffers(IoUring *ring, const IoUringBuffer *buffers,
+  u32 numBuffers);
+int ioUringUnregisterBuffers(IoUring *ring);
+int ioUringQueueRead(IoUring *ring, int fd, void *buffer, u32 length,
+  i64 offset, u64 userData);
+int ioUringQueueWrite(IoUring *ring, int fd, const void *buffer, u32 length,
+  i64 offset, u64 userData);
+int ioUringQueueReadFixed(IoUring *ring, int fd, u16 bufferIndex,
+  void *buffer, u32 length, i64 offset, u64 userData);
+int ioUringQueueWriteFixed(IoUring *ring, int fd, u16 bufferIndex,
+  const void *buffer, u32 length, i64 offset, u64 userData);
+int ioUringQueueFsync(IoUring *ring, int fd, u64 userData);
+int ioUringQueueSend(IoUring *ring, int fd, const void *buffer, u32 length,
+  int flags, u64 userData);
+int ioUringQueueRecv(IoUring *ring, int fd, void *buffer, u32 length,
+  int flags, u64 userData);
+int ioUringQueueProvideBuffers(IoUring *ring, u16 bufferGroup, void *base,
+  u32 bufferSize, u32 numBuffers, u16 firstBufferId, u64 userData);
+int ioUringQueueRecvMultishot(IoUring *ring, int fd, u16 bufferGroup,
+  u64 userData);
+int ioUringQueueAccept(IoUring *ring, int fd, bool multishot, u64 userData);
+int ioUringQueuePoll(IoUring *ring, int fd, u32 pollEvents, u64 userData);
+int ioUringQueuePollRemove(IoUring *ring, u64 targetUserData, u64 userData);
+int ioUringQueueCancel(IoUring *ring, u64 targetUserData, u64 userData);
+int ioUringSubmit(IoUring *ring);
+int ioUringSubmitAndWait(IoUring *ring, int timeoutMilliseconds);
+bool ioUringPeekCompletion(IoUring *ring, IoUringCompletion *completion);
+
+typedef struct AsyncIo AsyncIo;
+
+/// @struct AsyncIoResult
+///
+/// @brief The result of one operation queued on an AsyncIo.
+///
+/// @param userData The value passed when the operation was queued.
+/// @param result The number of bytes transferred (0 for an fsync) on success,
+///   a negated errno value on failure.
+typedef struct AsyncIoResult {
+  void *userData;
+  i64 result;
+} AsyncIoResult;
+
+AsyncIo* asyncIoCreate(u32 depth);
+AsyncIo* asyncIoDestroy(AsyncIo *asyncIo);
+bool asyncIoUsesIoUring(AsyncIo *asyncIo);
+int asyncIoRead(AsyncIo *asyncIo, int fd, void *buffer, size_t length,
+  i64 offset, void *userData);
+int asyncIoWrite(AsyncIo *asyncIo, int fd, const void *buffer, size_t length,
+  i64 offset, void *userData);
+int asyncIoFsync(AsyncIo *asyncIo, int fd, void *userData);
+int asyncIoSubmit(AsyncIo *asyncIo);
+int asyncIoWait(AsyncIo *asyncIo, AsyncIoResult *results, int maxResults,
+  int timeoutMilliseconds);
+u32 asyncIoNumPending(AsyncIo *asyncIo);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // ASYNC_IO_H
+
@@ -45,6 +45,26 @@ extern "C"
 {
 #endif
 
+/// @struct thrd_msg_buf_t
+///
+/// @brief Definition for an immutable, reference-counted message payload.  One
+/// buffer can be attached to any number of messages, so sending the same
+/// payload to several threads doesn't copy it.  The buffer is freed when the
+/// last reference to it is released.
+///
+/// @param data A pointer to the payload.  Must not be modified once the buffer
+///   has been attached to a message.
+/// @param size The number of bytes pointed to by the data pointer.
+/// @param references The number of messages and callers holding the buffer.
+/// @param free_data The function to free data with when the last reference is
+///   released.  NULL if data is stored inline after the structure.
+typedef struct thrd_msg_buf_t {
+  const void *data;
+  size_t size;
+  long references;
+  void (*free_data)(void *data);
+} thrd_msg_buf_t;
+
 /// @struct thrd_msg_t
 ///
 /// @brief Definition for a message that can be pushed onto a thread's message
@@ -70,6 +90,8 @@ extern "C"
 ///   initialization have been configured yet.
 /// @param dynamically_allocated Whether or not the message was dynamically
 ///   allocated with thrd_msg_create.
+/// @param buf The shared buffer attached with thrd_msg_init_buf, if any.  The
+///   message holds a reference to it until the message is released.
 typedef struct thrd_msg_t {
   int type;
   void *data;
@@ -84,6 +106,7 @@ typedef struct thrd_msg_t {
   mtx_t lock;
   bool configured;
   bool dynamically_allocated;
+  thrd_msg_buf_t *buf;
 } thrd_msg_t;
 
 // Message queue functions
@@ -93,6 +116,9 @@ thrd_msg_t* thrd_msg_q_pop_type(int type);
 thrd_msg_t* thrd_msg_q_wait(const struct timespec *ts);
 thrd_msg_t* thrd_msg_q_wait_for_type(int type, const struct timespec *ts);
 int thrd_msg_q_push(thrd_t thr, thrd_msg_t *msg);
+int thrd_msg_q_push_batch(thrd_t thr, thrd_msg_t *msgs);
+thrd_msg_t* thrd_msg_q_pop_n(size_t n);
+thrd_msg_t* thrd_msg_q_pop_all(void);
 
 // Message functions
 thrd_msg_t* thrd_msg_create(void);
@@ -105,6 +131,15 @@ int thrd_msg_wait_for_done(thrd_msg_t *msg, const struct timespec *ts);
 thrd_msg_t* thrd_msg_wait_for_reply(thrd_msg_t *sent, bool release, const struct timespec *ts);
 thrd_msg_t* thrd_msg_wait_for_reply_with_type(thrd_msg_t *sent, bool release, int type,
   const struct timespec *ts);
+int thrd_msg_init_buf(
+  thrd_msg_t *msg, int type, thrd_msg_buf_t *buf, bool waiting);
+
+// Shared buffer functions
+thrd_msg_buf_t* thrd_msg_buf_create(const void *data, size_t size);
+thrd_msg_buf_t* thrd_msg_buf_wrap(
+  void *data, size_t size, void (*free_data)(void *data));
+thrd_msg_buf_t* thrd_msg_buf_retain(thrd_msg_buf_t *buf);
+thrd_msg_buf_t* thrd_msg_buf_release(thrd_msg_buf_t *buf);
 
 // Message accessors
 #define thrd_msg_type(thrd_msg_ptr) \
@@ -126,6 +161,8 @@ thrd_msg_t* thrd_msg_wait_for_reply_with_type(thrd_msg_t *sent, bool release, in
   (((thrd_msg_ptr) != NULL) ? (thrd_msg_ptr)->to : 0)
 #define thrd_msg_configured(thrd_msg_ptr) \
   (((thrd_msg_ptr) != NULL) ? (thrd_msg_ptr)->configured : false)
+#define thrd_msg_buf(thrd_msg_ptr) \
+  (((thrd_msg_ptr) != NULL) ? (thrd_msg_ptr)->buf : NULL)
 
 
 #ifdef __cplusplus
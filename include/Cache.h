@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              Cache.h
+///
+/// @brief             This library contains the definitions for a bounded,
+///                    thread-safe cache with least-recently-used and
+///                    time-to-live eviction.
+///
+/// @details           A Cache is split into a power-of-two number of shards,
+///                    each of which is a HashTable with its thread safety
+///                    disabled, guarded by a single mutex.  A key's shard is
+///                    chosen by its hash, so operations on keys in different
+///                    shards don't contend with each other.
+///
+///                    A HashTable already keeps its nodes on a list in
+///                    insertion order.  The cache moves a node to the tail
+///                    of that list whenever it is read or written, which
+///                    makes the head the least recently used entry.  When a
+///                    shard holds more entries than its share of the
+///                    capacity, entries are evicted from the head.  Every
+///                    get and put therefore takes exactly one lock and does
+///                    O(1) work besides the hash lookup.  Recency is tracked
+///                    per shard, so eviction approximates a single
+///                    least-recently-used order across the whole cache.
+///
+///                    Keys and values are copied in with their
+///                    TypeDescriptors' copy functions and destroyed with
+///                    their destroy functions when they are replaced,
+///                    removed or evicted, exactly as in a HashTable.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include "DataTypes.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def CACHE_DEFAULT_NUM_SHARDS
+///
+/// @brief The number of shards a cache is split into when the caller doesn't
+/// say.  Caches smaller than this get one shard per entry.
+#ifndef CACHE_DEFAULT_NUM_SHARDS
+#define CACHE_DEFAULT_NUM_SHARDS 16
+#endif
+
+/// @def CACHE_SHARD_PADDING
+///
+/// @brief The number of bytes of padding at the end of each CacheShard, so
+/// that the locks and counters of neighboring shards are never on the same
+/// cache line.
+#define CACHE_SHARD_PADDING 64
+
+/// @struct CacheShard
+///
+/// @brief One independently-locked part of a Cache.
+///
+/// @param lock The mutex that guards the shard.
+/// @param table The HashTable holding the shard's entries in order from least
+///   to most recently used.  The byteOffset of each node holds the monotonic
+///   time, in nanoseconds, at which the entry expires.  Caches are never
+///   backed by files, so the field isn't otherwise used.
+/// @param capacity The most entries the shard may hold.
+/// @param hits The number of gets that found a live entry.
+/// @param misses The number of gets that didn't.
+/// @param evictions The number of entries removed to make room.
+/// @param expirations The number of entries removed because they expired.
+/// @param padding Keeps the next shard off of this shard's cache lines.
+typedef struct CacheShard {
+  mtx_t lock;
+  HashTable *table;
+  u64 capacity;
+  u64 hits;
+  u64 misses;
+  u64 evictions;
+  u64 expirations;
+  char padding[CACHE_SHARD_PADDING];
+} CacheShard;
+
+/// @struct Cache
+///
+/// @brief Bounded cache object definition.
+///
+/// @param keyType A pointer to a TypeDescriptor describing the keys used in
+///   the cache.
+/// @param capacity The most entries the cache may hold.
+/// @param ttlNanoseconds How long an entry lives after it is put, or 0 if
+///   entries never expire.
+/// @param numShards The number of shards.  Always a power of two.
+/// @param seed The seed passed to the hash function to choose a key's shard.
+/// @param shards The array of shards.
+typedef struct Cache {
+  TypeDescriptor *keyType;
+  u64 capacity;
+  i64 ttlNanoseconds;
+  u64 numShards;
+  u64 seed;
+  CacheShard *shards;
+} Cache;
+
+/// @struct CacheStats
+///
+/// @brief A snapshot of the counters of a Cache, summed over its shards.
+///
+/// @param size The number of entries in the cache, including any that have
+///   expired but haven't been removed yet.
+/// @param capacity The most entries the cache may hold.
+/// @param numShards The number of shards.
+/// @param hits The number of gets that found a live entry.
+/// @param misses The number of gets that didn't.
+/// @param evictions The number of entries removed to make room.
+/// @param expirations The number of entries removed because they expired.
+typedef struct CacheStats {
+  u64 size;
+  u64 capacity;
+  u64 numShards;
+  u64 hits;
+  u64 misses;
+  u64 evictions;
+  u64 expirations;
+} CacheStats;
+
+Cache* cacheCreate_(TypeDescriptor *keyType, u64 capacity,
+  u64 ttlMilliseconds, u64 numShards, ...);
+#define cacheCreate(keyType, capacity, ...) \
+  cacheCreate_(keyType, capacity, ##__VA_ARGS__, 0, 0)
+Cache* cacheDestroy(Cache *cache);
+i32 cachePut_(Cache *cache, const volatile void *key,
+  const volatile void *value, TypeDescriptor *type, ...);
+#define cachePut(cache, key, value, ...) \
+  cachePut_(cache, key, value, ##__VA_ARGS__, NULL)
+void* cacheGet(Cache *cache, const volatile void *key,
+  TypeDescriptor **type);
+bool cacheContains(Cache *cache, const volatile void *key);
+i32 cacheRemove(Cache *cache, const volatile void *key);
+u64 cacheSize(Cache *cache);
+i32 cacheClear(Cache *cache);
+u64 cachePurgeExpired(Cache *cache);
+int cacheStats(Cache *cache, CacheStats *stats);
+bool cacheUnitTest();
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // CACHE_H
+
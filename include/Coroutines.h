@@ -116,6 +116,24 @@ extern "C"
 #define COROUTINE_DEFAULT_STACK_SIZE 16384
 #endif
 
+/// @def COROUTINE_STACK_GUARD_PAGES
+///
+/// @brief The number of inaccessible pages placed below each stack allocated
+/// when the stack type is COROUTINE_STACK_MAPPED.  Every guard region is its
+/// own kernel mapping, so setting this to 0 allows far more coroutines before
+/// hitting the system's limit on the number of mappings per process.
+#ifndef COROUTINE_STACK_GUARD_PAGES
+#define COROUTINE_STACK_GUARD_PAGES 1
+#endif
+
+/// @def COROUTINE_STACK_POOL_CHUNK
+///
+/// @brief The number of stacks reserved by each mmap call when the stack type
+/// is COROUTINE_STACK_MAPPED.
+#ifndef COROUTINE_STACK_POOL_CHUNK
+#define COROUTINE_STACK_POOL_CHUNK 64
+#endif
+
 /// @def CoroutineId
 ///
 /// @brief The integer type to use for coroutine IDs.  Defaults to 64-bit IDs
@@ -186,6 +204,26 @@ typedef enum CoroutineState {
   NUM_COROUTINE_STATES
 } CoroutineState;
 
+/// @enum CoroutineStackType
+///
+/// @brief Where the stacks of newly-allocated coroutines come from.
+///
+/// @details COROUTINE_STACK_CARVED stacks are carved out of the stack of the
+/// thread that creates the coroutine.  This is the default and works
+/// everywhere, but the total number of coroutines is limited by the size of
+/// the thread's stack and nothing catches a coroutine that overflows into its
+/// neighbor until the guard values are checked.
+///
+/// COROUTINE_STACK_MAPPED stacks are reserved from an mmap'd pool.  Pages are
+/// only committed when they're touched, so mostly-idle coroutines stay small,
+/// and each stack has COROUTINE_STACK_GUARD_PAGES inaccessible pages below it
+/// so that an overflow faults immediately.  Not available on Windows.
+typedef enum CoroutineStackType {
+  COROUTINE_STACK_CARVED,
+  COROUTINE_STACK_MAPPED,
+  NUM_COROUTINE_STACK_TYPES
+} CoroutineStackType;
+
 // Forward declarations.  Doxygen below.
 typedef struct Comutex Comutex;
 typedef struct Cocondition Cocondition;
@@ -286,6 +324,38 @@ typedef struct Cocondition {
 
 // Coroutine base support.
 
+/// @def COROUTINE_CONTEXT_REGISTERS
+///
+/// @brief The number of pointer-sized slots needed to hold the callee-saved
+/// registers of the current architecture when Coroutines.c provides its own
+/// context switch routines for it.  Not defined on other platforms, which
+/// always use setjmp and longjmp.
+#if defined(__GNUC__) && defined(__x86_64__) && defined(_WIN64)
+#define COROUTINE_CONTEXT_REGISTERS 30
+#elif defined(__GNUC__) && defined(__x86_64__)
+#define COROUTINE_CONTEXT_REGISTERS 8
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define COROUTINE_CONTEXT_REGISTERS 21
+#endif
+
+/// @union CoroutineContext
+///
+/// @brief The saved execution context of a coroutine.
+///
+/// @details Whether a context is saved as registers or as a jmp_buf is decided
+/// when Coroutines.c is compiled (see COROUTINE_REGISTER_SWITCH there), so both
+/// are always present to keep the layout of Coroutine the same either way.
+///
+/// @param jumpBuffer The context as saved by setjmp.
+/// @param registers The callee-saved registers, stack pointer, and resume
+///   address as saved by the library's own context switch routines.
+typedef union CoroutineContext {
+  jmp_buf jumpBuffer;
+#ifdef COROUTINE_CONTEXT_REGISTERS
+  uintptr_t registers[COROUTINE_CONTEXT_REGISTERS];
+#endif
+} CoroutineContext;
+
 /// @struct Coroutine
 ///
 /// @brief Data structure to manage an individual coroutine.
@@ -293,7 +363,7 @@ typedef struct Cocondition {
 /// @param guard1 A well-known value to check for state corruption (stack
 ///   overflow).
 /// @param nextInList Pointer to the next Coroutine in the list.
-/// @param context The jmp_buf to hold the context of the coroutine.
+/// @param context The CoroutineContext to hold the context of the coroutine.
 /// @param id The ID of the coroutine.
 /// @param state The state of the coroutine.  (See enum above.)
 /// @param nextToLock The next coroutine to allow to lock a mutex.
@@ -301,7 +371,7 @@ typedef struct Cocondition {
 /// @param nextToSignal The next coroutine to signal when waiting on a signal.
 /// @param prevToSignal The previous coroutine to signal when waiting on a
 ///   signal.
-/// @param resetContext The jmp_buf that holds the place on stack to jump to
+/// @param resetContext The CoroutineContext that holds the place on stack to jump to
 ///   after a coroutine has been terminated and the value of context is reset.
 /// @param passed The CoroutineFuncData that's passed between contexts by the
 ///   coroutinePass function (on a yield or resume call).
@@ -316,19 +386,25 @@ typedef struct Cocondition {
 ///   is currently waiting to lock.
 /// @param blockingCocondition A pointer to a condition (Cocondition) that the
 ///   coroutine is currently waiting on to be signalled.
+/// @param wakeTime The deadline, in nanoseconds, of the timed wait the coroutine
+///   is currently blocked in, or 0 if it is not in a timed wait.
+/// @param runQueue A pointer to the run queue the coroutine is parked on while
+///   it's blocked, or NULL if it is not parked.
+/// @param timerIndex The coroutine's position within the run queue's deadline
+///   heap while it is parked in a timed wait.
 /// @param guard2 A well-known value to check for state corruption (stack
 ///   overflow).
 typedef struct Coroutine {
   uint32_t guard1;
   struct Coroutine *nextInList;
-  jmp_buf context;
+  CoroutineContext context;
   CoroutineId id;
   CoroutineState state;
   struct Coroutine *nextToLock;
   struct Coroutine *prevToLock;
   struct Coroutine *nextToSignal;
   struct Coroutine *prevToSignal;
-  jmp_buf resetContext;
+  CoroutineContext resetContext;
   CoroutineFuncData passed;
   Comessage *nextMessage;
   Comessage *lastMessage;
@@ -336,11 +412,34 @@ typedef struct Coroutine {
   Comutex messageLock;
   Comutex *blockingComutex;
   Cocondition *blockingCocondition;
+  int64_t wakeTime;
+  struct CoroutineRunQueue *runQueue;
+  size_t timerIndex;
   uint32_t guard2;
 } Coroutine;
 
 // Coroutine message support.
 
+/// @struct ComessageBuffer
+///
+/// @brief Definition for an immutable, reference-counted message payload.  One
+/// buffer can be attached to any number of Comessages, so sending the same
+/// payload to several coroutines doesn't copy it.  The buffer is freed when
+/// the last reference to it is released.
+///
+/// @param data A pointer to the payload.  Must not be modified once the buffer
+///   has been attached to a message.
+/// @param size The number of bytes pointed to by the data pointer.
+/// @param references The number of messages and callers holding the buffer.
+/// @param freeData The function to free data with when the last reference is
+///   released.  NULL if data is stored inline after the structure.
+typedef struct ComessageBuffer {
+  const void *data;
+  size_t size;
+  long references;
+  void (*freeData)(void *data);
+} ComessageBuffer;
+
 /// @struct Comessage
 ///
 /// @brief Definition for a coroutine message that can be pushed onto a
@@ -364,6 +463,8 @@ typedef struct Coroutine {
 /// @param lock A mutex (Comutex) to guard the condition.
 /// @param configured Whether or not the members of the message that requrie
 ///   initializatoin have been configured yet.
+/// @param buffer The shared buffer attached with comessageInitBuffer, if any.
+///   The message holds a reference to it until the message is released.
 typedef struct Comessage {
   int type;
   void *data;
@@ -377,6 +478,7 @@ typedef struct Comessage {
   Cocondition condition;
   Comutex lock;
   bool configured;
+  ComessageBuffer *buffer;
 } Comessage;
 
 // Support functions
@@ -427,6 +529,8 @@ int coroutineConfig(Coroutine *first, int stackSize, void *stateData,
 Coroutine* coroutineInit(Coroutine *userCoroutine,
   CoroutineFunction func, void *arg);
 int coroutineCreate(Coroutine **coroutine, CoroutineFunction func, void *arg);
+int coroutineSetStackType(CoroutineStackType stackType);
+CoroutineStackType coroutineStackType(void);
 void* coroutineResume(Coroutine *targetCoroutine, void *arg);
 void* coroutineYield(void *arg);
 int coroutineSetId(Coroutine *coroutine, CoroutineId id);
@@ -469,12 +573,17 @@ Comessage* comessageQueuePopType(int type);
 Comessage* comessageQueueWait(const struct timespec *ts);
 Comessage* comessageQueueWaitForType(int type, const struct timespec *ts);
 int comessageQueuePush(Coroutine *coroutine, Comessage *comessage);
+int comessageQueuePushBatch(Coroutine *coroutine, Comessage *comessages);
+Comessage* comessageQueuePopN(size_t n);
+Comessage* comessageQueuePopAll(void);
 
 
 // Comessage functions
 int comessageDestroy(Comessage *comessage);
 int comessageInit(
   Comessage *comessage, int type, void *data, size_t size, bool waiting);
+int comessageInitBuffer(
+  Comessage *comessage, int type, ComessageBuffer *buffer, bool waiting);
 int comessageRelease(Comessage *comessage);
 int comessageSetDone(Comessage *comessage);
 int comessageWaitForDone(Comessage *comessage, const struct timespec *ts);
@@ -483,6 +592,13 @@ Comessage* comessageWaitForReply(Comessage *sent, bool releaseAfterDone,
 Comessage* comessageWaitForReplyWithType(Comessage *sent, bool releaseAfterDone,
   int type, const struct timespec *ts);
 
+// ComessageBuffer functions
+ComessageBuffer* comessageBufferCreate(const void *data, size_t size);
+ComessageBuffer* comessageBufferWrap(
+  void *data, size_t size, void (*freeData)(void *data));
+ComessageBuffer* comessageBufferRetain(ComessageBuffer *buffer);
+ComessageBuffer* comessageBufferRelease(ComessageBuffer *buffer);
+
 
 // Comessage accessors
 #define comessageType(comessagePointer) \
@@ -504,6 +620,45 @@ Comessage* comessageWaitForReplyWithType(Comessage *sent, bool releaseAfterDone,
   (((comessagePointer) != NULL) ? (comessagePointer)->to : NULL)
 #define comessageConfigured(comessagePointer) \
   (((comessagePointer) != NULL) ? (comessagePointer)->configured : false)
+#define comessageBuffer(comessagePointer) \
+  (((comessagePointer) != NULL) ? (comessagePointer)->buffer : NULL)
+
+
+// Run queue support.
+
+// Run queue function prototypes.  Doxygen inline in source file.
+int coroutineSchedule(Coroutine *coroutine);
+int coroutineRun(void);
+
+
+#ifdef THREAD_SAFE_COROUTINES
+// Multi-threaded scheduler support.
+
+/// @def COROUTINE_SCHEDULER_DEFAULT_MAX_COROUTINES
+///
+/// @brief The default maximum number of coroutines that a single scheduler
+/// worker thread will have in flight at one time.  With the default
+/// COROUTINE_STACK_CARVED stacks, every coroutine's stack is carved out of its
+/// worker thread's stack, so this value times the coroutine stack size must fit
+/// within the stack of a thread created by thrd_create.  With
+/// COROUTINE_STACK_MAPPED stacks, much larger values are practical.
+#ifndef COROUTINE_SCHEDULER_DEFAULT_MAX_COROUTINES
+#define COROUTINE_SCHEDULER_DEFAULT_MAX_COROUTINES 32
+#endif
+
+/// @typedef CoroutineScheduler
+///
+/// @brief Opaque type for a pool of worker threads that run coroutines.  The
+/// definition is private to Coroutines.c.
+typedef struct CoroutineScheduler CoroutineScheduler;
+
+// Scheduler function prototypes.  Doxygen inline in source file.
+CoroutineScheduler* coroutineSchedulerCreate(size_t numWorkers,
+  int stackSize, size_t maxCoroutines);
+int coroutineSchedulerSubmit(CoroutineScheduler *scheduler,
+  CoroutineFunction func, void *arg);
+int coroutineSchedulerDestroy(CoroutineScheduler *scheduler);
+#endif // THREAD_SAFE_COROUTINES
 
 
 #ifdef __cplusplus
@@ -42,6 +42,7 @@
 
 #include "TypeDefinitions.h"
 #include "CThreads.h"
+#include "Allocator.h"
 #include <stdio.h>
 
 #ifdef __cplusplus
@@ -124,6 +125,11 @@ bool stringIsNumber(const char *str);
 bool stringIsBoolean(const char *str);
 bool strtobool(const char *str, char **endptr);
 
+// Defined in StringLib.h.
+struct JsonWriter;
+struct XmlReader;
+struct NodePool;
+
 /// @struct TypeDescriptor
 /// @brief This is the set of information required to describe any type of
 ///   data in the general data structures.
@@ -154,11 +160,22 @@ bool strtobool(const char *str, char **endptr);
 /// @param fromBlob A function that converts an array of bytes output by
 ///   toBlob back into a data element of the data type.
 /// @param hashFunction A function that hashes the data of the type into an
-///   integer value.  This member is optional.  The default hash algorithm will
-///   be used in the hash table logic if it's omitted.
+///   integer value using the provided seed.  This member is optional.  The
+///   default hash algorithm (hashMemory) will be used in the hash table logic
+///   if it's omitted.
 /// @param clear A function the clears but does not deallocate the value.
 /// @param toXml A function that converts the data to an XML representation.
 /// @param toJson A function that converts the data to a JSON representation.
+/// @param toJsonStream A function that writes the JSON representation of the
+///   data to a JsonWriter without building it in memory first.  This member is
+///   optional.  toJson will be used if it's omitted.
+/// @param blobSize A function that returns the exact number of bytes toBlob
+///   would produce for the data, or 0 if it cannot be encoded.  This member is
+///   optional.  The data will be sized with toBlob if it's omitted.
+/// @param toBlobBuffer A function that writes the same bytes as toBlob into a
+///   caller-provided buffer and returns the number of bytes written, or 0 if
+///   the data cannot be encoded or does not fit.  This member is optional.
+///   toBlob will be used if it's omitted.
 typedef struct TypeDescriptor {
   const char    *name;
   const char    *xmlName;
@@ -172,10 +189,13 @@ typedef struct TypeDescriptor {
   size_t       (*size)(const volatile void *value);
   Bytes        (*toBlob)(const volatile void *value);
   void*        (*fromBlob)(const volatile void *value, u64 *length, bool inPlaceData, bool disableThreadSafety);
-  u64          (*hashFunction)(const volatile void *value);
+  u64          (*hashFunction)(const volatile void *value, u64 seed);
   i32          (*clear)(volatile void *value);
   Bytes        (*toXml)(const volatile void*, const char *elementName, bool indent, ...);
   Bytes        (*toJson)(const volatile void*);
+  bool         (*toJsonStream)(const volatile void*, struct JsonWriter *writer);
+  u64          (*blobSize)(const volatile void *value);
+  u64          (*toBlobBuffer)(const volatile void *value, void *buffer, u64 bufferSize);
 } TypeDescriptor;
 
 /// @struct Variant
@@ -225,6 +245,8 @@ typedef struct ListNode {
 ///   the list.
 /// @param filePointer A pointer to the on-disk data for the list.
 /// @param lock A pointer to a mutex that guards access to this list.
+/// @param nodePool The pool the list's nodes are allocated from.  NULL if
+///   nodes come straight from malloc.
 typedef struct List {
   ListNode *head;
   ListNode *tail;
@@ -232,6 +254,7 @@ typedef struct List {
   TypeDescriptor *keyType;
   FILE *filePointer;
   mtx_t *lock;
+  struct NodePool *nodePool;
 } List;
 
 typedef struct ListNode QueueNode;
@@ -249,6 +272,8 @@ typedef struct ListNode QueueNode;
 ///   the queue.
 /// @param filePointer A pointer to the on-disk data for the queue.
 /// @param lock A pointer to a mutex that guards access to this queue.
+/// @param nodePool The pool the queue's nodes are allocated from.  NULL if
+///   nodes come straight from malloc.
 typedef struct Queue {
   QueueNode *head;
   QueueNode *tail;
@@ -256,6 +281,7 @@ typedef struct Queue {
   TypeDescriptor *keyType;
   FILE *filePointer;
   mtx_t *lock;
+  struct NodePool *nodePool;
 } Queue;
 
 typedef struct ListNode StackNode;
@@ -273,6 +299,8 @@ typedef struct ListNode StackNode;
 ///   the queue.
 /// @param filePointer A pointer to the on-disk data for the queue.
 /// @param lock A pointer to a mutex that guards access to this queue.
+/// @param nodePool The pool the stack's nodes are allocated from.  NULL if
+///   nodes come straight from malloc.
 typedef struct Stack {
   StackNode *head;
   StackNode *tail;
@@ -280,6 +308,7 @@ typedef struct Stack {
   TypeDescriptor *keyType;
   FILE *filePointer;
   mtx_t *lock;
+  struct NodePool *nodePool;
 } Stack;
 
 /// @struct RedBlackNode
@@ -335,6 +364,21 @@ typedef struct RedBlackNode {
 ///   value added.
 /// @param root A pointer to the root node of the tree.
 /// @param nil A pointer to a terminating node in the tree.
+/// @param rwLock A pointer to a reader/writer lock that lets lookups in the
+///   tree run concurrently.  NULL unless shared locking was requested when the
+///   tree was created.  When present, operations that only read the tree hold
+///   this lock shared instead of taking lock, and operations that modify the
+///   tree hold lock and then this lock exclusive.
+/// @param nodePool The pool the tree's nodes are allocated from.  NULL if
+///   nodes come straight from the allocator.
+/// @param nodeSubsystem The AllocatorSubsystem the tree's nodes are counted
+///   against when they don't come from nodePool.  This is
+///   ALLOCATOR_HASH_TABLE for the trees of a HashTable since the table
+///   allocates their nodes.
+/// @param unlinked Whether or not the tree skips keeping its nodes on the
+///   head/tail list in key order.  When true, head and tail are NULL except
+///   between a call to rbTreeLinkNodes and the next modification of the tree,
+///   and the tree's own functions walk the tree structure instead.
 typedef struct RedBlackTree {
   // The first six items must be compatible with List.
   RedBlackNode *head;
@@ -352,10 +396,28 @@ typedef struct RedBlackTree {
   // that the root and nil nodes do not require special cases in the code.
   RedBlackNode *root;             
   RedBlackNode *nil;              
+  rwl_t *rwLock;
+  struct NodePool *nodePool;
+  AllocatorSubsystem nodeSubsystem;
+  bool unlinked;
 } RedBlackTree;
 
 typedef struct RedBlackNode HashNode;
 
+/// @union HashTableLockStripe
+///
+/// @brief One of the reader/writer locks of a lock-striped hash table.
+///
+/// @details The padding keeps neighboring stripes off of each other's cache
+/// lines so that readers using different stripes never contend.
+///
+/// @param lock The reader/writer lock for the stripe.
+/// @param padding Unused.
+typedef union HashTableLockStripe {
+  rwl_t lock;
+  u8 padding[128];
+} HashTableLockStripe;
+
 /// @struct HashTable
 ///
 /// @brief Hash table object definition.  The first six elements must be
@@ -364,7 +426,8 @@ typedef struct RedBlackNode HashNode;
 /// @param head A pointer to the first HashNode in the hash table.
 /// @param tail A pointer to the last HashNode in the hash table.
 /// @param size The number of elements in the hash table.  This number will
-///   equal the sum of the sizes of all red-black trees in the table.
+///   equal the sum of the sizes of all red-black trees in the table (and
+///   oldTable, if a resize is in progress).
 /// @param keyType A pointer to a TypeDescriptor describing the keys used in
 ///   the hash table.
 /// @param filePointer A pointer to the on-disk data for the hash table.
@@ -373,6 +436,25 @@ typedef struct RedBlackNode HashNode;
 ///   value added.
 /// @param tableSize The number of red-black trees in the table.
 /// @param table The array of red-black trees for the table.
+/// @param oldTableSize The number of red-black trees in oldTable.
+/// @param oldTable The array of red-black trees being migrated into table
+///   during an incremental resize.  NULL when no resize is in progress.
+/// @param rehashIndex The index of the next tree in oldTable to migrate.
+///   Every index below this one has already been moved into table.
+/// @param seed The seed passed to the hash function for every key in this
+///   table.  Chosen at random when the table is created.
+/// @param numLockStripes The number of elements in lockStripes.  Always a
+///   power of two that evenly divides tableSize (and oldTableSize), so every
+///   key in a given tree maps to the same stripe.
+/// @param lockStripes The reader/writer locks that guard the trees of a
+///   lock-striped table.  NULL unless lock striping was requested when the
+///   table was created.  When present, lookups hold only the stripe of their
+///   key shared, while modifications hold lock and then the stripe of their
+///   key exclusive (or every stripe, when the tree arrays themselves change).
+/// @param unlinked Whether or not the table skips keeping its nodes on the
+///   head/tail list in insertion order.  When true, head and tail are NULL
+///   except between a call to htLinkNodes, which threads the nodes onto the
+///   list in bucket order, and the next modification of the table.
 typedef struct HashTable {
   HashNode *head;
   HashNode *tail;
@@ -383,6 +465,13 @@ typedef struct HashTable {
   TypeDescriptor *lastAddedType;
   u64 tableSize;
   RedBlackTree **table;
+  u64 oldTableSize;
+  RedBlackTree **oldTable;
+  u64 rehashIndex;
+  u64 seed;
+  u64 numLockStripes;
+  HashTableLockStripe *lockStripes;
+  bool unlinked;
 } HashTable;
 
 /// @struct VectorNode
@@ -653,6 +742,9 @@ int pointerCompare(const volatile void *valueA, const volatile void *valueB);
 Bytes pointerToBlob(const volatile void *value);
 void* pointerFromBlob(const volatile void *array, u64 *length, bool inPlaceData,
   bool disableThreadSafety);
+u64 hashMemory(const volatile void *data, u64 length, u64 seed);
+u64 hashMemoryCi(const volatile void *data, u64 length, u64 seed);
+u64 hashCreateSeed(void);
 
 // Endianness functions and macros
 //
@@ -712,10 +804,102 @@ bool valueToStringUnitTest();
 extern u16 DsMarker;
 extern u32 DsVersion;
 
+/// @def DS_INDEX_ENTRY_SIZE
+///
+/// @brief The number of bytes in one entry of the index that ends a version 11
+/// data structure byte array.  Each entry holds the offset of a node's type
+/// index followed by the offset of its key, both from the start of the array.
+#define DS_INDEX_ENTRY_SIZE (2 * sizeof(u64))
+
+/// @struct JsonContainerOps
+///
+/// @brief The operations jsonToDataStructure needs to build one kind of data
+/// structure from JSON.
+///
+/// @param create Creates an empty data structure keyed by strings.
+/// @param destroy Destroys a data structure made by create.
+/// @param addEntry Adds a value to a data structure.  key is NULL for
+///   arrays.  The value is added as addType and the node's type is then set to
+///   type, which lets ownership of an allocated value pass to the node.
+/// @param type The address of the data structure's TypeDescriptor.
+/// @param typeNoCopy The address of the NoCopy version of *type.
+/// @param isArray Whether the data structure holds JSON arrays (true) or
+///   JSON objects (false).
+typedef struct JsonContainerOps {
+  void*            (*create)(void);
+  void*            (*destroy)(void *container);
+  bool             (*addEntry)(void *container, const char *key,
+                     const volatile void *value, TypeDescriptor *addType,
+                     TypeDescriptor *type);
+  TypeDescriptor **type;
+  TypeDescriptor **typeNoCopy;
+  bool             isArray;
+} JsonContainerOps;
+
+#define JSON_CONTAINER_OPS(Type, prefix) \
+/** @fn static void* prefix##JsonCreate(void) */ \
+/** */ \
+/** @brief Create an empty Type for jsonToDataStructure. */ \
+/** */ \
+/** @return Returns a new Type on success, NULL on failure. */ \
+static void* prefix##JsonCreate(void) { \
+  return prefix##Create(typeString); \
+} \
+ \
+/** @fn static void* prefix##JsonDestroy(void *container) */ \
+/** */ \
+/** @brief Destroy a Type made by prefix##JsonCreate. */ \
+/** */ \
+/** @param container The Type to destroy. */ \
+/** */ \
+/** @return Returns NULL. */ \
+static void* prefix##JsonDestroy(void *container) { \
+  return prefix##Destroy((Type*) container); \
+} \
+ \
+/** @fn static bool prefix##JsonAddEntry(void *container, const char *key, const volatile void *value, TypeDescriptor *addType, TypeDescriptor *type) */ \
+/** */ \
+/** @brief Add a parsed value to a Type for jsonToDataStructure. */ \
+/** */ \
+/** @param container The Type to add to. */ \
+/** @param key The key of the value. */ \
+/** @param value The value to add. */ \
+/** @param addType The type to add the value as. */ \
+/** @param type The type to give the new node. */ \
+/** */ \
+/** @return Returns true on success, false on failure. */ \
+static bool prefix##JsonAddEntry(void *container, const char *key, \
+  const volatile void *value, TypeDescriptor *addType, TypeDescriptor *type \
+) { \
+  Type *dataStructure = (Type*) container; \
+  Type##Node *node = prefix##AddEntry(dataStructure, key, value, addType); \
+  if (node == NULL) { \
+    return false; \
+  } \
+  node->type = type; \
+  return true; \
+} \
+ \
+/** @var prefix##JsonContainerOps */ \
+/** */ \
+/** @brief The operations jsonToDataStructure uses to build a Type. */ \
+static const JsonContainerOps prefix##JsonContainerOps = { \
+  prefix##JsonCreate, \
+  prefix##JsonDestroy, \
+  prefix##JsonAddEntry, \
+  &type##Type, \
+  &type##Type##NoCopy, \
+  false \
+};
+
 #define JSON_TO_DATA_STRUCTURE(Type, prefix) \
+JSON_CONTAINER_OPS(Type, prefix) \
+ \
 /** @fn Type* jsonTo##Type(const char *jsonText, long long int *position) { */ \
 /** */ \
-/** @brief Converts a JSON-formatted string to a data structure. */ \
+/** @brief Converts a JSON-formatted string to a data structure.  Nested */ \
+/** objects become Type objects, arrays become Vectors, and objects within */ \
+/** arrays become HashTables. */ \
 /** */ \
 /** @param jsonText The text to convert. */ \
 /** @param position A pointer to the current byte postion within the jsonText. */ \
@@ -724,208 +908,54 @@ extern u32 DsVersion;
 Type* jsonTo##Type(const char *jsonText, long long int *position) { \
   printLog(TRACE, "ENTER jsonTo" #Type "(jsonText=\"%s\", position=%p)\n", \
     (jsonText != NULL) ? jsonText : "NULL", position); \
-  Type *returnValue = NULL; \
    \
-  if (jsonText == NULL) { \
-    printLog(ERR, "jsonText parameter is NULL.\n"); \
-    printLog(TRACE, \
-      "EXIT jsonTo" #Type "(jsonText=NULL, position=%p) = {NULL}\n", \
-      position); \
-    return NULL; \
-  } else if (position == NULL) { \
-    printLog(ERR, "position parameter is NULL.\n"); \
-    printLog(TRACE, \
-      "EXIT jsonTo" #Type "(jsonText=\"%s\", position=NULL) = {NULL}\n", \
-      jsonText); \
-    return NULL; \
-  } \
-   \
-  const char *charAt \
-    = &(jsonText[*position + strspn(&jsonText[*position], " \t\r\n")]); \
-  if (*charAt != '{') { \
-    printLog(ERR, "No opening brace in jsonText.  Malformed JSON input.\n"); \
-    printLog(TRACE, \
-      "EXIT jsonTo" #Type "(jsonText=\"%s\", position=%lld) = {NULL}\n", \
-      jsonText, *position); \
-    return NULL; \
-  } \
+  Type *returnValue = (Type*) jsonToDataStructure(jsonText, position, \
+    &prefix##JsonContainerOps); \
    \
-  returnValue = prefix##Create(typeString); \
+  printLog(TRACE, \
+    "EXIT jsonTo" #Type "(jsonText=\"%s\", position=%lld) = {%p}\n", \
+    (jsonText != NULL) ? jsonText : "NULL", \
+    (position != NULL) ? *position : -1LL, returnValue); \
+  return returnValue; \
+}
+
+#define XML_TO_DATA_STRUCTURE(Type, prefix) \
+/** @fn Type* xmlReaderTo##Type(XmlReader *reader) */ \
+/** */ \
+/** @brief Build a Type from the XML an XmlReader reads.  See */ \
+/** xmlToDataStructure for how elements are mapped to entries. */ \
+/** */ \
+/** @param reader The XmlReader to read from. */ \
+/** */ \
+/** @return Returns a pointer to a new Type on success, NULL on failure. */ \
+Type* xmlReaderTo##Type(XmlReader *reader) { \
+  return (Type*) xmlToDataStructure(reader, &prefix##JsonContainerOps); \
+} \
+ \
+/** @fn Type* xmlTo##Type(const char *inputData) */ \
+/** */ \
+/** @brief Take XML or SOAP data and return a Type of key-value objects. */ \
+/** The text is tokenized in place in a single pass. */ \
+/** */ \
+/** @param inputData is the full data string from a POST call. */ \
+/** */ \
+/** @return Returns a pointer to a new Type on success, NULL on failure. */ \
+Type* xmlTo##Type(const char *inputData) { \
+  printLog(TRACE, "ENTER xmlTo" #Type "(inputData=\"%s\")\n", \
+    (inputData != NULL) ? inputData : "NULL"); \
    \
-  *position += ((long long int) ((intptr_t) charAt)) \
-    - ((long long int) ((intptr_t) &jsonText[*position])); \
-  (*position)++; \
-  while ((*position >= 0) && (jsonText[*position] != '\0')) { \
-    *position += strspn(&jsonText[*position], " \t\r\n"); \
-    char charAtPosition = jsonText[*position]; \
-    if (charAtPosition == '}') { \
-      /* End of object. */ \
-      (*position)++; \
-      break; \
-    } else if (charAtPosition != '"') { \
-      printLog(ERR, "Malformed JSON input.\n"); \
-      returnValue = prefix##Destroy(returnValue);; \
-      printLog(TRACE, \
-        "EXIT jsonTo" #Type "(jsonText=\"%s\", position=%lld) = {NULL}\n", \
-        jsonText, *position); \
-      return NULL; \
-    } \
-    Bytes key = getBytesBetween(&jsonText[*position], "\"", "\":"); \
-    if (key == NULL) { \
-      printLog(ERR, "Malformed JSON input.\n"); \
-      returnValue = prefix##Destroy(returnValue);; \
-      printLog(TRACE, \
-        "EXIT jsonToList(jsonText=\"%s\", position=%lld) = {NULL}\n", \
-        jsonText, *position); \
-      return returnValue; \
-    } \
-    printLog(DEBUG, "Getting value for \"%s\".\n", key); \
-     \
-    /* Start of value is 3 past the start of name plus the name due to the */ \
-    /* double quotes, and colon. */ \
-    *position += bytesLength(key) + 3; \
-    *position += strspn(&jsonText[*position], " \t\r\n"); \
-    charAtPosition = jsonText[*position]; \
-    if ((charAtPosition != '"') && (charAtPosition != '{') \
-      && (charAtPosition != '[') && !stringIsNumber(&jsonText[*position]) \
-      && !stringIsBoolean(&jsonText[*position]) \
-      && (*((u32*) &jsonText[*position]) != *((u32*) "null")) \
-    ) { \
-      printLog(ERR, "Malformed JSON input.\n"); \
-      key = bytesDestroy(key); \
-      returnValue = prefix##Destroy(returnValue);; \
-      printLog(TRACE, \
-        "EXIT jsonTo" #Type "(jsonText=\"%s\", position=%lld) = {NULL}\n", \
-        jsonText, *position); \
-      return NULL; \
-    } \
-    if (charAtPosition == '"') { \
-      /* Get the string between the quotes. */ \
-      const char *startQuoteAt = &jsonText[*position]; \
-      const char *endQuoteAt = startQuoteAt + 1; \
-      while (*endQuoteAt != '"') { \
-        if (*endQuoteAt != '\\') { \
-          endQuoteAt++; \
-        } else { \
-          endQuoteAt += 2; \
-        } \
-      } \
-      Bytes stringValue = NULL; \
-      if (((uintptr_t) endQuoteAt) > ((uintptr_t) startQuoteAt)) { \
-        startQuoteAt++; \
-        u64 stringLength \
-          = ((uintptr_t) endQuoteAt) - ((uintptr_t) startQuoteAt); \
-        if (stringLength > 0) { \
-          /* The usual case. */ \
-          bytesAddData(&stringValue, startQuoteAt, stringLength); \
-        } else { \
-          /* Empty string. */ \
-          bytesAddStr(&stringValue, ""); \
-        } \
-      } \
-      if (stringValue == NULL) { \
-        printLog(ERR, "Malformed JSON input.\n"); \
-        key = bytesDestroy(key); \
-        returnValue = prefix##Destroy(returnValue);; \
-        printLog(TRACE, \
-          "EXIT jsonTo" #Type "(jsonText=\"%s\", position=%lld) = {NULL}\n", \
-          jsonText, *position); \
-        return NULL; \
-      } \
-      u64 skipLength = bytesLength(stringValue); \
-      /* Remove any backslash escapes that were injected by the protocol. */ \
-      u64 i = 0; \
-      for (u64 j = 0; j < skipLength; i++, j++) { \
-        if (stringValue[j] == '\\') { \
-          j++; \
-          if (stringValue[j] == 'n') { \
-            stringValue[i] = '\n'; \
-            continue; \
-          } \
-        } \
-        stringValue[i] = stringValue[j]; \
-      } \
-      bytesSetLength(stringValue, i); \
-      unescapeBytes(stringValue); \
-      Type##Node *node = prefix##AddEntry(returnValue, key, stringValue, typeBytesNoCopy); \
-      if (node != NULL) { \
-        node->type = typeBytes; \
-      } else { \
-        LOG_MALLOC_FAILURE(); \
-        returnValue = prefix##Destroy(returnValue); \
-        printLog(NEVER, \
-          "EXIT jsonTo" #Type "(jsonText=\"%s\", position=%lld) = {NULL}\n", \
-          jsonText, *position); \
-        return returnValue; \
-      } \
-      *position += skipLength + 2; \
-    } else if (stringIsNumber(&jsonText[*position])) { \
-      /* Parse the number. */ \
-      char *endpos = NULL; \
-      if (stringIsFloat(&jsonText[*position])) { \
-        double doubleValue = strtod(&jsonText[*position], &endpos); \
-        prefix##AddEntry(returnValue, key, &doubleValue, typeDouble); \
-      } else { /* stringIsInteger(&jsonText[*position]) */ \
-        i64 longLongValue = (i64) strtoll(&jsonText[*position], &endpos, 10); \
-        prefix##AddEntry(returnValue, key, &longLongValue, typeI64); \
-      } \
-      *position \
-        += ((long long int) ((intptr_t) endpos)) \
-        - ((long long int) ((intptr_t) &jsonText[*position])); \
-    } else if (stringIsBoolean(&jsonText[*position])) { \
-      /* Parse the boolean. */ \
-      char *endpos = NULL; \
-      bool boolValue = strtobool(&jsonText[*position], &endpos); \
-      prefix##AddEntry(returnValue, key, &boolValue, typeBool); \
-      *position \
-        += ((long long int) ((intptr_t) endpos)) \
-        - ((long long int) ((intptr_t) &jsonText[*position])); \
-    } else if (charAtPosition == '{') { \
-      /* Parse the key-value data structure. */ \
-      Type *dataStructure = jsonTo##Type(jsonText, position); \
-      if (dataStructure == NULL) { \
-        printLog(ERR, "Malformed JSON input.\n"); \
-        key = bytesDestroy(key); \
-        returnValue = prefix##Destroy(returnValue); \
-        printLog(TRACE, \
-          "EXIT jsonTo" #Type "(jsonText=\"%s\", position=%lld) = {NULL}\n", \
-          jsonText, *position); \
-        return returnValue; \
-      } \
-      Type##Node *node = prefix##AddEntry(returnValue, key, dataStructure, \
-        type##Type##NoCopy); \
-      node->type = type##Type; \
-      /* position is automatically updated in this case. */ \
-    } else if (charAtPosition == '[') { \
-      /* Parse the vector. */ \
-      Vector *vector = jsonToVector(jsonText, position); \
-      if (vector == NULL) { \
-        printLog(ERR, "Malformed JSON input.\n"); \
-        key = bytesDestroy(key); \
-        returnValue = prefix##Destroy(returnValue); \
-        printLog(TRACE, \
-          "EXIT jsonToList(jsonText=\"%s\", position=%lld) = {NULL}\n", \
-          jsonText, *position); \
-        return returnValue; \
-      } \
-      Type##Node *node = prefix##AddEntry(returnValue, key, vector, \
-        typeVectorNoCopy); \
-      node->type = typeVector; \
-      /* position is automatically updated in this case. */ \
-    } else { /* (strncmp(&jsonText[*position], "null", 4) == 0) */ \
-      prefix##AddEntry(returnValue, key, NULL, typePointer); \
-      *position += 4; \
-    } \
-    *position += strspn(&jsonText[*position], " \t\r\n"); \
-    if (jsonText[*position] == ',') { \
-      (*position)++; \
-    } \
-    key = bytesDestroy(key); \
+  Type *returnValue = NULL; \
+  if (inputData == NULL) { \
+    printLog(ERR, "NULL inputData provided.\n"); \
+  } else { \
+    XmlReader reader; \
+    xmlReaderInitString(&reader, inputData, strlen(inputData)); \
+    returnValue = xmlReaderTo##Type(&reader); \
+    xmlReaderDestroy(&reader); \
   } \
    \
-  printLog(TRACE, \
-    "EXIT jsonTo" #Type "(jsonText=\"%s\", position=%lld) = {%p}\n", \
-    jsonText, *position, returnValue); \
+  printLog(TRACE, "EXIT xmlTo" #Type "(inputData=\"%s\") = {%p}\n", \
+    (inputData != NULL) ? inputData : "NULL", returnValue); \
   return returnValue; \
 }
 
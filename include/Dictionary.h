@@ -47,6 +47,7 @@
 
 typedef RedBlackNode DictionaryEntry;
 typedef RedBlackTree Dictionary;
+typedef RedBlackTreeCursor DictionaryCursor;
 
 #ifdef __cplusplus
 extern "C"
@@ -85,6 +86,8 @@ void* dictionaryGetValue(const Dictionary *dictionary, const volatile void *key)
 extern int (*dictionaryCompare)(const Dictionary *dictionaryA, const Dictionary *dictionaryB);
 Dictionary *dictionaryCreate(TypeDescriptor *type);
 #define dictionaryToJson(dictionary) listToJson((List*) dictionary)
+#define dictionaryToJsonStream(dictionary, writer) \
+  listToJsonStream((List*) dictionary, writer)
 #define dictionaryToKeyValueString(dictionary) \
   listToKeyValueString((List*) dictionary)
 #define dictionaryCopy rbTreeCopy
@@ -92,9 +95,17 @@ Dictionary *dictionaryCreate(TypeDescriptor *type);
 #define dictionaryFromBlob(array, length, ...) \
   rbTreeFromBlob_(array, length, ##__VA_ARGS__, 0, 0)
 #define dictionaryToBlob(dictionary) \
-  listToBlob((List*) dictionary)
+  rbTreeToBlob((RedBlackTree*) dictionary)
+#define dictionaryBlobGetValue listBlobGetValue
 #define xmlToDictionary xmlToRedBlackTree
+#define xmlReaderToDictionary xmlReaderToRedBlackTree
 #define dictionaryDestroyNode rbTreeDestroyNode
+#define dictionaryLowerBound rbTreeLowerBound
+#define dictionaryUpperBound rbTreeUpperBound
+#define dictionaryRange rbTreeRange
+#define dictionaryCursorInit rbTreeCursorInit
+#define dictionaryCursorNext rbTreeCursorNext
+#define dictionaryCursorDestroy rbTreeCursorDestroy
 
 #ifdef __cplusplus
 } // extern "C"
@@ -413,14 +413,87 @@ void dirent_set_errno(int error);
 
 #endif // _WIN32
 
+#include <stdbool.h>
+#include <stdint.h>
+
+/// @enum DirectoryEntryType
+///
+/// @brief The kinds of entries that can be found in a directory.
+///
+/// @param ENTRY_TYPE_FILE A regular file.
+/// @param ENTRY_TYPE_DIRECTORY A directory.
+/// @param ENTRY_TYPE_SYMLINK A symbolic link.  Only reported by
+///   directoryWalk, which never follows links.
+/// @param ENTRY_TYPE_OTHER A device, FIFO, socket, or anything else.  Only
+///   reported by directoryWalk.
+/// @param NUM_ENTRY_TYPES The number of types in this enum.
 typedef enum DirectoryEntryType {
   ENTRY_TYPE_FILE,
   ENTRY_TYPE_DIRECTORY,
+  ENTRY_TYPE_SYMLINK,
+  ENTRY_TYPE_OTHER,
   NUM_ENTRY_TYPES
 } DirectoryEntryType;
 
+#ifndef DIRECTORY_WALK_BUFFER_SIZE
+/// The number of bytes of directory entries directoryWalk asks the kernel for
+/// at a time.
+#define DIRECTORY_WALK_BUFFER_SIZE (64 * 1024)
+#endif // DIRECTORY_WALK_BUFFER_SIZE
+
+// Values for the flags parameter of directoryWalk.
+/// Call the walk function a second time for each directory after everything
+/// beneath it has been visited.
+#define DIRECTORY_WALK_POST_ORDER 0x01
+
+// Values returned by a DirectoryWalkFunction.
+/// Keep walking, descending into the entry if it is a directory.
+#define DIRECTORY_WALK_CONTINUE 0
+/// Keep walking but don't descend into this directory.
+#define DIRECTORY_WALK_SKIP 1
+/// Stop the walk as soon as possible.
+#define DIRECTORY_WALK_STOP (-1)
+
+/// @struct DirectoryWalkEntry
+///
+/// @brief Information about an entry found by directoryWalk.
+///
+/// @param path The full path of the entry.
+/// @param name The last component of path.
+/// @param type The DirectoryEntryType of the entry, determined from the
+///   directory listing without a stat where the filesystem allows it.
+/// @param depth How many directories below the starting path the entry is.
+///   The starting path itself has a depth of 0.
+/// @param directoryFd A descriptor for the directory containing the entry,
+///   for use with the *at family of calls, or -1 if there isn't one (for the
+///   starting path, for post-order visits, and on platforms without them).
+/// @param postVisit Whether or not this is the post-order visit of a
+///   directory.
+typedef struct DirectoryWalkEntry {
+  const char         *path;
+  const char         *name;
+  DirectoryEntryType  type;
+  int                 depth;
+  int                 directoryFd;
+  bool                postVisit;
+} DirectoryWalkEntry;
+
+/// @typedef DirectoryWalkFunction
+///
+/// @brief Function called by directoryWalk for each entry.  When more than
+/// one thread is used, it is called concurrently from all of them.  Returns
+/// DIRECTORY_WALK_CONTINUE, DIRECTORY_WALK_SKIP, or DIRECTORY_WALK_STOP.
+typedef int (*DirectoryWalkFunction)(const DirectoryWalkEntry *entry,
+  void *context);
+
 int mkpath(const char *path, int mode);
-int rmdirRecursive(const char *directory);
+int rmdirRecursive_(const char *directory, uint32_t numThreads, ...);
+#define rmdirRecursive(directory, ...) \
+  rmdirRecursive_(directory, ##__VA_ARGS__, 1)
+int directoryWalk_(const char *path, DirectoryWalkFunction function,
+  void *context, uint32_t numThreads, int flags, ...);
+#define directoryWalk(path, function, context, numThreads, ...) \
+  directoryWalk_(path, function, context, numThreads, ##__VA_ARGS__, 0)
 char** destroyDirectoryEntries(char **directoryArray);
 char** getDirectoryEntries(const char *path);
 char **selectDirectoryEntries(const char *path, const char **directoryEntries,
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.14.2026
+///
+/// @file              FlatHashTable.h
+///
+/// @brief             This library contains the function and structure
+///                    definitions that make up the flat hash table data
+///                    structure.
+///
+/// @details           Unlike HashTable, which allocates a RedBlackNode for
+///                    every entry, a FlatHashTable stores its entries
+///                    directly in a single contiguous array and resolves
+///                    collisions with Robin Hood linear probing.  Keys and
+///                    values are managed with the same TypeDescriptor hooks
+///                    as the other data structures.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef FLAT_HASH_TABLE_H
+#define FLAT_HASH_TABLE_H
+
+#include <stdio.h>
+#include <string.h>
+
+#include "DataTypes.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def FLAT_HASH_TABLE_MIN_CAPACITY
+///
+/// @brief The minimum number of slots in a flat hash table.  This value must
+/// be a power of two.
+#define FLAT_HASH_TABLE_MIN_CAPACITY 16
+
+/// @def FLAT_HASH_TABLE_MAX_LOAD_PERCENTAGE
+///
+/// @brief The percentage of occupied slots at which a flat hash table will
+/// double its capacity.
+///
+/// @details Robin Hood probing keeps probe sequences short at high load, but
+/// the cost of an unsuccessful lookup grows sharply as the table approaches
+/// full, so don't set this too high.
+#ifndef FLAT_HASH_TABLE_MAX_LOAD_PERCENTAGE
+#define FLAT_HASH_TABLE_MAX_LOAD_PERCENTAGE 80
+#endif
+
+/// @struct FlatHashTableEntry
+///
+/// @brief A single slot in a flat hash table.
+///
+/// @param value A pointer to the value of the entry.
+/// @param type A pointer to the TypeDescriptor describing the value.
+/// @param key A pointer to the key of the entry.  NULL if the slot is empty.
+/// @param hash The full hash of the key.  This is cached so that the table
+///   can be resized and probed without rehashing or comparing keys.
+///
+/// @note Entries are stored inline in the table's array and are moved
+/// whenever the table is modified.  A pointer to an entry is only valid until
+/// the next add or remove on the same table.
+typedef struct FlatHashTableEntry {
+  // The first two items must be compatible with Variant.
+  volatile void *value;
+  TypeDescriptor *type;
+  void *key;
+  u64 hash;
+} FlatHashTableEntry;
+
+/// @struct FlatHashTable
+///
+/// @brief Flat hash table object definition.
+///
+/// @param size The number of entries in the table.
+/// @param keyType A pointer to a TypeDescriptor describing the keys used in
+///   the table.
+/// @param lock A pointer to a mutex that guards access to this table.
+/// @param lastAddedType TypeDescriptor describing the kind data for the last
+///   value added.
+/// @param capacity The number of slots in entries.  Always a power of two.
+/// @param entries The array of slots for the table.
+/// @param seed The seed passed to the hash function for every key in this
+///   table.  Chosen at random when the table is created.
+typedef struct FlatHashTable {
+  u64 size;
+  TypeDescriptor *keyType;
+  mtx_t *lock;
+  TypeDescriptor *lastAddedType;
+  u64 capacity;
+  FlatHashTableEntry *entries;
+  u64 seed;
+} FlatHashTable;
+
+FlatHashTable *fhtCreate_(TypeDescriptor *keyType, bool disableThreadSafety,
+  u64 size, ...);
+#define fhtCreate(keyType, ...) fhtCreate_(keyType, ##__VA_ARGS__, 0, 0)
+FlatHashTable* fhtDestroy(FlatHashTable *table);
+FlatHashTableEntry *fhtAddEntry_(FlatHashTable *table,
+  const volatile void *key, const volatile void *value,
+  TypeDescriptor *type, ...);
+#define fhtAddEntry(table, key, value, ...) \
+  fhtAddEntry_(table, key, value, ##__VA_ARGS__, NULL)
+FlatHashTableEntry *fhtGetEntry(const FlatHashTable *table,
+  const volatile void *key);
+void *fhtGetValue(const FlatHashTable *table, const volatile void *key);
+i32 fhtRemoveEntry(FlatHashTable *table, const volatile void *key);
+FlatHashTableEntry *fhtNextEntry(const FlatHashTable *table,
+  const FlatHashTableEntry *entry);
+char *fhtToString(const FlatHashTable *table);
+FlatHashTable *fhtCopy(const FlatHashTable *table);
+int fhtCompare(const FlatHashTable *tableA, const FlatHashTable *tableB);
+size_t fhtSize(const volatile void *value);
+i32 fhtClear(FlatHashTable *table);
+bool flatHashTableUnitTest();
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#if (defined __cplusplus) || (defined __STDC_VERSION__ && __STDC_VERSION__ >= 201710L)
+
+// This must come last and must come outside the extern "C" block.
+#include "TypeSafeFhtAdd.h"
+
+#endif // TypeSafeFhtAdd.h
+
+#endif // FLAT_HASH_TABLE_H
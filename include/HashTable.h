@@ -75,9 +75,88 @@ extern "C"
 /// experiments were done on Linux kernel 5.2.17.
 #define OPTIMAL_HASH_TABLE_SIZE 64
 
-HashTable *htCreate_(TypeDescriptor *keyType, bool disableThreadSafety, u64 size, ...);
-#define htCreate(keyType, ...) htCreate_(keyType, ##__VA_ARGS__, 0, 0)
+/// @def HASH_TABLE_MAX_LOAD_FACTOR
+///
+/// @brief The average number of entries per tree at which a hash table will
+/// double the number of trees it has.
+///
+/// @details The migration of entries from the old trees to the new ones is
+/// done a few trees at a time on subsequent adds, lookups, and removes so that
+/// no single call pays for rehashing the entire table.
+#ifndef HASH_TABLE_MAX_LOAD_FACTOR
+#define HASH_TABLE_MAX_LOAD_FACTOR 4
+#endif
+
+/// @def HASH_TABLE_REHASH_STEP_SIZE
+///
+/// @brief The number of non-empty trees to migrate per operation while a
+/// hash table resize is in progress.
+#ifndef HASH_TABLE_REHASH_STEP_SIZE
+#define HASH_TABLE_REHASH_STEP_SIZE 4
+#endif
+
+/// @def HASH_TABLE_MAX_LOCK_STRIPES
+///
+/// @brief The maximum number of reader/writer locks a lock-striped hash table
+/// will spread its trees across.
+///
+/// @details Operations that change the tree arrays of a table (starting or
+/// advancing a resize, clearing the table) have to hold every stripe, so more
+/// stripes make those operations slower.
+#ifndef HASH_TABLE_MAX_LOCK_STRIPES
+#define HASH_TABLE_MAX_LOCK_STRIPES 256
+#endif
+
+/// @def HASH_TABLE_STATS_MAX_DEPTH
+///
+/// @brief The number of elements in the bucketDepthHistogram of a
+/// HashTableStats.  The last element counts every bucket at least that deep.
+#define HASH_TABLE_STATS_MAX_DEPTH 16
+
+/// @struct HashTableStats
+///
+/// @brief The occupancy and approximate memory footprint of a HashTable as
+/// reported by htStats.  Each bucket is one of the red-black trees of the
+/// table and its depth is the number of entries in the tree.
+///
+/// @param size The number of entries in the table.
+/// @param tableSize The number of buckets in the table.
+/// @param oldTableSize The number of buckets in the array being migrated
+///   from if a resize is in progress, 0 otherwise.
+/// @param numLockStripes The number of lock stripes of the table.
+/// @param emptyBuckets The number of buckets with no entries.
+/// @param emptyBucketRatio emptyBuckets divided by the total number of
+///   buckets.
+/// @param averageBucketDepth The average number of entries in the buckets
+///   that are not empty.
+/// @param maxBucketDepth The number of entries in the deepest bucket.
+/// @param maxTreeHeight The height of the tallest tree, which is the most
+///   nodes a lookup has to visit.
+/// @param bucketDepthHistogram The number of buckets with each depth from 0 up
+///   to HASH_TABLE_STATS_MAX_DEPTH - 1.  A few very deep buckets while most
+///   are shallow points to keys that hash badly.
+/// @param memoryBytes The approximate number of bytes used by the table, its
+///   trees and nodes, and its keys and values.  Values that are themselves
+///   containers are only counted by the size of their top-level structure.
+typedef struct HashTableStats {
+  u64 size;
+  u64 tableSize;
+  u64 oldTableSize;
+  u64 numLockStripes;
+  u64 emptyBuckets;
+  double emptyBucketRatio;
+  double averageBucketDepth;
+  u64 maxBucketDepth;
+  u64 maxTreeHeight;
+  u64 bucketDepthHistogram[HASH_TABLE_STATS_MAX_DEPTH];
+  u64 memoryBytes;
+} HashTableStats;
+
+HashTable *htCreate_(TypeDescriptor *keyType, bool disableThreadSafety,
+  u64 size, u64 lockStripes, bool unlinkedNodes, ...);
+#define htCreate(keyType, ...) htCreate_(keyType, ##__VA_ARGS__, 0, 0, 0, 0)
 HashTable* htDestroy(HashTable *table);
+u64 htHashValue(TypeDescriptor *keyType, const volatile void *key, u64 seed);
 u64 htGetHash(const HashTable *table, const volatile void *key);
 HashNode *htAddEntry_(HashTable *table, const volatile void *key,
   const volatile void *value, TypeDescriptor *type, ...);
@@ -85,28 +164,37 @@ HashNode *htAddEntry_(HashTable *table, const volatile void *key,
 HashNode *htGetEntry(const HashTable *table, const volatile void *key);
 void *htGetValue(const HashTable *table, const volatile void *key);
 int htDestroyNode(HashTable *table, HashNode *node);
+HashTable *htLinkNodes(const HashTable *table);
 i32 htRemoveEntry(HashTable *table, const volatile void *key);
 char *htToString(const HashTable *table);
 #define htToXml(table, elementName, ...) \
-  listToXml_((const List*) table, elementName, ##__VA_ARGS__, false)
-#define htToList(table) listCopy((List*) table)
+  listToXml_((const List*) htLinkNodes(table), elementName, ##__VA_ARGS__, \
+    false)
+#define htToList(table) listCopy((List*) htLinkNodes(table))
 HashTable *xmlToHashTable(const char *inputData);
+HashTable *xmlReaderToHashTable(struct XmlReader *reader);
 HashTable *htFromBlob_(const volatile void *array, u64 *length, bool inPlaceData, bool disableThreadSafety, ...);
 #define htFromBlob(array, length, ...) \
   htFromBlob_(array, length, ##__VA_ARGS__, 0, 0)
 HashTable* listToHashTable(List *list);
-#define htToBlob(table) listToBlob((List*) table)
+Bytes htToBlob(const HashTable *table);
+u64 htToBlobBuffer(const HashTable *table, void *buffer, u64 bufferSize);
+#define htToBlobSize(table) listToBlobSize((List*) htLinkNodes(table))
+#define htBlobGetValue listBlobGetValue
 HashTable *htCopy(const HashTable *table);
 int htCompare(const HashTable *htA, const HashTable *htB);
-#define htToJson(table) listToJson((List*) table)
+#define htToJson(table) listToJson((List*) htLinkNodes(table))
+#define htToJsonStream(table, writer) \
+  listToJsonStream((List*) htLinkNodes(table), writer)
 HashTable* jsonToHashTable(const char *jsonText, long long int *position);
 i32 htClear(HashTable *table);
+int htStats(const HashTable *table, HashTableStats *stats);
 bool hashTableUnitTest();
 
 /// @def htSetKeyType
 ///
 /// @brief Set the key type for a hash table and all its subordinate red-black
-/// trees.
+/// trees, including any that are still awaiting migration from a resize.
 ///
 /// @note This macro is intended to be called when the the caller has already
 /// guaranteed that it has exclusive access to the table.  There are no mutex
@@ -121,7 +209,7 @@ bool hashTableUnitTest();
       break; \
     } \
     \
-    _table_->keyType = keyType; \
+    _table_->keyType = _keyType_; \
     RedBlackTree **cur = _table_->table; \
     for (u64 i = _table_->tableSize; i; i--) { \
       if (*cur != NULL) { \
@@ -129,6 +217,13 @@ bool hashTableUnitTest();
       } \
       cur++; \
     } \
+    cur = _table_->oldTable; \
+    for (u64 i = (cur != NULL) ? _table_->oldTableSize : 0; i; i--) { \
+      if (*cur != NULL) { \
+        (*cur)->keyType = _keyType_; \
+      } \
+      cur++; \
+    } \
   } while (0)
 
 #ifdef __cplusplus
@@ -48,8 +48,9 @@ extern "C"
 {
 #endif
 
-List *listCreate_(TypeDescriptor *keyType, bool disableThreadSafety, ...);
-#define listCreate(keyType, ...) listCreate_(keyType, ##__VA_ARGS__, 0)
+List *listCreate_(TypeDescriptor *keyType, bool disableThreadSafety,
+  bool pooledNodes, ...);
+#define listCreate(keyType, ...) listCreate_(keyType, ##__VA_ARGS__, 0, 0)
 ListNode *listAddFrontEntry_(List *list, const volatile void *key, const volatile void *value, TypeDescriptor *type, ...);
 #define listAddFrontEntry(list, key, value, ...) listAddFrontEntry_(list, key, value, ##__VA_ARGS__, NULL)
 ListNode *listAddBackEntry_(List *list, const volatile void *key, const volatile void *value, TypeDescriptor *type, ...);
@@ -66,6 +67,7 @@ List* listDestroy(List *list);
 char *listToString(const List *list);
 Bytes listToBytes(const List *list);
 List *xmlToList(const char *inputData);
+List *xmlReaderToList(struct XmlReader *reader);
 Bytes listToXml_(const List *list, const char *elementName, bool indent, ...);
 #define listToXml(list, elementName, ...) \
   listToXml_(list, elementName, ##__VA_ARGS__, false)
@@ -73,10 +75,21 @@ int listCompare(const List *listA, const List *listB);
 List *listCopy(const List *list);
 size_t listSize(const volatile void *value);
 Bytes listToBlob(const List *list);
+Bytes listToKeyedBlob(const List *list, bool listIsSorted);
+u64 listToBlobSize(const List *list);
+u64 listToBlobBuffer(const List *list, void *buffer, u64 bufferSize);
+u64 listToKeyedBlobBuffer(const List *list, bool listIsSorted, void *buffer,
+  u64 bufferSize);
 List *listFromBlob_(const volatile void *array, u64 *length, bool inPlaceData, bool disableThreadSafety, ...);
 #define listFromBlob(array, length, ...) \
   listFromBlob_(array, length, ##__VA_ARGS__, 0, 0)
+u64 listBlobSize(const volatile void *blob, u64 length);
+const void* listBlobGetIndex(const volatile void *blob, u64 length, u64 index,
+  const void **key, TypeDescriptor **type, u64 *valueLength);
+const void* listBlobGetValue(const volatile void *blob, u64 length,
+  const volatile void *key, TypeDescriptor **type, u64 *valueLength);
 Bytes listToJson(const List *list);
+bool listToJsonStream(const List *list, struct JsonWriter *writer);
 List* jsonToList(const char *jsonText, long long int *position);
 char* listToKeyValueString(const List *list, const char *separator);
 i32 listClear(List *list);
@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              LockStats.h
+///
+/// @brief             This library contains the definitions for optional
+///                    lock contention statistics.
+///
+/// @details           When the library is built with LOCK_STATS_ENABLED
+///                    defined, every mtx_lock call in a source file that
+///                    includes this header (after its other includes) is
+///                    counted per call site:  The number of acquisitions,
+///                    the number that had to wait because another thread
+///                    held the lock, the total and longest wait, and a
+///                    histogram of the waits.  lockStatsToJson reports the
+///                    sites that have been used so far.  Without
+///                    LOCK_STATS_ENABLED, mtx_lock is left alone and
+///                    lockStatsToJson reports no sites.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef LOCK_STATS_H
+#define LOCK_STATS_H
+
+#include "CThreads.h"
+#include "TypeDefinitions.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def LOCK_STATS_NUM_BUCKETS
+///
+/// @brief The number of buckets in a wait histogram.  Bucket 0 counts waits
+/// under 1 microsecond and each bucket after that doubles the limit, so the
+/// last bucket counts waits of about 1 second and longer.
+#define LOCK_STATS_NUM_BUCKETS 21
+
+/// @struct LockStatsSite
+///
+/// @brief The statistics of one mtx_lock call site.
+///
+/// @param lockName The text of the mutex argument, e.g. "list->lock".
+/// @param fileName The source file of the call.
+/// @param functionName The function the call is in.
+/// @param lineNumber The line of the call.
+/// @param acquisitions The number of times the lock was taken here.
+/// @param contended The number of acquisitions that had to wait.
+/// @param waitNanoseconds The total time spent waiting.
+/// @param maxWaitNanoseconds The longest wait.
+/// @param waitHistogram The number of waits in each bucket.
+/// @param registered Whether or not the site is on the list lockStatsToJson
+///   reports.
+/// @param next The next site on that list.
+typedef struct LockStatsSite {
+  const char *lockName;
+  const char *fileName;
+  const char *functionName;
+  int lineNumber;
+  u64 acquisitions;
+  u64 contended;
+  u64 waitNanoseconds;
+  u64 maxWaitNanoseconds;
+  u64 waitHistogram[LOCK_STATS_NUM_BUCKETS];
+  bool registered;
+  struct LockStatsSite *next;
+} LockStatsSite;
+
+int lockStatsLock(mtx_t *mtx, LockStatsSite *site);
+char* lockStatsToJson(void);
+void lockStatsReset(void);
+
+#ifdef LOCK_STATS_ENABLED
+
+/// @def mtx_lock(mtx)
+///
+/// @brief Lock a mutex through lockStatsLock with a LockStatsSite for this
+/// call site.
+#define mtx_lock(mtx) __extension__ ({ \
+  static LockStatsSite lockStatsSite_ = { \
+    #mtx, __FILE__, __func__, __LINE__, 0, 0, 0, 0, { 0 }, false, NULL \
+  }; \
+  lockStatsLock((mtx), &lockStatsSite_); \
+})
+
+#endif // LOCK_STATS_ENABLED
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // LOCK_STATS_H
+
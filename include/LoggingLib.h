@@ -58,6 +58,31 @@ extern "C"
 /// This is the size the logfile has to be before we roll over to a new file.
 #define LOG_ROLLOVER_SIZE (5 * 1024 * 1024) // 5 MB
 
+/// @def LOG_QUEUE_CAPACITY
+/// This is the number of messages that each thread can have waiting for the
+/// logging thread before its logging calls block.
+#define LOG_QUEUE_CAPACITY 4096
+
+/// @def LOG_WRITE_BUFFER_SIZE
+/// This is the size of the buffer the logging thread coalesces messages into
+/// before writing them to the log file.
+#define LOG_WRITE_BUFFER_SIZE (64 * 1024) // 64 KB
+
+/// @def LOG_WRITER_IDLE_WAIT_MS
+/// This is the longest the logging thread sleeps before checking for messages
+/// it wasn't woken up for.
+#define LOG_WRITER_IDLE_WAIT_MS 10
+
+/// @def LOG_BINARY_RECORD_MAGIC
+/// The value every record in a binary log begins with.  Reads as "LOGB" on
+/// little-endian hosts.
+#define LOG_BINARY_RECORD_MAGIC 0x42474f4c
+
+/// @def LOG_BINARY_RECORD_INITIAL_SIZE
+/// The number of bytes initially allocated for a binary log record.  Records
+/// with long string arguments grow past this.
+#define LOG_BINARY_RECORD_INITIAL_SIZE 256
+
 /// @def DEBUG_LOGFILE_POINTER
 /// This is the FILE pointer used to indicate that logging is running in debug
 /// mode and should provide extra output to stdout.
@@ -139,6 +164,14 @@ typedef enum LogLevel {
   NUM_LOG_LEVELS
 } LogLevel;
 
+/// @enum LogBinaryRecordType
+/// The kinds of records in a binary log.
+typedef enum LogBinaryRecordType {
+  LOG_BINARY_RECORD_STRING = 1, // The text of a string the log refers to
+  LOG_BINARY_RECORD_MESSAGE,    // A printLog call with its raw arguments
+  LOG_BINARY_RECORD_TEXT,       // A message that was formatted when logged
+} LogBinaryRecordType;
+
 /// @var LogLevelName
 /// The string representations of the LogLevel enum values.
 extern const char *LogLevelName[NUM_LOG_LEVELS];
@@ -184,9 +217,15 @@ bool tryLockResource(tss_t resource);
 void unlockResource(tss_t resource);
 void setThreadLogThreshold(LogLevel threadLogThreshold);
 void printStackTrace(LogLevel logLevel);
+size_t mallocSize(void *ptr);
 u64 loggingGetThreadId();
 LogLevel logLevelFromName(const char *levelName);
 void loggingFlush();
+int loggingSetRolloverPolicy(u64 maxSize, u64 maxAgeSeconds, bool compress,
+  u32 maxArchives);
+void loggingSetBinaryMode(bool binaryMode);
+bool loggingBinaryMode(void);
+int loggingDecodeBinaryLog(FILE *input, FILE *output);
 
 int setLogThreshold(LogLevel logLevel, const char *user);
 char *getTimestamp(struct timespec *time);
@@ -239,10 +278,36 @@ int printBinary_(const char *fileName, const char *functionName,
 #define LOGGING_ZERO ((void) 0)
 #endif
 
+/// @def LOG_COMPILE_MIN_LEVEL
+/// The lowest LogLevel to compile logging calls in at, e.g.
+/// -DLOG_COMPILE_MIN_LEVEL=INFO for a release build.  Calls at lower levels
+/// fold away at compile time along with their arguments.  WARN and above are
+/// always compiled in.
+#ifndef LOG_COMPILE_MIN_LEVEL
+#define LOG_COMPILE_MIN_LEVEL NEVER
+#endif
+
+/// @def LOG_UNLIKELY(condition)
+/// Branch prediction hint that a logging condition is usually false.
+#if defined __GNUC__ || defined __clang__
+#define LOG_UNLIKELY(condition) __builtin_expect(!!(condition), 0)
+#else
+#define LOG_UNLIKELY(condition) (condition)
+#endif
+
+/// @def logCompiledIn(logLevel)
+/// Determine whether or not logging calls at the specified level are compiled
+/// in.  This is a constant expression for a constant logLevel.
+#define logCompiledIn(logLevel) ( \
+  ((int) (logLevel) >= (int) (LOG_COMPILE_MIN_LEVEL)) \
+  || ((int) (logLevel) >= (int) WARN) \
+)
+
 /// @def shouldLog(logLevel)
 /// Determine whether or not logging should be done at the specified level.
 #define shouldLog(logLevel) ( \
-  (logLevel >= logThreshold) && (logLevel != NEVER) \
+  logCompiledIn(logLevel) \
+  && (logLevel >= logThreshold) && (logLevel != NEVER) \
   && (logThreshold != NONE) \
   && ((_threadLoggingThreshold_ == NULL) \
     || (logLevel >= ((uintptr_t) tss_get(*_threadLoggingThreshold_))) \
@@ -252,7 +317,7 @@ int printBinary_(const char *fileName, const char *functionName,
 /// @def printLog
 /// Wrapper macro that provides additional information to printLog_.
 #define printLog(logLevel, formatString, ...) ( \
-  (shouldLog(logLevel)) \
+  LOG_UNLIKELY(shouldLog(logLevel)) \
   ? printLog_(__FILE__, __func__, __LINE__, logLevel, formatString, ##__VA_ARGS__) \
   : LOGGING_ZERO \
 )
@@ -260,7 +325,7 @@ int printBinary_(const char *fileName, const char *functionName,
 /// @def printBinary
 /// Wrapper macro that provides additional information to printBinary_.
 #define printBinary(logLevel, data, length) ( \
-  (shouldLog(logLevel)) \
+  LOG_UNLIKELY(shouldLog(logLevel)) \
   ? printBinary_(__FILE__, __func__, __LINE__, logLevel, data, length) \
   : LOGGING_ZERO \
 )
@@ -268,7 +333,7 @@ int printBinary_(const char *fileName, const char *functionName,
 /// @def printBox
 /// Wrapper macro that provides additional information to printBox_.
 #define printBox(logLevel, formatString, ...) ( \
-  (shouldLog(logLevel)) \
+  LOG_UNLIKELY(shouldLog(logLevel)) \
   ? printBox_(__FILE__, __func__, __LINE__, logLevel, formatString, ##__VA_ARGS__) \
   : LOGGING_ZERO \
 )
@@ -276,7 +341,7 @@ int printBinary_(const char *fileName, const char *functionName,
 /// @def printBanner
 /// Wrapper macro that provides additional information to printBanner_.
 #define printBanner(logLevel, formatString, ...) ( \
-  (shouldLog(logLevel)) \
+  LOG_UNLIKELY(shouldLog(logLevel)) \
   ? printBanner_(__FILE__, __func__, __LINE__, logLevel, formatString, ##__VA_ARGS__) \
   : LOGGING_ZERO \
 )
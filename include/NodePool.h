@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              NodePool.h
+///
+/// @brief             This library contains the definitions for a slab
+///                    allocator for fixed-size container nodes.
+///
+/// @details           A NodePool carves nodes out of large slabs and keeps
+///                    released nodes on a free list for reuse, so containers
+///                    that add and remove entries at a high rate don't pay
+///                    for a malloc and free per entry, and nodes allocated
+///                    together sit next to each other in memory.  A pool
+///                    does no locking of its own.  It's owned by a single
+///                    container and is only used under that container's
+///                    lock.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stddef.h>
+
+#include "Allocator.h"
+#include "TypeDefinitions.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def NODE_POOL_MIN_SLAB_NODES
+///
+/// @brief The number of nodes in the first slab of a NodePool.  Each slab
+/// after that is twice the size of the one before it, up to
+/// NODE_POOL_MAX_SLAB_NODES.
+#define NODE_POOL_MIN_SLAB_NODES 64
+
+/// @def NODE_POOL_MAX_SLAB_NODES
+///
+/// @brief The largest number of nodes in a single slab of a NodePool.
+#define NODE_POOL_MAX_SLAB_NODES 4096
+
+/// @struct NodePoolSlab
+///
+/// @brief The header of one block of memory nodes are carved from.  The nodes
+/// immediately follow the header.
+///
+/// @param next The slab allocated before this one, if any.
+/// @param numNodes The number of nodes the slab holds.
+typedef struct NodePoolSlab {
+  struct NodePoolSlab *next;
+  u64 numNodes;
+} NodePoolSlab;
+
+/// @struct NodePool
+///
+/// @brief A slab allocator for nodes of a single size.
+///
+/// @param nodeSize The size of each node, rounded up to pointer alignment.
+/// @param freeList The most recently released node.  The first pointer of
+///   each released node points to the one released before it.
+/// @param nextNode The first node of the newest slab that has never been
+///   handed out.
+/// @param slabEnd The end of the newest slab.
+/// @param slabs The newest slab.
+/// @param nextSlabNodes The number of nodes to put in the next slab.
+/// @param subsystem The AllocatorSubsystem the pool's memory is counted
+///   against.
+/// @param type The TypeDescriptor the pool's memory is counted against, if
+///   any.
+typedef struct NodePool {
+  size_t nodeSize;
+  void *freeList;
+  char *nextNode;
+  char *slabEnd;
+  NodePoolSlab *slabs;
+  u64 nextSlabNodes;
+  AllocatorSubsystem subsystem;
+  const struct TypeDescriptor *type;
+} NodePool;
+
+NodePool* nodePoolCreate(size_t nodeSize, AllocatorSubsystem subsystem,
+  const struct TypeDescriptor *type);
+void* nodePoolAlloc(NodePool *nodePool, size_t size);
+void* nodePoolFree(NodePool *nodePool, void *node);
+NodePool* nodePoolDestroy(NodePool *nodePool);
+u64 nodePoolMemoryBytes(const NodePool *nodePool);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // NODE_POOL_H
+
@@ -0,0 +1,215 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              PersistentTree.h
+///
+/// @brief             This library contains the definitions for a persistent,
+///                    copy-on-write balanced tree whose readers take
+///                    consistent snapshots without locks.
+///
+/// @details           A PersistentTree is meant for data like configuration
+///                    and routing tables that are read constantly and changed
+///                    rarely.  A RedBlackTree makes every reader take the
+///                    tree's lock, and the usual way around that, building a
+///                    new tree with rbTreeCopy and swapping it in, copies
+///                    every node for every change.
+///
+///                    A PersistentTree is never modified in place.  A write
+///                    copies only the nodes on the path from the root to the
+///                    nodes it changes, O(log n) of them, links the copies to
+///                    the untouched subtrees of the previous version, and
+///                    publishes the new root with a single atomic store.
+///                    A reader loads the root once when it begins a snapshot
+///                    and sees exactly that version of the tree for as long
+///                    as the snapshot lasts, however many writes happen in
+///                    the meantime.  Readers never lock and never block
+///                    writers.  Writers are serialized with a mutex.
+///
+///                    Nodes replaced by a write are freed with the same
+///                    epoch scheme as adaptive RadixTrees:  once every
+///                    snapshot that began before the write has ended.  A
+///                    snapshot that is held for a long time therefore delays
+///                    the freeing of everything replaced since it began.
+///
+///                    The tree is a left-leaning red-black tree.  It's a
+///                    map:  Adding a key that is already present replaces
+///                    its value.  Keys and values are copied in with their
+///                    TypeDescriptors' copy functions and destroyed with
+///                    their destroy functions once they are no longer
+///                    reachable from any snapshot.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef PERSISTENT_TREE_H
+#define PERSISTENT_TREE_H
+
+#include "DataTypes.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def PERSISTENT_TREE_READER_STRIPES
+///
+/// @brief The number of counters the snapshots of a persistent tree are
+/// spread across.  This value must be a power of two.
+#ifndef PERSISTENT_TREE_READER_STRIPES
+#define PERSISTENT_TREE_READER_STRIPES 16
+#endif
+
+/// @struct PersistentTreeNode
+///
+/// @brief A node of a PersistentTree.  Nodes reachable from a snapshot are
+/// never modified, so readers may use them freely until the snapshot ends.
+///
+/// @param key The key of the entry.
+/// @param value The value of the entry.
+/// @param type The TypeDescriptor of the value.
+/// @param left The subtree of smaller keys or NULL.
+/// @param right The subtree of larger keys or NULL.
+/// @param size The number of nodes in the subtree rooted at this node.
+/// @param version The number of the write that created the node.  A write may
+///   only modify nodes it created itself.
+/// @param red Whether the link from the node's parent is red.
+/// @param ownsData Whether key and value are to be destroyed when the node
+///   is freed.  Only meaningful once the node has been retired.
+/// @param retiredNext The next node on the list the node is retired or
+///   reserved on.
+typedef struct PersistentTreeNode {
+  void *key;
+  void *value;
+  TypeDescriptor *type;
+  struct PersistentTreeNode *left;
+  struct PersistentTreeNode *right;
+  u64 size;
+  u64 version;
+  bool red;
+  bool ownsData;
+  struct PersistentTreeNode *retiredNext;
+} PersistentTreeNode;
+
+/// @union PersistentTreeReaderCount
+///
+/// @brief The number of snapshots of a persistent tree that began in each of
+/// the two most recent epoch parities, padded to its own cache line.
+///
+/// @var count The number of active snapshots per epoch parity.
+/// @var padding Padding to keep separate counters in separate cache lines.
+typedef union PersistentTreeReaderCount {
+  volatile i64 count[2];
+  u8 padding[64];
+} PersistentTreeReaderCount;
+
+/// @struct PersistentTree
+///
+/// @brief Persistent tree object definition.
+///
+/// @param keyType A pointer to a TypeDescriptor describing the keys used in
+///   the tree.
+/// @param root The root of the most recently published version of the tree.
+///   NULL if the tree is empty.  Only written by writers holding lock and
+///   only read by readers through a snapshot.
+/// @param lock The mutex that serializes writers.
+/// @param version The number of the current or most recent write.
+/// @param lastAddedType The TypeDescriptor of the most recently added value.
+/// @param reserve Nodes allocated ahead of a write so that the write can't
+///   fail halfway through.
+/// @param reserveCount The number of nodes in reserve.
+/// @param retired The nodes replaced or removed since the epoch last
+///   advanced.
+/// @param limbo The nodes retired before the epoch last advanced.  These are
+///   freed once every snapshot that began before that has ended.
+/// @param epoch The current reclamation epoch.  Snapshots are counted under
+///   the parity of the epoch they began in.
+/// @param readers The snapshot counters.
+typedef struct PersistentTree {
+  TypeDescriptor *keyType;
+  PersistentTreeNode *root;
+  mtx_t lock;
+  u64 version;
+  TypeDescriptor *lastAddedType;
+  PersistentTreeNode *reserve;
+  u64 reserveCount;
+  PersistentTreeNode *retired;
+  PersistentTreeNode *limbo;
+  volatile i64 epoch;
+  PersistentTreeReaderCount readers[PERSISTENT_TREE_READER_STRIPES];
+} PersistentTree;
+
+/// @struct PersistentTreeSnapshot
+///
+/// @brief One reader's consistent view of a PersistentTree.  Snapshots are
+/// usually declared on the stack and filled in by ptreeSnapshotBegin.
+///
+/// @param tree The tree the snapshot is of.
+/// @param root The root of the version of the tree the snapshot sees.
+/// @param token The token of the snapshot's read section.
+typedef struct PersistentTreeSnapshot {
+  PersistentTree *tree;
+  PersistentTreeNode *root;
+  i64 token;
+} PersistentTreeSnapshot;
+
+/// @typedef PersistentTreeRangeFunction
+///
+/// @brief Function called on each node visited by ptreeSnapshotRange.
+/// Returning false ends the walk.
+typedef bool (*PersistentTreeRangeFunction)(
+  const PersistentTreeNode *node, void *context);
+
+PersistentTree* ptreeCreate(TypeDescriptor *keyType);
+PersistentTree* ptreeDestroy(PersistentTree *tree);
+int ptreeAddEntry_(PersistentTree *tree, const volatile void *key,
+  const volatile void *value, TypeDescriptor *type, ...);
+#define ptreeAddEntry(tree, key, value, ...) \
+  ptreeAddEntry_(tree, key, value, ##__VA_ARGS__, NULL)
+int ptreeRemove(PersistentTree *tree, const volatile void *key);
+int ptreeAddRbTree(PersistentTree *tree, const RedBlackTree *source);
+u64 ptreeSize(PersistentTree *tree);
+void ptreeSynchronize(PersistentTree *tree);
+int ptreeSnapshotBegin(PersistentTree *tree,
+  PersistentTreeSnapshot *snapshot);
+void ptreeSnapshotEnd(PersistentTreeSnapshot *snapshot);
+const PersistentTreeNode* ptreeSnapshotGetEntry(
+  const PersistentTreeSnapshot *snapshot, const volatile void *key);
+void* ptreeSnapshotGetValue(const PersistentTreeSnapshot *snapshot,
+  const volatile void *key);
+u64 ptreeSnapshotSize(const PersistentTreeSnapshot *snapshot);
+u64 ptreeSnapshotRange(const PersistentTreeSnapshot *snapshot,
+  const volatile void *low, const volatile void *high,
+  PersistentTreeRangeFunction function, void *context);
+bool persistentTreeUnitTest();
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // PERSISTENT_TREE_H
+
@@ -87,6 +87,51 @@ int mtx_timedlock(mtx_t* mtx, const struct timespec* ts);
 int mtx_trylock(mtx_t *mtx);
 
 
+// Reader/writer lock support.  This is not part of C11.  Any number of
+// threads may hold the lock shared (read) at once, but only one may hold it
+// exclusive (write).  These locks are not recursive.
+typedef pthread_rwlock_t rwl_t;
+
+int rwl_init(rwl_t *rwl);
+int rwl_rdlock(rwl_t *rwl);
+int rwl_tryrdlock(rwl_t *rwl);
+int rwl_rdunlock(rwl_t *rwl);
+int rwl_wrlock(rwl_t *rwl);
+int rwl_trywrlock(rwl_t *rwl);
+int rwl_wrunlock(rwl_t *rwl);
+void rwl_destroy(rwl_t *rwl);
+
+
+// Light mutex and condition support.  These are not part of C11.  A light
+// mutex is never recursive and can't be locked with a timeout, but it's a
+// single word that is taken with one atomic operation when it's free and spins
+// briefly before sleeping when it isn't.  A light condition may only be used
+// with a light mutex.
+#ifdef __linux__
+typedef struct lmtx_t {
+  int state;        // 0 = unlocked, 1 = locked, 2 = locked with sleepers
+} lmtx_t;
+typedef struct lcnd_t {
+  unsigned int sequence;
+} lcnd_t;
+#else
+typedef pthread_mutex_t lmtx_t;
+typedef pthread_cond_t lcnd_t;
+#endif // __linux__
+
+int lmtx_init(lmtx_t *lmtx);
+int lmtx_lock(lmtx_t *lmtx);
+int lmtx_trylock(lmtx_t *lmtx);
+int lmtx_unlock(lmtx_t *lmtx);
+void lmtx_destroy(lmtx_t *lmtx);
+int lcnd_init(lcnd_t *cond);
+int lcnd_signal(lcnd_t *cond);
+int lcnd_broadcast(lcnd_t *cond);
+int lcnd_wait(lcnd_t *cond, lmtx_t *lmtx);
+int lcnd_timedwait(lcnd_t *cond, lmtx_t *lmtx, const struct timespec *ts);
+void lcnd_destroy(lcnd_t *cond);
+
+
 // Condition support.
 typedef pthread_cond_t cnd_t;
 
@@ -120,6 +165,25 @@ void thrd_yield(void);
 int thrd_terminate(thrd_t thr);
 
 
+// Extended thread creation support.  This is not part of C11.  Members left at
+// the values set by thrd_attr_init get the same defaults as thrd_create.
+// cpus restricts the thread to the listed CPUs.  numa_node makes the thread
+// prefer memory from that node and, if cpus is NULL, restricts it to the
+// node's CPUs.  CPU and NUMA placement are only supported on Linux and are
+// ignored elsewhere.  name is truncated to 15 characters.
+typedef struct thrd_attr_t {
+  const int *cpus;
+  size_t num_cpus;
+  int numa_node;
+  size_t stack_size;
+  const char *name;
+} thrd_attr_t;
+
+void thrd_attr_init(thrd_attr_t *attr);
+int thrd_create_ex(thrd_t *thr, const thrd_attr_t *attr,
+  thrd_start_t func, void *arg);
+
+
 // Thread-specific storage support.
 #define TSS_DTOR_ITERATIONS 4
 
@@ -45,6 +45,36 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
+#include "TypeDefinitions.h"
+
+/// @def POSIX_PROCESSES_SPAWN
+///
+/// @brief Defined when processes are launched with posix_spawn instead of
+/// fork().  This needs glibc 2.34 or later for
+/// posix_spawn_file_actions_addclosefrom_np and
+/// posix_spawn_file_actions_addchdir_np.
+#if defined(__GLIBC__) \
+  && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 34)))
+#define POSIX_PROCESSES_SPAWN
+#endif
+
+/// @def PROCESS_STDOUT_READY
+///
+/// @brief Event reported by processPoll when a process's stdout has data to
+/// read or has reached end of file.
+#define PROCESS_STDOUT_READY 0x01
+
+/// @def PROCESS_STDERR_READY
+///
+/// @brief Event reported by processPoll when a process's separate stderr has
+/// data to read or has reached end of file.
+#define PROCESS_STDERR_READY 0x02
+
+/// @def PROCESS_EXITED
+///
+/// @brief Event reported by processPoll when a process has exited.  The exit
+/// status is available from processExitStatus once this is reported.
+#define PROCESS_EXITED       0x04
 
 #ifdef __cplusplus
 extern "C"
@@ -57,23 +87,40 @@ extern "C"
 /// @param processId is the numerical ID of the process
 /// @param stdOut is the FILE object used to read data from the program
 /// @param stdIn is the FILE object used to write data to the program
+/// @param stdErr is the FILE object used to read the program's stderr, NULL
+///   if its stderr goes to stdOut
+/// @param pidFd is a pidfd for the process on Linux systems that support
+///   pidfd_open, -1 otherwise.  It becomes readable when the process exits.
+/// @param processStatus is the status collected by waitpid once the process
+///   has exited.
+/// @param exited is set to true once processStatus has been collected.
 /// @param killed is set to true when the process is forcibly killed,
 ///   false otherwise.
 typedef struct Process {
   uint32_t processId;
   FILE *stdOut;
   FILE *stdIn;
+  FILE *stdErr;
+  int pidFd;
   int processStatus;
+  bool exited;
   bool killed;
 } Process;
 
 
-Process* startProcess_(const char *commandLineArgs, const char *workingDirectory, char *environmentVariables[], ...);
-#define startProcess(commandLineArgs, ...) startProcess_(commandLineArgs, ##__VA_ARGS__, NULL, NULL)
+Process* startProcess_(const char *commandLineArgs, const char *workingDirectory, char *environmentVariables[], bool separateStderr, ...);
+#define startProcess(commandLineArgs, ...) startProcess_(commandLineArgs, ##__VA_ARGS__, 0, 0, 0)
 bool processHasExited(Process *process);
 int processExitStatus(Process *process);
 char* readProcessStdout_(Process *process, uint64_t *outputLength, ...);
 #define readProcessStdout(process, ...) readProcessStdout_(process, ##__VA_ARGS__, 0)
+char* readProcessStderr_(Process *process, uint64_t *outputLength, ...);
+#define readProcessStderr(process, ...) readProcessStderr_(process, ##__VA_ARGS__, 0)
+i64 processReadStdoutBytes(Process *process, Bytes *output);
+i64 processReadStderrBytes(Process *process, Bytes *output);
+int processPoll(Process **processes, int *events, u32 numProcesses,
+  int timeoutMilliseconds);
+int processWait(Process *process, int events, int timeoutMilliseconds);
 bool writeProcessStdin_(Process *process, const char *data, uint64_t dataLength, ...);
 #define writeProcessStdin(process, data, ...) writeProcessStdin_(process, data, ##__VA_ARGS__, NULL)
 Process* closeProcess(Process *process);
@@ -49,7 +49,64 @@ extern "C"
 {
 #endif
 
-Queue* queueCreate(TypeDescriptor *dataType);
+/// @enum RingQueueMode
+///
+/// @brief The concurrency guarantees a RingQueue is created with.
+///
+/// @param RING_QUEUE_SPSC Exactly one thread pushes and exactly one thread
+///   pops.  Neither side needs an atomic read-modify-write.
+/// @param RING_QUEUE_MPMC Any number of threads may push and pop
+///   concurrently.
+typedef enum RingQueueMode {
+  RING_QUEUE_SPSC,
+  RING_QUEUE_MPMC,
+  NUM_RING_QUEUE_MODES
+} RingQueueMode;
+
+/// @def RING_QUEUE_CACHE_LINE_SIZE
+///
+/// @brief The padding, in bytes, kept between the producer and consumer ends of
+/// a RingQueue so that they don't share a cache line.
+#define RING_QUEUE_CACHE_LINE_SIZE 64
+
+/// @struct RingQueueSlot
+///
+/// @brief One element of a RingQueue's ring.
+///
+/// @param sequence The position the slot is ready for.  Equal to the push
+///   position when the slot is free and to the push position plus one when it
+///   holds data.
+/// @param data The item held in the slot.
+typedef struct RingQueueSlot {
+  u64 sequence;
+  void *data;
+} RingQueueSlot;
+
+/// @struct RingQueue
+///
+/// @brief A bounded, lock-free FIFO queue backed by a fixed array of slots.
+/// Unlike Queue, pushing and popping never allocate or take a lock.
+///
+/// @param head The position of the next item to pop.
+/// @param tail The position of the next item to push.
+/// @param slots The ring of capacity slots.
+/// @param mask capacity - 1.  capacity is always a power of two.
+/// @param mode The RingQueueMode the queue was created with.
+/// @param dataType The TypeDescriptor used to copy pushed items and to destroy
+///   items left in the queue when it's destroyed.
+typedef struct RingQueue {
+  u64 head;
+  char headPadding[RING_QUEUE_CACHE_LINE_SIZE - sizeof(u64)];
+  u64 tail;
+  char tailPadding[RING_QUEUE_CACHE_LINE_SIZE - sizeof(u64)];
+  RingQueueSlot *slots;
+  u64 mask;
+  RingQueueMode mode;
+  TypeDescriptor *dataType;
+} RingQueue;
+
+Queue* queueCreate_(TypeDescriptor *dataType, bool pooledNodes, ...);
+#define queueCreate(dataType, ...) queueCreate_(dataType, ##__VA_ARGS__, 0)
 QueueNode* queuePushEntry_(Queue *queue,
   const volatile void *data, TypeDescriptor *type, ...);
 #define queuePushEntry(queue, data, ...) queuePushEntry_(queue, data, ##__VA_ARGS__, NULL)
@@ -60,12 +117,24 @@ int queueFlush(Queue *queue, int numItems);
 #define queueFlushAll(queue) \
   queueFlush(queue, (queue != NULL) ? queue->size : 0)
 #define queueToJson(queue) listToJson((List*) queue)
+#define queueToJsonStream(queue, writer) \
+  listToJsonStream((List*) queue, writer)
 #define queueIsEmpty(queue) (listLength((List*) queue) == 0)
 #define queueLength(queue) listLength((List*) queue)
 #define queueCompare(queueA, queueB) \
   listCompare((List*) queueA, (List*) queueB)
 bool queueUnitTest();
 
+RingQueue* ringQueueCreate(TypeDescriptor *dataType, u64 capacity,
+  RingQueueMode mode);
+bool ringQueuePush(RingQueue *ringQueue, const volatile void *data);
+void* ringQueuePop(RingQueue *ringQueue);
+u64 ringQueueLength(RingQueue *ringQueue);
+#define ringQueueIsEmpty(ringQueue) (ringQueueLength(ringQueue) == 0)
+#define ringQueueCapacity(ringQueue) \
+  (((ringQueue) != NULL) ? (ringQueue)->mask + 1 : 0)
+RingQueue* ringQueueDestroy(RingQueue *ringQueue);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
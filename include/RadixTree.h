@@ -66,18 +66,203 @@ typedef struct RadixTreeNode {
   struct RadixTreeNode *radixTreeNodes[RADIX_TREE_ARRAY_SIZE];
 } RadixTreeNode;
 
+/// @enum RadixTreeNodeType
+///
+/// @brief The layouts a node of an adaptive radix tree can have.
+///
+/// @var RADIX_TREE_LEAF A RadixTreeLeaf holding a full key and its value.
+/// @var RADIX_TREE_NODE4 A RadixTreeNode4 with up to 4 children.
+/// @var RADIX_TREE_NODE16 A RadixTreeNode16 with up to 16 children.
+/// @var RADIX_TREE_NODE48 A RadixTreeNode48 with up to 48 children.
+/// @var RADIX_TREE_NODE256 A RadixTreeNode256 with up to 256 children.
+typedef enum RadixTreeNodeType {
+  RADIX_TREE_LEAF,
+  RADIX_TREE_NODE4,
+  RADIX_TREE_NODE16,
+  RADIX_TREE_NODE48,
+  RADIX_TREE_NODE256,
+} RadixTreeNodeType;
+
+/// @struct RadixTreeAdaptiveNode
+///
+/// @brief Header common to every node of an adaptive radix tree.
+///
+/// @details Inner nodes of an adaptive tree are never modified once they are
+/// reachable from the root of the tree.  Every change to the structure of the
+/// tree builds new copies of the nodes along the path to the change and
+/// publishes them with a single compare-and-swap of the root.  The nodes
+/// that were replaced are retired to the tree's retired list since other
+/// threads may still be reading them.
+///
+/// @var type One of the RadixTreeNodeType values.
+/// @var numChildren The number of children of an inner node.
+/// @var prefixLength For inner nodes, the number of key elements compressed
+///   into this node.  For leaves, the number of elements in the key.
+/// @var prefix For inner nodes, the key elements compressed into this node in
+///   the order they are searched.  For leaves, the full key as it was
+///   provided.  This storage follows the node in the same allocation.
+/// @var leaf For inner nodes, the leaf of the key that ends at this node, if
+///   any.  Always NULL for leaves.
+/// @var retiredNext The next node in the retired list of the tree.
+typedef struct RadixTreeAdaptiveNode {
+  uint8_t type;
+  uint16_t numChildren;
+  size_t prefixLength;
+  RADIX_TREE_KEY_ELEMENT *prefix;
+  struct RadixTreeLeaf *leaf;
+  struct RadixTreeAdaptiveNode *retiredNext;
+} RadixTreeAdaptiveNode;
+
+/// @struct RadixTreeLeaf
+///
+/// @brief The node of an adaptive radix tree that holds a value.
+///
+/// @details Leaves hold their full key so that a key that shares no further
+/// elements with any other key needs no inner nodes below the point where it
+/// diverges.  Unlike inner nodes, leaves are shared by every version of the
+/// tree, so their values can be exchanged in place.
+///
+/// @var header The common node header.
+/// @var value A pointer to the value that exactly matches the key.
+typedef struct RadixTreeLeaf {
+  RadixTreeAdaptiveNode header;
+  volatile void *value;
+} RadixTreeLeaf;
+
+/// @struct RadixTreeNode4
+///
+/// @brief Inner node of an adaptive radix tree with up to 4 children.
+///
+/// @var header The common node header.
+/// @var keys The sorted key elements of the children.
+/// @var children The children corresponding to the elements of keys.
+typedef struct RadixTreeNode4 {
+  RadixTreeAdaptiveNode header;
+  RADIX_TREE_KEY_ELEMENT keys[4];
+  RadixTreeAdaptiveNode *children[4];
+} RadixTreeNode4;
+
+/// @struct RadixTreeNode16
+///
+/// @brief Inner node of an adaptive radix tree with up to 16 children.
+///
+/// @var header The common node header.
+/// @var keys The sorted key elements of the children.
+/// @var children The children corresponding to the elements of keys.
+typedef struct RadixTreeNode16 {
+  RadixTreeAdaptiveNode header;
+  RADIX_TREE_KEY_ELEMENT keys[16];
+  RadixTreeAdaptiveNode *children[16];
+} RadixTreeNode16;
+
+/// @struct RadixTreeNode48
+///
+/// @brief Inner node of an adaptive radix tree with up to 48 children.
+///
+/// @var header The common node header.
+/// @var childIndexes One more than the index within children of the child for
+///   each key element.  0 if there is no child for the element.
+/// @var children The children of the node.
+typedef struct RadixTreeNode48 {
+  RadixTreeAdaptiveNode header;
+  uint8_t childIndexes[RADIX_TREE_ARRAY_SIZE];
+  RadixTreeAdaptiveNode *children[48];
+} RadixTreeNode48;
+
+/// @struct RadixTreeNode256
+///
+/// @brief Inner node of an adaptive radix tree with a child pointer for every
+/// possible key element.
+///
+/// @var header The common node header.
+/// @var children The children of the node, indexed by key element.
+typedef struct RadixTreeNode256 {
+  RadixTreeAdaptiveNode header;
+  RadixTreeAdaptiveNode *children[RADIX_TREE_ARRAY_SIZE];
+} RadixTreeNode256;
+
+/// @def RADIX_TREE_READER_STRIPES
+///
+/// @brief The number of counters the readers of an adaptive radix tree are
+/// spread across.  This value must be a power of two.
+///
+/// @details Every read section increments and decrements one of these
+/// counters, so readers on different threads should mostly use different
+/// cache lines.
+#ifndef RADIX_TREE_READER_STRIPES
+#define RADIX_TREE_READER_STRIPES 16
+#endif
+
+/// @union RadixTreeReaderCount
+///
+/// @brief The number of readers of an adaptive radix tree that entered in
+/// each of the two most recent epoch parities, padded to its own cache line.
+///
+/// @var count The number of active readers per epoch parity.
+/// @var padding Padding to keep separate counters in separate cache lines.
+typedef union RadixTreeReaderCount {
+  volatile int64_t count[2];
+  uint8_t padding[64];
+} RadixTreeReaderCount;
+
 /// @struct RadixTree
 ///
 /// @brief Container for the radix tree.
 ///
 /// @var root A pointer to the top RadixTreeNode tree;
 /// @var destructor A tss_dtor_t function used to free the values of the tree.
+/// @var adaptive Whether or not this tree uses the adaptive node layouts
+///   instead of RadixTreeNodes.
+/// @var adaptiveRoot A pointer to the top node of an adaptive tree.  NULL if
+///   the tree is empty.
+/// @var retired The list of adaptive nodes that have been replaced or removed
+///   since the last time the epoch advanced.
+/// @var limbo The list of adaptive nodes that were retired before the last
+///   time the epoch advanced.  These are freed once every reader that entered
+///   before that has left.
+/// @var readers The reader counters of an adaptive tree.  NULL for trees of
+///   RadixTreeNodes.
+/// @var epoch The current reclamation epoch.  Readers are counted under the
+///   parity of the epoch they entered in.
+/// @var reclaiming Whether or not a thread is currently advancing the epoch.
 typedef struct RadixTree {
   RadixTreeNode *root;
   tss_dtor_t destructor;
+  bool adaptive;
+  RadixTreeAdaptiveNode *adaptiveRoot;
+  RadixTreeAdaptiveNode *retired;
+  RadixTreeAdaptiveNode *limbo;
+  RadixTreeReaderCount *readers;
+  volatile int64_t epoch;
+  volatile int64_t reclaiming;
 } RadixTree;
 
-RadixTree* radixTreeCreate(tss_dtor_t destructor);
+/// @struct RadixTreeStats
+///
+/// @brief The node counts, depth and approximate memory footprint of a
+/// RadixTree as reported by radixTreeStats.
+///
+/// @var adaptive Whether or not the tree uses the adaptive node layouts.
+/// @var numValues The number of values in the tree.
+/// @var numNodes The number of nodes in the tree, including the leaves of an
+///   adaptive tree.
+/// @var nodesByType For adaptive trees, the number of nodes of each
+///   RadixTreeNodeType.  All 0 for trees of RadixTreeNodes.
+/// @var maxDepth The number of nodes on the longest path from the root.
+/// @var memoryBytes The approximate number of bytes used by the tree and its
+///   nodes, not including the values.
+typedef struct RadixTreeStats {
+  bool adaptive;
+  uint64_t numValues;
+  uint64_t numNodes;
+  uint64_t nodesByType[RADIX_TREE_NODE256 + 1];
+  uint64_t maxDepth;
+  uint64_t memoryBytes;
+} RadixTreeStats;
+
+RadixTree* radixTreeCreate_(tss_dtor_t destructor, bool adaptive, ...);
+#define radixTreeCreate(destructor, ...) \
+  radixTreeCreate_(destructor, ##__VA_ARGS__, false, 0)
 RadixTree* radixTreeDestroy(RadixTree *tree);
 void* radixTreeGetValue(RadixTree *tree,
   const volatile void *key, size_t keySize);
@@ -95,6 +280,10 @@ int radixTreeDeleteValue(RadixTree *tree,
 int radixTreeDeleteValue2(RadixTree *tree1,
   const volatile void *key1, size_t keySize1,
   const volatile void *key2, size_t keySize2);
+int64_t radixTreeReadBegin(RadixTree *tree);
+void radixTreeReadEnd(RadixTree *tree, int64_t token);
+void radixTreeSynchronize(RadixTree *tree);
+int radixTreeStats(RadixTree *tree, RadixTreeStats *stats);
 
 #ifdef __cplusplus
 }
@@ -52,6 +52,11 @@ u64 getU48_(u64 upperBound, bool useProvidedSeed, u64 seed, ...);
 u32 getU32_(u32 upperBound, bool useProvidedSeed, u64 seed, ...);
 #define getU32(upperBound, ...) getU32_(upperBound, ##__VA_ARGS__, false, 0)
 u64 startRandom(u64 seed);
+u64 getRandomU64(void);
+void getRandomBytes(void *buffer, u64 length);
+bool getRandomCharacters(char *buffer, u64 length, const char *alphabet);
+Bytes bytesAddRandomCharacters(Bytes *buffer, u64 length,
+  const char *alphabet);
 char *getRandomString_(u32 length, const char *userAlphabet, ...);
 #define getRandomString(length, ...) \
   getRandomString_(length, ##__VA_ARGS__, NULL)
@@ -120,12 +120,67 @@ extern "C"
 // #define DEBUG_ASSERT 1
 
 
-RedBlackTree *rbTreeCreate_(TypeDescriptor *keyType, bool disableThreadSafety, ...);
-#define rbTreeCreate(keyType, ...) rbTreeCreate_(keyType, ##__VA_ARGS__, 0)
+/// @struct RedBlackTreeCursor
+///
+/// @brief State for walking a range of a RedBlackTree in batches with
+/// rbTreeCursorNext.
+///
+/// @param tree The tree being walked.
+/// @param low The smallest key to visit, NULL for no lower limit.
+/// @param high The largest key to visit, NULL for no upper limit.
+/// @param lastKey A copy of the key of the last node returned, NULL before the
+///   first batch.
+/// @param numLastKey The number of nodes with a key equal to lastKey that have
+///   already been returned.
+/// @param done Whether or not the walk is complete.
+typedef struct RedBlackTreeCursor {
+  const RedBlackTree *tree;
+  const volatile void *low;
+  const volatile void *high;
+  void *lastKey;
+  u64 numLastKey;
+  bool done;
+} RedBlackTreeCursor;
+
+/// @struct RedBlackTreeStats
+///
+/// @brief The shape and approximate memory footprint of a RedBlackTree as
+/// reported by rbTreeStats.
+///
+/// @param size The number of nodes in the tree.
+/// @param height The number of nodes on the longest path from the root to a
+///   leaf.  Lookups visit at most this many nodes.
+/// @param minimumHeight The height a perfectly balanced tree of the same size
+///   would have.  A red-black tree is never more than twice this.
+/// @param blackHeight The number of black nodes on every path from the root
+///   to a leaf.
+/// @param memoryBytes The approximate number of bytes used by the tree, its
+///   nodes, and its keys and values.  Values that are themselves containers
+///   are only counted by the size of their top-level structure.
+typedef struct RedBlackTreeStats {
+  u64 size;
+  u64 height;
+  u64 minimumHeight;
+  u64 blackHeight;
+  u64 memoryBytes;
+} RedBlackTreeStats;
+
+/// @typedef RedBlackTreeRangeFunction
+///
+/// @brief Function called on each node visited by rbTreeRange.  Returning
+/// false ends the walk.
+typedef bool (*RedBlackTreeRangeFunction)(RedBlackNode *node, void *context);
+
+RedBlackTree *rbTreeCreate_(TypeDescriptor *keyType, bool disableThreadSafety,
+  bool sharedLocking, bool pooledNodes, bool unlinkedNodes, ...);
+#define rbTreeCreate(keyType, ...) \
+  rbTreeCreate_(keyType, ##__VA_ARGS__, 0, 0, 0, 0)
 RedBlackNode *rbInsert_(RedBlackTree *tree, const volatile void *key,
   const volatile void *value, TypeDescriptor *type, ...);
 #define rbInsert(tree, key, value, ...) \
   rbInsert_(tree, key, value, ##__VA_ARGS__, NULL)
+RedBlackNode *rbTreeInsertNode(RedBlackTree *tree, RedBlackNode *x);
+RedBlackNode *rbTreeRemoveNode(RedBlackTree *tree, RedBlackNode *z);
 extern RedBlackNode* (*rbTreeAddEntry_)(RedBlackTree *tree,
   const volatile void *key, const volatile void *value, TypeDescriptor *type, ...);
 #define rbTreeAddEntry(tree, key, value, ...) \
@@ -140,22 +195,47 @@ RedBlackNode *rbTreePredecessor(RedBlackTree*, RedBlackNode*);
 RedBlackNode *rbTreeSuccessor(RedBlackTree*, RedBlackNode*);
 RedBlackNode *rbTreeFirst(RedBlackTree*);
 RedBlackNode *rbTreeLast(RedBlackTree *tree);
+RedBlackTree *rbTreeLinkNodes(const RedBlackTree *tree);
 List *rbEnumerate(const RedBlackTree *tree,
   const volatile void *low, const volatile void *high);
+RedBlackNode *rbTreeLowerBound(const RedBlackTree *tree,
+  const volatile void *key);
+RedBlackNode *rbTreeUpperBound(const RedBlackTree *tree,
+  const volatile void *key);
+u64 rbTreeRange(const RedBlackTree *tree, const volatile void *low,
+  const volatile void *high, RedBlackTreeRangeFunction function, void *context);
+void rbTreeCursorInit(RedBlackTreeCursor *cursor, const RedBlackTree *tree,
+  const volatile void *low, const volatile void *high);
+u64 rbTreeCursorNext(RedBlackTreeCursor *cursor, RedBlackNode **nodes,
+  u64 maxNodes);
+void rbTreeCursorDestroy(RedBlackTreeCursor *cursor);
 void rbAssert(bool assertion, const char *error);
 void *rbSafeMalloc(size_t size);
 #define rbTreeToXml(tree, elementName) \
-  listToXml((List*) tree, elementName)
-#define rbTreeToList(tree) listCopy((List*) tree)
-#define rbTreeToString(tree) listToString((List*) tree)
+  listToXml((List*) rbTreeLinkNodes(tree), elementName)
+#define rbTreeToList(tree) listCopy((List*) rbTreeLinkNodes(tree))
+#define rbTreeToString(tree) listToString((List*) rbTreeLinkNodes(tree))
 int rbTreeCompare(const RedBlackTree *treeA, const RedBlackTree *treeB);
 RedBlackTree *rbTreeCopy(const RedBlackTree *tree);
 RedBlackTree* listToRbTree(const List *list);
-#define rbTreeToBlob(tree) listToBlob((List*) tree)
-#define rbTreeToJson(tree) listToJson((List*) tree)
+RedBlackTree *rbTreeBuildSorted_(TypeDescriptor *keyType,
+  const volatile void *const *keys, const volatile void *const *values,
+  u64 numEntries, TypeDescriptor *type, ...);
+#define rbTreeBuildSorted(keyType, keys, values, numEntries, ...) \
+  rbTreeBuildSorted_(keyType, keys, values, numEntries, ##__VA_ARGS__, NULL)
+Bytes rbTreeToBlob(const RedBlackTree *tree);
+u64 rbTreeToBlobBuffer(const RedBlackTree *tree, void *buffer,
+  u64 bufferSize);
+#define rbTreeToBlobSize(tree) listToBlobSize((List*) rbTreeLinkNodes(tree))
+#define rbTreeBlobGetValue listBlobGetValue
+#define rbTreeToJson(tree) listToJson((List*) rbTreeLinkNodes(tree))
+#define rbTreeToJsonStream(tree, writer) \
+  listToJsonStream((List*) rbTreeLinkNodes(tree), writer)
 RedBlackTree* jsonToRedBlackTree(const char *jsonText, long long int *position);
 RedBlackTree *xmlToRedBlackTree(const char *inputData);
+RedBlackTree *xmlReaderToRedBlackTree(struct XmlReader *reader);
 i32 rbTreeClear(RedBlackTree *tree);
+int rbTreeStats(const RedBlackTree *tree, RedBlackTreeStats *stats);
 RedBlackTree *rbTreeFromBlob_(const volatile void *array, u64 *length, bool inPlaceData, bool disableThreadSafety, ...);
 #define rbTreeFromBlob(array, length, ...) \
   rbTreeFromBlob_(array, length, ##__VA_ARGS__, 0, 0)
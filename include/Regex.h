@@ -65,6 +65,9 @@
 #define MAX_REGEXP_OBJECTS  64    // Max number of regex symbols in expression.
 #define MAX_CHAR_CLASS_LENGTH  256    // Max length of character-class buffer in. Determines the size of buffer for chars in all char-classes in the expression.
 #define MAX_SUBEXPRESSIONS 20    // Max number of subexpressions when substituting with a replacement that matches part of a pattern.
+#define REGEX_DFA_MAX_POSITIONS 62    // Max number of atoms (after expanding {m,n}) in the automaton.  One bit per atom plus an accept bit and a mode bit must fit in a uint64_t.
+#define REGEX_DFA_MAX_STATES 256    // Max number of automaton states cached during one match.  The cache is flushed when it fills up.
+#define REGEX_DFA_MIN_TEXT_LENGTH 256    // Texts shorter than this go straight to the backtracking matcher.
 
 typedef enum RegexPatternType {
     REGEX_END_OF_PATTERN,     // is a sentinel used to indicate end-of-pattern
@@ -97,11 +100,33 @@ typedef struct RegexNode {
     };
 } RegexNode;
 
+// Automaton used to rule out text that can't match before the backtracking
+// matcher is run.  It accepts every string the backtracking matcher can match
+// (and, where the backtracking matcher has quirks or limits, possibly more), so
+// it's only ever used to skip work, never to decide that something matches.
+// States are sets of positions (atoms of the expanded pattern) and are built
+// lazily, one transition at a time, as the text is scanned.
+typedef struct RegexDfaProgram {
+    bool isPrepared;    // Whether the fields below have been filled in for the current pattern.
+    bool isUsable;      // Whether the pattern could be expressed as an automaton.
+    bool anchoredEnd;   // Whether the pattern ends in '$'.
+    uint8_t numPositions;
+    uint16_t numClasses;
+    int16_t firstByte;  // The only byte a match can start with, or -1.
+    uint64_t repeatMask;    // Positions that may match again after they've matched.
+    uint64_t closure[REGEX_DFA_MAX_POSITIONS + 1];  // Positions reachable before consuming anything from each position.
+    uint8_t byteClass[256];     // Bytes that no position tells apart share a class.
+    uint64_t classMask[256];    // Positions that match each byte class.
+    uint8_t literalLength;
+    unsigned char literal[MAX_REGEXP_OBJECTS];  // A string every match must contain.
+} RegexDfaProgram;
+
 typedef struct Regex {
     struct RegexNode compiledRegexArray[MAX_REGEXP_OBJECTS];
     unsigned char classCharArray[MAX_CHAR_CLASS_LENGTH];
     bool isPatternValid;
     const char *errorMessage;
+    RegexDfaProgram dfaProgram;
 } Regex;
 
 typedef struct Matcher {
@@ -128,6 +153,13 @@ void regexCompile(Regex *regex, const char *pattern);
 bool regexMatchMatcher(Regex *regex, const char *text, Matcher *matcher);
 Matcher regexMatch(Regex *regex, const char *text);
 
+// Build the automaton used to search long texts, which is otherwise built by
+// the first search that needs it.  A compiled regex isn't modified by searches
+// after this, so it may be shared between threads.
+void regexPrepareSearch(Regex *regex);
+
+bool regexUnitTest();
+
 // Substitute a matched regular expression with the provided replacement using
 // the provided output buffer.
 uint64_t substitute_(const char *haystack, const char *pattern,
@@ -140,6 +172,16 @@ uint64_t substitute_(const char *haystack, const char *pattern,
 #define substitute(haystack, pattern, replacement, greedy, buffer, bufferLength, ...) \
     substitute_(haystack, pattern, replacement, greedy, buffer, bufferLength, ##__VA_ARGS__, 0, 0)
 
+// Same as substitute but with a pattern that has already been compiled, so
+// that a pattern applied over and over is only compiled once.
+uint64_t substituteRegex_(const char *haystack, Regex *regex,
+    const char *replacement, bool greedy,
+    char *buffer, uint64_t bufferLength,
+    bool *successful, const char **errorMessage, ...);
+
+#define substituteRegex(haystack, regex, replacement, greedy, buffer, bufferLength, ...) \
+    substituteRegex_(haystack, regex, replacement, greedy, buffer, bufferLength, ##__VA_ARGS__, 0, 0)
+
 // Substitute a regular expression that contains one or more sub-expressions
 // delineated by \( and \) with a replacement that may contain references to
 // the matched sub-expressions using the provided output buffer.
@@ -153,6 +195,29 @@ uint64_t substituteMatch_(const char *haystack, const char *pattern,
 #define substituteMatch(haystack, pattern, replacement, greedy, buffer, bufferLength, ...) \
     substituteMatch_(haystack, pattern, replacement, greedy, buffer, bufferLength, ##__VA_ARGS__, 0, 0)
 
+// A pattern with \( \) sub-expressions, compiled once for use with
+// substituteSubexpressionRegex.  This is large, so allocate it rather than
+// putting it on the stack.
+typedef struct SubexpressionRegex {
+    Regex regexes[MAX_SUBEXPRESSIONS];
+    bool storeMatch[MAX_SUBEXPRESSIONS];    // Whether each piece was inside \( \).
+    int numSubexpressions;
+    bool isPatternValid;
+    const char *errorMessage;
+} SubexpressionRegex;
+
+void subexpressionRegexCompile(SubexpressionRegex *subexpressionRegex, const char *pattern);
+
+// Same as substituteMatch but with a pattern that has already been compiled.
+uint64_t substituteSubexpressionRegex_(const char *haystack,
+    SubexpressionRegex *subexpressionRegex,
+    const char *replacement, bool greedy,
+    char *buffer, uint64_t bufferLength,
+    bool *successful, const char **errorMessage, ...);
+
+#define substituteSubexpressionRegex(haystack, subexpressionRegex, replacement, greedy, buffer, bufferLength, ...) \
+    substituteSubexpressionRegex_(haystack, subexpressionRegex, replacement, greedy, buffer, bufferLength, ##__VA_ARGS__, 0, 0)
+
 // Apply successive patterns and replacements to an initial string using two
 // buffers provided.  substitutions must be a NULL-terminated array.  buffer
 // must be an array of (at least) two stirng buffers.  bufferLength must be
@@ -165,3 +230,33 @@ uint64_t substituteMultiple_(const char *haystack, Substitution *substitutions,
 
 #define substituteMultiple(haystack, substitutions, greedy, buffers, bufferLength, finalIndex, ...) \
     substituteMultiple_(haystack, substitutions, greedy, buffers, bufferLength, finalIndex, ##__VA_ARGS__, 0, 0, 0)
+
+// A set of substitutions compiled once and applied together.  Unlike
+// substituteMultiple, which runs each substitution over the output of the
+// previous one, a set makes a single pass over the haystack and, at each
+// point, replaces the leftmost match of any of its patterns (the earliest
+// pattern in the list wins ties).  Replacements are never rescanned.  The
+// pattern and replacement strings must outlive the set.  A set is not modified
+// when it's applied, so it may be shared between threads.
+typedef struct SubstitutionSet {
+    Regex *regexes;
+    const char **replacements;
+    uint64_t *replacementLengths;
+    uint64_t numSubstitutions;
+} SubstitutionSet;
+
+// Compile a NULL-terminated array of substitutions into a set.  Returns NULL
+// and sets errorMessage (if provided) if a pattern is invalid or memory can't
+// be allocated.
+SubstitutionSet* substitutionSetCreate(const Substitution *substitutions, const char **errorMessage);
+SubstitutionSet* substitutionSetDestroy(SubstitutionSet *substitutionSet);
+
+// Apply a substitution set to haystack using the provided output buffer.  If
+// greedy is false, each pattern is replaced at most once.  Returns the length
+// of the full output, which is more than was stored if the buffer was too small.
+uint64_t substitutionSetApply_(const SubstitutionSet *substitutionSet,
+    const char *haystack, bool greedy, char *buffer, uint64_t bufferLength,
+    bool *successful, const char **errorMessage, ...);
+
+#define substitutionSetApply(substitutionSet, haystack, greedy, buffer, bufferLength, ...) \
+    substitutionSetApply_(substitutionSet, haystack, greedy, buffer, bufferLength, ##__VA_ARGS__, 0, 0)
@@ -49,14 +49,57 @@ extern "C"
 #define MAX_SCOPE_VARS 512 // The minimum maximum number of variables per block.
 #endif
 
+#ifndef SCOPE_COMPACT_VARS
+#define SCOPE_COMPACT_VARS 16 // Entries on the stack in a compact Scope.
+#endif
+
+#ifndef SCOPE_SLOT_MAP_THRESHOLD
+#define SCOPE_SLOT_MAP_THRESHOLD 32 // Entries before a compact Scope hashes.
+#endif
+
+#ifndef ARENA_DEFAULT_SIZE
+#define ARENA_DEFAULT_SIZE 4096 // Bytes in an Arena's first chunk.
+#endif
+
+typedef struct ArenaChunk {
+  struct ArenaChunk *next; // The previously-filled chunk.
+  u8                *end;  // One past the last usable byte of this chunk.
+} ArenaChunk;
+
+typedef struct Arena {
+  ArenaChunk   *chunks;    // The chunk being allocated from, then older ones.
+  u8           *current;   // The next free byte in the first chunk.
+  u64           chunkSize; // The size of the next chunk to allocate.
+  struct Arena *previous;  // The Arena active on this thread before this one.
+} Arena;
+
+Arena* arenaCreate(u64 initialSize);
+Arena* arenaDestroy(Arena *arena);
+void* arenaAlloc(Arena *arena, u64 size);
+void* arenaRealloc(Arena *arena, void *pointer, u64 oldSize, u64 newSize);
+bool arenaOwns(const Arena *arena, const volatile void *pointer);
+Arena* arenaPush(Arena *arena);
+Arena* arenaPop(Arena *arena);
+Arena* arenaCurrent(void);
+Arena* arenaFind(const volatile void *pointer);
+
 typedef struct VariableAndDestructor {
   volatile void* variable;
   Destructor     destructor;
 } VariableAndDestructor;
 
+// entries points at variablesAndDestructors until a compact Scope outgrows it
+// and spills to the heap.  slotMap is an open-addressed table of entry index
+// plus one (0 is empty) keyed by each entry's variable.  It's only built for
+// compact Scopes with at least SCOPE_SLOT_MAP_THRESHOLD entries.
 typedef struct Scope {
   u64            numVars;
   u64            maxVars;
+  Arena         *arena;
+  VariableAndDestructor *entries;
+  u64           *slotMap;
+  u64            slotMapSize;
+  bool           growable;
   VariableAndDestructor variablesAndDestructors[MAX_SCOPE_VARS];
 } Scope;
 
@@ -64,12 +107,28 @@ typedef struct Scope {
   struct Scope##scopeSize { \
     u64            numVars; \
     u64            maxVars; \
+    Arena         *arena; \
+    VariableAndDestructor *entries; \
+    u64           *slotMap; \
+    u64            slotMapSize; \
+    bool           growable; \
     VariableAndDestructor variablesAndDestructors[scopeSize]; \
   }; \
    \
   struct Scope##scopeSize _scope_; \
   _scope_.numVars = 0; \
   _scope_.maxVars = scopeSize; \
+  _scope_.arena = NULL; \
+  _scope_.entries = _scope_.variablesAndDestructors; \
+  _scope_.slotMap = NULL; \
+  _scope_.slotMapSize = 0; \
+  _scope_.growable = false; \
+
+// A compact Scope starts with SCOPE_COMPACT_VARS entries on the stack and
+// grows on the heap instead of destroying pointers when it fills up.
+#define scopeBeginCompact() \
+  scopeBegin(SCOPE_COMPACT_VARS) \
+  _scope_.growable = true; \
 
 void* scopeAdd_(Scope *scope, volatile void *pointer, ...);
 #define scopeAdd(pointer, ...) \
@@ -93,17 +152,25 @@ void* scopeUpdate_(Scope *scope, volatile void *oldPointer, volatile void *newPo
   }
 #define scopeRemove(oldPointer) \
   scopeUpdate_((Scope*) &_scope_, (oldPointer), NULL)
+Arena* scopeArena_(Scope *scope, u64 initialSize, ...);
+#define scopeArena(...) \
+  scopeArena_((Scope*) &_scope_, ##__VA_ARGS__, ARENA_DEFAULT_SIZE)
 
 #define SCOPE_ENTER(argFormat, ...) \
   printLog(TRACE, "ENTER %s(" argFormat ")", __func__, ##__VA_ARGS__); \
   scopeBegin(MAX_SCOPE_VARS);
+#define SCOPE_ENTER_COMPACT(argFormat, ...) \
+  printLog(TRACE, "ENTER %s(" argFormat ")", __func__, ##__VA_ARGS__); \
+  scopeBeginCompact();
 #define SCOPE_EXIT(argFormat, returnFormat, ...) \
   printLog(TRACE, "EXIT %s(" argFormat ") = {" returnFormat "}", __func__, ##__VA_ARGS__); \
   scopeEnd_((Scope*) &_scope_);
 
 int scopeEnd_(Scope *scope);
 #define scopeEnd() \
-  ((_scope_.numVars > 0) ? scopeEnd_((Scope*) &_scope_) : TRINARY_ZERO)
+  (((_scope_.numVars > 0) || (_scope_.arena != NULL) \
+    || (_scope_.entries != _scope_.variablesAndDestructors)) \
+    ? scopeEnd_((Scope*) &_scope_) : TRINARY_ZERO)
 
 bool scopeUnitTest();
 
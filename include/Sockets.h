@@ -44,6 +44,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <signal.h>
 
 #include "StringLib.h"
@@ -118,6 +119,9 @@ extern "C"
 
 // Value definitions
 #define JUMBO_FRAME_SIZE 9000
+// Smallest send that uses MSG_ZEROCOPY when zero-copy is enabled.  Below this,
+// pinning the pages costs more than the copy saves.
+#define SOCKET_ZEROCOPY_MIN_LENGTH 16384
 
 // Type definitions
 typedef enum SocketType {
@@ -141,6 +145,36 @@ typedef enum SocketProtocol {
 } SocketProtocol;
 extern const char *SocketProtocolNames[];
 
+// One buffer of a scatter/gather send or receive.
+typedef struct SocketIoVector {
+  void *base;
+  size_t length;
+} SocketIoVector;
+
+// One datagram of a batched UDP send or receive.  For a send, length is the
+// number of bytes at base and address is the destination, or the socket's own
+// address if its family is 0.  For a receive, length is the size of the buffer
+// at base on input and the size of the datagram on output, address is filled
+// in with the sender, and truncated is set if the datagram didn't fit.
+typedef struct SocketDatagram {
+  void *base;
+  size_t length;
+  struct sockaddr_in address;
+  bool truncated;
+} SocketDatagram;
+
+// A fixed ring of preallocated datagram buffers that socketReceiveRing
+// receives straight into.  Received datagrams are consumed in order with
+// socketDatagramRingPeek and socketDatagramRingPop.
+typedef struct SocketDatagramRing {
+  SocketDatagram *datagrams;
+  char *buffers;
+  size_t bufferSize;
+  u32 capacity;
+  u32 head;
+  u32 count;
+} SocketDatagramRing;
+
 typedef struct Socket {
   int sockfd;
   SocketType socketType;
@@ -150,6 +184,7 @@ typedef struct Socket {
   struct sockaddr_in sockaddr;
   bool blocking;
   bool tcpConnected;
+  bool zeroCopy;
   mtx_t lock;
 #ifdef TLS_SOCKETS_ENABLED
   SSL_CTX *sslContext;
@@ -176,24 +211,100 @@ Socket* socketCreate_(SocketType socketType, SocketProtocol socketProtocol,
   int timeoutMilliseconds, ...);
 #define socketCreate(socketType, socketProtocol, address, ...) \
   socketCreate_(socketType, socketProtocol, address, ##__VA_ARGS__, 0, 0, 0, 0)
+Socket* socketCreateReusePort_(const char *address, int socketMode,
+  const char *certificate, const char *key, ...);
+#define socketCreateReusePort(address, ...) \
+  socketCreateReusePort_(address, ##__VA_ARGS__, 0, 0, 0)
 void getIpAddress(char **address);
 size_t getAddressSize(const char *address);
 char *getNetworkAddress(const char *address, size_t numFixedBits);
 Socket* socketDestroy(Socket *sock);
 int socketSend(Socket *sock, const volatile void *buf, int len);
+bool socketJsonWriterSink(void *sock, const volatile void *data, u64 length);
+#define jsonWriterInitSocket(writer, sock) \
+  jsonWriterInit((writer), socketJsonWriterSink, (sock))
+i64 socketXmlReaderSource(void *sock, void *buffer, u64 length);
+#define xmlReaderInitSocket(reader, sock) \
+  xmlReaderInit((reader), socketXmlReaderSource, (sock))
 int socketReceive_(Socket *sock, volatile void *buf, int len, int timeoutMilliseconds,
   ...);
 #define socketReceive(sock, buf, len, ...) \
   socketReceive_(sock, buf, len, ##__VA_ARGS__, -1)
+int socketSendv(Socket *sock, const SocketIoVector *vectors, int numVectors);
+int socketReceivev_(Socket *sock, SocketIoVector *vectors, int numVectors,
+  int timeoutMilliseconds, ...);
+#define socketReceivev(sock, vectors, numVectors, ...) \
+  socketReceivev_(sock, vectors, numVectors, ##__VA_ARGS__, -1)
+int socketSendBatch(Socket *sock, const SocketDatagram *datagrams,
+  int numDatagrams);
+int socketReceiveBatch_(Socket *sock, SocketDatagram *datagrams,
+  int numDatagrams, int timeoutMilliseconds, ...);
+#define socketReceiveBatch(sock, datagrams, numDatagrams, ...) \
+  socketReceiveBatch_(sock, datagrams, numDatagrams, ##__VA_ARGS__, -1)
+SocketDatagramRing* socketDatagramRingCreate(u32 capacity, size_t bufferSize);
+SocketDatagramRing* socketDatagramRingDestroy(SocketDatagramRing *ring);
+SocketDatagram* socketDatagramRingPeek(SocketDatagramRing *ring);
+int socketDatagramRingPop(SocketDatagramRing *ring);
+int socketReceiveRing_(Socket *sock, SocketDatagramRing *ring,
+  int timeoutMilliseconds, ...);
+#define socketReceiveRing(sock, ring, ...) \
+  socketReceiveRing_(sock, ring, ##__VA_ARGS__, -1)
+int64_t socketSendFile(Socket *sock, int fd, int64_t offset, int64_t count);
+int socketSetZeroCopy(Socket *sock, bool enabled);
 Socket* socketAccept_(Socket *serverSocket, void *buf, int len, ...);
 #define socketAccept(serverSocket, ...) \
   socketAccept_(serverSocket, ##__VA_ARGS__, 0, 0)
+int socketAcceptBatch(Socket *serverSocket, Socket **clientSockets,
+  int maxSockets, int timeoutMilliseconds);
 const char* socketAddress(Socket *sock);
 const char* socketToString(Socket *sock);
 #ifdef TLS_SOCKETS_ENABLED
 int configureTlsClientSocket(Socket *sock, int timeoutMilliseconds);
 bool tlsKeyAndCertificateValid(const char *certificate, const char *key);
+void tlsContextCacheClear(void);
+void tlsSetKernelOffload(bool enabled);
+bool tlsKernelOffload(void);
 #endif // TLS_SOCKETS_ENABLED
+bool socketKernelTlsActive(Socket *sock);
+
+// Client connection pool.  A SocketPool keeps connected client sockets open
+// between uses so that repeated requests to a destination don't each pay for
+// a TCP connection and TLS handshake.
+typedef struct SocketPool SocketPool;
+SocketPool* socketPoolCreate(u32 maxSocketsPerDestination,
+  int idleTimeoutMilliseconds);
+SocketPool* socketPoolDestroy(SocketPool *pool);
+Socket* socketPoolAcquire_(SocketPool *pool, SocketProtocol socketProtocol,
+  const char *address, int socketMode, int timeoutMilliseconds, ...);
+#define socketPoolAcquire(pool, socketProtocol, address, ...) \
+  socketPoolAcquire_(pool, socketProtocol, address, ##__VA_ARGS__, 0, 0)
+int socketPoolRelease(SocketPool *pool, Socket *sock, bool reusable);
+u32 socketPoolNumIdle(SocketPool *pool);
+
+// Reactor definitions.  A SocketReactor parks the running Coroutine while a
+// socket is not ready and resumes it when it is.
+#define SOCKET_READABLE 0x1
+#define SOCKET_WRITABLE 0x2
+typedef struct SocketReactor SocketReactor;
+
+// Reactor functions
+SocketReactor* socketReactorCreate(void);
+SocketReactor* socketReactorDestroy(SocketReactor *reactor);
+int socketReactorRun(SocketReactor *reactor, int timeoutMilliseconds);
+size_t socketReactorNumWaiters(SocketReactor *reactor);
+void socketSetIoUring(bool enabled);
+bool socketIoUring(void);
+bool socketReactorUsesIoUring(SocketReactor *reactor);
+int socketReactorWait(SocketReactor *reactor, Socket *sock, int events,
+  int timeoutMilliseconds);
+int socketReactorConnect(SocketReactor *reactor, int sockfd,
+  const struct sockaddr *address, int addressLength, int timeoutMilliseconds);
+Socket* socketReactorAccept(SocketReactor *reactor, Socket *serverSocket,
+  int timeoutMilliseconds);
+int socketReactorSend(SocketReactor *reactor, Socket *sock,
+  const volatile void *buf, int len, int timeoutMilliseconds);
+int socketReactorReceive(SocketReactor *reactor, Socket *sock,
+  volatile void *buf, int len, int timeoutMilliseconds);
 
 #ifdef __cplusplus
 }
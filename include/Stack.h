@@ -49,7 +49,8 @@ extern "C"
 {
 #endif
 
-Stack *stackCreate(TypeDescriptor *dataType);
+Stack *stackCreate_(TypeDescriptor *dataType, bool pooledNodes, ...);
+#define stackCreate(dataType, ...) stackCreate_(dataType, ##__VA_ARGS__, 0)
 StackNode *stackPushEntry_(Stack *stack,
   const volatile void *data, TypeDescriptor *type, ...);
 #define stackPushEntry(stack, data, ...) stackPushEntry_(stack, data, ##__VA_ARGS__, NULL)
@@ -60,6 +61,8 @@ int stackFlush(Stack *stack, int numItems);
 #define stackFlushAll(stack) \
   stackFlush(stack, (stack != NULL) ? stack->size : 0)
 #define stackToJson(stack) listToJson((List*) stack)
+#define stackToJsonStream(stack, writer) \
+  listToJsonStream((List*) stack, writer)
 #define stackCompare(stackA, stackB) \
   listCompare((List*) stackA, (List*) stackB)
 bool stackUnitTest();
@@ -60,6 +60,195 @@ extern "C"
 #define strOrNull(str) ((str != NULL) ? ((char*) str) : "NULL")
 #define strOrEmpty(str) ((str != NULL) ? ((char*) str) : "")
 
+/// @def LINE_READER_BUFFER_SIZE
+///
+/// @brief The default number of bytes a LineReader reads from its file at a
+/// time.
+#define LINE_READER_BUFFER_SIZE (64 * 1024)
+
+/// @struct LineReader
+///
+/// @brief State for reading a file one line at a time through a large buffer.
+///
+/// @param file The file being read.  Not owned by the LineReader.
+/// @param buffer The read buffer.  Lines are returned as slices of it.
+/// @param bufferSize The number of bytes allocated for buffer.
+/// @param start The offset in buffer of the first unconsumed byte.
+/// @param end The offset in buffer one past the last byte read.
+/// @param searched The offset in buffer up to which no newline was found.
+/// @param eof Whether or not the end of file has been reached.
+typedef struct LineReader {
+  FILE *file;
+  char *buffer;
+  u64 bufferSize;
+  u64 start;
+  u64 end;
+  u64 searched;
+  bool eof;
+} LineReader;
+
+/// @struct CodecStream
+///
+/// @brief State carried between the chunks of a streaming hex or Base64
+/// encode or decode.
+///
+/// @param pending Input left over from the previous chunk that did not make a
+///   complete group.
+/// @param numPending The number of valid bytes in pending.
+typedef struct CodecStream {
+  u8 pending[4];
+  u8 numPending;
+} CodecStream;
+
+/// @def CODEC_STREAM_INITIALIZER
+///
+/// @brief Initial value for a CodecStream.
+#define CODEC_STREAM_INITIALIZER { { 0, 0, 0, 0 }, 0 }
+
+/// @def JSON_WRITER_BUFFER_SIZE
+///
+/// @brief The number of bytes a JsonWriter collects before handing them to its
+/// sink.
+#define JSON_WRITER_BUFFER_SIZE 4096
+
+/// @typedef JsonWriterSink
+///
+/// @brief Function that receives the output of a JsonWriter.  Returns true if
+/// all length bytes were consumed, false on error.
+typedef bool (*JsonWriterSink)(void *context,
+  const volatile void *data, u64 length);
+
+/// @struct JsonWriter
+///
+/// @brief Buffered, indenting output stream that the toJsonStream functions
+/// write to.  Memory use is fixed no matter how large the document is.
+///
+/// @param sink The function that receives each full buffer.
+/// @param context The first parameter passed to sink (a FILE*, Bytes*, etc.).
+/// @param indent The number of spaces written after every newline.
+/// @param indentPending Whether or not a newline was written and the indent
+///   that follows it has not been yet.
+/// @param failed Whether or not the sink has reported an error.  Once set,
+///   all further writes are discarded.
+/// @param bufferLength The number of bytes currently in buffer.
+/// @param buffer Output that has not been handed to sink yet.
+typedef struct JsonWriter {
+  JsonWriterSink sink;
+  void *context;
+  u64 indent;
+  bool indentPending;
+  bool failed;
+  u64 bufferLength;
+  char buffer[JSON_WRITER_BUFFER_SIZE];
+} JsonWriter;
+
+/// @def JSON_SAX_MAX_DEPTH
+///
+/// @brief The deepest nesting of objects and arrays jsonSaxParse accepts.
+#define JSON_SAX_MAX_DEPTH 1024
+
+/// @struct JsonSaxHandler
+///
+/// @brief Callbacks that jsonSaxParse makes as it reads a JSON document.  Any
+/// member may be NULL, in which case that event is ignored.  Returning false
+/// from a callback stops the parse, and jsonSaxParse then returns false.
+///
+/// @param startObject Called for each '{'.
+/// @param endObject Called for each '}'.
+/// @param startArray Called for each '['.
+/// @param endArray Called for each ']'.
+/// @param key Called with each object key.  The key is passed as it appears
+///   in the input, without its quotes and with any escapes still in place.
+///   It is not NUL-terminated.
+/// @param string Called with each string value, in the same form as keys.
+/// @param integer Called with each number that has no fraction or exponent
+///   and fits in an i64.
+/// @param floatingPoint Called with every other number.
+/// @param boolean Called with each true or false.
+/// @param null Called with each null.
+typedef struct JsonSaxHandler {
+  bool (*startObject)(void *context);
+  bool (*endObject)(void *context);
+  bool (*startArray)(void *context);
+  bool (*endArray)(void *context);
+  bool (*key)(void *context, const char *key, u64 keyLength);
+  bool (*string)(void *context, const char *value, u64 valueLength);
+  bool (*integer)(void *context, i64 value);
+  bool (*floatingPoint)(void *context, double value);
+  bool (*boolean)(void *context, bool value);
+  bool (*null)(void *context);
+} JsonSaxHandler;
+
+/// @def XML_READER_BUFFER_SIZE
+///
+/// @brief The number of bytes an XmlReader that reads from a source holds at
+/// a time.  The buffer only grows past this for a single tag that is larger.
+#define XML_READER_BUFFER_SIZE 65536
+
+/// @typedef XmlReaderSource
+///
+/// @brief Function that supplies the input of an XmlReader.  Reads up to
+/// length bytes into buffer and returns the number of bytes read, 0 at the end
+/// of the input, or a negative value on error.
+typedef i64 (*XmlReaderSource)(void *context, void *buffer, u64 length);
+
+/// @enum XmlToken
+///
+/// @brief The kinds of tokens xmlReaderNext returns.
+///
+/// @param XML_TOKEN_ERROR The input is malformed or could not be read.
+/// @param XML_TOKEN_END The input ended.
+/// @param XML_TOKEN_START_ELEMENT An opening tag.  A self-closing tag is
+///   returned as a start token followed by an end token.
+/// @param XML_TOKEN_END_ELEMENT A closing tag.
+/// @param XML_TOKEN_TEXT Character data.  A long run of text may be returned
+///   as several text tokens in a row.
+typedef enum XmlToken {
+  XML_TOKEN_ERROR = -1,
+  XML_TOKEN_END = 0,
+  XML_TOKEN_START_ELEMENT,
+  XML_TOKEN_END_ELEMENT,
+  XML_TOKEN_TEXT,
+} XmlToken;
+
+/// @struct XmlReader
+///
+/// @brief Pull-style XML tokenizer that makes a single forward pass over its
+/// input.  Comments, processing instructions, and DOCTYPE declarations are
+/// skipped, CDATA sections are returned as text, and attributes are skipped.
+/// Entity references are left as they appear in the input.
+///
+/// @param source The function that supplies more input, NULL if all of the
+///   input was provided up front.
+/// @param context The first parameter passed to source (a FILE*, Socket*,
+///   etc.).
+/// @param buffer The input that has been read.  Owned by the reader if source
+///   is not NULL.
+/// @param bufferSize The number of bytes allocated for buffer.
+/// @param start The offset in buffer of the first byte not yet tokenized.
+/// @param end The offset in buffer just past the last byte read.
+/// @param position The offset in the input of buffer[0].
+/// @param endOfInput Whether or not source has reported the end of the input.
+/// @param inCData Whether or not start is inside a CDATA section.
+/// @param endPending Whether or not the last token was a self-closing tag
+///   whose end token has not been returned yet.
+/// @param data The name of the element for start and end tokens or the
+///   characters for text tokens.  Points into buffer and is only valid until
+///   the next call to xmlReaderNext.
+typedef struct XmlReader {
+  XmlReaderSource source;
+  void *context;
+  char *buffer;
+  u64 bufferSize;
+  u64 start;
+  u64 end;
+  u64 position;
+  bool endOfInput;
+  bool inCData;
+  bool endPending;
+  BytesView data;
+} XmlReader;
+
 /// @var fieldDelim
 /// Character used to delimit fields in ASCII text strings.
 extern const char *fieldDelim;
@@ -80,11 +269,23 @@ i64 getFileLength(const char *fullPath);
 Bytes getFileContent_(const char *fullPath, i64 start, i64 length, ...);
 #define getFileContent(fullPath, ...) \
   getFileContent_(fullPath, ##__VA_ARGS__, 0, 0)
+Bytes getFileMapping_(const char *fullPath, i64 start, i64 length, ...);
+#define getFileMapping(fullPath, ...) \
+  getFileMapping_(fullPath, ##__VA_ARGS__, 0, 0)
+Bytes fileMappingDestroy(Bytes fileMapping);
 i64 putFileContent_(
   const char *fullPath, const volatile void *dataBuffer, i64 dataLength, i64 start, ...);
 #define putFileContent(fullPath, dataBuffer, dataLength, ...) \
   putFileContent_(fullPath, dataBuffer, dataLength, ##__VA_ARGS__, 0)
 u64 getFileLine(FILE *requestedFile, char **dataBuffer);
+LineReader* lineReaderCreate(FILE *file, u64 bufferSize);
+LineReader* lineReaderDestroy(LineReader *lineReader);
+const char* lineReaderNext(LineReader *lineReader, u64 *length);
+Bytes lineReaderNextBytes(LineReader *lineReader);
+Bytes* lineReaderNextFields_(LineReader *lineReader, ...);
+// lineReaderNextFields macro makes the fieldDelimiter parameter optional.
+#define lineReaderNextFields(lineReader, ...) \
+  lineReaderNextFields_(lineReader, ##__VA_ARGS__, NULL)
 char unampersand(const char *inputString);
 char hexToChar(const char *inputString);
 char *strReplaceOneStr(
@@ -283,6 +484,62 @@ static inline void bytesSetSize(Bytes value, u64 valueSize) {
     ((BytesHeader*) value)[-1].size = valueSize;
   }
 }
+
+// BytesView functions
+static inline BytesView bytesViewFromData(
+  const volatile void *data, u64 length
+) {
+  BytesView view = { (const Byte*) data, (data != NULL) ? length : 0 };
+  return view;
+}
+static inline BytesView bytesViewFromStr(const char *string) {
+  return bytesViewFromData(string, (string != NULL) ? strlen(string) : 0);
+}
+static inline BytesView bytesViewFromBytes(const Bytes bytes) {
+  return bytesViewFromData(bytes, bytesLength(bytes));
+}
+static inline BytesView bytesViewSlice(
+  BytesView view, u64 start, u64 length
+) {
+  start = (start < view.length) ? start : view.length;
+  length = (length < view.length - start) ? length : view.length - start;
+  return bytesViewFromData(
+    (view.data != NULL) ? view.data + start : NULL, length);
+}
+BytesView getDataBetweenView(const volatile void *vHaystack, u64 haystackLength,
+  const volatile void *start, u64 startLength,
+  const volatile void *end, u64 endLength);
+#define getBytesBetweenView(haystack, start, end) ( \
+  ((haystack != NULL) && (start != NULL) && (end != NULL)) \
+  ? getDataBetweenView(haystack, strlen(haystack), \
+      start, strlen(start), end, strlen(end)) \
+  : bytesViewFromData(NULL, 0) \
+)
+BytesView getBytesBetweenCiView(
+  const char *haystack, const char *start, const char *end);
+BytesView bytesViewFind(BytesView haystack, BytesView needle);
+int bytesViewCompare(BytesView valueA, BytesView valueB);
+int bytesViewCompareCi(BytesView valueA, BytesView valueB);
+#define bytesViewEqualsStr(view, string) \
+  (bytesViewCompare((view), bytesViewFromStr(string)) == 0)
+u64 bytesViewHash(BytesView view, u64 seed);
+u64 bytesViewHashCi(BytesView view, u64 seed);
+Bytes bytesAddView(Bytes *buffer, BytesView view);
+char* bytesViewToString(BytesView view);
+
+// SmallBytes functions
+#define SMALL_BYTES_INITIALIZER { NULL, { 0, 0 }, { 0 } }
+Bytes smallBytesSet(SmallBytes *smallBytes, const volatile void *data,
+  u64 length);
+#define smallBytesSetStr(smallBytes, string) \
+  smallBytesSet((smallBytes), (string), \
+    ((string) != NULL) ? strlen(string) : 0)
+#define smallBytesSetView(smallBytes, view) \
+  smallBytesSet((smallBytes), (view).data, (view).length)
+Bytes smallBytesGet(SmallBytes *smallBytes);
+BytesView smallBytesView(SmallBytes *smallBytes);
+void smallBytesDestroy(SmallBytes *smallBytes);
+
 char *escapeBytes(const Bytes input);
 bool bytesArrayAddField(Bytes **array, u64 beforeIndex);
 bool bytesTableAddField(Bytes ***table, u64 beforeIndex);
@@ -290,6 +547,47 @@ Bytes dataToHexBytes(const volatile void *data, u64 length);
 Bytes hexStringToBytes(const char *hexString, u64 length);
 Bytes dataToBase64(const volatile void *data, u64 dataLength);
 Bytes base64ToBytes(const char *base64String, u64 base64StringLength);
+u64 base64EncodedLength(u64 dataLength);
+u64 base64DecodedLength(const char *base64String, u64 base64StringLength);
+Bytes hexEncodeChunk(Bytes *output, const volatile void *data,
+  u64 dataLength);
+Bytes hexDecodeChunk(CodecStream *stream, Bytes *output,
+  const char *hexString, u64 hexStringLength);
+Bytes base64EncodeChunk(CodecStream *stream, Bytes *output,
+  const volatile void *data, u64 dataLength);
+Bytes base64EncodeFinish(CodecStream *stream, Bytes *output);
+Bytes base64DecodeChunk(CodecStream *stream, Bytes *output,
+  const char *base64String, u64 base64StringLength);
+Bytes base64DecodeFinish(CodecStream *stream, Bytes *output);
+
+// JsonWriter functions
+void jsonWriterInit(JsonWriter *writer, JsonWriterSink sink, void *context);
+void jsonWriterInitFile(JsonWriter *writer, FILE *file);
+void jsonWriterInitBytes(JsonWriter *writer, Bytes *output);
+bool jsonWriterWrite(JsonWriter *writer, const volatile void *data,
+  u64 length);
+#define jsonWriterWriteStr(writer, string) \
+  jsonWriterWrite((writer), (string), \
+    ((string) != NULL) ? strlen(string) : 0)
+bool jsonWriterWriteEscaped(JsonWriter *writer, const volatile void *data,
+  u64 length);
+bool jsonWriterWriteValue(JsonWriter *writer, TypeDescriptor *type,
+  const volatile void *value);
+void jsonWriterIndent(JsonWriter *writer, u64 columns);
+void jsonWriterUnindent(JsonWriter *writer, u64 columns);
+bool jsonWriterFlush(JsonWriter *writer);
+
+// JSON reader functions
+bool jsonSaxParse(const char *jsonText, u64 length,
+  const JsonSaxHandler *handler, void *context, u64 *position);
+
+// XmlReader functions
+void xmlReaderInit(XmlReader *reader, XmlReaderSource source, void *context);
+void xmlReaderInitString(XmlReader *reader, const char *xmlText, u64 length);
+void xmlReaderInitFile(XmlReader *reader, FILE *file);
+XmlToken xmlReaderNext(XmlReader *reader);
+void xmlReaderDestroy(XmlReader *reader);
+void* xmlToDataStructure(XmlReader *reader, const JsonContainerOps *ops);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              ThreadPool.h
+///
+/// @brief             This library contains the definitions for a pool of
+///                    worker threads that the rest of the library can share.
+///
+/// @details           Each worker has its own queue of tasks.  A worker runs
+///                    the newest task in its own queue first and, when that
+///                    runs dry, steals the oldest task from another worker's
+///                    queue.  Tasks submitted from a worker go on that
+///                    worker's queue and tasks submitted from other threads
+///                    are spread across the queues.  parallelFor and
+///                    parallelReduce split a range into chunks that the
+///                    calling thread and the workers take one at a time.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stddef.h>
+
+#include "TypeDefinitions.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def THREAD_POOL_CHUNKS_PER_THREAD
+///
+/// @brief The number of chunks per thread that parallelFor and parallelReduce
+/// split a range into when no grain size is given.  More than one chunk per
+/// thread lets threads that finish early pick up work from slower ones.
+#define THREAD_POOL_CHUNKS_PER_THREAD 4
+
+typedef struct ThreadPool ThreadPool;
+typedef struct ThreadPoolFuture ThreadPoolFuture;
+
+/// @typedef ThreadPoolFunction
+///
+/// @brief Function run by a task submitted to a ThreadPool.  The value it
+/// returns is the result of the task's future.
+typedef void* (*ThreadPoolFunction)(void *argument);
+
+/// @typedef ParallelForFunction
+///
+/// @brief Function called by parallelFor for each chunk [begin, end) of the
+/// range.
+typedef void (*ParallelForFunction)(u64 begin, u64 end, void *context);
+
+/// @typedef ParallelReduceFunction
+///
+/// @brief Function called by parallelReduce for each chunk [begin, end) of the
+/// range.  It folds the chunk into partial, which starts out as a copy of the
+/// initial result.
+typedef void (*ParallelReduceFunction)(u64 begin, u64 end, void *partial,
+  void *context);
+
+/// @typedef ParallelCombineFunction
+///
+/// @brief Function called by parallelReduce to fold the partial result of one
+/// chunk into the final result.  Partials are combined in chunk order.
+typedef void (*ParallelCombineFunction)(void *result, const void *partial,
+  void *context);
+
+ThreadPool* threadPoolCreate(u32 numThreads);
+ThreadPool* threadPoolDestroy(ThreadPool *threadPool);
+ThreadPool* threadPoolGetDefault(void);
+u32 threadPoolNumThreads(ThreadPool *threadPool);
+ThreadPoolFuture* threadPoolSubmit(ThreadPool *threadPool,
+  ThreadPoolFunction function, void *argument);
+bool threadPoolFutureIsDone(ThreadPoolFuture *future);
+void* threadPoolFutureWait(ThreadPoolFuture *future);
+ThreadPoolFuture* threadPoolFutureDestroy(ThreadPoolFuture *future);
+int parallelFor(ThreadPool *threadPool, u64 begin, u64 end, u64 grainSize,
+  ParallelForFunction function, void *context);
+int parallelReduce(ThreadPool *threadPool, u64 begin, u64 end,
+  u64 grainSize, void *result, size_t resultSize,
+  ParallelReduceFunction reduce, ParallelCombineFunction combine,
+  void *context);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // THREAD_POOL_H
+
@@ -47,6 +47,12 @@
 #include "TypeDefinitions.h"
 #include "CThreads.h"
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -178,6 +184,14 @@ static inline i64 getTimezoneNanosecondsFromTimestamp(
   return timezoneNanoseconds;
 }
 
+/// @def TIMESTAMP_SIZE
+///
+/// @brief The size of the buffer needed to hold a timestamp in the form
+/// YYYY-MM-DD hh:mm:ss.nnnnnnnnn, including the null terminator.
+#define TIMESTAMP_SIZE 30
+
+char* formatTimestamp(i64 seconds, long nanoseconds, char *timestamp);
+
 /// @fn static inline char* nanosecondsToTimestamp(i64 nanoseconds, char *timestamp)
 ///
 /// @brief Convert a number of nanoseconds since midnight, Jan 1, 1970 to a UTC
@@ -187,30 +201,8 @@ static inline i64 getTimezoneNanosecondsFromTimestamp(
 /// @param timestamp Character buffer to hold the output timestamp.  This
 ///   parameter may be NULL.  A buffer will be allocated if it is not provided.
 static inline char* nanosecondsToTimestamp(i64 nanoseconds, char *timestamp) {
-  #define timestampSize 30
-  struct timespec timeValue = {
-    /* time_t */ .tv_sec  = (time_t) (nanoseconds / 1000000000),
-    /* long   */ .tv_nsec = (long)   (nanoseconds % 1000000000)
-  };
-  ZEROINIT(struct tm timestampStruct);
-  gmtime_r(&timeValue.tv_sec, &timestampStruct);
-  
-  if (timestamp == NULL) {
-    // No buffer provided, so allocate one.
-    timestamp = (char*) malloc(timestampSize);
-  }
-  
-  snprintf(timestamp, timestampSize, "%4d-%02d-%02d %02d:%02d:%02d.%09ld",
-    timestampStruct.tm_year + 1900,
-    timestampStruct.tm_mon + 1,
-    timestampStruct.tm_mday,
-    timestampStruct.tm_hour,
-    timestampStruct.tm_min,
-    timestampStruct.tm_sec,
-    (long) timeValue.tv_nsec);
-  
-  #undef timestampSize
-  return timestamp;
+  return formatTimestamp(nanoseconds / 1000000000,
+    (long) (nanoseconds % 1000000000), timestamp);
 }
 
 /// @fn static inline i64 timestampToNanoseconds(const char *timestamp)
@@ -293,6 +285,76 @@ static inline i64 getNowNanoseconds() {
   return (((i64) now.tv_sec) * ((i64) 1000000000)) + (i64) now.tv_nsec;
 }
 
+/// @fn static inline i64 getMonotonicNanoseconds(void)
+///
+/// @brief Get the time from a clock that only ever moves forward.  Unlike
+/// getNowNanoseconds, this is not affected by the wall clock being set or
+/// slewed, so it's what timeouts and elapsed-time measurements should use.
+///
+/// @return Returns the number of nanoseconds since an arbitrary, fixed point
+/// in the past (usually system boot).
+static inline i64 getMonotonicNanoseconds(void) {
+#ifdef _MSC_VER
+  static LARGE_INTEGER frequency = { 0 };
+  LARGE_INTEGER counter;
+  if (frequency.QuadPart == 0) {
+    QueryPerformanceFrequency(&frequency);
+  }
+  QueryPerformanceCounter(&counter);
+  return (((i64) (counter.QuadPart / frequency.QuadPart)) * ((i64) 1000000000))
+    + (i64) (((counter.QuadPart % frequency.QuadPart) * 1000000000)
+      / frequency.QuadPart);
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (((i64) now.tv_sec) * ((i64) 1000000000)) + (i64) now.tv_nsec;
+#endif // _MSC_VER
+}
+
+/// @fn static inline i64 getCoarseMonotonicNanoseconds(void)
+///
+/// @brief Get the time from a monotonic clock that is only updated once per
+/// scheduler tick (typically every 1 to 4 milliseconds).  Where the system
+/// has such a clock (CLOCK_MONOTONIC_COARSE on Linux), reading it is much
+/// cheaper than getMonotonicNanoseconds.  Elsewhere, this is the same as
+/// getMonotonicNanoseconds.
+///
+/// @return Returns the number of nanoseconds since an arbitrary, fixed point
+/// in the past (usually system boot).
+static inline i64 getCoarseMonotonicNanoseconds(void) {
+#ifdef CLOCK_MONOTONIC_COARSE
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+  return (((i64) now.tv_sec) * ((i64) 1000000000)) + (i64) now.tv_nsec;
+#else
+  return getMonotonicNanoseconds();
+#endif // CLOCK_MONOTONIC_COARSE
+}
+
+/// @fn static inline u64 getCpuTicks(void)
+///
+/// @brief Read the CPU's cycle or timer counter (the TSC on x86, CNTVCT_EL0 on
+/// 64-bit ARM).  Use getCpuTicksFrequency or getCpuTicksNanoseconds to turn
+/// ticks into time.
+///
+/// @return Returns the current tick count.  On systems without a counter that
+/// can be read directly, returns getMonotonicNanoseconds instead.
+static inline u64 getCpuTicks(void) {
+#if defined(__x86_64__) || defined(__i386__) \
+  || defined(_M_X64) || defined(_M_IX86)
+  return (u64) __rdtsc();
+#elif defined(__aarch64__)
+  u64 ticks;
+  __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (ticks));
+  return ticks;
+#else
+  return (u64) getMonotonicNanoseconds();
+#endif
+}
+
+u64 getCpuTicksFrequency(void);
+i64 getCpuTicksNanoseconds(void);
+
 #define MINUTE_NANOSECONDS 60000000000LL
 #define HOUR_NANOSECONDS (60LL * MINUTE_NANOSECONDS)
 #define DAY_NANOSECONDS (24LL * HOUR_NANOSECONDS)
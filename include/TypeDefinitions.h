@@ -101,6 +101,40 @@ typedef struct BytesHeader {
 typedef unsigned char Byte;
 typedef Byte *Bytes;
 
+/// @struct BytesView
+///
+/// @brief A non-owning view of a run of bytes, such as a slice of a Bytes
+/// object or a string.
+///
+/// @param data A pointer to the first byte of the view.  NULL means "no
+///   value", as opposed to an empty view that has a data pointer but a length
+///   of zero.
+/// @param length The number of bytes in the view.
+typedef struct BytesView {
+  const Byte *data;
+  u64 length;
+} BytesView;
+
+#ifndef SMALL_BYTES_CAPACITY
+#define SMALL_BYTES_CAPACITY 23 // Longest value a SmallBytes stores inline.
+#endif
+
+/// @struct SmallBytes
+///
+/// @brief A Bytes value that short values are stored inside of rather than on
+/// the heap.
+///
+/// @param heap A heap-allocated Bytes object holding the value when it's longer
+///   than SMALL_BYTES_CAPACITY, NULL otherwise.
+/// @param header The header for the inline value.  It immediately precedes
+///   data so that data can be handed out as a Bytes object.
+/// @param data The inline value and its NULL terminator.
+typedef struct SmallBytes {
+  Bytes heap;
+  BytesHeader header;
+  Byte data[SMALL_BYTES_CAPACITY + 1];
+} SmallBytes;
+
 
 #define llu(x)   ((long long unsigned int) (x))
 #define lli(x)   ((long long int) (x))
@@ -0,0 +1,18802 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.14.2026
+///
+/// @file              TypeSafeFhtAdd.h
+///
+/// @brief             This header contains type-safe versions of the
+///                    fhtAdd function.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TYPE_SAFE_FHT_ADD_H
+#define TYPE_SAFE_FHT_ADD_H
+
+#include "DataTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Type-safe inline functions.
+
+static inline FlatHashTableEntry* fhtAddBoolBool(FlatHashTable *dataStructure, bool key, bool value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddBoolBoolP(FlatHashTable *dataStructure, bool key, const volatile bool* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPBool(FlatHashTable *dataStructure, const volatile bool* key, bool value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddBoolPBoolP(FlatHashTable *dataStructure, const volatile bool* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolI16(FlatHashTable *dataStructure, bool key, i16 value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddBoolI16P(FlatHashTable *dataStructure, bool key, const volatile i16* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPI16(FlatHashTable *dataStructure, const volatile bool* key, i16 value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddBoolPI16P(FlatHashTable *dataStructure, const volatile bool* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolU16(FlatHashTable *dataStructure, bool key, u16 value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddBoolU16P(FlatHashTable *dataStructure, bool key, const volatile u16* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPU16(FlatHashTable *dataStructure, const volatile bool* key, u16 value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddBoolPU16P(FlatHashTable *dataStructure, const volatile bool* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolI32(FlatHashTable *dataStructure, bool key, i32 value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddBoolI32P(FlatHashTable *dataStructure, bool key, const volatile i32* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPI32(FlatHashTable *dataStructure, const volatile bool* key, i32 value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddBoolPI32P(FlatHashTable *dataStructure, const volatile bool* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolU32(FlatHashTable *dataStructure, bool key, u32 value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddBoolU32P(FlatHashTable *dataStructure, bool key, const volatile u32* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPU32(FlatHashTable *dataStructure, const volatile bool* key, u32 value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddBoolPU32P(FlatHashTable *dataStructure, const volatile bool* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolI64(FlatHashTable *dataStructure, bool key, i64 value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddBoolI64P(FlatHashTable *dataStructure, bool key, const volatile i64* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPI64(FlatHashTable *dataStructure, const volatile bool* key, i64 value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddBoolPI64P(FlatHashTable *dataStructure, const volatile bool* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolU64(FlatHashTable *dataStructure, bool key, u64 value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddBoolU64P(FlatHashTable *dataStructure, bool key, const volatile u64* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPU64(FlatHashTable *dataStructure, const volatile bool* key, u64 value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddBoolPU64P(FlatHashTable *dataStructure, const volatile bool* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolFloat(FlatHashTable *dataStructure, bool key, float value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddBoolFloatP(FlatHashTable *dataStructure, bool key, const volatile float* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPFloat(FlatHashTable *dataStructure, const volatile bool* key, float value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddBoolPFloatP(FlatHashTable *dataStructure, const volatile bool* key, const volatile float* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolDouble(FlatHashTable *dataStructure, bool key, double value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddBoolDoubleP(FlatHashTable *dataStructure, bool key, const volatile double* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPDouble(FlatHashTable *dataStructure, const volatile bool* key, double value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddBoolPDoubleP(FlatHashTable *dataStructure, const volatile bool* key, const volatile double* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolLongDouble(FlatHashTable *dataStructure, bool key, long double value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddBoolLongDoubleP(FlatHashTable *dataStructure, bool key, const volatile long double* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPLongDouble(FlatHashTable *dataStructure, const volatile bool* key, long double value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddBoolPLongDoubleP(FlatHashTable *dataStructure, const volatile bool* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolList(FlatHashTable *dataStructure, bool key, List value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddBoolListP(FlatHashTable *dataStructure, bool key, const volatile List* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPList(FlatHashTable *dataStructure, const volatile bool* key, List value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddBoolPListP(FlatHashTable *dataStructure, const volatile bool* key, const volatile List* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolQueue(FlatHashTable *dataStructure, bool key, Queue value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddBoolQueueP(FlatHashTable *dataStructure, bool key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPQueue(FlatHashTable *dataStructure, const volatile bool* key, Queue value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddBoolPQueueP(FlatHashTable *dataStructure, const volatile bool* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolStack(FlatHashTable *dataStructure, bool key, Stack value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddBoolStackP(FlatHashTable *dataStructure, bool key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPStack(FlatHashTable *dataStructure, const volatile bool* key, Stack value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddBoolPStackP(FlatHashTable *dataStructure, const volatile bool* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolRedBlackTree(FlatHashTable *dataStructure, bool key, RedBlackTree value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddBoolRedBlackTreeP(FlatHashTable *dataStructure, bool key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPRedBlackTree(FlatHashTable *dataStructure, const volatile bool* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddBoolPRedBlackTreeP(FlatHashTable *dataStructure, const volatile bool* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolHashTable(FlatHashTable *dataStructure, bool key, HashTable value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddBoolHashTableP(FlatHashTable *dataStructure, bool key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPHashTable(FlatHashTable *dataStructure, const volatile bool* key, HashTable value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddBoolPHashTableP(FlatHashTable *dataStructure, const volatile bool* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolVector(FlatHashTable *dataStructure, bool key, Vector value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddBoolVectorP(FlatHashTable *dataStructure, bool key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPVector(FlatHashTable *dataStructure, const volatile bool* key, Vector value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddBoolPVectorP(FlatHashTable *dataStructure, const volatile bool* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolString(FlatHashTable *dataStructure, bool key, const volatile char* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddBoolStringP(FlatHashTable *dataStructure, bool key, const volatile char** value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPString(FlatHashTable *dataStructure, const volatile bool* key, const volatile char* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddBoolPStringP(FlatHashTable *dataStructure, const volatile bool* key, const volatile char** value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolBytes(FlatHashTable *dataStructure, bool key, Bytes value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddBoolBytesP(FlatHashTable *dataStructure, bool key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPBytes(FlatHashTable *dataStructure, const volatile bool* key, Bytes value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddBoolPBytesP(FlatHashTable *dataStructure, const volatile bool* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPointer(FlatHashTable *dataStructure, bool key, void* value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddBoolPointerP(FlatHashTable *dataStructure, bool key, const volatile void** value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolPPointer(FlatHashTable *dataStructure, const volatile bool* key, void* value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddBoolPPointerP(FlatHashTable *dataStructure, const volatile bool* key, const volatile void** value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBoolI8(FlatHashTable *dataStructure, bool key, i8 value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddBoolPI8(FlatHashTable *dataStructure, const volatile bool* key, i8 value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddBoolU8(FlatHashTable *dataStructure, bool key, u8 value) {
+  if (dataStructure->keyType != typeBool) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddBoolPU8(FlatHashTable *dataStructure, const volatile bool* key, u8 value) {
+  if (dataStructure->keyType != typeBoolNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddI16Bool(FlatHashTable *dataStructure, i16 key, bool value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddI16BoolP(FlatHashTable *dataStructure, i16 key, const volatile bool* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PBool(FlatHashTable *dataStructure, const volatile i16* key, bool value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddI16PBoolP(FlatHashTable *dataStructure, const volatile i16* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16I16(FlatHashTable *dataStructure, i16 key, i16 value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddI16I16P(FlatHashTable *dataStructure, i16 key, const volatile i16* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PI16(FlatHashTable *dataStructure, const volatile i16* key, i16 value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddI16PI16P(FlatHashTable *dataStructure, const volatile i16* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16U16(FlatHashTable *dataStructure, i16 key, u16 value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddI16U16P(FlatHashTable *dataStructure, i16 key, const volatile u16* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PU16(FlatHashTable *dataStructure, const volatile i16* key, u16 value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddI16PU16P(FlatHashTable *dataStructure, const volatile i16* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16I32(FlatHashTable *dataStructure, i16 key, i32 value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddI16I32P(FlatHashTable *dataStructure, i16 key, const volatile i32* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PI32(FlatHashTable *dataStructure, const volatile i16* key, i32 value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddI16PI32P(FlatHashTable *dataStructure, const volatile i16* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16U32(FlatHashTable *dataStructure, i16 key, u32 value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddI16U32P(FlatHashTable *dataStructure, i16 key, const volatile u32* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PU32(FlatHashTable *dataStructure, const volatile i16* key, u32 value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddI16PU32P(FlatHashTable *dataStructure, const volatile i16* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16I64(FlatHashTable *dataStructure, i16 key, i64 value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddI16I64P(FlatHashTable *dataStructure, i16 key, const volatile i64* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PI64(FlatHashTable *dataStructure, const volatile i16* key, i64 value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddI16PI64P(FlatHashTable *dataStructure, const volatile i16* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16U64(FlatHashTable *dataStructure, i16 key, u64 value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddI16U64P(FlatHashTable *dataStructure, i16 key, const volatile u64* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PU64(FlatHashTable *dataStructure, const volatile i16* key, u64 value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddI16PU64P(FlatHashTable *dataStructure, const volatile i16* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16Float(FlatHashTable *dataStructure, i16 key, float value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddI16FloatP(FlatHashTable *dataStructure, i16 key, const volatile float* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PFloat(FlatHashTable *dataStructure, const volatile i16* key, float value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddI16PFloatP(FlatHashTable *dataStructure, const volatile i16* key, const volatile float* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16Double(FlatHashTable *dataStructure, i16 key, double value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddI16DoubleP(FlatHashTable *dataStructure, i16 key, const volatile double* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PDouble(FlatHashTable *dataStructure, const volatile i16* key, double value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddI16PDoubleP(FlatHashTable *dataStructure, const volatile i16* key, const volatile double* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16LongDouble(FlatHashTable *dataStructure, i16 key, long double value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddI16LongDoubleP(FlatHashTable *dataStructure, i16 key, const volatile long double* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PLongDouble(FlatHashTable *dataStructure, const volatile i16* key, long double value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddI16PLongDoubleP(FlatHashTable *dataStructure, const volatile i16* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16List(FlatHashTable *dataStructure, i16 key, List value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddI16ListP(FlatHashTable *dataStructure, i16 key, const volatile List* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PList(FlatHashTable *dataStructure, const volatile i16* key, List value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddI16PListP(FlatHashTable *dataStructure, const volatile i16* key, const volatile List* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16Queue(FlatHashTable *dataStructure, i16 key, Queue value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddI16QueueP(FlatHashTable *dataStructure, i16 key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PQueue(FlatHashTable *dataStructure, const volatile i16* key, Queue value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddI16PQueueP(FlatHashTable *dataStructure, const volatile i16* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16Stack(FlatHashTable *dataStructure, i16 key, Stack value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddI16StackP(FlatHashTable *dataStructure, i16 key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PStack(FlatHashTable *dataStructure, const volatile i16* key, Stack value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddI16PStackP(FlatHashTable *dataStructure, const volatile i16* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16RedBlackTree(FlatHashTable *dataStructure, i16 key, RedBlackTree value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddI16RedBlackTreeP(FlatHashTable *dataStructure, i16 key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PRedBlackTree(FlatHashTable *dataStructure, const volatile i16* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddI16PRedBlackTreeP(FlatHashTable *dataStructure, const volatile i16* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16HashTable(FlatHashTable *dataStructure, i16 key, HashTable value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddI16HashTableP(FlatHashTable *dataStructure, i16 key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PHashTable(FlatHashTable *dataStructure, const volatile i16* key, HashTable value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddI16PHashTableP(FlatHashTable *dataStructure, const volatile i16* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16Vector(FlatHashTable *dataStructure, i16 key, Vector value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddI16VectorP(FlatHashTable *dataStructure, i16 key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PVector(FlatHashTable *dataStructure, const volatile i16* key, Vector value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddI16PVectorP(FlatHashTable *dataStructure, const volatile i16* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16String(FlatHashTable *dataStructure, i16 key, const volatile char* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddI16StringP(FlatHashTable *dataStructure, i16 key, const volatile char** value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PString(FlatHashTable *dataStructure, const volatile i16* key, const volatile char* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddI16PStringP(FlatHashTable *dataStructure, const volatile i16* key, const volatile char** value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16Bytes(FlatHashTable *dataStructure, i16 key, Bytes value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddI16BytesP(FlatHashTable *dataStructure, i16 key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PBytes(FlatHashTable *dataStructure, const volatile i16* key, Bytes value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddI16PBytesP(FlatHashTable *dataStructure, const volatile i16* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16Pointer(FlatHashTable *dataStructure, i16 key, void* value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddI16PointerP(FlatHashTable *dataStructure, i16 key, const volatile void** value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16PPointer(FlatHashTable *dataStructure, const volatile i16* key, void* value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddI16PPointerP(FlatHashTable *dataStructure, const volatile i16* key, const volatile void** value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI16I8(FlatHashTable *dataStructure, i16 key, i8 value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddI16PI8(FlatHashTable *dataStructure, const volatile i16* key, i8 value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddI16U8(FlatHashTable *dataStructure, i16 key, u8 value) {
+  if (dataStructure->keyType != typeI16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddI16PU8(FlatHashTable *dataStructure, const volatile i16* key, u8 value) {
+  if (dataStructure->keyType != typeI16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddU16Bool(FlatHashTable *dataStructure, u16 key, bool value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddU16BoolP(FlatHashTable *dataStructure, u16 key, const volatile bool* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PBool(FlatHashTable *dataStructure, const volatile u16* key, bool value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddU16PBoolP(FlatHashTable *dataStructure, const volatile u16* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16I16(FlatHashTable *dataStructure, u16 key, i16 value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddU16I16P(FlatHashTable *dataStructure, u16 key, const volatile i16* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PI16(FlatHashTable *dataStructure, const volatile u16* key, i16 value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddU16PI16P(FlatHashTable *dataStructure, const volatile u16* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16U16(FlatHashTable *dataStructure, u16 key, u16 value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddU16U16P(FlatHashTable *dataStructure, u16 key, const volatile u16* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PU16(FlatHashTable *dataStructure, const volatile u16* key, u16 value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddU16PU16P(FlatHashTable *dataStructure, const volatile u16* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16I32(FlatHashTable *dataStructure, u16 key, i32 value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddU16I32P(FlatHashTable *dataStructure, u16 key, const volatile i32* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PI32(FlatHashTable *dataStructure, const volatile u16* key, i32 value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddU16PI32P(FlatHashTable *dataStructure, const volatile u16* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16U32(FlatHashTable *dataStructure, u16 key, u32 value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddU16U32P(FlatHashTable *dataStructure, u16 key, const volatile u32* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PU32(FlatHashTable *dataStructure, const volatile u16* key, u32 value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddU16PU32P(FlatHashTable *dataStructure, const volatile u16* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16I64(FlatHashTable *dataStructure, u16 key, i64 value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddU16I64P(FlatHashTable *dataStructure, u16 key, const volatile i64* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PI64(FlatHashTable *dataStructure, const volatile u16* key, i64 value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddU16PI64P(FlatHashTable *dataStructure, const volatile u16* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16U64(FlatHashTable *dataStructure, u16 key, u64 value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddU16U64P(FlatHashTable *dataStructure, u16 key, const volatile u64* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PU64(FlatHashTable *dataStructure, const volatile u16* key, u64 value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddU16PU64P(FlatHashTable *dataStructure, const volatile u16* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16Float(FlatHashTable *dataStructure, u16 key, float value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddU16FloatP(FlatHashTable *dataStructure, u16 key, const volatile float* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PFloat(FlatHashTable *dataStructure, const volatile u16* key, float value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddU16PFloatP(FlatHashTable *dataStructure, const volatile u16* key, const volatile float* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16Double(FlatHashTable *dataStructure, u16 key, double value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddU16DoubleP(FlatHashTable *dataStructure, u16 key, const volatile double* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PDouble(FlatHashTable *dataStructure, const volatile u16* key, double value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddU16PDoubleP(FlatHashTable *dataStructure, const volatile u16* key, const volatile double* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16LongDouble(FlatHashTable *dataStructure, u16 key, long double value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddU16LongDoubleP(FlatHashTable *dataStructure, u16 key, const volatile long double* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PLongDouble(FlatHashTable *dataStructure, const volatile u16* key, long double value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddU16PLongDoubleP(FlatHashTable *dataStructure, const volatile u16* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16List(FlatHashTable *dataStructure, u16 key, List value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddU16ListP(FlatHashTable *dataStructure, u16 key, const volatile List* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PList(FlatHashTable *dataStructure, const volatile u16* key, List value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddU16PListP(FlatHashTable *dataStructure, const volatile u16* key, const volatile List* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16Queue(FlatHashTable *dataStructure, u16 key, Queue value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddU16QueueP(FlatHashTable *dataStructure, u16 key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PQueue(FlatHashTable *dataStructure, const volatile u16* key, Queue value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddU16PQueueP(FlatHashTable *dataStructure, const volatile u16* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16Stack(FlatHashTable *dataStructure, u16 key, Stack value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddU16StackP(FlatHashTable *dataStructure, u16 key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PStack(FlatHashTable *dataStructure, const volatile u16* key, Stack value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddU16PStackP(FlatHashTable *dataStructure, const volatile u16* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16RedBlackTree(FlatHashTable *dataStructure, u16 key, RedBlackTree value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddU16RedBlackTreeP(FlatHashTable *dataStructure, u16 key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PRedBlackTree(FlatHashTable *dataStructure, const volatile u16* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddU16PRedBlackTreeP(FlatHashTable *dataStructure, const volatile u16* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16HashTable(FlatHashTable *dataStructure, u16 key, HashTable value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddU16HashTableP(FlatHashTable *dataStructure, u16 key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PHashTable(FlatHashTable *dataStructure, const volatile u16* key, HashTable value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddU16PHashTableP(FlatHashTable *dataStructure, const volatile u16* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16Vector(FlatHashTable *dataStructure, u16 key, Vector value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddU16VectorP(FlatHashTable *dataStructure, u16 key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PVector(FlatHashTable *dataStructure, const volatile u16* key, Vector value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddU16PVectorP(FlatHashTable *dataStructure, const volatile u16* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16String(FlatHashTable *dataStructure, u16 key, const volatile char* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddU16StringP(FlatHashTable *dataStructure, u16 key, const volatile char** value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PString(FlatHashTable *dataStructure, const volatile u16* key, const volatile char* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddU16PStringP(FlatHashTable *dataStructure, const volatile u16* key, const volatile char** value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16Bytes(FlatHashTable *dataStructure, u16 key, Bytes value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddU16BytesP(FlatHashTable *dataStructure, u16 key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PBytes(FlatHashTable *dataStructure, const volatile u16* key, Bytes value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddU16PBytesP(FlatHashTable *dataStructure, const volatile u16* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16Pointer(FlatHashTable *dataStructure, u16 key, void* value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddU16PointerP(FlatHashTable *dataStructure, u16 key, const volatile void** value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16PPointer(FlatHashTable *dataStructure, const volatile u16* key, void* value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddU16PPointerP(FlatHashTable *dataStructure, const volatile u16* key, const volatile void** value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU16I8(FlatHashTable *dataStructure, u16 key, i8 value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddU16PI8(FlatHashTable *dataStructure, const volatile u16* key, i8 value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddU16U8(FlatHashTable *dataStructure, u16 key, u8 value) {
+  if (dataStructure->keyType != typeU16) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddU16PU8(FlatHashTable *dataStructure, const volatile u16* key, u8 value) {
+  if (dataStructure->keyType != typeU16NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddI32Bool(FlatHashTable *dataStructure, i32 key, bool value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddI32BoolP(FlatHashTable *dataStructure, i32 key, const volatile bool* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PBool(FlatHashTable *dataStructure, const volatile i32* key, bool value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddI32PBoolP(FlatHashTable *dataStructure, const volatile i32* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32I16(FlatHashTable *dataStructure, i32 key, i16 value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddI32I16P(FlatHashTable *dataStructure, i32 key, const volatile i16* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PI16(FlatHashTable *dataStructure, const volatile i32* key, i16 value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddI32PI16P(FlatHashTable *dataStructure, const volatile i32* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32U16(FlatHashTable *dataStructure, i32 key, u16 value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddI32U16P(FlatHashTable *dataStructure, i32 key, const volatile u16* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PU16(FlatHashTable *dataStructure, const volatile i32* key, u16 value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddI32PU16P(FlatHashTable *dataStructure, const volatile i32* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32I32(FlatHashTable *dataStructure, i32 key, i32 value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddI32I32P(FlatHashTable *dataStructure, i32 key, const volatile i32* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PI32(FlatHashTable *dataStructure, const volatile i32* key, i32 value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddI32PI32P(FlatHashTable *dataStructure, const volatile i32* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32U32(FlatHashTable *dataStructure, i32 key, u32 value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddI32U32P(FlatHashTable *dataStructure, i32 key, const volatile u32* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PU32(FlatHashTable *dataStructure, const volatile i32* key, u32 value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddI32PU32P(FlatHashTable *dataStructure, const volatile i32* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32I64(FlatHashTable *dataStructure, i32 key, i64 value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddI32I64P(FlatHashTable *dataStructure, i32 key, const volatile i64* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PI64(FlatHashTable *dataStructure, const volatile i32* key, i64 value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddI32PI64P(FlatHashTable *dataStructure, const volatile i32* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32U64(FlatHashTable *dataStructure, i32 key, u64 value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddI32U64P(FlatHashTable *dataStructure, i32 key, const volatile u64* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PU64(FlatHashTable *dataStructure, const volatile i32* key, u64 value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddI32PU64P(FlatHashTable *dataStructure, const volatile i32* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32Float(FlatHashTable *dataStructure, i32 key, float value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddI32FloatP(FlatHashTable *dataStructure, i32 key, const volatile float* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PFloat(FlatHashTable *dataStructure, const volatile i32* key, float value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddI32PFloatP(FlatHashTable *dataStructure, const volatile i32* key, const volatile float* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32Double(FlatHashTable *dataStructure, i32 key, double value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddI32DoubleP(FlatHashTable *dataStructure, i32 key, const volatile double* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PDouble(FlatHashTable *dataStructure, const volatile i32* key, double value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddI32PDoubleP(FlatHashTable *dataStructure, const volatile i32* key, const volatile double* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32LongDouble(FlatHashTable *dataStructure, i32 key, long double value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddI32LongDoubleP(FlatHashTable *dataStructure, i32 key, const volatile long double* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PLongDouble(FlatHashTable *dataStructure, const volatile i32* key, long double value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddI32PLongDoubleP(FlatHashTable *dataStructure, const volatile i32* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32List(FlatHashTable *dataStructure, i32 key, List value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddI32ListP(FlatHashTable *dataStructure, i32 key, const volatile List* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PList(FlatHashTable *dataStructure, const volatile i32* key, List value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddI32PListP(FlatHashTable *dataStructure, const volatile i32* key, const volatile List* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32Queue(FlatHashTable *dataStructure, i32 key, Queue value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddI32QueueP(FlatHashTable *dataStructure, i32 key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PQueue(FlatHashTable *dataStructure, const volatile i32* key, Queue value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddI32PQueueP(FlatHashTable *dataStructure, const volatile i32* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32Stack(FlatHashTable *dataStructure, i32 key, Stack value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddI32StackP(FlatHashTable *dataStructure, i32 key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PStack(FlatHashTable *dataStructure, const volatile i32* key, Stack value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddI32PStackP(FlatHashTable *dataStructure, const volatile i32* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32RedBlackTree(FlatHashTable *dataStructure, i32 key, RedBlackTree value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddI32RedBlackTreeP(FlatHashTable *dataStructure, i32 key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PRedBlackTree(FlatHashTable *dataStructure, const volatile i32* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddI32PRedBlackTreeP(FlatHashTable *dataStructure, const volatile i32* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32HashTable(FlatHashTable *dataStructure, i32 key, HashTable value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddI32HashTableP(FlatHashTable *dataStructure, i32 key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PHashTable(FlatHashTable *dataStructure, const volatile i32* key, HashTable value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddI32PHashTableP(FlatHashTable *dataStructure, const volatile i32* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32Vector(FlatHashTable *dataStructure, i32 key, Vector value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddI32VectorP(FlatHashTable *dataStructure, i32 key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PVector(FlatHashTable *dataStructure, const volatile i32* key, Vector value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddI32PVectorP(FlatHashTable *dataStructure, const volatile i32* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32String(FlatHashTable *dataStructure, i32 key, const volatile char* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddI32StringP(FlatHashTable *dataStructure, i32 key, const volatile char** value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PString(FlatHashTable *dataStructure, const volatile i32* key, const volatile char* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddI32PStringP(FlatHashTable *dataStructure, const volatile i32* key, const volatile char** value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32Bytes(FlatHashTable *dataStructure, i32 key, Bytes value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddI32BytesP(FlatHashTable *dataStructure, i32 key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PBytes(FlatHashTable *dataStructure, const volatile i32* key, Bytes value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddI32PBytesP(FlatHashTable *dataStructure, const volatile i32* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32Pointer(FlatHashTable *dataStructure, i32 key, void* value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddI32PointerP(FlatHashTable *dataStructure, i32 key, const volatile void** value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32PPointer(FlatHashTable *dataStructure, const volatile i32* key, void* value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddI32PPointerP(FlatHashTable *dataStructure, const volatile i32* key, const volatile void** value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI32I8(FlatHashTable *dataStructure, i32 key, i8 value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddI32PI8(FlatHashTable *dataStructure, const volatile i32* key, i8 value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddI32U8(FlatHashTable *dataStructure, i32 key, u8 value) {
+  if (dataStructure->keyType != typeI32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddI32PU8(FlatHashTable *dataStructure, const volatile i32* key, u8 value) {
+  if (dataStructure->keyType != typeI32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddU32Bool(FlatHashTable *dataStructure, u32 key, bool value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddU32BoolP(FlatHashTable *dataStructure, u32 key, const volatile bool* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PBool(FlatHashTable *dataStructure, const volatile u32* key, bool value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddU32PBoolP(FlatHashTable *dataStructure, const volatile u32* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32I16(FlatHashTable *dataStructure, u32 key, i16 value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddU32I16P(FlatHashTable *dataStructure, u32 key, const volatile i16* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PI16(FlatHashTable *dataStructure, const volatile u32* key, i16 value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddU32PI16P(FlatHashTable *dataStructure, const volatile u32* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32U16(FlatHashTable *dataStructure, u32 key, u16 value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddU32U16P(FlatHashTable *dataStructure, u32 key, const volatile u16* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PU16(FlatHashTable *dataStructure, const volatile u32* key, u16 value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddU32PU16P(FlatHashTable *dataStructure, const volatile u32* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32I32(FlatHashTable *dataStructure, u32 key, i32 value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddU32I32P(FlatHashTable *dataStructure, u32 key, const volatile i32* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PI32(FlatHashTable *dataStructure, const volatile u32* key, i32 value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddU32PI32P(FlatHashTable *dataStructure, const volatile u32* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32U32(FlatHashTable *dataStructure, u32 key, u32 value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddU32U32P(FlatHashTable *dataStructure, u32 key, const volatile u32* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PU32(FlatHashTable *dataStructure, const volatile u32* key, u32 value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddU32PU32P(FlatHashTable *dataStructure, const volatile u32* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32I64(FlatHashTable *dataStructure, u32 key, i64 value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddU32I64P(FlatHashTable *dataStructure, u32 key, const volatile i64* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PI64(FlatHashTable *dataStructure, const volatile u32* key, i64 value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddU32PI64P(FlatHashTable *dataStructure, const volatile u32* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32U64(FlatHashTable *dataStructure, u32 key, u64 value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddU32U64P(FlatHashTable *dataStructure, u32 key, const volatile u64* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PU64(FlatHashTable *dataStructure, const volatile u32* key, u64 value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddU32PU64P(FlatHashTable *dataStructure, const volatile u32* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32Float(FlatHashTable *dataStructure, u32 key, float value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddU32FloatP(FlatHashTable *dataStructure, u32 key, const volatile float* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PFloat(FlatHashTable *dataStructure, const volatile u32* key, float value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddU32PFloatP(FlatHashTable *dataStructure, const volatile u32* key, const volatile float* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32Double(FlatHashTable *dataStructure, u32 key, double value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddU32DoubleP(FlatHashTable *dataStructure, u32 key, const volatile double* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PDouble(FlatHashTable *dataStructure, const volatile u32* key, double value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddU32PDoubleP(FlatHashTable *dataStructure, const volatile u32* key, const volatile double* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32LongDouble(FlatHashTable *dataStructure, u32 key, long double value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddU32LongDoubleP(FlatHashTable *dataStructure, u32 key, const volatile long double* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PLongDouble(FlatHashTable *dataStructure, const volatile u32* key, long double value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddU32PLongDoubleP(FlatHashTable *dataStructure, const volatile u32* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32List(FlatHashTable *dataStructure, u32 key, List value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddU32ListP(FlatHashTable *dataStructure, u32 key, const volatile List* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PList(FlatHashTable *dataStructure, const volatile u32* key, List value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddU32PListP(FlatHashTable *dataStructure, const volatile u32* key, const volatile List* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32Queue(FlatHashTable *dataStructure, u32 key, Queue value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddU32QueueP(FlatHashTable *dataStructure, u32 key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PQueue(FlatHashTable *dataStructure, const volatile u32* key, Queue value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddU32PQueueP(FlatHashTable *dataStructure, const volatile u32* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32Stack(FlatHashTable *dataStructure, u32 key, Stack value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddU32StackP(FlatHashTable *dataStructure, u32 key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PStack(FlatHashTable *dataStructure, const volatile u32* key, Stack value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddU32PStackP(FlatHashTable *dataStructure, const volatile u32* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32RedBlackTree(FlatHashTable *dataStructure, u32 key, RedBlackTree value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddU32RedBlackTreeP(FlatHashTable *dataStructure, u32 key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PRedBlackTree(FlatHashTable *dataStructure, const volatile u32* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddU32PRedBlackTreeP(FlatHashTable *dataStructure, const volatile u32* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32HashTable(FlatHashTable *dataStructure, u32 key, HashTable value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddU32HashTableP(FlatHashTable *dataStructure, u32 key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PHashTable(FlatHashTable *dataStructure, const volatile u32* key, HashTable value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddU32PHashTableP(FlatHashTable *dataStructure, const volatile u32* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32Vector(FlatHashTable *dataStructure, u32 key, Vector value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddU32VectorP(FlatHashTable *dataStructure, u32 key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PVector(FlatHashTable *dataStructure, const volatile u32* key, Vector value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddU32PVectorP(FlatHashTable *dataStructure, const volatile u32* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32String(FlatHashTable *dataStructure, u32 key, const volatile char* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddU32StringP(FlatHashTable *dataStructure, u32 key, const volatile char** value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PString(FlatHashTable *dataStructure, const volatile u32* key, const volatile char* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddU32PStringP(FlatHashTable *dataStructure, const volatile u32* key, const volatile char** value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32Bytes(FlatHashTable *dataStructure, u32 key, Bytes value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddU32BytesP(FlatHashTable *dataStructure, u32 key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PBytes(FlatHashTable *dataStructure, const volatile u32* key, Bytes value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddU32PBytesP(FlatHashTable *dataStructure, const volatile u32* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32Pointer(FlatHashTable *dataStructure, u32 key, void* value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddU32PointerP(FlatHashTable *dataStructure, u32 key, const volatile void** value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32PPointer(FlatHashTable *dataStructure, const volatile u32* key, void* value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddU32PPointerP(FlatHashTable *dataStructure, const volatile u32* key, const volatile void** value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU32I8(FlatHashTable *dataStructure, u32 key, i8 value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddU32PI8(FlatHashTable *dataStructure, const volatile u32* key, i8 value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddU32U8(FlatHashTable *dataStructure, u32 key, u8 value) {
+  if (dataStructure->keyType != typeU32) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddU32PU8(FlatHashTable *dataStructure, const volatile u32* key, u8 value) {
+  if (dataStructure->keyType != typeU32NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddI64Bool(FlatHashTable *dataStructure, i64 key, bool value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddI64BoolP(FlatHashTable *dataStructure, i64 key, const volatile bool* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PBool(FlatHashTable *dataStructure, const volatile i64* key, bool value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddI64PBoolP(FlatHashTable *dataStructure, const volatile i64* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64I16(FlatHashTable *dataStructure, i64 key, i16 value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddI64I16P(FlatHashTable *dataStructure, i64 key, const volatile i16* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PI16(FlatHashTable *dataStructure, const volatile i64* key, i16 value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddI64PI16P(FlatHashTable *dataStructure, const volatile i64* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64U16(FlatHashTable *dataStructure, i64 key, u16 value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddI64U16P(FlatHashTable *dataStructure, i64 key, const volatile u16* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PU16(FlatHashTable *dataStructure, const volatile i64* key, u16 value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddI64PU16P(FlatHashTable *dataStructure, const volatile i64* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64I32(FlatHashTable *dataStructure, i64 key, i32 value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddI64I32P(FlatHashTable *dataStructure, i64 key, const volatile i32* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PI32(FlatHashTable *dataStructure, const volatile i64* key, i32 value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddI64PI32P(FlatHashTable *dataStructure, const volatile i64* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64U32(FlatHashTable *dataStructure, i64 key, u32 value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddI64U32P(FlatHashTable *dataStructure, i64 key, const volatile u32* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PU32(FlatHashTable *dataStructure, const volatile i64* key, u32 value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddI64PU32P(FlatHashTable *dataStructure, const volatile i64* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64I64(FlatHashTable *dataStructure, i64 key, i64 value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddI64I64P(FlatHashTable *dataStructure, i64 key, const volatile i64* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PI64(FlatHashTable *dataStructure, const volatile i64* key, i64 value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddI64PI64P(FlatHashTable *dataStructure, const volatile i64* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64U64(FlatHashTable *dataStructure, i64 key, u64 value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddI64U64P(FlatHashTable *dataStructure, i64 key, const volatile u64* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PU64(FlatHashTable *dataStructure, const volatile i64* key, u64 value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddI64PU64P(FlatHashTable *dataStructure, const volatile i64* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64Float(FlatHashTable *dataStructure, i64 key, float value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddI64FloatP(FlatHashTable *dataStructure, i64 key, const volatile float* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PFloat(FlatHashTable *dataStructure, const volatile i64* key, float value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddI64PFloatP(FlatHashTable *dataStructure, const volatile i64* key, const volatile float* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64Double(FlatHashTable *dataStructure, i64 key, double value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddI64DoubleP(FlatHashTable *dataStructure, i64 key, const volatile double* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PDouble(FlatHashTable *dataStructure, const volatile i64* key, double value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddI64PDoubleP(FlatHashTable *dataStructure, const volatile i64* key, const volatile double* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64LongDouble(FlatHashTable *dataStructure, i64 key, long double value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddI64LongDoubleP(FlatHashTable *dataStructure, i64 key, const volatile long double* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PLongDouble(FlatHashTable *dataStructure, const volatile i64* key, long double value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddI64PLongDoubleP(FlatHashTable *dataStructure, const volatile i64* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64List(FlatHashTable *dataStructure, i64 key, List value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddI64ListP(FlatHashTable *dataStructure, i64 key, const volatile List* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PList(FlatHashTable *dataStructure, const volatile i64* key, List value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddI64PListP(FlatHashTable *dataStructure, const volatile i64* key, const volatile List* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64Queue(FlatHashTable *dataStructure, i64 key, Queue value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddI64QueueP(FlatHashTable *dataStructure, i64 key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PQueue(FlatHashTable *dataStructure, const volatile i64* key, Queue value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddI64PQueueP(FlatHashTable *dataStructure, const volatile i64* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64Stack(FlatHashTable *dataStructure, i64 key, Stack value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddI64StackP(FlatHashTable *dataStructure, i64 key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PStack(FlatHashTable *dataStructure, const volatile i64* key, Stack value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddI64PStackP(FlatHashTable *dataStructure, const volatile i64* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64RedBlackTree(FlatHashTable *dataStructure, i64 key, RedBlackTree value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddI64RedBlackTreeP(FlatHashTable *dataStructure, i64 key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PRedBlackTree(FlatHashTable *dataStructure, const volatile i64* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddI64PRedBlackTreeP(FlatHashTable *dataStructure, const volatile i64* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64HashTable(FlatHashTable *dataStructure, i64 key, HashTable value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddI64HashTableP(FlatHashTable *dataStructure, i64 key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PHashTable(FlatHashTable *dataStructure, const volatile i64* key, HashTable value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddI64PHashTableP(FlatHashTable *dataStructure, const volatile i64* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64Vector(FlatHashTable *dataStructure, i64 key, Vector value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddI64VectorP(FlatHashTable *dataStructure, i64 key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PVector(FlatHashTable *dataStructure, const volatile i64* key, Vector value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddI64PVectorP(FlatHashTable *dataStructure, const volatile i64* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64String(FlatHashTable *dataStructure, i64 key, const volatile char* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddI64StringP(FlatHashTable *dataStructure, i64 key, const volatile char** value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PString(FlatHashTable *dataStructure, const volatile i64* key, const volatile char* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddI64PStringP(FlatHashTable *dataStructure, const volatile i64* key, const volatile char** value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64Bytes(FlatHashTable *dataStructure, i64 key, Bytes value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddI64BytesP(FlatHashTable *dataStructure, i64 key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PBytes(FlatHashTable *dataStructure, const volatile i64* key, Bytes value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddI64PBytesP(FlatHashTable *dataStructure, const volatile i64* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64Pointer(FlatHashTable *dataStructure, i64 key, void* value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddI64PointerP(FlatHashTable *dataStructure, i64 key, const volatile void** value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64PPointer(FlatHashTable *dataStructure, const volatile i64* key, void* value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddI64PPointerP(FlatHashTable *dataStructure, const volatile i64* key, const volatile void** value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI64I8(FlatHashTable *dataStructure, i64 key, i8 value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddI64PI8(FlatHashTable *dataStructure, const volatile i64* key, i8 value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddI64U8(FlatHashTable *dataStructure, i64 key, u8 value) {
+  if (dataStructure->keyType != typeI64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddI64PU8(FlatHashTable *dataStructure, const volatile i64* key, u8 value) {
+  if (dataStructure->keyType != typeI64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddU64Bool(FlatHashTable *dataStructure, u64 key, bool value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddU64BoolP(FlatHashTable *dataStructure, u64 key, const volatile bool* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PBool(FlatHashTable *dataStructure, const volatile u64* key, bool value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddU64PBoolP(FlatHashTable *dataStructure, const volatile u64* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64I16(FlatHashTable *dataStructure, u64 key, i16 value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddU64I16P(FlatHashTable *dataStructure, u64 key, const volatile i16* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PI16(FlatHashTable *dataStructure, const volatile u64* key, i16 value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddU64PI16P(FlatHashTable *dataStructure, const volatile u64* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64U16(FlatHashTable *dataStructure, u64 key, u16 value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddU64U16P(FlatHashTable *dataStructure, u64 key, const volatile u16* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PU16(FlatHashTable *dataStructure, const volatile u64* key, u16 value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddU64PU16P(FlatHashTable *dataStructure, const volatile u64* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64I32(FlatHashTable *dataStructure, u64 key, i32 value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddU64I32P(FlatHashTable *dataStructure, u64 key, const volatile i32* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PI32(FlatHashTable *dataStructure, const volatile u64* key, i32 value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddU64PI32P(FlatHashTable *dataStructure, const volatile u64* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64U32(FlatHashTable *dataStructure, u64 key, u32 value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddU64U32P(FlatHashTable *dataStructure, u64 key, const volatile u32* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PU32(FlatHashTable *dataStructure, const volatile u64* key, u32 value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddU64PU32P(FlatHashTable *dataStructure, const volatile u64* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64I64(FlatHashTable *dataStructure, u64 key, i64 value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddU64I64P(FlatHashTable *dataStructure, u64 key, const volatile i64* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PI64(FlatHashTable *dataStructure, const volatile u64* key, i64 value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddU64PI64P(FlatHashTable *dataStructure, const volatile u64* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64U64(FlatHashTable *dataStructure, u64 key, u64 value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddU64U64P(FlatHashTable *dataStructure, u64 key, const volatile u64* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PU64(FlatHashTable *dataStructure, const volatile u64* key, u64 value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddU64PU64P(FlatHashTable *dataStructure, const volatile u64* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64Float(FlatHashTable *dataStructure, u64 key, float value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddU64FloatP(FlatHashTable *dataStructure, u64 key, const volatile float* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PFloat(FlatHashTable *dataStructure, const volatile u64* key, float value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddU64PFloatP(FlatHashTable *dataStructure, const volatile u64* key, const volatile float* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64Double(FlatHashTable *dataStructure, u64 key, double value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddU64DoubleP(FlatHashTable *dataStructure, u64 key, const volatile double* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PDouble(FlatHashTable *dataStructure, const volatile u64* key, double value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddU64PDoubleP(FlatHashTable *dataStructure, const volatile u64* key, const volatile double* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64LongDouble(FlatHashTable *dataStructure, u64 key, long double value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddU64LongDoubleP(FlatHashTable *dataStructure, u64 key, const volatile long double* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PLongDouble(FlatHashTable *dataStructure, const volatile u64* key, long double value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddU64PLongDoubleP(FlatHashTable *dataStructure, const volatile u64* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64List(FlatHashTable *dataStructure, u64 key, List value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddU64ListP(FlatHashTable *dataStructure, u64 key, const volatile List* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PList(FlatHashTable *dataStructure, const volatile u64* key, List value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddU64PListP(FlatHashTable *dataStructure, const volatile u64* key, const volatile List* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64Queue(FlatHashTable *dataStructure, u64 key, Queue value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddU64QueueP(FlatHashTable *dataStructure, u64 key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PQueue(FlatHashTable *dataStructure, const volatile u64* key, Queue value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddU64PQueueP(FlatHashTable *dataStructure, const volatile u64* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64Stack(FlatHashTable *dataStructure, u64 key, Stack value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddU64StackP(FlatHashTable *dataStructure, u64 key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PStack(FlatHashTable *dataStructure, const volatile u64* key, Stack value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddU64PStackP(FlatHashTable *dataStructure, const volatile u64* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64RedBlackTree(FlatHashTable *dataStructure, u64 key, RedBlackTree value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddU64RedBlackTreeP(FlatHashTable *dataStructure, u64 key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PRedBlackTree(FlatHashTable *dataStructure, const volatile u64* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddU64PRedBlackTreeP(FlatHashTable *dataStructure, const volatile u64* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64HashTable(FlatHashTable *dataStructure, u64 key, HashTable value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddU64HashTableP(FlatHashTable *dataStructure, u64 key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PHashTable(FlatHashTable *dataStructure, const volatile u64* key, HashTable value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddU64PHashTableP(FlatHashTable *dataStructure, const volatile u64* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64Vector(FlatHashTable *dataStructure, u64 key, Vector value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddU64VectorP(FlatHashTable *dataStructure, u64 key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PVector(FlatHashTable *dataStructure, const volatile u64* key, Vector value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddU64PVectorP(FlatHashTable *dataStructure, const volatile u64* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64String(FlatHashTable *dataStructure, u64 key, const volatile char* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddU64StringP(FlatHashTable *dataStructure, u64 key, const volatile char** value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PString(FlatHashTable *dataStructure, const volatile u64* key, const volatile char* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddU64PStringP(FlatHashTable *dataStructure, const volatile u64* key, const volatile char** value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64Bytes(FlatHashTable *dataStructure, u64 key, Bytes value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddU64BytesP(FlatHashTable *dataStructure, u64 key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PBytes(FlatHashTable *dataStructure, const volatile u64* key, Bytes value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddU64PBytesP(FlatHashTable *dataStructure, const volatile u64* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64Pointer(FlatHashTable *dataStructure, u64 key, void* value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddU64PointerP(FlatHashTable *dataStructure, u64 key, const volatile void** value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64PPointer(FlatHashTable *dataStructure, const volatile u64* key, void* value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddU64PPointerP(FlatHashTable *dataStructure, const volatile u64* key, const volatile void** value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU64I8(FlatHashTable *dataStructure, u64 key, i8 value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddU64PI8(FlatHashTable *dataStructure, const volatile u64* key, i8 value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddU64U8(FlatHashTable *dataStructure, u64 key, u8 value) {
+  if (dataStructure->keyType != typeU64) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddU64PU8(FlatHashTable *dataStructure, const volatile u64* key, u8 value) {
+  if (dataStructure->keyType != typeU64NoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddFloatBool(FlatHashTable *dataStructure, float key, bool value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddFloatBoolP(FlatHashTable *dataStructure, float key, const volatile bool* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPBool(FlatHashTable *dataStructure, const volatile float* key, bool value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddFloatPBoolP(FlatHashTable *dataStructure, const volatile float* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatI16(FlatHashTable *dataStructure, float key, i16 value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddFloatI16P(FlatHashTable *dataStructure, float key, const volatile i16* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPI16(FlatHashTable *dataStructure, const volatile float* key, i16 value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddFloatPI16P(FlatHashTable *dataStructure, const volatile float* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatU16(FlatHashTable *dataStructure, float key, u16 value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddFloatU16P(FlatHashTable *dataStructure, float key, const volatile u16* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPU16(FlatHashTable *dataStructure, const volatile float* key, u16 value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddFloatPU16P(FlatHashTable *dataStructure, const volatile float* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatI32(FlatHashTable *dataStructure, float key, i32 value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddFloatI32P(FlatHashTable *dataStructure, float key, const volatile i32* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPI32(FlatHashTable *dataStructure, const volatile float* key, i32 value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddFloatPI32P(FlatHashTable *dataStructure, const volatile float* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatU32(FlatHashTable *dataStructure, float key, u32 value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddFloatU32P(FlatHashTable *dataStructure, float key, const volatile u32* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPU32(FlatHashTable *dataStructure, const volatile float* key, u32 value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddFloatPU32P(FlatHashTable *dataStructure, const volatile float* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatI64(FlatHashTable *dataStructure, float key, i64 value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddFloatI64P(FlatHashTable *dataStructure, float key, const volatile i64* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPI64(FlatHashTable *dataStructure, const volatile float* key, i64 value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddFloatPI64P(FlatHashTable *dataStructure, const volatile float* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatU64(FlatHashTable *dataStructure, float key, u64 value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddFloatU64P(FlatHashTable *dataStructure, float key, const volatile u64* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPU64(FlatHashTable *dataStructure, const volatile float* key, u64 value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddFloatPU64P(FlatHashTable *dataStructure, const volatile float* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatFloat(FlatHashTable *dataStructure, float key, float value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddFloatFloatP(FlatHashTable *dataStructure, float key, const volatile float* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPFloat(FlatHashTable *dataStructure, const volatile float* key, float value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddFloatPFloatP(FlatHashTable *dataStructure, const volatile float* key, const volatile float* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatDouble(FlatHashTable *dataStructure, float key, double value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddFloatDoubleP(FlatHashTable *dataStructure, float key, const volatile double* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPDouble(FlatHashTable *dataStructure, const volatile float* key, double value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddFloatPDoubleP(FlatHashTable *dataStructure, const volatile float* key, const volatile double* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatLongDouble(FlatHashTable *dataStructure, float key, long double value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddFloatLongDoubleP(FlatHashTable *dataStructure, float key, const volatile long double* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPLongDouble(FlatHashTable *dataStructure, const volatile float* key, long double value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddFloatPLongDoubleP(FlatHashTable *dataStructure, const volatile float* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatList(FlatHashTable *dataStructure, float key, List value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddFloatListP(FlatHashTable *dataStructure, float key, const volatile List* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPList(FlatHashTable *dataStructure, const volatile float* key, List value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddFloatPListP(FlatHashTable *dataStructure, const volatile float* key, const volatile List* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatQueue(FlatHashTable *dataStructure, float key, Queue value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddFloatQueueP(FlatHashTable *dataStructure, float key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPQueue(FlatHashTable *dataStructure, const volatile float* key, Queue value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddFloatPQueueP(FlatHashTable *dataStructure, const volatile float* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatStack(FlatHashTable *dataStructure, float key, Stack value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddFloatStackP(FlatHashTable *dataStructure, float key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPStack(FlatHashTable *dataStructure, const volatile float* key, Stack value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddFloatPStackP(FlatHashTable *dataStructure, const volatile float* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatRedBlackTree(FlatHashTable *dataStructure, float key, RedBlackTree value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddFloatRedBlackTreeP(FlatHashTable *dataStructure, float key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPRedBlackTree(FlatHashTable *dataStructure, const volatile float* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddFloatPRedBlackTreeP(FlatHashTable *dataStructure, const volatile float* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatHashTable(FlatHashTable *dataStructure, float key, HashTable value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddFloatHashTableP(FlatHashTable *dataStructure, float key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPHashTable(FlatHashTable *dataStructure, const volatile float* key, HashTable value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddFloatPHashTableP(FlatHashTable *dataStructure, const volatile float* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatVector(FlatHashTable *dataStructure, float key, Vector value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddFloatVectorP(FlatHashTable *dataStructure, float key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPVector(FlatHashTable *dataStructure, const volatile float* key, Vector value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddFloatPVectorP(FlatHashTable *dataStructure, const volatile float* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatString(FlatHashTable *dataStructure, float key, const volatile char* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddFloatStringP(FlatHashTable *dataStructure, float key, const volatile char** value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPString(FlatHashTable *dataStructure, const volatile float* key, const volatile char* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddFloatPStringP(FlatHashTable *dataStructure, const volatile float* key, const volatile char** value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatBytes(FlatHashTable *dataStructure, float key, Bytes value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddFloatBytesP(FlatHashTable *dataStructure, float key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPBytes(FlatHashTable *dataStructure, const volatile float* key, Bytes value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddFloatPBytesP(FlatHashTable *dataStructure, const volatile float* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPointer(FlatHashTable *dataStructure, float key, void* value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddFloatPointerP(FlatHashTable *dataStructure, float key, const volatile void** value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatPPointer(FlatHashTable *dataStructure, const volatile float* key, void* value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddFloatPPointerP(FlatHashTable *dataStructure, const volatile float* key, const volatile void** value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddFloatI8(FlatHashTable *dataStructure, float key, i8 value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddFloatPI8(FlatHashTable *dataStructure, const volatile float* key, i8 value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddFloatU8(FlatHashTable *dataStructure, float key, u8 value) {
+  if (dataStructure->keyType != typeFloat) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddFloatPU8(FlatHashTable *dataStructure, const volatile float* key, u8 value) {
+  if (dataStructure->keyType != typeFloatNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddDoubleBool(FlatHashTable *dataStructure, double key, bool value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddDoubleBoolP(FlatHashTable *dataStructure, double key, const volatile bool* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePBool(FlatHashTable *dataStructure, const volatile double* key, bool value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddDoublePBoolP(FlatHashTable *dataStructure, const volatile double* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleI16(FlatHashTable *dataStructure, double key, i16 value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddDoubleI16P(FlatHashTable *dataStructure, double key, const volatile i16* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePI16(FlatHashTable *dataStructure, const volatile double* key, i16 value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddDoublePI16P(FlatHashTable *dataStructure, const volatile double* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleU16(FlatHashTable *dataStructure, double key, u16 value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddDoubleU16P(FlatHashTable *dataStructure, double key, const volatile u16* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePU16(FlatHashTable *dataStructure, const volatile double* key, u16 value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddDoublePU16P(FlatHashTable *dataStructure, const volatile double* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleI32(FlatHashTable *dataStructure, double key, i32 value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddDoubleI32P(FlatHashTable *dataStructure, double key, const volatile i32* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePI32(FlatHashTable *dataStructure, const volatile double* key, i32 value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddDoublePI32P(FlatHashTable *dataStructure, const volatile double* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleU32(FlatHashTable *dataStructure, double key, u32 value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddDoubleU32P(FlatHashTable *dataStructure, double key, const volatile u32* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePU32(FlatHashTable *dataStructure, const volatile double* key, u32 value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddDoublePU32P(FlatHashTable *dataStructure, const volatile double* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleI64(FlatHashTable *dataStructure, double key, i64 value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddDoubleI64P(FlatHashTable *dataStructure, double key, const volatile i64* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePI64(FlatHashTable *dataStructure, const volatile double* key, i64 value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddDoublePI64P(FlatHashTable *dataStructure, const volatile double* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleU64(FlatHashTable *dataStructure, double key, u64 value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddDoubleU64P(FlatHashTable *dataStructure, double key, const volatile u64* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePU64(FlatHashTable *dataStructure, const volatile double* key, u64 value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddDoublePU64P(FlatHashTable *dataStructure, const volatile double* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleFloat(FlatHashTable *dataStructure, double key, float value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddDoubleFloatP(FlatHashTable *dataStructure, double key, const volatile float* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePFloat(FlatHashTable *dataStructure, const volatile double* key, float value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddDoublePFloatP(FlatHashTable *dataStructure, const volatile double* key, const volatile float* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleDouble(FlatHashTable *dataStructure, double key, double value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddDoubleDoubleP(FlatHashTable *dataStructure, double key, const volatile double* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePDouble(FlatHashTable *dataStructure, const volatile double* key, double value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddDoublePDoubleP(FlatHashTable *dataStructure, const volatile double* key, const volatile double* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleLongDouble(FlatHashTable *dataStructure, double key, long double value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddDoubleLongDoubleP(FlatHashTable *dataStructure, double key, const volatile long double* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePLongDouble(FlatHashTable *dataStructure, const volatile double* key, long double value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddDoublePLongDoubleP(FlatHashTable *dataStructure, const volatile double* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleList(FlatHashTable *dataStructure, double key, List value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddDoubleListP(FlatHashTable *dataStructure, double key, const volatile List* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePList(FlatHashTable *dataStructure, const volatile double* key, List value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddDoublePListP(FlatHashTable *dataStructure, const volatile double* key, const volatile List* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleQueue(FlatHashTable *dataStructure, double key, Queue value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddDoubleQueueP(FlatHashTable *dataStructure, double key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePQueue(FlatHashTable *dataStructure, const volatile double* key, Queue value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddDoublePQueueP(FlatHashTable *dataStructure, const volatile double* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleStack(FlatHashTable *dataStructure, double key, Stack value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddDoubleStackP(FlatHashTable *dataStructure, double key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePStack(FlatHashTable *dataStructure, const volatile double* key, Stack value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddDoublePStackP(FlatHashTable *dataStructure, const volatile double* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleRedBlackTree(FlatHashTable *dataStructure, double key, RedBlackTree value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddDoubleRedBlackTreeP(FlatHashTable *dataStructure, double key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePRedBlackTree(FlatHashTable *dataStructure, const volatile double* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddDoublePRedBlackTreeP(FlatHashTable *dataStructure, const volatile double* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleHashTable(FlatHashTable *dataStructure, double key, HashTable value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddDoubleHashTableP(FlatHashTable *dataStructure, double key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePHashTable(FlatHashTable *dataStructure, const volatile double* key, HashTable value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddDoublePHashTableP(FlatHashTable *dataStructure, const volatile double* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleVector(FlatHashTable *dataStructure, double key, Vector value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddDoubleVectorP(FlatHashTable *dataStructure, double key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePVector(FlatHashTable *dataStructure, const volatile double* key, Vector value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddDoublePVectorP(FlatHashTable *dataStructure, const volatile double* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleString(FlatHashTable *dataStructure, double key, const volatile char* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddDoubleStringP(FlatHashTable *dataStructure, double key, const volatile char** value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePString(FlatHashTable *dataStructure, const volatile double* key, const volatile char* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddDoublePStringP(FlatHashTable *dataStructure, const volatile double* key, const volatile char** value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleBytes(FlatHashTable *dataStructure, double key, Bytes value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddDoubleBytesP(FlatHashTable *dataStructure, double key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePBytes(FlatHashTable *dataStructure, const volatile double* key, Bytes value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddDoublePBytesP(FlatHashTable *dataStructure, const volatile double* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePointer(FlatHashTable *dataStructure, double key, void* value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddDoublePointerP(FlatHashTable *dataStructure, double key, const volatile void** value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoublePPointer(FlatHashTable *dataStructure, const volatile double* key, void* value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddDoublePPointerP(FlatHashTable *dataStructure, const volatile double* key, const volatile void** value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddDoubleI8(FlatHashTable *dataStructure, double key, i8 value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddDoublePI8(FlatHashTable *dataStructure, const volatile double* key, i8 value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddDoubleU8(FlatHashTable *dataStructure, double key, u8 value) {
+  if (dataStructure->keyType != typeDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddDoublePU8(FlatHashTable *dataStructure, const volatile double* key, u8 value) {
+  if (dataStructure->keyType != typeDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleBool(FlatHashTable *dataStructure, long double key, bool value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleBoolP(FlatHashTable *dataStructure, long double key, const volatile bool* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePBool(FlatHashTable *dataStructure, const volatile long double* key, bool value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePBoolP(FlatHashTable *dataStructure, const volatile long double* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleI16(FlatHashTable *dataStructure, long double key, i16 value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleI16P(FlatHashTable *dataStructure, long double key, const volatile i16* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePI16(FlatHashTable *dataStructure, const volatile long double* key, i16 value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePI16P(FlatHashTable *dataStructure, const volatile long double* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleU16(FlatHashTable *dataStructure, long double key, u16 value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleU16P(FlatHashTable *dataStructure, long double key, const volatile u16* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePU16(FlatHashTable *dataStructure, const volatile long double* key, u16 value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePU16P(FlatHashTable *dataStructure, const volatile long double* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleI32(FlatHashTable *dataStructure, long double key, i32 value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleI32P(FlatHashTable *dataStructure, long double key, const volatile i32* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePI32(FlatHashTable *dataStructure, const volatile long double* key, i32 value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePI32P(FlatHashTable *dataStructure, const volatile long double* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleU32(FlatHashTable *dataStructure, long double key, u32 value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleU32P(FlatHashTable *dataStructure, long double key, const volatile u32* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePU32(FlatHashTable *dataStructure, const volatile long double* key, u32 value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePU32P(FlatHashTable *dataStructure, const volatile long double* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleI64(FlatHashTable *dataStructure, long double key, i64 value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleI64P(FlatHashTable *dataStructure, long double key, const volatile i64* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePI64(FlatHashTable *dataStructure, const volatile long double* key, i64 value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePI64P(FlatHashTable *dataStructure, const volatile long double* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleU64(FlatHashTable *dataStructure, long double key, u64 value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleU64P(FlatHashTable *dataStructure, long double key, const volatile u64* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePU64(FlatHashTable *dataStructure, const volatile long double* key, u64 value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePU64P(FlatHashTable *dataStructure, const volatile long double* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleFloat(FlatHashTable *dataStructure, long double key, float value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleFloatP(FlatHashTable *dataStructure, long double key, const volatile float* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePFloat(FlatHashTable *dataStructure, const volatile long double* key, float value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePFloatP(FlatHashTable *dataStructure, const volatile long double* key, const volatile float* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleDouble(FlatHashTable *dataStructure, long double key, double value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleDoubleP(FlatHashTable *dataStructure, long double key, const volatile double* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePDouble(FlatHashTable *dataStructure, const volatile long double* key, double value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePDoubleP(FlatHashTable *dataStructure, const volatile long double* key, const volatile double* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleLongDouble(FlatHashTable *dataStructure, long double key, long double value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleLongDoubleP(FlatHashTable *dataStructure, long double key, const volatile long double* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePLongDouble(FlatHashTable *dataStructure, const volatile long double* key, long double value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePLongDoubleP(FlatHashTable *dataStructure, const volatile long double* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleList(FlatHashTable *dataStructure, long double key, List value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleListP(FlatHashTable *dataStructure, long double key, const volatile List* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePList(FlatHashTable *dataStructure, const volatile long double* key, List value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePListP(FlatHashTable *dataStructure, const volatile long double* key, const volatile List* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleQueue(FlatHashTable *dataStructure, long double key, Queue value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleQueueP(FlatHashTable *dataStructure, long double key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePQueue(FlatHashTable *dataStructure, const volatile long double* key, Queue value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePQueueP(FlatHashTable *dataStructure, const volatile long double* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleStack(FlatHashTable *dataStructure, long double key, Stack value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleStackP(FlatHashTable *dataStructure, long double key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePStack(FlatHashTable *dataStructure, const volatile long double* key, Stack value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePStackP(FlatHashTable *dataStructure, const volatile long double* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleRedBlackTree(FlatHashTable *dataStructure, long double key, RedBlackTree value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleRedBlackTreeP(FlatHashTable *dataStructure, long double key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePRedBlackTree(FlatHashTable *dataStructure, const volatile long double* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePRedBlackTreeP(FlatHashTable *dataStructure, const volatile long double* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleHashTable(FlatHashTable *dataStructure, long double key, HashTable value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleHashTableP(FlatHashTable *dataStructure, long double key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePHashTable(FlatHashTable *dataStructure, const volatile long double* key, HashTable value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePHashTableP(FlatHashTable *dataStructure, const volatile long double* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleVector(FlatHashTable *dataStructure, long double key, Vector value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleVectorP(FlatHashTable *dataStructure, long double key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePVector(FlatHashTable *dataStructure, const volatile long double* key, Vector value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePVectorP(FlatHashTable *dataStructure, const volatile long double* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleString(FlatHashTable *dataStructure, long double key, const volatile char* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleStringP(FlatHashTable *dataStructure, long double key, const volatile char** value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePString(FlatHashTable *dataStructure, const volatile long double* key, const volatile char* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePStringP(FlatHashTable *dataStructure, const volatile long double* key, const volatile char** value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleBytes(FlatHashTable *dataStructure, long double key, Bytes value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleBytesP(FlatHashTable *dataStructure, long double key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePBytes(FlatHashTable *dataStructure, const volatile long double* key, Bytes value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePBytesP(FlatHashTable *dataStructure, const volatile long double* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePointer(FlatHashTable *dataStructure, long double key, void* value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePointerP(FlatHashTable *dataStructure, long double key, const volatile void** value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePPointer(FlatHashTable *dataStructure, const volatile long double* key, void* value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePPointerP(FlatHashTable *dataStructure, const volatile long double* key, const volatile void** value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleI8(FlatHashTable *dataStructure, long double key, i8 value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePI8(FlatHashTable *dataStructure, const volatile long double* key, i8 value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddLongDoubleU8(FlatHashTable *dataStructure, long double key, u8 value) {
+  if (dataStructure->keyType != typeLongDouble) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddLongDoublePU8(FlatHashTable *dataStructure, const volatile long double* key, u8 value) {
+  if (dataStructure->keyType != typeLongDoubleNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddListBool(FlatHashTable *dataStructure, List key, bool value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddListBoolP(FlatHashTable *dataStructure, List key, const volatile bool* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPBool(FlatHashTable *dataStructure, const volatile List* key, bool value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddListPBoolP(FlatHashTable *dataStructure, const volatile List* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListI16(FlatHashTable *dataStructure, List key, i16 value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddListI16P(FlatHashTable *dataStructure, List key, const volatile i16* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPI16(FlatHashTable *dataStructure, const volatile List* key, i16 value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddListPI16P(FlatHashTable *dataStructure, const volatile List* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListU16(FlatHashTable *dataStructure, List key, u16 value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddListU16P(FlatHashTable *dataStructure, List key, const volatile u16* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPU16(FlatHashTable *dataStructure, const volatile List* key, u16 value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddListPU16P(FlatHashTable *dataStructure, const volatile List* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListI32(FlatHashTable *dataStructure, List key, i32 value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddListI32P(FlatHashTable *dataStructure, List key, const volatile i32* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPI32(FlatHashTable *dataStructure, const volatile List* key, i32 value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddListPI32P(FlatHashTable *dataStructure, const volatile List* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListU32(FlatHashTable *dataStructure, List key, u32 value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddListU32P(FlatHashTable *dataStructure, List key, const volatile u32* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPU32(FlatHashTable *dataStructure, const volatile List* key, u32 value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddListPU32P(FlatHashTable *dataStructure, const volatile List* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListI64(FlatHashTable *dataStructure, List key, i64 value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddListI64P(FlatHashTable *dataStructure, List key, const volatile i64* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPI64(FlatHashTable *dataStructure, const volatile List* key, i64 value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddListPI64P(FlatHashTable *dataStructure, const volatile List* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListU64(FlatHashTable *dataStructure, List key, u64 value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddListU64P(FlatHashTable *dataStructure, List key, const volatile u64* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPU64(FlatHashTable *dataStructure, const volatile List* key, u64 value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddListPU64P(FlatHashTable *dataStructure, const volatile List* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListFloat(FlatHashTable *dataStructure, List key, float value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddListFloatP(FlatHashTable *dataStructure, List key, const volatile float* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPFloat(FlatHashTable *dataStructure, const volatile List* key, float value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddListPFloatP(FlatHashTable *dataStructure, const volatile List* key, const volatile float* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListDouble(FlatHashTable *dataStructure, List key, double value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddListDoubleP(FlatHashTable *dataStructure, List key, const volatile double* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPDouble(FlatHashTable *dataStructure, const volatile List* key, double value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddListPDoubleP(FlatHashTable *dataStructure, const volatile List* key, const volatile double* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListLongDouble(FlatHashTable *dataStructure, List key, long double value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddListLongDoubleP(FlatHashTable *dataStructure, List key, const volatile long double* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPLongDouble(FlatHashTable *dataStructure, const volatile List* key, long double value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddListPLongDoubleP(FlatHashTable *dataStructure, const volatile List* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListList(FlatHashTable *dataStructure, List key, List value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddListListP(FlatHashTable *dataStructure, List key, const volatile List* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPList(FlatHashTable *dataStructure, const volatile List* key, List value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddListPListP(FlatHashTable *dataStructure, const volatile List* key, const volatile List* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListQueue(FlatHashTable *dataStructure, List key, Queue value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddListQueueP(FlatHashTable *dataStructure, List key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPQueue(FlatHashTable *dataStructure, const volatile List* key, Queue value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddListPQueueP(FlatHashTable *dataStructure, const volatile List* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListStack(FlatHashTable *dataStructure, List key, Stack value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddListStackP(FlatHashTable *dataStructure, List key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPStack(FlatHashTable *dataStructure, const volatile List* key, Stack value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddListPStackP(FlatHashTable *dataStructure, const volatile List* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListRedBlackTree(FlatHashTable *dataStructure, List key, RedBlackTree value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddListRedBlackTreeP(FlatHashTable *dataStructure, List key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPRedBlackTree(FlatHashTable *dataStructure, const volatile List* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddListPRedBlackTreeP(FlatHashTable *dataStructure, const volatile List* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListHashTable(FlatHashTable *dataStructure, List key, HashTable value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddListHashTableP(FlatHashTable *dataStructure, List key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPHashTable(FlatHashTable *dataStructure, const volatile List* key, HashTable value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddListPHashTableP(FlatHashTable *dataStructure, const volatile List* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListVector(FlatHashTable *dataStructure, List key, Vector value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddListVectorP(FlatHashTable *dataStructure, List key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPVector(FlatHashTable *dataStructure, const volatile List* key, Vector value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddListPVectorP(FlatHashTable *dataStructure, const volatile List* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListString(FlatHashTable *dataStructure, List key, const volatile char* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddListStringP(FlatHashTable *dataStructure, List key, const volatile char** value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPString(FlatHashTable *dataStructure, const volatile List* key, const volatile char* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddListPStringP(FlatHashTable *dataStructure, const volatile List* key, const volatile char** value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListBytes(FlatHashTable *dataStructure, List key, Bytes value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddListBytesP(FlatHashTable *dataStructure, List key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPBytes(FlatHashTable *dataStructure, const volatile List* key, Bytes value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddListPBytesP(FlatHashTable *dataStructure, const volatile List* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPointer(FlatHashTable *dataStructure, List key, void* value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddListPointerP(FlatHashTable *dataStructure, List key, const volatile void** value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListPPointer(FlatHashTable *dataStructure, const volatile List* key, void* value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddListPPointerP(FlatHashTable *dataStructure, const volatile List* key, const volatile void** value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddListI8(FlatHashTable *dataStructure, List key, i8 value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddListPI8(FlatHashTable *dataStructure, const volatile List* key, i8 value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddListU8(FlatHashTable *dataStructure, List key, u8 value) {
+  if (dataStructure->keyType != typeList) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddListPU8(FlatHashTable *dataStructure, const volatile List* key, u8 value) {
+  if (dataStructure->keyType != typeListNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddQueueBool(FlatHashTable *dataStructure, Queue key, bool value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddQueueBoolP(FlatHashTable *dataStructure, Queue key, const volatile bool* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePBool(FlatHashTable *dataStructure, const volatile Queue* key, bool value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddQueuePBoolP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueI16(FlatHashTable *dataStructure, Queue key, i16 value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddQueueI16P(FlatHashTable *dataStructure, Queue key, const volatile i16* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePI16(FlatHashTable *dataStructure, const volatile Queue* key, i16 value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddQueuePI16P(FlatHashTable *dataStructure, const volatile Queue* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueU16(FlatHashTable *dataStructure, Queue key, u16 value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddQueueU16P(FlatHashTable *dataStructure, Queue key, const volatile u16* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePU16(FlatHashTable *dataStructure, const volatile Queue* key, u16 value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddQueuePU16P(FlatHashTable *dataStructure, const volatile Queue* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueI32(FlatHashTable *dataStructure, Queue key, i32 value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddQueueI32P(FlatHashTable *dataStructure, Queue key, const volatile i32* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePI32(FlatHashTable *dataStructure, const volatile Queue* key, i32 value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddQueuePI32P(FlatHashTable *dataStructure, const volatile Queue* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueU32(FlatHashTable *dataStructure, Queue key, u32 value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddQueueU32P(FlatHashTable *dataStructure, Queue key, const volatile u32* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePU32(FlatHashTable *dataStructure, const volatile Queue* key, u32 value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddQueuePU32P(FlatHashTable *dataStructure, const volatile Queue* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueI64(FlatHashTable *dataStructure, Queue key, i64 value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddQueueI64P(FlatHashTable *dataStructure, Queue key, const volatile i64* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePI64(FlatHashTable *dataStructure, const volatile Queue* key, i64 value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddQueuePI64P(FlatHashTable *dataStructure, const volatile Queue* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueU64(FlatHashTable *dataStructure, Queue key, u64 value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddQueueU64P(FlatHashTable *dataStructure, Queue key, const volatile u64* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePU64(FlatHashTable *dataStructure, const volatile Queue* key, u64 value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddQueuePU64P(FlatHashTable *dataStructure, const volatile Queue* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueFloat(FlatHashTable *dataStructure, Queue key, float value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddQueueFloatP(FlatHashTable *dataStructure, Queue key, const volatile float* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePFloat(FlatHashTable *dataStructure, const volatile Queue* key, float value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddQueuePFloatP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile float* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueDouble(FlatHashTable *dataStructure, Queue key, double value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddQueueDoubleP(FlatHashTable *dataStructure, Queue key, const volatile double* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePDouble(FlatHashTable *dataStructure, const volatile Queue* key, double value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddQueuePDoubleP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile double* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueLongDouble(FlatHashTable *dataStructure, Queue key, long double value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddQueueLongDoubleP(FlatHashTable *dataStructure, Queue key, const volatile long double* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePLongDouble(FlatHashTable *dataStructure, const volatile Queue* key, long double value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddQueuePLongDoubleP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueList(FlatHashTable *dataStructure, Queue key, List value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddQueueListP(FlatHashTable *dataStructure, Queue key, const volatile List* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePList(FlatHashTable *dataStructure, const volatile Queue* key, List value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddQueuePListP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile List* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueQueue(FlatHashTable *dataStructure, Queue key, Queue value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddQueueQueueP(FlatHashTable *dataStructure, Queue key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePQueue(FlatHashTable *dataStructure, const volatile Queue* key, Queue value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddQueuePQueueP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueStack(FlatHashTable *dataStructure, Queue key, Stack value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddQueueStackP(FlatHashTable *dataStructure, Queue key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePStack(FlatHashTable *dataStructure, const volatile Queue* key, Stack value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddQueuePStackP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueRedBlackTree(FlatHashTable *dataStructure, Queue key, RedBlackTree value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddQueueRedBlackTreeP(FlatHashTable *dataStructure, Queue key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePRedBlackTree(FlatHashTable *dataStructure, const volatile Queue* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddQueuePRedBlackTreeP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueHashTable(FlatHashTable *dataStructure, Queue key, HashTable value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddQueueHashTableP(FlatHashTable *dataStructure, Queue key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePHashTable(FlatHashTable *dataStructure, const volatile Queue* key, HashTable value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddQueuePHashTableP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueVector(FlatHashTable *dataStructure, Queue key, Vector value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddQueueVectorP(FlatHashTable *dataStructure, Queue key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePVector(FlatHashTable *dataStructure, const volatile Queue* key, Vector value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddQueuePVectorP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueString(FlatHashTable *dataStructure, Queue key, const volatile char* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddQueueStringP(FlatHashTable *dataStructure, Queue key, const volatile char** value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePString(FlatHashTable *dataStructure, const volatile Queue* key, const volatile char* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddQueuePStringP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile char** value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueBytes(FlatHashTable *dataStructure, Queue key, Bytes value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddQueueBytesP(FlatHashTable *dataStructure, Queue key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePBytes(FlatHashTable *dataStructure, const volatile Queue* key, Bytes value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddQueuePBytesP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePointer(FlatHashTable *dataStructure, Queue key, void* value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddQueuePointerP(FlatHashTable *dataStructure, Queue key, const volatile void** value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueuePPointer(FlatHashTable *dataStructure, const volatile Queue* key, void* value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddQueuePPointerP(FlatHashTable *dataStructure, const volatile Queue* key, const volatile void** value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddQueueI8(FlatHashTable *dataStructure, Queue key, i8 value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddQueuePI8(FlatHashTable *dataStructure, const volatile Queue* key, i8 value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddQueueU8(FlatHashTable *dataStructure, Queue key, u8 value) {
+  if (dataStructure->keyType != typeQueue) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddQueuePU8(FlatHashTable *dataStructure, const volatile Queue* key, u8 value) {
+  if (dataStructure->keyType != typeQueueNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddStackBool(FlatHashTable *dataStructure, Stack key, bool value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddStackBoolP(FlatHashTable *dataStructure, Stack key, const volatile bool* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPBool(FlatHashTable *dataStructure, const volatile Stack* key, bool value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddStackPBoolP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackI16(FlatHashTable *dataStructure, Stack key, i16 value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddStackI16P(FlatHashTable *dataStructure, Stack key, const volatile i16* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPI16(FlatHashTable *dataStructure, const volatile Stack* key, i16 value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddStackPI16P(FlatHashTable *dataStructure, const volatile Stack* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackU16(FlatHashTable *dataStructure, Stack key, u16 value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddStackU16P(FlatHashTable *dataStructure, Stack key, const volatile u16* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPU16(FlatHashTable *dataStructure, const volatile Stack* key, u16 value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddStackPU16P(FlatHashTable *dataStructure, const volatile Stack* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackI32(FlatHashTable *dataStructure, Stack key, i32 value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddStackI32P(FlatHashTable *dataStructure, Stack key, const volatile i32* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPI32(FlatHashTable *dataStructure, const volatile Stack* key, i32 value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddStackPI32P(FlatHashTable *dataStructure, const volatile Stack* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackU32(FlatHashTable *dataStructure, Stack key, u32 value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddStackU32P(FlatHashTable *dataStructure, Stack key, const volatile u32* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPU32(FlatHashTable *dataStructure, const volatile Stack* key, u32 value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddStackPU32P(FlatHashTable *dataStructure, const volatile Stack* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackI64(FlatHashTable *dataStructure, Stack key, i64 value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddStackI64P(FlatHashTable *dataStructure, Stack key, const volatile i64* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPI64(FlatHashTable *dataStructure, const volatile Stack* key, i64 value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddStackPI64P(FlatHashTable *dataStructure, const volatile Stack* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackU64(FlatHashTable *dataStructure, Stack key, u64 value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddStackU64P(FlatHashTable *dataStructure, Stack key, const volatile u64* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPU64(FlatHashTable *dataStructure, const volatile Stack* key, u64 value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddStackPU64P(FlatHashTable *dataStructure, const volatile Stack* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackFloat(FlatHashTable *dataStructure, Stack key, float value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddStackFloatP(FlatHashTable *dataStructure, Stack key, const volatile float* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPFloat(FlatHashTable *dataStructure, const volatile Stack* key, float value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddStackPFloatP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile float* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackDouble(FlatHashTable *dataStructure, Stack key, double value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddStackDoubleP(FlatHashTable *dataStructure, Stack key, const volatile double* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPDouble(FlatHashTable *dataStructure, const volatile Stack* key, double value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddStackPDoubleP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile double* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackLongDouble(FlatHashTable *dataStructure, Stack key, long double value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddStackLongDoubleP(FlatHashTable *dataStructure, Stack key, const volatile long double* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPLongDouble(FlatHashTable *dataStructure, const volatile Stack* key, long double value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddStackPLongDoubleP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackList(FlatHashTable *dataStructure, Stack key, List value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddStackListP(FlatHashTable *dataStructure, Stack key, const volatile List* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPList(FlatHashTable *dataStructure, const volatile Stack* key, List value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddStackPListP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile List* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackQueue(FlatHashTable *dataStructure, Stack key, Queue value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddStackQueueP(FlatHashTable *dataStructure, Stack key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPQueue(FlatHashTable *dataStructure, const volatile Stack* key, Queue value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddStackPQueueP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackStack(FlatHashTable *dataStructure, Stack key, Stack value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddStackStackP(FlatHashTable *dataStructure, Stack key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPStack(FlatHashTable *dataStructure, const volatile Stack* key, Stack value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddStackPStackP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackRedBlackTree(FlatHashTable *dataStructure, Stack key, RedBlackTree value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddStackRedBlackTreeP(FlatHashTable *dataStructure, Stack key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPRedBlackTree(FlatHashTable *dataStructure, const volatile Stack* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddStackPRedBlackTreeP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackHashTable(FlatHashTable *dataStructure, Stack key, HashTable value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddStackHashTableP(FlatHashTable *dataStructure, Stack key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPHashTable(FlatHashTable *dataStructure, const volatile Stack* key, HashTable value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddStackPHashTableP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackVector(FlatHashTable *dataStructure, Stack key, Vector value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddStackVectorP(FlatHashTable *dataStructure, Stack key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPVector(FlatHashTable *dataStructure, const volatile Stack* key, Vector value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddStackPVectorP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackString(FlatHashTable *dataStructure, Stack key, const volatile char* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddStackStringP(FlatHashTable *dataStructure, Stack key, const volatile char** value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPString(FlatHashTable *dataStructure, const volatile Stack* key, const volatile char* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddStackPStringP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile char** value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackBytes(FlatHashTable *dataStructure, Stack key, Bytes value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddStackBytesP(FlatHashTable *dataStructure, Stack key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPBytes(FlatHashTable *dataStructure, const volatile Stack* key, Bytes value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddStackPBytesP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPointer(FlatHashTable *dataStructure, Stack key, void* value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddStackPointerP(FlatHashTable *dataStructure, Stack key, const volatile void** value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackPPointer(FlatHashTable *dataStructure, const volatile Stack* key, void* value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddStackPPointerP(FlatHashTable *dataStructure, const volatile Stack* key, const volatile void** value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStackI8(FlatHashTable *dataStructure, Stack key, i8 value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddStackPI8(FlatHashTable *dataStructure, const volatile Stack* key, i8 value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddStackU8(FlatHashTable *dataStructure, Stack key, u8 value) {
+  if (dataStructure->keyType != typeStack) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddStackPU8(FlatHashTable *dataStructure, const volatile Stack* key, u8 value) {
+  if (dataStructure->keyType != typeStackNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeBool(FlatHashTable *dataStructure, RedBlackTree key, bool value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeBoolP(FlatHashTable *dataStructure, RedBlackTree key, const volatile bool* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePBool(FlatHashTable *dataStructure, const volatile RedBlackTree* key, bool value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePBoolP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeI16(FlatHashTable *dataStructure, RedBlackTree key, i16 value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeI16P(FlatHashTable *dataStructure, RedBlackTree key, const volatile i16* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePI16(FlatHashTable *dataStructure, const volatile RedBlackTree* key, i16 value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePI16P(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeU16(FlatHashTable *dataStructure, RedBlackTree key, u16 value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeU16P(FlatHashTable *dataStructure, RedBlackTree key, const volatile u16* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePU16(FlatHashTable *dataStructure, const volatile RedBlackTree* key, u16 value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePU16P(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeI32(FlatHashTable *dataStructure, RedBlackTree key, i32 value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeI32P(FlatHashTable *dataStructure, RedBlackTree key, const volatile i32* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePI32(FlatHashTable *dataStructure, const volatile RedBlackTree* key, i32 value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePI32P(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeU32(FlatHashTable *dataStructure, RedBlackTree key, u32 value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeU32P(FlatHashTable *dataStructure, RedBlackTree key, const volatile u32* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePU32(FlatHashTable *dataStructure, const volatile RedBlackTree* key, u32 value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePU32P(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeI64(FlatHashTable *dataStructure, RedBlackTree key, i64 value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeI64P(FlatHashTable *dataStructure, RedBlackTree key, const volatile i64* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePI64(FlatHashTable *dataStructure, const volatile RedBlackTree* key, i64 value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePI64P(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeU64(FlatHashTable *dataStructure, RedBlackTree key, u64 value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeU64P(FlatHashTable *dataStructure, RedBlackTree key, const volatile u64* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePU64(FlatHashTable *dataStructure, const volatile RedBlackTree* key, u64 value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePU64P(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeFloat(FlatHashTable *dataStructure, RedBlackTree key, float value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeFloatP(FlatHashTable *dataStructure, RedBlackTree key, const volatile float* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePFloat(FlatHashTable *dataStructure, const volatile RedBlackTree* key, float value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePFloatP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile float* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeDouble(FlatHashTable *dataStructure, RedBlackTree key, double value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeDoubleP(FlatHashTable *dataStructure, RedBlackTree key, const volatile double* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePDouble(FlatHashTable *dataStructure, const volatile RedBlackTree* key, double value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePDoubleP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile double* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeLongDouble(FlatHashTable *dataStructure, RedBlackTree key, long double value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeLongDoubleP(FlatHashTable *dataStructure, RedBlackTree key, const volatile long double* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePLongDouble(FlatHashTable *dataStructure, const volatile RedBlackTree* key, long double value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePLongDoubleP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeList(FlatHashTable *dataStructure, RedBlackTree key, List value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeListP(FlatHashTable *dataStructure, RedBlackTree key, const volatile List* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePList(FlatHashTable *dataStructure, const volatile RedBlackTree* key, List value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePListP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile List* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeQueue(FlatHashTable *dataStructure, RedBlackTree key, Queue value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeQueueP(FlatHashTable *dataStructure, RedBlackTree key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePQueue(FlatHashTable *dataStructure, const volatile RedBlackTree* key, Queue value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePQueueP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeStack(FlatHashTable *dataStructure, RedBlackTree key, Stack value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeStackP(FlatHashTable *dataStructure, RedBlackTree key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePStack(FlatHashTable *dataStructure, const volatile RedBlackTree* key, Stack value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePStackP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeRedBlackTree(FlatHashTable *dataStructure, RedBlackTree key, RedBlackTree value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeRedBlackTreeP(FlatHashTable *dataStructure, RedBlackTree key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePRedBlackTree(FlatHashTable *dataStructure, const volatile RedBlackTree* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePRedBlackTreeP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeHashTable(FlatHashTable *dataStructure, RedBlackTree key, HashTable value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeHashTableP(FlatHashTable *dataStructure, RedBlackTree key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePHashTable(FlatHashTable *dataStructure, const volatile RedBlackTree* key, HashTable value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePHashTableP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeVector(FlatHashTable *dataStructure, RedBlackTree key, Vector value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeVectorP(FlatHashTable *dataStructure, RedBlackTree key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePVector(FlatHashTable *dataStructure, const volatile RedBlackTree* key, Vector value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePVectorP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeString(FlatHashTable *dataStructure, RedBlackTree key, const volatile char* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeStringP(FlatHashTable *dataStructure, RedBlackTree key, const volatile char** value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePString(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile char* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePStringP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile char** value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeBytes(FlatHashTable *dataStructure, RedBlackTree key, Bytes value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeBytesP(FlatHashTable *dataStructure, RedBlackTree key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePBytes(FlatHashTable *dataStructure, const volatile RedBlackTree* key, Bytes value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePBytesP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePointer(FlatHashTable *dataStructure, RedBlackTree key, void* value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePointerP(FlatHashTable *dataStructure, RedBlackTree key, const volatile void** value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePPointer(FlatHashTable *dataStructure, const volatile RedBlackTree* key, void* value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePPointerP(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile void** value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeI8(FlatHashTable *dataStructure, RedBlackTree key, i8 value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePI8(FlatHashTable *dataStructure, const volatile RedBlackTree* key, i8 value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreeU8(FlatHashTable *dataStructure, RedBlackTree key, u8 value) {
+  if (dataStructure->keyType != typeRedBlackTree) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddRedBlackTreePU8(FlatHashTable *dataStructure, const volatile RedBlackTree* key, u8 value) {
+  if (dataStructure->keyType != typeRedBlackTreeNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddHashTableBool(FlatHashTable *dataStructure, HashTable key, bool value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddHashTableBoolP(FlatHashTable *dataStructure, HashTable key, const volatile bool* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePBool(FlatHashTable *dataStructure, const volatile HashTable* key, bool value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePBoolP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableI16(FlatHashTable *dataStructure, HashTable key, i16 value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddHashTableI16P(FlatHashTable *dataStructure, HashTable key, const volatile i16* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePI16(FlatHashTable *dataStructure, const volatile HashTable* key, i16 value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePI16P(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableU16(FlatHashTable *dataStructure, HashTable key, u16 value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddHashTableU16P(FlatHashTable *dataStructure, HashTable key, const volatile u16* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePU16(FlatHashTable *dataStructure, const volatile HashTable* key, u16 value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePU16P(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableI32(FlatHashTable *dataStructure, HashTable key, i32 value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddHashTableI32P(FlatHashTable *dataStructure, HashTable key, const volatile i32* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePI32(FlatHashTable *dataStructure, const volatile HashTable* key, i32 value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePI32P(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableU32(FlatHashTable *dataStructure, HashTable key, u32 value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddHashTableU32P(FlatHashTable *dataStructure, HashTable key, const volatile u32* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePU32(FlatHashTable *dataStructure, const volatile HashTable* key, u32 value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePU32P(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableI64(FlatHashTable *dataStructure, HashTable key, i64 value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddHashTableI64P(FlatHashTable *dataStructure, HashTable key, const volatile i64* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePI64(FlatHashTable *dataStructure, const volatile HashTable* key, i64 value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePI64P(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableU64(FlatHashTable *dataStructure, HashTable key, u64 value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddHashTableU64P(FlatHashTable *dataStructure, HashTable key, const volatile u64* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePU64(FlatHashTable *dataStructure, const volatile HashTable* key, u64 value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePU64P(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableFloat(FlatHashTable *dataStructure, HashTable key, float value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddHashTableFloatP(FlatHashTable *dataStructure, HashTable key, const volatile float* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePFloat(FlatHashTable *dataStructure, const volatile HashTable* key, float value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePFloatP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile float* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableDouble(FlatHashTable *dataStructure, HashTable key, double value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddHashTableDoubleP(FlatHashTable *dataStructure, HashTable key, const volatile double* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePDouble(FlatHashTable *dataStructure, const volatile HashTable* key, double value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePDoubleP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile double* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableLongDouble(FlatHashTable *dataStructure, HashTable key, long double value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddHashTableLongDoubleP(FlatHashTable *dataStructure, HashTable key, const volatile long double* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePLongDouble(FlatHashTable *dataStructure, const volatile HashTable* key, long double value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePLongDoubleP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableList(FlatHashTable *dataStructure, HashTable key, List value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddHashTableListP(FlatHashTable *dataStructure, HashTable key, const volatile List* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePList(FlatHashTable *dataStructure, const volatile HashTable* key, List value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePListP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile List* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableQueue(FlatHashTable *dataStructure, HashTable key, Queue value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddHashTableQueueP(FlatHashTable *dataStructure, HashTable key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePQueue(FlatHashTable *dataStructure, const volatile HashTable* key, Queue value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePQueueP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableStack(FlatHashTable *dataStructure, HashTable key, Stack value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddHashTableStackP(FlatHashTable *dataStructure, HashTable key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePStack(FlatHashTable *dataStructure, const volatile HashTable* key, Stack value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePStackP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableRedBlackTree(FlatHashTable *dataStructure, HashTable key, RedBlackTree value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddHashTableRedBlackTreeP(FlatHashTable *dataStructure, HashTable key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePRedBlackTree(FlatHashTable *dataStructure, const volatile HashTable* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePRedBlackTreeP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableHashTable(FlatHashTable *dataStructure, HashTable key, HashTable value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddHashTableHashTableP(FlatHashTable *dataStructure, HashTable key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePHashTable(FlatHashTable *dataStructure, const volatile HashTable* key, HashTable value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePHashTableP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableVector(FlatHashTable *dataStructure, HashTable key, Vector value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddHashTableVectorP(FlatHashTable *dataStructure, HashTable key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePVector(FlatHashTable *dataStructure, const volatile HashTable* key, Vector value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePVectorP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableString(FlatHashTable *dataStructure, HashTable key, const volatile char* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddHashTableStringP(FlatHashTable *dataStructure, HashTable key, const volatile char** value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePString(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile char* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePStringP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile char** value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableBytes(FlatHashTable *dataStructure, HashTable key, Bytes value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddHashTableBytesP(FlatHashTable *dataStructure, HashTable key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePBytes(FlatHashTable *dataStructure, const volatile HashTable* key, Bytes value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePBytesP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePointer(FlatHashTable *dataStructure, HashTable key, void* value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePointerP(FlatHashTable *dataStructure, HashTable key, const volatile void** value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePPointer(FlatHashTable *dataStructure, const volatile HashTable* key, void* value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePPointerP(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile void** value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddHashTableI8(FlatHashTable *dataStructure, HashTable key, i8 value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePI8(FlatHashTable *dataStructure, const volatile HashTable* key, i8 value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddHashTableU8(FlatHashTable *dataStructure, HashTable key, u8 value) {
+  if (dataStructure->keyType != typeHashTable) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddHashTablePU8(FlatHashTable *dataStructure, const volatile HashTable* key, u8 value) {
+  if (dataStructure->keyType != typeHashTableNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddVectorBool(FlatHashTable *dataStructure, Vector key, bool value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddVectorBoolP(FlatHashTable *dataStructure, Vector key, const volatile bool* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPBool(FlatHashTable *dataStructure, const volatile Vector* key, bool value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddVectorPBoolP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorI16(FlatHashTable *dataStructure, Vector key, i16 value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddVectorI16P(FlatHashTable *dataStructure, Vector key, const volatile i16* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPI16(FlatHashTable *dataStructure, const volatile Vector* key, i16 value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddVectorPI16P(FlatHashTable *dataStructure, const volatile Vector* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorU16(FlatHashTable *dataStructure, Vector key, u16 value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddVectorU16P(FlatHashTable *dataStructure, Vector key, const volatile u16* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPU16(FlatHashTable *dataStructure, const volatile Vector* key, u16 value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddVectorPU16P(FlatHashTable *dataStructure, const volatile Vector* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorI32(FlatHashTable *dataStructure, Vector key, i32 value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddVectorI32P(FlatHashTable *dataStructure, Vector key, const volatile i32* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPI32(FlatHashTable *dataStructure, const volatile Vector* key, i32 value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddVectorPI32P(FlatHashTable *dataStructure, const volatile Vector* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorU32(FlatHashTable *dataStructure, Vector key, u32 value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddVectorU32P(FlatHashTable *dataStructure, Vector key, const volatile u32* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPU32(FlatHashTable *dataStructure, const volatile Vector* key, u32 value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddVectorPU32P(FlatHashTable *dataStructure, const volatile Vector* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorI64(FlatHashTable *dataStructure, Vector key, i64 value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddVectorI64P(FlatHashTable *dataStructure, Vector key, const volatile i64* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPI64(FlatHashTable *dataStructure, const volatile Vector* key, i64 value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddVectorPI64P(FlatHashTable *dataStructure, const volatile Vector* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorU64(FlatHashTable *dataStructure, Vector key, u64 value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddVectorU64P(FlatHashTable *dataStructure, Vector key, const volatile u64* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPU64(FlatHashTable *dataStructure, const volatile Vector* key, u64 value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddVectorPU64P(FlatHashTable *dataStructure, const volatile Vector* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorFloat(FlatHashTable *dataStructure, Vector key, float value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddVectorFloatP(FlatHashTable *dataStructure, Vector key, const volatile float* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPFloat(FlatHashTable *dataStructure, const volatile Vector* key, float value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddVectorPFloatP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile float* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorDouble(FlatHashTable *dataStructure, Vector key, double value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddVectorDoubleP(FlatHashTable *dataStructure, Vector key, const volatile double* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPDouble(FlatHashTable *dataStructure, const volatile Vector* key, double value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddVectorPDoubleP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile double* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorLongDouble(FlatHashTable *dataStructure, Vector key, long double value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddVectorLongDoubleP(FlatHashTable *dataStructure, Vector key, const volatile long double* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPLongDouble(FlatHashTable *dataStructure, const volatile Vector* key, long double value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddVectorPLongDoubleP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorList(FlatHashTable *dataStructure, Vector key, List value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddVectorListP(FlatHashTable *dataStructure, Vector key, const volatile List* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPList(FlatHashTable *dataStructure, const volatile Vector* key, List value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddVectorPListP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile List* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorQueue(FlatHashTable *dataStructure, Vector key, Queue value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddVectorQueueP(FlatHashTable *dataStructure, Vector key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPQueue(FlatHashTable *dataStructure, const volatile Vector* key, Queue value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddVectorPQueueP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorStack(FlatHashTable *dataStructure, Vector key, Stack value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddVectorStackP(FlatHashTable *dataStructure, Vector key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPStack(FlatHashTable *dataStructure, const volatile Vector* key, Stack value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddVectorPStackP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorRedBlackTree(FlatHashTable *dataStructure, Vector key, RedBlackTree value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddVectorRedBlackTreeP(FlatHashTable *dataStructure, Vector key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPRedBlackTree(FlatHashTable *dataStructure, const volatile Vector* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddVectorPRedBlackTreeP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorHashTable(FlatHashTable *dataStructure, Vector key, HashTable value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddVectorHashTableP(FlatHashTable *dataStructure, Vector key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPHashTable(FlatHashTable *dataStructure, const volatile Vector* key, HashTable value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddVectorPHashTableP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorVector(FlatHashTable *dataStructure, Vector key, Vector value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddVectorVectorP(FlatHashTable *dataStructure, Vector key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPVector(FlatHashTable *dataStructure, const volatile Vector* key, Vector value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddVectorPVectorP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorString(FlatHashTable *dataStructure, Vector key, const volatile char* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddVectorStringP(FlatHashTable *dataStructure, Vector key, const volatile char** value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPString(FlatHashTable *dataStructure, const volatile Vector* key, const volatile char* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddVectorPStringP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile char** value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorBytes(FlatHashTable *dataStructure, Vector key, Bytes value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddVectorBytesP(FlatHashTable *dataStructure, Vector key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPBytes(FlatHashTable *dataStructure, const volatile Vector* key, Bytes value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddVectorPBytesP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPointer(FlatHashTable *dataStructure, Vector key, void* value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddVectorPointerP(FlatHashTable *dataStructure, Vector key, const volatile void** value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorPPointer(FlatHashTable *dataStructure, const volatile Vector* key, void* value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddVectorPPointerP(FlatHashTable *dataStructure, const volatile Vector* key, const volatile void** value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddVectorI8(FlatHashTable *dataStructure, Vector key, i8 value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddVectorPI8(FlatHashTable *dataStructure, const volatile Vector* key, i8 value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddVectorU8(FlatHashTable *dataStructure, Vector key, u8 value) {
+  if (dataStructure->keyType != typeVector) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddVectorPU8(FlatHashTable *dataStructure, const volatile Vector* key, u8 value) {
+  if (dataStructure->keyType != typeVectorNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+
+static inline FlatHashTableEntry* fhtAddStringBool(FlatHashTable *dataStructure, const volatile char* key, bool value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddStringBoolP(FlatHashTable *dataStructure, const volatile char* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPBool(FlatHashTable *dataStructure, const volatile char** key, bool value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddStringPBoolP(FlatHashTable *dataStructure, const volatile char** key, const volatile bool* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringI16(FlatHashTable *dataStructure, const volatile char* key, i16 value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddStringI16P(FlatHashTable *dataStructure, const volatile char* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPI16(FlatHashTable *dataStructure, const volatile char** key, i16 value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddStringPI16P(FlatHashTable *dataStructure, const volatile char** key, const volatile i16* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringU16(FlatHashTable *dataStructure, const volatile char* key, u16 value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddStringU16P(FlatHashTable *dataStructure, const volatile char* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPU16(FlatHashTable *dataStructure, const volatile char** key, u16 value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddStringPU16P(FlatHashTable *dataStructure, const volatile char** key, const volatile u16* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringI32(FlatHashTable *dataStructure, const volatile char* key, i32 value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddStringI32P(FlatHashTable *dataStructure, const volatile char* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPI32(FlatHashTable *dataStructure, const volatile char** key, i32 value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddStringPI32P(FlatHashTable *dataStructure, const volatile char** key, const volatile i32* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringU32(FlatHashTable *dataStructure, const volatile char* key, u32 value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddStringU32P(FlatHashTable *dataStructure, const volatile char* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPU32(FlatHashTable *dataStructure, const volatile char** key, u32 value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddStringPU32P(FlatHashTable *dataStructure, const volatile char** key, const volatile u32* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringI64(FlatHashTable *dataStructure, const volatile char* key, i64 value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddStringI64P(FlatHashTable *dataStructure, const volatile char* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPI64(FlatHashTable *dataStructure, const volatile char** key, i64 value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddStringPI64P(FlatHashTable *dataStructure, const volatile char** key, const volatile i64* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringU64(FlatHashTable *dataStructure, const volatile char* key, u64 value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddStringU64P(FlatHashTable *dataStructure, const volatile char* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPU64(FlatHashTable *dataStructure, const volatile char** key, u64 value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddStringPU64P(FlatHashTable *dataStructure, const volatile char** key, const volatile u64* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringFloat(FlatHashTable *dataStructure, const volatile char* key, float value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddStringFloatP(FlatHashTable *dataStructure, const volatile char* key, const volatile float* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPFloat(FlatHashTable *dataStructure, const volatile char** key, float value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddStringPFloatP(FlatHashTable *dataStructure, const volatile char** key, const volatile float* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringDouble(FlatHashTable *dataStructure, const volatile char* key, double value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddStringDoubleP(FlatHashTable *dataStructure, const volatile char* key, const volatile double* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPDouble(FlatHashTable *dataStructure, const volatile char** key, double value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddStringPDoubleP(FlatHashTable *dataStructure, const volatile char** key, const volatile double* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringLongDouble(FlatHashTable *dataStructure, const volatile char* key, long double value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddStringLongDoubleP(FlatHashTable *dataStructure, const volatile char* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPLongDouble(FlatHashTable *dataStructure, const volatile char** key, long double value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddStringPLongDoubleP(FlatHashTable *dataStructure, const volatile char** key, const volatile long double* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringList(FlatHashTable *dataStructure, const volatile char* key, List value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddStringListP(FlatHashTable *dataStructure, const volatile char* key, const volatile List* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPList(FlatHashTable *dataStructure, const volatile char** key, List value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddStringPListP(FlatHashTable *dataStructure, const volatile char** key, const volatile List* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringQueue(FlatHashTable *dataStructure, const volatile char* key, Queue value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddStringQueueP(FlatHashTable *dataStructure, const volatile char* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPQueue(FlatHashTable *dataStructure, const volatile char** key, Queue value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddStringPQueueP(FlatHashTable *dataStructure, const volatile char** key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringStack(FlatHashTable *dataStructure, const volatile char* key, Stack value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddStringStackP(FlatHashTable *dataStructure, const volatile char* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPStack(FlatHashTable *dataStructure, const volatile char** key, Stack value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddStringPStackP(FlatHashTable *dataStructure, const volatile char** key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringRedBlackTree(FlatHashTable *dataStructure, const volatile char* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddStringRedBlackTreeP(FlatHashTable *dataStructure, const volatile char* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPRedBlackTree(FlatHashTable *dataStructure, const volatile char** key, RedBlackTree value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddStringPRedBlackTreeP(FlatHashTable *dataStructure, const volatile char** key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringHashTable(FlatHashTable *dataStructure, const volatile char* key, HashTable value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddStringHashTableP(FlatHashTable *dataStructure, const volatile char* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPHashTable(FlatHashTable *dataStructure, const volatile char** key, HashTable value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddStringPHashTableP(FlatHashTable *dataStructure, const volatile char** key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringVector(FlatHashTable *dataStructure, const volatile char* key, Vector value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddStringVectorP(FlatHashTable *dataStructure, const volatile char* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPVector(FlatHashTable *dataStructure, const volatile char** key, Vector value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddStringPVectorP(FlatHashTable *dataStructure, const volatile char** key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringString(FlatHashTable *dataStructure, const volatile char* key, const volatile char* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddStringStringP(FlatHashTable *dataStructure, const volatile char* key, const volatile char** value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPString(FlatHashTable *dataStructure, const volatile char** key, const volatile char* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddStringPStringP(FlatHashTable *dataStructure, const volatile char** key, const volatile char** value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringBytes(FlatHashTable *dataStructure, const volatile char* key, Bytes value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddStringBytesP(FlatHashTable *dataStructure, const volatile char* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPBytes(FlatHashTable *dataStructure, const volatile char** key, Bytes value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddStringPBytesP(FlatHashTable *dataStructure, const volatile char** key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPointer(FlatHashTable *dataStructure, const volatile char* key, void* value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddStringPointerP(FlatHashTable *dataStructure, const volatile char* key, const volatile void** value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringPPointer(FlatHashTable *dataStructure, const volatile char** key, void* value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddStringPPointerP(FlatHashTable *dataStructure, const volatile char** key, const volatile void** value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddStringI8(FlatHashTable *dataStructure, const volatile char* key, i8 value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddStringPI8(FlatHashTable *dataStructure, const volatile char** key, i8 value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddStringU8(FlatHashTable *dataStructure, const volatile char* key, u8 value) {
+  if (dataStructure->keyType != typeString) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddStringPU8(FlatHashTable *dataStructure, const volatile char** key, u8 value) {
+  if (dataStructure->keyType != typeStringNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU8);
+}
+
+static inline FlatHashTableEntry* fhtAddBytesBool(FlatHashTable *dataStructure, Bytes key, bool value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddBytesBoolP(FlatHashTable *dataStructure, Bytes key, const volatile bool* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPBool(FlatHashTable *dataStructure, const volatile Bytes* key, bool value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddBytesPBoolP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile bool* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesI16(FlatHashTable *dataStructure, Bytes key, i16 value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddBytesI16P(FlatHashTable *dataStructure, Bytes key, const volatile i16* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPI16(FlatHashTable *dataStructure, const volatile Bytes* key, i16 value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddBytesPI16P(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile i16* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesU16(FlatHashTable *dataStructure, Bytes key, u16 value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddBytesU16P(FlatHashTable *dataStructure, Bytes key, const volatile u16* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPU16(FlatHashTable *dataStructure, const volatile Bytes* key, u16 value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddBytesPU16P(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile u16* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesI32(FlatHashTable *dataStructure, Bytes key, i32 value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddBytesI32P(FlatHashTable *dataStructure, Bytes key, const volatile i32* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPI32(FlatHashTable *dataStructure, const volatile Bytes* key, i32 value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddBytesPI32P(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile i32* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesU32(FlatHashTable *dataStructure, Bytes key, u32 value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddBytesU32P(FlatHashTable *dataStructure, Bytes key, const volatile u32* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPU32(FlatHashTable *dataStructure, const volatile Bytes* key, u32 value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddBytesPU32P(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile u32* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesI64(FlatHashTable *dataStructure, Bytes key, i64 value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddBytesI64P(FlatHashTable *dataStructure, Bytes key, const volatile i64* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPI64(FlatHashTable *dataStructure, const volatile Bytes* key, i64 value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddBytesPI64P(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile i64* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesU64(FlatHashTable *dataStructure, Bytes key, u64 value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddBytesU64P(FlatHashTable *dataStructure, Bytes key, const volatile u64* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPU64(FlatHashTable *dataStructure, const volatile Bytes* key, u64 value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddBytesPU64P(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile u64* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesFloat(FlatHashTable *dataStructure, Bytes key, float value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddBytesFloatP(FlatHashTable *dataStructure, Bytes key, const volatile float* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPFloat(FlatHashTable *dataStructure, const volatile Bytes* key, float value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddBytesPFloatP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile float* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesDouble(FlatHashTable *dataStructure, Bytes key, double value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddBytesDoubleP(FlatHashTable *dataStructure, Bytes key, const volatile double* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPDouble(FlatHashTable *dataStructure, const volatile Bytes* key, double value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddBytesPDoubleP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile double* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesLongDouble(FlatHashTable *dataStructure, Bytes key, long double value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddBytesLongDoubleP(FlatHashTable *dataStructure, Bytes key, const volatile long double* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPLongDouble(FlatHashTable *dataStructure, const volatile Bytes* key, long double value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddBytesPLongDoubleP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile long double* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesList(FlatHashTable *dataStructure, Bytes key, List value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddBytesListP(FlatHashTable *dataStructure, Bytes key, const volatile List* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPList(FlatHashTable *dataStructure, const volatile Bytes* key, List value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddBytesPListP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile List* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesQueue(FlatHashTable *dataStructure, Bytes key, Queue value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddBytesQueueP(FlatHashTable *dataStructure, Bytes key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPQueue(FlatHashTable *dataStructure, const volatile Bytes* key, Queue value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddBytesPQueueP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesStack(FlatHashTable *dataStructure, Bytes key, Stack value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddBytesStackP(FlatHashTable *dataStructure, Bytes key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPStack(FlatHashTable *dataStructure, const volatile Bytes* key, Stack value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddBytesPStackP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesRedBlackTree(FlatHashTable *dataStructure, Bytes key, RedBlackTree value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddBytesRedBlackTreeP(FlatHashTable *dataStructure, Bytes key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPRedBlackTree(FlatHashTable *dataStructure, const volatile Bytes* key, RedBlackTree value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddBytesPRedBlackTreeP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesHashTable(FlatHashTable *dataStructure, Bytes key, HashTable value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddBytesHashTableP(FlatHashTable *dataStructure, Bytes key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPHashTable(FlatHashTable *dataStructure, const volatile Bytes* key, HashTable value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddBytesPHashTableP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesVector(FlatHashTable *dataStructure, Bytes key, Vector value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddBytesVectorP(FlatHashTable *dataStructure, Bytes key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPVector(FlatHashTable *dataStructure, const volatile Bytes* key, Vector value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddBytesPVectorP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesString(FlatHashTable *dataStructure, Bytes key, const volatile char* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddBytesStringP(FlatHashTable *dataStructure, Bytes key, const volatile char** value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPString(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile char* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddBytesPStringP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile char** value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesBytes(FlatHashTable *dataStructure, Bytes key, Bytes value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddBytesBytesP(FlatHashTable *dataStructure, Bytes key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPBytes(FlatHashTable *dataStructure, const volatile Bytes* key, Bytes value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddBytesPBytesP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPointer(FlatHashTable *dataStructure, Bytes key, void* value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddBytesPointerP(FlatHashTable *dataStructure, Bytes key, const volatile void** value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesPPointer(FlatHashTable *dataStructure, const volatile Bytes* key, void* value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddBytesPPointerP(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile void** value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddBytesI8(FlatHashTable *dataStructure, Bytes key, i8 value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddBytesPI8(FlatHashTable *dataStructure, const volatile Bytes* key, i8 value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddBytesU8(FlatHashTable *dataStructure, Bytes key, u8 value) {
+  if (dataStructure->keyType != typeBytes) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddBytesPU8(FlatHashTable *dataStructure, const volatile Bytes* key, u8 value) {
+  if (dataStructure->keyType != typeBytesNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU8);
+}
+
+static inline FlatHashTableEntry* fhtAddPointerBool(FlatHashTable *dataStructure, void* key, bool value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddPointerBoolP(FlatHashTable *dataStructure, void* key, const volatile bool* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPBool(FlatHashTable *dataStructure, const volatile void** key, bool value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddPointerPBoolP(FlatHashTable *dataStructure, const volatile void** key, const volatile bool* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerI16(FlatHashTable *dataStructure, void* key, i16 value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddPointerI16P(FlatHashTable *dataStructure, void* key, const volatile i16* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPI16(FlatHashTable *dataStructure, const volatile void** key, i16 value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddPointerPI16P(FlatHashTable *dataStructure, const volatile void** key, const volatile i16* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerU16(FlatHashTable *dataStructure, void* key, u16 value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddPointerU16P(FlatHashTable *dataStructure, void* key, const volatile u16* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPU16(FlatHashTable *dataStructure, const volatile void** key, u16 value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddPointerPU16P(FlatHashTable *dataStructure, const volatile void** key, const volatile u16* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerI32(FlatHashTable *dataStructure, void* key, i32 value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddPointerI32P(FlatHashTable *dataStructure, void* key, const volatile i32* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPI32(FlatHashTable *dataStructure, const volatile void** key, i32 value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddPointerPI32P(FlatHashTable *dataStructure, const volatile void** key, const volatile i32* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerU32(FlatHashTable *dataStructure, void* key, u32 value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddPointerU32P(FlatHashTable *dataStructure, void* key, const volatile u32* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPU32(FlatHashTable *dataStructure, const volatile void** key, u32 value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddPointerPU32P(FlatHashTable *dataStructure, const volatile void** key, const volatile u32* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerI64(FlatHashTable *dataStructure, void* key, i64 value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddPointerI64P(FlatHashTable *dataStructure, void* key, const volatile i64* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPI64(FlatHashTable *dataStructure, const volatile void** key, i64 value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddPointerPI64P(FlatHashTable *dataStructure, const volatile void** key, const volatile i64* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerU64(FlatHashTable *dataStructure, void* key, u64 value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddPointerU64P(FlatHashTable *dataStructure, void* key, const volatile u64* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPU64(FlatHashTable *dataStructure, const volatile void** key, u64 value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddPointerPU64P(FlatHashTable *dataStructure, const volatile void** key, const volatile u64* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerFloat(FlatHashTable *dataStructure, void* key, float value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddPointerFloatP(FlatHashTable *dataStructure, void* key, const volatile float* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPFloat(FlatHashTable *dataStructure, const volatile void** key, float value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddPointerPFloatP(FlatHashTable *dataStructure, const volatile void** key, const volatile float* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerDouble(FlatHashTable *dataStructure, void* key, double value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddPointerDoubleP(FlatHashTable *dataStructure, void* key, const volatile double* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPDouble(FlatHashTable *dataStructure, const volatile void** key, double value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddPointerPDoubleP(FlatHashTable *dataStructure, const volatile void** key, const volatile double* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerLongDouble(FlatHashTable *dataStructure, void* key, long double value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddPointerLongDoubleP(FlatHashTable *dataStructure, void* key, const volatile long double* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPLongDouble(FlatHashTable *dataStructure, const volatile void** key, long double value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddPointerPLongDoubleP(FlatHashTable *dataStructure, const volatile void** key, const volatile long double* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerList(FlatHashTable *dataStructure, void* key, List value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddPointerListP(FlatHashTable *dataStructure, void* key, const volatile List* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPList(FlatHashTable *dataStructure, const volatile void** key, List value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddPointerPListP(FlatHashTable *dataStructure, const volatile void** key, const volatile List* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerQueue(FlatHashTable *dataStructure, void* key, Queue value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddPointerQueueP(FlatHashTable *dataStructure, void* key, const volatile Queue* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPQueue(FlatHashTable *dataStructure, const volatile void** key, Queue value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddPointerPQueueP(FlatHashTable *dataStructure, const volatile void** key, const volatile Queue* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerStack(FlatHashTable *dataStructure, void* key, Stack value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddPointerStackP(FlatHashTable *dataStructure, void* key, const volatile Stack* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPStack(FlatHashTable *dataStructure, const volatile void** key, Stack value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddPointerPStackP(FlatHashTable *dataStructure, const volatile void** key, const volatile Stack* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerRedBlackTree(FlatHashTable *dataStructure, void* key, RedBlackTree value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddPointerRedBlackTreeP(FlatHashTable *dataStructure, void* key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPRedBlackTree(FlatHashTable *dataStructure, const volatile void** key, RedBlackTree value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddPointerPRedBlackTreeP(FlatHashTable *dataStructure, const volatile void** key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerHashTable(FlatHashTable *dataStructure, void* key, HashTable value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddPointerHashTableP(FlatHashTable *dataStructure, void* key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPHashTable(FlatHashTable *dataStructure, const volatile void** key, HashTable value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddPointerPHashTableP(FlatHashTable *dataStructure, const volatile void** key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerVector(FlatHashTable *dataStructure, void* key, Vector value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddPointerVectorP(FlatHashTable *dataStructure, void* key, const volatile Vector* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPVector(FlatHashTable *dataStructure, const volatile void** key, Vector value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddPointerPVectorP(FlatHashTable *dataStructure, const volatile void** key, const volatile Vector* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerString(FlatHashTable *dataStructure, void* key, const volatile char* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddPointerStringP(FlatHashTable *dataStructure, void* key, const volatile char** value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPString(FlatHashTable *dataStructure, const volatile void** key, const volatile char* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddPointerPStringP(FlatHashTable *dataStructure, const volatile void** key, const volatile char** value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerBytes(FlatHashTable *dataStructure, void* key, Bytes value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddPointerBytesP(FlatHashTable *dataStructure, void* key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPBytes(FlatHashTable *dataStructure, const volatile void** key, Bytes value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddPointerPBytesP(FlatHashTable *dataStructure, const volatile void** key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPointer(FlatHashTable *dataStructure, void* key, void* value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddPointerPointerP(FlatHashTable *dataStructure, void* key, const volatile void** value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerPPointer(FlatHashTable *dataStructure, const volatile void** key, void* value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddPointerPPointerP(FlatHashTable *dataStructure, const volatile void** key, const volatile void** value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddPointerI8(FlatHashTable *dataStructure, void* key, i8 value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddPointerPI8(FlatHashTable *dataStructure, const volatile void** key, i8 value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddPointerU8(FlatHashTable *dataStructure, void* key, u8 value) {
+  if (dataStructure->keyType != typePointer) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, key, &value, typeU8);
+}
+static inline FlatHashTableEntry* fhtAddPointerPU8(FlatHashTable *dataStructure, const volatile void** key, u8 value) {
+  if (dataStructure->keyType != typePointerNoCopy) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, *key, &value, typeU8);
+}
+
+static inline FlatHashTableEntry* fhtAddI8Bool(FlatHashTable *dataStructure, i8 key, bool value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddI8BoolP(FlatHashTable *dataStructure, i8 key, const volatile bool* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8I16(FlatHashTable *dataStructure, i8 key, i16 value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddI8I16P(FlatHashTable *dataStructure, i8 key, const volatile i16* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8U16(FlatHashTable *dataStructure, i8 key, u16 value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddI8U16P(FlatHashTable *dataStructure, i8 key, const volatile u16* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8I32(FlatHashTable *dataStructure, i8 key, i32 value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddI8I32P(FlatHashTable *dataStructure, i8 key, const volatile i32* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8U32(FlatHashTable *dataStructure, i8 key, u32 value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddI8U32P(FlatHashTable *dataStructure, i8 key, const volatile u32* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8I64(FlatHashTable *dataStructure, i8 key, i64 value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddI8I64P(FlatHashTable *dataStructure, i8 key, const volatile i64* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8U64(FlatHashTable *dataStructure, i8 key, u64 value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddI8U64P(FlatHashTable *dataStructure, i8 key, const volatile u64* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8Float(FlatHashTable *dataStructure, i8 key, float value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddI8FloatP(FlatHashTable *dataStructure, i8 key, const volatile float* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8Double(FlatHashTable *dataStructure, i8 key, double value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddI8DoubleP(FlatHashTable *dataStructure, i8 key, const volatile double* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8LongDouble(FlatHashTable *dataStructure, i8 key, long double value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddI8LongDoubleP(FlatHashTable *dataStructure, i8 key, const volatile long double* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8List(FlatHashTable *dataStructure, i8 key, List value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddI8ListP(FlatHashTable *dataStructure, i8 key, const volatile List* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8Queue(FlatHashTable *dataStructure, i8 key, Queue value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddI8QueueP(FlatHashTable *dataStructure, i8 key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8Stack(FlatHashTable *dataStructure, i8 key, Stack value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddI8StackP(FlatHashTable *dataStructure, i8 key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8RedBlackTree(FlatHashTable *dataStructure, i8 key, RedBlackTree value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddI8RedBlackTreeP(FlatHashTable *dataStructure, i8 key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8HashTable(FlatHashTable *dataStructure, i8 key, HashTable value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddI8HashTableP(FlatHashTable *dataStructure, i8 key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8Vector(FlatHashTable *dataStructure, i8 key, Vector value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddI8VectorP(FlatHashTable *dataStructure, i8 key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8String(FlatHashTable *dataStructure, i8 key, const volatile char* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddI8StringP(FlatHashTable *dataStructure, i8 key, const volatile char** value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8Bytes(FlatHashTable *dataStructure, i8 key, Bytes value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddI8BytesP(FlatHashTable *dataStructure, i8 key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8Pointer(FlatHashTable *dataStructure, i8 key, void* value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddI8PointerP(FlatHashTable *dataStructure, i8 key, const volatile void** value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddI8I8(FlatHashTable *dataStructure, i8 key, i8 value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddI8U8(FlatHashTable *dataStructure, i8 key, u8 value) {
+  if (dataStructure->keyType != typeI8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+
+static inline FlatHashTableEntry* fhtAddU8Bool(FlatHashTable *dataStructure, u8 key, bool value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeBool);
+}
+static inline FlatHashTableEntry* fhtAddU8BoolP(FlatHashTable *dataStructure, u8 key, const volatile bool* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBoolNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8I16(FlatHashTable *dataStructure, u8 key, i16 value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI16);
+}
+static inline FlatHashTableEntry* fhtAddU8I16P(FlatHashTable *dataStructure, u8 key, const volatile i16* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8U16(FlatHashTable *dataStructure, u8 key, u16 value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU16);
+}
+static inline FlatHashTableEntry* fhtAddU8U16P(FlatHashTable *dataStructure, u8 key, const volatile u16* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU16NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8I32(FlatHashTable *dataStructure, u8 key, i32 value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI32);
+}
+static inline FlatHashTableEntry* fhtAddU8I32P(FlatHashTable *dataStructure, u8 key, const volatile i32* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8U32(FlatHashTable *dataStructure, u8 key, u32 value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU32);
+}
+static inline FlatHashTableEntry* fhtAddU8U32P(FlatHashTable *dataStructure, u8 key, const volatile u32* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU32NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8I64(FlatHashTable *dataStructure, u8 key, i64 value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI64);
+}
+static inline FlatHashTableEntry* fhtAddU8I64P(FlatHashTable *dataStructure, u8 key, const volatile i64* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeI64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8U64(FlatHashTable *dataStructure, u8 key, u64 value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU64);
+}
+static inline FlatHashTableEntry* fhtAddU8U64P(FlatHashTable *dataStructure, u8 key, const volatile u64* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeU64NoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8Float(FlatHashTable *dataStructure, u8 key, float value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeFloat);
+}
+static inline FlatHashTableEntry* fhtAddU8FloatP(FlatHashTable *dataStructure, u8 key, const volatile float* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeFloatNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8Double(FlatHashTable *dataStructure, u8 key, double value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeDouble);
+}
+static inline FlatHashTableEntry* fhtAddU8DoubleP(FlatHashTable *dataStructure, u8 key, const volatile double* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8LongDouble(FlatHashTable *dataStructure, u8 key, long double value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeLongDouble);
+}
+static inline FlatHashTableEntry* fhtAddU8LongDoubleP(FlatHashTable *dataStructure, u8 key, const volatile long double* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeLongDoubleNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8List(FlatHashTable *dataStructure, u8 key, List value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeList);
+}
+static inline FlatHashTableEntry* fhtAddU8ListP(FlatHashTable *dataStructure, u8 key, const volatile List* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeListNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8Queue(FlatHashTable *dataStructure, u8 key, Queue value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeQueue);
+}
+static inline FlatHashTableEntry* fhtAddU8QueueP(FlatHashTable *dataStructure, u8 key, const volatile Queue* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeQueueNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8Stack(FlatHashTable *dataStructure, u8 key, Stack value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeStack);
+}
+static inline FlatHashTableEntry* fhtAddU8StackP(FlatHashTable *dataStructure, u8 key, const volatile Stack* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeStackNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8RedBlackTree(FlatHashTable *dataStructure, u8 key, RedBlackTree value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeRedBlackTree);
+}
+static inline FlatHashTableEntry* fhtAddU8RedBlackTreeP(FlatHashTable *dataStructure, u8 key, const volatile RedBlackTree* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeRedBlackTreeNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8HashTable(FlatHashTable *dataStructure, u8 key, HashTable value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeHashTable);
+}
+static inline FlatHashTableEntry* fhtAddU8HashTableP(FlatHashTable *dataStructure, u8 key, const volatile HashTable* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeHashTableNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8Vector(FlatHashTable *dataStructure, u8 key, Vector value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeVector);
+}
+static inline FlatHashTableEntry* fhtAddU8VectorP(FlatHashTable *dataStructure, u8 key, const volatile Vector* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeVectorNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8String(FlatHashTable *dataStructure, u8 key, const volatile char* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeString);
+}
+static inline FlatHashTableEntry* fhtAddU8StringP(FlatHashTable *dataStructure, u8 key, const volatile char** value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeStringNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8Bytes(FlatHashTable *dataStructure, u8 key, Bytes value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typeBytes);
+}
+static inline FlatHashTableEntry* fhtAddU8BytesP(FlatHashTable *dataStructure, u8 key, const volatile Bytes* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typeBytesNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8Pointer(FlatHashTable *dataStructure, u8 key, void* value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, value, typePointer);
+}
+static inline FlatHashTableEntry* fhtAddU8PointerP(FlatHashTable *dataStructure, u8 key, const volatile void** value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, *value, typePointerNoCopy);
+}
+static inline FlatHashTableEntry* fhtAddU8I8(FlatHashTable *dataStructure, u8 key, i8 value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeI8);
+}
+static inline FlatHashTableEntry* fhtAddU8U8(FlatHashTable *dataStructure, u8 key, u8 value) {
+  if (dataStructure->keyType != typeU8) {
+    // Key types do not match.  Error.
+    return NULL;
+  }
+  return fhtAddEntry(dataStructure, &key, &value, typeU8);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#if defined __STDC_VERSION__
+
+#if __STDC_VERSION__ >= 201710L
+#define TYPE_SAFE_FLAT_HASH_TABLE
+
+#define FHT_ADD_GENERIC_CASES_BOOL_KEY(dataStructure, key, value) \
+  bool:                  fhtAddBoolBool,                              \
+  bool*:                 fhtAddBoolBoolP,                             \
+  const volatile bool*:  fhtAddBoolBoolP,                             \
+  i16:                   fhtAddBoolI16,                               \
+  i16*:                  fhtAddBoolI16P,                              \
+  const volatile i16*:   fhtAddBoolI16P,                              \
+  u16:                   fhtAddBoolU16,                               \
+  u16*:                  fhtAddBoolU16P,                              \
+  const volatile u16*:   fhtAddBoolU16P,                              \
+  i32:                   fhtAddBoolI32,                               \
+  i32*:                  fhtAddBoolI32P,                              \
+  const volatile i32*:   fhtAddBoolI32P,                              \
+  u32:                   fhtAddBoolU32,                               \
+  u32*:                  fhtAddBoolU32P,                              \
+  const volatile u32*:   fhtAddBoolU32P,                              \
+  i64:                   fhtAddBoolI64,                               \
+  i64*:                  fhtAddBoolI64P,                              \
+  const volatile i64*:   fhtAddBoolI64P,                              \
+  u64:                   fhtAddBoolU64,                               \
+  u64*:                  fhtAddBoolU64P,                              \
+  const volatile u64*:   fhtAddBoolU64P,                              \
+  float:                 fhtAddBoolFloat,                             \
+  float*:                fhtAddBoolFloatP,                            \
+  const volatile float*: fhtAddBoolFloatP,                            \
+  double:                fhtAddBoolDouble,                            \
+  double*:               fhtAddBoolDoubleP,                           \
+  const volatile double*: fhtAddBoolDoubleP,                           \
+  long double:           fhtAddBoolLongDouble,                        \
+  long double*:          fhtAddBoolLongDoubleP,                       \
+  const volatile long double*: fhtAddBoolLongDoubleP,                       \
+  List:                  fhtAddBoolList,                              \
+  List*:                 fhtAddBoolListP,                             \
+  const volatile List*:  fhtAddBoolListP,                             \
+  Queue:                 fhtAddBoolQueue,                             \
+  Queue*:                fhtAddBoolQueueP,                            \
+  const volatile Queue*: fhtAddBoolQueueP,                            \
+  Stack:                 fhtAddBoolStack,                             \
+  Stack*:                fhtAddBoolStackP,                            \
+  const volatile Stack*: fhtAddBoolStackP,                            \
+  RedBlackTree:          fhtAddBoolRedBlackTree,                      \
+  RedBlackTree*:         fhtAddBoolRedBlackTreeP,                     \
+  const volatile RedBlackTree*: fhtAddBoolRedBlackTreeP,                     \
+  HashTable:             fhtAddBoolHashTable,                         \
+  HashTable*:            fhtAddBoolHashTableP,                        \
+  const volatile HashTable*: fhtAddBoolHashTableP,                        \
+  Vector:                fhtAddBoolVector,                            \
+  Vector*:               fhtAddBoolVectorP,                           \
+  const volatile Vector*: fhtAddBoolVectorP,                           \
+  char*:                 fhtAddBoolString,                            \
+  const volatile char*:  fhtAddBoolString,                            \
+  char**:                fhtAddBoolStringP,                           \
+  const volatile char**: fhtAddBoolStringP,                           \
+  Bytes:                 fhtAddBoolBytes,                             \
+  Bytes*:                fhtAddBoolBytesP,                            \
+  const volatile Bytes*: fhtAddBoolBytesP,                            \
+  void*:                 fhtAddBoolPointer,                           \
+  void**:                fhtAddBoolPointerP,                          \
+  const volatile void**: fhtAddBoolPointerP,                          \
+  i8:                    fhtAddBoolI8,                                \
+  u8:                    fhtAddBoolU8                                 \
+
+#define fhtAddBool(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_BOOL_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_I16_KEY(dataStructure, key, value) \
+  bool:                  fhtAddI16Bool,                               \
+  bool*:                 fhtAddI16BoolP,                              \
+  const volatile bool*:  fhtAddI16BoolP,                              \
+  i16:                   fhtAddI16I16,                                \
+  i16*:                  fhtAddI16I16P,                               \
+  const volatile i16*:   fhtAddI16I16P,                               \
+  u16:                   fhtAddI16U16,                                \
+  u16*:                  fhtAddI16U16P,                               \
+  const volatile u16*:   fhtAddI16U16P,                               \
+  i32:                   fhtAddI16I32,                                \
+  i32*:                  fhtAddI16I32P,                               \
+  const volatile i32*:   fhtAddI16I32P,                               \
+  u32:                   fhtAddI16U32,                                \
+  u32*:                  fhtAddI16U32P,                               \
+  const volatile u32*:   fhtAddI16U32P,                               \
+  i64:                   fhtAddI16I64,                                \
+  i64*:                  fhtAddI16I64P,                               \
+  const volatile i64*:   fhtAddI16I64P,                               \
+  u64:                   fhtAddI16U64,                                \
+  u64*:                  fhtAddI16U64P,                               \
+  const volatile u64*:   fhtAddI16U64P,                               \
+  float:                 fhtAddI16Float,                              \
+  float*:                fhtAddI16FloatP,                             \
+  const volatile float*: fhtAddI16FloatP,                             \
+  double:                fhtAddI16Double,                             \
+  double*:               fhtAddI16DoubleP,                            \
+  const volatile double*: fhtAddI16DoubleP,                            \
+  long double:           fhtAddI16LongDouble,                         \
+  long double*:          fhtAddI16LongDoubleP,                        \
+  const volatile long double*: fhtAddI16LongDoubleP,                        \
+  List:                  fhtAddI16List,                               \
+  List*:                 fhtAddI16ListP,                              \
+  const volatile List*:  fhtAddI16ListP,                              \
+  Queue:                 fhtAddI16Queue,                              \
+  Queue*:                fhtAddI16QueueP,                             \
+  const volatile Queue*: fhtAddI16QueueP,                             \
+  Stack:                 fhtAddI16Stack,                              \
+  Stack*:                fhtAddI16StackP,                             \
+  const volatile Stack*: fhtAddI16StackP,                             \
+  RedBlackTree:          fhtAddI16RedBlackTree,                       \
+  RedBlackTree*:         fhtAddI16RedBlackTreeP,                      \
+  const volatile RedBlackTree*: fhtAddI16RedBlackTreeP,                      \
+  HashTable:             fhtAddI16HashTable,                          \
+  HashTable*:            fhtAddI16HashTableP,                         \
+  const volatile HashTable*: fhtAddI16HashTableP,                         \
+  Vector:                fhtAddI16Vector,                             \
+  Vector*:               fhtAddI16VectorP,                            \
+  const volatile Vector*: fhtAddI16VectorP,                            \
+  char*:                 fhtAddI16String,                             \
+  const volatile char*:  fhtAddI16String,                             \
+  char**:                fhtAddI16StringP,                            \
+  const volatile char**: fhtAddI16StringP,                            \
+  Bytes:                 fhtAddI16Bytes,                              \
+  Bytes*:                fhtAddI16BytesP,                             \
+  const volatile Bytes*: fhtAddI16BytesP,                             \
+  void*:                 fhtAddI16Pointer,                            \
+  void**:                fhtAddI16PointerP,                           \
+  const volatile void**: fhtAddI16PointerP,                           \
+  i8:                    fhtAddI16I8,                                 \
+  u8:                    fhtAddI16U8                                  \
+
+#define fhtAddI16(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_I16_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_U16_KEY(dataStructure, key, value) \
+  bool:                  fhtAddU16Bool,                               \
+  bool*:                 fhtAddU16BoolP,                              \
+  const volatile bool*:  fhtAddU16BoolP,                              \
+  i16:                   fhtAddU16I16,                                \
+  i16*:                  fhtAddU16I16P,                               \
+  const volatile i16*:   fhtAddU16I16P,                               \
+  u16:                   fhtAddU16U16,                                \
+  u16*:                  fhtAddU16U16P,                               \
+  const volatile u16*:   fhtAddU16U16P,                               \
+  i32:                   fhtAddU16I32,                                \
+  i32*:                  fhtAddU16I32P,                               \
+  const volatile i32*:   fhtAddU16I32P,                               \
+  u32:                   fhtAddU16U32,                                \
+  u32*:                  fhtAddU16U32P,                               \
+  const volatile u32*:   fhtAddU16U32P,                               \
+  i64:                   fhtAddU16I64,                                \
+  i64*:                  fhtAddU16I64P,                               \
+  const volatile i64*:   fhtAddU16I64P,                               \
+  u64:                   fhtAddU16U64,                                \
+  u64*:                  fhtAddU16U64P,                               \
+  const volatile u64*:   fhtAddU16U64P,                               \
+  float:                 fhtAddU16Float,                              \
+  float*:                fhtAddU16FloatP,                             \
+  const volatile float*: fhtAddU16FloatP,                             \
+  double:                fhtAddU16Double,                             \
+  double*:               fhtAddU16DoubleP,                            \
+  const volatile double*: fhtAddU16DoubleP,                            \
+  long double:           fhtAddU16LongDouble,                         \
+  long double*:          fhtAddU16LongDoubleP,                        \
+  const volatile long double*: fhtAddU16LongDoubleP,                        \
+  List:                  fhtAddU16List,                               \
+  List*:                 fhtAddU16ListP,                              \
+  const volatile List*:  fhtAddU16ListP,                              \
+  Queue:                 fhtAddU16Queue,                              \
+  Queue*:                fhtAddU16QueueP,                             \
+  const volatile Queue*: fhtAddU16QueueP,                             \
+  Stack:                 fhtAddU16Stack,                              \
+  Stack*:                fhtAddU16StackP,                             \
+  const volatile Stack*: fhtAddU16StackP,                             \
+  RedBlackTree:          fhtAddU16RedBlackTree,                       \
+  RedBlackTree*:         fhtAddU16RedBlackTreeP,                      \
+  const volatile RedBlackTree*: fhtAddU16RedBlackTreeP,                      \
+  HashTable:             fhtAddU16HashTable,                          \
+  HashTable*:            fhtAddU16HashTableP,                         \
+  const volatile HashTable*: fhtAddU16HashTableP,                         \
+  Vector:                fhtAddU16Vector,                             \
+  Vector*:               fhtAddU16VectorP,                            \
+  const volatile Vector*: fhtAddU16VectorP,                            \
+  char*:                 fhtAddU16String,                             \
+  const volatile char*:  fhtAddU16String,                             \
+  char**:                fhtAddU16StringP,                            \
+  const volatile char**: fhtAddU16StringP,                            \
+  Bytes:                 fhtAddU16Bytes,                              \
+  Bytes*:                fhtAddU16BytesP,                             \
+  const volatile Bytes*: fhtAddU16BytesP,                             \
+  void*:                 fhtAddU16Pointer,                            \
+  void**:                fhtAddU16PointerP,                           \
+  const volatile void**: fhtAddU16PointerP,                           \
+  i8:                    fhtAddU16I8,                                 \
+  u8:                    fhtAddU16U8                                  \
+
+#define fhtAddU16(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_U16_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_I32_KEY(dataStructure, key, value) \
+  bool:                  fhtAddI32Bool,                               \
+  bool*:                 fhtAddI32BoolP,                              \
+  const volatile bool*:  fhtAddI32BoolP,                              \
+  i16:                   fhtAddI32I16,                                \
+  i16*:                  fhtAddI32I16P,                               \
+  const volatile i16*:   fhtAddI32I16P,                               \
+  u16:                   fhtAddI32U16,                                \
+  u16*:                  fhtAddI32U16P,                               \
+  const volatile u16*:   fhtAddI32U16P,                               \
+  i32:                   fhtAddI32I32,                                \
+  i32*:                  fhtAddI32I32P,                               \
+  const volatile i32*:   fhtAddI32I32P,                               \
+  u32:                   fhtAddI32U32,                                \
+  u32*:                  fhtAddI32U32P,                               \
+  const volatile u32*:   fhtAddI32U32P,                               \
+  i64:                   fhtAddI32I64,                                \
+  i64*:                  fhtAddI32I64P,                               \
+  const volatile i64*:   fhtAddI32I64P,                               \
+  u64:                   fhtAddI32U64,                                \
+  u64*:                  fhtAddI32U64P,                               \
+  const volatile u64*:   fhtAddI32U64P,                               \
+  float:                 fhtAddI32Float,                              \
+  float*:                fhtAddI32FloatP,                             \
+  const volatile float*: fhtAddI32FloatP,                             \
+  double:                fhtAddI32Double,                             \
+  double*:               fhtAddI32DoubleP,                            \
+  const volatile double*: fhtAddI32DoubleP,                            \
+  long double:           fhtAddI32LongDouble,                         \
+  long double*:          fhtAddI32LongDoubleP,                        \
+  const volatile long double*: fhtAddI32LongDoubleP,                        \
+  List:                  fhtAddI32List,                               \
+  List*:                 fhtAddI32ListP,                              \
+  const volatile List*:  fhtAddI32ListP,                              \
+  Queue:                 fhtAddI32Queue,                              \
+  Queue*:                fhtAddI32QueueP,                             \
+  const volatile Queue*: fhtAddI32QueueP,                             \
+  Stack:                 fhtAddI32Stack,                              \
+  Stack*:                fhtAddI32StackP,                             \
+  const volatile Stack*: fhtAddI32StackP,                             \
+  RedBlackTree:          fhtAddI32RedBlackTree,                       \
+  RedBlackTree*:         fhtAddI32RedBlackTreeP,                      \
+  const volatile RedBlackTree*: fhtAddI32RedBlackTreeP,                      \
+  HashTable:             fhtAddI32HashTable,                          \
+  HashTable*:            fhtAddI32HashTableP,                         \
+  const volatile HashTable*: fhtAddI32HashTableP,                         \
+  Vector:                fhtAddI32Vector,                             \
+  Vector*:               fhtAddI32VectorP,                            \
+  const volatile Vector*: fhtAddI32VectorP,                            \
+  char*:                 fhtAddI32String,                             \
+  const volatile char*:  fhtAddI32String,                             \
+  char**:                fhtAddI32StringP,                            \
+  const volatile char**: fhtAddI32StringP,                            \
+  Bytes:                 fhtAddI32Bytes,                              \
+  Bytes*:                fhtAddI32BytesP,                             \
+  const volatile Bytes*: fhtAddI32BytesP,                             \
+  void*:                 fhtAddI32Pointer,                            \
+  void**:                fhtAddI32PointerP,                           \
+  const volatile void**: fhtAddI32PointerP,                           \
+  i8:                    fhtAddI32I8,                                 \
+  u8:                    fhtAddI32U8                                  \
+
+#define fhtAddI32(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_I32_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_U32_KEY(dataStructure, key, value) \
+  bool:                  fhtAddU32Bool,                               \
+  bool*:                 fhtAddU32BoolP,                              \
+  const volatile bool*:  fhtAddU32BoolP,                              \
+  i16:                   fhtAddU32I16,                                \
+  i16*:                  fhtAddU32I16P,                               \
+  const volatile i16*:   fhtAddU32I16P,                               \
+  u16:                   fhtAddU32U16,                                \
+  u16*:                  fhtAddU32U16P,                               \
+  const volatile u16*:   fhtAddU32U16P,                               \
+  i32:                   fhtAddU32I32,                                \
+  i32*:                  fhtAddU32I32P,                               \
+  const volatile i32*:   fhtAddU32I32P,                               \
+  u32:                   fhtAddU32U32,                                \
+  u32*:                  fhtAddU32U32P,                               \
+  const volatile u32*:   fhtAddU32U32P,                               \
+  i64:                   fhtAddU32I64,                                \
+  i64*:                  fhtAddU32I64P,                               \
+  const volatile i64*:   fhtAddU32I64P,                               \
+  u64:                   fhtAddU32U64,                                \
+  u64*:                  fhtAddU32U64P,                               \
+  const volatile u64*:   fhtAddU32U64P,                               \
+  float:                 fhtAddU32Float,                              \
+  float*:                fhtAddU32FloatP,                             \
+  const volatile float*: fhtAddU32FloatP,                             \
+  double:                fhtAddU32Double,                             \
+  double*:               fhtAddU32DoubleP,                            \
+  const volatile double*: fhtAddU32DoubleP,                            \
+  long double:           fhtAddU32LongDouble,                         \
+  long double*:          fhtAddU32LongDoubleP,                        \
+  const volatile long double*: fhtAddU32LongDoubleP,                        \
+  List:                  fhtAddU32List,                               \
+  List*:                 fhtAddU32ListP,                              \
+  const volatile List*:  fhtAddU32ListP,                              \
+  Queue:                 fhtAddU32Queue,                              \
+  Queue*:                fhtAddU32QueueP,                             \
+  const volatile Queue*: fhtAddU32QueueP,                             \
+  Stack:                 fhtAddU32Stack,                              \
+  Stack*:                fhtAddU32StackP,                             \
+  const volatile Stack*: fhtAddU32StackP,                             \
+  RedBlackTree:          fhtAddU32RedBlackTree,                       \
+  RedBlackTree*:         fhtAddU32RedBlackTreeP,                      \
+  const volatile RedBlackTree*: fhtAddU32RedBlackTreeP,                      \
+  HashTable:             fhtAddU32HashTable,                          \
+  HashTable*:            fhtAddU32HashTableP,                         \
+  const volatile HashTable*: fhtAddU32HashTableP,                         \
+  Vector:                fhtAddU32Vector,                             \
+  Vector*:               fhtAddU32VectorP,                            \
+  const volatile Vector*: fhtAddU32VectorP,                            \
+  char*:                 fhtAddU32String,                             \
+  const volatile char*:  fhtAddU32String,                             \
+  char**:                fhtAddU32StringP,                            \
+  const volatile char**: fhtAddU32StringP,                            \
+  Bytes:                 fhtAddU32Bytes,                              \
+  Bytes*:                fhtAddU32BytesP,                             \
+  const volatile Bytes*: fhtAddU32BytesP,                             \
+  void*:                 fhtAddU32Pointer,                            \
+  void**:                fhtAddU32PointerP,                           \
+  const volatile void**: fhtAddU32PointerP,                           \
+  i8:                    fhtAddU32I8,                                 \
+  u8:                    fhtAddU32U8                                  \
+
+#define fhtAddU32(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_U32_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_I64_KEY(dataStructure, key, value) \
+  bool:                  fhtAddI64Bool,                               \
+  bool*:                 fhtAddI64BoolP,                              \
+  const volatile bool*:  fhtAddI64BoolP,                              \
+  i16:                   fhtAddI64I16,                                \
+  i16*:                  fhtAddI64I16P,                               \
+  const volatile i16*:   fhtAddI64I16P,                               \
+  u16:                   fhtAddI64U16,                                \
+  u16*:                  fhtAddI64U16P,                               \
+  const volatile u16*:   fhtAddI64U16P,                               \
+  i32:                   fhtAddI64I32,                                \
+  i32*:                  fhtAddI64I32P,                               \
+  const volatile i32*:   fhtAddI64I32P,                               \
+  u32:                   fhtAddI64U32,                                \
+  u32*:                  fhtAddI64U32P,                               \
+  const volatile u32*:   fhtAddI64U32P,                               \
+  i64:                   fhtAddI64I64,                                \
+  i64*:                  fhtAddI64I64P,                               \
+  const volatile i64*:   fhtAddI64I64P,                               \
+  u64:                   fhtAddI64U64,                                \
+  u64*:                  fhtAddI64U64P,                               \
+  const volatile u64*:   fhtAddI64U64P,                               \
+  float:                 fhtAddI64Float,                              \
+  float*:                fhtAddI64FloatP,                             \
+  const volatile float*: fhtAddI64FloatP,                             \
+  double:                fhtAddI64Double,                             \
+  double*:               fhtAddI64DoubleP,                            \
+  const volatile double*: fhtAddI64DoubleP,                            \
+  long double:           fhtAddI64LongDouble,                         \
+  long double*:          fhtAddI64LongDoubleP,                        \
+  const volatile long double*: fhtAddI64LongDoubleP,                        \
+  List:                  fhtAddI64List,                               \
+  List*:                 fhtAddI64ListP,                              \
+  const volatile List*:  fhtAddI64ListP,                              \
+  Queue:                 fhtAddI64Queue,                              \
+  Queue*:                fhtAddI64QueueP,                             \
+  const volatile Queue*: fhtAddI64QueueP,                             \
+  Stack:                 fhtAddI64Stack,                              \
+  Stack*:                fhtAddI64StackP,                             \
+  const volatile Stack*: fhtAddI64StackP,                             \
+  RedBlackTree:          fhtAddI64RedBlackTree,                       \
+  RedBlackTree*:         fhtAddI64RedBlackTreeP,                      \
+  const volatile RedBlackTree*: fhtAddI64RedBlackTreeP,                      \
+  HashTable:             fhtAddI64HashTable,                          \
+  HashTable*:            fhtAddI64HashTableP,                         \
+  const volatile HashTable*: fhtAddI64HashTableP,                         \
+  Vector:                fhtAddI64Vector,                             \
+  Vector*:               fhtAddI64VectorP,                            \
+  const volatile Vector*: fhtAddI64VectorP,                            \
+  char*:                 fhtAddI64String,                             \
+  const volatile char*:  fhtAddI64String,                             \
+  char**:                fhtAddI64StringP,                            \
+  const volatile char**: fhtAddI64StringP,                            \
+  Bytes:                 fhtAddI64Bytes,                              \
+  Bytes*:                fhtAddI64BytesP,                             \
+  const volatile Bytes*: fhtAddI64BytesP,                             \
+  void*:                 fhtAddI64Pointer,                            \
+  void**:                fhtAddI64PointerP,                           \
+  const volatile void**: fhtAddI64PointerP,                           \
+  i8:                    fhtAddI64I8,                                 \
+  u8:                    fhtAddI64U8                                  \
+
+#define fhtAddI64(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_I64_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_U64_KEY(dataStructure, key, value) \
+  bool:                  fhtAddU64Bool,                               \
+  bool*:                 fhtAddU64BoolP,                              \
+  const volatile bool*:  fhtAddU64BoolP,                              \
+  i16:                   fhtAddU64I16,                                \
+  i16*:                  fhtAddU64I16P,                               \
+  const volatile i16*:   fhtAddU64I16P,                               \
+  u16:                   fhtAddU64U16,                                \
+  u16*:                  fhtAddU64U16P,                               \
+  const volatile u16*:   fhtAddU64U16P,                               \
+  i32:                   fhtAddU64I32,                                \
+  i32*:                  fhtAddU64I32P,                               \
+  const volatile i32*:   fhtAddU64I32P,                               \
+  u32:                   fhtAddU64U32,                                \
+  u32*:                  fhtAddU64U32P,                               \
+  const volatile u32*:   fhtAddU64U32P,                               \
+  i64:                   fhtAddU64I64,                                \
+  i64*:                  fhtAddU64I64P,                               \
+  const volatile i64*:   fhtAddU64I64P,                               \
+  u64:                   fhtAddU64U64,                                \
+  u64*:                  fhtAddU64U64P,                               \
+  const volatile u64*:   fhtAddU64U64P,                               \
+  float:                 fhtAddU64Float,                              \
+  float*:                fhtAddU64FloatP,                             \
+  const volatile float*: fhtAddU64FloatP,                             \
+  double:                fhtAddU64Double,                             \
+  double*:               fhtAddU64DoubleP,                            \
+  const volatile double*: fhtAddU64DoubleP,                            \
+  long double:           fhtAddU64LongDouble,                         \
+  long double*:          fhtAddU64LongDoubleP,                        \
+  const volatile long double*: fhtAddU64LongDoubleP,                        \
+  List:                  fhtAddU64List,                               \
+  List*:                 fhtAddU64ListP,                              \
+  const volatile List*:  fhtAddU64ListP,                              \
+  Queue:                 fhtAddU64Queue,                              \
+  Queue*:                fhtAddU64QueueP,                             \
+  const volatile Queue*: fhtAddU64QueueP,                             \
+  Stack:                 fhtAddU64Stack,                              \
+  Stack*:                fhtAddU64StackP,                             \
+  const volatile Stack*: fhtAddU64StackP,                             \
+  RedBlackTree:          fhtAddU64RedBlackTree,                       \
+  RedBlackTree*:         fhtAddU64RedBlackTreeP,                      \
+  const volatile RedBlackTree*: fhtAddU64RedBlackTreeP,                      \
+  HashTable:             fhtAddU64HashTable,                          \
+  HashTable*:            fhtAddU64HashTableP,                         \
+  const volatile HashTable*: fhtAddU64HashTableP,                         \
+  Vector:                fhtAddU64Vector,                             \
+  Vector*:               fhtAddU64VectorP,                            \
+  const volatile Vector*: fhtAddU64VectorP,                            \
+  char*:                 fhtAddU64String,                             \
+  const volatile char*:  fhtAddU64String,                             \
+  char**:                fhtAddU64StringP,                            \
+  const volatile char**: fhtAddU64StringP,                            \
+  Bytes:                 fhtAddU64Bytes,                              \
+  Bytes*:                fhtAddU64BytesP,                             \
+  const volatile Bytes*: fhtAddU64BytesP,                             \
+  void*:                 fhtAddU64Pointer,                            \
+  void**:                fhtAddU64PointerP,                           \
+  const volatile void**: fhtAddU64PointerP,                           \
+  i8:                    fhtAddU64I8,                                 \
+  u8:                    fhtAddU64U8                                  \
+
+#define fhtAddU64(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_U64_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_FLOAT_KEY(dataStructure, key, value) \
+  bool:                  fhtAddFloatBool,                             \
+  bool*:                 fhtAddFloatBoolP,                            \
+  const volatile bool*:  fhtAddFloatBoolP,                            \
+  i16:                   fhtAddFloatI16,                              \
+  i16*:                  fhtAddFloatI16P,                             \
+  const volatile i16*:   fhtAddFloatI16P,                             \
+  u16:                   fhtAddFloatU16,                              \
+  u16*:                  fhtAddFloatU16P,                             \
+  const volatile u16*:   fhtAddFloatU16P,                             \
+  i32:                   fhtAddFloatI32,                              \
+  i32*:                  fhtAddFloatI32P,                             \
+  const volatile i32*:   fhtAddFloatI32P,                             \
+  u32:                   fhtAddFloatU32,                              \
+  u32*:                  fhtAddFloatU32P,                             \
+  const volatile u32*:   fhtAddFloatU32P,                             \
+  i64:                   fhtAddFloatI64,                              \
+  i64*:                  fhtAddFloatI64P,                             \
+  const volatile i64*:   fhtAddFloatI64P,                             \
+  u64:                   fhtAddFloatU64,                              \
+  u64*:                  fhtAddFloatU64P,                             \
+  const volatile u64*:   fhtAddFloatU64P,                             \
+  float:                 fhtAddFloatFloat,                            \
+  float*:                fhtAddFloatFloatP,                           \
+  const volatile float*: fhtAddFloatFloatP,                           \
+  double:                fhtAddFloatDouble,                           \
+  double*:               fhtAddFloatDoubleP,                          \
+  const volatile double*: fhtAddFloatDoubleP,                          \
+  long double:           fhtAddFloatLongDouble,                       \
+  long double*:          fhtAddFloatLongDoubleP,                      \
+  const volatile long double*: fhtAddFloatLongDoubleP,                      \
+  List:                  fhtAddFloatList,                             \
+  List*:                 fhtAddFloatListP,                            \
+  const volatile List*:  fhtAddFloatListP,                            \
+  Queue:                 fhtAddFloatQueue,                            \
+  Queue*:                fhtAddFloatQueueP,                           \
+  const volatile Queue*: fhtAddFloatQueueP,                           \
+  Stack:                 fhtAddFloatStack,                            \
+  Stack*:                fhtAddFloatStackP,                           \
+  const volatile Stack*: fhtAddFloatStackP,                           \
+  RedBlackTree:          fhtAddFloatRedBlackTree,                     \
+  RedBlackTree*:         fhtAddFloatRedBlackTreeP,                    \
+  const volatile RedBlackTree*: fhtAddFloatRedBlackTreeP,                    \
+  HashTable:             fhtAddFloatHashTable,                        \
+  HashTable*:            fhtAddFloatHashTableP,                       \
+  const volatile HashTable*: fhtAddFloatHashTableP,                       \
+  Vector:                fhtAddFloatVector,                           \
+  Vector*:               fhtAddFloatVectorP,                          \
+  const volatile Vector*: fhtAddFloatVectorP,                          \
+  char*:                 fhtAddFloatString,                           \
+  const volatile char*:  fhtAddFloatString,                           \
+  char**:                fhtAddFloatStringP,                          \
+  const volatile char**: fhtAddFloatStringP,                          \
+  Bytes:                 fhtAddFloatBytes,                            \
+  Bytes*:                fhtAddFloatBytesP,                           \
+  const volatile Bytes*: fhtAddFloatBytesP,                           \
+  void*:                 fhtAddFloatPointer,                          \
+  void**:                fhtAddFloatPointerP,                         \
+  const volatile void**: fhtAddFloatPointerP,                         \
+  i8:                    fhtAddFloatI8,                               \
+  u8:                    fhtAddFloatU8                                \
+
+#define fhtAddFloat(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_FLOAT_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_DOUBLE_KEY(dataStructure, key, value) \
+  bool:                  fhtAddDoubleBool,                            \
+  bool*:                 fhtAddDoubleBoolP,                           \
+  const volatile bool*:  fhtAddDoubleBoolP,                           \
+  i16:                   fhtAddDoubleI16,                             \
+  i16*:                  fhtAddDoubleI16P,                            \
+  const volatile i16*:   fhtAddDoubleI16P,                            \
+  u16:                   fhtAddDoubleU16,                             \
+  u16*:                  fhtAddDoubleU16P,                            \
+  const volatile u16*:   fhtAddDoubleU16P,                            \
+  i32:                   fhtAddDoubleI32,                             \
+  i32*:                  fhtAddDoubleI32P,                            \
+  const volatile i32*:   fhtAddDoubleI32P,                            \
+  u32:                   fhtAddDoubleU32,                             \
+  u32*:                  fhtAddDoubleU32P,                            \
+  const volatile u32*:   fhtAddDoubleU32P,                            \
+  i64:                   fhtAddDoubleI64,                             \
+  i64*:                  fhtAddDoubleI64P,                            \
+  const volatile i64*:   fhtAddDoubleI64P,                            \
+  u64:                   fhtAddDoubleU64,                             \
+  u64*:                  fhtAddDoubleU64P,                            \
+  const volatile u64*:   fhtAddDoubleU64P,                            \
+  float:                 fhtAddDoubleFloat,                           \
+  float*:                fhtAddDoubleFloatP,                          \
+  const volatile float*: fhtAddDoubleFloatP,                          \
+  double:                fhtAddDoubleDouble,                          \
+  double*:               fhtAddDoubleDoubleP,                         \
+  const volatile double*: fhtAddDoubleDoubleP,                         \
+  long double:           fhtAddDoubleLongDouble,                      \
+  long double*:          fhtAddDoubleLongDoubleP,                     \
+  const volatile long double*: fhtAddDoubleLongDoubleP,                     \
+  List:                  fhtAddDoubleList,                            \
+  List*:                 fhtAddDoubleListP,                           \
+  const volatile List*:  fhtAddDoubleListP,                           \
+  Queue:                 fhtAddDoubleQueue,                           \
+  Queue*:                fhtAddDoubleQueueP,                          \
+  const volatile Queue*: fhtAddDoubleQueueP,                          \
+  Stack:                 fhtAddDoubleStack,                           \
+  Stack*:                fhtAddDoubleStackP,                          \
+  const volatile Stack*: fhtAddDoubleStackP,                          \
+  RedBlackTree:          fhtAddDoubleRedBlackTree,                    \
+  RedBlackTree*:         fhtAddDoubleRedBlackTreeP,                   \
+  const volatile RedBlackTree*: fhtAddDoubleRedBlackTreeP,                   \
+  HashTable:             fhtAddDoubleHashTable,                       \
+  HashTable*:            fhtAddDoubleHashTableP,                      \
+  const volatile HashTable*: fhtAddDoubleHashTableP,                      \
+  Vector:                fhtAddDoubleVector,                          \
+  Vector*:               fhtAddDoubleVectorP,                         \
+  const volatile Vector*: fhtAddDoubleVectorP,                         \
+  char*:                 fhtAddDoubleString,                          \
+  const volatile char*:  fhtAddDoubleString,                          \
+  char**:                fhtAddDoubleStringP,                         \
+  const volatile char**: fhtAddDoubleStringP,                         \
+  Bytes:                 fhtAddDoubleBytes,                           \
+  Bytes*:                fhtAddDoubleBytesP,                          \
+  const volatile Bytes*: fhtAddDoubleBytesP,                          \
+  void*:                 fhtAddDoublePointer,                         \
+  void**:                fhtAddDoublePointerP,                        \
+  const volatile void**: fhtAddDoublePointerP,                        \
+  i8:                    fhtAddDoubleI8,                              \
+  u8:                    fhtAddDoubleU8                               \
+
+#define fhtAddDouble(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_DOUBLE_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_LONG_DOUBLE_KEY(dataStructure, key, value) \
+  bool:                  fhtAddLongDoubleBool,                        \
+  bool*:                 fhtAddLongDoubleBoolP,                       \
+  const volatile bool*:  fhtAddLongDoubleBoolP,                       \
+  i16:                   fhtAddLongDoubleI16,                         \
+  i16*:                  fhtAddLongDoubleI16P,                        \
+  const volatile i16*:   fhtAddLongDoubleI16P,                        \
+  u16:                   fhtAddLongDoubleU16,                         \
+  u16*:                  fhtAddLongDoubleU16P,                        \
+  const volatile u16*:   fhtAddLongDoubleU16P,                        \
+  i32:                   fhtAddLongDoubleI32,                         \
+  i32*:                  fhtAddLongDoubleI32P,                        \
+  const volatile i32*:   fhtAddLongDoubleI32P,                        \
+  u32:                   fhtAddLongDoubleU32,                         \
+  u32*:                  fhtAddLongDoubleU32P,                        \
+  const volatile u32*:   fhtAddLongDoubleU32P,                        \
+  i64:                   fhtAddLongDoubleI64,                         \
+  i64*:                  fhtAddLongDoubleI64P,                        \
+  const volatile i64*:   fhtAddLongDoubleI64P,                        \
+  u64:                   fhtAddLongDoubleU64,                         \
+  u64*:                  fhtAddLongDoubleU64P,                        \
+  const volatile u64*:   fhtAddLongDoubleU64P,                        \
+  float:                 fhtAddLongDoubleFloat,                       \
+  float*:                fhtAddLongDoubleFloatP,                      \
+  const volatile float*: fhtAddLongDoubleFloatP,                      \
+  double:                fhtAddLongDoubleDouble,                      \
+  double*:               fhtAddLongDoubleDoubleP,                     \
+  const volatile double*: fhtAddLongDoubleDoubleP,                     \
+  long double:           fhtAddLongDoubleLongDouble,                  \
+  long double*:          fhtAddLongDoubleLongDoubleP,                 \
+  const volatile long double*: fhtAddLongDoubleLongDoubleP,                 \
+  List:                  fhtAddLongDoubleList,                        \
+  List*:                 fhtAddLongDoubleListP,                       \
+  const volatile List*:  fhtAddLongDoubleListP,                       \
+  Queue:                 fhtAddLongDoubleQueue,                       \
+  Queue*:                fhtAddLongDoubleQueueP,                      \
+  const volatile Queue*: fhtAddLongDoubleQueueP,                      \
+  Stack:                 fhtAddLongDoubleStack,                       \
+  Stack*:                fhtAddLongDoubleStackP,                      \
+  const volatile Stack*: fhtAddLongDoubleStackP,                      \
+  RedBlackTree:          fhtAddLongDoubleRedBlackTree,                \
+  RedBlackTree*:         fhtAddLongDoubleRedBlackTreeP,               \
+  const volatile RedBlackTree*: fhtAddLongDoubleRedBlackTreeP,               \
+  HashTable:             fhtAddLongDoubleHashTable,                   \
+  HashTable*:            fhtAddLongDoubleHashTableP,                  \
+  const volatile HashTable*: fhtAddLongDoubleHashTableP,                  \
+  Vector:                fhtAddLongDoubleVector,                      \
+  Vector*:               fhtAddLongDoubleVectorP,                     \
+  const volatile Vector*: fhtAddLongDoubleVectorP,                     \
+  char*:                 fhtAddLongDoubleString,                      \
+  const volatile char*:  fhtAddLongDoubleString,                      \
+  char**:                fhtAddLongDoubleStringP,                     \
+  const volatile char**: fhtAddLongDoubleStringP,                     \
+  Bytes:                 fhtAddLongDoubleBytes,                       \
+  Bytes*:                fhtAddLongDoubleBytesP,                      \
+  const volatile Bytes*: fhtAddLongDoubleBytesP,                      \
+  void*:                 fhtAddLongDoublePointer,                     \
+  void**:                fhtAddLongDoublePointerP,                    \
+  const volatile void**: fhtAddLongDoublePointerP,                    \
+  i8:                    fhtAddLongDoubleI8,                          \
+  u8:                    fhtAddLongDoubleU8                           \
+
+#define fhtAddLongDouble(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_LONG_DOUBLE_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_LIST_KEY(dataStructure, key, value) \
+  bool:                  fhtAddListBool,                              \
+  bool*:                 fhtAddListBoolP,                             \
+  const volatile bool*:  fhtAddListBoolP,                             \
+  i16:                   fhtAddListI16,                               \
+  i16*:                  fhtAddListI16P,                              \
+  const volatile i16*:   fhtAddListI16P,                              \
+  u16:                   fhtAddListU16,                               \
+  u16*:                  fhtAddListU16P,                              \
+  const volatile u16*:   fhtAddListU16P,                              \
+  i32:                   fhtAddListI32,                               \
+  i32*:                  fhtAddListI32P,                              \
+  const volatile i32*:   fhtAddListI32P,                              \
+  u32:                   fhtAddListU32,                               \
+  u32*:                  fhtAddListU32P,                              \
+  const volatile u32*:   fhtAddListU32P,                              \
+  i64:                   fhtAddListI64,                               \
+  i64*:                  fhtAddListI64P,                              \
+  const volatile i64*:   fhtAddListI64P,                              \
+  u64:                   fhtAddListU64,                               \
+  u64*:                  fhtAddListU64P,                              \
+  const volatile u64*:   fhtAddListU64P,                              \
+  float:                 fhtAddListFloat,                             \
+  float*:                fhtAddListFloatP,                            \
+  const volatile float*: fhtAddListFloatP,                            \
+  double:                fhtAddListDouble,                            \
+  double*:               fhtAddListDoubleP,                           \
+  const volatile double*: fhtAddListDoubleP,                           \
+  long double:           fhtAddListLongDouble,                        \
+  long double*:          fhtAddListLongDoubleP,                       \
+  const volatile long double*: fhtAddListLongDoubleP,                       \
+  List:                  fhtAddListList,                              \
+  List*:                 fhtAddListListP,                             \
+  const volatile List*:  fhtAddListListP,                             \
+  Queue:                 fhtAddListQueue,                             \
+  Queue*:                fhtAddListQueueP,                            \
+  const volatile Queue*: fhtAddListQueueP,                            \
+  Stack:                 fhtAddListStack,                             \
+  Stack*:                fhtAddListStackP,                            \
+  const volatile Stack*: fhtAddListStackP,                            \
+  RedBlackTree:          fhtAddListRedBlackTree,                      \
+  RedBlackTree*:         fhtAddListRedBlackTreeP,                     \
+  const volatile RedBlackTree*: fhtAddListRedBlackTreeP,                     \
+  HashTable:             fhtAddListHashTable,                         \
+  HashTable*:            fhtAddListHashTableP,                        \
+  const volatile HashTable*: fhtAddListHashTableP,                        \
+  Vector:                fhtAddListVector,                            \
+  Vector*:               fhtAddListVectorP,                           \
+  const volatile Vector*: fhtAddListVectorP,                           \
+  char*:                 fhtAddListString,                            \
+  const volatile char*:  fhtAddListString,                            \
+  char**:                fhtAddListStringP,                           \
+  const volatile char**: fhtAddListStringP,                           \
+  Bytes:                 fhtAddListBytes,                             \
+  Bytes*:                fhtAddListBytesP,                            \
+  const volatile Bytes*: fhtAddListBytesP,                            \
+  void*:                 fhtAddListPointer,                           \
+  void**:                fhtAddListPointerP,                          \
+  const volatile void**: fhtAddListPointerP,                          \
+  i8:                    fhtAddListI8,                                \
+  u8:                    fhtAddListU8                                 \
+
+#define fhtAddList(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_LIST_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_QUEUE_KEY(dataStructure, key, value) \
+  bool:                  fhtAddQueueBool,                             \
+  bool*:                 fhtAddQueueBoolP,                            \
+  const volatile bool*:  fhtAddQueueBoolP,                            \
+  i16:                   fhtAddQueueI16,                              \
+  i16*:                  fhtAddQueueI16P,                             \
+  const volatile i16*:   fhtAddQueueI16P,                             \
+  u16:                   fhtAddQueueU16,                              \
+  u16*:                  fhtAddQueueU16P,                             \
+  const volatile u16*:   fhtAddQueueU16P,                             \
+  i32:                   fhtAddQueueI32,                              \
+  i32*:                  fhtAddQueueI32P,                             \
+  const volatile i32*:   fhtAddQueueI32P,                             \
+  u32:                   fhtAddQueueU32,                              \
+  u32*:                  fhtAddQueueU32P,                             \
+  const volatile u32*:   fhtAddQueueU32P,                             \
+  i64:                   fhtAddQueueI64,                              \
+  i64*:                  fhtAddQueueI64P,                             \
+  const volatile i64*:   fhtAddQueueI64P,                             \
+  u64:                   fhtAddQueueU64,                              \
+  u64*:                  fhtAddQueueU64P,                             \
+  const volatile u64*:   fhtAddQueueU64P,                             \
+  float:                 fhtAddQueueFloat,                            \
+  float*:                fhtAddQueueFloatP,                           \
+  const volatile float*: fhtAddQueueFloatP,                           \
+  double:                fhtAddQueueDouble,                           \
+  double*:               fhtAddQueueDoubleP,                          \
+  const volatile double*: fhtAddQueueDoubleP,                          \
+  long double:           fhtAddQueueLongDouble,                       \
+  long double*:          fhtAddQueueLongDoubleP,                      \
+  const volatile long double*: fhtAddQueueLongDoubleP,                      \
+  List:                  fhtAddQueueList,                             \
+  List*:                 fhtAddQueueListP,                            \
+  const volatile List*:  fhtAddQueueListP,                            \
+  Queue:                 fhtAddQueueQueue,                            \
+  Queue*:                fhtAddQueueQueueP,                           \
+  const volatile Queue*: fhtAddQueueQueueP,                           \
+  Stack:                 fhtAddQueueStack,                            \
+  Stack*:                fhtAddQueueStackP,                           \
+  const volatile Stack*: fhtAddQueueStackP,                           \
+  RedBlackTree:          fhtAddQueueRedBlackTree,                     \
+  RedBlackTree*:         fhtAddQueueRedBlackTreeP,                    \
+  const volatile RedBlackTree*: fhtAddQueueRedBlackTreeP,                    \
+  HashTable:             fhtAddQueueHashTable,                        \
+  HashTable*:            fhtAddQueueHashTableP,                       \
+  const volatile HashTable*: fhtAddQueueHashTableP,                       \
+  Vector:                fhtAddQueueVector,                           \
+  Vector*:               fhtAddQueueVectorP,                          \
+  const volatile Vector*: fhtAddQueueVectorP,                          \
+  char*:                 fhtAddQueueString,                           \
+  const volatile char*:  fhtAddQueueString,                           \
+  char**:                fhtAddQueueStringP,                          \
+  const volatile char**: fhtAddQueueStringP,                          \
+  Bytes:                 fhtAddQueueBytes,                            \
+  Bytes*:                fhtAddQueueBytesP,                           \
+  const volatile Bytes*: fhtAddQueueBytesP,                           \
+  void*:                 fhtAddQueuePointer,                          \
+  void**:                fhtAddQueuePointerP,                         \
+  const volatile void**: fhtAddQueuePointerP,                         \
+  i8:                    fhtAddQueueI8,                               \
+  u8:                    fhtAddQueueU8                                \
+
+#define fhtAddQueue(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_QUEUE_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_STACK_KEY(dataStructure, key, value) \
+  bool:                  fhtAddStackBool,                             \
+  bool*:                 fhtAddStackBoolP,                            \
+  const volatile bool*:  fhtAddStackBoolP,                            \
+  i16:                   fhtAddStackI16,                              \
+  i16*:                  fhtAddStackI16P,                             \
+  const volatile i16*:   fhtAddStackI16P,                             \
+  u16:                   fhtAddStackU16,                              \
+  u16*:                  fhtAddStackU16P,                             \
+  const volatile u16*:   fhtAddStackU16P,                             \
+  i32:                   fhtAddStackI32,                              \
+  i32*:                  fhtAddStackI32P,                             \
+  const volatile i32*:   fhtAddStackI32P,                             \
+  u32:                   fhtAddStackU32,                              \
+  u32*:                  fhtAddStackU32P,                             \
+  const volatile u32*:   fhtAddStackU32P,                             \
+  i64:                   fhtAddStackI64,                              \
+  i64*:                  fhtAddStackI64P,                             \
+  const volatile i64*:   fhtAddStackI64P,                             \
+  u64:                   fhtAddStackU64,                              \
+  u64*:                  fhtAddStackU64P,                             \
+  const volatile u64*:   fhtAddStackU64P,                             \
+  float:                 fhtAddStackFloat,                            \
+  float*:                fhtAddStackFloatP,                           \
+  const volatile float*: fhtAddStackFloatP,                           \
+  double:                fhtAddStackDouble,                           \
+  double*:               fhtAddStackDoubleP,                          \
+  const volatile double*: fhtAddStackDoubleP,                          \
+  long double:           fhtAddStackLongDouble,                       \
+  long double*:          fhtAddStackLongDoubleP,                      \
+  const volatile long double*: fhtAddStackLongDoubleP,                      \
+  List:                  fhtAddStackList,                             \
+  List*:                 fhtAddStackListP,                            \
+  const volatile List*:  fhtAddStackListP,                            \
+  Queue:                 fhtAddStackQueue,                            \
+  Queue*:                fhtAddStackQueueP,                           \
+  const volatile Queue*: fhtAddStackQueueP,                           \
+  Stack:                 fhtAddStackStack,                            \
+  Stack*:                fhtAddStackStackP,                           \
+  const volatile Stack*: fhtAddStackStackP,                           \
+  RedBlackTree:          fhtAddStackRedBlackTree,                     \
+  RedBlackTree*:         fhtAddStackRedBlackTreeP,                    \
+  const volatile RedBlackTree*: fhtAddStackRedBlackTreeP,                    \
+  HashTable:             fhtAddStackHashTable,                        \
+  HashTable*:            fhtAddStackHashTableP,                       \
+  const volatile HashTable*: fhtAddStackHashTableP,                       \
+  Vector:                fhtAddStackVector,                           \
+  Vector*:               fhtAddStackVectorP,                          \
+  const volatile Vector*: fhtAddStackVectorP,                          \
+  char*:                 fhtAddStackString,                           \
+  const volatile char*:  fhtAddStackString,                           \
+  char**:                fhtAddStackStringP,                          \
+  const volatile char**: fhtAddStackStringP,                          \
+  Bytes:                 fhtAddStackBytes,                            \
+  Bytes*:                fhtAddStackBytesP,                           \
+  const volatile Bytes*: fhtAddStackBytesP,                           \
+  void*:                 fhtAddStackPointer,                          \
+  void**:                fhtAddStackPointerP,                         \
+  const volatile void**: fhtAddStackPointerP,                         \
+  i8:                    fhtAddStackI8,                               \
+  u8:                    fhtAddStackU8                                \
+
+#define fhtAddStack(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_STACK_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_RED_BLACK_TREE_KEY(dataStructure, key, value) \
+  bool:                  fhtAddRedBlackTreeBool,                      \
+  bool*:                 fhtAddRedBlackTreeBoolP,                     \
+  const volatile bool*:  fhtAddRedBlackTreeBoolP,                     \
+  i16:                   fhtAddRedBlackTreeI16,                       \
+  i16*:                  fhtAddRedBlackTreeI16P,                      \
+  const volatile i16*:   fhtAddRedBlackTreeI16P,                      \
+  u16:                   fhtAddRedBlackTreeU16,                       \
+  u16*:                  fhtAddRedBlackTreeU16P,                      \
+  const volatile u16*:   fhtAddRedBlackTreeU16P,                      \
+  i32:                   fhtAddRedBlackTreeI32,                       \
+  i32*:                  fhtAddRedBlackTreeI32P,                      \
+  const volatile i32*:   fhtAddRedBlackTreeI32P,                      \
+  u32:                   fhtAddRedBlackTreeU32,                       \
+  u32*:                  fhtAddRedBlackTreeU32P,                      \
+  const volatile u32*:   fhtAddRedBlackTreeU32P,                      \
+  i64:                   fhtAddRedBlackTreeI64,                       \
+  i64*:                  fhtAddRedBlackTreeI64P,                      \
+  const volatile i64*:   fhtAddRedBlackTreeI64P,                      \
+  u64:                   fhtAddRedBlackTreeU64,                       \
+  u64*:                  fhtAddRedBlackTreeU64P,                      \
+  const volatile u64*:   fhtAddRedBlackTreeU64P,                      \
+  float:                 fhtAddRedBlackTreeFloat,                     \
+  float*:                fhtAddRedBlackTreeFloatP,                    \
+  const volatile float*: fhtAddRedBlackTreeFloatP,                    \
+  double:                fhtAddRedBlackTreeDouble,                    \
+  double*:               fhtAddRedBlackTreeDoubleP,                   \
+  const volatile double*: fhtAddRedBlackTreeDoubleP,                   \
+  long double:           fhtAddRedBlackTreeLongDouble,                \
+  long double*:          fhtAddRedBlackTreeLongDoubleP,               \
+  const volatile long double*: fhtAddRedBlackTreeLongDoubleP,               \
+  List:                  fhtAddRedBlackTreeList,                      \
+  List*:                 fhtAddRedBlackTreeListP,                     \
+  const volatile List*:  fhtAddRedBlackTreeListP,                     \
+  Queue:                 fhtAddRedBlackTreeQueue,                     \
+  Queue*:                fhtAddRedBlackTreeQueueP,                    \
+  const volatile Queue*: fhtAddRedBlackTreeQueueP,                    \
+  Stack:                 fhtAddRedBlackTreeStack,                     \
+  Stack*:                fhtAddRedBlackTreeStackP,                    \
+  const volatile Stack*: fhtAddRedBlackTreeStackP,                    \
+  RedBlackTree:          fhtAddRedBlackTreeRedBlackTree,              \
+  RedBlackTree*:         fhtAddRedBlackTreeRedBlackTreeP,             \
+  const volatile RedBlackTree*: fhtAddRedBlackTreeRedBlackTreeP,             \
+  HashTable:             fhtAddRedBlackTreeHashTable,                 \
+  HashTable*:            fhtAddRedBlackTreeHashTableP,                \
+  const volatile HashTable*: fhtAddRedBlackTreeHashTableP,                \
+  Vector:                fhtAddRedBlackTreeVector,                    \
+  Vector*:               fhtAddRedBlackTreeVectorP,                   \
+  const volatile Vector*: fhtAddRedBlackTreeVectorP,                   \
+  char*:                 fhtAddRedBlackTreeString,                    \
+  const volatile char*:  fhtAddRedBlackTreeString,                    \
+  char**:                fhtAddRedBlackTreeStringP,                   \
+  const volatile char**: fhtAddRedBlackTreeStringP,                   \
+  Bytes:                 fhtAddRedBlackTreeBytes,                     \
+  Bytes*:                fhtAddRedBlackTreeBytesP,                    \
+  const volatile Bytes*: fhtAddRedBlackTreeBytesP,                    \
+  void*:                 fhtAddRedBlackTreePointer,                   \
+  void**:                fhtAddRedBlackTreePointerP,                  \
+  const volatile void**: fhtAddRedBlackTreePointerP,                  \
+  i8:                    fhtAddRedBlackTreeI8,                        \
+  u8:                    fhtAddRedBlackTreeU8                         \
+
+#define fhtAddRedBlackTree(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_RED_BLACK_TREE_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_HASH_TABLE_KEY(dataStructure, key, value) \
+  bool:                  fhtAddHashTableBool,                         \
+  bool*:                 fhtAddHashTableBoolP,                        \
+  const volatile bool*:  fhtAddHashTableBoolP,                        \
+  i16:                   fhtAddHashTableI16,                          \
+  i16*:                  fhtAddHashTableI16P,                         \
+  const volatile i16*:   fhtAddHashTableI16P,                         \
+  u16:                   fhtAddHashTableU16,                          \
+  u16*:                  fhtAddHashTableU16P,                         \
+  const volatile u16*:   fhtAddHashTableU16P,                         \
+  i32:                   fhtAddHashTableI32,                          \
+  i32*:                  fhtAddHashTableI32P,                         \
+  const volatile i32*:   fhtAddHashTableI32P,                         \
+  u32:                   fhtAddHashTableU32,                          \
+  u32*:                  fhtAddHashTableU32P,                         \
+  const volatile u32*:   fhtAddHashTableU32P,                         \
+  i64:                   fhtAddHashTableI64,                          \
+  i64*:                  fhtAddHashTableI64P,                         \
+  const volatile i64*:   fhtAddHashTableI64P,                         \
+  u64:                   fhtAddHashTableU64,                          \
+  u64*:                  fhtAddHashTableU64P,                         \
+  const volatile u64*:   fhtAddHashTableU64P,                         \
+  float:                 fhtAddHashTableFloat,                        \
+  float*:                fhtAddHashTableFloatP,                       \
+  const volatile float*: fhtAddHashTableFloatP,                       \
+  double:                fhtAddHashTableDouble,                       \
+  double*:               fhtAddHashTableDoubleP,                      \
+  const volatile double*: fhtAddHashTableDoubleP,                      \
+  long double:           fhtAddHashTableLongDouble,                   \
+  long double*:          fhtAddHashTableLongDoubleP,                  \
+  const volatile long double*: fhtAddHashTableLongDoubleP,                  \
+  List:                  fhtAddHashTableList,                         \
+  List*:                 fhtAddHashTableListP,                        \
+  const volatile List*:  fhtAddHashTableListP,                        \
+  Queue:                 fhtAddHashTableQueue,                        \
+  Queue*:                fhtAddHashTableQueueP,                       \
+  const volatile Queue*: fhtAddHashTableQueueP,                       \
+  Stack:                 fhtAddHashTableStack,                        \
+  Stack*:                fhtAddHashTableStackP,                       \
+  const volatile Stack*: fhtAddHashTableStackP,                       \
+  RedBlackTree:          fhtAddHashTableRedBlackTree,                 \
+  RedBlackTree*:         fhtAddHashTableRedBlackTreeP,                \
+  const volatile RedBlackTree*: fhtAddHashTableRedBlackTreeP,                \
+  HashTable:             fhtAddHashTableHashTable,                    \
+  HashTable*:            fhtAddHashTableHashTableP,                   \
+  const volatile HashTable*: fhtAddHashTableHashTableP,                   \
+  Vector:                fhtAddHashTableVector,                       \
+  Vector*:               fhtAddHashTableVectorP,                      \
+  const volatile Vector*: fhtAddHashTableVectorP,                      \
+  char*:                 fhtAddHashTableString,                       \
+  const volatile char*:  fhtAddHashTableString,                       \
+  char**:                fhtAddHashTableStringP,                      \
+  const volatile char**: fhtAddHashTableStringP,                      \
+  Bytes:                 fhtAddHashTableBytes,                        \
+  Bytes*:                fhtAddHashTableBytesP,                       \
+  const volatile Bytes*: fhtAddHashTableBytesP,                       \
+  void*:                 fhtAddHashTablePointer,                      \
+  void**:                fhtAddHashTablePointerP,                     \
+  const volatile void**: fhtAddHashTablePointerP,                     \
+  i8:                    fhtAddHashTableI8,                           \
+  u8:                    fhtAddHashTableU8                            \
+
+#define fhtAddHashTable(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_HASH_TABLE_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_VECTOR_KEY(dataStructure, key, value) \
+  bool:                  fhtAddVectorBool,                            \
+  bool*:                 fhtAddVectorBoolP,                           \
+  const volatile bool*:  fhtAddVectorBoolP,                           \
+  i16:                   fhtAddVectorI16,                             \
+  i16*:                  fhtAddVectorI16P,                            \
+  const volatile i16*:   fhtAddVectorI16P,                            \
+  u16:                   fhtAddVectorU16,                             \
+  u16*:                  fhtAddVectorU16P,                            \
+  const volatile u16*:   fhtAddVectorU16P,                            \
+  i32:                   fhtAddVectorI32,                             \
+  i32*:                  fhtAddVectorI32P,                            \
+  const volatile i32*:   fhtAddVectorI32P,                            \
+  u32:                   fhtAddVectorU32,                             \
+  u32*:                  fhtAddVectorU32P,                            \
+  const volatile u32*:   fhtAddVectorU32P,                            \
+  i64:                   fhtAddVectorI64,                             \
+  i64*:                  fhtAddVectorI64P,                            \
+  const volatile i64*:   fhtAddVectorI64P,                            \
+  u64:                   fhtAddVectorU64,                             \
+  u64*:                  fhtAddVectorU64P,                            \
+  const volatile u64*:   fhtAddVectorU64P,                            \
+  float:                 fhtAddVectorFloat,                           \
+  float*:                fhtAddVectorFloatP,                          \
+  const volatile float*: fhtAddVectorFloatP,                          \
+  double:                fhtAddVectorDouble,                          \
+  double*:               fhtAddVectorDoubleP,                         \
+  const volatile double*: fhtAddVectorDoubleP,                         \
+  long double:           fhtAddVectorLongDouble,                      \
+  long double*:          fhtAddVectorLongDoubleP,                     \
+  const volatile long double*: fhtAddVectorLongDoubleP,                     \
+  List:                  fhtAddVectorList,                            \
+  List*:                 fhtAddVectorListP,                           \
+  const volatile List*:  fhtAddVectorListP,                           \
+  Queue:                 fhtAddVectorQueue,                           \
+  Queue*:                fhtAddVectorQueueP,                          \
+  const volatile Queue*: fhtAddVectorQueueP,                          \
+  Stack:                 fhtAddVectorStack,                           \
+  Stack*:                fhtAddVectorStackP,                          \
+  const volatile Stack*: fhtAddVectorStackP,                          \
+  RedBlackTree:          fhtAddVectorRedBlackTree,                    \
+  RedBlackTree*:         fhtAddVectorRedBlackTreeP,                   \
+  const volatile RedBlackTree*: fhtAddVectorRedBlackTreeP,                   \
+  HashTable:             fhtAddVectorHashTable,                       \
+  HashTable*:            fhtAddVectorHashTableP,                      \
+  const volatile HashTable*: fhtAddVectorHashTableP,                      \
+  Vector:                fhtAddVectorVector,                          \
+  Vector*:               fhtAddVectorVectorP,                         \
+  const volatile Vector*: fhtAddVectorVectorP,                         \
+  char*:                 fhtAddVectorString,                          \
+  const volatile char*:  fhtAddVectorString,                          \
+  char**:                fhtAddVectorStringP,                         \
+  const volatile char**: fhtAddVectorStringP,                         \
+  Bytes:                 fhtAddVectorBytes,                           \
+  Bytes*:                fhtAddVectorBytesP,                          \
+  const volatile Bytes*: fhtAddVectorBytesP,                          \
+  void*:                 fhtAddVectorPointer,                         \
+  void**:                fhtAddVectorPointerP,                        \
+  const volatile void**: fhtAddVectorPointerP,                        \
+  i8:                    fhtAddVectorI8,                              \
+  u8:                    fhtAddVectorU8                               \
+
+#define fhtAddVector(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_VECTOR_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_STRING_KEY(dataStructure, key, value) \
+  bool:                  fhtAddStringBool,                            \
+  const volatile bool:   fhtAddStringBool,                            \
+  bool*:                 fhtAddStringBoolP,                           \
+  const volatile bool*:  fhtAddStringBoolP,                           \
+  i16:                   fhtAddStringI16,                             \
+  const volatile i16:    fhtAddStringI16,                             \
+  i16*:                  fhtAddStringI16P,                            \
+  const volatile i16*:   fhtAddStringI16P,                            \
+  u16:                   fhtAddStringU16,                             \
+  const volatile u16:    fhtAddStringU16,                             \
+  u16*:                  fhtAddStringU16P,                            \
+  const volatile u16*:   fhtAddStringU16P,                            \
+  i32:                   fhtAddStringI32,                             \
+  const volatile i32:    fhtAddStringI32,                             \
+  i32*:                  fhtAddStringI32P,                            \
+  const volatile i32*:   fhtAddStringI32P,                            \
+  u32:                   fhtAddStringU32,                             \
+  const volatile u32:    fhtAddStringU32,                             \
+  u32*:                  fhtAddStringU32P,                            \
+  const volatile u32*:   fhtAddStringU32P,                            \
+  i64:                   fhtAddStringI64,                             \
+  const volatile i64:    fhtAddStringI64,                             \
+  i64*:                  fhtAddStringI64P,                            \
+  const volatile i64*:   fhtAddStringI64P,                            \
+  u64:                   fhtAddStringU64,                             \
+  const volatile u64:    fhtAddStringU64,                             \
+  u64*:                  fhtAddStringU64P,                            \
+  const volatile u64*:   fhtAddStringU64P,                            \
+  float:                 fhtAddStringFloat,                           \
+  const volatile float:  fhtAddStringFloat,                           \
+  float*:                fhtAddStringFloatP,                          \
+  const volatile float*: fhtAddStringFloatP,                          \
+  double:                fhtAddStringDouble,                          \
+  const volatile double: fhtAddStringDouble,                          \
+  double*:               fhtAddStringDoubleP,                         \
+  const volatile double*: fhtAddStringDoubleP,                         \
+  long double:           fhtAddStringLongDouble,                      \
+  const volatile long double: fhtAddStringLongDouble,                      \
+  long double*:          fhtAddStringLongDoubleP,                     \
+  const volatile long double*: fhtAddStringLongDoubleP,                     \
+  List:                  fhtAddStringList,                            \
+  const volatile List:   fhtAddStringList,                            \
+  List*:                 fhtAddStringListP,                           \
+  const volatile List*:  fhtAddStringListP,                           \
+  Queue:                 fhtAddStringQueue,                           \
+  const volatile Queue:  fhtAddStringQueue,                           \
+  Queue*:                fhtAddStringQueueP,                          \
+  const volatile Queue*: fhtAddStringQueueP,                          \
+  Stack:                 fhtAddStringStack,                           \
+  const volatile Stack:  fhtAddStringStack,                           \
+  Stack*:                fhtAddStringStackP,                          \
+  const volatile Stack*: fhtAddStringStackP,                          \
+  RedBlackTree:          fhtAddStringRedBlackTree,                    \
+  const volatile RedBlackTree: fhtAddStringRedBlackTree,                    \
+  RedBlackTree*:         fhtAddStringRedBlackTreeP,                   \
+  const volatile RedBlackTree*: fhtAddStringRedBlackTreeP,                   \
+  HashTable:             fhtAddStringHashTable,                       \
+  const volatile HashTable: fhtAddStringHashTable,                       \
+  HashTable*:            fhtAddStringHashTableP,                      \
+  const volatile HashTable*: fhtAddStringHashTableP,                      \
+  Vector:                fhtAddStringVector,                          \
+  const volatile Vector: fhtAddStringVector,                          \
+  Vector*:               fhtAddStringVectorP,                         \
+  const volatile Vector*: fhtAddStringVectorP,                         \
+  char*:                 fhtAddStringString,                          \
+  const volatile char*:  fhtAddStringString,                          \
+  char**:                fhtAddStringStringP,                         \
+  const volatile char**: fhtAddStringStringP,                         \
+  Bytes:                 fhtAddStringBytes,                           \
+  Bytes*:                fhtAddStringBytesP,                          \
+  const volatile Bytes*: fhtAddStringBytesP,                          \
+  void*:                 fhtAddStringPointer,                         \
+  void**:                fhtAddStringPointerP,                        \
+  const volatile void**: fhtAddStringPointerP,                        \
+  i8:                    fhtAddStringI8,                              \
+  u8:                    fhtAddStringU8                               \
+
+#define fhtAddString(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_STRING_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_BYTES_KEY(dataStructure, key, value) \
+  bool:                  fhtAddBytesBool,                             \
+  bool*:                 fhtAddBytesBoolP,                            \
+  const volatile bool*:  fhtAddBytesBoolP,                            \
+  i16:                   fhtAddBytesI16,                              \
+  i16*:                  fhtAddBytesI16P,                             \
+  const volatile i16*:   fhtAddBytesI16P,                             \
+  u16:                   fhtAddBytesU16,                              \
+  u16*:                  fhtAddBytesU16P,                             \
+  const volatile u16*:   fhtAddBytesU16P,                             \
+  i32:                   fhtAddBytesI32,                              \
+  i32*:                  fhtAddBytesI32P,                             \
+  const volatile i32*:   fhtAddBytesI32P,                             \
+  u32:                   fhtAddBytesU32,                              \
+  u32*:                  fhtAddBytesU32P,                             \
+  const volatile u32*:   fhtAddBytesU32P,                             \
+  i64:                   fhtAddBytesI64,                              \
+  i64*:                  fhtAddBytesI64P,                             \
+  const volatile i64*:   fhtAddBytesI64P,                             \
+  u64:                   fhtAddBytesU64,                              \
+  u64*:                  fhtAddBytesU64P,                             \
+  const volatile u64*:   fhtAddBytesU64P,                             \
+  float:                 fhtAddBytesFloat,                            \
+  float*:                fhtAddBytesFloatP,                           \
+  const volatile float*: fhtAddBytesFloatP,                           \
+  double:                fhtAddBytesDouble,                           \
+  double*:               fhtAddBytesDoubleP,                          \
+  const volatile double*: fhtAddBytesDoubleP,                          \
+  long double:           fhtAddBytesLongDouble,                       \
+  long double*:          fhtAddBytesLongDoubleP,                      \
+  const volatile long double*: fhtAddBytesLongDoubleP,                      \
+  List:                  fhtAddBytesList,                             \
+  List*:                 fhtAddBytesListP,                            \
+  const volatile List*:  fhtAddBytesListP,                            \
+  Queue:                 fhtAddBytesQueue,                            \
+  Queue*:                fhtAddBytesQueueP,                           \
+  const volatile Queue*: fhtAddBytesQueueP,                           \
+  Stack:                 fhtAddBytesStack,                            \
+  Stack*:                fhtAddBytesStackP,                           \
+  const volatile Stack*: fhtAddBytesStackP,                           \
+  RedBlackTree:          fhtAddBytesRedBlackTree,                     \
+  RedBlackTree*:         fhtAddBytesRedBlackTreeP,                    \
+  const volatile RedBlackTree*: fhtAddBytesRedBlackTreeP,                    \
+  HashTable:             fhtAddBytesHashTable,                        \
+  HashTable*:            fhtAddBytesHashTableP,                       \
+  const volatile HashTable*: fhtAddBytesHashTableP,                       \
+  Vector:                fhtAddBytesVector,                           \
+  Vector*:               fhtAddBytesVectorP,                          \
+  const volatile Vector*: fhtAddBytesVectorP,                          \
+  char*:                 fhtAddBytesString,                           \
+  const volatile char*:  fhtAddBytesString,                           \
+  char**:                fhtAddBytesStringP,                          \
+  const volatile char**: fhtAddBytesStringP,                          \
+  Bytes:                 fhtAddBytesBytes,                            \
+  Bytes*:                fhtAddBytesBytesP,                           \
+  const volatile Bytes*: fhtAddBytesBytesP,                           \
+  void*:                 fhtAddBytesPointer,                          \
+  void**:                fhtAddBytesPointerP,                         \
+  const volatile void**: fhtAddBytesPointerP,                         \
+  i8:                    fhtAddBytesI8,                               \
+  u8:                    fhtAddBytesU8                                \
+
+#define fhtAddBytes(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_BYTES_KEY(dataStructure, key, value) \
+  )
+
+
+#define FHT_ADD_GENERIC_CASES_POINTER_KEY(dataStructure, key, value) \
+  bool:                  fhtAddPointerBool,                           \
+  bool*:                 fhtAddPointerBoolP,                          \
+  const volatile bool*:  fhtAddPointerBoolP,                          \
+  i16:                   fhtAddPointerI16,                            \
+  i16*:                  fhtAddPointerI16P,                           \
+  const volatile i16*:   fhtAddPointerI16P,                           \
+  u16:                   fhtAddPointerU16,                            \
+  u16*:                  fhtAddPointerU16P,                           \
+  const volatile u16*:   fhtAddPointerU16P,                           \
+  i32:                   fhtAddPointerI32,                            \
+  i32*:                  fhtAddPointerI32P,                           \
+  const volatile i32*:   fhtAddPointerI32P,                           \
+  u32:                   fhtAddPointerU32,                            \
+  u32*:                  fhtAddPointerU32P,                           \
+  const volatile u32*:   fhtAddPointerU32P,                           \
+  i64:                   fhtAddPointerI64,                            \
+  i64*:                  fhtAddPointerI64P,                           \
+  const volatile i64*:   fhtAddPointerI64P,                           \
+  u64:                   fhtAddPointerU64,                            \
+  u64*:                  fhtAddPointerU64P,                           \
+  const volatile u64*:   fhtAddPointerU64P,                           \
+  float:                 fhtAddPointerFloat,                          \
+  float*:                fhtAddPointerFloatP,                         \
+  const volatile float*: fhtAddPointerFloatP,                         \
+  double:                fhtAddPointerDouble,                         \
+  double*:               fhtAddPointerDoubleP,                        \
+  const volatile double*: fhtAddPointerDoubleP,                        \
+  long double:           fhtAddPointerLongDouble,                     \
+  long double*:          fhtAddPointerLongDoubleP,                    \
+  const volatile long double*: fhtAddPointerLongDoubleP,                    \
+  List:                  fhtAddPointerList,                           \
+  List*:                 fhtAddPointerListP,                          \
+  const volatile List*:  fhtAddPointerListP,                          \
+  Queue:                 fhtAddPointerQueue,                          \
+  Queue*:                fhtAddPointerQueueP,                         \
+  const volatile Queue*: fhtAddPointerQueueP,                         \
+  Stack:                 fhtAddPointerStack,                          \
+  Stack*:                fhtAddPointerStackP,                         \
+  const volatile Stack*: fhtAddPointerStackP,                         \
+  RedBlackTree:          fhtAddPointerRedBlackTree,                   \
+  RedBlackTree*:         fhtAddPointerRedBlackTreeP,                  \
+  const volatile RedBlackTree*: fhtAddPointerRedBlackTreeP,                  \
+  HashTable:             fhtAddPointerHashTable,                      \
+  HashTable*:            fhtAddPointerHashTableP,                     \
+  const volatile HashTable*: fhtAddPointerHashTableP,                     \
+  Vector:                fhtAddPointerVector,                         \
+  Vector*:               fhtAddPointerVectorP,                        \
+  const volatile Vector*: fhtAddPointerVectorP,                        \
+  char*:                 fhtAddPointerString,                         \
+  const volatile char*:  fhtAddPointerString,                         \
+  char**:                fhtAddPointerStringP,                        \
+  const volatile char**: fhtAddPointerStringP,                        \
+  Bytes:                 fhtAddPointerBytes,                          \
+  Bytes*:                fhtAddPointerBytesP,                         \
+  const volatile Bytes*: fhtAddPointerBytesP,                         \
+  void*:                 fhtAddPointerPointer,                        \
+  void**:                fhtAddPointerPointerP,                       \
+  const volatile void**: fhtAddPointerPointerP,                       \
+  i8:                    fhtAddPointerI8,                             \
+  u8:                    fhtAddPointerU8                              \
+
+#define fhtAddPointer(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_POINTER_KEY(dataStructure, key, value) \
+  )
+
+
+#define FHT_ADD_GENERIC_CASES_I8_KEY(dataStructure, key, value) \
+  bool:                  fhtAddI8Bool,                                \
+  bool*:                 fhtAddI8BoolP,                               \
+  const volatile bool*:  fhtAddI8BoolP,                               \
+  i16:                   fhtAddI8I16,                                 \
+  i16*:                  fhtAddI8I16P,                                \
+  const volatile i16*:   fhtAddI8I16P,                                \
+  u16:                   fhtAddI8U16,                                 \
+  u16*:                  fhtAddI8U16P,                                \
+  const volatile u16*:   fhtAddI8U16P,                                \
+  i32:                   fhtAddI8I32,                                 \
+  i32*:                  fhtAddI8I32P,                                \
+  const volatile i32*:   fhtAddI8I32P,                                \
+  u32:                   fhtAddI8U32,                                 \
+  u32*:                  fhtAddI8U32P,                                \
+  const volatile u32*:   fhtAddI8U32P,                                \
+  i64:                   fhtAddI8I64,                                 \
+  i64*:                  fhtAddI8I64P,                                \
+  const volatile i64*:   fhtAddI8I64P,                                \
+  u64:                   fhtAddI8U64,                                 \
+  u64*:                  fhtAddI8U64P,                                \
+  const volatile u64*:   fhtAddI8U64P,                                \
+  float:                 fhtAddI8Float,                               \
+  float*:                fhtAddI8FloatP,                              \
+  const volatile float*: fhtAddI8FloatP,                              \
+  double:                fhtAddI8Double,                              \
+  double*:               fhtAddI8DoubleP,                             \
+  const volatile double*: fhtAddI8DoubleP,                             \
+  long double:           fhtAddI8LongDouble,                          \
+  long double*:          fhtAddI8LongDoubleP,                         \
+  const volatile long double*: fhtAddI8LongDoubleP,                         \
+  List:                  fhtAddI8List,                                \
+  List*:                 fhtAddI8ListP,                               \
+  const volatile List*:  fhtAddI8ListP,                               \
+  Queue:                 fhtAddI8Queue,                               \
+  Queue*:                fhtAddI8QueueP,                              \
+  const volatile Queue*: fhtAddI8QueueP,                              \
+  Stack:                 fhtAddI8Stack,                               \
+  Stack*:                fhtAddI8StackP,                              \
+  const volatile Stack*: fhtAddI8StackP,                              \
+  RedBlackTree:          fhtAddI8RedBlackTree,                        \
+  RedBlackTree*:         fhtAddI8RedBlackTreeP,                       \
+  const volatile RedBlackTree*: fhtAddI8RedBlackTreeP,                       \
+  HashTable:             fhtAddI8HashTable,                           \
+  HashTable*:            fhtAddI8HashTableP,                          \
+  const volatile HashTable*: fhtAddI8HashTableP,                          \
+  Vector:                fhtAddI8Vector,                              \
+  Vector*:               fhtAddI8VectorP,                             \
+  const volatile Vector*: fhtAddI8VectorP,                             \
+  char*:                 fhtAddI8String,                              \
+  const volatile char*:  fhtAddI8String,                              \
+  char**:                fhtAddI8StringP,                             \
+  const volatile char**: fhtAddI8StringP,                             \
+  Bytes:                 fhtAddI8Bytes,                               \
+  Bytes*:                fhtAddI8BytesP,                              \
+  const volatile Bytes*: fhtAddI8BytesP,                              \
+  void*:                 fhtAddI8Pointer,                             \
+  void**:                fhtAddI8PointerP,                            \
+  const volatile void**: fhtAddI8PointerP,                            \
+  i8:                    fhtAddI8I8,                                  \
+  u8:                    fhtAddI8U8                                   \
+
+#define fhtAddI8(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_I8_KEY(dataStructure, key, value) \
+  )
+
+
+#define FHT_ADD_GENERIC_CASES_U8_KEY(dataStructure, key, value) \
+  bool:                  fhtAddU8Bool,                                \
+  bool*:                 fhtAddU8BoolP,                               \
+  const volatile bool*:  fhtAddU8BoolP,                               \
+  i16:                   fhtAddU8I16,                                 \
+  i16*:                  fhtAddU8I16P,                                \
+  const volatile i16*:   fhtAddU8I16P,                                \
+  u16:                   fhtAddU8U16,                                 \
+  u16*:                  fhtAddU8U16P,                                \
+  const volatile u16*:   fhtAddU8U16P,                                \
+  i32:                   fhtAddU8I32,                                 \
+  i32*:                  fhtAddU8I32P,                                \
+  const volatile i32*:   fhtAddU8I32P,                                \
+  u32:                   fhtAddU8U32,                                 \
+  u32*:                  fhtAddU8U32P,                                \
+  const volatile u32*:   fhtAddU8U32P,                                \
+  i64:                   fhtAddU8I64,                                 \
+  i64*:                  fhtAddU8I64P,                                \
+  const volatile i64*:   fhtAddU8I64P,                                \
+  u64:                   fhtAddU8U64,                                 \
+  u64*:                  fhtAddU8U64P,                                \
+  const volatile u64*:   fhtAddU8U64P,                                \
+  float:                 fhtAddU8Float,                               \
+  float*:                fhtAddU8FloatP,                              \
+  const volatile float*: fhtAddU8FloatP,                              \
+  double:                fhtAddU8Double,                              \
+  double*:               fhtAddU8DoubleP,                             \
+  const volatile double*: fhtAddU8DoubleP,                             \
+  long double:           fhtAddU8LongDouble,                          \
+  long double*:          fhtAddU8LongDoubleP,                         \
+  const volatile long double*: fhtAddU8LongDoubleP,                         \
+  List:                  fhtAddU8List,                                \
+  List*:                 fhtAddU8ListP,                               \
+  const volatile List*:  fhtAddU8ListP,                               \
+  Queue:                 fhtAddU8Queue,                               \
+  Queue*:                fhtAddU8QueueP,                              \
+  const volatile Queue*: fhtAddU8QueueP,                              \
+  Stack:                 fhtAddU8Stack,                               \
+  Stack*:                fhtAddU8StackP,                              \
+  const volatile Stack*: fhtAddU8StackP,                              \
+  RedBlackTree:          fhtAddU8RedBlackTree,                        \
+  RedBlackTree*:         fhtAddU8RedBlackTreeP,                       \
+  const volatile RedBlackTree*: fhtAddU8RedBlackTreeP,                       \
+  HashTable:             fhtAddU8HashTable,                           \
+  HashTable*:            fhtAddU8HashTableP,                          \
+  const volatile HashTable*: fhtAddU8HashTableP,                          \
+  Vector:                fhtAddU8Vector,                              \
+  Vector*:               fhtAddU8VectorP,                             \
+  const volatile Vector*: fhtAddU8VectorP,                             \
+  char*:                 fhtAddU8String,                              \
+  const volatile char*:  fhtAddU8String,                              \
+  char**:                fhtAddU8StringP,                             \
+  const volatile char**: fhtAddU8StringP,                             \
+  Bytes:                 fhtAddU8Bytes,                               \
+  Bytes*:                fhtAddU8BytesP,                              \
+  const volatile Bytes*: fhtAddU8BytesP,                              \
+  void*:                 fhtAddU8Pointer,                             \
+  void**:                fhtAddU8PointerP,                            \
+  const volatile void**: fhtAddU8PointerP,                            \
+  i8:                    fhtAddU8I8,                                  \
+  u8:                    fhtAddU8U8                                   \
+
+#define fhtAddU8(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_U8_KEY(dataStructure, key, value) \
+  )
+
+
+#define FHT_ADD_GENERIC_CASES_BOOLP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddBoolPBool,                             \
+  bool*:                 fhtAddBoolPBoolP,                            \
+  const volatile bool*:  fhtAddBoolPBoolP,                            \
+  i16:                   fhtAddBoolPI16,                              \
+  i16*:                  fhtAddBoolPI16P,                             \
+  const volatile i16*:   fhtAddBoolPI16P,                             \
+  u16:                   fhtAddBoolPU16,                              \
+  u16*:                  fhtAddBoolPU16P,                             \
+  const volatile u16*:   fhtAddBoolPU16P,                             \
+  i32:                   fhtAddBoolPI32,                              \
+  i32*:                  fhtAddBoolPI32P,                             \
+  const volatile i32*:   fhtAddBoolPI32P,                             \
+  u32:                   fhtAddBoolPU32,                              \
+  u32*:                  fhtAddBoolPU32P,                             \
+  const volatile u32*:   fhtAddBoolPU32P,                             \
+  i64:                   fhtAddBoolPI64,                              \
+  i64*:                  fhtAddBoolPI64P,                             \
+  const volatile i64*:   fhtAddBoolPI64P,                             \
+  u64:                   fhtAddBoolPU64,                              \
+  u64*:                  fhtAddBoolPU64P,                             \
+  const volatile u64*:   fhtAddBoolPU64P,                             \
+  float:                 fhtAddBoolPFloat,                            \
+  float*:                fhtAddBoolPFloatP,                           \
+  const volatile float*: fhtAddBoolPFloatP,                           \
+  double:                fhtAddBoolPDouble,                           \
+  double*:               fhtAddBoolPDoubleP,                          \
+  const volatile double*: fhtAddBoolPDoubleP,                          \
+  long double:           fhtAddBoolPLongDouble,                       \
+  long double*:          fhtAddBoolPLongDoubleP,                      \
+  const volatile long double*: fhtAddBoolPLongDoubleP,                      \
+  List:                  fhtAddBoolPList,                             \
+  List*:                 fhtAddBoolPListP,                            \
+  const volatile List*:  fhtAddBoolPListP,                            \
+  Queue:                 fhtAddBoolPQueue,                            \
+  Queue*:                fhtAddBoolPQueueP,                           \
+  const volatile Queue*: fhtAddBoolPQueueP,                           \
+  Stack:                 fhtAddBoolPStack,                            \
+  Stack*:                fhtAddBoolPStackP,                           \
+  const volatile Stack*: fhtAddBoolPStackP,                           \
+  RedBlackTree:          fhtAddBoolPRedBlackTree,                     \
+  RedBlackTree*:         fhtAddBoolPRedBlackTreeP,                    \
+  const volatile RedBlackTree*: fhtAddBoolPRedBlackTreeP,                    \
+  HashTable:             fhtAddBoolPHashTable,                        \
+  HashTable*:            fhtAddBoolPHashTableP,                       \
+  const volatile HashTable*: fhtAddBoolPHashTableP,                       \
+  Vector:                fhtAddBoolPVector,                           \
+  Vector*:               fhtAddBoolPVectorP,                          \
+  const volatile Vector*: fhtAddBoolPVectorP,                          \
+  char*:                 fhtAddBoolPString,                           \
+  const volatile char*:  fhtAddBoolPString,                           \
+  char**:                fhtAddBoolPStringP,                          \
+  const volatile char**: fhtAddBoolPStringP,                          \
+  Bytes:                 fhtAddBoolPBytes,                            \
+  Bytes*:                fhtAddBoolPBytesP,                           \
+  const volatile Bytes*: fhtAddBoolPBytesP,                           \
+  void*:                 fhtAddBoolPPointer,                          \
+  void**:                fhtAddBoolPPointerP,                         \
+  const volatile void**: fhtAddBoolPPointerP,                         \
+  i8:                    fhtAddBoolI8,                                \
+  u8:                    fhtAddBoolU8                                 \
+
+#define fhtAddBoolP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_BOOLP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_I16P_KEY(dataStructure, key, value) \
+  bool:                  fhtAddI16PBool,                              \
+  bool*:                 fhtAddI16PBoolP,                             \
+  const volatile bool*:  fhtAddI16PBoolP,                             \
+  i16:                   fhtAddI16PI16,                               \
+  i16*:                  fhtAddI16PI16P,                              \
+  const volatile i16*:   fhtAddI16PI16P,                              \
+  u16:                   fhtAddI16PU16,                               \
+  u16*:                  fhtAddI16PU16P,                              \
+  const volatile u16*:   fhtAddI16PU16P,                              \
+  i32:                   fhtAddI16PI32,                               \
+  i32*:                  fhtAddI16PI32P,                              \
+  const volatile i32*:   fhtAddI16PI32P,                              \
+  u32:                   fhtAddI16PU32,                               \
+  u32*:                  fhtAddI16PU32P,                              \
+  const volatile u32*:   fhtAddI16PU32P,                              \
+  i64:                   fhtAddI16PI64,                               \
+  i64*:                  fhtAddI16PI64P,                              \
+  const volatile i64*:   fhtAddI16PI64P,                              \
+  u64:                   fhtAddI16PU64,                               \
+  u64*:                  fhtAddI16PU64P,                              \
+  const volatile u64*:   fhtAddI16PU64P,                              \
+  float:                 fhtAddI16PFloat,                             \
+  float*:                fhtAddI16PFloatP,                            \
+  const volatile float*: fhtAddI16PFloatP,                            \
+  double:                fhtAddI16PDouble,                            \
+  double*:               fhtAddI16PDoubleP,                           \
+  const volatile double*: fhtAddI16PDoubleP,                           \
+  long double:           fhtAddI16PLongDouble,                        \
+  long double*:          fhtAddI16PLongDoubleP,                       \
+  const volatile long double*: fhtAddI16PLongDoubleP,                       \
+  List:                  fhtAddI16PList,                              \
+  List*:                 fhtAddI16PListP,                             \
+  const volatile List*:  fhtAddI16PListP,                             \
+  Queue:                 fhtAddI16PQueue,                             \
+  Queue*:                fhtAddI16PQueueP,                            \
+  const volatile Queue*: fhtAddI16PQueueP,                            \
+  Stack:                 fhtAddI16PStack,                             \
+  Stack*:                fhtAddI16PStackP,                            \
+  const volatile Stack*: fhtAddI16PStackP,                            \
+  RedBlackTree:          fhtAddI16PRedBlackTree,                      \
+  RedBlackTree*:         fhtAddI16PRedBlackTreeP,                     \
+  const volatile RedBlackTree*: fhtAddI16PRedBlackTreeP,                     \
+  HashTable:             fhtAddI16PHashTable,                         \
+  HashTable*:            fhtAddI16PHashTableP,                        \
+  const volatile HashTable*: fhtAddI16PHashTableP,                        \
+  Vector:                fhtAddI16PVector,                            \
+  Vector*:               fhtAddI16PVectorP,                           \
+  const volatile Vector*: fhtAddI16PVectorP,                           \
+  char*:                 fhtAddI16PString,                            \
+  const volatile char*:  fhtAddI16PString,                            \
+  char**:                fhtAddI16PStringP,                           \
+  const volatile char**: fhtAddI16PStringP,                           \
+  Bytes:                 fhtAddI16PBytes,                             \
+  Bytes*:                fhtAddI16PBytesP,                            \
+  const volatile Bytes*: fhtAddI16PBytesP,                            \
+  void*:                 fhtAddI16PPointer,                           \
+  void**:                fhtAddI16PPointerP,                          \
+  const volatile void**: fhtAddI16PPointerP,                          \
+  i8:                    fhtAddI16I8,                                 \
+  u8:                    fhtAddI16U8                                  \
+
+#define fhtAddI16P(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_I16P_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_U16P_KEY(dataStructure, key, value) \
+  bool:                  fhtAddU16PBool,                              \
+  bool*:                 fhtAddU16PBoolP,                             \
+  const volatile bool*:  fhtAddU16PBoolP,                             \
+  i16:                   fhtAddU16PI16,                               \
+  i16*:                  fhtAddU16PI16P,                              \
+  const volatile i16*:   fhtAddU16PI16P,                              \
+  u16:                   fhtAddU16PU16,                               \
+  u16*:                  fhtAddU16PU16P,                              \
+  const volatile u16*:   fhtAddU16PU16P,                              \
+  i32:                   fhtAddU16PI32,                               \
+  i32*:                  fhtAddU16PI32P,                              \
+  const volatile i32*:   fhtAddU16PI32P,                              \
+  u32:                   fhtAddU16PU32,                               \
+  u32*:                  fhtAddU16PU32P,                              \
+  const volatile u32*:   fhtAddU16PU32P,                              \
+  i64:                   fhtAddU16PI64,                               \
+  i64*:                  fhtAddU16PI64P,                              \
+  const volatile i64*:   fhtAddU16PI64P,                              \
+  u64:                   fhtAddU16PU64,                               \
+  u64*:                  fhtAddU16PU64P,                              \
+  const volatile u64*:   fhtAddU16PU64P,                              \
+  float:                 fhtAddU16PFloat,                             \
+  float*:                fhtAddU16PFloatP,                            \
+  const volatile float*: fhtAddU16PFloatP,                            \
+  double:                fhtAddU16PDouble,                            \
+  double*:               fhtAddU16PDoubleP,                           \
+  const volatile double*: fhtAddU16PDoubleP,                           \
+  long double:           fhtAddU16PLongDouble,                        \
+  long double*:          fhtAddU16PLongDoubleP,                       \
+  const volatile long double*: fhtAddU16PLongDoubleP,                       \
+  List:                  fhtAddU16PList,                              \
+  List*:                 fhtAddU16PListP,                             \
+  const volatile List*:  fhtAddU16PListP,                             \
+  Queue:                 fhtAddU16PQueue,                             \
+  Queue*:                fhtAddU16PQueueP,                            \
+  const volatile Queue*: fhtAddU16PQueueP,                            \
+  Stack:                 fhtAddU16PStack,                             \
+  Stack*:                fhtAddU16PStackP,                            \
+  const volatile Stack*: fhtAddU16PStackP,                            \
+  RedBlackTree:          fhtAddU16PRedBlackTree,                      \
+  RedBlackTree*:         fhtAddU16PRedBlackTreeP,                     \
+  const volatile RedBlackTree*: fhtAddU16PRedBlackTreeP,                     \
+  HashTable:             fhtAddU16PHashTable,                         \
+  HashTable*:            fhtAddU16PHashTableP,                        \
+  const volatile HashTable*: fhtAddU16PHashTableP,                        \
+  Vector:                fhtAddU16PVector,                            \
+  Vector*:               fhtAddU16PVectorP,                           \
+  const volatile Vector*: fhtAddU16PVectorP,                           \
+  char*:                 fhtAddU16PString,                            \
+  const volatile char*:  fhtAddU16PString,                            \
+  char**:                fhtAddU16PStringP,                           \
+  const volatile char**: fhtAddU16PStringP,                           \
+  Bytes:                 fhtAddU16PBytes,                             \
+  Bytes*:                fhtAddU16PBytesP,                            \
+  const volatile Bytes*: fhtAddU16PBytesP,                            \
+  void*:                 fhtAddU16PPointer,                           \
+  void**:                fhtAddU16PPointerP,                          \
+  const volatile void**: fhtAddU16PPointerP,                          \
+  i8:                    fhtAddU16I8,                                 \
+  u8:                    fhtAddU16U8                                  \
+
+#define fhtAddU16P(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_U16P_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_I32P_KEY(dataStructure, key, value) \
+  bool:                  fhtAddI32PBool,                              \
+  bool*:                 fhtAddI32PBoolP,                             \
+  const volatile bool*:  fhtAddI32PBoolP,                             \
+  i16:                   fhtAddI32PI16,                               \
+  i16*:                  fhtAddI32PI16P,                              \
+  const volatile i16*:   fhtAddI32PI16P,                              \
+  u16:                   fhtAddI32PU16,                               \
+  u16*:                  fhtAddI32PU16P,                              \
+  const volatile u16*:   fhtAddI32PU16P,                              \
+  i32:                   fhtAddI32PI32,                               \
+  i32*:                  fhtAddI32PI32P,                              \
+  const volatile i32*:   fhtAddI32PI32P,                              \
+  u32:                   fhtAddI32PU32,                               \
+  u32*:                  fhtAddI32PU32P,                              \
+  const volatile u32*:   fhtAddI32PU32P,                              \
+  i64:                   fhtAddI32PI64,                               \
+  i64*:                  fhtAddI32PI64P,                              \
+  const volatile i64*:   fhtAddI32PI64P,                              \
+  u64:                   fhtAddI32PU64,                               \
+  u64*:                  fhtAddI32PU64P,                              \
+  const volatile u64*:   fhtAddI32PU64P,                              \
+  float:                 fhtAddI32PFloat,                             \
+  float*:                fhtAddI32PFloatP,                            \
+  const volatile float*: fhtAddI32PFloatP,                            \
+  double:                fhtAddI32PDouble,                            \
+  double*:               fhtAddI32PDoubleP,                           \
+  const volatile double*: fhtAddI32PDoubleP,                           \
+  long double:           fhtAddI32PLongDouble,                        \
+  long double*:          fhtAddI32PLongDoubleP,                       \
+  const volatile long double*: fhtAddI32PLongDoubleP,                       \
+  List:                  fhtAddI32PList,                              \
+  List*:                 fhtAddI32PListP,                             \
+  const volatile List*:  fhtAddI32PListP,                             \
+  Queue:                 fhtAddI32PQueue,                             \
+  Queue*:                fhtAddI32PQueueP,                            \
+  const volatile Queue*: fhtAddI32PQueueP,                            \
+  Stack:                 fhtAddI32PStack,                             \
+  Stack*:                fhtAddI32PStackP,                            \
+  const volatile Stack*: fhtAddI32PStackP,                            \
+  RedBlackTree:          fhtAddI32PRedBlackTree,                      \
+  RedBlackTree*:         fhtAddI32PRedBlackTreeP,                     \
+  const volatile RedBlackTree*: fhtAddI32PRedBlackTreeP,                     \
+  HashTable:             fhtAddI32PHashTable,                         \
+  HashTable*:            fhtAddI32PHashTableP,                        \
+  const volatile HashTable*: fhtAddI32PHashTableP,                        \
+  Vector:                fhtAddI32PVector,                            \
+  Vector*:               fhtAddI32PVectorP,                           \
+  const volatile Vector*: fhtAddI32PVectorP,                           \
+  char*:                 fhtAddI32PString,                            \
+  const volatile char*:  fhtAddI32PString,                            \
+  char**:                fhtAddI32PStringP,                           \
+  const volatile char**: fhtAddI32PStringP,                           \
+  Bytes:                 fhtAddI32PBytes,                             \
+  Bytes*:                fhtAddI32PBytesP,                            \
+  const volatile Bytes*: fhtAddI32PBytesP,                            \
+  void*:                 fhtAddI32PPointer,                           \
+  void**:                fhtAddI32PPointerP,                          \
+  const volatile void**: fhtAddI32PPointerP,                          \
+  i8:                    fhtAddI32I8,                                 \
+  u8:                    fhtAddI32U8                                  \
+
+#define fhtAddI32P(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_I32P_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_U32P_KEY(dataStructure, key, value) \
+  bool:                  fhtAddU32PBool,                              \
+  bool*:                 fhtAddU32PBoolP,                             \
+  const volatile bool*:  fhtAddU32PBoolP,                             \
+  i16:                   fhtAddU32PI16,                               \
+  i16*:                  fhtAddU32PI16P,                              \
+  const volatile i16*:   fhtAddU32PI16P,                              \
+  u16:                   fhtAddU32PU16,                               \
+  u16*:                  fhtAddU32PU16P,                              \
+  const volatile u16*:   fhtAddU32PU16P,                              \
+  i32:                   fhtAddU32PI32,                               \
+  i32*:                  fhtAddU32PI32P,                              \
+  const volatile i32*:   fhtAddU32PI32P,                              \
+  u32:                   fhtAddU32PU32,                               \
+  u32*:                  fhtAddU32PU32P,                              \
+  const volatile u32*:   fhtAddU32PU32P,                              \
+  i64:                   fhtAddU32PI64,                               \
+  i64*:                  fhtAddU32PI64P,                              \
+  const volatile i64*:   fhtAddU32PI64P,                              \
+  u64:                   fhtAddU32PU64,                               \
+  u64*:                  fhtAddU32PU64P,                              \
+  const volatile u64*:   fhtAddU32PU64P,                              \
+  float:                 fhtAddU32PFloat,                             \
+  float*:                fhtAddU32PFloatP,                            \
+  const volatile float*: fhtAddU32PFloatP,                            \
+  double:                fhtAddU32PDouble,                            \
+  double*:               fhtAddU32PDoubleP,                           \
+  const volatile double*: fhtAddU32PDoubleP,                           \
+  long double:           fhtAddU32PLongDouble,                        \
+  long double*:          fhtAddU32PLongDoubleP,                       \
+  const volatile long double*: fhtAddU32PLongDoubleP,                       \
+  List:                  fhtAddU32PList,                              \
+  List*:                 fhtAddU32PListP,                             \
+  const volatile List*:  fhtAddU32PListP,                             \
+  Queue:                 fhtAddU32PQueue,                             \
+  Queue*:                fhtAddU32PQueueP,                            \
+  const volatile Queue*: fhtAddU32PQueueP,                            \
+  Stack:                 fhtAddU32PStack,                             \
+  Stack*:                fhtAddU32PStackP,                            \
+  const volatile Stack*: fhtAddU32PStackP,                            \
+  RedBlackTree:          fhtAddU32PRedBlackTree,                      \
+  RedBlackTree*:         fhtAddU32PRedBlackTreeP,                     \
+  const volatile RedBlackTree*: fhtAddU32PRedBlackTreeP,                     \
+  HashTable:             fhtAddU32PHashTable,                         \
+  HashTable*:            fhtAddU32PHashTableP,                        \
+  const volatile HashTable*: fhtAddU32PHashTableP,                        \
+  Vector:                fhtAddU32PVector,                            \
+  Vector*:               fhtAddU32PVectorP,                           \
+  const volatile Vector*: fhtAddU32PVectorP,                           \
+  char*:                 fhtAddU32PString,                            \
+  const volatile char*:  fhtAddU32PString,                            \
+  char**:                fhtAddU32PStringP,                           \
+  const volatile char**: fhtAddU32PStringP,                           \
+  Bytes:                 fhtAddU32PBytes,                             \
+  Bytes*:                fhtAddU32PBytesP,                            \
+  const volatile Bytes*: fhtAddU32PBytesP,                            \
+  void*:                 fhtAddU32PPointer,                           \
+  void**:                fhtAddU32PPointerP,                          \
+  const volatile void**: fhtAddU32PPointerP,                          \
+  i8:                    fhtAddU32I8,                                 \
+  u8:                    fhtAddU32U8                                  \
+
+#define fhtAddU32P(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_U32P_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_I64P_KEY(dataStructure, key, value) \
+  bool:                  fhtAddI64PBool,                              \
+  bool*:                 fhtAddI64PBoolP,                             \
+  const volatile bool*:  fhtAddI64PBoolP,                             \
+  i16:                   fhtAddI64PI16,                               \
+  i16*:                  fhtAddI64PI16P,                              \
+  const volatile i16*:   fhtAddI64PI16P,                              \
+  u16:                   fhtAddI64PU16,                               \
+  u16*:                  fhtAddI64PU16P,                              \
+  const volatile u16*:   fhtAddI64PU16P,                              \
+  i32:                   fhtAddI64PI32,                               \
+  i32*:                  fhtAddI64PI32P,                              \
+  const volatile i32*:   fhtAddI64PI32P,                              \
+  u32:                   fhtAddI64PU32,                               \
+  u32*:                  fhtAddI64PU32P,                              \
+  const volatile u32*:   fhtAddI64PU32P,                              \
+  i64:                   fhtAddI64PI64,                               \
+  i64*:                  fhtAddI64PI64P,                              \
+  const volatile i64*:   fhtAddI64PI64P,                              \
+  u64:                   fhtAddI64PU64,                               \
+  u64*:                  fhtAddI64PU64P,                              \
+  const volatile u64*:   fhtAddI64PU64P,                              \
+  float:                 fhtAddI64PFloat,                             \
+  float*:                fhtAddI64PFloatP,                            \
+  const volatile float*: fhtAddI64PFloatP,                            \
+  double:                fhtAddI64PDouble,                            \
+  double*:               fhtAddI64PDoubleP,                           \
+  const volatile double*: fhtAddI64PDoubleP,                           \
+  long double:           fhtAddI64PLongDouble,                        \
+  long double*:          fhtAddI64PLongDoubleP,                       \
+  const volatile long double*: fhtAddI64PLongDoubleP,                       \
+  List:                  fhtAddI64PList,                              \
+  List*:                 fhtAddI64PListP,                             \
+  const volatile List*:  fhtAddI64PListP,                             \
+  Queue:                 fhtAddI64PQueue,                             \
+  Queue*:                fhtAddI64PQueueP,                            \
+  const volatile Queue*: fhtAddI64PQueueP,                            \
+  Stack:                 fhtAddI64PStack,                             \
+  Stack*:                fhtAddI64PStackP,                            \
+  const volatile Stack*: fhtAddI64PStackP,                            \
+  RedBlackTree:          fhtAddI64PRedBlackTree,                      \
+  RedBlackTree*:         fhtAddI64PRedBlackTreeP,                     \
+  const volatile RedBlackTree*: fhtAddI64PRedBlackTreeP,                     \
+  HashTable:             fhtAddI64PHashTable,                         \
+  HashTable*:            fhtAddI64PHashTableP,                        \
+  const volatile HashTable*: fhtAddI64PHashTableP,                        \
+  Vector:                fhtAddI64PVector,                            \
+  Vector*:               fhtAddI64PVectorP,                           \
+  const volatile Vector*: fhtAddI64PVectorP,                           \
+  char*:                 fhtAddI64PString,                            \
+  const volatile char*:  fhtAddI64PString,                            \
+  char**:                fhtAddI64PStringP,                           \
+  const volatile char**: fhtAddI64PStringP,                           \
+  Bytes:                 fhtAddI64PBytes,                             \
+  Bytes*:                fhtAddI64PBytesP,                            \
+  const volatile Bytes*: fhtAddI64PBytesP,                            \
+  void*:                 fhtAddI64PPointer,                           \
+  void**:                fhtAddI64PPointerP,                          \
+  const volatile void**: fhtAddI64PPointerP,                          \
+  i8:                    fhtAddI64I8,                                 \
+  u8:                    fhtAddI64U8                                  \
+
+#define fhtAddI64P(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_I64P_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_U64P_KEY(dataStructure, key, value) \
+  bool:                  fhtAddU64PBool,                              \
+  bool*:                 fhtAddU64PBoolP,                             \
+  const volatile bool*:  fhtAddU64PBoolP,                             \
+  i16:                   fhtAddU64PI16,                               \
+  i16*:                  fhtAddU64PI16P,                              \
+  const volatile i16*:   fhtAddU64PI16P,                              \
+  u16:                   fhtAddU64PU16,                               \
+  u16*:                  fhtAddU64PU16P,                              \
+  const volatile u16*:   fhtAddU64PU16P,                              \
+  i32:                   fhtAddU64PI32,                               \
+  i32*:                  fhtAddU64PI32P,                              \
+  const volatile i32*:   fhtAddU64PI32P,                              \
+  u32:                   fhtAddU64PU32,                               \
+  u32*:                  fhtAddU64PU32P,                              \
+  const volatile u32*:   fhtAddU64PU32P,                              \
+  i64:                   fhtAddU64PI64,                               \
+  i64*:                  fhtAddU64PI64P,                              \
+  const volatile i64*:   fhtAddU64PI64P,                              \
+  u64:                   fhtAddU64PU64,                               \
+  u64*:                  fhtAddU64PU64P,                              \
+  const volatile u64*:   fhtAddU64PU64P,                              \
+  float:                 fhtAddU64PFloat,                             \
+  float*:                fhtAddU64PFloatP,                            \
+  const volatile float*: fhtAddU64PFloatP,                            \
+  double:                fhtAddU64PDouble,                            \
+  double*:               fhtAddU64PDoubleP,                           \
+  const volatile double*: fhtAddU64PDoubleP,                           \
+  long double:           fhtAddU64PLongDouble,                        \
+  long double*:          fhtAddU64PLongDoubleP,                       \
+  const volatile long double*: fhtAddU64PLongDoubleP,                       \
+  List:                  fhtAddU64PList,                              \
+  List*:                 fhtAddU64PListP,                             \
+  const volatile List*:  fhtAddU64PListP,                             \
+  Queue:                 fhtAddU64PQueue,                             \
+  Queue*:                fhtAddU64PQueueP,                            \
+  const volatile Queue*: fhtAddU64PQueueP,                            \
+  Stack:                 fhtAddU64PStack,                             \
+  Stack*:                fhtAddU64PStackP,                            \
+  const volatile Stack*: fhtAddU64PStackP,                            \
+  RedBlackTree:          fhtAddU64PRedBlackTree,                      \
+  RedBlackTree*:         fhtAddU64PRedBlackTreeP,                     \
+  const volatile RedBlackTree*: fhtAddU64PRedBlackTreeP,                     \
+  HashTable:             fhtAddU64PHashTable,                         \
+  HashTable*:            fhtAddU64PHashTableP,                        \
+  const volatile HashTable*: fhtAddU64PHashTableP,                        \
+  Vector:                fhtAddU64PVector,                            \
+  Vector*:               fhtAddU64PVectorP,                           \
+  const volatile Vector*: fhtAddU64PVectorP,                           \
+  char*:                 fhtAddU64PString,                            \
+  const volatile char*:  fhtAddU64PString,                            \
+  char**:                fhtAddU64PStringP,                           \
+  const volatile char**: fhtAddU64PStringP,                           \
+  Bytes:                 fhtAddU64PBytes,                             \
+  Bytes*:                fhtAddU64PBytesP,                            \
+  const volatile Bytes*: fhtAddU64PBytesP,                            \
+  void*:                 fhtAddU64PPointer,                           \
+  void**:                fhtAddU64PPointerP,                          \
+  const volatile void**: fhtAddU64PPointerP,                          \
+  i8:                    fhtAddU64I8,                                 \
+  u8:                    fhtAddU64U8                                  \
+
+#define fhtAddU64P(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_U64P_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_FLOATP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddFloatPBool,                            \
+  bool*:                 fhtAddFloatPBoolP,                           \
+  const volatile bool*:  fhtAddFloatPBoolP,                           \
+  i16:                   fhtAddFloatPI16,                             \
+  i16*:                  fhtAddFloatPI16P,                            \
+  const volatile i16*:   fhtAddFloatPI16P,                            \
+  u16:                   fhtAddFloatPU16,                             \
+  u16*:                  fhtAddFloatPU16P,                            \
+  const volatile u16*:   fhtAddFloatPU16P,                            \
+  i32:                   fhtAddFloatPI32,                             \
+  i32*:                  fhtAddFloatPI32P,                            \
+  const volatile i32*:   fhtAddFloatPI32P,                            \
+  u32:                   fhtAddFloatPU32,                             \
+  u32*:                  fhtAddFloatPU32P,                            \
+  const volatile u32*:   fhtAddFloatPU32P,                            \
+  i64:                   fhtAddFloatPI64,                             \
+  i64*:                  fhtAddFloatPI64P,                            \
+  const volatile i64*:   fhtAddFloatPI64P,                            \
+  u64:                   fhtAddFloatPU64,                             \
+  u64*:                  fhtAddFloatPU64P,                            \
+  const volatile u64*:   fhtAddFloatPU64P,                            \
+  float:                 fhtAddFloatPFloat,                           \
+  float*:                fhtAddFloatPFloatP,                          \
+  const volatile float*: fhtAddFloatPFloatP,                          \
+  double:                fhtAddFloatPDouble,                          \
+  double*:               fhtAddFloatPDoubleP,                         \
+  const volatile double*: fhtAddFloatPDoubleP,                         \
+  long double:           fhtAddFloatPLongDouble,                      \
+  long double*:          fhtAddFloatPLongDoubleP,                     \
+  const volatile long double*: fhtAddFloatPLongDoubleP,                     \
+  List:                  fhtAddFloatPList,                            \
+  List*:                 fhtAddFloatPListP,                           \
+  const volatile List*:  fhtAddFloatPListP,                           \
+  Queue:                 fhtAddFloatPQueue,                           \
+  Queue*:                fhtAddFloatPQueueP,                          \
+  const volatile Queue*: fhtAddFloatPQueueP,                          \
+  Stack:                 fhtAddFloatPStack,                           \
+  Stack*:                fhtAddFloatPStackP,                          \
+  const volatile Stack*: fhtAddFloatPStackP,                          \
+  RedBlackTree:          fhtAddFloatPRedBlackTree,                    \
+  RedBlackTree*:         fhtAddFloatPRedBlackTreeP,                   \
+  const volatile RedBlackTree*: fhtAddFloatPRedBlackTreeP,                   \
+  HashTable:             fhtAddFloatPHashTable,                       \
+  HashTable*:            fhtAddFloatPHashTableP,                      \
+  const volatile HashTable*: fhtAddFloatPHashTableP,                      \
+  Vector:                fhtAddFloatPVector,                          \
+  Vector*:               fhtAddFloatPVectorP,                         \
+  const volatile Vector*: fhtAddFloatPVectorP,                         \
+  char*:                 fhtAddFloatPString,                          \
+  const volatile char*:  fhtAddFloatPString,                          \
+  char**:                fhtAddFloatPStringP,                         \
+  const volatile char**: fhtAddFloatPStringP,                         \
+  Bytes:                 fhtAddFloatPBytes,                           \
+  Bytes*:                fhtAddFloatPBytesP,                          \
+  const volatile Bytes*: fhtAddFloatPBytesP,                          \
+  void*:                 fhtAddFloatPPointer,                         \
+  void**:                fhtAddFloatPPointerP,                        \
+  const volatile void**: fhtAddFloatPPointerP,                        \
+  i8:                    fhtAddFloatI8,                               \
+  u8:                    fhtAddFloatU8                                \
+
+#define fhtAddFloatP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_FLOATP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_DOUBLEP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddDoublePBool,                           \
+  bool*:                 fhtAddDoublePBoolP,                          \
+  const volatile bool*:  fhtAddDoublePBoolP,                          \
+  i16:                   fhtAddDoublePI16,                            \
+  i16*:                  fhtAddDoublePI16P,                           \
+  const volatile i16*:   fhtAddDoublePI16P,                           \
+  u16:                   fhtAddDoublePU16,                            \
+  u16*:                  fhtAddDoublePU16P,                           \
+  const volatile u16*:   fhtAddDoublePU16P,                           \
+  i32:                   fhtAddDoublePI32,                            \
+  i32*:                  fhtAddDoublePI32P,                           \
+  const volatile i32*:   fhtAddDoublePI32P,                           \
+  u32:                   fhtAddDoublePU32,                            \
+  u32*:                  fhtAddDoublePU32P,                           \
+  const volatile u32*:   fhtAddDoublePU32P,                           \
+  i64:                   fhtAddDoublePI64,                            \
+  i64*:                  fhtAddDoublePI64P,                           \
+  const volatile i64*:   fhtAddDoublePI64P,                           \
+  u64:                   fhtAddDoublePU64,                            \
+  u64*:                  fhtAddDoublePU64P,                           \
+  const volatile u64*:   fhtAddDoublePU64P,                           \
+  float:                 fhtAddDoublePFloat,                          \
+  float*:                fhtAddDoublePFloatP,                         \
+  const volatile float*: fhtAddDoublePFloatP,                         \
+  double:                fhtAddDoublePDouble,                         \
+  double*:               fhtAddDoublePDoubleP,                        \
+  const volatile double*: fhtAddDoublePDoubleP,                        \
+  long double:           fhtAddDoublePLongDouble,                     \
+  long double*:          fhtAddDoublePLongDoubleP,                    \
+  const volatile long double*: fhtAddDoublePLongDoubleP,                    \
+  List:                  fhtAddDoublePList,                           \
+  List*:                 fhtAddDoublePListP,                          \
+  const volatile List*:  fhtAddDoublePListP,                          \
+  Queue:                 fhtAddDoublePQueue,                          \
+  Queue*:                fhtAddDoublePQueueP,                         \
+  const volatile Queue*: fhtAddDoublePQueueP,                         \
+  Stack:                 fhtAddDoublePStack,                          \
+  Stack*:                fhtAddDoublePStackP,                         \
+  const volatile Stack*: fhtAddDoublePStackP,                         \
+  RedBlackTree:          fhtAddDoublePRedBlackTree,                   \
+  RedBlackTree*:         fhtAddDoublePRedBlackTreeP,                  \
+  const volatile RedBlackTree*: fhtAddDoublePRedBlackTreeP,                  \
+  HashTable:             fhtAddDoublePHashTable,                      \
+  HashTable*:            fhtAddDoublePHashTableP,                     \
+  const volatile HashTable*: fhtAddDoublePHashTableP,                     \
+  Vector:                fhtAddDoublePVector,                         \
+  Vector*:               fhtAddDoublePVectorP,                        \
+  const volatile Vector*: fhtAddDoublePVectorP,                        \
+  char*:                 fhtAddDoublePString,                         \
+  const volatile char*:  fhtAddDoublePString,                         \
+  char**:                fhtAddDoublePStringP,                        \
+  const volatile char**: fhtAddDoublePStringP,                        \
+  Bytes:                 fhtAddDoublePBytes,                          \
+  Bytes*:                fhtAddDoublePBytesP,                         \
+  const volatile Bytes*: fhtAddDoublePBytesP,                         \
+  void*:                 fhtAddDoublePPointer,                        \
+  void**:                fhtAddDoublePPointerP,                       \
+  const volatile void**: fhtAddDoublePPointerP,                       \
+  i8:                    fhtAddDoubleI8,                              \
+  u8:                    fhtAddDoubleU8                               \
+
+#define fhtAddDoubleP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_DOUBLEP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_LONG_DOUBLEP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddLongDoublePBool,                       \
+  bool*:                 fhtAddLongDoublePBoolP,                      \
+  const volatile bool*:  fhtAddLongDoublePBoolP,                      \
+  i16:                   fhtAddLongDoublePI16,                        \
+  i16*:                  fhtAddLongDoublePI16P,                       \
+  const volatile i16*:   fhtAddLongDoublePI16P,                       \
+  u16:                   fhtAddLongDoublePU16,                        \
+  u16*:                  fhtAddLongDoublePU16P,                       \
+  const volatile u16*:   fhtAddLongDoublePU16P,                       \
+  i32:                   fhtAddLongDoublePI32,                        \
+  i32*:                  fhtAddLongDoublePI32P,                       \
+  const volatile i32*:   fhtAddLongDoublePI32P,                       \
+  u32:                   fhtAddLongDoublePU32,                        \
+  u32*:                  fhtAddLongDoublePU32P,                       \
+  const volatile u32*:   fhtAddLongDoublePU32P,                       \
+  i64:                   fhtAddLongDoublePI64,                        \
+  i64*:                  fhtAddLongDoublePI64P,                       \
+  const volatile i64*:   fhtAddLongDoublePI64P,                       \
+  u64:                   fhtAddLongDoublePU64,                        \
+  u64*:                  fhtAddLongDoublePU64P,                       \
+  const volatile u64*:   fhtAddLongDoublePU64P,                       \
+  float:                 fhtAddLongDoublePFloat,                      \
+  float*:                fhtAddLongDoublePFloatP,                     \
+  const volatile float*: fhtAddLongDoublePFloatP,                     \
+  double:                fhtAddLongDoublePDouble,                     \
+  double*:               fhtAddLongDoublePDoubleP,                    \
+  const volatile double*: fhtAddLongDoublePDoubleP,                    \
+  long double:           fhtAddLongDoublePLongDouble,                 \
+  long double*:          fhtAddLongDoublePLongDoubleP,                \
+  const volatile long double*: fhtAddLongDoublePLongDoubleP,                \
+  List:                  fhtAddLongDoublePList,                       \
+  List*:                 fhtAddLongDoublePListP,                      \
+  const volatile List*:  fhtAddLongDoublePListP,                      \
+  Queue:                 fhtAddLongDoublePQueue,                      \
+  Queue*:                fhtAddLongDoublePQueueP,                     \
+  const volatile Queue*: fhtAddLongDoublePQueueP,                     \
+  Stack:                 fhtAddLongDoublePStack,                      \
+  Stack*:                fhtAddLongDoublePStackP,                     \
+  const volatile Stack*: fhtAddLongDoublePStackP,                     \
+  RedBlackTree:          fhtAddLongDoublePRedBlackTree,               \
+  RedBlackTree*:         fhtAddLongDoublePRedBlackTreeP,              \
+  const volatile RedBlackTree*: fhtAddLongDoublePRedBlackTreeP,              \
+  HashTable:             fhtAddLongDoublePHashTable,                  \
+  HashTable*:            fhtAddLongDoublePHashTableP,                 \
+  const volatile HashTable*: fhtAddLongDoublePHashTableP,                 \
+  Vector:                fhtAddLongDoublePVector,                     \
+  Vector*:               fhtAddLongDoublePVectorP,                    \
+  const volatile Vector*: fhtAddLongDoublePVectorP,                    \
+  char*:                 fhtAddLongDoublePString,                     \
+  const volatile char*:  fhtAddLongDoublePString,                     \
+  char**:                fhtAddLongDoublePStringP,                    \
+  const volatile char**: fhtAddLongDoublePStringP,                    \
+  Bytes:                 fhtAddLongDoublePBytes,                      \
+  Bytes*:                fhtAddLongDoublePBytesP,                     \
+  const volatile Bytes*: fhtAddLongDoublePBytesP,                     \
+  void*:                 fhtAddLongDoublePPointer,                    \
+  void**:                fhtAddLongDoublePPointerP,                   \
+  const volatile void**: fhtAddLongDoublePPointerP,                   \
+  i8:                    fhtAddLongDoubleI8,                          \
+  u8:                    fhtAddLongDoubleU8                           \
+
+#define fhtAddLongDoubleP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_LONG_DOUBLEP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_LISTP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddListPBool,                             \
+  bool*:                 fhtAddListPBoolP,                            \
+  const volatile bool*:  fhtAddListPBoolP,                            \
+  i16:                   fhtAddListPI16,                              \
+  i16*:                  fhtAddListPI16P,                             \
+  const volatile i16*:   fhtAddListPI16P,                             \
+  u16:                   fhtAddListPU16,                              \
+  u16*:                  fhtAddListPU16P,                             \
+  const volatile u16*:   fhtAddListPU16P,                             \
+  i32:                   fhtAddListPI32,                              \
+  i32*:                  fhtAddListPI32P,                             \
+  const volatile i32*:   fhtAddListPI32P,                             \
+  u32:                   fhtAddListPU32,                              \
+  u32*:                  fhtAddListPU32P,                             \
+  const volatile u32*:   fhtAddListPU32P,                             \
+  i64:                   fhtAddListPI64,                              \
+  i64*:                  fhtAddListPI64P,                             \
+  const volatile i64*:   fhtAddListPI64P,                             \
+  u64:                   fhtAddListPU64,                              \
+  u64*:                  fhtAddListPU64P,                             \
+  const volatile u64*:   fhtAddListPU64P,                             \
+  float:                 fhtAddListPFloat,                            \
+  float*:                fhtAddListPFloatP,                           \
+  const volatile float*: fhtAddListPFloatP,                           \
+  double:                fhtAddListPDouble,                           \
+  double*:               fhtAddListPDoubleP,                          \
+  const volatile double*: fhtAddListPDoubleP,                          \
+  long double:           fhtAddListPLongDouble,                       \
+  long double*:          fhtAddListPLongDoubleP,                      \
+  const volatile long double*: fhtAddListPLongDoubleP,                      \
+  List:                  fhtAddListPList,                             \
+  List*:                 fhtAddListPListP,                            \
+  const volatile List*:  fhtAddListPListP,                            \
+  Queue:                 fhtAddListPQueue,                            \
+  Queue*:                fhtAddListPQueueP,                           \
+  const volatile Queue*: fhtAddListPQueueP,                           \
+  Stack:                 fhtAddListPStack,                            \
+  Stack*:                fhtAddListPStackP,                           \
+  const volatile Stack*: fhtAddListPStackP,                           \
+  RedBlackTree:          fhtAddListPRedBlackTree,                     \
+  RedBlackTree*:         fhtAddListPRedBlackTreeP,                    \
+  const volatile RedBlackTree*: fhtAddListPRedBlackTreeP,                    \
+  HashTable:             fhtAddListPHashTable,                        \
+  HashTable*:            fhtAddListPHashTableP,                       \
+  const volatile HashTable*: fhtAddListPHashTableP,                       \
+  Vector:                fhtAddListPVector,                           \
+  Vector*:               fhtAddListPVectorP,                          \
+  const volatile Vector*: fhtAddListPVectorP,                          \
+  char*:                 fhtAddListPString,                           \
+  const volatile char*:  fhtAddListPString,                           \
+  char**:                fhtAddListPStringP,                          \
+  const volatile char**: fhtAddListPStringP,                          \
+  Bytes:                 fhtAddListPBytes,                            \
+  Bytes*:                fhtAddListPBytesP,                           \
+  const volatile Bytes*: fhtAddListPBytesP,                           \
+  void*:                 fhtAddListPPointer,                          \
+  void**:                fhtAddListPPointerP,                         \
+  const volatile void**: fhtAddListPPointerP,                         \
+  i8:                    fhtAddListI8,                                \
+  u8:                    fhtAddListU8                                 \
+
+#define fhtAddListP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_LISTP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_QUEUEP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddQueuePBool,                            \
+  bool*:                 fhtAddQueuePBoolP,                           \
+  const volatile bool*:  fhtAddQueuePBoolP,                           \
+  i16:                   fhtAddQueuePI16,                             \
+  i16*:                  fhtAddQueuePI16P,                            \
+  const volatile i16*:   fhtAddQueuePI16P,                            \
+  u16:                   fhtAddQueuePU16,                             \
+  u16*:                  fhtAddQueuePU16P,                            \
+  const volatile u16*:   fhtAddQueuePU16P,                            \
+  i32:                   fhtAddQueuePI32,                             \
+  i32*:                  fhtAddQueuePI32P,                            \
+  const volatile i32*:   fhtAddQueuePI32P,                            \
+  u32:                   fhtAddQueuePU32,                             \
+  u32*:                  fhtAddQueuePU32P,                            \
+  const volatile u32*:   fhtAddQueuePU32P,                            \
+  i64:                   fhtAddQueuePI64,                             \
+  i64*:                  fhtAddQueuePI64P,                            \
+  const volatile i64*:   fhtAddQueuePI64P,                            \
+  u64:                   fhtAddQueuePU64,                             \
+  u64*:                  fhtAddQueuePU64P,                            \
+  const volatile u64*:   fhtAddQueuePU64P,                            \
+  float:                 fhtAddQueuePFloat,                           \
+  float*:                fhtAddQueuePFloatP,                          \
+  const volatile float*: fhtAddQueuePFloatP,                          \
+  double:                fhtAddQueuePDouble,                          \
+  double*:               fhtAddQueuePDoubleP,                         \
+  const volatile double*: fhtAddQueuePDoubleP,                         \
+  long double:           fhtAddQueuePLongDouble,                      \
+  long double*:          fhtAddQueuePLongDoubleP,                     \
+  const volatile long double*: fhtAddQueuePLongDoubleP,                     \
+  List:                  fhtAddQueuePList,                            \
+  List*:                 fhtAddQueuePListP,                           \
+  const volatile List*:  fhtAddQueuePListP,                           \
+  Queue:                 fhtAddQueuePQueue,                           \
+  Queue*:                fhtAddQueuePQueueP,                          \
+  const volatile Queue*: fhtAddQueuePQueueP,                          \
+  Stack:                 fhtAddQueuePStack,                           \
+  Stack*:                fhtAddQueuePStackP,                          \
+  const volatile Stack*: fhtAddQueuePStackP,                          \
+  RedBlackTree:          fhtAddQueuePRedBlackTree,                    \
+  RedBlackTree*:         fhtAddQueuePRedBlackTreeP,                   \
+  const volatile RedBlackTree*: fhtAddQueuePRedBlackTreeP,                   \
+  HashTable:             fhtAddQueuePHashTable,                       \
+  HashTable*:            fhtAddQueuePHashTableP,                      \
+  const volatile HashTable*: fhtAddQueuePHashTableP,                      \
+  Vector:                fhtAddQueuePVector,                          \
+  Vector*:               fhtAddQueuePVectorP,                         \
+  const volatile Vector*: fhtAddQueuePVectorP,                         \
+  char*:                 fhtAddQueuePString,                          \
+  const volatile char*:  fhtAddQueuePString,                          \
+  char**:                fhtAddQueuePStringP,                         \
+  const volatile char**: fhtAddQueuePStringP,                         \
+  Bytes:                 fhtAddQueuePBytes,                           \
+  Bytes*:                fhtAddQueuePBytesP,                          \
+  const volatile Bytes*: fhtAddQueuePBytesP,                          \
+  void*:                 fhtAddQueuePPointer,                         \
+  void**:                fhtAddQueuePPointerP,                        \
+  const volatile void**: fhtAddQueuePPointerP,                        \
+  i8:                    fhtAddQueueI8,                               \
+  u8:                    fhtAddQueueU8                                \
+
+#define fhtAddQueueP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_QUEUEP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_STACKP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddStackPBool,                            \
+  bool*:                 fhtAddStackPBoolP,                           \
+  const volatile bool*:  fhtAddStackPBoolP,                           \
+  i16:                   fhtAddStackPI16,                             \
+  i16*:                  fhtAddStackPI16P,                            \
+  const volatile i16*:   fhtAddStackPI16P,                            \
+  u16:                   fhtAddStackPU16,                             \
+  u16*:                  fhtAddStackPU16P,                            \
+  const volatile u16*:   fhtAddStackPU16P,                            \
+  i32:                   fhtAddStackPI32,                             \
+  i32*:                  fhtAddStackPI32P,                            \
+  const volatile i32*:   fhtAddStackPI32P,                            \
+  u32:                   fhtAddStackPU32,                             \
+  u32*:                  fhtAddStackPU32P,                            \
+  const volatile u32*:   fhtAddStackPU32P,                            \
+  i64:                   fhtAddStackPI64,                             \
+  i64*:                  fhtAddStackPI64P,                            \
+  const volatile i64*:   fhtAddStackPI64P,                            \
+  u64:                   fhtAddStackPU64,                             \
+  u64*:                  fhtAddStackPU64P,                            \
+  const volatile u64*:   fhtAddStackPU64P,                            \
+  float:                 fhtAddStackPFloat,                           \
+  float*:                fhtAddStackPFloatP,                          \
+  const volatile float*: fhtAddStackPFloatP,                          \
+  double:                fhtAddStackPDouble,                          \
+  double*:               fhtAddStackPDoubleP,                         \
+  const volatile double*: fhtAddStackPDoubleP,                         \
+  long double:           fhtAddStackPLongDouble,                      \
+  long double*:          fhtAddStackPLongDoubleP,                     \
+  const volatile long double*: fhtAddStackPLongDoubleP,                     \
+  List:                  fhtAddStackPList,                            \
+  List*:                 fhtAddStackPListP,                           \
+  const volatile List*:  fhtAddStackPListP,                           \
+  Queue:                 fhtAddStackPQueue,                           \
+  Queue*:                fhtAddStackPQueueP,                          \
+  const volatile Queue*: fhtAddStackPQueueP,                          \
+  Stack:                 fhtAddStackPStack,                           \
+  Stack*:                fhtAddStackPStackP,                          \
+  const volatile Stack*: fhtAddStackPStackP,                          \
+  RedBlackTree:          fhtAddStackPRedBlackTree,                    \
+  RedBlackTree*:         fhtAddStackPRedBlackTreeP,                   \
+  const volatile RedBlackTree*: fhtAddStackPRedBlackTreeP,                   \
+  HashTable:             fhtAddStackPHashTable,                       \
+  HashTable*:            fhtAddStackPHashTableP,                      \
+  const volatile HashTable*: fhtAddStackPHashTableP,                      \
+  Vector:                fhtAddStackPVector,                          \
+  Vector*:               fhtAddStackPVectorP,                         \
+  const volatile Vector*: fhtAddStackPVectorP,                         \
+  char*:                 fhtAddStackPString,                          \
+  const volatile char*:  fhtAddStackPString,                          \
+  char**:                fhtAddStackPStringP,                         \
+  const volatile char**: fhtAddStackPStringP,                         \
+  Bytes:                 fhtAddStackPBytes,                           \
+  Bytes*:                fhtAddStackPBytesP,                          \
+  const volatile Bytes*: fhtAddStackPBytesP,                          \
+  void*:                 fhtAddStackPPointer,                         \
+  void**:                fhtAddStackPPointerP,                        \
+  const volatile void**: fhtAddStackPPointerP,                        \
+  i8:                    fhtAddStackI8,                               \
+  u8:                    fhtAddStackU8                                \
+
+#define fhtAddStackP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_STACKP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_RED_BLACK_TREEP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddRedBlackTreePBool,                     \
+  bool*:                 fhtAddRedBlackTreePBoolP,                    \
+  const volatile bool*:  fhtAddRedBlackTreePBoolP,                    \
+  i16:                   fhtAddRedBlackTreePI16,                      \
+  i16*:                  fhtAddRedBlackTreePI16P,                     \
+  const volatile i16*:   fhtAddRedBlackTreePI16P,                     \
+  u16:                   fhtAddRedBlackTreePU16,                      \
+  u16*:                  fhtAddRedBlackTreePU16P,                     \
+  const volatile u16*:   fhtAddRedBlackTreePU16P,                     \
+  i32:                   fhtAddRedBlackTreePI32,                      \
+  i32*:                  fhtAddRedBlackTreePI32P,                     \
+  const volatile i32*:   fhtAddRedBlackTreePI32P,                     \
+  u32:                   fhtAddRedBlackTreePU32,                      \
+  u32*:                  fhtAddRedBlackTreePU32P,                     \
+  const volatile u32*:   fhtAddRedBlackTreePU32P,                     \
+  i64:                   fhtAddRedBlackTreePI64,                      \
+  i64*:                  fhtAddRedBlackTreePI64P,                     \
+  const volatile i64*:   fhtAddRedBlackTreePI64P,                     \
+  u64:                   fhtAddRedBlackTreePU64,                      \
+  u64*:                  fhtAddRedBlackTreePU64P,                     \
+  const volatile u64*:   fhtAddRedBlackTreePU64P,                     \
+  float:                 fhtAddRedBlackTreePFloat,                    \
+  float*:                fhtAddRedBlackTreePFloatP,                   \
+  const volatile float*: fhtAddRedBlackTreePFloatP,                   \
+  double:                fhtAddRedBlackTreePDouble,                   \
+  double*:               fhtAddRedBlackTreePDoubleP,                  \
+  const volatile double*: fhtAddRedBlackTreePDoubleP,                  \
+  long double:           fhtAddRedBlackTreePLongDouble,               \
+  long double*:          fhtAddRedBlackTreePLongDoubleP,              \
+  const volatile long double*: fhtAddRedBlackTreePLongDoubleP,              \
+  List:                  fhtAddRedBlackTreePList,                     \
+  List*:                 fhtAddRedBlackTreePListP,                    \
+  const volatile List*:  fhtAddRedBlackTreePListP,                    \
+  Queue:                 fhtAddRedBlackTreePQueue,                    \
+  Queue*:                fhtAddRedBlackTreePQueueP,                   \
+  const volatile Queue*: fhtAddRedBlackTreePQueueP,                   \
+  Stack:                 fhtAddRedBlackTreePStack,                    \
+  Stack*:                fhtAddRedBlackTreePStackP,                   \
+  const volatile Stack*: fhtAddRedBlackTreePStackP,                   \
+  RedBlackTree:          fhtAddRedBlackTreePRedBlackTree,             \
+  RedBlackTree*:         fhtAddRedBlackTreePRedBlackTreeP,            \
+  const volatile RedBlackTree*: fhtAddRedBlackTreePRedBlackTreeP,            \
+  HashTable:             fhtAddRedBlackTreePHashTable,                \
+  HashTable*:            fhtAddRedBlackTreePHashTableP,               \
+  const volatile HashTable*: fhtAddRedBlackTreePHashTableP,               \
+  Vector:                fhtAddRedBlackTreePVector,                   \
+  Vector*:               fhtAddRedBlackTreePVectorP,                  \
+  const volatile Vector*: fhtAddRedBlackTreePVectorP,                  \
+  char*:                 fhtAddRedBlackTreePString,                   \
+  const volatile char*:  fhtAddRedBlackTreePString,                   \
+  char**:                fhtAddRedBlackTreePStringP,                  \
+  const volatile char**: fhtAddRedBlackTreePStringP,                  \
+  Bytes:                 fhtAddRedBlackTreePBytes,                    \
+  Bytes*:                fhtAddRedBlackTreePBytesP,                   \
+  const volatile Bytes*: fhtAddRedBlackTreePBytesP,                   \
+  void*:                 fhtAddRedBlackTreePPointer,                  \
+  void**:                fhtAddRedBlackTreePPointerP,                 \
+  const volatile void**: fhtAddRedBlackTreePPointerP,                 \
+  i8:                    fhtAddRedBlackTreeI8,                        \
+  u8:                    fhtAddRedBlackTreeU8                         \
+
+#define fhtAddRedBlackTreeP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_RED_BLACK_TREEP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_HASH_TABLEP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddHashTablePBool,                        \
+  bool*:                 fhtAddHashTablePBoolP,                       \
+  const volatile bool*:  fhtAddHashTablePBoolP,                       \
+  i16:                   fhtAddHashTablePI16,                         \
+  i16*:                  fhtAddHashTablePI16P,                        \
+  const volatile i16*:   fhtAddHashTablePI16P,                        \
+  u16:                   fhtAddHashTablePU16,                         \
+  u16*:                  fhtAddHashTablePU16P,                        \
+  const volatile u16*:   fhtAddHashTablePU16P,                        \
+  i32:                   fhtAddHashTablePI32,                         \
+  i32*:                  fhtAddHashTablePI32P,                        \
+  const volatile i32*:   fhtAddHashTablePI32P,                        \
+  u32:                   fhtAddHashTablePU32,                         \
+  u32*:                  fhtAddHashTablePU32P,                        \
+  const volatile u32*:   fhtAddHashTablePU32P,                        \
+  i64:                   fhtAddHashTablePI64,                         \
+  i64*:                  fhtAddHashTablePI64P,                        \
+  const volatile i64*:   fhtAddHashTablePI64P,                        \
+  u64:                   fhtAddHashTablePU64,                         \
+  u64*:                  fhtAddHashTablePU64P,                        \
+  const volatile u64*:   fhtAddHashTablePU64P,                        \
+  float:                 fhtAddHashTablePFloat,                       \
+  float*:                fhtAddHashTablePFloatP,                      \
+  const volatile float*: fhtAddHashTablePFloatP,                      \
+  double:                fhtAddHashTablePDouble,                      \
+  double*:               fhtAddHashTablePDoubleP,                     \
+  const volatile double*: fhtAddHashTablePDoubleP,                     \
+  long double:           fhtAddHashTablePLongDouble,                  \
+  long double*:          fhtAddHashTablePLongDoubleP,                 \
+  const volatile long double*: fhtAddHashTablePLongDoubleP,                 \
+  List:                  fhtAddHashTablePList,                        \
+  List*:                 fhtAddHashTablePListP,                       \
+  const volatile List*:  fhtAddHashTablePListP,                       \
+  Queue:                 fhtAddHashTablePQueue,                       \
+  Queue*:                fhtAddHashTablePQueueP,                      \
+  const volatile Queue*: fhtAddHashTablePQueueP,                      \
+  Stack:                 fhtAddHashTablePStack,                       \
+  Stack*:                fhtAddHashTablePStackP,                      \
+  const volatile Stack*: fhtAddHashTablePStackP,                      \
+  RedBlackTree:          fhtAddHashTablePRedBlackTree,                \
+  RedBlackTree*:         fhtAddHashTablePRedBlackTreeP,               \
+  const volatile RedBlackTree*: fhtAddHashTablePRedBlackTreeP,               \
+  HashTable:             fhtAddHashTablePHashTable,                   \
+  HashTable*:            fhtAddHashTablePHashTableP,                  \
+  const volatile HashTable*: fhtAddHashTablePHashTableP,                  \
+  Vector:                fhtAddHashTablePVector,                      \
+  Vector*:               fhtAddHashTablePVectorP,                     \
+  const volatile Vector*: fhtAddHashTablePVectorP,                     \
+  char*:                 fhtAddHashTablePString,                      \
+  const volatile char*:  fhtAddHashTablePString,                      \
+  char**:                fhtAddHashTablePStringP,                     \
+  const volatile char**: fhtAddHashTablePStringP,                     \
+  Bytes:                 fhtAddHashTablePBytes,                       \
+  Bytes*:                fhtAddHashTablePBytesP,                      \
+  const volatile Bytes*: fhtAddHashTablePBytesP,                      \
+  void*:                 fhtAddHashTablePPointer,                     \
+  void**:                fhtAddHashTablePPointerP,                    \
+  const volatile void**: fhtAddHashTablePPointerP,                    \
+  i8:                    fhtAddHashTableI8,                           \
+  u8:                    fhtAddHashTableU8                            \
+
+#define fhtAddHashTableP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_HASH_TABLEP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_VECTORP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddVectorPBool,                           \
+  bool*:                 fhtAddVectorPBoolP,                          \
+  const volatile bool*:  fhtAddVectorPBoolP,                          \
+  i16:                   fhtAddVectorPI16,                            \
+  i16*:                  fhtAddVectorPI16P,                           \
+  const volatile i16*:   fhtAddVectorPI16P,                           \
+  u16:                   fhtAddVectorPU16,                            \
+  u16*:                  fhtAddVectorPU16P,                           \
+  const volatile u16*:   fhtAddVectorPU16P,                           \
+  i32:                   fhtAddVectorPI32,                            \
+  i32*:                  fhtAddVectorPI32P,                           \
+  const volatile i32*:   fhtAddVectorPI32P,                           \
+  u32:                   fhtAddVectorPU32,                            \
+  u32*:                  fhtAddVectorPU32P,                           \
+  const volatile u32*:   fhtAddVectorPU32P,                           \
+  i64:                   fhtAddVectorPI64,                            \
+  i64*:                  fhtAddVectorPI64P,                           \
+  const volatile i64*:   fhtAddVectorPI64P,                           \
+  u64:                   fhtAddVectorPU64,                            \
+  u64*:                  fhtAddVectorPU64P,                           \
+  const volatile u64*:   fhtAddVectorPU64P,                           \
+  float:                 fhtAddVectorPFloat,                          \
+  float*:                fhtAddVectorPFloatP,                         \
+  const volatile float*: fhtAddVectorPFloatP,                         \
+  double:                fhtAddVectorPDouble,                         \
+  double*:               fhtAddVectorPDoubleP,                        \
+  const volatile double*: fhtAddVectorPDoubleP,                        \
+  long double:           fhtAddVectorPLongDouble,                     \
+  long double*:          fhtAddVectorPLongDoubleP,                    \
+  const volatile long double*: fhtAddVectorPLongDoubleP,                    \
+  List:                  fhtAddVectorPList,                           \
+  List*:                 fhtAddVectorPListP,                          \
+  const volatile List*:  fhtAddVectorPListP,                          \
+  Queue:                 fhtAddVectorPQueue,                          \
+  Queue*:                fhtAddVectorPQueueP,                         \
+  const volatile Queue*: fhtAddVectorPQueueP,                         \
+  Stack:                 fhtAddVectorPStack,                          \
+  Stack*:                fhtAddVectorPStackP,                         \
+  const volatile Stack*: fhtAddVectorPStackP,                         \
+  RedBlackTree:          fhtAddVectorPRedBlackTree,                   \
+  RedBlackTree*:         fhtAddVectorPRedBlackTreeP,                  \
+  const volatile RedBlackTree*: fhtAddVectorPRedBlackTreeP,                  \
+  HashTable:             fhtAddVectorPHashTable,                      \
+  HashTable*:            fhtAddVectorPHashTableP,                     \
+  const volatile HashTable*: fhtAddVectorPHashTableP,                     \
+  Vector:                fhtAddVectorPVector,                         \
+  Vector*:               fhtAddVectorPVectorP,                        \
+  const volatile Vector*: fhtAddVectorPVectorP,                        \
+  char*:                 fhtAddVectorPString,                         \
+  const volatile char*:  fhtAddVectorPString,                         \
+  char**:                fhtAddVectorPStringP,                        \
+  const volatile char**: fhtAddVectorPStringP,                        \
+  Bytes:                 fhtAddVectorPBytes,                          \
+  Bytes*:                fhtAddVectorPBytesP,                         \
+  const volatile Bytes*: fhtAddVectorPBytesP,                         \
+  void*:                 fhtAddVectorPPointer,                        \
+  void**:                fhtAddVectorPPointerP,                       \
+  const volatile void**: fhtAddVectorPPointerP,                       \
+  i8:                    fhtAddVectorI8,                              \
+  u8:                    fhtAddVectorU8                               \
+
+#define fhtAddVectorP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_VECTORP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_STRINGP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddStringPBool,                           \
+  bool*:                 fhtAddStringPBoolP,                          \
+  const volatile bool*:  fhtAddStringPBoolP,                          \
+  i16:                   fhtAddStringPI16,                            \
+  i16*:                  fhtAddStringPI16P,                           \
+  const volatile i16*:   fhtAddStringPI16P,                           \
+  u16:                   fhtAddStringPU16,                            \
+  u16*:                  fhtAddStringPU16P,                           \
+  const volatile u16*:   fhtAddStringPU16P,                           \
+  i32:                   fhtAddStringPI32,                            \
+  i32*:                  fhtAddStringPI32P,                           \
+  const volatile i32*:   fhtAddStringPI32P,                           \
+  u32:                   fhtAddStringPU32,                            \
+  u32*:                  fhtAddStringPU32P,                           \
+  const volatile u32*:   fhtAddStringPU32P,                           \
+  i64:                   fhtAddStringPI64,                            \
+  i64*:                  fhtAddStringPI64P,                           \
+  const volatile i64*:   fhtAddStringPI64P,                           \
+  u64:                   fhtAddStringPU64,                            \
+  u64*:                  fhtAddStringPU64P,                           \
+  const volatile u64*:   fhtAddStringPU64P,                           \
+  float:                 fhtAddStringPFloat,                          \
+  float*:                fhtAddStringPFloatP,                         \
+  const volatile float*: fhtAddStringPFloatP,                         \
+  double:                fhtAddStringPDouble,                         \
+  double*:               fhtAddStringPDoubleP,                        \
+  const volatile double*: fhtAddStringPDoubleP,                        \
+  long double:           fhtAddStringPLongDouble,                     \
+  long double*:          fhtAddStringPLongDoubleP,                    \
+  const volatile long double*: fhtAddStringPLongDoubleP,                    \
+  List:                  fhtAddStringPList,                           \
+  List*:                 fhtAddStringPListP,                          \
+  const volatile List*:  fhtAddStringPListP,                          \
+  Queue:                 fhtAddStringPQueue,                          \
+  Queue*:                fhtAddStringPQueueP,                         \
+  const volatile Queue*: fhtAddStringPQueueP,                         \
+  Stack:                 fhtAddStringPStack,                          \
+  Stack*:                fhtAddStringPStackP,                         \
+  const volatile Stack*: fhtAddStringPStackP,                         \
+  RedBlackTree:          fhtAddStringPRedBlackTree,                   \
+  RedBlackTree*:         fhtAddStringPRedBlackTreeP,                  \
+  const volatile RedBlackTree*: fhtAddStringPRedBlackTreeP,                  \
+  HashTable:             fhtAddStringPHashTable,                      \
+  HashTable*:            fhtAddStringPHashTableP,                     \
+  const volatile HashTable*: fhtAddStringPHashTableP,                     \
+  Vector:                fhtAddStringPVector,                         \
+  Vector*:               fhtAddStringPVectorP,                        \
+  const volatile Vector*: fhtAddStringPVectorP,                        \
+  char*:                 fhtAddStringPString,                         \
+  const volatile char*:  fhtAddStringPString,                         \
+  char**:                fhtAddStringPStringP,                        \
+  const volatile char**: fhtAddStringPStringP,                        \
+  Bytes:                 fhtAddStringPBytes,                          \
+  Bytes*:                fhtAddStringPBytesP,                         \
+  const volatile Bytes*: fhtAddStringPBytesP,                         \
+  void*:                 fhtAddStringPPointer,                        \
+  void**:                fhtAddStringPPointerP,                       \
+  const volatile void**: fhtAddStringPPointerP,                       \
+  i8:                    fhtAddStringI8,                              \
+  u8:                    fhtAddStringU8                               \
+
+#define fhtAddStringP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_STRINGP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_BYTESP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddBytesPBool,                            \
+  bool*:                 fhtAddBytesPBoolP,                           \
+  const volatile bool*:  fhtAddBytesPBoolP,                           \
+  i16:                   fhtAddBytesPI16,                             \
+  i16*:                  fhtAddBytesPI16P,                            \
+  const volatile i16*:   fhtAddBytesPI16P,                            \
+  u16:                   fhtAddBytesPU16,                             \
+  u16*:                  fhtAddBytesPU16P,                            \
+  const volatile u16*:   fhtAddBytesPU16P,                            \
+  i32:                   fhtAddBytesPI32,                             \
+  i32*:                  fhtAddBytesPI32P,                            \
+  const volatile i32*:   fhtAddBytesPI32P,                            \
+  u32:                   fhtAddBytesPU32,                             \
+  u32*:                  fhtAddBytesPU32P,                            \
+  const volatile u32*:   fhtAddBytesPU32P,                            \
+  i64:                   fhtAddBytesPI64,                             \
+  i64*:                  fhtAddBytesPI64P,                            \
+  const volatile i64*:   fhtAddBytesPI64P,                            \
+  u64:                   fhtAddBytesPU64,                             \
+  u64*:                  fhtAddBytesPU64P,                            \
+  const volatile u64*:   fhtAddBytesPU64P,                            \
+  float:                 fhtAddBytesPFloat,                           \
+  float*:                fhtAddBytesPFloatP,                          \
+  const volatile float*: fhtAddBytesPFloatP,                          \
+  double:                fhtAddBytesPDouble,                          \
+  double*:               fhtAddBytesPDoubleP,                         \
+  const volatile double*: fhtAddBytesPDoubleP,                         \
+  long double:           fhtAddBytesPLongDouble,                      \
+  long double*:          fhtAddBytesPLongDoubleP,                     \
+  const volatile long double*: fhtAddBytesPLongDoubleP,                     \
+  List:                  fhtAddBytesPList,                            \
+  List*:                 fhtAddBytesPListP,                           \
+  const volatile List*:  fhtAddBytesPListP,                           \
+  Queue:                 fhtAddBytesPQueue,                           \
+  Queue*:                fhtAddBytesPQueueP,                          \
+  const volatile Queue*: fhtAddBytesPQueueP,                          \
+  Stack:                 fhtAddBytesPStack,                           \
+  Stack*:                fhtAddBytesPStackP,                          \
+  const volatile Stack*: fhtAddBytesPStackP,                          \
+  RedBlackTree:          fhtAddBytesPRedBlackTree,                    \
+  RedBlackTree*:         fhtAddBytesPRedBlackTreeP,                   \
+  const volatile RedBlackTree*: fhtAddBytesPRedBlackTreeP,                   \
+  HashTable:             fhtAddBytesPHashTable,                       \
+  HashTable*:            fhtAddBytesPHashTableP,                      \
+  const volatile HashTable*: fhtAddBytesPHashTableP,                      \
+  Vector:                fhtAddBytesPVector,                          \
+  Vector*:               fhtAddBytesPVectorP,                         \
+  const volatile Vector*: fhtAddBytesPVectorP,                         \
+  char*:                 fhtAddBytesPString,                          \
+  const volatile char*:  fhtAddBytesPString,                          \
+  char**:                fhtAddBytesPStringP,                         \
+  const volatile char**: fhtAddBytesPStringP,                         \
+  Bytes:                 fhtAddBytesPBytes,                           \
+  Bytes*:                fhtAddBytesPBytesP,                          \
+  const volatile Bytes*: fhtAddBytesPBytesP,                          \
+  void*:                 fhtAddBytesPPointer,                         \
+  void**:                fhtAddBytesPPointerP,                        \
+  const volatile void**: fhtAddBytesPPointerP,                        \
+  i8:                    fhtAddBytesI8,                               \
+  u8:                    fhtAddBytesU8                                \
+
+#define fhtAddBytesP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_BYTESP_KEY(dataStructure, key, value) \
+  )
+
+#define FHT_ADD_GENERIC_CASES_POINTERP_KEY(dataStructure, key, value) \
+  bool:                  fhtAddPointerPBool,                          \
+  bool*:                 fhtAddPointerPBoolP,                         \
+  const volatile bool*:  fhtAddPointerPBoolP,                         \
+  i16:                   fhtAddPointerPI16,                           \
+  i16*:                  fhtAddPointerPI16P,                          \
+  const volatile i16*:   fhtAddPointerPI16P,                          \
+  u16:                   fhtAddPointerPU16,                           \
+  u16*:                  fhtAddPointerPU16P,                          \
+  const volatile u16*:   fhtAddPointerPU16P,                          \
+  i32:                   fhtAddPointerPI32,                           \
+  i32*:                  fhtAddPointerPI32P,                          \
+  const volatile i32*:   fhtAddPointerPI32P,                          \
+  u32:                   fhtAddPointerPU32,                           \
+  u32*:                  fhtAddPointerPU32P,                          \
+  const volatile u32*:   fhtAddPointerPU32P,                          \
+  i64:                   fhtAddPointerPI64,                           \
+  i64*:                  fhtAddPointerPI64P,                          \
+  const volatile i64*:   fhtAddPointerPI64P,                          \
+  u64:                   fhtAddPointerPU64,                           \
+  u64*:                  fhtAddPointerPU64P,                          \
+  const volatile u64*:   fhtAddPointerPU64P,                          \
+  float:                 fhtAddPointerPFloat,                         \
+  float*:                fhtAddPointerPFloatP,                        \
+  const volatile float*: fhtAddPointerPFloatP,                        \
+  double:                fhtAddPointerPDouble,                        \
+  double*:               fhtAddPointerPDoubleP,                       \
+  const volatile double*: fhtAddPointerPDoubleP,                       \
+  long double:           fhtAddPointerPLongDouble,                    \
+  long double*:          fhtAddPointerPLongDoubleP,                   \
+  const volatile long double*: fhtAddPointerPLongDoubleP,                   \
+  List:                  fhtAddPointerPList,                          \
+  List*:                 fhtAddPointerPListP,                         \
+  const volatile List*:  fhtAddPointerPListP,                         \
+  Queue:                 fhtAddPointerPQueue,                         \
+  Queue*:                fhtAddPointerPQueueP,                        \
+  const volatile Queue*: fhtAddPointerPQueueP,                        \
+  Stack:                 fhtAddPointerPStack,                         \
+  Stack*:                fhtAddPointerPStackP,                        \
+  const volatile Stack*: fhtAddPointerPStackP,                        \
+  RedBlackTree:          fhtAddPointerPRedBlackTree,                  \
+  RedBlackTree*:         fhtAddPointerPRedBlackTreeP,                 \
+  const volatile RedBlackTree*: fhtAddPointerPRedBlackTreeP,                 \
+  HashTable:             fhtAddPointerPHashTable,                     \
+  HashTable*:            fhtAddPointerPHashTableP,                    \
+  const volatile HashTable*: fhtAddPointerPHashTableP,                    \
+  Vector:                fhtAddPointerPVector,                        \
+  Vector*:               fhtAddPointerPVectorP,                       \
+  const volatile Vector*: fhtAddPointerPVectorP,                       \
+  char*:                 fhtAddPointerPString,                        \
+  const volatile char*:  fhtAddPointerPString,                        \
+  char**:                fhtAddPointerPStringP,                       \
+  const volatile char**: fhtAddPointerPStringP,                       \
+  Bytes:                 fhtAddPointerPBytes,                         \
+  Bytes*:                fhtAddPointerPBytesP,                        \
+  const volatile Bytes*: fhtAddPointerPBytesP,                        \
+  void*:                 fhtAddPointerPPointer,                       \
+  void**:                fhtAddPointerPPointerP,                      \
+  const volatile void**: fhtAddPointerPPointerP,                      \
+  i8:                    fhtAddPointerI8,                             \
+  u8:                    fhtAddPointerU8                              \
+
+#define fhtAddPointerP(dataStructure, key, value) _Generic((value), \
+  FHT_ADD_GENERIC_CASES_POINTERP_KEY(dataStructure, key, value) \
+  )
+
+
+#define FHT_ADD_GENERIC_CASES(dataStructure, key, value) \
+  bool:                  fhtAddBool(dataStructure, key, value),       \
+  bool*:                 fhtAddBoolP(dataStructure, key, value),      \
+  const volatile bool*:  fhtAddBoolP(dataStructure, key, value),      \
+  i16:                   fhtAddI16(dataStructure, key, value),        \
+  i16*:                  fhtAddI16P(dataStructure, key, value),       \
+  const volatile i16*:   fhtAddI16P(dataStructure, key, value),       \
+  u16:                   fhtAddU16(dataStructure, key, value),        \
+  u16*:                  fhtAddU16P(dataStructure, key, value),       \
+  const volatile u16*:   fhtAddU16P(dataStructure, key, value),       \
+  i32:                   fhtAddI32(dataStructure, key, value),        \
+  i32*:                  fhtAddI32P(dataStructure, key, value),       \
+  const volatile i32*:   fhtAddI32P(dataStructure, key, value),       \
+  u32:                   fhtAddU32(dataStructure, key, value),        \
+  u32*:                  fhtAddU32P(dataStructure, key, value),       \
+  const volatile u32*:   fhtAddU32P(dataStructure, key, value),       \
+  i64:                   fhtAddI64(dataStructure, key, value),        \
+  i64*:                  fhtAddI64P(dataStructure, key, value),       \
+  const volatile i64*:   fhtAddI64P(dataStructure, key, value),       \
+  u64:                   fhtAddU64(dataStructure, key, value),        \
+  u64*:                  fhtAddU64P(dataStructure, key, value),       \
+  const volatile u64*:   fhtAddU64P(dataStructure, key, value),       \
+  float:                 fhtAddFloat(dataStructure, key, value),      \
+  float*:                fhtAddFloatP(dataStructure, key, value),     \
+  const volatile float*: fhtAddFloatP(dataStructure, key, value),     \
+  double:                fhtAddDouble(dataStructure, key, value),     \
+  double*:               fhtAddDoubleP(dataStructure, key, value),    \
+  const volatile double*: fhtAddDoubleP(dataStructure, key, value),    \
+  long double:           fhtAddLongDouble(dataStructure, key, value), \
+  long double*:          fhtAddLongDoubleP(dataStructure, key, value), \
+  const volatile long double*: fhtAddLongDoubleP(dataStructure, key, value), \
+  List:                  fhtAddList(dataStructure, key, value),       \
+  List*:                 fhtAddListP(dataStructure, key, value),      \
+  const volatile List*:  fhtAddListP(dataStructure, key, value),      \
+  Queue:                 fhtAddQueue(dataStructure, key, value),      \
+  Queue*:                fhtAddQueueP(dataStructure, key, value),     \
+  const volatile Queue*: fhtAddQueueP(dataStructure, key, value),     \
+  Stack:                 fhtAddStack(dataStructure, key, value),      \
+  Stack*:                fhtAddStackP(dataStructure, key, value),     \
+  const volatile Stack*: fhtAddStackP(dataStructure, key, value),     \
+  RedBlackTree:          fhtAddRedBlackTree(dataStructure, key, value), \
+  RedBlackTree*:         fhtAddRedBlackTreeP(dataStructure, key, value), \
+  const volatile RedBlackTree*: fhtAddRedBlackTreeP(dataStructure, key, value), \
+  HashTable:             fhtAddHashTable(dataStructure, key, value),  \
+  HashTable*:            fhtAddHashTableP(dataStructure, key, value), \
+  const volatile HashTable*: fhtAddHashTableP(dataStructure, key, value), \
+  Vector:                fhtAddVector(dataStructure, key, value),     \
+  Vector*:               fhtAddVectorP(dataStructure, key, value),    \
+  const volatile Vector*: fhtAddVectorP(dataStructure, key, value),    \
+  char*:                 fhtAddString(dataStructure, key, value),     \
+  const volatile char*:  fhtAddString(dataStructure, key, value),     \
+  char**:                fhtAddStringP(dataStructure, key, value),    \
+  const volatile char**: fhtAddStringP(dataStructure, key, value),    \
+  Bytes:                 fhtAddBytes(dataStructure, key, value),      \
+  Bytes*:                fhtAddBytesP(dataStructure, key, value),     \
+  const volatile Bytes*: fhtAddBytesP(dataStructure, key, value),     \
+  void*:                 fhtAddPointer(dataStructure, key, value),    \
+  void**:                fhtAddPointerP(dataStructure, key, value),   \
+  const volatile void**: fhtAddPointerP(dataStructure, key, value),   \
+  i8:                    fhtAddI8(dataStructure, key, value),         \
+  u8:                    fhtAddU8(dataStructure, key, value)          \
+
+#define fhtAdd(dataStructure, key, value) _Generic((key), \
+  FHT_ADD_GENERIC_CASES(dataStructure, key, value) \
+  )(dataStructure, key, value)
+
+#endif // __STDC_VERSION__
+
+#elif defined __cplusplus // __STDC_VERSION__ is *NOT* defined
+#define TYPE_SAFE_FLAT_HASH_TABLE
+
+// Define the C++ function overloads.
+
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, bool value) {
+  return fhtAddBoolBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile bool* value) {
+  return fhtAddBoolBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, bool value) {
+  return fhtAddBoolPBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile bool* value) {
+  return fhtAddBoolPBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, i16 value) {
+  return fhtAddBoolI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile i16* value) {
+  return fhtAddBoolI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, i16 value) {
+  return fhtAddBoolPI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile i16* value) {
+  return fhtAddBoolPI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, u16 value) {
+  return fhtAddBoolU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile u16* value) {
+  return fhtAddBoolU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, u16 value) {
+  return fhtAddBoolPU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile u16* value) {
+  return fhtAddBoolPU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, i32 value) {
+  return fhtAddBoolI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile i32* value) {
+  return fhtAddBoolI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, i32 value) {
+  return fhtAddBoolPI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile i32* value) {
+  return fhtAddBoolPI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, u32 value) {
+  return fhtAddBoolU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile u32* value) {
+  return fhtAddBoolU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, u32 value) {
+  return fhtAddBoolPU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile u32* value) {
+  return fhtAddBoolPU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, i64 value) {
+  return fhtAddBoolI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile i64* value) {
+  return fhtAddBoolI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, i64 value) {
+  return fhtAddBoolPI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile i64* value) {
+  return fhtAddBoolPI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, u64 value) {
+  return fhtAddBoolU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile u64* value) {
+  return fhtAddBoolU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, u64 value) {
+  return fhtAddBoolPU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile u64* value) {
+  return fhtAddBoolPU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, float value) {
+  return fhtAddBoolFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile float* value) {
+  return fhtAddBoolFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, float value) {
+  return fhtAddBoolPFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile float* value) {
+  return fhtAddBoolPFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, double value) {
+  return fhtAddBoolDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile double* value) {
+  return fhtAddBoolDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, double value) {
+  return fhtAddBoolPDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile double* value) {
+  return fhtAddBoolPDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, long double value) {
+  return fhtAddBoolLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile long double* value) {
+  return fhtAddBoolLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, long double value) {
+  return fhtAddBoolPLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile long double* value) {
+  return fhtAddBoolPLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, List value) {
+  return fhtAddBoolList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile List* value) {
+  return fhtAddBoolListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, List value) {
+  return fhtAddBoolPList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile List* value) {
+  return fhtAddBoolPListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, Queue value) {
+  return fhtAddBoolQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile Queue* value) {
+  return fhtAddBoolQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, Queue value) {
+  return fhtAddBoolPQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile Queue* value) {
+  return fhtAddBoolPQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, Stack value) {
+  return fhtAddBoolStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile Stack* value) {
+  return fhtAddBoolStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, Stack value) {
+  return fhtAddBoolPStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile Stack* value) {
+  return fhtAddBoolPStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, RedBlackTree value) {
+  return fhtAddBoolRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile RedBlackTree* value) {
+  return fhtAddBoolRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, RedBlackTree value) {
+  return fhtAddBoolPRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile RedBlackTree* value) {
+  return fhtAddBoolPRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, HashTable value) {
+  return fhtAddBoolHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile HashTable* value) {
+  return fhtAddBoolHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, HashTable value) {
+  return fhtAddBoolPHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile HashTable* value) {
+  return fhtAddBoolPHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, Vector value) {
+  return fhtAddBoolVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile Vector* value) {
+  return fhtAddBoolVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, Vector value) {
+  return fhtAddBoolPVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile Vector* value) {
+  return fhtAddBoolPVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile char* value) {
+  return fhtAddBoolString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile char** value) {
+  return fhtAddBoolStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile char* value) {
+  return fhtAddBoolPString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile char** value) {
+  return fhtAddBoolPStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, Bytes value) {
+  return fhtAddBoolBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile Bytes* value) {
+  return fhtAddBoolBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, Bytes value) {
+  return fhtAddBoolPBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile Bytes* value) {
+  return fhtAddBoolPBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, void* value) {
+  return fhtAddBoolPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, const volatile void** value) {
+  return fhtAddBoolPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, void* value) {
+  return fhtAddBoolPPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, const volatile void** value) {
+  return fhtAddBoolPPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, i8 value) {
+  return fhtAddBoolI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, i8 value) {
+  return fhtAddBoolPI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, bool key, u8 value) {
+  return fhtAddBoolU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile bool* key, u8 value) {
+  return fhtAddBoolPU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, bool value) {
+  return fhtAddI16Bool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile bool* value) {
+  return fhtAddI16BoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, bool value) {
+  return fhtAddI16PBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile bool* value) {
+  return fhtAddI16PBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, i16 value) {
+  return fhtAddI16I16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile i16* value) {
+  return fhtAddI16I16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, i16 value) {
+  return fhtAddI16PI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile i16* value) {
+  return fhtAddI16PI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, u16 value) {
+  return fhtAddI16U16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile u16* value) {
+  return fhtAddI16U16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, u16 value) {
+  return fhtAddI16PU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile u16* value) {
+  return fhtAddI16PU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, i32 value) {
+  return fhtAddI16I32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile i32* value) {
+  return fhtAddI16I32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, i32 value) {
+  return fhtAddI16PI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile i32* value) {
+  return fhtAddI16PI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, u32 value) {
+  return fhtAddI16U32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile u32* value) {
+  return fhtAddI16U32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, u32 value) {
+  return fhtAddI16PU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile u32* value) {
+  return fhtAddI16PU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, i64 value) {
+  return fhtAddI16I64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile i64* value) {
+  return fhtAddI16I64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, i64 value) {
+  return fhtAddI16PI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile i64* value) {
+  return fhtAddI16PI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, u64 value) {
+  return fhtAddI16U64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile u64* value) {
+  return fhtAddI16U64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, u64 value) {
+  return fhtAddI16PU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile u64* value) {
+  return fhtAddI16PU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, float value) {
+  return fhtAddI16Float(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile float* value) {
+  return fhtAddI16FloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, float value) {
+  return fhtAddI16PFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile float* value) {
+  return fhtAddI16PFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, double value) {
+  return fhtAddI16Double(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile double* value) {
+  return fhtAddI16DoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, double value) {
+  return fhtAddI16PDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile double* value) {
+  return fhtAddI16PDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, long double value) {
+  return fhtAddI16LongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile long double* value) {
+  return fhtAddI16LongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, long double value) {
+  return fhtAddI16PLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile long double* value) {
+  return fhtAddI16PLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, List value) {
+  return fhtAddI16List(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile List* value) {
+  return fhtAddI16ListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, List value) {
+  return fhtAddI16PList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile List* value) {
+  return fhtAddI16PListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, Queue value) {
+  return fhtAddI16Queue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile Queue* value) {
+  return fhtAddI16QueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, Queue value) {
+  return fhtAddI16PQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile Queue* value) {
+  return fhtAddI16PQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, Stack value) {
+  return fhtAddI16Stack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile Stack* value) {
+  return fhtAddI16StackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, Stack value) {
+  return fhtAddI16PStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile Stack* value) {
+  return fhtAddI16PStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, RedBlackTree value) {
+  return fhtAddI16RedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile RedBlackTree* value) {
+  return fhtAddI16RedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, RedBlackTree value) {
+  return fhtAddI16PRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile RedBlackTree* value) {
+  return fhtAddI16PRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, HashTable value) {
+  return fhtAddI16HashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile HashTable* value) {
+  return fhtAddI16HashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, HashTable value) {
+  return fhtAddI16PHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile HashTable* value) {
+  return fhtAddI16PHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, Vector value) {
+  return fhtAddI16Vector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile Vector* value) {
+  return fhtAddI16VectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, Vector value) {
+  return fhtAddI16PVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile Vector* value) {
+  return fhtAddI16PVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile char* value) {
+  return fhtAddI16String(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile char** value) {
+  return fhtAddI16StringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile char* value) {
+  return fhtAddI16PString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile char** value) {
+  return fhtAddI16PStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, Bytes value) {
+  return fhtAddI16Bytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile Bytes* value) {
+  return fhtAddI16BytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, Bytes value) {
+  return fhtAddI16PBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile Bytes* value) {
+  return fhtAddI16PBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, void* value) {
+  return fhtAddI16Pointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, const volatile void** value) {
+  return fhtAddI16PointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, void* value) {
+  return fhtAddI16PPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, const volatile void** value) {
+  return fhtAddI16PPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, i8 value) {
+  return fhtAddI16I8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, i8 value) {
+  return fhtAddI16PI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i16 key, u8 value) {
+  return fhtAddI16U8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i16* key, u8 value) {
+  return fhtAddI16PU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, bool value) {
+  return fhtAddU16Bool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile bool* value) {
+  return fhtAddU16BoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, bool value) {
+  return fhtAddU16PBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile bool* value) {
+  return fhtAddU16PBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, i16 value) {
+  return fhtAddU16I16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile i16* value) {
+  return fhtAddU16I16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, i16 value) {
+  return fhtAddU16PI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile i16* value) {
+  return fhtAddU16PI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, u16 value) {
+  return fhtAddU16U16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile u16* value) {
+  return fhtAddU16U16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, u16 value) {
+  return fhtAddU16PU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile u16* value) {
+  return fhtAddU16PU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, i32 value) {
+  return fhtAddU16I32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile i32* value) {
+  return fhtAddU16I32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, i32 value) {
+  return fhtAddU16PI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile i32* value) {
+  return fhtAddU16PI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, u32 value) {
+  return fhtAddU16U32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile u32* value) {
+  return fhtAddU16U32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, u32 value) {
+  return fhtAddU16PU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile u32* value) {
+  return fhtAddU16PU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, i64 value) {
+  return fhtAddU16I64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile i64* value) {
+  return fhtAddU16I64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, i64 value) {
+  return fhtAddU16PI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile i64* value) {
+  return fhtAddU16PI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, u64 value) {
+  return fhtAddU16U64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile u64* value) {
+  return fhtAddU16U64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, u64 value) {
+  return fhtAddU16PU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile u64* value) {
+  return fhtAddU16PU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, float value) {
+  return fhtAddU16Float(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile float* value) {
+  return fhtAddU16FloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, float value) {
+  return fhtAddU16PFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile float* value) {
+  return fhtAddU16PFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, double value) {
+  return fhtAddU16Double(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile double* value) {
+  return fhtAddU16DoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, double value) {
+  return fhtAddU16PDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile double* value) {
+  return fhtAddU16PDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, long double value) {
+  return fhtAddU16LongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile long double* value) {
+  return fhtAddU16LongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, long double value) {
+  return fhtAddU16PLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile long double* value) {
+  return fhtAddU16PLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, List value) {
+  return fhtAddU16List(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile List* value) {
+  return fhtAddU16ListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, List value) {
+  return fhtAddU16PList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile List* value) {
+  return fhtAddU16PListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, Queue value) {
+  return fhtAddU16Queue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile Queue* value) {
+  return fhtAddU16QueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, Queue value) {
+  return fhtAddU16PQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile Queue* value) {
+  return fhtAddU16PQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, Stack value) {
+  return fhtAddU16Stack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile Stack* value) {
+  return fhtAddU16StackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, Stack value) {
+  return fhtAddU16PStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile Stack* value) {
+  return fhtAddU16PStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, RedBlackTree value) {
+  return fhtAddU16RedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile RedBlackTree* value) {
+  return fhtAddU16RedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, RedBlackTree value) {
+  return fhtAddU16PRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile RedBlackTree* value) {
+  return fhtAddU16PRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, HashTable value) {
+  return fhtAddU16HashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile HashTable* value) {
+  return fhtAddU16HashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, HashTable value) {
+  return fhtAddU16PHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile HashTable* value) {
+  return fhtAddU16PHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, Vector value) {
+  return fhtAddU16Vector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile Vector* value) {
+  return fhtAddU16VectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, Vector value) {
+  return fhtAddU16PVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile Vector* value) {
+  return fhtAddU16PVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile char* value) {
+  return fhtAddU16String(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile char** value) {
+  return fhtAddU16StringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile char* value) {
+  return fhtAddU16PString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile char** value) {
+  return fhtAddU16PStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, Bytes value) {
+  return fhtAddU16Bytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile Bytes* value) {
+  return fhtAddU16BytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, Bytes value) {
+  return fhtAddU16PBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile Bytes* value) {
+  return fhtAddU16PBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, void* value) {
+  return fhtAddU16Pointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, const volatile void** value) {
+  return fhtAddU16PointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, void* value) {
+  return fhtAddU16PPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, const volatile void** value) {
+  return fhtAddU16PPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, i8 value) {
+  return fhtAddU16I8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, i8 value) {
+  return fhtAddU16PI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u16 key, u8 value) {
+  return fhtAddU16U8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u16* key, u8 value) {
+  return fhtAddU16PU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, bool value) {
+  return fhtAddI32Bool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile bool* value) {
+  return fhtAddI32BoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, bool value) {
+  return fhtAddI32PBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile bool* value) {
+  return fhtAddI32PBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, i16 value) {
+  return fhtAddI32I16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile i16* value) {
+  return fhtAddI32I16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, i16 value) {
+  return fhtAddI32PI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile i16* value) {
+  return fhtAddI32PI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, u16 value) {
+  return fhtAddI32U16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile u16* value) {
+  return fhtAddI32U16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, u16 value) {
+  return fhtAddI32PU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile u16* value) {
+  return fhtAddI32PU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, i32 value) {
+  return fhtAddI32I32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile i32* value) {
+  return fhtAddI32I32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, i32 value) {
+  return fhtAddI32PI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile i32* value) {
+  return fhtAddI32PI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, u32 value) {
+  return fhtAddI32U32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile u32* value) {
+  return fhtAddI32U32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, u32 value) {
+  return fhtAddI32PU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile u32* value) {
+  return fhtAddI32PU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, i64 value) {
+  return fhtAddI32I64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile i64* value) {
+  return fhtAddI32I64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, i64 value) {
+  return fhtAddI32PI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile i64* value) {
+  return fhtAddI32PI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, u64 value) {
+  return fhtAddI32U64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile u64* value) {
+  return fhtAddI32U64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, u64 value) {
+  return fhtAddI32PU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile u64* value) {
+  return fhtAddI32PU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, float value) {
+  return fhtAddI32Float(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile float* value) {
+  return fhtAddI32FloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, float value) {
+  return fhtAddI32PFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile float* value) {
+  return fhtAddI32PFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, double value) {
+  return fhtAddI32Double(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile double* value) {
+  return fhtAddI32DoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, double value) {
+  return fhtAddI32PDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile double* value) {
+  return fhtAddI32PDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, long double value) {
+  return fhtAddI32LongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile long double* value) {
+  return fhtAddI32LongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, long double value) {
+  return fhtAddI32PLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile long double* value) {
+  return fhtAddI32PLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, List value) {
+  return fhtAddI32List(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile List* value) {
+  return fhtAddI32ListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, List value) {
+  return fhtAddI32PList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile List* value) {
+  return fhtAddI32PListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, Queue value) {
+  return fhtAddI32Queue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile Queue* value) {
+  return fhtAddI32QueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, Queue value) {
+  return fhtAddI32PQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile Queue* value) {
+  return fhtAddI32PQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, Stack value) {
+  return fhtAddI32Stack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile Stack* value) {
+  return fhtAddI32StackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, Stack value) {
+  return fhtAddI32PStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile Stack* value) {
+  return fhtAddI32PStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, RedBlackTree value) {
+  return fhtAddI32RedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile RedBlackTree* value) {
+  return fhtAddI32RedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, RedBlackTree value) {
+  return fhtAddI32PRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile RedBlackTree* value) {
+  return fhtAddI32PRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, HashTable value) {
+  return fhtAddI32HashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile HashTable* value) {
+  return fhtAddI32HashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, HashTable value) {
+  return fhtAddI32PHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile HashTable* value) {
+  return fhtAddI32PHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, Vector value) {
+  return fhtAddI32Vector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile Vector* value) {
+  return fhtAddI32VectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, Vector value) {
+  return fhtAddI32PVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile Vector* value) {
+  return fhtAddI32PVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile char* value) {
+  return fhtAddI32String(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile char** value) {
+  return fhtAddI32StringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile char* value) {
+  return fhtAddI32PString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile char** value) {
+  return fhtAddI32PStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, Bytes value) {
+  return fhtAddI32Bytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile Bytes* value) {
+  return fhtAddI32BytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, Bytes value) {
+  return fhtAddI32PBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile Bytes* value) {
+  return fhtAddI32PBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, void* value) {
+  return fhtAddI32Pointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, const volatile void** value) {
+  return fhtAddI32PointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, void* value) {
+  return fhtAddI32PPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, const volatile void** value) {
+  return fhtAddI32PPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, i8 value) {
+  return fhtAddI32I8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, i8 value) {
+  return fhtAddI32PI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i32 key, u8 value) {
+  return fhtAddI32U8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i32* key, u8 value) {
+  return fhtAddI32PU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, bool value) {
+  return fhtAddU32Bool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile bool* value) {
+  return fhtAddU32BoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, bool value) {
+  return fhtAddU32PBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile bool* value) {
+  return fhtAddU32PBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, i16 value) {
+  return fhtAddU32I16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile i16* value) {
+  return fhtAddU32I16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, i16 value) {
+  return fhtAddU32PI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile i16* value) {
+  return fhtAddU32PI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, u16 value) {
+  return fhtAddU32U16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile u16* value) {
+  return fhtAddU32U16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, u16 value) {
+  return fhtAddU32PU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile u16* value) {
+  return fhtAddU32PU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, i32 value) {
+  return fhtAddU32I32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile i32* value) {
+  return fhtAddU32I32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, i32 value) {
+  return fhtAddU32PI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile i32* value) {
+  return fhtAddU32PI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, u32 value) {
+  return fhtAddU32U32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile u32* value) {
+  return fhtAddU32U32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, u32 value) {
+  return fhtAddU32PU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile u32* value) {
+  return fhtAddU32PU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, i64 value) {
+  return fhtAddU32I64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile i64* value) {
+  return fhtAddU32I64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, i64 value) {
+  return fhtAddU32PI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile i64* value) {
+  return fhtAddU32PI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, u64 value) {
+  return fhtAddU32U64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile u64* value) {
+  return fhtAddU32U64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, u64 value) {
+  return fhtAddU32PU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile u64* value) {
+  return fhtAddU32PU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, float value) {
+  return fhtAddU32Float(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile float* value) {
+  return fhtAddU32FloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, float value) {
+  return fhtAddU32PFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile float* value) {
+  return fhtAddU32PFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, double value) {
+  return fhtAddU32Double(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile double* value) {
+  return fhtAddU32DoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, double value) {
+  return fhtAddU32PDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile double* value) {
+  return fhtAddU32PDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, long double value) {
+  return fhtAddU32LongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile long double* value) {
+  return fhtAddU32LongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, long double value) {
+  return fhtAddU32PLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile long double* value) {
+  return fhtAddU32PLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, List value) {
+  return fhtAddU32List(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile List* value) {
+  return fhtAddU32ListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, List value) {
+  return fhtAddU32PList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile List* value) {
+  return fhtAddU32PListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, Queue value) {
+  return fhtAddU32Queue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile Queue* value) {
+  return fhtAddU32QueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, Queue value) {
+  return fhtAddU32PQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile Queue* value) {
+  return fhtAddU32PQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, Stack value) {
+  return fhtAddU32Stack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile Stack* value) {
+  return fhtAddU32StackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, Stack value) {
+  return fhtAddU32PStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile Stack* value) {
+  return fhtAddU32PStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, RedBlackTree value) {
+  return fhtAddU32RedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile RedBlackTree* value) {
+  return fhtAddU32RedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, RedBlackTree value) {
+  return fhtAddU32PRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile RedBlackTree* value) {
+  return fhtAddU32PRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, HashTable value) {
+  return fhtAddU32HashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile HashTable* value) {
+  return fhtAddU32HashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, HashTable value) {
+  return fhtAddU32PHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile HashTable* value) {
+  return fhtAddU32PHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, Vector value) {
+  return fhtAddU32Vector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile Vector* value) {
+  return fhtAddU32VectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, Vector value) {
+  return fhtAddU32PVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile Vector* value) {
+  return fhtAddU32PVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile char* value) {
+  return fhtAddU32String(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile char** value) {
+  return fhtAddU32StringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile char* value) {
+  return fhtAddU32PString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile char** value) {
+  return fhtAddU32PStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, Bytes value) {
+  return fhtAddU32Bytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile Bytes* value) {
+  return fhtAddU32BytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, Bytes value) {
+  return fhtAddU32PBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile Bytes* value) {
+  return fhtAddU32PBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, void* value) {
+  return fhtAddU32Pointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, const volatile void** value) {
+  return fhtAddU32PointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, void* value) {
+  return fhtAddU32PPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, const volatile void** value) {
+  return fhtAddU32PPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, i8 value) {
+  return fhtAddU32I8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, i8 value) {
+  return fhtAddU32PI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u32 key, u8 value) {
+  return fhtAddU32U8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u32* key, u8 value) {
+  return fhtAddU32PU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, bool value) {
+  return fhtAddI64Bool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile bool* value) {
+  return fhtAddI64BoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, bool value) {
+  return fhtAddI64PBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile bool* value) {
+  return fhtAddI64PBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, i16 value) {
+  return fhtAddI64I16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile i16* value) {
+  return fhtAddI64I16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, i16 value) {
+  return fhtAddI64PI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile i16* value) {
+  return fhtAddI64PI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, u16 value) {
+  return fhtAddI64U16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile u16* value) {
+  return fhtAddI64U16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, u16 value) {
+  return fhtAddI64PU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile u16* value) {
+  return fhtAddI64PU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, i32 value) {
+  return fhtAddI64I32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile i32* value) {
+  return fhtAddI64I32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, i32 value) {
+  return fhtAddI64PI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile i32* value) {
+  return fhtAddI64PI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, u32 value) {
+  return fhtAddI64U32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile u32* value) {
+  return fhtAddI64U32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, u32 value) {
+  return fhtAddI64PU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile u32* value) {
+  return fhtAddI64PU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, i64 value) {
+  return fhtAddI64I64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile i64* value) {
+  return fhtAddI64I64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, i64 value) {
+  return fhtAddI64PI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile i64* value) {
+  return fhtAddI64PI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, u64 value) {
+  return fhtAddI64U64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile u64* value) {
+  return fhtAddI64U64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, u64 value) {
+  return fhtAddI64PU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile u64* value) {
+  return fhtAddI64PU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, float value) {
+  return fhtAddI64Float(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile float* value) {
+  return fhtAddI64FloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, float value) {
+  return fhtAddI64PFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile float* value) {
+  return fhtAddI64PFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, double value) {
+  return fhtAddI64Double(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile double* value) {
+  return fhtAddI64DoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, double value) {
+  return fhtAddI64PDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile double* value) {
+  return fhtAddI64PDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, long double value) {
+  return fhtAddI64LongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile long double* value) {
+  return fhtAddI64LongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, long double value) {
+  return fhtAddI64PLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile long double* value) {
+  return fhtAddI64PLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, List value) {
+  return fhtAddI64List(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile List* value) {
+  return fhtAddI64ListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, List value) {
+  return fhtAddI64PList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile List* value) {
+  return fhtAddI64PListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, Queue value) {
+  return fhtAddI64Queue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile Queue* value) {
+  return fhtAddI64QueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, Queue value) {
+  return fhtAddI64PQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile Queue* value) {
+  return fhtAddI64PQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, Stack value) {
+  return fhtAddI64Stack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile Stack* value) {
+  return fhtAddI64StackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, Stack value) {
+  return fhtAddI64PStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile Stack* value) {
+  return fhtAddI64PStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, RedBlackTree value) {
+  return fhtAddI64RedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile RedBlackTree* value) {
+  return fhtAddI64RedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, RedBlackTree value) {
+  return fhtAddI64PRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile RedBlackTree* value) {
+  return fhtAddI64PRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, HashTable value) {
+  return fhtAddI64HashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile HashTable* value) {
+  return fhtAddI64HashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, HashTable value) {
+  return fhtAddI64PHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile HashTable* value) {
+  return fhtAddI64PHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, Vector value) {
+  return fhtAddI64Vector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile Vector* value) {
+  return fhtAddI64VectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, Vector value) {
+  return fhtAddI64PVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile Vector* value) {
+  return fhtAddI64PVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile char* value) {
+  return fhtAddI64String(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile char** value) {
+  return fhtAddI64StringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile char* value) {
+  return fhtAddI64PString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile char** value) {
+  return fhtAddI64PStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, Bytes value) {
+  return fhtAddI64Bytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile Bytes* value) {
+  return fhtAddI64BytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, Bytes value) {
+  return fhtAddI64PBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile Bytes* value) {
+  return fhtAddI64PBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, void* value) {
+  return fhtAddI64Pointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, const volatile void** value) {
+  return fhtAddI64PointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, void* value) {
+  return fhtAddI64PPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, const volatile void** value) {
+  return fhtAddI64PPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, i8 value) {
+  return fhtAddI64I8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, i8 value) {
+  return fhtAddI64PI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i64 key, u8 value) {
+  return fhtAddI64U8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile i64* key, u8 value) {
+  return fhtAddI64PU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, bool value) {
+  return fhtAddU64Bool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile bool* value) {
+  return fhtAddU64BoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, bool value) {
+  return fhtAddU64PBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile bool* value) {
+  return fhtAddU64PBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, i16 value) {
+  return fhtAddU64I16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile i16* value) {
+  return fhtAddU64I16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, i16 value) {
+  return fhtAddU64PI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile i16* value) {
+  return fhtAddU64PI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, u16 value) {
+  return fhtAddU64U16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile u16* value) {
+  return fhtAddU64U16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, u16 value) {
+  return fhtAddU64PU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile u16* value) {
+  return fhtAddU64PU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, i32 value) {
+  return fhtAddU64I32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile i32* value) {
+  return fhtAddU64I32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, i32 value) {
+  return fhtAddU64PI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile i32* value) {
+  return fhtAddU64PI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, u32 value) {
+  return fhtAddU64U32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile u32* value) {
+  return fhtAddU64U32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, u32 value) {
+  return fhtAddU64PU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile u32* value) {
+  return fhtAddU64PU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, i64 value) {
+  return fhtAddU64I64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile i64* value) {
+  return fhtAddU64I64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, i64 value) {
+  return fhtAddU64PI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile i64* value) {
+  return fhtAddU64PI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, u64 value) {
+  return fhtAddU64U64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile u64* value) {
+  return fhtAddU64U64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, u64 value) {
+  return fhtAddU64PU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile u64* value) {
+  return fhtAddU64PU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, float value) {
+  return fhtAddU64Float(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile float* value) {
+  return fhtAddU64FloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, float value) {
+  return fhtAddU64PFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile float* value) {
+  return fhtAddU64PFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, double value) {
+  return fhtAddU64Double(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile double* value) {
+  return fhtAddU64DoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, double value) {
+  return fhtAddU64PDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile double* value) {
+  return fhtAddU64PDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, long double value) {
+  return fhtAddU64LongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile long double* value) {
+  return fhtAddU64LongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, long double value) {
+  return fhtAddU64PLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile long double* value) {
+  return fhtAddU64PLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, List value) {
+  return fhtAddU64List(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile List* value) {
+  return fhtAddU64ListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, List value) {
+  return fhtAddU64PList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile List* value) {
+  return fhtAddU64PListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, Queue value) {
+  return fhtAddU64Queue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile Queue* value) {
+  return fhtAddU64QueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, Queue value) {
+  return fhtAddU64PQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile Queue* value) {
+  return fhtAddU64PQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, Stack value) {
+  return fhtAddU64Stack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile Stack* value) {
+  return fhtAddU64StackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, Stack value) {
+  return fhtAddU64PStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile Stack* value) {
+  return fhtAddU64PStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, RedBlackTree value) {
+  return fhtAddU64RedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile RedBlackTree* value) {
+  return fhtAddU64RedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, RedBlackTree value) {
+  return fhtAddU64PRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile RedBlackTree* value) {
+  return fhtAddU64PRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, HashTable value) {
+  return fhtAddU64HashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile HashTable* value) {
+  return fhtAddU64HashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, HashTable value) {
+  return fhtAddU64PHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile HashTable* value) {
+  return fhtAddU64PHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, Vector value) {
+  return fhtAddU64Vector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile Vector* value) {
+  return fhtAddU64VectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, Vector value) {
+  return fhtAddU64PVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile Vector* value) {
+  return fhtAddU64PVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile char* value) {
+  return fhtAddU64String(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile char** value) {
+  return fhtAddU64StringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile char* value) {
+  return fhtAddU64PString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile char** value) {
+  return fhtAddU64PStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, Bytes value) {
+  return fhtAddU64Bytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile Bytes* value) {
+  return fhtAddU64BytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, Bytes value) {
+  return fhtAddU64PBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile Bytes* value) {
+  return fhtAddU64PBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, void* value) {
+  return fhtAddU64Pointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, const volatile void** value) {
+  return fhtAddU64PointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, void* value) {
+  return fhtAddU64PPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, const volatile void** value) {
+  return fhtAddU64PPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, i8 value) {
+  return fhtAddU64I8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, i8 value) {
+  return fhtAddU64PI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u64 key, u8 value) {
+  return fhtAddU64U8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile u64* key, u8 value) {
+  return fhtAddU64PU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, bool value) {
+  return fhtAddFloatBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile bool* value) {
+  return fhtAddFloatBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, bool value) {
+  return fhtAddFloatPBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile bool* value) {
+  return fhtAddFloatPBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, i16 value) {
+  return fhtAddFloatI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile i16* value) {
+  return fhtAddFloatI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, i16 value) {
+  return fhtAddFloatPI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile i16* value) {
+  return fhtAddFloatPI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, u16 value) {
+  return fhtAddFloatU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile u16* value) {
+  return fhtAddFloatU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, u16 value) {
+  return fhtAddFloatPU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile u16* value) {
+  return fhtAddFloatPU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, i32 value) {
+  return fhtAddFloatI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile i32* value) {
+  return fhtAddFloatI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, i32 value) {
+  return fhtAddFloatPI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile i32* value) {
+  return fhtAddFloatPI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, u32 value) {
+  return fhtAddFloatU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile u32* value) {
+  return fhtAddFloatU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, u32 value) {
+  return fhtAddFloatPU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile u32* value) {
+  return fhtAddFloatPU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, i64 value) {
+  return fhtAddFloatI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile i64* value) {
+  return fhtAddFloatI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, i64 value) {
+  return fhtAddFloatPI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile i64* value) {
+  return fhtAddFloatPI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, u64 value) {
+  return fhtAddFloatU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile u64* value) {
+  return fhtAddFloatU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, u64 value) {
+  return fhtAddFloatPU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile u64* value) {
+  return fhtAddFloatPU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, float value) {
+  return fhtAddFloatFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile float* value) {
+  return fhtAddFloatFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, float value) {
+  return fhtAddFloatPFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile float* value) {
+  return fhtAddFloatPFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, double value) {
+  return fhtAddFloatDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile double* value) {
+  return fhtAddFloatDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, double value) {
+  return fhtAddFloatPDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile double* value) {
+  return fhtAddFloatPDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, long double value) {
+  return fhtAddFloatLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile long double* value) {
+  return fhtAddFloatLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, long double value) {
+  return fhtAddFloatPLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile long double* value) {
+  return fhtAddFloatPLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, List value) {
+  return fhtAddFloatList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile List* value) {
+  return fhtAddFloatListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, List value) {
+  return fhtAddFloatPList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile List* value) {
+  return fhtAddFloatPListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, Queue value) {
+  return fhtAddFloatQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile Queue* value) {
+  return fhtAddFloatQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, Queue value) {
+  return fhtAddFloatPQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile Queue* value) {
+  return fhtAddFloatPQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, Stack value) {
+  return fhtAddFloatStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile Stack* value) {
+  return fhtAddFloatStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, Stack value) {
+  return fhtAddFloatPStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile Stack* value) {
+  return fhtAddFloatPStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, RedBlackTree value) {
+  return fhtAddFloatRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile RedBlackTree* value) {
+  return fhtAddFloatRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, RedBlackTree value) {
+  return fhtAddFloatPRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile RedBlackTree* value) {
+  return fhtAddFloatPRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, HashTable value) {
+  return fhtAddFloatHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile HashTable* value) {
+  return fhtAddFloatHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, HashTable value) {
+  return fhtAddFloatPHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile HashTable* value) {
+  return fhtAddFloatPHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, Vector value) {
+  return fhtAddFloatVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile Vector* value) {
+  return fhtAddFloatVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, Vector value) {
+  return fhtAddFloatPVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile Vector* value) {
+  return fhtAddFloatPVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile char* value) {
+  return fhtAddFloatString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile char** value) {
+  return fhtAddFloatStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile char* value) {
+  return fhtAddFloatPString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile char** value) {
+  return fhtAddFloatPStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, Bytes value) {
+  return fhtAddFloatBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile Bytes* value) {
+  return fhtAddFloatBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, Bytes value) {
+  return fhtAddFloatPBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile Bytes* value) {
+  return fhtAddFloatPBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, void* value) {
+  return fhtAddFloatPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, const volatile void** value) {
+  return fhtAddFloatPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, void* value) {
+  return fhtAddFloatPPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, const volatile void** value) {
+  return fhtAddFloatPPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, i8 value) {
+  return fhtAddFloatI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, i8 value) {
+  return fhtAddFloatPI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, float key, u8 value) {
+  return fhtAddFloatU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile float* key, u8 value) {
+  return fhtAddFloatPU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, bool value) {
+  return fhtAddDoubleBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile bool* value) {
+  return fhtAddDoubleBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, bool value) {
+  return fhtAddDoublePBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile bool* value) {
+  return fhtAddDoublePBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, i16 value) {
+  return fhtAddDoubleI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile i16* value) {
+  return fhtAddDoubleI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, i16 value) {
+  return fhtAddDoublePI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile i16* value) {
+  return fhtAddDoublePI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, u16 value) {
+  return fhtAddDoubleU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile u16* value) {
+  return fhtAddDoubleU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, u16 value) {
+  return fhtAddDoublePU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile u16* value) {
+  return fhtAddDoublePU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, i32 value) {
+  return fhtAddDoubleI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile i32* value) {
+  return fhtAddDoubleI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, i32 value) {
+  return fhtAddDoublePI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile i32* value) {
+  return fhtAddDoublePI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, u32 value) {
+  return fhtAddDoubleU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile u32* value) {
+  return fhtAddDoubleU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, u32 value) {
+  return fhtAddDoublePU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile u32* value) {
+  return fhtAddDoublePU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, i64 value) {
+  return fhtAddDoubleI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile i64* value) {
+  return fhtAddDoubleI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, i64 value) {
+  return fhtAddDoublePI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile i64* value) {
+  return fhtAddDoublePI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, u64 value) {
+  return fhtAddDoubleU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile u64* value) {
+  return fhtAddDoubleU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, u64 value) {
+  return fhtAddDoublePU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile u64* value) {
+  return fhtAddDoublePU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, float value) {
+  return fhtAddDoubleFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile float* value) {
+  return fhtAddDoubleFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, float value) {
+  return fhtAddDoublePFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile float* value) {
+  return fhtAddDoublePFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, double value) {
+  return fhtAddDoubleDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile double* value) {
+  return fhtAddDoubleDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, double value) {
+  return fhtAddDoublePDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile double* value) {
+  return fhtAddDoublePDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, long double value) {
+  return fhtAddDoubleLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile long double* value) {
+  return fhtAddDoubleLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, long double value) {
+  return fhtAddDoublePLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile long double* value) {
+  return fhtAddDoublePLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, List value) {
+  return fhtAddDoubleList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile List* value) {
+  return fhtAddDoubleListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, List value) {
+  return fhtAddDoublePList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile List* value) {
+  return fhtAddDoublePListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, Queue value) {
+  return fhtAddDoubleQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile Queue* value) {
+  return fhtAddDoubleQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, Queue value) {
+  return fhtAddDoublePQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile Queue* value) {
+  return fhtAddDoublePQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, Stack value) {
+  return fhtAddDoubleStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile Stack* value) {
+  return fhtAddDoubleStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, Stack value) {
+  return fhtAddDoublePStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile Stack* value) {
+  return fhtAddDoublePStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, RedBlackTree value) {
+  return fhtAddDoubleRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile RedBlackTree* value) {
+  return fhtAddDoubleRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, RedBlackTree value) {
+  return fhtAddDoublePRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile RedBlackTree* value) {
+  return fhtAddDoublePRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, HashTable value) {
+  return fhtAddDoubleHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile HashTable* value) {
+  return fhtAddDoubleHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, HashTable value) {
+  return fhtAddDoublePHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile HashTable* value) {
+  return fhtAddDoublePHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, Vector value) {
+  return fhtAddDoubleVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile Vector* value) {
+  return fhtAddDoubleVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, Vector value) {
+  return fhtAddDoublePVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile Vector* value) {
+  return fhtAddDoublePVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile char* value) {
+  return fhtAddDoubleString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile char** value) {
+  return fhtAddDoubleStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile char* value) {
+  return fhtAddDoublePString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile char** value) {
+  return fhtAddDoublePStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, Bytes value) {
+  return fhtAddDoubleBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile Bytes* value) {
+  return fhtAddDoubleBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, Bytes value) {
+  return fhtAddDoublePBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile Bytes* value) {
+  return fhtAddDoublePBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, void* value) {
+  return fhtAddDoublePointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, const volatile void** value) {
+  return fhtAddDoublePointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, void* value) {
+  return fhtAddDoublePPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, const volatile void** value) {
+  return fhtAddDoublePPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, i8 value) {
+  return fhtAddDoubleI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, i8 value) {
+  return fhtAddDoublePI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, double key, u8 value) {
+  return fhtAddDoubleU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile double* key, u8 value) {
+  return fhtAddDoublePU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, bool value) {
+  return fhtAddLongDoubleBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile bool* value) {
+  return fhtAddLongDoubleBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, bool value) {
+  return fhtAddLongDoublePBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile bool* value) {
+  return fhtAddLongDoublePBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, i16 value) {
+  return fhtAddLongDoubleI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile i16* value) {
+  return fhtAddLongDoubleI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, i16 value) {
+  return fhtAddLongDoublePI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile i16* value) {
+  return fhtAddLongDoublePI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, u16 value) {
+  return fhtAddLongDoubleU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile u16* value) {
+  return fhtAddLongDoubleU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, u16 value) {
+  return fhtAddLongDoublePU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile u16* value) {
+  return fhtAddLongDoublePU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, i32 value) {
+  return fhtAddLongDoubleI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile i32* value) {
+  return fhtAddLongDoubleI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, i32 value) {
+  return fhtAddLongDoublePI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile i32* value) {
+  return fhtAddLongDoublePI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, u32 value) {
+  return fhtAddLongDoubleU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile u32* value) {
+  return fhtAddLongDoubleU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, u32 value) {
+  return fhtAddLongDoublePU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile u32* value) {
+  return fhtAddLongDoublePU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, i64 value) {
+  return fhtAddLongDoubleI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile i64* value) {
+  return fhtAddLongDoubleI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, i64 value) {
+  return fhtAddLongDoublePI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile i64* value) {
+  return fhtAddLongDoublePI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, u64 value) {
+  return fhtAddLongDoubleU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile u64* value) {
+  return fhtAddLongDoubleU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, u64 value) {
+  return fhtAddLongDoublePU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile u64* value) {
+  return fhtAddLongDoublePU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, float value) {
+  return fhtAddLongDoubleFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile float* value) {
+  return fhtAddLongDoubleFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, float value) {
+  return fhtAddLongDoublePFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile float* value) {
+  return fhtAddLongDoublePFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, double value) {
+  return fhtAddLongDoubleDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile double* value) {
+  return fhtAddLongDoubleDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, double value) {
+  return fhtAddLongDoublePDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile double* value) {
+  return fhtAddLongDoublePDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, long double value) {
+  return fhtAddLongDoubleLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile long double* value) {
+  return fhtAddLongDoubleLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, long double value) {
+  return fhtAddLongDoublePLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile long double* value) {
+  return fhtAddLongDoublePLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, List value) {
+  return fhtAddLongDoubleList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile List* value) {
+  return fhtAddLongDoubleListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, List value) {
+  return fhtAddLongDoublePList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile List* value) {
+  return fhtAddLongDoublePListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, Queue value) {
+  return fhtAddLongDoubleQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile Queue* value) {
+  return fhtAddLongDoubleQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, Queue value) {
+  return fhtAddLongDoublePQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile Queue* value) {
+  return fhtAddLongDoublePQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, Stack value) {
+  return fhtAddLongDoubleStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile Stack* value) {
+  return fhtAddLongDoubleStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, Stack value) {
+  return fhtAddLongDoublePStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile Stack* value) {
+  return fhtAddLongDoublePStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, RedBlackTree value) {
+  return fhtAddLongDoubleRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile RedBlackTree* value) {
+  return fhtAddLongDoubleRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, RedBlackTree value) {
+  return fhtAddLongDoublePRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile RedBlackTree* value) {
+  return fhtAddLongDoublePRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, HashTable value) {
+  return fhtAddLongDoubleHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile HashTable* value) {
+  return fhtAddLongDoubleHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, HashTable value) {
+  return fhtAddLongDoublePHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile HashTable* value) {
+  return fhtAddLongDoublePHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, Vector value) {
+  return fhtAddLongDoubleVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile Vector* value) {
+  return fhtAddLongDoubleVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, Vector value) {
+  return fhtAddLongDoublePVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile Vector* value) {
+  return fhtAddLongDoublePVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile char* value) {
+  return fhtAddLongDoubleString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile char** value) {
+  return fhtAddLongDoubleStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile char* value) {
+  return fhtAddLongDoublePString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile char** value) {
+  return fhtAddLongDoublePStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, Bytes value) {
+  return fhtAddLongDoubleBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile Bytes* value) {
+  return fhtAddLongDoubleBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, Bytes value) {
+  return fhtAddLongDoublePBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile Bytes* value) {
+  return fhtAddLongDoublePBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, void* value) {
+  return fhtAddLongDoublePointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, const volatile void** value) {
+  return fhtAddLongDoublePointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, void* value) {
+  return fhtAddLongDoublePPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, const volatile void** value) {
+  return fhtAddLongDoublePPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, i8 value) {
+  return fhtAddLongDoubleI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, i8 value) {
+  return fhtAddLongDoublePI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, long double key, u8 value) {
+  return fhtAddLongDoubleU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile long double* key, u8 value) {
+  return fhtAddLongDoublePU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, bool value) {
+  return fhtAddListBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile bool* value) {
+  return fhtAddListBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, bool value) {
+  return fhtAddListPBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile bool* value) {
+  return fhtAddListPBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, i16 value) {
+  return fhtAddListI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile i16* value) {
+  return fhtAddListI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, i16 value) {
+  return fhtAddListPI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile i16* value) {
+  return fhtAddListPI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, u16 value) {
+  return fhtAddListU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile u16* value) {
+  return fhtAddListU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, u16 value) {
+  return fhtAddListPU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile u16* value) {
+  return fhtAddListPU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, i32 value) {
+  return fhtAddListI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile i32* value) {
+  return fhtAddListI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, i32 value) {
+  return fhtAddListPI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile i32* value) {
+  return fhtAddListPI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, u32 value) {
+  return fhtAddListU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile u32* value) {
+  return fhtAddListU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, u32 value) {
+  return fhtAddListPU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile u32* value) {
+  return fhtAddListPU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, i64 value) {
+  return fhtAddListI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile i64* value) {
+  return fhtAddListI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, i64 value) {
+  return fhtAddListPI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile i64* value) {
+  return fhtAddListPI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, u64 value) {
+  return fhtAddListU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile u64* value) {
+  return fhtAddListU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, u64 value) {
+  return fhtAddListPU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile u64* value) {
+  return fhtAddListPU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, float value) {
+  return fhtAddListFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile float* value) {
+  return fhtAddListFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, float value) {
+  return fhtAddListPFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile float* value) {
+  return fhtAddListPFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, double value) {
+  return fhtAddListDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile double* value) {
+  return fhtAddListDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, double value) {
+  return fhtAddListPDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile double* value) {
+  return fhtAddListPDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, long double value) {
+  return fhtAddListLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile long double* value) {
+  return fhtAddListLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, long double value) {
+  return fhtAddListPLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile long double* value) {
+  return fhtAddListPLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, List value) {
+  return fhtAddListList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile List* value) {
+  return fhtAddListListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, List value) {
+  return fhtAddListPList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile List* value) {
+  return fhtAddListPListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, Queue value) {
+  return fhtAddListQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile Queue* value) {
+  return fhtAddListQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, Queue value) {
+  return fhtAddListPQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile Queue* value) {
+  return fhtAddListPQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, Stack value) {
+  return fhtAddListStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile Stack* value) {
+  return fhtAddListStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, Stack value) {
+  return fhtAddListPStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile Stack* value) {
+  return fhtAddListPStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, RedBlackTree value) {
+  return fhtAddListRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile RedBlackTree* value) {
+  return fhtAddListRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, RedBlackTree value) {
+  return fhtAddListPRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile RedBlackTree* value) {
+  return fhtAddListPRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, HashTable value) {
+  return fhtAddListHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile HashTable* value) {
+  return fhtAddListHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, HashTable value) {
+  return fhtAddListPHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile HashTable* value) {
+  return fhtAddListPHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, Vector value) {
+  return fhtAddListVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile Vector* value) {
+  return fhtAddListVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, Vector value) {
+  return fhtAddListPVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile Vector* value) {
+  return fhtAddListPVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile char* value) {
+  return fhtAddListString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile char** value) {
+  return fhtAddListStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile char* value) {
+  return fhtAddListPString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile char** value) {
+  return fhtAddListPStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, Bytes value) {
+  return fhtAddListBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile Bytes* value) {
+  return fhtAddListBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, Bytes value) {
+  return fhtAddListPBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile Bytes* value) {
+  return fhtAddListPBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, void* value) {
+  return fhtAddListPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, const volatile void** value) {
+  return fhtAddListPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, void* value) {
+  return fhtAddListPPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, const volatile void** value) {
+  return fhtAddListPPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, i8 value) {
+  return fhtAddListI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, i8 value) {
+  return fhtAddListPI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, List key, u8 value) {
+  return fhtAddListU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile List* key, u8 value) {
+  return fhtAddListPU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, bool value) {
+  return fhtAddQueueBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile bool* value) {
+  return fhtAddQueueBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, bool value) {
+  return fhtAddQueuePBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile bool* value) {
+  return fhtAddQueuePBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, i16 value) {
+  return fhtAddQueueI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile i16* value) {
+  return fhtAddQueueI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, i16 value) {
+  return fhtAddQueuePI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile i16* value) {
+  return fhtAddQueuePI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, u16 value) {
+  return fhtAddQueueU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile u16* value) {
+  return fhtAddQueueU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, u16 value) {
+  return fhtAddQueuePU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile u16* value) {
+  return fhtAddQueuePU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, i32 value) {
+  return fhtAddQueueI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile i32* value) {
+  return fhtAddQueueI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, i32 value) {
+  return fhtAddQueuePI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile i32* value) {
+  return fhtAddQueuePI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, u32 value) {
+  return fhtAddQueueU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile u32* value) {
+  return fhtAddQueueU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, u32 value) {
+  return fhtAddQueuePU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile u32* value) {
+  return fhtAddQueuePU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, i64 value) {
+  return fhtAddQueueI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile i64* value) {
+  return fhtAddQueueI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, i64 value) {
+  return fhtAddQueuePI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile i64* value) {
+  return fhtAddQueuePI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, u64 value) {
+  return fhtAddQueueU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile u64* value) {
+  return fhtAddQueueU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, u64 value) {
+  return fhtAddQueuePU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile u64* value) {
+  return fhtAddQueuePU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, float value) {
+  return fhtAddQueueFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile float* value) {
+  return fhtAddQueueFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, float value) {
+  return fhtAddQueuePFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile float* value) {
+  return fhtAddQueuePFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, double value) {
+  return fhtAddQueueDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile double* value) {
+  return fhtAddQueueDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, double value) {
+  return fhtAddQueuePDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile double* value) {
+  return fhtAddQueuePDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, long double value) {
+  return fhtAddQueueLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile long double* value) {
+  return fhtAddQueueLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, long double value) {
+  return fhtAddQueuePLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile long double* value) {
+  return fhtAddQueuePLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, List value) {
+  return fhtAddQueueList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile List* value) {
+  return fhtAddQueueListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, List value) {
+  return fhtAddQueuePList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile List* value) {
+  return fhtAddQueuePListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, Queue value) {
+  return fhtAddQueueQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile Queue* value) {
+  return fhtAddQueueQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, Queue value) {
+  return fhtAddQueuePQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile Queue* value) {
+  return fhtAddQueuePQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, Stack value) {
+  return fhtAddQueueStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile Stack* value) {
+  return fhtAddQueueStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, Stack value) {
+  return fhtAddQueuePStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile Stack* value) {
+  return fhtAddQueuePStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, RedBlackTree value) {
+  return fhtAddQueueRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile RedBlackTree* value) {
+  return fhtAddQueueRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, RedBlackTree value) {
+  return fhtAddQueuePRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile RedBlackTree* value) {
+  return fhtAddQueuePRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, HashTable value) {
+  return fhtAddQueueHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile HashTable* value) {
+  return fhtAddQueueHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, HashTable value) {
+  return fhtAddQueuePHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile HashTable* value) {
+  return fhtAddQueuePHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, Vector value) {
+  return fhtAddQueueVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile Vector* value) {
+  return fhtAddQueueVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, Vector value) {
+  return fhtAddQueuePVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile Vector* value) {
+  return fhtAddQueuePVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile char* value) {
+  return fhtAddQueueString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile char** value) {
+  return fhtAddQueueStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile char* value) {
+  return fhtAddQueuePString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile char** value) {
+  return fhtAddQueuePStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, Bytes value) {
+  return fhtAddQueueBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile Bytes* value) {
+  return fhtAddQueueBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, Bytes value) {
+  return fhtAddQueuePBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile Bytes* value) {
+  return fhtAddQueuePBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, void* value) {
+  return fhtAddQueuePointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, const volatile void** value) {
+  return fhtAddQueuePointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, void* value) {
+  return fhtAddQueuePPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, const volatile void** value) {
+  return fhtAddQueuePPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, i8 value) {
+  return fhtAddQueueI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, i8 value) {
+  return fhtAddQueuePI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Queue key, u8 value) {
+  return fhtAddQueueU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Queue* key, u8 value) {
+  return fhtAddQueuePU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, bool value) {
+  return fhtAddStackBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile bool* value) {
+  return fhtAddStackBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, bool value) {
+  return fhtAddStackPBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile bool* value) {
+  return fhtAddStackPBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, i16 value) {
+  return fhtAddStackI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile i16* value) {
+  return fhtAddStackI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, i16 value) {
+  return fhtAddStackPI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile i16* value) {
+  return fhtAddStackPI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, u16 value) {
+  return fhtAddStackU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile u16* value) {
+  return fhtAddStackU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, u16 value) {
+  return fhtAddStackPU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile u16* value) {
+  return fhtAddStackPU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, i32 value) {
+  return fhtAddStackI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile i32* value) {
+  return fhtAddStackI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, i32 value) {
+  return fhtAddStackPI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile i32* value) {
+  return fhtAddStackPI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, u32 value) {
+  return fhtAddStackU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile u32* value) {
+  return fhtAddStackU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, u32 value) {
+  return fhtAddStackPU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile u32* value) {
+  return fhtAddStackPU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, i64 value) {
+  return fhtAddStackI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile i64* value) {
+  return fhtAddStackI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, i64 value) {
+  return fhtAddStackPI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile i64* value) {
+  return fhtAddStackPI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, u64 value) {
+  return fhtAddStackU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile u64* value) {
+  return fhtAddStackU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, u64 value) {
+  return fhtAddStackPU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile u64* value) {
+  return fhtAddStackPU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, float value) {
+  return fhtAddStackFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile float* value) {
+  return fhtAddStackFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, float value) {
+  return fhtAddStackPFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile float* value) {
+  return fhtAddStackPFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, double value) {
+  return fhtAddStackDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile double* value) {
+  return fhtAddStackDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, double value) {
+  return fhtAddStackPDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile double* value) {
+  return fhtAddStackPDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, long double value) {
+  return fhtAddStackLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile long double* value) {
+  return fhtAddStackLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, long double value) {
+  return fhtAddStackPLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile long double* value) {
+  return fhtAddStackPLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, List value) {
+  return fhtAddStackList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile List* value) {
+  return fhtAddStackListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, List value) {
+  return fhtAddStackPList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile List* value) {
+  return fhtAddStackPListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, Queue value) {
+  return fhtAddStackQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile Queue* value) {
+  return fhtAddStackQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, Queue value) {
+  return fhtAddStackPQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile Queue* value) {
+  return fhtAddStackPQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, Stack value) {
+  return fhtAddStackStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile Stack* value) {
+  return fhtAddStackStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, Stack value) {
+  return fhtAddStackPStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile Stack* value) {
+  return fhtAddStackPStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, RedBlackTree value) {
+  return fhtAddStackRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile RedBlackTree* value) {
+  return fhtAddStackRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, RedBlackTree value) {
+  return fhtAddStackPRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile RedBlackTree* value) {
+  return fhtAddStackPRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, HashTable value) {
+  return fhtAddStackHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile HashTable* value) {
+  return fhtAddStackHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, HashTable value) {
+  return fhtAddStackPHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile HashTable* value) {
+  return fhtAddStackPHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, Vector value) {
+  return fhtAddStackVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile Vector* value) {
+  return fhtAddStackVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, Vector value) {
+  return fhtAddStackPVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile Vector* value) {
+  return fhtAddStackPVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile char* value) {
+  return fhtAddStackString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile char** value) {
+  return fhtAddStackStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile char* value) {
+  return fhtAddStackPString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile char** value) {
+  return fhtAddStackPStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, Bytes value) {
+  return fhtAddStackBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile Bytes* value) {
+  return fhtAddStackBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, Bytes value) {
+  return fhtAddStackPBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile Bytes* value) {
+  return fhtAddStackPBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, void* value) {
+  return fhtAddStackPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, const volatile void** value) {
+  return fhtAddStackPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, void* value) {
+  return fhtAddStackPPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, const volatile void** value) {
+  return fhtAddStackPPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, i8 value) {
+  return fhtAddStackI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, i8 value) {
+  return fhtAddStackPI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Stack key, u8 value) {
+  return fhtAddStackU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Stack* key, u8 value) {
+  return fhtAddStackPU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, bool value) {
+  return fhtAddRedBlackTreeBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile bool* value) {
+  return fhtAddRedBlackTreeBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, bool value) {
+  return fhtAddRedBlackTreePBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile bool* value) {
+  return fhtAddRedBlackTreePBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, i16 value) {
+  return fhtAddRedBlackTreeI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile i16* value) {
+  return fhtAddRedBlackTreeI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, i16 value) {
+  return fhtAddRedBlackTreePI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile i16* value) {
+  return fhtAddRedBlackTreePI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, u16 value) {
+  return fhtAddRedBlackTreeU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile u16* value) {
+  return fhtAddRedBlackTreeU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, u16 value) {
+  return fhtAddRedBlackTreePU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile u16* value) {
+  return fhtAddRedBlackTreePU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, i32 value) {
+  return fhtAddRedBlackTreeI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile i32* value) {
+  return fhtAddRedBlackTreeI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, i32 value) {
+  return fhtAddRedBlackTreePI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile i32* value) {
+  return fhtAddRedBlackTreePI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, u32 value) {
+  return fhtAddRedBlackTreeU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile u32* value) {
+  return fhtAddRedBlackTreeU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, u32 value) {
+  return fhtAddRedBlackTreePU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile u32* value) {
+  return fhtAddRedBlackTreePU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, i64 value) {
+  return fhtAddRedBlackTreeI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile i64* value) {
+  return fhtAddRedBlackTreeI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, i64 value) {
+  return fhtAddRedBlackTreePI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile i64* value) {
+  return fhtAddRedBlackTreePI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, u64 value) {
+  return fhtAddRedBlackTreeU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile u64* value) {
+  return fhtAddRedBlackTreeU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, u64 value) {
+  return fhtAddRedBlackTreePU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile u64* value) {
+  return fhtAddRedBlackTreePU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, float value) {
+  return fhtAddRedBlackTreeFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile float* value) {
+  return fhtAddRedBlackTreeFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, float value) {
+  return fhtAddRedBlackTreePFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile float* value) {
+  return fhtAddRedBlackTreePFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, double value) {
+  return fhtAddRedBlackTreeDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile double* value) {
+  return fhtAddRedBlackTreeDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, double value) {
+  return fhtAddRedBlackTreePDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile double* value) {
+  return fhtAddRedBlackTreePDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, long double value) {
+  return fhtAddRedBlackTreeLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile long double* value) {
+  return fhtAddRedBlackTreeLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, long double value) {
+  return fhtAddRedBlackTreePLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile long double* value) {
+  return fhtAddRedBlackTreePLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, List value) {
+  return fhtAddRedBlackTreeList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile List* value) {
+  return fhtAddRedBlackTreeListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, List value) {
+  return fhtAddRedBlackTreePList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile List* value) {
+  return fhtAddRedBlackTreePListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, Queue value) {
+  return fhtAddRedBlackTreeQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile Queue* value) {
+  return fhtAddRedBlackTreeQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, Queue value) {
+  return fhtAddRedBlackTreePQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile Queue* value) {
+  return fhtAddRedBlackTreePQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, Stack value) {
+  return fhtAddRedBlackTreeStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile Stack* value) {
+  return fhtAddRedBlackTreeStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, Stack value) {
+  return fhtAddRedBlackTreePStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile Stack* value) {
+  return fhtAddRedBlackTreePStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, RedBlackTree value) {
+  return fhtAddRedBlackTreeRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile RedBlackTree* value) {
+  return fhtAddRedBlackTreeRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, RedBlackTree value) {
+  return fhtAddRedBlackTreePRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile RedBlackTree* value) {
+  return fhtAddRedBlackTreePRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, HashTable value) {
+  return fhtAddRedBlackTreeHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile HashTable* value) {
+  return fhtAddRedBlackTreeHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, HashTable value) {
+  return fhtAddRedBlackTreePHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile HashTable* value) {
+  return fhtAddRedBlackTreePHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, Vector value) {
+  return fhtAddRedBlackTreeVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile Vector* value) {
+  return fhtAddRedBlackTreeVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, Vector value) {
+  return fhtAddRedBlackTreePVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile Vector* value) {
+  return fhtAddRedBlackTreePVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile char* value) {
+  return fhtAddRedBlackTreeString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile char** value) {
+  return fhtAddRedBlackTreeStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile char* value) {
+  return fhtAddRedBlackTreePString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile char** value) {
+  return fhtAddRedBlackTreePStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, Bytes value) {
+  return fhtAddRedBlackTreeBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile Bytes* value) {
+  return fhtAddRedBlackTreeBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, Bytes value) {
+  return fhtAddRedBlackTreePBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile Bytes* value) {
+  return fhtAddRedBlackTreePBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, void* value) {
+  return fhtAddRedBlackTreePointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, const volatile void** value) {
+  return fhtAddRedBlackTreePointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, void* value) {
+  return fhtAddRedBlackTreePPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, const volatile void** value) {
+  return fhtAddRedBlackTreePPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, i8 value) {
+  return fhtAddRedBlackTreeI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, i8 value) {
+  return fhtAddRedBlackTreePI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, RedBlackTree key, u8 value) {
+  return fhtAddRedBlackTreeU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile RedBlackTree* key, u8 value) {
+  return fhtAddRedBlackTreePU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, bool value) {
+  return fhtAddHashTableBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile bool* value) {
+  return fhtAddHashTableBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, bool value) {
+  return fhtAddHashTablePBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile bool* value) {
+  return fhtAddHashTablePBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, i16 value) {
+  return fhtAddHashTableI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile i16* value) {
+  return fhtAddHashTableI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, i16 value) {
+  return fhtAddHashTablePI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile i16* value) {
+  return fhtAddHashTablePI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, u16 value) {
+  return fhtAddHashTableU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile u16* value) {
+  return fhtAddHashTableU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, u16 value) {
+  return fhtAddHashTablePU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile u16* value) {
+  return fhtAddHashTablePU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, i32 value) {
+  return fhtAddHashTableI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile i32* value) {
+  return fhtAddHashTableI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, i32 value) {
+  return fhtAddHashTablePI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile i32* value) {
+  return fhtAddHashTablePI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, u32 value) {
+  return fhtAddHashTableU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile u32* value) {
+  return fhtAddHashTableU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, u32 value) {
+  return fhtAddHashTablePU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile u32* value) {
+  return fhtAddHashTablePU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, i64 value) {
+  return fhtAddHashTableI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile i64* value) {
+  return fhtAddHashTableI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, i64 value) {
+  return fhtAddHashTablePI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile i64* value) {
+  return fhtAddHashTablePI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, u64 value) {
+  return fhtAddHashTableU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile u64* value) {
+  return fhtAddHashTableU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, u64 value) {
+  return fhtAddHashTablePU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile u64* value) {
+  return fhtAddHashTablePU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, float value) {
+  return fhtAddHashTableFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile float* value) {
+  return fhtAddHashTableFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, float value) {
+  return fhtAddHashTablePFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile float* value) {
+  return fhtAddHashTablePFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, double value) {
+  return fhtAddHashTableDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile double* value) {
+  return fhtAddHashTableDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, double value) {
+  return fhtAddHashTablePDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile double* value) {
+  return fhtAddHashTablePDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, long double value) {
+  return fhtAddHashTableLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile long double* value) {
+  return fhtAddHashTableLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, long double value) {
+  return fhtAddHashTablePLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile long double* value) {
+  return fhtAddHashTablePLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, List value) {
+  return fhtAddHashTableList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile List* value) {
+  return fhtAddHashTableListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, List value) {
+  return fhtAddHashTablePList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile List* value) {
+  return fhtAddHashTablePListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, Queue value) {
+  return fhtAddHashTableQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile Queue* value) {
+  return fhtAddHashTableQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, Queue value) {
+  return fhtAddHashTablePQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile Queue* value) {
+  return fhtAddHashTablePQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, Stack value) {
+  return fhtAddHashTableStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile Stack* value) {
+  return fhtAddHashTableStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, Stack value) {
+  return fhtAddHashTablePStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile Stack* value) {
+  return fhtAddHashTablePStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, RedBlackTree value) {
+  return fhtAddHashTableRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile RedBlackTree* value) {
+  return fhtAddHashTableRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, RedBlackTree value) {
+  return fhtAddHashTablePRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile RedBlackTree* value) {
+  return fhtAddHashTablePRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, HashTable value) {
+  return fhtAddHashTableHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile HashTable* value) {
+  return fhtAddHashTableHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, HashTable value) {
+  return fhtAddHashTablePHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile HashTable* value) {
+  return fhtAddHashTablePHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, Vector value) {
+  return fhtAddHashTableVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile Vector* value) {
+  return fhtAddHashTableVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, Vector value) {
+  return fhtAddHashTablePVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile Vector* value) {
+  return fhtAddHashTablePVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile char* value) {
+  return fhtAddHashTableString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile char** value) {
+  return fhtAddHashTableStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile char* value) {
+  return fhtAddHashTablePString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile char** value) {
+  return fhtAddHashTablePStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, Bytes value) {
+  return fhtAddHashTableBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile Bytes* value) {
+  return fhtAddHashTableBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, Bytes value) {
+  return fhtAddHashTablePBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile Bytes* value) {
+  return fhtAddHashTablePBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, void* value) {
+  return fhtAddHashTablePointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, const volatile void** value) {
+  return fhtAddHashTablePointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, void* value) {
+  return fhtAddHashTablePPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, const volatile void** value) {
+  return fhtAddHashTablePPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, i8 value) {
+  return fhtAddHashTableI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, i8 value) {
+  return fhtAddHashTablePI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, HashTable key, u8 value) {
+  return fhtAddHashTableU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile HashTable* key, u8 value) {
+  return fhtAddHashTablePU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, bool value) {
+  return fhtAddVectorBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile bool* value) {
+  return fhtAddVectorBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, bool value) {
+  return fhtAddVectorPBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile bool* value) {
+  return fhtAddVectorPBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, i16 value) {
+  return fhtAddVectorI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile i16* value) {
+  return fhtAddVectorI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, i16 value) {
+  return fhtAddVectorPI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile i16* value) {
+  return fhtAddVectorPI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, u16 value) {
+  return fhtAddVectorU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile u16* value) {
+  return fhtAddVectorU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, u16 value) {
+  return fhtAddVectorPU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile u16* value) {
+  return fhtAddVectorPU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, i32 value) {
+  return fhtAddVectorI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile i32* value) {
+  return fhtAddVectorI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, i32 value) {
+  return fhtAddVectorPI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile i32* value) {
+  return fhtAddVectorPI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, u32 value) {
+  return fhtAddVectorU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile u32* value) {
+  return fhtAddVectorU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, u32 value) {
+  return fhtAddVectorPU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile u32* value) {
+  return fhtAddVectorPU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, i64 value) {
+  return fhtAddVectorI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile i64* value) {
+  return fhtAddVectorI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, i64 value) {
+  return fhtAddVectorPI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile i64* value) {
+  return fhtAddVectorPI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, u64 value) {
+  return fhtAddVectorU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile u64* value) {
+  return fhtAddVectorU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, u64 value) {
+  return fhtAddVectorPU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile u64* value) {
+  return fhtAddVectorPU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, float value) {
+  return fhtAddVectorFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile float* value) {
+  return fhtAddVectorFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, float value) {
+  return fhtAddVectorPFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile float* value) {
+  return fhtAddVectorPFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, double value) {
+  return fhtAddVectorDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile double* value) {
+  return fhtAddVectorDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, double value) {
+  return fhtAddVectorPDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile double* value) {
+  return fhtAddVectorPDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, long double value) {
+  return fhtAddVectorLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile long double* value) {
+  return fhtAddVectorLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, long double value) {
+  return fhtAddVectorPLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile long double* value) {
+  return fhtAddVectorPLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, List value) {
+  return fhtAddVectorList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile List* value) {
+  return fhtAddVectorListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, List value) {
+  return fhtAddVectorPList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile List* value) {
+  return fhtAddVectorPListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, Queue value) {
+  return fhtAddVectorQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile Queue* value) {
+  return fhtAddVectorQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, Queue value) {
+  return fhtAddVectorPQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile Queue* value) {
+  return fhtAddVectorPQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, Stack value) {
+  return fhtAddVectorStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile Stack* value) {
+  return fhtAddVectorStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, Stack value) {
+  return fhtAddVectorPStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile Stack* value) {
+  return fhtAddVectorPStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, RedBlackTree value) {
+  return fhtAddVectorRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile RedBlackTree* value) {
+  return fhtAddVectorRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, RedBlackTree value) {
+  return fhtAddVectorPRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile RedBlackTree* value) {
+  return fhtAddVectorPRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, HashTable value) {
+  return fhtAddVectorHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile HashTable* value) {
+  return fhtAddVectorHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, HashTable value) {
+  return fhtAddVectorPHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile HashTable* value) {
+  return fhtAddVectorPHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, Vector value) {
+  return fhtAddVectorVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile Vector* value) {
+  return fhtAddVectorVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, Vector value) {
+  return fhtAddVectorPVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile Vector* value) {
+  return fhtAddVectorPVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile char* value) {
+  return fhtAddVectorString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile char** value) {
+  return fhtAddVectorStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile char* value) {
+  return fhtAddVectorPString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile char** value) {
+  return fhtAddVectorPStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, Bytes value) {
+  return fhtAddVectorBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile Bytes* value) {
+  return fhtAddVectorBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, Bytes value) {
+  return fhtAddVectorPBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile Bytes* value) {
+  return fhtAddVectorPBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, void* value) {
+  return fhtAddVectorPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, const volatile void** value) {
+  return fhtAddVectorPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, void* value) {
+  return fhtAddVectorPPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, const volatile void** value) {
+  return fhtAddVectorPPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, i8 value) {
+  return fhtAddVectorI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, i8 value) {
+  return fhtAddVectorPI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Vector key, u8 value) {
+  return fhtAddVectorU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Vector* key, u8 value) {
+  return fhtAddVectorPU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, bool value) {
+  return fhtAddStringBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile bool* value) {
+  return fhtAddStringBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, bool value) {
+  return fhtAddStringPBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile bool* value) {
+  return fhtAddStringPBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, i16 value) {
+  return fhtAddStringI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile i16* value) {
+  return fhtAddStringI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, i16 value) {
+  return fhtAddStringPI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile i16* value) {
+  return fhtAddStringPI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, u16 value) {
+  return fhtAddStringU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile u16* value) {
+  return fhtAddStringU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, u16 value) {
+  return fhtAddStringPU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile u16* value) {
+  return fhtAddStringPU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, i32 value) {
+  return fhtAddStringI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile i32* value) {
+  return fhtAddStringI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, i32 value) {
+  return fhtAddStringPI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile i32* value) {
+  return fhtAddStringPI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, u32 value) {
+  return fhtAddStringU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile u32* value) {
+  return fhtAddStringU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, u32 value) {
+  return fhtAddStringPU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile u32* value) {
+  return fhtAddStringPU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, i64 value) {
+  return fhtAddStringI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile i64* value) {
+  return fhtAddStringI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, i64 value) {
+  return fhtAddStringPI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile i64* value) {
+  return fhtAddStringPI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, u64 value) {
+  return fhtAddStringU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile u64* value) {
+  return fhtAddStringU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, u64 value) {
+  return fhtAddStringPU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile u64* value) {
+  return fhtAddStringPU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, float value) {
+  return fhtAddStringFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile float* value) {
+  return fhtAddStringFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, float value) {
+  return fhtAddStringPFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile float* value) {
+  return fhtAddStringPFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, double value) {
+  return fhtAddStringDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile double* value) {
+  return fhtAddStringDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, double value) {
+  return fhtAddStringPDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile double* value) {
+  return fhtAddStringPDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, long double value) {
+  return fhtAddStringLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile long double* value) {
+  return fhtAddStringLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, long double value) {
+  return fhtAddStringPLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile long double* value) {
+  return fhtAddStringPLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, List value) {
+  return fhtAddStringList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile List* value) {
+  return fhtAddStringListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, List value) {
+  return fhtAddStringPList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile List* value) {
+  return fhtAddStringPListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, Queue value) {
+  return fhtAddStringQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile Queue* value) {
+  return fhtAddStringQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, Queue value) {
+  return fhtAddStringPQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile Queue* value) {
+  return fhtAddStringPQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, Stack value) {
+  return fhtAddStringStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile Stack* value) {
+  return fhtAddStringStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, Stack value) {
+  return fhtAddStringPStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile Stack* value) {
+  return fhtAddStringPStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, RedBlackTree value) {
+  return fhtAddStringRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile RedBlackTree* value) {
+  return fhtAddStringRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, RedBlackTree value) {
+  return fhtAddStringPRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile RedBlackTree* value) {
+  return fhtAddStringPRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, HashTable value) {
+  return fhtAddStringHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile HashTable* value) {
+  return fhtAddStringHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, HashTable value) {
+  return fhtAddStringPHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile HashTable* value) {
+  return fhtAddStringPHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, Vector value) {
+  return fhtAddStringVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile Vector* value) {
+  return fhtAddStringVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, Vector value) {
+  return fhtAddStringPVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile Vector* value) {
+  return fhtAddStringPVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile char* value) {
+  return fhtAddStringString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile char** value) {
+  return fhtAddStringStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile char* value) {
+  return fhtAddStringPString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile char** value) {
+  return fhtAddStringPStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, Bytes value) {
+  return fhtAddStringBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile Bytes* value) {
+  return fhtAddStringBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, Bytes value) {
+  return fhtAddStringPBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile Bytes* value) {
+  return fhtAddStringPBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, void* value) {
+  return fhtAddStringPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, const volatile void** value) {
+  return fhtAddStringPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, void* value) {
+  return fhtAddStringPPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, const volatile void** value) {
+  return fhtAddStringPPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, i8 value) {
+  return fhtAddStringI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, i8 value) {
+  return fhtAddStringPI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char* key, u8 value) {
+  return fhtAddStringU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile char** key, u8 value) {
+  return fhtAddStringPU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, bool value) {
+  return fhtAddBytesBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile bool* value) {
+  return fhtAddBytesBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, bool value) {
+  return fhtAddBytesPBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile bool* value) {
+  return fhtAddBytesPBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, i16 value) {
+  return fhtAddBytesI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile i16* value) {
+  return fhtAddBytesI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, i16 value) {
+  return fhtAddBytesPI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile i16* value) {
+  return fhtAddBytesPI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, u16 value) {
+  return fhtAddBytesU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile u16* value) {
+  return fhtAddBytesU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, u16 value) {
+  return fhtAddBytesPU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile u16* value) {
+  return fhtAddBytesPU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, i32 value) {
+  return fhtAddBytesI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile i32* value) {
+  return fhtAddBytesI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, i32 value) {
+  return fhtAddBytesPI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile i32* value) {
+  return fhtAddBytesPI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, u32 value) {
+  return fhtAddBytesU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile u32* value) {
+  return fhtAddBytesU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, u32 value) {
+  return fhtAddBytesPU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile u32* value) {
+  return fhtAddBytesPU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, i64 value) {
+  return fhtAddBytesI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile i64* value) {
+  return fhtAddBytesI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, i64 value) {
+  return fhtAddBytesPI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile i64* value) {
+  return fhtAddBytesPI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, u64 value) {
+  return fhtAddBytesU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile u64* value) {
+  return fhtAddBytesU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, u64 value) {
+  return fhtAddBytesPU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile u64* value) {
+  return fhtAddBytesPU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, float value) {
+  return fhtAddBytesFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile float* value) {
+  return fhtAddBytesFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, float value) {
+  return fhtAddBytesPFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile float* value) {
+  return fhtAddBytesPFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, double value) {
+  return fhtAddBytesDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile double* value) {
+  return fhtAddBytesDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, double value) {
+  return fhtAddBytesPDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile double* value) {
+  return fhtAddBytesPDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, long double value) {
+  return fhtAddBytesLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile long double* value) {
+  return fhtAddBytesLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, long double value) {
+  return fhtAddBytesPLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile long double* value) {
+  return fhtAddBytesPLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, List value) {
+  return fhtAddBytesList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile List* value) {
+  return fhtAddBytesListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, List value) {
+  return fhtAddBytesPList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile List* value) {
+  return fhtAddBytesPListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, Queue value) {
+  return fhtAddBytesQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile Queue* value) {
+  return fhtAddBytesQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, Queue value) {
+  return fhtAddBytesPQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile Queue* value) {
+  return fhtAddBytesPQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, Stack value) {
+  return fhtAddBytesStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile Stack* value) {
+  return fhtAddBytesStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, Stack value) {
+  return fhtAddBytesPStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile Stack* value) {
+  return fhtAddBytesPStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, RedBlackTree value) {
+  return fhtAddBytesRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile RedBlackTree* value) {
+  return fhtAddBytesRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, RedBlackTree value) {
+  return fhtAddBytesPRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile RedBlackTree* value) {
+  return fhtAddBytesPRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, HashTable value) {
+  return fhtAddBytesHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile HashTable* value) {
+  return fhtAddBytesHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, HashTable value) {
+  return fhtAddBytesPHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile HashTable* value) {
+  return fhtAddBytesPHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, Vector value) {
+  return fhtAddBytesVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile Vector* value) {
+  return fhtAddBytesVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, Vector value) {
+  return fhtAddBytesPVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile Vector* value) {
+  return fhtAddBytesPVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile char* value) {
+  return fhtAddBytesString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile char** value) {
+  return fhtAddBytesStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile char* value) {
+  return fhtAddBytesPString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile char** value) {
+  return fhtAddBytesPStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, Bytes value) {
+  return fhtAddBytesBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile Bytes* value) {
+  return fhtAddBytesBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, Bytes value) {
+  return fhtAddBytesPBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile Bytes* value) {
+  return fhtAddBytesPBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, void* value) {
+  return fhtAddBytesPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, const volatile void** value) {
+  return fhtAddBytesPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, void* value) {
+  return fhtAddBytesPPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, const volatile void** value) {
+  return fhtAddBytesPPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, i8 value) {
+  return fhtAddBytesI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, i8 value) {
+  return fhtAddBytesPI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, Bytes key, u8 value) {
+  return fhtAddBytesU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile Bytes* key, u8 value) {
+  return fhtAddBytesPU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, bool value) {
+  return fhtAddPointerBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile bool* value) {
+  return fhtAddPointerBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, bool value) {
+  return fhtAddPointerPBool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile bool* value) {
+  return fhtAddPointerPBoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, i16 value) {
+  return fhtAddPointerI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile i16* value) {
+  return fhtAddPointerI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, i16 value) {
+  return fhtAddPointerPI16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile i16* value) {
+  return fhtAddPointerPI16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, u16 value) {
+  return fhtAddPointerU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile u16* value) {
+  return fhtAddPointerU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, u16 value) {
+  return fhtAddPointerPU16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile u16* value) {
+  return fhtAddPointerPU16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, i32 value) {
+  return fhtAddPointerI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile i32* value) {
+  return fhtAddPointerI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, i32 value) {
+  return fhtAddPointerPI32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile i32* value) {
+  return fhtAddPointerPI32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, u32 value) {
+  return fhtAddPointerU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile u32* value) {
+  return fhtAddPointerU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, u32 value) {
+  return fhtAddPointerPU32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile u32* value) {
+  return fhtAddPointerPU32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, i64 value) {
+  return fhtAddPointerI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile i64* value) {
+  return fhtAddPointerI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, i64 value) {
+  return fhtAddPointerPI64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile i64* value) {
+  return fhtAddPointerPI64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, u64 value) {
+  return fhtAddPointerU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile u64* value) {
+  return fhtAddPointerU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, u64 value) {
+  return fhtAddPointerPU64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile u64* value) {
+  return fhtAddPointerPU64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, float value) {
+  return fhtAddPointerFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile float* value) {
+  return fhtAddPointerFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, float value) {
+  return fhtAddPointerPFloat(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile float* value) {
+  return fhtAddPointerPFloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, double value) {
+  return fhtAddPointerDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile double* value) {
+  return fhtAddPointerDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, double value) {
+  return fhtAddPointerPDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile double* value) {
+  return fhtAddPointerPDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, long double value) {
+  return fhtAddPointerLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile long double* value) {
+  return fhtAddPointerLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, long double value) {
+  return fhtAddPointerPLongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile long double* value) {
+  return fhtAddPointerPLongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, List value) {
+  return fhtAddPointerList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile List* value) {
+  return fhtAddPointerListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, List value) {
+  return fhtAddPointerPList(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile List* value) {
+  return fhtAddPointerPListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, Queue value) {
+  return fhtAddPointerQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile Queue* value) {
+  return fhtAddPointerQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, Queue value) {
+  return fhtAddPointerPQueue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile Queue* value) {
+  return fhtAddPointerPQueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, Stack value) {
+  return fhtAddPointerStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile Stack* value) {
+  return fhtAddPointerStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, Stack value) {
+  return fhtAddPointerPStack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile Stack* value) {
+  return fhtAddPointerPStackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, RedBlackTree value) {
+  return fhtAddPointerRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile RedBlackTree* value) {
+  return fhtAddPointerRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, RedBlackTree value) {
+  return fhtAddPointerPRedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile RedBlackTree* value) {
+  return fhtAddPointerPRedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, HashTable value) {
+  return fhtAddPointerHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile HashTable* value) {
+  return fhtAddPointerHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, HashTable value) {
+  return fhtAddPointerPHashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile HashTable* value) {
+  return fhtAddPointerPHashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, Vector value) {
+  return fhtAddPointerVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile Vector* value) {
+  return fhtAddPointerVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, Vector value) {
+  return fhtAddPointerPVector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile Vector* value) {
+  return fhtAddPointerPVectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile char* value) {
+  return fhtAddPointerString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile char** value) {
+  return fhtAddPointerStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile char* value) {
+  return fhtAddPointerPString(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile char** value) {
+  return fhtAddPointerPStringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, Bytes value) {
+  return fhtAddPointerBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile Bytes* value) {
+  return fhtAddPointerBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, Bytes value) {
+  return fhtAddPointerPBytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile Bytes* value) {
+  return fhtAddPointerPBytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, void* value) {
+  return fhtAddPointerPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, const volatile void** value) {
+  return fhtAddPointerPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, void* value) {
+  return fhtAddPointerPPointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, const volatile void** value) {
+  return fhtAddPointerPPointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, i8 value) {
+  return fhtAddPointerI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, i8 value) {
+  return fhtAddPointerPI8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, void* key, u8 value) {
+  return fhtAddPointerU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, const volatile void** key, u8 value) {
+  return fhtAddPointerPU8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, bool value) {
+  return fhtAddI8Bool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile bool* value) {
+  return fhtAddI8BoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, i16 value) {
+  return fhtAddI8I16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile i16* value) {
+  return fhtAddI8I16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, u16 value) {
+  return fhtAddI8U16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile u16* value) {
+  return fhtAddI8U16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, i32 value) {
+  return fhtAddI8I32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile i32* value) {
+  return fhtAddI8I32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, u32 value) {
+  return fhtAddI8U32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile u32* value) {
+  return fhtAddI8U32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, i64 value) {
+  return fhtAddI8I64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile i64* value) {
+  return fhtAddI8I64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, u64 value) {
+  return fhtAddI8U64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile u64* value) {
+  return fhtAddI8U64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, float value) {
+  return fhtAddI8Float(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile float* value) {
+  return fhtAddI8FloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, double value) {
+  return fhtAddI8Double(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile double* value) {
+  return fhtAddI8DoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, long double value) {
+  return fhtAddI8LongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile long double* value) {
+  return fhtAddI8LongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, List value) {
+  return fhtAddI8List(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile List* value) {
+  return fhtAddI8ListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, Queue value) {
+  return fhtAddI8Queue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile Queue* value) {
+  return fhtAddI8QueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, Stack value) {
+  return fhtAddI8Stack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile Stack* value) {
+  return fhtAddI8StackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, RedBlackTree value) {
+  return fhtAddI8RedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile RedBlackTree* value) {
+  return fhtAddI8RedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, HashTable value) {
+  return fhtAddI8HashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile HashTable* value) {
+  return fhtAddI8HashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, Vector value) {
+  return fhtAddI8Vector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile Vector* value) {
+  return fhtAddI8VectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile char* value) {
+  return fhtAddI8String(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile char** value) {
+  return fhtAddI8StringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, Bytes value) {
+  return fhtAddI8Bytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile Bytes* value) {
+  return fhtAddI8BytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, void* value) {
+  return fhtAddI8Pointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, const volatile void** value) {
+  return fhtAddI8PointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, i8 value) {
+  return fhtAddI8I8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, i8 key, u8 value) {
+  return fhtAddI8U8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, bool value) {
+  return fhtAddU8Bool(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile bool* value) {
+  return fhtAddU8BoolP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, i16 value) {
+  return fhtAddU8I16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile i16* value) {
+  return fhtAddU8I16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, u16 value) {
+  return fhtAddU8U16(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile u16* value) {
+  return fhtAddU8U16P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, i32 value) {
+  return fhtAddU8I32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile i32* value) {
+  return fhtAddU8I32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, u32 value) {
+  return fhtAddU8U32(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile u32* value) {
+  return fhtAddU8U32P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, i64 value) {
+  return fhtAddU8I64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile i64* value) {
+  return fhtAddU8I64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, u64 value) {
+  return fhtAddU8U64(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile u64* value) {
+  return fhtAddU8U64P(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, float value) {
+  return fhtAddU8Float(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile float* value) {
+  return fhtAddU8FloatP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, double value) {
+  return fhtAddU8Double(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile double* value) {
+  return fhtAddU8DoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, long double value) {
+  return fhtAddU8LongDouble(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile long double* value) {
+  return fhtAddU8LongDoubleP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, List value) {
+  return fhtAddU8List(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile List* value) {
+  return fhtAddU8ListP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, Queue value) {
+  return fhtAddU8Queue(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile Queue* value) {
+  return fhtAddU8QueueP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, Stack value) {
+  return fhtAddU8Stack(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile Stack* value) {
+  return fhtAddU8StackP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, RedBlackTree value) {
+  return fhtAddU8RedBlackTree(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile RedBlackTree* value) {
+  return fhtAddU8RedBlackTreeP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, HashTable value) {
+  return fhtAddU8HashTable(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile HashTable* value) {
+  return fhtAddU8HashTableP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, Vector value) {
+  return fhtAddU8Vector(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile Vector* value) {
+  return fhtAddU8VectorP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile char* value) {
+  return fhtAddU8String(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile char** value) {
+  return fhtAddU8StringP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, Bytes value) {
+  return fhtAddU8Bytes(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile Bytes* value) {
+  return fhtAddU8BytesP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, void* value) {
+  return fhtAddU8Pointer(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, const volatile void** value) {
+  return fhtAddU8PointerP(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, i8 value) {
+  return fhtAddU8I8(dataStructure, key, value);
+}
+static inline FlatHashTableEntry* fhtAdd(FlatHashTable *dataStructure, u8 key, u8 value) {
+  return fhtAddU8U8(dataStructure, key, value);
+}
+
+#endif // __cplusplus
+
+#endif // TYPE_SAFE_FHT_ADD_H
+
@@ -0,0 +1,308 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              TypeSafeVectorData.h
+///
+/// @brief             This header contains type-safe accessors for the raw
+///                    value arrays of Vectors of primitive types and
+///                    type-safe versions of the vectorSetRange function.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TYPE_SAFE_VECTOR_DATA_H
+#define TYPE_SAFE_VECTOR_DATA_H
+
+#include "DataTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Type-safe inline functions.  vectorXData returns the vector's contiguous
+// array of values (or NULL if the vector doesn't hold X values), vectorGetX
+// returns the value at an index (or 0 if there is none), and vectorSetXRange
+// copies count values into consecutive indexes.
+
+static inline bool* vectorBoolData(Vector *dataStructure) {
+  return (bool*) vectorData(dataStructure, typeBool);
+}
+static inline bool vectorGetBool(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeBool)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((bool*) dataStructure->data)[index];
+}
+static inline i32 vectorSetBoolRange(Vector *dataStructure, u64 index, const bool* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeBool);
+}
+static inline i8* vectorI8Data(Vector *dataStructure) {
+  return (i8*) vectorData(dataStructure, typeI8);
+}
+static inline i8 vectorGetI8(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeI8)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((i8*) dataStructure->data)[index];
+}
+static inline i32 vectorSetI8Range(Vector *dataStructure, u64 index, const i8* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeI8);
+}
+static inline u8* vectorU8Data(Vector *dataStructure) {
+  return (u8*) vectorData(dataStructure, typeU8);
+}
+static inline u8 vectorGetU8(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeU8)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((u8*) dataStructure->data)[index];
+}
+static inline i32 vectorSetU8Range(Vector *dataStructure, u64 index, const u8* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeU8);
+}
+static inline i16* vectorI16Data(Vector *dataStructure) {
+  return (i16*) vectorData(dataStructure, typeI16);
+}
+static inline i16 vectorGetI16(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeI16)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((i16*) dataStructure->data)[index];
+}
+static inline i32 vectorSetI16Range(Vector *dataStructure, u64 index, const i16* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeI16);
+}
+static inline u16* vectorU16Data(Vector *dataStructure) {
+  return (u16*) vectorData(dataStructure, typeU16);
+}
+static inline u16 vectorGetU16(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeU16)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((u16*) dataStructure->data)[index];
+}
+static inline i32 vectorSetU16Range(Vector *dataStructure, u64 index, const u16* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeU16);
+}
+static inline i32* vectorI32Data(Vector *dataStructure) {
+  return (i32*) vectorData(dataStructure, typeI32);
+}
+static inline i32 vectorGetI32(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeI32)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((i32*) dataStructure->data)[index];
+}
+static inline i32 vectorSetI32Range(Vector *dataStructure, u64 index, const i32* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeI32);
+}
+static inline u32* vectorU32Data(Vector *dataStructure) {
+  return (u32*) vectorData(dataStructure, typeU32);
+}
+static inline u32 vectorGetU32(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeU32)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((u32*) dataStructure->data)[index];
+}
+static inline i32 vectorSetU32Range(Vector *dataStructure, u64 index, const u32* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeU32);
+}
+static inline i64* vectorI64Data(Vector *dataStructure) {
+  return (i64*) vectorData(dataStructure, typeI64);
+}
+static inline i64 vectorGetI64(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeI64)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((i64*) dataStructure->data)[index];
+}
+static inline i32 vectorSetI64Range(Vector *dataStructure, u64 index, const i64* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeI64);
+}
+static inline u64* vectorU64Data(Vector *dataStructure) {
+  return (u64*) vectorData(dataStructure, typeU64);
+}
+static inline u64 vectorGetU64(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeU64)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((u64*) dataStructure->data)[index];
+}
+static inline i32 vectorSetU64Range(Vector *dataStructure, u64 index, const u64* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeU64);
+}
+static inline float* vectorFloatData(Vector *dataStructure) {
+  return (float*) vectorData(dataStructure, typeFloat);
+}
+static inline float vectorGetFloat(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeFloat)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((float*) dataStructure->data)[index];
+}
+static inline i32 vectorSetFloatRange(Vector *dataStructure, u64 index, const float* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeFloat);
+}
+static inline double* vectorDoubleData(Vector *dataStructure) {
+  return (double*) vectorData(dataStructure, typeDouble);
+}
+static inline double vectorGetDouble(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeDouble)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((double*) dataStructure->data)[index];
+}
+static inline i32 vectorSetDoubleRange(Vector *dataStructure, u64 index, const double* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeDouble);
+}
+static inline long double* vectorLongDoubleData(Vector *dataStructure) {
+  return (long double*) vectorData(dataStructure, typeLongDouble);
+}
+static inline long double vectorGetLongDouble(const Vector *dataStructure, u64 index) {
+  if ((dataStructure == NULL) || (dataStructure->valueType != typeLongDouble)
+    || (index >= dataStructure->size)
+  ) {
+    return 0;
+  }
+  return ((long double*) dataStructure->data)[index];
+}
+static inline i32 vectorSetLongDoubleRange(Vector *dataStructure, u64 index, const long double* values, u64 count) {
+  return vectorSetRange(dataStructure, index, values, count, typeLongDouble);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#if defined __STDC_VERSION__
+
+#if __STDC_VERSION__ >= 201710L
+#define TYPE_SAFE_VECTOR_DATA
+
+#define VECTOR_SET_VALUES_GENERIC_CASES(dataStructure, index, values, count) \
+  bool*:                 vectorSetBoolRange,        \
+  const bool*:           vectorSetBoolRange,        \
+  i8*:                   vectorSetI8Range,          \
+  const i8*:             vectorSetI8Range,          \
+  u8*:                   vectorSetU8Range,          \
+  const u8*:             vectorSetU8Range,          \
+  i16*:                  vectorSetI16Range,         \
+  const i16*:            vectorSetI16Range,         \
+  u16*:                  vectorSetU16Range,         \
+  const u16*:            vectorSetU16Range,         \
+  i32*:                  vectorSetI32Range,         \
+  const i32*:            vectorSetI32Range,         \
+  u32*:                  vectorSetU32Range,         \
+  const u32*:            vectorSetU32Range,         \
+  i64*:                  vectorSetI64Range,         \
+  const i64*:            vectorSetI64Range,         \
+  u64*:                  vectorSetU64Range,         \
+  const u64*:            vectorSetU64Range,         \
+  float*:                vectorSetFloatRange,       \
+  const float*:          vectorSetFloatRange,       \
+  double*:               vectorSetDoubleRange,      \
+  const double*:         vectorSetDoubleRange,      \
+  long double*:          vectorSetLongDoubleRange,  \
+  const long double*:    vectorSetLongDoubleRange   \
+
+#define vectorSetValues(dataStructure, index, values, count) _Generic((values), \
+  VECTOR_SET_VALUES_GENERIC_CASES(dataStructure, index, values, count) \
+  )(dataStructure, index, values, count)
+
+#endif // __STDC_VERSION__
+
+#elif defined __cplusplus // __STDC_VERSION__ is *NOT* defined
+#define TYPE_SAFE_VECTOR_DATA
+
+// Define the C++ function overloads.
+
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const bool* values, u64 count) {
+  return vectorSetBoolRange(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const i8* values, u64 count) {
+  return vectorSetI8Range(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const u8* values, u64 count) {
+  return vectorSetU8Range(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const i16* values, u64 count) {
+  return vectorSetI16Range(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const u16* values, u64 count) {
+  return vectorSetU16Range(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const i32* values, u64 count) {
+  return vectorSetI32Range(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const u32* values, u64 count) {
+  return vectorSetU32Range(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const i64* values, u64 count) {
+  return vectorSetI64Range(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const u64* values, u64 count) {
+  return vectorSetU64Range(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const float* values, u64 count) {
+  return vectorSetFloatRange(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const double* values, u64 count) {
+  return vectorSetDoubleRange(dataStructure, index, values, count);
+}
+static inline i32 vectorSetValues(Vector *dataStructure, u64 index, const long double* values, u64 count) {
+  return vectorSetLongDoubleRange(dataStructure, index, values, count);
+}
+
+#endif // __cplusplus
+
+#endif // TYPE_SAFE_VECTOR_DATA_H
+
@@ -0,0 +1,523 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              TypedContainers.h
+///
+/// @brief             This library contains macros that generate hash tables
+///                    and vectors specialized for one key and value type at
+///                    compile time.
+///
+/// @details           The general containers store every key and value as a
+///                    pointer to a copy and compare, copy and destroy them
+///                    through the function pointers of a TypeDescriptor.
+///                    That's what lets one implementation hold anything, but
+///                    it costs an indirect call per comparison and a pointer
+///                    to chase per element.  The containers generated here
+///                    store keys and values by value in a single array and
+///                    compare and hash them with code the compiler can
+///                    inline, so a lookup in a map of integers touches
+///                    nothing but the slots it probes.
+///
+///                    In exchange, they know nothing about ownership:  Keys
+///                    and values are copied with assignment and never
+///                    destroyed, so anything they point to belongs to the
+///                    caller.  They have no locks, so callers that share one
+///                    between threads must guard it themselves.  And they
+///                    have no TypeDescriptors, so they can't be nested in or
+///                    serialized by the general containers.
+///
+///                    Each generator defines static inline functions, so it
+///                    can be used in a header or in as many source files as
+///                    need the same container.  For example:
+///
+///                        DEFINE_TYPED_HASH_TABLE(I64DoubleMap, i64DoubleMap,
+///                          i64, double)
+///
+///                        I64DoubleMap *map = i64DoubleMapCreate(0);
+///                        i64DoubleMapPut(map, 42, 3.14);
+///                        double *value = i64DoubleMapGet(map, 42);
+///                        map = i64DoubleMapDestroy(map);
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TYPED_CONTAINERS_H
+#define TYPED_CONTAINERS_H
+
+#include <string.h>
+
+#include "DataTypes.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @def TYPED_HASH_TABLE_MIN_CAPACITY
+///
+/// @brief The minimum number of slots in a typed hash table.  This value must
+/// be a power of two.
+#define TYPED_HASH_TABLE_MIN_CAPACITY 16
+
+/// @def TYPED_HASH_TABLE_MAX_LOAD_PERCENTAGE
+///
+/// @brief The percentage of occupied slots at which a typed hash table will
+/// double its capacity.  As with FlatHashTable, unsuccessful lookups get
+/// sharply more expensive as the table approaches full.
+#ifndef TYPED_HASH_TABLE_MAX_LOAD_PERCENTAGE
+#define TYPED_HASH_TABLE_MAX_LOAD_PERCENTAGE 80
+#endif
+
+/// @def TYPED_VECTOR_MIN_CAPACITY
+///
+/// @brief The number of values a typed vector makes room for the first time
+/// it grows.
+#define TYPED_VECTOR_MIN_CAPACITY 16
+
+/// @fn static inline u64 typedHashInteger(u64 key, u64 seed)
+///
+/// @brief Hash an integer key for a typed hash table.
+///
+/// @details The key is combined with the table's seed and then scrambled
+/// with the MurmurHash3 finalizer so that the low-order bits used to select
+/// a slot depend on all the bits of the key.
+///
+/// @param key The key, converted to a u64.
+/// @param seed The seed of the table.
+///
+/// @return Returns the hash of the key.
+static inline u64 typedHashInteger(u64 key, u64 seed) {
+  u64 hash = key ^ seed;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+
+  return hash;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @def TYPED_HASH_INTEGER(key, seed)
+///
+/// @brief The default hash of DEFINE_TYPED_HASH_TABLE.  Works for any key
+/// that converts to a u64:  Integers, enums, bools and pointers.
+#define TYPED_HASH_INTEGER(key, seed) typedHashInteger((u64) (key), seed)
+
+/// @def TYPED_EQUALS(keyA, keyB)
+///
+/// @brief The default key comparison of DEFINE_TYPED_HASH_TABLE.
+#define TYPED_EQUALS(keyA, keyB) ((keyA) == (keyB))
+
+/// @def DEFINE_TYPED_HASH_TABLE(TYPE_NAME, PREFIX, KEY_TYPE, VALUE_TYPE)
+///
+/// @brief Define a hash table from KEY_TYPE keys to VALUE_TYPE values that
+/// hashes keys with TYPED_HASH_INTEGER and compares them with ==.
+///
+/// @details See DEFINE_TYPED_HASH_TABLE_WITH for what is defined.
+#define DEFINE_TYPED_HASH_TABLE(TYPE_NAME, PREFIX, KEY_TYPE, VALUE_TYPE) \
+  DEFINE_TYPED_HASH_TABLE_WITH(TYPE_NAME, PREFIX, KEY_TYPE, VALUE_TYPE, \
+    TYPED_HASH_INTEGER, TYPED_EQUALS)
+
+/// @def DEFINE_TYPED_HASH_TABLE_WITH(TYPE_NAME, PREFIX, KEY_TYPE, VALUE_TYPE, HASH, EQUALS)
+///
+/// @brief Define a hash table from KEY_TYPE keys to VALUE_TYPE values.
+///
+/// @details The table uses Robin Hood open addressing, like FlatHashTable, in
+/// one array of TYPE_NAME##Entry slots.  The following are defined:
+///
+/// - TYPE_NAME##Entry:  A slot, with key, value and probe members.  probe is
+///   0 for an empty slot and otherwise one more than the distance of the slot
+///   from the one the key's hash selects.
+/// - TYPE_NAME:  The table, with size, capacity, seed and entries members.
+/// - TYPE_NAME* PREFIX##Create(u64 size):  Create a table that can hold size
+///   entries before it has to grow.  Returns NULL on failure.
+/// - TYPE_NAME* PREFIX##Destroy(TYPE_NAME *table):  Free a table.  Always
+///   returns NULL.
+/// - int PREFIX##Reserve(TYPE_NAME *table, u64 size):  Grow the table, if
+///   needed, so that it can hold size entries without growing again.
+///   Returns 0 on success, -1 on failure.
+/// - VALUE_TYPE* PREFIX##Put(TYPE_NAME *table, KEY_TYPE key,
+///   VALUE_TYPE value):  Add an entry or replace the value of an existing
+///   one.  Returns a pointer to the stored value on success, NULL on failure.
+/// - VALUE_TYPE* PREFIX##Get(const TYPE_NAME *table, KEY_TYPE key):  Returns
+///   a pointer to the value for key or NULL if there isn't one.
+/// - i32 PREFIX##Remove(TYPE_NAME *table, KEY_TYPE key):  Returns 0 if the
+///   entry was removed, -1 if there was none.
+/// - void PREFIX##Clear(TYPE_NAME *table):  Remove every entry.
+/// - TYPE_NAME##Entry* PREFIX##Next(const TYPE_NAME *table,
+///   const TYPE_NAME##Entry *entry):  Returns the occupied slot after entry,
+///   or the first one if entry is NULL, or NULL if there are no more.
+///
+/// Pointers to values and entries are only valid until the next Put, Remove
+/// or Clear on the same table, since those move entries.
+///
+/// @param TYPE_NAME The name of the table type, e.g. I64DoubleMap.
+/// @param PREFIX The prefix of the functions, e.g. i64DoubleMap.
+/// @param KEY_TYPE The type of the keys.
+/// @param VALUE_TYPE The type of the values.
+/// @param HASH A function or macro, called as HASH(key, seed), that returns a
+///   u64 hash of a key.  It should mix the seed in.
+/// @param EQUALS A function or macro, called as EQUALS(keyA, keyB), that is
+///   true if two keys are the same.
+#define DEFINE_TYPED_HASH_TABLE_WITH(TYPE_NAME, PREFIX, KEY_TYPE, VALUE_TYPE, \
+  HASH, EQUALS) \
+typedef struct TYPE_NAME##Entry { \
+  KEY_TYPE key; \
+  VALUE_TYPE value; \
+  u32 probe; \
+} TYPE_NAME##Entry; \
+ \
+typedef struct TYPE_NAME { \
+  u64 size; \
+  u64 capacity; \
+  u64 seed; \
+  TYPE_NAME##Entry *entries; \
+} TYPE_NAME; \
+ \
+static inline TYPE_NAME* PREFIX##Create(u64 size) { \
+  TYPE_NAME *table = (TYPE_NAME*) allocatorCalloc( \
+    ALLOCATOR_FLAT_HASH_TABLE, NULL, 1, sizeof(TYPE_NAME)); \
+  if (table == NULL) { \
+    return NULL; \
+  } \
+  \
+  u64 capacity = TYPED_HASH_TABLE_MIN_CAPACITY; \
+  while ((capacity * TYPED_HASH_TABLE_MAX_LOAD_PERCENTAGE) / 100 < size) { \
+    capacity <<= 1; \
+  } \
+  table->entries = (TYPE_NAME##Entry*) allocatorCalloc( \
+    ALLOCATOR_FLAT_HASH_TABLE, NULL, capacity, sizeof(TYPE_NAME##Entry)); \
+  if (table->entries == NULL) { \
+    return (TYPE_NAME*) allocatorFree(ALLOCATOR_FLAT_HASH_TABLE, NULL, table); \
+  } \
+  table->capacity = capacity; \
+  table->seed = hashCreateSeed(); \
+  \
+  return table; \
+} \
+ \
+static inline TYPE_NAME* PREFIX##Destroy(TYPE_NAME *table) { \
+  if (table != NULL) { \
+    allocatorFree(ALLOCATOR_FLAT_HASH_TABLE, NULL, table->entries); \
+    allocatorFree(ALLOCATOR_FLAT_HASH_TABLE, NULL, table); \
+  } \
+  \
+  return NULL; \
+} \
+ \
+/* Put a key that isn't in the table into it.  The caller must have made */ \
+/* sure there's room.  Returns the slot the key ends up in. */ \
+static inline TYPE_NAME##Entry* PREFIX##Place(TYPE_NAME *table, \
+  KEY_TYPE key, VALUE_TYPE value \
+) { \
+  TYPE_NAME##Entry *entries = table->entries; \
+  u64 mask = table->capacity - 1; \
+  u64 slot = HASH(key, table->seed) & mask; \
+  u32 probe = 1; \
+  while (entries[slot].probe >= probe) { \
+    slot = (slot + 1) & mask; \
+    probe++; \
+  } \
+  \
+  /* Take the slot and move its entry, if any, to where it belongs. */ \
+  TYPE_NAME##Entry *placed = &entries[slot]; \
+  TYPE_NAME##Entry carried = entries[slot]; \
+  entries[slot].key = key; \
+  entries[slot].value = value; \
+  entries[slot].probe = probe; \
+  while (carried.probe != 0) { \
+    slot = (slot + 1) & mask; \
+    carried.probe++; \
+    if (entries[slot].probe < carried.probe) { \
+      TYPE_NAME##Entry swapped = entries[slot]; \
+      entries[slot] = carried; \
+      carried = swapped; \
+    } \
+  } \
+  table->size++; \
+  \
+  return placed; \
+} \
+ \
+static inline int PREFIX##Reserve(TYPE_NAME *table, u64 size) { \
+  if (table == NULL) { \
+    return -1; \
+  } \
+  u64 capacity = table->capacity; \
+  while ((capacity * TYPED_HASH_TABLE_MAX_LOAD_PERCENTAGE) / 100 < size) { \
+    capacity <<= 1; \
+  } \
+  if (capacity == table->capacity) { \
+    return 0; \
+  } \
+  \
+  TYPE_NAME##Entry *oldEntries = table->entries; \
+  u64 oldCapacity = table->capacity; \
+  table->entries = (TYPE_NAME##Entry*) allocatorCalloc( \
+    ALLOCATOR_FLAT_HASH_TABLE, NULL, capacity, sizeof(TYPE_NAME##Entry)); \
+  if (table->entries == NULL) { \
+    table->entries = oldEntries; \
+    return -1; \
+  } \
+  table->capacity = capacity; \
+  table->size = 0; \
+  for (u64 ii = 0; ii < oldCapacity; ii++) { \
+    if (oldEntries[ii].probe != 0) { \
+      PREFIX##Place(table, oldEntries[ii].key, oldEntries[ii].value); \
+    } \
+  } \
+  allocatorFree(ALLOCATOR_FLAT_HASH_TABLE, NULL, oldEntries); \
+  \
+  return 0; \
+} \
+ \
+static inline VALUE_TYPE* PREFIX##Get(const TYPE_NAME *table, \
+  KEY_TYPE key \
+) { \
+  if (table == NULL) { \
+    return NULL; \
+  } \
+  \
+  const TYPE_NAME##Entry *entries = table->entries; \
+  u64 mask = table->capacity - 1; \
+  u64 slot = HASH(key, table->seed) & mask; \
+  /* Only a key with the same home slot can be at the same probe length. */ \
+  for (u32 probe = 1; entries[slot].probe >= probe; probe++) { \
+    if ((entries[slot].probe == probe) && (EQUALS(entries[slot].key, key))) { \
+      return &table->entries[slot].value; \
+    } \
+    slot = (slot + 1) & mask; \
+  } \
+  \
+  return NULL; \
+} \
+ \
+static inline VALUE_TYPE* PREFIX##Put(TYPE_NAME *table, KEY_TYPE key, \
+  VALUE_TYPE value \
+) { \
+  if (table == NULL) { \
+    return NULL; \
+  } \
+  \
+  VALUE_TYPE *existing = PREFIX##Get(table, key); \
+  if (existing != NULL) { \
+    *existing = value; \
+    return existing; \
+  } \
+  if (PREFIX##Reserve(table, table->size + 1) != 0) { \
+    return NULL; \
+  } \
+  \
+  return &PREFIX##Place(table, key, value)->value; \
+} \
+ \
+static inline i32 PREFIX##Remove(TYPE_NAME *table, KEY_TYPE key) { \
+  VALUE_TYPE *value = PREFIX##Get(table, key); \
+  if (value == NULL) { \
+    return -1; \
+  } \
+  \
+  /* Shift the entries after this one back a slot until one is home. */ \
+  TYPE_NAME##Entry *entries = table->entries; \
+  u64 mask = table->capacity - 1; \
+  u64 slot = (u64) (((char*) value - (char*) entries) \
+    / sizeof(TYPE_NAME##Entry)); \
+  u64 next = (slot + 1) & mask; \
+  while (entries[next].probe > 1) { \
+    entries[slot] = entries[next]; \
+    entries[slot].probe--; \
+    slot = next; \
+    next = (next + 1) & mask; \
+  } \
+  entries[slot].probe = 0; \
+  table->size--; \
+  \
+  return 0; \
+} \
+ \
+static inline void PREFIX##Clear(TYPE_NAME *table) { \
+  if (table != NULL) { \
+    memset(table->entries, 0, table->capacity * sizeof(TYPE_NAME##Entry)); \
+    table->size = 0; \
+  } \
+} \
+ \
+static inline TYPE_NAME##Entry* PREFIX##Next(const TYPE_NAME *table, \
+  const TYPE_NAME##Entry *entry \
+) { \
+  if (table == NULL) { \
+    return NULL; \
+  } \
+  \
+  u64 slot = (entry == NULL) ? 0 : ((u64) (entry - table->entries)) + 1; \
+  for (; slot < table->capacity; slot++) { \
+    if (table->entries[slot].probe != 0) { \
+      return &table->entries[slot]; \
+    } \
+  } \
+  \
+  return NULL; \
+}
+
+/// @def DEFINE_TYPED_VECTOR(TYPE_NAME, PREFIX, VALUE_TYPE)
+///
+/// @brief Define a growable array of VALUE_TYPE values.
+///
+/// @details The following are defined:
+///
+/// - TYPE_NAME:  The vector, with size, capacity and values members.  Values
+///   may be read and written through values directly for indexes below size.
+/// - TYPE_NAME* PREFIX##Create(u64 capacity):  Create a vector with room for
+///   capacity values.  Returns NULL on failure.
+/// - TYPE_NAME* PREFIX##Destroy(TYPE_NAME *vector):  Free a vector.  Always
+///   returns NULL.
+/// - int PREFIX##Reserve(TYPE_NAME *vector, u64 capacity):  Make room for at
+///   least capacity values.  Returns 0 on success, -1 on failure.
+/// - VALUE_TYPE* PREFIX##Push(TYPE_NAME *vector, VALUE_TYPE value):  Add a
+///   value to the end.  Returns a pointer to the stored value on success,
+///   NULL on failure.
+/// - i32 PREFIX##Pop(TYPE_NAME *vector, VALUE_TYPE *value):  Remove the last
+///   value and, if value isn't NULL, store it there.  Returns 0 on success,
+///   -1 if the vector is empty.
+/// - VALUE_TYPE* PREFIX##At(const TYPE_NAME *vector, u64 index):  Returns a
+///   pointer to the value at index or NULL if index is out of range.
+/// - void PREFIX##Clear(TYPE_NAME *vector):  Remove every value.  The
+///   memory is kept.
+///
+/// Pointers to values are only valid until the next Push or Reserve on the
+/// same vector, since those may move the values.
+///
+/// @param TYPE_NAME The name of the vector type, e.g. I64Vector.
+/// @param PREFIX The prefix of the functions, e.g. i64Vector.
+/// @param VALUE_TYPE The type of the values.
+#define DEFINE_TYPED_VECTOR(TYPE_NAME, PREFIX, VALUE_TYPE) \
+typedef struct TYPE_NAME { \
+  u64 size; \
+  u64 capacity; \
+  VALUE_TYPE *values; \
+} TYPE_NAME; \
+ \
+static inline int PREFIX##Reserve(TYPE_NAME *vector, u64 capacity) { \
+  if (vector == NULL) { \
+    return -1; \
+  } \
+  if (capacity <= vector->capacity) { \
+    return 0; \
+  } \
+  \
+  VALUE_TYPE *values = (VALUE_TYPE*) allocatorRealloc(ALLOCATOR_VECTOR, NULL, \
+    vector->values, capacity * sizeof(VALUE_TYPE)); \
+  if (values == NULL) { \
+    return -1; \
+  } \
+  vector->values = values; \
+  vector->capacity = capacity; \
+  \
+  return 0; \
+} \
+ \
+static inline TYPE_NAME* PREFIX##Create(u64 capacity) { \
+  TYPE_NAME *vector = (TYPE_NAME*) allocatorCalloc( \
+    ALLOCATOR_VECTOR, NULL, 1, sizeof(TYPE_NAME)); \
+  if ((vector != NULL) && (PREFIX##Reserve(vector, capacity) != 0)) { \
+    vector = (TYPE_NAME*) allocatorFree(ALLOCATOR_VECTOR, NULL, vector); \
+  } \
+  \
+  return vector; \
+} \
+ \
+static inline TYPE_NAME* PREFIX##Destroy(TYPE_NAME *vector) { \
+  if (vector != NULL) { \
+    allocatorFree(ALLOCATOR_VECTOR, NULL, vector->values); \
+    allocatorFree(ALLOCATOR_VECTOR, NULL, vector); \
+  } \
+  \
+  return NULL; \
+} \
+ \
+static inline VALUE_TYPE* PREFIX##Push(TYPE_NAME *vector, \
+  VALUE_TYPE value \
+) { \
+  if (vector == NULL) { \
+    return NULL; \
+  } \
+  if ((vector->size == vector->capacity) \
+    && (PREFIX##Reserve(vector, (vector->capacity > 0) \
+      ? (vector->capacity << 1) : TYPED_VECTOR_MIN_CAPACITY) != 0) \
+  ) { \
+    return NULL; \
+  } \
+  \
+  vector->values[vector->size] = value; \
+  return &vector->values[vector->size++]; \
+} \
+ \
+static inline i32 PREFIX##Pop(TYPE_NAME *vector, VALUE_TYPE *value) { \
+  if ((vector == NULL) || (vector->size == 0)) { \
+    return -1; \
+  } \
+  \
+  vector->size--; \
+  if (value != NULL) { \
+    *value = vector->values[vector->size]; \
+  } \
+  \
+  return 0; \
+} \
+ \
+static inline VALUE_TYPE* PREFIX##At(const TYPE_NAME *vector, u64 index) { \
+  if ((vector == NULL) || (index >= vector->size)) { \
+    return NULL; \
+  } \
+  \
+  return &vector->values[index]; \
+} \
+ \
+static inline void PREFIX##Clear(TYPE_NAME *vector) { \
+  if (vector != NULL) { \
+    vector->size = 0; \
+  } \
+}
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+bool typedContainersUnitTest();
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // TYPED_CONTAINERS_H
+
@@ -48,6 +48,34 @@ extern "C"
 {
 #endif
 
+/// @struct VectorStats
+///
+/// @brief The occupancy and approximate memory footprint of a Vector as
+/// reported by vectorStats.
+///
+/// @param size One more than the highest index that has been set.
+/// @param arraySize The number of VectorNodes allocated.
+/// @param allocatedEntries The number of indexes that currently hold a value.
+/// @param fillRatio allocatedEntries divided by arraySize.
+/// @param elementSize The number of bytes each value takes in the data array
+///   (the size of a pointer for values that are stored as pointers).  0 if
+///   no value has been set yet.
+/// @param unusedBytes The number of bytes of nodes and data that are
+///   allocated for indexes that hold no value.
+/// @param memoryBytes The approximate number of bytes used by the Vector, its
+///   nodes and data array, and its keys and out-of-line values.  Values that
+///   are themselves containers are only counted by the size of their
+///   top-level structure.
+typedef struct VectorStats {
+  u64 size;
+  u64 arraySize;
+  u64 allocatedEntries;
+  double fillRatio;
+  u64 elementSize;
+  u64 unusedBytes;
+  u64 memoryBytes;
+} VectorStats;
+
 Vector *vectorCreate_(TypeDescriptor *keyType, TypeDescriptor *valueType,
   bool disableThreadSafety, u64 size, ...);
 #define vectorCreate(valueType, ...) \
@@ -68,6 +96,9 @@ VectorNode* vectorFindPreviousAllocated(Vector *vector, u64 index);
 VectorNode* vectorFindNextAllocated(Vector *vector, u64 index);
 i32 vectorRemove(Vector *vector, u64 index);
 void* vectorGetValue(Vector *vector, u64 index);
+void* vectorData(Vector *vector, TypeDescriptor *type);
+i32 vectorSetRange(Vector *vector, u64 index, const volatile void *values,
+  u64 count, TypeDescriptor *type);
 VectorNode* kvVectorGetEntry(Vector *vector, const volatile void *key);
 void* kvVectorGetValue(Vector *vector, const volatile void *key);
 Vector* vectorDestroy(Vector *vector);
@@ -78,7 +109,12 @@ Bytes vectorToXml_(const Vector *vector, const char *elementName, bool indent, .
 #define vectorToXml(vector, elementName, ...) \
   vectorToXml_(vector, elementName, ##__VA_ARGS__, false)
 int vectorCompare(Vector *vectorA, Vector *vectorB);
+int vectorCompareParallel(Vector *vectorA, Vector *vectorB, u32 numThreads);
 Vector *vectorCopy(Vector *vector);
+Vector *vectorCopyParallel(Vector *vector, u32 numThreads);
+i32 vectorClear(Vector *vector);
+i32 vectorClearParallel(Vector *vector, u32 numThreads);
+int vectorStats(Vector *vector, VectorStats *stats);
 // ASCENDING and DESCENDING are defined in both Vector.h and Array.h, so take
 // care not to define them twice and make the compiler complain.
 #ifndef ASCENDING
@@ -88,10 +124,28 @@ Vector *vectorCopy(Vector *vector);
 #define DESCENDING (-1)
 #endif // DESCENDING
 void* vectorSort(Vector *vector, i32 order, bool sortValues);
+void* vectorSortParallel(Vector *vector, i32 order, bool sortValues,
+  u32 numThreads);
+typedef void (*VectorForEachFunction)(VectorNode *node, void *context);
+i32 vectorForEach_(Vector *vector, VectorForEachFunction function,
+  void *context, u32 numThreads, ...);
+#define vectorForEach(vector, function, context, ...) \
+  vectorForEach_(vector, function, context, ##__VA_ARGS__, 1)
+typedef bool (*VectorMapFunction)(const VectorNode *node, void *value,
+  void *context);
+Vector* vectorMap_(Vector *vector, TypeDescriptor *valueType,
+  VectorMapFunction function, void *context, u32 numThreads, ...);
+#define vectorMap(vector, valueType, function, context, ...) \
+  vectorMap_(vector, valueType, function, context, ##__VA_ARGS__, 1)
 #define vectorToBlob(vector) listToBlob((List*) vector)
+#define vectorBlobGetIndex listBlobGetIndex
 Bytes vectorToJson(const Vector *vector);
+bool vectorToJsonStream(const Vector *vector,
+  struct JsonWriter *writer);
 Vector* jsonToVector(const char *jsonText, long long int *position);
 Vector* jsonToKvVector(const char *jsonText, long long int *position);
+void* jsonToDataStructure(const char *jsonText, long long int *position,
+  const JsonContainerOps *ops);
 VectorNode* vectorGetIndex(Vector *vector, char *index);
 Vector* vectorFromBlob_(const volatile void *array, u64 *length, bool inPlaceData, bool disableThreadSafety, ...);
 #define vectorFromBlob(array, length, ...) \
@@ -104,10 +158,11 @@ bool vectorUnitTest();
 
 #if (defined __cplusplus) || (defined __STDC_VERSION__ && __STDC_VERSION__ >= 201710L)
 
-// This must come last and must come outside the extern "C" block.
+// These must come last and must come outside the extern "C" block.
 #include "TypeSafeVectorSet.h"
+#include "TypeSafeVectorData.h"
 
-#endif // TypeSafeVectorSet.h
+#endif // TypeSafeVectorSet.h and TypeSafeVectorData.h
 
 #endif // VECTOR_H
 
@@ -85,6 +85,40 @@ int mtx_timedlock(mtx_t* mtx, const struct timespec* ts);
 int mtx_trylock(mtx_t* mtx);
 
 
+// Reader/writer lock support.  This is not part of C11.  Any number of
+// threads may hold the lock shared (read) at once, but only one may hold it
+// exclusive (write).  These locks are not recursive.
+typedef SRWLOCK rwl_t;
+
+int rwl_init(rwl_t* rwl);
+int rwl_rdlock(rwl_t* rwl);
+int rwl_tryrdlock(rwl_t* rwl);
+int rwl_rdunlock(rwl_t* rwl);
+int rwl_wrlock(rwl_t* rwl);
+int rwl_trywrlock(rwl_t* rwl);
+int rwl_wrunlock(rwl_t* rwl);
+void rwl_destroy(rwl_t* rwl);
+
+
+// Light mutex and condition support.  These are not part of C11.  A light
+// mutex is never recursive and can't be locked with a timeout.  A light
+// condition may only be used with a light mutex.
+typedef SRWLOCK lmtx_t;
+typedef CONDITION_VARIABLE lcnd_t;
+
+int lmtx_init(lmtx_t* lmtx);
+int lmtx_lock(lmtx_t* lmtx);
+int lmtx_trylock(lmtx_t* lmtx);
+int lmtx_unlock(lmtx_t* lmtx);
+void lmtx_destroy(lmtx_t* lmtx);
+int lcnd_init(lcnd_t* cond);
+int lcnd_signal(lcnd_t* cond);
+int lcnd_broadcast(lcnd_t* cond);
+int lcnd_wait(lcnd_t* cond, lmtx_t* lmtx);
+int lcnd_timedwait(lcnd_t* cond, lmtx_t* lmtx, const struct timespec* ts);
+void lcnd_destroy(lcnd_t* cond);
+
+
 // Condition support.
 typedef CONDITION_VARIABLE cnd_t;
 
@@ -118,6 +152,25 @@ void thrd_yield(void);
 int thrd_terminate(thrd_t thr);
 
 
+// Extended thread creation support.  This is not part of C11.  Members left at
+// the values set by thrd_attr_init get the same defaults as thrd_create.
+// cpus restricts the thread to the listed CPUs of processor group 0.
+// numa_node, if cpus is NULL, restricts the thread to the node's CPUs, which
+// also makes Windows allocate its memory from that node.  name is truncated
+// to 15 characters.
+typedef struct thrd_attr_t {
+    const int* cpus;
+    size_t num_cpus;
+    int numa_node;
+    size_t stack_size;
+    const char* name;
+} thrd_attr_t;
+
+void thrd_attr_init(thrd_attr_t* attr);
+int thrd_create_ex(thrd_t* thr, const thrd_attr_t* attr,
+    thrd_start_t func, void* arg);
+
+
 // Thread-specific storage support.
 #define TSS_DTOR_ITERATIONS 4
 
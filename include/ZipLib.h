@@ -59,6 +59,29 @@ extern "C"
 #define ZIP_DEFAULT_COMPRESSION_LEVEL 9
 #endif // ZIP_DEFAULT_COMPRESSION_LEVEL
 
+#ifndef ZIP_PARALLEL_BLOCK_SIZE
+// Entries larger than this are split into independently-compressed blocks of
+// this size by zipAddEntriesParallel.
+#define ZIP_PARALLEL_BLOCK_SIZE (1024 * 1024)
+#endif // ZIP_PARALLEL_BLOCK_SIZE
+
+// Passed as the level or strategy of compressData to get the default.  The
+// default level is miniz's most thorough match search, which is what
+// compressData has always used.
+#define COMPRESS_DATA_DEFAULT (-1)
+
+#ifndef COMPRESS_DATA_ENTROPY_SAMPLE_SIZE
+// The number of bytes compressData samples from payloads larger than this to
+// decide whether they are worth compressing at all.
+#define COMPRESS_DATA_ENTROPY_SAMPLE_SIZE 4096
+#endif // COMPRESS_DATA_ENTROPY_SAMPLE_SIZE
+
+#ifndef ZIP_READ_BUFFER_SIZE
+// The number of compressed bytes a ZipEntryReader reads from the archive at a
+// time.
+#define ZIP_READ_BUFFER_SIZE (64 * 1024)
+#endif // ZIP_READ_BUFFER_SIZE
+
 
 // Functionality for data in memory.
 
@@ -79,7 +102,11 @@ typedef struct CompressedData {
   bool  dataIsStatic;
 } CompressedData;
 
-CompressedData* compressData(const volatile void *data, i64 dataLength);
+CompressedData* compressData_(const volatile void *data, i64 dataLength,
+  int level, int strategy, ...);
+#define compressData(data, dataLength, ...) \
+  compressData_(data, dataLength, ##__VA_ARGS__, \
+    COMPRESS_DATA_DEFAULT, COMPRESS_DATA_DEFAULT)
 void*           decompressData_(const CompressedData *compressedData, i64 *dataLength, ...);
 #define decompressData(compressedData, ...) \
   decompressData_(compressedData, ##__VA_ARGS__, NULL)
@@ -93,6 +120,46 @@ CompressedData* compressedDataDestroy(CompressedData *compressedData);
 Bytes           compressedDataToBlob(const CompressedData *compressedData);
 CompressedData* compressedDataFromBlob(const volatile void *array, i64 *length);
 
+/// @typedef CompressDataStreamWriter
+///
+/// @brief Function called by a CompressDataStream with each piece of
+/// compressed output.  Returns true on success, false to fail the stream.
+typedef bool (*CompressDataStreamWriter)(const void *data, i64 dataLength,
+  void *context);
+
+/// @struct CompressDataStream
+///
+/// @brief State for compressing data that arrives in chunks.  The output is
+/// the same raw deflate format that compressData produces, so a
+/// CompressedData made from it can be read with decompressData.
+///
+/// @param compressor The miniz compressor state.
+/// @param writer The function that receives the compressed output.
+/// @param context The context passed to writer.
+/// @param inputLength The number of bytes passed in so far.
+/// @param outputLength The number of bytes passed to writer so far.
+/// @param failed Whether or not compression or the writer has failed.
+/// @param finished Whether or not compressDataStreamFinish has been called.
+typedef struct CompressDataStream {
+  tdefl_compressor         *compressor;
+  CompressDataStreamWriter  writer;
+  void                     *context;
+  i64                       inputLength;
+  i64                       outputLength;
+  bool                      failed;
+  bool                      finished;
+} CompressDataStream;
+
+CompressDataStream* compressDataStreamCreate_(CompressDataStreamWriter writer,
+  void *context, int level, ...);
+#define compressDataStreamCreate(writer, context, ...) \
+  compressDataStreamCreate_(writer, context, ##__VA_ARGS__, \
+    ZIP_DEFAULT_COMPRESSION_LEVEL)
+i32             compressDataStream(CompressDataStream *stream,
+  const volatile void *data, i64 dataLength);
+i32             compressDataStreamFinish(CompressDataStream *stream);
+CompressDataStream* compressDataStreamDestroy(CompressDataStream *stream);
+
 
 // Formal zip functionality.
 
@@ -151,8 +218,15 @@ typedef enum ZipLocation {
 /// @param numEntries The number of entries in the archive.
 /// @param entryNames The names of the entries in the archive, if any.
 /// @param entrySizes The sizes, in bytes, of the entries in the archive.
+/// @param entryIndex Open-addressed hash index over entryNames.  Each slot
+///   holds an entry's index plus one, or 0 if the slot is empty.
+/// @param entryIndexMask The number of slots in entryIndex minus one.
+/// @param entryIndexSeed The seed used to hash names into entryIndex.
 /// @param lock A mtx_t that guards access.
 /// @param leaseData Whether or not the data is leased (not owned).
+/// @param mappedData The memory mapping of a file-based archive while it is
+///   open for reading, if the file could be mapped.
+/// @param mappedLength The length, in bytes, of mappedData.
 typedef struct Zip {
   // These first two entries need to come first and in this order to be
   // compatible with CompressedData.
@@ -165,10 +239,66 @@ typedef struct Zip {
   i64              numEntries;
   char           **entryNames;
   i64             *entrySizes;
+  u32             *entryIndex;
+  u64              entryIndexMask;
+  u64              entryIndexSeed;
   mtx_t           lock;
   bool            leaseData;
+  void            *mappedData;
+  i64              mappedLength;
 } Zip;
 
+/// @struct ZipEntryReader
+///
+/// @brief State for reading the decompressed contents of a single Zip entry
+/// a piece at a time.
+///
+/// @param zip The Zip the entry is in.
+/// @param decompressor The inflate state for a deflated entry.
+/// @param input Buffer of up to ZIP_READ_BUFFER_SIZE compressed bytes read
+///   from the archive.
+/// @param inputOffset The offset of the next unconsumed byte in input.
+/// @param inputLength The number of valid bytes in input.
+/// @param dictionary The TINFL_LZ_DICT_SIZE circular buffer that inflated
+///   data is written to.  Chunks returned by zipEntryReaderRead point into
+///   this buffer (or into input for stored entries).
+/// @param dictionaryOffset The offset of the next byte to write in dictionary.
+/// @param archiveOffset The offset within the archive of the next compressed
+///   byte to read.
+/// @param compressedRemaining The number of compressed bytes not yet read.
+/// @param uncompressedLength The number of decompressed bytes produced so far.
+/// @param expectedLength The uncompressed size recorded in the archive.
+/// @param crc32 The running CRC-32 of the decompressed bytes.
+/// @param expectedCrc32 The CRC-32 recorded in the archive.
+/// @param stored Whether or not the entry is stored without compression.
+/// @param done Whether or not the whole entry has been returned.
+/// @param failed Whether or not reading the entry has failed.
+typedef struct ZipEntryReader {
+  Zip                *zip;
+  tinfl_decompressor  decompressor;
+  u8                 *input;
+  size_t              inputOffset;
+  size_t              inputLength;
+  u8                 *dictionary;
+  size_t              dictionaryOffset;
+  u64                 archiveOffset;
+  u64                 compressedRemaining;
+  u64                 uncompressedLength;
+  u64                 expectedLength;
+  mz_uint32           crc32;
+  mz_uint32           expectedCrc32;
+  bool                stored;
+  bool                done;
+  bool                failed;
+} ZipEntryReader;
+
+/// @typedef ZipEntryChunkHandler
+///
+/// @brief Function called by zipReadEntryToCallback with each piece of an
+/// entry's decompressed data.  Return false to stop reading.
+typedef bool (*ZipEntryChunkHandler)(const void *chunk, i64 chunkLength,
+  void *context);
+
 // Constructors/Destructors.
 Zip*   zipCreate();
 Zip*   zipOpenFile(const char *fileName);
@@ -194,11 +324,27 @@ void* zipDetachData(Zip *zip);
 void*        zipReadEntryByName(const Zip *zip, const char *entryName,
   i64 *entryLength);
 void*        zipReadEntryByIndex(const Zip *zip, i64 entryIndex, i64 *entryLength);
+ZipEntryReader* zipEntryReaderCreateByName(const Zip *zip,
+  const char *entryName);
+ZipEntryReader* zipEntryReaderCreateByIndex(const Zip *zip, i64 entryIndex);
+i64          zipEntryReaderRead(ZipEntryReader *reader, const void **chunk);
+ZipEntryReader* zipEntryReaderDestroy(ZipEntryReader *reader);
+i32          zipReadEntryToCallbackByName(const Zip *zip,
+  const char *entryName, ZipEntryChunkHandler handler, void *context);
+i32          zipReadEntryToCallbackByIndex(const Zip *zip, i64 entryIndex,
+  ZipEntryChunkHandler handler, void *context);
 i32          zipAddEntry_(Zip *zip, const char *entryName,
   const volatile void *data, i64 dataLength, int level, ...);
 #define zipAddEntry(zip, entryName, data, dataLength, ...) \
   zipAddEntry_(zip, entryName, data, dataLength, ##__VA_ARGS__, \
     ZIP_DEFAULT_COMPRESSION_LEVEL)
+i32          zipAddEntriesParallel_(Zip *zip, const char *const *entryNames,
+  const volatile void *const *data, const i64 *dataLengths, i64 numEntries,
+  u32 numThreads, int level, ...);
+#define zipAddEntriesParallel(zip, entryNames, data, dataLengths, numEntries, \
+  numThreads, ...) \
+  zipAddEntriesParallel_(zip, entryNames, data, dataLengths, numEntries, \
+    numThreads, ##__VA_ARGS__, ZIP_DEFAULT_COMPRESSION_LEVEL)
 i64          zipGetNumEntries(Zip *zip);
 const char** zipGetEntryNames(Zip *zip);
 const char*  zipGetEntryName(Zip *zip, i64 index);
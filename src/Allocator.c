@@ -0,0 +1,661 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              Allocator.c
+///
+/// @brief             This library contains the implementation of the
+///                    pluggable allocator the containers get their memory
+///                    from and of optional allocation accounting.
+///
+/// @details           Bytes are counted with the allocator's usableSize
+///                    function, so a release is credited the same amount
+///                    its allocation was charged without the caller having
+///                    to remember the size.  The counters are updated with
+///                    relaxed atomic operations, so a report made while
+///                    other threads are allocating is a close snapshot
+///                    rather than an exact one.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+// Doxygen marker
+/// @file
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Allocator.h"
+#include "DataTypes.h"
+#include "LoggingLib.h"
+#include "StringLib.h"
+#include "TimeUtils.h"
+
+/// @def ALLOCATOR_MAX_TYPES
+///
+/// @brief The number of TypeDescriptors allocations can be counted against.
+/// Allocations for types seen after the table is full are only counted
+/// against their subsystem.
+#define ALLOCATOR_MAX_TYPES 64
+
+/// @fn static void* allocatorDefaultMalloc(void *context, size_t size)
+///
+/// @brief Allocate memory with the C library's malloc.
+///
+/// @param context Unused.
+/// @param size The number of bytes to allocate.
+///
+/// @return Returns the value of malloc.
+static void* allocatorDefaultMalloc(void *context, size_t size) {
+  (void) context;
+  return malloc(size);
+}
+
+/// @fn static void* allocatorDefaultCalloc(void *context, size_t count, size_t size)
+///
+/// @brief Allocate zeroed memory with the C library's calloc.
+///
+/// @param context Unused.
+/// @param count The number of elements to allocate.
+/// @param size The size of each element.
+///
+/// @return Returns the value of calloc.
+static void* allocatorDefaultCalloc(void *context, size_t count, size_t size) {
+  (void) context;
+  return calloc(count, size);
+}
+
+/// @fn static void* allocatorDefaultRealloc(void *context, void *pointer, size_t size)
+///
+/// @brief Resize memory with the C library's realloc.
+///
+/// @param context Unused.
+/// @param pointer The allocation to resize.
+/// @param size The new size of the allocation.
+///
+/// @return Returns the value of realloc.
+static void* allocatorDefaultRealloc(void *context, void *pointer, size_t size) {
+  (void) context;
+  return realloc(pointer, size);
+}
+
+/// @fn static void allocatorDefaultFree(void *context, void *pointer)
+///
+/// @brief Release memory with the C library's free.
+///
+/// @param context Unused.
+/// @param pointer The allocation to release.
+///
+/// @return This function returns no value.
+static void allocatorDefaultFree(void *context, void *pointer) {
+  (void) context;
+  free(pointer);
+}
+
+/// @fn static size_t allocatorDefaultUsableSize(void *context, void *pointer)
+///
+/// @brief Get the size of memory from the C library's functions.  These are
+/// wrapped by LoggingLib, which records the size of every block.
+///
+/// @param context Unused.
+/// @param pointer The allocation of interest.
+///
+/// @return Returns the number of bytes requested for the allocation.
+static size_t allocatorDefaultUsableSize(void *context, void *pointer) {
+  (void) context;
+  return mallocSize(pointer);
+}
+
+/// @var _defaultAllocator
+///
+/// @brief The Allocator for the C library's functions.
+static const Allocator _defaultAllocator = {
+  "libc",
+  allocatorDefaultMalloc,
+  allocatorDefaultCalloc,
+  allocatorDefaultRealloc,
+  allocatorDefaultFree,
+  allocatorDefaultUsableSize,
+  NULL
+};
+
+/// @var _allocator
+///
+/// @brief The Allocator in use.
+static Allocator _allocator = _defaultAllocator;
+
+/// @var _subsystemNames
+///
+/// @brief The names of the AllocatorSubsystems, for reports.
+static const char *_subsystemNames[NUM_ALLOCATOR_SUBSYSTEMS] = {
+  "other",
+  "list",
+  "vector",
+  "hashTable",
+  "redBlackTree",
+  "flatHashTable",
+  "queue",
+  "radixTree",
+};
+
+/// @var _subsystemCounters
+///
+/// @brief The counters of each AllocatorSubsystem.
+static AllocatorCounters _subsystemCounters[NUM_ALLOCATOR_SUBSYSTEMS];
+
+/// @var _types
+///
+/// @brief The TypeDescriptors that have been counted against so far.  Slots
+/// are claimed in order and never given up.
+static const TypeDescriptor *_types[ALLOCATOR_MAX_TYPES];
+
+/// @var _typeCounters
+///
+/// @brief The counters of each TypeDescriptor in _types.
+static AllocatorCounters _typeCounters[ALLOCATOR_MAX_TYPES];
+
+/// @var _statsStartNanoseconds
+///
+/// @brief When counting started, for the allocation rates in reports.
+static i64 _statsStartNanoseconds = 0;
+
+/// @fn int allocatorSet(const Allocator *allocator)
+///
+/// @brief Install the Allocator the library gets its memory from.
+///
+/// @note This has to be done before any containers are created and while no
+/// other threads are using the library.  Memory is always released to the
+/// Allocator that's current at the time, so anything allocated by the
+/// previous Allocator must already be gone.
+///
+/// @param allocator The Allocator to install, or NULL for the C library's.
+///   The structure is copied.
+///
+/// @return Returns 0 on success, -1 on failure.
+int allocatorSet(const Allocator *allocator) {
+  if (allocator == NULL) {
+    _allocator = _defaultAllocator;
+    return 0;
+  }
+
+  if ((allocator->malloc == NULL) || (allocator->calloc == NULL)
+    || (allocator->realloc == NULL) || (allocator->free == NULL)
+  ) {
+    printLog(ERR, "Allocator is missing a function.\n");
+    return -1;
+  }
+
+  _allocator = *allocator;
+  if (_allocator.name == NULL) {
+    _allocator.name = "custom";
+  }
+
+  return 0;
+}
+
+/// @fn const Allocator* allocatorGet(void)
+///
+/// @brief Get the Allocator the library gets its memory from.
+///
+/// @return Returns a pointer to the current Allocator.
+const Allocator* allocatorGet(void) {
+  return &_allocator;
+}
+
+#ifdef ALLOCATOR_STATS_ENABLED
+
+/// @fn static AllocatorCounters* allocatorTypeCounters(const TypeDescriptor *type)
+///
+/// @brief Get the counters of a TypeDescriptor, claiming a slot for it the
+/// first time it's seen.
+///
+/// @param type The TypeDescriptor of interest.  May be NULL.
+///
+/// @return Returns the counters on success, NULL if type is NULL or the table
+/// is full.
+static AllocatorCounters* allocatorTypeCounters(const TypeDescriptor *type) {
+  if (type == NULL) {
+    return NULL;
+  }
+
+  for (int ii = 0; ii < ALLOCATOR_MAX_TYPES; ii++) {
+    const TypeDescriptor *slotType
+      = __atomic_load_n(&_types[ii], __ATOMIC_ACQUIRE);
+    if (slotType == NULL) {
+      const TypeDescriptor *expected = NULL;
+      if (__atomic_compare_exchange_n(&_types[ii], &expected, type,
+        false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+      ) {
+        return &_typeCounters[ii];
+      }
+      // Another thread claimed the slot first.
+      slotType = expected;
+    }
+    if (slotType == type) {
+      return &_typeCounters[ii];
+    }
+  }
+
+  return NULL;
+}
+
+/// @fn static void allocatorCount(AllocatorCounters *counters, i64 allocations, i64 frees, i64 bytes)
+///
+/// @brief Add to a set of counters.
+///
+/// @param counters The counters to add to.  May be NULL.
+/// @param allocations The number of allocations to add.
+/// @param frees The number of frees to add.
+/// @param bytes The change in live bytes.
+///
+/// @return This function returns no value.
+static void allocatorCount(AllocatorCounters *counters,
+  i64 allocations, i64 frees, i64 bytes
+) {
+  if (counters == NULL) {
+    return;
+  }
+
+  if (allocations > 0) {
+    __atomic_add_fetch(&counters->allocations, (u64) allocations,
+      __ATOMIC_RELAXED);
+  }
+  if (frees > 0) {
+    __atomic_add_fetch(&counters->frees, (u64) frees, __ATOMIC_RELAXED);
+  }
+  if (bytes > 0) {
+    __atomic_add_fetch(&counters->allocatedBytes, (u64) bytes,
+      __ATOMIC_RELAXED);
+  }
+  if (bytes != 0) {
+    i64 liveBytes
+      = __atomic_add_fetch(&counters->liveBytes, bytes, __ATOMIC_RELAXED);
+    i64 peakBytes = __atomic_load_n(&counters->peakBytes, __ATOMIC_RELAXED);
+    while ((liveBytes > peakBytes)
+      && (!__atomic_compare_exchange_n(&counters->peakBytes, &peakBytes,
+        liveBytes, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    );
+  }
+}
+
+/// @fn static void allocatorRecord(AllocatorSubsystem subsystem, const TypeDescriptor *type, i64 allocations, i64 frees, i64 bytes)
+///
+/// @brief Count an allocation or release against a subsystem and a type.
+///
+/// @param subsystem The AllocatorSubsystem responsible.
+/// @param type The TypeDescriptor responsible, if any.
+/// @param allocations The number of allocations to add.
+/// @param frees The number of frees to add.
+/// @param bytes The change in live bytes.
+///
+/// @return This function returns no value.
+static void allocatorRecord(AllocatorSubsystem subsystem,
+  const TypeDescriptor *type, i64 allocations, i64 frees, i64 bytes
+) {
+  if (__atomic_load_n(&_statsStartNanoseconds, __ATOMIC_RELAXED) == 0) {
+    i64 expected = 0;
+    __atomic_compare_exchange_n(&_statsStartNanoseconds, &expected,
+      getMonotonicNanoseconds(), false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+  }
+
+  if ((subsystem < 0) || (subsystem >= NUM_ALLOCATOR_SUBSYSTEMS)) {
+    subsystem = ALLOCATOR_OTHER;
+  }
+  allocatorCount(&_subsystemCounters[subsystem], allocations, frees, bytes);
+  allocatorCount(allocatorTypeCounters(type), allocations, frees, bytes);
+}
+
+/// @fn static inline i64 allocatorUsableSize(void *pointer)
+///
+/// @brief Get the usable size of an allocation from the current Allocator.
+///
+/// @param pointer The allocation of interest.  May be NULL.
+///
+/// @return Returns the number of usable bytes, 0 if pointer is NULL or the
+/// Allocator can't tell.
+static inline i64 allocatorUsableSize(void *pointer) {
+  if ((pointer == NULL) || (_allocator.usableSize == NULL)) {
+    return 0;
+  }
+
+  return (i64) _allocator.usableSize(_allocator.context, pointer);
+}
+
+#endif // ALLOCATOR_STATS_ENABLED
+
+/// @fn void* allocatorMalloc(AllocatorSubsystem subsystem, const struct TypeDescriptor *type, size_t size)
+///
+/// @brief Allocate uninitialized memory from the current Allocator.
+///
+/// @param subsystem The AllocatorSubsystem to count the allocation against.
+/// @param type The TypeDescriptor to count the allocation against.  May be
+///   NULL.
+/// @param size The number of bytes to allocate.
+///
+/// @return Returns a pointer to the memory on success, NULL on failure.
+void* allocatorMalloc(AllocatorSubsystem subsystem,
+  const struct TypeDescriptor *type, size_t size
+) {
+  void *pointer = _allocator.malloc(_allocator.context, size);
+#ifdef ALLOCATOR_STATS_ENABLED
+  if (pointer != NULL) {
+    allocatorRecord(subsystem, type, 1, 0, allocatorUsableSize(pointer));
+  }
+#else
+  (void) subsystem;
+  (void) type;
+#endif // ALLOCATOR_STATS_ENABLED
+
+  return pointer;
+}
+
+/// @fn void* allocatorCalloc(AllocatorSubsystem subsystem, const struct TypeDescriptor *type, size_t count, size_t size)
+///
+/// @brief Allocate zeroed memory for an array from the current Allocator.
+///
+/// @param subsystem The AllocatorSubsystem to count the allocation against.
+/// @param type The TypeDescriptor to count the allocation against.  May be
+///   NULL.
+/// @param count The number of elements to allocate.
+/// @param size The size of each element.
+///
+/// @return Returns a pointer to the memory on success, NULL on failure.
+void* allocatorCalloc(AllocatorSubsystem subsystem,
+  const struct TypeDescriptor *type, size_t count, size_t size
+) {
+  void *pointer = _allocator.calloc(_allocator.context, count, size);
+#ifdef ALLOCATOR_STATS_ENABLED
+  if (pointer != NULL) {
+    allocatorRecord(subsystem, type, 1, 0, allocatorUsableSize(pointer));
+  }
+#else
+  (void) subsystem;
+  (void) type;
+#endif // ALLOCATOR_STATS_ENABLED
+
+  return pointer;
+}
+
+/// @fn void* allocatorRealloc(AllocatorSubsystem subsystem, const struct TypeDescriptor *type, void *pointer, size_t size)
+///
+/// @brief Resize memory from the current Allocator.
+///
+/// @param subsystem The AllocatorSubsystem the memory is counted against.
+/// @param type The TypeDescriptor the memory is counted against.  May be NULL.
+/// @param pointer The allocation to resize.  May be NULL.
+/// @param size The new size of the allocation.
+///
+/// @return Returns a pointer to the resized memory on success, NULL on
+/// failure.  On failure, the original allocation is left alone.
+void* allocatorRealloc(AllocatorSubsystem subsystem,
+  const struct TypeDescriptor *type, void *pointer, size_t size
+) {
+#ifdef ALLOCATOR_STATS_ENABLED
+  i64 oldSize = allocatorUsableSize(pointer);
+#endif // ALLOCATOR_STATS_ENABLED
+
+  void *newPointer = _allocator.realloc(_allocator.context, pointer, size);
+
+#ifdef ALLOCATOR_STATS_ENABLED
+  if (newPointer != NULL) {
+    i64 newSize = allocatorUsableSize(newPointer);
+    if (pointer != NULL) {
+      allocatorRecord(subsystem, type, 0, 0, -oldSize);
+      allocatorRecord(subsystem, type, 1, 1, newSize);
+    } else {
+      allocatorRecord(subsystem, type, 1, 0, newSize);
+    }
+  }
+#else
+  (void) subsystem;
+  (void) type;
+#endif // ALLOCATOR_STATS_ENABLED
+
+  return newPointer;
+}
+
+/// @fn void* allocatorFree(AllocatorSubsystem subsystem, const struct TypeDescriptor *type, void *pointer)
+///
+/// @brief Release memory to the current Allocator.
+///
+/// @param subsystem The AllocatorSubsystem the memory was counted against.
+/// @param type The TypeDescriptor the memory was counted against.  May be
+///   NULL.
+/// @param pointer The allocation to release.  May be NULL.
+///
+/// @return Always returns NULL.
+void* allocatorFree(AllocatorSubsystem subsystem,
+  const struct TypeDescriptor *type, void *pointer
+) {
+  if (pointer == NULL) {
+    return NULL;
+  }
+
+#ifdef ALLOCATOR_STATS_ENABLED
+  allocatorRecord(subsystem, type, 0, 1, -allocatorUsableSize(pointer));
+#else
+  (void) subsystem;
+  (void) type;
+#endif // ALLOCATOR_STATS_ENABLED
+
+  _allocator.free(_allocator.context, pointer);
+  return NULL;
+}
+
+/// @fn static void allocatorCountersGet(AllocatorCounters *counters, const AllocatorCounters *source)
+///
+/// @brief Take a snapshot of a set of counters.
+///
+/// @param counters The AllocatorCounters to fill in.
+/// @param source The counters to read.
+///
+/// @return This function returns no value.
+static void allocatorCountersGet(AllocatorCounters *counters,
+  const AllocatorCounters *source
+) {
+  counters->allocations
+    = __atomic_load_n(&source->allocations, __ATOMIC_RELAXED);
+  counters->frees = __atomic_load_n(&source->frees, __ATOMIC_RELAXED);
+  counters->allocatedBytes
+    = __atomic_load_n(&source->allocatedBytes, __ATOMIC_RELAXED);
+  counters->liveBytes = __atomic_load_n(&source->liveBytes, __ATOMIC_RELAXED);
+  counters->peakBytes = __atomic_load_n(&source->peakBytes, __ATOMIC_RELAXED);
+}
+
+/// @fn int allocatorSubsystemStats(AllocatorSubsystem subsystem, AllocatorCounters *counters)
+///
+/// @brief Get the allocation counters of a subsystem.
+///
+/// @param subsystem The AllocatorSubsystem of interest.
+/// @param counters The AllocatorCounters to fill in.  These are all 0 if the
+///   library was built without ALLOCATOR_STATS_ENABLED.
+///
+/// @return Returns 0 on success, -1 on failure.
+int allocatorSubsystemStats(AllocatorSubsystem subsystem,
+  AllocatorCounters *counters
+) {
+  if ((subsystem < 0) || (subsystem >= NUM_ALLOCATOR_SUBSYSTEMS)
+    || (counters == NULL)
+  ) {
+    printLog(ERR, "Invalid parameter provided.\n");
+    return -1;
+  }
+
+  allocatorCountersGet(counters, &_subsystemCounters[subsystem]);
+  return 0;
+}
+
+/// @fn static void allocatorAddJsonCounters(char **json, const char *name, const AllocatorCounters *source, double elapsedSeconds)
+///
+/// @brief Add one object of counters to a JSON report.
+///
+/// @param json A pointer to the buffer to add to.
+/// @param name The name of the subsystem or type.
+/// @param source The counters to report.
+/// @param elapsedSeconds The time counting has been going on, for the
+///   allocation rate.
+///
+/// @return This function returns no value.
+static void allocatorAddJsonCounters(char **json, const char *name,
+  const AllocatorCounters *source, double elapsedSeconds
+) {
+  AllocatorCounters counters;
+  allocatorCountersGet(&counters, source);
+  char buffer[256];
+
+  snprintf(buffer, sizeof(buffer),
+    "{\"name\":\"%s\",\"allocations\":%llu,\"frees\":%llu,"
+    "\"allocatedBytes\":%llu,\"liveBytes\":%lld,\"peakBytes\":%lld,"
+    "\"allocationsPerSecond\":%.1f}",
+    name, llu(counters.allocations), llu(counters.frees),
+    llu(counters.allocatedBytes), lld(counters.liveBytes),
+    lld(counters.peakBytes),
+    (elapsedSeconds > 0.0)
+      ? ((double) counters.allocations / elapsedSeconds) : 0.0);
+  straddstr(json, buffer);
+}
+
+/// @fn char* allocatorStatsToJson(void)
+///
+/// @brief Report the allocation counters of every subsystem and of every
+/// TypeDescriptor allocations have been counted against.
+///
+/// @details The report is an object with an "enabled" member, which is false
+/// if the library was built without ALLOCATOR_STATS_ENABLED, the name of the
+/// current allocator, the number of seconds since counting started or was
+/// last reset, and "subsystems" and "types" arrays.  Each entry has its name,
+/// allocations, frees, allocatedBytes, liveBytes, peakBytes and
+/// allocationsPerSecond.  allocationsPerSecond is the average since counting
+/// started.  TypeDescriptors that share a name are reported together.  Their
+/// peakBytes is the sum of their individual peaks.
+///
+/// @return Returns a newly-allocated string on success, NULL on failure.  The
+/// caller must free it with stringDestroy.
+char* allocatorStatsToJson(void) {
+  char *json = NULL;
+  char buffer[128];
+
+  i64 start = __atomic_load_n(&_statsStartNanoseconds, __ATOMIC_RELAXED);
+  double elapsedSeconds = (start != 0)
+    ? ((double) (getMonotonicNanoseconds() - start) / 1000000000.0) : 0.0;
+
+#ifdef ALLOCATOR_STATS_ENABLED
+  straddstr(&json, "{\"enabled\":true,\"allocator\":\"");
+#else
+  straddstr(&json, "{\"enabled\":false,\"allocator\":\"");
+#endif // ALLOCATOR_STATS_ENABLED
+  straddstr(&json, _allocator.name);
+  snprintf(buffer, sizeof(buffer), "\",\"elapsedSeconds\":%.3f", elapsedSeconds);
+  straddstr(&json, buffer);
+
+  straddstr(&json, ",\"subsystems\":[");
+  for (int ii = 0; ii < NUM_ALLOCATOR_SUBSYSTEMS; ii++) {
+    if (ii > 0) {
+      straddstr(&json, ",");
+    }
+    allocatorAddJsonCounters(&json, _subsystemNames[ii],
+      &_subsystemCounters[ii], elapsedSeconds);
+  }
+
+  straddstr(&json, "],\"types\":[");
+  int numTypes = 0;
+  while ((numTypes < ALLOCATOR_MAX_TYPES)
+    && (__atomic_load_n(&_types[numTypes], __ATOMIC_ACQUIRE) != NULL)
+  ) {
+    numTypes++;
+  }
+  bool first = true;
+  for (int ii = 0; ii < numTypes; ii++) {
+    const char *name = _types[ii]->name;
+    bool reported = false;
+    for (int jj = 0; (jj < ii) && (reported == false); jj++) {
+      reported = (strcmp(_types[jj]->name, name) == 0);
+    }
+    if (reported == true) {
+      continue;
+    }
+
+    // A type and its NoCopy twin share a name and containers switch between
+    // the two, so report them as one.
+    AllocatorCounters counters = { 0, 0, 0, 0, 0 };
+    for (int jj = ii; jj < numTypes; jj++) {
+      if (strcmp(_types[jj]->name, name) == 0) {
+        AllocatorCounters typeCounters;
+        allocatorCountersGet(&typeCounters, &_typeCounters[jj]);
+        counters.allocations += typeCounters.allocations;
+        counters.frees += typeCounters.frees;
+        counters.allocatedBytes += typeCounters.allocatedBytes;
+        counters.liveBytes += typeCounters.liveBytes;
+        counters.peakBytes += typeCounters.peakBytes;
+      }
+    }
+    if (first == false) {
+      straddstr(&json, ",");
+    }
+    first = false;
+    allocatorAddJsonCounters(&json, name, &counters, elapsedSeconds);
+  }
+  straddstr(&json, "]}");
+
+  return json;
+}
+
+/// @fn static void allocatorCountersReset(AllocatorCounters *counters)
+///
+/// @brief Zero the cumulative counters of a set and restart its peak at the
+/// current number of live bytes.  Live bytes are left alone since the memory
+/// they count is still allocated.
+///
+/// @param counters The counters to reset.
+///
+/// @return This function returns no value.
+static void allocatorCountersReset(AllocatorCounters *counters) {
+  __atomic_store_n(&counters->allocations, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&counters->frees, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&counters->allocatedBytes, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&counters->peakBytes,
+    __atomic_load_n(&counters->liveBytes, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+}
+
+/// @fn void allocatorStatsReset(void)
+///
+/// @brief Zero the allocation, free and byte totals of every subsystem and
+/// type and restart the allocation rates.  Live bytes are kept.
+///
+/// @return This function returns no value.
+void allocatorStatsReset(void) {
+  for (int ii = 0; ii < NUM_ALLOCATOR_SUBSYSTEMS; ii++) {
+    allocatorCountersReset(&_subsystemCounters[ii]);
+  }
+  for (int ii = 0; ii < ALLOCATOR_MAX_TYPES; ii++) {
+    allocatorCountersReset(&_typeCounters[ii]);
+  }
+  __atomic_store_n(&_statsStartNanoseconds, getMonotonicNanoseconds(),
+    __ATOMIC_RELAXED);
+}
+
@@ -0,0 +1,1424 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+//                     Copyright (c) 2012-2024 James Card                     //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included    //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+//                                                                            //
+//                                 James Card                                 //
+//                          http://www.jamescard.org                          //
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+// Doxygen marker
+/// @file
+
+#ifdef DS_LOGGING_ENABLED
+#include "LoggingLib.h"
+#else
+#undef printLog
+#define printLog(...) {}
+#define logFile stderr
+#define LOG_MALLOC_FAILURE(...) {}
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif // _WIN32
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define IO_URING_SUPPORTED
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#endif
+#endif // __linux__
+
+#include "AsyncIo.h"
+
+#ifdef IO_URING_SUPPORTED
+
+// Older kernel headers may not have the multishot flags.  The values are part
+// of the kernel ABI, so supplying them here is safe; kernels that don't
+// support them fail the operation with -EINVAL.
+#ifndef IORING_RECV_MULTISHOT
+#define IORING_RECV_MULTISHOT (1U << 1)
+#endif
+#ifndef IORING_ACCEPT_MULTISHOT
+#define IORING_ACCEPT_MULTISHOT (1U << 0)
+#endif
+
+/// @struct IoUringTimespec
+///
+/// @brief The kernel's struct __kernel_timespec, used for the timeout of
+/// ioUringSubmitAndWait.
+///
+/// @param tvSec The number of whole seconds.
+/// @param tvNsec The number of nanoseconds past tvSec.
+typedef struct IoUringTimespec {
+  i64 tvSec;
+  long long tvNsec;
+} IoUringTimespec;
+
+/// @struct IoUringGetEventsArgument
+///
+/// @brief The kernel's struct io_uring_getevents_arg, passed to io_uring_enter
+/// with IORING_ENTER_EXT_ARG.
+///
+/// @param sigmask The signal mask to apply while waiting.  Unused.
+/// @param sigmaskSize The size of sigmask.  Unused.
+/// @param pad Reserved.
+/// @param timeout The address of an IoUringTimespec, or 0 for no timeout.
+typedef struct IoUringGetEventsArgument {
+  u64 sigmask;
+  u32 sigmaskSize;
+  u32 pad;
+  u64 timeout;
+} IoUringGetEventsArgument;
+
+/// @struct IoUring
+///
+/// @brief An io_uring instance and the parts of its shared memory that we use.
+/// An IoUring is not thread safe.  Each thread should have its own.
+///
+/// @param fd The io_uring file descriptor.
+/// @param sqRing The mapping of the submission queue ring.
+/// @param sqRingSize The size of sqRing in bytes.
+/// @param cqRing The mapping of the completion queue ring.  The same as sqRing
+///   if the kernel maps both rings together.
+/// @param cqRingSize The size of cqRing in bytes.
+/// @param sqes The mapping of the submission queue entries.
+/// @param sqesSize The size of sqes in bytes.
+/// @param sqHead The kernel's submission queue head.
+/// @param sqTail The submission queue tail that the kernel sees.
+/// @param sqMask The mask to apply to submission queue indexes.
+/// @param sqEntries The number of entries in the submission queue.
+/// @param sqTailLocal The tail including entries that haven't been handed to
+///   the kernel yet.
+/// @param cqHead The completion queue head.
+/// @param cqTail The kernel's completion queue tail.
+/// @param cqMask The mask to apply to completion queue indexes.
+/// @param cqes The completion queue entries.
+/// @param buffersRegistered Whether or not buffers are registered with the
+///   kernel.
+struct IoUring {
+  int fd;
+  void *sqRing;
+  size_t sqRingSize;
+  void *cqRing;
+  size_t cqRingSize;
+  struct io_uring_sqe *sqes;
+  size_t sqesSize;
+  u32 *sqHead;
+  u32 *sqTail;
+  u32 sqMask;
+  u32 sqEntries;
+  u32 sqTailLocal;
+  u32 *cqHead;
+  u32 *cqTail;
+  u32 cqMask;
+  struct io_uring_cqe *cqes;
+  bool buffersRegistered;
+};
+
+/// @fn IoUring* ioUringCreate(u32 numEntries)
+///
+/// @brief Create an io_uring instance.
+///
+/// @param numEntries The number of operations that can be queued before they
+///   have to be submitted.  The kernel rounds this up to a power of two.  The
+///   completion queue is twice this size.
+///
+/// @return Returns a pointer to the new IoUring on success, NULL if io_uring
+/// isn't available (too old a kernel, disabled by the administrator, or not
+/// Linux) or on failure.
+IoUring* ioUringCreate(u32 numEntries) {
+  if (numEntries == 0) {
+    printLog(ERR, "Invalid number of entries.\n");
+    return NULL;
+  }
+  
+  ZEROINIT(struct io_uring_params params);
+  int fd = (int) syscall(__NR_io_uring_setup, numEntries, &params);
+  if (fd < 0) {
+    printLog(DEBUG, "io_uring is not available: %s\n", strerror(errno));
+    return NULL;
+  }
+  // We need IORING_FEAT_EXT_ARG to wait with a timeout.  Every kernel that has
+  // it (5.11 and later) also has IORING_FEAT_NODROP, so completions are never
+  // lost if the completion queue overflows.
+  if ((params.features & IORING_FEAT_EXT_ARG) == 0) {
+    printLog(DEBUG, "io_uring is too old to use.\n");
+    close(fd);
+    return NULL;
+  }
+  
+  IoUring *ring = (IoUring*) calloc(1, sizeof(IoUring));
+  if (ring == NULL) {
+    LOG_MALLOC_FAILURE();
+    close(fd);
+    return NULL;
+  }
+  ring->fd = fd;
+  
+  ring->sqRingSize = params.sq_off.array + (params.sq_entries * sizeof(u32));
+  ring->cqRingSize = params.cq_off.cqes
+    + (params.cq_entries * sizeof(struct io_uring_cqe));
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    if (ring->cqRingSize > ring->sqRingSize) {
+      ring->sqRingSize = ring->cqRingSize;
+    }
+    ring->cqRingSize = ring->sqRingSize;
+  }
+  ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE,
+    MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (ring->sqRing == MAP_FAILED) {
+    ring->sqRing = NULL;
+    printLog(ERR, "Could not map submission queue: %s\n", strerror(errno));
+    return ioUringDestroy(ring);
+  }
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    ring->cqRing = ring->sqRing;
+  } else {
+    ring->cqRing = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    if (ring->cqRing == MAP_FAILED) {
+      ring->cqRing = NULL;
+      printLog(ERR, "Could not map completion queue: %s\n", strerror(errno));
+      return ioUringDestroy(ring);
+    }
+  }
+  ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+  ring->sqes = (struct io_uring_sqe*) mmap(NULL, ring->sqesSize,
+    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (ring->sqes == MAP_FAILED) {
+    ring->sqes = NULL;
+    printLog(ERR, "Could not map submission entries: %s\n", strerror(errno));
+    return ioUringDestroy(ring);
+  }
+  
+  char *sqRing = (char*) ring->sqRing;
+  char *cqRing = (char*) ring->cqRing;
+  ring->sqHead = (u32*) (sqRing + params.sq_off.head);
+  ring->sqTail = (u32*) (sqRing + params.sq_off.tail);
+  ring->sqMask = *((u32*) (sqRing + params.sq_off.ring_mask));
+  ring->sqEntries = params.sq_entries;
+  ring->sqTailLocal = *ring->sqTail;
+  ring->cqHead = (u32*) (cqRing + params.cq_off.head);
+  ring->cqTail = (u32*) (cqRing + params.cq_off.tail);
+  ring->cqMask = *((u32*) (cqRing + params.cq_off.ring_mask));
+  ring->cqes = (struct io_uring_cqe*) (cqRing + params.cq_off.cqes);
+  
+  // Submission entry N always lives in slot N of the entry array, so the
+  // indirection array only has to be filled in once.
+  u32 *sqArray = (u32*) (sqRing + params.sq_off.array);
+  for (u32 ii = 0; ii < params.sq_entries; ii++) {
+    sqArray[ii] = ii;
+  }
+  
+  return ring;
+}
+
+/// @fn IoUring* ioUringDestroy(IoUring *ring)
+///
+/// @brief Destroy an io_uring instance.  Operations still in flight are
+/// cancelled.
+///
+/// @param ring The IoUring to destroy.
+///
+/// @return Always returns NULL.
+IoUring* ioUringDestroy(IoUring *ring) {
+  if (ring == NULL) {
+    return NULL;
+  }
+  
+  if (ring->sqes != NULL) {
+    munmap(ring->sqes, ring->sqesSize);
+  }
+  if ((ring->cqRing != NULL) && (ring->cqRing != ring->sqRing)) {
+    munmap(ring->cqRing, ring->cqRingSize);
+  }
+  if (ring->sqRing != NULL) {
+    munmap(ring->sqRing, ring->sqRingSize);
+  }
+  close(ring->fd);
+  free(ring); ring = NULL;
+  
+  return NULL;
+}
+
+/// @fn int ioUringRegisterBuffers(IoUring *ring, const IoUringBuffer *buffers, u32 numBuffers)
+///
+/// @brief Register buffers with the kernel so that ioUringQueueReadFixed and
+/// ioUringQueueWriteFixed don't have to map and pin them on every operation.
+/// Only one set of buffers can be registered at a time.
+///
+/// @param ring The IoUring to register the buffers with.
+/// @param buffers The buffers to register.  The index of a buffer in this
+///   array is the bufferIndex to pass when queueing an operation on it.
+/// @param numBuffers The number of elements in buffers.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringRegisterBuffers(IoUring *ring, const IoUringBuffer *buffers,
+  u32 numBuffers
+) {
+  if ((ring == NULL) || (buffers == NULL) || (numBuffers == 0)) {
+    printLog(ERR, "Invalid parameters.\n");
+    return -1;
+  } else if (ring->buffersRegistered == true) {
+    printLog(ERR, "Buffers are already registered.\n");
+    return -1;
+  }
+  
+  struct iovec *iovecs
+    = (struct iovec*) malloc(numBuffers * sizeof(struct iovec));
+  if (iovecs == NULL) {
+    LOG_MALLOC_FAILURE();
+    return -1;
+  }
+  for (u32 ii = 0; ii < numBuffers; ii++) {
+    iovecs[ii].iov_base = buffers[ii].base;
+    iovecs[ii].iov_len = buffers[ii].length;
+  }
+  int returnValue = (int) syscall(__NR_io_uring_register, ring->fd,
+    IORING_REGISTER_BUFFERS, iovecs, numBuffers);
+  free(iovecs); iovecs = NULL;
+  if (returnValue < 0) {
+    printLog(ERR, "Could not register buffers: %s\n", strerror(errno));
+    return -1;
+  }
+  ring->buffersRegistered = true;
+  
+  return 0;
+}
+
+/// @fn int ioUringUnregisterBuffers(IoUring *ring)
+///
+/// @brief Unregister the buffers registered with ioUringRegisterBuffers.
+///
+/// @param ring The IoUring to unregister the buffers from.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringUnregisterBuffers(IoUring *ring) {
+  if ((ring == NULL) || (ring->buffersRegistered == false)) {
+    return -1;
+  }
+  
+  if (syscall(__NR_io_uring_register, ring->fd, IORING_UNREGISTER_BUFFERS,
+    NULL, 0) < 0
+  ) {
+    printLog(ERR, "Could not unregister buffers: %s\n", strerror(errno));
+    return -1;
+  }
+  ring->buffersRegistered = false;
+  
+  return 0;
+}
+
+/// @fn static struct io_uring_sqe* ioUringGetSqe(IoUring *ring, u8 opcode, int fd, u64 userData)
+///
+/// @brief Get the next free submission queue entry and fill in the fields
+/// common to all operations.  If the submission queue is full, the entries in
+/// it are submitted first.
+///
+/// @param ring The IoUring to get the entry from.
+/// @param opcode The IORING_OP_* operation of the entry.
+/// @param fd The file descriptor the operation is on.
+/// @param userData The value to report in the operation's completion.
+///
+/// @return Returns a pointer to the zero-filled entry on success, NULL on
+/// failure.
+static struct io_uring_sqe* ioUringGetSqe(IoUring *ring, u8 opcode, int fd,
+  u64 userData
+) {
+  if (ring == NULL) {
+    printLog(ERR, "NULL ring provided.\n");
+    return NULL;
+  }
+  
+  if ((ring->sqTailLocal - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE))
+    >= ring->sqEntries
+  ) {
+    if ((ioUringSubmit(ring) < 0)
+      || ((ring->sqTailLocal - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE))
+        >= ring->sqEntries)
+    ) {
+      printLog(ERR, "Submission queue is full.\n");
+      return NULL;
+    }
+  }
+  
+  struct io_uring_sqe *sqe = &ring->sqes[ring->sqTailLocal & ring->sqMask];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->fd = fd;
+  sqe->user_data = userData;
+  ring->sqTailLocal++;
+  
+  return sqe;
+}
+
+/// @fn static struct io_uring_sqe* ioUringQueueReadWrite(IoUring *ring, u8 opcode, int fd, const void *buffer, u32 length, i64 offset, u64 userData)
+///
+/// @brief Queue an operation that transfers data between a file descriptor and
+/// a single buffer.
+///
+/// @param ring The IoUring to queue the operation on.
+/// @param opcode The IORING_OP_* operation to queue.
+/// @param fd The file descriptor to read or write.
+/// @param buffer The buffer to transfer the data to or from.
+/// @param length The number of bytes to transfer.
+/// @param offset The file offset to transfer at, or -1 to use (and advance)
+///   the file position.
+/// @param userData The value to report in the operation's completion.
+///
+/// @return Returns a pointer to the queued entry on success, NULL on failure.
+static struct io_uring_sqe* ioUringQueueReadWrite(IoUring *ring, u8 opcode,
+  int fd, const void *buffer, u32 length, i64 offset, u64 userData
+) {
+  struct io_uring_sqe *sqe = ioUringGetSqe(ring, opcode, fd, userData);
+  if (sqe == NULL) {
+    return NULL;
+  }
+  sqe->addr = (u64) (uintptr_t) buffer;
+  sqe->len = length;
+  sqe->off = (u64) offset;
+  
+  return sqe;
+}
+
+/// @fn int ioUringQueueRead(IoUring *ring, int fd, void *buffer, u32 length, i64 offset, u64 userData)
+///
+/// @brief Queue a read from a file descriptor.
+///
+/// @param ring The IoUring to queue the read on.
+/// @param fd The file descriptor to read from.
+/// @param buffer The buffer to read into.  Must stay valid until the read
+///   completes.
+/// @param length The maximum number of bytes to read.
+/// @param offset The file offset to read at, or -1 to use (and advance) the
+///   file position.
+/// @param userData The value to report in the read's completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueRead(IoUring *ring, int fd, void *buffer, u32 length,
+  i64 offset, u64 userData
+) {
+  return (ioUringQueueReadWrite(ring, IORING_OP_READ, fd, buffer, length,
+    offset, userData) != NULL) ? 0 : -1;
+}
+
+/// @fn int ioUringQueueWrite(IoUring *ring, int fd, const void *buffer, u32 length, i64 offset, u64 userData)
+///
+/// @brief Queue a write to a file descriptor.
+///
+/// @param ring The IoUring to queue the write on.
+/// @param fd The file descriptor to write to.
+/// @param buffer The data to write.  Must stay valid until the write
+///   completes.
+/// @param length The number of bytes to write.
+/// @param offset The file offset to write at, or -1 to use (and advance) the
+///   file position.
+/// @param userData The value to report in the write's completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueWrite(IoUring *ring, int fd, const void *buffer, u32 length,
+  i64 offset, u64 userData
+) {
+  return (ioUringQueueReadWrite(ring, IORING_OP_WRITE, fd, buffer, length,
+    offset, userData) != NULL) ? 0 : -1;
+}
+
+/// @fn int ioUringQueueReadFixed(IoUring *ring, int fd, u16 bufferIndex, void *buffer, u32 length, i64 offset, u64 userData)
+///
+/// @brief Queue a read into part of a buffer registered with
+/// ioUringRegisterBuffers.
+///
+/// @param ring The IoUring to queue the read on.
+/// @param fd The file descriptor to read from.
+/// @param bufferIndex The index of the registered buffer.
+/// @param buffer Where in the registered buffer to read to.
+/// @param length The maximum number of bytes to read.
+/// @param offset The file offset to read at, or -1 to use (and advance) the
+///   file position.
+/// @param userData The value to report in the read's completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueReadFixed(IoUring *ring, int fd, u16 bufferIndex,
+  void *buffer, u32 length, i64 offset, u64 userData
+) {
+  struct io_uring_sqe *sqe = ioUringQueueReadWrite(ring, IORING_OP_READ_FIXED,
+    fd, buffer, length, offset, userData);
+  if (sqe == NULL) {
+    return -1;
+  }
+  sqe->buf_index = bufferIndex;
+  
+  return 0;
+}
+
+/// @fn int ioUringQueueWriteFixed(IoUring *ring, int fd, u16 bufferIndex, const void *buffer, u32 length, i64 offset, u64 userData)
+///
+/// @brief Queue a write from part of a buffer registered with
+/// ioUringRegisterBuffers.
+///
+/// @param ring The IoUring to queue the write on.
+/// @param fd The file descriptor to write to.
+/// @param bufferIndex The index of the registered buffer.
+/// @param buffer Where in the registered buffer the data to write starts.
+/// @param length The number of bytes to write.
+/// @param offset The file offset to write at, or -1 to use (and advance) the
+///   file position.
+/// @param userData The value to report in the write's completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueWriteFixed(IoUring *ring, int fd, u16 bufferIndex,
+  const void *buffer, u32 length, i64 offset, u64 userData
+) {
+  struct io_uring_sqe *sqe = ioUringQueueReadWrite(ring,
+    IORING_OP_WRITE_FIXED, fd, buffer, length, offset, userData);
+  if (sqe == NULL) {
+    return -1;
+  }
+  sqe->buf_index = bufferIndex;
+  
+  return 0;
+}
+
+/// @fn int ioUringQueueFsync(IoUring *ring, int fd, u64 userData)
+///
+/// @brief Queue a flush of a file's data and metadata to storage.
+///
+/// @param ring The IoUring to queue the flush on.
+/// @param fd The file descriptor to flush.
+/// @param userData The value to report in the flush's completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueFsync(IoUring *ring, int fd, u64 userData) {
+  return (ioUringGetSqe(ring, IORING_OP_FSYNC, fd, userData) != NULL)
+    ? 0 : -1;
+}
+
+/// @fn int ioUringQueueSend(IoUring *ring, int fd, const void *buffer, u32 length, int flags, u64 userData)
+///
+/// @brief Queue a send on a socket.
+///
+/// @param ring The IoUring to queue the send on.
+/// @param fd The socket to send on.
+/// @param buffer The data to send.  Must stay valid until the send completes.
+/// @param length The number of bytes to send.
+/// @param flags The MSG_* flags to pass to send.
+/// @param userData The value to report in the send's completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueSend(IoUring *ring, int fd, const void *buffer, u32 length,
+  int flags, u64 userData
+) {
+  struct io_uring_sqe *sqe = ioUringQueueReadWrite(ring, IORING_OP_SEND, fd,
+    buffer, length, 0, userData);
+  if (sqe == NULL) {
+    return -1;
+  }
+  sqe->msg_flags = (u32) flags;
+  
+  return 0;
+}
+
+/// @fn int ioUringQueueRecv(IoUring *ring, int fd, void *buffer, u32 length, int flags, u64 userData)
+///
+/// @brief Queue a receive on a socket.
+///
+/// @param ring The IoUring to queue the receive on.
+/// @param fd The socket to receive on.
+/// @param buffer The buffer to receive into.  Must stay valid until the
+///   receive completes.
+/// @param length The maximum number of bytes to receive.
+/// @param flags The MSG_* flags to pass to recv.
+/// @param userData The value to report in the receive's completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueRecv(IoUring *ring, int fd, void *buffer, u32 length,
+  int flags, u64 userData
+) {
+  struct io_uring_sqe *sqe = ioUringQueueReadWrite(ring, IORING_OP_RECV, fd,
+    buffer, length, 0, userData);
+  if (sqe == NULL) {
+    return -1;
+  }
+  sqe->msg_flags = (u32) flags;
+  
+  return 0;
+}
+
+/// @fn int ioUringQueueProvideBuffers(IoUring *ring, u16 bufferGroup, void *base, u32 bufferSize, u32 numBuffers, u16 firstBufferId, u64 userData)
+///
+/// @brief Queue handing a set of equally-sized buffers to the kernel for
+/// operations queued with a buffer group, such as
+/// ioUringQueueRecvMultishot, to pick from.  A buffer is handed back in the
+/// completion of the operation that used it and must be provided again once
+/// the caller is done with it.
+///
+/// @param ring The IoUring to queue the operation on.
+/// @param bufferGroup The ID of the group to add the buffers to.
+/// @param base The address of the first buffer.  The others follow it
+///   contiguously.
+/// @param bufferSize The size of each buffer in bytes.
+/// @param numBuffers The number of buffers.
+/// @param firstBufferId The ID of the first buffer.  The others get
+///   consecutive IDs.
+/// @param userData The value to report in the operation's completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueProvideBuffers(IoUring *ring, u16 bufferGroup, void *base,
+  u32 bufferSize, u32 numBuffers, u16 firstBufferId, u64 userData
+) {
+  struct io_uring_sqe *sqe = ioUringQueueReadWrite(ring,
+    IORING_OP_PROVIDE_BUFFERS, (int) numBuffers, base, bufferSize,
+    firstBufferId, userData);
+  if (sqe == NULL) {
+    return -1;
+  }
+  sqe->buf_group = bufferGroup;
+  
+  return 0;
+}
+
+/// @fn int ioUringQueueRecvMultishot(IoUring *ring, int fd, u16 bufferGroup, u64 userData)
+///
+/// @brief Queue a receive that stays armed and produces a completion each time
+/// data arrives on a socket, using buffers from a group provided with
+/// ioUringQueueProvideBuffers.  Completions have IO_URING_COMPLETION_MORE set
+/// while the receive is still armed.  It's disarmed when the peer closes the
+/// connection, on error, or when the buffer group runs out (-ENOBUFS), and
+/// must be queued again in the last two cases.
+///
+/// @param ring The IoUring to queue the receive on.
+/// @param fd The socket to receive on.
+/// @param bufferGroup The ID of the buffer group to receive into.
+/// @param userData The value to report in each of the receive's completions.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueRecvMultishot(IoUring *ring, int fd, u16 bufferGroup,
+  u64 userData
+) {
+  struct io_uring_sqe *sqe = ioUringGetSqe(ring, IORING_OP_RECV, fd, userData);
+  if (sqe == NULL) {
+    return -1;
+  }
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = bufferGroup;
+  sqe->ioprio = IORING_RECV_MULTISHOT;
+  
+  return 0;
+}
+
+/// @fn int ioUringQueueAccept(IoUring *ring, int fd, bool multishot, u64 userData)
+///
+/// @brief Queue accepting a connection on a listening socket.  The result of
+/// the completion is the new connection's file descriptor.  Accepted sockets
+/// are created close-on-exec.
+///
+/// @param ring The IoUring to queue the accept on.
+/// @param fd The listening socket.
+/// @param multishot If true, the accept stays armed and produces a completion
+///   for every incoming connection (with IO_URING_COMPLETION_MORE set while it
+///   stays armed).
+/// @param userData The value to report in the accept's completions.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueAccept(IoUring *ring, int fd, bool multishot, u64 userData) {
+  struct io_uring_sqe *sqe
+    = ioUringGetSqe(ring, IORING_OP_ACCEPT, fd, userData);
+  if (sqe == NULL) {
+    return -1;
+  }
+  sqe->accept_flags = SOCK_CLOEXEC;
+  if (multishot == true) {
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+  }
+  
+  return 0;
+}
+
+/// @fn int ioUringQueuePoll(IoUring *ring, int fd, u32 pollEvents, u64 userData)
+///
+/// @brief Queue a one-shot wait for a file descriptor to become ready.  The
+/// result of the completion is the ready poll events.
+///
+/// @param ring The IoUring to queue the wait on.
+/// @param fd The file descriptor to wait on.
+/// @param pollEvents The POLL* events to wait for.
+/// @param userData The value to report in the wait's completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueuePoll(IoUring *ring, int fd, u32 pollEvents, u64 userData) {
+  struct io_uring_sqe *sqe
+    = ioUringGetSqe(ring, IORING_OP_POLL_ADD, fd, userData);
+  if (sqe == NULL) {
+    return -1;
+  }
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  // The kernel reads the events as two 16-bit halves on big-endian systems.
+  pollEvents = (pollEvents << 16) | (pollEvents >> 16);
+#endif
+  sqe->poll32_events = pollEvents;
+  
+  return 0;
+}
+
+/// @fn int ioUringQueuePollRemove(IoUring *ring, u64 targetUserData, u64 userData)
+///
+/// @brief Queue the removal of a wait queued with ioUringQueuePoll.  The wait
+/// completes with -ECANCELED if it hadn't already completed.
+///
+/// @param ring The IoUring to queue the removal on.
+/// @param targetUserData The userData the wait was queued with.
+/// @param userData The value to report in the removal's own completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueuePollRemove(IoUring *ring, u64 targetUserData, u64 userData) {
+  struct io_uring_sqe *sqe
+    = ioUringGetSqe(ring, IORING_OP_POLL_REMOVE, -1, userData);
+  if (sqe == NULL) {
+    return -1;
+  }
+  sqe->addr = targetUserData;
+  
+  return 0;
+}
+
+/// @fn int ioUringQueueCancel(IoUring *ring, u64 targetUserData, u64 userData)
+///
+/// @brief Queue the cancellation of an operation, such as a multishot accept
+/// or receive.  The operation completes with -ECANCELED if it hadn't already
+/// completed.
+///
+/// @param ring The IoUring to queue the cancellation on.
+/// @param targetUserData The userData the operation was queued with.
+/// @param userData The value to report in the cancellation's own completion.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ioUringQueueCancel(IoUring *ring, u64 targetUserData, u64 userData) {
+  struct io_uring_sqe *sqe
+    = ioUringGetSqe(ring, IORING_OP_ASYNC_CANCEL, -1, userData);
+  if (sqe == NULL) {
+    return -1;
+  }
+  sqe->addr = targetUserData;
+  
+  return 0;
+}
+
+/// @fn static int ioUringEnter(IoUring *ring, u32 minComplete, int timeoutMilliseconds)
+///
+/// @brief Hand the queued operations to the kernel and, optionally, wait for
+/// completions, all in one system call.
+///
+/// @param ring The IoUring to submit the operations of.
+/// @param minComplete The number of completions to wait for, or 0 to not wait.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait, or a
+///   negative value to wait indefinitely.
+///
+/// @return Returns the number of operations submitted on success, -1 on
+/// failure.  A wait that times out or is interrupted is not a failure.
+static int ioUringEnter(IoUring *ring, u32 minComplete,
+  int timeoutMilliseconds
+) {
+  __atomic_store_n(ring->sqTail, ring->sqTailLocal, __ATOMIC_RELEASE);
+  u32 toSubmit
+    = ring->sqTailLocal - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+  if ((toSubmit == 0) && (minComplete == 0)) {
+    return 0;
+  }
+  
+  u32 flags = 0;
+  ZEROINIT(IoUringGetEventsArgument argument);
+  ZEROINIT(IoUringTimespec timeout);
+  if (minComplete > 0) {
+    flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+    if (timeoutMilliseconds >= 0) {
+      timeout.tvSec = timeoutMilliseconds / 1000;
+      timeout.tvNsec = ((long long) (timeoutMilliseconds % 1000)) * 1000000LL;
+      argument.timeout = (u64) (uintptr_t) &timeout;
+    }
+  }
+  
+  long returnValue = 0;
+  do {
+    returnValue = syscall(__NR_io_uring_enter, ring->fd, toSubmit,
+      minComplete, flags, (minComplete > 0) ? &argument : NULL,
+      (minComplete > 0) ? sizeof(argument) : 0);
+  } while ((returnValue < 0) && (errno == EINTR) && (minComplete == 0));
+  if (returnValue < 0) {
+    if ((errno == ETIME) || (errno == EINTR)) {
+      return 0;
+    }
+    printLog(ERR, "io_uring_enter failed: %s\n", strerror(errno));
+    return -1;
+  }
+  
+  return (int) returnValue;
+}
+
+/// @fn int ioUringSubmit(IoUring *ring)
+///
+/// @brief Hand all of the queued operations to the kernel in one system call.
+///
+/// @param ring The IoUring to submit the operations of.
+///
+/// @return Returns the number of operations submitted on success, -1 on
+/// failure.
+int ioUringSubmit(IoUring *ring) {
+  if (ring == NULL) {
+    printLog(ERR, "NULL ring provided.\n");
+    return -1;
+  }
+  
+  return ioUringEnter(ring, 0, 0);
+}
+
+/// @fn int ioUringSubmitAndWait(IoUring *ring, int timeoutMilliseconds)
+///
+/// @brief Hand all of the queued operations to the kernel and wait for at
+/// least one completion, in one system call.
+///
+/// @param ring The IoUring to submit the operations of.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait, 0 to
+///   not wait at all, or a negative value to wait indefinitely.
+///
+/// @return Returns the number of operations submitted on success (which may
+/// be 0 whether or not there are completions to collect), -1 on failure.
+int ioUringSubmitAndWait(IoUring *ring, int timeoutMilliseconds) {
+  if (ring == NULL) {
+    printLog(ERR, "NULL ring provided.\n");
+    return -1;
+  } else if (timeoutMilliseconds == 0) {
+    return ioUringEnter(ring, 0, 0);
+  }
+  
+  return ioUringEnter(ring, 1, timeoutMilliseconds);
+}
+
+/// @fn bool ioUringPeekCompletion(IoUring *ring, IoUringCompletion *completion)
+///
+/// @brief Take the next completion off of the completion queue without
+/// entering the kernel.
+///
+/// @param ring The IoUring to take the completion from.
+/// @param completion Where to store the completion.
+///
+/// @return Returns true if a completion was taken, false if there were none.
+bool ioUringPeekCompletion(IoUring *ring, IoUringCompletion *completion) {
+  if ((ring == NULL) || (completion == NULL)) {
+    return false;
+  }
+  
+  u32 head = *ring->cqHead;
+  if (head == __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE)) {
+    return false;
+  }
+  struct io_uring_cqe *cqe = &ring->cqes[head & ring->cqMask];
+  completion->userData = cqe->user_data;
+  completion->result = cqe->res;
+  completion->flags = cqe->flags
+    & (IO_URING_COMPLETION_MORE | IO_URING_COMPLETION_BUFFER);
+  completion->bufferId = (u16) (cqe->flags >> 16);
+  __atomic_store_n(ring->cqHead, head + 1, __ATOMIC_RELEASE);
+  
+  return true;
+}
+
+#else // IO_URING_SUPPORTED
+
+// Without io_uring, ioUringCreate always fails, so there's never a ring to
+// pass to the other functions.
+
+struct IoUring {
+  int fd;
+};
+
+IoUring* ioUringCreate(u32 numEntries) {
+  (void) numEntries;
+  return NULL;
+}
+
+IoUring* ioUringDestroy(IoUring *ring) {
+  (void) ring;
+  return NULL;
+}
+
+int ioUringRegisterBuffers(IoUring *ring, const IoUringBuffer *buffers,
+  u32 numBuffers
+) {
+  (void) ring; (void) buffers; (void) numBuffers;
+  return -1;
+}
+
+int ioUringUnregisterBuffers(IoUring *ring) {
+  (void) ring;
+  return -1;
+}
+
+int ioUringQueueRead(IoUring *ring, int fd, void *buffer, u32 length,
+  i64 offset, u64 userData
+) {
+  (void) ring; (void) fd; (void) buffer; (void) length; (void) offset;
+  (void) userData;
+  return -1;
+}
+
+int ioUringQueueWrite(IoUring *ring, int fd, const void *buffer, u32 length,
+  i64 offset, u64 userData
+) {
+  (void) ring; (void) fd; (void) buffer; (void) length; (void) offset;
+  (void) userData;
+  return -1;
+}
+
+int ioUringQueueReadFixed(IoUring *ring, int fd, u16 bufferIndex,
+  void *buffer, u32 length, i64 offset, u64 userData
+) {
+  (void) ring; (void) fd; (void) bufferIndex; (void) buffer; (void) length;
+  (void) offset; (void) userData;
+  return -1;
+}
+
+int ioUringQueueWriteFixed(IoUring *ring, int fd, u16 bufferIndex,
+  const void *buffer, u32 length, i64 offset, u64 userData
+) {
+  (void) ring; (void) fd; (void) bufferIndex; (void) buffer; (void) length;
+  (void) offset; (void) userData;
+  return -1;
+}
+
+int ioUringQueueFsync(IoUring *ring, int fd, u64 userData) {
+  (void) ring; (void) fd; (void) userData;
+  return -1;
+}
+
+int ioUringQueueSend(IoUring *ring, int fd, const void *buffer, u32 length,
+  int flags, u64 userData
+) {
+  (void) ring; (void) fd; (void) buffer; (void) length; (void) flags;
+  (void) userData;
+  return -1;
+}
+
+int ioUringQueueRecv(IoUring *ring, int fd, void *buffer, u32 length,
+  int flags, u64 userData
+) {
+  (void) ring; (void) fd; (void) buffer; (void) length; (void) flags;
+  (void) userData;
+  return -1;
+}
+
+int ioUringQueueProvideBuffers(IoUring *ring, u16 bufferGroup, void *base,
+  u32 bufferSize, u32 numBuffers, u16 firstBufferId, u64 userData
+) {
+  (void) ring; (void) bufferGroup; (void) base; (void) bufferSize;
+  (void) numBuffers; (void) firstBufferId; (void) userData;
+  return -1;
+}
+
+int ioUringQueueRecvMultishot(IoUring *ring, int fd, u16 bufferGroup,
+  u64 userData
+) {
+  (void) ring; (void) fd; (void) bufferGroup; (void) userData;
+  return -1;
+}
+
+int ioUringQueueAccept(IoUring *ring, int fd, bool multishot, u64 userData) {
+  (void) ring; (void) fd; (void) multishot; (void) userData;
+  return -1;
+}
+
+int ioUringQueuePoll(IoUring *ring, int fd, u32 pollEvents, u64 userData) {
+  (void) ring; (void) fd; (void) pollEvents; (void) userData;
+  return -1;
+}
+
+int ioUringQueuePollRemove(IoUring *ring, u64 targetUserData, u64 userData) {
+  (void) ring; (void) targetUserData; (void) userData;
+  return -1;
+}
+
+int ioUringQueueCancel(IoUring *ring, u64 targetUserData, u64 userData) {
+  (void) ring; (void) targetUserData; (void) userData;
+  return -1;
+}
+
+int ioUringSubmit(IoUring *ring) {
+  (void) ring;
+  return -1;
+}
+
+int ioUringSubmitAndWait(IoUring *ring, int timeoutMilliseconds) {
+  (void) ring; (void) timeoutMilliseconds;
+  return -1;
+}
+
+bool ioUringPeekCompletion(IoUring *ring, IoUringCompletion *completion) {
+  (void) ring; (void) completion;
+  return false;
+}
+
+#endif // IO_URING_SUPPORTED
+
+/// @def ASYNC_IO_MAX_TRANSFER
+///
+/// @brief The largest number of bytes one AsyncIo operation transfers.  Linux
+/// never transfers more than this in one call anyway, and it keeps the
+/// result of an io_uring completion positive.
+#define ASYNC_IO_MAX_TRANSFER 0x7ffff000
+
+/// @enum AsyncIoOperationType
+///
+/// @brief The kinds of operation an AsyncIo can queue.
+typedef enum AsyncIoOperationType {
+  ASYNC_IO_READ,
+  ASYNC_IO_WRITE,
+  ASYNC_IO_FSYNC
+} AsyncIoOperationType;
+
+/// @struct AsyncIoOperation
+///
+/// @brief An operation queued on an AsyncIo that has no IoUring.
+///
+/// @param type The kind of operation.
+/// @param fd The file descriptor to operate on.
+/// @param buffer The buffer to transfer data to or from.
+/// @param length The number of bytes to transfer.
+/// @param offset The file offset to transfer at, or -1 to use the file
+///   position.
+/// @param userData The value to report in the operation's AsyncIoResult.
+typedef struct AsyncIoOperation {
+  AsyncIoOperationType type;
+  int fd;
+  void *buffer;
+  size_t length;
+  i64 offset;
+  void *userData;
+} AsyncIoOperation;
+
+/// @struct AsyncIo
+///
+/// @brief A queue of asynchronous file operations.  Not thread safe.
+///
+/// @param ring The IoUring the operations go through, or NULL if they're
+///   performed by asyncIoSubmit itself.
+/// @param depth The maximum number of operations that can be pending.
+/// @param numPending The number of operations queued whose results haven't
+///   been returned by asyncIoWait yet.
+/// @param operations The operations queued since the last asyncIoSubmit when
+///   there's no ring.
+/// @param numOperations The number of elements of operations in use.
+/// @param results The results of performed operations not yet returned by
+///   asyncIoWait when there's no ring.
+/// @param resultsHead The index of the first result not yet returned.
+/// @param numResults The number of elements of results in use.
+struct AsyncIo {
+  IoUring *ring;
+  u32 depth;
+  u32 numPending;
+  AsyncIoOperation *operations;
+  u32 numOperations;
+  AsyncIoResult *results;
+  u32 resultsHead;
+  u32 numResults;
+};
+
+/// @fn AsyncIo* asyncIoCreate(u32 depth)
+///
+/// @brief Create a queue of asynchronous file operations.  On Linux the
+/// operations go through io_uring when it's available.  Everywhere else
+/// they're performed, in order, when they're submitted.
+///
+/// @param depth The maximum number of operations that can be pending at once.
+///
+/// @return Returns a pointer to the new AsyncIo on success, NULL on failure.
+AsyncIo* asyncIoCreate(u32 depth) {
+  if (depth == 0) {
+    printLog(ERR, "Invalid depth.\n");
+    return NULL;
+  }
+  
+  AsyncIo *asyncIo = (AsyncIo*) calloc(1, sizeof(AsyncIo));
+  if (asyncIo == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  asyncIo->depth = depth;
+  asyncIo->ring = ioUringCreate(depth);
+  if (asyncIo->ring == NULL) {
+    asyncIo->operations
+      = (AsyncIoOperation*) malloc(depth * sizeof(AsyncIoOperation));
+    asyncIo->results = (AsyncIoResult*) malloc(depth * sizeof(AsyncIoResult));
+    if ((asyncIo->operations == NULL) || (asyncIo->results == NULL)) {
+      LOG_MALLOC_FAILURE();
+      return asyncIoDestroy(asyncIo);
+    }
+  }
+  
+  return asyncIo;
+}
+
+/// @fn AsyncIo* asyncIoDestroy(AsyncIo *asyncIo)
+///
+/// @brief Destroy a queue of asynchronous file operations.  Operations still
+/// pending are cancelled or, if they've already been handed to the kernel,
+/// may still complete, so their buffers must stay valid until the results
+/// have been collected.
+///
+/// @param asyncIo The AsyncIo to destroy.
+///
+/// @return Always returns NULL.
+AsyncIo* asyncIoDestroy(AsyncIo *asyncIo) {
+  if (asyncIo == NULL) {
+    return NULL;
+  }
+  
+  asyncIo->ring = ioUringDestroy(asyncIo->ring);
+  free(asyncIo->operations); asyncIo->operations = NULL;
+  free(asyncIo->results); asyncIo->results = NULL;
+  free(asyncIo); asyncIo = NULL;
+  
+  return NULL;
+}
+
+/// @fn bool asyncIoUsesIoUring(AsyncIo *asyncIo)
+///
+/// @brief Determine whether or not an AsyncIo's operations go through
+/// io_uring.
+///
+/// @param asyncIo The AsyncIo to examine.
+///
+/// @return Returns true if the operations go through io_uring, false if
+/// they're performed by asyncIoSubmit.
+bool asyncIoUsesIoUring(AsyncIo *asyncIo) {
+  return (asyncIo != NULL) && (asyncIo->ring != NULL);
+}
+
+/// @fn u32 asyncIoNumPending(AsyncIo *asyncIo)
+///
+/// @brief Get the number of operations whose results haven't been returned by
+/// asyncIoWait yet.
+///
+/// @param asyncIo The AsyncIo to examine.
+///
+/// @return Returns the number of pending operations, 0 if asyncIo is NULL.
+u32 asyncIoNumPending(AsyncIo *asyncIo) {
+  return (asyncIo != NULL) ? asyncIo->numPending : 0;
+}
+
+/// @fn static int asyncIoQueue(AsyncIo *asyncIo, AsyncIoOperationType type, int fd, void *buffer, size_t length, i64 offset, void *userData)
+///
+/// @brief Queue an operation on an AsyncIo.
+///
+/// @param asyncIo The AsyncIo to queue the operation on.
+/// @param type The kind of operation.
+/// @param fd The file descriptor to operate on.
+/// @param buffer The buffer to transfer data to or from.
+/// @param length The number of bytes to transfer.
+/// @param offset The file offset to transfer at, or a negative value to use
+///   (and advance) the file position.
+/// @param userData The value to report in the operation's AsyncIoResult.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int asyncIoQueue(AsyncIo *asyncIo, AsyncIoOperationType type, int fd,
+  void *buffer, size_t length, i64 offset, void *userData
+) {
+  if ((asyncIo == NULL) || (fd < 0)
+    || ((buffer == NULL) && (type != ASYNC_IO_FSYNC))
+  ) {
+    printLog(ERR, "Invalid parameters.\n");
+    return -1;
+  } else if (asyncIo->numPending >= asyncIo->depth) {
+    printLog(ERR, "AsyncIo is full.  Collect results with asyncIoWait.\n");
+    return -1;
+  }
+  
+  if (length > ASYNC_IO_MAX_TRANSFER) {
+    length = ASYNC_IO_MAX_TRANSFER;
+  }
+  if (offset < 0) {
+    offset = -1;
+  }
+  
+  if (asyncIo->ring != NULL) {
+    int returnValue = -1;
+    u64 ringUserData = (u64) (uintptr_t) userData;
+    if (type == ASYNC_IO_READ) {
+      returnValue = ioUringQueueRead(asyncIo->ring, fd, buffer, (u32) length,
+        offset, ringUserData);
+    } else if (type == ASYNC_IO_WRITE) {
+      returnValue = ioUringQueueWrite(asyncIo->ring, fd, buffer, (u32) length,
+        offset, ringUserData);
+    } else {
+      returnValue = ioUringQueueFsync(asyncIo->ring, fd, ringUserData);
+    }
+    if (returnValue != 0) {
+      return -1;
+    }
+  } else {
+    AsyncIoOperation *operation
+      = &asyncIo->operations[asyncIo->numOperations];
+    operation->type = type;
+    operation->fd = fd;
+    operation->buffer = buffer;
+    operation->length = length;
+    operation->offset = offset;
+    operation->userData = userData;
+    asyncIo->numOperations++;
+  }
+  asyncIo->numPending++;
+  
+  return 0;
+}
+
+/// @fn int asyncIoRead(AsyncIo *asyncIo, int fd, void *buffer, size_t length, i64 offset, void *userData)
+///
+/// @brief Queue a read from a file.
+///
+/// @param asyncIo The AsyncIo to queue the read on.
+/// @param fd The file descriptor to read from.
+/// @param buffer The buffer to read into.  Must stay valid until the read's
+///   result is returned by asyncIoWait.
+/// @param length The maximum number of bytes to read.
+/// @param offset The file offset to read at, or a negative value to use (and
+///   advance) the file position.
+/// @param userData The value to report in the read's AsyncIoResult.
+///
+/// @return Returns 0 on success, -1 on failure.
+int asyncIoRead(AsyncIo *asyncIo, int fd, void *buffer, size_t length,
+  i64 offset, void *userData
+) {
+  return asyncIoQueue(asyncIo, ASYNC_IO_READ, fd, buffer, length, offset,
+    userData);
+}
+
+/// @fn int asyncIoWrite(AsyncIo *asyncIo, int fd, const void *buffer, size_t length, i64 offset, void *userData)
+///
+/// @brief Queue a write to a file.
+///
+/// @param asyncIo The AsyncIo to queue the write on.
+/// @param fd The file descriptor to write to.
+/// @param buffer The data to write.  Must stay valid until the write's result
+///   is returned by asyncIoWait.
+/// @param length The number of bytes to write.
+/// @param offset The file offset to write at, or a negative value to use (and
+///   advance) the file position.
+/// @param userData The value to report in the write's AsyncIoResult.
+///
+/// @return Returns 0 on success, -1 on failure.
+int asyncIoWrite(AsyncIo *asyncIo, int fd, const void *buffer, size_t length,
+  i64 offset, void *userData
+) {
+  return asyncIoQueue(asyncIo, ASYNC_IO_WRITE, fd, (void*) buffer, length,
+    offset, userData);
+}
+
+/// @fn int asyncIoFsync(AsyncIo *asyncIo, int fd, void *userData)
+///
+/// @brief Queue a flush of a file's data and metadata to storage.  The flush
+/// is not ordered with respect to other pending operations, so wait for the
+/// writes it should cover to complete before queueing it.
+///
+/// @param asyncIo The AsyncIo to queue the flush on.
+/// @param fd The file descriptor to flush.
+/// @param userData The value to report in the flush's AsyncIoResult.
+///
+/// @return Returns 0 on success, -1 on failure.
+int asyncIoFsync(AsyncIo *asyncIo, int fd, void *userData) {
+  return asyncIoQueue(asyncIo, ASYNC_IO_FSYNC, fd, NULL, 0, -1, userData);
+}
+
+/// @fn static i64 asyncIoPerform(AsyncIoOperation *operation)
+///
+/// @brief Perform a queued operation synchronously.
+///
+/// @param operation The operation to perform.
+///
+/// @return Returns the number of bytes transferred (0 for a flush) on success,
+/// a negated errno value on failure.
+static i64 asyncIoPerform(AsyncIoOperation *operation) {
+  i64 returnValue = 0;
+#ifdef _WIN32
+  if ((operation->type != ASYNC_IO_FSYNC) && (operation->offset >= 0)
+    && (_lseeki64(operation->fd, operation->offset, SEEK_SET) < 0)
+  ) {
+    return -((i64) errno);
+  }
+  if (operation->type == ASYNC_IO_READ) {
+    returnValue = _read(operation->fd, operation->buffer,
+      (unsigned int) operation->length);
+  } else if (operation->type == ASYNC_IO_WRITE) {
+    returnValue = _write(operation->fd, operation->buffer,
+      (unsigned int) operation->length);
+  } else {
+    returnValue = _commit(operation->fd);
+  }
+#else
+  do {
+    if (operation->type == ASYNC_IO_READ) {
+      returnValue = (operation->offset >= 0)
+        ? pread(operation->fd, operation->buffer, operation->length,
+          (off_t) operation->offset)
+        : read(operation->fd, operation->buffer, operation->length);
+    } else if (operation->type == ASYNC_IO_WRITE) {
+      returnValue = (operation->offset >= 0)
+        ? pwrite(operation->fd, operation->buffer, operation->length,
+          (off_t) operation->offset)
+        : write(operation->fd, operation->buffer, operation->length);
+    } else {
+      returnValue = fsync(operation->fd);
+    }
+  } while ((returnValue < 0) && (errno == EINTR));
+#endif // _WIN32
+  if (returnValue < 0) {
+    return -((i64) errno);
+  }
+  
+  return returnValue;
+}
+
+/// @fn int asyncIoSubmit(AsyncIo *asyncIo)
+///
+/// @brief Start all of the operations queued since the last submission.  With
+/// io_uring they're handed to the kernel in one system call.  Without it
+/// they're performed here, in the order they were queued.
+///
+/// @param asyncIo The AsyncIo to submit the operations of.
+///
+/// @return Returns the number of operations submitted on success, -1 on
+/// failure.
+int asyncIoSubmit(AsyncIo *asyncIo) {
+  if (asyncIo == NULL) {
+    printLog(ERR, "NULL AsyncIo provided.\n");
+    return -1;
+  } else if (asyncIo->ring != NULL) {
+    return ioUringSubmit(asyncIo->ring);
+  }
+  
+  if (asyncIo->resultsHead == asyncIo->numResults) {
+    asyncIo->resultsHead = 0;
+    asyncIo->numResults = 0;
+  } else if (asyncIo->resultsHead > 0) {
+    memmove(asyncIo->results, &asyncIo->results[asyncIo->resultsHead],
+      (asyncIo->numResults - asyncIo->resultsHead) * sizeof(AsyncIoResult));
+    asyncIo->numResults -= asyncIo->resultsHead;
+    asyncIo->resultsHead = 0;
+  }
+  
+  u32 numOperations = asyncIo->numOperations;
+  for (u32 ii = 0; ii < numOperations; ii++) {
+    AsyncIoResult *result = &asyncIo->results[asyncIo->numResults];
+    result->userData = asyncIo->operations[ii].userData;
+    result->result = asyncIoPerform(&asyncIo->operations[ii]);
+    asyncIo->numResults++;
+  }
+  asyncIo->numOperations = 0;
+  
+  return (int) numOperations;
+}
+
+/// @fn static int asyncIoCollect(AsyncIo *asyncIo, AsyncIoResult *results, int maxResults)
+///
+/// @brief Collect the results that are already available without waiting.
+///
+/// @param asyncIo The AsyncIo to collect the results of.
+/// @param results The array to store the results in.
+/// @param maxResults The maximum number of results to store.
+///
+/// @return Returns the number of results stored.
+static int asyncIoCollect(AsyncIo *asyncIo, AsyncIoResult *results,
+  int maxResults
+) {
+  int numResults = 0;
+  if (asyncIo->ring != NULL) {
+    IoUringCompletion completion;
+    while ((numResults < maxResults)
+      && (ioUringPeekCompletion(asyncIo->ring, &completion) == true)
+    ) {
+      results[numResults].userData = (void*) (uintptr_t) completion.userData;
+      results[numResults].result = completion.result;
+      numResults++;
+    }
+  } else {
+    while ((numResults < maxResults)
+      && (asyncIo->resultsHead < asyncIo->numResults)
+    ) {
+      results[numResults] = asyncIo->results[asyncIo->resultsHead];
+      asyncIo->resultsHead++;
+      numResults++;
+    }
+  }
+  asyncIo->numPending -= (u32) numResults;
+  
+  return numResults;
+}
+
+/// @fn int asyncIoWait(AsyncIo *asyncIo, AsyncIoResult *results, int maxResults, int timeoutMilliseconds)
+///
+/// @brief Submit any unsubmitted operations and collect the results of
+/// completed ones, waiting for at least one if none have completed yet.
+/// Results are not necessarily returned in the order the operations were
+/// queued.
+///
+/// @param asyncIo The AsyncIo to collect the results of.
+/// @param results The array to store the results in.
+/// @param maxResults The maximum number of results to store.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait, 0 to
+///   not wait at all, or a negative value to wait indefinitely.
+///
+/// @return Returns the number of results stored (0 if nothing completed
+/// before the timeout or nothing was pending) on success, -1 on failure.
+int asyncIoWait(AsyncIo *asyncIo, AsyncIoResult *results, int maxResults,
+  int timeoutMilliseconds
+) {
+  if ((asyncIo == NULL) || (results == NULL) || (maxResults <= 0)) {
+    printLog(ERR, "Invalid parameters.\n");
+    return -1;
+  }
+  
+  if (asyncIo->ring == NULL) {
+    // Everything submitted has already completed.
+    asyncIoSubmit(asyncIo);
+    return asyncIoCollect(asyncIo, results, maxResults);
+  }
+  
+  int numResults = asyncIoCollect(asyncIo, results, maxResults);
+  if (ioUringSubmitAndWait(asyncIo->ring,
+    ((numResults > 0) || (asyncIo->numPending == 0))
+      ? 0 : timeoutMilliseconds) < 0
+  ) {
+    return (numResults > 0) ? numResults : -1;
+  }
+  numResults += asyncIoCollect(asyncIo, &results[numResults],
+    maxResults - numResults);
+  
+  return numResults;
+}
+
@@ -54,6 +54,76 @@ int thrd_msg_q_destroy(thrd_msg_q_t *queue);
 }
 #endif
 
+/// @def THRD_MSG_Q_LOCK_FREE
+///
+/// @brief Whether or not thread message queues use the lock-free
+/// multi-producer/single-consumer backend.
+///
+/// @details When this is 0, every push takes the destination queue's lock and
+/// signals its condition.  When this is 1, producers push onto the queue's
+/// incoming stack with a single compare-and-swap and only take the lock to
+/// wake the queue's thread if it is parked.  The queue's thread moves the
+/// incoming messages into its own list without any lock, spins for up to
+/// THRD_MSG_Q_SPIN_COUNT iterations waiting for new messages, and then parks
+/// on the queue's condition.
+#ifndef THRD_MSG_Q_LOCK_FREE
+#define THRD_MSG_Q_LOCK_FREE 0
+#endif
+
+/// @def THRD_MSG_Q_SPIN_COUNT
+///
+/// @brief The number of times a thread waiting on its lock-free message queue
+/// checks for new messages before it parks.
+#ifndef THRD_MSG_Q_SPIN_COUNT
+#define THRD_MSG_Q_SPIN_COUNT 1024
+#endif
+
+#if defined(_WIN32)
+
+#define exchangePointer(destinationPointerP, sourcePointer) \
+  InterlockedExchangePointer(destinationPointerP, sourcePointer)
+#define compareExchangePointer( \
+    destinationPointerP, sourcePointer, comparePointer) \
+  InterlockedCompareExchangePointer( \
+    destinationPointerP, sourcePointer, comparePointer)
+#define loadPointer(sourcePointerP) (*(sourcePointerP))
+#define exchangeInt(destinationP, source) \
+  InterlockedExchange(destinationP, source)
+#define loadInt(sourceP) InterlockedOr(sourceP, 0)
+#define addFetchLong(destinationP, value) \
+  (InterlockedExchangeAdd(destinationP, value) + (value))
+#define cpuRelax() YieldProcessor()
+
+#elif defined(__GNUC__)
+
+#define exchangePointer(destinationPointerP, sourcePointer) \
+  __atomic_exchange_n(destinationPointerP, sourcePointer, __ATOMIC_SEQ_CST)
+static inline void* compareExchangePointer(
+  void * volatile *destinationPointerP,
+  void *sourcePointer, void *comparePointer
+) {
+  __atomic_compare_exchange_n(
+    destinationPointerP, &comparePointer, sourcePointer,
+    false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  
+  // comparePointer now holds the original value of *destinationPointerP.
+  return comparePointer;
+}
+#define loadPointer(sourcePointerP) \
+  __atomic_load_n(sourcePointerP, __ATOMIC_SEQ_CST)
+#define exchangeInt(destinationP, source) \
+  __atomic_exchange_n(destinationP, source, __ATOMIC_SEQ_CST)
+#define loadInt(sourceP) __atomic_load_n(sourceP, __ATOMIC_SEQ_CST)
+#define addFetchLong(destinationP, value) \
+  __atomic_add_fetch(destinationP, value, __ATOMIC_ACQ_REL)
+#if defined(__x86_64__) || defined(__i386__)
+#define cpuRelax() __builtin_ia32_pause()
+#else
+#define cpuRelax() {}
+#endif
+
+#endif
+
 /// @struct thrd_msg_q_t
 ///
 /// @brief Definition for a thread's message queue.
@@ -65,11 +135,20 @@ int thrd_msg_q_destroy(thrd_msg_q_t *queue);
 /// @param condition A condition (cnd_t) that will allow for signalling between
 ///   threads when adding a message to the queue.
 /// @param lock A mutex (mtx_t) to guard the condition.
+/// @param incoming The stack of messages pushed by other threads that the
+///   queue's thread has not moved into its list yet, most recent first.  Only
+///   used when THRD_MSG_Q_LOCK_FREE is enabled, in which case head and tail
+///   are only ever touched by the queue's thread.
+/// @param parked Whether or not the queue's thread is blocked on condition
+///   waiting for new messages.  Only used when THRD_MSG_Q_LOCK_FREE is
+///   enabled.
 typedef struct thrd_msg_q_t {
   thrd_msg_t *head;
   thrd_msg_t *tail;
   cnd_t condition;
   mtx_t lock;
+  thrd_msg_t *incoming;
+  volatile long parked;
 } thrd_msg_q_t;
 
 /// @var thrd_msg_q_storage_initialized
@@ -100,6 +179,203 @@ static inline thrd_msg_q_t* get_thread_thrd_msg_q(void) {
   return (thrd_msg_q_t*) radixTreeGetValue(message_queues, &thr, sizeof(thr));
 }
 
+/// @fn void thrd_msg_q_collect(thrd_msg_q_t *queue)
+///
+/// @brief Move the messages other threads have pushed onto a lock-free queue's
+/// incoming stack to the end of its list, in the order they were pushed.
+///
+/// @param queue A pointer to the current thread's message queue.
+///
+/// @return This function returns no value.
+static inline void thrd_msg_q_collect(thrd_msg_q_t *queue) {
+  thrd_msg_t *cur = (thrd_msg_t*) exchangePointer(
+    (void * volatile*) &queue->incoming, NULL);
+  if (cur == NULL) {
+    return;
+  }
+  
+  // The stack is in most-recent-first order.  Reverse it.
+  thrd_msg_t *first = NULL;
+  thrd_msg_t *last = cur;
+  while (cur != NULL) {
+    thrd_msg_t *next = cur->next;
+    cur->next = first;
+    first = cur;
+    cur = next;
+  }
+  
+  if (queue->tail != NULL) {
+    queue->tail->next = first;
+  } else {
+    queue->head = first;
+  }
+  queue->tail = last;
+}
+
+/// @fn int thrd_msg_q_lock_list(thrd_msg_q_t *queue, const struct timespec *ts)
+///
+/// @brief Get exclusive access to the list of the current thread's message
+/// queue.
+///
+/// @param queue A pointer to the current thread's message queue.
+/// @param ts A pointer to a struct timespec that specifies the latest time to
+///   wait for the queue's lock.  If this parameter is NULL then an infinite
+///   timeout will be used.
+///
+/// @return Returns thrd_success on success, another thrd_* value on failure.
+static inline int thrd_msg_q_lock_list(
+  thrd_msg_q_t *queue, const struct timespec *ts
+) {
+#if THRD_MSG_Q_LOCK_FREE
+  // Only the queue's thread ever touches its list.
+  (void) ts;
+  thrd_msg_q_collect(queue);
+  return thrd_success;
+#else
+  if (ts == NULL) {
+    return mtx_lock(&queue->lock);
+  }
+  return mtx_timedlock(&queue->lock, ts);
+#endif
+}
+
+/// @fn void thrd_msg_q_unlock_list(thrd_msg_q_t *queue)
+///
+/// @brief Release the access granted by thrd_msg_q_lock_list.
+///
+/// @param queue A pointer to the current thread's message queue.
+///
+/// @return This function returns no value.
+static inline void thrd_msg_q_unlock_list(thrd_msg_q_t *queue) {
+#if THRD_MSG_Q_LOCK_FREE
+  (void) queue;
+#else
+  mtx_unlock(&queue->lock);
+#endif
+}
+
+/// @fn int thrd_msg_q_block(thrd_msg_q_t *queue, const struct timespec *ts)
+///
+/// @brief Wait for another thread to push a message onto the current thread's
+/// message queue.  The caller must hold the access granted by
+/// thrd_msg_q_lock_list, which is held again when this call returns.
+///
+/// @param queue A pointer to the current thread's message queue.
+/// @param ts A pointer to a struct timespec that specifies the end of the time
+///   period to wait for.  If this parameter is NULL then an infinite timeout
+///   will be used.
+///
+/// @return Returns thrd_success if the queue may have new messages,
+/// thrd_timedout if the timeout was reached, thrd_error on failure.
+static inline int thrd_msg_q_block(
+  thrd_msg_q_t *queue, const struct timespec *ts
+) {
+#if THRD_MSG_Q_LOCK_FREE
+  int return_value = thrd_success;
+  
+  for (int ii = 0; ii < THRD_MSG_Q_SPIN_COUNT; ii++) {
+    if (loadPointer((void * volatile*) &queue->incoming) != NULL) {
+      thrd_msg_q_collect(queue);
+      return return_value; // thrd_success
+    }
+    cpuRelax();
+  }
+  
+  // Park.  Producers check parked after pushing and we check incoming after
+  // setting parked, so at least one of us will see the other.
+  if (mtx_lock(&queue->lock) != thrd_success) {
+    return thrd_error;
+  }
+  exchangeInt(&queue->parked, 1);
+  if (loadPointer((void * volatile*) &queue->incoming) == NULL) {
+    if (ts == NULL) {
+      return_value = cnd_wait(&queue->condition, &queue->lock);
+    } else {
+      return_value = cnd_timedwait(&queue->condition, &queue->lock, ts);
+    }
+  }
+  exchangeInt(&queue->parked, 0);
+  mtx_unlock(&queue->lock);
+  
+  thrd_msg_q_collect(queue);
+  return return_value;
+#else
+  if (ts == NULL) {
+    return cnd_wait(&queue->condition, &queue->lock);
+  }
+  return cnd_timedwait(&queue->condition, &queue->lock, ts);
+#endif
+}
+
+/// @fn int thrd_msg_q_append(thrd_msg_q_t *queue,
+///   thrd_msg_t *first, thrd_msg_t *last)
+///
+/// @brief Add a chain of messages to the end of another thread's message queue
+/// with a single synchronization operation and wake the thread if it's
+/// waiting.
+///
+/// @param queue A pointer to the destination message queue.
+/// @param first A pointer to the first message of the chain.
+/// @param last A pointer to the last message of the chain, whose next pointer
+///   must be NULL.
+///
+/// @return Returns thrd_success on success, thrd_error on failure.
+static inline int thrd_msg_q_append(thrd_msg_q_t *queue,
+  thrd_msg_t *first, thrd_msg_t *last
+) {
+  int return_value = thrd_success;
+  
+#if THRD_MSG_Q_LOCK_FREE
+  // The incoming stack is in most-recent-first order, so the chain has to go
+  // onto it reversed.
+  thrd_msg_t *reversed = NULL;
+  for (thrd_msg_t *cur = first; cur != NULL; ) {
+    thrd_msg_t *next = cur->next;
+    cur->next = reversed;
+    reversed = cur;
+    cur = next;
+  }
+  
+  thrd_msg_t *incoming = NULL;
+  do {
+    incoming = (thrd_msg_t*) loadPointer((void * volatile*) &queue->incoming);
+    first->next = incoming;
+  } while (compareExchangePointer((void * volatile*) &queue->incoming,
+    (void*) last, (void*) incoming) != (void*) incoming);
+  
+  if (loadInt(&queue->parked) != 0) {
+    // The queue's thread is parked or about to be.  Taking the lock makes sure
+    // it's waiting on the condition before we signal it.
+    if (mtx_lock(&queue->lock) != thrd_success) {
+      return thrd_error;
+    }
+    return_value = cnd_broadcast(&queue->condition);
+    mtx_unlock(&queue->lock);
+  }
+#else
+  if (mtx_lock(&queue->lock) != thrd_success) {
+    // Error case.
+    return thrd_error;
+  }
+  
+  if (queue->tail != NULL) {
+    queue->tail->next = first;
+    queue->tail = last;
+  } else {
+    // Empty queue.  Populate both queue->head and queue->tail.
+    queue->head = first;
+    queue->tail = last;
+  }
+  
+  // Let all the waiters know that there's something new in the queue now.
+  return_value = cnd_broadcast(&queue->condition);
+  
+  mtx_unlock(&queue->lock);
+#endif
+  
+  return return_value;
+}
+
 /// @fn void thrd_msg_q_storage_init(void)
 ///
 /// @brief call_once function that initializes the message_queues radix tree
@@ -107,7 +383,8 @@ static inline thrd_msg_q_t* get_thread_thrd_msg_q(void) {
 ///
 /// @return This function returns no value.
 void thrd_msg_q_storage_init(void) {
-  message_queues = radixTreeCreate(NULL);
+  // There's one key per running thread, so use the compact node layouts.
+  message_queues = radixTreeCreate(NULL, true);
   if (message_queues == NULL) {
     // No tree.  Can't proceed.
     LOG_MALLOC_FAILURE();
@@ -121,7 +398,9 @@ void thrd_msg_q_storage_init(void) {
 ///
 /// @brief Dynamically allocate and initialize a thrd_msg_q_t that will server as the
 /// message queue for the current thread and associate it with this thread's
-/// thrd_t value in the message_queues radix tree.
+/// thrd_t value in the message_queues radix tree.  Threads started by
+/// thrd_create_ex call this after their CPU and NUMA placement has been
+/// applied, so the queue comes from memory local to the thread that polls it.
 ///
 /// @return Returns thrd_success on success, thrd_error on failure.
 int thrd_msg_q_create(void) {
@@ -201,8 +480,13 @@ int thrd_msg_q_destroy(thrd_msg_q_t *queue) {
       // Nothing to do.
       return return_value; // thrd_success
     }
+    
+    // Other threads may have looked up the queue before it was removed and
+    // still be pushing onto it.  Wait for them to finish.
+    radixTreeSynchronize(message_queues);
   }
   
+  thrd_msg_q_collect(queue);
   for (thrd_msg_t *cur = queue->head; cur != NULL; ) {
     thrd_msg_t *next = cur->next;
     thrd_msg_destroy(cur);
@@ -226,8 +510,9 @@ thrd_msg_t* thrd_msg_q_peek(void) {
   thrd_msg_t *head = NULL;
   
   thrd_msg_q_t *queue = get_thread_thrd_msg_q();
-  if (queue != NULL) {
+  if ((queue != NULL) && (thrd_msg_q_lock_list(queue, NULL) == thrd_success)) {
     head = queue->head;
+    thrd_msg_q_unlock_list(queue);
   }
   
   return head;
@@ -242,7 +527,7 @@ thrd_msg_t* thrd_msg_q_pop(void) {
   thrd_msg_q_t *queue = get_thread_thrd_msg_q();
   thrd_msg_t *head = NULL;
   
-  if ((queue == NULL) || (mtx_lock(&queue->lock) != thrd_success)) {
+  if ((queue == NULL) || (thrd_msg_q_lock_list(queue, NULL) != thrd_success)) {
     // Error case.
     return head; // NULL
   }
@@ -258,11 +543,63 @@ thrd_msg_t* thrd_msg_q_pop(void) {
     }
   }
   
-  mtx_unlock(&queue->lock);
+  thrd_msg_q_unlock_list(queue);
   
   return head;
 }
 
+/// @fn thrd_msg_t* thrd_msg_q_pop_n(size_t n)
+///
+/// @brief Remove up to a specified number of messages from the head of the
+/// current thread's message queue with a single synchronization operation.
+///
+/// @param n The maximum number of messages to remove.
+///
+/// @return Returns the first of the removed messages, which are still linked
+/// in order by their next pointers with the last one's next pointer set to
+/// NULL.  Returns NULL if the queue is empty or on failure.
+thrd_msg_t* thrd_msg_q_pop_n(size_t n) {
+  thrd_msg_q_t *queue = get_thread_thrd_msg_q();
+  thrd_msg_t *head = NULL;
+  
+  if ((n == 0) || (queue == NULL)
+    || (thrd_msg_q_lock_list(queue, NULL) != thrd_success)
+  ) {
+    // Nothing to do or error case.
+    return head; // NULL
+  }
+  
+  head = queue->head;
+  thrd_msg_t *last = head;
+  for (size_t ii = 1; (ii < n) && (last != NULL); ii++) {
+    last = last->next;
+  }
+  if ((last == NULL) || (last->next == NULL)) {
+    // Taking everything.
+    queue->head = NULL;
+    queue->tail = NULL;
+  } else {
+    queue->head = last->next;
+    last->next = NULL;
+  }
+  
+  thrd_msg_q_unlock_list(queue);
+  
+  return head;
+}
+
+/// @fn thrd_msg_t* thrd_msg_q_pop_all(void)
+///
+/// @brief Remove every message from the current thread's message queue with a
+/// single synchronization operation.
+///
+/// @return Returns the first of the removed messages, which are still linked
+/// in order by their next pointers.  Returns NULL if the queue is empty or on
+/// failure.
+thrd_msg_t* thrd_msg_q_pop_all(void) {
+  return thrd_msg_q_pop_n(SIZE_MAX);
+}
+
 /// @fn thrd_msg_t* thrd_msg_q_pop_type(int type)
 ///
 /// @brief Get the first message of the specified type from the current
@@ -275,14 +612,14 @@ thrd_msg_t* thrd_msg_q_pop(void) {
 thrd_msg_t* thrd_msg_q_pop_type(int type) {
   thrd_msg_q_t *queue = get_thread_thrd_msg_q();
   thrd_msg_t *return_value = NULL;
-  thrd_msg_t *cur = queue->head;
-  thrd_msg_t **prev = &queue->head;
   
-  if (mtx_lock(&queue->lock) != thrd_success) {
+  if ((queue == NULL) || (thrd_msg_q_lock_list(queue, NULL) != thrd_success)) {
     // Error case.
     return return_value; // NULL
   }
   
+  thrd_msg_t *cur = queue->head;
+  thrd_msg_t **prev = &queue->head;
   while ((cur != NULL) && (cur->type != type)) {
     prev = &cur->next;
     cur = cur->next;
@@ -303,7 +640,7 @@ thrd_msg_t* thrd_msg_q_pop_type(int type) {
     cur->next = NULL;
   }
   
-  mtx_unlock(&queue->lock);
+  thrd_msg_q_unlock_list(queue);
   
   return return_value;
 }
@@ -327,8 +664,6 @@ thrd_msg_t* thrd_msg_q_pop_type(int type) {
 thrd_msg_t* thrd_msg_q_wait_for_type_(int *type, const struct timespec *ts) {
   thrd_msg_q_t *queue = get_thread_thrd_msg_q();
   thrd_msg_t *return_value = NULL;
-  thrd_msg_t *cur = queue->head;
-  thrd_msg_t **prev = &queue->head;
   int lock_status = thrd_success;
   int wait_status = thrd_success;
   int search_type = 0;
@@ -338,11 +673,11 @@ thrd_msg_t* thrd_msg_q_wait_for_type_(int *type, const struct timespec *ts) {
     search_type = *type;
   }
   
-  if (ts == NULL) {
-    lock_status = mtx_lock(&queue->lock);
-  } else {
-    lock_status = mtx_timedlock(&queue->lock, ts);
+  if (queue == NULL) {
+    // Error case.
+    return return_value; // NULL
   }
+  lock_status = thrd_msg_q_lock_list(queue, ts);
   if (lock_status != thrd_success) {
     // Error case.
     return return_value; // NULL
@@ -350,6 +685,8 @@ thrd_msg_t* thrd_msg_q_wait_for_type_(int *type, const struct timespec *ts) {
   // mtx_timedlock will return thrd_timedout if the timeout is reached, so we'll
   // never reach this point if we've exceeded our timeout.
   
+  thrd_msg_t *cur = queue->head;
+  thrd_msg_t **prev = &queue->head;
   while (return_value == NULL) {
     while ((cur != NULL) && (type != NULL) && (cur->type != search_type)) {
       prev = &cur->next;
@@ -371,11 +708,7 @@ thrd_msg_t* thrd_msg_q_wait_for_type_(int *type, const struct timespec *ts) {
       cur->next = NULL;
     } else {
       // Desired type was not found.  Block until something else is pushed.
-      if (ts == NULL) {
-        wait_status = cnd_wait(&queue->condition, &queue->lock);
-      } else {
-        wait_status = cnd_timedwait(&queue->condition, &queue->lock, ts);
-      }
+      wait_status = thrd_msg_q_block(queue, ts);
       if (wait_status != thrd_success) {
         break;
       }
@@ -387,7 +720,7 @@ thrd_msg_t* thrd_msg_q_wait_for_type_(int *type, const struct timespec *ts) {
     prev = &queue->head;
   }
   
-  mtx_unlock(&queue->lock);
+  thrd_msg_q_unlock_list(queue);
   
   return return_value;
 }
@@ -446,34 +779,64 @@ int thrd_msg_q_push(thrd_t thr, thrd_msg_t *msg) {
     return return_value; // thrd_error
   }
   
+  // Keep the destination thread from freeing its queue until we're done.
+  int64_t token = radixTreeReadBegin(message_queues);
   thrd_msg_q_t *queue
     = (thrd_msg_q_t*) radixTreeGetValue(message_queues, &thr, sizeof(thr));
   if (queue == NULL) {
     // Destination thread has exited.  Fail.
-    return return_value; // thrd_error
-  }
-  
-  if (mtx_lock(&queue->lock) != thrd_success) {
-    // Error case.
+    radixTreeReadEnd(message_queues, token);
     return return_value; // thrd_error
   }
   
   msg->from = thrd_current();
   msg->to = thr;
   msg->next = NULL;
-  if (queue->tail != NULL) {
-    queue->tail->next = msg;
-    queue->tail = msg;
-  } else {
-    // Empty queue.  Populate both queue->head and queue->tail.
-    queue->head = msg;
-    queue->tail = msg;
+  return_value = thrd_msg_q_append(queue, msg, msg);
+  radixTreeReadEnd(message_queues, token);
+  
+  return return_value;
+}
+
+/// @fn int thrd_msg_q_push_batch(thrd_t thr, thrd_msg_t *msgs)
+///
+/// @brief Push a chain of messages onto the message queue of a specified
+/// thread.  The whole chain is added with a single synchronization operation
+/// and the destination thread is woken at most once.
+///
+/// @param thr The thrd_t that identifies the destination thread.
+/// @param msgs A pointer to the first thrd_msg_t of a chain of messages linked
+///   by their next pointers and terminated by a NULL next pointer.  The
+///   messages keep their order in the destination queue.
+///
+/// @return Returns thrd_success on success, thrd_error on failure.
+int thrd_msg_q_push_batch(thrd_t thr, thrd_msg_t *msgs) {
+  int return_value = thrd_error;
+  
+  if (msgs == NULL) {
+    // Invalid.
+    return return_value; // thrd_error
   }
   
-  // Let all the waiters know that there's something new in the queue now.
-  return_value = cnd_broadcast(&queue->condition);
+  // Keep the destination thread from freeing its queue until we're done.
+  int64_t token = radixTreeReadBegin(message_queues);
+  thrd_msg_q_t *queue
+    = (thrd_msg_q_t*) radixTreeGetValue(message_queues, &thr, sizeof(thr));
+  if (queue == NULL) {
+    // Destination thread has exited.  Fail.
+    radixTreeReadEnd(message_queues, token);
+    return return_value; // thrd_error
+  }
   
-  mtx_unlock(&queue->lock);
+  thrd_t from = thrd_current();
+  thrd_msg_t *last = msgs;
+  for (thrd_msg_t *cur = msgs; cur != NULL; cur = cur->next) {
+    cur->from = from;
+    cur->to = thr;
+    last = cur;
+  }
+  return_value = thrd_msg_q_append(queue, msgs, last);
+  radixTreeReadEnd(message_queues, token);
   
   return return_value;
 }
@@ -501,6 +864,7 @@ static inline int thrd_msg_start_use(thrd_msg_t *msg) {
       msg->done = true;
       msg->in_use = true;
       msg->from = 0;
+      msg->buf = NULL;
       if (msg->configured == false) {
         memset(&msg->condition, 0, sizeof(msg->condition));
         memset(&msg->lock, 0, sizeof(msg->condition));
@@ -567,6 +931,7 @@ thrd_msg_t* thrd_msg_destroy(thrd_msg_t *msg) {
   // Don't touch msg->size.
   // Don't touch msg->next.
   // Don't touch msg->waiting.
+  msg->buf = thrd_msg_buf_release(msg->buf);
   msg->in_use = false;
   // Don't touch from.
   if (msg->configured == true) {
@@ -642,11 +1007,144 @@ int thrd_msg_init(
   msg->done = false;
   // No need to set msg->in_use since we called thrd_msg_start_use above.
   // Don't touch msg->from in case this message is being reused.
+  // A message that's being reused while still in use may still hold a buffer.
+  msg->buf = thrd_msg_buf_release(msg->buf);
   return_value = thrd_success;
   
   return return_value;
 }
 
+/// @fn int thrd_msg_init_buf(
+///   thrd_msg_t *msg, int type, thrd_msg_buf_t *buf, bool waiting)
+///
+/// @brief Initialize a message whose payload is a shared buffer.  The message
+/// takes its own reference to the buffer and drops it when the message is
+/// released or destroyed, so the caller can release its reference as soon as
+/// the message has been pushed.
+///
+/// @param msg A pointer to an allocated thrd_msg_t.  Will be properly
+///   configured if not already so.
+/// @param type The message type to use for the message.
+/// @param buf The thrd_msg_buf_t to attach to the message.  The message's data
+///   and size are set to the buffer's.
+/// @param waiting Whether or not the caller of this function will be waiting on
+///   a response to this message from the destination thread.
+///
+/// @return Returns thrd_success on success, thrd_error on failure.
+int thrd_msg_init_buf(
+  thrd_msg_t *msg, int type, thrd_msg_buf_t *buf, bool waiting
+) {
+  if (buf == NULL) {
+    return thrd_error;
+  }
+  
+  int return_value
+    = thrd_msg_init(msg, type, (void*) buf->data, buf->size, waiting);
+  if (return_value == thrd_success) {
+    msg->buf = thrd_msg_buf_retain(buf);
+  }
+  
+  return return_value;
+}
+
+/// @fn thrd_msg_buf_t* thrd_msg_buf_create(const void *data, size_t size)
+///
+/// @brief Create a shared buffer holding a copy of a payload.  The payload is
+/// stored in the same allocation as the buffer.
+///
+/// @param data A pointer to the payload to copy.  May be NULL only if size is
+///   0.
+/// @param size The number of bytes pointed to by data.
+///
+/// @return Returns a new thrd_msg_buf_t with one reference, owned by the
+/// caller, on success, NULL on failure.
+thrd_msg_buf_t* thrd_msg_buf_create(const void *data, size_t size) {
+  if ((data == NULL) && (size > 0)) {
+    return NULL;
+  }
+  
+  thrd_msg_buf_t *buf = (thrd_msg_buf_t*) malloc(sizeof(thrd_msg_buf_t) + size);
+  if (buf == NULL) {
+    LOG_MALLOC_FAILURE();
+    return buf; // NULL
+  }
+  
+  void *inline_data = &buf[1];
+  if (size > 0) {
+    memcpy(inline_data, data, size);
+  }
+  buf->data = inline_data;
+  buf->size = size;
+  buf->references = 1;
+  buf->free_data = NULL;
+  
+  return buf;
+}
+
+/// @fn thrd_msg_buf_t* thrd_msg_buf_wrap(
+///   void *data, size_t size, void (*free_data)(void *data))
+///
+/// @brief Create a shared buffer that takes ownership of an existing payload
+/// without copying it.
+///
+/// @param data A pointer to the payload.
+/// @param size The number of bytes pointed to by data.
+/// @param free_data The function to free data with when the last reference to
+///   the buffer is released.  May be NULL if data doesn't need to be freed.
+///
+/// @return Returns a new thrd_msg_buf_t with one reference, owned by the
+/// caller, on success, NULL on failure.  On failure, data is not freed.
+thrd_msg_buf_t* thrd_msg_buf_wrap(
+  void *data, size_t size, void (*free_data)(void *data)
+) {
+  thrd_msg_buf_t *buf = (thrd_msg_buf_t*) malloc(sizeof(thrd_msg_buf_t));
+  if (buf == NULL) {
+    LOG_MALLOC_FAILURE();
+    return buf; // NULL
+  }
+  
+  buf->data = data;
+  buf->size = size;
+  buf->references = 1;
+  buf->free_data = free_data;
+  
+  return buf;
+}
+
+/// @fn thrd_msg_buf_t* thrd_msg_buf_retain(thrd_msg_buf_t *buf)
+///
+/// @brief Take another reference to a shared buffer.
+///
+/// @param buf A pointer to the thrd_msg_buf_t to reference.
+///
+/// @return Returns buf.
+thrd_msg_buf_t* thrd_msg_buf_retain(thrd_msg_buf_t *buf) {
+  if (buf != NULL) {
+    addFetchLong(&buf->references, 1);
+  }
+  
+  return buf;
+}
+
+/// @fn thrd_msg_buf_t* thrd_msg_buf_release(thrd_msg_buf_t *buf)
+///
+/// @brief Drop a reference to a shared buffer, freeing it and its payload if
+/// it was the last one.
+///
+/// @param buf A pointer to the thrd_msg_buf_t to release.
+///
+/// @return Always returns NULL.
+thrd_msg_buf_t* thrd_msg_buf_release(thrd_msg_buf_t *buf) {
+  if ((buf != NULL) && (addFetchLong(&buf->references, -1) == 0)) {
+    if (buf->free_data != NULL) {
+      buf->free_data((void*) buf->data);
+    }
+    free(buf);
+  }
+  
+  return NULL;
+}
+
 /// @fn int thrd_msg_release(thrd_msg_t *msg)
 ///
 /// @brief Release a message from use.
@@ -667,6 +1165,9 @@ int thrd_msg_release(thrd_msg_t *msg) {
   // Don't touch msg->size.
   // Don't touch msg->next.
   // Don't touch msg->waiting.
+  // Drop the message's reference to its shared buffer.  msg->data is left
+  // alone, but it's only valid for as long as someone else holds the buffer.
+  msg->buf = thrd_msg_buf_release(msg->buf);
   msg->in_use = false;
   // Don't touch msg->from.
   if (msg->configured == true) {
@@ -865,12 +1366,7 @@ thrd_msg_t* thrd_msg_wait_for_reply_with_type_(
   }
 
   // Recipient has processed the message.  We now need to wait for their reply.
-  int lockStatus = thrd_success;
-  if (ts == NULL) {
-    lockStatus = mtx_lock(&queue->lock);
-  } else {
-    lockStatus = mtx_timedlock(&queue->lock, ts);
-  }
+  int lockStatus = thrd_msg_q_lock_list(queue, ts);
   if (lockStatus != thrd_success) {
     // Either we've timed out or there's a problem with the lock.  Either way,
     // we're done.  Bail.
@@ -915,12 +1411,7 @@ thrd_msg_t* thrd_msg_wait_for_reply_with_type_(
       cur->next = NULL;
     } else {
       // Desired reply was not found.  Block until something else is pushed.
-      if (ts == NULL) {
-        waitStatus = cnd_wait(&queue->condition, &queue->lock);
-      } else {
-        waitStatus = cnd_timedwait(
-          &queue->condition, &queue->lock, ts);
-      }
+      waitStatus = thrd_msg_q_block(queue, ts);
       if (waitStatus != thrd_success) {
         // Something isn't as expected.  Bail.
         break;
@@ -933,7 +1424,7 @@ thrd_msg_t* thrd_msg_wait_for_reply_with_type_(
     prev = &queue->head;
   }
 
-  mtx_unlock(&queue->lock);
+  thrd_msg_q_unlock_list(queue);
 
   return reply;
 }
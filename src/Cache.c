@@ -0,0 +1,750 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              Cache.c
+///
+/// @brief             This library contains the implementation of a bounded,
+///                    thread-safe cache with least-recently-used and
+///                    time-to-live eviction.
+///
+/// @details           Expired entries are removed lazily:  A get that finds
+///                    one removes it and reports a miss, and a put removes
+///                    any at the least recently used end of its shard.
+///                    cachePurgeExpired removes the rest on demand.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+// Doxygen marker
+/// @file
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Cache.h"
+#include "HashTable.h"
+#include "LoggingLib.h"
+#include "StringLib.h"
+#include "TimeUtils.h"
+#include "LockStats.h"
+
+/// @fn static inline CacheShard* cacheGetShard(Cache *cache,
+///   const volatile void *key)
+///
+/// @brief Get the shard a key belongs to.
+///
+/// @details The hash is scrambled with the MurmurHash3 finalizer before its
+/// low-order bits are used so that key types with a weak hashFunction still
+/// spread across the shards.
+///
+/// @param cache The cache of interest.
+/// @param key The key of interest.
+///
+/// @return Returns a pointer to the key's shard.
+static inline CacheShard* cacheGetShard(Cache *cache,
+  const volatile void *key
+) {
+  u64 hash = htHashValue(cache->keyType, key, cache->seed);
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+
+  return &cache->shards[hash & (cache->numShards - 1)];
+}
+
+/// @fn static inline i64 cacheNow(const Cache *cache)
+///
+/// @brief Get the current time for expiration checks.
+///
+/// @param cache The cache of interest.
+///
+/// @return Returns the monotonic time in nanoseconds, or 0 if the cache's
+/// entries never expire, in which case the clock isn't read.
+static inline i64 cacheNow(const Cache *cache) {
+  return (cache->ttlNanoseconds > 0) ? getMonotonicNanoseconds() : 0;
+}
+
+/// @fn static inline bool cacheExpired(const Cache *cache,
+///   const HashNode *node, i64 now)
+///
+/// @brief Determine whether or not an entry has expired.
+///
+/// @param cache The cache the entry is in.
+/// @param node The HashNode of the entry.
+/// @param now The time returned by cacheNow.
+///
+/// @return Returns true if the entry has expired, false if not.
+static inline bool cacheExpired(const Cache *cache, const HashNode *node,
+  i64 now
+) {
+  return (cache->ttlNanoseconds > 0) && (node->byteOffset <= now);
+}
+
+/// @fn static inline void cacheTouch(HashTable *table, HashNode *node)
+///
+/// @brief Mark an entry as the most recently used in its shard by moving its
+/// node to the tail of the table's list.
+///
+/// @param table The shard's HashTable.
+/// @param node The HashNode of the entry.
+///
+/// @return This function returns no value.
+static inline void cacheTouch(HashTable *table, HashNode *node) {
+  if (node == table->tail) {
+    return;
+  }
+
+  // node is not the tail, so node->next is not NULL.
+  if (node->prev != NULL) {
+    node->prev->next = node->next;
+  } else {
+    table->head = node->next;
+  }
+  node->next->prev = node->prev;
+
+  node->prev = table->tail;
+  node->next = NULL;
+  table->tail->next = node;
+  table->tail = node;
+}
+
+/// @fn Cache* cacheCreate_(TypeDescriptor *keyType, u64 capacity,
+///   u64 ttlMilliseconds, u64 numShards, ...)
+///
+/// @brief Create a new Cache.
+///
+/// @param keyType The TypeDescriptor representing the kind of key to use.
+/// @param capacity The most entries the cache may hold.  Must be greater
+///   than 0.
+/// @param ttlMilliseconds How long an entry lives after it is put, or 0 if
+///   entries should never expire.
+/// @param numShards The number of independently-locked shards to split the
+///   cache into.  This is rounded up to a power of two and limited to the
+///   capacity.  0 selects CACHE_DEFAULT_NUM_SHARDS.
+/// @param ... Ignored parameters.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides 0 for ttlMilliseconds
+/// and numShards.
+///
+/// @return Returns a pointer to a new Cache on success, NULL on failure.
+Cache* cacheCreate_(TypeDescriptor *keyType, u64 capacity,
+  u64 ttlMilliseconds, u64 numShards, ...
+) {
+  printLog(TRACE,
+    "ENTER cacheCreate(keyType=%s, capacity=%llu, ttlMilliseconds=%llu)\n",
+    (keyType != NULL) ? keyType->name : "NULL", llu(capacity),
+    llu(ttlMilliseconds));
+
+  if ((keyType == NULL) || (capacity == 0)) {
+    printLog(ERR, "Invalid parameters.  keyType=%p, capacity=%llu\n",
+      keyType, llu(capacity));
+    printLog(TRACE, "EXIT cacheCreate(keyType=%s) = {NULL}\n",
+      (keyType != NULL) ? keyType->name : "NULL");
+    return NULL;
+  }
+
+  if (numShards == 0) {
+    numShards = CACHE_DEFAULT_NUM_SHARDS;
+  }
+  u64 shardCount = 1;
+  while ((shardCount < numShards) && ((shardCount << 1) <= capacity)) {
+    shardCount <<= 1;
+  }
+
+  Cache *cache = (Cache*) allocatorCalloc(ALLOCATOR_OTHER, NULL,
+    1, sizeof(Cache));
+  if (cache == NULL) {
+    LOG_MALLOC_FAILURE();
+    printLog(TRACE, "EXIT cacheCreate(keyType=%s) = {NULL}\n", keyType->name);
+    return NULL;
+  }
+  cache->shards = (CacheShard*) allocatorCalloc(ALLOCATOR_OTHER, NULL,
+    shardCount, sizeof(CacheShard));
+  if (cache->shards == NULL) {
+    LOG_MALLOC_FAILURE();
+    cache = (Cache*) allocatorFree(ALLOCATOR_OTHER, NULL, cache);
+    printLog(TRACE, "EXIT cacheCreate(keyType=%s) = {NULL}\n", keyType->name);
+    return NULL;
+  }
+  cache->keyType = keyType;
+  cache->capacity = capacity;
+  cache->ttlNanoseconds = ((i64) ttlMilliseconds) * ((i64) 1000000);
+  cache->numShards = shardCount;
+  cache->seed = hashCreateSeed();
+
+  // Spread the capacity over the shards so that the total is exact.
+  for (u64 ii = 0; ii < shardCount; ii++) {
+    CacheShard *shard = &cache->shards[ii];
+    shard->capacity = (capacity / shardCount)
+      + ((ii < (capacity % shardCount)) ? 1 : 0);
+    if (mtx_init(&shard->lock, mtx_plain) != thrd_success) {
+      printLog(ERR, "Could not initialize shard mutex lock.\n");
+    }
+    // The shard's lock guards its table, so the table doesn't need its own.
+    shard->table = htCreate(keyType, true);
+    if (shard->table == NULL) {
+      printLog(ERR, "Could not create table for shard %llu.\n", llu(ii));
+      cache->numShards = ii + 1;
+      cache = cacheDestroy(cache);
+      printLog(TRACE, "EXIT cacheCreate(keyType=%s) = {NULL}\n",
+        keyType->name);
+      return NULL;
+    }
+  }
+
+  printLog(TRACE, "EXIT cacheCreate(keyType=%s) = {%p}\n",
+    keyType->name, cache);
+  return cache;
+}
+
+/// @fn Cache* cacheDestroy(Cache *cache)
+///
+/// @brief Destroy a Cache and all of its keys and values.
+///
+/// @param cache The cache to destroy.
+///
+/// @return This function always returns NULL.
+Cache* cacheDestroy(Cache *cache) {
+  printLog(TRACE, "ENTER cacheDestroy(cache=%p)\n", cache);
+
+  if (cache != NULL) {
+    for (u64 ii = 0; ii < cache->numShards; ii++) {
+      CacheShard *shard = &cache->shards[ii];
+      shard->table = htDestroy(shard->table);
+      mtx_destroy(&shard->lock);
+    }
+    cache->shards = (CacheShard*)
+      allocatorFree(ALLOCATOR_OTHER, NULL, cache->shards);
+    cache = (Cache*) allocatorFree(ALLOCATOR_OTHER, NULL, cache);
+  }
+
+  printLog(TRACE, "EXIT cacheDestroy(cache=%p) = {NULL}\n", cache);
+  return NULL;
+}
+
+/// @fn i32 cachePut_(Cache *cache, const volatile void *key,
+///   const volatile void *value, TypeDescriptor *type, ...)
+///
+/// @brief Add a value to a cache or replace the value already there for the
+/// same key.
+///
+/// @details The entry becomes the most recently used in its shard and, if
+/// the cache has a time-to-live, its expiration starts over.  If the shard is
+/// then over its capacity, its least recently used entries are evicted.
+///
+/// @param cache The cache to add to.
+/// @param key The key of the entry.  The cache stores a copy.
+/// @param value The value of the entry.  The cache stores a copy.
+/// @param type The TypeDescriptor of the value.  If this is NULL, the type
+///   of the last value added to the key's shard is used or, if there isn't
+///   one, the type of the key.
+/// @param ... Ignored parameters.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides NULL for the type.
+///
+/// @return Returns 0 on success, -1 on failure.
+i32 cachePut_(Cache *cache, const volatile void *key,
+  const volatile void *value, TypeDescriptor *type, ...
+) {
+  printLog(TRACE, "ENTER cachePut(cache=%p, key=%p, value=%p, type=%s)\n",
+    cache, key, value, (type != NULL) ? type->name : "NULL");
+
+  if ((cache == NULL) || (key == NULL)) {
+    printLog(ERR, "NULL cache or key provided.\n");
+    printLog(TRACE, "EXIT cachePut(cache=%p, key=%p, value=%p) = {-1}\n",
+      cache, key, value);
+    return -1;
+  }
+
+  CacheShard *shard = cacheGetShard(cache, key);
+  HashTable *table = shard->table;
+  i64 now = cacheNow(cache);
+  i32 returnValue = 0;
+
+  if (mtx_lock(&shard->lock) != thrd_success) {
+    printLog(WARN, "Could not lock shard mutex.\n");
+  }
+
+  if (type == NULL) {
+    type = (table->lastAddedType != NULL)
+      ? table->lastAddedType : table->keyType;
+  }
+
+  HashNode *node = htGetEntry(table, key);
+  if (node != NULL) {
+    void *newValue = type->copy(value);
+    if ((newValue == NULL) && (value != NULL)) {
+      LOG_MALLOC_FAILURE();
+      returnValue = -1;
+    } else {
+      node->type->destroy(node->value);
+      node->value = newValue;
+      node->type = type;
+      table->lastAddedType = type;
+      cacheTouch(table, node);
+    }
+  } else {
+    node = htAddEntry(table, key, value, type);
+    if (node == NULL) {
+      returnValue = -1;
+    }
+  }
+
+  if (returnValue == 0) {
+    node->byteOffset = now + cache->ttlNanoseconds;
+
+    // Entries that expired are the cheapest to give up, so drop any at the
+    // head before evicting live ones.
+    while ((table->head != node) && (cacheExpired(cache, table->head, now))) {
+      htDestroyNode(table, table->head);
+      shard->expirations++;
+    }
+    while (table->size > shard->capacity) {
+      htDestroyNode(table, table->head);
+      shard->evictions++;
+    }
+  }
+
+  mtx_unlock(&shard->lock);
+
+  printLog(TRACE,
+    "EXIT cachePut(cache=%p, key=%p, value=%p, type=%s) = {%d}\n",
+    cache, key, value, type->name, returnValue);
+  return returnValue;
+}
+
+/// @fn void* cacheGet(Cache *cache, const volatile void *key,
+///   TypeDescriptor **type)
+///
+/// @brief Get a copy of the value stored in a cache for a key.
+///
+/// @details A live entry becomes the most recently used in its shard.  Its
+/// expiration is not extended.  An expired entry is removed.
+///
+/// @param cache The cache of interest.
+/// @param key The key of the entry to get.
+/// @param type A pointer to a TypeDescriptor pointer to set to the type of
+///   the value.  May be NULL if the caller already knows the type.
+///
+/// @return Returns a copy of the value on success, NULL if there is no live
+/// entry for the key.  The caller must free the copy with the type's destroy
+/// function.  The copy is made while the shard is locked, so it stays valid
+/// no matter what other threads do to the cache.
+void* cacheGet(Cache *cache, const volatile void *key,
+  TypeDescriptor **type
+) {
+  printLog(TRACE, "ENTER cacheGet(cache=%p, key=%p)\n", cache, key);
+
+  if ((cache == NULL) || (key == NULL)) {
+    printLog(ERR, "NULL cache or key provided.\n");
+    printLog(TRACE, "EXIT cacheGet(cache=%p, key=%p) = {NULL}\n", cache, key);
+    return NULL;
+  }
+
+  CacheShard *shard = cacheGetShard(cache, key);
+  HashTable *table = shard->table;
+  i64 now = cacheNow(cache);
+  void *value = NULL;
+
+  if (mtx_lock(&shard->lock) != thrd_success) {
+    printLog(WARN, "Could not lock shard mutex.\n");
+  }
+
+  HashNode *node = htGetEntry(table, key);
+  if ((node != NULL) && (cacheExpired(cache, node, now))) {
+    htDestroyNode(table, node);
+    shard->expirations++;
+    node = NULL;
+  }
+  if (node != NULL) {
+    value = node->type->copy(node->value);
+    if (type != NULL) {
+      *type = node->type;
+    }
+    cacheTouch(table, node);
+    shard->hits++;
+  } else {
+    shard->misses++;
+  }
+
+  mtx_unlock(&shard->lock);
+
+  printLog(TRACE, "EXIT cacheGet(cache=%p, key=%p) = {%p}\n",
+    cache, key, value);
+  return value;
+}
+
+/// @fn bool cacheContains(Cache *cache, const volatile void *key)
+///
+/// @brief Determine whether or not a cache has a live entry for a key.
+///
+/// @details Unlike cacheGet, this does not copy the value, does not change
+/// the entry's recency and does not count a hit or a miss.
+///
+/// @param cache The cache of interest.
+/// @param key The key of interest.
+///
+/// @return Returns true if there is a live entry for the key, false if not.
+bool cacheContains(Cache *cache, const volatile void *key) {
+  printLog(TRACE, "ENTER cacheContains(cache=%p, key=%p)\n", cache, key);
+
+  bool returnValue = false;
+  if ((cache != NULL) && (key != NULL)) {
+    CacheShard *shard = cacheGetShard(cache, key);
+    i64 now = cacheNow(cache);
+
+    if (mtx_lock(&shard->lock) != thrd_success) {
+      printLog(WARN, "Could not lock shard mutex.\n");
+    }
+    HashNode *node = htGetEntry(shard->table, key);
+    returnValue = (node != NULL) && (!cacheExpired(cache, node, now));
+    mtx_unlock(&shard->lock);
+  }
+
+  printLog(TRACE, "EXIT cacheContains(cache=%p, key=%p) = {%s}\n",
+    cache, key, (returnValue == true) ? "true" : "false");
+  return returnValue;
+}
+
+/// @fn i32 cacheRemove(Cache *cache, const volatile void *key)
+///
+/// @brief Remove the entry for a key from a cache.
+///
+/// @param cache The cache to remove from.
+/// @param key The key of the entry to remove.
+///
+/// @return Returns 0 on success, -1 if there was no entry for the key or on
+/// failure.
+i32 cacheRemove(Cache *cache, const volatile void *key) {
+  printLog(TRACE, "ENTER cacheRemove(cache=%p, key=%p)\n", cache, key);
+
+  if ((cache == NULL) || (key == NULL)) {
+    printLog(ERR, "NULL cache or key provided.\n");
+    printLog(TRACE, "EXIT cacheRemove(cache=%p, key=%p) = {-1}\n", cache, key);
+    return -1;
+  }
+
+  CacheShard *shard = cacheGetShard(cache, key);
+  i32 returnValue = -1;
+
+  if (mtx_lock(&shard->lock) != thrd_success) {
+    printLog(WARN, "Could not lock shard mutex.\n");
+  }
+  HashNode *node = htGetEntry(shard->table, key);
+  if (node != NULL) {
+    returnValue = htDestroyNode(shard->table, node);
+  }
+  mtx_unlock(&shard->lock);
+
+  printLog(TRACE, "EXIT cacheRemove(cache=%p, key=%p) = {%d}\n",
+    cache, key, returnValue);
+  return returnValue;
+}
+
+/// @fn u64 cacheSize(Cache *cache)
+///
+/// @brief Get the number of entries in a cache.
+///
+/// @param cache The cache of interest.
+///
+/// @return Returns the number of entries, including any that have expired
+/// but haven't been removed yet.  Returns 0 if cache is NULL.
+u64 cacheSize(Cache *cache) {
+  u64 size = 0;
+  if (cache != NULL) {
+    for (u64 ii = 0; ii < cache->numShards; ii++) {
+      CacheShard *shard = &cache->shards[ii];
+      if (mtx_lock(&shard->lock) != thrd_success) {
+        printLog(WARN, "Could not lock shard mutex.\n");
+      }
+      size += shard->table->size;
+      mtx_unlock(&shard->lock);
+    }
+  }
+
+  return size;
+}
+
+/// @fn i32 cacheClear(Cache *cache)
+///
+/// @brief Remove all the entries from a cache.  The counters are left alone.
+///
+/// @param cache The cache to clear.
+///
+/// @return Returns 0 on success, -1 on failure.
+i32 cacheClear(Cache *cache) {
+  printLog(TRACE, "ENTER cacheClear(cache=%p)\n", cache);
+
+  i32 returnValue = 0;
+  if (cache == NULL) {
+    printLog(ERR, "NULL cache provided.\n");
+    returnValue = -1;
+  } else {
+    for (u64 ii = 0; ii < cache->numShards; ii++) {
+      CacheShard *shard = &cache->shards[ii];
+      if (mtx_lock(&shard->lock) != thrd_success) {
+        printLog(WARN, "Could not lock shard mutex.\n");
+      }
+      if (htClear(shard->table) != 0) {
+        returnValue = -1;
+      }
+      mtx_unlock(&shard->lock);
+    }
+  }
+
+  printLog(TRACE, "EXIT cacheClear(cache=%p) = {%d}\n", cache, returnValue);
+  return returnValue;
+}
+
+/// @fn u64 cachePurgeExpired(Cache *cache)
+///
+/// @brief Remove every expired entry from a cache.
+///
+/// @details Gets don't extend expirations, so the entries of a shard aren't
+/// in expiration order and every entry has to be checked.  Each shard is
+/// locked only while it is being checked.
+///
+/// @param cache The cache to purge.
+///
+/// @return Returns the number of entries removed.
+u64 cachePurgeExpired(Cache *cache) {
+  printLog(TRACE, "ENTER cachePurgeExpired(cache=%p)\n", cache);
+
+  u64 numRemoved = 0;
+  if ((cache != NULL) && (cache->ttlNanoseconds > 0)) {
+    i64 now = cacheNow(cache);
+    for (u64 ii = 0; ii < cache->numShards; ii++) {
+      CacheShard *shard = &cache->shards[ii];
+      if (mtx_lock(&shard->lock) != thrd_success) {
+        printLog(WARN, "Could not lock shard mutex.\n");
+      }
+      HashNode *next = NULL;
+      for (HashNode *node = shard->table->head; node != NULL; node = next) {
+        next = node->next;
+        if (cacheExpired(cache, node, now)) {
+          htDestroyNode(shard->table, node);
+          shard->expirations++;
+          numRemoved++;
+        }
+      }
+      mtx_unlock(&shard->lock);
+    }
+  }
+
+  printLog(TRACE, "EXIT cachePurgeExpired(cache=%p) = {%llu}\n",
+    cache, llu(numRemoved));
+  return numRemoved;
+}
+
+/// @fn int cacheStats(Cache *cache, CacheStats *stats)
+///
+/// @brief Get the counters of a cache, summed over its shards.
+///
+/// @param cache The cache of interest.
+/// @param stats The CacheStats to fill in.
+///
+/// @return Returns 0 on success, -1 on failure.
+int cacheStats(Cache *cache, CacheStats *stats) {
+  if ((cache == NULL) || (stats == NULL)) {
+    printLog(ERR, "NULL cache or stats provided.\n");
+    return -1;
+  }
+
+  memset(stats, 0, sizeof(*stats));
+  stats->capacity = cache->capacity;
+  stats->numShards = cache->numShards;
+  for (u64 ii = 0; ii < cache->numShards; ii++) {
+    CacheShard *shard = &cache->shards[ii];
+    if (mtx_lock(&shard->lock) != thrd_success) {
+      printLog(WARN, "Could not lock shard mutex.\n");
+    }
+    stats->size += shard->table->size;
+    stats->hits += shard->hits;
+    stats->misses += shard->misses;
+    stats->evictions += shard->evictions;
+    stats->expirations += shard->expirations;
+    mtx_unlock(&shard->lock);
+  }
+
+  return 0;
+}
+
+/// @def CACHE_UNIT_TEST
+///
+/// @brief Unit tests for cache functionality.
+/// @details Implementing this as a macro instead of raw code allows this to
+/// be skipped by the code coverage metrics.
+///
+/// @return Returns true on success, false on failure.
+#define CACHE_UNIT_TEST \
+bool cacheUnitTest() { \
+  Cache *cache = NULL; \
+  CacheStats stats; \
+  TypeDescriptor *type = NULL; \
+  char *stringValue = NULL; \
+  char key[16]; \
+ \
+  printLog(INFO, "Testing Cache data structure.\n"); \
+ \
+  if ((cacheCreate(NULL, 4) != NULL) || (cacheCreate(typeString, 0) != NULL)) { \
+    printLog(ERR, "cacheCreate succeeded with invalid parameters.\n"); \
+    return false; \
+  } \
+  if ((cachePut(NULL, "key", "value") == 0) \
+    || (cacheGet(NULL, "key", NULL) != NULL) \
+    || (cacheRemove(NULL, "key") == 0) \
+    || (cacheStats(NULL, &stats) == 0) \
+  ) { \
+    printLog(ERR, "Cache function succeeded with NULL cache.\n"); \
+    return false; \
+  } \
+ \
+  /* One shard, so that recency is exact. */ \
+  cache = cacheCreate(typeString, 4, 0, 1); \
+  if ((cache == NULL) || (cache->numShards != 1)) { \
+    printLog(ERR, "Could not create single-shard cache.\n"); \
+    return false; \
+  } \
+  if ((cachePut(cache, "a", "1", typeString) != 0) \
+    || (cachePut(cache, "b", "2") != 0) \
+    || (cachePut(cache, "c", "3") != 0) \
+    || (cachePut(cache, "d", "4") != 0) \
+  ) { \
+    printLog(ERR, "cachePut failed.\n"); \
+    return false; \
+  } \
+  stringValue = (char*) cacheGet(cache, "a", &type); \
+  if ((stringValue == NULL) || (strcmp(stringValue, "1") != 0) \
+    || (type != typeString) \
+  ) { \
+    printLog(ERR, "cacheGet did not return a copy of \"1\".\n"); \
+    return false; \
+  } \
+  stringValue = stringDestroy(stringValue); \
+  /* "b" is now the least recently used. */ \
+  cachePut(cache, "e", "5"); \
+  if ((cacheSize(cache) != 4) || (cacheContains(cache, "b") == true) \
+    || (cacheContains(cache, "a") == false) \
+  ) { \
+    printLog(ERR, "Least recently used entry was not evicted.\n"); \
+    return false; \
+  } \
+  if ((cachePut(cache, "c", "33") != 0) || (cacheSize(cache) != 4)) { \
+    printLog(ERR, "Replacing a value changed the size.\n"); \
+    return false; \
+  } \
+  stringValue = (char*) cacheGet(cache, "c", NULL); \
+  if ((stringValue == NULL) || (strcmp(stringValue, "33") != 0)) { \
+    printLog(ERR, "cachePut did not replace the value.\n"); \
+    return false; \
+  } \
+  stringValue = stringDestroy(stringValue); \
+  /* "d" is now the least recently used. */ \
+  cachePut(cache, "f", "6"); \
+  if ((cacheContains(cache, "d") == true) \
+    || (cacheContains(cache, "c") == false) \
+  ) { \
+    printLog(ERR, "Replacement did not refresh recency.\n"); \
+    return false; \
+  } \
+  if ((cacheRemove(cache, "a") != 0) || (cacheRemove(cache, "a") == 0) \
+    || (cacheGet(cache, "a", NULL) != NULL) \
+  ) { \
+    printLog(ERR, "cacheRemove did not remove exactly once.\n"); \
+    return false; \
+  } \
+  if ((cacheStats(cache, &stats) != 0) || (stats.size != 3) \
+    || (stats.hits != 2) || (stats.misses != 1) || (stats.evictions != 2) \
+    || (stats.capacity != 4) \
+  ) { \
+    printLog(ERR, "Unexpected cache stats.\n"); \
+    return false; \
+  } \
+  if ((cacheClear(cache) != 0) || (cacheSize(cache) != 0)) { \
+    printLog(ERR, "cacheClear did not remove all entries.\n"); \
+    return false; \
+  } \
+  cache = cacheDestroy(cache); \
+ \
+  /* Time to live. */ \
+  cache = cacheCreate(typeString, 16, 1, 1); \
+  if (cache == NULL) { \
+    printLog(ERR, "Could not create cache with a time to live.\n"); \
+    return false; \
+  } \
+  cachePut(cache, "a", "1"); \
+  cachePut(cache, "b", "2"); \
+  struct timespec duration = { 0, 2000000 }; \
+  thrd_sleep(&duration, NULL); \
+  if (cacheContains(cache, "a") == true) { \
+    printLog(ERR, "Entry did not expire.\n"); \
+    return false; \
+  } \
+  if (cacheGet(cache, "a", NULL) != NULL) { \
+    printLog(ERR, "cacheGet returned an expired entry.\n"); \
+    return false; \
+  } \
+  if ((cachePurgeExpired(cache) != 1) || (cacheSize(cache) != 0)) { \
+    printLog(ERR, "cachePurgeExpired did not remove the other entry.\n"); \
+    return false; \
+  } \
+  if ((cacheStats(cache, &stats) != 0) || (stats.expirations != 2)) { \
+    printLog(ERR, "Expected 2 expirations, got %llu.\n", \
+      llu(stats.expirations)); \
+    return false; \
+  } \
+  cache = cacheDestroy(cache); \
+ \
+  /* Many shards. */ \
+  cache = cacheCreate(typeString, 1000, 0, 8); \
+  if ((cache == NULL) || (cache->numShards != 8)) { \
+    printLog(ERR, "Could not create sharded cache.\n"); \
+    return false; \
+  } \
+  for (int ii = 0; ii < 2000; ii++) { \
+    snprintf(key, sizeof(key), "%d", ii); \
+    if (cachePut(cache, key, key) != 0) { \
+      printLog(ERR, "cachePut failed for key %d.\n", ii); \
+      return false; \
+    } \
+  } \
+  if ((cacheStats(cache, &stats) != 0) || (stats.size > 1000) \
+    || (stats.size + stats.evictions != 2000) \
+  ) { \
+    printLog(ERR, "Sharded cache exceeded its capacity.\n"); \
+    return false; \
+  } \
+  cache = cacheDestroy(cache); \
+ \
+  return true; \
+}
+CACHE_UNIT_TEST
+
@@ -88,6 +88,11 @@
  * running stack.  It is the responsibility of the caller to ensure that the
  * running stack is setup correctly before calling coroutinePass.
  *
+ * On platforms where this file has its own context switch routines (see
+ * COROUTINE_REGISTER_SWITCH below), coroutineSaveContext and
+ * coroutineRestoreContext stand in for setjmp and longjmp.  They behave the
+ * same way but only save and restore the callee-saved registers.
+ *
  * The second parameter of coroutinePass is a CoroutineFuncData union.  This is
  * a union of a data pointer and a function pointer.  The reason for this union
  * is that both function pointers and data pointers have to be passed through
@@ -136,10 +141,237 @@
 #include <string.h>
 #include <stdio.h> // For error messages
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#endif // _WIN32
+
 // Prototype forward declarations for mutual recursion.
 void coroutineAllocateStack(int stackSize);
 void coroutineMain(void *stack);
 
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+#define COROUTINE_NO_REGISTER_SWITCH
+#endif
+#endif
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+// The sanitizers intercept longjmp to keep track of stack switches.  They
+// can't see ours.
+#define COROUTINE_NO_REGISTER_SWITCH
+#endif
+
+/// @def COROUTINE_REGISTER_SWITCH
+///
+/// @brief Defined when context switches are done by the routines below, which
+/// save and restore only the callee-saved registers, instead of by setjmp and
+/// longjmp.  setjmp and longjmp may save and restore the signal mask (a system
+/// call on some platforms) and mangle pointers, none of which a switch between
+/// coroutines on the same thread needs.  Define COROUTINE_NO_REGISTER_SWITCH to
+/// always use setjmp and longjmp.
+#if defined(COROUTINE_CONTEXT_REGISTERS) \
+  && !defined(COROUTINE_NO_REGISTER_SWITCH)
+#define COROUTINE_REGISTER_SWITCH
+#endif
+
+#ifdef COROUTINE_REGISTER_SWITCH
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+int coroutineRegistersSave(uintptr_t *registers)
+  __attribute__((returns_twice));
+void coroutineRegistersRestore(uintptr_t *registers, int value)
+  __attribute__((noreturn));
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @def COROUTINE_ASM_SYMBOL
+///
+/// @brief The assembler name of a C symbol.
+#ifdef __APPLE__
+#define COROUTINE_ASM_SYMBOL(name) "_" #name
+#else
+#define COROUTINE_ASM_SYMBOL(name) #name
+#endif
+
+// int coroutineRegistersSave(uintptr_t *registers)
+//
+// Works like setjmp:  Saves the callee-saved registers, the caller's stack
+// pointer, and the return address and returns 0.  Returns again with the value
+// passed to coroutineRegistersRestore when the context is restored.
+//
+// void coroutineRegistersRestore(uintptr_t *registers, int value)
+//
+// Works like longjmp:  Restores a context saved by coroutineRegistersSave and
+// makes that call return value (or 1 if value is 0).
+#if defined(__x86_64__) && defined(_WIN64)
+// Win64:  rbx, rbp, rdi, rsi, r12-r15, and xmm6-xmm15 are callee-saved.  The
+// first two arguments are in rcx and edx.
+__asm__(
+  ".text\n"
+  ".globl " COROUTINE_ASM_SYMBOL(coroutineRegistersSave) "\n"
+  ".p2align 4\n"
+  COROUTINE_ASM_SYMBOL(coroutineRegistersSave) ":\n"
+  "  movq %rbx, 0(%rcx)\n"
+  "  movq %rbp, 8(%rcx)\n"
+  "  movq %rdi, 16(%rcx)\n"
+  "  movq %rsi, 24(%rcx)\n"
+  "  movq %r12, 32(%rcx)\n"
+  "  movq %r13, 40(%rcx)\n"
+  "  movq %r14, 48(%rcx)\n"
+  "  movq %r15, 56(%rcx)\n"
+  "  leaq 8(%rsp), %rdx\n"
+  "  movq %rdx, 64(%rcx)\n"
+  "  movq (%rsp), %rdx\n"
+  "  movq %rdx, 72(%rcx)\n"
+  "  movdqu %xmm6, 80(%rcx)\n"
+  "  movdqu %xmm7, 96(%rcx)\n"
+  "  movdqu %xmm8, 112(%rcx)\n"
+  "  movdqu %xmm9, 128(%rcx)\n"
+  "  movdqu %xmm10, 144(%rcx)\n"
+  "  movdqu %xmm11, 160(%rcx)\n"
+  "  movdqu %xmm12, 176(%rcx)\n"
+  "  movdqu %xmm13, 192(%rcx)\n"
+  "  movdqu %xmm14, 208(%rcx)\n"
+  "  movdqu %xmm15, 224(%rcx)\n"
+  "  xorl %eax, %eax\n"
+  "  ret\n"
+  ".globl " COROUTINE_ASM_SYMBOL(coroutineRegistersRestore) "\n"
+  ".p2align 4\n"
+  COROUTINE_ASM_SYMBOL(coroutineRegistersRestore) ":\n"
+  "  movl %edx, %eax\n"
+  "  testl %eax, %eax\n"
+  "  jnz 1f\n"
+  "  incl %eax\n"
+  "1:\n"
+  "  movq 0(%rcx), %rbx\n"
+  "  movq 8(%rcx), %rbp\n"
+  "  movq 16(%rcx), %rdi\n"
+  "  movq 24(%rcx), %rsi\n"
+  "  movq 32(%rcx), %r12\n"
+  "  movq 40(%rcx), %r13\n"
+  "  movq 48(%rcx), %r14\n"
+  "  movq 56(%rcx), %r15\n"
+  "  movdqu 80(%rcx), %xmm6\n"
+  "  movdqu 96(%rcx), %xmm7\n"
+  "  movdqu 112(%rcx), %xmm8\n"
+  "  movdqu 128(%rcx), %xmm9\n"
+  "  movdqu 144(%rcx), %xmm10\n"
+  "  movdqu 160(%rcx), %xmm11\n"
+  "  movdqu 176(%rcx), %xmm12\n"
+  "  movdqu 192(%rcx), %xmm13\n"
+  "  movdqu 208(%rcx), %xmm14\n"
+  "  movdqu 224(%rcx), %xmm15\n"
+  "  movq 64(%rcx), %rsp\n"
+  "  jmpq *72(%rcx)\n"
+);
+#elif defined(__x86_64__)
+// System V:  rbx, rbp, and r12-r15 are callee-saved.  The first two arguments
+// are in rdi and esi.
+__asm__(
+  ".text\n"
+  ".globl " COROUTINE_ASM_SYMBOL(coroutineRegistersSave) "\n"
+  ".p2align 4\n"
+  COROUTINE_ASM_SYMBOL(coroutineRegistersSave) ":\n"
+  "  movq %rbx, 0(%rdi)\n"
+  "  movq %rbp, 8(%rdi)\n"
+  "  movq %r12, 16(%rdi)\n"
+  "  movq %r13, 24(%rdi)\n"
+  "  movq %r14, 32(%rdi)\n"
+  "  movq %r15, 40(%rdi)\n"
+  "  leaq 8(%rsp), %rdx\n"
+  "  movq %rdx, 48(%rdi)\n"
+  "  movq (%rsp), %rdx\n"
+  "  movq %rdx, 56(%rdi)\n"
+  "  xorl %eax, %eax\n"
+  "  ret\n"
+  ".globl " COROUTINE_ASM_SYMBOL(coroutineRegistersRestore) "\n"
+  ".p2align 4\n"
+  COROUTINE_ASM_SYMBOL(coroutineRegistersRestore) ":\n"
+  "  movl %esi, %eax\n"
+  "  testl %eax, %eax\n"
+  "  jnz 1f\n"
+  "  incl %eax\n"
+  "1:\n"
+  "  movq 0(%rdi), %rbx\n"
+  "  movq 8(%rdi), %rbp\n"
+  "  movq 16(%rdi), %r12\n"
+  "  movq 24(%rdi), %r13\n"
+  "  movq 32(%rdi), %r14\n"
+  "  movq 40(%rdi), %r15\n"
+  "  movq 48(%rdi), %rsp\n"
+  "  jmpq *56(%rdi)\n"
+);
+#elif defined(__aarch64__)
+// AAPCS64:  x19-x29, the link register (x30), sp, and d8-d15 are
+// callee-saved.  The first two arguments are in x0 and w1.
+__asm__(
+  ".text\n"
+  ".globl " COROUTINE_ASM_SYMBOL(coroutineRegistersSave) "\n"
+  ".p2align 4\n"
+  COROUTINE_ASM_SYMBOL(coroutineRegistersSave) ":\n"
+  "  stp x19, x20, [x0, #0]\n"
+  "  stp x21, x22, [x0, #16]\n"
+  "  stp x23, x24, [x0, #32]\n"
+  "  stp x25, x26, [x0, #48]\n"
+  "  stp x27, x28, [x0, #64]\n"
+  "  stp x29, x30, [x0, #80]\n"
+  "  mov x2, sp\n"
+  "  str x2, [x0, #96]\n"
+  "  stp d8, d9, [x0, #104]\n"
+  "  stp d10, d11, [x0, #120]\n"
+  "  stp d12, d13, [x0, #136]\n"
+  "  stp d14, d15, [x0, #152]\n"
+  "  mov w0, #0\n"
+  "  ret\n"
+  ".globl " COROUTINE_ASM_SYMBOL(coroutineRegistersRestore) "\n"
+  ".p2align 4\n"
+  COROUTINE_ASM_SYMBOL(coroutineRegistersRestore) ":\n"
+  "  ldp x19, x20, [x0, #0]\n"
+  "  ldp x21, x22, [x0, #16]\n"
+  "  ldp x23, x24, [x0, #32]\n"
+  "  ldp x25, x26, [x0, #48]\n"
+  "  ldp x27, x28, [x0, #64]\n"
+  "  ldp x29, x30, [x0, #80]\n"
+  "  ldr x2, [x0, #96]\n"
+  "  mov sp, x2\n"
+  "  ldp d8, d9, [x0, #104]\n"
+  "  ldp d10, d11, [x0, #120]\n"
+  "  ldp d12, d13, [x0, #136]\n"
+  "  ldp d14, d15, [x0, #152]\n"
+  "  cmp w1, #0\n"
+  "  csinc w0, w1, wzr, ne\n"
+  "  ret\n"
+);
+#endif // architecture
+
+/// @def coroutineSaveContext(context)
+///
+/// @brief Save the current context into a CoroutineContext.  Evaluates to 0
+/// when the context is saved and to the value passed to
+/// coroutineRestoreContext when it's restored.
+#define coroutineSaveContext(context) \
+  coroutineRegistersSave((context).registers)
+
+/// @def coroutineRestoreContext(context, value)
+///
+/// @brief Resume execution at the coroutineSaveContext call that saved a
+/// CoroutineContext.
+#define coroutineRestoreContext(context, value) \
+  coroutineRegistersRestore((context).registers, (value))
+
+#else // COROUTINE_REGISTER_SWITCH not defined
+
+#define coroutineSaveContext(context) setjmp((context).jumpBuffer)
+#define coroutineRestoreContext(context, value) \
+  longjmp((context).jumpBuffer, (value))
+
+#endif // COROUTINE_REGISTER_SWITCH
+
 /// @def ZEROINIT
 ///
 /// @brief Define the proper way to declare a zeroized variable based on the
@@ -154,6 +386,20 @@ void coroutineMain(void *stack);
 #define ZEROINIT(x) x = {0}
 #endif // __cplusplus
 
+/// @def comessageBufferAddFetch(referencesP, value)
+///
+/// @brief Atomically add value to the reference count of a ComessageBuffer and
+/// return the new count.  Buffers can be shared by coroutines on different
+/// threads, so this is atomic even without THREAD_SAFE_COROUTINES.
+#ifdef _MSC_VER
+#include <intrin.h>
+#define comessageBufferAddFetch(referencesP, value) \
+  (_InterlockedExchangeAdd((referencesP), (value)) + (value))
+#else
+#define comessageBufferAddFetch(referencesP, value) \
+  __atomic_add_fetch((referencesP), (value), __ATOMIC_ACQ_REL)
+#endif // _MSC_VER
+
 // Use statically-allocated global variables for use wihtout threading.
 
 /// @var static Coroutine *_globalFirst
@@ -186,6 +432,11 @@ static Coroutine* _globalIdle = NULL;
 /// @brief The size of each coroutine's stack in bytes.
 static int _globalStackSize = COROUTINE_DEFAULT_STACK_SIZE;
 
+/// @var static CoroutineStackType _globalStackType
+///
+/// @brief Where the stacks of new coroutines come from.
+static CoroutineStackType _globalStackType = COROUTINE_STACK_CARVED;
+
 /// @var _globalStateData
 ///
 /// @brief Global state data provided to the global callbacks.
@@ -201,6 +452,12 @@ static ComutexUnlockCallback _globalComutexUnlockCallback = NULL;
 /// @brief Global callback to call when a cocondition is signalled.
 static CoconditionSignalCallback _globalCoconditionSignalCallback = NULL;
 
+/// @var static struct CoroutineRunQueue *_globalRunQueue
+///
+/// @brief Global run queue used by coroutineSchedule and coroutineRun.
+/// Allocated on first use.
+static struct CoroutineRunQueue *_globalRunQueue = NULL;
+
 /// @fn int64_t coroutineGetNanoseconds(const struct timespec *ts)
 ///
 /// @brief Convert the time in a timespec to a raw number of nanoseconds.
@@ -222,6 +479,288 @@ int64_t coroutineGetNanoseconds(const struct timespec *ts) {
          + ((int64_t) ts->tv_nsec);
 }
 
+/// @struct CoroutineRunQueue
+///
+/// @brief The coroutines that a run loop (coroutineRun or a scheduler worker)
+/// is responsible for, split by whether they can make progress.  Runnable
+/// coroutines are resumed on every pass.  Coroutines that are blocked in a
+/// comutex or cocondition wait are parked and not resumed again until an
+/// unlock, a signal, or (for timed waits) their deadline wakes them.  Parked
+/// coroutines with a deadline are kept in a binary min-heap ordered by
+/// wakeTime so that idle waiters cost nothing until the earliest of them
+/// expires.
+///
+/// @param runnable The array of coroutines to resume on the next pass.
+/// @param numRunnable The number of elements in use in the runnable array.
+/// @param parked The min-heap of parked coroutines that have a deadline.
+/// @param numParked The number of elements in use in the parked array.
+/// @param numBlocked The number of parked coroutines without a deadline.
+///   These are only referenced from the queues of the comutexes and
+///   coconditions they're waiting on.
+/// @param capacity The number of elements allocated for each of the runnable
+///   and parked arrays.
+/// @param running Whether or not a run loop is currently using the queue.
+typedef struct CoroutineRunQueue {
+  Coroutine **runnable;
+  size_t numRunnable;
+  Coroutine **parked;
+  size_t numParked;
+  size_t numBlocked;
+  size_t capacity;
+  bool running;
+} CoroutineRunQueue;
+
+/// @fn static inline void coroutineRunQueuePlace(CoroutineRunQueue *runQueue, Coroutine *coroutine, size_t index)
+///
+/// @brief Store a coroutine at a position in the parked heap and record the
+/// position in the coroutine.
+///
+/// @param runQueue A pointer to the CoroutineRunQueue that owns the heap.
+/// @param coroutine A pointer to the Coroutine to store.
+/// @param index The heap position to store the coroutine at.
+///
+/// @return This function returns no value.
+static inline void coroutineRunQueuePlace(CoroutineRunQueue *runQueue,
+  Coroutine *coroutine, size_t index
+) {
+  runQueue->parked[index] = coroutine;
+  coroutine->timerIndex = index;
+}
+
+/// @fn static void coroutineRunQueueSift(CoroutineRunQueue *runQueue, size_t index)
+///
+/// @brief Restore the heap property for the coroutine at a position in the
+/// parked heap by moving it up or down as needed.
+///
+/// @param runQueue A pointer to the CoroutineRunQueue that owns the heap.
+/// @param index The heap position of the coroutine that may be out of place.
+///
+/// @return This function returns no value.
+static void coroutineRunQueueSift(CoroutineRunQueue *runQueue, size_t index) {
+  Coroutine **parked = runQueue->parked;
+  Coroutine *coroutine = parked[index];
+  int64_t wakeTime = coroutine->wakeTime;
+
+  while (index > 0) {
+    size_t parent = (index - 1) / 2;
+    if (parked[parent]->wakeTime <= wakeTime) {
+      break;
+    }
+    coroutineRunQueuePlace(runQueue, parked[parent], index);
+    index = parent;
+  }
+
+  while (1) {
+    size_t child = (2 * index) + 1;
+    if (child >= runQueue->numParked) {
+      break;
+    }
+    if ((child + 1 < runQueue->numParked)
+      && (parked[child + 1]->wakeTime < parked[child]->wakeTime)
+    ) {
+      child++;
+    }
+    if (parked[child]->wakeTime >= wakeTime) {
+      break;
+    }
+    coroutineRunQueuePlace(runQueue, parked[child], index);
+    index = child;
+  }
+
+  coroutineRunQueuePlace(runQueue, coroutine, index);
+}
+
+/// @fn static void coroutineRunQueuePark(CoroutineRunQueue *runQueue, Coroutine *coroutine)
+///
+/// @brief Park a blocked coroutine until coroutineRunQueueWake is called for
+/// it or, if it has a wakeTime, until its deadline passes.
+///
+/// @param runQueue A pointer to the CoroutineRunQueue to park the coroutine
+///   on.  The coroutine must already have been removed from the runnable
+///   array.
+/// @param coroutine A pointer to the Coroutine to park.
+///
+/// @return This function returns no value.
+static void coroutineRunQueuePark(CoroutineRunQueue *runQueue,
+  Coroutine *coroutine
+) {
+  coroutine->runQueue = runQueue;
+  if (coroutine->wakeTime != 0) {
+    coroutineRunQueuePlace(runQueue, coroutine, runQueue->numParked);
+    runQueue->numParked++;
+    coroutineRunQueueSift(runQueue, coroutine->timerIndex);
+  } else {
+    runQueue->numBlocked++;
+  }
+}
+
+/// @fn static void coroutineRunQueueWake(Coroutine *coroutine)
+///
+/// @brief Move a parked coroutine back to the runnable array of the
+/// CoroutineRunQueue it's parked on.  Called whenever something happens that
+/// may end the coroutine's wait.
+///
+/// @param coroutine A pointer to the Coroutine to wake.  If the coroutine is
+///   not parked, this call has no effect.
+///
+/// @return This function returns no value.
+static void coroutineRunQueueWake(Coroutine *coroutine) {
+  if ((coroutine == NULL) || (coroutine->runQueue == NULL)) {
+    return;
+  }
+
+  CoroutineRunQueue *runQueue = coroutine->runQueue;
+  if (coroutine->wakeTime != 0) {
+    size_t index = coroutine->timerIndex;
+    runQueue->numParked--;
+    if (index < runQueue->numParked) {
+      coroutineRunQueuePlace(runQueue,
+        runQueue->parked[runQueue->numParked], index);
+      coroutineRunQueueSift(runQueue, index);
+    }
+  } else {
+    runQueue->numBlocked--;
+  }
+
+  coroutine->runQueue = NULL;
+  runQueue->runnable[runQueue->numRunnable] = coroutine;
+  runQueue->numRunnable++;
+}
+
+/// @fn static void coroutineRunQueueExpire(CoroutineRunQueue *runQueue, int64_t now)
+///
+/// @brief Wake every parked coroutine whose deadline has been reached.
+///
+/// @param runQueue A pointer to the CoroutineRunQueue to check.
+/// @param now The current time in nanoseconds.
+///
+/// @return This function returns no value.
+static void coroutineRunQueueExpire(CoroutineRunQueue *runQueue,
+  int64_t now
+) {
+  while ((runQueue->numParked > 0)
+    && (runQueue->parked[0]->wakeTime <= now)
+  ) {
+    coroutineRunQueueWake(runQueue->parked[0]);
+  }
+}
+
+/// @fn static int coroutineRunQueueAdd(CoroutineRunQueue *runQueue, Coroutine *coroutine)
+///
+/// @brief Add a coroutine to the runnable array of a run queue, growing the
+/// queue's arrays if needed.
+///
+/// @param runQueue A pointer to the CoroutineRunQueue to add to.
+/// @param coroutine A pointer to the Coroutine to add.
+///
+/// @return Returns coroutineSuccess on success, coroutineNomem if the arrays
+/// could not be grown.
+static int coroutineRunQueueAdd(CoroutineRunQueue *runQueue,
+  Coroutine *coroutine
+) {
+  size_t numCoroutines
+    = runQueue->numRunnable + runQueue->numParked + runQueue->numBlocked;
+  if (numCoroutines == runQueue->capacity) {
+    // A coroutine is only ever in one of the arrays, so each of them needs to
+    // be able to hold every coroutine in the queue.
+    size_t capacity = (runQueue->capacity > 0) ? (2 * runQueue->capacity) : 16;
+    Coroutine **runnable = (Coroutine**) realloc(runQueue->runnable,
+      capacity * sizeof(Coroutine*));
+    if (runnable == NULL) {
+      return coroutineNomem;
+    }
+    runQueue->runnable = runnable;
+    Coroutine **parked = (Coroutine**) realloc(runQueue->parked,
+      capacity * sizeof(Coroutine*));
+    if (parked == NULL) {
+      return coroutineNomem;
+    }
+    runQueue->parked = parked;
+    runQueue->capacity = capacity;
+  }
+
+  runQueue->runnable[runQueue->numRunnable] = coroutine;
+  runQueue->numRunnable++;
+
+  return coroutineSuccess;
+}
+
+/// @fn static bool coroutineRunQueuePass(CoroutineRunQueue *runQueue)
+///
+/// @brief Wake any parked coroutines whose deadlines have passed and then
+/// resume every runnable coroutine once.  Coroutines that finish are dropped
+/// from the queue.  Coroutines that block in a comutex or cocondition wait are
+/// parked.  Coroutines that are woken by the ones that run are appended to the
+/// runnable array and get their turn in the same pass.
+///
+/// @param runQueue A pointer to the CoroutineRunQueue to run.
+///
+/// @return Returns true if any coroutine made progress, false if every
+/// coroutine that ran was blocked.
+static bool coroutineRunQueuePass(CoroutineRunQueue *runQueue) {
+  bool progress = false;
+
+  if (runQueue->numParked > 0) {
+    coroutineRunQueueExpire(runQueue, coroutineGetNanoseconds(NULL));
+  }
+
+  // The runnable array may be appended to while a coroutine runs, so don't
+  // hold on to anything but indices across a resume.
+  for (size_t ii = 0; ii < runQueue->numRunnable;) {
+    Coroutine *coroutine = runQueue->runnable[ii];
+    void *yieldValue = coroutineResume(coroutine, NULL);
+    if (coroutineFinished(coroutine)
+      || (yieldValue == COROUTINE_NOT_RESUMABLE)
+      || (yieldValue == COROUTINE_CORRUPT)
+    ) {
+      // The coroutine is done (or unusable).  Its Coroutine goes back on this
+      // thread's idle list, so just forget about it here.
+      runQueue->numRunnable--;
+      runQueue->runnable[ii] = runQueue->runnable[runQueue->numRunnable];
+      progress = true;
+      continue;
+    } else if (((yieldValue == COROUTINE_WAIT)
+        || (yieldValue == COROUTINE_TIMEDWAIT))
+      && ((coroutine->blockingComutex != NULL)
+        || (coroutine->blockingCocondition != NULL))
+    ) {
+      // The coroutine is blocked until whatever it's waiting on wakes it or
+      // its deadline passes.  Don't resume it again before then.
+      runQueue->numRunnable--;
+      runQueue->runnable[ii] = runQueue->runnable[runQueue->numRunnable];
+      coroutineRunQueuePark(runQueue, coroutine);
+      continue;
+    } else if ((yieldValue != COROUTINE_WAIT)
+      && (yieldValue != COROUTINE_TIMEDWAIT)
+    ) {
+      progress = true;
+    }
+    ii++;
+  }
+
+  return progress;
+}
+
+#ifdef THREAD_SAFE_COROUTINES
+/// @fn static void coroutineRunQueueDestroy(void *runQueue)
+///
+/// @brief Free a CoroutineRunQueue allocated by coroutineGetRunQueue.  The
+/// signature is that of a tss_dtor_t so that the thread-specific queues are
+/// freed when their threads exit.
+///
+/// @param runQueue A pointer to the CoroutineRunQueue to free, cast to a
+///   void*.
+///
+/// @return This function returns no value.
+static void coroutineRunQueueDestroy(void *runQueue) {
+  if (runQueue != NULL) {
+    free(((CoroutineRunQueue*) runQueue)->runnable);
+    free(((CoroutineRunQueue*) runQueue)->parked);
+    free(runQueue);
+  }
+}
+#endif // THREAD_SAFE_COROUTINES
+
 /// @fn void coroutineGlobalPush(Coroutine **list, Coroutine *coroutine)
 ///
 /// @brief Add a coroutine to a global list and get the previous head of the
@@ -297,6 +836,11 @@ ZEROINIT(static tss_t _tssIdle);
 /// @brief Thread-specific size of each coroutine's stack, in bytes.
 ZEROINIT(static tss_t _tssStackSize);
 
+/// @var static tss_t _tssStackType
+///
+/// @brief Thread-specific CoroutineStackType of new coroutines' stacks.
+ZEROINIT(static tss_t _tssStackType);
+
 /// @var static tss_t _tssStateData
 ///
 /// @brief Thread-specific state data provided to the thread-specific callbacks.
@@ -312,6 +856,12 @@ ZEROINIT(static tss_t _tssComutexUnlockCallback);
 /// @brief Thread-specific callback to call when a cocondition is signalled.
 ZEROINIT(static tss_t _tssCoconditionSignalCallback);
 
+/// @var static tss_t _tssRunQueue
+///
+/// @brief Thread-specific run queue used by coroutineSchedule and coroutineRun.
+/// Allocated on first use.
+ZEROINIT(static tss_t _tssRunQueue);
+
 /// @var static once_flag _threadMetadataSetup
 ///
 /// @brief once_flag to make sure we only initialize the thread-specific storage
@@ -340,6 +890,10 @@ void coroutineSetupThreadMetadata(void) {
   if (status != thrd_success) {
     fprintf(stderr, "Could not initialize _tssStackSize.\n");
   }
+  status = tss_create(&_tssStackType, NULL);
+  if (status != thrd_success) {
+    fprintf(stderr, "Could not initialize _tssStackType.\n");
+  }
   status = tss_create(&_tssStateData, NULL);
   if (status != thrd_success) {
     fprintf(stderr, "Could not initialize _tssStateData.\n");
@@ -352,6 +906,10 @@ void coroutineSetupThreadMetadata(void) {
   if (status != thrd_success) {
     fprintf(stderr, "Could not initialize _tssCoconditionSignalCallback.\n");
   }
+  status = tss_create(&_tssRunQueue, coroutineRunQueueDestroy);
+  if (status != thrd_success) {
+    fprintf(stderr, "Could not initialize _tssRunQueue.\n");
+  }
 }
 
 /// @fn void coroutineInitializeThreadMetadata(Coroutine *first)
@@ -403,6 +961,13 @@ bool coroutineInitializeThreadMetadata(Coroutine *first) {
       "coroutineInitializeThreadMetadata.\n", _globalStackSize);
     return false;
   }
+  status = tss_set(_tssStackType, (void*) ((intptr_t) _globalStackType));
+  if (status != thrd_success) {
+    fprintf(stderr,
+      "Could not set _tssStackType to %d in "
+      "coroutineInitializeThreadMetadata.\n", (int) _globalStackType);
+    return false;
+  }
   status = tss_set(_tssStateData, _globalStateData);
   if (status != thrd_success) {
     fprintf(stderr,
@@ -509,7 +1074,7 @@ CoroutineFuncData coroutinePass(Coroutine *currentCoroutine, CoroutineFuncData a
   ZEROINIT(CoroutineFuncData returnValue);
   
   if (currentCoroutine != NULL) {
-    if (!setjmp(currentCoroutine->context)) {
+    if (!coroutineSaveContext(currentCoroutine->context)) {
 #ifdef THREAD_SAFE_COROUTINES
       Coroutine* targetCoroutine = NULL;
       if (!_coroutineThreadingSupportEnabled) {
@@ -533,7 +1098,7 @@ CoroutineFuncData coroutinePass(Coroutine *currentCoroutine, CoroutineFuncData a
         context->Frame = 0;
 #endif // _MSC_VER
         targetCoroutine->passed = arg;
-        longjmp(targetCoroutine->context, 1);
+        coroutineRestoreContext(targetCoroutine->context, 1);
       }
     }
   } else {
@@ -722,11 +1287,25 @@ Coroutine* coroutineInit(Coroutine *userCoroutine,
   }
 
   // The current coroutine is at the head of the running list.
-  if ((idle == NULL) && (!setjmp(running->context))) {
+  if ((idle == NULL) && (!coroutineSaveContext(running->context))) {
     // We've just been called from the calling function and need to create a
     // new Coroutine instance, including its stack.
     coroutineAllocateStack(stackSize);
   }
+  if (idle == NULL) {
+    // If the allocation succeeded, the new Coroutine is on the idle list now.
+    // A mapped stack allocation can fail and return here without one.
+    idle = _globalIdle;
+#ifdef THREAD_SAFE_COROUTINES
+    if (_coroutineThreadingSupportEnabled) {
+      idle = (Coroutine*) tss_get(_tssIdle);
+    }
+#endif
+    if (idle == NULL) {
+      fprintf(stderr, "ERROR: Could not allocate coroutine stack.\n");
+      return NULL;
+    }
+  }
   // Either there was an idle coroutine on the idle list or we just returned
   // from coroutineMain (called by coroutineAllocateStack).  Either way, the Coroutine
   // instance we want to use is now at the head of the idle list.
@@ -815,6 +1394,8 @@ Coroutine* coroutineInit(Coroutine *userCoroutine,
   configuredCoroutine->nextToLock = NULL;
   configuredCoroutine->prevToLock = NULL;
   configuredCoroutine->blockingComutex = NULL;
+  configuredCoroutine->wakeTime = 0;
+  configuredCoroutine->runQueue = NULL;
 
   coroutineResume(configuredCoroutine, arg);
 
@@ -936,11 +1517,11 @@ void coroutineMain(void *stack) {
     stackSize = (int) ((intptr_t) tss_get(_tssStackSize));
   }
 #endif
-  if (!setjmp(running->context)) {
+  if (!coroutineSaveContext(running->context)) {
     coroutineAllocateStack(stackSize);
   }
 
-  if (setjmp(running->resetContext)) {
+  if (coroutineSaveContext(running->resetContext)) {
     // When a coroutine is killed, its normal context is set to this position
     // so that it can be restarted properly from the constructor.  We'll have to
     // manually pull the data that was provided from coroutinePass since the
@@ -1087,13 +1668,188 @@ void coroutineAllocateStack1024(int stackSize, void *topOfStack) {
   allocateNextStackChunk(stackSize, topOfStack);
 }
 
+#ifndef _WIN32
+
+/// @var static char *_stackPoolNext
+///
+/// @brief The next unused stack in the most recently mapped pool chunk.
+static char *_stackPoolNext = NULL;
+
+/// @var static size_t _stackPoolRemaining
+///
+/// @brief The number of unused stacks left in the current pool chunk.
+static size_t _stackPoolRemaining = 0;
+
+/// @var static size_t _stackPoolStride
+///
+/// @brief The size in bytes (guard pages included) of each stack in the
+/// current pool chunk.
+static size_t _stackPoolStride = 0;
+
+#ifdef THREAD_SAFE_COROUTINES
+/// @var static lmtx_t _stackPoolLock
+///
+/// @brief Mutex guarding the stack pool variables above.
+ZEROINIT(static lmtx_t _stackPoolLock);
+
+/// @var static once_flag _stackPoolLockSetup
+///
+/// @brief once_flag to make sure we only initialize _stackPoolLock once.
+static once_flag _stackPoolLockSetup = ONCE_FLAG_INIT;
+
+/// @fn static void coroutineSetupStackPoolLock(void)
+///
+/// @brief Initialize the mutex that guards the stack pool.
+///
+/// @return This function returns no value.
+static void coroutineSetupStackPoolLock(void) {
+  if (lmtx_init(&_stackPoolLock) != thrd_success) {
+    fprintf(stderr, "Could not initialize _stackPoolLock.\n");
+  }
+}
+#endif // THREAD_SAFE_COROUTINES
+
+/// @fn static char* coroutineStackPoolGet(size_t stride)
+///
+/// @brief Reserve one stack's worth of address space from the stack pool,
+/// mapping a new chunk of COROUTINE_STACK_POOL_CHUNK stacks if needed.  The
+/// pages are mapped with MAP_NORESERVE where available, so they are not
+/// committed until they're touched.  Stacks are never returned to the pool
+/// because Coroutines are recycled through the idle list rather than freed.
+///
+/// @param stride The size in bytes of the stack to reserve, including its
+///   guard pages.
+///
+/// @return Returns a pointer to the lowest address of the reserved stack on
+/// success, NULL on failure.
+static char* coroutineStackPoolGet(size_t stride) {
+  char *stackBase = NULL;
+
+#ifdef THREAD_SAFE_COROUTINES
+  call_once(&_stackPoolLockSetup, coroutineSetupStackPoolLock);
+  lmtx_lock(&_stackPoolLock);
+#endif // THREAD_SAFE_COROUTINES
+
+  if ((_stackPoolRemaining == 0) || (_stackPoolStride != stride)) {
+    // Either the current chunk is used up or it was carved for a different
+    // stack size.  Either way, abandon what's left of it and map a new one.
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+#ifdef MAP_STACK
+    flags |= MAP_STACK;
+#endif
+    void *chunk = mmap(NULL, stride * COROUTINE_STACK_POOL_CHUNK,
+      PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (chunk != MAP_FAILED) {
+      _stackPoolNext = (char*) chunk;
+      _stackPoolRemaining = COROUTINE_STACK_POOL_CHUNK;
+      _stackPoolStride = stride;
+    } else {
+      fprintf(stderr, "Could not map coroutine stack pool chunk.\n");
+    }
+  }
+  if ((_stackPoolRemaining > 0) && (_stackPoolStride == stride)) {
+    stackBase = _stackPoolNext;
+    _stackPoolNext += stride;
+    _stackPoolRemaining--;
+  }
+
+#ifdef THREAD_SAFE_COROUTINES
+  lmtx_unlock(&_stackPoolLock);
+#endif // THREAD_SAFE_COROUTINES
+
+  return stackBase;
+}
+
+/// @fn static void coroutineMappedStackMain(void)
+///
+/// @brief Entry point on a freshly-mapped stack.  makecontext can only pass
+/// int arguments, so take the address of a local to hand to coroutineMain as
+/// its (otherwise unused) stack pointer.
+///
+/// @return This function never returns.
+static void coroutineMappedStackMain(void) {
+  char topOfStack = 0;
+  coroutineMain(&topOfStack);
+}
+
+/// @fn static void coroutineAllocateMappedStack(int stackSize)
+///
+/// @brief Reserve a stack with guard pages from the stack pool and start
+/// coroutineMain on it.  From then on, control moves between it and the other
+/// coroutines with setjmp and longjmp just like with carved stacks.
+///
+/// @param stackSize The desired minimum size of the stack, in bytes.
+///
+/// @return This function only returns on failure.
+static void coroutineAllocateMappedStack(int stackSize) {
+  size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+  size_t usableSize
+    = (((size_t) stackSize + pageSize - 1) / pageSize) * pageSize;
+  size_t guardSize = ((size_t) COROUTINE_STACK_GUARD_PAGES) * pageSize;
+
+  char *stackBase = coroutineStackPoolGet(guardSize + usableSize);
+  if (stackBase == NULL) {
+    return;
+  }
+  // Stacks grow down, so the guard pages go at the low end.
+  if ((guardSize > 0) && (mprotect(stackBase, guardSize, PROT_NONE) != 0)) {
+    fprintf(stderr, "Could not protect coroutine stack guard pages.\n");
+    return;
+  }
+
+  ucontext_t context;
+  if (getcontext(&context) != 0) {
+    fprintf(stderr, "Could not get context for coroutine stack.\n");
+    return;
+  }
+  context.uc_stack.ss_sp = stackBase + guardSize;
+  context.uc_stack.ss_size = usableSize;
+  context.uc_link = NULL;
+  makecontext(&context, coroutineMappedStackMain, 0);
+  setcontext(&context);
+
+  // setcontext only returns on failure.
+  fprintf(stderr, "Could not switch to coroutine stack.\n");
+}
+
+#endif // _WIN32
+
+/// @fn static CoroutineStackType coroutineCurrentStackType(void)
+///
+/// @brief Get the stack type configured for the current thread.
+///
+/// @return Returns the CoroutineStackType to use for new coroutines.
+static CoroutineStackType coroutineCurrentStackType(void) {
+#ifdef THREAD_SAFE_COROUTINES
+  if (_coroutineThreadingSupportEnabled) {
+    call_once(&_threadMetadataSetup, coroutineSetupThreadMetadata);
+    if (tss_get(_tssFirst) != NULL) {
+      return (CoroutineStackType) ((intptr_t) tss_get(_tssStackType));
+    }
+  }
+#endif // THREAD_SAFE_COROUTINES
+
+  return _globalStackType;
+}
+
 /// void coroutineAllocateStack(int stackSize)
 ///
 /// @brief Allocate space for the current stack to grow before creating the
 /// initial stack frame for the next coroutine.
 ///
-/// @return This function returns no value.
+/// @return This function returns no value.  When the stack type is
+/// COROUTINE_STACK_MAPPED, it only returns on failure.
 void coroutineAllocateStack(int stackSize) {
+#ifndef _WIN32
+  if (coroutineCurrentStackType() == COROUTINE_STACK_MAPPED) {
+    coroutineAllocateMappedStack(stackSize);
+    return;
+  }
+#endif // _WIN32
+
   if (stackSize >= 1024) {
     coroutineAllocateStack1024(stackSize, NULL);
   } else if (stackSize >= 512) {
@@ -1168,7 +1924,7 @@ int coroutineTerminate(Coroutine *targetCoroutine, Comutex **mutexes) {
   // Halt the coroutine.
   targetCoroutine->id = COROUTINE_ID_NOT_SET;
   targetCoroutine->state = COROUTINE_STATE_NOT_RUNNING;
-  memcpy(&targetCoroutine->context, &targetCoroutine->resetContext, sizeof(jmp_buf));
+  memcpy(&targetCoroutine->context, &targetCoroutine->resetContext, sizeof(CoroutineContext));
 #ifdef THREAD_SAFE_COROUTINES
   if (!_coroutineThreadingSupportEnabled) {
     coroutineGlobalPush(&_globalIdle, targetCoroutine);
@@ -1187,6 +1943,7 @@ int coroutineTerminate(Coroutine *targetCoroutine, Comutex **mutexes) {
         // Unlock the mutex.
         mutexes[i]->recursionLevel = 0;
         mutexes[i]->coroutine = NULL;
+        coroutineRunQueueWake(mutexes[i]->head);
       }
     }
   }
@@ -1238,6 +1995,22 @@ int coroutineTerminate(Coroutine *targetCoroutine, Comutex **mutexes) {
   targetCoroutine->prevToLock = NULL;
   targetCoroutine->blockingComutex = NULL;
 
+  // If the coroutine was parked, hand it back to its run loop so that the run
+  // loop sees that it's no longer resumable.
+  coroutineRunQueueWake(targetCoroutine);
+  targetCoroutine->wakeTime = 0;
+
+  // Whoever is now at the head of the queues the coroutine was in may be able
+  // to proceed.
+  if (cond != NULL) {
+    if (cond->numSignals > 0) {
+      coroutineRunQueueWake(cond->head);
+    }
+  }
+  if ((mtx != NULL) && (mtx->coroutine == NULL)) {
+    coroutineRunQueueWake(mtx->head);
+  }
+
   // Destroy any messages that were sent.
   // NOTE:  This must be done after we've taken care of the signals and mutexes
   // above because the coroutine may have been waiting on a message, in which
@@ -1445,6 +2218,63 @@ int coroutineConfig(Coroutine *first, int stackSize, void *stateData,
   return coroutineSuccess;
 }
 
+/// @fn int coroutineSetStackType(CoroutineStackType stackType)
+///
+/// @brief Select where the stacks of coroutines allocated by the current
+/// thread (and by threads that start using coroutines later) come from.  Like
+/// the stack size, this must be set before the first coroutine is created on
+/// the thread.
+///
+/// @param stackType The CoroutineStackType to use.
+///
+/// @return Returns coroutineSuccess on success, coroutineError if the type is
+/// invalid or unsupported on this platform or if a coroutine has already been
+/// created on this thread.
+int coroutineSetStackType(CoroutineStackType stackType) {
+  if ((stackType < 0) || (stackType >= NUM_COROUTINE_STACK_TYPES)) {
+    return coroutineError;
+  }
+#ifdef _WIN32
+  if (stackType == COROUTINE_STACK_MAPPED) {
+    // No mmap or makecontext here.
+    return coroutineError;
+  }
+#endif // _WIN32
+
+  Coroutine* idle = _globalIdle;
+#ifdef THREAD_SAFE_COROUTINES
+  if (_coroutineThreadingSupportEnabled) {
+    call_once(&_threadMetadataSetup, coroutineSetupThreadMetadata);
+    idle = (Coroutine*) tss_get(_tssIdle);
+  }
+#endif // THREAD_SAFE_COROUTINES
+
+  if (idle != NULL) {
+    fprintf(stderr,
+      "coroutineSetStackType called after coroutine creation.\n");
+    return coroutineError;
+  }
+
+  _globalStackType = stackType;
+#ifdef THREAD_SAFE_COROUTINES
+  if (_coroutineThreadingSupportEnabled) {
+    tss_set(_tssStackType, (void*) ((intptr_t) stackType));
+  }
+#endif // THREAD_SAFE_COROUTINES
+
+  return coroutineSuccess;
+}
+
+/// @fn CoroutineStackType coroutineStackType(void)
+///
+/// @brief Get where the stacks of coroutines allocated by the current thread
+/// come from.
+///
+/// @return Returns the current thread's CoroutineStackType.
+CoroutineStackType coroutineStackType(void) {
+  return coroutineCurrentStackType();
+}
+
 /// @fn int comutexInit(Comutex* mtx, int type)
 ///
 /// @brief Initialize a coroutine mutex.
@@ -1593,6 +2423,7 @@ int comutexUnlock(Comutex *mtx) {
       }
 
       mtx->coroutine = NULL;
+      coroutineRunQueueWake(mtx->head);
     }
   } else {
     returnValue = coroutineError;
@@ -1610,6 +2441,9 @@ int comutexUnlock(Comutex *mtx) {
 /// @return This function returns no value.
 void comutexDestroy(Comutex *mtx) {
   if (mtx != NULL) {
+    for (Coroutine *cur = mtx->head; cur != NULL; cur = cur->nextToLock) {
+      coroutineRunQueueWake(cur);
+    }
     mtx->lastYieldValue = NULL;
     mtx->type = 0;
     mtx->coroutine = NULL;
@@ -1680,6 +2514,7 @@ int comutexTimedLock(Comutex *mtx, const struct timespec *ts) {
 
   int returnValue = comutexTryLock(mtx);
   running->blockingComutex = mtx;
+  running->wakeTime = mtx->timeoutTime;
   while (returnValue != coroutineSuccess) {
     if (coroutineGetNanoseconds(NULL) > mtx->timeoutTime) {
       returnValue = coroutineTimedout;
@@ -1689,6 +2524,7 @@ int comutexTimedLock(Comutex *mtx, const struct timespec *ts) {
     returnValue = comutexTryLock(mtx);
   }
   mtx->timeoutTime = 0;
+  running->wakeTime = 0;
   running->blockingComutex = NULL;
 
   // Remove ourselves from the queue.
@@ -1702,6 +2538,11 @@ int comutexTimedLock(Comutex *mtx, const struct timespec *ts) {
   if (running->nextToLock != NULL) {
     running->nextToLock->prevToLock = prev;
   }
+  if (mtx->coroutine == NULL) {
+    // We gave up while the mutex was free, so whoever is now at the head of
+    // the queue can have it.
+    coroutineRunQueueWake(mtx->head);
+  }
 
   return returnValue;
 }
@@ -1789,6 +2630,9 @@ int coconditionBroadcast(Cocondition *cond) {
 
   if (cond != NULL) {
     cond->numSignals = cond->numWaiters;
+    for (Coroutine *cur = cond->head; cur != NULL; cur = cur->nextToSignal) {
+      coroutineRunQueueWake(cur);
+    }
 
     void *stateData = _globalStateData;
     CoconditionSignalCallback coconditionSignalCallback
@@ -1825,6 +2669,9 @@ int coconditionBroadcast(Cocondition *cond) {
 /// @return This function returns no value.
 void coconditionDestroy(Cocondition *cond) {
   if (cond != NULL) {
+    for (Coroutine *cur = cond->head; cur != NULL; cur = cur->nextToSignal) {
+      coroutineRunQueueWake(cur);
+    }
     cond->lastYieldValue = NULL;
     cond->numWaiters = 0;
     cond->numSignals = -1;
@@ -1872,6 +2719,7 @@ int coconditionSignal(Cocondition *cond) {
 
   if ((cond != NULL) && (cond->numWaiters > 0)) {
     cond->numSignals++;
+    coroutineRunQueueWake(cond->head);
 
     void *stateData = _globalStateData;
     CoconditionSignalCallback coconditionSignalCallback
@@ -1958,6 +2806,7 @@ int coconditionTimedWait(Cocondition *cond, Comutex *mtx,
 
   int returnValue = coroutineSuccess;
   running->blockingCocondition = cond;
+  running->wakeTime = cond->timeoutTime;
   while ((cond->numSignals == 0) || (cond->head != running)) {
     cond->lastYieldValue = coroutineYield(COROUTINE_TIMEDWAIT);
 
@@ -1969,6 +2818,7 @@ int coconditionTimedWait(Cocondition *cond, Comutex *mtx,
     }
   }
   cond->timeoutTime = 0;
+  running->wakeTime = 0;
   running->blockingCocondition = NULL;
   if ((returnValue == coroutineSuccess) && (cond->numSignals > 0)) {
     // We are at the head of the queue.
@@ -2009,6 +2859,10 @@ int coconditionTimedWait(Cocondition *cond, Comutex *mtx,
   }
   running->nextToSignal = NULL;
   running->prevToSignal = NULL;
+  if (cond->numSignals > 0) {
+    // There are signals left over for whoever is next in line.
+    coroutineRunQueueWake(cond->head);
+  }
 
   comutexLock(mtx);
   return returnValue;
@@ -2089,6 +2943,10 @@ int coconditionWait(Cocondition *cond, Comutex *mtx) {
   }
   running->nextToSignal = NULL;
   running->prevToSignal = NULL;
+  if (cond->numSignals > 0) {
+    // There are signals left over for whoever is next in line.
+    coroutineRunQueueWake(cond->head);
+  }
 
   comutexLock(mtx);
   return returnValue;
@@ -2191,12 +3049,61 @@ Comessage* comessageQueuePop(void) {
   return head;
 }
 
-/// @fn Comessage* comessageQueuePopType(int type)
+/// @fn Comessage* comessageQueuePopN(size_t n)
 ///
-/// @brief Get the first message of the specified type from the running
-/// coroutine's message queue and remove it from the queue.
+/// @brief Remove up to a specified number of messages from the head of the
+/// running coroutine's message queue with a single lock operation.
 ///
-/// @param type The type of message to get.
+/// @param n The maximum number of messages to remove.
+///
+/// @return Returns the first of the removed messages, which are still linked
+/// in order by their next pointers with the last one's next pointer set to
+/// NULL.  Returns NULL if the queue is empty or on failure.
+Comessage* comessageQueuePopN(size_t n) {
+  Comessage *head = NULL;
+
+  Coroutine *coroutine = getRunningCoroutine();
+  if ((n > 0) && (coroutine != NULL)
+    && (comutexLock(&coroutine->messageLock) == coroutineSuccess)
+  ) {
+    head = coroutine->nextMessage;
+    Comessage *last = head;
+    for (size_t ii = 1; (ii < n) && (last != NULL); ii++) {
+      last = last->next;
+    }
+    if ((last == NULL) || (last->next == NULL)) {
+      // Taking everything.
+      coroutine->nextMessage = NULL;
+      coroutine->lastMessage = NULL;
+    } else {
+      coroutine->nextMessage = last->next;
+      last->next = NULL;
+    }
+
+    comutexUnlock(&coroutine->messageLock);
+  }
+
+  return head;
+}
+
+/// @fn Comessage* comessageQueuePopAll(void)
+///
+/// @brief Remove every message from the running coroutine's message queue
+/// with a single lock operation.
+///
+/// @return Returns the first of the removed messages, which are still linked
+/// in order by their next pointers.  Returns NULL if the queue is empty or on
+/// failure.
+Comessage* comessageQueuePopAll(void) {
+  return comessageQueuePopN(SIZE_MAX);
+}
+
+/// @fn Comessage* comessageQueuePopType(int type)
+///
+/// @brief Get the first message of the specified type from the running
+/// coroutine's message queue and remove it from the queue.
+///
+/// @param type The type of message to get.
 ///
 /// @return Returns the first message of the specified type on success, NULL on
 /// failure.
@@ -2408,6 +3315,59 @@ int comessageQueuePush(Coroutine *coroutine, Comessage *comessage) {
   return returnValue;
 }
 
+/// @fn int comessageQueuePushBatch(Coroutine *coroutine, Comessage *comessages)
+///
+/// @brief Push a chain of messages onto a coroutine's message queue.  The whole
+/// chain is added under a single lock operation and the waiters are signalled
+/// once.
+///
+/// @param coroutine A pointer to the Coroutine with the message queue to add
+///   to.  If this is NULL, the messages are sent to the running coroutine.
+/// @param comessages A pointer to the first Comessage of a chain of messages
+///   linked by their next pointers and terminated by a NULL next pointer.  The
+///   messages keep their order in the destination queue.
+///
+/// @return Returns coroutineSuccess, coroutineError on failure.
+int comessageQueuePushBatch(Coroutine *coroutine, Comessage *comessages) {
+  int returnValue = coroutineError;
+
+  if (comessages == NULL) {
+    // This is invalid.
+    return returnValue; // coroutineError
+  }
+
+  if (coroutine == NULL) {
+    // Sending messages to ourselves.
+    coroutine = getRunningCoroutine();
+  }
+
+  if ((coroutine != NULL)
+    && (comutexLock(&coroutine->messageLock) == coroutineSuccess)
+  ) {
+    Coroutine *from = getRunningCoroutine();
+    Comessage *last = comessages;
+    for (Comessage *cur = comessages; cur != NULL; cur = cur->next) {
+      cur->from = from;
+      cur->to = coroutine;
+      last = cur;
+    }
+    if (coroutine->lastMessage != NULL) {
+      coroutine->lastMessage->next = comessages;
+    } else {
+      // Empty queue.
+      coroutine->nextMessage = comessages;
+    }
+    coroutine->lastMessage = last;
+
+    // Let all the waiters know that there's something new in the queue now.
+    returnValue = coconditionBroadcast(&coroutine->messageCondition);
+
+    comutexUnlock(&coroutine->messageLock);
+  }
+
+  return returnValue;
+}
+
 /// @fn int comessageStartUse(Comessage *comessage)
 ///
 /// @brief Initialize a Comessage for use if it's not arleady initialized.
@@ -2428,6 +3388,7 @@ int comessageStartUse(Comessage *comessage) {
       comessage->done = true;
       comessage->inUse = true;
       comessage->from = 0;
+      comessage->buffer = NULL;
       if (comessage->configured == false) {
         if (coconditionInit(&comessage->condition) == coroutineSuccess) {
           if (comutexInit(&comessage->lock, comutexPlain | comutexTimed)
@@ -2473,6 +3434,7 @@ int comessageDestroy(Comessage *comessage) {
   // Don't touch comessage->size.
   // Don't touch comessage->next.
   // Don't touch comessage->waiting.
+  comessage->buffer = comessageBufferRelease(comessage->buffer);
   comessage->inUse = false;
   // Don't touch from.
   if (comessage->configured == true) {
@@ -2542,11 +3504,143 @@ int comessageInit(
   comessage->done = false;
   // No need to set comessage->inUse since we called comessageStartUse above.
   // Don't touch comessage->from in case this message is being reused.
+  // A message that's being reused while still in use may still hold a buffer.
+  comessage->buffer = comessageBufferRelease(comessage->buffer);
   returnValue = coroutineSuccess;
 
   return returnValue;
 }
 
+/// @fn int comessageInitBuffer(Comessage *comessage, int type, ComessageBuffer *buffer, bool waiting)
+///
+/// @brief Initialize a Comessage whose payload is a shared buffer.  The message
+/// takes its own reference to the buffer and drops it when the message is
+/// released or destroyed, so the caller can release its reference as soon as
+/// the message has been pushed.
+///
+/// @param comessage A pointer to the Comessage structure to initialize.
+/// @param type The type integer value to set for the type of the Comessage.
+/// @param buffer The ComessageBuffer to attach to the message.  The message's
+///   data and size are set to the buffer's.
+/// @param waiting Whether or not the caller of this function will be waiting on
+///   a response to this message from the destination thread.
+///
+/// @return Returns coroutineSuccess on success, coroutineError on failure.
+int comessageInitBuffer(
+  Comessage *comessage, int type, ComessageBuffer *buffer, bool waiting
+) {
+  if (buffer == NULL) {
+    return coroutineError;
+  }
+
+  int returnValue = comessageInit(
+    comessage, type, (void*) buffer->data, buffer->size, waiting);
+  if (returnValue == coroutineSuccess) {
+    comessage->buffer = comessageBufferRetain(buffer);
+  }
+
+  return returnValue;
+}
+
+/// @fn ComessageBuffer* comessageBufferCreate(const void *data, size_t size)
+///
+/// @brief Create a shared buffer holding a copy of a payload.  The payload is
+/// stored in the same allocation as the buffer.
+///
+/// @param data A pointer to the payload to copy.  May be NULL only if size is
+///   0.
+/// @param size The number of bytes pointed to by data.
+///
+/// @return Returns a new ComessageBuffer with one reference, owned by the
+/// caller, on success, NULL on failure.
+ComessageBuffer* comessageBufferCreate(const void *data, size_t size) {
+  if ((data == NULL) && (size > 0)) {
+    return NULL;
+  }
+
+  ComessageBuffer *buffer
+    = (ComessageBuffer*) malloc(sizeof(ComessageBuffer) + size);
+  if (buffer == NULL) {
+    return buffer; // NULL
+  }
+
+  void *inlineData = &buffer[1];
+  if (size > 0) {
+    memcpy(inlineData, data, size);
+  }
+  buffer->data = inlineData;
+  buffer->size = size;
+  buffer->references = 1;
+  buffer->freeData = NULL;
+
+  return buffer;
+}
+
+/// @fn ComessageBuffer* comessageBufferWrap(void *data, size_t size, void (*freeData)(void *data))
+///
+/// @brief Create a shared buffer that takes ownership of an existing payload
+/// without copying it.
+///
+/// @param data A pointer to the payload.
+/// @param size The number of bytes pointed to by data.
+/// @param freeData The function to free data with when the last reference to
+///   the buffer is released.  May be NULL if data doesn't need to be freed.
+///
+/// @return Returns a new ComessageBuffer with one reference, owned by the
+/// caller, on success, NULL on failure.  On failure, data is not freed.
+ComessageBuffer* comessageBufferWrap(
+  void *data, size_t size, void (*freeData)(void *data)
+) {
+  ComessageBuffer *buffer
+    = (ComessageBuffer*) malloc(sizeof(ComessageBuffer));
+  if (buffer == NULL) {
+    return buffer; // NULL
+  }
+
+  buffer->data = data;
+  buffer->size = size;
+  buffer->references = 1;
+  buffer->freeData = freeData;
+
+  return buffer;
+}
+
+/// @fn ComessageBuffer* comessageBufferRetain(ComessageBuffer *buffer)
+///
+/// @brief Take another reference to a shared buffer.
+///
+/// @param buffer A pointer to the ComessageBuffer to reference.
+///
+/// @return Returns buffer.
+ComessageBuffer* comessageBufferRetain(ComessageBuffer *buffer) {
+  if (buffer != NULL) {
+    comessageBufferAddFetch(&buffer->references, 1);
+  }
+
+  return buffer;
+}
+
+/// @fn ComessageBuffer* comessageBufferRelease(ComessageBuffer *buffer)
+///
+/// @brief Drop a reference to a shared buffer, freeing it and its payload if
+/// it was the last one.
+///
+/// @param buffer A pointer to the ComessageBuffer to release.
+///
+/// @return Always returns NULL.
+ComessageBuffer* comessageBufferRelease(ComessageBuffer *buffer) {
+  if ((buffer != NULL)
+    && (comessageBufferAddFetch(&buffer->references, -1) == 0)
+  ) {
+    if (buffer->freeData != NULL) {
+      buffer->freeData((void*) buffer->data);
+    }
+    free(buffer);
+  }
+
+  return NULL;
+}
+
 /// @fn int comessageRelease(Comessage *comessage)
 ///
 /// @brief Release a Comessage from use, but don't deconfigure any of its
@@ -2568,6 +3662,7 @@ int comessageRelease(Comessage *comessage) {
   // Don't touch comessage->size.
   // Don't touch comessage->next.
   // Don't touch comessage->waiting.
+  comessage->buffer = comessageBufferRelease(comessage->buffer);
   comessage->inUse = false;
   // Don't touch comessage->from.
   if (comessage->configured == true) {
@@ -2885,3 +3980,643 @@ Comessage* comessageWaitForReplyWithType(Comessage *sent, bool releaseAfterDone,
   return comessageWaitForReplyWithType_(sent, releaseAfterDone, &type, ts);
 }
 
+
+// Run queue support.
+
+/// @fn static CoroutineRunQueue* coroutineGetRunQueue(void)
+///
+/// @brief Get the calling thread's run queue, allocating it if this is the
+/// first time it's been asked for.
+///
+/// @return Returns a pointer to the thread's CoroutineRunQueue on success, NULL
+/// on failure.
+static CoroutineRunQueue* coroutineGetRunQueue(void) {
+  CoroutineRunQueue *runQueue = _globalRunQueue;
+#ifdef THREAD_SAFE_COROUTINES
+  if (_coroutineThreadingSupportEnabled) {
+    call_once(&_threadMetadataSetup, coroutineSetupThreadMetadata);
+    runQueue = (CoroutineRunQueue*) tss_get(_tssRunQueue);
+  }
+#endif
+
+  if (runQueue == NULL) {
+    runQueue = (CoroutineRunQueue*) calloc(1, sizeof(CoroutineRunQueue));
+    if (runQueue == NULL) {
+      return NULL;
+    }
+#ifdef THREAD_SAFE_COROUTINES
+    if (_coroutineThreadingSupportEnabled) {
+      if (tss_set(_tssRunQueue, runQueue) != thrd_success) {
+        free(runQueue);
+        return NULL;
+      }
+    } else {
+      _globalRunQueue = runQueue;
+    }
+#else
+    _globalRunQueue = runQueue;
+#endif
+  }
+
+  return runQueue;
+}
+
+/// @fn int coroutineSchedule(Coroutine *coroutine)
+///
+/// @brief Add a coroutine to the calling thread's run queue so that it will be
+/// resumed by coroutineRun.  Coroutines that are already running may schedule
+/// other coroutines, including while coroutineRun is in progress.
+///
+/// @param coroutine A pointer to a Coroutine, previously started with
+///   coroutineCreate on the calling thread, that has not finished.
+///
+/// @return Returns coroutineSuccess on success, coroutineNomem if the run queue
+/// could not be allocated or grown, coroutineError on any other failure.
+int coroutineSchedule(Coroutine *coroutine) {
+  if ((coroutine == NULL) || (!coroutineResumable(coroutine))) {
+    return coroutineError;
+  }
+
+  CoroutineRunQueue *runQueue = coroutineGetRunQueue();
+  if (runQueue == NULL) {
+    return coroutineNomem;
+  }
+
+  return coroutineRunQueueAdd(runQueue, coroutine);
+}
+
+/// @fn int coroutineRun(void)
+///
+/// @brief Resume the coroutines in the calling thread's run queue until all of
+/// them have finished.  Only coroutines that can make progress are resumed.  A
+/// coroutine that blocks in a comutex, cocondition, or comessage call is
+/// parked until the mutex is unlocked, the condition is signalled, or the
+/// deadline of a timed call passes.  When every coroutine is parked with a
+/// deadline, the thread sleeps until the earliest one.  Values yielded by the
+/// coroutines are discarded.
+///
+/// @return Returns coroutineSuccess when every scheduled coroutine has
+/// finished, coroutineBusy if the coroutines that remain are all blocked
+/// without deadlines and nothing is left that could wake them (they remain
+/// scheduled), or coroutineError if called while coroutineRun is already in
+/// progress on the thread.
+int coroutineRun(void) {
+  CoroutineRunQueue *runQueue = coroutineGetRunQueue();
+  if (runQueue == NULL) {
+    return coroutineNomem;
+  } else if (runQueue->running == true) {
+    return coroutineError;
+  }
+  runQueue->running = true;
+
+  int returnValue = coroutineSuccess;
+  while (1) {
+    bool progress = coroutineRunQueuePass(runQueue);
+
+    if (runQueue->numRunnable > 0) {
+      if (progress == false) {
+        // Something is blocked without going through a comutex or
+        // cocondition, so all we can do is keep checking on it.
+#ifdef THREAD_SAFE_COROUTINES
+        thrd_yield();
+#endif
+      }
+    } else if (runQueue->numParked > 0) {
+      // Everything left is parked.  Nothing can happen until the earliest
+      // deadline.
+      int64_t delay
+        = runQueue->parked[0]->wakeTime - coroutineGetNanoseconds(NULL);
+      if (delay > 0) {
+        struct timespec duration = { 0, 0 };
+        duration.tv_sec = (time_t) (delay / 1000000000LL);
+        duration.tv_nsec = (long) (delay % 1000000000LL);
+#if defined(THREAD_SAFE_COROUTINES)
+        thrd_sleep(&duration, NULL);
+#elif !defined(_WIN32)
+        nanosleep(&duration, NULL);
+#endif // Otherwise, the next pass will just check the deadline again.
+      }
+    } else {
+      if (runQueue->numBlocked > 0) {
+        returnValue = coroutineBusy;
+      }
+      break;
+    }
+  }
+
+  runQueue->running = false;
+  return returnValue;
+}
+
+
+#ifdef THREAD_SAFE_COROUTINES
+// Multi-threaded scheduler support.
+
+/*
+ * A CoroutineScheduler is a fixed pool of worker threads, each of which runs
+ * its own set of coroutines.  Work is submitted as a function and an argument
+ * (a task) that is queued on one of the workers.  Each worker starts tasks from
+ * its own queue as coroutines and round-robins through the coroutines it has
+ * in flight.  When a worker's queue runs dry, it steals half of the waiting
+ * tasks from the first peer it finds that has any.
+ *
+ * Each worker keeps its coroutines in a CoroutineRunQueue, the same structure
+ * used by coroutineRun, so coroutines that block on a comutex, cocondition, or
+ * comessage are parked rather than being resumed every pass just to find out
+ * that they're still blocked.  A worker whose coroutines are all parked sleeps
+ * until the earliest deadline or until new work arrives.
+ *
+ * Only tasks that have not yet started can be stolen.  A coroutine's stack is
+ * carved out of the stack of the thread that created it (see the notes at the
+ * top of this file), so once a task has started as a coroutine, it can only
+ * ever be resumed by the worker that started it.  Coroutines on different
+ * workers run in parallel and must use thread-safe mechanisms (not comutexes,
+ * coconditions, or comessages) to communicate with each other.
+ */
+
+/// @struct CoroutineTask
+///
+/// @brief A unit of work that has been submitted to a CoroutineScheduler but
+/// not yet started as a coroutine.
+///
+/// @param func The function to run as a coroutine.
+/// @param arg The argument to pass to the function.
+/// @param next The next CoroutineTask in the worker's queue.
+typedef struct CoroutineTask {
+  CoroutineFunction func;
+  void *arg;
+  struct CoroutineTask *next;
+} CoroutineTask;
+
+/// @struct CoroutineWorker
+///
+/// @brief The state for one worker thread of a CoroutineScheduler.
+///
+/// @param scheduler A pointer to the CoroutineScheduler that owns the worker.
+/// @param index The index of this worker within the scheduler's workers array.
+/// @param thread The thrd_t of the worker thread.
+/// @param started Whether or not the worker thread was successfully started.
+/// @param lock The mutex that guards the task queue.
+/// @param head The next task to start.
+/// @param tail The most recently submitted task.
+/// @param numTasks The number of tasks in the queue.
+typedef struct CoroutineWorker {
+  struct CoroutineScheduler *scheduler;
+  size_t index;
+  thrd_t thread;
+  bool started;
+  lmtx_t lock;
+  CoroutineTask *head;
+  CoroutineTask *tail;
+  size_t numTasks;
+} CoroutineWorker;
+
+/// @struct CoroutineScheduler
+///
+/// @brief A pool of worker threads that run coroutines.
+///
+/// @param numWorkers The number of elements in the workers array.
+/// @param workers The array of worker thread states.
+/// @param stackSize The size of each coroutine's stack, in bytes.
+/// @param maxCoroutines The maximum number of coroutines in flight per worker.
+/// @param lock The mutex that guards the members below it.
+/// @param condition The condition idle workers wait on for new tasks.
+/// @param pending The number of tasks that have been submitted but have not
+///   yet been taken off of a worker's queue.
+/// @param numIdle The number of workers waiting on the condition.
+/// @param nextWorker The worker to queue the next external submission on.
+/// @param shuttingDown Whether or not coroutineSchedulerDestroy has been
+///   called.
+struct CoroutineScheduler {
+  size_t numWorkers;
+  CoroutineWorker *workers;
+  int stackSize;
+  size_t maxCoroutines;
+  lmtx_t lock;
+  lcnd_t condition;
+  size_t pending;
+  size_t numIdle;
+  size_t nextWorker;
+  bool shuttingDown;
+};
+
+/// @fn static CoroutineTask* coroutineWorkerTakeTasks(CoroutineWorker *worker, bool half)
+///
+/// @brief Remove tasks from the head of a worker's queue.
+///
+/// @param worker A pointer to the CoroutineWorker to remove tasks from.
+/// @param half Whether to remove half of the queued tasks (rounded up, for a
+///   steal) or just one (for the owner).
+///
+/// @return Returns the removed tasks as a NULL-terminated list on success, NULL
+/// if the queue was empty.
+static CoroutineTask* coroutineWorkerTakeTasks(CoroutineWorker *worker,
+  bool half
+) {
+  CoroutineTask *tasks = NULL;
+  size_t numTaken = 0;
+
+  if (lmtx_lock(&worker->lock) != thrd_success) {
+    return NULL;
+  }
+  if (worker->numTasks > 0) {
+    numTaken = (half == true) ? ((worker->numTasks + 1) / 2) : 1;
+    tasks = worker->head;
+    CoroutineTask *last = tasks;
+    for (size_t ii = 1; ii < numTaken; ii++) {
+      last = last->next;
+    }
+    worker->head = last->next;
+    if (worker->head == NULL) {
+      worker->tail = NULL;
+    }
+    last->next = NULL;
+    worker->numTasks -= numTaken;
+  }
+  lmtx_unlock(&worker->lock);
+
+  if (numTaken > 0) {
+    CoroutineScheduler *scheduler = worker->scheduler;
+    lmtx_lock(&scheduler->lock);
+    scheduler->pending -= numTaken;
+    lmtx_unlock(&scheduler->lock);
+  }
+
+  return tasks;
+}
+
+/// @fn static void coroutineWorkerAddTasks(CoroutineWorker *worker, CoroutineTask *tasks)
+///
+/// @brief Append a NULL-terminated list of tasks to a worker's queue.  The
+/// tasks must already be accounted for in the scheduler's pending count.
+///
+/// @param worker A pointer to the CoroutineWorker to add the tasks to.
+/// @param tasks The first task of the list to add.
+///
+/// @return This function returns no value.
+static void coroutineWorkerAddTasks(CoroutineWorker *worker,
+  CoroutineTask *tasks
+) {
+  CoroutineTask *last = tasks;
+  size_t numTasks = 1;
+  while (last->next != NULL) {
+    last = last->next;
+    numTasks++;
+  }
+
+  lmtx_lock(&worker->lock);
+  if (worker->tail != NULL) {
+    worker->tail->next = tasks;
+  } else {
+    worker->head = tasks;
+  }
+  worker->tail = last;
+  worker->numTasks += numTasks;
+  lmtx_unlock(&worker->lock);
+}
+
+/// @fn static CoroutineTask* coroutineWorkerNextTask(CoroutineWorker *worker)
+///
+/// @brief Get the next task for a worker to start, stealing from its peers if
+/// its own queue is empty.
+///
+/// @param worker A pointer to the CoroutineWorker that needs a task.
+///
+/// @return Returns a pointer to the task to start on success, NULL if there
+/// were no tasks available anywhere.
+static CoroutineTask* coroutineWorkerNextTask(CoroutineWorker *worker) {
+  CoroutineTask *task = coroutineWorkerTakeTasks(worker, false);
+  if (task != NULL) {
+    return task;
+  }
+
+  CoroutineScheduler *scheduler = worker->scheduler;
+  for (size_t ii = 1; ii < scheduler->numWorkers; ii++) {
+    CoroutineWorker *victim
+      = &scheduler->workers[(worker->index + ii) % scheduler->numWorkers];
+    CoroutineTask *stolen = coroutineWorkerTakeTasks(victim, true);
+    if (stolen != NULL) {
+      // Keep the first stolen task and queue the rest locally.  They're still
+      // unstarted, so they remain available to be stolen again.
+      task = stolen;
+      if (stolen->next != NULL) {
+        CoroutineTask *rest = stolen->next;
+        task->next = NULL;
+        size_t numRest = 0;
+        for (CoroutineTask *cur = rest; cur != NULL; cur = cur->next) {
+          numRest++;
+        }
+        lmtx_lock(&scheduler->lock);
+        scheduler->pending += numRest;
+        lmtx_unlock(&scheduler->lock);
+        coroutineWorkerAddTasks(worker, rest);
+      }
+      break;
+    }
+  }
+
+  return task;
+}
+
+/// @fn static int coroutineWorkerMain(void *arg)
+///
+/// @brief The main function of a CoroutineScheduler worker thread.
+///
+/// @param arg A pointer to the CoroutineWorker for this thread, cast to a
+///   void*.
+///
+/// @return Returns thrd_success when the scheduler has shut down and all the
+/// worker's coroutines have completed, thrd_error on failure to set up.
+static int coroutineWorkerMain(void *arg) {
+  CoroutineWorker *worker = (CoroutineWorker*) arg;
+  CoroutineScheduler *scheduler = worker->scheduler;
+
+  // Set up this thread's coroutine metadata directly rather than through
+  // coroutineConfig, which would overwrite the process-wide defaults.
+  ZEROINIT(Coroutine first);
+  first.state = COROUTINE_STATE_RUNNING;
+  call_once(&_threadMetadataSetup, coroutineSetupThreadMetadata);
+  if ((!coroutineInitializeThreadMetadata(&first))
+    || (tss_set(_tssStackSize, (void*) ((intptr_t) scheduler->stackSize))
+      != thrd_success)
+  ) {
+    fprintf(stderr, "Could not initialize coroutine scheduler worker %zu.\n",
+      worker->index);
+    return thrd_error;
+  }
+
+  ZEROINIT(CoroutineRunQueue runQueue);
+  runQueue.running = true;
+
+  while (1) {
+    bool progress = false;
+
+    // Start as many new coroutines as we have room for.
+    while (runQueue.numRunnable + runQueue.numParked + runQueue.numBlocked
+      < scheduler->maxCoroutines
+    ) {
+      CoroutineTask *task = coroutineWorkerNextTask(worker);
+      if (task == NULL) {
+        break;
+      }
+      Coroutine *coroutine = NULL;
+      if (coroutineCreate(&coroutine, task->func, task->arg)
+        != coroutineSuccess
+      ) {
+        fprintf(stderr,
+          "Could not start coroutine in coroutineWorkerMain.\n");
+      } else if ((!coroutineFinished(coroutine))
+        && (coroutineRunQueueAdd(&runQueue, coroutine) != coroutineSuccess)
+      ) {
+        // We can't keep track of it, so all we can do is run it to completion
+        // here.
+        while (!coroutineFinished(coroutine)) {
+          coroutineResume(coroutine, NULL);
+        }
+      }
+      free(task);
+      progress = true;
+    }
+
+    // Give every runnable coroutine a turn.
+    if (coroutineRunQueuePass(&runQueue) == true) {
+      progress = true;
+    }
+
+    if ((runQueue.numRunnable == 0) && (runQueue.numParked == 0)) {
+      // Nothing in flight that can make progress on its own and nothing to
+      // steal.  Sleep until there's work or until we're told to exit.  Blocked
+      // coroutines can only be woken by other coroutines on this thread, so
+      // we can't exit while there are any.
+      lmtx_lock(&scheduler->lock);
+      while ((scheduler->pending == 0)
+        && ((scheduler->shuttingDown == false) || (runQueue.numBlocked > 0))
+      ) {
+        scheduler->numIdle++;
+        lcnd_wait(&scheduler->condition, &scheduler->lock);
+        scheduler->numIdle--;
+      }
+      bool done
+        = (scheduler->pending == 0) && (scheduler->shuttingDown == true);
+      lmtx_unlock(&scheduler->lock);
+      if (done == true) {
+        break;
+      }
+    } else if (runQueue.numRunnable == 0) {
+      // Everything in flight is parked.  Sleep until the earliest deadline or
+      // until there's new work.
+      int64_t wakeTime = runQueue.parked[0]->wakeTime;
+      struct timespec deadline = { 0, 0 };
+      deadline.tv_sec = (time_t) (wakeTime / 1000000000LL);
+      deadline.tv_nsec = (long) (wakeTime % 1000000000LL);
+      lmtx_lock(&scheduler->lock);
+      while ((scheduler->pending == 0)
+        && (coroutineGetNanoseconds(NULL) < wakeTime)
+      ) {
+        scheduler->numIdle++;
+        int status = lcnd_timedwait(
+          &scheduler->condition, &scheduler->lock, &deadline);
+        scheduler->numIdle--;
+        if (status != thrd_success) {
+          break;
+        }
+      }
+      lmtx_unlock(&scheduler->lock);
+    } else if (progress == false) {
+      // Everything in flight is blocked.  Let the other threads run.
+      thrd_yield();
+    }
+  }
+
+  free(runQueue.runnable);
+  free(runQueue.parked);
+  return thrd_success;
+}
+
+/// @fn CoroutineScheduler* coroutineSchedulerCreate(size_t numWorkers, int stackSize, size_t maxCoroutines)
+///
+/// @brief Create a pool of worker threads that run submitted tasks as
+/// coroutines.  Threading support for coroutines is enabled as a side effect.
+///
+/// @param numWorkers The number of worker threads to start.  Must be at least
+///   one.
+/// @param stackSize The desired minimum size of each coroutine's stack, in
+///   bytes.  If this value is less than COROUTINE_STACK_CHUNK_SIZE,
+///   COROUTINE_DEFAULT_STACK_SIZE will be used.
+/// @param maxCoroutines The maximum number of coroutines each worker will have
+///   in flight at once.  If this value is 0,
+///   COROUTINE_SCHEDULER_DEFAULT_MAX_COROUTINES will be used.
+///
+/// @return Returns a pointer to the new CoroutineScheduler on success, NULL on
+/// failure.
+CoroutineScheduler* coroutineSchedulerCreate(size_t numWorkers,
+  int stackSize, size_t maxCoroutines
+) {
+  if (numWorkers == 0) {
+    return NULL;
+  }
+  if (stackSize < COROUTINE_STACK_CHUNK_SIZE) {
+    stackSize = COROUTINE_DEFAULT_STACK_SIZE;
+  }
+  if (maxCoroutines == 0) {
+    maxCoroutines = COROUTINE_SCHEDULER_DEFAULT_MAX_COROUTINES;
+  }
+
+  CoroutineScheduler *scheduler
+    = (CoroutineScheduler*) calloc(1, sizeof(CoroutineScheduler));
+  if (scheduler == NULL) {
+    return NULL;
+  }
+  scheduler->workers
+    = (CoroutineWorker*) calloc(numWorkers, sizeof(CoroutineWorker));
+  if (scheduler->workers == NULL) {
+    free(scheduler);
+    return NULL;
+  }
+  scheduler->stackSize = stackSize;
+  scheduler->maxCoroutines = maxCoroutines;
+  if (lmtx_init(&scheduler->lock) != thrd_success) {
+    free(scheduler->workers);
+    free(scheduler);
+    return NULL;
+  }
+  if (lcnd_init(&scheduler->condition) != thrd_success) {
+    lmtx_destroy(&scheduler->lock);
+    free(scheduler->workers);
+    free(scheduler);
+    return NULL;
+  }
+  for (size_t ii = 0; ii < numWorkers; ii++) {
+    CoroutineWorker *worker = &scheduler->workers[ii];
+    worker->scheduler = scheduler;
+    worker->index = ii;
+    if (lmtx_init(&worker->lock) != thrd_success) {
+      coroutineSchedulerDestroy(scheduler);
+      return NULL;
+    }
+    scheduler->numWorkers++;
+  }
+
+  coroutineSetThreadingSupportEnabled(true);
+  for (size_t ii = 0; ii < numWorkers; ii++) {
+    CoroutineWorker *worker = &scheduler->workers[ii];
+    if (thrd_create(&worker->thread, coroutineWorkerMain, worker)
+      != thrd_success
+    ) {
+      coroutineSchedulerDestroy(scheduler);
+      return NULL;
+    }
+    worker->started = true;
+  }
+
+  return scheduler;
+}
+
+/// @fn int coroutineSchedulerSubmit(CoroutineScheduler *scheduler, CoroutineFunction func, void *arg)
+///
+/// @brief Queue a function to be run as a coroutine by one of a scheduler's
+/// worker threads.  Tasks submitted from a worker thread are queued on that
+/// worker.  Tasks submitted from anywhere else are distributed round-robin.
+/// The function's return value is discarded.
+///
+/// @param scheduler A pointer to the CoroutineScheduler to submit to.
+/// @param func The function to run as a coroutine.
+/// @param arg The argument to pass to the function.
+///
+/// @return Returns coroutineSuccess on success, coroutineNomem if the task
+/// could not be allocated, coroutineError on any other failure.
+int coroutineSchedulerSubmit(CoroutineScheduler *scheduler,
+  CoroutineFunction func, void *arg
+) {
+  if ((scheduler == NULL) || (func == NULL)) {
+    return coroutineError;
+  }
+
+  CoroutineTask *task = (CoroutineTask*) malloc(sizeof(CoroutineTask));
+  if (task == NULL) {
+    return coroutineNomem;
+  }
+  task->func = func;
+  task->arg = arg;
+  task->next = NULL;
+
+  CoroutineWorker *worker = NULL;
+  thrd_t current = thrd_current();
+  for (size_t ii = 0; ii < scheduler->numWorkers; ii++) {
+    if (thrd_equal(scheduler->workers[ii].thread, current)) {
+      worker = &scheduler->workers[ii];
+      break;
+    }
+  }
+
+  lmtx_lock(&scheduler->lock);
+  if ((scheduler->shuttingDown == true) && (worker == NULL)) {
+    // Tasks that are still running may keep submitting work while the
+    // scheduler drains, but nobody else may.
+    lmtx_unlock(&scheduler->lock);
+    free(task);
+    return coroutineError;
+  }
+  if (worker == NULL) {
+    worker = &scheduler->workers[scheduler->nextWorker];
+    scheduler->nextWorker
+      = (scheduler->nextWorker + 1) % scheduler->numWorkers;
+  }
+  scheduler->pending++;
+  lmtx_unlock(&scheduler->lock);
+
+  coroutineWorkerAddTasks(worker, task);
+
+  lmtx_lock(&scheduler->lock);
+  if (scheduler->numIdle > 0) {
+    lcnd_signal(&scheduler->condition);
+  }
+  lmtx_unlock(&scheduler->lock);
+
+  return coroutineSuccess;
+}
+
+/// @fn int coroutineSchedulerDestroy(CoroutineScheduler *scheduler)
+///
+/// @brief Stop accepting new tasks from outside the scheduler, wait for every
+/// task that has been submitted (including those submitted by running tasks in
+/// the meantime) to run to completion, stop the worker threads, and free the
+/// scheduler.  Must not be called from one of the scheduler's own workers.
+///
+/// @param scheduler A pointer to the CoroutineScheduler to destroy.
+///
+/// @return Returns coroutineSuccess on success, coroutineError on failure.
+int coroutineSchedulerDestroy(CoroutineScheduler *scheduler) {
+  if (scheduler == NULL) {
+    return coroutineError;
+  }
+
+  lmtx_lock(&scheduler->lock);
+  scheduler->shuttingDown = true;
+  lcnd_broadcast(&scheduler->condition);
+  lmtx_unlock(&scheduler->lock);
+
+  int returnValue = coroutineSuccess;
+  for (size_t ii = 0; ii < scheduler->numWorkers; ii++) {
+    CoroutineWorker *worker = &scheduler->workers[ii];
+    if (worker->started == true) {
+      int workerStatus = thrd_success;
+      if ((thrd_join(worker->thread, &workerStatus) != thrd_success)
+        || (workerStatus != thrd_success)
+      ) {
+        returnValue = coroutineError;
+      }
+    }
+    lmtx_destroy(&worker->lock);
+  }
+
+  lcnd_destroy(&scheduler->condition);
+  lmtx_destroy(&scheduler->lock);
+  free(scheduler->workers);
+  free(scheduler);
+
+  return returnValue;
+}
+
+#endif // THREAD_SAFE_COROUTINES
+
@@ -30,6 +30,7 @@
 
 #include "DataTypes.h"
 #include "StringLib.h"
+#include <time.h>
 #ifdef DS_LOGGING_ENABLED
 #include "LoggingLib.h"
 #else
@@ -63,8 +64,10 @@ u16 DsMarker = 0x4ABC;
 /// @var DsVersion
 ///
 /// @brief Version information for data structures in to/from bytearray
-/// functions to determine how to parse them.
-u32 DsVersion = 10;
+/// functions to determine how to parse them.  Version 11 appends an offset
+/// index to version 10's entries so that the array can be searched in place.
+/// The *FromBlob functions still accept version 10 arrays.
+u32 DsVersion = 11;
 
 /// @var boolNames
 ///
@@ -663,6 +666,44 @@ void* boolFromBlob(const volatile void *value, u64 *length, bool inPlaceData, bo
   return returnValue;
 }
 
+/// @def PRIMITIVE_TO_BLOB_BUFFER
+///
+/// @brief Define the blobSize and toBlobBuffer functions of a fixed-size
+/// primitive type.  The bytes written are the same ones type##ToBlob produces.
+///
+/// @param type The name of the primitive type.
+/// @param swapBytes Whether type##ToBlob stores the value in little endian
+///   byte order.
+#define PRIMITIVE_TO_BLOB_BUFFER(type, swapBytes) \
+/** @fn static u64 type##ToBlobSize(const volatile void *value) */ \
+/** */ \
+/** @brief Get the number of bytes type##ToBlob produces for a value. */ \
+/** */ \
+/** @return Returns sizeof(type), or 0 if value is NULL. */ \
+static u64 type##ToBlobSize(const volatile void *value) { \
+  return (value != NULL) ? sizeof(type) : 0; \
+} \
+ \
+/** @fn static u64 type##ToBlobBuffer(const volatile void *value, void *buffer, u64 bufferSize) */ \
+/** */ \
+/** @brief Encode a value the way type##ToBlob does, directly into a buffer. */ \
+/** */ \
+/** @return Returns the number of bytes written, 0 on failure. */ \
+static u64 type##ToBlobBuffer(const volatile void *value, void *buffer, \
+  u64 bufferSize \
+) { \
+  if ((value == NULL) || (buffer == NULL) || (bufferSize < sizeof(type))) { \
+    return 0; \
+  } \
+  memcpy(buffer, (const void*) value, sizeof(type)); \
+  if (swapBytes) { \
+    hostToLittleEndian(buffer, sizeof(type)); \
+  } \
+  return sizeof(type); \
+}
+
+PRIMITIVE_TO_BLOB_BUFFER(bool, false)
+
 /// @var typeBool
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -684,6 +725,9 @@ TypeDescriptor _typeBool = {
   .clear         = clearBool,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = boolToBlobSize,
+  .toBlobBuffer  = boolToBlobBuffer,
 };
 TypeDescriptor *typeBool = &_typeBool;
 
@@ -708,6 +752,9 @@ TypeDescriptor _typeBoolNoCopy = {
   .clear         = clearBool,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = boolToBlobSize,
+  .toBlobBuffer  = boolToBlobBuffer,
 };
 TypeDescriptor *typeBoolNoCopy = &_typeBoolNoCopy;
 
@@ -998,6 +1045,8 @@ void* u8FromBlob(const volatile void *value, u64 *length, bool inPlaceData, bool
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(u8, false)
+
 /// @var typeU8
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -1019,6 +1068,9 @@ TypeDescriptor _typeU8 = {
   .clear         = clear8,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = u8ToBlobSize,
+  .toBlobBuffer  = u8ToBlobBuffer,
 };
 TypeDescriptor *typeU8 = &_typeU8;
 
@@ -1043,6 +1095,9 @@ TypeDescriptor _typeU8NoCopy = {
   .clear         = clear8,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = u8ToBlobSize,
+  .toBlobBuffer  = u8ToBlobBuffer,
 };
 TypeDescriptor *typeU8NoCopy = &_typeU8NoCopy;
 
@@ -1149,7 +1204,7 @@ int u16Compare(const volatile void *valueA, const volatile void *valueB) {
       valueB, returnValue);
     return returnValue;
   }
-
+  
   u16 u16ValueA = *((u16*) valueA);
   u16 u16ValueB = *((u16*) valueB);
   
@@ -1337,6 +1392,8 @@ void* u16FromBlob(const volatile void *value, u64 *length, bool inPlaceData, boo
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(u16, true)
+
 /// @var typeU16
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -1358,6 +1415,9 @@ TypeDescriptor _typeU16 = {
   .clear         = clear16,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = u16ToBlobSize,
+  .toBlobBuffer  = u16ToBlobBuffer,
 };
 TypeDescriptor *typeU16 = &_typeU16;
 
@@ -1382,6 +1442,9 @@ TypeDescriptor _typeU16NoCopy = {
   .clear         = clear16,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = u16ToBlobSize,
+  .toBlobBuffer  = u16ToBlobBuffer,
 };
 TypeDescriptor *typeU16NoCopy = &_typeU16NoCopy;
 
@@ -1674,6 +1737,8 @@ void* u32FromBlob(const volatile void *value, u64 *length, bool inPlaceData, boo
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(u32, true)
+
 /// @var typeU32
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -1695,6 +1760,9 @@ TypeDescriptor _typeU32 = {
   .clear         = clear32,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = u32ToBlobSize,
+  .toBlobBuffer  = u32ToBlobBuffer,
 };
 TypeDescriptor *typeU32 = &_typeU32;
 
@@ -1719,6 +1787,9 @@ TypeDescriptor _typeU32NoCopy = {
   .clear         = clear32,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = u32ToBlobSize,
+  .toBlobBuffer  = u32ToBlobBuffer,
 };
 TypeDescriptor *typeU32NoCopy = &_typeU32NoCopy;
 
@@ -1824,7 +1895,7 @@ int u64Compare(const volatile void *valueA, const volatile void *valueB) {
       valueB, returnValue);
     return returnValue;
   }
-
+  
   u64 u64ValueA = *((u64*) valueA);
   u64 u64ValueB = *((u64*) valueB);
   
@@ -2010,6 +2081,8 @@ void* u64FromBlob(const volatile void *value, u64 *length, bool inPlaceData, boo
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(u64, true)
+
 /// @var typeU64
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -2031,6 +2104,9 @@ TypeDescriptor _typeU64 = {
   .clear         = clear64,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = u64ToBlobSize,
+  .toBlobBuffer  = u64ToBlobBuffer,
 };
 TypeDescriptor *typeU64 = &_typeU64;
 
@@ -2055,6 +2131,9 @@ TypeDescriptor _typeU64NoCopy = {
   .clear         = clear64,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = u64ToBlobSize,
+  .toBlobBuffer  = u64ToBlobBuffer,
 };
 TypeDescriptor *typeU64NoCopy = &_typeU64NoCopy;
 
@@ -2159,7 +2238,7 @@ int u128Compare(const volatile void *valueA, const volatile void *valueB) {
       valueB, returnValue);
     return returnValue;
   }
-
+  
   u128 u128ValueA = *((u128*) valueA);
   u128 u128ValueB = *((u128*) valueB);
   
@@ -2344,6 +2423,8 @@ void* u128FromBlob(const volatile void *value, u64 *length, bool inPlaceData, bo
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(u128, true)
+
 /// @var typeU128
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -2365,6 +2446,9 @@ TypeDescriptor _typeU128 = {
   .clear         = clear128,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = u128ToBlobSize,
+  .toBlobBuffer  = u128ToBlobBuffer,
 };
 TypeDescriptor *typeU128 = &_typeU128;
 
@@ -2389,6 +2473,9 @@ TypeDescriptor _typeU128NoCopy = {
   .clear         = clear128,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = u128ToBlobSize,
+  .toBlobBuffer  = u128ToBlobBuffer,
 };
 TypeDescriptor *typeU128NoCopy = &_typeU128NoCopy;
 
@@ -2702,6 +2789,8 @@ void* i8FromBlob(const volatile void *value, u64 *length, bool inPlaceData, bool
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(i8, false)
+
 /// @var typeI8
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -2723,6 +2812,9 @@ TypeDescriptor _typeI8 = {
   .clear         = clear8,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = i8ToBlobSize,
+  .toBlobBuffer  = i8ToBlobBuffer,
 };
 TypeDescriptor *typeI8 = &_typeI8;
 
@@ -2747,6 +2839,9 @@ TypeDescriptor _typeI8NoCopy = {
   .clear         = clear8,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = i8ToBlobSize,
+  .toBlobBuffer  = i8ToBlobBuffer,
 };
 TypeDescriptor *typeI8NoCopy = &_typeI8NoCopy;
 
@@ -3060,6 +3155,8 @@ void* i16FromBlob(const volatile void *value, u64 *length, bool inPlaceData, boo
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(i16, true)
+
 /// @var typeI16
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -3081,6 +3178,9 @@ TypeDescriptor _typeI16 = {
   .clear         = clear16,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = i16ToBlobSize,
+  .toBlobBuffer  = i16ToBlobBuffer,
 };
 TypeDescriptor *typeI16 = &_typeI16;
 
@@ -3105,6 +3205,9 @@ TypeDescriptor _typeI16NoCopy = {
   .clear         = clear16,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = i16ToBlobSize,
+  .toBlobBuffer  = i16ToBlobBuffer,
 };
 TypeDescriptor *typeI16NoCopy = &_typeI16NoCopy;
 
@@ -3419,6 +3522,8 @@ void* i32FromBlob(const volatile void *value, u64 *length, bool inPlaceData, boo
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(i32, true)
+
 /// @var typeI32
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -3440,6 +3545,9 @@ TypeDescriptor _typeI32 = {
   .clear         = clear32,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = i32ToBlobSize,
+  .toBlobBuffer  = i32ToBlobBuffer,
 };
 TypeDescriptor *typeI32 = &_typeI32;
 
@@ -3464,6 +3572,9 @@ TypeDescriptor _typeI32NoCopy = {
   .clear         = clear32,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = i32ToBlobSize,
+  .toBlobBuffer  = i32ToBlobBuffer,
 };
 TypeDescriptor *typeI32NoCopy = &_typeI32NoCopy;
 
@@ -3777,6 +3888,8 @@ void* i64FromBlob(const volatile void *value, u64 *length, bool inPlaceData, boo
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(i64, true)
+
 /// @var typeI64
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -3798,6 +3911,9 @@ TypeDescriptor _typeI64 = {
   .clear         = clear64,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = i64ToBlobSize,
+  .toBlobBuffer  = i64ToBlobBuffer,
 };
 TypeDescriptor *typeI64 = &_typeI64;
 
@@ -3822,6 +3938,9 @@ TypeDescriptor _typeI64NoCopy = {
   .clear         = clear64,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = i64ToBlobSize,
+  .toBlobBuffer  = i64ToBlobBuffer,
 };
 TypeDescriptor *typeI64NoCopy = &_typeI64NoCopy;
 
@@ -4133,6 +4252,8 @@ void* i128FromBlob(const volatile void *value, u64 *length, bool inPlaceData, bo
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(i128, true)
+
 /// @var typeI128
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -4154,6 +4275,9 @@ TypeDescriptor _typeI128 = {
   .clear         = clear128,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = i128ToBlobSize,
+  .toBlobBuffer  = i128ToBlobBuffer,
 };
 TypeDescriptor *typeI128 = &_typeI128;
 
@@ -4178,6 +4302,9 @@ TypeDescriptor _typeI128NoCopy = {
   .clear         = clear128,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = i128ToBlobSize,
+  .toBlobBuffer  = i128ToBlobBuffer,
 };
 TypeDescriptor *typeI128NoCopy = &_typeI128NoCopy;
 
@@ -4461,6 +4588,8 @@ void* floatFromBlob(const volatile void *value, u64 *length, bool inPlaceData, b
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(float, false)
+
 /// @var typeFloat
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -4482,6 +4611,9 @@ TypeDescriptor _typeFloat = {
   .clear         = clearFloat,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = floatToBlobSize,
+  .toBlobBuffer  = floatToBlobBuffer,
 };
 TypeDescriptor *typeFloat = &_typeFloat;
 
@@ -4506,6 +4638,9 @@ TypeDescriptor _typeFloatNoCopy = {
   .clear         = clearFloat,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = floatToBlobSize,
+  .toBlobBuffer  = floatToBlobBuffer,
 };
 TypeDescriptor *typeFloatNoCopy = &_typeFloatNoCopy;
 
@@ -4789,6 +4924,8 @@ void* doubleFromBlob(const volatile void *value, u64 *length, bool inPlaceData,
   return returnValue;
 }
 
+PRIMITIVE_TO_BLOB_BUFFER(double, false)
+
 /// @var typeDouble
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -4810,6 +4947,9 @@ TypeDescriptor _typeDouble = {
   .clear         = clearDouble,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = doubleToBlobSize,
+  .toBlobBuffer  = doubleToBlobBuffer,
 };
 TypeDescriptor *typeDouble = &_typeDouble;
 
@@ -4834,6 +4974,9 @@ TypeDescriptor _typeDoubleNoCopy = {
   .clear         = clearDouble,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = doubleToBlobSize,
+  .toBlobBuffer  = doubleToBlobBuffer,
 };
 TypeDescriptor *typeDoubleNoCopy = &_typeDoubleNoCopy;
 
@@ -5126,6 +5269,9 @@ TypeDescriptor _typeLongDouble = {
   .clear         = clearLongDouble,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = NULL,
+  .toBlobBuffer  = NULL,
 };
 TypeDescriptor *typeLongDouble = &_typeLongDouble;
 
@@ -5150,6 +5296,9 @@ TypeDescriptor _typeLongDoubleNoCopy = {
   .clear         = clearLongDouble,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = NULL,
+  .toBlobBuffer  = NULL,
 };
 TypeDescriptor *typeLongDoubleNoCopy = &_typeLongDoubleNoCopy;
 
@@ -5330,6 +5479,39 @@ Bytes stringToBlob(const volatile void *value) {
   return returnValue;
 }
 
+/// @fn static u64 stringToBlobSize(const volatile void *value)
+///
+/// @brief Get the number of bytes stringToBlob produces for a string.
+///
+/// @param value A pointer to the string value to size.
+///
+/// @return Returns the length of the string plus its NULL terminator, or 0
+/// if value is NULL.
+static u64 stringToBlobSize(const volatile void *value) {
+  return (value != NULL) ? strlen((const char*) value) + 1 : 0;
+}
+
+/// @fn static u64 stringToBlobBuffer(const volatile void *value, void *buffer, u64 bufferSize)
+///
+/// @brief Encode a string the way stringToBlob does, directly into a buffer.
+///
+/// @param value A pointer to the string value to encode.
+/// @param buffer The memory to encode the string into.
+/// @param bufferSize The number of bytes available at buffer.
+///
+/// @return Returns the number of bytes written, 0 on failure.
+static u64 stringToBlobBuffer(const volatile void *value, void *buffer,
+  u64 bufferSize
+) {
+  u64 size = stringToBlobSize(value);
+  if ((size == 0) || (buffer == NULL) || (bufferSize < size)) {
+    return 0;
+  }
+  
+  memcpy(buffer, (const void*) value, size);
+  return size;
+}
+
 /// @fn void* stringFromBlob(const volatile void *value, u64 *length, bool inPlaceData, bool disableThreadSafety)
 ///
 /// @brief Convert a string value to an array of bytes.
@@ -5373,44 +5555,302 @@ void* stringFromBlob(const volatile void *value, u64 *length, bool inPlaceData,
   return returnValue;
 }
 
-/// @fn u64 stringHashFunction(const volatile void *value)
+/// @def HASH_PRIME_0
+///
+/// @brief The first of the four odd 64-bit constants used by hashMemory.
+#define HASH_PRIME_0 0xa0761d6478bd642fULL
+
+/// @def HASH_PRIME_1
+///
+/// @brief The second of the four odd 64-bit constants used by hashMemory.
+#define HASH_PRIME_1 0xe7037ed1a0b428dbULL
+
+/// @def HASH_PRIME_2
+///
+/// @brief The third of the four odd 64-bit constants used by hashMemory.
+#define HASH_PRIME_2 0x8ebc6af09c88c6e3ULL
+
+/// @def HASH_PRIME_3
+///
+/// @brief The fourth of the four odd 64-bit constants used by hashMemory.
+#define HASH_PRIME_3 0x589965cc75374cc3ULL
+
+/// @fn static inline u64 hashMix(u64 a, u64 b)
+///
+/// @brief Multiply two 64-bit values into a 128-bit product and fold the
+/// upper half of the product into the lower half.
+///
+/// @param a The first value to mix.
+/// @param b The second value to mix.
+///
+/// @return Returns the high 64 bits of a * b XORed with the low 64 bits.
+static inline u64 hashMix(u64 a, u64 b) {
+#if defined(__SIZEOF_INT128__)
+  __uint128_t product = ((__uint128_t) a) * b;
+  return ((u64) product) ^ ((u64) (product >> 64));
+#else
+  // Portable 64x64 -> 128 multiplication from 32-bit halves.
+  u64 aHigh = a >> 32, aLow = (u32) a;
+  u64 bHigh = b >> 32, bLow = (u32) b;
+  u64 highHigh = aHigh * bHigh, highLow = aHigh * bLow;
+  u64 lowHigh = aLow * bHigh, lowLow = aLow * bLow;
+  u64 middle = (lowLow >> 32) + ((u32) highLow) + ((u32) lowHigh);
+  u64 low = (middle << 32) | ((u32) lowLow);
+  u64 high = highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+  return low ^ high;
+#endif
+}
+
+/// @fn static inline u64 hashFoldCase(u64 word)
+///
+/// @brief Convert every lower-case ASCII letter in an 8-byte word to upper
+/// case without looking at the bytes individually.
+///
+/// @details For each byte, adding 0x80 - 'a' to its low seven bits sets the
+/// byte's high bit if the byte is >= 'a' and adding 0x80 - 'z' - 1 sets it if
+/// the byte is > 'z'.  Bytes that had their high bit set to begin with are
+/// not ASCII and are left alone.  Subtracting 0x20 from the remaining bytes
+/// is the same as clearing the 0x20 bit, which is one XOR.
+///
+/// @param word The 8 bytes to convert.
+///
+/// @return Returns the word with all of its lower-case ASCII letters
+/// converted to upper case.
+static inline u64 hashFoldCase(u64 word) {
+  u64 heptets = word & 0x7f7f7f7f7f7f7f7fULL;
+  u64 atLeastA = heptets + 0x1f1f1f1f1f1f1f1fULL;
+  u64 aboveZ = heptets + 0x0505050505050505ULL;
+  u64 isLower = atLeastA & ~aboveZ & ~word & 0x8080808080808080ULL;
+  return word ^ (isLower >> 2);
+}
+
+/// @fn static inline u64 hashRead8(const u8 *data, bool foldCase)
+///
+/// @brief Read 8 bytes of unaligned data as a single word.
+///
+/// @param data A pointer to the first byte to read.
+/// @param foldCase Whether or not to convert lower-case ASCII letters to
+///   upper case.
+///
+/// @return Returns the bytes read as a u64.
+static inline u64 hashRead8(const u8 *data, bool foldCase) {
+  u64 word = 0;
+  memcpy(&word, data, sizeof(word));
+  return (foldCase == false) ? word : hashFoldCase(word);
+}
+
+/// @fn static inline u64 hashRead4(const u8 *data, bool foldCase)
+///
+/// @brief Read 4 bytes of unaligned data as a single word.
+///
+/// @param data A pointer to the first byte to read.
+/// @param foldCase Whether or not to convert lower-case ASCII letters to
+///   upper case.
+///
+/// @return Returns the bytes read as a u64.
+static inline u64 hashRead4(const u8 *data, bool foldCase) {
+  u32 word = 0;
+  memcpy(&word, data, sizeof(word));
+  return (foldCase == false) ? word : hashFoldCase(word);
+}
+
+/// @fn static u64 hashMemory_(const u8 *data, u64 length, u64 seed, bool foldCase)
+///
+/// @brief Common implementation of hashMemory and hashMemoryCi.
+///
+/// @details This is a variant of wyhash (https://github.com/wangyi-fudan/wyhash).
+/// Input is consumed a word at a time.  Inputs of 16 bytes or fewer are read
+/// with overlapping loads so that there are no per-byte loops at all.  Longer
+/// inputs are consumed 48 bytes at a time in three independent lanes that the
+/// processor can execute in parallel, and the remainder 16 bytes at a time.
+///
+/// @param data A pointer to the memory to hash.
+/// @param length The number of bytes at data to hash.
+/// @param seed The seed for the hash.
+/// @param foldCase Whether or not to hash lower-case ASCII letters as their
+///   upper-case equivalents.
+///
+/// @return Returns the 64-bit hash of the memory.
+static u64 hashMemory_(const u8 *data, u64 length, u64 seed, bool foldCase) {
+  u64 a = 0, b = 0;
+  
+  seed ^= hashMix(seed ^ HASH_PRIME_0, HASH_PRIME_1);
+  if (length <= 16) {
+    if (length >= 4) {
+      u64 offset = (length >> 3) << 2;
+      a = (hashRead4(data, foldCase) << 32)
+        | hashRead4(data + offset, foldCase);
+      b = (hashRead4(data + length - 4, foldCase) << 32)
+        | hashRead4(data + length - 4 - offset, foldCase);
+    } else if (length > 0) {
+      a = (((u64) data[0]) << 16) | (((u64) data[length >> 1]) << 8)
+        | data[length - 1];
+      if (foldCase == true) {
+        a = hashFoldCase(a);
+      }
+    }
+  } else {
+    u64 remaining = length;
+    if (remaining > 48) {
+      u64 seed1 = seed, seed2 = seed;
+      do {
+        seed = hashMix(hashRead8(data, foldCase) ^ HASH_PRIME_1,
+          hashRead8(data + 8, foldCase) ^ seed);
+        seed1 = hashMix(hashRead8(data + 16, foldCase) ^ HASH_PRIME_2,
+          hashRead8(data + 24, foldCase) ^ seed1);
+        seed2 = hashMix(hashRead8(data + 32, foldCase) ^ HASH_PRIME_3,
+          hashRead8(data + 40, foldCase) ^ seed2);
+        data += 48;
+        remaining -= 48;
+      } while (remaining > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (remaining > 16) {
+      seed = hashMix(hashRead8(data, foldCase) ^ HASH_PRIME_1,
+        hashRead8(data + 8, foldCase) ^ seed);
+      data += 16;
+      remaining -= 16;
+    }
+    // The last 16 bytes always overlap what came before, so there's no tail.
+    a = hashRead8(data + remaining - 16, foldCase);
+    b = hashRead8(data + remaining - 8, foldCase);
+  }
+  
+  a ^= HASH_PRIME_1;
+  b ^= seed;
+  a = hashMix(a, b);
+  return hashMix(a ^ HASH_PRIME_0 ^ length, b ^ HASH_PRIME_1);
+}
+
+/// @fn u64 hashMemory(const volatile void *data, u64 length, u64 seed)
+///
+/// @brief Compute a seeded 64-bit hash of an arbitrary block of memory.  This
+/// is the default hash used by the hash table logic for any type that does not
+/// provide its own hashFunction.
+///
+/// @param data A pointer to the memory to hash.  Need not be aligned.
+/// @param length The number of bytes at data to hash.
+/// @param seed The seed for the hash.  Different seeds produce unrelated hash
+///   values for the same data.
+///
+/// @return Returns the 64-bit hash of the memory.
+u64 hashMemory(const volatile void *data, u64 length, u64 seed) {
+  if ((data == NULL) || (length == 0)) {
+    return hashMemory_(NULL, 0, seed, false);
+  }
+  
+  return hashMemory_((const u8*) data, length, seed, false);
+}
+
+/// @fn u64 hashMemoryCi(const volatile void *data, u64 length, u64 seed)
+///
+/// @brief Compute a seeded 64-bit hash of an arbitrary block of memory in
+/// which lower-case ASCII letters hash the same as their upper-case
+/// equivalents.
+///
+/// @param data A pointer to the memory to hash.  Need not be aligned.
+/// @param length The number of bytes at data to hash.
+/// @param seed The seed for the hash.
+///
+/// @return Returns the 64-bit case-insensitive hash of the memory.
+u64 hashMemoryCi(const volatile void *data, u64 length, u64 seed) {
+  if ((data == NULL) || (length == 0)) {
+    return hashMemory_(NULL, 0, seed, true);
+  }
+  
+  return hashMemory_((const u8*) data, length, seed, true);
+}
+
+/// @var _hashSeedSetup
+///
+/// @brief once_flag to make sure we only initialize the hash seed state once.
+static once_flag _hashSeedSetup = ONCE_FLAG_INIT;
+
+/// @var _hashSeedMutex
+///
+/// @brief Mutex to guard _hashSeedState.
+ZEROINIT(static mtx_t _hashSeedMutex);
+
+/// @var _hashSeedState
+///
+/// @brief The state of the generator used by hashCreateSeed.
+static u64 _hashSeedState = 0;
+
+/// @fn static void hashSeedSetup(void)
+///
+/// @brief Initialize the state of the hash seed generator from values that
+/// vary from one run of the program to the next.
+///
+/// @return This function returns no value.
+static void hashSeedSetup(void) {
+  if (mtx_init(&_hashSeedMutex, mtx_plain) != thrd_success) {
+    fprintf(stderr, "Could not initialize _hashSeedMutex.\n");
+  }
+  
+  ZEROINIT(struct timespec now);
+  timespec_get(&now, TIME_UTC);
+  u64 stackAddress = (u64) ((intptr_t) &now);
+  u64 codeAddress = (u64) ((intptr_t) &hashSeedSetup);
+  
+  _hashSeedState = hashMix(((u64) now.tv_sec) ^ HASH_PRIME_0,
+    ((u64) now.tv_nsec) ^ HASH_PRIME_1);
+  _hashSeedState = hashMix(_hashSeedState ^ stackAddress,
+    codeAddress ^ ((u64) clock()) ^ HASH_PRIME_2);
+}
+
+/// @fn u64 hashCreateSeed(void)
+///
+/// @brief Get a new seed for a hash table.
+///
+/// @details Keys that come from outside the program (request headers, for
+/// example) can be chosen by an attacker to all land in the same bucket of a
+/// table with a known hash function.  Giving each table its own
+/// unpredictable seed makes such keys impossible to construct in advance.
+/// The generator is a wyrand sequence whose starting point is derived from the
+/// time and from the (randomized) addresses of the process.  It is not
+/// suitable for cryptography.
+///
+/// @return Returns a new 64-bit seed.
+u64 hashCreateSeed(void) {
+  call_once(&_hashSeedSetup, hashSeedSetup);
+  
+  if (mtx_lock(&_hashSeedMutex) != thrd_success) {
+    printLog(WARN, "Could not lock _hashSeedMutex.\n");
+  }
+  _hashSeedState += HASH_PRIME_0;
+  u64 seed = hashMix(_hashSeedState, _hashSeedState ^ HASH_PRIME_1);
+  mtx_unlock(&_hashSeedMutex);
+  
+  return seed;
+}
+
+/// @fn u64 stringHashFunction(const volatile void *value, u64 seed)
 ///
-/// @brief Specialized hash function for strings.  This is the same algorithm
-/// as is in HashTable.c, and indeed we could just use that.  However, that
-/// relies on calling typeString->size, which calls strlen, which, of course
-/// itereates through the whole string until the NULL terminator is found to
-/// compute the size of the string.  This means that we go through the string
-/// TWICE when computing the hash this way.  That's inefficient, so we have a
-/// custom algorithm that just goes through it once.
+/// @brief Specialized hash function for strings.  The length of the string is
+/// found with strlen, which the C library implements a vector at a time, and
+/// the characters are then hashed in place with hashMemory.  This avoids
+/// building a blob of the string just to hash it.
 ///
 /// @param value The string to be hashed.
+/// @param seed The seed for the hash.
 ///
-/// @return Returns a register-width integer repsresenting the case-insensitive
-/// hash of the string.
-u64 stringHashFunction(const volatile void *value) {
-  printLog(TRACE, "ENTER stringHashFunction(value=%p)\n", value);
+/// @return Returns a register-width integer repsresenting the hash of the
+/// string.
+u64 stringHashFunction(const volatile void *value, u64 seed) {
+  printLog(TRACE, "ENTER stringHashFunction(value=%p, seed=%llu)\n",
+    value, llu(seed));
   
   if (value == NULL) {
-    printLog(TRACE, "EXIT stringHashFunction(value=%p) = {%llu}\n",
-      value, 0ULL);
+    printLog(TRACE, "EXIT stringHashFunction(value=%p, seed=%llu) = {%llu}\n",
+      value, llu(seed), 0ULL);
     return 0;
   }
   
   const char *key = (const char*) value;
-  u64 hash = 0;
-  
-  for (u64 i = 0; key[i] != '\0'; i++) {
-    hash += key[i];
-    hash += hash << 10;
-    hash ^= hash >> 6;
-  }
-   
-  hash += hash << 3;
-  hash ^= hash >> 11;
-  hash += hash << 15;
+  u64 hash = hashMemory(key, strlen(key), seed);
   
-  printLog(TRACE, "EXIT stringHashFunction(value=\"%s\") = {%llu}\n",
-    str(value), llu(hash));
+  printLog(TRACE, "EXIT stringHashFunction(value=\"%s\", seed=%llu) = {%llu}\n",
+    str(value), llu(seed), llu(hash));
   return hash;
 }
 
@@ -5435,6 +5875,9 @@ TypeDescriptor _typeString = {
   .clear         = clearString,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = stringToBlobSize,
+  .toBlobBuffer  = stringToBlobBuffer,
 };
 TypeDescriptor *typeString = &_typeString;
 
@@ -5453,44 +5896,32 @@ int _strcmpci(const volatile void *valueA, const volatile void *valueB) {
   return strcmpci((const char*) valueA, (const char*) valueB);
 }
 
-/// @fn u64 stringCiHashFunction(const volatile void *value)
+/// @fn u64 stringCiHashFunction(const volatile void *value, u64 seed)
 ///
 /// @brief Specialized hash function to provide a case-insensitive hash.  This
 /// is accomplished by translating all lower-case letters in the string to their
-/// upper-case counterparts and hashing those values.
+/// upper-case counterparts, a word at a time, as they are hashed.
 ///
 /// @param value The string to be hashed.
+/// @param seed The seed for the hash.
 ///
 /// @return Returns a register-width integer repsresenting the case-insensitive
 /// hash of the string.
-u64 stringCiHashFunction(const volatile void *value) {
-  printLog(TRACE, "ENTER stringCiHashFunction(value=%p)\n", value);
+u64 stringCiHashFunction(const volatile void *value, u64 seed) {
+  printLog(TRACE, "ENTER stringCiHashFunction(value=%p, seed=%llu)\n",
+    value, llu(seed));
   
   if (value == NULL) {
-    printLog(TRACE, "EXIT stringCiHashFunction(value=%p) = {%llu}\n",
-      value, 0ULL);
+    printLog(TRACE, "EXIT stringCiHashFunction(value=%p, seed=%llu) = {%llu}\n",
+      value, llu(seed), 0ULL);
     return 0;
   }
   
   const char *key = (const char*) value;
-  u64 hash = 0;
-  
-  for (u64 i = 0; key[i] != '\0'; i++) {
-    char c = key[i];
-    if ((c >= 'a') && (c <= 'z')) {
-      c -= 32;
-    }
-    hash += c;
-    hash += hash << 10;
-    hash ^= hash >> 6;
-  }
-   
-  hash += hash << 3;
-  hash ^= hash >> 11;
-  hash += hash << 15;
+  u64 hash = hashMemoryCi(key, strlen(key), seed);
   
-  printLog(TRACE, "EXIT stringCiHashFunction(value=%p) = {%llu}\n",
-    value, llu(hash));
+  printLog(TRACE, "EXIT stringCiHashFunction(value=%p, seed=%llu) = {%llu}\n",
+    value, llu(seed), llu(hash));
   return hash;
 }
 
@@ -5522,6 +5953,9 @@ TypeDescriptor _typeStringNoCopy = {
   .clear         = clearString,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = stringToBlobSize,
+  .toBlobBuffer  = stringToBlobBuffer,
 };
 TypeDescriptor *typeStringNoCopy = &_typeStringNoCopy;
 
@@ -5546,6 +5980,9 @@ TypeDescriptor _typeStringCi = {
   .clear         = clearString,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = stringToBlobSize,
+  .toBlobBuffer  = stringToBlobBuffer,
 };
 TypeDescriptor *typeStringCi = &_typeStringCi;
 
@@ -5571,6 +6008,9 @@ TypeDescriptor _typeStringCiNoCopy = {
   .clear         = clearString,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = stringToBlobSize,
+  .toBlobBuffer  = stringToBlobBuffer,
 };
 TypeDescriptor *typeStringCiNoCopy = &_typeStringCiNoCopy;
 
@@ -5711,6 +6151,37 @@ Bytes pointerToBlob(const volatile void *value) {
   return returnValue;
 }
 
+/// @fn static u64 pointerToBlobSize(const volatile void *value)
+///
+/// @brief Get the number of bytes pointerToBlob produces for a pointer.
+///
+/// @param value A pointer value.
+///
+/// @return Returns sizeof(void*), or 0 if value is NULL.
+static u64 pointerToBlobSize(const volatile void *value) {
+  return (value != NULL) ? sizeof(void*) : 0;
+}
+
+/// @fn static u64 pointerToBlobBuffer(const volatile void *value, void *buffer, u64 bufferSize)
+///
+/// @brief Encode a pointer the way pointerToBlob does, directly into a buffer.
+///
+/// @param value A pointer value.
+/// @param buffer The memory to encode the pointer into.
+/// @param bufferSize The number of bytes available at buffer.
+///
+/// @return Returns the number of bytes written, 0 on failure.
+static u64 pointerToBlobBuffer(const volatile void *value, void *buffer,
+  u64 bufferSize
+) {
+  if ((value == NULL) || (buffer == NULL) || (bufferSize < sizeof(void*))) {
+    return 0;
+  }
+  
+  memcpy(buffer, &value, sizeof(void*));
+  return sizeof(void*);
+}
+
 /// @fn void* pointerFromBlob(const volatile void *value, u64 *length, bool inPlaceData, bool disableThreadSafety)
 ///
 /// @brief Convert an array of bytes to a pointer value.
@@ -5772,7 +6243,7 @@ void* pointerDestroyFunction(volatile void *pointer) {
   return NULL;
 }
 
-/// @fn u64 pointerHashFunction(const volatile void *value)
+/// @fn u64 pointerHashFunction(const volatile void *value, u64 seed)
 ///
 /// @brief Hash function for pointer types.
 ///
@@ -5780,14 +6251,17 @@ void* pointerDestroyFunction(volatile void *pointer) {
 /// By definition, every pointer value in a program is unique.  If someone is
 /// using generic pointers as keys in a data structure (which is the only reason
 /// this function would be called), there's no reason to compute a fancy hash.
-/// We really just need to return the numeric version of the pointer provided.
+/// However, the low bits of pointers returned by malloc are always zero, so
+/// the numeric value of the pointer is mixed with the seed once to spread it
+/// across all the bits of the result.
 ///
 /// @param value A pointer to the value being used as a key.
+/// @param seed The seed for the hash.
 ///
-/// @return Returns a hash value of the pointer, which is the numeric value of
-/// the pointer cast to a REGISTER_INT.
-u64 pointerHashFunction(const volatile void *value) {
-  return (u64) ((intptr_t) value);
+/// @return Returns a hash value of the pointer.
+u64 pointerHashFunction(const volatile void *value, u64 seed) {
+  return hashMix(((u64) ((intptr_t) value)) ^ seed ^ HASH_PRIME_0,
+    HASH_PRIME_1);
 }
 
 /// @var typePointer
@@ -5814,6 +6288,9 @@ TypeDescriptor _typePointer = {
   .clear         = clearNull,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = pointerToBlobSize,
+  .toBlobBuffer  = pointerToBlobBuffer,
 };
 TypeDescriptor *typePointer = &_typePointer;
 
@@ -5840,6 +6317,9 @@ TypeDescriptor _typePointerNoCopy = {
   .clear         = clearNull,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = pointerToBlobSize,
+  .toBlobBuffer  = pointerToBlobBuffer,
 };
 TypeDescriptor *typePointerNoCopy = &_typePointerNoCopy;
 TypeDescriptor *typePointerNoOwn = &_typePointerNoCopy;
@@ -6034,6 +6514,57 @@ Bytes bytesToBlob(const volatile void *value) {
   return returnValue;
 }
 
+/// @fn static u64 bytesToBlobSize(const volatile void *value)
+///
+/// @brief Get the number of bytes bytesToBlob produces for a Bytes value.
+///
+/// @param value A pointer to the Bytes value to size.
+///
+/// @return Returns the size of the BytesHeader plus the length of the value
+/// and its NULL terminator, or 0 if value is NULL.
+static u64 bytesToBlobSize(const volatile void *value) {
+  if (value == NULL) {
+    return 0;
+  }
+  
+  return sizeof(BytesHeader) + bytesLength((Bytes) value) + 1;
+}
+
+/// @fn static u64 bytesToBlobBuffer(const volatile void *value, void *buffer, u64 bufferSize)
+///
+/// @brief Encode a Bytes value the way bytesToBlob does, directly into a
+/// buffer.
+///
+/// @param value A pointer to the Bytes value to encode.
+/// @param buffer The memory to encode the value into.
+/// @param bufferSize The number of bytes available at buffer.
+///
+/// @return Returns the number of bytes written, 0 on failure.
+static u64 bytesToBlobBuffer(const volatile void *value, void *buffer,
+  u64 bufferSize
+) {
+  u64 size = bytesToBlobSize(value);
+  if ((size == 0) || (buffer == NULL) || (bufferSize < size)) {
+    return 0;
+  }
+  
+  // The encoded size only covers the data that is actually used, just as it
+  // does in bytesToBlob.
+  u64 valueLength = bytesLength((Bytes) value);
+  BytesHeader bytesHeader = {
+    .length = valueLength,
+    .size = valueLength + 1,
+  };
+  hostToLittleEndian(&bytesHeader.length, sizeof(bytesHeader.length));
+  hostToLittleEndian(&bytesHeader.size, sizeof(bytesHeader.size));
+  memcpy(buffer, &bytesHeader, sizeof(BytesHeader));
+  memcpy(((char*) buffer) + sizeof(BytesHeader), (const void*) value,
+    valueLength);
+  ((char*) buffer)[size - 1] = '\0';
+  
+  return size;
+}
+
 /// @fn void* bytesFromBlob(const volatile void *value, u64 *length, bool inPlaceData, bool disableThreadSafety)
 ///
 /// @brief Convert a byte array representation of Bytes to bytes.
@@ -6125,6 +6656,20 @@ int _bytesCompare(const volatile void *valueA, const volatile void *valueB) {
   return bytesCompare((Bytes) valueA, (Bytes) valueB);
 }
 
+/// @fn u64 bytesHashFunction(const volatile void *value, u64 seed)
+///
+/// @brief Specialized hash function for Bytes objects.  The length of a Bytes
+/// object is stored in its header, so its data can be hashed in place.
+///
+/// @param value The Bytes object to be hashed.
+/// @param seed The seed for the hash.
+///
+/// @return Returns a register-width integer repsresenting the hash of the
+/// Bytes object.
+u64 bytesHashFunction(const volatile void *value, u64 seed) {
+  return hashMemory(value, bytesLength((Bytes) value), seed);
+}
+
 /// @var typeBytes
 ///
 /// @brief TypeDescriptor describing how libraries should interact with data
@@ -6142,10 +6687,13 @@ TypeDescriptor _typeBytes = {
   .size          = _bytesSize,
   .toBlob        = bytesToBlob,
   .fromBlob      = bytesFromBlob,
-  .hashFunction  = NULL,
+  .hashFunction  = bytesHashFunction,
   .clear         = clearBytes,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = bytesToBlobSize,
+  .toBlobBuffer  = bytesToBlobBuffer,
 };
 TypeDescriptor *typeBytes = &_typeBytes;
 
@@ -6173,10 +6721,13 @@ TypeDescriptor _typeBytesNoCopy = {
   .size          = _bytesSize,
   .toBlob        = bytesToBlob,
   .fromBlob      = bytesFromBlob,
-  .hashFunction  = NULL,
+  .hashFunction  = bytesHashFunction,
   .clear         = clearBytes,
   .toXml         = NULL,
   .toJson        = NULL,
+  .toJsonStream  = NULL,
+  .blobSize      = bytesToBlobSize,
+  .toBlobBuffer  = bytesToBlobBuffer,
 };
 TypeDescriptor *typeBytesNoCopy = &_typeBytesNoCopy;
 
@@ -6996,6 +7547,58 @@ bool stringUnitTest() { \
       "length of %d.\n", "String", 63); \
     return false; \
   } \
+   \
+  char upperValue[64]; \
+  for (u64 i = 0; i <= strlen(value1); i++) { \
+    upperValue[i] = value1[i]; \
+    if ((upperValue[i] >= 'a') && (upperValue[i] <= 'z')) { \
+      upperValue[i] -= 32; \
+    } \
+  } \
+  for (u64 i = 0; i < 63; i++) { \
+    if (hashMemory(value1, i, 1) != hashMemory(newValue, i, 1)) { \
+      printLog(ERR, "hashMemory of %llu equal bytes differed.\n", llu(i)); \
+      return false; \
+    } \
+    if (hashMemoryCi(value1, i, 1) != hashMemoryCi(upperValue, i, 1)) { \
+      printLog(ERR, "hashMemoryCi of %llu bytes was not case-insensitive.\n", \
+        llu(i)); \
+      return false; \
+    } \
+  } \
+  if (hashMemory(value1, 62, 1) == hashMemory(value1, 63, 1)) { \
+    printLog(ERR, "hashMemory ignored the last byte of its input.\n"); \
+    return false; \
+  } \
+  if (typeString->hashFunction(value1, 1) != hashMemory(value1, 62, 1)) { \
+    printLog(ERR, "type%s->hashFunction did not hash the full string.\n", \
+      "String"); \
+    return false; \
+  } \
+  if (typeString->hashFunction(value1, 1) \
+    == typeString->hashFunction(value1, 2) \
+  ) { \
+    printLog(ERR, "type%s->hashFunction ignored its seed.\n", "String"); \
+    return false; \
+  } \
+  if (typeString->hashFunction(value1, 1) \
+    == typeString->hashFunction(upperValue, 1) \
+  ) { \
+    printLog(ERR, "type%s->hashFunction was case-insensitive.\n", "String"); \
+    return false; \
+  } \
+  if (typeStringCi->hashFunction(value1, 1) \
+    != typeStringCi->hashFunction(upperValue, 1) \
+  ) { \
+    printLog(ERR, "type%s->hashFunction was not case-insensitive.\n", \
+      "StringCi"); \
+    return false; \
+  } \
+  if (hashCreateSeed() == hashCreateSeed()) { \
+    printLog(ERR, "hashCreateSeed returned the same seed twice.\n"); \
+    return false; \
+  } \
+   \
   newValue = stringDestroy(newValue); \
   bytesValue = bytesDestroy(bytesValue); \
    \
@@ -7415,6 +8018,20 @@ bool bytesUnitTest() { \
       "pointer to %s equal to bytesValue1.\n", "Bytes", "bytes"); \
     return false; \
   } \
+  if (typeBytes->hashFunction(bytesValue1, 1) \
+    != typeBytes->hashFunction(newValue2, 1) \
+  ) { \
+    printLog(ERR, "type%s->hashFunction differed for equal values.\n", \
+      "Bytes"); \
+    return false; \
+  } \
+  if (typeBytes->hashFunction(bytesValue1, 1) \
+    != hashMemory(bytesValue1, bytesLength(bytesValue1), 1) \
+  ) { \
+    printLog(ERR, "type%s->hashFunction did not hash the data in place.\n", \
+      "Bytes"); \
+    return false; \
+  } \
   byteArray = bytesDestroy(byteArray); \
   newValue2 = (char*) typeBytes->destroy(newValue2); \
    \
@@ -29,9 +29,16 @@
 /// @file
 
 #include <errno.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#endif // _WIN32
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif // __linux__
 
 #include "DirectoryLib.h"
 #include "StringLib.h"
+#include "CThreads.h"
 
 #ifdef LOGGING_ENABLED
 #include "LoggingLib.h"
@@ -760,68 +767,576 @@ int mkpath(const char *path, int mode) {
   return returnValue;
 }
 
-/// @fn int rmdirRecursive(const char *directory)
+/// @struct DirectoryWalkNode
 ///
-/// @brief Recursively remove a directory and all of its contents.
+/// @brief A directory that directoryWalk has found but not finished with.
 ///
-/// @param directory The full path to the directory.  Trailing '/' is optional.
+/// @param path The full path of the directory.
+/// @param depth The depth of the directory below the starting path.
+/// @param parent The node for the directory containing this one.
+/// @param pending One for this directory's own listing plus one for each of
+///   its subdirectories that has not been finished.  The directory is
+///   finished (and post-visited) when this reaches zero.
+/// @param next The next node in the walk's stack of directories to list.
+typedef struct DirectoryWalkNode {
+  char *path;
+  int depth;
+  struct DirectoryWalkNode *parent;
+  int64_t pending;
+  struct DirectoryWalkNode *next;
+} DirectoryWalkNode;
+
+/// @struct DirectoryWalk
 ///
-/// @return Returns 0 on success, -1 on failure.
-int rmdirRecursive(const char *directory) {
-  if ((directory == NULL) || (*directory == '\0')) {
-    printLog(ERR, "NULL or empty directory provided.\n");
-    return -1;
+/// @brief The state shared by the threads of a directoryWalk.
+///
+/// @param function The function to call for each entry.
+/// @param context The context to pass to function.
+/// @param flags The flags passed to directoryWalk.
+/// @param lock Guards stack and outstanding.
+/// @param condition Signaled when a directory is pushed or the walk is done.
+/// @param stack The directories waiting to be listed.
+/// @param outstanding The number of directories pushed but not yet listed.
+/// @param stopped Set when the walk function returns DIRECTORY_WALK_STOP.
+/// @param failed Set when a directory could not be listed.
+typedef struct DirectoryWalk {
+  DirectoryWalkFunction function;
+  void *context;
+  int flags;
+  lmtx_t lock;
+  lcnd_t condition;
+  DirectoryWalkNode *stack;
+  int64_t outstanding;
+  bool stopped;
+  bool failed;
+} DirectoryWalk;
+
+/// @fn static DirectoryEntryType directoryWalkStatType(const char *path, int directoryFd, const char *name)
+///
+/// @brief Determine the type of an entry whose directory listing didn't say.
+///
+/// @param path The full path of the entry.
+/// @param directoryFd The descriptor of the entry's directory, or -1.
+/// @param name The name of the entry within its directory.
+///
+/// @return Returns the DirectoryEntryType of the entry.  Entries that can't
+/// be examined are reported as ENTRY_TYPE_OTHER.
+static DirectoryEntryType directoryWalkStatType(const char *path,
+  int directoryFd, const char *name
+) {
+  struct stat statBuffer;
+#ifndef _WIN32
+  int status = (directoryFd >= 0)
+    ? fstatat(directoryFd, name, &statBuffer, AT_SYMLINK_NOFOLLOW)
+    : lstat(path, &statBuffer);
+#else
+  (void) directoryFd;
+  (void) name;
+  int status = stat(path, &statBuffer);
+#endif // _WIN32
+  if (status != 0) {
+    return ENTRY_TYPE_OTHER;
+  } else if (S_ISDIR(statBuffer.st_mode)) {
+    return ENTRY_TYPE_DIRECTORY;
+  } else if (S_ISREG(statBuffer.st_mode)) {
+    return ENTRY_TYPE_FILE;
+  } else if (S_ISLNK(statBuffer.st_mode)) {
+    return ENTRY_TYPE_SYMLINK;
   }
   
-  DIR *dir = NULL;
-  struct dirent *entry = NULL;
+  return ENTRY_TYPE_OTHER;
+}
+
+/// @fn static DirectoryEntryType directoryWalkType(unsigned char dType, const char *path, int directoryFd, const char *name)
+///
+/// @brief Convert the d_type of a directory listing to a DirectoryEntryType,
+/// falling back to a stat for filesystems that don't fill d_type in.
+///
+/// @param dType The d_type from the listing.
+/// @param path The full path of the entry.
+/// @param directoryFd The descriptor of the entry's directory, or -1.
+/// @param name The name of the entry within its directory.
+///
+/// @return Returns the DirectoryEntryType of the entry.
+static DirectoryEntryType directoryWalkType(unsigned char dType,
+  const char *path, int directoryFd, const char *name
+) {
+  // This is an if chain rather than a switch because some of these values
+  // are the same on some platforms.
+  if (dType == DT_DIR) {
+    return ENTRY_TYPE_DIRECTORY;
+  } else if (dType == DT_REG) {
+    return ENTRY_TYPE_FILE;
+  } else if (dType == DT_UNKNOWN) {
+    return directoryWalkStatType(path, directoryFd, name);
+  } else if (dType == DT_LNK) {
+    return ENTRY_TYPE_SYMLINK;
+  }
+  
+  return ENTRY_TYPE_OTHER;
+}
+
+/// @fn static void directoryWalkPush(DirectoryWalk *walk, DirectoryWalkNode *node)
+///
+/// @brief Add a directory to the stack of directories waiting to be listed.
+///
+/// @param walk The DirectoryWalk to add the directory to.
+/// @param node The directory to add.
+///
+/// @return This function returns no value.
+static void directoryWalkPush(DirectoryWalk *walk, DirectoryWalkNode *node) {
+  if (node->parent != NULL) {
+    __atomic_add_fetch(&node->parent->pending, 1, __ATOMIC_RELAXED);
+  }
+  
+  lmtx_lock(&walk->lock);
+  node->next = walk->stack;
+  walk->stack = node;
+  walk->outstanding++;
+  lcnd_signal(&walk->condition);
+  lmtx_unlock(&walk->lock);
+}
+
+/// @fn static void directoryWalkRelease(DirectoryWalk *walk, DirectoryWalkNode *node)
+///
+/// @brief Drop one of a directory's pending references.  When the last one
+/// goes, post-visit the directory if asked to, free it, and drop the
+/// reference it held on its parent.
+///
+/// @param walk The DirectoryWalk the node belongs to.
+/// @param node The directory to release.
+///
+/// @return This function returns no value.
+static void directoryWalkRelease(DirectoryWalk *walk, DirectoryWalkNode *node) {
+  while ((node != NULL)
+    && (__atomic_sub_fetch(&node->pending, 1, __ATOMIC_ACQ_REL) == 0)
+  ) {
+    if (((walk->flags & DIRECTORY_WALK_POST_ORDER) != 0)
+      && (__atomic_load_n(&walk->stopped, __ATOMIC_RELAXED) == false)
+    ) {
+      const char *name = strrchr(node->path, '/');
+      DirectoryWalkEntry entry = {
+        node->path,
+        ((name != NULL) && (node->depth > 0)) ? name + 1 : node->path,
+        ENTRY_TYPE_DIRECTORY,
+        node->depth,
+        -1,
+        true
+      };
+      if (walk->function(&entry, walk->context) == DIRECTORY_WALK_STOP) {
+        __atomic_store_n(&walk->stopped, true, __ATOMIC_RELAXED);
+      }
+    }
+    
+    DirectoryWalkNode *parent = node->parent;
+    node->path = stringDestroy(node->path);
+    node = (DirectoryWalkNode*) pointerDestroy(node);
+    node = parent;
+  }
+}
+
+/// @fn static bool directoryWalkVisit(DirectoryWalk *walk, DirectoryWalkNode *node, const char *path, int directoryFd, const char *name, unsigned char dType)
+///
+/// @brief Visit one entry of a directory being listed, queueing it to be
+/// listed itself if it is a directory the walk function wants to descend
+/// into.
+///
+/// @param walk The DirectoryWalk being run.
+/// @param node The directory being listed.
+/// @param path The full path of the entry.
+/// @param directoryFd The descriptor of the directory being listed, or -1.
+/// @param name The name of the entry.
+/// @param dType The d_type of the entry from the listing.
+///
+/// @return Returns true if the walk should go on, false if it should stop.
+static bool directoryWalkVisit(DirectoryWalk *walk, DirectoryWalkNode *node,
+  const char *path, int directoryFd, const char *name, unsigned char dType
+) {
+  DirectoryWalkEntry entry = {
+    path,
+    name,
+    directoryWalkType(dType, path, directoryFd, name),
+    node->depth + 1,
+    directoryFd,
+    false
+  };
+  
+  int action = walk->function(&entry, walk->context);
+  if (action == DIRECTORY_WALK_STOP) {
+    __atomic_store_n(&walk->stopped, true, __ATOMIC_RELAXED);
+    return false;
+  } else if ((action == DIRECTORY_WALK_CONTINUE)
+    && (entry.type == ENTRY_TYPE_DIRECTORY)
+  ) {
+    DirectoryWalkNode *child
+      = (DirectoryWalkNode*) calloc(1, sizeof(DirectoryWalkNode));
+    if (child == NULL) {
+      LOG_MALLOC_FAILURE();
+      __atomic_store_n(&walk->failed, true, __ATOMIC_RELAXED);
+      return true;
+    }
+    straddstr(&child->path, path);
+    child->depth = node->depth + 1;
+    child->parent = node;
+    child->pending = 1;
+    directoryWalkPush(walk, child);
+  }
+  
+  return true;
+}
+
+/// @fn static void directoryWalkList(DirectoryWalk *walk, DirectoryWalkNode *node)
+///
+/// @brief List one directory, visiting each of its entries.  On Linux the
+/// directory is read with getdents64 in large batches and entries are typed
+/// from d_type, so most entries cost no system calls of their own.
+///
+/// @param walk The DirectoryWalk being run.
+/// @param node The directory to list.
+///
+/// @return This function returns no value.
+static void directoryWalkList(DirectoryWalk *walk, DirectoryWalkNode *node) {
+  size_t directoryLength = strlen(node->path);
+  size_t pathSize = directoryLength + 258;
+  char *path = (char*) malloc(pathSize);
+  if (path == NULL) {
+    LOG_MALLOC_FAILURE();
+    __atomic_store_n(&walk->failed, true, __ATOMIC_RELAXED);
+    return;
+  }
+  memcpy(path, node->path, directoryLength);
+  if ((directoryLength == 0) || (path[directoryLength - 1] != '/')) {
+    path[directoryLength++] = '/';
+  }
   
-  char *directoryName = NULL;
-  straddstr(&directoryName, directory);
-  if (directoryName[strlen(directoryName) - 1] != '/') {
-    straddstr(&directoryName, "/");
+#ifdef __linux__
+  int directoryFd = open(node->path,
+    O_RDONLY | O_DIRECTORY | O_CLOEXEC | ((node->depth > 0) ? O_NOFOLLOW : 0));
+  if (directoryFd < 0) {
+    printLog(ERR, "Cannot open directory \"%s\": %s\n",
+      node->path, strerror(errno));
+    __atomic_store_n(&walk->failed, true, __ATOMIC_RELAXED);
+    path = stringDestroy(path);
+    return;
+  }
+  
+  // Layout of the records returned by getdents64.
+  typedef struct LinuxDirent64 {
+    uint64_t       d_ino;
+    int64_t        d_off;
+    unsigned short d_reclen;
+    unsigned char  d_type;
+    char           d_name[];
+  } LinuxDirent64;
+  
+  char *buffer = (char*) malloc(DIRECTORY_WALK_BUFFER_SIZE);
+  if (buffer == NULL) {
+    LOG_MALLOC_FAILURE();
+    __atomic_store_n(&walk->failed, true, __ATOMIC_RELAXED);
+    close(directoryFd);
+    path = stringDestroy(path);
+    return;
+  }
+  
+  bool keepGoing = true;
+  while (keepGoing == true) {
+    long numBytes = syscall(SYS_getdents64, directoryFd, buffer,
+      DIRECTORY_WALK_BUFFER_SIZE);
+    if (numBytes < 0) {
+      printLog(ERR, "Cannot read directory \"%s\": %s\n",
+        node->path, strerror(errno));
+      __atomic_store_n(&walk->failed, true, __ATOMIC_RELAXED);
+      break;
+    } else if (numBytes == 0) {
+      break;
+    }
+    
+    for (long offset = 0; (keepGoing == true) && (offset < numBytes);) {
+      LinuxDirent64 *record = (LinuxDirent64*) (buffer + offset);
+      offset += record->d_reclen;
+      const char *name = record->d_name;
+      if ((name[0] == '.') && ((name[1] == '\0')
+        || ((name[1] == '.') && (name[2] == '\0')))
+      ) {
+        continue;
+      }
+      
+      size_t nameLength = strlen(name);
+      memcpy(&path[directoryLength], name, nameLength + 1);
+      keepGoing = directoryWalkVisit(walk, node, path, directoryFd, name,
+        record->d_type);
+      if (__atomic_load_n(&walk->stopped, __ATOMIC_RELAXED) == true) {
+        keepGoing = false;
+      }
+    }
   }
   
-  dir = opendir(directoryName);
+  buffer = (char*) pointerDestroy(buffer);
+  close(directoryFd);
+#else
+  DIR *dir = opendir(node->path);
   if (dir == NULL) {
-    // Cannot open the directory.  Error.
-    printLog(ERR, "Cannot open directory \"%s\".\n", directoryName);
-    printLog(ERR, "%s\n", strerror(errno));
-    directoryName = stringDestroy(directoryName);
-    return -1;
+    printLog(ERR, "Cannot open directory \"%s\": %s\n",
+      node->path, strerror(errno));
+    __atomic_store_n(&walk->failed, true, __ATOMIC_RELAXED);
+    path = stringDestroy(path);
+    return;
   }
   
-  int returnValue = 0;
-  entry = readdir(dir);
-  while (entry != NULL) {
-    char *entryName = entry->d_name;
-    if ((strcmp(entryName, "..") == 0) || (strcmp(entryName, ".") == 0)) {
-      // AVOID THESE AT ALL COSTS!  RECURSING INTO THEM WILL DESTROY US!!!
-      entry = readdir(dir);
+  struct dirent *entry = NULL;
+  while ((entry = readdir(dir)) != NULL) {
+    const char *name = entry->d_name;
+    if ((strcmp(name, ".") == 0) || (strcmp(name, "..") == 0)) {
       continue;
     }
-    char *fullPath = NULL;
-    straddstr(&fullPath, directoryName);
-    straddstr(&fullPath, entryName);
-    DIR *tryDir = opendir(fullPath);
-    if (tryDir != NULL) {
-      closedir(tryDir);
-      straddchr(&fullPath, '/');
-      returnValue |= rmdirRecursive(fullPath);
-    } else {
-      returnValue |= remove(fullPath);
+    
+    size_t nameLength = strlen(name);
+    if (directoryLength + nameLength + 1 > pathSize) {
+      pathSize = directoryLength + nameLength + 1;
+      char *check = (char*) realloc(path, pathSize);
+      if (check == NULL) {
+        LOG_MALLOC_FAILURE();
+        __atomic_store_n(&walk->failed, true, __ATOMIC_RELAXED);
+        break;
+      }
+      path = check;
     }
-    if (returnValue != 0) {
-      printLog(ERR, "Could not remove \"%s\".\n", fullPath);
+    memcpy(&path[directoryLength], name, nameLength + 1);
+    if ((!directoryWalkVisit(walk, node, path, -1, name, entry->d_type))
+      || (__atomic_load_n(&walk->stopped, __ATOMIC_RELAXED) == true)
+    ) {
+      break;
     }
-    fullPath = stringDestroy(fullPath);
-    entry = readdir(dir);
   }
   closedir(dir); dir = NULL;
+#endif // __linux__
+  
+  path = stringDestroy(path);
+}
+
+/// @fn static int directoryWalkWorker(void *arg)
+///
+/// @brief Thread function for directoryWalk.  Lists directories from the
+/// walk's stack until every directory found has been listed.
+///
+/// @param arg The DirectoryWalk being run.
+///
+/// @return Always returns 0.
+static int directoryWalkWorker(void *arg) {
+  DirectoryWalk *walk = (DirectoryWalk*) arg;
+  
+  while (true) {
+    lmtx_lock(&walk->lock);
+    while ((walk->stack == NULL) && (walk->outstanding > 0)) {
+      lcnd_wait(&walk->condition, &walk->lock);
+    }
+    DirectoryWalkNode *node = walk->stack;
+    if (node != NULL) {
+      walk->stack = node->next;
+    }
+    lmtx_unlock(&walk->lock);
+    if (node == NULL) {
+      // Nothing left to list anywhere.
+      break;
+    }
+    
+    if (__atomic_load_n(&walk->stopped, __ATOMIC_RELAXED) == false) {
+      directoryWalkList(walk, node);
+    }
+    directoryWalkRelease(walk, node);
+    
+    lmtx_lock(&walk->lock);
+    walk->outstanding--;
+    if (walk->outstanding == 0) {
+      lcnd_broadcast(&walk->condition);
+    }
+    lmtx_unlock(&walk->lock);
+  }
+  
+  return 0;
+}
+
+/// @fn int directoryWalk_(const char *path, DirectoryWalkFunction function, void *context, uint32_t numThreads, int flags, ...)
+///
+/// @brief Walk a directory tree, calling a function for the starting
+/// directory and everything beneath it.  Directories are listed by a pool of
+/// threads, so entries are visited in no particular order, except that a
+/// directory is always visited before its contents and, with
+/// DIRECTORY_WALK_POST_ORDER, post-visited after them.  Symbolic links are
+/// reported but never followed.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides 0 for the flags if they
+/// are not provided.
+///
+/// @param path The directory to start at.
+/// @param function The function to call for each entry.
+/// @param context The context to pass to function.
+/// @param numThreads The number of threads to list directories with.  0
+///   means one per online CPU.  The calling thread is one of them.
+/// @param flags Zero or more DIRECTORY_WALK_* flags ORed together.
+/// @param ... All further parameters are ignored.
+///
+/// @return Returns 0 if the whole tree was walked, -1 if any directory could
+/// not be read or the walk function stopped the walk.
+int directoryWalk_(const char *path, DirectoryWalkFunction function,
+  void *context, uint32_t numThreads, int flags, ...
+) {
+  if ((path == NULL) || (*path == '\0') || (function == NULL)) {
+    printLog(ERR, "NULL or empty parameter provided.\n");
+    return -1;
+  }
+  
+  struct stat statBuffer;
+  if ((stat(path, &statBuffer) != 0) || (!S_ISDIR(statBuffer.st_mode))) {
+    printLog(ERR, "\"%s\" is not a directory.\n", path);
+    return -1;
+  }
+  
+  DirectoryWalk walk;
+  memset(&walk, 0, sizeof(walk));
+  walk.function = function;
+  walk.context = context;
+  walk.flags = flags;
+  if (lmtx_init(&walk.lock) != thrd_success) {
+    printLog(ERR, "Could not initialize walk mutex.\n");
+    return -1;
+  }
+  if (lcnd_init(&walk.condition) != thrd_success) {
+    printLog(ERR, "Could not initialize walk condition.\n");
+    lmtx_destroy(&walk.lock);
+    return -1;
+  }
+  
+  DirectoryWalkNode *root
+    = (DirectoryWalkNode*) calloc(1, sizeof(DirectoryWalkNode));
+  if (root == NULL) {
+    LOG_MALLOC_FAILURE();
+    lcnd_destroy(&walk.condition);
+    lmtx_destroy(&walk.lock);
+    return -1;
+  }
+  straddstr(&root->path, path);
+  root->pending = 1;
+  
+  DirectoryWalkEntry entry = {
+    root->path, root->path, ENTRY_TYPE_DIRECTORY, 0, -1, false
+  };
+  int action = function(&entry, context);
+  if (action == DIRECTORY_WALK_CONTINUE) {
+    directoryWalkPush(&walk, root);
+  } else {
+    if (action == DIRECTORY_WALK_STOP) {
+      walk.stopped = true;
+    }
+    root->path = stringDestroy(root->path);
+    root = (DirectoryWalkNode*) pointerDestroy(root);
+  }
+  
+  if (numThreads == 0) {
+#ifdef _WIN32
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    numThreads = systemInfo.dwNumberOfProcessors;
+#else
+    long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    numThreads = (numCpus > 0) ? (uint32_t) numCpus : 1;
+#endif // _WIN32
+  }
+  
+  thrd_t *threads = NULL;
+  uint32_t numStarted = 0;
+  if ((root != NULL) && (numThreads > 1)) {
+    threads = (thrd_t*) calloc(numThreads - 1, sizeof(thrd_t));
+    if (threads == NULL) {
+      LOG_MALLOC_FAILURE();
+    }
+  }
+  if (threads != NULL) {
+    for (; numStarted < numThreads - 1; numStarted++) {
+      if (thrd_create(&threads[numStarted], directoryWalkWorker, &walk)
+        != thrd_success
+      ) {
+        // Make do with the threads we have.
+        break;
+      }
+    }
+  }
+  
+  directoryWalkWorker(&walk);
+  
+  for (uint32_t ii = 0; ii < numStarted; ii++) {
+    thrd_join(threads[ii], NULL);
+  }
+  threads = (thrd_t*) pointerDestroy(threads);
+  lcnd_destroy(&walk.condition);
+  lmtx_destroy(&walk.lock);
+  
+  return ((walk.stopped == true) || (walk.failed == true)) ? -1 : 0;
+}
+
+/// @fn static int rmdirRecursiveVisit(const DirectoryWalkEntry *entry, void *context)
+///
+/// @brief DirectoryWalkFunction for rmdirRecursive.  Removes everything but
+/// directories as they are found and removes directories once they are
+/// empty.
+///
+/// @param entry The entry to remove.
+/// @param context A pointer to a bool to set if anything can't be removed.
+///
+/// @return Always returns DIRECTORY_WALK_CONTINUE.
+static int rmdirRecursiveVisit(const DirectoryWalkEntry *entry,
+  void *context
+) {
+  int status = 0;
+  if (entry->type == ENTRY_TYPE_DIRECTORY) {
+    if (entry->postVisit == true) {
+      status = rmdir(entry->path);
+    }
+#ifndef _WIN32
+  } else if (entry->directoryFd >= 0) {
+    status = unlinkat(entry->directoryFd, entry->name, 0);
+#endif // _WIN32
+  } else {
+    status = remove(entry->path);
+  }
+  
+  if (status != 0) {
+    printLog(ERR, "Could not remove \"%s\".\n", entry->path);
+    __atomic_store_n((bool*) context, true, __ATOMIC_RELAXED);
+  }
+  
+  return DIRECTORY_WALK_CONTINUE;
+}
+
+/// @fn int rmdirRecursive_(const char *directory, uint32_t numThreads, ...)
+///
+/// @brief Recursively remove a directory and all of its contents.  Symbolic
+/// links inside the directory are removed, not followed.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides 1 for numThreads if it is
+/// not provided.
+///
+/// @param directory The full path to the directory.  Trailing '/' is optional.
+/// @param numThreads The number of threads to remove entries with.  0 means
+///   one per online CPU.
+/// @param ... All further parameters are ignored.
+///
+/// @return Returns 0 on success, -1 on failure.
+int rmdirRecursive_(const char *directory, uint32_t numThreads, ...) {
+  if ((directory == NULL) || (*directory == '\0')) {
+    printLog(ERR, "NULL or empty directory provided.\n");
+    return -1;
+  }
   
-  returnValue |= rmdir(directoryName);
+  bool failed = false;
+  int returnValue = directoryWalk(directory, rmdirRecursiveVisit, &failed,
+    numThreads, DIRECTORY_WALK_POST_ORDER);
+  if (failed == true) {
+    returnValue = -1;
+  }
   
-  directoryName = stringDestroy(directoryName);
   return returnValue;
 }
 
@@ -846,16 +1361,20 @@ char** destroyDirectoryEntries(char **directoryEntries) {
   return directoryEntries;
 }
 
-/// @fn char** getDirectoryEntries(const char *path)
+/// @fn static char** directoryListEntries(const char *path, int entryType)
 ///
-/// @brief Get the entries (file names and directory names) in a specified
-/// directrory, excluding "." and ".." which are part of every directory.
+/// @brief List the entries of a directory, optionally only those of one type.
+/// Types come from d_type where the filesystem provides it, so entries only
+/// need a stat of their own when it doesn't or when they are symbolic links,
+/// which are classified by what they point to.
 ///
 /// @param path The full path to the directory.  Trailing '/' is optional.
+/// @param entryType ENTRY_TYPE_FILE or ENTRY_TYPE_DIRECTORY to select only
+///   entries of that type, or -1 for all entries.
 ///
 /// @return Returns a NULL-terminated array of entries on success, NULL on
 /// failure.
-char** getDirectoryEntries(const char *path) {
+static char** directoryListEntries(const char *path, int entryType) {
   if ((path == NULL) || (*path == '\0')) {
     printLog(ERR, "NULL or empty path provided.\n");
     return NULL;
@@ -880,8 +1399,9 @@ char** getDirectoryEntries(const char *path) {
   }
   
   uint64_t numEntries = 0;
-  char **returnValue = (char**) calloc(1, sizeof(char*));
-  entry = readdir(dir);
+  uint64_t capacity = 16;
+  char **returnValue = (char**) calloc(capacity, sizeof(char*));
+  entry = (returnValue != NULL) ? readdir(dir) : NULL;
   while (entry != NULL) {
     char *entryName = entry->d_name;
     if ((strcmp(entryName, "..") == 0) || (strcmp(entryName, ".") == 0)) {
@@ -889,19 +1409,41 @@ char** getDirectoryEntries(const char *path) {
       entry = readdir(dir);
       continue;
     }
-    numEntries++;
     
-    void *check = realloc(returnValue, (numEntries + 1) * sizeof(char*));
-    if (check == NULL) {
-      LOG_MALLOC_FAILURE();
-      returnValue = destroyDirectoryEntries(returnValue);
-      return NULL;
+    if (entryType >= 0) {
+      bool isDirectory = (entry->d_type == DT_DIR);
+      if ((entry->d_type == DT_UNKNOWN) || (entry->d_type == DT_LNK)) {
+        // Follow links the same way selectDirectoryEntries does.
+        char *fullPath = NULL;
+        straddstr(&fullPath, pathName);
+        straddstr(&fullPath, entryName);
+        struct stat statBuffer;
+        isDirectory = (stat(fullPath, &statBuffer) == 0)
+          && (S_ISDIR(statBuffer.st_mode));
+        fullPath = stringDestroy(fullPath);
+      }
+      if (isDirectory != (entryType == ENTRY_TYPE_DIRECTORY)) {
+        // The user is not interested in this entry.
+        entry = readdir(dir);
+        continue;
+      }
+    }
+    
+    if (numEntries + 1 >= capacity) {
+      capacity *= 2;
+      void *check = realloc(returnValue, capacity * sizeof(char*));
+      if (check == NULL) {
+        LOG_MALLOC_FAILURE();
+        returnValue = destroyDirectoryEntries(returnValue);
+        break;
+      }
+      returnValue = (char**) check;
     }
-    returnValue = (char**) check;
     
     returnValue[numEntries] = NULL;
-    // returnValue[numEntries - 1] is already NULL.
-    straddstr(&returnValue[numEntries - 1], entryName);
+    straddstr(&returnValue[numEntries], entryName);
+    numEntries++;
+    returnValue[numEntries] = NULL;
     
     entry = readdir(dir);
   }
@@ -911,6 +1453,19 @@ char** getDirectoryEntries(const char *path) {
   return returnValue;
 }
 
+/// @fn char** getDirectoryEntries(const char *path)
+///
+/// @brief Get the entries (file names and directory names) in a specified
+/// directrory, excluding "." and ".." which are part of every directory.
+///
+/// @param path The full path to the directory.  Trailing '/' is optional.
+///
+/// @return Returns a NULL-terminated array of entries on success, NULL on
+/// failure.
+char** getDirectoryEntries(const char *path) {
+  return directoryListEntries(path, -1);
+}
+
 /// @fn char **selectDirectoryEntries(const char *path, const char **directoryEntries, DirectoryEntryType entryType)
 ///
 /// @brief Select only the directory entries that are interesting.
@@ -995,11 +1550,7 @@ char **selectDirectoryEntries(const char *path, const char **directoryEntries,
 /// @return Returns a NULL-terminated array of entries on success, NULL on
 /// failure.
 char** getDirectoryFiles(const char *path) {
-  char **entries = getDirectoryEntries(path);
-  char **returnValue = selectDirectoryEntries(path, (const char**) entries, ENTRY_TYPE_FILE);
-  entries = destroyDirectoryEntries(entries);
-  
-  return returnValue;
+  return directoryListEntries(path, ENTRY_TYPE_FILE);
 }
 
 /// @fn char** getDirectoryDirectories(const char *path)
@@ -1011,11 +1562,6 @@ char** getDirectoryFiles(const char *path) {
 /// @return Returns a NULL-terminated array of entries on success, NULL on
 /// failure.
 char** getDirectoryDirectories(const char *path) {
-  char **entries = getDirectoryEntries(path);
-  char **returnValue
-    = selectDirectoryEntries(path, (const char**) entries, ENTRY_TYPE_DIRECTORY);
-  entries = destroyDirectoryEntries(entries);
-  
-  return returnValue;
+  return directoryListEntries(path, ENTRY_TYPE_DIRECTORY);
 }
 
@@ -0,0 +1,968 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+//                     Copyright (c) 2012-2024 James Card                     //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included    //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+//                                                                            //
+//                                 James Card                                 //
+//                          http://www.jamescard.org                          //
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+// Doxygen marker
+/// @file
+
+#ifdef DS_LOGGING_ENABLED
+#include "LoggingLib.h"
+#else
+#undef printLog
+#define printLog(...) {}
+#define logFile stderr
+#define LOG_MALLOC_FAILURE(...) {}
+#endif
+
+#include "StringLib.h"
+#include "FlatHashTable.h"
+#include "HashTable.h"
+#include "LockStats.h"
+
+/// @fn static inline u64 fhtMixHash(u64 hash)
+///
+/// @brief Scramble the bits of a hash so that the low-order bits used to
+///   select a slot depend on all the bits of the original hash.
+///
+/// @details This is the finalizer from MurmurHash3.  Without it, key types
+///   with a weak hashFunction would cluster badly because the capacity of the
+///   table is always a power of two.
+///
+/// @param hash The hash to scramble.
+///
+/// @return Returns the scrambled hash.
+static inline u64 fhtMixHash(u64 hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  
+  return hash;
+}
+
+/// @fn static inline u64 fhtProbeDistance(const FlatHashTable *table, u64 slot)
+///
+/// @brief Compute how far the entry at a slot is from the slot its hash
+///   selects.
+///
+/// @param table The table of interest.
+/// @param slot The index of an occupied slot.
+///
+/// @return Returns the number of slots between the entry's ideal slot and
+///   its actual one.
+static inline u64 fhtProbeDistance(const FlatHashTable *table, u64 slot) {
+  u64 mask = table->capacity - 1;
+  return (slot - (table->entries[slot].hash & mask)) & mask;
+}
+
+/// @fn static FlatHashTableEntry *fhtFind(const FlatHashTable *table, const volatile void *key, u64 hash)
+///
+/// @brief Find the entry that matches a key.
+///
+/// @details With Robin Hood probing, the search can stop as soon as it
+///   reaches an entry that is closer to its ideal slot than the key being
+///   searched for would be, since the key would have displaced that entry.
+///
+/// @param table The table to search.  The caller must hold its lock.
+/// @param key The key to search for.
+/// @param hash The mixed hash of the key.
+///
+/// @return Returns the matching entry on success, NULL if there is none.
+static FlatHashTableEntry *fhtFind(const FlatHashTable *table,
+  const volatile void *key, u64 hash
+) {
+  u64 mask = table->capacity - 1;
+  u64 slot = hash & mask;
+  
+  for (u64 distance = 0; distance < table->capacity; distance++) {
+    FlatHashTableEntry *entry = &table->entries[slot];
+    if ((entry->key == NULL) || (fhtProbeDistance(table, slot) < distance)) {
+      break;
+    }
+    if ((entry->hash == hash)
+      && (table->keyType->compare(entry->key, key) == 0)
+    ) {
+      return entry;
+    }
+    slot = (slot + 1) & mask;
+  }
+  
+  return NULL;
+}
+
+/// @fn static FlatHashTableEntry *fhtPlace(FlatHashTableEntry *entries, u64 capacity, FlatHashTableEntry entry)
+///
+/// @brief Put an entry into an array of slots using Robin Hood probing.
+///
+/// @details Whenever the entry being placed is farther from its ideal slot
+///   than the resident entry, the two are swapped and placement continues
+///   with the displaced entry.  The caller must ensure that the key is not
+///   already present and that there is at least one empty slot.
+///
+/// @param entries The array of slots to place the entry into.
+/// @param capacity The number of slots in entries.  Must be a power of two.
+/// @param entry The entry to place.
+///
+/// @return Returns a pointer to the slot that now holds the entry.
+static FlatHashTableEntry *fhtPlace(FlatHashTableEntry *entries,
+  u64 capacity, FlatHashTableEntry entry
+) {
+  u64 mask = capacity - 1;
+  u64 slot = entry.hash & mask;
+  u64 distance = 0;
+  FlatHashTableEntry *placed = NULL;
+  
+  while (entries[slot].key != NULL) {
+    u64 residentDistance = (slot - (entries[slot].hash & mask)) & mask;
+    if (residentDistance < distance) {
+      FlatHashTableEntry resident = entries[slot];
+      entries[slot] = entry;
+      if (placed == NULL) {
+        placed = &entries[slot];
+      }
+      entry = resident;
+      distance = residentDistance;
+    }
+    slot = (slot + 1) & mask;
+    distance++;
+  }
+  entries[slot] = entry;
+  if (placed == NULL) {
+    placed = &entries[slot];
+  }
+  
+  return placed;
+}
+
+/// @fn static int fhtResize(FlatHashTable *table, u64 capacity)
+///
+/// @brief Move all the entries of a table into a new array of slots.
+///
+/// @details The entries themselves are moved, not copied.  Their cached
+///   hashes are used so no keys are rehashed.
+///
+/// @param table The table to resize.  The caller must hold its lock.
+/// @param capacity The new number of slots.  Must be a power of two larger
+///   than the table's size.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int fhtResize(FlatHashTable *table, u64 capacity) {
+  FlatHashTableEntry *entries = (FlatHashTableEntry*) allocatorCalloc(
+    ALLOCATOR_FLAT_HASH_TABLE, table->keyType,
+    capacity, sizeof(FlatHashTableEntry));
+  if (entries == NULL) {
+    LOG_MALLOC_FAILURE();
+    return -1;
+  }
+  
+  for (u64 i = 0; i < table->capacity; i++) {
+    if (table->entries[i].key != NULL) {
+      fhtPlace(entries, capacity, table->entries[i]);
+    }
+  }
+  
+  table->entries = (FlatHashTableEntry*) allocatorFree(
+    ALLOCATOR_FLAT_HASH_TABLE, table->keyType, table->entries);
+  table->entries = entries;
+  table->capacity = capacity;
+  
+  return 0;
+}
+
+/// @fn FlatHashTable *fhtCreate_(TypeDescriptor *keyType, bool disableThreadSafety, u64 size, ...)
+///
+/// @brief Create a flat hash table with the specified type as the key.
+///
+/// @param keyType The TypeDescriptor representing the kind of key to use.
+/// @param disableThreadSafety Whether or not to disable thread safety for the
+///   FlatHashTable.
+/// @param size The number of entries the table should be able to hold before
+///   it has to grow.
+/// @param ... Ignored parameters.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides false for
+/// disableThreadSafety and 0 for the size.
+///
+/// @return Returns a pointer to a new flat hash table on success, NULL on
+///   failure.
+FlatHashTable *fhtCreate_(TypeDescriptor *keyType, bool disableThreadSafety,
+  u64 size, ...
+) {
+  printLog(TRACE, "ENTER fhtCreate(keyType=%s)\n",
+    (keyType != NULL) ? keyType->name : "NULL");
+  
+  if (keyType == NULL) {
+    printLog(ERR, "NULL keyType provided to fhtCreate.  Cannot create table.\n");
+    printLog(TRACE, "EXIT fhtCreate(keyType=%s) = {NULL}\n", "NULL");
+    return NULL;
+  }
+  
+  FlatHashTable *table = (FlatHashTable*)
+    allocatorCalloc(ALLOCATOR_FLAT_HASH_TABLE, NULL, 1, sizeof(FlatHashTable));
+  if (table == NULL) {
+    LOG_MALLOC_FAILURE();
+    printLog(NEVER, "EXIT fhtCreate(keyType=%s) = {NULL}\n", keyType->name);
+    return NULL;
+  }
+  
+  u64 capacity = FLAT_HASH_TABLE_MIN_CAPACITY;
+  while ((capacity * FLAT_HASH_TABLE_MAX_LOAD_PERCENTAGE) / 100 < size) {
+    capacity <<= 1;
+  }
+  table->entries = (FlatHashTableEntry*) allocatorCalloc(
+    ALLOCATOR_FLAT_HASH_TABLE, keyType, capacity, sizeof(FlatHashTableEntry));
+  if (table->entries == NULL) {
+    LOG_MALLOC_FAILURE();
+    table = (FlatHashTable*)
+      allocatorFree(ALLOCATOR_FLAT_HASH_TABLE, NULL, table);
+    printLog(NEVER, "EXIT fhtCreate(keyType=%s) = {NULL}\n", keyType->name);
+    return NULL;
+  }
+  table->capacity = capacity;
+  table->keyType = keyType;
+  table->seed = hashCreateSeed();
+  
+  if (disableThreadSafety == false) {
+    table->lock = (mtx_t*)
+      allocatorCalloc(ALLOCATOR_FLAT_HASH_TABLE, NULL, 1, sizeof(mtx_t));
+    if (mtx_init(table->lock, mtx_plain | mtx_recursive) != thrd_success) {
+      printLog(ERR, "Could not initialize table mutex lock.\n");
+    }
+  }
+  
+  printLog(TRACE, "EXIT fhtCreate(keyType=%s) = {%p}\n", keyType->name, table);
+  return table;
+}
+
+/// @fn i32 fhtClear(FlatHashTable *table)
+///
+/// @brief Destroy all the entries of a FlatHashTable but do not destroy the
+///   FlatHashTable object or release its slots.
+///
+/// @param table A pointer to a FlatHashTable object to clear.
+///
+/// @return Returns 0 on success, -1 on failure.
+i32 fhtClear(FlatHashTable *table) {
+  printLog(TRACE, "ENTER fhtClear(table=%p)\n", table);
+  
+  i32 returnValue = 0;
+  if (table == NULL) {
+    // No-op.
+    printLog(TRACE, "EXIT fhtClear(table=%p) = {%d}\n", table, returnValue);
+    return returnValue;
+  }
+  
+  if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  
+  for (u64 i = 0; (i < table->capacity) && (table->size > 0); i++) {
+    FlatHashTableEntry *entry = &table->entries[i];
+    if (entry->key != NULL) {
+      table->keyType->destroy(entry->key);
+      entry->type->destroy(entry->value);
+      table->size--;
+    }
+  }
+  memset(table->entries, 0, table->capacity * sizeof(FlatHashTableEntry));
+  table->size = 0;
+  
+  if (table->lock != NULL) {
+    mtx_unlock(table->lock);
+  }
+  
+  printLog(TRACE, "EXIT fhtClear(table=%p) = {%d}\n", table, returnValue);
+  return returnValue;
+}
+
+/// @fn FlatHashTable* fhtDestroy(FlatHashTable *table)
+///
+/// @brief Deallocate a previously allocated flat hash table and all of its
+///   entries.
+///
+/// @param table The table to deallocate.
+///
+/// @return Returns NULL on success, pointer to the table on failure.
+FlatHashTable* fhtDestroy(FlatHashTable *table) {
+  printLog(TRACE, "ENTER fhtDestroy(table=%p)\n", table);
+  
+  if (table == NULL) {
+    // Don't print out an error here.  Just return silently.
+    printLog(TRACE, "EXIT fhtDestroy(table=%p) = {NULL}\n", table);
+    return NULL;
+  }
+  
+  // Make sure we're not deleting while someone else is accessing.
+  if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  
+  fhtClear(table);
+  table->entries = (FlatHashTableEntry*) allocatorFree(
+    ALLOCATOR_FLAT_HASH_TABLE, table->keyType, table->entries);
+  
+  if (table->lock != NULL) {
+    mtx_unlock(table->lock);
+    mtx_destroy(table->lock);
+  }
+  table->lock = (mtx_t*)
+    allocatorFree(ALLOCATOR_FLAT_HASH_TABLE, NULL, table->lock);
+  
+  table = (FlatHashTable*)
+    allocatorFree(ALLOCATOR_FLAT_HASH_TABLE, NULL, table);
+  
+  printLog(TRACE, "EXIT fhtDestroy(table=%p) = {NULL}\n", table);
+  return NULL;
+}
+
+/// @fn FlatHashTableEntry *fhtAddEntry_(FlatHashTable *table, const volatile void *key, const volatile void *value, TypeDescriptor *type, ...)
+///
+/// @brief Add a new entry (key-value pair) to an existing flat hash table.
+///
+/// @param table is the flat hash table to add a new entry into.
+/// @param key is the key for the entry.
+/// @param value is the value for the entry.
+/// @param type is the TypeDescriptor used to describe the value provided.
+///
+/// @note This function is wrapped by a define of the same name, minus the
+/// leading underscore.  The type parameter is optional when the define is
+/// used.
+///
+/// @note Unlike HashTable, a FlatHashTable holds at most one entry per key.
+/// If the key is already present, its value is destroyed and replaced.
+///
+/// @return Returns a pointer to the entry on success, NULL on failure.  The
+///   pointer is only valid until the next add or remove on the table.
+FlatHashTableEntry *fhtAddEntry_(FlatHashTable *table,
+  const volatile void *key, const volatile void *value,
+  TypeDescriptor *type, ...
+) {
+  printLog(TRACE, "ENTER fhtAddEntry(table=%p, key=%p, value=%p, type=%s)\n",
+    table, key, value, (type != NULL) ? type->name : "NULL");
+  
+  // Parameter check
+  if ((table == NULL) || (key == NULL)) {
+    printLog(ERR, "One or more NULL parameters.\n");
+    printLog(TRACE,
+      "EXIT fhtAddEntry(table=%p, key=%p, value=%p, type=%s) = {%p}\n",
+      table, key, value, (type != NULL) ? type->name : "NULL", (void*) NULL);
+    return NULL;
+  }
+  if (type == NULL) {
+    if (table->lastAddedType != NULL) {
+      type = table->lastAddedType;
+      printLog(DEBUG, "Defaulting to type of last added element.\n");
+    } else {
+      type = table->keyType;
+      printLog(DEBUG, "Defaulting to type of key.\n");
+    }
+  }
+  
+  if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  
+  u64 hash = fhtMixHash(htHashValue(table->keyType, key, table->seed));
+  FlatHashTableEntry *entry = fhtFind(table, key, hash);
+  if (entry != NULL) {
+    // Replace the value in place.
+    entry->type->destroy(entry->value);
+    entry->value = type->copy(value);
+    entry->type = type;
+  } else {
+    if (((table->size + 1) * 100)
+      > (table->capacity * FLAT_HASH_TABLE_MAX_LOAD_PERCENTAGE)
+    ) {
+      if ((fhtResize(table, table->capacity << 1) != 0)
+        && (table->size + 1 >= table->capacity)
+      ) {
+        // There must always be at least one empty slot to terminate probes.
+        printLog(ERR, "Could not grow table to add new entry.\n");
+        if (table->lock != NULL) {
+          mtx_unlock(table->lock);
+        }
+        printLog(TRACE,
+          "EXIT fhtAddEntry(table=%p, key=%p, value=%p, type=%s) = {%p}\n",
+          table, key, value, type->name, (void*) NULL);
+        return NULL;
+      }
+    }
+    
+    FlatHashTableEntry newEntry;
+    newEntry.value = type->copy(value);
+    newEntry.type = type;
+    newEntry.key = table->keyType->copy(key);
+    newEntry.hash = hash;
+    entry = fhtPlace(table->entries, table->capacity, newEntry);
+    table->size++;
+  }
+  
+  // If we made it this far then the add was successful.  Record the type for
+  // future use if desired.
+  table->lastAddedType = type;
+  
+  if (table->lock != NULL) {
+    mtx_unlock(table->lock);
+  }
+  
+  printLog(TRACE,
+    "EXIT fhtAddEntry(table=%p, key=%p, value=%p, type=%s) = {%p}\n",
+    table, key, value, type->name, entry);
+  return entry;
+}
+
+/// @fn FlatHashTableEntry *fhtGetEntry(const FlatHashTable *table, const volatile void *key)
+///
+/// @brief Retrieve a previously-added entry from a flat hash table.
+///
+/// @param table is the flat hash table of interest.
+/// @param key is the key for the value of interest.
+///
+/// @return Returns the matching entry on success, NULL on failure.  The
+///   pointer is only valid until the next add or remove on the table.
+FlatHashTableEntry *fhtGetEntry(const FlatHashTable *table,
+  const volatile void *key
+) {
+  printLog(TRACE, "ENTER fhtGetEntry(table=%p, key=%p)\n", table, key);
+  
+  if ((table == NULL) || (key == NULL)) {
+    printLog(TRACE, "EXIT fhtGetEntry(table=%p, key=%p) = {%p}\n",
+      table, key, (void*) NULL);
+    return NULL;
+  }
+  
+  if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  
+  FlatHashTableEntry *returnValue = fhtFind(table, key,
+    fhtMixHash(htHashValue(table->keyType, key, table->seed)));
+  
+  if (table->lock != NULL) {
+    mtx_unlock(table->lock);
+  }
+  
+  printLog(TRACE, "EXIT fhtGetEntry(table=%p, key=%p) = {%p}\n",
+    table, key, returnValue);
+  return returnValue;
+}
+
+/// @fn void *fhtGetValue(const FlatHashTable *table, const volatile void *key)
+///
+/// @brief Get the value of an entry in a flat hash table, if any.
+///
+/// @param table is the flat hash table of interest.
+/// @param key is the key for the value of interest.
+///
+/// @return Returns the value of the corresponding entry on success, NULL on
+/// failure.
+void *fhtGetValue(const FlatHashTable *table, const volatile void *key) {
+  printLog(TRACE, "ENTER fhtGetValue(table=%p, key=%p)\n", table, key);
+  
+  void *returnValue = NULL;
+  FlatHashTableEntry *entry = fhtGetEntry(table, key);
+  if (entry != NULL) {
+    returnValue = (void*) entry->value;
+  }
+  
+  printLog(TRACE, "EXIT fhtGetValue(table=%p, key=%p) = {%p}\n",
+    table, key, returnValue);
+  return returnValue;
+}
+
+/// @fn i32 fhtRemoveEntry(FlatHashTable *table, const volatile void *key)
+///
+/// @brief Remove a previously-added entry from a flat hash table.
+///
+/// @details The entries that follow the removed one in its probe sequence are
+///   shifted back by one slot so that no tombstones are needed.
+///
+/// @param table is the table to remove the entry from.
+/// @param key is the key of the value to remove.
+///
+/// @return Returns 0 on success.  Any other value is failure.
+i32 fhtRemoveEntry(FlatHashTable *table, const volatile void *key) {
+  printLog(TRACE, "ENTER fhtRemoveEntry(table=%p, key=%p)\n", table, key);
+  
+  if ((table == NULL) || (key == NULL)) {
+    printLog(ERR, "One or more NULL parameters.\n");
+    printLog(TRACE, "EXIT fhtRemoveEntry(table=%p, key=%p) = {-1}\n",
+      table, key);
+    return -1;
+  }
+  
+  if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  
+  FlatHashTableEntry *entry = fhtFind(table, key,
+    fhtMixHash(htHashValue(table->keyType, key, table->seed)));
+  if (entry != NULL) {
+    table->keyType->destroy(entry->key);
+    entry->type->destroy(entry->value);
+    
+    u64 mask = table->capacity - 1;
+    u64 slot = (u64) (entry - table->entries);
+    u64 next = (slot + 1) & mask;
+    while ((table->entries[next].key != NULL)
+      && (fhtProbeDistance(table, next) > 0)
+    ) {
+      table->entries[slot] = table->entries[next];
+      slot = next;
+      next = (next + 1) & mask;
+    }
+    memset(&table->entries[slot], 0, sizeof(FlatHashTableEntry));
+    table->size--;
+  }
+  
+  if (table->lock != NULL) {
+    mtx_unlock(table->lock);
+  }
+  
+  printLog(TRACE, "EXIT fhtRemoveEntry(table=%p, key=%p) = {0}\n", table, key);
+  return 0;
+}
+
+/// @fn FlatHashTableEntry *fhtNextEntry(const FlatHashTable *table, const FlatHashTableEntry *entry)
+///
+/// @brief Iterate over the entries of a flat hash table.
+///
+/// @param table The table to iterate over.
+/// @param entry The entry returned by the previous call or NULL to get the
+///   first entry.
+///
+/// @note Entries are visited in slot order, not insertion order.  The caller
+/// must guarantee that the table is not modified during the iteration.  There
+/// are no mutex locks in this function.
+///
+/// @return Returns the next entry in the table or NULL when there are no more.
+FlatHashTableEntry *fhtNextEntry(const FlatHashTable *table,
+  const FlatHashTableEntry *entry
+) {
+  if (table == NULL) {
+    return NULL;
+  }
+  
+  u64 slot = (entry != NULL) ? ((u64) (entry - table->entries)) + 1 : 0;
+  for (; slot < table->capacity; slot++) {
+    if (table->entries[slot].key != NULL) {
+      return &table->entries[slot];
+    }
+  }
+  
+  return NULL;
+}
+
+/// @fn char *fhtToString(const FlatHashTable *table)
+///
+/// @brief Create a string representation of the flat hash table.
+///
+/// @param table The table to represent as a string.
+///
+/// @return Returns a C string representing the table on success,
+///   NULL on failure.
+char *fhtToString(const FlatHashTable *table) {
+  printLog(TRACE, "ENTER fhtToString(table=%p)\n", table);
+  
+  char *returnValue = NULL;
+  
+  if (table == NULL) {
+    straddstr(&returnValue, "");
+    printLog(TRACE, "EXIT fhtToString(table=%p) = {%s}\n", table, returnValue);
+    return returnValue;
+  }
+  
+  if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  
+  if (asprintf(&returnValue, "{\n  size=%llu\n  capacity=%llu\n  keyType=%s",
+    llu(table->size), llu(table->capacity), table->keyType->name) < 0
+  ) {
+    printLog(ERR, "Cannot allocate memory for return value.\n");
+    if (table->lock != NULL) {
+      mtx_unlock(table->lock);
+    }
+    printLog(TRACE, "EXIT fhtToString(table=%p) = {%p}\n", table, returnValue);
+    return NULL;
+  }
+  
+  for (FlatHashTableEntry *entry = fhtNextEntry(table, NULL);
+    entry != NULL;
+    entry = fhtNextEntry(table, entry)
+  ) {
+    straddstr(&returnValue, "\n  {\n");
+    straddstr(&returnValue, "    valueType=");
+    straddstr(&returnValue, entry->type->name);
+    straddstr(&returnValue, "\n");
+    
+    straddstr(&returnValue, "    key={\n");
+    char *keyString = NULL;
+    if (table->keyType == typeString) {
+      straddchr(&keyString, '"');
+      straddstr(&keyString, str(entry->key));
+      straddchr(&keyString, '"');
+    } else {
+      keyString = table->keyType->toString(entry->key);
+    }
+    char *indentedKey = indentText(keyString, 6);
+    keyString = stringDestroy(keyString);
+    straddstr(&returnValue, indentedKey);
+    indentedKey = stringDestroy(indentedKey);
+    straddstr(&returnValue, "\n    }\n");
+    
+    straddstr(&returnValue, "    value={\n");
+    char *valueString = NULL;
+    if (entry->type == typeString) {
+      straddchr(&valueString, '"');
+      straddstr(&valueString, str(entry->value));
+      straddchr(&valueString, '"');
+    } else {
+      valueString = entry->type->toString(entry->value);
+    }
+    char *indentedValue = indentText(valueString, 6);
+    valueString = stringDestroy(valueString);
+    straddstr(&returnValue, indentedValue);
+    indentedValue = stringDestroy(indentedValue);
+    straddstr(&returnValue, "\n    }\n");
+    
+    straddstr(&returnValue, "  }");
+  }
+  straddstr(&returnValue, "\n}");
+  
+  if (table->lock != NULL) {
+    mtx_unlock(table->lock);
+  }
+  
+  printLog(TRACE, "EXIT fhtToString(table=%p) = {%s}\n", table, returnValue);
+  return returnValue;
+}
+
+/// @fn FlatHashTable *fhtCopy(const FlatHashTable *table)
+///
+/// @brief Create a copy of an existing flat hash table.
+///
+/// @param table is the flat hash table to copy.  It is not modified.
+///
+/// @return Returns a newly-allocated copy of the input table on success,
+///   NULL on failure.
+FlatHashTable *fhtCopy(const FlatHashTable *table) {
+  printLog(TRACE, "ENTER fhtCopy(table=%p)\n", table);
+  
+  FlatHashTable *copy = NULL;
+  
+  if (table == NULL) {
+    printLog(ERR, "FlatHashTable provided is NULL.\n");
+    printLog(TRACE, "EXIT fhtCopy(table=%p) = {%p}\n", table, copy);
+    return copy;
+  }
+  
+  if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  
+  copy = fhtCreate(table->keyType, (table->lock == NULL));
+  if ((copy != NULL) && (fhtResize(copy, table->capacity) == 0)) {
+    // Same seed and same capacity means the same slots, so there's no need
+    // to probe.
+    copy->seed = table->seed;
+    for (u64 i = 0; i < table->capacity; i++) {
+      const FlatHashTableEntry *entry = &table->entries[i];
+      if (entry->key != NULL) {
+        copy->entries[i].value = entry->type->copy(entry->value);
+        copy->entries[i].type = entry->type;
+        copy->entries[i].key = table->keyType->copy(entry->key);
+        copy->entries[i].hash = entry->hash;
+      }
+    }
+    copy->size = table->size;
+    copy->lastAddedType = table->lastAddedType;
+  } else {
+    copy = fhtDestroy(copy);
+  }
+  
+  if (table->lock != NULL) {
+    mtx_unlock(table->lock);
+  }
+  
+  printLog(TRACE, "EXIT fhtCopy(table=%p) = {%p}\n", table, copy);
+  return copy;
+}
+
+/// @fn int fhtCompare(const FlatHashTable *tableA, const FlatHashTable *tableB)
+///
+/// @brief Compare the contents of two flat hash tables.
+///
+/// @param tableA,tableB are the flat hash tables to compare.
+///
+/// @return Returns 0 if the contents are the same, non-zero otherwise.
+///
+/// @note Non-zero return values from this function are meaningless other than
+///   that they express that the two tables are not the same.  The capacities
+///   and slot positions of the entries are not considered.
+int fhtCompare(const FlatHashTable *tableA, const FlatHashTable *tableB) {
+  printLog(TRACE, "ENTER fhtCompare(tableA=%p, tableB=%p)\n", tableA, tableB);
+  
+  int returnValue = 0;
+  if (tableA == tableB) {
+    printLog(TRACE, "EXIT fhtCompare(tableA=%p, tableB=%p) = {%d}\n",
+      tableA, tableB, returnValue);
+    return returnValue;
+  } else if (tableA == NULL) {
+    returnValue = -1;
+    printLog(TRACE, "EXIT fhtCompare(tableA=%p, tableB=%p) = {%d}\n",
+      tableA, tableB, returnValue);
+    return returnValue;
+  } else if (tableB == NULL) {
+    returnValue = 1;
+    printLog(TRACE, "EXIT fhtCompare(tableA=%p, tableB=%p) = {%d}\n",
+      tableA, tableB, returnValue);
+    return returnValue;
+  }
+  
+  if ((tableA->lock != NULL) && (mtx_lock(tableA->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  
+  if (tableA->keyType != tableB->keyType) {
+    returnValue = (getIndexFromTypeDescriptor(tableA->keyType)
+      > getIndexFromTypeDescriptor(tableB->keyType)) ? 1 : -1;
+  } else if (tableA->size != tableB->size) {
+    returnValue = (tableA->size > tableB->size) ? 1 : -1;
+  } else {
+    for (FlatHashTableEntry *entryA = fhtNextEntry(tableA, NULL);
+      entryA != NULL;
+      entryA = fhtNextEntry(tableA, entryA)
+    ) {
+      FlatHashTableEntry *entryB = fhtGetEntry(tableB, entryA->key);
+      if (entryB == NULL) {
+        returnValue = 1;
+        break;
+      }
+      
+      i64 typeIndexA = getIndexFromTypeDescriptor(entryA->type);
+      i64 typeIndexB = getIndexFromTypeDescriptor(entryB->type);
+      if (typeIndexA != typeIndexB) {
+        returnValue = (typeIndexA > typeIndexB) ? 1 : -1;
+        break;
+      }
+      
+      returnValue = entryA->type->compare(entryA->value, entryB->value);
+      if (returnValue != 0) {
+        break;
+      }
+    }
+  }
+  
+  if (tableA->lock != NULL) {
+    mtx_unlock(tableA->lock);
+  }
+  
+  printLog(TRACE, "EXIT fhtCompare(tableA=%p, tableB=%p) = {%d}\n",
+    tableA, tableB, returnValue);
+  return returnValue;
+}
+
+/// @fn size_t fhtSize(const volatile void *value)
+///
+/// @brief Compute the size of a flat hash table structure in memory.
+///
+/// @return Returns the size of the table and its slots in bytes.
+size_t fhtSize(const volatile void *value) {
+  size_t size = 0;
+  FlatHashTable *table = (FlatHashTable*) value;
+  printLog(TRACE, "ENTER fhtSize(value=\"%p\")\n", value);
+  
+  if (table != NULL) {
+    size = sizeof(FlatHashTable)
+      + (table->capacity * sizeof(FlatHashTableEntry));
+  }
+  
+  printLog(TRACE, "EXIT fhtSize(value=\"%p\") = {%llu}\n", value, llu(size));
+  return size;
+}
+
+/// @def FLAT_HASH_TABLE_UNIT_TEST
+///
+/// @brief Unit tests for flat hash table functionality.
+/// @details Implementing this as a macro instead of raw code allows this to
+/// be skipped by the code coverage metrics.
+///
+/// @return Returns true on success, false on failure.
+#define FLAT_HASH_TABLE_UNIT_TEST \
+bool flatHashTableUnitTest() { \
+  FlatHashTable *table = NULL, *table2 = NULL; \
+  FlatHashTableEntry *entry = NULL; \
+  char *stringValue = NULL; \
+ \
+  printLog(INFO, "Testing FlatHashTable data structure.\n"); \
+ \
+  table = fhtCreate(NULL); \
+  if (table != NULL) { \
+    printLog(ERR, "Expected NULL from fhtCreate, got %p\n", table); \
+    return false; \
+  } \
+  if (fhtAddEntry(NULL, "key", "value") != NULL) { \
+    printLog(ERR, "fhtAddEntry succeeded with NULL table.\n"); \
+    return false; \
+  } \
+  if (fhtGetEntry(NULL, "key") != NULL) { \
+    printLog(ERR, "fhtGetEntry succeeded with NULL table.\n"); \
+    return false; \
+  } \
+  if (fhtRemoveEntry(NULL, "key") == 0) { \
+    printLog(ERR, "fhtRemoveEntry succeeded with NULL table.\n"); \
+    return false; \
+  } \
+  if (fhtDestroy(NULL) != NULL) { \
+    printLog(ERR, "fhtDestroy(NULL) did not return NULL.\n"); \
+    return false; \
+  } \
+ \
+  table = fhtCreate(typeString); \
+  if (table == NULL) { \
+    printLog(ERR, "Expected table from fhtCreate, got NULL\n"); \
+    return false; \
+  } \
+  if (fhtAddEntry(table, NULL, "value") != NULL) { \
+    printLog(ERR, "fhtAddEntry succeeded with NULL key.\n"); \
+    return false; \
+  } \
+  if (fhtAddEntry(table, "key1", "value1", typeString) == NULL) { \
+    printLog(ERR, "fhtAddEntry failed for key1.\n"); \
+    return false; \
+  } \
+  if (fhtAddEntry(table, "key2", "value2") == NULL) { \
+    printLog(ERR, "fhtAddEntry failed for key2.\n"); \
+    return false; \
+  } \
+  entry = fhtAddEntry(table, "key1", "newValue1"); \
+  if ((entry == NULL) || (table->size != 2)) { \
+    printLog(ERR, "Replacing key1 did not keep the size at 2.\n"); \
+    return false; \
+  } \
+  stringValue = (char*) fhtGetValue(table, "key1"); \
+  if ((stringValue == NULL) || (strcmp(stringValue, "newValue1") != 0)) { \
+    printLog(ERR, "Expected \"newValue1\" for key1, got \"%s\".\n", \
+      (stringValue != NULL) ? stringValue : "NULL"); \
+    return false; \
+  } \
+  if (fhtGetValue(table, "key3") != NULL) { \
+    printLog(ERR, "Found value for key3 that was never added.\n"); \
+    return false; \
+  } \
+  stringValue = fhtToString(table); \
+  if ((stringValue == NULL) || (strstr(stringValue, "newValue1") == NULL)) { \
+    printLog(ERR, "fhtToString did not include newValue1.\n"); \
+    return false; \
+  } \
+  stringValue = stringDestroy(stringValue); \
+  table2 = fhtCopy(table); \
+  if (fhtCompare(table, table2) != 0) { \
+    printLog(ERR, "table and table2 are not equal after fhtCopy.\n"); \
+    return false; \
+  } \
+  if ((fhtRemoveEntry(table2, "key2") != 0) \
+    || (fhtGetEntry(table2, "key2") != NULL) \
+  ) { \
+    printLog(ERR, "fhtRemoveEntry did not remove key2.\n"); \
+    return false; \
+  } \
+  if (fhtCompare(table, table2) == 0) { \
+    printLog(ERR, "table and table2 are equal after fhtRemoveEntry.\n"); \
+    return false; \
+  } \
+  table2 = fhtDestroy(table2); \
+  table = fhtDestroy(table); \
+ \
+  table = fhtCreate(typeI32, true); \
+  for (i32 i = 0; i < 10000; i++) { \
+    if (fhtAddEntry(table, &i, &i, typeI32) == NULL) { \
+      printLog(ERR, "fhtAddEntry failed for %d.\n", i); \
+      return false; \
+    } \
+  } \
+  if ((table->size != 10000) || (table->capacity < 10000)) { \
+    printLog(ERR, "Table did not grow correctly.  size=%llu, capacity=%llu\n", \
+      llu(table->size), llu(table->capacity)); \
+    return false; \
+  } \
+  for (i32 i = 0; i < 10000; i += 2) { \
+    fhtRemoveEntry(table, &i); \
+  } \
+  for (i32 i = 0; i < 10000; i++) { \
+    i32 *i32Value = (i32*) fhtGetValue(table, &i); \
+    if ((i & 1) && ((i32Value == NULL) || (*i32Value != i))) { \
+      printLog(ERR, "Value for %d was not found.\n", i); \
+      return false; \
+    } else if (((i & 1) == 0) && (i32Value != NULL)) { \
+      printLog(ERR, "Value for %d was found after removal.\n", i); \
+      return false; \
+    } \
+  } \
+  u64 numEntries = 0; \
+  for (entry = fhtNextEntry(table, NULL); entry != NULL; \
+    entry = fhtNextEntry(table, entry) \
+  ) { \
+    numEntries++; \
+  } \
+  if ((numEntries != 5000) || (table->size != 5000)) { \
+    printLog(ERR, "Expected 5000 entries, iterated %llu, size %llu.\n", \
+      llu(numEntries), llu(table->size)); \
+    return false; \
+  } \
+  if (fhtSize(table) <= sizeof(FlatHashTable)) { \
+    printLog(ERR, "fhtSize did not account for the slots.\n"); \
+    return false; \
+  } \
+  fhtClear(table); \
+  if ((table->size != 0) || (fhtNextEntry(table, NULL) != NULL)) { \
+    printLog(ERR, "fhtClear did not remove all entries.\n"); \
+    return false; \
+  } \
+  if (fhtAdd(table, (i32) 5, (i32) 7) == NULL) { \
+    printLog(ERR, "Type-safe fhtAdd failed for an i32 table.\n"); \
+    return false; \
+  } \
+  if (fhtAdd(table, (i64) 5, (i32) 7) != NULL) { \
+    printLog(ERR, "Type-safe fhtAdd accepted an i64 key for an i32 table.\n"); \
+    return false; \
+  } \
+  i32 i32Key = 5; \
+  if ((fhtGetValue(table, &i32Key) == NULL) \
+    || (*((i32*) fhtGetValue(table, &i32Key)) != 7) \
+  ) { \
+    printLog(ERR, "Value added with fhtAdd was not found.\n"); \
+    return false; \
+  } \
+  table = fhtDestroy(table); \
+ \
+  return true; \
+}
+FLAT_HASH_TABLE_UNIT_TEST
+
@@ -41,8 +41,105 @@
 #include "HashTable.h"
 #include "Vector.h"
 #include "Scope.h"
+#include "LockStats.h"
 
-/// @fn HashTable *htCreate_(TypeDescriptor *keyType, bool disableThreadSafety, u64 size, ...)
+/// @fn static void htInitLockStripes(HashTable *table, u64 lockStripes)
+///
+/// @brief Allocate and initialize the lock stripes of a newly-created table.
+///
+/// @details The size of the table is rounded up to a multiple of the number
+///   of stripes.  Since the number of stripes is a power of two and tables
+///   only ever double in size, every key in a tree then has the same hash
+///   modulo the number of stripes, before and after any resize, and the
+///   stripe of a key can be computed from its hash alone.
+///
+/// @param table The table being created.  Its tree array is reallocated if
+///   its size changes.
+/// @param lockStripes The requested number of stripes.
+///
+/// @return This function returns no value.  If the stripes cannot be
+///   allocated, the table falls back to its mutex.
+static void htInitLockStripes(HashTable *table, u64 lockStripes) {
+  u64 numLockStripes = 1;
+  while ((numLockStripes < lockStripes)
+    && (numLockStripes < HASH_TABLE_MAX_LOCK_STRIPES)
+  ) {
+    numLockStripes <<= 1;
+  }
+  
+  u64 tableSize = ((table->tableSize + numLockStripes - 1) / numLockStripes)
+    * numLockStripes;
+  if (tableSize != table->tableSize) {
+    RedBlackTree **newTable = (RedBlackTree**) allocatorCalloc(
+      ALLOCATOR_HASH_TABLE, NULL, tableSize, sizeof(RedBlackTree*));
+    if (newTable == NULL) {
+      LOG_MALLOC_FAILURE();
+      return;
+    }
+    table->table = (RedBlackTree**)
+      allocatorFree(ALLOCATOR_HASH_TABLE, NULL, table->table);
+    table->table = newTable;
+    table->tableSize = tableSize;
+  }
+  
+  table->lockStripes = (HashTableLockStripe*) allocatorCalloc(
+    ALLOCATOR_HASH_TABLE, NULL, numLockStripes, sizeof(HashTableLockStripe));
+  if (table->lockStripes == NULL) {
+    LOG_MALLOC_FAILURE();
+    return;
+  }
+  for (u64 i = 0; i < numLockStripes; i++) {
+    if (rwl_init(&table->lockStripes[i].lock) != thrd_success) {
+      printLog(ERR, "Could not initialize table lock stripe.\n");
+    }
+  }
+  table->numLockStripes = numLockStripes;
+}
+
+/// @fn static inline rwl_t *htLockStripe(const HashTable *table, u64 hash)
+///
+/// @brief Get the lock stripe that guards the tree of a key.
+///
+/// @param table The table of interest.  It must be lock-striped.
+/// @param hash The full hash of the key as returned by htHashValue.
+///
+/// @return Returns a pointer to the reader/writer lock for the key.
+static inline rwl_t *htLockStripe(const HashTable *table, u64 hash) {
+  return &table->lockStripes[hash & (table->numLockStripes - 1)].lock;
+}
+
+/// @fn static void htLockAllStripes(HashTable *table)
+///
+/// @brief Hold every stripe of a lock-striped table exclusive.  This is
+///   needed whenever a change is made that could affect keys in more than one
+///   stripe, such as swapping or migrating the tree arrays of the table.
+///
+/// @param table The table to lock.  The caller must hold its mutex, which
+///   also guarantees that the stripes are always taken in the same order.
+///
+/// @return This function returns no value.
+static void htLockAllStripes(HashTable *table) {
+  for (u64 i = 0; i < table->numLockStripes; i++) {
+    if (rwl_wrlock(&table->lockStripes[i].lock) != thrd_success) {
+      printLog(WARN, "Could not lock table lock stripe.\n");
+    }
+  }
+}
+
+/// @fn static void htUnlockAllStripes(HashTable *table)
+///
+/// @brief Release the stripes taken by htLockAllStripes.
+///
+/// @param table The table to unlock.
+///
+/// @return This function returns no value.
+static void htUnlockAllStripes(HashTable *table) {
+  for (u64 i = 0; i < table->numLockStripes; i++) {
+    rwl_wrunlock(&table->lockStripes[i].lock);
+  }
+}
+
+/// @fn HashTable *htCreate_(TypeDescriptor *keyType, bool disableThreadSafety, u64 size, u64 lockStripes, bool unlinkedNodes, ...)
 ///
 /// @brief Create a hash table with the specified type as the key.
 ///
@@ -50,14 +147,28 @@
 /// @param disableThreadSafety Whether or not to disable thread safety for the
 ///   HashTable.
 /// @param size The minimum size for the hash table.
+/// @param lockStripes The number of reader/writer locks to spread the trees of
+///   the table across.  0 (the default) guards the whole table with its single
+///   mutex.  Any other value lets lookups of keys in different stripes run
+///   completely independently of each other and lookups of keys in the same
+///   stripe run concurrently.  This is rounded up to a power of two and caps
+///   at HASH_TABLE_MAX_LOCK_STRIPES.  Ignored if disableThreadSafety is true.
+/// @param unlinkedNodes Whether or not to skip keeping the nodes of the table
+///   on its head/tail list in insertion order.  Tables that are only used for
+///   lookups should set this to save two pointer updates on every add and
+///   remove.  Functions that walk the whole table, such as htToJson and
+///   htCopy, then see the entries in bucket order instead.  Code that walks
+///   table->head itself must call htLinkNodes first.
 /// @param ... Ignored parameters.
 ///
 /// @note This function is wrapped by a macro of the same name (minus the
 /// trailing underscore) that automatically provides false for
-/// disableThreadSafety and 0 for the size.
+/// disableThreadSafety and unlinkedNodes and 0 for the size and lockStripes.
 ///
 /// @return Returns a pointer to a new hash table on success, NULL on failure.
-HashTable *htCreate_(TypeDescriptor *keyType, bool disableThreadSafety, u64 size, ...) {
+HashTable *htCreate_(TypeDescriptor *keyType, bool disableThreadSafety,
+  u64 size, u64 lockStripes, bool unlinkedNodes, ...
+) {
   printLog(TRACE, "ENTER htCreate(keyType=%s)\n", (keyType != NULL) ? keyType->name : "NULL");
   
   // Make sure we have sensible parameters.
@@ -68,7 +179,8 @@ HashTable *htCreate_(TypeDescriptor *keyType, bool disableThreadSafety, u64 size
   }
   
   // Allocate all the memory...
-  HashTable *table = (HashTable*) calloc(1, sizeof(HashTable));
+  HashTable *table = (HashTable*)
+    allocatorCalloc(ALLOCATOR_HASH_TABLE, NULL, 1, sizeof(HashTable));
   if (size == 0) {
     table->tableSize = OPTIMAL_HASH_TABLE_SIZE;
   } else if (size < REGISTER_BIT_WIDTH) {
@@ -76,16 +188,22 @@ HashTable *htCreate_(TypeDescriptor *keyType, bool disableThreadSafety, u64 size
   } else {
     table->tableSize = size;
   }
-  table->table = (RedBlackTree**)
-    calloc(1, table->tableSize * sizeof(RedBlackTree*));
+  table->table = (RedBlackTree**) allocatorCalloc(
+    ALLOCATOR_HASH_TABLE, NULL, table->tableSize, sizeof(RedBlackTree*));
   
   // Initialize everything that shouldn't be NULL.
   table->keyType = keyType;
+  table->seed = hashCreateSeed();
+  table->unlinked = unlinkedNodes;
   if (disableThreadSafety == false) {
-    table->lock = (mtx_t*) calloc(1, sizeof(mtx_t));
+    table->lock = (mtx_t*)
+      allocatorCalloc(ALLOCATOR_HASH_TABLE, NULL, 1, sizeof(mtx_t));
     if (mtx_init(table->lock, mtx_plain | mtx_recursive) != thrd_success) {
       printLog(ERR, "Could not initialize table mutex lock.\n");
     }
+    if (lockStripes > 0) {
+      htInitLockStripes(table, lockStripes);
+    }
   }
   
   printLog(TRACE, "EXIT htCreate(keyType=%s) = {%p}\n", keyType->name, table);
@@ -121,8 +239,18 @@ HashTable* htDestroy(HashTable *table) {
       rbTreeDestroy(table->table[i]);
     }
   }
+  if (table->oldTable != NULL) {
+    for (u64 i = table->rehashIndex; i < table->oldTableSize; i++) {
+      if (table->oldTable[i] != NULL) {
+        rbTreeDestroy(table->oldTable[i]);
+      }
+    }
+  }
   
-  table->table = (RedBlackTree**) pointerDestroy(table->table);
+  table->table = (RedBlackTree**)
+    allocatorFree(ALLOCATOR_HASH_TABLE, NULL, table->table);
+  table->oldTable = (RedBlackTree**)
+    allocatorFree(ALLOCATOR_HASH_TABLE, NULL, table->oldTable);
   
   if (table->filePointer != NULL) {
     fclose(table->filePointer); table->filePointer = NULL;
@@ -134,19 +262,74 @@ HashTable* htDestroy(HashTable *table) {
   if (table->lock != NULL) {
     mtx_destroy(table->lock);
   }
-  table->lock = (mtx_t*) pointerDestroy(table->lock);
+  table->lock = (mtx_t*)
+    allocatorFree(ALLOCATOR_HASH_TABLE, NULL, table->lock);
+  for (u64 i = 0; i < table->numLockStripes; i++) {
+    rwl_destroy(&table->lockStripes[i].lock);
+  }
+  table->lockStripes = (HashTableLockStripe*)
+    allocatorFree(ALLOCATOR_HASH_TABLE, NULL, table->lockStripes);
   
-  table = (HashTable*) pointerDestroy(table);
+  table = (HashTable*) allocatorFree(ALLOCATOR_HASH_TABLE, NULL, table);
   
   printLog(TRACE, "EXIT htDestroy(table=%p) = {NULL}\n", table);
   return NULL;
 }
 
-/// @fn u6y4 htGetHash(const HashTable *table, const volatile void *rawKey)
+/// @fn u64 htHashValue(TypeDescriptor *keyType, const volatile void *rawKey, u64 seed)
+///
+/// @brief Calculate the full hash value of a provided key.  Keys whose type
+/// does not provide a hashFunction are hashed a word at a time with
+/// hashMemory.
+///
+/// @param keyType is the TypeDescriptor describing the key.  If it provides a
+///   hashFunction, that function is used instead.
+/// @param rawKey is the key of interest.
+/// @param seed is the seed of the table the key is being hashed for.
+///
+/// @return Returns the full hash of the key.  This value is not reduced by the
+///   size of any table, which allows a HashTable to compute the index of the
+///   key in both its current and its old tree arrays and allows other
+///   containers to share the same hash.
+u64 htHashValue(TypeDescriptor *keyType, const volatile void *rawKey, u64 seed) {
+  printLog(TRACE, "ENTER htHashValue(keyType=%p, rawKey=%p, seed=%llu)\n",
+    keyType, rawKey, llu(seed));
+  
+  u64 hash = 0;
+  
+  if (keyType->hashFunction != NULL) {
+    hash = keyType->hashFunction(rawKey, seed);
+    printLog(TRACE,
+      "EXIT htHashValue(keyType=%p, rawKey=%p, seed=%llu) = {%llu}\n",
+      keyType, rawKey, llu(seed), llu(hash));
+    return hash;
+  }
+  
+  // Only the primitive types store their data directly, so checking
+  // dataIsPointer first avoids searching the type descriptor table for them.
+  i64 keyTypeIndex = 0;
+  if (keyType->dataIsPointer == true) {
+    keyTypeIndex = getIndexFromTypeDescriptor(keyType);
+  }
+  if ((keyType->dataIsPointer == false)
+    || ((keyTypeIndex < getIndexFromTypeDescriptor(typeList))
+      && (keyTypeIndex > 0))
+  ) { // key type is primitive
+    hash = hashMemory(rawKey, keyType->size(rawKey), seed);
+  } else { // key type is non-primitive
+    Bytes key = keyType->toBlob(rawKey);
+    hash = hashMemory(key, bytesLength(key), seed);
+    key = bytesDestroy(key);
+  }
+  
+  printLog(TRACE, "EXIT htHashValue(keyType=%p, rawKey=%p, seed=%llu) = {%llu}\n",
+    keyType, rawKey, llu(seed), llu(hash));
+  return hash;
+}
+
+/// @fn u64 htGetHash(const HashTable *table, const volatile void *rawKey)
 ///
-/// @brief Calculate a hash value of a provided key.  This is an
-/// implementation of the Jenkins one_at_a_time hash function, described
-/// at https://en.wikipedia.org/wiki/Jenkins_hash_function
+/// @brief Calculate a hash value of a provided key.
 ///
 /// @param table is the table of interest.
 /// @param rawKey is the key of interest.
@@ -156,140 +339,187 @@ HashTable* htDestroy(HashTable *table) {
 u64 htGetHash(const HashTable *table, const volatile void *rawKey) {
   printLog(TRACE, "ENTER htGetHash(table=%p, rawKey=%p)\n", table, rawKey);
   
-  u64 length = 0;
-  Bytes key = NULL;
-  bool keyCopied = false;
-  u64 hash = 0;
-  
   if ((table == NULL) || (rawKey == NULL)) {
     printLog(TRACE, "EXIT htGetHash(table=%p, rawKey=%p) = {%llu}\n",
       table, rawKey, 0ULL);
     return 0;
   }
   
-  if (table->keyType->hashFunction != NULL) {
-    u64 returnValue
-      = table->keyType->hashFunction(rawKey) % table->tableSize;
-    printLog(DEBUG, "tableSize = %llu\n", llu(table->tableSize));
-    printLog(TRACE, "EXIT htGetHash(table=%p, rawKey=%p) = {%llu}\n",
-      table, rawKey, llu(returnValue));
-    return returnValue;
+  u64 returnValue = htHashValue(table->keyType, rawKey, table->seed) % table->tableSize;
+  printLog(DEBUG, "tableSize = %llu\n", llu(table->tableSize));
+  
+  printLog(TRACE, "EXIT htGetHash(table=%p, rawKey=%p) = {%llu}\n",
+    table, rawKey, llu(returnValue));
+  return returnValue;
+}
+
+/// @fn static RedBlackTree **htGetTree(const HashTable *table, u64 hash)
+///
+/// @brief Get the slot of the tree that holds (or would hold) the key with the
+///   provided hash.
+///
+/// @details While a resize is in progress, keys whose old trees have not yet
+///   been migrated still live in oldTable.  Everything else lives in table.
+///
+/// @param table is the table of interest.
+/// @param hash is the full hash of the key as returned by htHashValue.
+///
+/// @return Returns a pointer to the tree pointer for the key.  The tree
+///   pointer itself may be NULL.
+static RedBlackTree **htGetTree(const HashTable *table, u64 hash) {
+  if (table->oldTable != NULL) {
+    u64 oldIndex = hash % table->oldTableSize;
+    if (oldIndex >= table->rehashIndex) {
+      return &table->oldTable[oldIndex];
+    }
   }
   
-  i64 keyTypeIndex = getIndexFromTypeDescriptor(table->keyType);
-  if ((keyTypeIndex < getIndexFromTypeDescriptor(typeList)) && (keyTypeIndex > 0)
-  ) { // key type is primitive
-    key = (Bytes) rawKey;
-    length = table->keyType->size(rawKey);
-  } else { // key type is non-primitive
-    key = table->keyType->toBlob(rawKey);
-    length = bytesLength(key);
-    keyCopied = true;
+  return &table->table[hash % table->tableSize];
+}
+
+/// @fn static inline RedBlackTree* htCreateTree(HashTable *table)
+///
+/// @brief Create one of the red-black trees that make up the buckets of a
+///   table.
+///
+/// @details The table allocates the nodes of its trees and the trees free
+///   them, so the trees are told to count their nodes against the table.
+///
+/// @param table is the table the tree is for.
+///
+/// @return Returns the new tree on success, NULL on failure.
+static inline RedBlackTree* htCreateTree(HashTable *table) {
+  RedBlackTree *tree = rbTreeCreate(table->keyType, true);
+  if (tree != NULL) {
+    tree->nodeSubsystem = ALLOCATOR_HASH_TABLE;
   }
   
-  for (u64 i = 0; i != length; ++i) {
-    hash += key[i];
-    hash += hash << 10;
-    hash ^= hash >> 6;
+  return tree;
+}
+
+/// @fn static void htMigrateNodes(HashTable *table, RedBlackTree *tree, RedBlackNode *x)
+///
+/// @brief Move the nodes of an old tree into the trees of the current table
+///   postorder.
+///
+/// @details The nodes themselves are reused.  Only their tree linkage is
+///   changed, so the table's linked list of nodes remains valid throughout.
+///
+/// @param table is the table being resized.
+/// @param tree is the old tree being emptied.
+/// @param x is the current node.
+///
+/// @return This function returns no value.
+static void htMigrateNodes(HashTable *table, RedBlackTree *tree,
+  RedBlackNode *x
+) {
+  if (x == tree->nil) {
+    return;
   }
-   
-  hash += hash << 3;
-  hash ^= hash >> 11;
-  hash += hash << 15;
   
-  u64 returnValue = hash % table->tableSize;
+  htMigrateNodes(table, tree, x->left);
+  htMigrateNodes(table, tree, x->right);
   
-  if (keyCopied == true) {
-    key = bytesDestroy(key);
+  u64 index = htHashValue(table->keyType, x->key, table->seed) % table->tableSize;
+  if (table->table[index] == NULL) {
+    table->table[index] = htCreateTree(table);
   }
-  
-  printLog(TRACE, "EXIT htGetHash(table=%p, rawKey=%p) = {%llu}\n",
-    table, rawKey, llu(returnValue));
-  return returnValue;
+  rbTreeInsertNode(table->table[index], x);
 }
 
-/// @fn static int updateTreeLinks(HashTable *table, u64 index)
+/// @fn static void htRehashStep(HashTable *table)
 ///
-/// @brief Fix the links of a table when a tree is updated.
+/// @brief Migrate up to HASH_TABLE_REHASH_STEP_SIZE trees from oldTable into
+///   table if a resize is in progress.
 ///
-/// @param table The HashTable to update.
-/// @param index The index of the RedBlackTree that was updated.
+/// @details Empty slots are cheap to skip but a sparse old table could still
+///   make a single step long, so the number of empty slots visited per step
+///   is also bounded.
 ///
-/// @return Returns 0 on success, -1 on failure.
-int updateTreeLinks(HashTable *table, u64 index) {
-  printLog(TRACE, "ENTER updateTreeLinks(table=%p, index=%llu)\n", table, llu(index));
-  
-  // This function is only called from htAddEntry, which guarantees that the
-  // arguments are correct, so no need to check them.  We also are guaranteed
-  // that there's at least one other tree in the table, so no need to check for
-  // that either.
-  
-  // When a RedBlackTree has a new node inserted, tree->head->prev will be
-  // NULL if the newly-inserted node is the new tree->head and tree->tail->next
-  // will be NULL if the newly-inserted node is the new tree->tail.  If niether
-  // is NULL, we have nothing to do.
-  RedBlackTree *tree = table->table[index];
-  if ((tree->head->prev != NULL) && (tree->tail->next != NULL)) {
-    // All is well.  Exit.
-    printLog(TRACE, "EXIT updateTreeLinks(table=%p, index=%llu) = {%d}\n",
-      table, llu(index), 0);
-    return 0;
+/// @param table is the table being resized.  The caller must hold its lock
+///   but not any of its lock stripes.
+///
+/// @return This function returns no value.
+static void htRehashStep(HashTable *table) {
+  if (table->oldTable == NULL) {
+    return;
   }
   
-  HashNode *prev = NULL;
-  HashNode *next = NULL;
+  // Readers of lock-striped tables look at oldTable and rehashIndex without
+  // the mutex.
+  htLockAllStripes(table);
   
-  if (tree->tail->next == NULL) {
-    u64 tableSize = table->tableSize;
-    for (u64 i = index + 1; i < tableSize; i++) {
-      if (table->table[i] != NULL) {
-        next = table->table[i]->head;
-        prev = next->prev;
-        break;
-      }
-    }
-    
-    if (next != NULL) {
-      tree->tail->next = next;
-      next->prev = tree->tail;
-    }
-    
-    if (prev != NULL) {
-      tree->head->prev = prev;
-      prev->next = tree->head;
+  u64 treesMigrated = 0;
+  u64 emptyVisits = HASH_TABLE_REHASH_STEP_SIZE * 10;
+  while ((table->rehashIndex < table->oldTableSize)
+    && (treesMigrated < HASH_TABLE_REHASH_STEP_SIZE)
+    && (emptyVisits > 0)
+  ) {
+    RedBlackTree *tree = table->oldTable[table->rehashIndex];
+    if (tree != NULL) {
+      htMigrateNodes(table, tree, tree->root->left);
+      // The nodes now belong to other trees.  Detach them before destroying
+      // what's left of this one.
+      tree->root->left = tree->nil;
+      tree->size = 0;
+      rbTreeDestroy(tree);
+      table->oldTable[table->rehashIndex] = NULL;
+      treesMigrated++;
+    } else {
+      emptyVisits--;
     }
+    table->rehashIndex++;
   }
   
-  if ((tree->head->prev == NULL) && (index > 0)) {
-    for (u64 i = index - 1; i > 0; i--) {
-      if (table->table[i] != NULL) {
-        prev = table->table[i]->tail;
-        next = prev->next;
-        break;
-      }
-    }
-    
-    if (prev == NULL) {
-      // Check index 0.
-      if (table->table[0] != NULL) {
-        prev = table->table[0]->tail;
-        next = prev->next;
-      }
-    }
-    
-    if (prev != NULL) {
-      tree->head->prev = prev;
-      prev->next = tree->head;
-    }
-    
-    if (next != NULL) {
-      tree->tail->next = next;
-      next->prev = tree->tail;
-    }
+  if (table->rehashIndex >= table->oldTableSize) {
+    printLog(DEBUG, "Resize to %llu trees complete.\n",
+      llu(table->tableSize));
+    table->oldTable = (RedBlackTree**)
+      allocatorFree(ALLOCATOR_HASH_TABLE, NULL, table->oldTable);
+    table->oldTableSize = 0;
+    table->rehashIndex = 0;
   }
   
-  printLog(TRACE, "EXIT updateTreeLinks(table=%p, index=%llu) = {%d}\n", table, llu(index), 0);
-  return 0;
+  htUnlockAllStripes(table);
+}
+
+/// @fn static void htStartResize(HashTable *table)
+///
+/// @brief Double the number of trees in the table if its load factor has
+///   exceeded HASH_TABLE_MAX_LOAD_FACTOR and no resize is already in progress.
+///
+/// @details Only the new tree array is allocated here.  The entries are moved
+///   over incrementally by htRehashStep.
+///
+/// @param table is the table to check.  The caller must hold its lock but not
+///   any of its lock stripes.
+///
+/// @return This function returns no value.
+static void htStartResize(HashTable *table) {
+  if ((table->oldTable != NULL)
+    || (table->size <= table->tableSize * HASH_TABLE_MAX_LOAD_FACTOR)
+  ) {
+    return;
+  }
+  
+  u64 newTableSize = table->tableSize << 1;
+  RedBlackTree **newTable = (RedBlackTree**) allocatorCalloc(
+    ALLOCATOR_HASH_TABLE, NULL, newTableSize, sizeof(RedBlackTree*));
+  if (newTable == NULL) {
+    // Not fatal.  The table just stays at its current size.
+    LOG_MALLOC_FAILURE();
+    return;
+  }
+  
+  printLog(DEBUG, "Resizing table from %llu to %llu trees.\n",
+    llu(table->tableSize), llu(newTableSize));
+  htLockAllStripes(table);
+  table->oldTable = table->table;
+  table->oldTableSize = table->tableSize;
+  table->rehashIndex = 0;
+  table->table = newTable;
+  table->tableSize = newTableSize;
+  htUnlockAllStripes(table);
 }
 
 /// @fn HashNode *htAddEntry_(HashTable *table, const volatile void *key, const volatile void *value, TypeDescriptor *type, ...)
@@ -342,26 +572,32 @@ HashNode *htAddEntry_(HashTable *table, const volatile void *key,
     printLog(WARN, "Could not lock table mutex.\n");
   }
   
-  u64 index = htGetHash(table, key);
-  if (table->table[index] == NULL) {
-    table->table[index] = rbTreeCreate(table->keyType);
-  }
+  htRehashStep(table);
   
-  // Make sure the head and tail finding algorithm can work correctly.
-  // The trees get linked when an iterator is requested.
-  RedBlackNode *prev = NULL;
-  RedBlackNode *next = NULL;
-  
-  if (table->table[index]->head != NULL) {
-    prev = table->table[index]->head->prev;
+  // The trees are only used as indexes.  The table guards them with its own
+  // lock and maintains its own list of the nodes in insertion order.
+  u64 hash = htHashValue(table->keyType, key, table->seed);
+  rwl_t *stripe = NULL;
+  if (table->lockStripes != NULL) {
+    stripe = htLockStripe(table, hash);
+    if (rwl_wrlock(stripe) != thrd_success) {
+      printLog(WARN, "Could not lock table lock stripe.\n");
+    }
   }
-  if (table->table[index]->tail != NULL) {
-    next = table->table[index]->tail->next;
+  RedBlackTree **tree = htGetTree(table, hash);
+  if (*tree == NULL) {
+    *tree = htCreateTree(table);
   }
   
-  RedBlackNode *node = rbInsert(table->table[index], key, value, type);
-  if (node == NULL) {
-    printLog(ERR, "NULL node returned from rbInsert.\n");
+  HashNode *node = (HashNode*) allocatorCalloc(
+    ALLOCATOR_HASH_TABLE, table->keyType, 1, sizeof(HashNode));
+  if ((*tree == NULL) || (node == NULL)) {
+    LOG_MALLOC_FAILURE();
+    node = (HashNode*)
+      allocatorFree(ALLOCATOR_HASH_TABLE, table->keyType, node);
+    if (stripe != NULL) {
+      rwl_wrunlock(stripe);
+    }
     if (table->lock != NULL) {
       mtx_unlock(table->lock);
     }
@@ -371,34 +607,34 @@ HashNode *htAddEntry_(HashTable *table, const volatile void *key,
       table, key, value, type->name, (void*) NULL);
     return NULL;
   }
+  node->key = table->keyType->copy(key);
+  node->value = type->copy(value);
+  node->type = type;
+  rbTreeInsertNode(*tree, node);
+  if (stripe != NULL) {
+    rwl_wrunlock(stripe);
+  }
+  
+  if (table->unlinked == false) {
+    node->prev = table->tail;
+    if (table->tail != NULL) {
+      table->tail->next = node;
+    } else {
+      table->head = node;
+    }
+    table->tail = node;
+  } else {
+    // Whatever htLinkNodes last threaded no longer includes every node.
+    table->head = NULL;
+    table->tail = NULL;
+  }
   
   // If we made it this far then the add was successful.  Record the type for
   // future use if desired.
   table->lastAddedType = type;
-  
-  table->table[index]->head->prev = prev;
-  if (prev != NULL) {
-    prev->next = table->table[index]->head;
-  }
-  table->table[index]->tail->next = next;
-  if (next != NULL) {
-    next->prev = table->table[index]->tail;
-  }
-  
   table->size++;
-  if ((table->table[index]->size == 1) && (table->size != 1)) {
-    // New tree and other trees present.  Update links around the tree.
-    updateTreeLinks(table, index);
-  }
   
-  if (table->table[index]->head->prev == NULL) {
-    // tree->head is the head of the table.
-    table->head = table->table[index]->head;
-  }
-  if (table->table[index]->tail->next == NULL) {
-    // tree->tail is the tail of the table.
-    table->tail = table->table[index]->tail;
-  }
+  htStartResize(table);
   
   if (table->lock != NULL) {
     mtx_unlock(table->lock);
@@ -417,22 +653,43 @@ HashNode *htAddEntry_(HashTable *table, const volatile void *key,
 /// @param table is the hash table of interest.
 /// @param key is the key for the value of interest.
 ///
+/// @note If a resize is in progress and the table is guarded by its mutex,
+///   this call also advances the resize.  Tables with thread safety disabled
+///   and lock-striped tables are never modified by lookups so that concurrent
+///   readers remain safe.  Lookups in lock-striped tables hold only the stripe
+///   of their key, shared.
+///
 /// @return Returns the matching HashNode on success, NULL on failure.
 HashNode *htGetEntry(const HashTable *table, const volatile void *key) {
   printLog(TRACE, "ENTER htGetEntry(table=%p, key=%p)\n", table, key);
   
-  if (table == NULL) {
+  if ((table == NULL) || (key == NULL)) {
     printLog(TRACE, "EXIT htGetEntry(table=%p, key=%p) = {%p}\n", table, key, (void*) NULL);
     return NULL;
   }
   
+  if (table->lockStripes != NULL) {
+    u64 hash = htHashValue(table->keyType, key, table->seed);
+    rwl_t *stripe = htLockStripe(table, hash);
+    if (rwl_rdlock(stripe) != thrd_success) {
+      printLog(WARN, "Could not lock table lock stripe.\n");
+    }
+    HashNode *returnValue = rbQuery(*htGetTree(table, hash), key);
+    rwl_rdunlock(stripe);
+    
+    printLog(TRACE, "EXIT htGetEntry(table=%p, key=%p) = {%p}\n", table, key, returnValue);
+    return returnValue;
+  }
+  
   if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
     printLog(WARN, "Could not lock table mutex.\n");
   }
   
-  u64 index = htGetHash(table, key);
-  printLog(DEBUG, "Getting value from tree %llu.\n", llu(index));
-  HashNode *returnValue = rbQuery(table->table[index], key);
+  if (table->lock != NULL) {
+    htRehashStep((HashTable*) table);
+  }
+  
+  HashNode *returnValue = rbQuery(*htGetTree(table, htHashValue(table->keyType, key, table->seed)), key);
   
   if (table->lock != NULL) {
     mtx_unlock(table->lock);
@@ -465,6 +722,48 @@ void *htGetValue(const HashTable *table, const volatile void *key) {
   return returnValue;
 }
 
+/// @fn static void htDeleteNode(HashTable *table, RedBlackTree **tree, HashNode *node)
+///
+/// @brief Unlink a node from a table and its tree and free it.
+///
+/// @param table is the table that contains the node.  The caller must hold
+///   its lock.
+/// @param tree is the slot of the tree that contains the node.  If the tree
+///   is empty after the removal, it is destroyed and the slot is cleared.
+/// @param node is the node to destroy.
+///
+/// @return This function returns no value.
+static void htDeleteNode(HashTable *table, RedBlackTree **tree,
+  HashNode *node
+) {
+  if (table->unlinked == false) {
+    if (node->prev != NULL) {
+      node->prev->next = node->next;
+    } else {
+      table->head = node->next;
+    }
+    if (node->next != NULL) {
+      node->next->prev = node->prev;
+    } else {
+      table->tail = node->prev;
+    }
+  } else {
+    table->head = NULL;
+    table->tail = NULL;
+  }
+  
+  rbTreeRemoveNode(*tree, node);
+  table->keyType->destroy(node->key); node->key = NULL;
+  node->type->destroy(node->value); node->value = NULL;
+  node = (HashNode*)
+    allocatorFree(ALLOCATOR_HASH_TABLE, table->keyType, node);
+  table->size--;
+  
+  if ((*tree)->size == 0) {
+    *tree = rbTreeDestroy(*tree);
+  }
+}
+
 /// @fn i32 htRemoveEntry(HashTable *table, const volatile void *key)
 ///
 /// @brief Remove a previously-added entry from a hash table.
@@ -486,32 +785,31 @@ i32 htRemoveEntry(HashTable *table, const volatile void *key) {
     printLog(TRACE, "EXIT htRemoveEntry(table=%p, key=%p) = {-1}\n", table, key);
     return -1;
   }
-
+  
   if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
     printLog(WARN, "Could not lock table mutex.\n");
   }
   
-  u64 index = htGetHash(table, key);
-  RedBlackTree *tree = NULL;
+  htRehashStep(table);
   
-  tree = table->table[index];
-  if (tree != NULL) {
-    RedBlackNode *node = rbQuery(tree, key);
-    if (node != NULL) {
-      if (table->head == node) {
-        table->head = node->next;
-      }
-      if (table->tail == node) {
-        table->tail = node->prev;
-      }
-      table->size--;
+  u64 hash = htHashValue(table->keyType, key, table->seed);
+  rwl_t *stripe = NULL;
+  if (table->lockStripes != NULL) {
+    stripe = htLockStripe(table, hash);
+    if (rwl_wrlock(stripe) != thrd_success) {
+      printLog(WARN, "Could not lock table lock stripe.\n");
     }
-    rbTreeRemove(tree, key);
-    if (tree->size == 0) {
-      rbTreeDestroy(tree);
-      table->table[index] = NULL;
+  }
+  RedBlackTree **tree = htGetTree(table, hash);
+  if (*tree != NULL) {
+    RedBlackNode *node = rbQuery(*tree, key);
+    if (node != NULL) {
+      htDeleteNode(table, tree, node);
     }
   }
+  if (stripe != NULL) {
+    rwl_wrunlock(stripe);
+  }
   
   if (table->lock != NULL) {
     mtx_unlock(table->lock);
@@ -521,6 +819,58 @@ i32 htRemoveEntry(HashTable *table, const volatile void *key) {
   return 0;
 }
 
+/// @fn static char *htTreeToString(const RedBlackTree *tree)
+///
+/// @brief Create a string representation of one of the trees of a table.
+///
+/// @details The trees of a table do not maintain their own linked lists, so
+///   a temporary, shallow list of the tree's nodes is built in key order and
+///   printed instead.
+///
+/// @param tree The tree to represent as a string.
+///
+/// @return Returns a C string representing the tree on success,
+///   NULL on failure.
+static char *htTreeToString(const RedBlackTree *tree) {
+  ListNode *nodes = (ListNode*) calloc(tree->size + 1, sizeof(ListNode));
+  if (nodes == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  
+  u64 numNodes = 0;
+  RedBlackNode *nil = tree->nil;
+  RedBlackNode *first = tree->root->left;
+  while ((first != nil) && (first->left != nil)) {
+    first = first->left;
+  }
+  for (RedBlackNode *cur = first;
+    (cur != nil) && (numNodes < tree->size);
+    cur = rbTreeSuccessor((RedBlackTree*) tree, cur)
+  ) {
+    nodes[numNodes].value = cur->value;
+    nodes[numNodes].type = cur->type;
+    nodes[numNodes].key = cur->key;
+    if (numNodes > 0) {
+      nodes[numNodes].prev = &nodes[numNodes - 1];
+      nodes[numNodes - 1].next = &nodes[numNodes];
+    }
+    numNodes++;
+  }
+  
+  List list;
+  memset(&list, 0, sizeof(list));
+  list.head = (numNodes > 0) ? &nodes[0] : NULL;
+  list.tail = (numNodes > 0) ? &nodes[numNodes - 1] : NULL;
+  list.size = numNodes;
+  list.keyType = tree->keyType;
+  
+  char *returnValue = listToString(&list);
+  nodes = (ListNode*) pointerDestroy(nodes);
+  
+  return returnValue;
+}
+
 /// @fn char *htToString(const HashTable *table)
 ///
 /// @brief Create a string representation of the hash table.
@@ -553,25 +903,30 @@ char *htToString(const HashTable *table) {
   }
   
   u64 numTablesPrinted = 0;
-  for (u64 i = 0; i < table->tableSize; i++) {
-    if (table->table[i] != NULL) {
-      if (numTablesPrinted > 0) {
-        straddstr(&returnValue, "\n");
-      }
-      
-      char *indexString = NULL;
-      if (asprintf(&indexString, "table[%llu]={\n", llu(i)) > 0) {
-        straddstr(&returnValue, indexString);
-        indexString = stringDestroy(indexString);
+  for (int pass = 0; pass < 2; pass++) {
+    RedBlackTree **trees = (pass == 0) ? table->table : table->oldTable;
+    u64 numTrees = (pass == 0) ? table->tableSize : table->oldTableSize;
+    const char *arrayName = (pass == 0) ? "table" : "oldTable";
+    for (u64 i = 0; (trees != NULL) && (i < numTrees); i++) {
+      if (trees[i] != NULL) {
+        if (numTablesPrinted > 0) {
+          straddstr(&returnValue, "\n");
+        }
+        
+        char *indexString = NULL;
+        if (asprintf(&indexString, "%s[%llu]={\n", arrayName, llu(i)) > 0) {
+          straddstr(&returnValue, indexString);
+          indexString = stringDestroy(indexString);
+        }
+        char *treeString = htTreeToString(trees[i]);
+        char *indentedTreeString = indentText(treeString, 2);
+        treeString = stringDestroy(treeString);
+        straddstr(&returnValue, indentedTreeString);
+        indentedTreeString = stringDestroy(indentedTreeString);
+        straddstr(&returnValue, "\n}");
+        
+        numTablesPrinted++;
       }
-      char *treeString = rbTreeToString(table->table[i]);
-      char *indentedTreeString = indentText(treeString, 2);
-      treeString = stringDestroy(treeString);
-      straddstr(&returnValue, indentedTreeString);
-      indentedTreeString = stringDestroy(indentedTreeString);
-      straddstr(&returnValue, "\n}");
-      
-      numTablesPrinted++;
     }
   }
   
@@ -622,19 +977,24 @@ Bytes htToBytes(const HashTable *table) {
   tableSizeBytes = bytesDestroy(tableSizeBytes);
   bytesAddStr(&returnValue, "\n");
   
-  for (u64 i = 0; i < table->tableSize; i++) {
-    if (table->table[i] != NULL) {
-      char *indexString = NULL;
-      if (asprintf(&indexString, "table[%llu]={\n", llu(i)) > 0) {
-        bytesAddStr(&returnValue, indexString);
-        indexString = stringDestroy(indexString);
+  for (int pass = 0; pass < 2; pass++) {
+    RedBlackTree **trees = (pass == 0) ? table->table : table->oldTable;
+    u64 numTrees = (pass == 0) ? table->tableSize : table->oldTableSize;
+    const char *arrayName = (pass == 0) ? "table" : "oldTable";
+    for (u64 i = 0; (trees != NULL) && (i < numTrees); i++) {
+      if (trees[i] != NULL) {
+        char *indexString = NULL;
+        if (asprintf(&indexString, "%s[%llu]={\n", arrayName, llu(i)) > 0) {
+          bytesAddStr(&returnValue, indexString);
+          indexString = stringDestroy(indexString);
+        }
+        char *treeString = htTreeToString(trees[i]);
+        char *indentedTreeString = indentText(treeString, 2);
+        treeString = stringDestroy(treeString);
+        bytesAddStr(&returnValue, indentedTreeString);
+        indentedTreeString = stringDestroy(indentedTreeString);
+        bytesAddStr(&returnValue, "}\n");
       }
-      char *treeString = rbTreeToString(table->table[i]);
-      char *indentedTreeString = indentText(treeString, 2);
-      treeString = stringDestroy(treeString);
-      bytesAddStr(&returnValue, indentedTreeString);
-      indentedTreeString = stringDestroy(indentedTreeString);
-      bytesAddStr(&returnValue, "}\n");
     }
   }
   
@@ -669,11 +1029,14 @@ HashTable *htCopy(const HashTable *table) {
   if (table->lock == NULL) {
     disableThreadSafety = true;
   }
-  copy = htCreate(table->keyType, disableThreadSafety, table->tableSize);
+  copy = htCreate(table->keyType, disableThreadSafety, table->tableSize,
+    table->numLockStripes, table->unlinked);
   
   if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
     printLog(WARN, "Could not lock table mutex.\n");
   }
+  // The mutex is recursive, so the table can be linked while it's held.
+  htLinkNodes(table);
   
   for (HashNode *cur = table->head; cur != NULL; cur = cur->next) {
     htAddEntry(copy, cur->key, cur->value, cur->type);
@@ -698,185 +1061,58 @@ HashTable *htCopy(const HashTable *table) {
 /// @note Non-zero return values from this function are meaningless other than
 ///   that they express that the two tables are not the same.  There is no
 ///   standard for evaluating meaning of non-zero values otherwise.
+///
+/// @note The order in which the entries were added is not considered.  Two
+///   tables are the same if they have the same key type and the same
+///   key-value pairs.
 int htCompare(const HashTable *htA, const HashTable *htB) {
   printLog(TRACE, "ENTER htCompare(htA=%p, htB=%p)\n", htA, htB);
   
-  int returnValue = listCompare((List*) htA, (List*) htB);
-  
-  printLog(TRACE, "EXIT htCompare(htA=%p, htB=%p) = {%d}\n", htA, htB, returnValue);
-  return returnValue;
-}
-
-/// @fn HashTable *xmlToHashTable(const char *inputData)
-///
-/// @brief Take SOAP data and return a hash table of key-value objects.
-///
-/// @param inputData is the full data string from a POST call.
-///
-/// @return Returns a HashTable containing the data parsed.
-HashTable *xmlToHashTable(const char *inputData) {
-  char *separatorAt = NULL;
-  char *hashTableString = NULL, *indentedHashTableString = NULL;
-  HashTable *hashTable= NULL;
-  char *key = NULL;
-  Bytes value = NULL;
-  char *xmlString = NULL;
-  
-  printLog(TRACE, "ENTER xmlToHashTable(inputData=\"%s\")\n", inputData);
-  
-  if (inputData == NULL) {
-    printLog(ERR, "NULL inputData provided.\n");
-    printLog(TRACE, "EXIT xmlToHashTable(inputData=NULL) = {NULL}\n");
-    return NULL;
-  }
-  
-  const char *startAt = &(inputData[strspn(inputData, " \t\n")]);
-  if (*startAt != '<') {
-    printLog(DEBUG, "No XML provided.\n");
-    printLog(TRACE, "EXIT xmlToHashTable(inputData=NULL) = {NULL}\n");
-    return NULL;
+  if (htA == htB) {
+    printLog(TRACE, "EXIT htCompare(htA=%p, htB=%p) = {%d}\n", htA, htB, 0);
+    return 0;
+  } else if ((htA == NULL) || (htB == NULL)
+    || (htA->keyType != htB->keyType) || (htA->size != htB->size)
+  ) {
+    int returnValue
+      = listCompare((List*) htLinkNodes(htA), (List*) htLinkNodes(htB));
+    printLog(TRACE, "EXIT htCompare(htA=%p, htB=%p) = {%d}\n",
+      htA, htB, returnValue);
+    return returnValue;
   }
-  straddstr(&xmlString, startAt);
   
-  hashTable = htCreate(typeString);
-  
-  separatorAt = strstr(xmlString, "Request");
-  if (separatorAt == NULL) {
-    // Might be response data we're parsing instead of request data.  Try that.
-    separatorAt = strstr(xmlString, "Response");
-  }
-  if (separatorAt == NULL) {
-    // See if it's just generic XML, maybe.
-    printLog(DEBUG, "Looking for generic XML data.\n");
-    separatorAt = strchr(xmlString, '>');
-    if (separatorAt != NULL && separatorAt != xmlString) {
-      printLog(DEBUG, "Generic XML data found.\n");
-      separatorAt--;
-    }
-  }
-  if (separatorAt != NULL) {
-    separatorAt = strchr(separatorAt, '>'); // Skip over the request header
-    if (separatorAt != NULL) {
-      separatorAt = strchr(separatorAt, '<');
-      // We're now either at the first field or the close of the request
-    }
+  if ((htA->lock != NULL) && (mtx_lock(htA->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
   }
+  htLinkNodes(htA);
   
-  while (separatorAt != NULL && *(separatorAt + 1) != '/') {
-    char *endOfLine = strchr(separatorAt, '\n');
-    // separatorAt should point to a '<'
-    char *endOfTag = strchr((++separatorAt), ' ');
-    printLog(DEBUG, "In separatorAt while.\n");
-    
-    if (endOfLine == NULL) {
-      // XML is all on one line
-      endOfLine = separatorAt + strlen(separatorAt);
-    }
-    
-    if (endOfTag != NULL && strchr(separatorAt, '>') &&
-      strchr(separatorAt, '>') < endOfTag) {
-      endOfTag = strchr((separatorAt), '>');
-    }
-    
-    if (endOfTag == NULL || endOfTag > endOfLine) {
-      endOfTag = strchr((separatorAt), '>');
-    }
-    
-    if (endOfTag != NULL) {
-      char *valueAt = NULL;
-      char *closeTag = NULL;
-      
-      if (*endOfTag == '>' && *(endOfTag - 1) == '/') {
-        // There is no value for this key
-        valueAt = NULL;
-      } else if (*endOfTag == '>') {
-        valueAt = endOfTag + 1;
-      } else { // endOfTag is ' '
-        valueAt = strchr((separatorAt + 1), '>');
-        if (valueAt) {
-          valueAt = valueAt + 1;
-        }
-      }
-      *endOfTag = '\0';
-      key = (char *) malloc(strlen(separatorAt) + 1);
-      strcpy(key, separatorAt);
-      straddstr(&closeTag, "</");
-      straddstr(&closeTag, key);
-      if (valueAt) {
-        endOfTag = strstr(valueAt, closeTag);
-      } else {
-        endOfTag = NULL;
-      }
-      if (endOfTag != NULL) {
-        *endOfTag = '\0';
-        value = NULL;
-        bytesAddStr(&value, valueAt);
-      } else {
-        // No value but there WAS a tag so we can't just leave the value
-        // NULL.  Make it an empty string.
-        value = NULL;
-        bytesAddData(&value, "", 1);
-      }
-      closeTag = stringDestroy(closeTag);
-      
-      // OK.  We're parsing XML data.  It's possible that what we just parsed
-      // is really just more XML.  If so, it should be added to a subordinate
-      // List.  Try to detect this case and act intelligently.
-      if (strstr(str(value), "<") != NULL &&
-        strrchr(str(value), '>') != NULL &&
-        strstr(str(value), "<") < strrchr(str(value), '>')) {
-        // Probably more XML.  Make it look like XML and parse again.
-        char *xmlValue = NULL;
-        straddstr(&xmlValue, "<");
-        straddstr(&xmlValue, key);
-        straddstr(&xmlValue, ">\n");
-        straddstr(&xmlValue, str(value));
-        straddstr(&xmlValue, "</");
-        straddstr(&xmlValue, key);
-        straddstr(&xmlValue, ">\n");
-        value = bytesDestroy(value);
-        HashTable *subTable = xmlToHashTable(xmlValue);
-        xmlValue = stringDestroy(xmlValue);
-        HashNode *node = htAddEntry(hashTable, key, subTable,
-          typeHashTableNoCopy);
-        if (node == NULL) {
-          printLog(ERR, "htAddEntry failed when adding key/table pair.\n");
-        } else {
-          node->type = typeHashTable;
-        }
-      }
-    } else {
-      // No end of tag?  Is this possible?
+  int returnValue = 0;
+  for (HashNode *nodeA = htA->head; nodeA != NULL; nodeA = nodeA->next) {
+    HashNode *nodeB = htGetEntry(htB, nodeA->key);
+    if (nodeB == NULL) {
+      returnValue = 1;
+      break;
     }
     
-    if (value != NULL) {
-      HashNode *node = htAddEntry(hashTable, key, value, typeBytesNoCopy);
-      if (node != NULL) {
-        node->type = typeBytes;
-      } else {
-        printLog(ERR, "htAddEntry failed when adding key/value pair.\n");
-      }
+    i64 typeIndexA = getIndexFromTypeDescriptor(nodeA->type);
+    i64 typeIndexB = getIndexFromTypeDescriptor(nodeB->type);
+    if (typeIndexA != typeIndexB) {
+      returnValue = (typeIndexA > typeIndexB) ? 1 : -1;
+      break;
     }
-    key = stringDestroy(key);
     
-    // separatorAt should now be at the beginning of the value
-    // endOfTag should now be at the '<' of the closing tag but set to '\0'
-    if (endOfTag != NULL) {
-      separatorAt = strchr((endOfTag + 1), '<');
-    } else {
-      separatorAt = separatorAt + 1;
-      separatorAt = strchr(separatorAt, '<');
+    returnValue = nodeA->type->compare(nodeA->value, nodeB->value);
+    if (returnValue != 0) {
+      break;
     }
-    // separatorAt should now be at the '<' of the opening tag of the next value
   }
   
-  xmlString = stringDestroy(xmlString);
-  hashTableString = htToString(hashTable);
-  indentedHashTableString = indentText(hashTableString, 2);
-  hashTableString = stringDestroy(hashTableString);
-  printLog(TRACE, "EXIT xmlToHashTable(inputData=\"%s\") = {%s}\n", inputData, indentedHashTableString);
-  indentedHashTableString = stringDestroy(indentedHashTableString);
-  return hashTable;
+  if (htA->lock != NULL) {
+    mtx_unlock(htA->lock);
+  }
+  
+  printLog(TRACE, "EXIT htCompare(htA=%p, htB=%p) = {%d}\n", htA, htB, returnValue);
+  return returnValue;
 }
 
 /// @fn size_t htSize(const volatile void *value)
@@ -954,7 +1190,7 @@ HashTable *htFromBlob_(const volatile void *array, u64 *length, bool inPlaceData
   
   u32 dsVersion = *((u32*) &byteArray[index]);
   littleEndianToHost(&dsVersion, sizeof(dsVersion));
-  if (dsVersion != 10) {
+  if ((dsVersion < 10) || (dsVersion > DsVersion)) {
     printLog(ERR, "Don't know how to parse version %u of input byte array.\n",
       dsVersion);
     printLog(ERR, "If this input came from this library, please "
@@ -990,6 +1226,26 @@ HashTable *htFromBlob_(const volatile void *array, u64 *length, bool inPlaceData
   size = *((u64*) &byteArray[index]);
   littleEndianToHost(&size, sizeof(size));
   index += sizeof(size);
+  u64 indexOffset = 0;
+  if (dsVersion > 10) {
+    // Version 11 follows the size with the offset and order of the entry
+    // index.  The entries themselves are encoded the same way as in version
+    // 10, so they are parsed the same way and the index is just skipped.
+    if (arrayLength >= index + sizeof(indexOffset) + sizeof(u8)) {
+      indexOffset = *((u64*) &byteArray[index]);
+      littleEndianToHost(&indexOffset, sizeof(indexOffset));
+      index += sizeof(indexOffset) + sizeof(u8);
+    }
+    if ((indexOffset < index) || (indexOffset > arrayLength)
+      || (size > (arrayLength - indexOffset) / DS_INDEX_ENTRY_SIZE)
+    ) {
+      printLog(ERR, "Improperly formatted byte array.  Invalid index.\n");
+      printLog(ERR, "If this input came from this library, please "
+        "report this as a bug.\n");
+      return NULL;
+    }
+    arrayLength = indexOffset;
+  }
   table = htCreate(keyTypeNoCopy, disableThreadSafety, size);
   if (table == NULL) {
     LOG_MALLOC_FAILURE();
@@ -1129,6 +1385,10 @@ HashTable *htFromBlob_(const volatile void *array, u64 *length, bool inPlaceData
   }
   
   *length = index;
+  if (indexOffset > 0) {
+    // Consume the index too so that the caller's next read starts after it.
+    *length = indexOffset + (size * DS_INDEX_ENTRY_SIZE);
+  }
   if (inPlaceData) {
     // Optimize for this case.
     if (keyTypeIndex >= listIndex) {
@@ -1194,6 +1454,9 @@ HashTable* listToHashTable(List *list) {
 // jsonToHashTable implementation from generic macro.
 JSON_TO_DATA_STRUCTURE(HashTable, ht)
 
+// xmlToHashTable implementation from generic macro.
+XML_TO_DATA_STRUCTURE(HashTable, ht)
+
 /// @fn i32 htClear(HashTable *table)
 ///
 /// @brief Destroy all the nodes of the HashTable (starting with table->head and
@@ -1217,6 +1480,7 @@ i32 htClear(HashTable *table) {
   if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
     printLog(WARN, "Could not lock table mutex.\n");
   }
+  htLockAllStripes(table);
   
   // Destroy the allocated red-black trees.
   for (u64 i = 0; i < table->tableSize; i++) {
@@ -1224,6 +1488,17 @@ i32 htClear(HashTable *table) {
       table->table[i] = rbTreeDestroy(table->table[i]);
     }
   }
+  if (table->oldTable != NULL) {
+    for (u64 i = table->rehashIndex; i < table->oldTableSize; i++) {
+      if (table->oldTable[i] != NULL) {
+        rbTreeDestroy(table->oldTable[i]);
+      }
+    }
+    table->oldTable = (RedBlackTree**)
+      allocatorFree(ALLOCATOR_HASH_TABLE, NULL, table->oldTable);
+    table->oldTableSize = 0;
+    table->rehashIndex = 0;
+  }
   table->size = 0;
   table->head = NULL;
   table->tail = NULL;
@@ -1231,6 +1506,7 @@ i32 htClear(HashTable *table) {
     fclose(table->filePointer); table->filePointer = NULL;
   }
   
+  htUnlockAllStripes(table);
   if (table->lock != NULL) {
     mtx_unlock(table->lock);
   }
@@ -1239,6 +1515,113 @@ i32 htClear(HashTable *table) {
   return returnValue;
 }
 
+/// @fn static void htStatsAddTrees(RedBlackTree **trees, u64 numTrees, HashTableStats *stats)
+///
+/// @brief Add the buckets of one of a table's tree arrays to a
+/// HashTableStats.
+///
+/// @param trees The array of trees.
+/// @param numTrees The number of elements in trees.
+/// @param stats The HashTableStats being filled in.
+///
+/// @return This function returns no value.
+static void htStatsAddTrees(RedBlackTree **trees, u64 numTrees,
+  HashTableStats *stats
+) {
+  for (u64 i = 0; i < numTrees; i++) {
+    u64 depth = 0;
+    if (trees[i] != NULL) {
+      RedBlackTreeStats treeStats;
+      if (rbTreeStats(trees[i], &treeStats) == 0) {
+        depth = treeStats.size;
+        stats->memoryBytes += treeStats.memoryBytes;
+        if (treeStats.height > stats->maxTreeHeight) {
+          stats->maxTreeHeight = treeStats.height;
+        }
+      }
+    }
+    
+    if (depth == 0) {
+      stats->emptyBuckets++;
+    } else if (depth > stats->maxBucketDepth) {
+      stats->maxBucketDepth = depth;
+    }
+    if (depth >= HASH_TABLE_STATS_MAX_DEPTH) {
+      depth = HASH_TABLE_STATS_MAX_DEPTH - 1;
+    }
+    stats->bucketDepthHistogram[depth]++;
+  }
+}
+
+/// @fn int htStats(const HashTable *table, HashTableStats *stats)
+///
+/// @brief Get the distribution of entries across the buckets of a table and
+/// its approximate memory footprint.
+///
+/// @details While a resize is in progress, the buckets of the old tree array
+/// that have not been migrated yet are counted along with the new ones.
+///
+/// @param table The table of interest.
+/// @param stats The HashTableStats to fill in.
+///
+/// @return Returns 0 on success, -1 on failure.
+int htStats(const HashTable *table, HashTableStats *stats) {
+  printLog(TRACE, "ENTER htStats(table=%p, stats=%p)\n", table, stats);
+  
+  if ((table == NULL) || (stats == NULL)) {
+    printLog(ERR, "NULL parameter provided.\n");
+    printLog(TRACE, "EXIT htStats(table=%p, stats=%p) = {-1}\n", table, stats);
+    return -1;
+  }
+  memset(stats, 0, sizeof(*stats));
+  
+  if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  htLockAllStripes((HashTable*) table);
+  
+  stats->size = table->size;
+  stats->tableSize = table->tableSize;
+  stats->oldTableSize = table->oldTableSize;
+  stats->numLockStripes = table->numLockStripes;
+  stats->memoryBytes = sizeof(HashTable)
+    + ((table->tableSize + table->oldTableSize) * sizeof(RedBlackTree*))
+    + (table->numLockStripes * sizeof(HashTableLockStripe));
+  if (table->lock != NULL) {
+    stats->memoryBytes += sizeof(mtx_t);
+  }
+  htStatsAddTrees(table->table, table->tableSize, stats);
+  if (table->oldTable != NULL) {
+    htStatsAddTrees(table->oldTable, table->oldTableSize, stats);
+  }
+  
+  u64 numBuckets = table->tableSize + table->oldTableSize;
+  if (numBuckets > 0) {
+    stats->emptyBucketRatio
+      = ((double) stats->emptyBuckets) / ((double) numBuckets);
+  }
+  if (stats->emptyBuckets < numBuckets) {
+    stats->averageBucketDepth = ((double) table->size)
+      / ((double) (numBuckets - stats->emptyBuckets));
+  }
+  
+  htUnlockAllStripes((HashTable*) table);
+  if (table->lock != NULL) {
+    mtx_unlock(table->lock);
+  }
+  
+  printLog(TRACE, "EXIT htStats(table=%p, stats=%p) = {0}\n", table, stats);
+  return 0;
+}
+
+/// @fn int htDestroyNode(HashTable *table, HashNode *node)
+///
+/// @brief Remove a node from a table and destroy its key and value.
+///
+/// @param table A pointer to the HashTable that contains the node.
+/// @param node A pointer to the HashNode to destroy.
+///
+/// @return Returns 0 on success, -1 on failure.
 int htDestroyNode(HashTable *table, HashNode *node) {
   SCOPE_ENTER("table=%p, node=%p", table, node);
   
@@ -1250,14 +1633,192 @@ int htDestroyNode(HashTable *table, HashNode *node) {
     return returnValue;
   }
   
-  u64 index = htGetHash(table, node->key);
-  printLog(DEBUG, "Destroying node in tree %llu.\n", llu(index));
-  returnValue = rbTreeDestroyNode(table->table[index], node);
+  if ((table->lock != NULL) && (mtx_lock(table->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  
+  htRehashStep(table);
+  
+  u64 hash = htHashValue(table->keyType, node->key, table->seed);
+  rwl_t *stripe = NULL;
+  if (table->lockStripes != NULL) {
+    stripe = htLockStripe(table, hash);
+    if (rwl_wrlock(stripe) != thrd_success) {
+      printLog(WARN, "Could not lock table lock stripe.\n");
+    }
+  }
+  RedBlackTree **tree = htGetTree(table, hash);
+  if (*tree != NULL) {
+    htDeleteNode(table, tree, node);
+  } else {
+    printLog(ERR, "Node is not in the table.\n");
+    returnValue = -1;
+  }
+  if (stripe != NULL) {
+    rwl_wrunlock(stripe);
+  }
+  
+  if (table->lock != NULL) {
+    mtx_unlock(table->lock);
+  }
   
   SCOPE_EXIT("table=%p, node=%p", "%d", table, node, returnValue);
   return returnValue;
 }
 
+/// @fn static void htLinkTree(HashTable *table, RedBlackTree *tree, RedBlackNode *x)
+///
+/// @brief Append the nodes of a subtree to the end of a table's head/tail list
+///   in key order.
+///
+/// @param table is the table being linked.
+/// @param tree is the tree that contains the subtree.
+/// @param x is the root of the subtree.
+///
+/// @return This function returns no value.
+static void htLinkTree(HashTable *table, RedBlackTree *tree,
+  RedBlackNode *x
+) {
+  if (x == tree->nil) {
+    return;
+  }
+  
+  htLinkTree(table, tree, x->left);
+  x->prev = table->tail;
+  x->next = NULL;
+  if (table->tail != NULL) {
+    table->tail->next = x;
+  } else {
+    table->head = x;
+  }
+  table->tail = x;
+  htLinkTree(table, tree, x->right);
+}
+
+/// @fn HashTable *htLinkNodes(const HashTable *table)
+///
+/// @brief Make sure the head/tail list of a table includes all of its nodes.
+///
+/// @details Tables created with unlinkedNodes don't maintain the list as
+///   entries are added and removed.  This threads every node onto it, bucket
+///   by bucket, so that the table can be walked from head to tail or passed to
+///   the List functions.  The list stays valid until the next add or remove.
+///   This is a no-op for tables that maintain the list and for unlinked
+///   tables that haven't been modified since they were last linked.
+///
+/// @param table is the table to link.
+///
+/// @return Returns the table, so that calls can be nested.
+HashTable *htLinkNodes(const HashTable *table) {
+  printLog(TRACE, "ENTER htLinkNodes(table=%p)\n", table);
+  
+  HashTable *linked = (HashTable*) table;
+  if ((linked == NULL) || (linked->unlinked == false)) {
+    printLog(TRACE, "EXIT htLinkNodes(table=%p) = {%p}\n", table, linked);
+    return linked;
+  }
+  
+  if ((linked->lock != NULL) && (mtx_lock(linked->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock table mutex.\n");
+  }
+  
+  if ((linked->head == NULL) && (linked->size > 0)) {
+    if (linked->oldTable != NULL) {
+      for (u64 i = linked->rehashIndex; i < linked->oldTableSize; i++) {
+        RedBlackTree *tree = linked->oldTable[i];
+        if (tree != NULL) {
+          htLinkTree(linked, tree, tree->root->left);
+        }
+      }
+    }
+    for (u64 i = 0; i < linked->tableSize; i++) {
+      RedBlackTree *tree = linked->table[i];
+      if (tree != NULL) {
+        htLinkTree(linked, tree, tree->root->left);
+      }
+    }
+  }
+  
+  if (linked->lock != NULL) {
+    mtx_unlock(linked->lock);
+  }
+  
+  printLog(TRACE, "EXIT htLinkNodes(table=%p) = {%p}\n", table, linked);
+  return linked;
+}
+
+/// @fn Bytes htToBlob(const HashTable *table)
+///
+/// @brief Convert a HashTable to a single array of bytes whose index is sorted
+/// by key so that htBlobGetValue can search it in place.
+///
+/// @param table The HashTable to convert.
+///
+/// @return Returns a Bytes object with the encoded table on success,
+/// NULL on failure.
+Bytes htToBlob(const HashTable *table) {
+  return listToKeyedBlob((const List*) htLinkNodes(table), false);
+}
+
+/// @fn u64 htToBlobBuffer(const HashTable *table, void *buffer, u64 bufferSize)
+///
+/// @brief Encode a HashTable the way htToBlob does, directly into a buffer.
+///
+/// @param table The HashTable to encode.
+/// @param buffer The memory to encode the table into.
+/// @param bufferSize The number of bytes available at buffer.  htToBlobSize
+///   gives the number of bytes needed.
+///
+/// @return Returns the number of bytes written on success, 0 on failure or if
+/// the table does not fit.
+u64 htToBlobBuffer(const HashTable *table, void *buffer, u64 bufferSize) {
+  return listToKeyedBlobBuffer((const List*) htLinkNodes(table), false,
+    buffer, bufferSize);
+}
+
+/// @fn static Bytes htToXmlLinked(const HashTable *table, const char *elementName, bool indent, ...)
+///
+/// @brief Wrapper around listToXml_ that links the nodes of unlinked tables
+///   first.  The List functions below are wrapped the same way so that
+///   typeHashTable can serialize any table.
+///
+/// @return Returns the value of listToXml_.
+static Bytes htToXmlLinked(const HashTable *table, const char *elementName,
+  bool indent, ...
+) {
+  return listToXml_((const List*) htLinkNodes(table), elementName, indent);
+}
+
+/// @fn static Bytes htToJsonLinked(const HashTable *table)
+///
+/// @brief Wrapper around listToJson that links the nodes of unlinked tables
+///   first.
+///
+/// @return Returns the value of listToJson.
+static Bytes htToJsonLinked(const HashTable *table) {
+  return htToJson(table);
+}
+
+/// @fn static bool htToJsonStreamLinked(const HashTable *table, JsonWriter *writer)
+///
+/// @brief Wrapper around listToJsonStream that links the nodes of unlinked
+///   tables first.
+///
+/// @return Returns the value of listToJsonStream.
+static bool htToJsonStreamLinked(const HashTable *table, JsonWriter *writer) {
+  return htToJsonStream(table, writer);
+}
+
+/// @fn static u64 htToBlobSizeLinked(const HashTable *table)
+///
+/// @brief Wrapper around listToBlobSize that links the nodes of unlinked
+///   tables first.
+///
+/// @return Returns the value of listToBlobSize.
+static u64 htToBlobSizeLinked(const HashTable *table) {
+  return htToBlobSize(table);
+}
+
 /// @var typeHashTable
 ///
 /// @brief TypeDescriptor describing how libraries should interact with
@@ -1273,12 +1834,15 @@ TypeDescriptor _typeHashTable = {
   .copy          = (void* (*)(const volatile void*)) htCopy,
   .destroy       = (void* (*)(volatile void*)) htDestroy,
   .size          = htSize,
-  .toBlob        = (Bytes (*)(const volatile void*)) listToBlob,
+  .toBlob        = (Bytes (*)(const volatile void*)) htToBlob,
   .fromBlob      = (void* (*)(const volatile void*, u64*, bool, bool)) htFromBlob_,
   .hashFunction  = NULL,
-  .clear         = (i32 (*)(volatile void *)) listClear,
-  .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) listToXml_,
-  .toJson        = (Bytes (*)(const volatile void*)) listToJson,
+  .clear         = (i32 (*)(volatile void *)) htClear,
+  .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) htToXmlLinked,
+  .toJson        = (Bytes (*)(const volatile void*)) htToJsonLinked,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) htToJsonStreamLinked,
+  .blobSize      = (u64 (*)(const volatile void*)) htToBlobSizeLinked,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) htToBlobBuffer,
 };
 TypeDescriptor *typeHashTable = &_typeHashTable;
 
@@ -1304,12 +1868,15 @@ TypeDescriptor _typeHashTableNoCopy = {
   .copy          = (void* (*)(const volatile void*)) shallowCopy,
   .destroy       = (void* (*)(volatile void*)) nullFunction,
   .size          = htSize,
-  .toBlob        = (Bytes (*)(const volatile void*)) listToBlob,
+  .toBlob        = (Bytes (*)(const volatile void*)) htToBlob,
   .fromBlob      = (void* (*)(const volatile void*, u64*, bool, bool)) htFromBlob_,
   .hashFunction  = NULL,
-  .clear         = (i32 (*)(volatile void *)) listClear,
-  .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) listToXml_,
-  .toJson        = (Bytes (*)(const volatile void*)) listToJson,
+  .clear         = (i32 (*)(volatile void *)) htClear,
+  .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) htToXmlLinked,
+  .toJson        = (Bytes (*)(const volatile void*)) htToJsonLinked,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) htToJsonStreamLinked,
+  .blobSize      = (u64 (*)(const volatile void*)) htToBlobSizeLinked,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) htToBlobBuffer,
 };
 TypeDescriptor *typeHashTableNoCopy = &_typeHashTableNoCopy;
 
@@ -1487,6 +2054,10 @@ bool hashTableUnitTest() { \
     printLog(ERR, "hashTable and hashTable2 are not equal after htCopy.\n"); \
     return false; \
   } \
+  if (hashTable->seed == hashTable2->seed) { \
+    printLog(ERR, "hashTable and hashTable2 have the same seed.\n"); \
+    return false; \
+  } \
   htAddEntry(hashTable2, "key2", "value2"); \
   if (htCompare(hashTable, hashTable2) == 0) { \
     printLog(ERR, "hashTable and hashTable2 are equal after htAddEntry.\n"); \
@@ -1606,6 +2177,86 @@ bool hashTableUnitTest() { \
   } \
   listDestroy(list); list = NULL; \
   htDestroy(hashTable); \
+ \
+  hashTable = htCreate(typeI32); \
+  for (int i = 0; i < 10000; i++) { \
+    htAddEntry(hashTable, &i, &i); \
+  } \
+  if (hashTable->tableSize <= OPTIMAL_HASH_TABLE_SIZE) { \
+    printLog(ERR, "Hash table did not grow after 10000 adds.\n"); \
+    return false; \
+  } \
+  for (int i = 0; i < 10000; i += 2) { \
+    if (htRemoveEntry(hashTable, &i) != 0) { \
+      printLog(ERR, "htRemoveEntry failed for %d after growth.\n", i); \
+      return false; \
+    } \
+  } \
+  for (int i = 0; i < 10000; i++) { \
+    i32 *i32Value = (i32*) htGetValue(hashTable, &i); \
+    if ((i & 1) && ((i32Value == NULL) || (*i32Value != i))) { \
+      printLog(ERR, "Value for %d was not found after growth.\n", i); \
+      return false; \
+    } else if (((i & 1) == 0) && (i32Value != NULL)) { \
+      printLog(ERR, "Value for %d was found after removal.\n", i); \
+      return false; \
+    } \
+  } \
+  if (hashTable->size != 5000) { \
+    printLog(ERR, "Expected 5000 entries after growth, found %llu.\n", \
+      llu(hashTable->size)); \
+    return false; \
+  } \
+  hashTable2 = htCopy(hashTable); \
+  if (htCompare(hashTable, hashTable2) != 0) { \
+    printLog(ERR, "Grown hashTable and its copy are not equal.\n"); \
+    return false; \
+  } \
+  htDestroy(hashTable2); \
+  htDestroy(hashTable); \
+ \
+  hashTable = htCreate(typeI32, false, 100, 6); \
+  if ((hashTable == NULL) || (hashTable->numLockStripes != 8) \
+    || ((hashTable->tableSize % 8) != 0) \
+  ) { \
+    printLog(ERR, "Lock-striped table was not created as expected.\n"); \
+    return false; \
+  } \
+  for (int i = 0; i < 10000; i++) { \
+    htAddEntry(hashTable, &i, &i); \
+  } \
+  for (int i = 0; i < 10000; i += 2) { \
+    if (htRemoveEntry(hashTable, &i) != 0) { \
+      printLog(ERR, "htRemoveEntry failed for %d in striped table.\n", i); \
+      return false; \
+    } \
+  } \
+  for (int i = 0; i < 10000; i++) { \
+    i32 *i32Value = (i32*) htGetValue(hashTable, &i); \
+    if ((i & 1) && ((i32Value == NULL) || (*i32Value != i))) { \
+      printLog(ERR, "Value for %d was not found in striped table.\n", i); \
+      return false; \
+    } else if (((i & 1) == 0) && (i32Value != NULL)) { \
+      printLog(ERR, "Value for %d was found in striped table after " \
+        "removal.\n", i); \
+      return false; \
+    } \
+  } \
+  hashTable2 = htCopy(hashTable); \
+  if ((hashTable2->numLockStripes != hashTable->numLockStripes) \
+    || (htCompare(hashTable, hashTable2) != 0) \
+  ) { \
+    printLog(ERR, "Striped hashTable and its copy are not equal.\n"); \
+    return false; \
+  } \
+  htDestroy(hashTable2); \
+  htClear(hashTable); \
+  i32 stripedKey = 1; \
+  if ((hashTable->size != 0) || (htGetValue(hashTable, &stripedKey) != NULL)) { \
+    printLog(ERR, "Striped hashTable was not cleared.\n"); \
+    return false; \
+  } \
+  htDestroy(hashTable); \
  \
   const char *xmlToParse = \
     "<hashTable>" \
@@ -1891,8 +2542,106 @@ bool hashTableUnitTest() { \
     printLog(ERR, "Expected \"value8\", got \"%s\".\n", stringValue); \
     return false; \
   } \
+  TypeDescriptor *blobType = NULL; \
+  u64 blobLength = 0; \
+  const void *blobValue = htBlobGetValue(byteArray, length, "myHashTable3", \
+    &blobType, &blobLength); \
+  if ((blobValue == NULL) || (blobType != typeHashTable)) { \
+    printLog(ERR, "htBlobGetValue did not find myHashTable3.\n"); \
+    return false; \
+  } \
+  blobValue = htBlobGetValue(blobValue, blobLength, "myHashTable4", \
+    &blobType, &blobLength); \
+  if ((blobValue == NULL) || (blobType != typeHashTable)) { \
+    printLog(ERR, "htBlobGetValue did not find myHashTable4.\n"); \
+    return false; \
+  } \
+  blobValue = htBlobGetValue(blobValue, blobLength, "key8", \
+    &blobType, &blobLength); \
+  if ((blobValue == NULL) || (blobType != typeBytes)) { \
+    printLog(ERR, "htBlobGetValue did not find key8.\n"); \
+    return false; \
+  } \
+  stringValue = (char*) typeBytes->fromBlob(blobValue, &blobLength, true, true); \
+  if ((stringValue == NULL) || (strcmp(stringValue, "value8") != 0)) { \
+    printLog(ERR, "Expected \"value8\" in place, got \"%s\".\n", \
+      (stringValue != NULL) ? stringValue : "NULL"); \
+    return false; \
+  } \
+  if (htBlobGetValue(byteArray, length, "key0", NULL, NULL) != NULL) { \
+    printLog(ERR, "htBlobGetValue found a key that is not there.\n"); \
+    return false; \
+  } \
   byteArray = bytesDestroy(byteArray); \
   hashTable = htDestroy(hashTable); \
+ \
+  hashTable = htCreate(typeI32); \
+  for (int ii = 0; ii < 100; ii++) { \
+    htAddEntry(hashTable, &ii, &ii, typeI32); \
+  } \
+  HashTableStats hashTableStats; \
+  if ((htStats(hashTable, &hashTableStats) != 0) \
+    || (hashTableStats.size != 100) \
+    || (hashTableStats.emptyBuckets > hashTableStats.tableSize) \
+    || (hashTableStats.maxBucketDepth == 0) \
+    || (hashTableStats.memoryBytes == 0) \
+  ) { \
+    printLog(ERR, "htStats returned unexpected statistics.\n"); \
+    return false; \
+  } \
+  if (htStats(NULL, &hashTableStats) == 0) { \
+    printLog(ERR, "htStats succeeded with a NULL table.\n"); \
+    return false; \
+  } \
+  hashTable = htDestroy(hashTable); \
+ \
+  hashTable = htCreate(typeI32, false, 0, 0, true); \
+  for (int ii = 0; ii < 100; ii++) { \
+    htAddEntry(hashTable, &ii, &ii, typeI32); \
+  } \
+  if ((hashTable->head != NULL) || (hashTable->size != 100)) { \
+    printLog(ERR, "Unlinked table maintained its list.\n"); \
+    return false; \
+  } \
+  i32 unlinkedKey = 42; \
+  if ((htGetValue(hashTable, &unlinkedKey) == NULL) \
+    || (htRemoveEntry(hashTable, &unlinkedKey) != 0) \
+    || (htGetValue(hashTable, &unlinkedKey) != NULL) \
+  ) { \
+    printLog(ERR, "Lookup or removal failed in unlinked table.\n"); \
+    return false; \
+  } \
+  u64 numLinked = 0; \
+  for (HashNode *node = htLinkNodes(hashTable)->head; node != NULL; \
+    node = node->next \
+  ) { \
+    numLinked++; \
+  } \
+  if (numLinked != 99) { \
+    printLog(ERR, "htLinkNodes linked %llu nodes, expected 99.\n", \
+      llu(numLinked)); \
+    return false; \
+  } \
+  htAddEntry(hashTable, &unlinkedKey, &unlinkedKey, typeI32); \
+  if (hashTable->head != NULL) { \
+    printLog(ERR, "Adding to an unlinked table did not clear its list.\n"); \
+    return false; \
+  } \
+  list = htToList(hashTable); \
+  if ((list == NULL) || (list->size != 100)) { \
+    printLog(ERR, "htToList did not list every entry of unlinked table.\n"); \
+    return false; \
+  } \
+  list = listDestroy(list); \
+  hashTable2 = htCopy(hashTable); \
+  if ((hashTable2 == NULL) || (hashTable2->unlinked == false) \
+    || (htCompare(hashTable, hashTable2) != 0) \
+  ) { \
+    printLog(ERR, "htCopy of unlinked table did not match.\n"); \
+    return false; \
+  } \
+  hashTable2 = htDestroy(hashTable2); \
+  hashTable = htDestroy(hashTable); \
  \
   return true; \
 }
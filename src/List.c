@@ -30,6 +30,8 @@
 
 #include "List.h"
 #include "StringLib.h"
+#include "NodePool.h"
+#include "Allocator.h"
 #ifdef DS_LOGGING_ENABLED
 #include "LoggingLib.h"
 #else
@@ -40,8 +42,43 @@
 #endif
 
 #include "Vector.h" // For to/from JSON support
+#include "LockStats.h"
 
-/// @fn List *listCreate_(TypeDescriptor *keyType, bool disableThreadSafety, ...)
+/// @fn static inline ListNode* listAllocNode(List *list)
+///
+/// @brief Get memory for a new node from the list's NodePool or, if it
+/// doesn't have one, from the allocator.
+///
+/// @param list The List the node is for.
+///
+/// @return Returns uninitialized memory for the node on success, NULL on
+/// failure.
+static inline ListNode* listAllocNode(List *list) {
+  if (list->nodePool != NULL) {
+    return (ListNode*) nodePoolAlloc(list->nodePool, sizeof(ListNode));
+  }
+  
+  return (ListNode*) allocatorMalloc(ALLOCATOR_LIST, list->keyType,
+    sizeof(ListNode));
+}
+
+/// @fn static inline ListNode* listFreeNode(List *list, ListNode *node)
+///
+/// @brief Release the memory of a node obtained from listAllocNode.
+///
+/// @param list The List the node belongs to.
+/// @param node The node to release.
+///
+/// @return Always returns NULL.
+static inline ListNode* listFreeNode(List *list, ListNode *node) {
+  if (list->nodePool != NULL) {
+    return (ListNode*) nodePoolFree(list->nodePool, node);
+  }
+  
+  return (ListNode*) allocatorFree(ALLOCATOR_LIST, list->keyType, node);
+}
+
+/// @fn List *listCreate_(TypeDescriptor *keyType, bool disableThreadSafety, bool pooledNodes, ...)
 ///
 /// @brief Create a new linked list data structure.
 ///
@@ -49,13 +86,19 @@
 ///   used with this list.
 /// @param disableThreadSafety Whether or not to disable thread safety for the
 ///   List.
+/// @param pooledNodes Whether or not to allocate the List's nodes from a
+///   NodePool owned by the List.  This is worth it for lists with a lot of
+///   churn.  Memory for removed nodes is kept for reuse until the List is
+///   destroyed.
 ///
 /// @note This function is wrapped by a macro of the same name (minus the
 /// trailing underscore) that automatically provides false for the
-/// dsiableThreadSafety parameter.
+/// dsiableThreadSafety and pooledNodes parameters.
 ///
 /// @return Returns a new list on success, NULL on failure.
-List *listCreate_(TypeDescriptor *keyType, bool disableThreadSafety, ...) {
+List *listCreate_(TypeDescriptor *keyType, bool disableThreadSafety,
+  bool pooledNodes, ...
+) {
   if (keyType == NULL) {
     // Can't make a functional list.
     printLog(ERR, "keyType is NULL.\n");
@@ -64,7 +107,7 @@ List *listCreate_(TypeDescriptor *keyType, bool disableThreadSafety, ...) {
   
   printLog(TRACE, "ENTER listCreate(keyType=%s)\n", keyType->name);
   
-  List *list = (List*) calloc(1, sizeof(List));
+  List *list = (List*) allocatorCalloc(ALLOCATOR_LIST, NULL, 1, sizeof(List));
   if (list == NULL) {
     // Out of memory.  Fail.
     LOG_MALLOC_FAILURE();
@@ -75,12 +118,22 @@ List *listCreate_(TypeDescriptor *keyType, bool disableThreadSafety, ...) {
   
   if (disableThreadSafety == false) {
     // The mtx_t lock member has to be zeroed, so use calloc here.
-    list->lock = (mtx_t*) calloc(1, sizeof(mtx_t));
+    list->lock
+      = (mtx_t*) allocatorCalloc(ALLOCATOR_LIST, NULL, 1, sizeof(mtx_t));
     if (mtx_init(list->lock, mtx_plain | mtx_recursive) != thrd_success) {
       printLog(ERR, "Could not initialize list mutex lock.\n");
     }
   }
   
+  if (pooledNodes == true) {
+    list->nodePool
+      = nodePoolCreate(sizeof(ListNode), ALLOCATOR_LIST, keyType);
+    if (list->nodePool == NULL) {
+      // Not fatal.  The list just falls back to malloc.
+      printLog(ERR, "Could not create list node pool.\n");
+    }
+  }
+  
   printLog(TRACE, "EXIT listCreate(keyType=%s) = {%p}\n", keyType->name, list);
   return list;
 }
@@ -130,7 +183,7 @@ ListNode *listAddFrontEntry_(List *list, const volatile void *key,
     }
   }
   
-  ListNode *node = (ListNode*) malloc(sizeof(ListNode));
+  ListNode *node = listAllocNode(list);
   if (node == NULL) {
     // Out of memory.  Fail.
     printLog(ERR, "Could not allocate memory for list node.\n");
@@ -214,7 +267,7 @@ ListNode *listAddBackEntry_(List *list, const volatile void *key,
     }
   }
   
-  ListNode *node = (ListNode*) malloc(sizeof(ListNode));
+  ListNode *node = listAllocNode(list);
   if (node == NULL) {
     // Out of memory.  Fail.
     printLog(ERR, "Could not allocate memory for list node.\n");
@@ -535,7 +588,7 @@ int listDestroyNode(List *list, ListNode *node) {
   if (node == list->tail) {
     list->tail = node->prev;
   }
-  node = (ListNode*) pointerDestroy(node);
+  node = listFreeNode(list, node);
   list->size--;
   
   if (list->lock != NULL) {
@@ -578,9 +631,10 @@ List* listDestroy(List *list) {
   if (list->lock != NULL) {
     mtx_destroy(list->lock);
   }
-  list->lock = (mtx_t*) pointerDestroy(list->lock);
+  list->lock = (mtx_t*) allocatorFree(ALLOCATOR_LIST, NULL, list->lock);
+  list->nodePool = nodePoolDestroy(list->nodePool);
   
-  list = (List*) pointerDestroy(list);
+  list = (List*) allocatorFree(ALLOCATOR_LIST, NULL, list);
   
   printLog(TRACE, "EXIT listDestroy(list=%p) = {0}\n", list);
   return NULL;
@@ -772,177 +826,6 @@ Bytes listToBytes(const List *list) {
   return returnValue;
 }
 
-/// @fn List *xmlToList(const char *inputData)
-///
-/// @brief Take SOAP data and return a list of key-value objects.
-///
-/// @param inputData is the full data string from a POST call.
-///
-/// @return Returns a List containing the ListNodes parsed.
-List *xmlToList(const char *inputData) {
-  char *separatorAt = NULL;
-  char *listString = NULL, *indentedListString = NULL;
-  List *list = NULL;
-  char *key = NULL;
-  Bytes value = NULL;
-  char *xmlString = NULL;
-  
-  printLog(TRACE, "ENTER xmlToList(inputData=\"%s\")\n", inputData);
-  
-  if (inputData == NULL) {
-    printLog(ERR, "NULL inputData provided.\n");
-    printLog(TRACE, "EXIT xmlToHashList(inputData=NULL) = {NULL}\n");
-    return NULL;
-  }
-  
-  const char *startAt = &(inputData[strspn(inputData, " \t\n")]);
-  if (*startAt != '<') {
-    printLog(DEBUG, "No XML provided.\n");
-    printLog(TRACE, "EXIT xmlToList(inputData=NULL) = {NULL}\n");
-    return NULL;
-  }
-  straddstr(&xmlString, startAt);
-  
-  list = listCreate(typeString);
-  // No need to lock the list since nothing else can be using it yet.
-  
-  separatorAt = strstr(xmlString, "Request");
-  if (separatorAt == NULL) {
-    // Might be response data we're parsing instead of request data.  Try that.
-    separatorAt = strstr(xmlString, "Response");
-  }
-  if (separatorAt == NULL) {
-    // See if it's just generic XML, maybe.
-    printLog(DEBUG, "Looking for generic XML data.\n");
-    separatorAt = strchr(xmlString, '>');
-    if (separatorAt != NULL && separatorAt != xmlString) {
-      printLog(DEBUG, "Generic XML data found.\n");
-      separatorAt--;
-    }
-  }
-  if (separatorAt != NULL) {
-    separatorAt = strchr(separatorAt, '>'); // Skip over the request header
-    if (separatorAt != NULL) {
-      separatorAt = strchr(separatorAt, '<');
-      // We're now either at the first field or the close of the request
-    }
-  }
-  
-  while (separatorAt != NULL && *(separatorAt + 1) != '/') {
-    char *endOfLine = strchr(separatorAt, '\n');
-    // separatorAt should point to a '<'
-    char *endOfTag = strchr((++separatorAt), ' ');
-    printLog(DEBUG, "In separatorAt while.\n");
-    
-    if (endOfLine == NULL) {
-      // XML is all on one line
-      endOfLine = separatorAt + strlen(separatorAt);
-    }
-    
-    if (endOfTag != NULL && strchr(separatorAt, '>') &&
-      strchr(separatorAt, '>') < endOfTag) {
-      endOfTag = strchr((separatorAt), '>');
-    }
-    
-    if (endOfTag == NULL || endOfTag > endOfLine) {
-      endOfTag = strchr((separatorAt), '>');
-    }
-    
-    if (endOfTag != NULL) {
-      char *valueAt = NULL;
-      char *closeTag = NULL;
-      
-      if (*endOfTag == '>' && *(endOfTag - 1) == '/') {
-        // There is no value for this key
-        valueAt = NULL;
-      } else if (*endOfTag == '>') {
-        valueAt = endOfTag + 1;
-      } else { // endOfTag is ' '
-        valueAt = strchr((separatorAt + 1), '>');
-        if (valueAt) {
-          valueAt = valueAt + 1;
-        }
-      }
-      *endOfTag = '\0';
-      key = (char *) malloc(strlen(separatorAt) + 1);
-      strcpy(key, separatorAt);
-      straddstr(&closeTag, "</");
-      straddstr(&closeTag, key);
-      if (valueAt) {
-        endOfTag = strstr(valueAt, closeTag);
-      } else {
-        endOfTag = NULL;
-      }
-      if (endOfTag != NULL) {
-        *endOfTag = '\0';
-        value = NULL;
-        bytesAddStr(&value, valueAt);
-      } else {
-        // No value but there WAS a tag so we can't just leave the value
-        // NULL.  Make it an empty string.
-        value = NULL;
-        bytesAddData(&value, "", 1);
-      }
-      closeTag = stringDestroy(closeTag);
-      
-      // OK.  We're parsing XML data.  It's possible that what we just parsed
-      // is really just more XML.  If so, it should be added to a subordinate
-      // List.  Try to detect this case and act intelligently.
-      if (strstr(str(value), "<") != NULL &&
-        strrchr(str(value), '>') != NULL &&
-        strstr(str(value), "<") < strrchr(str(value), '>')) {
-        // Probably more XML.  Make it look like XML and parse again.
-        char *xmlValue = NULL;
-        straddstr(&xmlValue, "<");
-        straddstr(&xmlValue, key);
-        straddstr(&xmlValue, ">\n");
-        straddstr(&xmlValue, str(value));
-        straddstr(&xmlValue, "</");
-        straddstr(&xmlValue, key);
-        straddstr(&xmlValue, ">\n");
-        value = bytesDestroy(value);
-        List *subList = xmlToList(xmlValue);
-        xmlValue = stringDestroy(xmlValue);
-        ListNode *newNode = listAddBackEntry(list, key, subList, typeListNoCopy);
-        if (newNode == NULL) {
-          printLog(ERR, "listAddBackEntry returned an error.\n");
-        }
-        newNode->type = typeList;
-      }
-    } else {
-      // No end of tag?  Is this possible?
-    }
-    
-    if (value != NULL) {
-      ListNode *node = listAddBackEntry(list, key, value, typeBytesNoCopy);
-      if (node != NULL) {
-        node->type = typeBytes;
-      } else {
-        printLog(ERR, "listAddBackEntry failed when adding key/value pair.\n");
-      }
-    }
-    key = stringDestroy(key);
-    
-    // separatorAt should now be at the beginning of the value
-    // endOfTag should now be at the '<' of the closing tag but set to '\0'
-    if (endOfTag != NULL) {
-      separatorAt = strchr((endOfTag + 1), '<');
-    } else {
-      separatorAt = separatorAt + 1;
-      separatorAt = strchr(separatorAt, '<');
-    }
-    // separatorAt should now be at the '<' of the opening tag of the next value
-  }
-  
-  xmlString = stringDestroy(xmlString);
-  listString = listToString(list);
-  indentedListString = indentText(listString, 2);
-  listString = stringDestroy(listString);
-  printLog(TRACE, "EXIT xmlToList(inputData=\"%s\") = {%s}\n", inputData, indentedListString);
-  indentedListString = stringDestroy(indentedListString);
-  return list;
-}
-
 /// @fn Bytes listToXml(const List *list, const char *elementName)
 ///
 /// @brief Convert a list to its XML representation.
@@ -1253,130 +1136,565 @@ size_t listSize(const volatile void *value) {
   return size;
 }
 
-/// @fn Bytes listToBlob(const List *list)
+/// @def LIST_BLOB_HEADER_SIZE
 ///
-/// @brief Convert a List to a single array of bytes.
+/// @brief The number of bytes in the header of a version 11 byte array:  the
+/// DsMarker (u16), the DsVersion (u32), the key type index (i16), the number
+/// of entries (u64), the offset of the entry index (u64), and the order of the
+/// entry index (u8).
+#define LIST_BLOB_HEADER_SIZE 25
+
+/// @def LIST_BLOB_SIZE_OFFSET
 ///
-/// @param list The List (or compatible data structure) to convert.
+/// @brief The offset of the number of entries within a byte array.
+#define LIST_BLOB_SIZE_OFFSET 8
+
+/// @def LIST_BLOB_INDEX_OFFSET_OFFSET
 ///
-/// @return Returns a Bytes object with the encoded list on success,
-/// NULL on failure.
-Bytes listToBlob(const List *list) {
-  Bytes returnValue = NULL;
-  i16 typeIndex = 0;
-  u64 size = 0;
-  printLog(TRACE, "ENTER listToBlob(list=%p)\n", list);
+/// @brief The offset of the entry index's offset within a version 11 byte
+/// array.
+#define LIST_BLOB_INDEX_OFFSET_OFFSET 16
+
+/// @def LIST_BLOB_INDEX_ORDER_OFFSET
+///
+/// @brief The offset of the entry index's order within a version 11 byte
+/// array.
+#define LIST_BLOB_INDEX_ORDER_OFFSET 24
+
+/// @def LIST_BLOB_INDEX_ORDER_NODES
+///
+/// @brief Index order for byte arrays whose index follows the order of the
+/// nodes in the encoded data structure.
+#define LIST_BLOB_INDEX_ORDER_NODES 0
+
+/// @def LIST_BLOB_INDEX_ORDER_KEYS
+///
+/// @brief Index order for byte arrays whose index is sorted by key, which
+/// allows the array to be binary searched.
+#define LIST_BLOB_INDEX_ORDER_KEYS 1
+
+/// @struct ListBlobIndexEntry
+///
+/// @brief One entry of the index of a byte array that is being built.
+///
+/// @param key The key of the node the entry describes.
+/// @param keyType The TypeDescriptor of key.  This is kept with the entry so
+///   that qsort can compare two entries without any shared state.
+/// @param entryOffset The offset of the node's type index within the array.
+/// @param keyOffset The offset of the node's encoded key within the array.
+typedef struct ListBlobIndexEntry {
+  const volatile void *key;
+  TypeDescriptor *keyType;
+  u64 entryOffset;
+  u64 keyOffset;
+} ListBlobIndexEntry;
+
+/// @fn int listBlobIndexEntryCompare(const void *entryAPointer, const void *entryBPointer)
+///
+/// @brief Compare the keys of two ListBlobIndexEntry objects.
+///
+/// @note This has to be passed to qsort as its __compar_fn_t parameter, so the
+/// function signature is dictated by that typedef.
+///
+/// @param entryAPointer A pointer to a ListBlobIndexEntry.
+/// @param entryBPointer A pointer to a ListBlobIndexEntry for the same list.
+///
+/// @return Returns a value less than 0 if the key of entryAPointer is less
+/// than the key of entryBPointer, 0 if they are equal, and a value greater than
+/// 0 if the key of entryAPointer is greater.
+static int listBlobIndexEntryCompare(
+  const void *entryAPointer, const void *entryBPointer
+) {
+  const ListBlobIndexEntry *entryA = (const ListBlobIndexEntry*) entryAPointer;
+  const ListBlobIndexEntry *entryB = (const ListBlobIndexEntry*) entryBPointer;
   
-  if (list== NULL) {
-    printLog(ERR, "One or more NULL parameters.\n");
-    printLog(TRACE, "EXIT listToBlob(list=%p) = {%p}\n", list,
-      returnValue);
-    return returnValue;
+  return entryA->keyType->compare(entryA->key, entryB->key);
+}
+
+/// @fn static i16 listBlobTypeIndex(TypeDescriptor *type)
+///
+/// @brief Get the type index that is encoded in a byte array for a type.
+///
+/// @param type The TypeDescriptor to look up.
+///
+/// @return Returns the type index to encode on success, -1 if the type is not
+/// registered.
+static i16 listBlobTypeIndex(TypeDescriptor *type) {
+  i16 typeIndex = getIndexFromTypeDescriptor(type);
+  if (typeIndex < 0) {
+    // Index is invalid.  TypeDescriptor was not found.
+    return -1;
+  }
+  if (type->copy == typeStringNoCopy->copy) {
+    // Use the base type instead of the NoCopy type.
+    typeIndex--;
   }
   
-  if ((list->lock != NULL) && (mtx_lock(list->lock) != thrd_success)) {
-    printLog(WARN, "Could not lock list mutex.\n");
+  return typeIndex;
+}
+
+/// @fn static u64 listBlobValueSize(TypeDescriptor *type, const volatile void *value)
+///
+/// @brief Get the number of bytes toBlob would produce for a value.
+///
+/// @param type The TypeDescriptor of value.  Types without a blobSize
+///   function are sized by encoding the value with toBlob.
+/// @param value The value to size.
+///
+/// @return Returns the size of the encoded value, 0 if it cannot be encoded.
+static u64 listBlobValueSize(TypeDescriptor *type, const volatile void *value) {
+  if (type->blobSize != NULL) {
+    return type->blobSize(value);
   }
   
-  // Metadata
-  u16 dsMarker = DsMarker;
-  hostToLittleEndian(&dsMarker, sizeof(dsMarker));
-  bytesAddData(&returnValue, &dsMarker, sizeof(DsMarker));
-  u32 dsVersion = DsVersion;
-  hostToLittleEndian(&dsVersion, sizeof(dsVersion));
-  bytesAddData(&returnValue, &dsVersion, sizeof(dsVersion));
+  Bytes blob = type->toBlob(value);
+  u64 size = bytesSize(blob);
+  blob = bytesDestroy(blob);
+  return size;
+}
+
+/// @fn static u64 listBlobValueWrite(TypeDescriptor *type, const volatile void *value, char *buffer, u64 bufferSize)
+///
+/// @brief Encode a value the way toBlob would, directly into a buffer.
+///
+/// @param type The TypeDescriptor of value.  Types without a toBlobBuffer
+///   function are encoded with toBlob and copied.
+/// @param value The value to encode.
+/// @param buffer The memory to encode the value into.
+/// @param bufferSize The number of bytes available at buffer.
+///
+/// @return Returns the number of bytes written, 0 if the value cannot be
+/// encoded or does not fit.
+static u64 listBlobValueWrite(TypeDescriptor *type, const volatile void *value,
+  char *buffer, u64 bufferSize
+) {
+  if (type->toBlobBuffer != NULL) {
+    return type->toBlobBuffer(value, buffer, bufferSize);
+  }
   
-  typeIndex = getIndexFromTypeDescriptor(list->keyType);
-  if (typeIndex < 0) {
-    // Index is invalid.  TypeDescriptor was not found.
-    printLog(ERR, "Could not find list key type \"%s\".\n",
-      list->keyType->name);
-    if (list->lock != NULL) {
-      mtx_unlock(list->lock);
+  Bytes blob = type->toBlob(value);
+  // *DO NOT* use bytesLength here.  toBlob sets the size to be the full
+  // amount of data encoded, which includes the NULL terminator of strings.
+  u64 size = bytesSize(blob);
+  if (size > bufferSize) {
+    size = 0;
+  } else if (size > 0) {
+    memcpy(buffer, blob, size);
+  }
+  blob = bytesDestroy(blob);
+  return size;
+}
+
+/// @fn static u64 listToBlobSizeUnlocked(const List *list, const volatile void *defaultKey)
+///
+/// @brief Compute the exact number of bytes listToBlob would produce for a
+/// list.  The caller must hold the list's lock.
+///
+/// @param list The List (or compatible data structure) to size.
+/// @param defaultKey The value whose encoding is used in place of values and
+///   keys that cannot be encoded.
+///
+/// @return Returns the size of the encoded list.
+static u64 listToBlobSizeUnlocked(const List *list,
+  const volatile void *defaultKey
+) {
+  u64 defaultSize = listBlobValueSize(list->keyType, defaultKey);
+  u64 size = LIST_BLOB_HEADER_SIZE;
+  
+  ListNode *node = NULL;
+  u64 listSize = list->size;
+  u64 index = 0;
+  for (node = list->head;
+    (node != NULL) && (index++ < listSize);
+    node = node->next
+  ) {
+    if (listBlobTypeIndex(node->type) < 0) {
+      // listToBlobBufferUnlocked will skip this node.
+      continue;
     }
     
-    printLog(TRACE, "EXIT listToBlob(list=%p) = {%p}\n", list,
-      returnValue);
-    return returnValue;
+    u64 valueSize = listBlobValueSize(node->type, node->value);
+    u64 keySize = listBlobValueSize(list->keyType, node->key);
+    size += sizeof(i16) + DS_INDEX_ENTRY_SIZE
+      + ((valueSize > 0) ? valueSize : defaultSize)
+      + ((keySize > 0) ? keySize : defaultSize);
   }
-  if (list->keyType->copy == typeStringNoCopy->copy) {
-    // Use the base type instead of the NoCopy type.
-    typeIndex--;
+  
+  return size;
+}
+
+/// @fn static u64 listToBlobBufferUnlocked(const List *list, u8 indexOrder, bool listIsSorted, const volatile void *defaultKey, char *buffer, u64 bufferSize)
+///
+/// @brief Encode a List into a buffer as a version 11 byte array that ends
+/// with an index of its entries.  The caller must hold the list's lock.
+///
+/// @details Each entry is encoded the same way it was in version 10 of the
+/// format:  the type index of the value, the value's blob, and the key's blob.
+/// The header records where the index starts, and every index entry holds
+/// the offsets of an entry's type index and key from the start of the array.
+/// Because all offsets are relative to the start of the array, a nested data
+/// structure's value is itself a complete, searchable byte array.
+///
+/// @param list The List (or compatible data structure) to encode.
+/// @param indexOrder LIST_BLOB_INDEX_ORDER_NODES or LIST_BLOB_INDEX_ORDER_KEYS.
+/// @param listIsSorted Whether the nodes of the list are already in key order,
+///   in which case the index does not need to be sorted.
+/// @param defaultKey The value whose encoding is used in place of values and
+///   keys that cannot be encoded.
+/// @param buffer The memory to encode the list into.
+/// @param bufferSize The number of bytes available at buffer.
+///
+/// @return Returns the number of bytes written on success, 0 if the list could
+/// not be encoded or did not fit.
+static u64 listToBlobBufferUnlocked(const List *list, u8 indexOrder,
+  bool listIsSorted, const volatile void *defaultKey, char *buffer,
+  u64 bufferSize
+) {
+  i16 typeIndex = listBlobTypeIndex(list->keyType);
+  if (typeIndex < 0) {
+    printLog(ERR, "Could not find list key type \"%s\".\n",
+      list->keyType->name);
+    return 0;
+  } else if (bufferSize < LIST_BLOB_HEADER_SIZE) {
+    return 0;
   }
-  hostToLittleEndian(&typeIndex, sizeof(i16));
-  bytesAddData(&returnValue, &typeIndex, sizeof(i16));
   
-  size = list->size;
-  hostToLittleEndian(&size, sizeof(size));
-  bytesAddData(&returnValue, &size, sizeof(size));
+  u64 listSize = list->size;
+  ListBlobIndexEntry *indexEntries = (ListBlobIndexEntry*) malloc(
+    (listSize + 1) * sizeof(ListBlobIndexEntry));
+  if (indexEntries == NULL) {
+    LOG_MALLOC_FAILURE();
+    return 0;
+  }
   
-  // Construct a default value for NULL values.
-  void* defaultKey = list->keyType->create(NULL);
-  Bytes defaultValue = list->keyType->toBlob(defaultKey);
-  defaultKey = list->keyType->destroy(defaultKey);
+  // Metadata.  The size and index offset are filled in once the entries have
+  // been written.
+  u16 dsMarker = DsMarker;
+  hostToLittleEndian(&dsMarker, sizeof(dsMarker));
+  memcpy(buffer, &dsMarker, sizeof(dsMarker));
+  u32 dsVersion = DsVersion;
+  hostToLittleEndian(&dsVersion, sizeof(dsVersion));
+  memcpy(&buffer[sizeof(dsMarker)], &dsVersion, sizeof(dsVersion));
+  hostToLittleEndian(&typeIndex, sizeof(i16));
+  memcpy(&buffer[sizeof(dsMarker) + sizeof(dsVersion)], &typeIndex,
+    sizeof(i16));
+  buffer[LIST_BLOB_INDEX_ORDER_OFFSET] = (char) indexOrder;
+  u64 offset = LIST_BLOB_HEADER_SIZE;
   
+  u64 size = 0;
   ListNode *node = NULL;
-  u64 listSize = list->size;
   u64 index = 0;
   for (node = list->head;
     (node != NULL) && (index++ < listSize);
     node = node->next
   ) {
-    Bytes value = NULL, key = NULL;
-    typeIndex = getIndexFromTypeDescriptor(node->type);
+    typeIndex = listBlobTypeIndex(node->type);
     if (typeIndex < 0) {
-      // Index is invalid.  TypeDescriptor was not found.
       printLog(ERR, "Could not find node type \"%s\".  Skipping node.\n",
         node->type->name);
       continue;
     }
-    if (node->type->copy == typeStringNoCopy->copy) {
-      // Use the base type instead of the NoCopy type.
-      typeIndex--;
+    if (bufferSize - offset < sizeof(i16)) {
+      break;
     }
+    
+    indexEntries[size].key = node->key;
+    indexEntries[size].keyType = list->keyType;
+    indexEntries[size].entryOffset = offset;
     hostToLittleEndian(&typeIndex, sizeof(i16));
-    value = node->type->toBlob(node->value);
-    if (value == NULL) {
-      value = defaultValue;
-    }
-    key = list->keyType->toBlob(node->key);
-    if (key == NULL) {
-      key = defaultValue;
-    }
+    memcpy(&buffer[offset], &typeIndex, sizeof(i16));
+    offset += sizeof(i16);
     
-    bytesAddData(&returnValue, &typeIndex, sizeof(i16));
-    // *DO NOT* use bytesAddBytes or bytesLength here.  The toBlob call
-    // above will set the size to be the full amount of data encoded.
-    // bytesAddBytes and bytesLength do not return the full amount of data
-    // encoded for string values (it doesn't include the NULL terminator).
-    // We need to gurantee that we get the full data.
-    bytesAddData(&returnValue, value, bytesSize(value));
-    if (value != defaultValue) {
-      value = bytesDestroy(value);
+    u64 written = listBlobValueWrite(node->type, node->value,
+      &buffer[offset], bufferSize - offset);
+    if (written == 0) {
+      written = listBlobValueWrite(list->keyType, defaultKey,
+        &buffer[offset], bufferSize - offset);
     }
-    value = NULL;
-    bytesAddData(&returnValue, key, bytesSize(key));
-    if (key != defaultValue) {
-      key = bytesDestroy(key);
+    offset += written;
+    indexEntries[size].keyOffset = offset;
+    written = listBlobValueWrite(list->keyType, node->key,
+      &buffer[offset], bufferSize - offset);
+    if (written == 0) {
+      written = listBlobValueWrite(list->keyType, defaultKey,
+        &buffer[offset], bufferSize - offset);
     }
-    key = NULL;
+    offset += written;
+    size++;
+  }
+  
+  if ((indexOrder == LIST_BLOB_INDEX_ORDER_KEYS) && (listIsSorted == false)) {
+    qsort(indexEntries, size, sizeof(ListBlobIndexEntry),
+      listBlobIndexEntryCompare);
+  }
+  
+  u64 indexOffset = offset;
+  if ((node != NULL) && (index <= listSize)) {
+    // The loop above ran out of space.
+    offset = 0;
+  } else if ((bufferSize - offset) / DS_INDEX_ENTRY_SIZE < size) {
+    offset = 0;
+  } else {
+    for (index = 0; index < size; index++) {
+      u64 offsets[2] = {
+        indexEntries[index].entryOffset,
+        indexEntries[index].keyOffset
+      };
+      hostToLittleEndian(&offsets[0], sizeof(offsets[0]));
+      hostToLittleEndian(&offsets[1], sizeof(offsets[1]));
+      memcpy(&buffer[offset], offsets, sizeof(offsets));
+      offset += sizeof(offsets);
+    }
+    
+    // Only the nodes that were actually encoded are counted.
+    hostToLittleEndian(&size, sizeof(size));
+    memcpy(&buffer[LIST_BLOB_SIZE_OFFSET], &size, sizeof(size));
+    hostToLittleEndian(&indexOffset, sizeof(indexOffset));
+    memcpy(&buffer[LIST_BLOB_INDEX_OFFSET_OFFSET], &indexOffset,
+      sizeof(indexOffset));
+  }
+  indexEntries = (ListBlobIndexEntry*) pointerDestroy(indexEntries);
+  
+  return offset;
+}
+
+/// @fn static Bytes listToIndexedBlob(const List *list, u8 indexOrder, bool listIsSorted)
+///
+/// @brief Convert a List to a single array of bytes that ends with an index of
+/// the entries in the array.
+///
+/// @details The array is built in two passes.  The first computes its exact
+/// size so that the second can encode every value directly into one buffer
+/// without any intermediate Bytes objects.
+///
+/// @param list The List (or compatible data structure) to convert.
+/// @param indexOrder LIST_BLOB_INDEX_ORDER_NODES or LIST_BLOB_INDEX_ORDER_KEYS.
+/// @param listIsSorted Whether the nodes of the list are already in key order,
+///   in which case the index does not need to be sorted.
+///
+/// @return Returns a Bytes object with the encoded list on success,
+/// NULL on failure.
+static Bytes listToIndexedBlob(const List *list, u8 indexOrder,
+  bool listIsSorted
+) {
+  Bytes returnValue = NULL;
+  
+  if (listBlobTypeIndex(list->keyType) < 0) {
+    printLog(ERR, "Could not find list key type \"%s\".\n",
+      list->keyType->name);
+    return returnValue;
+  }
+  
+  if ((list->lock != NULL) && (mtx_lock(list->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock list mutex.\n");
+  }
+  
+  // Construct a default value for NULL values.
+  void* defaultKey = list->keyType->create(NULL);
+  u64 size = listToBlobSizeUnlocked(list, defaultKey);
+  if (bytesAllocate(&returnValue, size) == NULL) {
+    LOG_MALLOC_FAILURE();
+  } else if (listToBlobBufferUnlocked(list, indexOrder, listIsSorted,
+    defaultKey, (char*) returnValue, size) != size
+  ) {
+    printLog(ERR, "List changed while it was being converted.\n");
+    returnValue = bytesDestroy(returnValue);
+  } else {
+    returnValue[size] = '\0';
+    bytesSetLength(returnValue, size);
+    // Set the size to match the length.  This is so recursive toBlob calls
+    // will encode the right amount of data, which does not include the NULL
+    // string terminator in our case.
+    bytesSetSize(returnValue, size);
+  }
+  defaultKey = list->keyType->destroy(defaultKey);
+  
+  if (list->lock != NULL) {
+    mtx_unlock(list->lock);
+  }
+  
+  return returnValue;
+}
+
+/// @fn static u64 listToIndexedBlobBuffer(const List *list, u8 indexOrder, bool listIsSorted, void *buffer, u64 bufferSize)
+///
+/// @brief Lock a list and encode it into a buffer.
+///
+/// @param list The List (or compatible data structure) to encode.
+/// @param indexOrder LIST_BLOB_INDEX_ORDER_NODES or LIST_BLOB_INDEX_ORDER_KEYS.
+/// @param listIsSorted Whether the nodes of the list are already in key order.
+/// @param buffer The memory to encode the list into.
+/// @param bufferSize The number of bytes available at buffer.
+///
+/// @return Returns the number of bytes written on success, 0 on failure.
+static u64 listToIndexedBlobBuffer(const List *list, u8 indexOrder,
+  bool listIsSorted, void *buffer, u64 bufferSize
+) {
+  if ((list == NULL) || (buffer == NULL)) {
+    return 0;
+  }
+  
+  if ((list->lock != NULL) && (mtx_lock(list->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock list mutex.\n");
   }
   
-  defaultValue = bytesDestroy(defaultValue);
+  void* defaultKey = list->keyType->create(NULL);
+  u64 written = listToBlobBufferUnlocked(list, indexOrder, listIsSorted,
+    defaultKey, (char*) buffer, bufferSize);
+  defaultKey = list->keyType->destroy(defaultKey);
+  
+  if (list->lock != NULL) {
+    mtx_unlock(list->lock);
+  }
+  
+  return written;
+}
+
+/// @fn u64 listToBlobSize(const List *list)
+///
+/// @brief Compute the exact number of bytes listToBlob (or listToKeyedBlob)
+/// would produce for a list without encoding it.
+///
+/// @param list The List (or compatible data structure) to size.
+///
+/// @return Returns the size of the encoded list, 0 if list is NULL.
+u64 listToBlobSize(const List *list) {
+  u64 size = 0;
+  printLog(TRACE, "ENTER listToBlobSize(list=%p)\n", list);
+  
+  if (list == NULL) {
+    printLog(TRACE, "EXIT listToBlobSize(list=%p) = {%llu}\n",
+      list, llu(size));
+    return size;
+  }
+  
+  if ((list->lock != NULL) && (mtx_lock(list->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock list mutex.\n");
+  }
+  
+  void* defaultKey = list->keyType->create(NULL);
+  size = listToBlobSizeUnlocked(list, defaultKey);
+  defaultKey = list->keyType->destroy(defaultKey);
   
   if (list->lock != NULL) {
     mtx_unlock(list->lock);
   }
   
-  // Set the size to match the length.  This is so recursive toBlob calls
-  // will encode the right amount of data, which does not include the NULL
-  // string terminator in our case.
-  bytesSetSize(returnValue, bytesLength(returnValue));
+  printLog(TRACE, "EXIT listToBlobSize(list=%p) = {%llu}\n", list, llu(size));
+  return size;
+}
+
+/// @fn u64 listToBlobBuffer(const List *list, void *buffer, u64 bufferSize)
+///
+/// @brief Encode a list the way listToBlob does, directly into a buffer.
+///
+/// @param list The List (or compatible data structure) to encode.
+/// @param buffer The memory to encode the list into.
+/// @param bufferSize The number of bytes available at buffer.  listToBlobSize
+///   gives the number of bytes needed.
+///
+/// @return Returns the number of bytes written on success, 0 on failure or if
+/// the list does not fit.
+u64 listToBlobBuffer(const List *list, void *buffer, u64 bufferSize) {
+  printLog(TRACE, "ENTER listToBlobBuffer(list=%p, buffer=%p, bufferSize=%llu)\n",
+    list, buffer, llu(bufferSize));
+  
+  u64 written = listToIndexedBlobBuffer(list, LIST_BLOB_INDEX_ORDER_NODES,
+    false, buffer, bufferSize);
+  
+  printLog(TRACE,
+    "EXIT listToBlobBuffer(list=%p, buffer=%p, bufferSize=%llu) = {%llu}\n",
+    list, buffer, llu(bufferSize), llu(written));
+  return written;
+}
+
+/// @fn u64 listToKeyedBlobBuffer(const List *list, bool listIsSorted, void *buffer, u64 bufferSize)
+///
+/// @brief Encode a list the way listToKeyedBlob does, directly into a buffer.
+///
+/// @param list The List (or compatible data structure) to encode.
+/// @param listIsSorted Whether the nodes of the list are already in key order.
+/// @param buffer The memory to encode the list into.
+/// @param bufferSize The number of bytes available at buffer.  listToBlobSize
+///   gives the number of bytes needed.
+///
+/// @return Returns the number of bytes written on success, 0 on failure or if
+/// the list does not fit.
+u64 listToKeyedBlobBuffer(const List *list, bool listIsSorted, void *buffer,
+  u64 bufferSize
+) {
+  printLog(TRACE,
+    "ENTER listToKeyedBlobBuffer(list=%p, listIsSorted=%s, buffer=%p, bufferSize=%llu)\n",
+    list, boolNames[listIsSorted], buffer, llu(bufferSize));
+  
+  u64 written = listToIndexedBlobBuffer(list, LIST_BLOB_INDEX_ORDER_KEYS,
+    listIsSorted, buffer, bufferSize);
+  
+  printLog(TRACE,
+    "EXIT listToKeyedBlobBuffer(list=%p, listIsSorted=%s, buffer=%p, bufferSize=%llu) = {%llu}\n",
+    list, boolNames[listIsSorted], buffer, llu(bufferSize), llu(written));
+  return written;
+}
+
+/// @fn Bytes listToBlob(const List *list)
+///
+/// @brief Convert a List to a single array of bytes.  The index at the end of
+/// the array follows the order of the list's nodes, so listBlobGetIndex can
+/// get any entry of the array without decoding the ones before it.
+///
+/// @param list The List (or compatible data structure) to convert.
+///
+/// @return Returns a Bytes object with the encoded list on success,
+/// NULL on failure.
+Bytes listToBlob(const List *list) {
+  Bytes returnValue = NULL;
+  printLog(TRACE, "ENTER listToBlob(list=%p)\n", list);
+  
+  if (list == NULL) {
+    printLog(ERR, "One or more NULL parameters.\n");
+    printLog(TRACE, "EXIT listToBlob(list=%p) = {%p}\n", list,
+      returnValue);
+    return returnValue;
+  }
+  
+  returnValue = listToIndexedBlob(list, LIST_BLOB_INDEX_ORDER_NODES, false);
   
   printLog(TRACE, "EXIT listToBlob(list=%p) = {%p}\n", list, returnValue);
   return returnValue;
 }
 
+/// @fn Bytes listToKeyedBlob(const List *list, bool listIsSorted)
+///
+/// @brief Convert a List whose keys are unique to a single array of bytes
+/// whose index is sorted by key.  listBlobGetValue can then look up keys in
+/// the array with a binary search and without decoding it.
+///
+/// @param list The List (or compatible data structure) to convert.
+/// @param listIsSorted Whether the nodes of the list are already in key order,
+///   as they are in a RedBlackTree.
+///
+/// @return Returns a Bytes object with the encoded list on success,
+/// NULL on failure.
+Bytes listToKeyedBlob(const List *list, bool listIsSorted) {
+  Bytes returnValue = NULL;
+  printLog(TRACE, "ENTER listToKeyedBlob(list=%p, listIsSorted=%s)\n",
+    list, boolNames[listIsSorted]);
+  
+  if (list == NULL) {
+    printLog(ERR, "One or more NULL parameters.\n");
+    printLog(TRACE, "EXIT listToKeyedBlob(list=%p, listIsSorted=%s) = {%p}\n",
+      list, boolNames[listIsSorted], returnValue);
+    return returnValue;
+  }
+  
+  returnValue = listToIndexedBlob(list, LIST_BLOB_INDEX_ORDER_KEYS,
+    listIsSorted);
+  
+  printLog(TRACE, "EXIT listToKeyedBlob(list=%p, listIsSorted=%s) = {%p}\n",
+    list, boolNames[listIsSorted], returnValue);
+  return returnValue;
+}
+
 /// @fn List *listFromBlob_(const volatile void *array, u64 *length, bool inPlaceData, bool disableThreadSafety, ...)
 ///
 /// @brief Convert a properly-formatted byte array into a list.
@@ -1434,7 +1752,7 @@ List *listFromBlob_(const volatile void *array, u64 *length, bool inPlaceData, b
   
   u32 dsVersion = *((u32*) &byteArray[index]);
   littleEndianToHost(&dsVersion, sizeof(dsVersion));
-  if (dsVersion != 10) {
+  if ((dsVersion < 10) || (dsVersion > DsVersion)) {
     printLog(ERR, "Don't know how to parse version %u of input byte array.\n",
       dsVersion);
     printLog(ERR, "If this input came from this library, please "
@@ -1461,6 +1779,26 @@ List *listFromBlob_(const volatile void *array, u64 *length, bool inPlaceData, b
   size = *((u64*) &byteArray[index]);
   littleEndianToHost(&size, sizeof(size));
   index += sizeof(size);
+  u64 indexOffset = 0;
+  if (dsVersion > 10) {
+    // Version 11 follows the size with the offset and order of the entry
+    // index.  The entries themselves are encoded the same way as in version
+    // 10, so they are parsed the same way and the index is just skipped.
+    if (arrayLength >= index + sizeof(indexOffset) + sizeof(u8)) {
+      indexOffset = *((u64*) &byteArray[index]);
+      littleEndianToHost(&indexOffset, sizeof(indexOffset));
+      index += sizeof(indexOffset) + sizeof(u8);
+    }
+    if ((indexOffset < index) || (indexOffset > arrayLength)
+      || (size > (arrayLength - indexOffset) / DS_INDEX_ENTRY_SIZE)
+    ) {
+      printLog(ERR, "Improperly formatted byte array.  Invalid index.\n");
+      printLog(ERR, "If this input came from this library, please "
+        "report this as a bug.\n");
+      return NULL;
+    }
+    arrayLength = indexOffset;
+  }
   list = listCreate(keyTypeNoCopy, disableThreadSafety);
   if (list == NULL) {
     LOG_MALLOC_FAILURE();
@@ -1579,6 +1917,10 @@ List *listFromBlob_(const volatile void *array, u64 *length, bool inPlaceData, b
   }
   
   *length = index;
+  if (indexOffset > 0) {
+    // Consume the index too so that the caller's next read starts after it.
+    *length = indexOffset + (size * DS_INDEX_ENTRY_SIZE);
+  }
   if (inPlaceData) {
     // Optimize for this case.
     if (keyTypeIndex >= listIndex) {
@@ -1596,26 +1938,321 @@ List *listFromBlob_(const volatile void *array, u64 *length, bool inPlaceData, b
   return list;
 }
 
-/// @fn Bytes listToJson(const List *list)
+/// @fn static u64 listBlobReadU64(const char *data)
 ///
-/// @brief Converts a List to a JSON-formatted string.  This function will
-///   always return an allocated string, even if it's a zero-length (one null
-///   byte) string.
+/// @brief Read a little endian u64 from a possibly-unaligned address.
+///
+/// @param data A pointer to the encoded value.
+///
+/// @return Returns the value in host byte order.
+static u64 listBlobReadU64(const char *data) {
+  u64 value = 0;
+  memcpy(&value, data, sizeof(value));
+  littleEndianToHost(&value, sizeof(value));
+  return value;
+}
+
+/// @fn static const char* listBlobIndex(const volatile void *blob, u64 length, u64 *size, u8 *indexOrder, TypeDescriptor **keyType)
+///
+/// @brief Validate the header of a version 11 byte array and find its index.
+///
+/// @param blob The byte array produced by listToBlob or listToKeyedBlob.
+/// @param length The number of bytes available at blob.
+/// @param size Receives the number of entries in the array.
+/// @param indexOrder Receives the order of the index.
+/// @param keyType Receives the TypeDescriptor of the array's keys.
+///
+/// @return Returns a pointer to the first index entry on success, NULL if the
+/// array is not a valid version 11 byte array.
+static const char* listBlobIndex(const volatile void *blob, u64 length,
+  u64 *size, u8 *indexOrder, TypeDescriptor **keyType
+) {
+  const char *byteArray = (const char*) blob;
+  if ((byteArray == NULL) || (length < LIST_BLOB_HEADER_SIZE)) {
+    printLog(ERR, "Insufficient data provided.\n");
+    return NULL;
+  }
+  
+  u16 dsMarker = 0;
+  memcpy(&dsMarker, byteArray, sizeof(dsMarker));
+  littleEndianToHost(&dsMarker, sizeof(dsMarker));
+  u32 dsVersion = 0;
+  memcpy(&dsVersion, &byteArray[sizeof(dsMarker)], sizeof(dsVersion));
+  littleEndianToHost(&dsVersion, sizeof(dsVersion));
+  if ((dsMarker != DsMarker) || (dsVersion < 11) || (dsVersion > DsVersion)) {
+    // Version 10 arrays have no index and have to be decoded with the
+    // *FromBlob functions.
+    printLog(ERR, "Byte array is not an indexed byte array.\n");
+    return NULL;
+  }
+  
+  i16 keyTypeIndex = 0;
+  memcpy(&keyTypeIndex, &byteArray[sizeof(dsMarker) + sizeof(dsVersion)],
+    sizeof(keyTypeIndex));
+  littleEndianToHost(&keyTypeIndex, sizeof(keyTypeIndex));
+  *keyType = getTypeDescriptorFromIndex(keyTypeIndex);
+  *size = listBlobReadU64(&byteArray[LIST_BLOB_SIZE_OFFSET]);
+  u64 indexOffset = listBlobReadU64(&byteArray[LIST_BLOB_INDEX_OFFSET_OFFSET]);
+  *indexOrder = (u8) byteArray[LIST_BLOB_INDEX_ORDER_OFFSET];
+  if ((keyTypeIndex < 1) || (*keyType == NULL)
+    || (indexOffset < LIST_BLOB_HEADER_SIZE) || (indexOffset > length)
+    || (*size > (length - indexOffset) / DS_INDEX_ENTRY_SIZE)
+  ) {
+    printLog(ERR, "Improperly formatted byte array.\n");
+    return NULL;
+  }
+  
+  return &byteArray[indexOffset];
+}
+
+/// @fn static const void* listBlobEntry(const char *byteArray, u64 length, const char *indexEntry, const void **key, TypeDescriptor **type, u64 *valueLength)
+///
+/// @brief Resolve one entry of a byte array's index.
+///
+/// @param byteArray The byte array the index belongs to.
+/// @param length The number of bytes available at byteArray.
+/// @param indexEntry A pointer to the index entry to resolve.
+/// @param key If non-NULL, receives a pointer to the entry's encoded key.
+/// @param type If non-NULL, receives the TypeDescriptor of the entry's value.
+/// @param valueLength If non-NULL, receives the number of bytes in the
+///   entry's encoded value.
+///
+/// @return Returns a pointer to the entry's encoded value on success, NULL on
+/// failure.
+static const void* listBlobEntry(const char *byteArray, u64 length,
+  const char *indexEntry, const void **key, TypeDescriptor **type,
+  u64 *valueLength
+) {
+  u64 entryOffset = listBlobReadU64(indexEntry);
+  u64 keyOffset = listBlobReadU64(&indexEntry[sizeof(u64)]);
+  if ((entryOffset < LIST_BLOB_HEADER_SIZE)
+    || (keyOffset < entryOffset + sizeof(i16)) || (keyOffset >= length)
+  ) {
+    printLog(ERR, "Improperly formatted byte array index.\n");
+    return NULL;
+  }
+  
+  if (type != NULL) {
+    i16 typeIndex = 0;
+    memcpy(&typeIndex, &byteArray[entryOffset], sizeof(typeIndex));
+    littleEndianToHost(&typeIndex, sizeof(typeIndex));
+    *type = getTypeDescriptorFromIndex(typeIndex);
+  }
+  if (key != NULL) {
+    *key = &byteArray[keyOffset];
+  }
+  if (valueLength != NULL) {
+    *valueLength = keyOffset - entryOffset - sizeof(i16);
+  }
+  
+  return &byteArray[entryOffset + sizeof(i16)];
+}
+
+/// @fn static int listBlobKeyCompare(TypeDescriptor *keyType, const char *blobKey, u64 length, const volatile void *key)
+///
+/// @brief Compare an encoded key in a byte array to a key in memory.
+///
+/// @details Primitive, string, and Bytes keys are compared in place.  Any
+/// other kind of key has to be decoded (and freed) to be compared.
+///
+/// @param keyType The TypeDescriptor of both keys.
+/// @param blobKey A pointer to the encoded key.
+/// @param length The number of bytes available at blobKey.
+/// @param key The key to compare blobKey to.
+///
+/// @return Returns a value less than 0 if blobKey is less than key, 0 if they
+/// are equal, and a value greater than 0 if blobKey is greater than key.
+static int listBlobKeyCompare(TypeDescriptor *keyType, const char *blobKey,
+  u64 length, const volatile void *key
+) {
+  int returnValue = 0;
+  bool inPlaceData = (keyType->dataIsPointer == false)
+    || (getIndexFromTypeDescriptor(keyType)
+      < getIndexFromTypeDescriptor(typeList));
+  void *decodedKey = keyType->fromBlob(blobKey, &length, inPlaceData, true);
+  if (decodedKey == NULL) {
+    return -1;
+  }
+  
+  returnValue = keyType->compare(decodedKey, key);
+  if (inPlaceData == false) {
+    decodedKey = keyType->destroy(decodedKey);
+  }
+  
+  return returnValue;
+}
+
+/// @fn u64 listBlobSize(const volatile void *blob, u64 length)
+///
+/// @brief Get the number of entries in a byte array produced by listToBlob or
+/// listToKeyedBlob without decoding it.
+///
+/// @param blob The byte array to examine.  This may be a read-only mapping.
+/// @param length The number of bytes available at blob.
+///
+/// @return Returns the number of entries in the array on success, 0 on
+/// failure.
+u64 listBlobSize(const volatile void *blob, u64 length) {
+  u64 size = 0;
+  u8 indexOrder = 0;
+  TypeDescriptor *keyType = NULL;
+  printLog(TRACE, "ENTER listBlobSize(blob=%p, length=%llu)\n",
+    blob, llu(length));
+  
+  if (listBlobIndex(blob, length, &size, &indexOrder, &keyType) == NULL) {
+    size = 0;
+  }
+  
+  printLog(TRACE, "EXIT listBlobSize(blob=%p, length=%llu) = {%llu}\n",
+    blob, llu(length), llu(size));
+  return size;
+}
+
+/// @fn const void* listBlobGetIndex(const volatile void *blob, u64 length, u64 index, const void **key, TypeDescriptor **type, u64 *valueLength)
+///
+/// @brief Get an entry of a byte array produced by listToBlob or
+/// listToKeyedBlob without decoding the array or allocating any memory.
+///
+/// @param blob The byte array to search.  This may be a read-only mapping.
+/// @param length The number of bytes available at blob.
+/// @param index The position of the entry in the array's index.  This is the
+///   position of the node in the original data structure for listToBlob
+///   arrays and the position of the key in sorted order for listToKeyedBlob
+///   arrays.
+/// @param key If non-NULL, receives a pointer to the entry's encoded key.
+/// @param type If non-NULL, receives the TypeDescriptor of the entry's value.
+/// @param valueLength If non-NULL, receives the number of bytes in the
+///   entry's encoded value.
+///
+/// @return Returns a pointer to the entry's encoded value on success, NULL on
+/// failure.  Primitive and string values can be used directly through this
+/// pointer.  The value of a nested data structure is itself a byte array that
+/// can be passed back into these functions.
+const void* listBlobGetIndex(const volatile void *blob, u64 length, u64 index,
+  const void **key, TypeDescriptor **type, u64 *valueLength
+) {
+  const void *returnValue = NULL;
+  u64 size = 0;
+  u8 indexOrder = 0;
+  TypeDescriptor *keyType = NULL;
+  printLog(TRACE, "ENTER listBlobGetIndex(blob=%p, length=%llu, index=%llu)\n",
+    blob, llu(length), llu(index));
+  
+  const char *indexEntries
+    = listBlobIndex(blob, length, &size, &indexOrder, &keyType);
+  if ((indexEntries != NULL) && (index < size)) {
+    returnValue = listBlobEntry((const char*) blob, length,
+      &indexEntries[index * DS_INDEX_ENTRY_SIZE], key, type, valueLength);
+  }
+  
+  printLog(TRACE,
+    "EXIT listBlobGetIndex(blob=%p, length=%llu, index=%llu) = {%p}\n",
+    blob, llu(length), llu(index), returnValue);
+  return returnValue;
+}
+
+/// @fn const void* listBlobGetValue(const volatile void *blob, u64 length, const volatile void *key, TypeDescriptor **type, u64 *valueLength)
+///
+/// @brief Look up a key in a byte array produced by listToBlob or
+/// listToKeyedBlob without decoding the array.
+///
+/// @details Arrays from listToKeyedBlob (which is what htToBlob and
+/// rbTreeToBlob produce) are binary searched.  Other arrays are searched in
+/// order.  No memory is allocated for primitive, string, or Bytes keys.
+///
+/// @param blob The byte array to search.  This may be a read-only mapping.
+/// @param length The number of bytes available at blob.
+/// @param key The key to look up, of the array's key type.
+/// @param type If non-NULL, receives the TypeDescriptor of the value found.
+/// @param valueLength If non-NULL, receives the number of bytes in the
+///   encoded value found.
+///
+/// @return Returns a pointer to the encoded value of the first entry with the
+/// key on success, NULL if the key is not found or on failure.
+const void* listBlobGetValue(const volatile void *blob, u64 length,
+  const volatile void *key, TypeDescriptor **type, u64 *valueLength
+) {
+  const void *returnValue = NULL;
+  const char *byteArray = (const char*) blob;
+  const void *blobKey = NULL;
+  u64 size = 0;
+  u8 indexOrder = 0;
+  TypeDescriptor *keyType = NULL;
+  printLog(TRACE, "ENTER listBlobGetValue(blob=%p, length=%llu, key=%p)\n",
+    blob, llu(length), key);
+  
+  const char *indexEntries
+    = listBlobIndex(blob, length, &size, &indexOrder, &keyType);
+  if ((indexEntries == NULL) || (key == NULL)) {
+    printLog(TRACE,
+      "EXIT listBlobGetValue(blob=%p, length=%llu, key=%p) = {%p}\n",
+      blob, llu(length), key, returnValue);
+    return returnValue;
+  }
+  
+  u64 low = 0, high = size;
+  if (indexOrder == LIST_BLOB_INDEX_ORDER_KEYS) {
+    // Find the first entry whose key is not less than the one requested.
+    while (low < high) {
+      u64 middle = low + ((high - low) >> 1);
+      if (listBlobEntry(byteArray, length,
+        &indexEntries[middle * DS_INDEX_ENTRY_SIZE], &blobKey, NULL, NULL)
+        == NULL
+      ) {
+        break;
+      }
+      if (listBlobKeyCompare(keyType, (const char*) blobKey,
+        length - ((const char*) blobKey - byteArray), key) < 0
+      ) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    high = (low < size) ? low + 1 : low;
+  }
+  
+  for (u64 index = low; index < high; index++) {
+    const void *value = listBlobEntry(byteArray, length,
+      &indexEntries[index * DS_INDEX_ENTRY_SIZE], &blobKey, type, valueLength);
+    if (value == NULL) {
+      break;
+    }
+    if (listBlobKeyCompare(keyType, (const char*) blobKey,
+      length - ((const char*) blobKey - byteArray), key) == 0
+    ) {
+      returnValue = value;
+      break;
+    }
+  }
+  
+  printLog(TRACE,
+    "EXIT listBlobGetValue(blob=%p, length=%llu, key=%p) = {%p}\n",
+    blob, llu(length), key, returnValue);
+  return returnValue;
+}
+
+/// @fn bool listToJsonStream(const List *list, JsonWriter *writer)
+///
+/// @brief Writes a List to a JsonWriter in JSON format.  Nested data
+///   structures are written directly to the writer, so no part of the document
+///   is built in memory.
 ///
 /// @param list is the List to convert.
+/// @param writer is the JsonWriter to write to.
 ///
-/// @return Returns a JSON-formatted Bytes object representation of the list.
-Bytes listToJson(const List *list) {
-  printLog(TRACE, "ENTER listToJson(list=%p)\n", list);
+/// @return Returns true on success, false on failure.
+bool listToJsonStream(const List *list, JsonWriter *writer) {
+  printLog(TRACE, "ENTER listToJsonStream(list=%p, writer=%p)\n",
+    list, writer);
   
-  Bytes returnValue = NULL;
   ListNode *node = NULL;
   
   if (list == NULL) {
     printLog(DEBUG, "List provided was NULL.\n");
-    bytesAllocate(&returnValue, 0);
-    
-    printLog(TRACE, "EXIT listToJson(list=%p) = {%s}\n", list, returnValue);
+    bool returnValue = (writer != NULL) && (writer->failed == false);
+    printLog(TRACE, "EXIT listToJsonStream(list=NULL, writer=%p) = {%s}\n",
+      writer, boolNames[returnValue]);
     return returnValue;
   }
   
@@ -1624,81 +2261,100 @@ Bytes listToJson(const List *list) {
   }
   
   i64 listTypeIndex = getIndexFromTypeDescriptor(typeList);
-  bytesAddStr(&returnValue, "{\n");
+  jsonWriterWriteStr(writer, "{\n");
   u64 size = list->size;
   u64 index = 0;
   for (node = list->head;
     (node != NULL) && (index++ < size);
     node = node->next
   ) {
-    bytesAddStr(&returnValue, "  \"");
+    jsonWriterWriteStr(writer, "  \"");
     char *keyString = list->keyType->toString(node->key);
-    bytesAddStr(&returnValue, keyString);
+    jsonWriterWriteStr(writer, keyString);
     keyString = stringDestroy(keyString);
-    bytesAddStr(&returnValue, "\"");
+    jsonWriterWriteStr(writer, "\"");
     
     if (getIndexFromTypeDescriptor(node->type) < listTypeIndex) {
       // Append end of key, start of value.
-      bytesAddStr(&returnValue, ": ");
-      char *valueString = NULL;
-      if ((node->type == typeString) || (node->type == typeStringNoCopy)
+      jsonWriterWriteStr(writer, ": ");
+      if ((node->type == typeBytes) || (node->type == typeBytesNoCopy)) {
+        jsonWriterWriteStr(writer, "\"");
+        jsonWriterWriteEscaped(writer, node->value,
+          bytesLength((Bytes) node->value));
+        jsonWriterWriteStr(writer, "\"");
+      } else if ((node->type == typeString) || (node->type == typeStringNoCopy)
         || (node->type == typeStringCi) || (node->type == typeStringCiNoCopy)
-        || (node->type == typeBytes) || (node->type == typeBytesNoCopy)
       ) {
-        bytesAddStr(&returnValue, "\"");
-        if ((node->type == typeBytes) || (node->type == typeBytesNoCopy)) {
-          valueString = escapeBytes((Bytes) node->value);
-        } else { // some kind of string
-          valueString = escapeString(str(node->value));
-        }
+        const char *valueString = str(node->value);
+        jsonWriterWriteStr(writer, "\"");
+        jsonWriterWriteEscaped(writer, valueString,
+          (valueString != NULL) ? strlen(valueString) : 0);
+        jsonWriterWriteStr(writer, "\"");
       } else {
-        valueString = node->type->toString(node->value);
-      }
-      bytesAddStr(&returnValue, valueString);
-      valueString = stringDestroy(valueString);
-      if ((node->type == typeString) || (node->type == typeStringNoCopy)
-        || (node->type == typeStringCi) || (node->type == typeStringCiNoCopy)
-        || (node->type == typeBytes) || (node->type == typeBytesNoCopy)
-      ) {
-        bytesAddStr(&returnValue, "\"");
+        char *valueString = node->type->toString(node->value);
+        jsonWriterWriteStr(writer, valueString);
+        valueString = stringDestroy(valueString);
       }
     } else if (
       ((node->type == typePointer) || (node->type == typePointerNoCopy))
       && (node->value == NULL)
     ) {
       // NULL value.
-      bytesAddStr(&returnValue, ": null");
+      jsonWriterWriteStr(writer, ": null");
     } else { // Value's type is a data structure, not a primitive.
-      Bytes valueString = node->type->toJson(node->value);
-      // In this case, valueString starts with '{' or '[' on its own line and
-      // ends with '}' or ']' on its own line.  After the indent, the
-      // valueString will be correct except that we need to change the first
-      // character to a ':' to properly end the key.
-      char *indentedValue = indentText(str(valueString), 2);
-      valueString = bytesDestroy(valueString);
-      indentedValue[0] = ':';
-      bytesAddStr(&returnValue, indentedValue);
-      indentedValue = stringDestroy(indentedValue);
+      // The nested value starts with '{' or '[' right after the key and every
+      // line after its first is indented two more columns than ours.
+      jsonWriterWriteStr(writer, ": ");
+      jsonWriterIndent(writer, 2);
+      jsonWriterWriteValue(writer, node->type, node->value);
+      jsonWriterUnindent(writer, 2);
     }
     
     if (node->next != NULL) {
       // End of the list
-      bytesAddStr(&returnValue, ",\n");
+      jsonWriterWriteStr(writer, ",\n");
     }
   }
-  bytesAddStr(&returnValue, "\n}");
+  jsonWriterWriteStr(writer, "\n}");
   
   if (list->lock != NULL) {
     mtx_unlock(list->lock);
   }
   
+  bool returnValue = (writer != NULL) && (writer->failed == false);
+  printLog(TRACE, "EXIT listToJsonStream(list=%p, writer=%p) = {%s}\n",
+    list, writer, boolNames[returnValue]);
+  return returnValue;
+}
+
+/// @fn Bytes listToJson(const List *list)
+///
+/// @brief Converts a List to a JSON-formatted string.  This function will
+///   always return an allocated string, even if it's a zero-length (one null
+///   byte) string.
+///
+/// @param list is the List to convert.
+///
+/// @return Returns a JSON-formatted Bytes object representation of the list.
+Bytes listToJson(const List *list) {
+  printLog(TRACE, "ENTER listToJson(list=%p)\n", list);
+  
+  Bytes returnValue = NULL;
+  bytesAllocate(&returnValue, 0);
+  
+  JsonWriter writer;
+  jsonWriterInitBytes(&writer, &returnValue);
+  listToJsonStream(list, &writer);
+  jsonWriterFlush(&writer);
+  
   printLog(TRACE, "EXIT listToJson(list=%p) = {%s}\n", list, returnValue);
   return returnValue;
 }
 
-// jsonToList implementation from generic macro.
+// jsonToList and xmlToList implementations from generic macros.
 #define listAddEntry listAddBackEntry
 JSON_TO_DATA_STRUCTURE(List, list)
+XML_TO_DATA_STRUCTURE(List, list)
 #undef listAddEntry
 
 /// @fn char* listToKeyValueString(const List *list, const char *separator)
@@ -1875,6 +2531,9 @@ TypeDescriptor _typeList = {
   .clear         = (i32 (*)(volatile void *)) listClear,
   .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) listToXml_,
   .toJson        = (Bytes (*)(const volatile void*)) listToJson,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) listToJsonStream,
+  .blobSize      = (u64 (*)(const volatile void*)) listToBlobSize,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) listToBlobBuffer,
 };
 TypeDescriptor *typeList = &_typeList;
 
@@ -1906,6 +2565,9 @@ TypeDescriptor _typeListNoCopy = {
   .clear         = (i32 (*)(volatile void *)) listClear,
   .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) listToXml_,
   .toJson        = (Bytes (*)(const volatile void*)) listToJson,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) listToJsonStream,
+  .blobSize      = (u64 (*)(const volatile void*)) listToBlobSize,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) listToBlobBuffer,
 };
 TypeDescriptor *typeListNoCopy = &_typeListNoCopy;
 
@@ -2213,6 +2875,38 @@ bool listUnitTest() { \
     printLog(ERR, "listTestCases(list) failed.\n"); \
     return false; \
   } \
+ \
+  List *pooledList = listCreate(typeString, false, true); \
+  if ((pooledList == NULL) || (pooledList->nodePool == NULL)) { \
+    printLog(ERR, "Could not create list with pooled nodes.\n"); \
+    return false; \
+  } \
+  for (int ii = 0; ii < 1000; ii++) { \
+    char pooledKey[16]; \
+    snprintf(pooledKey, sizeof(pooledKey), "%d", ii); \
+    if (((ii & 1) ? listAddFrontEntry(pooledList, pooledKey, pooledKey) \
+      : listAddBackEntry(pooledList, pooledKey, pooledKey)) == NULL \
+    ) { \
+      printLog(ERR, "Could not add entry %d to pooled list.\n", ii); \
+      return false; \
+    } \
+    if ((ii % 3) == 0) { \
+      listRemoveFront(pooledList); \
+    } \
+  } \
+  if ((pooledList->size != 666) \
+    || (strcmp((char*) listGetBack(pooledList)->value, "998") != 0) \
+  ) { \
+    printLog(ERR, "Unexpected pooled list contents.\n"); \
+    return false; \
+  } \
+  ListNode *pooledNode = listAddBackEntry(pooledList, "churn", "value"); \
+  listRemove(pooledList, "churn"); \
+  if (listAddBackEntry(pooledList, "churn", "value") != pooledNode) { \
+    printLog(ERR, "Removed list node was not reused by the node pool.\n"); \
+    return false; \
+  } \
+  pooledList = listDestroy(pooledList); \
  \
   const char *xmlToParse = \
     "<list>" \
@@ -2472,6 +3166,30 @@ bool listUnitTest() { \
     listString = stringDestroy(listString); \
     return false; \
   } \
+  /* Streaming the list to a file must produce the same document. */ \
+  FILE *jsonFile = tmpfile(); \
+  JsonWriter jsonWriter; \
+  jsonWriterInitFile(&jsonWriter, jsonFile); \
+  if ((jsonFile == NULL) || (listToJsonStream(list, &jsonWriter) == false) \
+    || (jsonWriterFlush(&jsonWriter) == false) \
+  ) { \
+    printLog(ERR, "Could not stream list JSON to a file.\n"); \
+    return false; \
+  } \
+  u64 jsonFileLength = (u64) ftell(jsonFile); \
+  rewind(jsonFile); \
+  Bytes fileJson = NULL; \
+  bytesAllocate(&fileJson, jsonFileLength); \
+  bytesSetLength(fileJson, \
+    (u64) fread(fileJson, 1, jsonFileLength, jsonFile)); \
+  fileJson[bytesLength(fileJson)] = '\0'; \
+  fclose(jsonFile); \
+  if (bytesCompare(listJson, fileJson) != 0) { \
+    printLog(ERR, "Streamed list JSON did not match listToJson.\n"); \
+    printLog(ERR, "Streamed JSON:  %s\n", str(fileJson)); \
+    return false; \
+  } \
+  fileJson = bytesDestroy(fileJson); \
   list2Json = bytesDestroy(list2Json); \
   listJson = bytesDestroy(listJson); \
  \
@@ -0,0 +1,242 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              LockStats.c
+///
+/// @brief             This library contains the implementation of optional
+///                    lock contention statistics.
+///
+/// @details           Sites are put on a lock-free list the first time they
+///                    are used and are never taken off of it.  The counters
+///                    are updated with relaxed atomic operations, so a report
+///                    made while other threads are locking is a close
+///                    snapshot rather than an exact one.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+// Doxygen marker
+/// @file
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "LockStats.h"
+#include "StringLib.h"
+#include "TimeUtils.h"
+
+/// @var _lockStatsSites
+///
+/// @brief The most recently registered LockStatsSite.  The rest follow its
+/// next pointers.
+static LockStatsSite *_lockStatsSites = NULL;
+
+/// @fn static inline void lockStatsRegister(LockStatsSite *site)
+///
+/// @brief Put a site on the list of sites the first time it's used.
+///
+/// @param site The LockStatsSite being used.
+///
+/// @return This function returns no value.
+static inline void lockStatsRegister(LockStatsSite *site) {
+  if (__atomic_load_n(&site->registered, __ATOMIC_ACQUIRE)) {
+    return;
+  }
+
+  bool expected = false;
+  if (!__atomic_compare_exchange_n(&site->registered, &expected, true,
+    false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+  ) {
+    // Another thread got here first.
+    return;
+  }
+
+  LockStatsSite *head = __atomic_load_n(&_lockStatsSites, __ATOMIC_ACQUIRE);
+  do {
+    site->next = head;
+  } while (!__atomic_compare_exchange_n(&_lockStatsSites, &head, site,
+    true, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+}
+
+/// @fn static inline int lockStatsBucket(u64 nanoseconds)
+///
+/// @brief Get the histogram bucket a wait falls in.
+///
+/// @param nanoseconds The length of the wait.
+///
+/// @return Returns the index of the bucket.
+static inline int lockStatsBucket(u64 nanoseconds) {
+  u64 microseconds = nanoseconds / 1000;
+  int bucket = 0;
+  while ((microseconds > 0) && (bucket < LOCK_STATS_NUM_BUCKETS - 1)) {
+    microseconds >>= 1;
+    bucket++;
+  }
+
+  return bucket;
+}
+
+/// @fn int lockStatsLock(mtx_t *mtx, LockStatsSite *site)
+///
+/// @brief Lock a mutex and record the acquisition, and the time spent waiting
+/// if the mutex was held by another thread, in a LockStatsSite.
+///
+/// @param mtx The mutex to lock.
+/// @param site The LockStatsSite of the call.
+///
+/// @return Returns the value of mtx_lock.
+int lockStatsLock(mtx_t *mtx, LockStatsSite *site) {
+  lockStatsRegister(site);
+
+  int status = mtx_trylock(mtx);
+  if (status == thrd_success) {
+    __atomic_add_fetch(&site->acquisitions, 1, __ATOMIC_RELAXED);
+    return status;
+  }
+
+  // The parentheses keep the mtx_lock macro from LockStats.h from applying.
+  i64 start = getMonotonicNanoseconds();
+  status = (mtx_lock)(mtx);
+  if (status != thrd_success) {
+    return status;
+  }
+  u64 wait = (u64) (getMonotonicNanoseconds() - start);
+
+  __atomic_add_fetch(&site->acquisitions, 1, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&site->contended, 1, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&site->waitNanoseconds, wait, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&site->waitHistogram[lockStatsBucket(wait)], 1,
+    __ATOMIC_RELAXED);
+  u64 maxWait = __atomic_load_n(&site->maxWaitNanoseconds, __ATOMIC_RELAXED);
+  while ((wait > maxWait)
+    && (!__atomic_compare_exchange_n(&site->maxWaitNanoseconds, &maxWait,
+      wait, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+  );
+
+  return status;
+}
+
+/// @fn static void lockStatsAddJsonString(char **json, const char *string)
+///
+/// @brief Add a quoted, escaped JSON string to a buffer.
+///
+/// @param json A pointer to the buffer to add to.
+/// @param string The string to add.
+///
+/// @return This function returns no value.
+static void lockStatsAddJsonString(char **json, const char *string) {
+  straddstr(json, "\"");
+  for (const char *cursor = string; *cursor != '\0'; cursor++) {
+    if ((*cursor == '"') || (*cursor == '\\')) {
+      straddstr(json, "\\");
+    }
+    char character[2] = { *cursor, '\0' };
+    straddstr(json, character);
+  }
+  straddstr(json, "\"");
+}
+
+/// @fn char* lockStatsToJson(void)
+///
+/// @brief Report the statistics of every lock site used so far.
+///
+/// @details The report is an object with an "enabled" member, which is false
+/// if the library was built without LOCK_STATS_ENABLED, and a "sites" array.
+/// Each site has its lock, file, function, line, acquisitions, contended,
+/// waitNs, maxWaitNs and waitHistogram.  waitHistogram holds the number of
+/// contended waits under 1 microsecond, under 2, under 4 and so on.
+///
+/// @return Returns a newly-allocated string on success, NULL on failure.  The
+/// caller must free it with stringDestroy.
+char* lockStatsToJson(void) {
+  char *json = NULL;
+  char number[64];
+
+#ifdef LOCK_STATS_ENABLED
+  straddstr(&json, "{\"enabled\":true,\"sites\":[");
+#else
+  straddstr(&json, "{\"enabled\":false,\"sites\":[");
+#endif // LOCK_STATS_ENABLED
+
+  for (LockStatsSite *site = __atomic_load_n(&_lockStatsSites, __ATOMIC_ACQUIRE);
+    site != NULL; site = site->next
+  ) {
+    straddstr(&json, "{\"lock\":");
+    lockStatsAddJsonString(&json, site->lockName);
+    straddstr(&json, ",\"file\":");
+    lockStatsAddJsonString(&json, site->fileName);
+    straddstr(&json, ",\"function\":");
+    lockStatsAddJsonString(&json, site->functionName);
+    snprintf(number, sizeof(number), ",\"line\":%d", site->lineNumber);
+    straddstr(&json, number);
+    snprintf(number, sizeof(number), ",\"acquisitions\":%llu",
+      llu(__atomic_load_n(&site->acquisitions, __ATOMIC_RELAXED)));
+    straddstr(&json, number);
+    snprintf(number, sizeof(number), ",\"contended\":%llu",
+      llu(__atomic_load_n(&site->contended, __ATOMIC_RELAXED)));
+    straddstr(&json, number);
+    snprintf(number, sizeof(number), ",\"waitNs\":%llu",
+      llu(__atomic_load_n(&site->waitNanoseconds, __ATOMIC_RELAXED)));
+    straddstr(&json, number);
+    snprintf(number, sizeof(number), ",\"maxWaitNs\":%llu",
+      llu(__atomic_load_n(&site->maxWaitNanoseconds, __ATOMIC_RELAXED)));
+    straddstr(&json, number);
+    straddstr(&json, ",\"waitHistogram\":[");
+    for (int ii = 0; ii < LOCK_STATS_NUM_BUCKETS; ii++) {
+      snprintf(number, sizeof(number), (ii == 0) ? "%llu" : ",%llu",
+        llu(__atomic_load_n(&site->waitHistogram[ii], __ATOMIC_RELAXED)));
+      straddstr(&json, number);
+    }
+    straddstr(&json, (site->next != NULL) ? "]}," : "]}");
+  }
+  straddstr(&json, "]}");
+
+  return json;
+}
+
+/// @fn void lockStatsReset(void)
+///
+/// @brief Zero the statistics of every lock site used so far.  Sites stay
+/// registered.
+///
+/// @return This function returns no value.
+void lockStatsReset(void) {
+  for (LockStatsSite *site = __atomic_load_n(&_lockStatsSites, __ATOMIC_ACQUIRE);
+    site != NULL; site = site->next
+  ) {
+    __atomic_store_n(&site->acquisitions, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&site->contended, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&site->waitNanoseconds, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&site->maxWaitNanoseconds, 0, __ATOMIC_RELAXED);
+    for (int ii = 0; ii < LOCK_STATS_NUM_BUCKETS; ii++) {
+      __atomic_store_n(&site->waitHistogram[ii], 0, __ATOMIC_RELAXED);
+    }
+  }
+}
+
@@ -31,6 +31,10 @@
 #include "LoggingLib.h"
 #include "Queue.h"
 #include "OsApi.h"
+#include "TimeUtils.h"
+#include "ZipLib.h"
+#include "DirectoryLib.h"
+#include "LockStats.h"
 
 /// @var logFile
 /// The log file used by this library.
@@ -110,7 +114,8 @@ static void *_encryptionKey = NULL;
 static int (*_userPlaintextLogHandler)(void *message, u64 length) = NULL;
 static const char *_hostname = NULL;
 static bool _loggingInitialized = false;
-static Queue *_logQueue = NULL;
+static bool _serializeLogCallbacks = false;
+static bool _binaryLogging = false;
 ZEROINIT(thrd_t _loggingQueueThread);
 int _loggingQueueFunction(void *args);
 bool _runLoggingQueueFunction = false;
@@ -118,6 +123,221 @@ FILE *_fileToWriteTo = NULL;
 ZEROINIT(cnd_t _writeMessagesCondition);
 ZEROINIT(mtx_t _writeMessagesMutex);
 ZEROINIT(mtx_t _headerMessageMutex);
+ZEROINIT(mtx_t _logThreadBuffersMutex);
+ZEROINIT(tss_t _logThreadBufferKey);
+bool _loggingWriterSleeping = false;
+u64 _loggingWriterPasses = 0;
+
+/// @struct LogRolloverJob
+///
+/// @brief Work that's left for the rollover thread after the logging thread
+/// swaps log files.
+///
+/// @param oldLogFile The FILE of the log that was rolled over, or NULL if it
+///   was copied into the archive instead of renamed.  Closed by the rollover
+///   thread.
+/// @param logFilename A copy of the name of the log at the time.
+/// @param archiveFilename The name the rolled-over log was archived as.
+/// @param next The next job in the queue.
+typedef struct LogRolloverJob {
+  FILE *oldLogFile;
+  char *logFilename;
+  char *archiveFilename;
+  struct LogRolloverJob *next;
+} LogRolloverJob;
+
+// Rollover policy.  See loggingSetRolloverPolicy.
+static u64 _logRolloverSize = LOG_ROLLOVER_SIZE;
+static i64 _logRolloverInterval = 0;
+static bool _logRolloverCompress = false;
+static u32 _logRolloverMaxArchives = 0;
+static i64 _logFileStarted = 0;
+
+// Rollover thread state.  Everything below is protected by _logRolloverMutex.
+ZEROINIT(thrd_t _logRolloverThread);
+static int _logRolloverFunction(void *args);
+static void _logRolloverSetFilename(const char *logFilename);
+ZEROINIT(mtx_t _logRolloverMutex);
+ZEROINIT(cnd_t _logRolloverCondition);
+static bool _runLogRolloverThread = false;
+static LogRolloverJob *_logRolloverJobs = NULL;
+static LogRolloverJob *_logRolloverJobsTail = NULL;
+static char *_logRolloverFilename = NULL;
+static FILE *_logNextFile = NULL;
+static char *_logNextFilename = NULL;
+
+/// @struct LogThreadBuffer
+///
+/// @brief A producer thread's private queue of messages for the logging
+/// thread.  Only the owning thread pushes and only the logging thread pops, so
+/// a thread can queue a message without touching any shared lock.
+///
+/// @param queue The RING_QUEUE_SPSC RingQueue of LogMessage pointers.
+/// @param abandoned Set when the owning thread exits.  The logging thread frees
+///   the buffer once it's drained.
+/// @param next The next buffer in the list of all buffers.
+typedef struct LogThreadBuffer {
+  RingQueue *queue;
+  bool abandoned;
+  struct LogThreadBuffer *next;
+} LogThreadBuffer;
+
+/// @var _logThreadBuffers
+///
+/// @brief The list of every thread's LogThreadBuffer.  New buffers are added at
+/// the head and only the logging thread removes them.  Modified only with
+/// _logThreadBuffersMutex held.
+static LogThreadBuffer *_logThreadBuffers = NULL;
+
+/// @fn static void _logThreadBufferAbandon(void *threadBuffer)
+///
+/// @brief Destructor for _logThreadBufferKey.  Marks the exiting thread's
+/// buffer so that the logging thread frees it once it's been drained.
+///
+/// @param threadBuffer The exiting thread's LogThreadBuffer.
+///
+/// @return This function returns no value.
+static void _logThreadBufferAbandon(void *threadBuffer) {
+  mtx_lock(&_logThreadBuffersMutex);
+  ((LogThreadBuffer*) threadBuffer)->abandoned = true;
+  mtx_unlock(&_logThreadBuffersMutex);
+}
+
+/// @LogStringTableEntry
+///
+/// @brief One entry in a LogStringTable.
+///
+/// @param key The address the string had in the logging process.
+/// @param value The text of the string, or NULL if the entry is empty.
+typedef struct LogStringTableEntry {
+  u64 key;
+  const char *value;
+} LogStringTableEntry;
+
+/// @struct LogStringTable
+///
+/// @brief A small open-addressed map from the address of a string in a logging
+/// process to the string's text.  Used by the logging thread to track which
+/// strings it has already defined in a binary log and by
+/// loggingDecodeBinaryLog to look them back up.
+///
+/// @param entries The array of entries.  Empty entries have a NULL value.
+/// @param size The number of entries allocated.  Always a power of two.
+/// @param count The number of entries in use.
+/// @param ownsValues Whether or not the table frees its values.
+typedef struct LogStringTable {
+  LogStringTableEntry *entries;
+  u64 size;
+  u64 count;
+  bool ownsValues;
+} LogStringTable;
+
+/// @var _logBinaryStrings
+///
+/// @brief The strings that have been defined in the current binary log file.
+/// Only accessed by the logging thread and, once it's stopped, loggingStop.
+static LogStringTable _logBinaryStrings = { NULL, 0, 0, false };
+
+/// @fn static const char* _logStringTableGet(const LogStringTable *table, u64 key)
+///
+/// @brief Look up a string by the address it had in the logging process.
+///
+/// @param table The LogStringTable to search.
+/// @param key The address of the string.
+///
+/// @return Returns the string's text if it's in the table, NULL if not.
+static const char* _logStringTableGet(const LogStringTable *table, u64 key) {
+  if (table->size == 0) {
+    return NULL;
+  }
+  
+  u64 mask = table->size - 1;
+  for (u64 ii = (key * 0x9e3779b97f4a7c15ULL) >> 32; ; ii++) {
+    const LogStringTableEntry *entry = &table->entries[ii & mask];
+    if (entry->value == NULL) {
+      return NULL;
+    } else if (entry->key == key) {
+      return entry->value;
+    }
+  }
+}
+
+/// @fn static bool _logStringTableAdd(LogStringTable *table, u64 key, const char *value)
+///
+/// @brief Add a string to a LogStringTable, replacing any string already there
+/// with the same key.
+///
+/// @param table The LogStringTable to add to.
+/// @param key The address the string had in the logging process.
+/// @param value The text of the string.  If the table owns its values, it takes
+///   ownership of this one.
+///
+/// @return Returns true on success, false on memory allocation failure.
+static bool _logStringTableAdd(LogStringTable *table, u64 key,
+  const char *value
+) {
+  if ((table->count + 1) * 2 > table->size) {
+    // Keep the table at most half full.
+    LogStringTable grown = *table;
+    grown.size = (table->size > 0) ? table->size * 2 : 64;
+    grown.count = 0;
+    grown.entries = (LogStringTableEntry*) calloc(grown.size,
+      sizeof(LogStringTableEntry));
+    if (grown.entries == NULL) {
+      return false;
+    }
+    for (u64 ii = 0; ii < table->size; ii++) {
+      if (table->entries[ii].value != NULL) {
+        _logStringTableAdd(&grown, table->entries[ii].key,
+          table->entries[ii].value);
+      }
+    }
+    free(table->entries);
+    *table = grown;
+  }
+  
+  u64 mask = table->size - 1;
+  for (u64 ii = (key * 0x9e3779b97f4a7c15ULL) >> 32; ; ii++) {
+    LogStringTableEntry *entry = &table->entries[ii & mask];
+    if (entry->value == NULL) {
+      entry->key = key;
+      entry->value = value;
+      table->count++;
+      break;
+    } else if (entry->key == key) {
+      if (table->ownsValues == true) {
+        free((void*) entry->value);
+      }
+      entry->value = value;
+      break;
+    }
+  }
+  
+  return true;
+}
+
+/// @fn static void _logStringTableClear(LogStringTable *table, bool release)
+///
+/// @brief Remove all the strings from a LogStringTable.
+///
+/// @param table The LogStringTable to clear.
+/// @param release Whether or not to also release the table's memory.
+///
+/// @return This function returns no value.
+static void _logStringTableClear(LogStringTable *table, bool release) {
+  for (u64 ii = 0; ii < table->size; ii++) {
+    if ((table->ownsValues == true) && (table->entries[ii].value != NULL)) {
+      free((void*) table->entries[ii].value);
+    }
+    table->entries[ii].value = NULL;
+  }
+  table->count = 0;
+  if (release == true) {
+    free(table->entries);
+    table->entries = NULL;
+    table->size = 0;
+  }
+}
 
 /// @fn int loggingStart_(const char *logFilename, char* (*makeLogHeader)(LogLevel logLevel, const char *fileName, const char *functionName, int lineNumber), int (*userLogHandler)(void *message, u64 length), void* (*encryptLogMessage)(void *message, u64 *length), int (*userPlaintextLogHandler)(void *message, u64 length), ...)
 ///
@@ -186,9 +406,27 @@ int loggingStart_(const char *logFilename,
       returnValue = -1;
     }
     
-    _logQueue = queueCreate(typePointerNoCopy);
-    if (_logQueue == NULL) {
-      fputs("Could not initialize _logQueue.\n", stderr);
+    status = mtx_init(&_logThreadBuffersMutex, mtx_plain);
+    if (status != thrd_success) {
+      fputs("Could not initialize logThreadBuffersMutex.\n", stderr);
+      returnValue = -1;
+    }
+    
+    status = tss_create(&_logThreadBufferKey, _logThreadBufferAbandon);
+    if (status != thrd_success) {
+      fputs("Could not initialize logThreadBufferKey.\n", stderr);
+      returnValue = -1;
+    }
+    
+    status = mtx_init(&_logRolloverMutex, mtx_plain);
+    if (status != thrd_success) {
+      fputs("Could not initialize logRolloverMutex.\n", stderr);
+      returnValue = -1;
+    }
+    
+    status = cnd_init(&_logRolloverCondition);
+    if (status != thrd_success) {
+      fputs("Could not initialize logRolloverCondition.\n", stderr);
       returnValue = -1;
     }
     
@@ -242,6 +480,12 @@ int loggingStart_(const char *logFilename,
   _encryptLogMessage = encryptLogMessage;
   _encryptionKey = encryptionKey;
   _userPlaintextLogHandler = userPlaintextLogHandler;
+  // Only the built-in header generator is known to be thread-safe.  Calls into
+  // anything else are serialized, as they always have been.
+  _serializeLogCallbacks = ((makeLogHeader != NULL)
+      && (makeLogHeader != loggingHeaderGenerator))
+    || (userLogHandler != NULL) || (encryptLogMessage != NULL)
+    || (userPlaintextLogHandler != NULL);
   _hostname = getenv("HOSTNAME");
   if ((_hostname == NULL) || (*_hostname == '\0')) {
     _hostname = getenv("COMPUTERNAME");
@@ -258,6 +502,14 @@ int loggingStart_(const char *logFilename,
     _fileToWriteTo = stdout;
   }
   
+  _logFileStarted = getNowNanoseconds();
+  if (_runLogRolloverThread == false) {
+    _runLogRolloverThread = true;
+    thrd_create(&_logRolloverThread, _logRolloverFunction, NULL);
+  }
+  _logRolloverSetFilename(((logFile != NULL) && (logFile != stderr)
+    && (logFile != DEBUG_LOGFILE_POINTER)) ? _logFilename : NULL);
+  
   if (_runLoggingQueueFunction == false) {
     // loggingQueueFunction's initialization depends on some of the variables
     // above being setup, so we have to start it last.
@@ -283,11 +535,32 @@ void loggingStop() {
     mtx_unlock(&_writeMessagesMutex);
     int result = 0; // Unused dummy variable for thrd_join.
     thrd_join(_loggingQueueThread, &result);
+    // The rollover thread finishes any archives that are pending before it
+    // exits.
+    _logRolloverSetFilename(NULL);
+    mtx_lock(&_logRolloverMutex);
+    _runLogRolloverThread = false;
+    cnd_signal(&_logRolloverCondition);
+    mtx_unlock(&_logRolloverMutex);
+    thrd_join(_logRolloverThread, &result);
     tryLockResource(loggingForbidden);
-    _logQueue = queueDestroy(_logQueue);
+    tss_delete(_logThreadBufferKey);
+    mtx_lock(&_logThreadBuffersMutex);
+    while (_logThreadBuffers != NULL) {
+      LogThreadBuffer *threadBuffer = _logThreadBuffers;
+      _logThreadBuffers = threadBuffer->next;
+      // The logging thread drained everything before it exited.
+      threadBuffer->queue = ringQueueDestroy(threadBuffer->queue);
+      threadBuffer = (LogThreadBuffer*) pointerDestroy(threadBuffer);
+    }
+    mtx_unlock(&_logThreadBuffersMutex);
+    _logStringTableClear(&_logBinaryStrings, true);
     unlockResource(loggingForbidden);
     _fileToWriteTo = NULL;
     
+    mtx_destroy(&_logRolloverMutex);
+    cnd_destroy(&_logRolloverCondition);
+    mtx_destroy(&_logThreadBuffersMutex);
     mtx_destroy(&_headerMessageMutex);
     mtx_destroy(&_writeMessagesMutex);
     cnd_destroy(&_writeMessagesCondition);
@@ -298,220 +571,1548 @@ void loggingStop() {
       fclose(logFile); logFile = NULL;
     }
     
-    tss_delete(loggingForbidden);
-    memset(&loggingForbidden, 0, sizeof(loggingForbidden));
-    tss_delete(*_threadLoggingThreshold_);
-    _threadLoggingThreshold_
-      = (tss_t*) pointerDestroy(_threadLoggingThreshold_);
-    
-    _makeLogHeader = NULL;
-    _userLogHandler = NULL;
-    _encryptLogMessage = NULL;
-    _encryptionKey = NULL;
-    _userPlaintextLogHandler = NULL;
-    _hostname = NULL;
+    tss_delete(loggingForbidden);
+    memset(&loggingForbidden, 0, sizeof(loggingForbidden));
+    tss_delete(*_threadLoggingThreshold_);
+    _threadLoggingThreshold_
+      = (tss_t*) pointerDestroy(_threadLoggingThreshold_);
+    
+    _makeLogHeader = NULL;
+    _userLogHandler = NULL;
+    _encryptLogMessage = NULL;
+    _encryptionKey = NULL;
+    _userPlaintextLogHandler = NULL;
+    _hostname = NULL;
+  }
+  
+  _loggingInitialized = false;
+  
+  return;
+}
+
+/// @fn int setLogThreshold(LogLevel logLevel, const char *user)
+///
+/// @brief This sets the log level threshold below which we will not print.
+/// The new log level is always echoed to the log file since the message is
+/// critical.
+///
+/// @param logLevel is the new log level.
+/// @param user is the user who initiated the command.
+///
+/// @return This function return 0 on success, -1 on failure.
+int setLogThreshold(LogLevel logLevel, const char *user) {
+  printLog(TRACE, "ENTER setLogThreshold(logLevel=\"%s\", user=\"%s\")\n",
+    (logLevel < NUM_LOG_LEVELS) ? LogLevelName[logLevel] : "INVALID", user);
+  
+  if (logLevel >= NUM_LOG_LEVELS) {
+    printLog(ERR, "Invalid logLevel %d specified.\n", logLevel);
+    printLog(TRACE, "EXIT setLogThreshold(logLevel=INVALID, \"%s\") = {-1}\n",
+      user);
+    return -1;
+  }
+  
+  const char *oldThreshold = LogLevelName[logThreshold];
+  logThreshold = logLevel;
+  printLog(CRITICAL, "%s has changed the log level from %s to %s\n", user,
+    oldThreshold, LogLevelName[logThreshold]);
+  (void) oldThreshold; // In case logging is disabled and printLog is compiled
+                       // out.
+  
+  printLog(TRACE, "EXIT setLogThreshold(logLevel=\"%s\", \"%s\") = {0}\n",
+    LogLevelName[logLevel], user);
+  return 0;
+}
+
+/// @fn char *getTimestamp(struct timespec *time)
+///
+/// @brief This function returns a timestamp in a standard format used.  Any
+/// functions that require a timestamp MUST call this function to get it.
+///
+/// @param time A pointer to a struct timespec representing the time to make
+///   this timestamp for.  If NULL is provided, the current time will be used.
+///
+/// @return A timestamp representing the current time will be returned.
+///
+/// @note This function is one of the few that does not print out ENTER and
+/// EXIT information to the log as that would create a situation of infinite
+/// recursion.
+char *getTimestamp(struct timespec *time) {
+  struct timespec now;
+  if (time == NULL) {
+    // This is the expected usual case, so optimize for that.
+    timespec_get(&now, TIME_UTC);
+  } else {
+    now = *time;
+  }
+  
+  return formatTimestamp((i64) now.tv_sec, (long) now.tv_nsec, NULL);
+}
+
+/// @fn char *loggingHeaderGenerator(LogLevel logLevel, const char *fileName, const char *functionName, int lineNumber)
+///
+/// @brief Creates a header for a log entry in the form:<br />
+/// "[YYYY-MM-DD HH:MM:SS.NNNNNNNNN HostInfo Module LogLevel] "<br />
+/// Module will be constructed from the fileName, functionName, and lineNumber
+///
+/// @param logLevel is the LogLevel the message was logged with
+/// @param fileName is the name of the file the header is for
+/// @param functionName is the name of the function the header is for
+/// @param lineNumber is the line number the header is for
+///
+/// @return Returns a newly-allocated string containing the log header.
+///
+/// @note This function is one of the few that does not print out ENTER and
+///       EXIT information to the log as that would create a situation of
+///       infinite recursion.
+char *loggingHeaderGenerator(LogLevel logLevel, const char *fileName,
+  const char *functionName, int lineNumber
+) {
+  char *logHeader = NULL;
+  
+  // Timestamp variables
+  char timestamp[TIMESTAMP_SIZE];
+  struct timespec now;
+  timespec_get(&now, TIME_UTC);
+  formatTimestamp((i64) now.tv_sec, (long) now.tv_nsec, timestamp);
+  
+  const char *slashAt = strrchr(fileName, '/');
+  if (slashAt == NULL) {
+    slashAt = strrchr(fileName, '\\');
+  }
+  if (slashAt != NULL) {
+    fileName = slashAt + 1;
+  }
+  
+  u64 threadId = loggingGetThreadId();
+  u32 pid = 0;
+  pid = (u32) getpid();
+  
+  // "[YYYY-MM-DD HH:MM:SS.NNNNNNNNN HostInfo Module LogLevel] "
+  // HostInfo = hostname:pid.thread
+  // We may have forked since loggingStart was called, so have to call getpid
+  // every time.  We can assume we're running on the same host, though.
+  // Module = fileName:functionName.lineNumber
+  if (asprintf(&logHeader, "[%s %s:%u.%llu %s:%s.%d %s] ", timestamp,
+    _hostname, (unsigned int) pid, (long long unsigned int) threadId,
+    fileName, functionName, lineNumber,
+    LogLevelName[logLevel]) < 0
+  ) {
+    // Do nothing.  We can't log an error.  logHeader will be NULL.  This is
+    // just here to make the complier happy.
+  }
+  
+  return logHeader;
+}
+
+/// @fn int loggingSetRolloverPolicy(u64 maxSize, u64 maxAgeSeconds, bool compress, u32 maxArchives)
+///
+/// @brief Configure when the log file is rolled over and what happens to the
+/// archives.  Archives are named after the log file with a timestamp appended.
+///
+/// @param maxSize Roll over once the log reaches this many bytes.  0 disables
+///   size-based rollover.  The default is LOG_ROLLOVER_SIZE.
+/// @param maxAgeSeconds Roll over once the log has been written to for this
+///   many seconds.  0, the default, disables time-based rollover.
+/// @param compress Whether or not to compress each archive into a .zip file.
+/// @param maxArchives The number of archives to keep.  Older ones are deleted.
+///   0, the default, keeps all of them.
+///
+/// @return This function always succeeds and returns 0.
+int loggingSetRolloverPolicy(u64 maxSize, u64 maxAgeSeconds, bool compress,
+  u32 maxArchives
+) {
+  _logRolloverSize = maxSize;
+  _logRolloverInterval = ((i64) maxAgeSeconds) * ((i64) 1000000000);
+  _logRolloverCompress = compress;
+  _logRolloverMaxArchives = maxArchives;
+  
+  return 0;
+}
+
+/// @fn static void _logArchiveCompress(const char *archiveFilename)
+///
+/// @brief Compress a log archive into a .zip file next to it and remove the
+/// original.
+///
+/// @param archiveFilename The full path to the archive.
+///
+/// @return This function returns no value.  If compression fails, the archive
+/// is left as it is.
+static void _logArchiveCompress(const char *archiveFilename) {
+  Bytes fileContent = getFileContent(archiveFilename);
+  if (fileContent == NULL) {
+    return;
+  }
+  
+  const char *entryName = strrchr(archiveFilename, '/');
+  if (entryName == NULL) {
+    entryName = strrchr(archiveFilename, '\\');
+  }
+  entryName = (entryName != NULL) ? entryName + 1 : archiveFilename;
+  char *zipFilename = NULL;
+  straddstr(&zipFilename, archiveFilename);
+  straddstr(&zipFilename, ".zip");
+  
+  Zip *zip = NULL;
+  if (zipFilename != NULL) {
+    remove(zipFilename);
+    zip = zipOpenFile(zipFilename);
+  }
+  if ((zip != NULL)
+    && (zipAddEntry(zip, entryName, fileContent, bytesLength(fileContent))
+      == 0)
+    && (zipFlush(zip) == 0)
+  ) {
+    remove(archiveFilename);
+  }
+  
+  zip = zipDestroy(zip);
+  zipFilename = stringDestroy(zipFilename);
+  fileContent = bytesDestroy(fileContent);
+}
+
+/// @fn static int _logArchiveCompare(const void *a, const void *b)
+///
+/// @brief qsort comparison function for archive names.  The timestamps in the
+/// names sort in time order.
+///
+/// @param a A pointer to the first name.
+/// @param b A pointer to the second name.
+///
+/// @return Returns the strcmp of the two names.
+static int _logArchiveCompare(const void *a, const void *b) {
+  return strcmp(*((char**) a), *((char**) b));
+}
+
+/// @fn static void _logArchivesPrune(const char *logFilename, u32 maxArchives)
+///
+/// @brief Delete the oldest archives of a log so that at most maxArchives of
+/// them remain.
+///
+/// @param logFilename The name of the log whose archives to prune.
+/// @param maxArchives The number of archives to keep.
+///
+/// @return This function returns no value.
+static void _logArchivesPrune(const char *logFilename, u32 maxArchives) {
+  char *directoryName = NULL;
+  const char *baseName = strrchr(logFilename, '/');
+  if (baseName == NULL) {
+    baseName = strrchr(logFilename, '\\');
+  }
+  if (baseName != NULL) {
+    directoryName = (char*) calloc(1, (baseName - logFilename) + 2);
+    if (directoryName != NULL) {
+      memcpy(directoryName, logFilename, (baseName - logFilename) + 1);
+    }
+    baseName++;
+  } else {
+    straddstr(&directoryName, ".");
+    baseName = logFilename;
+  }
+  char *prefix = NULL;
+  straddstr(&prefix, baseName);
+  straddstr(&prefix, "_");
+  DIR *directory = NULL;
+  if ((directoryName != NULL) && (prefix != NULL)) {
+    directory = opendir(directoryName);
+  }
+  if (directory == NULL) {
+    prefix = stringDestroy(prefix);
+    directoryName = stringDestroy(directoryName);
+    return;
+  }
+  
+  char **archives = NULL;
+  u64 numArchives = 0;
+  u64 prefixLength = (u64) strlen(prefix);
+  struct dirent *entry = NULL;
+  while ((entry = readdir(directory)) != NULL) {
+    if (strncmp(entry->d_name, prefix, prefixLength) != 0) {
+      continue;
+    }
+    char **grown = (char**) realloc(archives,
+      (numArchives + 1) * sizeof(char*));
+    if (grown == NULL) {
+      break;
+    }
+    archives = grown;
+    archives[numArchives] = NULL;
+    straddstr(&archives[numArchives], directoryName);
+    straddstr(&archives[numArchives], "/");
+    straddstr(&archives[numArchives], entry->d_name);
+    numArchives++;
+  }
+  closedir(directory);
+  
+  if (numArchives > 0) {
+    qsort(archives, numArchives, sizeof(char*), _logArchiveCompare);
+  }
+  for (u64 ii = 0; ii < numArchives; ii++) {
+    if ((numArchives - ii > maxArchives) && (archives[ii] != NULL)) {
+      remove(archives[ii]);
+    }
+    archives[ii] = stringDestroy(archives[ii]);
+  }
+  
+  archives = (char**) pointerDestroy(archives);
+  prefix = stringDestroy(prefix);
+  directoryName = stringDestroy(directoryName);
+}
+
+/// @fn static void _logNextFileDiscard(void)
+///
+/// @brief Close and remove the pre-opened log file, if any.  Must be called
+/// with _logRolloverMutex held.
+///
+/// @return This function returns no value.
+static void _logNextFileDiscard(void) {
+  if (_logNextFile != NULL) {
+    fclose(_logNextFile); _logNextFile = NULL;
+    remove(_logNextFilename);
+  }
+  _logNextFilename = stringDestroy(_logNextFilename);
+}
+
+/// @fn static int _logRolloverFunction(void *args)
+///
+/// @brief Thread function that does the slow parts of rolling the log over so
+/// that the logging thread doesn't have to:  pre-opening the next log file,
+/// closing old ones, compressing archives, and pruning old archives.
+///
+/// @param args Parameter supplied for compatibility with C threads function
+///   pointer prototype.  Ignored by this function.
+///
+/// @return This function always returns 0.
+static int _logRolloverFunction(void *args) {
+  (void) args;
+  
+  // Prevent this thread from generating any logging messages.
+  bool logLock = tryLockResource(loggingForbidden);
+  bool preopenFailed = false;
+  
+  mtx_lock(&_logRolloverMutex);
+  while (1) {
+    LogRolloverJob *jobs = _logRolloverJobs;
+    _logRolloverJobs = NULL;
+    _logRolloverJobsTail = NULL;
+    char *nextFilename = NULL;
+    if ((_logNextFile == NULL) && (_logRolloverFilename != NULL)
+      && (preopenFailed == false)
+    ) {
+      straddstr(&nextFilename, _logRolloverFilename);
+      straddstr(&nextFilename, ".next");
+    }
+    if ((jobs == NULL) && (nextFilename == NULL)) {
+      if (_runLogRolloverThread == false) {
+        break;
+      }
+      cnd_wait(&_logRolloverCondition, &_logRolloverMutex);
+      continue;
+    }
+    mtx_unlock(&_logRolloverMutex);
+    
+    // Get the next log file ready to swap in.
+    FILE *nextFile = NULL;
+    if (nextFilename != NULL) {
+      remove(nextFilename);
+      nextFile = fopen(nextFilename, "a");
+      preopenFailed = (nextFile == NULL);
+    }
+    
+    while (jobs != NULL) {
+      LogRolloverJob *job = jobs;
+      jobs = job->next;
+      if (job->oldLogFile != NULL) {
+        fclose(job->oldLogFile);
+      }
+      if (_logRolloverCompress == true) {
+        _logArchiveCompress(job->archiveFilename);
+      }
+      if (_logRolloverMaxArchives > 0) {
+        _logArchivesPrune(job->logFilename, _logRolloverMaxArchives);
+      }
+      job->logFilename = stringDestroy(job->logFilename);
+      job->archiveFilename = stringDestroy(job->archiveFilename);
+      job = (LogRolloverJob*) pointerDestroy(job);
+      // A log file was swapped out, so try pre-opening again.
+      preopenFailed = false;
+    }
+    
+    mtx_lock(&_logRolloverMutex);
+    if ((nextFile != NULL) && (_logNextFile == NULL)
+      && (_logRolloverFilename != NULL)
+      && (strncmp(nextFilename, _logRolloverFilename,
+        strlen(_logRolloverFilename)) == 0)
+      && (strcmp(nextFilename + strlen(_logRolloverFilename), ".next") == 0)
+    ) {
+      _logNextFile = nextFile;
+      _logNextFilename = nextFilename;
+      nextFilename = NULL;
+    } else if (nextFile != NULL) {
+      // The log file changed while we were opening this one.
+      fclose(nextFile);
+      remove(nextFilename);
+    }
+    nextFilename = stringDestroy(nextFilename);
+  }
+  _logNextFileDiscard();
+  mtx_unlock(&_logRolloverMutex);
+  
+  if (logLock) {
+    unlockResource(loggingForbidden);
+  }
+  
+  return 0;
+}
+
+/// @fn static void _logRolloverSetFilename(const char *logFilename)
+///
+/// @brief Tell the rollover thread which log file to prepare replacements for.
+///
+/// @param logFilename The name of the current log file, or NULL if we're not
+///   logging to a file.
+///
+/// @return This function returns no value.
+static void _logRolloverSetFilename(const char *logFilename) {
+  mtx_lock(&_logRolloverMutex);
+  _logNextFileDiscard();
+  _logRolloverFilename = stringDestroy(_logRolloverFilename);
+  if ((logFilename != NULL) && (*logFilename != '\0')) {
+    straddstr(&_logRolloverFilename, logFilename);
+  }
+  cnd_signal(&_logRolloverCondition);
+  mtx_unlock(&_logRolloverMutex);
+}
+
+/// @fn int _rolloverLog(void)
+///
+/// @brief Check to see if we need to roll over the log into an arhive log and
+///   start a new one if so.
+///
+/// @details The full log is renamed to its archive name and the file the
+/// rollover thread pre-opened is renamed into its place, so the logging thread
+/// only swaps FILE pointers.  Where open files can't be renamed, the log is
+/// copied to the archive and truncated instead.  Closing, compressing, and
+/// pruning are left to the rollover thread.
+///
+/// @return Returns 0 on success, -1 on failure.
+int _rolloverLog(void) {
+  if ((exitNow == false) && (logFile != NULL)
+    && (logFile != DEBUG_LOGFILE_POINTER)
+    && (_logFilename != NULL) && (*_logFilename != '\0')
+  ) {
+    long logSize = 0;
+    logSize = ftell(logFile);
+    i64 now = 0;
+    if (_logRolloverInterval > 0) {
+      now = getNowNanoseconds();
+    }
+    if (((_logRolloverSize > 0) && (logSize >= (long) _logRolloverSize))
+      || ((_logRolloverInterval > 0) && (logSize > 0)
+        && (now - _logFileStarted >= _logRolloverInterval))
+    ) {
+      FILE *_logFile = logFile;
+      // Anything still in the stdio buffer belongs in the archive, not at the
+      // start of the new log.
+      fflush(_logFile);
+      
+      char *timestamp = NULL;
+      timestamp = getTimestamp(NULL);
+      char *archiveLogFilename = NULL;
+      straddstr(&archiveLogFilename, _logFilename);
+      // timestamp format = "YYYY-MM-DD HH:MM:SS.NNNNNNNNN "
+      //                     0123456789012345678901234567890
+      // We can't use ':' in a file name, and let's not use ' ' or '.' either.
+      timestamp[10] = '_';
+      timestamp[13] = '-';
+      timestamp[16] = '-';
+      timestamp[19] = '-';
+      timestamp[29] = '\0';
+      straddstr(&archiveLogFilename, "_");
+      straddstr(&archiveLogFilename, timestamp);
+      timestamp = stringDestroy(timestamp);
+      if (archiveLogFilename == NULL) {
+        // Memory allocation failure.  Try again on the next write.
+        return -1;
+      }
+      
+      mtx_lock(&_logRolloverMutex);
+      FILE *nextLogFile = _logNextFile;
+      char *nextLogFilename = _logNextFilename;
+      _logNextFile = NULL;
+      _logNextFilename = NULL;
+      mtx_unlock(&_logRolloverMutex);
+      
+      bool swapped = false;
+      if (rename(_logFilename, archiveLogFilename) == 0) {
+        if ((nextLogFile != NULL)
+          && (rename(nextLogFilename, _logFilename) == 0)
+        ) {
+          swapped = true;
+        } else {
+          // Nothing pre-opened.  Open the new log ourselves.
+          if (nextLogFile != NULL) {
+            fclose(nextLogFile);
+            remove(nextLogFilename);
+          }
+          nextLogFile = fopen(_logFilename, "a");
+          swapped = (nextLogFile != NULL);
+          if (swapped == false) {
+            rename(archiveLogFilename, _logFilename);
+          }
+        }
+      } else if (nextLogFile != NULL) {
+        fclose(nextLogFile);
+        remove(nextLogFilename);
+      }
+      nextLogFilename = stringDestroy(nextLogFilename);
+      
+      if (swapped == true) {
+        logFile = nextLogFile;
+        _fileToWriteTo = nextLogFile;
+      } else {
+        // Change the globl logFile in case any non-LoggingLib calls try to
+        // write to it whiile we're rolling over.
+        logFile = stderr;
+        Bytes fileContent = NULL;
+        fileContent = getFileContent(_logFilename);
+        putFileContent(archiveLogFilename, fileContent,
+          bytesLength(fileContent));
+        fileContent = bytesDestroy(fileContent);
+        if (ftruncate(fileno(_logFile), 0) != 0) {
+          // Do nothing.  We can't log an error here.  Also, if we can't
+          // truncate the file, we don't lose data, so we don't care.  This
+          // check is just here to make the compiler happy.
+        }
+        
+        // Reset the logFile.
+        logFile = _logFile;
+      }
+      // A binary log's string definitions went with the archive.
+      _logStringTableClear(&_logBinaryStrings, false);
+      _logFileStarted = (now != 0) ? now : getNowNanoseconds();
+      
+      LogRolloverJob *job
+        = (LogRolloverJob*) calloc(1, sizeof(LogRolloverJob));
+      if (job != NULL) {
+        job->oldLogFile = (swapped == true) ? _logFile : NULL;
+        job->archiveFilename = archiveLogFilename;
+        straddstr(&job->logFilename, _logFilename);
+        mtx_lock(&_logRolloverMutex);
+        if (_logRolloverJobsTail != NULL) {
+          _logRolloverJobsTail->next = job;
+        } else {
+          _logRolloverJobs = job;
+        }
+        _logRolloverJobsTail = job;
+        cnd_signal(&_logRolloverCondition);
+        mtx_unlock(&_logRolloverMutex);
+      } else {
+        if (swapped == true) {
+          fclose(_logFile);
+        }
+        archiveLogFilename = stringDestroy(archiveLogFilename);
+      }
+    }
+  }
+  
+  return 0;
+}
+
+/// @struct LogMessage
+///
+/// @brief Structure for containing all the information needed to log a message
+/// to the log file.  Messages printed to the log file may be ASCII or binary,
+/// so we have to have a pointer and a length rather than a string.
+///
+/// @param buffer A pointer to the contnets to print to the log file.
+/// @param length The number of bytes pointed to by the buffer pointer.
+/// @param binary Whether or not the buffer holds a binary log record rather
+///   than formatted text.
+typedef struct LogMessage {
+  void *buffer;
+  size_t length;
+  bool binary;
+} LogMessage;
+
+/// @struct LogBinaryRecordHeader
+///
+/// @brief The header that begins every record in a binary log.
+///
+/// @param magic Always LOG_BINARY_RECORD_MAGIC.
+/// @param type The LogBinaryRecordType of the record.
+/// @param length The number of bytes in the record that follow the header.
+typedef struct LogBinaryRecordHeader {
+  u32 magic;
+  u32 type;
+  u64 length;
+} LogBinaryRecordHeader;
+
+/// @struct LogBinaryMessage
+///
+/// @brief The fixed part of a LOG_BINARY_RECORD_MESSAGE record.  It's followed
+/// by the message's raw arguments in the order the format string consumes
+/// them.  Integers and pointers take 8 bytes, doubles take a double, long
+/// doubles take a long double, and strings take an 8-byte length followed by
+/// their text (a length of all ones means a NULL string).
+///
+/// The string fields hold the addresses the strings had in the logging
+/// process.  Their text is written to the log in LOG_BINARY_RECORD_STRING
+/// records before the first record that refers to them.
+///
+/// @param timestamp The time of the call as returned by getNowNanoseconds.
+/// @param threadId The loggingGetThreadId value of the calling thread.
+/// @param formatString The address of the printLog format string.
+/// @param fileName The address of the __FILE__ string of the call.
+/// @param functionName The address of the __func__ string of the call.
+/// @param lineNumber The __LINE__ of the call.
+/// @param logLevel The LogLevel of the message.
+/// @param pid The process ID of the caller.
+/// @param hasHeader 1 if the message gets a loggingHeaderGenerator header, 0
+///   if it's logged bare.
+typedef struct LogBinaryMessage {
+  i64 timestamp;
+  u64 threadId;
+  u64 formatString;
+  u64 fileName;
+  u64 functionName;
+  i32 lineNumber;
+  u32 logLevel;
+  u32 pid;
+  u32 hasHeader;
+} LogBinaryMessage;
+
+/// @enum LogArgumentType
+///
+/// @brief The kinds of arguments a printf conversion can consume.
+typedef enum LogArgumentType {
+  LOG_ARGUMENT_NONE,        // "%%"
+  LOG_ARGUMENT_INT,
+  LOG_ARGUMENT_LONG,
+  LOG_ARGUMENT_LONG_LONG,
+  LOG_ARGUMENT_INTMAX,
+  LOG_ARGUMENT_SIZE,
+  LOG_ARGUMENT_PTRDIFF,
+  LOG_ARGUMENT_DOUBLE,
+  LOG_ARGUMENT_LONG_DOUBLE,
+  LOG_ARGUMENT_STRING,
+  LOG_ARGUMENT_POINTER,
+  LOG_ARGUMENT_UNSUPPORTED, // "%n", wide characters, anything unrecognized
+} LogArgumentType;
+
+/// @struct LogConversion
+///
+/// @brief One conversion specification from a printf format string.
+///
+/// @param start The '%' that begins the specification.
+/// @param end One past the conversion character.
+/// @param type The type of argument the conversion consumes.
+/// @param numStars The number of '*' width and precision int arguments that
+///   come before the argument.
+/// @param starPrecision Whether or not the last star argument is the precision.
+/// @param precision The literal precision, or -1 if none was given.
+typedef struct LogConversion {
+  const char *start;
+  const char *end;
+  LogArgumentType type;
+  u8 numStars;
+  bool starPrecision;
+  i64 precision;
+} LogConversion;
+
+/// @fn static const char* _logNextConversion(const char *formatString, LogConversion *conversion)
+///
+/// @brief Find and parse the next conversion specification in a printf format
+/// string.
+///
+/// @param formatString The part of the format string to search.
+/// @param conversion The LogConversion to fill in.
+///
+/// @return Returns the start of the specification found, NULL if there are no
+/// more.
+static const char* _logNextConversion(const char *formatString,
+  LogConversion *conversion
+) {
+  const char *cur = strchr(formatString, '%');
+  if (cur == NULL) {
+    return NULL;
+  }
+  conversion->start = cur++;
+  conversion->numStars = 0;
+  conversion->starPrecision = false;
+  conversion->precision = -1;
+  
+  if (*cur == '%') {
+    conversion->type = LOG_ARGUMENT_NONE;
+    conversion->end = cur + 1;
+    return conversion->start;
+  }
+  
+  // Flags and width.
+  while ((*cur != '\0') && (strchr("-+ #0'", *cur) != NULL)) {
+    cur++;
+  }
+  if (*cur == '*') {
+    conversion->numStars++;
+    cur++;
+  }
+  while (isdigit((unsigned char) *cur)) {
+    cur++;
+  }
+  
+  // Precision.
+  if (*cur == '.') {
+    cur++;
+    if (*cur == '*') {
+      conversion->numStars++;
+      conversion->starPrecision = true;
+      cur++;
+    } else {
+      conversion->precision = 0;
+      while (isdigit((unsigned char) *cur)) {
+        conversion->precision = (conversion->precision * 10) + (*cur - '0');
+        cur++;
+      }
+    }
+  }
+  
+  // Length modifier.  hh and h arguments are promoted to int.
+  int numLongs = 0;
+  char length = '\0';
+  while ((*cur == 'h') || (*cur == 'l')) {
+    numLongs += (*cur == 'l');
+    cur++;
+  }
+  if ((*cur != '\0') && (strchr("jztLq", *cur) != NULL)) {
+    length = *cur++;
+  }
+  
+  switch (*cur) {
+    case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+      if (length == 'j') {
+        conversion->type = LOG_ARGUMENT_INTMAX;
+      } else if (length == 'z') {
+        conversion->type = LOG_ARGUMENT_SIZE;
+      } else if (length == 't') {
+        conversion->type = LOG_ARGUMENT_PTRDIFF;
+      } else if ((numLongs >= 2) || (length == 'L') || (length == 'q')) {
+        conversion->type = LOG_ARGUMENT_LONG_LONG;
+      } else if (numLongs == 1) {
+        conversion->type = LOG_ARGUMENT_LONG;
+      } else {
+        conversion->type = LOG_ARGUMENT_INT;
+      }
+      break;
+    case 'c':
+      conversion->type
+        = (numLongs == 0) ? LOG_ARGUMENT_INT : LOG_ARGUMENT_UNSUPPORTED;
+      break;
+    case 'e': case 'E': case 'f': case 'F': case 'g': case 'G':
+    case 'a': case 'A':
+      conversion->type
+        = (length == 'L') ? LOG_ARGUMENT_LONG_DOUBLE : LOG_ARGUMENT_DOUBLE;
+      break;
+    case 's':
+      conversion->type
+        = (numLongs == 0) ? LOG_ARGUMENT_STRING : LOG_ARGUMENT_UNSUPPORTED;
+      break;
+    case 'p':
+      conversion->type = LOG_ARGUMENT_POINTER;
+      break;
+    default:
+      conversion->type = LOG_ARGUMENT_UNSUPPORTED;
+      break;
+  }
+  conversion->end = (*cur != '\0') ? cur + 1 : cur;
+  
+  return conversion->start;
+}
+
+/// @fn static bool _logBinaryAppend(char **record, u64 *length, u64 *size, const void *data, u64 dataLength)
+///
+/// @brief Append data to a binary record that's being built, growing it as
+/// needed.
+///
+/// @param record A pointer to the record's buffer.
+/// @param length A pointer to the number of bytes used in the record.
+/// @param size A pointer to the number of bytes allocated for the record.
+/// @param data The data to append.
+/// @param dataLength The number of bytes of data to append.
+///
+/// @return Returns true on success, false on memory allocation failure.
+static bool _logBinaryAppend(char **record, u64 *length, u64 *size,
+  const void *data, u64 dataLength
+) {
+  if (*length + dataLength > *size) {
+    u64 newSize = *size * 2;
+    while (newSize < *length + dataLength) {
+      newSize *= 2;
+    }
+    char *newRecord = (char*) realloc(*record, newSize);
+    if (newRecord == NULL) {
+      return false;
+    }
+    *record = newRecord;
+    *size = newSize;
+  }
+  memcpy(*record + *length, data, dataLength);
+  *length += dataLength;
+  
+  return true;
+}
+
+/// @fn static LogMessage* _logBinaryMessageCreate(const char *fileName, const char *functionName, int lineNumber, LogLevel logLevel, const char *formatString, va_list args)
+///
+/// @brief Capture a printLog call as a LOG_BINARY_RECORD_MESSAGE record
+/// without formatting it.
+///
+/// @param fileName is the name of the file from which the call is made.
+/// @param functionName is the name of the function making the call.
+/// @param lineNumber is the line of the file the printLog call is made from.
+/// @param logLevel is the level of the message to be printed.
+/// @param formatString is the format string of the message.  It must outlive
+///   the logging thread, which is true of the string literals printLog is
+///   used with.
+/// @param args is the va_list of arguments the formatString requires.
+///
+/// @return Returns a newly-allocated LogMessage holding the record on success,
+/// NULL if the format string uses a conversion that can't be deferred or on
+/// memory allocation failure.
+static LogMessage* _logBinaryMessageCreate(const char *fileName,
+  const char *functionName, int lineNumber, LogLevel logLevel,
+  const char *formatString, va_list args
+) {
+  u64 size = LOG_BINARY_RECORD_INITIAL_SIZE;
+  u64 length = sizeof(LogBinaryRecordHeader) + sizeof(LogBinaryMessage);
+  char *record = (char*) malloc(size);
+  if (record == NULL) {
+    return NULL;
+  }
+  
+  ZEROINIT(LogBinaryMessage binaryMessage);
+  binaryMessage.timestamp = getNowNanoseconds();
+  binaryMessage.threadId = loggingGetThreadId();
+  binaryMessage.formatString = (u64) (uintptr_t) formatString;
+  binaryMessage.fileName = (u64) (uintptr_t) fileName;
+  binaryMessage.functionName = (u64) (uintptr_t) functionName;
+  binaryMessage.lineNumber = (i32) lineNumber;
+  binaryMessage.logLevel = (u32) logLevel;
+  binaryMessage.pid = (u32) getpid();
+  binaryMessage.hasHeader = (_makeLogHeader == loggingHeaderGenerator);
+  memcpy(record + sizeof(LogBinaryRecordHeader), &binaryMessage,
+    sizeof(binaryMessage));
+  
+  bool success = true;
+  LogConversion conversion;
+  const char *cur = formatString;
+  while ((success == true) && (_logNextConversion(cur, &conversion) != NULL)) {
+    cur = conversion.end;
+    i64 precision = conversion.precision;
+    for (u8 ii = 0; (success == true) && (ii < conversion.numStars); ii++) {
+      i64 starValue = (i64) va_arg(args, int);
+      if ((conversion.starPrecision == true)
+        && (ii == conversion.numStars - 1)
+      ) {
+        precision = starValue;
+      }
+      success = _logBinaryAppend(&record, &length, &size,
+        &starValue, sizeof(starValue));
+    }
+    
+    i64 integer = 0;
+    switch (conversion.type) {
+      case LOG_ARGUMENT_NONE:
+        continue;
+      case LOG_ARGUMENT_INT:
+        integer = (i64) va_arg(args, int);
+        break;
+      case LOG_ARGUMENT_LONG:
+        integer = (i64) va_arg(args, long);
+        break;
+      case LOG_ARGUMENT_LONG_LONG:
+        integer = (i64) va_arg(args, long long);
+        break;
+      case LOG_ARGUMENT_INTMAX:
+        integer = (i64) va_arg(args, intmax_t);
+        break;
+      case LOG_ARGUMENT_SIZE:
+        integer = (i64) va_arg(args, size_t);
+        break;
+      case LOG_ARGUMENT_PTRDIFF:
+        integer = (i64) va_arg(args, ptrdiff_t);
+        break;
+      case LOG_ARGUMENT_POINTER:
+        integer = (i64) (uintptr_t) va_arg(args, void*);
+        break;
+      case LOG_ARGUMENT_DOUBLE:
+        {
+          double value = va_arg(args, double);
+          success = success && _logBinaryAppend(&record, &length, &size,
+            &value, sizeof(value));
+        }
+        continue;
+      case LOG_ARGUMENT_LONG_DOUBLE:
+        {
+          long double value = va_arg(args, long double);
+          success = success && _logBinaryAppend(&record, &length, &size,
+            &value, sizeof(value));
+        }
+        continue;
+      case LOG_ARGUMENT_STRING:
+        {
+          const char *string = va_arg(args, const char*);
+          u64 stringLength = (u64) -1;
+          if (string != NULL) {
+            // Honor the precision so that we never read past the end of an
+            // unterminated buffer.
+            stringLength = (precision >= 0)
+              ? (u64) strnlen(string, (size_t) precision)
+              : (u64) strlen(string);
+          }
+          success = success && _logBinaryAppend(&record, &length, &size,
+            &stringLength, sizeof(stringLength));
+          if ((success == true) && (string != NULL)) {
+            success = _logBinaryAppend(&record, &length, &size,
+              string, stringLength);
+          }
+        }
+        continue;
+      default:
+        success = false;
+        continue;
+    }
+    success = success && _logBinaryAppend(&record, &length, &size,
+      &integer, sizeof(integer));
+  }
+  
+  LogMessage *message = NULL;
+  if (success == true) {
+    message = (LogMessage*) malloc(sizeof(LogMessage));
+  }
+  if (message == NULL) {
+    record = (char*) pointerDestroy(record);
+    return NULL;
+  }
+  
+  LogBinaryRecordHeader recordHeader;
+  recordHeader.magic = LOG_BINARY_RECORD_MAGIC;
+  recordHeader.type = LOG_BINARY_RECORD_MESSAGE;
+  recordHeader.length = length - sizeof(LogBinaryRecordHeader);
+  memcpy(record, &recordHeader, sizeof(recordHeader));
+  message->buffer = record;
+  message->length = length;
+  message->binary = true;
+  
+  return message;
+}
+
+/// @fn static inline bool _logBinaryActive(void)
+///
+/// @brief Determine whether or not messages are currently going to the log file
+/// as binary records.  Binary mode only applies to a real log file and only
+/// when no user callbacks are installed, since those expect formatted text.
+///
+/// @return Returns true if the log is binary, false if it's text.
+static inline bool _logBinaryActive(void) {
+  return (_binaryLogging == true) && (_serializeLogCallbacks == false)
+    && (logFile != NULL) && (logFile != DEBUG_LOGFILE_POINTER)
+    && (_fileToWriteTo == logFile);
+}
+
+/// @fn void loggingSetBinaryMode(bool binaryMode)
+///
+/// @brief Turn binary logging on or off.  In binary mode, printLog only copies
+/// its format string address and raw arguments into a record, and formatting
+/// is done offline by loggingDecodeBinaryLog.  printBox, printBanner, and
+/// printBinary messages are still formatted and are stored as text records.
+///
+/// @param binaryMode Whether or not to write a binary log.
+///
+/// @return This function returns no value.
+///
+/// @note A binary log should have a file of its own.  Binary mode is ignored
+/// when logging to stdout and when any user callbacks were given to
+/// loggingStart.
+void loggingSetBinaryMode(bool binaryMode) {
+  _binaryLogging = binaryMode;
+}
+
+/// @fn bool loggingBinaryMode(void)
+///
+/// @brief Get the setting of loggingSetBinaryMode.
+///
+/// @return Returns true if binary logging is requested, false if not.
+bool loggingBinaryMode(void) {
+  return _binaryLogging;
+}
+
+/// @struct LogWriteBuffer
+///
+/// @brief The logging thread's buffer for coalescing messages into large
+/// writes.
+///
+/// @param data The buffer itself.
+/// @param length The number of bytes of data waiting to be written.
+/// @param size The number of bytes allocated for data.
+/// @param direct Write straight to the log file instead of buffering.  Set
+///   while writing a message that's too big for the buffer.
+typedef struct LogWriteBuffer {
+  char *data;
+  u64 length;
+  u64 size;
+  bool direct;
+} LogWriteBuffer;
+
+/// @fn static void _logWriteBufferFlush(LogWriteBuffer *writeBuffer)
+///
+/// @brief Write everything waiting in a LogWriteBuffer to the log file.
+///
+/// @param writeBuffer The LogWriteBuffer to flush.
+///
+/// @return This function returns no value.
+static void _logWriteBufferFlush(LogWriteBuffer *writeBuffer) {
+  if (writeBuffer->length > 0) {
+    fwrite(writeBuffer->data, writeBuffer->length, 1, _fileToWriteTo);
+    writeBuffer->length = 0;
+  }
+}
+
+/// @fn static void _logWriteBufferAdd(LogWriteBuffer *writeBuffer, const void *data, u64 length)
+///
+/// @brief Add data to a LogWriteBuffer, or write it directly if it doesn't fit.
+///
+/// @param writeBuffer The LogWriteBuffer to add to.
+/// @param data The data to write.
+/// @param length The number of bytes of data to write.
+///
+/// @return This function returns no value.
+static void _logWriteBufferAdd(LogWriteBuffer *writeBuffer, const void *data,
+  u64 length
+) {
+  if ((writeBuffer->direct == false)
+    && (length <= writeBuffer->size - writeBuffer->length)
+  ) {
+    memcpy(writeBuffer->data + writeBuffer->length, data, length);
+    writeBuffer->length += length;
+  } else {
+    _logWriteBufferFlush(writeBuffer);
+    fwrite(data, length, 1, _fileToWriteTo);
+  }
+}
+
+/// @fn static u64 _logBinaryDefineStrings(const LogBinaryMessage *binaryMessage, LogWriteBuffer *writeBuffer)
+///
+/// @brief Write LOG_BINARY_RECORD_STRING records for the strings a message
+/// refers to that haven't been defined in the current log file yet.  The
+/// first record in every file defines the hostname, with a key of 0.
+///
+/// @param binaryMessage The LogBinaryMessage about to be written.
+/// @param writeBuffer The LogWriteBuffer to write to, or NULL to only compute
+///   how many bytes would be written.
+///
+/// @return Returns the number of bytes of records needed.
+static u64 _logBinaryDefineStrings(const LogBinaryMessage *binaryMessage,
+  LogWriteBuffer *writeBuffer
+) {
+  u64 keys[4] = {
+    0,
+    binaryMessage->formatString,
+    binaryMessage->fileName,
+    binaryMessage->functionName,
+  };
+  u64 numBytes = 0;
+  
+  for (int ii = 0; ii < 4; ii++) {
+    const char *string = (const char*) (uintptr_t) keys[ii];
+    if (ii == 0) {
+      if (_logBinaryStrings.count > 0) {
+        continue;
+      }
+      string = (_hostname != NULL) ? _hostname : "";
+    }
+    bool defined = (_logStringTableGet(&_logBinaryStrings, keys[ii]) != NULL);
+    for (int jj = 0; (defined == false) && (jj < ii); jj++) {
+      // When we're only counting, a key seen earlier in this message counts as
+      // defined.
+      defined = (writeBuffer == NULL) && (keys[jj] == keys[ii]);
+    }
+    if (defined == true) {
+      continue;
+    }
+    
+    u64 stringLength = (u64) strlen(string);
+    LogBinaryRecordHeader recordHeader;
+    recordHeader.magic = LOG_BINARY_RECORD_MAGIC;
+    recordHeader.type = LOG_BINARY_RECORD_STRING;
+    recordHeader.length = sizeof(keys[ii]) + stringLength;
+    numBytes += sizeof(recordHeader) + recordHeader.length;
+    if (writeBuffer != NULL) {
+      _logWriteBufferAdd(writeBuffer, &recordHeader, sizeof(recordHeader));
+      _logWriteBufferAdd(writeBuffer, &keys[ii], sizeof(keys[ii]));
+      _logWriteBufferAdd(writeBuffer, string, stringLength);
+      // If this fails, we'll just define the string again next time.
+      _logStringTableAdd(&_logBinaryStrings, keys[ii], string);
+    }
+  }
+  
+  return numBytes;
+}
+
+/// @fn static u64 _logMessageSize(const LogMessage *message, bool binaryLog)
+///
+/// @brief Compute the number of bytes writing a message to the log will take.
+///
+/// @param message The LogMessage to write.
+/// @param binaryLog Whether or not the log file is a binary log.
+///
+/// @return Returns the number of bytes needed.
+static u64 _logMessageSize(const LogMessage *message, bool binaryLog) {
+  if (message->binary == true) {
+    LogBinaryMessage binaryMessage;
+    memcpy(&binaryMessage,
+      (char*) message->buffer + sizeof(LogBinaryRecordHeader),
+      sizeof(binaryMessage));
+    return message->length + _logBinaryDefineStrings(&binaryMessage, NULL);
+  } else if (binaryLog == true) {
+    return sizeof(LogBinaryRecordHeader) + message->length;
+  }
+  
+  return message->length;
+}
+
+/// @fn static void _logMessageWrite(const LogMessage *message, bool binaryLog, LogWriteBuffer *writeBuffer)
+///
+/// @brief Write a message to the log in the log's format.
+///
+/// @param message The LogMessage to write.
+/// @param binaryLog Whether or not the log file is a binary log.  Text
+///   messages in a binary log are wrapped in LOG_BINARY_RECORD_TEXT records.
+/// @param writeBuffer The LogWriteBuffer to write to.
+///
+/// @return This function returns no value.
+static void _logMessageWrite(const LogMessage *message, bool binaryLog,
+  LogWriteBuffer *writeBuffer
+) {
+  if (message->binary == true) {
+    LogBinaryMessage binaryMessage;
+    memcpy(&binaryMessage,
+      (char*) message->buffer + sizeof(LogBinaryRecordHeader),
+      sizeof(binaryMessage));
+    _logBinaryDefineStrings(&binaryMessage, writeBuffer);
+  } else if (binaryLog == true) {
+    LogBinaryRecordHeader recordHeader;
+    recordHeader.magic = LOG_BINARY_RECORD_MAGIC;
+    recordHeader.type = LOG_BINARY_RECORD_TEXT;
+    recordHeader.length = message->length;
+    _logWriteBufferAdd(writeBuffer, &recordHeader, sizeof(recordHeader));
+  }
+  _logWriteBufferAdd(writeBuffer, message->buffer, message->length);
+}
+
+/// @fn static bool _logBinaryRead(const char **cur, const char *end, void *value, u64 length)
+///
+/// @brief Read a value out of a binary log record.
+///
+/// @param cur A pointer to the position to read from.  Advanced past the value.
+/// @param end The end of the record.
+/// @param value Where to copy the value to.
+/// @param length The number of bytes in the value.
+///
+/// @return Returns true on success, false if the record is too short.
+static bool _logBinaryRead(const char **cur, const char *end, void *value,
+  u64 length
+) {
+  if ((u64) (end - *cur) < length) {
+    return false;
+  }
+  memcpy(value, *cur, length);
+  *cur += length;
+  
+  return true;
+}
+
+/// @fn static int _logBinaryMessageRender(const char *record, u64 length, const LogStringTable *strings, const char *hostname, FILE *output)
+///
+/// @brief Render a LOG_BINARY_RECORD_MESSAGE record the way vprintLog would
+/// have.
+///
+/// @param record The contents of the record after its LogBinaryRecordHeader.
+/// @param length The number of bytes in record.
+/// @param strings The strings defined so far in the log.
+/// @param hostname The hostname defined for the log.
+/// @param output The FILE to write the rendered message to.
+///
+/// @return Returns 0 on success, -1 if the record is malformed or refers to a
+/// string that was never defined.
+static int _logBinaryMessageRender(const char *record, u64 length,
+  const LogStringTable *strings, const char *hostname, FILE *output
+) {
+  const char *cur = record;
+  const char *end = record + length;
+  LogBinaryMessage binaryMessage;
+  if (_logBinaryRead(&cur, end, &binaryMessage, sizeof(binaryMessage))
+    == false
+  ) {
+    return -1;
+  }
+  const char *formatString
+    = _logStringTableGet(strings, binaryMessage.formatString);
+  const char *fileName = _logStringTableGet(strings, binaryMessage.fileName);
+  const char *functionName
+    = _logStringTableGet(strings, binaryMessage.functionName);
+  if ((formatString == NULL) || (fileName == NULL) || (functionName == NULL)
+    || (binaryMessage.logLevel >= NUM_LOG_LEVELS)
+  ) {
+    return -1;
+  }
+  
+  if (binaryMessage.hasHeader != 0) {
+    struct timespec time;
+    time.tv_sec = (time_t) (binaryMessage.timestamp / 1000000000LL);
+    time.tv_nsec = (long) (binaryMessage.timestamp % 1000000000LL);
+    char *timestamp = getTimestamp(&time);
+    const char *slashAt = strrchr(fileName, '/');
+    if (slashAt == NULL) {
+      slashAt = strrchr(fileName, '\\');
+    }
+    if (slashAt != NULL) {
+      fileName = slashAt + 1;
+    }
+    fprintf(output, "[%s %s:%u.%llu %s:%s.%d %s] ", timestamp, hostname,
+      (unsigned int) binaryMessage.pid,
+      (long long unsigned int) binaryMessage.threadId,
+      fileName, functionName, (int) binaryMessage.lineNumber,
+      LogLevelName[binaryMessage.logLevel]);
+    timestamp = stringDestroy(timestamp);
+  }
+  
+  int returnValue = 0;
+  LogConversion conversion;
+  const char *formatAt = formatString;
+  while (_logNextConversion(formatAt, &conversion) != NULL) {
+    fwrite(formatAt, conversion.start - formatAt, 1, output);
+    formatAt = conversion.end;
+    
+    char specification[64];
+    u64 specificationLength = (u64) (conversion.end - conversion.start);
+    int stars[2] = { 0, 0 };
+    bool success = (specificationLength < sizeof(specification));
+    for (u8 ii = 0; (success == true) && (ii < conversion.numStars); ii++) {
+      i64 starValue = 0;
+      success = _logBinaryRead(&cur, end, &starValue, sizeof(starValue));
+      stars[ii] = (int) starValue;
+    }
+    if (success == false) {
+      returnValue = -1;
+      break;
+    }
+    memcpy(specification, conversion.start, specificationLength);
+    specification[specificationLength] = '\0';
+    
+    // Print one argument with however many star arguments come before it.
+    #define printArgument(value) \
+      ((conversion.numStars == 0) \
+        ? fprintf(output, specification, value) \
+        : (conversion.numStars == 1) \
+          ? fprintf(output, specification, stars[0], value) \
+          : fprintf(output, specification, stars[0], stars[1], value))
+    
+    i64 integer = 0;
+    switch (conversion.type) {
+      case LOG_ARGUMENT_NONE:
+        fputc('%', output);
+        continue;
+      case LOG_ARGUMENT_DOUBLE:
+        {
+          double value = 0.0;
+          success = _logBinaryRead(&cur, end, &value, sizeof(value));
+          if (success == true) {
+            printArgument(value);
+          }
+        }
+        break;
+      case LOG_ARGUMENT_LONG_DOUBLE:
+        {
+          long double value = 0.0;
+          success = _logBinaryRead(&cur, end, &value, sizeof(value));
+          if (success == true) {
+            printArgument(value);
+          }
+        }
+        break;
+      case LOG_ARGUMENT_STRING:
+        {
+          u64 stringLength = 0;
+          success = _logBinaryRead(&cur, end, &stringLength,
+            sizeof(stringLength));
+          if ((success == true) && (stringLength == (u64) -1)) {
+            printArgument("(null)");
+          } else if ((success == true)
+            && (stringLength <= (u64) (end - cur))
+          ) {
+            char *string = (char*) malloc(stringLength + 1);
+            if (string != NULL) {
+              memcpy(string, cur, stringLength);
+              string[stringLength] = '\0';
+              printArgument(string);
+              string = stringDestroy(string);
+            }
+            cur += stringLength;
+          } else {
+            success = false;
+          }
+        }
+        break;
+      case LOG_ARGUMENT_UNSUPPORTED:
+        // _logBinaryMessageCreate never produces these.
+        success = false;
+        break;
+      default:
+        success = _logBinaryRead(&cur, end, &integer, sizeof(integer));
+        if (success == false) {
+          break;
+        }
+        switch (conversion.type) {
+          case LOG_ARGUMENT_LONG:
+            printArgument((long) integer);
+            break;
+          case LOG_ARGUMENT_LONG_LONG:
+            printArgument((long long) integer);
+            break;
+          case LOG_ARGUMENT_INTMAX:
+            printArgument((intmax_t) integer);
+            break;
+          case LOG_ARGUMENT_SIZE:
+            printArgument((size_t) integer);
+            break;
+          case LOG_ARGUMENT_PTRDIFF:
+            printArgument((ptrdiff_t) integer);
+            break;
+          case LOG_ARGUMENT_POINTER:
+            printArgument((void*) (uintptr_t) integer);
+            break;
+          default:
+            printArgument((int) integer);
+            break;
+        }
+        break;
+    }
+    #undef printArgument
+    
+    if (success == false) {
+      returnValue = -1;
+      break;
+    }
   }
   
-  _loggingInitialized = false;
+  fputs(formatAt, output);
+  if ((*formatString == '\0')
+    || (formatString[strlen(formatString) - 1] != '\n')
+  ) {
+    fputc('\n', output);
+  }
   
-  return;
+  return returnValue;
 }
 
-/// @fn int setLogThreshold(LogLevel logLevel, const char *user)
+/// @fn int loggingDecodeBinaryLog(FILE *input, FILE *output)
 ///
-/// @brief This sets the log level threshold below which we will not print.
-/// The new log level is always echoed to the log file since the message is
-/// critical.
+/// @brief Render a log written with loggingSetBinaryMode(true) as the text log
+/// it would have been.
 ///
-/// @param logLevel is the new log level.
-/// @param user is the user who initiated the command.
+/// @param input The binary log to read.  Must be opened in binary mode.
+/// @param output The FILE to write the text log to.
 ///
-/// @return This function return 0 on success, -1 on failure.
-int setLogThreshold(LogLevel logLevel, const char *user) {
-  printLog(TRACE, "ENTER setLogThreshold(logLevel=\"%s\", user=\"%s\")\n",
-    (logLevel < NUM_LOG_LEVELS) ? LogLevelName[logLevel] : "INVALID", user);
+/// @return Returns 0 on success, -1 if the input is malformed or can't be
+/// read.
+///
+/// @note The input must come from the same architecture that wrote it.
+int loggingDecodeBinaryLog(FILE *input, FILE *output) {
+  int returnValue = 0;
+  LogStringTable strings = { NULL, 0, 0, true };
+  char *record = NULL;
   
-  if (logLevel >= NUM_LOG_LEVELS) {
-    printLog(ERR, "Invalid logLevel %d specified.\n", logLevel);
-    printLog(TRACE, "EXIT setLogThreshold(logLevel=INVALID, \"%s\") = {-1}\n",
-      user);
-    return -1;
+  LogBinaryRecordHeader recordHeader;
+  while (fread(&recordHeader, sizeof(recordHeader), 1, input) == 1) {
+    if ((recordHeader.magic != LOG_BINARY_RECORD_MAGIC)
+      || (recordHeader.length > (u64) SIZE_MAX - 1)
+    ) {
+      returnValue = -1;
+      break;
+    }
+    record = (char*) malloc(recordHeader.length + 1);
+    if ((record == NULL) || ((recordHeader.length > 0)
+      && (fread(record, recordHeader.length, 1, input) != 1))
+    ) {
+      returnValue = -1;
+      break;
+    }
+    
+    if (recordHeader.type == LOG_BINARY_RECORD_STRING) {
+      u64 key = 0;
+      const char *cur = record;
+      if (_logBinaryRead(&cur, record + recordHeader.length, &key,
+        sizeof(key)) == false
+      ) {
+        returnValue = -1;
+        break;
+      }
+      // Reuse the record as the string's storage.
+      u64 stringLength = recordHeader.length - sizeof(key);
+      memmove(record, cur, stringLength);
+      record[stringLength] = '\0';
+      if (_logStringTableAdd(&strings, key, record) == false) {
+        returnValue = -1;
+        break;
+      }
+      record = NULL;
+    } else if (recordHeader.type == LOG_BINARY_RECORD_MESSAGE) {
+      const char *hostname = _logStringTableGet(&strings, 0);
+      if (_logBinaryMessageRender(record, recordHeader.length, &strings,
+        (hostname != NULL) ? hostname : "", output) != 0
+      ) {
+        returnValue = -1;
+        break;
+      }
+    } else if (recordHeader.type == LOG_BINARY_RECORD_TEXT) {
+      fwrite(record, recordHeader.length, 1, output);
+    } else {
+      returnValue = -1;
+      break;
+    }
+    record = stringDestroy(record);
+  }
+  if (ferror(input)) {
+    returnValue = -1;
   }
   
-  const char *oldThreshold = LogLevelName[logThreshold];
-  logThreshold = logLevel;
-  printLog(CRITICAL, "%s has changed the log level from %s to %s\n", user,
-    oldThreshold, LogLevelName[logThreshold]);
-  (void) oldThreshold; // In case logging is disabled and printLog is compiled
-                       // out.
+  record = stringDestroy(record);
+  _logStringTableClear(&strings, true);
   
-  printLog(TRACE, "EXIT setLogThreshold(logLevel=\"%s\", \"%s\") = {0}\n",
-    LogLevelName[logLevel], user);
-  return 0;
+  return returnValue;
 }
 
-/// @fn char *getTimestamp(struct timespec *time)
+
+/// @fn static void _logCallbacksLock(void)
 ///
-/// @brief This function returns a timestamp in a standard format used.  Any
-/// functions that require a timestamp MUST call this function to get it.
+/// @brief Serialize calls to user-supplied logging callbacks if any are
+/// installed.  Messages themselves never need this lock.
 ///
-/// @param time A pointer to a struct timespec representing the time to make
-///   this timestamp for.  If NULL is provided, the current time will be used.
+/// @return This function returns no value.
+static inline void _logCallbacksLock(void) {
+  if (_serializeLogCallbacks == true) {
+    _logCallbacksLock();
+  }
+}
+
+/// @fn static void _logCallbacksUnlock(void)
 ///
-/// @return A timestamp representing the current time will be returned.
+/// @brief Release the lock taken by _logCallbacksLock, if any.
 ///
-/// @note This function is one of the few that does not print out ENTER and
-/// EXIT information to the log as that would create a situation of infinite
-/// recursion.
-char *getTimestamp(struct timespec *time) {
-  char *timestamp = NULL;
-  
-  // Timestamp variables
-  #define timestampSize 30
-  struct timespec now;
-  if (time == NULL) {
-    // This is the expected usual case, so optimize for that.
-    timespec_get(&now, TIME_UTC);
-  } else {
-    now = *time;
+/// @return This function returns no value.
+static inline void _logCallbacksUnlock(void) {
+  if (_serializeLogCallbacks == true) {
+    _logCallbacksUnlock();
   }
-  ZEROINIT(struct tm nowStruct);
-  gmtime_r(&now.tv_sec, &nowStruct);
-  
-  timestamp = (char*) malloc(timestampSize);
-  snprintf(timestamp, timestampSize, "%4d-%02d-%02d %02d:%02d:%02d.%09ld",
-    nowStruct.tm_year + 1900,
-    nowStruct.tm_mon + 1,
-    nowStruct.tm_mday,
-    nowStruct.tm_hour,
-    nowStruct.tm_min,
-    nowStruct.tm_sec,
-    (long) now.tv_nsec);
-  
-  #undef timestampSize
-  return timestamp;
 }
 
-/// @fn char *loggingHeaderGenerator(LogLevel logLevel, const char *fileName, const char *functionName, int lineNumber)
+/// @fn static void _logWakeWriter(void)
 ///
-/// @brief Creates a header for a log entry in the form:<br />
-/// "[YYYY-MM-DD HH:MM:SS.NNNNNNNNN HostInfo Module LogLevel] "<br />
-/// Module will be constructed from the fileName, functionName, and lineNumber
+/// @brief Wake the logging thread if it's waiting for messages.  When it's
+/// busy, this costs nothing but a load.
 ///
-/// @param logLevel is the LogLevel the message was logged with
-/// @param fileName is the name of the file the header is for
-/// @param functionName is the name of the function the header is for
-/// @param lineNumber is the line number the header is for
+/// @return This function returns no value.
+static void _logWakeWriter(void) {
+  if (_loggingWriterSleeping == true) {
+    mtx_lock(&_writeMessagesMutex);
+    cnd_signal(&_writeMessagesCondition);
+    mtx_unlock(&_writeMessagesMutex);
+  }
+}
+
+/// @fn static LogThreadBuffer* _logThreadBufferGet(void)
 ///
-/// @return Returns a newly-allocated string containing the log header.
+/// @brief Get the calling thread's LogThreadBuffer, creating and registering
+/// it on the thread's first message.
 ///
-/// @note This function is one of the few that does not print out ENTER and
-///       EXIT information to the log as that would create a situation of
-///       infinite recursion.
-char *loggingHeaderGenerator(LogLevel logLevel, const char *fileName,
-  const char *functionName, int lineNumber
-) {
-  char *logHeader = NULL;
-  
-  // Timestamp variables
-  char *timestamp = NULL;
-  timestamp = getTimestamp(NULL);
+/// @return Returns the calling thread's LogThreadBuffer on success, NULL on
+/// failure.
+static LogThreadBuffer* _logThreadBufferGet(void) {
+  LogThreadBuffer *threadBuffer
+    = (LogThreadBuffer*) tss_get(_logThreadBufferKey);
+  if (threadBuffer != NULL) {
+    // This is the expected case.
+    return threadBuffer;
+  }
   
-  const char *slashAt = strrchr(fileName, '/');
-  if (slashAt == NULL) {
-    slashAt = strrchr(fileName, '\\');
+  threadBuffer = (LogThreadBuffer*) calloc(1, sizeof(LogThreadBuffer));
+  if (threadBuffer == NULL) {
+    return NULL;
   }
-  if (slashAt != NULL) {
-    fileName = slashAt + 1;
+  threadBuffer->queue = ringQueueCreate(typePointerNoCopy,
+    LOG_QUEUE_CAPACITY, RING_QUEUE_SPSC);
+  if (threadBuffer->queue == NULL) {
+    threadBuffer = (LogThreadBuffer*) pointerDestroy(threadBuffer);
+    return NULL;
   }
   
-  u64 threadId = loggingGetThreadId();
-  u32 pid = 0;
-  pid = (u32) getpid();
-  
-  // "[YYYY-MM-DD HH:MM:SS.NNNNNNNNN HostInfo Module LogLevel] "
-  // HostInfo = hostname:pid.thread
-  // We may have forked since loggingStart was called, so have to call getpid
-  // every time.  We can assume we're running on the same host, though.
-  // Module = fileName:functionName.lineNumber
-  if (asprintf(&logHeader, "[%s %s:%u.%llu %s:%s.%d %s] ", timestamp,
-    _hostname, (unsigned int) pid, (long long unsigned int) threadId,
-    fileName, functionName, lineNumber,
-    LogLevelName[logLevel]) < 0
-  ) {
-    // Do nothing.  We can't log an error.  logHeader will be NULL.  This is
-    // just here to make the complier happy.
-  }
-  timestamp = stringDestroy(timestamp);
+  mtx_lock(&_logThreadBuffersMutex);
+  threadBuffer->next = _logThreadBuffers;
+  _logThreadBuffers = threadBuffer;
+  mtx_unlock(&_logThreadBuffersMutex);
+  tss_set(_logThreadBufferKey, threadBuffer);
   
-  return logHeader;
+  return threadBuffer;
 }
 
-/// @fn int _rolloverLog(void)
+/// @fn static void _logQueuePush(LogMessage *message)
 ///
-/// @brief Check to see if we need to roll over the log into an arhive log and
-///   start a new one if so.
+/// @brief Hand a message off to the logging thread through the calling
+/// thread's own buffer.  If the buffer is full, wake the logging thread and
+/// wait for it to make room.
 ///
-/// @return Returns 0 on success, -1 on failure.
-int _rolloverLog(void) {
-  if ((exitNow == false) && (logFile != NULL)
-    && (logFile != DEBUG_LOGFILE_POINTER)
-    && (_logFilename != NULL) && (*_logFilename != '\0')
+/// @param message The LogMessage to queue.  The logging thread takes ownership
+///   of it.  If logging stops before there's room, the message is dropped and
+///   freed.
+///
+/// @return This function returns no value.
+static void _logQueuePush(LogMessage *message) {
+  LogThreadBuffer *threadBuffer = _logThreadBufferGet();
+  while ((threadBuffer == NULL)
+    || (ringQueuePush(threadBuffer->queue, message) == false)
   ) {
-    int logSize = 0;
-    logSize = ftell(logFile);
-    if (logSize >= LOG_ROLLOVER_SIZE) {
-      FILE *_logFile = logFile;
-      // Change the globl logFile in case any non-LoggingLib calls try to write
-      // to it whiile we're rolling over.
-      logFile = stderr;
-      
-      char *timestamp = NULL;
-      timestamp = getTimestamp(NULL);
-      char *archiveLogFilename = NULL;
-      straddstr(&archiveLogFilename, _logFilename);
-      // timestamp format = "YYYY-MM-DD HH:MM:SS.NNNNNNNNN "
-      //                     0123456789012345678901234567890
-      // We can't use ':' in a file name, and let's not use ' ' or '.' either.
-      timestamp[10] = '_';
-      timestamp[13] = '-';
-      timestamp[16] = '-';
-      timestamp[19] = '-';
-      timestamp[29] = '\0';
-      straddstr(&archiveLogFilename, "_");
-      straddstr(&archiveLogFilename, timestamp);
-      timestamp = stringDestroy(timestamp);
-      Bytes fileContent = NULL;
-      fileContent = getFileContent(_logFilename);
-      putFileContent(archiveLogFilename, fileContent, bytesLength(fileContent));
-      fileContent = bytesDestroy(fileContent);
-      archiveLogFilename = stringDestroy(archiveLogFilename);
-      if (ftruncate(fileno(_logFile), 0) != 0) {
-        // Do nothing.  We can't log an error here.  Also, if we can't
-        // truncate the file, we don't lose data, so we don't care.  This
-        // check is just here to make the compiler happy.
-      }
-      
-      // Reset the logFile.
-      logFile = _logFile;
+    if ((threadBuffer == NULL) || (_runLoggingQueueFunction == false)) {
+      message->buffer = pointerDestroy(message->buffer);
+      message = (LogMessage*) pointerDestroy(message);
+      return;
     }
+    mtx_lock(&_writeMessagesMutex);
+    cnd_signal(&_writeMessagesCondition);
+    mtx_unlock(&_writeMessagesMutex);
+    thrd_yield();
   }
+  _logWakeWriter();
   
-  return 0;
+  return;
 }
 
-/// @struct LogMessage
+/// @fn static u64 _logMessagesPending(void)
 ///
-/// @brief Structure for containing all the information needed to log a message
-/// to the log file.  Messages printed to the log file may be ASCII or binary,
-/// so we have to have a pointer and a length rather than a string.
+/// @brief Count the messages waiting in all threads' buffers.
 ///
-/// @param buffer A pointer to the contnets to print to the log file.
-/// @param length The number of bytes pointed to by the buffer pointer.
-typedef struct LogMessage {
-  void *buffer;
-  size_t length;
-} LogMessage;
+/// @return Returns the number of messages that the logging thread has yet to
+/// pop.
+static u64 _logMessagesPending(void) {
+  u64 numPending = 0;
+  
+  mtx_lock(&_logThreadBuffersMutex);
+  for (LogThreadBuffer *cur = _logThreadBuffers; cur != NULL; cur = cur->next) {
+    numPending += ringQueueLength(cur->queue);
+  }
+  mtx_unlock(&_logThreadBuffersMutex);
+  
+  return numPending;
+}
 
 /// @fn void loggingFlush()
 ///
@@ -520,15 +2121,113 @@ typedef struct LogMessage {
 ///
 /// @return This function returns no value.
 void loggingFlush() {
-  while ((_runLoggingQueueFunction == true) && (_logQueue->size > 0));
+  while ((_runLoggingQueueFunction == true) && (_logMessagesPending() > 0)) {
+    thrd_yield();
+  }
+  
+  // The last messages may have been popped but not yet written.  Once the
+  // logging thread has finished a pass that began after they were popped,
+  // they're in the file.
+  u64 passes = _loggingWriterPasses;
+  while ((_runLoggingQueueFunction == true)
+    && (_loggingWriterPasses - passes < 2)
+  ) {
+    _logWakeWriter();
+    thrd_yield();
+  }
   
   return;
 }
 
+/// @fn static u64 _logDrainThreadBuffers(LogWriteBuffer *writeBuffer)
+///
+/// @brief Pop every queued message from every thread's buffer and write them to
+/// the log, coalescing small messages into writeBuffer so that many messages
+/// go out in each fwrite.  Frees the buffers of threads that have exited once
+/// they're empty.
+///
+/// @param writeBuffer The LogWriteBuffer to coalesce messages in.
+///
+/// @return Returns the number of messages written.
+static u64 _logDrainThreadBuffers(LogWriteBuffer *writeBuffer) {
+  u64 numMessages = 0;
+  bool binaryLog = _logBinaryActive();
+  
+  // Producers only ever add buffers at the head and only we remove them, so
+  // once we have the head we can walk the list without the lock.
+  mtx_lock(&_logThreadBuffersMutex);
+  LogThreadBuffer *threadBuffer = _logThreadBuffers;
+  mtx_unlock(&_logThreadBuffersMutex);
+  
+  LogThreadBuffer *prev = NULL;
+  while (threadBuffer != NULL) {
+    mtx_lock(&_logThreadBuffersMutex);
+    bool abandoned = threadBuffer->abandoned;
+    mtx_unlock(&_logThreadBuffersMutex);
+    
+    LogMessage *message = NULL;
+    while ((message = (LogMessage*) ringQueuePop(threadBuffer->queue))
+      != NULL
+    ) {
+      if ((message->buffer != NULL) && (message->length > 0)) {
+        u64 messageSize = _logMessageSize(message, binaryLog);
+        if (writeBuffer->length + messageSize > writeBuffer->size) {
+          // Only roll over between messages with nothing buffered so that a
+          // binary message never lands in a different file than the strings
+          // it refers to.
+          _logWriteBufferFlush(writeBuffer);
+          _rolloverLog();
+          messageSize = _logMessageSize(message, binaryLog);
+        }
+        writeBuffer->direct = (messageSize > writeBuffer->size);
+        _logMessageWrite(message, binaryLog, writeBuffer);
+        if (writeBuffer->direct == true) {
+          writeBuffer->direct = false;
+          _rolloverLog();
+        }
+      }
+      message->buffer = pointerDestroy(message->buffer);
+      message = (LogMessage*) pointerDestroy(message);
+      numMessages++;
+    }
+    
+    LogThreadBuffer *next = threadBuffer->next;
+    if (abandoned == true) {
+      // The owning thread is gone and we've popped everything it pushed.
+      mtx_lock(&_logThreadBuffersMutex);
+      if (prev == NULL) {
+        // New buffers may have been added in front of this one since we took
+        // the head.
+        LogThreadBuffer **link = &_logThreadBuffers;
+        while (*link != threadBuffer) {
+          link = &(*link)->next;
+        }
+        *link = next;
+      } else {
+        prev->next = next;
+      }
+      mtx_unlock(&_logThreadBuffersMutex);
+      threadBuffer->queue = ringQueueDestroy(threadBuffer->queue);
+      threadBuffer = (LogThreadBuffer*) pointerDestroy(threadBuffer);
+    } else {
+      prev = threadBuffer;
+    }
+    threadBuffer = next;
+  }
+  
+  if (writeBuffer->length > 0) {
+    _logWriteBufferFlush(writeBuffer);
+    _rolloverLog();
+  }
+  _loggingWriterPasses++;
+  
+  return numMessages;
+}
+
 /// @fn int _loggingQueueFunction(void *args)
 ///
-/// @brief Thread function for popping the _logQueue and printing to the log
-/// file.
+/// @brief Thread function for draining the threads' log buffers and printing
+/// to the log file.
 ///
 /// args Parameter supplied for compatibility with C threads function pointer
 ///   prototype.  Ignored by this function.
@@ -536,46 +2235,52 @@ void loggingFlush() {
 /// @return This function always returns 0.
 int _loggingQueueFunction(void *args) {
   (void) args;
-  LogMessage *message = NULL;
-  void *buffer = NULL;
-  size_t length = 0;
   
   // Prevent this thread from generating any logging messages.
   bool logLock = tryLockResource(loggingForbidden);
   
-  // Pop and print for as long as _runLoggingQueueFunction is true.
-  while ((_runLoggingQueueFunction == true) || (_logQueue->size > 0)) {
-    message = (LogMessage*) queuePop(_logQueue);
-    while (message != NULL) {
-      // Print the message and flush the buffer.
-      buffer = message->buffer;
-      length = message->length;
-      if (buffer != NULL) {
-        fwrite(buffer, length, 1, _fileToWriteTo);
-      }
-      
-      buffer = pointerDestroy(buffer);
-      message = (LogMessage*) pointerDestroy(message);
-      length = 0;
-      
-      _rolloverLog();
-      message = (LogMessage*) queuePop(_logQueue);
+  LogWriteBuffer writeBuffer = { NULL, 0, 0, false };
+  writeBuffer.data = (char*) malloc(LOG_WRITE_BUFFER_SIZE);
+  writeBuffer.size = (writeBuffer.data != NULL) ? LOG_WRITE_BUFFER_SIZE : 0;
+  
+  // Drain and print for as long as _runLoggingQueueFunction is true, then
+  // once more to pick up anything queued while we were stopping.
+  while (1) {
+    bool running = _runLoggingQueueFunction;
+    if (_logDrainThreadBuffers(&writeBuffer) > 0) {
+      fflush(_fileToWriteTo);
+      continue;
+    } else if (running == false) {
+      break;
     }
-    fflush(_fileToWriteTo);
+    
+    // Nothing to do.  Wait to be signaled before checking again.  Producers
+    // don't take the mutex to push, so a wakeup can slip in between our last
+    // check and the wait.  The timeout bounds how long such a message waits.
+    mtx_lock(&_writeMessagesMutex);
+    _loggingWriterSleeping = true;
     if (_runLoggingQueueFunction == true) {
-      // Wait to be signaled before checking again.
-      mtx_lock(&_writeMessagesMutex);
-      if (cnd_wait(&_writeMessagesCondition, &_writeMessagesMutex)
-        != thrd_success
+      struct timespec timeout;
+      timespec_get(&timeout, TIME_UTC);
+      timeout.tv_nsec += LOG_WRITER_IDLE_WAIT_MS * 1000000L;
+      if (timeout.tv_nsec >= 1000000000L) {
+        timeout.tv_sec++;
+        timeout.tv_nsec -= 1000000000L;
+      }
+      if (cnd_timedwait(&_writeMessagesCondition, &_writeMessagesMutex,
+        &timeout) == thrd_error
       ) {
         // Something's wrong with the condition.  Bail.
+        _loggingWriterSleeping = false;
         mtx_unlock(&_writeMessagesMutex);
         break;
       }
-      mtx_unlock(&_writeMessagesMutex);
     }
+    _loggingWriterSleeping = false;
+    mtx_unlock(&_writeMessagesMutex);
   }
   
+  writeBuffer.data = (char*) pointerDestroy(writeBuffer.data);
   if (logLock) {
     unlockResource(loggingForbidden);
   }
@@ -634,9 +2339,24 @@ int vprintLog(const char *fileName, const char *functionName, int lineNumber,
   // Disable logging for other functions on THIS thread while we're trying
   // to print.
   logLock = tryLockResource(loggingForbidden);
+  if ((logLock == true) && (_runLoggingQueueFunction == true)
+    && (_logBinaryActive() == true)
+  ) {
+    // Defer all the formatting to loggingDecodeBinaryLog.
+    va_copy(args2, args);
+    LogMessage *message = _logBinaryMessageCreate(fileName, functionName,
+      lineNumber, logLevel, formatString, args2);
+    va_end(args2);
+    if (message != NULL) {
+      _logQueuePush(message);
+      unlockResource(loggingForbidden);
+      return returnValue;
+    }
+    // The format string can't be deferred.  Log it as text.
+  }
   if (logLock == true) {
     char *logString = NULL;
-    mtx_lock(&_headerMessageMutex);
+    _logCallbacksLock();
     if (_makeLogHeader != NULL) {
       logString = _makeLogHeader(logLevel, (char*) fileName,
       (char*) functionName, lineNumber);
@@ -646,6 +2366,7 @@ int vprintLog(const char *fileName, const char *functionName, int lineNumber,
     straddstr(&logString, formatString);
     if (logString == NULL) {
       // Memory allocation failure.  Bail.
+      _logCallbacksUnlock();
       unlockResource(loggingForbidden);
       LOG_MALLOC_FAILURE();
       return -1;
@@ -664,6 +2385,7 @@ int vprintLog(const char *fileName, const char *functionName, int lineNumber,
     
     if ((length <= 0) || (buffer == NULL)) {
       // Memory allocation failure.  Bail.
+      _logCallbacksUnlock();
       logString = stringDestroy(logString);
       unlockResource(loggingForbidden);
       LOG_MALLOC_FAILURE();
@@ -695,13 +2417,11 @@ int vprintLog(const char *fileName, const char *functionName, int lineNumber,
     if ((_runLoggingQueueFunction == true) && (message != NULL)) {
       message->buffer = buffer;
       message->length = length;
-      queuePushEntry(_logQueue, message);
-      mtx_unlock(&_headerMessageMutex);
-      mtx_lock(&_writeMessagesMutex);
-      cnd_signal(&_writeMessagesCondition);
-      mtx_unlock(&_writeMessagesMutex);
+      message->binary = false;
+      _logQueuePush(message);
+      _logCallbacksUnlock();
     } else {
-      mtx_unlock(&_headerMessageMutex);
+      _logCallbacksUnlock();
       // buffer didn't get queued, so won't be freed by
       // _loggingQueueFunction.  Free it here.
       buffer = stringDestroy(buffer);
@@ -827,7 +2547,7 @@ int printBinary_(const char *fileName, const char *functionName, int lineNumber,
   if (logLock == true) {
     char *logString = NULL;
     u64 length = 0;
-    mtx_lock(&_headerMessageMutex);
+    _logCallbacksLock();
     if (_makeLogHeader != NULL) {
       logString = _makeLogHeader(logLevel, (char*) fileName,
       (char*) functionName, lineNumber);
@@ -862,13 +2582,11 @@ int printBinary_(const char *fileName, const char *functionName, int lineNumber,
     if ((_runLoggingQueueFunction == true) && (message != NULL)) {
       message->buffer = logString;
       message->length = length;
-      queuePushEntry(_logQueue, message);
-      mtx_unlock(&_headerMessageMutex);
-      mtx_lock(&_writeMessagesMutex);
-      cnd_signal(&_writeMessagesCondition);
-      mtx_unlock(&_writeMessagesMutex);
+      message->binary = false;
+      _logQueuePush(message);
+      _logCallbacksUnlock();
     } else {
-      mtx_unlock(&_headerMessageMutex);
+      _logCallbacksUnlock();
       // logString didn't get queued, so won't be freed by
       // _loggingQueueFunction.  Free it here.
       logString = stringDestroy(logString);
@@ -1020,7 +2738,7 @@ int vprintBox(const char *fileName, const char *functionName, int lineNumber,
     // to print.
     logLock = tryLockResource(loggingForbidden);
     if (logLock == true) {
-      mtx_lock(&_headerMessageMutex);
+      _logCallbacksLock();
       if (_encryptLogMessage != NULL) {
         if (_userPlaintextLogHandler != NULL) {
           // The user wants to log the plaintext message.  Do it.
@@ -1046,13 +2764,11 @@ int vprintBox(const char *fileName, const char *functionName, int lineNumber,
       if ((_runLoggingQueueFunction == true) && (message != NULL)) {
         message->buffer = buffer;
         message->length = length;
-        queuePushEntry(_logQueue, message);
-        mtx_unlock(&_headerMessageMutex);
-        mtx_lock(&_writeMessagesMutex);
-        cnd_signal(&_writeMessagesCondition);
-        mtx_unlock(&_writeMessagesMutex);
+        message->binary = false;
+        _logQueuePush(message);
+        _logCallbacksUnlock();
       } else {
-        mtx_unlock(&_headerMessageMutex);
+        _logCallbacksUnlock();
         // buffer didn't get queued, so won't be freed by
         // _loggingQueueFunction.  Free it here.
         buffer = stringDestroy(buffer);
@@ -1202,7 +2918,7 @@ int vprintBanner(const char *fileName, const char *functionName, int lineNumber,
       bufferSize++;
       char *logHeader = NULL;
       int logHeaderLength = 0;
-      mtx_lock(&_headerMessageMutex);
+      _logCallbacksLock();
       if (_makeLogHeader != NULL) {
         logHeader = _makeLogHeader(logLevel, (char*)fileName,
           (char*)functionName, lineNumber);
@@ -1214,7 +2930,7 @@ int vprintBanner(const char *fileName, const char *functionName, int lineNumber,
       if (printString == NULL) {
         // Memory allocation failure.  Bail.
         logHeader = stringDestroy(logHeader);
-        mtx_unlock(&_headerMessageMutex);
+        _logCallbacksUnlock();
         unlockResource(loggingForbidden);
         LOG_MALLOC_FAILURE();
         return -1;
@@ -1236,7 +2952,7 @@ int vprintBanner(const char *fileName, const char *functionName, int lineNumber,
         // Memory allocation failure.  Bail.
         printString = stringDestroy(printString);
         logHeader = stringDestroy(logHeader);
-        mtx_unlock(&_headerMessageMutex);
+        _logCallbacksUnlock();
         unlockResource(loggingForbidden);
         LOG_MALLOC_FAILURE();
         return -1;
@@ -1291,7 +3007,7 @@ int vprintBanner(const char *fileName, const char *functionName, int lineNumber,
         // Memory allocation failure.  Bail.
         printString = stringDestroy(printString);
         logHeader = stringDestroy(logHeader);
-        mtx_unlock(&_headerMessageMutex);
+        _logCallbacksUnlock();
         unlockResource(loggingForbidden);
         LOG_MALLOC_FAILURE();
         return -1;
@@ -1322,10 +3038,8 @@ int vprintBanner(const char *fileName, const char *functionName, int lineNumber,
       if ((_runLoggingQueueFunction == true) && (message != NULL)) {
         message->buffer = buffer;
         message->length = length;
-        queuePushEntry(_logQueue, message);
-        mtx_lock(&_writeMessagesMutex);
-        cnd_signal(&_writeMessagesCondition);
-        mtx_unlock(&_writeMessagesMutex);
+        message->binary = false;
+        _logQueuePush(message);
       } else {
         // buffer was not queued and so won't be freed by
         // _loggingQueueFunction.  Free it here.
@@ -1337,7 +3051,7 @@ int vprintBanner(const char *fileName, const char *functionName, int lineNumber,
       printString = stringDestroy(printString);
       logHeader = stringDestroy(logHeader);
       
-      mtx_unlock(&_headerMessageMutex);
+      _logCallbacksUnlock();
     } else {
       returnValue = bufferSize;
     }
@@ -1899,12 +3613,25 @@ void* calloc(size_t nmemb, size_t size) {
   returnValue = (char*) realCalloc(1, totalSize + sizeof(MemNode));
   if (returnValue != NULL) {
     returnValue += sizeof(MemNode);
-    memNode(returnValue)->size = size;
+    memNode(returnValue)->size = totalSize;
   }
   return returnValue;
 }
 void* (*localCalloc)(size_t nmemb, size_t size) = calloc;
 
+/// @fn size_t mallocSize(void *ptr)
+///
+/// @brief Get the number of bytes requested for a block of memory returned by
+/// malloc, calloc, or realloc.
+///
+/// @param ptr A pointer returned by one of the memory allocation functions.
+///   May be NULL.
+///
+/// @return Returns the size of the block, 0 if ptr is NULL.
+size_t mallocSize(void *ptr) {
+  return sizeOfMemory(ptr);
+}
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
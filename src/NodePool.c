@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+//                     Copyright (c) 2012-2024 James Card                     //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included    //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+//                                                                            //
+//                                 James Card                                 //
+//                          http://www.jamescard.org                          //
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+// Doxygen marker
+/// @file
+
+#ifdef DS_LOGGING_ENABLED
+#include "LoggingLib.h"
+#else
+#undef printLog
+#define printLog(...) {}
+#define logFile stderr
+#define LOG_MALLOC_FAILURE(...) {}
+#endif
+
+#include <stdlib.h>
+
+#include "NodePool.h"
+
+/// @fn NodePool* nodePoolCreate(size_t nodeSize)
+///
+/// @brief Create a NodePool for nodes of the given size.  No memory for nodes
+/// is allocated until the first call to nodePoolAlloc.
+///
+/// @param nodeSize The size of the nodes the pool will hand out.
+/// @param subsystem The AllocatorSubsystem to count the pool's memory against.
+/// @param type The TypeDescriptor to count the pool's memory against.  May be
+///   NULL.
+///
+/// @return Returns a new NodePool on success, NULL on failure.
+NodePool* nodePoolCreate(size_t nodeSize, AllocatorSubsystem subsystem,
+  const struct TypeDescriptor *type
+) {
+  printLog(TRACE, "ENTER nodePoolCreate(nodeSize=%zu)\n", nodeSize);
+  
+  NodePool *nodePool = NULL;
+  if (nodeSize == 0) {
+    printLog(ERR, "nodeSize is 0.\n");
+    printLog(TRACE, "EXIT nodePoolCreate(nodeSize=%zu) = {%p}\n",
+      nodeSize, nodePool);
+    return nodePool; // NULL
+  }
+  
+  nodePool = (NodePool*) allocatorCalloc(subsystem, type, 1, sizeof(NodePool));
+  if (nodePool == NULL) {
+    LOG_MALLOC_FAILURE();
+    printLog(TRACE, "EXIT nodePoolCreate(nodeSize=%zu) = {%p}\n",
+      nodeSize, nodePool);
+    return nodePool; // NULL
+  }
+  
+  // Every node has to be able to hold the free list pointer and has to keep
+  // the node after it aligned.
+  nodePool->nodeSize
+    = (nodeSize + sizeof(void*) - 1) & ~((size_t) sizeof(void*) - 1);
+  nodePool->nextSlabNodes = NODE_POOL_MIN_SLAB_NODES;
+  nodePool->subsystem = subsystem;
+  nodePool->type = type;
+  
+  printLog(TRACE, "EXIT nodePoolCreate(nodeSize=%zu) = {%p}\n",
+    nodeSize, nodePool);
+  return nodePool;
+}
+
+/// @fn void* nodePoolAlloc(NodePool *nodePool, size_t size)
+///
+/// @brief Get a node from a NodePool.  The most recently released node is
+/// reused first since it's the most likely to still be in cache.  Failing
+/// that, nodes are handed out in address order from the newest slab.
+///
+/// @param nodePool The NodePool to allocate from.  If this is NULL, the node
+///   comes from allocatorMalloc instead.
+/// @param size The size of the node.  This is only used when nodePool is NULL
+///   and must not be more than the pool's node size otherwise.
+///
+/// @return Returns a pointer to uninitialized memory for the node on success,
+/// NULL on failure.
+void* nodePoolAlloc(NodePool *nodePool, size_t size) {
+  if (nodePool == NULL) {
+    return allocatorMalloc(ALLOCATOR_OTHER, NULL, size);
+  }
+  
+  void *node = nodePool->freeList;
+  if (node != NULL) {
+    nodePool->freeList = *((void**) node);
+    return node;
+  }
+  
+  if (nodePool->nextNode == nodePool->slabEnd) {
+    u64 numNodes = nodePool->nextSlabNodes;
+    NodePoolSlab *slab = (NodePoolSlab*) allocatorMalloc(
+      nodePool->subsystem, nodePool->type,
+      sizeof(NodePoolSlab) + (numNodes * nodePool->nodeSize));
+    if (slab == NULL) {
+      LOG_MALLOC_FAILURE();
+      return NULL;
+    }
+    slab->next = nodePool->slabs;
+    slab->numNodes = numNodes;
+    nodePool->slabs = slab;
+    nodePool->nextNode = (char*) (slab + 1);
+    nodePool->slabEnd = nodePool->nextNode + (numNodes * nodePool->nodeSize);
+    if (numNodes < NODE_POOL_MAX_SLAB_NODES) {
+      nodePool->nextSlabNodes = numNodes << 1;
+    }
+  }
+  
+  node = nodePool->nextNode;
+  nodePool->nextNode += nodePool->nodeSize;
+  return node;
+}
+
+/// @fn void* nodePoolFree(NodePool *nodePool, void *node)
+///
+/// @brief Release a node back to the NodePool it came from.  The memory stays
+/// with the pool until the pool is destroyed.
+///
+/// @param nodePool The NodePool the node was allocated from.  If this is
+///   NULL, the node is passed to allocatorFree instead.
+/// @param node The node to release.  May be NULL.
+///
+/// @return Always returns NULL.
+void* nodePoolFree(NodePool *nodePool, void *node) {
+  if (nodePool == NULL) {
+    allocatorFree(ALLOCATOR_OTHER, NULL, node);
+  } else if (node != NULL) {
+    *((void**) node) = nodePool->freeList;
+    nodePool->freeList = node;
+  }
+  
+  return NULL;
+}
+
+/// @fn NodePool* nodePoolDestroy(NodePool *nodePool)
+///
+/// @brief Free a NodePool and all of its slabs.  Every node the pool has
+/// handed out becomes invalid.
+///
+/// @param nodePool The NodePool to destroy.  May be NULL.
+///
+/// @return Always returns NULL.
+NodePool* nodePoolDestroy(NodePool *nodePool) {
+  printLog(TRACE, "ENTER nodePoolDestroy(nodePool=%p)\n", nodePool);
+  
+  if (nodePool != NULL) {
+    NodePoolSlab *slab = nodePool->slabs;
+    while (slab != NULL) {
+      NodePoolSlab *next = slab->next;
+      allocatorFree(nodePool->subsystem, nodePool->type, slab);
+      slab = next;
+    }
+    allocatorFree(nodePool->subsystem, nodePool->type, nodePool);
+  }
+  
+  printLog(TRACE, "EXIT nodePoolDestroy(nodePool=%p) = {NULL}\n", nodePool);
+  return NULL;
+}
+
+/// @fn u64 nodePoolMemoryBytes(const NodePool *nodePool)
+///
+/// @brief Get the amount of memory a NodePool holds, including nodes that are
+/// on its free list or have never been handed out.
+///
+/// @param nodePool The NodePool of interest.  May be NULL.
+///
+/// @return Returns the number of bytes allocated for the pool and its slabs,
+/// 0 if nodePool is NULL.
+u64 nodePoolMemoryBytes(const NodePool *nodePool) {
+  if (nodePool == NULL) {
+    return 0;
+  }
+  
+  u64 memoryBytes = sizeof(NodePool);
+  for (NodePoolSlab *slab = nodePool->slabs; slab != NULL; slab = slab->next) {
+    memoryBytes += sizeof(NodePoolSlab) + (slab->numNodes * nodePool->nodeSize);
+  }
+  
+  return memoryBytes;
+}
+
@@ -0,0 +1,1409 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              PersistentTree.c
+///
+/// @brief             This library contains the implementation of a
+///                    persistent, copy-on-write balanced tree whose readers
+///                    take consistent snapshots without locks.
+///
+/// @details           The balancing is Sedgewick's left-leaning red-black
+///                    tree, which needs no parent pointers and does all of
+///                    its work on the way down to and back up from the node
+///                    being changed.  That makes path copying simple:  Every
+///                    function that modifies a node first passes it through
+///                    ptreeMutable, which returns the node itself if the
+///                    current write created it and a copy otherwise.  Each
+///                    node is copied at most once per write, and the copies
+///                    are all on or next to the path that was searched.
+///
+///                    Since a write can't be rolled back once it has started
+///                    copying, the nodes it may need are allocated before it
+///                    starts and the write itself never allocates.  The keys
+///                    and values a write makes unreachable are handed to
+///                    spare nodes so that they can be retired and freed with
+///                    the same lists as the nodes.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+// Doxygen marker
+/// @file
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "PersistentTree.h"
+#include "RedBlackTree.h"
+#include "LoggingLib.h"
+#include "StringLib.h"
+#include "LockStats.h"
+
+/// @fn static inline bool ptreeIsRed(const PersistentTreeNode *node)
+///
+/// @brief Determine whether the link to a node is red.
+///
+/// @param node A node or NULL.
+///
+/// @return Returns true if node is non-NULL and red, false otherwise.
+static inline bool ptreeIsRed(const PersistentTreeNode *node) {
+  return (node != NULL) && (node->red);
+}
+
+/// @fn static inline u64 ptreeNodeSize(const PersistentTreeNode *node)
+///
+/// @brief Get the number of nodes in a subtree.
+///
+/// @param node The root of the subtree or NULL.
+///
+/// @return Returns the number of nodes in the subtree.
+static inline u64 ptreeNodeSize(const PersistentTreeNode *node) {
+  return (node != NULL) ? node->size : 0;
+}
+
+/// @fn static i64 ptreeReadBegin(PersistentTree *tree)
+///
+/// @brief Enter a read section of a persistent tree.  No node that is
+/// reachable from the tree's root when the section begins is freed until the
+/// section ends.
+///
+/// @param tree A pointer to a previously-allocated PersistentTree.
+///
+/// @return Returns a token that must be passed to ptreeReadEnd.
+static i64 ptreeReadBegin(PersistentTree *tree) {
+  // Spread the readers across the counters by their stack address, which is
+  // distinct for every thread and coroutine.
+  i64 token = 0;
+  u64 stripe = ((((u64) (uintptr_t) &token) >> 12)
+    * 0x9E3779B97F4A7C15ULL) >> 32;
+  stripe &= (PERSISTENT_TREE_READER_STRIPES - 1);
+  volatile i64 *count = tree->readers[stripe].count;
+
+  while (1) {
+    i64 epoch = __atomic_load_n(&tree->epoch, __ATOMIC_SEQ_CST);
+    __atomic_add_fetch(&count[epoch & 1], 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&tree->epoch, __ATOMIC_SEQ_CST) == epoch) {
+      token = (i64) ((stripe << 1) | (u64) (epoch & 1));
+      break;
+    }
+    // The epoch advanced before we were counted, so the writer may not have
+    // seen us.  Try again in the new epoch.
+    __atomic_sub_fetch(&count[epoch & 1], 1, __ATOMIC_SEQ_CST);
+  }
+
+  return token;
+}
+
+/// @fn static void ptreeReadEnd(PersistentTree *tree, i64 token)
+///
+/// @brief Leave a read section of a persistent tree.
+///
+/// @param tree A pointer to the PersistentTree passed to ptreeReadBegin.
+/// @param token The value returned by ptreeReadBegin.
+///
+/// @return This function returns no value.
+static void ptreeReadEnd(PersistentTree *tree, i64 token) {
+  __atomic_sub_fetch(&tree->readers[token >> 1].count[token & 1], 1,
+    __ATOMIC_SEQ_CST);
+}
+
+/// @fn static void ptreeFreeList(PersistentTree *tree,
+///   PersistentTreeNode *node)
+///
+/// @brief Free a list of retired or reserved nodes and whatever keys and
+/// values they own.
+///
+/// @param tree The tree the nodes belong to.
+/// @param node The first node of the list or NULL.
+///
+/// @return This function returns no value.
+static void ptreeFreeList(PersistentTree *tree, PersistentTreeNode *node) {
+  while (node != NULL) {
+    PersistentTreeNode *next = node->retiredNext;
+    if (node->ownsData == true) {
+      if (node->key != NULL) {
+        tree->keyType->destroy(node->key);
+      }
+      if ((node->type != NULL) && (node->value != NULL)) {
+        node->type->destroy(node->value);
+      }
+    }
+    allocatorFree(ALLOCATOR_RED_BLACK_TREE, tree->keyType, node);
+    node = next;
+  }
+}
+
+/// @fn static bool ptreeAdvanceEpoch(PersistentTree *tree)
+///
+/// @brief Try to advance the reclamation epoch of a persistent tree.
+///
+/// @details This is the scheme of radixTreeAdvanceEpoch.  Nodes are only
+/// retired once a write has published a root they aren't reachable from, so
+/// the only readers that can see them are those already in a snapshot.
+/// Advancing the epoch moves the retired list to limbo and starts counting
+/// new snapshots under the other parity.  The next advance can only happen
+/// once no snapshot from before the previous advance remains, which is
+/// exactly when limbo can be freed.
+///
+/// @param tree A pointer to a PersistentTree.  The caller must hold its lock.
+///
+/// @return Returns true if the epoch was advanced, false if snapshots from
+/// the previous epoch are still active.
+static bool ptreeAdvanceEpoch(PersistentTree *tree) {
+  i64 epoch = __atomic_load_n(&tree->epoch, __ATOMIC_SEQ_CST);
+  i64 previous = (epoch + 1) & 1;
+  for (int ii = 0; ii < PERSISTENT_TREE_READER_STRIPES; ii++) {
+    if (__atomic_load_n(&tree->readers[ii].count[previous],
+      __ATOMIC_SEQ_CST) != 0
+    ) {
+      return false;
+    }
+  }
+
+  ptreeFreeList(tree, tree->limbo);
+  tree->limbo = tree->retired;
+  tree->retired = NULL;
+  __atomic_add_fetch(&tree->epoch, 1, __ATOMIC_SEQ_CST);
+
+  return true;
+}
+
+/// @fn static int ptreeFillReserve(PersistentTree *tree, u64 size)
+///
+/// @brief Make sure a tree has enough nodes in reserve for one insertion or
+/// removal.
+///
+/// @details A left-leaning red-black tree of n nodes is at most 2 lg(n + 1)
+/// high, and a write touches at most the nodes on its path and the children
+/// and grandchildren of those nodes it rotates or recolors.  Eight nodes per
+/// level covers that with room to spare.
+///
+/// @param tree The tree to fill the reserve of.  The caller must hold its
+///   lock.
+/// @param size The number of nodes in the tree being written.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int ptreeFillReserve(PersistentTree *tree, u64 size) {
+  u64 height = 2 * (64 - (u64) __builtin_clzll(size + 1));
+  u64 needed = (8 * (height + 2)) + 4;
+
+  while (tree->reserveCount < needed) {
+    PersistentTreeNode *node = (PersistentTreeNode*) allocatorMalloc(
+      ALLOCATOR_RED_BLACK_TREE, tree->keyType, sizeof(PersistentTreeNode));
+    if (node == NULL) {
+      LOG_MALLOC_FAILURE();
+      return -1;
+    }
+    node->ownsData = false;
+    node->retiredNext = tree->reserve;
+    tree->reserve = node;
+    tree->reserveCount++;
+  }
+
+  return 0;
+}
+
+/// @fn static inline PersistentTreeNode* ptreeTakeNode(PersistentTree *tree)
+///
+/// @brief Take a node from a tree's reserve for the current write.
+///
+/// @param tree The tree being written.
+///
+/// @return Returns a node with its version set to the current write.  The
+/// other members are unset.
+static inline PersistentTreeNode* ptreeTakeNode(PersistentTree *tree) {
+  PersistentTreeNode *node = tree->reserve;
+  tree->reserve = node->retiredNext;
+  tree->reserveCount--;
+  node->version = tree->version;
+  node->ownsData = false;
+
+  return node;
+}
+
+/// @fn static inline void ptreeRetireData(PersistentTree *tree, void *key,
+///   void *value, TypeDescriptor *type)
+///
+/// @brief Arrange for a key and value that the current write made
+/// unreachable to be destroyed once no snapshot can see them.
+///
+/// @param tree The tree being written.
+/// @param key The key to destroy or NULL.
+/// @param value The value to destroy or NULL.
+/// @param type The TypeDescriptor of value.
+///
+/// @return This function returns no value.
+static inline void ptreeRetireData(PersistentTree *tree, void *key,
+  void *value, TypeDescriptor *type
+) {
+  PersistentTreeNode *carrier = ptreeTakeNode(tree);
+  carrier->key = key;
+  carrier->value = value;
+  carrier->type = type;
+  carrier->ownsData = true;
+  carrier->retiredNext = tree->retired;
+  tree->retired = carrier;
+}
+
+/// @fn static inline void ptreeDropNode(PersistentTree *tree,
+///   PersistentTreeNode *node)
+///
+/// @brief Dispose of a node that the current write has unlinked.  Its key and
+/// value, if they're still needed, are owned elsewhere.
+///
+/// @param tree The tree being written.
+/// @param node The unlinked node.
+///
+/// @return This function returns no value.
+static inline void ptreeDropNode(PersistentTree *tree,
+  PersistentTreeNode *node
+) {
+  if (node->version == tree->version) {
+    // No snapshot has ever seen this node.  Reuse it.
+    node->retiredNext = tree->reserve;
+    tree->reserve = node;
+    tree->reserveCount++;
+    return;
+  }
+
+  node->ownsData = false;
+  node->retiredNext = tree->retired;
+  tree->retired = node;
+}
+
+/// @fn static inline PersistentTreeNode* ptreeMutable(PersistentTree *tree,
+///   PersistentTreeNode *node)
+///
+/// @brief Get a version of a node that the current write may modify.
+///
+/// @param tree The tree being written.
+/// @param node A node reachable from the tree being written.
+///
+/// @return Returns node if the current write created it.  Otherwise, returns
+/// a copy of it and retires the original.  The copy takes over ownership of
+/// the key and value.
+static inline PersistentTreeNode* ptreeMutable(PersistentTree *tree,
+  PersistentTreeNode *node
+) {
+  if (node->version == tree->version) {
+    return node;
+  }
+
+  PersistentTreeNode *copy = ptreeTakeNode(tree);
+  copy->key = node->key;
+  copy->value = node->value;
+  copy->type = node->type;
+  copy->left = node->left;
+  copy->right = node->right;
+  copy->size = node->size;
+  copy->red = node->red;
+  ptreeDropNode(tree, node);
+
+  return copy;
+}
+
+/// @fn static PersistentTreeNode* ptreeRotateLeft(PersistentTree *tree,
+///   PersistentTreeNode *h)
+///
+/// @brief Make a right-leaning red link lean left.
+///
+/// @param tree The tree being written.
+/// @param h A node the current write may modify.
+///
+/// @return Returns the new root of the subtree.
+static PersistentTreeNode* ptreeRotateLeft(PersistentTree *tree,
+  PersistentTreeNode *h
+) {
+  PersistentTreeNode *x = ptreeMutable(tree, h->right);
+  h->right = x->left;
+  x->left = h;
+  x->red = h->red;
+  h->red = true;
+  x->size = h->size;
+  h->size = 1 + ptreeNodeSize(h->left) + ptreeNodeSize(h->right);
+
+  return x;
+}
+
+/// @fn static PersistentTreeNode* ptreeRotateRight(PersistentTree *tree,
+///   PersistentTreeNode *h)
+///
+/// @brief Make a left-leaning red link lean right.
+///
+/// @param tree The tree being written.
+/// @param h A node the current write may modify.
+///
+/// @return Returns the new root of the subtree.
+static PersistentTreeNode* ptreeRotateRight(PersistentTree *tree,
+  PersistentTreeNode *h
+) {
+  PersistentTreeNode *x = ptreeMutable(tree, h->left);
+  h->left = x->right;
+  x->right = h;
+  x->red = h->red;
+  h->red = true;
+  x->size = h->size;
+  h->size = 1 + ptreeNodeSize(h->left) + ptreeNodeSize(h->right);
+
+  return x;
+}
+
+/// @fn static void ptreeFlipColors(PersistentTree *tree,
+///   PersistentTreeNode *h)
+///
+/// @brief Flip the colors of a node and both of its children.
+///
+/// @param tree The tree being written.
+/// @param h A node the current write may modify.  Both of its children must
+///   be non-NULL.
+///
+/// @return This function returns no value.
+static void ptreeFlipColors(PersistentTree *tree, PersistentTreeNode *h) {
+  h->left = ptreeMutable(tree, h->left);
+  h->right = ptreeMutable(tree, h->right);
+  h->red = !h->red;
+  h->left->red = !h->left->red;
+  h->right->red = !h->right->red;
+}
+
+/// @fn static PersistentTreeNode* ptreeBalance(PersistentTree *tree,
+///   PersistentTreeNode *h)
+///
+/// @brief Restore the invariants of a left-leaning red-black tree at a node
+/// on the way back up from a change.
+///
+/// @param tree The tree being written.
+/// @param h A node the current write may modify.
+///
+/// @return Returns the new root of the subtree.
+static PersistentTreeNode* ptreeBalance(PersistentTree *tree,
+  PersistentTreeNode *h
+) {
+  if ((ptreeIsRed(h->right)) && (!ptreeIsRed(h->left))) {
+    h = ptreeRotateLeft(tree, h);
+  }
+  if ((ptreeIsRed(h->left)) && (ptreeIsRed(h->left->left))) {
+    h = ptreeRotateRight(tree, h);
+  }
+  if ((ptreeIsRed(h->left)) && (ptreeIsRed(h->right))) {
+    ptreeFlipColors(tree, h);
+  }
+  h->size = 1 + ptreeNodeSize(h->left) + ptreeNodeSize(h->right);
+
+  return h;
+}
+
+/// @fn static PersistentTreeNode* ptreeInsert(PersistentTree *tree,
+///   PersistentTreeNode *h, void *key, void *value, TypeDescriptor *type)
+///
+/// @brief Insert a key and value into a subtree or replace the value of the
+/// key if it's already there.
+///
+/// @param tree The tree being written.  Its reserve must be full.
+/// @param h The root of the subtree or NULL.
+/// @param key The key to insert.  The tree takes ownership of it.
+/// @param value The value to insert.  The tree takes ownership of it.
+/// @param type The TypeDescriptor of value.
+///
+/// @return Returns the new root of the subtree.
+static PersistentTreeNode* ptreeInsert(PersistentTree *tree,
+  PersistentTreeNode *h, void *key, void *value, TypeDescriptor *type
+) {
+  if (h == NULL) {
+    PersistentTreeNode *node = ptreeTakeNode(tree);
+    node->key = key;
+    node->value = value;
+    node->type = type;
+    node->left = NULL;
+    node->right = NULL;
+    node->size = 1;
+    node->red = true;
+    return node;
+  }
+
+  h = ptreeMutable(tree, h);
+  int comparison = tree->keyType->compare(key, h->key);
+  if (comparison < 0) {
+    h->left = ptreeInsert(tree, h->left, key, value, type);
+  } else if (comparison > 0) {
+    h->right = ptreeInsert(tree, h->right, key, value, type);
+  } else {
+    // Snapshots may still be using the old value, and the new key isn't
+    // needed.  Retire them both.
+    ptreeRetireData(tree, key, h->value, h->type);
+    h->value = value;
+    h->type = type;
+  }
+
+  return ptreeBalance(tree, h);
+}
+
+/// @fn static PersistentTreeNode* ptreeMoveRedLeft(PersistentTree *tree,
+///   PersistentTreeNode *h)
+///
+/// @brief Make h->left or one of its children red on the way down to a
+/// removal in the left subtree.
+///
+/// @param tree The tree being written.
+/// @param h A red node the current write may modify whose left child and
+///   left grandchild are black.
+///
+/// @return Returns the new root of the subtree.
+static PersistentTreeNode* ptreeMoveRedLeft(PersistentTree *tree,
+  PersistentTreeNode *h
+) {
+  ptreeFlipColors(tree, h);
+  if (ptreeIsRed(h->right->left)) {
+    h->right = ptreeRotateRight(tree, h->right);
+    h = ptreeRotateLeft(tree, h);
+    ptreeFlipColors(tree, h);
+  }
+
+  return h;
+}
+
+/// @fn static PersistentTreeNode* ptreeMoveRedRight(PersistentTree *tree,
+///   PersistentTreeNode *h)
+///
+/// @brief Make h->right or one of its children red on the way down to a
+/// removal in the right subtree.
+///
+/// @param tree The tree being written.
+/// @param h A red node the current write may modify whose right child and
+///   right child's left child are black.
+///
+/// @return Returns the new root of the subtree.
+static PersistentTreeNode* ptreeMoveRedRight(PersistentTree *tree,
+  PersistentTreeNode *h
+) {
+  ptreeFlipColors(tree, h);
+  if (ptreeIsRed(h->left->left)) {
+    h = ptreeRotateRight(tree, h);
+    ptreeFlipColors(tree, h);
+  }
+
+  return h;
+}
+
+/// @fn static PersistentTreeNode* ptreeRemoveMin(PersistentTree *tree,
+///   PersistentTreeNode *h)
+///
+/// @brief Unlink the node with the smallest key from a subtree.  The node's
+/// key and value are left alone for the caller to take over.
+///
+/// @param tree The tree being written.
+/// @param h The root of the subtree.
+///
+/// @return Returns the new root of the subtree.
+static PersistentTreeNode* ptreeRemoveMin(PersistentTree *tree,
+  PersistentTreeNode *h
+) {
+  if (h->left == NULL) {
+    ptreeDropNode(tree, h);
+    return NULL;
+  }
+
+  h = ptreeMutable(tree, h);
+  if ((!ptreeIsRed(h->left)) && (!ptreeIsRed(h->left->left))) {
+    h = ptreeMoveRedLeft(tree, h);
+  }
+  h->left = ptreeRemoveMin(tree, h->left);
+
+  return ptreeBalance(tree, h);
+}
+
+/// @fn static PersistentTreeNode* ptreeRemoveNode(PersistentTree *tree,
+///   PersistentTreeNode *h, const volatile void *key)
+///
+/// @brief Remove a key from a subtree.
+///
+/// @param tree The tree being written.  Its reserve must be full.
+/// @param h The root of the subtree.
+/// @param key The key to remove.  It must be in the subtree.
+///
+/// @return Returns the new root of the subtree.
+static PersistentTreeNode* ptreeRemoveNode(PersistentTree *tree,
+  PersistentTreeNode *h, const volatile void *key
+) {
+  h = ptreeMutable(tree, h);
+  if (tree->keyType->compare(key, h->key) < 0) {
+    if ((!ptreeIsRed(h->left)) && (!ptreeIsRed(h->left->left))) {
+      h = ptreeMoveRedLeft(tree, h);
+    }
+    h->left = ptreeRemoveNode(tree, h->left, key);
+  } else {
+    if (ptreeIsRed(h->left)) {
+      h = ptreeRotateRight(tree, h);
+    }
+    if ((tree->keyType->compare(key, h->key) == 0) && (h->right == NULL)) {
+      ptreeRetireData(tree, h->key, h->value, h->type);
+      ptreeDropNode(tree, h);
+      return NULL;
+    }
+    if ((!ptreeIsRed(h->right)) && (!ptreeIsRed(h->right->left))) {
+      h = ptreeMoveRedRight(tree, h);
+    }
+    if (tree->keyType->compare(key, h->key) == 0) {
+      // Replace this node's entry with its successor's and unlink the
+      // successor's node instead.
+      PersistentTreeNode *successor = h->right;
+      while (successor->left != NULL) {
+        successor = successor->left;
+      }
+      ptreeRetireData(tree, h->key, h->value, h->type);
+      h->key = successor->key;
+      h->value = successor->value;
+      h->type = successor->type;
+      h->right = ptreeRemoveMin(tree, h->right);
+    } else {
+      h->right = ptreeRemoveNode(tree, h->right, key);
+    }
+  }
+
+  return ptreeBalance(tree, h);
+}
+
+/// @fn static PersistentTreeNode* ptreeFind(const PersistentTree *tree,
+///   const PersistentTreeNode *node, const volatile void *key)
+///
+/// @brief Find the node with a key in a version of a tree.
+///
+/// @param tree The tree to search.
+/// @param node The root of the version to search.
+/// @param key The key to search for.
+///
+/// @return Returns the node with the key or NULL if there isn't one.
+static PersistentTreeNode* ptreeFind(const PersistentTree *tree,
+  const PersistentTreeNode *node, const volatile void *key
+) {
+  while (node != NULL) {
+    int comparison = tree->keyType->compare(key, node->key);
+    if (comparison == 0) {
+      return (PersistentTreeNode*) node;
+    }
+    node = (comparison < 0) ? node->left : node->right;
+  }
+
+  return NULL;
+}
+
+/// @fn static void ptreePublish(PersistentTree *tree, PersistentTreeNode *root)
+///
+/// @brief Make the result of a write visible to new snapshots and free
+/// whatever older writes retired that no snapshot can still see.
+///
+/// @param tree The tree being written.  The caller must hold its lock.
+/// @param root The new root of the tree.
+///
+/// @return This function returns no value.
+static void ptreePublish(PersistentTree *tree, PersistentTreeNode *root) {
+  __atomic_store_n(&tree->root, root, __ATOMIC_SEQ_CST);
+  if ((tree->retired != NULL) || (tree->limbo != NULL)) {
+    ptreeAdvanceEpoch(tree);
+  }
+}
+
+/// @fn static void ptreeDestroyNode(PersistentTree *tree,
+///   PersistentTreeNode *node)
+///
+/// @brief Destroy a node, its key and value, and all its subordinate nodes.
+///
+/// @param tree The tree the node belongs to.
+/// @param node The node to destroy or NULL.
+///
+/// @return This function returns no value.
+static void ptreeDestroyNode(PersistentTree *tree, PersistentTreeNode *node) {
+  if (node == NULL) {
+    return;
+  }
+
+  ptreeDestroyNode(tree, node->left);
+  ptreeDestroyNode(tree, node->right);
+  node->ownsData = true;
+  node->retiredNext = NULL;
+  ptreeFreeList(tree, node);
+}
+
+/// @fn PersistentTree* ptreeCreate(TypeDescriptor *keyType)
+///
+/// @brief Create a new, empty PersistentTree.
+///
+/// @param keyType The TypeDescriptor representing the kind of key to use.
+///
+/// @return Returns a pointer to a new PersistentTree on success, NULL on
+/// failure.
+PersistentTree* ptreeCreate(TypeDescriptor *keyType) {
+  printLog(TRACE, "ENTER ptreeCreate(keyType=%s)\n",
+    (keyType != NULL) ? keyType->name : "NULL");
+
+  if (keyType == NULL) {
+    printLog(ERR, "NULL keyType provided.\n");
+    printLog(TRACE, "EXIT ptreeCreate(keyType=NULL) = {NULL}\n");
+    return NULL;
+  }
+
+  PersistentTree *tree = (PersistentTree*) allocatorCalloc(
+    ALLOCATOR_RED_BLACK_TREE, keyType, 1, sizeof(PersistentTree));
+  if (tree == NULL) {
+    LOG_MALLOC_FAILURE();
+    printLog(TRACE, "EXIT ptreeCreate(keyType=%s) = {NULL}\n", keyType->name);
+    return NULL;
+  }
+  if (mtx_init(&tree->lock, mtx_plain) != thrd_success) {
+    printLog(ERR, "Could not initialize tree mutex.\n");
+    tree = (PersistentTree*)
+      allocatorFree(ALLOCATOR_RED_BLACK_TREE, keyType, tree);
+    printLog(TRACE, "EXIT ptreeCreate(keyType=%s) = {NULL}\n", keyType->name);
+    return NULL;
+  }
+  tree->keyType = keyType;
+
+  printLog(TRACE, "EXIT ptreeCreate(keyType=%s) = {%p}\n",
+    keyType->name, tree);
+  return tree;
+}
+
+/// @fn PersistentTree* ptreeDestroy(PersistentTree *tree)
+///
+/// @brief Destroy a PersistentTree and everything in it.
+///
+/// @details No snapshot of the tree may be active and no other thread may be
+/// using the tree.
+///
+/// @param tree The tree to destroy.
+///
+/// @return Always returns NULL.
+PersistentTree* ptreeDestroy(PersistentTree *tree) {
+  printLog(TRACE, "ENTER ptreeDestroy(tree=%p)\n", tree);
+
+  if (tree != NULL) {
+    ptreeDestroyNode(tree, tree->root);
+    ptreeFreeList(tree, tree->retired);
+    ptreeFreeList(tree, tree->limbo);
+    ptreeFreeList(tree, tree->reserve);
+    mtx_destroy(&tree->lock);
+    allocatorFree(ALLOCATOR_RED_BLACK_TREE, tree->keyType, tree);
+  }
+
+  printLog(TRACE, "EXIT ptreeDestroy(tree=%p) = {NULL}\n", tree);
+  return NULL;
+}
+
+/// @fn int ptreeAddEntry_(PersistentTree *tree, const volatile void *key,
+///   const volatile void *value, TypeDescriptor *type, ...)
+///
+/// @brief Add an entry to a tree, or replace the value of the entry with the
+/// same key, and publish the result.
+///
+/// @details Snapshots that began before this call keep seeing the tree as it
+/// was.  Only the nodes on the path to the entry are copied.
+///
+/// @param tree The tree to add to.
+/// @param key The key of the entry.  A copy is made with the tree's key type.
+/// @param value The value of the entry.  A copy is made with type.
+/// @param type The TypeDescriptor of value.  NULL selects the type of the
+///   last value added or, if there wasn't one, the key type.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides NULL for type.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ptreeAddEntry_(PersistentTree *tree, const volatile void *key,
+  const volatile void *value, TypeDescriptor *type, ...
+) {
+  printLog(TRACE, "ENTER ptreeAddEntry(tree=%p, key=%p, value=%p)\n",
+    tree, key, value);
+
+  if ((tree == NULL) || (key == NULL)) {
+    printLog(ERR, "NULL tree or key provided.\n");
+    printLog(TRACE, "EXIT ptreeAddEntry(tree=%p, key=%p, value=%p) = {-1}\n",
+      tree, key, value);
+    return -1;
+  }
+
+  if (mtx_lock(&tree->lock) != thrd_success) {
+    printLog(ERR, "Could not lock tree mutex.\n");
+    printLog(TRACE, "EXIT ptreeAddEntry(tree=%p, key=%p, value=%p) = {-1}\n",
+      tree, key, value);
+    return -1;
+  }
+
+  if (type == NULL) {
+    type = (tree->lastAddedType != NULL) ? tree->lastAddedType : tree->keyType;
+  }
+  PersistentTreeNode *root = tree->root;
+  if (ptreeFillReserve(tree, ptreeNodeSize(root)) != 0) {
+    mtx_unlock(&tree->lock);
+    printLog(TRACE, "EXIT ptreeAddEntry(tree=%p, key=%p, value=%p) = {-1}\n",
+      tree, key, value);
+    return -1;
+  }
+
+  tree->version++;
+  root = ptreeInsert(tree, root,
+    tree->keyType->copy(key), type->copy(value), type);
+  root->red = false;
+  tree->lastAddedType = type;
+  ptreePublish(tree, root);
+
+  mtx_unlock(&tree->lock);
+
+  printLog(TRACE, "EXIT ptreeAddEntry(tree=%p, key=%p, value=%p) = {0}\n",
+    tree, key, value);
+  return 0;
+}
+
+/// @fn int ptreeRemove(PersistentTree *tree, const volatile void *key)
+///
+/// @brief Remove the entry with a key from a tree and publish the result.
+///
+/// @param tree The tree to remove from.
+/// @param key The key of the entry to remove.
+///
+/// @return Returns 0 if the entry was removed, -1 if there was no such entry
+/// or on failure.
+int ptreeRemove(PersistentTree *tree, const volatile void *key) {
+  printLog(TRACE, "ENTER ptreeRemove(tree=%p, key=%p)\n", tree, key);
+
+  if ((tree == NULL) || (key == NULL)) {
+    printLog(ERR, "NULL tree or key provided.\n");
+    printLog(TRACE, "EXIT ptreeRemove(tree=%p, key=%p) = {-1}\n", tree, key);
+    return -1;
+  }
+
+  if (mtx_lock(&tree->lock) != thrd_success) {
+    printLog(ERR, "Could not lock tree mutex.\n");
+    printLog(TRACE, "EXIT ptreeRemove(tree=%p, key=%p) = {-1}\n", tree, key);
+    return -1;
+  }
+
+  PersistentTreeNode *root = tree->root;
+  if ((ptreeFind(tree, root, key) == NULL)
+    || (ptreeFillReserve(tree, ptreeNodeSize(root)) != 0)
+  ) {
+    mtx_unlock(&tree->lock);
+    printLog(TRACE, "EXIT ptreeRemove(tree=%p, key=%p) = {-1}\n", tree, key);
+    return -1;
+  }
+
+  tree->version++;
+  root = ptreeMutable(tree, root);
+  if ((!ptreeIsRed(root->left)) && (!ptreeIsRed(root->right))) {
+    root->red = true;
+  }
+  root = ptreeRemoveNode(tree, root, key);
+  if (root != NULL) {
+    root->red = false;
+  }
+  ptreePublish(tree, root);
+
+  mtx_unlock(&tree->lock);
+
+  printLog(TRACE, "EXIT ptreeRemove(tree=%p, key=%p) = {0}\n", tree, key);
+  return 0;
+}
+
+/// @struct PersistentTreeAddContext
+///
+/// @brief The state of a ptreeAddRbTree walk.
+///
+/// @param tree The tree being written.
+/// @param root The root of the version being built.
+/// @param status 0 until an allocation fails, -1 after.
+typedef struct PersistentTreeAddContext {
+  PersistentTree *tree;
+  PersistentTreeNode *root;
+  int status;
+} PersistentTreeAddContext;
+
+/// @fn static bool ptreeAddRbTreeNode(RedBlackNode *node, void *context)
+///
+/// @brief Add one entry of a RedBlackTree to the version of a persistent tree
+/// being built by ptreeAddRbTree.
+///
+/// @param node The RedBlackTree node to add.
+/// @param context A pointer to the PersistentTreeAddContext of the walk.
+///
+/// @return Returns true to continue the walk, false to stop it.
+static bool ptreeAddRbTreeNode(RedBlackNode *node, void *context) {
+  PersistentTreeAddContext *addContext = (PersistentTreeAddContext*) context;
+  PersistentTree *tree = addContext->tree;
+
+  if (ptreeFillReserve(tree, ptreeNodeSize(addContext->root)) != 0) {
+    addContext->status = -1;
+    return false;
+  }
+  addContext->root = ptreeInsert(tree, addContext->root,
+    tree->keyType->copy(node->key), node->type->copy(node->value),
+    node->type);
+  addContext->root->red = false;
+
+  return true;
+}
+
+/// @fn int ptreeAddRbTree(PersistentTree *tree, const RedBlackTree *source)
+///
+/// @brief Add every entry of a RedBlackTree to a tree as a single write.
+///
+/// @details This is the way to move a Dictionary or other RedBlackTree that
+/// is read far more often than it is written over to a PersistentTree, and to
+/// apply a batch of changes that readers should see all at once.  Within the
+/// write, nodes are only copied the first time they're touched.  If the
+/// source has several entries with the same key, the last one wins.
+///
+/// @param tree The tree to add to.  Its key type must be able to compare and
+///   copy the keys of source.
+/// @param source The RedBlackTree to add the entries of.
+///
+/// @return Returns 0 on success, -1 on failure.  On failure, the entries
+/// added before the failure are published.
+int ptreeAddRbTree(PersistentTree *tree, const RedBlackTree *source) {
+  printLog(TRACE, "ENTER ptreeAddRbTree(tree=%p, source=%p)\n", tree, source);
+
+  if ((tree == NULL) || (source == NULL)) {
+    printLog(ERR, "NULL tree or source provided.\n");
+    printLog(TRACE, "EXIT ptreeAddRbTree(tree=%p, source=%p) = {-1}\n",
+      tree, source);
+    return -1;
+  }
+
+  if (mtx_lock(&tree->lock) != thrd_success) {
+    printLog(ERR, "Could not lock tree mutex.\n");
+    printLog(TRACE, "EXIT ptreeAddRbTree(tree=%p, source=%p) = {-1}\n",
+      tree, source);
+    return -1;
+  }
+
+  tree->version++;
+  PersistentTreeAddContext context = { tree, tree->root, 0 };
+  rbTreeRange(source, NULL, NULL, ptreeAddRbTreeNode, &context);
+  ptreePublish(tree, context.root);
+
+  mtx_unlock(&tree->lock);
+
+  printLog(TRACE, "EXIT ptreeAddRbTree(tree=%p, source=%p) = {%d}\n",
+    tree, source, context.status);
+  return context.status;
+}
+
+/// @fn u64 ptreeSize(PersistentTree *tree)
+///
+/// @brief Get the number of entries in the most recently published version
+/// of a tree.
+///
+/// @param tree The tree of interest.
+///
+/// @return Returns the number of entries in the tree, 0 if tree is NULL.
+u64 ptreeSize(PersistentTree *tree) {
+  PersistentTreeSnapshot snapshot;
+  if (ptreeSnapshotBegin(tree, &snapshot) != 0) {
+    return 0;
+  }
+
+  u64 size = ptreeSnapshotSize(&snapshot);
+  ptreeSnapshotEnd(&snapshot);
+
+  return size;
+}
+
+/// @fn void ptreeSynchronize(PersistentTree *tree)
+///
+/// @brief Wait until every snapshot of a tree that began before this call
+/// has ended and free everything that writes before this call replaced.
+///
+/// @details This must not be called by a thread that holds a snapshot of the
+/// tree.
+///
+/// @param tree The tree of interest.
+///
+/// @return This function returns no value.
+void ptreeSynchronize(PersistentTree *tree) {
+  printLog(TRACE, "ENTER ptreeSynchronize(tree=%p)\n", tree);
+
+  if ((tree == NULL) || (mtx_lock(&tree->lock) != thrd_success)) {
+    printLog(ERR, "NULL tree provided or could not lock tree mutex.\n");
+    printLog(TRACE, "EXIT ptreeSynchronize(tree=%p)\n", tree);
+    return;
+  }
+
+  // The first advance waits out the snapshots that began before the current
+  // epoch.  The second waits out the ones that began during it.
+  for (int ii = 0; ii < 2; ii++) {
+    while (ptreeAdvanceEpoch(tree) == false) {
+      thrd_yield();
+    }
+  }
+
+  mtx_unlock(&tree->lock);
+
+  printLog(TRACE, "EXIT ptreeSynchronize(tree=%p)\n", tree);
+}
+
+/// @fn int ptreeSnapshotBegin(PersistentTree *tree,
+///   PersistentTreeSnapshot *snapshot)
+///
+/// @brief Begin a consistent, read-only view of the most recently published
+/// version of a tree.
+///
+/// @details This never blocks and never takes a lock.  Every read through
+/// the snapshot sees the same version of the tree, regardless of any writes
+/// made after it began.  The snapshot must be ended with ptreeSnapshotEnd,
+/// and it should be kept only as long as needed, since nothing replaced
+/// after it began can be freed until it ends.  Snapshots may be nested.
+///
+/// @param tree The tree to take a snapshot of.
+/// @param snapshot The snapshot to fill in.
+///
+/// @return Returns 0 on success, -1 on failure.
+int ptreeSnapshotBegin(PersistentTree *tree,
+  PersistentTreeSnapshot *snapshot
+) {
+  if ((tree == NULL) || (snapshot == NULL)) {
+    printLog(ERR, "NULL tree or snapshot provided.\n");
+    return -1;
+  }
+
+  snapshot->tree = tree;
+  snapshot->token = ptreeReadBegin(tree);
+  snapshot->root = __atomic_load_n(&tree->root, __ATOMIC_SEQ_CST);
+
+  return 0;
+}
+
+/// @fn void ptreeSnapshotEnd(PersistentTreeSnapshot *snapshot)
+///
+/// @brief End a snapshot begun with ptreeSnapshotBegin.  Nothing obtained
+/// through the snapshot may be used afterward.
+///
+/// @param snapshot The snapshot to end.
+///
+/// @return This function returns no value.
+void ptreeSnapshotEnd(PersistentTreeSnapshot *snapshot) {
+  if ((snapshot == NULL) || (snapshot->tree == NULL)) {
+    return;
+  }
+
+  ptreeReadEnd(snapshot->tree, snapshot->token);
+  snapshot->tree = NULL;
+  snapshot->root = NULL;
+}
+
+/// @fn const PersistentTreeNode* ptreeSnapshotGetEntry(
+///   const PersistentTreeSnapshot *snapshot, const volatile void *key)
+///
+/// @brief Find the entry with a key in a snapshot.
+///
+/// @param snapshot The snapshot to search.
+/// @param key The key to search for.
+///
+/// @return Returns the node of the entry, which is valid until the snapshot
+/// ends, or NULL if there is no such entry.
+const PersistentTreeNode* ptreeSnapshotGetEntry(
+  const PersistentTreeSnapshot *snapshot, const volatile void *key
+) {
+  if ((snapshot == NULL) || (snapshot->tree == NULL) || (key == NULL)) {
+    return NULL;
+  }
+
+  return ptreeFind(snapshot->tree, snapshot->root, key);
+}
+
+/// @fn void* ptreeSnapshotGetValue(const PersistentTreeSnapshot *snapshot,
+///   const volatile void *key)
+///
+/// @brief Get the value for a key in a snapshot.
+///
+/// @param snapshot The snapshot to search.
+/// @param key The key to search for.
+///
+/// @return Returns the value, which belongs to the tree and is valid until
+/// the snapshot ends, or NULL if there is no such entry.
+void* ptreeSnapshotGetValue(const PersistentTreeSnapshot *snapshot,
+  const volatile void *key
+) {
+  const PersistentTreeNode *node = ptreeSnapshotGetEntry(snapshot, key);
+
+  return (node != NULL) ? node->value : NULL;
+}
+
+/// @fn u64 ptreeSnapshotSize(const PersistentTreeSnapshot *snapshot)
+///
+/// @brief Get the number of entries in a snapshot.
+///
+/// @param snapshot The snapshot of interest.
+///
+/// @return Returns the number of entries in the snapshot.
+u64 ptreeSnapshotSize(const PersistentTreeSnapshot *snapshot) {
+  return (snapshot != NULL) ? ptreeNodeSize(snapshot->root) : 0;
+}
+
+/// @fn static bool ptreeRangeNode(const PersistentTree *tree,
+///   const PersistentTreeNode *node, const volatile void *low,
+///   const volatile void *high, PersistentTreeRangeFunction function,
+///   void *context, u64 *count)
+///
+/// @brief Walk the part of a subtree between low and high in key order.
+///
+/// @param tree The tree the subtree belongs to.
+/// @param node The root of the subtree or NULL.
+/// @param low The smallest key to visit or NULL.
+/// @param high The largest key to visit or NULL.
+/// @param function The function to call on each node.
+/// @param context Passed through to function unmodified.
+/// @param count Incremented for every call to function.
+///
+/// @return Returns false if function ended the walk, true otherwise.
+static bool ptreeRangeNode(const PersistentTree *tree,
+  const PersistentTreeNode *node, const volatile void *low,
+  const volatile void *high, PersistentTreeRangeFunction function,
+  void *context, u64 *count
+) {
+  if (node == NULL) {
+    return true;
+  }
+
+  bool aboveLow = (low == NULL) || (tree->keyType->compare(node->key, low) >= 0);
+  bool belowHigh
+    = (high == NULL) || (tree->keyType->compare(node->key, high) <= 0);
+  if ((aboveLow) && (!ptreeRangeNode(tree, node->left, low, high,
+    function, context, count))
+  ) {
+    return false;
+  }
+  if ((aboveLow) && (belowHigh)) {
+    (*count)++;
+    if (!function(node, context)) {
+      return false;
+    }
+  }
+  if ((belowHigh) && (!ptreeRangeNode(tree, node->right, low, high,
+    function, context, count))
+  ) {
+    return false;
+  }
+
+  return true;
+}
+
+/// @fn u64 ptreeSnapshotRange(const PersistentTreeSnapshot *snapshot,
+///   const volatile void *low, const volatile void *high,
+///   PersistentTreeRangeFunction function, void *context)
+///
+/// @brief Call a function on every entry of a snapshot with a key between low
+/// and high, inclusive, in key order.
+///
+/// @details Unlike rbTreeRange, this holds no lock, so the function may do
+/// anything, including writing to the tree.  Such writes aren't visible
+/// through the snapshot.
+///
+/// @param snapshot The snapshot to walk.
+/// @param low The smallest key to visit.  NULL starts at the first entry.
+/// @param high The largest key to visit.  NULL ends at the last entry.
+/// @param function The function to call on each node.  Returning false from
+///   it ends the walk early.
+/// @param context Passed through to function unmodified.
+///
+/// @return Returns the number of nodes function was called on.
+u64 ptreeSnapshotRange(const PersistentTreeSnapshot *snapshot,
+  const volatile void *low, const volatile void *high,
+  PersistentTreeRangeFunction function, void *context
+) {
+  u64 count = 0;
+  if ((snapshot == NULL) || (snapshot->tree == NULL) || (function == NULL)) {
+    printLog(ERR, "NULL snapshot or function provided.\n");
+    return count;
+  }
+
+  ptreeRangeNode(snapshot->tree, snapshot->root, low, high,
+    function, context, &count);
+
+  return count;
+}
+
+/// @fn static i64 ptreeCheckNode(const PersistentTree *tree,
+///   const PersistentTreeNode *node)
+///
+/// @brief Verify the invariants of a subtree for the unit test:  Keys in
+/// order, sizes correct, no right-leaning red links, no two red links in a
+/// row and the same number of black links on every path.
+///
+/// @param tree The tree the subtree belongs to.
+/// @param node The root of the subtree or NULL.
+///
+/// @return Returns the black height of the subtree, -1 if it's invalid.
+static i64 ptreeCheckNode(const PersistentTree *tree,
+  const PersistentTreeNode *node
+) {
+  if (node == NULL) {
+    return 0;
+  }
+
+  if ((ptreeIsRed(node->right))
+    || ((ptreeIsRed(node)) && (ptreeIsRed(node->left)))
+    || (node->size
+      != 1 + ptreeNodeSize(node->left) + ptreeNodeSize(node->right))
+    || ((node->left != NULL)
+      && (tree->keyType->compare(node->left->key, node->key) >= 0))
+    || ((node->right != NULL)
+      && (tree->keyType->compare(node->right->key, node->key) <= 0))
+  ) {
+    return -1;
+  }
+
+  i64 leftHeight = ptreeCheckNode(tree, node->left);
+  i64 rightHeight = ptreeCheckNode(tree, node->right);
+  if ((leftHeight < 0) || (leftHeight != rightHeight)) {
+    return -1;
+  }
+
+  return leftHeight + ((ptreeIsRed(node)) ? 0 : 1);
+}
+
+/// @fn static bool ptreeCheckOrder(const PersistentTreeNode *node,
+///   void *context)
+///
+/// @brief Range function for the unit test that verifies that keys are
+/// visited in increasing order.
+///
+/// @param node The node being visited.
+/// @param context A pointer to the i64 key of the previous node.
+///
+/// @return Returns true if the key is larger than the previous one.
+static bool ptreeCheckOrder(const PersistentTreeNode *node, void *context) {
+  i64 *previous = (i64*) context;
+  i64 key = *((i64*) node->key);
+  bool inOrder = (key > *previous);
+  *previous = key;
+
+  return inOrder;
+}
+
+/// @struct PersistentTreeTestReader
+///
+/// @brief The arguments and result of a unit test reader thread.
+///
+/// @param tree The tree to read.
+/// @param done Set when the writer has finished.
+/// @param failed Set by the reader if it saw an inconsistent snapshot.
+typedef struct PersistentTreeTestReader {
+  PersistentTree *tree;
+  volatile bool done;
+  volatile bool failed;
+} PersistentTreeTestReader;
+
+/// @fn static int ptreeTestReader(void *arg)
+///
+/// @brief Unit test reader thread.  Takes snapshots while another thread
+/// writes and verifies that each one is a valid tree whose entries all have
+/// the value the writer gives every entry of a version.
+///
+/// @param arg A pointer to a PersistentTreeTestReader.
+///
+/// @return Always returns 0.
+static int ptreeTestReader(void *arg) {
+  PersistentTreeTestReader *reader = (PersistentTreeTestReader*) arg;
+  PersistentTreeSnapshot snapshot;
+
+  while (!__atomic_load_n(&reader->done, __ATOMIC_ACQUIRE)) {
+    ptreeSnapshotBegin(reader->tree, &snapshot);
+    if ((ptreeCheckNode(reader->tree, snapshot.root) < 0)
+      || (ptreeSnapshotSize(&snapshot) != 64)
+    ) {
+      reader->failed = true;
+    } else {
+      i64 first = 0;
+      i64 *firstValue = (i64*) ptreeSnapshotGetValue(&snapshot, &first);
+      for (i64 ii = 1; (firstValue != NULL) && (ii < 64); ii++) {
+        i64 *value = (i64*) ptreeSnapshotGetValue(&snapshot, &ii);
+        if ((value == NULL) || (*value != *firstValue)) {
+          reader->failed = true;
+          break;
+        }
+      }
+    }
+    ptreeSnapshotEnd(&snapshot);
+  }
+
+  return 0;
+}
+
+/// @def PERSISTENT_TREE_UNIT_TEST
+///
+/// @brief Unit tests for persistent tree functionality.
+/// @details Implementing this as a macro instead of raw code allows this to
+/// be skipped by the code coverage metrics.
+///
+/// @return Returns true on success, false on failure.
+#define PERSISTENT_TREE_UNIT_TEST \
+bool persistentTreeUnitTest() { \
+  PersistentTree *tree = ptreeCreate(typeI64); \
+  PersistentTreeSnapshot before, after; \
+  char value[32]; \
+  if ((tree == NULL) || (ptreeSize(tree) != 0)) { \
+    printLog(ERR, "Could not create persistent tree.\n"); \
+    return false; \
+  } \
+ \
+  /* Insert in a scattered order and check the shape after every write. */ \
+  for (i64 ii = 0; ii < 1000; ii++) { \
+    i64 key = (ii * 7919) % 1000; \
+    snprintf(value, sizeof(value), "%lld", lld(key)); \
+    if (ptreeAddEntry(tree, &key, value, typeString) != 0) { \
+      printLog(ERR, "Could not add key %lld.\n", lld(key)); \
+      return false; \
+    } \
+    if (ptreeCheckNode(tree, tree->root) < 0) { \
+      printLog(ERR, "Tree invalid after adding key %lld.\n", lld(key)); \
+      return false; \
+    } \
+  } \
+  if (ptreeSize(tree) != 1000) { \
+    printLog(ERR, "Expected 1000 entries, found %llu.\n", \
+      llu(ptreeSize(tree))); \
+    return false; \
+  } \
+ \
+  /* Writes made after a snapshot begins aren't visible through it. */ \
+  ptreeSnapshotBegin(tree, &before); \
+  for (i64 key = 0; key < 1000; key += 2) { \
+    if (ptreeRemove(tree, &key) != 0) { \
+      printLog(ERR, "Could not remove key %lld.\n", lld(key)); \
+      return false; \
+    } \
+    if (ptreeCheckNode(tree, tree->root) < 0) { \
+      printLog(ERR, "Tree invalid after removing key %lld.\n", lld(key)); \
+      return false; \
+    } \
+  } \
+  i64 key = 1; \
+  ptreeAddEntry(tree, &key, "one"); \
+  key = 0; \
+  if (ptreeRemove(tree, &key) != -1) { \
+    printLog(ERR, "Removed a key that isn't there.\n"); \
+    return false; \
+  } \
+  ptreeSnapshotBegin(tree, &after); \
+  if ((ptreeSnapshotSize(&before) != 1000) \
+    || (ptreeSnapshotSize(&after) != 500) \
+    || (ptreeSnapshotGetValue(&before, &key) == NULL) \
+    || (ptreeSnapshotGetValue(&after, &key) != NULL) \
+  ) { \
+    printLog(ERR, "Snapshots don't match their versions.\n"); \
+    return false; \
+  } \
+  key = 1; \
+  if ((strcmp((char*) ptreeSnapshotGetValue(&before, &key), "1") != 0) \
+    || (strcmp((char*) ptreeSnapshotGetValue(&after, &key), "one") != 0) \
+  ) { \
+    printLog(ERR, "Replaced value visible in older snapshot.\n"); \
+    return false; \
+  } \
+  i64 previous = -1; \
+  if ((ptreeSnapshotRange(&before, NULL, NULL, ptreeCheckOrder, &previous) \
+      != 1000) \
+    || (ptreeCheckNode(tree, before.root) < 0) \
+  ) { \
+    printLog(ERR, "Older snapshot was modified.\n"); \
+    return false; \
+  } \
+  i64 low = 100, high = 199; \
+  previous = -1; \
+  if (ptreeSnapshotRange(&after, &low, &high, ptreeCheckOrder, &previous) \
+    != 50 \
+  ) { \
+    printLog(ERR, "Range walk visited the wrong entries.\n"); \
+    return false; \
+  } \
+  ptreeSnapshotEnd(&after); \
+  ptreeSnapshotEnd(&before); \
+ \
+  /* Nothing is left waiting to be freed once the snapshots are gone. */ \
+  ptreeSynchronize(tree); \
+  if ((tree->retired != NULL) || (tree->limbo != NULL)) { \
+    printLog(ERR, "Retired nodes not freed by ptreeSynchronize.\n"); \
+    return false; \
+  } \
+ \
+  /* Bulk load from a RedBlackTree. */ \
+  RedBlackTree *source = rbTreeCreate(typeI64); \
+  for (key = 0; key < 2000; key += 3) { \
+    rbTreeAddEntry(source, &key, &key, typeI64); \
+  } \
+  if ((ptreeAddRbTree(tree, source) != 0) \
+    || (ptreeSize(tree) != 500 + 667 - 167) \
+    || (ptreeCheckNode(tree, tree->root) < 0) \
+  ) { \
+    printLog(ERR, "Adding a RedBlackTree failed.\n"); \
+    return false; \
+  } \
+  source = rbTreeDestroy(source); \
+  tree = ptreeDestroy(tree); \
+ \
+  /* Readers see whole versions while a writer changes every value. */ \
+  tree = ptreeCreate(typeI64); \
+  for (key = 0; key < 64; key++) { \
+    i64 version = 0; \
+    ptreeAddEntry(tree, &key, &version, typeI64); \
+  } \
+  PersistentTreeTestReader reader = { tree, false, false }; \
+  thrd_t threads[2]; \
+  for (int ii = 0; ii < 2; ii++) { \
+    thrd_create(&threads[ii], ptreeTestReader, &reader); \
+  } \
+  for (i64 version = 1; version <= 200; version++) { \
+    RedBlackTree *batch = rbTreeCreate(typeI64); \
+    for (key = 0; key < 64; key++) { \
+      rbTreeAddEntry(batch, &key, &version, typeI64); \
+    } \
+    ptreeAddRbTree(tree, batch); \
+    batch = rbTreeDestroy(batch); \
+  } \
+  __atomic_store_n(&reader.done, true, __ATOMIC_RELEASE); \
+  for (int ii = 0; ii < 2; ii++) { \
+    thrd_join(threads[ii], NULL); \
+  } \
+  if (reader.failed) { \
+    printLog(ERR, "A reader saw an inconsistent snapshot.\n"); \
+    return false; \
+  } \
+  tree = ptreeDestroy(tree); \
+ \
+  if ((ptreeAddEntry(NULL, &key, &key) != -1) \
+    || (ptreeRemove(NULL, &key) != -1) \
+    || (ptreeSnapshotBegin(NULL, &before) != -1) \
+    || (ptreeSize(NULL) != 0) \
+  ) { \
+    printLog(ERR, "NULL tree not handled.\n"); \
+    return false; \
+  } \
+ \
+  return true; \
+}
+PERSISTENT_TREE_UNIT_TEST
+
@@ -32,6 +32,21 @@
 #include "PosixCThreads.h"
 #include <stdio.h>
 #include <stdlib.h>
+#ifdef __linux__
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif // __linux__
+
+#ifdef __linux__
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+/// @def THRD_MAX_NUMA_NODES
+///
+/// @brief The number of NUMA nodes that thrd_create_ex can place a thread on.
+#define THRD_MAX_NUMA_NODES 1024
+#endif // __linux__
 
 #ifdef __cplusplus
 #define ZEROINIT(x) x = {}
@@ -182,6 +197,92 @@ void mtx_destroy(mtx_t* mtx) {
   pthread_mutex_destroy(mtx);
 }
 
+int rwl_init(rwl_t *rwl) {
+  int returnValue = pthread_rwlock_init(rwl, NULL);
+  
+  if (returnValue != 0) {
+    fputs("pthread_rwlock_init: ", stderr);
+    fputs(strerror(returnValue), stderr);
+    fputs("\n", stderr);
+    returnValue = thrd_error;
+  }
+  
+  return returnValue;
+}
+
+int rwl_rdlock(rwl_t *rwl) {
+  int returnValue = thrd_success;
+  
+  returnValue = pthread_rwlock_rdlock(rwl);
+  
+  if (returnValue != 0) {
+    returnValue = thrd_error;
+  }
+  
+  return returnValue;
+}
+
+int rwl_tryrdlock(rwl_t *rwl) {
+  int returnValue = thrd_success;
+  
+  returnValue = pthread_rwlock_tryrdlock(rwl);
+  
+  if (returnValue == EBUSY) {
+    returnValue = thrd_busy;
+  } else if (returnValue != 0) {
+    returnValue = thrd_error;
+  }
+  
+  return returnValue;
+}
+
+int rwl_rdunlock(rwl_t *rwl) {
+  int returnValue = thrd_success;
+  
+  returnValue = pthread_rwlock_unlock(rwl);
+  
+  if (returnValue != 0) {
+    returnValue = thrd_error;
+  }
+  
+  return returnValue;
+}
+
+int rwl_wrlock(rwl_t *rwl) {
+  int returnValue = thrd_success;
+  
+  returnValue = pthread_rwlock_wrlock(rwl);
+  
+  if (returnValue != 0) {
+    returnValue = thrd_error;
+  }
+  
+  return returnValue;
+}
+
+int rwl_trywrlock(rwl_t *rwl) {
+  int returnValue = thrd_success;
+  
+  returnValue = pthread_rwlock_trywrlock(rwl);
+  
+  if (returnValue == EBUSY) {
+    returnValue = thrd_busy;
+  } else if (returnValue != 0) {
+    returnValue = thrd_error;
+  }
+  
+  return returnValue;
+}
+
+int rwl_wrunlock(rwl_t *rwl) {
+  // POSIX uses the same call to release either kind of hold.
+  return rwl_rdunlock(rwl);
+}
+
+void rwl_destroy(rwl_t *rwl) {
+  pthread_rwlock_destroy(rwl);
+}
+
 #ifndef _WIN32
 int timespec_get(struct timespec* spec, int base) {
   clock_gettime(CLOCK_REALTIME, spec);
@@ -206,15 +307,15 @@ int timespec_get(struct timespec* spec, int base) {
 int timespec_get(struct timespec* spec, int base) {
   __int64 wintime = 0;
   FILETIME filetime = { 0, 0 };
-
+  
   GetSystemTimeAsFileTime(&filetime);
   wintime = (((__int64) filetime.dwHighDateTime) << 32)
     | ((__int64) filetime.dwLowDateTime);
-
+  
   wintime -= 116444736000000000LL;       // 1-Jan-1601 to 1-Jan-1970
   spec->tv_sec = wintime / 10000000LL;       // seconds
   spec->tv_nsec = wintime % 10000000LL * 100; // nano-seconds
-
+  
   return base;
 }
 #endif
@@ -222,17 +323,86 @@ int timespec_get(struct timespec* spec, int base) {
 typedef struct PthreadCreateWrapperArgs {
   thrd_start_t func;
   void *arg;
+  int numa_node;
+  char name[16];
 } PthreadCreateWrapperArgs;
 
+#ifdef __linux__
+/// @fn static int posix_c_threads_node_cpus(int node, cpu_set_t *cpu_set)
+///
+/// @brief Add the CPUs of a NUMA node, as listed by sysfs, to a CPU set.
+///
+/// @param node The NUMA node to look up.
+/// @param cpu_set The cpu_set_t to add the node's CPUs to.
+///
+/// @return Returns the number of CPUs added, 0 if the node doesn't exist.
+static int posix_c_threads_node_cpus(int node, cpu_set_t *cpu_set) {
+  char path[64];
+  snprintf(path, sizeof(path),
+    "/sys/devices/system/node/node%d/cpulist", node);
+  FILE *cpulist = fopen(path, "r");
+  if (cpulist == NULL) {
+    return 0;
+  }
+  
+  // The list is a comma-separated list of CPUs and ranges, e.g. "0-3,8-11".
+  int num_cpus = 0;
+  int first = 0, last = 0;
+  while (fscanf(cpulist, "%d", &first) == 1) {
+    last = first;
+    int separator = fgetc(cpulist);
+    if (separator == '-') {
+      if (fscanf(cpulist, "%d", &last) != 1) {
+        break;
+      }
+      separator = fgetc(cpulist);
+    }
+    for (int cpu = first; (cpu <= last) && (cpu < CPU_SETSIZE); cpu++) {
+      CPU_SET(cpu, cpu_set);
+      num_cpus++;
+    }
+    if (separator != ',') {
+      break;
+    }
+  }
+  fclose(cpulist);
+  
+  return num_cpus;
+}
+#endif // __linux__
+
 void *posix_c_threads_create_wrapper(void* wrapper_args) {
   // We want to be able to kill this thread if we need to.
   pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
   
-  // Create the message queue for this thread.
-  thrd_msg_q_create();
-  
   PthreadCreateWrapperArgs *cthread_args
     = (PthreadCreateWrapperArgs*) wrapper_args;
+  
+#ifdef __linux__
+  if (cthread_args->numa_node >= 0) {
+    // Prefer memory from the thread's node for everything it allocates from
+    // here on, starting with its message queue.
+    unsigned long node_mask[THRD_MAX_NUMA_NODES / (8 * sizeof(unsigned long))];
+    memset(node_mask, 0, sizeof(node_mask));
+    node_mask[cthread_args->numa_node / (8 * sizeof(unsigned long))]
+      |= 1UL << (cthread_args->numa_node % (8 * sizeof(unsigned long)));
+    syscall(SYS_set_mempolicy, MPOL_PREFERRED, node_mask,
+      THRD_MAX_NUMA_NODES + 1);
+  }
+  if (cthread_args->name[0] != '\0') {
+    pthread_setname_np(pthread_self(), cthread_args->name);
+  }
+#elif defined(__APPLE__)
+  if (cthread_args->name[0] != '\0') {
+    pthread_setname_np(cthread_args->name);
+  }
+#endif // __linux__
+  
+  // Create the message queue for this thread.  This is done after the thread's
+  // placement has been applied so that the queue is allocated from memory
+  // that's local to the thread.
+  thrd_msg_q_create();
+  
   thrd_start_t func = cthread_args->func;
   void *arg = cthread_args->arg;
   // Free our args so that the called function has as much memory as possible.
@@ -249,28 +419,106 @@ void *posix_c_threads_create_wrapper(void* wrapper_args) {
 }
 
 int thrd_create(thrd_t *thr, thrd_start_t func, void *arg) {
+  return thrd_create_ex(thr, NULL, func, arg);
+}
+
+void thrd_attr_init(thrd_attr_t *attr) {
+  if (attr != NULL) {
+    attr->cpus = NULL;
+    attr->num_cpus = 0;
+    attr->numa_node = -1;
+    attr->stack_size = 0;
+    attr->name = NULL;
+  }
+}
+
+int thrd_create_ex(thrd_t *thr, const thrd_attr_t *attr,
+  thrd_start_t func, void *arg
+) {
   if (thr == NULL) {
     return thrd_error;
   }
-
+  
   int returnValue = thrd_success;
   
   call_once(&thrd_msg_q_storage_initialized, thrd_msg_q_storage_init);
   
   PthreadCreateWrapperArgs *wrapper_args
-    = (PthreadCreateWrapperArgs*) malloc(sizeof(PthreadCreateWrapperArgs));
+    = (PthreadCreateWrapperArgs*) calloc(1, sizeof(PthreadCreateWrapperArgs));
   if (wrapper_args == NULL) {
     return thrd_error;
   }
   
   wrapper_args->func = func;
   wrapper_args->arg = arg;
+  wrapper_args->numa_node = -1;
   
-  returnValue = pthread_create(thr, NULL,
-    posix_c_threads_create_wrapper, wrapper_args);
+  pthread_attr_t pthread_attr;
+  pthread_attr_t *pthread_attr_p = NULL;
+  if (attr != NULL) {
+    pthread_attr_init(&pthread_attr);
+    pthread_attr_p = &pthread_attr;
+    
+    if (attr->stack_size > 0) {
+      size_t stack_size = attr->stack_size;
+      if (stack_size < (size_t) PTHREAD_STACK_MIN) {
+        stack_size = (size_t) PTHREAD_STACK_MIN;
+      }
+      if (pthread_attr_setstacksize(&pthread_attr, stack_size) != 0) {
+        returnValue = thrd_error;
+      }
+    }
+    
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    int num_cpus = 0;
+    if ((attr->cpus != NULL) && (attr->num_cpus > 0)) {
+      for (size_t ii = 0; ii < attr->num_cpus; ii++) {
+        if ((attr->cpus[ii] < 0) || (attr->cpus[ii] >= CPU_SETSIZE)) {
+          returnValue = thrd_error;
+          break;
+        }
+        CPU_SET(attr->cpus[ii], &cpu_set);
+        num_cpus++;
+      }
+    }
+    if (attr->numa_node >= 0) {
+      if (attr->numa_node >= THRD_MAX_NUMA_NODES) {
+        returnValue = thrd_error;
+      } else if (num_cpus == 0) {
+        num_cpus = posix_c_threads_node_cpus(attr->numa_node, &cpu_set);
+        if (num_cpus == 0) {
+          // No such node.
+          returnValue = thrd_error;
+        }
+      }
+      wrapper_args->numa_node = attr->numa_node;
+    }
+    if ((num_cpus > 0) && (pthread_attr_setaffinity_np(
+      &pthread_attr, sizeof(cpu_set), &cpu_set) != 0)
+    ) {
+      returnValue = thrd_error;
+    }
+#endif // __linux__
+    
+    if (attr->name != NULL) {
+      strncpy(wrapper_args->name, attr->name, sizeof(wrapper_args->name) - 1);
+    }
+  }
   
-  if (returnValue != 0) {
-    returnValue = thrd_error;
+  if (returnValue == thrd_success) {
+    returnValue = pthread_create(thr, pthread_attr_p,
+      posix_c_threads_create_wrapper, wrapper_args);
+    if (returnValue != 0) {
+      returnValue = thrd_error;
+    }
+  }
+  if (pthread_attr_p != NULL) {
+    pthread_attr_destroy(pthread_attr_p);
+  }
+  
+  if (returnValue != thrd_success) {
     free(wrapper_args); wrapper_args = NULL;
   }
   
@@ -300,7 +548,7 @@ int thrd_equal(thrd_t thr0, thrd_t thr1) {
 void thrd_exit(int res) {
   // Destroy the message queue for this thread.
   thrd_msg_q_destroy(NULL);
-
+  
   pthread_exit((void*) ((intptr_t) res));
 }
 
@@ -442,5 +690,201 @@ int cnd_wait(cnd_t *cond, mtx_t *mtx) {
   return returnValue;
 }
 
+// Light mutex and condition support.
+#ifdef __linux__
+
+// Number of times lmtx_lock retries a held lock before going to sleep.
+#define LMTX_SPIN_COUNT 100
+
+#if defined(__x86_64__) || defined(__i386__)
+#define lmtxPause() __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#define lmtxPause() __asm__ __volatile__("yield")
+#else
+#define lmtxPause() do {} while (0)
+#endif
+
+static inline long lmtxFutex(
+  void *address, int operation, int value, const struct timespec *ts
+) {
+  return syscall(SYS_futex, address, operation | FUTEX_PRIVATE_FLAG,
+    value, ts, NULL, FUTEX_BITSET_MATCH_ANY);
+}
+
+/// @fn static inline void lmtxLockContended(lmtx_t *lmtx)
+///
+/// @brief Take a light mutex, sleeping for as long as it's held.  The state is
+/// left at 2 because there's no way to know whether other threads are still
+/// sleeping on it, which costs at most one unnecessary wake on unlock.
+///
+/// @param lmtx A pointer to the lmtx_t to lock.
+///
+/// @return This function returns no value.
+static inline void lmtxLockContended(lmtx_t *lmtx) {
+  while (__atomic_exchange_n(&lmtx->state, 2, __ATOMIC_ACQUIRE) != 0) {
+    lmtxFutex(&lmtx->state, FUTEX_WAIT, 2, NULL);
+  }
+}
+
+int lmtx_init(lmtx_t *lmtx) {
+  if (lmtx == NULL) {
+    return thrd_error;
+  }
+  
+  __atomic_store_n(&lmtx->state, 0, __ATOMIC_RELEASE);
+  return thrd_success;
+}
+
+int lmtx_lock(lmtx_t *lmtx) {
+  int expected = 0;
+  if (__atomic_compare_exchange_n(&lmtx->state, &expected, 1,
+    false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)
+  ) {
+    return thrd_success;
+  }
+  
+  // Most critical sections are short, so it's usually cheaper to wait for the
+  // holder to finish than to go to sleep.
+  for (int ii = 0; ii < LMTX_SPIN_COUNT; ii++) {
+    lmtxPause();
+    expected = 0;
+    if ((__atomic_load_n(&lmtx->state, __ATOMIC_RELAXED) == 0)
+      && __atomic_compare_exchange_n(&lmtx->state, &expected, 1,
+        false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)
+    ) {
+      return thrd_success;
+    }
+  }
+  
+  lmtxLockContended(lmtx);
+  return thrd_success;
+}
+
+int lmtx_trylock(lmtx_t *lmtx) {
+  int expected = 0;
+  if (__atomic_compare_exchange_n(&lmtx->state, &expected, 1,
+    false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)
+  ) {
+    return thrd_success;
+  }
+  
+  return thrd_busy;
+}
+
+int lmtx_unlock(lmtx_t *lmtx) {
+  if (__atomic_exchange_n(&lmtx->state, 0, __ATOMIC_RELEASE) == 2) {
+    lmtxFutex(&lmtx->state, FUTEX_WAKE, 1, NULL);
+  }
+  
+  return thrd_success;
+}
+
+void lmtx_destroy(lmtx_t *lmtx) {
+  (void) lmtx;
+  // No-op.  Light mutexes hold no resources.
+}
+
+int lcnd_init(lcnd_t *cond) {
+  if (cond == NULL) {
+    return thrd_error;
+  }
+  
+  __atomic_store_n(&cond->sequence, 0, __ATOMIC_RELEASE);
+  return thrd_success;
+}
+
+int lcnd_signal(lcnd_t *cond) {
+  __atomic_add_fetch(&cond->sequence, 1, __ATOMIC_RELEASE);
+  lmtxFutex(&cond->sequence, FUTEX_WAKE, 1, NULL);
+  return thrd_success;
+}
+
+int lcnd_broadcast(lcnd_t *cond) {
+  __atomic_add_fetch(&cond->sequence, 1, __ATOMIC_RELEASE);
+  lmtxFutex(&cond->sequence, FUTEX_WAKE, INT_MAX, NULL);
+  return thrd_success;
+}
+
+int lcnd_wait(lcnd_t *cond, lmtx_t *lmtx) {
+  // The sequence is read while the mutex is held, so any signal sent after the
+  // mutex is released changes it and keeps the futex from sleeping.
+  unsigned int sequence = __atomic_load_n(&cond->sequence, __ATOMIC_RELAXED);
+  lmtx_unlock(lmtx);
+  lmtxFutex(&cond->sequence, FUTEX_WAIT, (int) sequence, NULL);
+  lmtxLockContended(lmtx);
+  
+  return thrd_success;
+}
+
+int lcnd_timedwait(lcnd_t *cond, lmtx_t *lmtx, const struct timespec *ts) {
+  int returnValue = thrd_success;
+  
+  unsigned int sequence = __atomic_load_n(&cond->sequence, __ATOMIC_RELAXED);
+  lmtx_unlock(lmtx);
+  // FUTEX_WAIT_BITSET takes an absolute time, which is what ts is.
+  if ((lmtxFutex(&cond->sequence, FUTEX_WAIT_BITSET | FUTEX_CLOCK_REALTIME,
+    (int) sequence, ts) != 0) && (errno == ETIMEDOUT)
+  ) {
+    returnValue = thrd_timedout;
+  }
+  lmtxLockContended(lmtx);
+  
+  return returnValue;
+}
+
+void lcnd_destroy(lcnd_t *cond) {
+  (void) cond;
+  // No-op.  Light conditions hold no resources.
+}
+
+#else // __linux__
+
+// There's no portable futex, so fall back to the plain pthread primitives.
+int lmtx_init(lmtx_t *lmtx) {
+  return mtx_init(lmtx, mtx_plain);
+}
+
+int lmtx_lock(lmtx_t *lmtx) {
+  return mtx_lock(lmtx);
+}
+
+int lmtx_trylock(lmtx_t *lmtx) {
+  return mtx_trylock(lmtx);
+}
+
+int lmtx_unlock(lmtx_t *lmtx) {
+  return mtx_unlock(lmtx);
+}
+
+void lmtx_destroy(lmtx_t *lmtx) {
+  mtx_destroy(lmtx);
+}
+
+int lcnd_init(lcnd_t *cond) {
+  return cnd_init(cond);
+}
+
+int lcnd_signal(lcnd_t *cond) {
+  return cnd_signal(cond);
+}
+
+int lcnd_broadcast(lcnd_t *cond) {
+  return cnd_broadcast(cond);
+}
+
+int lcnd_wait(lcnd_t *cond, lmtx_t *lmtx) {
+  return cnd_wait(cond, lmtx);
+}
+
+int lcnd_timedwait(lcnd_t *cond, lmtx_t *lmtx, const struct timespec *ts) {
+  return cnd_timedwait(cond, lmtx, ts);
+}
+
+void lcnd_destroy(lcnd_t *cond) {
+  cnd_destroy(cond);
+}
+
+#endif // __linux__
+
 #endif // _MSC_VER
 
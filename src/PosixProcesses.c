@@ -33,6 +33,8 @@
 #include "PosixProcesses.h"
 #include "DirectoryLib.h"
 #include "StringLib.h"
+#include "Coroutines.h"
+#include "TimeUtils.h"
 #include <string.h>
 #include <errno.h>
 #include <sys/types.h>
@@ -41,6 +43,25 @@
 #include <fcntl.h>
 #include <time.h>
 #include <signal.h>
+#include <poll.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif // __linux__
+#ifdef POSIX_PROCESSES_SPAWN
+#include <spawn.h>
+#endif // POSIX_PROCESSES_SPAWN
+
+/// @def POSIX_PROCESSES_READ_CHUNK
+///
+/// @brief The minimum amount of free space to make available in an output
+/// buffer before each read from a process's pipe.
+#define POSIX_PROCESSES_READ_CHUNK 4096
+
+/// @def POSIX_PROCESSES_POLL_STACK_FDS
+///
+/// @brief The number of pollfd structures processPoll keeps on the stack.
+/// Waits on more processes than fit here allocate the array instead.
+#define POSIX_PROCESSES_POLL_STACK_FDS 48
 
 
 /// @fn char** posixProcessesFreeArgArray(char **args)
@@ -291,16 +312,209 @@ char** posixProcessesStringToArgs(const char *parseString) {
   return argArray;
 }
 
-/// @fn bool startPosixProcess(const char *args, uint32_t *processId, FILE **readFile, FILE **writeFile, const char* workingDirectory, char* environmentVariables[])
+/// @fn static void posixProcessesPrintPipeError(void)
+///
+/// @brief Print the reason that a call to pipe() failed.
+///
+/// @return This function returns no value.
+static void posixProcessesPrintPipeError(void) {
+  if (errno == EFAULT) {
+    fprintf(stderr, "pipefd is not valid.\n");
+  } else if (errno == EINVAL) {
+    fprintf(stderr, "(pipe2()) Invalid value in flags.\n");
+  } else if (errno == EMFILE) {
+    fprintf(stderr,
+      "The per-process limit on the number of open file descriptors "
+      "has been reached.\n");
+  } else if (errno == ENFILE) {
+    fprintf(stderr,
+      "The system-wide limit on the total number of open files "
+      "has been reached.\n");
+  } else {
+    fprintf(stderr, "Unknown error in pipe().\n");
+  }
+}
+
+/// @fn static void posixProcessesClosePipes(int pipes[][2], int numPipes)
+///
+/// @brief Close both ends of every open pipe in an array of pipes.  Ends that
+/// are not open must be -1.
+///
+/// @param pipes The array of pipes to close.
+/// @param numPipes The number of pipes in the array.
+///
+/// @return This function returns no value.
+static void posixProcessesClosePipes(int pipes[][2], int numPipes) {
+  for (int ii = 0; ii < numPipes; ii++) {
+    for (int jj = 0; jj < 2; jj++) {
+      if (pipes[ii][jj] >= 0) {
+        close(pipes[ii][jj]);
+        pipes[ii][jj] = -1;
+      }
+    }
+  }
+}
+
+#ifdef POSIX_PROCESSES_SPAWN
+/// @fn static pid_t posixProcessesSpawn(char **argArray, int pipes[][2], const char *workingDirectory, char *environmentVariables[])
+///
+/// @brief Launch a child process with posix_spawn.
+///
+/// @details glibc implements posix_spawn with a clone() that shares the
+/// parent's memory until the exec, so unlike fork() the cost does not grow
+/// with the size of the parent's address space.  Everything that the fork()
+/// path does in the child is expressed as a spawn attribute or file action
+/// instead.
+///
+/// @param argArray The NULL-terminated program path and arguments.
+/// @param pipes The stdin, stdout, and stderr pipes.  If the stderr pipe is
+///   not open, stderr goes to the stdout pipe.
+/// @param workingDirectory The working directory for the child, NULL to use
+///   the parent's.
+/// @param environmentVariables The environment for the child.
+///
+/// @return Returns the process ID of the child on success, -1 on failure.
+static pid_t posixProcessesSpawn(char **argArray, int pipes[][2],
+  const char *workingDirectory, char *environmentVariables[]
+) {
+  const int stdIn  = 0;
+  const int stdOut = 1;
+  const int stdErr = 2;
+  posix_spawn_file_actions_t fileActions;
+  posix_spawnattr_t attributes;
+  pid_t processId = -1;
+  
+  if (posix_spawn_file_actions_init(&fileActions) != 0) {
+    fprintf(stderr, "startPosixProcess(): Could not initialize file actions.\n");
+    return processId; // -1
+  }
+  if (posix_spawnattr_init(&attributes) != 0) {
+    fprintf(stderr, "startPosixProcess(): Could not initialize attributes.\n");
+    posix_spawn_file_actions_destroy(&fileActions);
+    return processId; // -1
+  }
+  
+  // Make the child's process id the process group leader.
+  posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+  posix_spawnattr_setpgroup(&attributes, 0);
+  
+  if (workingDirectory != NULL) {
+    posix_spawn_file_actions_addchdir_np(&fileActions, workingDirectory);
+  }
+  posix_spawn_file_actions_adddup2(&fileActions, pipes[stdIn][0], stdIn);
+  posix_spawn_file_actions_adddup2(&fileActions, pipes[stdOut][1], stdOut);
+  posix_spawn_file_actions_adddup2(&fileActions,
+    (pipes[stdErr][1] >= 0) ? pipes[stdErr][1] : pipes[stdOut][1], stdErr);
+  // Close any other file descriptors we inherited from the parent.
+  posix_spawn_file_actions_addclosefrom_np(&fileActions, 3);
+  
+  int status = posix_spawn(&processId, argArray[0], &fileActions, &attributes,
+    argArray, environmentVariables);
+  if (status != 0) {
+    fprintf(stderr, "startPosixProcess(): posix_spawn(%s) failed!\n",
+      argArray[0]);
+    fprintf(stderr, "[ERROR] %s\n", strerror(status));
+    processId = -1;
+  }
+  
+  posix_spawnattr_destroy(&attributes);
+  posix_spawn_file_actions_destroy(&fileActions);
+  return processId;
+}
+#else
+/// @fn static pid_t posixProcessesFork(char **argArray, int pipes[][2], const char *workingDirectory, char *environmentVariables[])
+///
+/// @brief Launch a child process with fork() and execve().  Used where
+/// posix_spawn cannot do everything the child needs.
+///
+/// @param argArray The NULL-terminated program path and arguments.
+/// @param pipes The stdin, stdout, and stderr pipes.  If the stderr pipe is
+///   not open, stderr goes to the stdout pipe.
+/// @param workingDirectory The working directory for the child, NULL to use
+///   the parent's.
+/// @param environmentVariables The environment for the child.
+///
+/// @return Returns the process ID of the child on success, -1 on failure.
+static pid_t posixProcessesFork(char **argArray, int pipes[][2],
+  const char *workingDirectory, char *environmentVariables[]
+) {
+  const int stdIn  = 0;
+  const int stdOut = 1;
+  const int stdErr = 2;
+  
+  pid_t processId = fork();
+  if (processId == 0) {
+    // We are the child.
+    // This process will become the process to run.  Setup and go.
+    // Note that this portion should not produce log output of any level since
+    // it will be almost guaranteed to mangle the log file.  If we must have
+    // log output, it should be ONLY at the DEBUG level.
+    if (workingDirectory != NULL) {
+      if (chdir(workingDirectory) != 0) {
+        perror("chdir to working directory failed");
+      }
+    }
+    
+    // Make our process id the process group leader.
+    setpgid(0, 0);
+    
+    fflush(stdout);
+    fflush(stderr);
+    
+    // Set up new file descriptors for stdin, stdout, stderr
+    if (dup2(pipes[stdIn][0], stdIn) < 0) {
+      perror("dup of stdin for pipe failed");
+    }
+    if (dup2(pipes[stdOut][1], stdOut) < 0) {
+      perror("dup of stdout for pipe failed");
+    }
+    if (dup2((pipes[stdErr][1] >= 0) ? pipes[stdErr][1] : pipes[stdOut][1],
+      stdErr) < 0
+    ) {
+      perror("dup of stderr for pipe failed");
+    }
+    
+    // Close any other file descriptors we inherited from the parent.
+    for (int i = 3; i < FD_SETSIZE; i++) {
+      close(i);
+    }
+    
+    execve(argArray[0], argArray, environmentVariables);
+    
+    // If we get this far then the command above failed.
+    // Since we forked above, continuing on will spawn off more instances
+    // of the Test Client.  Exit to avoid that scenario.
+    fprintf(stderr, "startPosixProcess(): execve(%s) failed!\n", argArray[0]);
+    fprintf(stderr, "[ERROR] %s\n", strerror(errno));
+    // Use _exit so that stdio buffers copied from the parent aren't flushed a
+    // second time.
+    _exit(1);
+  } else if (processId < 0) { // fork() failed.  Major system problem.
+    fprintf(stderr, "startPosixProcess(): fork() failed\n");
+  }
+  
+  return processId;
+}
+#endif // POSIX_PROCESSES_SPAWN
+
+/// @fn bool startPosixProcess(const char *args, uint32_t *processId, FILE **readFile, FILE **writeFile, FILE **errorFile, const char* workingDirectory, char* environmentVariables[])
 ///
 /// @brief Start a process and set up file descriptors for read-write access.
 ///
+/// @details Where posix_spawn can do everything the child needs (see
+/// POSIX_PROCESSES_SPAWN in PosixProcesses.h), the process is launched with
+/// it instead of fork() so that starting a helper from a large parent does
+/// not have to copy the parent's page tables.
+///
 /// @param args is an unparsed string containing the name of the program to
 ///   run and the arguments with which to call it.  It will be parsed by this
 ///   function.
 /// @param processId is the PID of the process that is started upon success
 /// @param readFile is the FILE object used to read data from the program
 /// @param writeFile is the FILE object used to write data to the program
+/// @param errorFile is the FILE object used to read the program's stderr.  If
+///   this is NULL, the program's stderr goes to readFile along with its
+///   stdout.
 /// @param workingDirectory The full path to the working directory for the
 ///   child process.  A value of NULL will use the parent's working directory
 /// @param environmentVariables A NULL-terminated, one-dimensional array of
@@ -310,125 +524,83 @@ char** posixProcessesStringToArgs(const char *parseString) {
 /// @return Returns true on success, false otherwise
 bool startPosixProcess(
   const char *args, uint32_t *processId, FILE **readFile, FILE **writeFile,
-  const char* workingDirectory, char* environmentVariables[]
+  FILE **errorFile, const char* workingDirectory, char* environmentVariables[]
 ) {
-  char **argArray = posixProcessesStringToArgs(args);
-  
-  int  pipeId[2];
-  bool returnValue = false;
   const int stdIn  = 0;
   const int stdOut = 1;
   const int stdErr = 2;
   
-  if (pipe(pipeId) >= 0) {
-    *processId = fork();
-    if (*processId > 0) {
-      // We are the parent.
-      int flags = 0;
-      
-      *readFile = fdopen(pipeId[stdIn], "r");
-      flags = fcntl(fileno(*readFile), F_GETFL, 0);
-      flags |= O_NONBLOCK;
-      fcntl(fileno(*readFile), F_SETFL, flags);
-      
-      *writeFile = fdopen(pipeId[stdOut], "w");
-      flags = fcntl(fileno(*readFile), F_GETFL, 0);
-      flags |= O_NONBLOCK;
-      fcntl(fileno(*readFile), F_SETFL, flags);
-      
-      returnValue = true;
-    } else if (*processId == 0) {
-      // We are the child.
-      // This process will become the process to run.  Setup and go.
-      // Note that this portion should not produce log output of any level since
-      // it will be almost guaranteed to mangle the log file.  If we must have
-      // log output, it should be ONLY at the DEBUG level.
-      if (workingDirectory != NULL) {
-        chdir(workingDirectory);
-      }
-      
-      bool dupSucceeded = true;
-      
-      // Make our process id the process group leader.
-      setpgid(0, 0);
-      
-      fflush(stdout);
-      fflush(stderr);
-      
-      // Set up new file descriptors for stdin, stdout, stderr
-      close(stdIn);
-      if (dup(pipeId[stdIn]) < 0) {
-        dupSucceeded = false;
-        perror("dup of stdin for pipe failed");
-      }
-      close(stdOut);
-      if (dup(pipeId[stdOut]) < 0) {
-        dupSucceeded = false;
-        perror("dup of stdout for pipe failed");
-      }
-      close(stdErr);
-      if (dup(pipeId[stdOut]) < 0) { // stderr goes to stdout
-        dupSucceeded = false;
-        perror("dup of stderr for pipe failed");
-      }
-      
-      if (dupSucceeded == true) {
-        // Close these since we dup()'ed what we needed.
-        close(pipeId[stdIn]);
-        close(pipeId[stdOut]);
-      }
-      
-      // Close any other file descriptors we inherited from the parent.
-      for (int i = 3; i < FD_SETSIZE; i++) {
-        int fd = dup(i);
-        if (fd >= 0) {
-          close(fd);
-          close(i);
-        }
-      }
-      
-      if (argArray == NULL) {
-        // Parsing the command failed.  Alert the parent and exit.
-        fprintf(stderr, "Could not parse command line \"%s\".\n", args);
-        fprintf(stderr, "Exiting.\n");
-        exit(1);
-      }
-      
-      execve(argArray[0], argArray, environmentVariables);
-      
-      // If we get this far then the command above failed.
-      // Since we forked above, continuing on will spawn off more instances
-      // of the Test Client.  Exit to avoid that scenario.
-      fprintf(stderr, "startPosixProcess(): execve(%s) failed!\n", argArray[0]);
-      fprintf(stderr, "[ERROR] %s\n", strerror(errno));
-      argArray = posixProcessesFreeArgArray(argArray);
-      exit(1);
-    } else { // fork() failed.  Major system problem.
-      close(pipeId[stdIn]);
-      close(pipeId[stdOut]);
-      fprintf(stderr, "startPosixProcess(): fork() failed\n");
+  char **argArray = posixProcessesStringToArgs(args);
+  if (argArray == NULL) {
+    fprintf(stderr, "Could not parse command line \"%s\".\n", args);
+    return false;
+  }
+  
+  // One pipe each for the child's stdin, stdout, and stderr.
+  int pipes[3][2] = { { -1, -1 }, { -1, -1 }, { -1, -1 } };
+  for (int ii = stdIn; ii <= stdErr; ii++) {
+    if ((ii == stdErr) && (errorFile == NULL)) {
+      break;
     }
-  } else {
-    // We couldn't create a pipe.  Why?
-    if (errno == EFAULT) {
-      fprintf(stderr, "pipefd is not valid.\n");
-    } else if (errno == EINVAL) {
-      fprintf(stderr, "(pipe2()) Invalid value in flags.\n");
-    } else if (errno == EMFILE) {
-      fprintf(stderr,
-        "The per-process limit on the number of open file descriptors "
-        "has been reached.\n");
-    } else if (errno == ENFILE) {
-      fprintf(stderr,
-        "The system-wide limit on the total number of open files "
-        "has been reached.\n");
-    } else {
-      fprintf(stderr, "Unknown error in pipe().\n");
+    if (pipe(pipes[ii]) < 0) {
+      // We couldn't create a pipe.  Why?
+      posixProcessesPrintPipeError();
+      posixProcessesClosePipes(pipes, 3);
+      argArray = posixProcessesFreeArgArray(argArray);
+      return false;
     }
   }
   
+#ifdef POSIX_PROCESSES_SPAWN
+  pid_t childId = posixProcessesSpawn(argArray, pipes, workingDirectory,
+    environmentVariables);
+#else
+  pid_t childId = posixProcessesFork(argArray, pipes, workingDirectory,
+    environmentVariables);
+#endif // POSIX_PROCESSES_SPAWN
   argArray = posixProcessesFreeArgArray(argArray);
-  return returnValue;
+  if (childId <= 0) {
+    posixProcessesClosePipes(pipes, 3);
+    return false;
+  }
+  
+  // We are the parent.  Close the child's ends of the pipes and wrap ours.
+  *processId = (uint32_t) childId;
+  close(pipes[stdIn][0]);
+  close(pipes[stdOut][1]);
+  
+  *readFile = fdopen(pipes[stdOut][0], "r");
+  fcntl(pipes[stdOut][0], F_SETFL,
+    fcntl(pipes[stdOut][0], F_GETFL, 0) | O_NONBLOCK);
+  
+  *writeFile = fdopen(pipes[stdIn][1], "w");
+  
+  if (errorFile != NULL) {
+    close(pipes[stdErr][1]);
+    *errorFile = fdopen(pipes[stdErr][0], "r");
+    fcntl(pipes[stdErr][0], F_SETFL,
+      fcntl(pipes[stdErr][0], F_GETFL, 0) | O_NONBLOCK);
+  }
+  
+  return true;
+}
+
+/// @fn static int posixProcessesOpenPidFd(pid_t processId)
+///
+/// @brief Open a pidfd for a child process so that its exit can be waited on
+/// with poll along with its pipes.
+///
+/// @param processId The PID of the child process.
+///
+/// @return Returns the pidfd on success, -1 if pidfds are not supported.
+static int posixProcessesOpenPidFd(pid_t processId) {
+#if defined(__linux__) && defined(SYS_pidfd_open)
+  // pidfd_open always sets close-on-exec on the new descriptor.
+  return (int) syscall(SYS_pidfd_open, processId, 0);
+#else
+  (void) processId;
+  return -1;
+#endif // __linux__ && SYS_pidfd_open
 }
 
 /// @var environ
@@ -437,7 +609,7 @@ bool startPosixProcess(
 /// name=value format.
 extern char **environ;
 
-/// @fn Process* startProcess_(const char *commandLineArgs, const char *workingDirectory, char *environmentVariables[], ...)
+/// @fn Process* startProcess_(const char *commandLineArgs, const char *workingDirectory, char *environmentVariables[], bool separateStderr, ...)
 ///
 /// @brief Start a process specified by a command and its arguments.
 ///
@@ -448,23 +620,35 @@ extern char **environ;
 /// @param environmentVariables A NULL-terminated, one-dimensional array of
 ///   environment variables and their values in "name=value" format.  A value
 ///   of NULL will use the parent's environment variables.
+/// @param separateStderr Whether the process's stderr should be read through
+///   its own pipe with readProcessStderr (true) or mixed in with its stdout
+///   (false).
 /// @param ... All further parameters are ignored.
 ///
 /// @return Returnss a pointer to a Process instance on success,
 /// NULL on failure.
 Process* startProcess_(const char* commandLineArgs,
-  const char *workingDirectory, char *environmentVariables[], ...
+  const char *workingDirectory, char *environmentVariables[],
+  bool separateStderr, ...
 ) {
   Process *returnValue = (Process*) calloc(1, sizeof(Process));
+  if (returnValue == NULL) {
+    return NULL;
+  }
+  returnValue->pidFd = -1;
   if (environmentVariables == NULL) {
     environmentVariables = environ;
   }
   if (!startPosixProcess(commandLineArgs, &returnValue->processId,
     &returnValue->stdOut, &returnValue->stdIn,
+    (separateStderr == true) ? &returnValue->stdErr : NULL,
     workingDirectory, environmentVariables)
   ) {
     // Could not start the process.
     free(returnValue); returnValue = NULL;
+  } else {
+    returnValue->pidFd
+      = posixProcessesOpenPidFd((pid_t) returnValue->processId);
   }
   
   return returnValue;
@@ -482,11 +666,12 @@ bool processHasExited(Process *process) {
     return true;
   }
   
-  if (process->processStatus == 0) {
+  if (process->exited == false) {
     // Collect the status.
     if (waitpid(process->processId, &process->processStatus, WNOHANG) <= 0) {
       return false;
     }
+    process->exited = true;
   }
 
   // Check the state of the process and report accordingly.
@@ -512,49 +697,62 @@ int processExitStatus(Process *process) {
   return WEXITSTATUS(process->processStatus);
 }
 
-/// @fn char* readProcessStdout_(Process *process, uint64_t *outputLength, ...)
+/// @fn static char* posixProcessesReadPipe(FILE *pipeFile, uint64_t *outputLength)
 ///
-/// @brief Read from a process's stdout pipe until the pipe is empty.
+/// @brief Read from one of a process's output pipes until the pipe is empty.
 ///
-/// @param process A pointer to a Process instance.
+/// @param pipeFile The FILE object for the pipe.
 /// @param outputLength A pointer to a uint64_t value that will hold the length
 ///   of the returned output.
-/// @param ... All further parameters are ignored.
 ///
-/// @return Returns a Bytes object with the contents of the process's stdout
-/// on success, NULL on failure.
-char* readProcessStdout_(Process *process, uint64_t *outputLength, ...) {
-  uint32_t bufferSize = 4096;
+/// @return Returns a Bytes object with the contents of the pipe on success,
+/// NULL on failure.
+static char* posixProcessesReadPipe(FILE *pipeFile, uint64_t *outputLength) {
   char *processOutput = NULL;
   size_t processOutputLength = 0;
-  
-  char tempBuffer[4096];
+  size_t processOutputSize = 0;
   
   // In the event that the user has given us a bad command to run, we
-  // might wind up in a situation where fread blocks forever.  Need to
-  // put the file descriptor in non-blocking mode to avoid this.
-  // JBC 2020-09-24
-  int fd = fileno(process->stdOut);
+  // might wind up in a situation where a read blocks forever.
+  // startPosixProcess puts the read ends of the pipes in non-blocking mode to
+  // avoid this, so read straight from the descriptor until it's empty.
+  int fd = fileno(pipeFile);
   
-  size_t numBytesRead = 0;
-  do {
-    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
-    numBytesRead = fread(tempBuffer, 1, bufferSize, process->stdOut);
-    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
-    if (numBytesRead > 0) {
-      void* check = realloc(processOutput,
-        processOutputLength + (size_t) numBytesRead + 1);
+  while (true) {
+    if (processOutputSize - processOutputLength
+      < POSIX_PROCESSES_READ_CHUNK + 1
+    ) {
+      // Grow geometrically so that large outputs don't realloc per chunk.
+      size_t newSize = (processOutputSize == 0)
+        ? POSIX_PROCESSES_READ_CHUNK + 1
+        : processOutputSize << 1;
+      void* check = realloc(processOutput, newSize);
       if (check == NULL) {
         // Memory allocation failure.  Just fail.
         free(processOutput);
         return NULL;
       }
       processOutput = (char*) check;
-      memcpy(&processOutput[processOutputLength], tempBuffer, numBytesRead);
+      processOutputSize = newSize;
+    }
+    
+    ssize_t numBytesRead = read(fd, &processOutput[processOutputLength],
+      processOutputSize - processOutputLength - 1);
+    if (numBytesRead > 0) {
       processOutputLength += (size_t) numBytesRead;
-      processOutput[processOutputLength] = '\0';
+    } else if ((numBytesRead < 0) && (errno == EINTR)) {
+      continue;
+    } else {
+      // Either the pipe is empty (EAGAIN) or the writer has closed it.
+      break;
     }
-  } while (numBytesRead > 0);
+  }
+  
+  if (processOutputLength == 0) {
+    free(processOutput); processOutput = NULL;
+  } else {
+    processOutput[processOutputLength] = '\0';
+  }
   
   if (outputLength != NULL) {
     *outputLength = (uint64_t) processOutputLength;
@@ -562,6 +760,357 @@ char* readProcessStdout_(Process *process, uint64_t *outputLength, ...) {
   return processOutput;
 }
 
+/// @fn static i64 posixProcessesReadPipeBytes(FILE *pipeFile, Bytes *output)
+///
+/// @brief Append everything currently available in one of a process's output
+/// pipes to a Bytes object.
+///
+/// @param pipeFile The FILE object for the pipe.
+/// @param output A pointer to the Bytes object to append to.  *output may be
+///   NULL, in which case it will be allocated.
+///
+/// @return Returns the number of bytes appended, 0 if no data was available,
+/// or -1 if the pipe has reached end of file with nothing left to read or an
+/// error occurred.
+static i64 posixProcessesReadPipeBytes(FILE *pipeFile, Bytes *output) {
+  if ((pipeFile == NULL) || (output == NULL)) {
+    return -1;
+  }
+  
+  int fd = fileno(pipeFile);
+  i64 totalRead = 0;
+  while (true) {
+    u64 length = bytesLength(*output);
+    if (bytesAllocate(output, length + POSIX_PROCESSES_READ_CHUNK) == NULL) {
+      return -1;
+    }
+    
+    // bytesAllocate always leaves room for the terminating null byte.
+    ssize_t numBytesRead = read(fd, &(*output)[length],
+      bytesSize(*output) - length - 1);
+    if (numBytesRead > 0) {
+      length += (u64) numBytesRead;
+      bytesSetLength(*output, length);
+      (*output)[length] = '\0';
+      totalRead += (i64) numBytesRead;
+    } else if (numBytesRead == 0) {
+      // End of file.  Report the data we got first, if any.
+      return (totalRead > 0) ? totalRead : -1;
+    } else if (errno == EINTR) {
+      continue;
+    } else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+      return totalRead;
+    } else {
+      return (totalRead > 0) ? totalRead : -1;
+    }
+  }
+}
+
+/// @fn char* readProcessStdout_(Process *process, uint64_t *outputLength, ...)
+///
+/// @brief Read from a process's stdout pipe until the pipe is empty.
+///
+/// @param process A pointer to a Process instance.
+/// @param outputLength A pointer to a uint64_t value that will hold the length
+///   of the returned output.
+/// @param ... All further parameters are ignored.
+///
+/// @return Returns a Bytes object with the contents of the process's stdout
+/// on success, NULL on failure.
+char* readProcessStdout_(Process *process, uint64_t *outputLength, ...) {
+  return posixProcessesReadPipe(process->stdOut, outputLength);
+}
+
+/// @fn char* readProcessStderr_(Process *process, uint64_t *outputLength, ...)
+///
+/// @brief Read from a process's stderr pipe until the pipe is empty.  Only
+/// available for processes started with separateStderr set to true.
+///
+/// @param process A pointer to a Process instance.
+/// @param outputLength A pointer to a uint64_t value that will hold the length
+///   of the returned output.
+/// @param ... All further parameters are ignored.
+///
+/// @return Returns a Bytes object with the contents of the process's stderr
+/// on success, NULL on failure.
+char* readProcessStderr_(Process *process, uint64_t *outputLength, ...) {
+  if ((process == NULL) || (process->stdErr == NULL)) {
+    if (outputLength != NULL) {
+      *outputLength = 0;
+    }
+    return NULL;
+  }
+  
+  return posixProcessesReadPipe(process->stdErr, outputLength);
+}
+
+/// @fn i64 processReadStdoutBytes(Process *process, Bytes *output)
+///
+/// @brief Append everything currently available on a process's stdout to a
+/// Bytes object without blocking.
+///
+/// @param process A pointer to a Process instance.
+/// @param output A pointer to the Bytes object to append to.  *output may be
+///   NULL, in which case it will be allocated.
+///
+/// @return Returns the number of bytes appended, 0 if no data was available,
+/// or -1 once the process has closed its stdout and all of it has been read
+/// (or on error).
+i64 processReadStdoutBytes(Process *process, Bytes *output) {
+  if (process == NULL) {
+    return -1;
+  }
+  
+  return posixProcessesReadPipeBytes(process->stdOut, output);
+}
+
+/// @fn i64 processReadStderrBytes(Process *process, Bytes *output)
+///
+/// @brief Append everything currently available on a process's separate
+/// stderr to a Bytes object without blocking.  Only available for processes
+/// started with separateStderr set to true.
+///
+/// @param process A pointer to a Process instance.
+/// @param output A pointer to the Bytes object to append to.  *output may be
+///   NULL, in which case it will be allocated.
+///
+/// @return Returns the number of bytes appended, 0 if no data was available,
+/// or -1 once the process has closed its stderr and all of it has been read
+/// (or on error).
+i64 processReadStderrBytes(Process *process, Bytes *output) {
+  if (process == NULL) {
+    return -1;
+  }
+  
+  return posixProcessesReadPipeBytes(process->stdErr, output);
+}
+
+/// @fn static int posixProcessesPollOnce(Process **processes, int *events, const int *wantedEvents, u32 numProcesses, struct pollfd *pollFds, int timeoutMilliseconds)
+///
+/// @brief Make one pass of poll over the pipes and pidfds of a set of
+/// processes.
+///
+/// @param processes The array of processes to check.
+/// @param events The array that receives the events that are ready, one
+///   element per process.
+/// @param wantedEvents The caller's requested events, one per process.
+/// @param numProcesses The number of elements in processes and events.
+/// @param pollFds Scratch space for at least 3 * numProcesses pollfds.
+/// @param timeoutMilliseconds The maximum number of milliseconds to block in
+///   poll, 0 to not block, or a negative value to block indefinitely.
+///
+/// @return Returns the number of processes with ready events, 0 on timeout,
+/// -1 on error.
+static int posixProcessesPollOnce(Process **processes, int *events,
+  const int *wantedEvents, u32 numProcesses, struct pollfd *pollFds,
+  int timeoutMilliseconds
+) {
+  nfds_t numFds = 0;
+  int numReady = 0;
+  
+  for (u32 ii = 0; ii < numProcesses; ii++) {
+    Process *process = processes[ii];
+    int wanted = wantedEvents[ii];
+    events[ii] = 0;
+    if ((process == NULL) || (wanted == 0)) {
+      continue;
+    }
+    
+    if ((wanted & PROCESS_EXITED)
+      && ((process->pidFd < 0) || (process->exited == true)
+        || (process->killed == true))
+      && (processHasExited(process) == true)
+    ) {
+      // No pidfd to wait on (or already collected).  Without a pidfd, the
+      // child closing its end of stdout wakes the poll below and the next
+      // pass collects the status here.
+      events[ii] |= PROCESS_EXITED;
+    }
+    
+    if ((wanted & PROCESS_STDOUT_READY) && (process->stdOut != NULL)) {
+      pollFds[numFds].fd = fileno(process->stdOut);
+      pollFds[numFds].events = POLLIN;
+      pollFds[numFds].revents = 0;
+      numFds++;
+    }
+    if ((wanted & PROCESS_STDERR_READY) && (process->stdErr != NULL)) {
+      pollFds[numFds].fd = fileno(process->stdErr);
+      pollFds[numFds].events = POLLIN;
+      pollFds[numFds].revents = 0;
+      numFds++;
+    }
+    if ((wanted & PROCESS_EXITED) && (process->pidFd >= 0)
+      && ((events[ii] & PROCESS_EXITED) == 0)
+    ) {
+      pollFds[numFds].fd = process->pidFd;
+      pollFds[numFds].events = POLLIN;
+      pollFds[numFds].revents = 0;
+      numFds++;
+    }
+    
+    if (events[ii] != 0) {
+      numReady++;
+    }
+  }
+  
+  if (numReady > 0) {
+    // Something is already known to be ready.  Don't block.
+    timeoutMilliseconds = 0;
+  } else if (numFds == 0) {
+    // Nothing to wait on at all.
+    return 0;
+  }
+  
+  int pollResult = 0;
+  do {
+    pollResult = poll(pollFds, numFds, timeoutMilliseconds);
+  } while ((pollResult < 0) && (errno == EINTR));
+  if (pollResult < 0) {
+    return -1;
+  }
+  
+  // Walk the descriptors in the same order they were added.
+  nfds_t fdIndex = 0;
+  numReady = 0;
+  for (u32 ii = 0; ii < numProcesses; ii++) {
+    Process *process = processes[ii];
+    int wanted = wantedEvents[ii];
+    if ((process == NULL) || (wanted == 0)) {
+      continue;
+    }
+    
+    if ((wanted & PROCESS_STDOUT_READY) && (process->stdOut != NULL)) {
+      if (pollFds[fdIndex++].revents != 0) {
+        events[ii] |= PROCESS_STDOUT_READY;
+      }
+    }
+    if ((wanted & PROCESS_STDERR_READY) && (process->stdErr != NULL)) {
+      if (pollFds[fdIndex++].revents != 0) {
+        events[ii] |= PROCESS_STDERR_READY;
+      }
+    }
+    if ((wanted & PROCESS_EXITED) && (process->pidFd >= 0)
+      && ((events[ii] & PROCESS_EXITED) == 0)
+    ) {
+      if ((pollFds[fdIndex++].revents != 0)
+        && (processHasExited(process) == true)
+      ) {
+        events[ii] |= PROCESS_EXITED;
+      }
+    }
+    
+    if (events[ii] != 0) {
+      numReady++;
+    }
+  }
+  
+  return numReady;
+}
+
+/// @fn int processPoll(Process **processes, int *events, u32 numProcesses, int timeoutMilliseconds)
+///
+/// @brief Wait for output or exit on any of a set of child processes.
+///
+/// @details This multiplexes many children from one thread.  On Linux, a
+/// process's exit is waited on through its pidfd.  Elsewhere, exit is noticed
+/// when the child closes its stdout and its status is collected with waitpid.
+/// When called from a Coroutine that can yield, the coroutine yields between
+/// non-blocking checks so that other coroutines on the thread keep running.
+/// Otherwise, the calling thread blocks in poll.
+///
+/// @param processes The array of processes to wait on.  NULL elements are
+///   ignored.
+/// @param events The array of events to wait for, one element per process,
+///   made of PROCESS_STDOUT_READY, PROCESS_STDERR_READY, and PROCESS_EXITED.
+///   On return, each element holds the events that are ready for that
+///   process.  Elements of 0 are ignored.
+/// @param numProcesses The number of elements in processes and events.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait, 0 to
+///   not wait at all, or a negative value to wait indefinitely.
+///
+/// @return Returns the number of processes with ready events, 0 on timeout,
+/// -1 on error.
+int processPoll(Process **processes, int *events, u32 numProcesses,
+  int timeoutMilliseconds
+) {
+  if ((processes == NULL) || (events == NULL) || (numProcesses == 0)) {
+    return -1;
+  }
+  
+  struct pollfd stackPollFds[POSIX_PROCESSES_POLL_STACK_FDS];
+  struct pollfd *pollFds = stackPollFds;
+  int stackWantedEvents[POSIX_PROCESSES_POLL_STACK_FDS / 3];
+  int *wantedEvents = stackWantedEvents;
+  if (numProcesses > (POSIX_PROCESSES_POLL_STACK_FDS / 3)) {
+    pollFds = (struct pollfd*) malloc(
+      ((size_t) numProcesses) * 3 * sizeof(struct pollfd));
+    wantedEvents = (int*) malloc(((size_t) numProcesses) * sizeof(int));
+    if ((pollFds == NULL) || (wantedEvents == NULL)) {
+      if (pollFds != stackPollFds) {
+        free(pollFds);
+      }
+      if (wantedEvents != stackWantedEvents) {
+        free(wantedEvents);
+      }
+      return -1;
+    }
+  }
+  memcpy(wantedEvents, events, ((size_t) numProcesses) * sizeof(int));
+  
+  // The first (main) coroutine of a thread is the only one on the running list
+  // that has no next coroutine.  It can't yield, so it has to block.
+  Coroutine *running = getRunningCoroutine();
+  bool canYield = (running != NULL) && (running->nextInList != NULL)
+    && (timeoutMilliseconds != 0);
+  int64_t deadline = -1;
+  if (timeoutMilliseconds > 0) {
+    deadline = getMonotonicNanoseconds()
+      + (((int64_t) timeoutMilliseconds) * ((int64_t) 1000000));
+  }
+  
+  int numReady = 0;
+  while (true) {
+    numReady = posixProcessesPollOnce(processes, events, wantedEvents,
+      numProcesses, pollFds, (canYield == true) ? 0 : timeoutMilliseconds);
+    if ((numReady != 0) || (canYield == false)
+      || ((deadline >= 0) && (getMonotonicNanoseconds() >= deadline))
+    ) {
+      break;
+    }
+    coroutineYield((deadline >= 0) ? COROUTINE_TIMEDWAIT : COROUTINE_WAIT);
+  }
+  
+  if (pollFds != stackPollFds) {
+    free(pollFds);
+  }
+  if (wantedEvents != stackWantedEvents) {
+    free(wantedEvents);
+  }
+  
+  return numReady;
+}
+
+/// @fn int processWait(Process *process, int events, int timeoutMilliseconds)
+///
+/// @brief Wait for output or exit on a single child process.  See processPoll
+/// for details.
+///
+/// @param process A pointer to a Process instance.
+/// @param events The PROCESS_STDOUT_READY, PROCESS_STDERR_READY, and/or
+///   PROCESS_EXITED events to wait for.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait, 0 to
+///   not wait at all, or a negative value to wait indefinitely.
+///
+/// @return Returns the ready events on success, 0 on timeout, -1 on error.
+int processWait(Process *process, int events, int timeoutMilliseconds) {
+  int numReady = processPoll(&process, &events, 1, timeoutMilliseconds);
+  if (numReady <= 0) {
+    return numReady;
+  }
+  
+  return events;
+}
+
 /// @fn bool writeProcessStdin_(Process *process, const char *data, uint64_t dataLength, ...)
 ///
 /// @brief Write to a process's stdin pipe.
@@ -594,6 +1143,12 @@ Process* closeProcess(Process *process) {
   process->processId = 0;
   fclose(process->stdOut); process->stdOut = NULL;
   fclose(process->stdIn); process->stdIn = NULL;
+  if (process->stdErr != NULL) {
+    fclose(process->stdErr); process->stdErr = NULL;
+  }
+  if (process->pidFd >= 0) {
+    close(process->pidFd); process->pidFd = -1;
+  }
   free(process); process = NULL;
   
   return NULL;
@@ -37,20 +37,27 @@
 #define logFile stderr
 #endif
 
-/// @fn Queue *queueCreate(TypeDescriptor *dataType)
+#include "LockStats.h"
+
+/// @fn Queue *queueCreate_(TypeDescriptor *dataType, bool pooledNodes, ...)
 ///
 /// @brief Allocate a new Queue data structure.
 ///
 /// @param dataType specifies the kind of data this queue handles.
+/// @param pooledNodes Whether or not to allocate the Queue's nodes from a
+///   NodePool owned by the Queue instead of with a malloc per push.
 ///
 /// @return Returns a pointer to a new Queue data structure.
 ///
 /// @note This implementation uses List as the backing infrastructure.
-Queue *queueCreate(TypeDescriptor *dataType) {
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides false for pooledNodes.
+Queue *queueCreate_(TypeDescriptor *dataType, bool pooledNodes, ...) {
   printLog(TRACE, "ENTER queueCreate(dataType=%s)\n",
     (dataType == NULL) ? "NULL" : dataType->name);
   
-  Queue *queue = (Queue*) listCreate(dataType);
+  Queue *queue = (Queue*) listCreate(dataType, false, pooledNodes);
   
   printLog(TRACE, "EXIT queueCreate(dataType=%s) = {%p}\n",
     (dataType == NULL) ? "NULL" : dataType->name, queue);
@@ -154,6 +161,247 @@ int queueFlush(Queue *queue, int numItems) {
   return 0;
 }
 
+// RingQueue support.
+
+#if defined(_MSC_VER)
+
+#include <intrin.h>
+#define ringQueueLoad(sourceP) \
+  ((u64) InterlockedCompareExchange64((volatile LONG64*) (sourceP), 0, 0))
+#define ringQueueStore(destinationP, value) \
+  InterlockedExchange64((volatile LONG64*) (destinationP), (LONG64) (value))
+#define ringQueueCompareExchange(destinationP, compare, value) \
+  (InterlockedCompareExchange64((volatile LONG64*) (destinationP), \
+    (LONG64) (value), (LONG64) (compare)) == (LONG64) (compare))
+
+#else
+
+#define ringQueueLoad(sourceP) __atomic_load_n(sourceP, __ATOMIC_ACQUIRE)
+#define ringQueueStore(destinationP, value) \
+  __atomic_store_n(destinationP, value, __ATOMIC_RELEASE)
+static inline bool ringQueueCompareExchange(
+  u64 *destinationP, u64 compare, u64 value
+) {
+  return __atomic_compare_exchange_n(destinationP, &compare, value,
+    false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+#endif // _MSC_VER
+
+/// @fn RingQueue* ringQueueCreate(TypeDescriptor *dataType, u64 capacity, RingQueueMode mode)
+///
+/// @brief Allocate a new RingQueue.
+///
+/// @param dataType The TypeDescriptor of the items in the queue.  Items are
+///   copied with its copy function when pushed and destroyed with its destroy
+///   function if they're still in the queue when it's destroyed.  Use a NoCopy
+///   type to hand pointers off without copying them.
+/// @param capacity The maximum number of items the queue can hold.  Rounded up
+///   to the next power of two.
+/// @param mode RING_QUEUE_SPSC if only one thread will ever push and only one
+///   thread will ever pop, RING_QUEUE_MPMC otherwise.
+///
+/// @return Returns a pointer to a new RingQueue on success, NULL on failure.
+RingQueue* ringQueueCreate(TypeDescriptor *dataType, u64 capacity,
+  RingQueueMode mode
+) {
+  printLog(TRACE,
+    "ENTER ringQueueCreate(dataType=%s, capacity=%llu, mode=%d)\n",
+    (dataType == NULL) ? "NULL" : dataType->name, llu(capacity), mode);
+  
+  if ((dataType == NULL) || (capacity == 0) || (mode >= NUM_RING_QUEUE_MODES)
+    || (capacity > (((u64) 1) << 62))
+  ) {
+    printLog(TRACE, "EXIT ringQueueCreate(dataType=%s, capacity=%llu, "
+      "mode=%d) = {NULL}\n", (dataType == NULL) ? "NULL" : dataType->name,
+      llu(capacity), mode);
+    return NULL;
+  }
+  
+  u64 roundedCapacity = 1;
+  while (roundedCapacity < capacity) {
+    roundedCapacity <<= 1;
+  }
+  
+  RingQueue *ringQueue = (RingQueue*)
+    allocatorCalloc(ALLOCATOR_QUEUE, NULL, 1, sizeof(RingQueue));
+  if (ringQueue == NULL) {
+    return NULL;
+  }
+  ringQueue->slots = (RingQueueSlot*) allocatorCalloc(
+    ALLOCATOR_QUEUE, NULL, roundedCapacity, sizeof(RingQueueSlot));
+  if (ringQueue->slots == NULL) {
+    ringQueue = (RingQueue*) allocatorFree(ALLOCATOR_QUEUE, NULL, ringQueue);
+    return NULL;
+  }
+  for (u64 ii = 0; ii < roundedCapacity; ii++) {
+    ringQueue->slots[ii].sequence = ii;
+  }
+  ringQueue->mask = roundedCapacity - 1;
+  ringQueue->mode = mode;
+  ringQueue->dataType = dataType;
+  
+  printLog(TRACE, "EXIT ringQueueCreate(dataType=%s, capacity=%llu, mode=%d) "
+    "= {%p}\n", dataType->name, llu(capacity), mode, ringQueue);
+  return ringQueue;
+}
+
+/// @fn bool ringQueuePush(RingQueue *ringQueue, const volatile void *data)
+///
+/// @brief Push a copy of a data item onto the back of a RingQueue.
+///
+/// @param ringQueue The RingQueue to push data to.
+/// @param data The data item to push.  Must not be NULL.
+///
+/// @return Returns true on success, false if the queue is full or on error.
+/// On failure, the queue does not keep a copy of data.
+bool ringQueuePush(RingQueue *ringQueue, const volatile void *data) {
+  printLog(TRACE, "ENTER ringQueuePush(ringQueue=%p, data=%p)\n",
+    ringQueue, data);
+  
+  if ((ringQueue == NULL) || (data == NULL)) {
+    printLog(TRACE, "EXIT ringQueuePush(ringQueue=%p, data=%p) = {false}\n",
+      ringQueue, data);
+    return false;
+  }
+  
+  RingQueueSlot *slot = NULL;
+  u64 position = ringQueueLoad(&ringQueue->tail);
+  while (1) {
+    slot = &ringQueue->slots[position & ringQueue->mask];
+    u64 sequence = ringQueueLoad(&slot->sequence);
+    i64 difference = (i64) (sequence - position);
+    if (difference == 0) {
+      if (ringQueue->mode == RING_QUEUE_SPSC) {
+        // We're the only producer, so nobody else can claim this slot.
+        ringQueueStore(&ringQueue->tail, position + 1);
+        break;
+      } else if (ringQueueCompareExchange(
+        &ringQueue->tail, position, position + 1)
+      ) {
+        break;
+      }
+      position = ringQueueLoad(&ringQueue->tail);
+    } else if (difference < 0) {
+      // The slot still holds an item from one lap ago.  The queue is full.
+      printLog(TRACE, "EXIT ringQueuePush(ringQueue=%p, data=%p) = {false}\n",
+        ringQueue, data);
+      return false;
+    } else {
+      // Another producer got here first.
+      position = ringQueueLoad(&ringQueue->tail);
+    }
+  }
+  
+  // The slot is ours until we publish it by advancing its sequence.  Copying
+  // after claiming it means a full queue never wastes a copy.
+  slot->data = ringQueue->dataType->copy(data);
+  ringQueueStore(&slot->sequence, position + 1);
+  
+  printLog(TRACE, "EXIT ringQueuePush(ringQueue=%p, data=%p) = {true}\n",
+    ringQueue, data);
+  return true;
+}
+
+/// @fn void* ringQueuePop(RingQueue *ringQueue)
+///
+/// @brief Remove the item at the front of a RingQueue and return it.
+///
+/// @param ringQueue The RingQueue to pop from.
+///
+/// @return Returns the item at the front of the queue, which the caller now
+/// owns, on success.  Returns NULL if the queue is empty or on error.
+void* ringQueuePop(RingQueue *ringQueue) {
+  printLog(TRACE, "ENTER ringQueuePop(ringQueue=%p)\n", ringQueue);
+  
+  if (ringQueue == NULL) {
+    printLog(TRACE, "EXIT ringQueuePop(ringQueue=NULL) = {NULL}\n");
+    return NULL;
+  }
+  
+  RingQueueSlot *slot = NULL;
+  u64 position = ringQueueLoad(&ringQueue->head);
+  while (1) {
+    slot = &ringQueue->slots[position & ringQueue->mask];
+    u64 sequence = ringQueueLoad(&slot->sequence);
+    i64 difference = (i64) (sequence - (position + 1));
+    if (difference == 0) {
+      if (ringQueue->mode == RING_QUEUE_SPSC) {
+        ringQueueStore(&ringQueue->head, position + 1);
+        break;
+      } else if (ringQueueCompareExchange(
+        &ringQueue->head, position, position + 1)
+      ) {
+        break;
+      }
+      position = ringQueueLoad(&ringQueue->head);
+    } else if (difference < 0) {
+      // Nothing has been published in this slot yet.  The queue is empty.
+      printLog(TRACE, "EXIT ringQueuePop(ringQueue=%p) = {NULL}\n",
+        ringQueue);
+      return NULL;
+    } else {
+      // Another consumer got here first.
+      position = ringQueueLoad(&ringQueue->head);
+    }
+  }
+  
+  void *returnValue = slot->data;
+  slot->data = NULL;
+  // Free the slot for the producer one lap from now.
+  ringQueueStore(&slot->sequence, position + ringQueue->mask + 1);
+  
+  printLog(TRACE, "EXIT ringQueuePop(ringQueue=%p) = {%p}\n",
+    ringQueue, returnValue);
+  return returnValue;
+}
+
+/// @fn u64 ringQueueLength(RingQueue *ringQueue)
+///
+/// @brief Get the number of items in a RingQueue.  With concurrent pushes and
+/// pops in progress, this is only a snapshot.
+///
+/// @param ringQueue The RingQueue to examine.
+///
+/// @return Returns the number of items in the queue, 0 if ringQueue is NULL.
+u64 ringQueueLength(RingQueue *ringQueue) {
+  if (ringQueue == NULL) {
+    return 0;
+  }
+  
+  // Read head first so that a pop between the two loads can't make the length
+  // appear negative.
+  u64 head = ringQueueLoad(&ringQueue->head);
+  u64 tail = ringQueueLoad(&ringQueue->tail);
+  return (tail > head) ? tail - head : 0;
+}
+
+/// @fn RingQueue* ringQueueDestroy(RingQueue *ringQueue)
+///
+/// @brief Deallocate a RingQueue and destroy any items still in it.  No other
+/// thread may be using the queue.
+///
+/// @param ringQueue The RingQueue to deallocate.
+///
+/// @return Always returns NULL.
+RingQueue* ringQueueDestroy(RingQueue *ringQueue) {
+  printLog(TRACE, "ENTER ringQueueDestroy(ringQueue=%p)\n", ringQueue);
+  
+  if (ringQueue != NULL) {
+    void *data = NULL;
+    while ((data = ringQueuePop(ringQueue)) != NULL) {
+      ringQueue->dataType->destroy(data);
+    }
+    ringQueue->slots = (RingQueueSlot*)
+      allocatorFree(ALLOCATOR_QUEUE, NULL, ringQueue->slots);
+    ringQueue = (RingQueue*) allocatorFree(ALLOCATOR_QUEUE, NULL, ringQueue);
+  }
+  
+  printLog(TRACE, "EXIT ringQueueDestroy(ringQueue=%p) = {NULL}\n",
+    ringQueue);
+  return NULL;
+}
+
 /// @var typeQueue
 ///
 /// @brief TypeDescriptor describing how libraries should interact with
@@ -165,7 +413,7 @@ TypeDescriptor _typeQueue = {
   .toString      = (char* (*)(const volatile void*)) listToString,
   .toBytes       = (Bytes (*)(const volatile void*)) listToBytes,
   .compare       = (int (*)(const volatile void*, const volatile void*)) listCompare,
-  .create        = (void* (*)(const volatile void*, ...)) queueCreate,
+  .create        = (void* (*)(const volatile void*, ...)) queueCreate_,
   .copy          = (void* (*)(const volatile void*)) listCopy,
   .destroy       = (void* (*)(volatile void*)) queueDestroy,
   .size          = listSize,
@@ -175,6 +423,9 @@ TypeDescriptor _typeQueue = {
   .clear         = (i32 (*)(volatile void *)) listClear,
   .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) listToXml_,
   .toJson        = (Bytes (*)(const volatile void*)) listToJson,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) listToJsonStream,
+  .blobSize      = (u64 (*)(const volatile void*)) listToBlobSize,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) listToBlobBuffer,
 };
 TypeDescriptor *typeQueue = &_typeQueue;
 
@@ -196,7 +447,7 @@ TypeDescriptor _typeQueueNoCopy = {
   .toString      = (char* (*)(const volatile void*)) listToString,
   .toBytes       = (Bytes (*)(const volatile void*)) listToBytes,
   .compare       = (int (*)(const volatile void*, const volatile void*)) listCompare,
-  .create        = (void* (*)(const volatile void*, ...)) queueCreate,
+  .create        = (void* (*)(const volatile void*, ...)) queueCreate_,
   .copy          = (void* (*)(const volatile void*)) shallowCopy,
   .destroy       = (void* (*)(volatile void*)) nullFunction,
   .size          = listSize,
@@ -206,9 +457,153 @@ TypeDescriptor _typeQueueNoCopy = {
   .clear         = (i32 (*)(volatile void *)) listClear,
   .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) listToXml_,
   .toJson        = (Bytes (*)(const volatile void*)) listToJson,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) listToJsonStream,
+  .blobSize      = (u64 (*)(const volatile void*)) listToBlobSize,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) listToBlobBuffer,
 };
 TypeDescriptor *typeQueueNoCopy = &_typeQueueNoCopy;
 
+/// @def RING_QUEUE_TEST_ITEMS_PER_THREAD
+///
+/// @brief The number of items each producer thread pushes in the RingQueue
+/// unit test.
+#define RING_QUEUE_TEST_ITEMS_PER_THREAD 20000
+
+/// @def RING_QUEUE_TEST_NUM_PRODUCERS
+///
+/// @brief The number of producer threads in the MPMC RingQueue unit test.
+#define RING_QUEUE_TEST_NUM_PRODUCERS 4
+
+/// @fn static int ringQueueTestProducer(void *arg)
+///
+/// @brief Producer thread for the RingQueue unit test.  Pushes
+/// RING_QUEUE_TEST_ITEMS_PER_THREAD distinct values onto the queue, retrying
+/// whenever it's full.
+///
+/// @param arg The RingQueue to push onto.
+///
+/// @return Always returns 0.
+static int ringQueueTestProducer(void *arg) {
+  RingQueue *ringQueue = (RingQueue*) arg;
+  
+  // The values only need to be unique non-NULL pointers.
+  for (uintptr_t ii = 1; ii <= RING_QUEUE_TEST_ITEMS_PER_THREAD; ii++) {
+    while (ringQueuePush(ringQueue, (void*) ii) == false) {
+      thrd_yield();
+    }
+  }
+  
+  return 0;
+}
+
+/// @def RING_QUEUE_UNIT_TEST
+///
+/// @brief Unit test for RingQueue functionality.
+///
+/// @return Returns true on success, false on failure.
+#define RING_QUEUE_UNIT_TEST \
+static bool ringQueueUnitTest() { \
+  printLog(INFO, "Testing RingQueue data structure.\n"); \
+ \
+  if (ringQueueCreate(typeString, 0, RING_QUEUE_SPSC) != NULL) { \
+    printLog(ERR, "Expected NULL RingQueue for zero capacity.\n"); \
+    return false; \
+  } \
+  if (ringQueuePush(NULL, "one") == true) { \
+    printLog(ERR, "Pushing onto a NULL RingQueue succeeded.\n"); \
+    return false; \
+  } \
+  if (ringQueuePop(NULL) != NULL) { \
+    printLog(ERR, "Popping a NULL RingQueue returned data.\n"); \
+    return false; \
+  } \
+ \
+  RingQueue *ringQueue = ringQueueCreate(typeString, 3, RING_QUEUE_SPSC); \
+  if (ringQueueCapacity(ringQueue) != 4) { \
+    printLog(ERR, "Expected capacity 4, got %llu.\n", \
+      llu(ringQueueCapacity(ringQueue))); \
+    return false; \
+  } \
+  const char *words[] = {"one", "two", "three", "four"}; \
+  for (int lap = 0; lap < 3; lap++) { \
+    for (int ii = 0; ii < 4; ii++) { \
+      if (ringQueuePush(ringQueue, words[ii]) == false) { \
+        printLog(ERR, "Could not push \"%s\" on lap %d.\n", words[ii], lap); \
+        return false; \
+      } \
+    } \
+    if (ringQueuePush(ringQueue, "five") == true) { \
+      printLog(ERR, "Pushing onto a full RingQueue succeeded.\n"); \
+      return false; \
+    } \
+    if (ringQueueLength(ringQueue) != 4) { \
+      printLog(ERR, "Expected 4 items, found %llu.\n", \
+        llu(ringQueueLength(ringQueue))); \
+      return false; \
+    } \
+    for (int ii = 0; ii < 4; ii++) { \
+      char *word = (char*) ringQueuePop(ringQueue); \
+      if ((word == NULL) || (strcmp(word, words[ii]) != 0)) { \
+        printLog(ERR, "Expected \"%s\" from RingQueue, got \"%s\".\n", \
+          words[ii], (word == NULL) ? "NULL" : word); \
+        return false; \
+      } \
+      if (word == words[ii]) { \
+        printLog(ERR, "RingQueue did not copy \"%s\".\n", words[ii]); \
+        return false; \
+      } \
+      word = stringDestroy(word); \
+    } \
+    if (ringQueuePop(ringQueue) != NULL) { \
+      printLog(ERR, "Popping an empty RingQueue returned data.\n"); \
+      return false; \
+    } \
+  } \
+  printLog(INFO, "Destroying RingQueue with items in it.\n"); \
+  ringQueuePush(ringQueue, "one"); \
+  ringQueuePush(ringQueue, "two"); \
+  ringQueue = ringQueueDestroy(ringQueue); \
+ \
+  for (int mode = 0; mode < NUM_RING_QUEUE_MODES; mode++) { \
+    int numProducers = (mode == RING_QUEUE_SPSC) \
+      ? 1 : RING_QUEUE_TEST_NUM_PRODUCERS; \
+    printLog(INFO, "Testing %d-producer RingQueue.\n", numProducers); \
+    ringQueue = ringQueueCreate(typePointerNoCopy, 64, (RingQueueMode) mode); \
+    thrd_t producers[RING_QUEUE_TEST_NUM_PRODUCERS]; \
+    for (int ii = 0; ii < numProducers; ii++) { \
+      thrd_create(&producers[ii], ringQueueTestProducer, ringQueue); \
+    } \
+    u64 numItems = 0; \
+    u64 sum = 0; \
+    u64 expectedItems \
+      = ((u64) numProducers) * RING_QUEUE_TEST_ITEMS_PER_THREAD; \
+    while (numItems < expectedItems) { \
+      uintptr_t value = (uintptr_t) ringQueuePop(ringQueue); \
+      if (value == 0) { \
+        thrd_yield(); \
+        continue; \
+      } \
+      sum += value; \
+      numItems++; \
+    } \
+    for (int ii = 0; ii < numProducers; ii++) { \
+      thrd_join(producers[ii], NULL); \
+    } \
+    u64 expectedSum = ((u64) numProducers) \
+      * ((((u64) RING_QUEUE_TEST_ITEMS_PER_THREAD) \
+      * (RING_QUEUE_TEST_ITEMS_PER_THREAD + 1)) / 2); \
+    if ((sum != expectedSum) || (ringQueuePop(ringQueue) != NULL)) { \
+      printLog(ERR, "Expected sum %llu, got %llu.\n", \
+        llu(expectedSum), llu(sum)); \
+      return false; \
+    } \
+    ringQueue = ringQueueDestroy(ringQueue); \
+  } \
+ \
+  return true; \
+}
+RING_QUEUE_UNIT_TEST
+
 /// @def QUEUE_UNIT_TEST
 ///
 /// @brief Unit test for queue functionality.
@@ -349,6 +744,10 @@ bool queueUnitTest() { \
     printLog(ERR, "Expected NULL queue, but got non-NULL queue.\n"); \
     return false; \
   } \
+ \
+  if (ringQueueUnitTest() == false) { \
+    return false; \
+  } \
  \
   return true; \
 }
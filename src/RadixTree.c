@@ -29,6 +29,11 @@
 /// @file
 
 #include "RadixTree.h"
+#include "Allocator.h"
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #ifdef DS_LOGGING_ENABLED
 #include "LoggingLib.h"
 #else
@@ -43,6 +48,13 @@
 
 #define exchangePointer(destinationPointerP, sourcePointer) \
   InterlockedExchangePointer(destinationPointerP, sourcePointer)
+// Volatile reads have acquire semantics with the Microsoft compilers.
+#define loadPointer(sourcePointerP) (*(sourcePointerP))
+#define atomicLoad64(valueP) InterlockedOr64(valueP, 0)
+#define atomicIncrement64(valueP) InterlockedIncrement64(valueP)
+#define atomicDecrement64(valueP) InterlockedDecrement64(valueP)
+#define compareExchange64(destinationP, source, compare) \
+  InterlockedCompareExchange64(destinationP, source, compare)
 #define compareExchangePointer( \
     destinationPointerP, sourcePointer, comparePointer) \
   InterlockedCompareExchangePointer( \
@@ -52,6 +64,22 @@
 
 #define exchangePointer(destinationPointerP, sourcePointer) \
   __atomic_exchange_n(destinationPointerP, sourcePointer, __ATOMIC_SEQ_CST)
+#define loadPointer(sourcePointerP) \
+  __atomic_load_n(sourcePointerP, __ATOMIC_ACQUIRE)
+#define atomicLoad64(valueP) __atomic_load_n(valueP, __ATOMIC_SEQ_CST)
+#define atomicIncrement64(valueP) \
+  __atomic_add_fetch(valueP, 1, __ATOMIC_SEQ_CST)
+#define atomicDecrement64(valueP) \
+  __atomic_sub_fetch(valueP, 1, __ATOMIC_SEQ_CST)
+static inline int64_t compareExchange64(volatile int64_t *destinationP,
+  int64_t source, int64_t compare
+) {
+  __atomic_compare_exchange_n(destinationP, &compare, source,
+    false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+
+  // As with compareExchangePointer, compare now holds the original value.
+  return compare;
+}
 static inline void* compareExchangePointer(
   void * volatile *destinationPointerP,
   void *sourcePointer, void *comparePointer
@@ -71,34 +99,1146 @@ static inline void* compareExchangePointer(
   
 #endif
 
-/// @fn RadixTree* radixTreeCreate(tss_dtor_t destructor)
+// Adaptive radix tree support.
+
+/// @fn static inline RADIX_TREE_KEY_ELEMENT radixTreeKeyElement(
+///          const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys,
+///          size_t depth)
+///
+/// @brief Get the element of a key that is examined at a given depth of an
+/// adaptive tree.
+///
+/// @details The key is searched from its most-significant end, just like the
+/// search of a RadixTreeNode tree.  See radixTreeNodeGetValue for why.
+///
+/// @param key A pointer to the key elements.
+/// @param numKeys The number of elements in the key.
+/// @param depth The number of key elements already examined.  Must be less
+///   than numKeys.
+///
+/// @return Returns the key element at the specified depth.
+static inline RADIX_TREE_KEY_ELEMENT radixTreeKeyElement(
+  const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys, size_t depth
+) {
+  return key[numKeys - 1 - depth];
+}
+
+/// @fn static inline RadixTreeAdaptiveNode* radixTreeAdaptiveFindChild(
+///          const RadixTreeAdaptiveNode *node,
+///          RADIX_TREE_KEY_ELEMENT keyElement)
+///
+/// @brief Find the child of an inner node for a key element.
+///
+/// @param node A pointer to an inner node of an adaptive tree.
+/// @param keyElement The key element of the child to find.
+///
+/// @return Returns the child on success, NULL if there is no such child.
+static inline RadixTreeAdaptiveNode* radixTreeAdaptiveFindChild(
+  const RadixTreeAdaptiveNode *node, RADIX_TREE_KEY_ELEMENT keyElement
+) {
+  switch (node->type) {
+    case RADIX_TREE_NODE4:
+      {
+        const RadixTreeNode4 *node4 = (const RadixTreeNode4*) node;
+        for (uint16_t ii = 0; ii < node->numChildren; ii++) {
+          if (node4->keys[ii] == keyElement) {
+            return node4->children[ii];
+          }
+        }
+      }
+      break;
+    case RADIX_TREE_NODE16:
+      {
+        const RadixTreeNode16 *node16 = (const RadixTreeNode16*) node;
+#ifdef __SSE2__
+        // Compare all 16 keys at once.
+        __m128i matches = _mm_cmpeq_epi8(
+          _mm_set1_epi8((char) keyElement),
+          _mm_loadu_si128((const __m128i*) node16->keys));
+        unsigned int mask = ((unsigned int) _mm_movemask_epi8(matches))
+          & ((1U << node->numChildren) - 1);
+        if (mask != 0) {
+          return node16->children[__builtin_ctz(mask)];
+        }
+#else
+        for (uint16_t ii = 0; ii < node->numChildren; ii++) {
+          if (node16->keys[ii] == keyElement) {
+            return node16->children[ii];
+          } else if (node16->keys[ii] > keyElement) {
+            break;
+          }
+        }
+#endif
+      }
+      break;
+    case RADIX_TREE_NODE48:
+      {
+        const RadixTreeNode48 *node48 = (const RadixTreeNode48*) node;
+        uint8_t childIndex = node48->childIndexes[keyElement];
+        if (childIndex != 0) {
+          return node48->children[childIndex - 1];
+        }
+      }
+      break;
+    case RADIX_TREE_NODE256:
+      return ((const RadixTreeNode256*) node)->children[keyElement];
+    default:
+      break;
+  }
+
+  return NULL;
+}
+
+/// @fn static inline RadixTreeAdaptiveNode* radixTreeAdaptiveNextChild(
+///          const RadixTreeAdaptiveNode *node, unsigned int *position,
+///          RADIX_TREE_KEY_ELEMENT *keyElement)
+///
+/// @brief Iterate over the children of an inner node in key element order.
+///
+/// @param node A pointer to an inner node of an adaptive tree.
+/// @param position A pointer to the iteration state.  This must be 0 for the
+///   first call and is updated by every call.
+/// @param keyElement A pointer to the storage for the key element of the child
+///   returned.
+///
+/// @return Returns the next child on success, NULL when there are no more.
+static inline RadixTreeAdaptiveNode* radixTreeAdaptiveNextChild(
+  const RadixTreeAdaptiveNode *node, unsigned int *position,
+  RADIX_TREE_KEY_ELEMENT *keyElement
+) {
+  RadixTreeAdaptiveNode *child = NULL;
+
+  switch (node->type) {
+    case RADIX_TREE_NODE4:
+      if (*position < node->numChildren) {
+        *keyElement = ((const RadixTreeNode4*) node)->keys[*position];
+        child = ((const RadixTreeNode4*) node)->children[*position];
+        (*position)++;
+      }
+      break;
+    case RADIX_TREE_NODE16:
+      if (*position < node->numChildren) {
+        *keyElement = ((const RadixTreeNode16*) node)->keys[*position];
+        child = ((const RadixTreeNode16*) node)->children[*position];
+        (*position)++;
+      }
+      break;
+    case RADIX_TREE_NODE48:
+    case RADIX_TREE_NODE256:
+      for (; (*position < RADIX_TREE_ARRAY_SIZE) && (child == NULL);
+        (*position)++
+      ) {
+        *keyElement = (RADIX_TREE_KEY_ELEMENT) *position;
+        child = radixTreeAdaptiveFindChild(node, *keyElement);
+      }
+      break;
+    default:
+      break;
+  }
+
+  return child;
+}
+
+/// @fn static RadixTreeAdaptiveNode* radixTreeAdaptiveNodeCreate(
+///          unsigned int numChildren, size_t prefixLength,
+///          RadixTreeLeaf *leaf)
+///
+/// @brief Allocate an inner node with the smallest layout that can hold the
+/// specified number of children.
+///
+/// @param numChildren The number of children the node will hold.
+/// @param prefixLength The number of key elements to compress into the node.
+///   The caller must fill in the prefix.
+/// @param leaf The leaf of the key that ends at the node, if any.
+///
+/// @return Returns a pointer to the new node, which has no children yet, on
+/// success, NULL on failure.
+static RadixTreeAdaptiveNode* radixTreeAdaptiveNodeCreate(
+  unsigned int numChildren, size_t prefixLength, RadixTreeLeaf *leaf
+) {
+  uint8_t type = RADIX_TREE_NODE256;
+  size_t nodeSize = sizeof(RadixTreeNode256);
+  if (numChildren <= 4) {
+    type = RADIX_TREE_NODE4;
+    nodeSize = sizeof(RadixTreeNode4);
+  } else if (numChildren <= 16) {
+    type = RADIX_TREE_NODE16;
+    nodeSize = sizeof(RadixTreeNode16);
+  } else if (numChildren <= 48) {
+    type = RADIX_TREE_NODE48;
+    nodeSize = sizeof(RadixTreeNode48);
+  }
+
+  RadixTreeAdaptiveNode *node = (RadixTreeAdaptiveNode*) allocatorCalloc(
+    ALLOCATOR_RADIX_TREE, NULL, 1,
+    nodeSize + (prefixLength * sizeof(RADIX_TREE_KEY_ELEMENT)));
+  if (node == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+
+  node->type = type;
+  node->prefixLength = prefixLength;
+  node->prefix = (RADIX_TREE_KEY_ELEMENT*) (((char*) node) + nodeSize);
+  node->leaf = leaf;
+
+  return node;
+}
+
+/// @fn static void radixTreeAdaptiveNodeAppend(RadixTreeAdaptiveNode *node,
+///          RADIX_TREE_KEY_ELEMENT keyElement, RadixTreeAdaptiveNode *child)
+///
+/// @brief Add a child to a node that is being built.  Children must be added
+/// in increasing key element order and the node must have been created with
+/// room for them.
+///
+/// @param node A pointer to the node being built.
+/// @param keyElement The key element of the child.
+/// @param child A pointer to the child to add.
+///
+/// @return This function returns no value.
+static void radixTreeAdaptiveNodeAppend(RadixTreeAdaptiveNode *node,
+  RADIX_TREE_KEY_ELEMENT keyElement, RadixTreeAdaptiveNode *child
+) {
+  switch (node->type) {
+    case RADIX_TREE_NODE4:
+      ((RadixTreeNode4*) node)->keys[node->numChildren] = keyElement;
+      ((RadixTreeNode4*) node)->children[node->numChildren] = child;
+      break;
+    case RADIX_TREE_NODE16:
+      ((RadixTreeNode16*) node)->keys[node->numChildren] = keyElement;
+      ((RadixTreeNode16*) node)->children[node->numChildren] = child;
+      break;
+    case RADIX_TREE_NODE48:
+      ((RadixTreeNode48*) node)->children[node->numChildren] = child;
+      ((RadixTreeNode48*) node)->childIndexes[keyElement]
+        = (uint8_t) (node->numChildren + 1);
+      break;
+    case RADIX_TREE_NODE256:
+      ((RadixTreeNode256*) node)->children[keyElement] = child;
+      break;
+    default:
+      break;
+  }
+  node->numChildren++;
+}
+
+/// @fn static RadixTreeAdaptiveNode* radixTreeAdaptiveNodeRebuild(
+///          const RadixTreeAdaptiveNode *node, size_t prefixLength,
+///          RadixTreeLeaf *leaf, bool modifyChild,
+///          RADIX_TREE_KEY_ELEMENT keyElement, RadixTreeAdaptiveNode *child)
+///
+/// @brief Create a modified copy of an inner node.  The copy is grown or
+/// shrunk to the layout that fits its new number of children.
+///
+/// @param node A pointer to the inner node to copy.
+/// @param prefixLength The prefix length of the copy.  The caller must fill in
+///   the prefix.
+/// @param leaf The leaf of the key that ends at the copy, if any.
+/// @param modifyChild Whether or not to change the child for keyElement.
+/// @param keyElement The key element of the child to add, replace, or remove.
+/// @param child The new child for keyElement.  NULL removes the child.
+///
+/// @return Returns a pointer to the new node on success, NULL on failure.
+static RadixTreeAdaptiveNode* radixTreeAdaptiveNodeRebuild(
+  const RadixTreeAdaptiveNode *node, size_t prefixLength,
+  RadixTreeLeaf *leaf, bool modifyChild,
+  RADIX_TREE_KEY_ELEMENT keyElement, RadixTreeAdaptiveNode *child
+) {
+  unsigned int numChildren = node->numChildren;
+  if (modifyChild == true) {
+    bool exists = (radixTreeAdaptiveFindChild(node, keyElement) != NULL);
+    if ((exists == false) && (child != NULL)) {
+      numChildren++;
+    } else if ((exists == true) && (child == NULL)) {
+      numChildren--;
+    }
+  }
+
+  RadixTreeAdaptiveNode *newNode
+    = radixTreeAdaptiveNodeCreate(numChildren, prefixLength, leaf);
+  if (newNode == NULL) {
+    return NULL;
+  }
+
+  unsigned int position = 0;
+  RADIX_TREE_KEY_ELEMENT currentKeyElement = 0;
+  RadixTreeAdaptiveNode *currentChild = NULL;
+  while ((currentChild = radixTreeAdaptiveNextChild(
+    node, &position, &currentKeyElement)) != NULL
+  ) {
+    if ((modifyChild == true) && (currentKeyElement >= keyElement)) {
+      if (child != NULL) {
+        radixTreeAdaptiveNodeAppend(newNode, keyElement, child);
+      }
+      modifyChild = false;
+      if (currentKeyElement == keyElement) {
+        continue;
+      }
+    }
+    radixTreeAdaptiveNodeAppend(newNode, currentKeyElement, currentChild);
+  }
+  if ((modifyChild == true) && (child != NULL)) {
+    radixTreeAdaptiveNodeAppend(newNode, keyElement, child);
+  }
+
+  return newNode;
+}
+
+/// @fn static RadixTreeLeaf* radixTreeLeafCreate(
+///          const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys,
+///          volatile void *value)
+///
+/// @brief Allocate a leaf for an adaptive tree.
+///
+/// @param key A pointer to the key elements.
+/// @param numKeys The number of elements in the key.
+/// @param value The value of the leaf.
+///
+/// @return Returns a pointer to the new leaf on success, NULL on failure.
+static RadixTreeLeaf* radixTreeLeafCreate(
+  const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys,
+  volatile void *value
+) {
+  RadixTreeLeaf *leaf = (RadixTreeLeaf*) allocatorCalloc(
+    ALLOCATOR_RADIX_TREE, NULL, 1,
+    sizeof(RadixTreeLeaf) + (numKeys * sizeof(RADIX_TREE_KEY_ELEMENT)));
+  if (leaf == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+
+  leaf->header.type = RADIX_TREE_LEAF;
+  leaf->header.prefixLength = numKeys;
+  leaf->header.prefix
+    = (RADIX_TREE_KEY_ELEMENT*) (((char*) leaf) + sizeof(RadixTreeLeaf));
+  if (numKeys > 0) {
+    memcpy(leaf->header.prefix, (const void*) key,
+      numKeys * sizeof(RADIX_TREE_KEY_ELEMENT));
+  }
+  leaf->value = value;
+
+  return leaf;
+}
+
+/// @fn static RadixTreeLeaf* radixTreeAdaptiveFind(RadixTreeAdaptiveNode *node,
+///          const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys)
+///
+/// @brief Find the leaf for a key in an adaptive tree.
+///
+/// @param node A pointer to the root of the tree or NULL.
+/// @param key A pointer to the key elements.
+/// @param numKeys The number of elements in the key.
+///
+/// @return Returns the leaf for the key if it exists, NULL if not.
+static RadixTreeLeaf* radixTreeAdaptiveFind(RadixTreeAdaptiveNode *node,
+  const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys
+) {
+  size_t depth = 0;
+
+  while (node != NULL) {
+    if (node->type == RADIX_TREE_LEAF) {
+      if ((node->prefixLength == numKeys) && ((numKeys == 0)
+        || (memcmp(node->prefix, (const void*) key,
+          numKeys * sizeof(RADIX_TREE_KEY_ELEMENT)) == 0))
+      ) {
+        return (RadixTreeLeaf*) node;
+      }
+      return NULL;
+    }
+
+    if (node->prefixLength > numKeys - depth) {
+      return NULL;
+    }
+    for (size_t ii = 0; ii < node->prefixLength; ii++) {
+      if (node->prefix[ii] != radixTreeKeyElement(key, numKeys, depth + ii)) {
+        return NULL;
+      }
+    }
+    depth += node->prefixLength;
+
+    if (depth == numKeys) {
+      return node->leaf;
+    }
+    node = radixTreeAdaptiveFindChild(node,
+      radixTreeKeyElement(key, numKeys, depth));
+    depth++;
+  }
+
+  return NULL;
+}
+
+/// @struct RadixTreeAdaptiveUpdate
+///
+/// @brief The nodes touched while building a new version of an adaptive tree.
+///
+/// @var created The nodes allocated for the new version.  These are freed if
+///   the new version cannot be published.
+/// @var numCreated The number of elements in created.
+/// @var replaced The nodes of the current version that are not part of the new
+///   version.  These are retired if the new version is published.
+/// @var numReplaced The number of elements in replaced.
+/// @var failed Whether or not building the new version failed.
+typedef struct RadixTreeAdaptiveUpdate {
+  RadixTreeAdaptiveNode **created;
+  size_t numCreated;
+  RadixTreeAdaptiveNode **replaced;
+  size_t numReplaced;
+  bool failed;
+} RadixTreeAdaptiveUpdate;
+
+/// @fn static RadixTreeAdaptiveNode* radixTreeAdaptiveCreated(
+///          RadixTreeAdaptiveUpdate *update, RadixTreeAdaptiveNode *node)
+///
+/// @brief Record a node allocated for the new version of a tree.
+///
+/// @param update A pointer to the update being built.
+/// @param node A pointer to the new node.  NULL marks the update as failed.
+///
+/// @return Returns the node provided.
+static RadixTreeAdaptiveNode* radixTreeAdaptiveCreated(
+  RadixTreeAdaptiveUpdate *update, RadixTreeAdaptiveNode *node
+) {
+  if (node == NULL) {
+    update->failed = true;
+  } else {
+    update->created[update->numCreated++] = node;
+  }
+
+  return node;
+}
+
+/// @fn static RadixTreeAdaptiveNode* radixTreeAdaptiveInsert(
+///          RadixTreeAdaptiveNode *node,
+///          const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys,
+///          size_t depth, RadixTreeLeaf *leaf,
+///          RadixTreeAdaptiveUpdate *update)
+///
+/// @brief Build the new version of a subtree with a leaf added to it.
+///
+/// @param node A pointer to the root of the subtree or NULL.  The key of the
+///   leaf must not already be in the subtree.
+/// @param key A pointer to the key elements of the leaf.
+/// @param numKeys The number of elements in the key.
+/// @param depth The number of key elements consumed above node.
+/// @param leaf A pointer to the leaf to add.
+/// @param update A pointer to the update being built.
+///
+/// @return Returns the root of the new version of the subtree on success,
+/// NULL on failure.
+static RadixTreeAdaptiveNode* radixTreeAdaptiveInsert(
+  RadixTreeAdaptiveNode *node,
+  const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys,
+  size_t depth, RadixTreeLeaf *leaf, RadixTreeAdaptiveUpdate *update
+) {
+  RadixTreeAdaptiveNode *newNode = NULL;
+
+  if (node == NULL) {
+    return &leaf->header;
+  } else if (node->type == RADIX_TREE_LEAF) {
+    // Lazy expansion:  Replace the existing leaf with a node that holds the
+    // elements the two keys have in common and has both leaves below it.
+    RADIX_TREE_KEY_ELEMENT *otherKey = node->prefix;
+    size_t otherNumKeys = node->prefixLength;
+    size_t prefixLength = 0;
+    while ((depth + prefixLength < numKeys)
+      && (depth + prefixLength < otherNumKeys)
+      && (radixTreeKeyElement(key, numKeys, depth + prefixLength)
+        == radixTreeKeyElement(otherKey, otherNumKeys, depth + prefixLength))
+    ) {
+      prefixLength++;
+    }
+    size_t newDepth = depth + prefixLength;
+
+    RadixTreeLeaf *nodeLeaf = NULL;
+    if (newDepth == numKeys) {
+      nodeLeaf = leaf;
+    } else if (newDepth == otherNumKeys) {
+      nodeLeaf = (RadixTreeLeaf*) node;
+    }
+    newNode = radixTreeAdaptiveCreated(update, radixTreeAdaptiveNodeCreate(
+      (nodeLeaf != NULL) ? 1 : 2, prefixLength, nodeLeaf));
+    if (newNode == NULL) {
+      return NULL;
+    }
+    for (size_t ii = 0; ii < prefixLength; ii++) {
+      newNode->prefix[ii] = radixTreeKeyElement(key, numKeys, depth + ii);
+    }
+
+    if (nodeLeaf == leaf) {
+      radixTreeAdaptiveNodeAppend(newNode,
+        radixTreeKeyElement(otherKey, otherNumKeys, newDepth), node);
+    } else if (nodeLeaf != NULL) {
+      radixTreeAdaptiveNodeAppend(newNode,
+        radixTreeKeyElement(key, numKeys, newDepth), &leaf->header);
+    } else {
+      RADIX_TREE_KEY_ELEMENT keyElement
+        = radixTreeKeyElement(key, numKeys, newDepth);
+      RADIX_TREE_KEY_ELEMENT otherKeyElement
+        = radixTreeKeyElement(otherKey, otherNumKeys, newDepth);
+      if (keyElement < otherKeyElement) {
+        radixTreeAdaptiveNodeAppend(newNode, keyElement, &leaf->header);
+        radixTreeAdaptiveNodeAppend(newNode, otherKeyElement, node);
+      } else {
+        radixTreeAdaptiveNodeAppend(newNode, otherKeyElement, node);
+        radixTreeAdaptiveNodeAppend(newNode, keyElement, &leaf->header);
+      }
+    }
+
+    return newNode;
+  }
+
+  size_t matched = 0;
+  while ((matched < node->prefixLength) && (depth + matched < numKeys)
+    && (node->prefix[matched]
+      == radixTreeKeyElement(key, numKeys, depth + matched))
+  ) {
+    matched++;
+  }
+
+  if (matched < node->prefixLength) {
+    // The key diverges inside the compressed prefix.  Split the prefix with a
+    // new node that has a shortened copy of this one below it.
+    size_t newDepth = depth + matched;
+    RadixTreeLeaf *nodeLeaf = (newDepth == numKeys) ? leaf : NULL;
+    newNode = radixTreeAdaptiveCreated(update, radixTreeAdaptiveNodeCreate(
+      (nodeLeaf != NULL) ? 1 : 2, matched, nodeLeaf));
+    if (newNode == NULL) {
+      return NULL;
+    }
+    memcpy(newNode->prefix, node->prefix,
+      matched * sizeof(RADIX_TREE_KEY_ELEMENT));
+
+    size_t shortenedLength = node->prefixLength - matched - 1;
+    RadixTreeAdaptiveNode *shortened = radixTreeAdaptiveCreated(update,
+      radixTreeAdaptiveNodeRebuild(node,
+        shortenedLength, node->leaf, false, 0, NULL));
+    if (shortened == NULL) {
+      return NULL;
+    }
+    memcpy(shortened->prefix, &node->prefix[matched + 1],
+      shortenedLength * sizeof(RADIX_TREE_KEY_ELEMENT));
+    update->replaced[update->numReplaced++] = node;
+
+    RADIX_TREE_KEY_ELEMENT nodeKeyElement = node->prefix[matched];
+    if (nodeLeaf != NULL) {
+      radixTreeAdaptiveNodeAppend(newNode, nodeKeyElement, shortened);
+    } else {
+      RADIX_TREE_KEY_ELEMENT keyElement
+        = radixTreeKeyElement(key, numKeys, newDepth);
+      if (keyElement < nodeKeyElement) {
+        radixTreeAdaptiveNodeAppend(newNode, keyElement, &leaf->header);
+        radixTreeAdaptiveNodeAppend(newNode, nodeKeyElement, shortened);
+      } else {
+        radixTreeAdaptiveNodeAppend(newNode, nodeKeyElement, shortened);
+        radixTreeAdaptiveNodeAppend(newNode, keyElement, &leaf->header);
+      }
+    }
+
+    return newNode;
+  }
+
+  depth += node->prefixLength;
+  if (depth == numKeys) {
+    // The key ends at this node.
+    newNode = radixTreeAdaptiveCreated(update, radixTreeAdaptiveNodeRebuild(
+      node, node->prefixLength, leaf, false, 0, NULL));
+  } else {
+    RADIX_TREE_KEY_ELEMENT keyElement
+      = radixTreeKeyElement(key, numKeys, depth);
+    RadixTreeAdaptiveNode *child = radixTreeAdaptiveFindChild(node, keyElement);
+    if (child != NULL) {
+      child = radixTreeAdaptiveInsert(
+        child, key, numKeys, depth + 1, leaf, update);
+      if (child == NULL) {
+        return NULL;
+      }
+    } else {
+      child = &leaf->header;
+    }
+    newNode = radixTreeAdaptiveCreated(update, radixTreeAdaptiveNodeRebuild(
+      node, node->prefixLength, node->leaf, true, keyElement, child));
+  }
+  if (newNode == NULL) {
+    return NULL;
+  }
+  memcpy(newNode->prefix, node->prefix,
+    node->prefixLength * sizeof(RADIX_TREE_KEY_ELEMENT));
+  update->replaced[update->numReplaced++] = node;
+
+  return newNode;
+}
+
+/// @fn static RadixTreeAdaptiveNode* radixTreeAdaptiveRemove(
+///          RadixTreeAdaptiveNode *node,
+///          const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys,
+///          size_t depth, RadixTreeAdaptiveUpdate *update)
+///
+/// @brief Build the new version of a subtree with the leaf for a key removed
+/// from it.
+///
+/// @param node A pointer to the root of the subtree.  The key must be in the
+///   subtree.
+/// @param key A pointer to the key elements of the leaf to remove.
+/// @param numKeys The number of elements in the key.
+/// @param depth The number of key elements consumed above node.
+/// @param update A pointer to the update being built.
+///
+/// @return Returns the root of the new version of the subtree, which is NULL
+/// if the subtree is now empty.  update->failed is set on failure.
+static RadixTreeAdaptiveNode* radixTreeAdaptiveRemove(
+  RadixTreeAdaptiveNode *node,
+  const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys,
+  size_t depth, RadixTreeAdaptiveUpdate *update
+) {
+  if (node->type == RADIX_TREE_LEAF) {
+    return NULL;
+  }
+
+  depth += node->prefixLength;
+  RadixTreeLeaf *leaf = node->leaf;
+  bool modifyChild = false;
+  RADIX_TREE_KEY_ELEMENT keyElement = 0;
+  RadixTreeAdaptiveNode *child = NULL;
+  unsigned int numChildren = node->numChildren;
+  if (depth == numKeys) {
+    leaf = NULL;
+  } else {
+    modifyChild = true;
+    keyElement = radixTreeKeyElement(key, numKeys, depth);
+    child = radixTreeAdaptiveRemove(
+      radixTreeAdaptiveFindChild(node, keyElement),
+      key, numKeys, depth + 1, update);
+    if (update->failed == true) {
+      return NULL;
+    }
+    if (child == NULL) {
+      numChildren--;
+    }
+  }
+  update->replaced[update->numReplaced++] = node;
+
+  if (numChildren == 0) {
+    // Only the leaf of the key that ends here is left.
+    return &leaf->header;
+  } else if ((numChildren == 1) && (leaf == NULL)) {
+    // Only one child is left.  Merge this node's prefix into it.
+    unsigned int position = 0;
+    RADIX_TREE_KEY_ELEMENT remainingKeyElement = 0;
+    RadixTreeAdaptiveNode *remaining = NULL;
+    while ((remaining = radixTreeAdaptiveNextChild(
+      node, &position, &remainingKeyElement)) != NULL
+    ) {
+      if ((modifyChild == false) || (remainingKeyElement != keyElement)) {
+        break;
+      }
+    }
+    if (remaining->type == RADIX_TREE_LEAF) {
+      return remaining;
+    }
+
+    size_t prefixLength = node->prefixLength + 1 + remaining->prefixLength;
+    RadixTreeAdaptiveNode *newNode = radixTreeAdaptiveCreated(update,
+      radixTreeAdaptiveNodeRebuild(remaining,
+        prefixLength, remaining->leaf, false, 0, NULL));
+    if (newNode == NULL) {
+      return NULL;
+    }
+    memcpy(newNode->prefix, node->prefix,
+      node->prefixLength * sizeof(RADIX_TREE_KEY_ELEMENT));
+    newNode->prefix[node->prefixLength] = remainingKeyElement;
+    memcpy(&newNode->prefix[node->prefixLength + 1], remaining->prefix,
+      remaining->prefixLength * sizeof(RADIX_TREE_KEY_ELEMENT));
+    update->replaced[update->numReplaced++] = remaining;
+
+    return newNode;
+  }
+
+  RadixTreeAdaptiveNode *newNode = radixTreeAdaptiveCreated(update,
+    radixTreeAdaptiveNodeRebuild(node,
+      node->prefixLength, leaf, modifyChild, keyElement, child));
+  if (newNode == NULL) {
+    return NULL;
+  }
+  memcpy(newNode->prefix, node->prefix,
+    node->prefixLength * sizeof(RADIX_TREE_KEY_ELEMENT));
+
+  return newNode;
+}
+
+/// @fn static bool radixTreeAdaptiveUpdateInit(
+///          RadixTreeAdaptiveUpdate *update, size_t numKeys)
+///
+/// @brief Allocate the storage needed to build a new version of a tree for a
+/// key.
+///
+/// @param update A pointer to the update to initialize.
+/// @param numKeys The number of elements in the key being added or removed.
+///
+/// @return Returns true on success, false on failure.
+static bool radixTreeAdaptiveUpdateInit(
+  RadixTreeAdaptiveUpdate *update, size_t numKeys
+) {
+  // Every level of the tree along the key's path creates and replaces at most
+  // two nodes.
+  size_t capacity = 2 * (numKeys + 2);
+  update->created = (RadixTreeAdaptiveNode**)
+    calloc(1, 2 * capacity * sizeof(RadixTreeAdaptiveNode*));
+  if (update->created == NULL) {
+    LOG_MALLOC_FAILURE();
+    return false;
+  }
+  update->replaced = &update->created[capacity];
+  update->numCreated = 0;
+  update->numReplaced = 0;
+  update->failed = false;
+
+  return true;
+}
+
+/// @fn static void radixTreeAdaptiveRetire(RadixTree *tree,
+///          RadixTreeAdaptiveNode *node)
+///
+/// @brief Add a node that is no longer reachable from the root of an adaptive
+/// tree to the tree's retired list.
+///
+/// @param tree A pointer to the tree the node was removed from.
+/// @param node A pointer to the node to retire.
+///
+/// @return This function returns no value.
+static void radixTreeAdaptiveRetire(RadixTree *tree,
+  RadixTreeAdaptiveNode *node
+) {
+  RadixTreeAdaptiveNode *retired = NULL;
+  do {
+    retired = (RadixTreeAdaptiveNode*) loadPointer(
+      (void * volatile*) &tree->retired);
+    node->retiredNext = retired;
+  } while (compareExchangePointer((void * volatile*) &tree->retired,
+    (void*) node, (void*) retired) != (void*) retired);
+}
+
+/// @fn static void radixTreeAdaptiveFreeList(RadixTree *tree,
+///          RadixTreeAdaptiveNode *node)
+///
+/// @brief Free a list of retired nodes.
+///
+/// @details Retired inner nodes share their children with the live tree and
+/// other retired nodes, so only the nodes themselves are freed.  Retired
+/// leaves are the leaves of deleted keys, so their values are destroyed.
+///
+/// @param tree A pointer to the tree the nodes were retired from.
+/// @param node A pointer to the first node of the list or NULL.
+///
+/// @return This function returns no value.
+static void radixTreeAdaptiveFreeList(RadixTree *tree,
+  RadixTreeAdaptiveNode *node
+) {
+  while (node != NULL) {
+    RadixTreeAdaptiveNode *next = node->retiredNext;
+    if ((node->type == RADIX_TREE_LEAF) && (tree->destructor != NULL)) {
+      tree->destructor(exchangePointer(
+        (void * volatile*) &((RadixTreeLeaf*) node)->value, NULL));
+    }
+    allocatorFree(ALLOCATOR_RADIX_TREE, NULL, node);
+    node = next;
+  }
+}
+
+/// @fn int64_t radixTreeReadBegin(RadixTree *tree)
+///
+/// @brief Enter a read section of a radix tree.  No node or value that is
+/// reachable from an adaptive tree when the section begins is freed until the
+/// section ends, which solves the problem of values and nodes being freed
+/// while another thread is still using them.
+///
+/// @details Read sections never block or take locks.  They may be nested, but
+/// radixTreeSynchronize must not be called from within one.  Read sections on
+/// trees of RadixTreeNodes do nothing.
+///
+/// @param tree A pointer to a previously-allocated RadixTree.
+///
+/// @return Returns a token that must be passed to radixTreeReadEnd.
+int64_t radixTreeReadBegin(RadixTree *tree) {
+  if ((tree == NULL) || (tree->readers == NULL)) {
+    return 0;
+  }
+
+  // Spread the readers across the counters by their stack address, which is
+  // distinct for every thread and coroutine.
+  int64_t token = 0;
+  uint64_t stripe = ((((uint64_t) (uintptr_t) &token) >> 12)
+    * 0x9E3779B97F4A7C15ULL) >> 32;
+  stripe &= (RADIX_TREE_READER_STRIPES - 1);
+  volatile int64_t *count = tree->readers[stripe].count;
+
+  while (1) {
+    int64_t epoch = atomicLoad64(&tree->epoch);
+    atomicIncrement64(&count[epoch & 1]);
+    if (atomicLoad64(&tree->epoch) == epoch) {
+      token = (int64_t) ((stripe << 1) | (uint64_t) (epoch & 1));
+      break;
+    }
+    // The epoch advanced before we were counted, so the reclaimer may not
+    // have seen us.  Try again in the new epoch.
+    atomicDecrement64(&count[epoch & 1]);
+  }
+
+  return token;
+}
+
+/// @fn void radixTreeReadEnd(RadixTree *tree, int64_t token)
+///
+/// @brief Leave a read section of a radix tree.
+///
+/// @param tree A pointer to the RadixTree passed to radixTreeReadBegin.
+/// @param token The value returned by radixTreeReadBegin.
+///
+/// @return This function returns no value.
+void radixTreeReadEnd(RadixTree *tree, int64_t token) {
+  if ((tree == NULL) || (tree->readers == NULL)) {
+    return;
+  }
+
+  atomicDecrement64(&tree->readers[token >> 1].count[token & 1]);
+}
+
+/// @fn static bool radixTreeAdvanceEpoch(RadixTree *tree)
+///
+/// @brief Try to advance the reclamation epoch of an adaptive tree.
+///
+/// @details Nodes are retired only after they have been made unreachable, so
+/// the only readers that can see the nodes in the retired list are those that
+/// are already in a read section.  Advancing the epoch moves the retired list
+/// to limbo and starts counting new readers under the other parity.  The next
+/// advance can only happen once no reader from before the previous advance
+/// remains, which is exactly when limbo can be freed.
+///
+/// @param tree A pointer to an adaptive RadixTree.  The caller must own
+///   tree->reclaiming.
+///
+/// @return Returns true if the epoch was advanced, false if readers from the
+/// previous epoch are still active.
+static bool radixTreeAdvanceEpoch(RadixTree *tree) {
+  int64_t epoch = atomicLoad64(&tree->epoch);
+  int64_t previous = (epoch + 1) & 1;
+  for (int ii = 0; ii < RADIX_TREE_READER_STRIPES; ii++) {
+    if (atomicLoad64(&tree->readers[ii].count[previous]) != 0) {
+      return false;
+    }
+  }
+
+  radixTreeAdaptiveFreeList(tree, tree->limbo);
+  tree->limbo = (RadixTreeAdaptiveNode*) exchangePointer(
+    (void * volatile*) &tree->retired, NULL);
+  atomicIncrement64(&tree->epoch);
+
+  return true;
+}
+
+/// @fn static void radixTreeTryReclaim(RadixTree *tree)
+///
+/// @brief Free whatever retired nodes of an adaptive tree can be freed without
+/// waiting for any reader.
+///
+/// @param tree A pointer to an adaptive RadixTree.
+///
+/// @return This function returns no value.
+static void radixTreeTryReclaim(RadixTree *tree) {
+  if (compareExchange64(&tree->reclaiming, 1, 0) != 0) {
+    // Another thread is already reclaiming.
+    return;
+  }
+
+  if ((loadPointer((void * volatile*) &tree->retired) != NULL)
+    || (tree->limbo != NULL)
+  ) {
+    radixTreeAdvanceEpoch(tree);
+  }
+
+  compareExchange64(&tree->reclaiming, 0, 1);
+}
+
+/// @fn void radixTreeSynchronize(RadixTree *tree)
+///
+/// @brief Wait until every read section of a radix tree that began before this
+/// call has ended.  Values removed from the tree before this call can then be
+/// freed safely.
+///
+/// @param tree A pointer to a previously-allocated RadixTree.
+///
+/// @return This function returns no value.
+void radixTreeSynchronize(RadixTree *tree) {
+  if ((tree == NULL) || (tree->readers == NULL)) {
+    return;
+  }
+
+  while (compareExchange64(&tree->reclaiming, 1, 0) != 0) {
+    thrd_yield();
+  }
+
+  // The first advance waits out the readers that entered before the current
+  // epoch.  The second waits out the ones that entered during it.
+  for (int ii = 0; ii < 2; ii++) {
+    while (radixTreeAdvanceEpoch(tree) == false) {
+      thrd_yield();
+    }
+  }
+
+  compareExchange64(&tree->reclaiming, 0, 1);
+}
+
+/// @fn static void radixTreeAdaptiveDestroyNode(RadixTreeAdaptiveNode *node,
+///          tss_dtor_t destructor)
+///
+/// @brief Destroy a node of an adaptive tree, its value, and all its
+/// subordinate nodes.
+///
+/// @param node A pointer to a node of an adaptive tree or NULL.
+/// @param destructor A tss_dtor_t that can be used to destroy the values held
+///   by the leaves.
+///
+/// @return This function returns no value.
+static void radixTreeAdaptiveDestroyNode(RadixTreeAdaptiveNode *node,
+  tss_dtor_t destructor
+) {
+  if (node == NULL) {
+    return;
+  }
+
+  if (node->type == RADIX_TREE_LEAF) {
+    if (destructor != NULL) {
+      destructor(exchangePointer(
+        (void * volatile*) &((RadixTreeLeaf*) node)->value, NULL));
+    }
+  } else {
+    if (node->leaf != NULL) {
+      radixTreeAdaptiveDestroyNode(&node->leaf->header, destructor);
+    }
+    unsigned int position = 0;
+    RADIX_TREE_KEY_ELEMENT keyElement = 0;
+    RadixTreeAdaptiveNode *child = NULL;
+    while ((child = radixTreeAdaptiveNextChild(
+      node, &position, &keyElement)) != NULL
+    ) {
+      radixTreeAdaptiveDestroyNode(child, destructor);
+    }
+  }
+  allocatorFree(ALLOCATOR_RADIX_TREE, NULL, node);
+}
+
+/// @fn static void radixTreeAdaptiveUpdateFinish(RadixTree *tree,
+///          RadixTreeAdaptiveUpdate *update, bool published)
+///
+/// @brief Release the nodes of an update after trying to publish it.
+///
+/// @param tree A pointer to the tree the update was built for.
+/// @param update A pointer to the update.
+/// @param published Whether or not the new version of the tree was
+///   published.  If it was, the replaced nodes are retired.  If not, the
+///   created nodes are freed.
+///
+/// @return This function returns no value.
+static void radixTreeAdaptiveUpdateFinish(RadixTree *tree,
+  RadixTreeAdaptiveUpdate *update, bool published
+) {
+  if (published == true) {
+    for (size_t ii = 0; ii < update->numReplaced; ii++) {
+      radixTreeAdaptiveRetire(tree, update->replaced[ii]);
+    }
+  } else {
+    for (size_t ii = 0; ii < update->numCreated; ii++) {
+      allocatorFree(ALLOCATOR_RADIX_TREE, NULL, update->created[ii]);
+    }
+  }
+  update->numCreated = 0;
+  update->numReplaced = 0;
+  update->failed = false;
+}
+
+/// @fn static void* radixTreeAdaptiveSetValue(RadixTree *tree,
+///          const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys,
+///          volatile void *value)
+///
+/// @brief Set a value in an adaptive tree.
+///
+/// @details If the key is already in the tree, its value is exchanged
+/// atomically.  Otherwise, a new version of the tree with a new leaf is
+/// published with a compare-and-swap of the root.  If another thread
+/// published a different version first, the operation is retried against
+/// that version.
+///
+/// @param tree A pointer to an adaptive RadixTree.
+/// @param key A pointer to the key elements.
+/// @param numKeys The number of elements in the key.
+/// @param value A pointer to the value to set.
+///
+/// @return Returns the previous value for the key, if any.
+static void* radixTreeAdaptiveSetValue(RadixTree *tree,
+  const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys,
+  volatile void *value
+) {
+  void *returnValue = NULL;
+  RadixTreeLeaf *leaf = NULL;
+  RadixTreeAdaptiveUpdate update;
+  if (radixTreeAdaptiveUpdateInit(&update, numKeys) == false) {
+    return returnValue; // NULL
+  }
+
+  int64_t token = radixTreeReadBegin(tree);
+  while (1) {
+    RadixTreeAdaptiveNode *root = (RadixTreeAdaptiveNode*) loadPointer(
+      (void * volatile*) &tree->adaptiveRoot);
+    RadixTreeLeaf *existing = radixTreeAdaptiveFind(root, key, numKeys);
+    if (existing != NULL) {
+      returnValue = exchangePointer(
+        (void * volatile*) &existing->value, (void*) value);
+      leaf = (RadixTreeLeaf*)
+        allocatorFree(ALLOCATOR_RADIX_TREE, NULL, leaf);
+      break;
+    }
+
+    if (leaf == NULL) {
+      leaf = radixTreeLeafCreate(key, numKeys, value);
+      if (leaf == NULL) {
+        break;
+      }
+    }
+
+    RadixTreeAdaptiveNode *newRoot
+      = radixTreeAdaptiveInsert(root, key, numKeys, 0, leaf, &update);
+    if (newRoot == NULL) {
+      radixTreeAdaptiveUpdateFinish(tree, &update, false);
+      leaf = (RadixTreeLeaf*)
+        allocatorFree(ALLOCATOR_RADIX_TREE, NULL, leaf);
+      break;
+    }
+
+    bool published = (compareExchangePointer(
+      (void * volatile*) &tree->adaptiveRoot, (void*) newRoot, (void*) root)
+      == (void*) root);
+    radixTreeAdaptiveUpdateFinish(tree, &update, published);
+    if (published == true) {
+      break;
+    }
+  }
+  radixTreeReadEnd(tree, token);
+
+  radixTreeTryReclaim(tree);
+  free(update.created); update.created = NULL;
+  return returnValue;
+}
+
+/// @fn static int radixTreeAdaptiveDeleteValue(RadixTree *tree,
+///          const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys)
+///
+/// @brief Delete a value from an adaptive tree.
+///
+/// @details The leaf of the key and its value are destroyed once no reader can
+/// still be using them.
+///
+/// @param tree A pointer to an adaptive RadixTree.
+/// @param key A pointer to the key elements.
+/// @param numKeys The number of elements in the key.
+///
+/// @return Returns 0 on success, -1 on error.
+static int radixTreeAdaptiveDeleteValue(RadixTree *tree,
+  const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys
+) {
+  int returnValue = -1;
+  RadixTreeAdaptiveUpdate update;
+  if (radixTreeAdaptiveUpdateInit(&update, numKeys) == false) {
+    return returnValue; // -1
+  }
+
+  int64_t token = radixTreeReadBegin(tree);
+  while (1) {
+    RadixTreeAdaptiveNode *root = (RadixTreeAdaptiveNode*) loadPointer(
+      (void * volatile*) &tree->adaptiveRoot);
+    RadixTreeLeaf *leaf = radixTreeAdaptiveFind(root, key, numKeys);
+    if (leaf == NULL) {
+      returnValue = 0;
+      break;
+    }
+
+    RadixTreeAdaptiveNode *newRoot
+      = radixTreeAdaptiveRemove(root, key, numKeys, 0, &update);
+    if (update.failed == true) {
+      radixTreeAdaptiveUpdateFinish(tree, &update, false);
+      break;
+    }
+
+    bool published = (compareExchangePointer(
+      (void * volatile*) &tree->adaptiveRoot, (void*) newRoot, (void*) root)
+      == (void*) root);
+    radixTreeAdaptiveUpdateFinish(tree, &update, published);
+    if (published == true) {
+      // Readers may still be using the value, so it is destroyed along with
+      // the leaf.
+      radixTreeAdaptiveRetire(tree, &leaf->header);
+      returnValue = 0;
+      break;
+    }
+  }
+  radixTreeReadEnd(tree, token);
+
+  radixTreeTryReclaim(tree);
+  free(update.created); update.created = NULL;
+  return returnValue;
+}
+
+
+/// @fn RadixTree* radixTreeCreate_(tss_dtor_t destructor, bool adaptive, ...)
 ///
 /// @brief Create a radix tree to be used with the thread-specific storage
 /// calls.
 ///
 /// @param destructor The destructor to call on the values in the tree when one
 /// of them is deleted or the tree is destroyed.
+/// @param adaptive Whether or not to use the adaptive node layouts.  Adaptive
+///   trees use nodes sized to their number of children and compress paths
+///   with a single child, so a tree with few keys costs a small fraction of
+///   the memory of one made of RadixTreeNodes.  Lookups remain lock-free.
+///   Adding and removing keys publishes new versions of the affected nodes
+///   with a compare-and-swap.  The nodes they replace are freed once no
+///   reader can still be using them.  See radixTreeReadBegin.
+/// @param ... Ignored parameters.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides false for adaptive.
 ///
 /// @return Returns a pointer to a newly-allocated RadixTree on success,
 /// NULL on failure.
-RadixTree* radixTreeCreate(tss_dtor_t destructor) {
-  RadixTree *tree
-    = (RadixTree*) malloc(sizeof(RadixTree));
+RadixTree* radixTreeCreate_(tss_dtor_t destructor, bool adaptive, ...) {
+  RadixTree *tree = (RadixTree*)
+    allocatorCalloc(ALLOCATOR_RADIX_TREE, NULL, 1, sizeof(RadixTree));
   if (tree == NULL) {
     LOG_MALLOC_FAILURE();
     return NULL;
   }
 
-  tree->root
-    = (RadixTreeNode*) calloc(1, sizeof(RadixTreeNode));
+  tree->destructor = destructor;
+  tree->adaptive = adaptive;
+  if (adaptive == true) {
+    // Adaptive trees start out with no nodes at all.
+    tree->readers = (RadixTreeReaderCount*) allocatorCalloc(
+      ALLOCATOR_RADIX_TREE, NULL,
+      RADIX_TREE_READER_STRIPES, sizeof(RadixTreeReaderCount));
+    if (tree->readers == NULL) {
+      LOG_MALLOC_FAILURE();
+      tree = (RadixTree*) allocatorFree(ALLOCATOR_RADIX_TREE, NULL, tree);
+    }
+    return tree;
+  }
+
+  tree->root = (RadixTreeNode*)
+    allocatorCalloc(ALLOCATOR_RADIX_TREE, NULL, 1, sizeof(RadixTreeNode));
   if (tree->root == NULL) {
     LOG_MALLOC_FAILURE();
-    free(tree); tree = NULL;
+    tree = (RadixTree*) allocatorFree(ALLOCATOR_RADIX_TREE, NULL, tree);
     return NULL;
   }
 
-  tree->destructor = destructor;
-
   return tree;
 }
 
@@ -133,7 +1273,7 @@ static inline RadixTreeNode* radixTreeDestroyNode(
           destructor);
       }
     }
-    free(node); node = NULL;
+    node = (RadixTreeNode*) allocatorFree(ALLOCATOR_RADIX_TREE, NULL, node);
   }
 
   return node;
@@ -152,11 +1292,148 @@ RadixTree* radixTreeDestroy(RadixTree *tree) {
       (RadixTreeNode*) exchangePointer(
         (void * volatile*) &tree->root, NULL),
       tree->destructor);
-    free(tree); tree = NULL;
+    radixTreeAdaptiveDestroyNode(
+      (RadixTreeAdaptiveNode*) exchangePointer(
+        (void * volatile*) &tree->adaptiveRoot, NULL),
+      tree->destructor);
+    radixTreeAdaptiveFreeList(tree, (RadixTreeAdaptiveNode*)
+      exchangePointer((void * volatile*) &tree->retired, NULL));
+    radixTreeAdaptiveFreeList(tree, tree->limbo); tree->limbo = NULL;
+    tree->readers = (RadixTreeReaderCount*)
+      allocatorFree(ALLOCATOR_RADIX_TREE, NULL, tree->readers);
+    tree = (RadixTree*) allocatorFree(ALLOCATOR_RADIX_TREE, NULL, tree);
   }
   return tree;
 }
 
+/// @fn static uint64_t radixTreeNodeStats(RadixTreeNode *node,
+///          RadixTreeStats *stats)
+///
+/// @brief Add a subtree of RadixTreeNodes to a RadixTreeStats.
+///
+/// @param node A pointer to the root of the subtree or NULL.
+/// @param stats The RadixTreeStats being filled in.
+///
+/// @return Returns the number of nodes on the longest path from node down to
+/// a node with no children, 0 if node is NULL.
+static uint64_t radixTreeNodeStats(RadixTreeNode *node, RadixTreeStats *stats) {
+  if (node == NULL) {
+    return 0;
+  }
+
+  stats->numNodes++;
+  stats->memoryBytes += sizeof(RadixTreeNode);
+  if (loadPointer((void * volatile*) &node->value) != NULL) {
+    stats->numValues++;
+  }
+  uint64_t depth = 0;
+  for (int ii = 0; ii < RADIX_TREE_ARRAY_SIZE; ii++) {
+    uint64_t childDepth = radixTreeNodeStats((RadixTreeNode*)
+      loadPointer((void * volatile*) &node->radixTreeNodes[ii]), stats);
+    if (childDepth > depth) {
+      depth = childDepth;
+    }
+  }
+
+  return depth + 1;
+}
+
+/// @fn static uint64_t radixTreeAdaptiveNodeStats(RadixTreeAdaptiveNode *node,
+///          RadixTreeStats *stats)
+///
+/// @brief Add a subtree of adaptive nodes to a RadixTreeStats.
+///
+/// @param node A pointer to the root of the subtree or NULL.
+/// @param stats The RadixTreeStats being filled in.
+///
+/// @return Returns the number of nodes on the longest path from node down to
+/// a leaf, 0 if node is NULL.
+static uint64_t radixTreeAdaptiveNodeStats(RadixTreeAdaptiveNode *node,
+  RadixTreeStats *stats
+) {
+  if (node == NULL) {
+    return 0;
+  }
+
+  stats->numNodes++;
+  stats->nodesByType[node->type]++;
+  stats->memoryBytes += node->prefixLength * sizeof(RADIX_TREE_KEY_ELEMENT);
+  if (node->type == RADIX_TREE_LEAF) {
+    stats->numValues++;
+    stats->memoryBytes += sizeof(RadixTreeLeaf);
+    return 1;
+  }
+
+  switch (node->type) {
+    case RADIX_TREE_NODE4:
+      stats->memoryBytes += sizeof(RadixTreeNode4);
+      break;
+    case RADIX_TREE_NODE16:
+      stats->memoryBytes += sizeof(RadixTreeNode16);
+      break;
+    case RADIX_TREE_NODE48:
+      stats->memoryBytes += sizeof(RadixTreeNode48);
+      break;
+    default:
+      stats->memoryBytes += sizeof(RadixTreeNode256);
+      break;
+  }
+
+  uint64_t depth = radixTreeAdaptiveNodeStats(
+    (node->leaf != NULL) ? &node->leaf->header : NULL, stats);
+  unsigned int position = 0;
+  RADIX_TREE_KEY_ELEMENT keyElement = 0;
+  RadixTreeAdaptiveNode *child = NULL;
+  while ((child = radixTreeAdaptiveNextChild(
+    node, &position, &keyElement)) != NULL
+  ) {
+    uint64_t childDepth = radixTreeAdaptiveNodeStats(child, stats);
+    if (childDepth > depth) {
+      depth = childDepth;
+    }
+  }
+
+  return depth + 1;
+}
+
+/// @fn int radixTreeStats(RadixTree *tree, RadixTreeStats *stats)
+///
+/// @brief Get the node counts, depth and approximate memory footprint of a
+/// radix tree.
+///
+/// @details Adaptive trees are walked inside a read section, so the result is
+/// a consistent snapshot of one version of the tree.  Trees of RadixTreeNodes
+/// have no such protection and must not have values deleted while they are
+/// being walked.  Nodes that have been retired but not freed yet and the
+/// values themselves are not counted.
+///
+/// @param tree A pointer to a previously-allocated RadixTree.
+/// @param stats The RadixTreeStats to fill in.
+///
+/// @return Returns 0 on success, -1 on error.
+int radixTreeStats(RadixTree *tree, RadixTreeStats *stats) {
+  if ((tree == NULL) || (stats == NULL)) {
+    return -1;
+  }
+  memset(stats, 0, sizeof(*stats));
+
+  stats->adaptive = tree->adaptive;
+  stats->memoryBytes = sizeof(RadixTree);
+  if (tree->adaptive == true) {
+    stats->memoryBytes
+      += RADIX_TREE_READER_STRIPES * sizeof(RadixTreeReaderCount);
+    int64_t token = radixTreeReadBegin(tree);
+    stats->maxDepth = radixTreeAdaptiveNodeStats((RadixTreeAdaptiveNode*)
+      loadPointer((void * volatile*) &tree->adaptiveRoot), stats);
+    radixTreeReadEnd(tree, token);
+  } else {
+    stats->maxDepth = radixTreeNodeStats((RadixTreeNode*)
+      loadPointer((void * volatile*) &tree->root), stats);
+  }
+
+  return 0;
+}
+
 /// @fn void* radixTreeNodeGetValue(RadixTreeNode *node,
 ///               const volatile RADIX_TREE_KEY_ELEMENT *key, size_t numKeys)
 ///
@@ -225,6 +1502,20 @@ void* radixTreeGetValue(RadixTree *tree,
     return returnValue;
   }
 
+  if (tree->adaptive == true) {
+    int64_t token = radixTreeReadBegin(tree);
+    RadixTreeLeaf *leaf = radixTreeAdaptiveFind(
+      (RadixTreeAdaptiveNode*) loadPointer(
+        (void * volatile*) &tree->adaptiveRoot),
+      (RADIX_TREE_KEY_ELEMENT*) key,
+      (keySize >> RADIX_TREE_NUM_KEYS_BIT_SHIFT));
+    if (leaf != NULL) {
+      returnValue = (void*) leaf->value;
+    }
+    radixTreeReadEnd(tree, token);
+    return returnValue;
+  }
+
   returnValue = radixTreeNodeGetValue(
     tree->root,
      (RADIX_TREE_KEY_ELEMENT*) key,
@@ -295,14 +1586,15 @@ static inline void* radixTreeNodeSetValue(RadixTreeNode *node,
       currentKeyIndex = key[numKeys - 1];
       radixTreeNodes = node->radixTreeNodes;
       if (radixTreeNodes[currentKeyIndex] == NULL) {
-        RadixTreeNode *radixTreeNode = (RadixTreeNode*)
-          calloc(1, sizeof(RadixTreeNode));
+        RadixTreeNode *radixTreeNode = (RadixTreeNode*) allocatorCalloc(
+          ALLOCATOR_RADIX_TREE, NULL, 1, sizeof(RadixTreeNode));
         if (compareExchangePointer(
           (void* volatile*) &radixTreeNodes[currentKeyIndex],
           (void*) radixTreeNode,
           NULL) != NULL
         ) {
-          free(radixTreeNode); radixTreeNode = NULL;
+          radixTreeNode = (RadixTreeNode*)
+            allocatorFree(ALLOCATOR_RADIX_TREE, NULL, radixTreeNode);
         }
       }
 
@@ -339,6 +1631,13 @@ void* radixTreeSetValue(RadixTree *tree,
     return returnValue; // NULL
   }
 
+  if (tree->adaptive == true) {
+    return radixTreeAdaptiveSetValue(tree,
+      (RADIX_TREE_KEY_ELEMENT*) key,
+      (keySize >> RADIX_TREE_NUM_KEYS_BIT_SHIFT),
+      value);
+  }
+
   returnValue = radixTreeNodeSetValue(
     tree->root,
     (RADIX_TREE_KEY_ELEMENT*) key,
@@ -362,7 +1661,8 @@ void* radixTreeSetValue(RadixTree *tree,
 /// @param key1 A pointer to the key of value in the second-level tree.
 /// @param keySize1 The number of bytes in key2.
 /// @param destructor2 The tss_dtor_t for the second-level tree if a second-
-///  level tree doesn't already exist for key1.
+///  level tree doesn't already exist for key1.  A new second-level tree uses
+///  the same node layouts as tree1.
 ///
 /// @return Returns the number of new elements added on success, -1 on error.
 void* radixTreeSetValue2(RadixTree *tree1,
@@ -381,7 +1681,7 @@ void* radixTreeSetValue2(RadixTree *tree1,
   RadixTree *tree2
     = (RadixTree*) radixTreeGetValue(tree1, key1, keySize1);
   if (tree2 == NULL) {
-    RadixTree *newTree = radixTreeCreate(destructor2);
+    RadixTree *newTree = radixTreeCreate(destructor2, tree1->adaptive);
     radixTreeSetValue(tree1, key1, keySize1, newTree);
     tree2 = (RadixTree*) radixTreeGetValue(
       tree1, key1, keySize1);
@@ -439,7 +1739,7 @@ static inline int radixTreeNodeDeleteValue(
         radixTreeNodes[currentKeyIndex], key, numKeys - 1, destructor);
       if (secondLevelReturnValue > 1) {
         // There's nothing left in this node.  Delete it.
-        free(exchangePointer(
+        allocatorFree(ALLOCATOR_RADIX_TREE, NULL, exchangePointer(
           (void* volatile*) &radixTreeNodes[currentKeyIndex], NULL));
         valueDeleted = true;
         returnValue = 1;
@@ -496,6 +1796,12 @@ int radixTreeDeleteValue(RadixTree *tree,
     return returnValue; // -1
   }
 
+  if (tree->adaptive == true) {
+    return radixTreeAdaptiveDeleteValue(tree,
+      (RADIX_TREE_KEY_ELEMENT*) key,
+      (keySize >> RADIX_TREE_NUM_KEYS_BIT_SHIFT));
+  }
+
   radixTreeNodeDeleteValue(
     tree->root,
     (RADIX_TREE_KEY_ELEMENT*) key,
@@ -31,10 +31,12 @@
 // Standard C includes.
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 // C.next includes.
 #include "RandomLib.h"
 #include "CThreads.h"
+#include "StringLib.h"
 
 #ifdef LOGGING_ENABLED
 #include "LoggingLib.h"
@@ -47,6 +49,8 @@
 #define logFile stderr
 #endif
 
+#include "LockStats.h"
+
 /// @var _internalSeed
 ///
 /// @brief The seed to use if none is specified when calling getU32.
@@ -63,6 +67,40 @@ static once_flag _randomSetup = ONCE_FLAG_INIT;
 /// @brief Mutex to ensure that random number operations are atomic.
 ZEROINIT(static mtx_t prngMutex);
 
+/// @struct RandomState
+///
+/// @brief The state of one thread's xoshiro256** generator.
+///
+/// @param s The 256 bits of generator state.  Never all zero.
+/// @param generation The value of _randomGeneration the state was seeded
+///   under.  When startRandom changes it, the state is reseeded.
+typedef struct RandomState {
+  u64 s[4];
+  u64 generation;
+} RandomState;
+
+/// @var _randomStateKey
+///
+/// @brief Thread-specific storage for each thread's RandomState.
+ZEROINIT(static tss_t _randomStateKey);
+
+/// @var _randomStateKeyValid
+///
+/// @brief Whether or not _randomStateKey was successfully created.
+static bool _randomStateKeyValid = false;
+
+/// @var _randomGeneration
+///
+/// @brief Incremented by every call to startRandom.  Protected by prngMutex.
+static u64 _randomGeneration = 1;
+
+/// @var _randomThreadCounter
+///
+/// @brief The number of threads seeded in the current generation.  Each thread
+/// gets its own stream derived from the seed and its position.  Protected by
+/// prngMutex.
+static u64 _randomThreadCounter = 0;
+
 #define RANDOM_MAX 0xffffffffffffULL
 #define RANDOM_MULTIPLIER 25214903917ULL
 #define RANDOM_INCREMENT 11ULL
@@ -78,6 +116,182 @@ void setupRandomMetadata(void) {
   if (status != thrd_success) {
     fprintf(stderr, "Could not initialize prngMutex.\n");
   }
+  
+  status = tss_create(&_randomStateKey, free);
+  if (status != thrd_success) {
+    fprintf(stderr, "Could not initialize _randomStateKey.\n");
+  } else {
+    _randomStateKeyValid = true;
+  }
+}
+
+/// @fn static inline u64 randomRotateLeft(u64 value, int bits)
+///
+/// @brief Rotate a 64-bit value left.
+///
+/// @param value The value to rotate.
+/// @param bits The number of bits to rotate by, 1 through 63.
+///
+/// @return Returns the rotated value.
+static inline u64 randomRotateLeft(u64 value, int bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+/// @fn static inline u64 randomSplitMix64(u64 *x)
+///
+/// @brief Advance a splitmix64 generator.  Used to expand a single 64-bit seed
+/// into a full xoshiro256** state.
+///
+/// @param x A pointer to the splitmix64 state.
+///
+/// @return Returns the next splitmix64 output.
+static inline u64 randomSplitMix64(u64 *x) {
+  u64 z = (*x += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+/// @fn static inline u64 randomXoshiro256StarStar(u64 *s)
+///
+/// @brief Advance a xoshiro256** generator.
+///
+/// @param s The four words of generator state.
+///
+/// @return Returns the next 64-bit output.
+static inline u64 randomXoshiro256StarStar(u64 *s) {
+  u64 result = randomRotateLeft(s[1] * 5, 7) * 9;
+  u64 t = s[1] << 17;
+  
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = randomRotateLeft(s[3], 45);
+  
+  return result;
+}
+
+/// @fn static void randomStateSeed(RandomState *state, u64 seed, u64 generation)
+///
+/// @brief Seed a thread's generator state.
+///
+/// @param state The RandomState to seed.
+/// @param seed The 64-bit seed to expand into the state.
+/// @param generation The generation the state is being seeded for.
+///
+/// @return This function returns no value.
+static void randomStateSeed(RandomState *state, u64 seed, u64 generation) {
+  for (int ii = 0; ii < 4; ii++) {
+    state->s[ii] = randomSplitMix64(&seed);
+  }
+  state->generation = generation;
+}
+
+/// @fn static RandomState* randomStateGet(void)
+///
+/// @brief Get the calling thread's generator, creating or reseeding it as
+/// needed.
+///
+/// @return Returns the calling thread's RandomState on success, NULL if
+/// thread-specific state is unavailable.
+static RandomState* randomStateGet(void) {
+  call_once(&_randomSetup, setupRandomMetadata);
+  if (_randomStateKeyValid == false) {
+    return NULL;
+  }
+  
+  RandomState *state = (RandomState*) tss_get(_randomStateKey);
+  if (state == NULL) {
+    state = (RandomState*) calloc(1, sizeof(RandomState));
+    if ((state == NULL) || (tss_set(_randomStateKey, state) != thrd_success)) {
+      free(state);
+      return NULL;
+    }
+  }
+  
+  if (state->generation != _randomGeneration) {
+    mtx_lock(&prngMutex);
+    u64 threadIndex = _randomThreadCounter++;
+    randomStateSeed(state,
+      _internalSeed + (threadIndex * 0xd1342543de82ef95ULL),
+      _randomGeneration);
+    mtx_unlock(&prngMutex);
+  }
+  
+  return state;
+}
+
+/// @fn u64 getRandomU64(void)
+///
+/// @brief Get a random 64-bit value from the calling thread's generator.  No
+/// locks are taken.
+///
+/// @return Returns a pseudo-random, unsigned, 64-bit integer value.
+///
+/// @note The generator is xoshiro256**.  It's fast and statistically strong
+/// but it is not suitable for cryptographic use.
+u64 getRandomU64(void) {
+  RandomState *state = randomStateGet();
+  if (state != NULL) {
+    // This is the expected case.
+    return randomXoshiro256StarStar(state->s);
+  }
+  
+  // No thread-specific state.  Fall back to the shared generator.
+  mtx_lock(&prngMutex);
+  _internalSeed = ((RANDOM_MULTIPLIER * _internalSeed) + RANDOM_INCREMENT)
+    & RANDOM_MODULUS;
+  u64 returnValue = _internalSeed << 16;
+  _internalSeed = ((RANDOM_MULTIPLIER * _internalSeed) + RANDOM_INCREMENT)
+    & RANDOM_MODULUS;
+  returnValue ^= _internalSeed;
+  mtx_unlock(&prngMutex);
+  
+  return returnValue;
+}
+
+/// @fn void getRandomBytes(void *buffer, u64 length)
+///
+/// @brief Fill a buffer with random bytes from the calling thread's
+/// generator, eight bytes per generator step.
+///
+/// @param buffer The buffer to fill.
+/// @param length The number of bytes to fill.
+///
+/// @return This function returns no value.
+///
+/// @note Like getRandomU64, this is not suitable for cryptographic use.
+void getRandomBytes(void *buffer, u64 length) {
+  if ((buffer == NULL) || (length == 0)) {
+    return;
+  }
+  
+  u8 *output = (u8*) buffer;
+  RandomState *state = randomStateGet();
+  if (state == NULL) {
+    for (; length >= sizeof(u64); length -= sizeof(u64)) {
+      u64 word = getRandomU64();
+      memcpy(output, &word, sizeof(word));
+      output += sizeof(word);
+    }
+  } else {
+    // Keep the state in locals so that the compiler can hold it in registers
+    // for the whole loop.
+    u64 s[4] = { state->s[0], state->s[1], state->s[2], state->s[3] };
+    for (; length >= sizeof(u64); length -= sizeof(u64)) {
+      u64 word = randomXoshiro256StarStar(s);
+      memcpy(output, &word, sizeof(word));
+      output += sizeof(word);
+    }
+    memcpy(state->s, s, sizeof(s));
+  }
+  
+  if (length > 0) {
+    u64 word = getRandomU64();
+    memcpy(output, &word, length);
+  }
 }
 
 /// @fn u48 getU48_(u64 upperBound, bool useProvidedSeed, u64 seed, ...)
@@ -87,8 +301,8 @@ void setupRandomMetadata(void) {
 ///
 /// @param upperBound The ceiling for the call.
 /// @param useProvidedSeed Whether or not to use the seed parameter in the
-///   generation of the random number.  If false, the last-generated value will
-///   be used.
+///   generation of the random number.  If false, the calling thread's
+///   generator will be used.
 /// @param seed The seed to use in the calculations.
 ///
 /// @note This function is wrapped by a macro of the same name (minus the
@@ -102,21 +316,14 @@ u64 getU48_(u64 upperBound, bool useProvidedSeed, u64 seed, ...) {
     "ENTER getU48(upperBound=%llu, useProvidedSeed=%s, seed=%llu)\n",
     llu(upperBound), (useProvidedSeed == true) ? "true" : "false", llu(seed));
   
-  call_once(&_randomSetup, setupRandomMetadata);
-  
   u64 returnValue = 0;
   
-  // Use a linear congruential algorithm to generate a random number.
   if (!useProvidedSeed) {
-    // This is the expected case.  Use and update the internal seed.
-    mtx_lock(&prngMutex);
-    returnValue
-      = ((RANDOM_MULTIPLIER * _internalSeed) + RANDOM_INCREMENT)
-      & RANDOM_MODULUS;
-    _internalSeed = returnValue;
-    mtx_unlock(&prngMutex);
+    // This is the expected case.  Use the calling thread's generator.
+    returnValue = getRandomU64() >> 16;
   } else {
-    // Use the user's provided seed.  This requires no mutex locking.
+    // Use a linear congruential algorithm on the user's provided seed.  This
+    // requires no mutex locking.
     returnValue
       = ((RANDOM_MULTIPLIER * seed) + RANDOM_INCREMENT) & RANDOM_MODULUS;
   }
@@ -184,6 +391,10 @@ u32 getU32_(u32 upperBound, bool useProvidedSeed, u64 seed, ...) {
 /// to call this function with a value of 0 because that's what the internal
 /// seed is initialized to anyway.
 ///
+/// @details The calling thread's generator is reseeded immediately, so its
+/// sequence is reproducible for a given seed.  Every other thread reseeds with
+/// its own stream derived from the seed the next time it generates a value.
+///
 /// @return Returns the seed used for starting the random number generator.
 u64 startRandom(u64 seed) {
   printLog(TRACE, "ENTER startRandom(seed=%llu)\n", llu(seed));
@@ -210,14 +421,149 @@ u64 startRandom(u64 seed) {
   }
   
   _internalSeed = (u64) seed;
+  _randomGeneration++;
+  _randomThreadCounter = 0;
   
   mtx_unlock(&prngMutex);
   
+  // Seed the calling thread first so that it gets stream 0.
+  randomStateGet();
+  
   printLog(TRACE, "EXIT startRandom(seed=%llu) = {%llu}\n",
     llu(seed), llu(seed));
   return (u64) seed;
 }
 
+/// @def RANDOM_DEFAULT_ALPHABET
+///
+/// @brief The alphabet used for random strings when the caller doesn't provide
+/// one.
+#define RANDOM_DEFAULT_ALPHABET \
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz" \
+  "0123456789!@#$%^&*(),./;'[]\\-=`<>?:\"{}|_+~ \t\n"
+
+/// @def RANDOM_BATCH_WORDS
+///
+/// @brief The number of 64-bit random words generated per batch when filling
+/// buffers with random characters.
+#define RANDOM_BATCH_WORDS 32
+
+/// @fn bool getRandomCharacters(char *buffer, u64 length, const char *alphabet)
+///
+/// @brief Fill a buffer with characters drawn uniformly from an alphabet.
+///
+/// @param buffer The buffer to fill.  No NULL terminator is written.
+/// @param length The number of characters to write to buffer.
+/// @param alphabet The alphabet of characters to draw from.  Defaults to all
+///   printable ASCII characters if NULL.
+///
+/// @details Random words are generated in batches with getRandomBytes and
+/// mapped onto the alphabet with rejection sampling so that every character is
+/// equally likely.  Alphabets of up to 256 characters consume one random byte
+/// per candidate through a lookup table; larger alphabets consume four.
+///
+/// @return Returns true on success, false if buffer is NULL or the alphabet
+/// is empty.
+bool getRandomCharacters(char *buffer, u64 length, const char *alphabet) {
+  printLog(TRACE, "ENTER getRandomCharacters(length=%llu)\n", llu(length));
+  
+  if (alphabet == NULL) {
+    alphabet = RANDOM_DEFAULT_ALPHABET;
+  }
+  u64 alphabetLength = strlen(alphabet);
+  if ((buffer == NULL) || (alphabetLength == 0)) {
+    printLog(ERR, "Invalid parameters.  buffer=%p, alphabetLength=%llu\n",
+      buffer, llu(alphabetLength));
+    printLog(TRACE, "EXIT getRandomCharacters(length=%llu) = {false}\n",
+      llu(length));
+    return false;
+  }
+  
+  u64 index = 0;
+  if (alphabetLength <= 256) {
+    // Map every possible byte value onto the alphabet up front.  Bytes at or
+    // beyond threshold would bias the distribution and are rejected.
+    u32 threshold = 256 - (256 % alphabetLength);
+    char byteMap[256];
+    for (u32 ii = 0; ii < 256; ii++) {
+      byteMap[ii] = alphabet[ii % alphabetLength];
+    }
+    
+    u8 bytes[RANDOM_BATCH_WORDS * sizeof(u64)];
+    while (index < length) {
+      getRandomBytes(bytes, sizeof(bytes));
+      for (u64 ii = 0; (ii < sizeof(bytes)) && (index < length); ii++) {
+        buffer[index] = byteMap[bytes[ii]];
+        index += (bytes[ii] < threshold);
+      }
+    }
+  } else {
+    u64 threshold = 0x100000000ULL - (0x100000000ULL % alphabetLength);
+    u32 values[RANDOM_BATCH_WORDS * 2];
+    while (index < length) {
+      getRandomBytes(values, sizeof(values));
+      for (u64 ii = 0; (ii < RANDOM_BATCH_WORDS * 2) && (index < length); ii++) {
+        if (values[ii] < threshold) {
+          buffer[index++] = alphabet[values[ii] % alphabetLength];
+        }
+      }
+    }
+  }
+  
+  printLog(TRACE, "EXIT getRandomCharacters(length=%llu) = {true}\n",
+    llu(length));
+  return true;
+}
+
+/// @fn Bytes bytesAddRandomCharacters(Bytes *buffer, u64 length,
+///   const char *alphabet)
+///
+/// @brief Append random characters drawn from an alphabet to a Bytes object.
+///
+/// @param buffer A pointer to the Bytes object to append to.  If *buffer is
+///   NULL, a new Bytes object is allocated.
+/// @param length The number of characters to append.
+/// @param alphabet The alphabet of characters to draw from.  Defaults to all
+///   printable ASCII characters if NULL.
+///
+/// @return Returns the updated Bytes object on success, NULL on failure.  On
+/// memory allocation failure, *buffer is destroyed and set to NULL.
+Bytes bytesAddRandomCharacters(Bytes *buffer, u64 length,
+  const char *alphabet
+) {
+  printLog(TRACE, "ENTER bytesAddRandomCharacters(length=%llu)\n",
+    llu(length));
+  
+  if (buffer == NULL) {
+    printLog(ERR, "NULL buffer provided.\n");
+    printLog(TRACE, "EXIT bytesAddRandomCharacters(length=%llu) = {NULL}\n",
+      llu(length));
+    return NULL;
+  }
+  
+  u64 bufferLength = bytesLength(*buffer);
+  if (bytesAllocate(buffer, bufferLength + length) == NULL) {
+    printLog(TRACE, "EXIT bytesAddRandomCharacters(length=%llu) = {NULL}\n",
+      llu(length));
+    return NULL;
+  }
+  
+  if (getRandomCharacters((char*) &(*buffer)[bufferLength], length, alphabet)
+    == false
+  ) {
+    (*buffer)[bufferLength] = '\0';
+    printLog(TRACE, "EXIT bytesAddRandomCharacters(length=%llu) = {NULL}\n",
+      llu(length));
+    return NULL;
+  }
+  (*buffer)[bufferLength + length] = '\0';
+  bytesSetLength(*buffer, bufferLength + length);
+  
+  printLog(TRACE, "EXIT bytesAddRandomCharacters(length=%llu) = {%p}\n",
+    llu(length), *buffer);
+  return *buffer;
+}
+
 /// @fn char *getRandomString_(u32 length, const char *userAlphabet, ...)
 ///
 /// @brief Get a random string of the specified length.
@@ -227,18 +573,10 @@ u64 startRandom(u64 seed) {
 ///   Defaults to all printable ASCII characters if NULL.
 ///
 /// @return Returns a newly-allocated random string on success, NULL on failure
-/// (memory allocation failure).
+/// (memory allocation failure or an empty alphabet).
 char *getRandomString_(u32 length, const char *userAlphabet, ...) {
   printLog(TRACE, "ENTER getRandomString(length=%u)\n", length);
   
-  const char *alphabet
-    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
-      "0123456789!@#$%^&*(),./;'[]\\-=`<>?:\"{}|_+~ \t\n";
-  if (userAlphabet != NULL) {
-    alphabet = userAlphabet;
-  }
-  u32 alphabetMax = strlen(alphabet) - 1;
-  
   char *randomString = (char*) malloc(length + 1);
   if (randomString == NULL) {
     LOG_MALLOC_FAILURE();
@@ -246,13 +584,13 @@ char *getRandomString_(u32 length, const char *userAlphabet, ...) {
   }
   randomString[length] = '\0';
   
-  for (u32 index = 0; index < length; ++index) {
-    randomString[index] = alphabet[getU32(alphabetMax)];
+  if (getRandomCharacters(randomString, length, userAlphabet) == false) {
+    free(randomString); randomString = NULL;
+    printLog(TRACE, "EXIT getRandomString(length=%u) = {NULL}\n", length);
+    return randomString;
   }
   
   printLog(TRACE, "EXIT getRandomString(length=%u) = {%s}\n",
     length, randomString);
   return randomString;
 }
-
-
@@ -31,6 +31,7 @@
 #include "RedBlackTree.h"
 #include "StringLib.h"
 #include "HashTable.h"
+#include "NodePool.h"
 #include "Vector.h" // For JSON
 
 #ifdef DS_LOGGING_ENABLED
@@ -44,20 +45,201 @@
 #define logThreshold 11 // NONE
 #endif
 
-/// @fn RedBlackTree *rbTreeCreate_(TypeDescriptor *keyType, bool disableThreadSafety, ...)
+#include "LockStats.h"
+
+// Forward declarations of the implementations of the public lookup functions.
+// Anything that already holds the tree has to call these instead of the
+// public versions because reader/writer locks are not recursive.
+static RedBlackNode *rbTreeSuccessorUnlocked(RedBlackTree *tree,
+  RedBlackNode *x);
+static RedBlackNode *rbTreePredecessorUnlocked(RedBlackTree *tree,
+  RedBlackNode *x);
+static RedBlackNode *rbQueryUnlocked(const RedBlackTree *tree,
+  const volatile void *q);
+
+/// @fn static inline void rbTreeLockShared(const RedBlackTree *tree)
+///
+/// @brief Lock a tree for an operation that only reads it.
+///
+/// @param tree The tree to lock.
+///
+/// @return This function returns no value.
+static inline void rbTreeLockShared(const RedBlackTree *tree) {
+  if (tree->rwLock != NULL) {
+    if (rwl_rdlock(tree->rwLock) != thrd_success) {
+      printLog(WARN, "Could not lock red black tree reader/writer lock.\n");
+    }
+  } else if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock red black tree mutex.\n");
+  }
+}
+
+/// @fn static inline void rbTreeUnlockShared(const RedBlackTree *tree)
+///
+/// @brief Release a lock taken by rbTreeLockShared.
+///
+/// @param tree The tree to unlock.
+///
+/// @return This function returns no value.
+static inline void rbTreeUnlockShared(const RedBlackTree *tree) {
+  if (tree->rwLock != NULL) {
+    rwl_rdunlock(tree->rwLock);
+  } else if (tree->lock != NULL) {
+    mtx_unlock(tree->lock);
+  }
+}
+
+/// @fn static inline void rbTreeLockExclusive(const RedBlackTree *tree)
+///
+/// @brief Lock a tree for an operation that modifies it.
+///
+/// @details The mutex is always taken first.  The List functions that operate
+/// on trees only know about the mutex, so holding it keeps them out while the
+/// tree is being modified.  Holding the reader/writer lock exclusive then
+/// waits for any readers to finish.
+///
+/// @param tree The tree to lock.
+///
+/// @return This function returns no value.
+static inline void rbTreeLockExclusive(const RedBlackTree *tree) {
+  if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock red black tree mutex.\n");
+  }
+  if ((tree->rwLock != NULL) && (rwl_wrlock(tree->rwLock) != thrd_success)) {
+    printLog(WARN, "Could not lock red black tree reader/writer lock.\n");
+  }
+}
+
+/// @fn static inline void rbTreeUnlockExclusive(const RedBlackTree *tree)
+///
+/// @brief Release a lock taken by rbTreeLockExclusive.
+///
+/// @param tree The tree to unlock.
+///
+/// @return This function returns no value.
+static inline void rbTreeUnlockExclusive(const RedBlackTree *tree) {
+  if (tree->rwLock != NULL) {
+    rwl_wrunlock(tree->rwLock);
+  }
+  if (tree->lock != NULL) {
+    mtx_unlock(tree->lock);
+  }
+}
+
+/// @fn static inline RedBlackNode *rbTreeFirstUnlocked(const RedBlackTree *tree)
+///
+/// @brief Implementation of rbTreeFirst.  The caller must hold the tree.
+///
+/// @param tree is the red-black tree to parse.
+///
+/// @return Returns the left-most node in the tree or NULL if the tree is
+///   empty.
+static inline RedBlackNode *rbTreeFirstUnlocked(const RedBlackTree *tree) {
+  if (tree->unlinked == false) {
+    return tree->head;
+  }
+  
+  RedBlackNode *nil = tree->nil;
+  RedBlackNode *x = tree->root->left;
+  if (x == nil) {
+    return NULL;
+  }
+  while (x->left != nil) {
+    x = x->left;
+  }
+  
+  return x;
+}
+
+/// @fn static inline RedBlackNode *rbTreeLastUnlocked(const RedBlackTree *tree)
+///
+/// @brief Implementation of rbTreeLast.  The caller must hold the tree.
+///
+/// @param tree is the red-black tree to parse.
+///
+/// @return Returns the right-most node in the tree or NULL if the tree is
+///   empty.
+static inline RedBlackNode *rbTreeLastUnlocked(const RedBlackTree *tree) {
+  if (tree->unlinked == false) {
+    return tree->tail;
+  }
+  
+  RedBlackNode *nil = tree->nil;
+  RedBlackNode *x = tree->root->left;
+  if (x == nil) {
+    return NULL;
+  }
+  while (x->right != nil) {
+    x = x->right;
+  }
+  
+  return x;
+}
+
+/// @fn static inline RedBlackNode *rbTreeNextUnlocked(const RedBlackTree *tree, RedBlackNode *x)
+///
+/// @brief Step to the next node in key order, following the node's next
+///   pointer if the tree maintains its list and walking the tree if not.  The
+///   caller must hold the tree.
+///
+/// @param tree is the tree that contains x.
+/// @param x is the current node.
+///
+/// @return Returns the next node or NULL if x is the last one.
+static inline RedBlackNode *rbTreeNextUnlocked(const RedBlackTree *tree,
+  RedBlackNode *x
+) {
+  return (tree->unlinked == false)
+    ? x->next : rbTreeSuccessorUnlocked((RedBlackTree*) tree, x);
+}
+
+/// @fn static inline RedBlackNode *rbTreePrevUnlocked(const RedBlackTree *tree, RedBlackNode *x)
+///
+/// @brief Step to the previous node in key order the way rbTreeNextUnlocked
+///   steps to the next one.  The caller must hold the tree.
+///
+/// @param tree is the tree that contains x.
+/// @param x is the current node.
+///
+/// @return Returns the previous node or NULL if x is the first one.
+static inline RedBlackNode *rbTreePrevUnlocked(const RedBlackTree *tree,
+  RedBlackNode *x
+) {
+  return (tree->unlinked == false)
+    ? x->prev : rbTreePredecessorUnlocked((RedBlackTree*) tree, x);
+}
+
+/// @fn RedBlackTree *rbTreeCreate_(TypeDescriptor *keyType, bool disableThreadSafety, bool sharedLocking, bool pooledNodes, bool unlinkedNodes, ...)
 ///
 /// @brief Allocates a new RedBlackTree and associated metadata.
 ///
 /// @param keyType is the TypeDescriptor to use for the keys in the tree.
 /// @param disableThreadSafety Whether or not to disable thread safety for the
 ///   RedBlackTree.
+/// @param sharedLocking Whether or not lookups in the tree should be able to
+///   run concurrently with each other.  Trees that are read far more often
+///   than they are modified should set this.  Ignored if disableThreadSafety
+///   is true.
+/// @param pooledNodes Whether or not to allocate the tree's nodes from a
+///   NodePool owned by the tree.  This is worth it for trees with a lot of
+///   churn.  Memory for removed nodes is kept for reuse until the tree is
+///   destroyed.  Nodes added to a pooled tree with rbTreeInsertNode must not
+///   be destroyed by the tree.
+/// @param unlinkedNodes Whether or not to skip keeping the nodes of the tree
+///   on its head/tail list in key order.  Without the list, inserts don't have
+///   to find and update the new node's neighbors, but stepping from one node
+///   to the next walks the tree instead of following a pointer.  Code that
+///   walks tree->head itself must call rbTreeLinkNodes first.
 ///
 /// @note This function is wrapped by a macro of the same name (minus the
 /// trailing underscore) that automatically provides false for the
-/// dsiableThreadSafety parameter.
+/// dsiableThreadSafety, sharedLocking, pooledNodes, and unlinkedNodes
+/// parameters.
 ///
 /// @return Returns a pointer to a newly-created RedBlackTree.
-RedBlackTree *rbTreeCreate_(TypeDescriptor *keyType, bool disableThreadSafety, ...) {
+RedBlackTree *rbTreeCreate_(TypeDescriptor *keyType, bool disableThreadSafety,
+  bool sharedLocking, bool pooledNodes, bool unlinkedNodes, ...
+) {
   printLog(TRACE, "ENTER rbTreeCreate(keyType=%s)\n",
     (keyType != NULL) ? keyType->name : "NULL");
   
@@ -70,19 +252,44 @@ RedBlackTree *rbTreeCreate_(TypeDescriptor *keyType, bool disableThreadSafety, .
   RedBlackTree *newTree = NULL;
   RedBlackNode *temp = NULL;
   
-  newTree = (RedBlackTree*) calloc(1, sizeof(RedBlackTree));
+  newTree = (RedBlackTree*)
+    allocatorCalloc(ALLOCATOR_RED_BLACK_TREE, NULL, 1, sizeof(RedBlackTree));
   if (newTree == NULL) {
     LOG_MALLOC_FAILURE();
     return NULL;
   }
   // No need to NULL-ify member varialbes since we used calloc.
   newTree->keyType = keyType;
+  newTree->nodeSubsystem = ALLOCATOR_RED_BLACK_TREE;
+  newTree->unlinked = unlinkedNodes;
   if (disableThreadSafety == false) {
     // The lock mtx_t member variable has to be zeroed, so use calloc here.
-    newTree->lock = (mtx_t*) calloc(1, sizeof(mtx_t));
+    newTree->lock = (mtx_t*)
+      allocatorCalloc(ALLOCATOR_RED_BLACK_TREE, NULL, 1, sizeof(mtx_t));
     if (mtx_init(newTree->lock, mtx_plain | mtx_recursive) != thrd_success) {
       printLog(ERR, "Could not initialize red black tree mutex lock.\n");
     }
+    if (sharedLocking == true) {
+      newTree->rwLock = (rwl_t*)
+        allocatorCalloc(ALLOCATOR_RED_BLACK_TREE, NULL, 1, sizeof(rwl_t));
+      if ((newTree->rwLock == NULL)
+        || (rwl_init(newTree->rwLock) != thrd_success)
+      ) {
+        // Not fatal.  The tree just falls back to the mutex.
+        printLog(ERR, "Could not initialize red black tree reader/writer lock.\n");
+        newTree->rwLock = (rwl_t*)
+          allocatorFree(ALLOCATOR_RED_BLACK_TREE, NULL, newTree->rwLock);
+      }
+    }
+  }
+  
+  if (pooledNodes == true) {
+    newTree->nodePool = nodePoolCreate(sizeof(RedBlackNode),
+      ALLOCATOR_RED_BLACK_TREE, keyType);
+    if (newTree->nodePool == NULL) {
+      // Not fatal.  The tree just falls back to malloc.
+      printLog(ERR, "Could not create red black tree node pool.\n");
+    }
   }
   
   // See the comment in the RedBlackTree structure in RedBlackTree.h
@@ -137,14 +344,14 @@ void leftRotate(RedBlackTree *tree, RedBlackNode *x) {
   
   y = x->right;
   x->right = y->left;
-
+  
   if (y->left != nil) {
     y->left->parent = x; // Formerly used a sentinel here
     // and did an unconditional assignment instead of testing for nil.
   }
   
   y->parent = x->parent;   
-
+  
   // Instead of checking if x->parent is the root as in the book, we
   // count on the root sentinel to implicitly take care of this case.
   if (x == x->parent->left) {
@@ -182,7 +389,7 @@ void rightRotate(RedBlackTree *tree, RedBlackNode *y) {
   
   RedBlackNode *x = NULL;
   RedBlackNode *nil = tree->nil;
-
+  
   // The author originally wrote this function to use the sentinel for
   // nil to avoid checking for nil.  However this introduces a
   // very subtle bug because sometimes this function modifies
@@ -192,15 +399,15 @@ void rightRotate(RedBlackTree *tree, RedBlackNode *y) {
   // after calling this function.  For example, when rbTreeDestroyNodeFixUp
   // calls rightRotate it expects the parent pointer of nil to be
   // unchanged.
-
+  
   x = y->left;
   y->left = x->right;
-
+  
   if (nil != x->right) {
     x->right->parent = y; // Formerly used a sentinel here
     // and did an unconditional assignment instead of testing for nil.
   }
-
+  
   // Instead of checking if x->parent is the root as in the book, we
   // count on the root sentinel to implicitly take care of this case.
   x->parent = y->parent;
@@ -269,79 +476,24 @@ void treeInsertHelp(RedBlackTree *tree, RedBlackNode *z) {
   printLog(TRACE, "EXIT treeInsertHelp(tree=%p, z=%p)\n", tree, z);
 }
 
-/// @fn RedBlackNode *rbInsert_(RedBlackTree *tree, const volatile void *key, const volatile void *value, TypeDescriptor *type, ...)
-///
-/// @brief Insert a new key/value pair into a RedBlackTree.
-///
-/// @details Creates a node node which contains the appropriate key and
-///   value pointers and inserts it into the tree.
+/// @fn static RedBlackNode *rbTreeInsertNodeUnlocked(RedBlackTree *tree, RedBlackNode *x)
 ///
-/// @param tree is a pointer ot the RedBlackTree to insert the key/value pair
-///   into.
-/// @param key is the key of the key/value pair to use for insertion.
-/// @param value is the value of the key/value pair to use for insertion.
-/// @param type is the TypeDescriptor that describes the value provided.
+/// @brief Implementation of rbTreeInsertNode.  The caller must hold the tree
+///   exclusive and must have validated the parameters.
 ///
-/// @note This function is wrapped by a define of the same name, minus the
-/// leading underscore.  The type parameter is optional when the define is
-/// used.
+/// @param tree is a pointer to the RedBlackTree to insert into.
+/// @param x is a pointer to the RedBlackNode to insert.
 ///
-/// @return This function returns a pointer to the newly inserted node
-///   which is guarunteed to be valid until this node is deleted.
-///   What this means is if another data structure stores this
-///   pointer then the tree does not need to be searched when this
-///   is to be deleted.
-RedBlackNode *rbInsert_(RedBlackTree *tree, const volatile void *key,
-  const volatile void *value, TypeDescriptor *type, ...
+/// @return Returns the node inserted.
+static RedBlackNode *rbTreeInsertNodeUnlocked(RedBlackTree *tree,
+  RedBlackNode *x
 ) {
-  printLog(TRACE, "ENTER rbInsert(tree=%p, key=%p, value=%p, type=%s)\n",
-    tree, key, value, (type != NULL) ? type->name : "NULL");
-  RedBlackNode *x = NULL;
-  RedBlackNode *y = NULL;
-  RedBlackNode *newNode = NULL, *neighbor = NULL;
-  RedBlackNode *nil = NULL;
-
-  // Sanity check the parameters
-  if (tree == NULL) {
-    printLog(ERR, "NULL tree provided.\n");
-    printLog(TRACE,
-      "EXIT rbInsert(tree=%p, key=%p, value=%p, type=%s) = {%p}\n",
-      tree, key, value, (type != NULL) ? type->name : "NULL", (void*) NULL);
-    return NULL;
-  }
-  if (key == NULL) {
-    printLog(ERR, "NULL key provided.\n");
-    printLog(TRACE,
-      "EXIT rbInsert(tree=%p, key=%p, value=%p, type=%s) = {%p}\n",
-      tree, key, value, (type != NULL) ? type->name : "NULL", (void*) NULL);
-    return NULL;
-  }
-  
-  if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
-    printLog(WARN, "Could not lock red black tree mutex.\n");
-  }
+  printLog(TRACE, "ENTER rbTreeInsertNodeUnlocked(tree=%p, x=%p)\n", tree, x);
   
-  if (type == NULL) {
-    if (tree->lastAddedType != NULL) {
-      type = tree->lastAddedType;
-      printLog(DEBUG, "Defaulting to type of last added element.\n");
-    } else {
-      type = tree->keyType;
-      printLog(DEBUG, "Defaulting to type of key.\n");
-    }
-  }
+  RedBlackNode *y = NULL;
+  RedBlackNode *newNode = x;
   
-  nil = tree->nil;
-  x = (RedBlackNode*) rbSafeMalloc(sizeof(RedBlackNode));
-  x->key = tree->keyType->copy(key);
-  x->value = type->copy(value);
-  x->type = type;
-  x->byteOffset = 0;
-  x->left = nil;
-  x->right = nil;
-
   treeInsertHelp(tree, x);
-  newNode = x;
   x->red = true;
   while (x->parent->red == true) { // use sentinel instead of checking for root
     if (x->parent == x->parent->parent->left) {
@@ -380,193 +532,579 @@ RedBlackNode *rbInsert_(RedBlackTree *tree, const volatile void *key,
   }
   tree->root->left->red = false;
   tree->size++;
-
-  neighbor = rbTreePredecessor(tree, newNode);
-  if (neighbor == nil) {
-    neighbor = NULL;
-  }
-  if (neighbor != NULL) {
-    neighbor->next = newNode;
-  }
-  newNode->prev = neighbor;
-  neighbor = rbTreeSuccessor(tree, newNode);
-  if (neighbor == nil) {
-    neighbor = NULL;
-  }
-  if (neighbor != NULL) {
-    neighbor->prev = newNode;
-  }
-  newNode->next = neighbor;
-  
-  if (newNode->prev == NULL) {
-    // First node in the tree
-    tree->head = newNode;
-  }
-  if (newNode->next == NULL) {
-    // Last node in the tree
-    tree->tail = newNode;
-  }
-  
-  // If we made it this far then the add was successful.  Record the type for
-  // future use if desired.
-  tree->lastAddedType = type;
-  
-  if (tree->lock != NULL) {
-    mtx_unlock(tree->lock);
-  }
   
 #ifdef DEBUG_ASSERT
-  rbAssert((tree->nil->red == false), "nil not black in rbInsert");
-  rbAssert((tree->root->red == false), "root not black in rbInsert");
+  rbAssert((tree->nil->red == false), "nil not black in rbTreeInsertNodeUnlocked");
+  rbAssert((tree->root->red == false), "root not black in rbTreeInsertNodeUnlocked");
 #endif
   
-  printLog(TRACE, "EXIT rbInsert(tree=%p, key=%p, value=%p, type=%s) = {%p}\n",
-    tree, key, value, type->name, newNode);
+  printLog(TRACE, "EXIT rbTreeInsertNodeUnlocked(tree=%p, x=%p) = {%p}\n",
+    tree, newNode, newNode);
   return newNode;
 }
 
-RedBlackNode* (*rbTreeAddEntry_)(RedBlackTree *tree, const volatile void *key,
-  const volatile void *value, TypeDescriptor *type, ...) = rbInsert_;
-
-/// @fn RedBlackNode *rbTreeSuccessor(RedBlackTree *tree, RedBlackNode *x)
+/// @fn RedBlackNode *rbTreeInsertNode(RedBlackTree *tree, RedBlackNode *x)
 ///
-/// @brief find the successor of a RedBlackNode in a tree.
+/// @brief Insert an already-allocated node into the structure of a
+///   RedBlackTree and restore the red-black properties.
 ///
-/// @param tree is a pointer to the RedBlackTree to search.
-/// @param x is a pointer to the node to find the successor of.
+/// @details The key, value, and type of the node must already be populated.
+///   Only the left, right, parent, and red members of the node are modified.
+///   The prev and next members are left untouched so that containers that
+///   maintain their own linkage through the nodes (such as HashTable) can use
+///   the tree as a pure index.  The size of the tree is incremented.
 ///
-/// @return This function returns the successor of x or NULL if no
-///   successor exists.
+/// @param tree is a pointer to the RedBlackTree to insert into.
+/// @param x is a pointer to the RedBlackNode to insert.
 ///
-/// @note Uses the algorithm in _Introduction_To_Algorithms_.
-RedBlackNode *rbTreeSuccessor(RedBlackTree *tree, RedBlackNode *x) {
-  printLog(TRACE, "ENTER rbTreeSuccessor(tree=%p, x=%p)\n", tree, x);
+/// @return Returns the node inserted on success, NULL on failure.
+RedBlackNode *rbTreeInsertNode(RedBlackTree *tree, RedBlackNode *x) {
+  printLog(TRACE, "ENTER rbTreeInsertNode(tree=%p, x=%p)\n", tree, x);
   
-  // Parameter check.
-  if (tree == NULL) {
-    printLog(ERR, "tree is NULL.\n");
-    printLog(TRACE, "EXIT rbTreeSuccessor(tree=%p, x=%p) = {%p}\n",
-      tree, x, (void*) NULL);
-    return NULL;
-  }
-  if (x == NULL) {
-    printLog(ERR, "x is NULL.\n");
-    printLog(TRACE, "EXIT rbTreeSuccessor(tree=%p, x=%p) = {%p}\n",
+  if ((tree == NULL) || (x == NULL)) {
+    printLog(ERR, "One or more NULL parameters.\n");
+    printLog(TRACE, "EXIT rbTreeInsertNode(tree=%p, x=%p) = {%p}\n",
       tree, x, (void*) NULL);
     return NULL;
   }
   
-  if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
-    printLog(WARN, "Could not lock red black tree mutex.\n");
-  }
-  
-  RedBlackNode *y = NULL;
-  RedBlackNode *nil = tree->nil;
-  RedBlackNode *root = tree->root;
+  rbTreeLockExclusive(tree);
+  RedBlackNode *newNode = rbTreeInsertNodeUnlocked(tree, x);
+  rbTreeUnlockExclusive(tree);
   
-  if (nil != (y = x->right)) { // assignment to y is intentional
-    while (y->left != nil) { // returns the minium of the right subtree of x
-      y = y->left;
-    }
-    
-    if (tree->lock != NULL) {
-      mtx_unlock(tree->lock);
-    }
-    
-    printLog(TRACE, "EXIT rbTreeSuccessor(tree=%p, x=%p) = {%p}\n", tree, x, y);
-    return y;
-  } else {
-    y = x->parent;
-    while (x == y->right) { // sentinel used instead of checking for nil
-      x = y;
-      y = y->parent;
-    }
-    
-    if (tree->lock != NULL) {
-      mtx_unlock(tree->lock);
-    }
-    
-    if (y == root) {
-      printLog(TRACE, "EXIT rbTreeSuccessor(tree=%p, x=%p) = {NULL}\n", tree, x);
-      return NULL;
-    }
-    
-    printLog(TRACE, "EXIT rbTreeSuccessor(tree=%p, x=%p) = {%p}\n", tree, x, y);
-    return y;
-  }
+  printLog(TRACE, "EXIT rbTreeInsertNode(tree=%p, x=%p) = {%p}\n",
+    tree, x, newNode);
+  return newNode;
 }
 
-/// @fn RedBlackNode *rbTreePredecessor(RedBlackTree *tree, RedBlackNode *x)
+/// @fn static RedBlackNode *rbTreeNewNode(RedBlackTree *tree, const volatile void *key, const volatile void *value, TypeDescriptor *type)
 ///
-/// @brief Finds the predecessor of a node in a RedBlackTree.
+/// @brief Allocate a node for a tree and populate it with copies of the key
+///   and value.  The node is not linked into the tree.
+///
+/// @param tree is a pointer to the RedBlackTree the node is for.
+/// @param key is the key to copy into the node.
+/// @param value is the value to copy into the node.
+/// @param type is the TypeDescriptor that describes the value provided.
+///
+/// @return Returns the new node on success, NULL on failure.
+static RedBlackNode *rbTreeNewNode(RedBlackTree *tree,
+  const volatile void *key, const volatile void *value, TypeDescriptor *type
+) {
+  RedBlackNode *x = NULL;
+  if (tree->nodePool == NULL) {
+    x = (RedBlackNode*) allocatorMalloc(tree->nodeSubsystem, tree->keyType,
+      sizeof(RedBlackNode));
+    if (x == NULL) {
+      LOG_MALLOC_FAILURE();
+      return NULL;
+    }
+  } else {
+    x = (RedBlackNode*) nodePoolAlloc(tree->nodePool, sizeof(RedBlackNode));
+    if (x == NULL) {
+      printLog(ERR, "Could not allocate node from tree node pool.\n");
+      return NULL;
+    }
+  }
+  x->key = tree->keyType->copy(key);
+  x->value = type->copy(value);
+  x->type = type;
+  x->byteOffset = 0;
+  x->left = tree->nil;
+  x->right = tree->nil;
+  
+  return x;
+}
+
+/// @fn static inline RedBlackNode* rbTreeFreeNode(RedBlackTree *tree, RedBlackNode *node)
+///
+/// @brief Release the memory of a node to the tree's NodePool or, if it
+///   doesn't have one, to the allocator.
+///
+/// @param tree is a pointer to the RedBlackTree the node belongs to.
+/// @param node is the node to release.
+///
+/// @return Always returns NULL.
+static inline RedBlackNode* rbTreeFreeNode(RedBlackTree *tree,
+  RedBlackNode *node
+) {
+  if (tree->nodePool != NULL) {
+    return (RedBlackNode*) nodePoolFree(tree->nodePool, node);
+  }
+  
+  return (RedBlackNode*)
+    allocatorFree(tree->nodeSubsystem, tree->keyType, node);
+}
+
+/// @fn RedBlackNode *rbInsert_(RedBlackTree *tree, const volatile void *key, const volatile void *value, TypeDescriptor *type, ...)
+///
+/// @brief Insert a new key/value pair into a RedBlackTree.
+///
+/// @details Creates a node node which contains the appropriate key and
+///   value pointers and inserts it into the tree.
+///
+/// @param tree is a pointer ot the RedBlackTree to insert the key/value pair
+///   into.
+/// @param key is the key of the key/value pair to use for insertion.
+/// @param value is the value of the key/value pair to use for insertion.
+/// @param type is the TypeDescriptor that describes the value provided.
+///
+/// @note This function is wrapped by a define of the same name, minus the
+/// leading underscore.  The type parameter is optional when the define is
+/// used.
+///
+/// @return This function returns a pointer to the newly inserted node
+///   which is guarunteed to be valid until this node is deleted.
+///   What this means is if another data structure stores this
+///   pointer then the tree does not need to be searched when this
+///   is to be deleted.
+RedBlackNode *rbInsert_(RedBlackTree *tree, const volatile void *key,
+  const volatile void *value, TypeDescriptor *type, ...
+) {
+  printLog(TRACE, "ENTER rbInsert(tree=%p, key=%p, value=%p, type=%s)\n",
+    tree, key, value, (type != NULL) ? type->name : "NULL");
+  RedBlackNode *x = NULL;
+  RedBlackNode *newNode = NULL, *neighbor = NULL;
+  RedBlackNode *nil = NULL;
+  
+  // Sanity check the parameters
+  if (tree == NULL) {
+    printLog(ERR, "NULL tree provided.\n");
+    printLog(TRACE,
+      "EXIT rbInsert(tree=%p, key=%p, value=%p, type=%s) = {%p}\n",
+      tree, key, value, (type != NULL) ? type->name : "NULL", (void*) NULL);
+    return NULL;
+  }
+  if (key == NULL) {
+    printLog(ERR, "NULL key provided.\n");
+    printLog(TRACE,
+      "EXIT rbInsert(tree=%p, key=%p, value=%p, type=%s) = {%p}\n",
+      tree, key, value, (type != NULL) ? type->name : "NULL", (void*) NULL);
+    return NULL;
+  }
+  
+  rbTreeLockExclusive(tree);
+  
+  if (type == NULL) {
+    if (tree->lastAddedType != NULL) {
+      type = tree->lastAddedType;
+      printLog(DEBUG, "Defaulting to type of last added element.\n");
+    } else {
+      type = tree->keyType;
+      printLog(DEBUG, "Defaulting to type of key.\n");
+    }
+  }
+  
+  nil = tree->nil;
+  x = rbTreeNewNode(tree, key, value, type);
+  if (x == NULL) {
+    rbTreeUnlockExclusive(tree);
+    printLog(TRACE,
+      "EXIT rbInsert(tree=%p, key=%p, value=%p, type=%s) = {%p}\n",
+      tree, key, value, type->name, (void*) NULL);
+    return NULL;
+  }
+  
+  newNode = rbTreeInsertNodeUnlocked(tree, x);
+  if (tree->unlinked == true) {
+    // Whatever rbTreeLinkNodes last threaded no longer includes every node.
+    tree->head = NULL;
+    tree->tail = NULL;
+    tree->lastAddedType = type;
+    rbTreeUnlockExclusive(tree);
+    
+    printLog(TRACE,
+      "EXIT rbInsert(tree=%p, key=%p, value=%p, type=%s) = {%p}\n",
+      tree, key, value, type->name, newNode);
+    return newNode;
+  }
+  
+  neighbor = rbTreePredecessorUnlocked(tree, newNode);
+  if (neighbor == nil) {
+    neighbor = NULL;
+  }
+  if (neighbor != NULL) {
+    neighbor->next = newNode;
+  }
+  newNode->prev = neighbor;
+  neighbor = rbTreeSuccessorUnlocked(tree, newNode);
+  if (neighbor == nil) {
+    neighbor = NULL;
+  }
+  if (neighbor != NULL) {
+    neighbor->prev = newNode;
+  }
+  newNode->next = neighbor;
+  
+  if (newNode->prev == NULL) {
+    // First node in the tree
+    tree->head = newNode;
+  }
+  if (newNode->next == NULL) {
+    // Last node in the tree
+    tree->tail = newNode;
+  }
+  
+  // If we made it this far then the add was successful.  Record the type for
+  // future use if desired.
+  tree->lastAddedType = type;
+  
+  rbTreeUnlockExclusive(tree);
+  
+  printLog(TRACE, "EXIT rbInsert(tree=%p, key=%p, value=%p, type=%s) = {%p}\n",
+    tree, key, value, type->name, newNode);
+  return newNode;
+}
+
+RedBlackNode* (*rbTreeAddEntry_)(RedBlackTree *tree, const volatile void *key,
+  const volatile void *value, TypeDescriptor *type, ...) = rbInsert_;
+
+/// @fn static RedBlackNode *rbTreeBuildRange(RedBlackTree *tree, u32 level, i64 low, i64 high, u32 redLevel, RedBlackNode **cursor)
+///
+/// @brief Recursively shape the nodes at positions low through high of a
+///   tree's prev/next chain into a balanced subtree.
+///
+/// @param tree is a pointer to the RedBlackTree being built.
+/// @param level is the depth of the subtree's root in the whole tree.
+/// @param low is the chain position of the first node of the subtree.
+/// @param high is the chain position of the last node of the subtree.
+/// @param redLevel is the depth of the only level that is colored red.
+/// @param cursor is a pointer to the next unconsumed node of the chain.  It
+///   is advanced past every node placed in the subtree.
+///
+/// @return Returns the root of the subtree, tree->nil if it is empty.
+static RedBlackNode *rbTreeBuildRange(RedBlackTree *tree, u32 level,
+  i64 low, i64 high, u32 redLevel, RedBlackNode **cursor
+) {
+  if (high < low) {
+    return tree->nil;
+  }
+  
+  i64 middle = low + ((high - low) >> 1);
+  RedBlackNode *left = rbTreeBuildRange(tree, level + 1, low, middle - 1,
+    redLevel, cursor);
+  RedBlackNode *x = *cursor;
+  *cursor = x->next;
+  RedBlackNode *right = rbTreeBuildRange(tree, level + 1, middle + 1, high,
+    redLevel, cursor);
+  
+  x->left = left;
+  if (left != tree->nil) {
+    left->parent = x;
+  }
+  x->right = right;
+  if (right != tree->nil) {
+    right->parent = x;
+  }
+  x->red = (level == redLevel);
+  
+  return x;
+}
+
+/// @fn static void rbTreeBuildLinked(RedBlackTree *tree)
+///
+/// @brief Build the structure of a tree whose nodes have only been threaded
+///   onto its prev/next chain by rbTreeAppendSorted.
+///
+/// @details The chain is already in key order, so the nodes are split around
+///   their midpoints into a balanced tree in linear time instead of being
+///   inserted one at a time.  Every level of the result is full except
+///   possibly the deepest one, which is colored red and everything above it
+///   black, so the red-black properties hold without any rotations.  This
+///   is a no-op if the tree is empty or its structure is already built.
+///
+/// @param tree is a pointer to the RedBlackTree to build.
+///
+/// @return This function returns no value.
+static void rbTreeBuildLinked(RedBlackTree *tree) {
+  if ((tree->head == NULL) || (tree->root->left != tree->nil)) {
+    return;
+  }
+  
+  // The deepest level is the only one that may be partially filled.
+  u32 redLevel = 0;
+  for (i64 ii = ((i64) tree->size) - 1; ii >= 0; ii = (ii / 2) - 1) {
+    redLevel++;
+  }
+  
+  RedBlackNode *cursor = tree->head;
+  RedBlackNode *top
+    = rbTreeBuildRange(tree, 0, 0, ((i64) tree->size) - 1, redLevel, &cursor);
+  top->parent = tree->root;
+  top->red = false;
+  tree->root->left = top;
+  
+#ifdef DEBUG_ASSERT
+  rbAssert((cursor == NULL), "chain not consumed in rbTreeBuildLinked");
+#endif
+}
+
+/// @fn static RedBlackNode *rbTreeAppendSorted(RedBlackTree *tree, const volatile void *key, const volatile void *value, TypeDescriptor *type)
+///
+/// @brief Add a key/value pair to a tree that is being loaded in key order.
+///
+/// @details As long as each key is greater than or equal to the one before
+///   it, the new node is only threaded onto the end of the tree's prev/next
+///   chain and rbTreeBuildLinked has to be called once all of the pairs have
+///   been appended.  The first key that is out of order causes the structure
+///   to be built from the nodes appended so far and that key, and every one
+///   after it, to go through rbInsert instead, so unsorted input is still
+///   loaded correctly, just without the speedup.
+///
+/// @param tree is a pointer to the RedBlackTree to add to.  It must not be
+///   visible to any other thread until rbTreeBuildLinked has been called.
+/// @param key is the key of the key/value pair to add.
+/// @param value is the value of the key/value pair to add.
+/// @param type is the TypeDescriptor that describes the value provided.
+///
+/// @return Returns the node added on success, NULL on failure.
+static RedBlackNode *rbTreeAppendSorted(RedBlackTree *tree,
+  const volatile void *key, const volatile void *value, TypeDescriptor *type
+) {
+  if ((key == NULL) || (tree->root->left != tree->nil)
+    || ((tree->tail != NULL)
+      && (tree->keyType->compare(tree->tail->key, key) > 0))
+  ) {
+    rbTreeBuildLinked(tree);
+    return rbInsert(tree, key, value, type);
+  }
+  
+  RedBlackNode *x = rbTreeNewNode(tree, key, value, type);
+  if (x == NULL) {
+    return NULL;
+  }
+  x->prev = tree->tail;
+  x->next = NULL;
+  if (tree->tail != NULL) {
+    tree->tail->next = x;
+  } else {
+    tree->head = x;
+  }
+  tree->tail = x;
+  tree->size++;
+  tree->lastAddedType = type;
+  
+  return x;
+}
+
+/// @fn RedBlackTree *rbTreeBuildSorted_(TypeDescriptor *keyType, const volatile void *const *keys, const volatile void *const *values, u64 numEntries, TypeDescriptor *type, ...)
+///
+/// @brief Create a RedBlackTree from arrays of keys and values that are
+///   already sorted by key.
+///
+/// @details The tree is built in linear time with its prev/next links
+///   threaded as it goes rather than by inserting and rebalancing one entry
+///   at a time.  Input that turns out not to be sorted is still loaded
+///   correctly, but everything from the first out-of-order key on is inserted
+///   the slow way.
+///
+/// @param keyType is the TypeDescriptor for the keys of the new tree.
+/// @param keys is the array of keys, in ascending order.
+/// @param values is the array of values that go with the keys.  May be NULL,
+///   in which case each key is also used as its value.
+/// @param numEntries is the number of elements in keys (and values).
+/// @param type is the TypeDescriptor that describes the values.  Defaults to
+///   keyType.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that makes the type parameter optional.
+///
+/// @return Returns a pointer to a newly-created RedBlackTree on success, NULL
+///   on failure.
+RedBlackTree *rbTreeBuildSorted_(TypeDescriptor *keyType,
+  const volatile void *const *keys, const volatile void *const *values,
+  u64 numEntries, TypeDescriptor *type, ...
+) {
+  printLog(TRACE,
+    "ENTER rbTreeBuildSorted(keyType=%s, keys=%p, values=%p, numEntries=%llu)\n",
+    (keyType != NULL) ? keyType->name : "NULL", keys, values, llu(numEntries));
+  
+  if ((keys == NULL) && (numEntries > 0)) {
+    printLog(ERR, "NULL keys provided.\n");
+    printLog(TRACE,
+      "EXIT rbTreeBuildSorted(keyType=%s, keys=%p, values=%p, numEntries=%llu) = {%p}\n",
+      (keyType != NULL) ? keyType->name : "NULL", keys, values,
+      llu(numEntries), (void*) NULL);
+    return NULL;
+  }
+  
+  RedBlackTree *tree = rbTreeCreate(keyType);
+  if (tree == NULL) {
+    printLog(TRACE,
+      "EXIT rbTreeBuildSorted(keyType=%s, keys=%p, values=%p, numEntries=%llu) = {%p}\n",
+      (keyType != NULL) ? keyType->name : "NULL", keys, values,
+      llu(numEntries), (void*) NULL);
+    return NULL;
+  }
+  if (type == NULL) {
+    type = keyType;
+  }
+  
+  for (u64 ii = 0; ii < numEntries; ii++) {
+    const volatile void *value = (values != NULL) ? values[ii] : keys[ii];
+    if (rbTreeAppendSorted(tree, keys[ii], value, type) == NULL) {
+      printLog(ERR, "Could not add entry %llu to tree.\n", llu(ii));
+    }
+  }
+  rbTreeBuildLinked(tree);
+  
+  printLog(TRACE,
+    "EXIT rbTreeBuildSorted(keyType=%s, keys=%p, values=%p, numEntries=%llu) = {%p}\n",
+    keyType->name, keys, values, llu(numEntries), tree);
+  return tree;
+}
+
+/// @fn static RedBlackNode *rbTreeSuccessorUnlocked(RedBlackTree *tree, RedBlackNode *x)
+///
+/// @brief Implementation of rbTreeSuccessor.  The caller must hold the tree
+///   and must have validated the parameters.
 ///
 /// @param tree is a pointer to the RedBlackTree to search.
-/// @param x is a pointer to the node to find the predecessor of.
+/// @param x is a pointer to the node to find the successor of.
 ///
-/// @return This function returns the predecessor of x or NULL if no
-///   predecessor exists.
+/// @return This function returns the successor of x or NULL if no
+///   successor exists.
 ///
 /// @note Uses the algorithm in _Introduction_To_Algorithms_.
-RedBlackNode *rbTreePredecessor(RedBlackTree *tree, RedBlackNode *x) {
-  printLog(TRACE, "ENTER rbTreePredecessor(tree=%p, x=%p)\n", tree, x);
+static RedBlackNode *rbTreeSuccessorUnlocked(RedBlackTree *tree,
+  RedBlackNode *x
+) {
+  RedBlackNode *y = NULL;
+  RedBlackNode *nil = tree->nil;
+  RedBlackNode *root = tree->root;
+  
+  if (nil != (y = x->right)) { // assignment to y is intentional
+    while (y->left != nil) { // returns the minium of the right subtree of x
+      y = y->left;
+    }
+    
+    return y;
+  } else {
+    y = x->parent;
+    while (x == y->right) { // sentinel used instead of checking for nil
+      x = y;
+      y = y->parent;
+    }
+    
+    if (y == root) {
+      return NULL;
+    }
+    
+    return y;
+  }
+}
+
+/// @fn RedBlackNode *rbTreeSuccessor(RedBlackTree *tree, RedBlackNode *x)
+///
+/// @brief find the successor of a RedBlackNode in a tree.
+///
+/// @param tree is a pointer to the RedBlackTree to search.
+/// @param x is a pointer to the node to find the successor of.
+///
+/// @return This function returns the successor of x or NULL if no
+///   successor exists.
+///
+/// @note Uses the algorithm in _Introduction_To_Algorithms_.
+RedBlackNode *rbTreeSuccessor(RedBlackTree *tree, RedBlackNode *x) {
+  printLog(TRACE, "ENTER rbTreeSuccessor(tree=%p, x=%p)\n", tree, x);
   
   // Parameter check.
   if (tree == NULL) {
     printLog(ERR, "tree is NULL.\n");
-    printLog(TRACE, "EXIT rbTreePredecessor(tree=%p, x=%p) = {%p}\n",
+    printLog(TRACE, "EXIT rbTreeSuccessor(tree=%p, x=%p) = {%p}\n",
       tree, x, (void*) NULL);
     return NULL;
   }
   if (x == NULL) {
     printLog(ERR, "x is NULL.\n");
-    printLog(TRACE, "EXIT rbTreePredecessor(tree=%p, x=%p) = {%p}\n",
+    printLog(TRACE, "EXIT rbTreeSuccessor(tree=%p, x=%p) = {%p}\n",
       tree, x, (void*) NULL);
     return NULL;
   }
   
-  if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
-    printLog(WARN, "Could not lock red black tree mutex.\n");
-  }
+  rbTreeLockShared(tree);
+  RedBlackNode *y = rbTreeSuccessorUnlocked(tree, x);
+  rbTreeUnlockShared(tree);
   
+  printLog(TRACE, "EXIT rbTreeSuccessor(tree=%p, x=%p) = {%p}\n", tree, x, y);
+  return y;
+}
+
+/// @fn static RedBlackNode *rbTreePredecessorUnlocked(RedBlackTree *tree, RedBlackNode *x)
+///
+/// @brief Implementation of rbTreePredecessor.  The caller must hold the tree
+///   and must have validated the parameters.
+///
+/// @param tree is a pointer to the RedBlackTree to search.
+/// @param x is a pointer to the node to find the predecessor of.
+///
+/// @return This function returns the predecessor of x or NULL if no
+///   predecessor exists.
+///
+/// @note Uses the algorithm in _Introduction_To_Algorithms_.
+static RedBlackNode *rbTreePredecessorUnlocked(RedBlackTree *tree,
+  RedBlackNode *x
+) {
   RedBlackNode *y = NULL;
   RedBlackNode *nil = tree->nil;
   RedBlackNode *root = tree->root;
-
+  
   if (nil != (y = x->left)) { // assignment to y is intentional
     while (y->right != nil) { // returns the maximum of the left subtree of x
       y = y->right;
     }
     
-    if (tree->lock != NULL) {
-      mtx_unlock(tree->lock);
-    }
-    
-    printLog(TRACE, "EXIT rbTreePredecessor(tree=%p, x=%p) = {%p}\n", tree, x, y);
     return y;
   } else {
     y = x->parent;
     while (x == y->left) { 
       if (y == root) {
-        if (tree->lock != NULL) {
-          mtx_unlock(tree->lock);
-        }
-        
-        printLog(TRACE, "EXIT rbTreePredecessor(tree=%p, x=%p) = {NULL}\n", tree, x);
         return NULL; 
       }
       x = y;
       y = y->parent;
     }
     
-    if (tree->lock != NULL) {
-      mtx_unlock(tree->lock);
-    }
-    
-    printLog(TRACE, "EXIT rbTreePredecessor(tree=%p, x=%p) = {%p}\n", tree, x, y);
     return y;
   }
 }
 
+/// @fn RedBlackNode *rbTreePredecessor(RedBlackTree *tree, RedBlackNode *x)
+///
+/// @brief Finds the predecessor of a node in a RedBlackTree.
+///
+/// @param tree is a pointer to the RedBlackTree to search.
+/// @param x is a pointer to the node to find the predecessor of.
+///
+/// @return This function returns the predecessor of x or NULL if no
+///   predecessor exists.
+///
+/// @note Uses the algorithm in _Introduction_To_Algorithms_.
+RedBlackNode *rbTreePredecessor(RedBlackTree *tree, RedBlackNode *x) {
+  printLog(TRACE, "ENTER rbTreePredecessor(tree=%p, x=%p)\n", tree, x);
+  
+  // Parameter check.
+  if (tree == NULL) {
+    printLog(ERR, "tree is NULL.\n");
+    printLog(TRACE, "EXIT rbTreePredecessor(tree=%p, x=%p) = {%p}\n",
+      tree, x, (void*) NULL);
+    return NULL;
+  }
+  if (x == NULL) {
+    printLog(ERR, "x is NULL.\n");
+    printLog(TRACE, "EXIT rbTreePredecessor(tree=%p, x=%p) = {%p}\n",
+      tree, x, (void*) NULL);
+    return NULL;
+  }
+  
+  rbTreeLockShared(tree);
+  RedBlackNode *y = rbTreePredecessorUnlocked(tree, x);
+  rbTreeUnlockShared(tree);
+  
+  printLog(TRACE, "EXIT rbTreePredecessor(tree=%p, x=%p) = {%p}\n", tree, x, y);
+  return y;
+}
+
 /// @fn RedBlackNode *rbTreeFirst(RedBlackTree *tree)
 ///
 /// @brief Find the left-most node (the first node) in the tree.
@@ -585,20 +1123,12 @@ RedBlackNode *rbTreeFirst(RedBlackTree *tree) {
     return NULL;
   }
   
-  /* Suboptimal now
-   * JBC 2019-09-29
-   * RedBlackNode *nil = tree->nil;
-   * RedBlackNode *x = tree->root->left;
-   * RedBlackNode *y = NULL;
-   * 
-   * while (x != nil) {
-   *   y = x;
-   *   x = x->left;
-   * }
-   */
+  rbTreeLockShared(tree);
+  RedBlackNode *x = rbTreeFirstUnlocked(tree);
+  rbTreeUnlockShared(tree);
   
-  printLog(TRACE, "EXIT rbTreeFirst(tree=%p) = {%p}\n", tree, tree->head);
-  return tree->head;
+  printLog(TRACE, "EXIT rbTreeFirst(tree=%p) = {%p}\n", tree, x);
+  return x;
 }
 
 /// @fn RedBlackNode *rbTreeLast(RedBlackTree *tree)
@@ -619,23 +1149,64 @@ RedBlackNode *rbTreeLast(RedBlackTree *tree) {
     return NULL;
   }
   
-  /* Suboptimal now
-   * JBC 2019-09-29
-   * RedBlackNode *nil = tree->nil;
-   * RedBlackNode *x = tree->root->left;
-   * RedBlackNode *y = NULL;
-   * 
-   * while (x != nil) {
-   *   y = x;
-   *   x = x->right;
-   * }
-   */
+  rbTreeLockShared(tree);
+  RedBlackNode *x = rbTreeLastUnlocked(tree);
+  rbTreeUnlockShared(tree);
   
-  printLog(TRACE, "EXIT rbTreeLast(tree=%p) = {%p}\n", tree, tree->tail);
-  return tree->tail;
+  printLog(TRACE, "EXIT rbTreeLast(tree=%p) = {%p}\n", tree, x);
+  return x;
 }
 
 
+/// @fn RedBlackTree *rbTreeLinkNodes(const RedBlackTree *tree)
+///
+/// @brief Make sure the head/tail list of a tree includes all of its nodes in
+///   key order.
+///
+/// @details Trees created with unlinkedNodes don't maintain the list as
+///   entries are added and removed.  This threads every node onto it so that
+///   the tree can be walked from head to tail or passed to the List
+///   functions.  The list stays valid until the next add or remove.  This is
+///   a no-op for trees that maintain the list and for unlinked trees that
+///   haven't been modified since they were last linked.
+///
+/// @param tree is the tree to link.
+///
+/// @return Returns the tree, so that calls can be nested.
+RedBlackTree *rbTreeLinkNodes(const RedBlackTree *tree) {
+  printLog(TRACE, "ENTER rbTreeLinkNodes(tree=%p)\n", tree);
+  
+  RedBlackTree *linked = (RedBlackTree*) tree;
+  if ((linked == NULL) || (linked->unlinked == false)) {
+    printLog(TRACE, "EXIT rbTreeLinkNodes(tree=%p) = {%p}\n", tree, linked);
+    return linked;
+  }
+  
+  rbTreeLockExclusive(linked);
+  
+  if ((linked->head == NULL) && (linked->size > 0)) {
+    RedBlackNode *prev = NULL;
+    for (RedBlackNode *x = rbTreeFirstUnlocked(linked); x != NULL;
+      x = rbTreeSuccessorUnlocked(linked, x)
+    ) {
+      x->prev = prev;
+      x->next = NULL;
+      if (prev != NULL) {
+        prev->next = x;
+      } else {
+        linked->head = x;
+      }
+      prev = x;
+    }
+    linked->tail = prev;
+  }
+  
+  rbTreeUnlockExclusive(linked);
+  
+  printLog(TRACE, "EXIT rbTreeLinkNodes(tree=%p) = {%p}\n", tree, linked);
+  return linked;
+}
+
 /// @fn static void treeDestroyHelper(RedBlackTree *tree, RedBlackNode *x)
 ///
 /// @brief This function recursively destroys the nodes of the tree
@@ -656,7 +1227,7 @@ void treeDestroyHelper(RedBlackTree *tree, RedBlackNode *x) {
     treeDestroyHelper(tree, x->right); x->right = NULL;
     tree->keyType->destroy(x->key); x->key = NULL;
     x->type->destroy(x->value); x->value = NULL;
-    x = (RedBlackNode*) pointerDestroy(x);
+    x = rbTreeFreeNode(tree, x);
     tree->size--;
   }
   
@@ -679,13 +1250,22 @@ RedBlackTree *rbTreeDestroy(RedBlackTree *tree) {
   }
   
   treeDestroyHelper(tree, tree->root->left); tree->root->left = NULL;
-  tree->root = (RedBlackNode*) pointerDestroy(tree->root);
-  tree->nil = (RedBlackNode*) pointerDestroy(tree->nil);
+  tree->root = (RedBlackNode*)
+    allocatorFree(ALLOCATOR_RED_BLACK_TREE, NULL, tree->root);
+  tree->nil = (RedBlackNode*)
+    allocatorFree(ALLOCATOR_RED_BLACK_TREE, NULL, tree->nil);
   if (tree->lock != NULL) {
     mtx_destroy(tree->lock);
   }
-  tree->lock = (mtx_t*) pointerDestroy(tree->lock);
-  tree = (RedBlackTree*) pointerDestroy(tree);
+  tree->lock = (mtx_t*)
+    allocatorFree(ALLOCATOR_RED_BLACK_TREE, NULL, tree->lock);
+  if (tree->rwLock != NULL) {
+    rwl_destroy(tree->rwLock);
+  }
+  tree->rwLock = (rwl_t*)
+    allocatorFree(ALLOCATOR_RED_BLACK_TREE, NULL, tree->rwLock);
+  tree->nodePool = nodePoolDestroy(tree->nodePool);
+  tree = (RedBlackTree*) allocatorFree(ALLOCATOR_RED_BLACK_TREE, NULL, tree);
   
   printLog(TRACE, "EXIT rbTreeDestroy(tree=%p) = {%p}\n", tree, (void*) NULL);
   return NULL;
@@ -707,9 +1287,7 @@ i32 rbTreeClear(RedBlackTree *tree) {
     return -1;
   }
   
-  if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
-    printLog(WARN, "Could not lock red black tree mutex.\n");
-  }
+  rbTreeLockExclusive(tree);
   
   treeDestroyHelper(tree, tree->root->left); tree->root->left = tree->nil;
   tree->head = NULL;
@@ -720,51 +1298,101 @@ i32 rbTreeClear(RedBlackTree *tree) {
   tree->head = NULL;
   tree->tail = NULL;
   
-  if (tree->lock != NULL) {
-    mtx_unlock(tree->lock);
-  }
+  rbTreeUnlockExclusive(tree);
   
   printLog(TRACE, "EXIT rbTreeClear(tree=%p) = {%p}\n", tree, (void*) NULL);
   return 0;
 }
 
-/// @fn RedBlackNode *rbQuery(const RedBlackTree *tree, const volatile void *q)
+/// @fn static u64 rbTreeStatsHelper(const RedBlackTree *tree, const RedBlackNode *x, RedBlackTreeStats *stats)
 ///
-/// @brief Find the RedBlackNode in the tree with a key equal to q.
+/// @brief Get the height of a subtree and add the sizes of its keys and
+/// values to the memory footprint in a RedBlackTreeStats.
 ///
-/// @details
-/// If there are multiple nodes with key equal to q, this function returns
-///   the one highest in the tree.
+/// @param tree The tree the subtree belongs to.
+/// @param x The root of the subtree.
+/// @param stats The RedBlackTreeStats being filled in.
 ///
-/// @param tree is a pointer to the RedBlackTree to search.
-/// @param q is the key value to search for
+/// @return Returns the number of nodes on the longest path from x down to a
+/// leaf, 0 if x is nil.
+static u64 rbTreeStatsHelper(const RedBlackTree *tree, const RedBlackNode *x,
+  RedBlackTreeStats *stats
+) {
+  if (x == tree->nil) {
+    return 0;
+  }
+  
+  stats->memoryBytes += tree->keyType->size(x->key);
+  if ((x->type != NULL) && (x->value != NULL)) {
+    stats->memoryBytes += x->type->size(x->value);
+  }
+  u64 leftHeight = rbTreeStatsHelper(tree, x->left, stats);
+  u64 rightHeight = rbTreeStatsHelper(tree, x->right, stats);
+  return ((leftHeight > rightHeight) ? leftHeight : rightHeight) + 1;
+}
+
+/// @fn int rbTreeStats(const RedBlackTree *tree, RedBlackTreeStats *stats)
 ///
-/// @return A RedBlackTree with key equal to q on success or NULL on failure.
-RedBlackNode *rbQuery(const RedBlackTree *tree, const volatile void *q) {
-  printLog(TRACE, "ENTER rbQuery(tree=%p, q=%p)\n", tree, q);
+/// @brief Get the shape and approximate memory footprint of a tree.
+///
+/// @param tree The tree of interest.
+/// @param stats The RedBlackTreeStats to fill in.
+///
+/// @return Returns 0 on success, -1 on failure.
+int rbTreeStats(const RedBlackTree *tree, RedBlackTreeStats *stats) {
+  if ((tree == NULL) || (stats == NULL)) {
+    printLog(ERR, "NULL parameter provided.\n");
+    return -1;
+  }
+  memset(stats, 0, sizeof(*stats));
   
-  if (tree == NULL) {
-    printLog(DEBUG, "Tree provided is NULL.\n");
-    
-    printLog(TRACE, "EXIT rbQuery(tree=%p, q=%p) = {%p}\n",
-      tree, q, (void*) NULL);
-    return NULL;
+  rbTreeLockShared(tree);
+  
+  stats->size = tree->size;
+  stats->height = rbTreeStatsHelper(tree, tree->root->left, stats);
+  while ((((u64) 1) << stats->minimumHeight) <= stats->size) {
+    stats->minimumHeight++;
+  }
+  for (const RedBlackNode *x = tree->root->left; x != tree->nil; x = x->left) {
+    if (x->red == false) {
+      stats->blackHeight++;
+    }
   }
   
-  if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
-    printLog(WARN, "Could not lock red black tree mutex.\n");
+  stats->memoryBytes += sizeof(RedBlackTree) + (2 * sizeof(RedBlackNode));
+  if (tree->lock != NULL) {
+    stats->memoryBytes += sizeof(mtx_t);
+  }
+  if (tree->rwLock != NULL) {
+    stats->memoryBytes += sizeof(rwl_t);
   }
+  if (tree->nodePool != NULL) {
+    stats->memoryBytes += nodePoolMemoryBytes(tree->nodePool);
+  } else {
+    stats->memoryBytes += tree->size * sizeof(RedBlackNode);
+  }
+  
+  rbTreeUnlockShared(tree);
   
+  return 0;
+}
+
+/// @fn static RedBlackNode *rbQueryUnlocked(const RedBlackTree *tree, const volatile void *q)
+///
+/// @brief Implementation of rbQuery.  The caller must hold the tree and must
+///   have validated the tree.
+///
+/// @param tree is a pointer to the RedBlackTree to search.
+/// @param q is the key value to search for
+///
+/// @return A RedBlackTree with key equal to q on success or NULL on failure.
+static RedBlackNode *rbQueryUnlocked(const RedBlackTree *tree,
+  const volatile void *q
+) {
   RedBlackNode *x = tree->root->left;
   RedBlackNode *nil = tree->nil;
   int compVal = 0;
   if (x == nil) {
-    if (tree->lock != NULL) {
-      mtx_unlock(tree->lock);
-    }
-    
-    printLog(TRACE, "EXIT rbQuery(tree=%p, q=%p) = {%p}\n",
-      tree, q, (void*) NULL);
     return NULL;
   }
   compVal = tree->keyType->compare(x->key, q);
@@ -775,21 +1403,42 @@ RedBlackNode *rbQuery(const RedBlackTree *tree, const volatile void *q) {
       x = x->right;
     }
     if ((x == nil) || (x == NULL)) {
-      if (tree->lock != NULL) {
-        mtx_unlock(tree->lock);
-      }
-      
-      printLog(TRACE, "EXIT rbQuery(tree=%p, q=%p) = {%p}\n",
-        tree, q, (void*) NULL);
       return NULL;
     }
     compVal = tree->keyType->compare(x->key, q);
   }
   
-  if (tree->lock != NULL) {
-    mtx_unlock(tree->lock);
+  return x;
+}
+
+/// @fn RedBlackNode *rbQuery(const RedBlackTree *tree, const volatile void *q)
+///
+/// @brief Find the RedBlackNode in the tree with a key equal to q.
+///
+/// @details
+/// If there are multiple nodes with key equal to q, this function returns
+///   the one highest in the tree.  If the tree was created with shared
+///   locking, any number of threads may be in this function at once.
+///
+/// @param tree is a pointer to the RedBlackTree to search.
+/// @param q is the key value to search for
+///
+/// @return A RedBlackTree with key equal to q on success or NULL on failure.
+RedBlackNode *rbQuery(const RedBlackTree *tree, const volatile void *q) {
+  printLog(TRACE, "ENTER rbQuery(tree=%p, q=%p)\n", tree, q);
+  
+  if (tree == NULL) {
+    printLog(DEBUG, "Tree provided is NULL.\n");
+    
+    printLog(TRACE, "EXIT rbQuery(tree=%p, q=%p) = {%p}\n",
+      tree, q, (void*) NULL);
+    return NULL;
   }
   
+  rbTreeLockShared(tree);
+  RedBlackNode *x = rbQueryUnlocked(tree, q);
+  rbTreeUnlockShared(tree);
+  
   printLog(TRACE, "EXIT rbQuery(tree=%p, q=%p) = {%p}\n", tree, q, x);
   return x;
 }
@@ -809,7 +1458,7 @@ void rbTreeDestroyNodeFixUp(RedBlackTree *tree, RedBlackNode *x) {
   
   RedBlackNode *root = tree->root->left;
   RedBlackNode *w = NULL;
-
+  
   while ((x->red == false) && (root != x)) {
     if (x == x->parent->left) {
       w = x->parent->right;
@@ -869,59 +1518,29 @@ void rbTreeDestroyNodeFixUp(RedBlackTree *tree, RedBlackNode *x) {
   printLog(TRACE, "EXIT rbTreeDestroyNodeFixUp(tree=%p, x=%p) = {}\n", tree, x);
 }
 
-
-/// @fn int rbTreeDestroyNode(RedBlackTree *tree, RedBlackNode *z)
-///
-/// @brief Deletes z from tree and frees the key and value of z
-///   using tree->keyType->destory and z->type->destroy.
-///
-/// @details  This function calls rbTreeDestroyNodeFixUp to restore red-black
-///   properties after the deletion of z.
-///
-/// @param tree is the tree to remove the node from.
-/// @param z is the node to remove.
-///
-/// @return Returns 0 on success, -1 on failure.
-///
-/// @note The algorithm for this function is from _Introduction_To_Algorithms_.
-int rbTreeDestroyNode(RedBlackTree *tree, RedBlackNode *z) {
-  printLog(TRACE, "ENTER rbTreeDestroyNode(tree=%p, z=%p) = {}\n", tree, z);
-  
-  int returnValue = 0;
-  
-  // Parameter check.
-  if (tree == NULL) {
-    printLog(ERR, "tree is NULL.\n");
-    returnValue = -1;
-    printLog(TRACE, "EXIT rbTreeDestroyNode(tree=%p, z=%p) = {%d}\n",
-      tree, z, returnValue);
-    return returnValue;
-  }
-  if (z == NULL) {
-    printLog(ERR, "z is NULL.\n");
-    returnValue = -1;
-    printLog(TRACE, "EXIT rbTreeDestroyNode(tree=%p, z=%p) = {%d}\n",
-      tree, z, returnValue);
-    return returnValue;
-  }
-  
-  if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
-    printLog(WARN, "Could not lock red black tree mutex.\n");
-  }
+
+/// @fn static RedBlackNode *rbTreeRemoveNodeUnlocked(RedBlackTree *tree, RedBlackNode *z)
+///
+/// @brief Implementation of rbTreeRemoveNode.  The caller must hold the tree
+///   exclusive and must have validated the parameters.
+///
+/// @param tree is the tree to remove the node from.
+/// @param z is the node to remove.
+///
+/// @return Returns z.
+///
+/// @note The algorithm for this function is from _Introduction_To_Algorithms_.
+static RedBlackNode *rbTreeRemoveNodeUnlocked(RedBlackTree *tree,
+  RedBlackNode *z
+) {
+  printLog(TRACE, "ENTER rbTreeRemoveNodeUnlocked(tree=%p, z=%p)\n", tree, z);
   
   RedBlackNode *x = NULL;
   RedBlackNode *y = NULL;
   RedBlackNode *nil = tree->nil;
   RedBlackNode *root = tree->root;
   
-  if (z->prev != NULL) {
-    z->prev->next = z->next;
-  }
-  if (z->next != NULL) {
-    z->next->prev = z->prev;
-  }
-  
-  y = ((z->left == nil) || (z->right == nil)) ? z : rbTreeSuccessor(tree, z);
+  y = ((z->left == nil) || (z->right == nil)) ? z : rbTreeSuccessorUnlocked(tree, z);
   x = (y->left == nil) ? y->right : y->left;
   if (root == (x->parent = y->parent)) {
     // assignment of y->parent to x->parent above is intentional
@@ -936,7 +1555,7 @@ int rbTreeDestroyNode(RedBlackTree *tree, RedBlackNode *z) {
   if (y != z) { // y should not be nil in this case
     // We're removing z in this case.
 #ifdef DEBUG_ASSERT
-    rbAssert((y != tree->nil), "y is nil in rbTreeDestroyNode\n");
+    rbAssert((y != tree->nil), "y is nil in rbTreeRemoveNode\n");
 #endif
     
     // y is the node to splice out and x is its child
@@ -944,22 +1563,6 @@ int rbTreeDestroyNode(RedBlackTree *tree, RedBlackNode *z) {
       rbTreeDestroyNodeFixUp(tree, x);
     }
     
-    // Fix the linked-list portions.
-    if (tree->head == z) {
-      tree->head = z->next;
-    }
-    if (tree->tail == z) {
-      tree->tail = z->prev;
-    }
-    if (z->prev != NULL) {
-      z->prev->next = z->next;
-    }
-    if (z->next != NULL) {
-      z->next->prev = z->prev;
-    }
-    
-    tree->keyType->destroy(z->key); z->key = NULL;
-    z->type->destroy(z->value); z->value = NULL;
     y->left = z->left;
     y->right = z->right;
     y->parent = z->parent;
@@ -970,39 +1573,131 @@ int rbTreeDestroyNode(RedBlackTree *tree, RedBlackNode *z) {
     } else {
       z->parent->right = y;
     }
-    z = (RedBlackNode*) pointerDestroy(z);
   } else {
     // We're removing y in this case.
-    // Fix the linked-list portions.
-    if (tree->head == y) {
-      tree->head = y->next;
+    if (y->red == false) {
+      rbTreeDestroyNodeFixUp(tree, x);
     }
-    if (tree->tail == y) {
-      tree->tail = y->prev;
+  }
+  z->left = z->right = z->parent = NULL;
+  tree->size--;
+  
+#ifdef DEBUG_ASSERT
+  rbAssert((tree->nil->red == false) ,"nil not black in rbTreeRemoveNodeUnlocked");
+#endif
+  printLog(TRACE, "EXIT rbTreeRemoveNodeUnlocked(tree=%p, z=%p) = {%p}\n",
+    tree, z, z);
+  return z;
+}
+
+/// @fn RedBlackNode *rbTreeRemoveNode(RedBlackTree *tree, RedBlackNode *z)
+///
+/// @brief Removes z from the structure of a tree without destroying its key
+///   or value and without freeing it.
+///
+/// @details  This function calls rbTreeDestroyNodeFixUp to restore red-black
+///   properties after the removal of z.  As with rbTreeInsertNode, the prev and
+///   next members of the node are not modified.  The size of the tree is
+///   decremented.
+///
+/// @param tree is the tree to remove the node from.
+/// @param z is the node to remove.
+///
+/// @return Returns z on success, NULL on failure.
+///
+/// @note The algorithm for this function is from _Introduction_To_Algorithms_.
+RedBlackNode *rbTreeRemoveNode(RedBlackTree *tree, RedBlackNode *z) {
+  printLog(TRACE, "ENTER rbTreeRemoveNode(tree=%p, z=%p)\n", tree, z);
+  
+  // Parameter check.
+  if ((tree == NULL) || (z == NULL)) {
+    printLog(ERR, "One or more NULL parameters.\n");
+    printLog(TRACE, "EXIT rbTreeRemoveNode(tree=%p, z=%p) = {%p}\n",
+      tree, z, (void*) NULL);
+    return NULL;
+  }
+  
+  rbTreeLockExclusive(tree);
+  rbTreeRemoveNodeUnlocked(tree, z);
+  rbTreeUnlockExclusive(tree);
+  
+  printLog(TRACE, "EXIT rbTreeRemoveNode(tree=%p, z=%p) = {%p}\n",
+    tree, z, z);
+  return z;
+}
+
+/// @fn static void rbTreeDestroyNodeUnlocked(RedBlackTree *tree, RedBlackNode *z)
+///
+/// @brief Implementation of rbTreeDestroyNode.  The caller must hold the tree
+///   exclusive and must have validated the parameters.
+///
+/// @param tree is the tree to remove the node from.
+/// @param z is the node to remove.
+///
+/// @return This function returns no value.
+static void rbTreeDestroyNodeUnlocked(RedBlackTree *tree, RedBlackNode *z) {
+  // Fix the linked-list portions.
+  if (tree->unlinked == true) {
+    tree->head = NULL;
+    tree->tail = NULL;
+  } else {
+    if (tree->head == z) {
+      tree->head = z->next;
     }
-    if (y->prev != NULL) {
-      y->prev->next = y->next;
+    if (tree->tail == z) {
+      tree->tail = z->prev;
     }
-    if (y->next != NULL) {
-      y->next->prev = y->prev;
+    if (z->prev != NULL) {
+      z->prev->next = z->next;
     }
-    
-    tree->keyType->destroy(y->key); y->key = NULL;
-    y->type->destroy(y->value); y->value = NULL;
-    if (y->red == false) {
-      rbTreeDestroyNodeFixUp(tree, x);
+    if (z->next != NULL) {
+      z->next->prev = z->prev;
     }
-    y = (RedBlackNode*) pointerDestroy(y);
   }
-  tree->size--;
   
-  if (tree->lock != NULL) {
-    mtx_unlock(tree->lock);
+  rbTreeRemoveNodeUnlocked(tree, z);
+  tree->keyType->destroy(z->key); z->key = NULL;
+  z->type->destroy(z->value); z->value = NULL;
+  z = rbTreeFreeNode(tree, z);
+}
+
+/// @fn int rbTreeDestroyNode(RedBlackTree *tree, RedBlackNode *z)
+///
+/// @brief Deletes z from tree and frees the key and value of z
+///   using tree->keyType->destory and z->type->destroy.
+///
+/// @details  This function calls rbTreeRemoveNode to take z out of the tree
+///   and then fixes the linked-list portions of the tree around it.
+///
+/// @param tree is the tree to remove the node from.
+/// @param z is the node to remove.
+///
+/// @return Returns 0 on success, -1 on failure.
+int rbTreeDestroyNode(RedBlackTree *tree, RedBlackNode *z) {
+  printLog(TRACE, "ENTER rbTreeDestroyNode(tree=%p, z=%p) = {}\n", tree, z);
+  
+  int returnValue = 0;
+  
+  // Parameter check.
+  if (tree == NULL) {
+    printLog(ERR, "tree is NULL.\n");
+    returnValue = -1;
+    printLog(TRACE, "EXIT rbTreeDestroyNode(tree=%p, z=%p) = {%d}\n",
+      tree, z, returnValue);
+    return returnValue;
+  }
+  if (z == NULL) {
+    printLog(ERR, "z is NULL.\n");
+    returnValue = -1;
+    printLog(TRACE, "EXIT rbTreeDestroyNode(tree=%p, z=%p) = {%d}\n",
+      tree, z, returnValue);
+    return returnValue;
   }
   
-#ifdef DEBUG_ASSERT
-  rbAssert((tree->nil->red == false) ,"nil not black in rbTreeDestroyNode");
-#endif
+  rbTreeLockExclusive(tree);
+  rbTreeDestroyNodeUnlocked(tree, z);
+  rbTreeUnlockExclusive(tree);
+  
   printLog(TRACE, "EXIT rbTreeDestroyNode(tree=%p, z=%p) = {%d}\n",
     tree, z, returnValue);
   return returnValue;
@@ -1028,102 +1723,410 @@ int rbTreeRemove(RedBlackTree *tree, const volatile void *key) {
     return -1;
   }
   
-  if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
-    printLog(WARN, "Could not lock red black tree mutex.\n");
-  }
+  rbTreeLockExclusive(tree);
   
-  RedBlackNode *node = rbQuery(tree, key);
+  RedBlackNode *node = rbQueryUnlocked(tree, key);
   if (node != NULL) {
-    rbTreeDestroyNode(tree, node);
-    if (tree->lock != NULL) {
-      mtx_unlock(tree->lock);
-    }
+    rbTreeDestroyNodeUnlocked(tree, node);
+    rbTreeUnlockExclusive(tree);
     
     printLog(TRACE, "EXIT rbTreeRemove(tree=%p, key=%p) = {0}\n", tree, key);
     return 0;
   } else {
-    if (tree->lock != NULL) {
-      mtx_unlock(tree->lock);
+    rbTreeUnlockExclusive(tree);
+    
+    printLog(TRACE, "EXIT rbTreeRemove(tree=%p, key=%p) = {-1}\n", tree, key);
+    return -1;
+  }
+}
+
+/// @fn List *rbEnumerate(const RedBlackTree *tree, const volatile void *low, const volatile void *high)
+///
+/// @brief Create a list containing node contents between low and high,
+///   inclusive.
+///
+/// @param tree is a pointer to the RedBlackTree to search.
+/// @param low is the minimum value to return.
+/// @param high is the maximum value to return.
+///
+/// @return Returns a list containing tree contents between low and high,
+///   inclusive.
+List *rbEnumerate(const RedBlackTree *tree,
+  const volatile void *low, const volatile void *high
+) {
+  printLog(TRACE, "ENTER rbEnumerate(tree=%p, low=%p, high=%p)\n",
+    tree, low, high);
+  
+  // Parameter check.
+  if (tree == NULL) {
+    printLog(ERR, "tree is NULL.\n");
+    printLog(TRACE, "EXIT rbEnumerate(tree=%p, low=%p, high=%p) = {%p}\n",
+      tree, low, high, (void*) NULL);
+    return NULL;
+  }
+  if (low == NULL) {
+    printLog(ERR, "low is NULL.\n");
+    printLog(TRACE, "EXIT rbEnumerate(tree=%p, low=%p, high=%p) = {%p}\n",
+      tree, low, high, (void*) NULL);
+    return NULL;
+  }
+  if (high == NULL) {
+    printLog(ERR, "high is NULL.\n");
+    printLog(TRACE, "EXIT rbEnumerate(tree=%p, low=%p, high=%p) = {%p}\n",
+      tree, low, high, (void*) NULL);
+    return NULL;
+  }
+  
+  rbTreeLockShared(tree);
+  
+  List *enumResultStack = NULL;
+  RedBlackNode *nil = tree->nil;
+  RedBlackNode *x = tree->root->left;
+  RedBlackNode *lastBest = nil;
+  
+  enumResultStack = listCreate(tree->keyType);
+  
+  while (x != nil) {
+    if (tree->keyType->compare(x->key, high) > 0) { // x->key > high
+      x = x->left;
+    } else { // x->key <= high
+      lastBest = x;
+      x = x->right;
+    }
+  }
+  while ((lastBest != NULL) && (tree->keyType->compare(low, lastBest->key) <= 0)) {
+    listAddFrontEntry(enumResultStack, lastBest->key, lastBest->value, lastBest->type);
+    /* Suboptimal now.
+     * JBC 2019-09-29
+     * lastBest = rbTreePredecessor(tree, lastBest);
+     */
+    lastBest = rbTreePrevUnlocked(tree, lastBest);
+  }
+  
+  rbTreeUnlockShared(tree);
+    
+  // Top of stack now contains first tree entry >= low.  Bottom of stack now
+  // contains last tree entry <= high.
+  printLog(TRACE, "EXIT rbEnumerate(tree=%p, low=%p, high=%p) = {%p}\n", tree, low, high, enumResultStack);
+  return enumResultStack;
+}
+
+/// @fn static RedBlackNode *rbTreeLowerBoundUnlocked(const RedBlackTree *tree, const volatile void *key)
+///
+/// @brief Implementation of rbTreeLowerBound.  The caller must hold the tree
+///   and must have validated the parameters.
+///
+/// @param tree is a pointer to the RedBlackTree to search.
+/// @param key is the key to search for.
+///
+/// @return Returns the first node with a key greater than or equal to key or
+///   NULL if there is no such node.
+static RedBlackNode *rbTreeLowerBoundUnlocked(const RedBlackTree *tree,
+  const volatile void *key
+) {
+  RedBlackNode *nil = tree->nil;
+  RedBlackNode *x = tree->root->left;
+  RedBlackNode *best = NULL;
+  
+  while (x != nil) {
+    if (tree->keyType->compare(x->key, key) >= 0) { // x->key >= key
+      best = x;
+      x = x->left;
+    } else { // x->key < key
+      x = x->right;
+    }
+  }
+  
+  return best;
+}
+
+/// @fn static RedBlackNode *rbTreeUpperBoundUnlocked(const RedBlackTree *tree, const volatile void *key)
+///
+/// @brief Implementation of rbTreeUpperBound.  The caller must hold the tree
+///   and must have validated the parameters.
+///
+/// @param tree is a pointer to the RedBlackTree to search.
+/// @param key is the key to search for.
+///
+/// @return Returns the first node with a key greater than key or NULL if
+///   there is no such node.
+static RedBlackNode *rbTreeUpperBoundUnlocked(const RedBlackTree *tree,
+  const volatile void *key
+) {
+  RedBlackNode *nil = tree->nil;
+  RedBlackNode *x = tree->root->left;
+  RedBlackNode *best = NULL;
+  
+  while (x != nil) {
+    if (tree->keyType->compare(x->key, key) > 0) { // x->key > key
+      best = x;
+      x = x->left;
+    } else { // x->key <= key
+      x = x->right;
+    }
+  }
+  
+  return best;
+}
+
+/// @fn RedBlackNode *rbTreeLowerBound(const RedBlackTree *tree, const volatile void *key)
+///
+/// @brief Find the first node in a tree whose key is not less than a given
+///   key.
+///
+/// @param tree is a pointer to the RedBlackTree to search.
+/// @param key is the key to search for.
+///
+/// @return Returns the first node with a key greater than or equal to key or
+///   NULL if there is no such node.
+RedBlackNode *rbTreeLowerBound(const RedBlackTree *tree,
+  const volatile void *key
+) {
+  printLog(TRACE, "ENTER rbTreeLowerBound(tree=%p, key=%p)\n", tree, key);
+  
+  if ((tree == NULL) || (key == NULL)) {
+    printLog(ERR, "One or more NULL parameters.\n");
+    printLog(TRACE, "EXIT rbTreeLowerBound(tree=%p, key=%p) = {%p}\n",
+      tree, key, (void*) NULL);
+    return NULL;
+  }
+  
+  rbTreeLockShared(tree);
+  RedBlackNode *x = rbTreeLowerBoundUnlocked(tree, key);
+  rbTreeUnlockShared(tree);
+  
+  printLog(TRACE, "EXIT rbTreeLowerBound(tree=%p, key=%p) = {%p}\n",
+    tree, key, x);
+  return x;
+}
+
+/// @fn RedBlackNode *rbTreeUpperBound(const RedBlackTree *tree, const volatile void *key)
+///
+/// @brief Find the first node in a tree whose key is greater than a given
+///   key.
+///
+/// @param tree is a pointer to the RedBlackTree to search.
+/// @param key is the key to search for.
+///
+/// @return Returns the first node with a key greater than key or NULL if
+///   there is no such node.
+RedBlackNode *rbTreeUpperBound(const RedBlackTree *tree,
+  const volatile void *key
+) {
+  printLog(TRACE, "ENTER rbTreeUpperBound(tree=%p, key=%p)\n", tree, key);
+  
+  if ((tree == NULL) || (key == NULL)) {
+    printLog(ERR, "One or more NULL parameters.\n");
+    printLog(TRACE, "EXIT rbTreeUpperBound(tree=%p, key=%p) = {%p}\n",
+      tree, key, (void*) NULL);
+    return NULL;
+  }
+  
+  rbTreeLockShared(tree);
+  RedBlackNode *x = rbTreeUpperBoundUnlocked(tree, key);
+  rbTreeUnlockShared(tree);
+  
+  printLog(TRACE, "EXIT rbTreeUpperBound(tree=%p, key=%p) = {%p}\n",
+    tree, key, x);
+  return x;
+}
+
+/// @fn u64 rbTreeRange(const RedBlackTree *tree, const volatile void *low, const volatile void *high, RedBlackTreeRangeFunction function, void *context)
+///
+/// @brief Call a function on every node of a tree with a key between low and
+///   high, inclusive, in key order.
+///
+/// @details The tree is held for the whole walk instead of once per node, so
+///   the function must not call back into the tree.
+///
+/// @param tree is a pointer to the RedBlackTree to walk.
+/// @param low is the smallest key to visit.  NULL starts at the first node.
+/// @param high is the largest key to visit.  NULL ends at the last node.
+/// @param function is the function to call on each node.  Returning false
+///   from it ends the walk early.
+/// @param context is passed through to function unmodified.
+///
+/// @return Returns the number of nodes function was called on.
+u64 rbTreeRange(const RedBlackTree *tree, const volatile void *low,
+  const volatile void *high, RedBlackTreeRangeFunction function, void *context
+) {
+  printLog(TRACE,
+    "ENTER rbTreeRange(tree=%p, low=%p, high=%p, function=%p, context=%p)\n",
+    tree, low, high, function, context);
+  
+  u64 numNodes = 0;
+  if ((tree == NULL) || (function == NULL)) {
+    printLog(ERR, "One or more NULL parameters.\n");
+    printLog(TRACE,
+      "EXIT rbTreeRange(tree=%p, low=%p, high=%p, function=%p, context=%p) = {%llu}\n",
+      tree, low, high, function, context, llu(numNodes));
+    return numNodes; // 0
+  }
+  
+  rbTreeLockShared(tree);
+  
+  RedBlackNode *node = rbTreeFirstUnlocked(tree);
+  if (low != NULL) {
+    node = rbTreeLowerBoundUnlocked(tree, low);
+  }
+  while ((node != NULL)
+    && ((high == NULL) || (tree->keyType->compare(node->key, high) <= 0))
+  ) {
+    numNodes++;
+    if (function(node, context) == false) {
+      break;
     }
-    
-    printLog(TRACE, "EXIT rbTreeRemove(tree=%p, key=%p) = {-1}\n", tree, key);
-    return -1;
+    node = rbTreeNextUnlocked(tree, node);
   }
+  
+  rbTreeUnlockShared(tree);
+  
+  printLog(TRACE,
+    "EXIT rbTreeRange(tree=%p, low=%p, high=%p, function=%p, context=%p) = {%llu}\n",
+    tree, low, high, function, context, llu(numNodes));
+  return numNodes;
 }
 
-/// @fn List *rbEnumerate(const RedBlackTree *tree, const volatile void *low, const volatile void *high)
+/// @fn void rbTreeCursorInit(RedBlackTreeCursor *cursor, const RedBlackTree *tree, const volatile void *low, const volatile void *high)
 ///
-/// @brief Create a list containing node contents between low and high,
-///   inclusive.
+/// @brief Set up a cursor to walk the nodes of a tree with keys between low
+///   and high, inclusive, in batches.
 ///
-/// @param tree is a pointer to the RedBlackTree to search.
-/// @param low is the minimum value to return.
-/// @param high is the maximum value to return.
+/// @param cursor is a pointer to the RedBlackTreeCursor to initialize.
+/// @param tree is a pointer to the RedBlackTree to walk.
+/// @param low is the smallest key to visit.  NULL starts at the first node.
+///   The memory is not copied and must remain valid while the cursor is used.
+/// @param high is the largest key to visit.  NULL ends at the last node.  The
+///   memory is not copied and must remain valid while the cursor is used.
 ///
-/// @return Returns a list containing tree contents between low and high,
-///   inclusive.
-List *rbEnumerate(const RedBlackTree *tree,
+/// @return This function returns no value.
+void rbTreeCursorInit(RedBlackTreeCursor *cursor, const RedBlackTree *tree,
   const volatile void *low, const volatile void *high
 ) {
-  printLog(TRACE, "ENTER rbEnumerate(tree=%p, low=%p, high=%p)\n",
-    tree, low, high);
+  printLog(TRACE, "ENTER rbTreeCursorInit(cursor=%p, tree=%p, low=%p, high=%p)\n",
+    cursor, tree, low, high);
   
-  // Parameter check.
-  if (tree == NULL) {
-    printLog(ERR, "tree is NULL.\n");
-    printLog(TRACE, "EXIT rbEnumerate(tree=%p, low=%p, high=%p) = {%p}\n",
-      tree, low, high, (void*) NULL);
-    return NULL;
+  if (cursor != NULL) {
+    cursor->tree = tree;
+    cursor->low = low;
+    cursor->high = high;
+    cursor->lastKey = NULL;
+    cursor->numLastKey = 0;
+    cursor->done = (tree == NULL);
   }
-  if (low == NULL) {
-    printLog(ERR, "low is NULL.\n");
-    printLog(TRACE, "EXIT rbEnumerate(tree=%p, low=%p, high=%p) = {%p}\n",
-      tree, low, high, (void*) NULL);
-    return NULL;
-  }
-  if (high == NULL) {
-    printLog(ERR, "high is NULL.\n");
-    printLog(TRACE, "EXIT rbEnumerate(tree=%p, low=%p, high=%p) = {%p}\n",
-      tree, low, high, (void*) NULL);
-    return NULL;
+  
+  printLog(TRACE, "EXIT rbTreeCursorInit(cursor=%p, tree=%p, low=%p, high=%p)\n",
+    cursor, tree, low, high);
+}
+
+/// @fn u64 rbTreeCursorNext(RedBlackTreeCursor *cursor, RedBlackNode **nodes, u64 maxNodes)
+///
+/// @brief Get the next batch of nodes from a cursor.
+///
+/// @details The tree is held once for the whole batch.  Between batches the
+///   cursor only remembers a copy of the last key it returned and seeks back
+///   to it, so the tree may be modified between calls.  As with rbQuery, the
+///   node pointers returned are only good until the nodes are removed from
+///   the tree.
+///
+/// @param cursor is a pointer to a RedBlackTreeCursor set up by
+///   rbTreeCursorInit.
+/// @param nodes is the array to fill with the nodes of the batch, in key
+///   order.
+/// @param maxNodes is the number of elements in nodes.
+///
+/// @return Returns the number of nodes placed in nodes.  0 means that the
+///   walk is complete.
+u64 rbTreeCursorNext(RedBlackTreeCursor *cursor, RedBlackNode **nodes,
+  u64 maxNodes
+) {
+  printLog(TRACE, "ENTER rbTreeCursorNext(cursor=%p, nodes=%p, maxNodes=%llu)\n",
+    cursor, nodes, llu(maxNodes));
+  
+  u64 numNodes = 0;
+  if ((cursor == NULL) || (nodes == NULL) || (cursor->done == true)) {
+    printLog(TRACE,
+      "EXIT rbTreeCursorNext(cursor=%p, nodes=%p, maxNodes=%llu) = {%llu}\n",
+      cursor, nodes, llu(maxNodes), llu(numNodes));
+    return numNodes; // 0
   }
   
-  if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
-    printLog(WARN, "Could not lock red black tree mutex.\n");
+  const RedBlackTree *tree = cursor->tree;
+  TypeDescriptor *keyType = tree->keyType;
+  rbTreeLockShared(tree);
+  
+  RedBlackNode *node = NULL;
+  if (cursor->lastKey != NULL) {
+    // Skip the nodes with the last key that were returned in earlier batches.
+    node = rbTreeLowerBoundUnlocked(tree, cursor->lastKey);
+    for (u64 ii = 0; (ii < cursor->numLastKey) && (node != NULL)
+      && (keyType->compare(node->key, cursor->lastKey) == 0); ii++
+    ) {
+      node = rbTreeNextUnlocked(tree, node);
+    }
+  } else if (cursor->low != NULL) {
+    node = rbTreeLowerBoundUnlocked(tree, cursor->low);
+  } else {
+    node = rbTreeFirstUnlocked(tree);
   }
   
-  List *enumResultStack = NULL;
-  RedBlackNode *nil = tree->nil;
-  RedBlackNode *x = tree->root->left;
-  RedBlackNode *lastBest = nil;
-
-  enumResultStack = listCreate(tree->keyType);
+  while ((numNodes < maxNodes) && (node != NULL)
+    && ((cursor->high == NULL)
+      || (keyType->compare(node->key, cursor->high) <= 0))
+  ) {
+    nodes[numNodes] = node;
+    numNodes++;
+    node = rbTreeNextUnlocked(tree, node);
+  }
   
-  while (x != nil) {
-    if (tree->keyType->compare(x->key, high) > 0) { // x->key > high
-      x = x->left;
-    } else { // x->key <= high
-      lastBest = x;
-      x = x->right;
+  if (numNodes > 0) {
+    RedBlackNode *last = nodes[numNodes - 1];
+    if ((cursor->lastKey != NULL)
+      && (keyType->compare(last->key, cursor->lastKey) == 0)
+    ) {
+      cursor->numLastKey += numNodes;
+    } else {
+      keyType->destroy(cursor->lastKey);
+      cursor->lastKey = keyType->copy(last->key);
+      cursor->numLastKey = 0;
+      for (u64 ii = numNodes; (ii > 0)
+        && (keyType->compare(nodes[ii - 1]->key, last->key) == 0); ii--
+      ) {
+        cursor->numLastKey++;
+      }
     }
   }
-  while ((lastBest != NULL) && (tree->keyType->compare(low, lastBest->key) <= 0)) {
-    listAddFrontEntry(enumResultStack, lastBest->key, lastBest->value, lastBest->type);
-    /* Suboptimal now.
-     * JBC 2019-09-29
-     * lastBest = rbTreePredecessor(tree, lastBest);
-     */
-    lastBest = lastBest->prev;
+  if (numNodes < maxNodes) {
+    cursor->done = true;
   }
   
-  if (tree->lock != NULL) {
-    mtx_unlock(tree->lock);
+  rbTreeUnlockShared(tree);
+  
+  printLog(TRACE,
+    "EXIT rbTreeCursorNext(cursor=%p, nodes=%p, maxNodes=%llu) = {%llu}\n",
+    cursor, nodes, llu(maxNodes), llu(numNodes));
+  return numNodes;
+}
+
+/// @fn void rbTreeCursorDestroy(RedBlackTreeCursor *cursor)
+///
+/// @brief Release the memory held by a cursor.  The cursor itself is not
+///   freed.
+///
+/// @param cursor is a pointer to the RedBlackTreeCursor to clean up.
+///
+/// @return This function returns no value.
+void rbTreeCursorDestroy(RedBlackTreeCursor *cursor) {
+  printLog(TRACE, "ENTER rbTreeCursorDestroy(cursor=%p)\n", cursor);
+  
+  if ((cursor != NULL) && (cursor->tree != NULL)) {
+    cursor->tree->keyType->destroy(cursor->lastKey);
+    cursor->lastKey = NULL;
+    cursor->numLastKey = 0;
+    cursor->done = true;
   }
-    
-  // Top of stack now contains first tree entry >= low.  Bottom of stack now
-  // contains last tree entry <= high.
-  printLog(TRACE, "EXIT rbEnumerate(tree=%p, low=%p, high=%p) = {%p}\n", tree, low, high, enumResultStack);
-  return enumResultStack;
+  
+  printLog(TRACE, "EXIT rbTreeCursorDestroy(cursor=%p)\n", cursor);
 }
 
 /// @fn void rbAssert(bool assertion, const char *error)
@@ -1150,15 +2153,17 @@ void rbAssert(bool assertion, const char *error) {
 /// @fn void *rbSafeMalloc(size_t size)
 ///
 /// @brief Allocate memory or exit the program if the memory cannot be
-///   allocated.
+///   allocated.  The memory comes from the allocator and is counted against
+///   ALLOCATOR_RED_BLACK_TREE, so it must be released with allocatorFree.
 ///
 /// @param size is the size to malloc.
 ///
 /// @return Returns pointer to allocated memory if succesful.
 void *rbSafeMalloc(size_t size) {
   void *result;
-
-  if ((result = malloc(size))) { // assignment intentional
+  
+  // assignment intentional
+  if ((result = allocatorMalloc(ALLOCATOR_RED_BLACK_TREE, NULL, size))) {
     return result;
   } else {
     printLog(CRITICAL, "memory overflow: malloc failed in rbSafeMalloc.");
@@ -1179,7 +2184,8 @@ void *rbSafeMalloc(size_t size) {
 int rbTreeCompare(const RedBlackTree *treeA, const RedBlackTree *treeB) {
   printLog(TRACE, "ENTER rbTreeCompare(treeA=%p, treeB=%p)\n", treeA, treeB);
   
-  int returnValue = listCompare((List*) treeA, (List*) treeB);
+  int returnValue
+    = listCompare((List*) rbTreeLinkNodes(treeA), (List*) rbTreeLinkNodes(treeB));
   
   printLog(TRACE, "EXIT rbTreeCompare(treeA=%p, treeB=%p) = {%d}\n", treeA, treeB, returnValue);
   return returnValue;
@@ -1205,29 +2211,29 @@ RedBlackTree *rbTreeCopy(const RedBlackTree *tree) {
     printLog(TRACE, "EXIT rbTreeCopy(tree=%p) = {%p}\n", tree, treeCopy);
     return treeCopy; // NULL
   }
-  treeCopy = rbTreeCreate(tree->keyType);
+  treeCopy = rbTreeCreate(tree->keyType, false, (tree->rwLock != NULL),
+    (tree->nodePool != NULL), tree->unlinked);
   
-  if ((tree->lock != NULL) && (mtx_lock(tree->lock) != thrd_success)) {
-    printLog(WARN, "Could not lock red black tree mutex.\n");
-  }
+  rbTreeLockShared(tree);
   
-  if (tree->tail == NULL) {
+  if (tree->size == 0) {
     // Empty tree.  We're done with the copy.
-    if (tree->lock != NULL) {
-      mtx_unlock(tree->lock);
-    }
+    rbTreeUnlockShared(tree);
       
     printLog(TRACE, "EXIT rbTreeCopy(tree=%p) = {%p}\n", tree, treeCopy);
     return treeCopy; // Empty tree
   }
   
-  for (node = tree->head; node != tree->tail->next; node = node->next) {
-    rbInsert(treeCopy, node->key, node->value, node->type);
+  // The source is already in key order, so the copy can be built in one
+  // pass.
+  for (node = rbTreeFirstUnlocked(tree); node != NULL;
+    node = rbTreeNextUnlocked(tree, node)
+  ) {
+    rbTreeAppendSorted(treeCopy, node->key, node->value, node->type);
   }
+  rbTreeBuildLinked(treeCopy);
   
-  if (tree->lock != NULL) {
-    mtx_unlock(tree->lock);
-  }
+  rbTreeUnlockShared(tree);
   
   printLog(TRACE, "EXIT rbTreeCopy(tree=%p) = {%p}\n", tree, treeCopy);
   return treeCopy;
@@ -1308,7 +2314,7 @@ RedBlackTree *rbTreeFromBlob_(const volatile void *array, u64 *length, bool inPl
   
   u32 dsVersion = *((u32*) &byteArray[index]);
   littleEndianToHost(&dsVersion, sizeof(dsVersion));
-  if (dsVersion != 10) {
+  if ((dsVersion < 10) || (dsVersion > DsVersion)) {
     printLog(ERR, "Don't know how to parse version %u of input byte array.\n",
       dsVersion);
     printLog(ERR, "If this input came from this library, please "
@@ -1335,6 +2341,26 @@ RedBlackTree *rbTreeFromBlob_(const volatile void *array, u64 *length, bool inPl
   size = *((u64*) &byteArray[index]);
   littleEndianToHost(&size, sizeof(size));
   index += sizeof(size);
+  u64 indexOffset = 0;
+  if (dsVersion > 10) {
+    // Version 11 follows the size with the offset and order of the entry
+    // index.  The entries themselves are encoded the same way as in version
+    // 10, so they are parsed the same way and the index is just skipped.
+    if (arrayLength >= index + sizeof(indexOffset) + sizeof(u8)) {
+      indexOffset = *((u64*) &byteArray[index]);
+      littleEndianToHost(&indexOffset, sizeof(indexOffset));
+      index += sizeof(indexOffset) + sizeof(u8);
+    }
+    if ((indexOffset < index) || (indexOffset > arrayLength)
+      || (size > (arrayLength - indexOffset) / DS_INDEX_ENTRY_SIZE)
+    ) {
+      printLog(ERR, "Improperly formatted byte array.  Invalid index.\n");
+      printLog(ERR, "If this input came from this library, please "
+        "report this as a bug.\n");
+      return NULL;
+    }
+    arrayLength = indexOffset;
+  }
   rbTree = rbTreeCreate(keyTypeNoCopy, disableThreadSafety);
   if (rbTree == NULL) {
     LOG_MALLOC_FAILURE();
@@ -1375,6 +2401,7 @@ RedBlackTree *rbTreeFromBlob_(const volatile void *array, u64 *length, bool inPl
       } else {
         rbTree->keyType = keyType;
       }
+      rbTreeBuildLinked(rbTree);
       return rbTree;
     }
     valueType = getTypeDescriptorFromIndex(typeIndex);
@@ -1399,6 +2426,7 @@ RedBlackTree *rbTreeFromBlob_(const volatile void *array, u64 *length, bool inPl
       } else {
         rbTree->keyType = keyType;
       }
+      rbTreeBuildLinked(rbTree);
       return rbTree;
     }
     
@@ -1420,10 +2448,12 @@ RedBlackTree *rbTreeFromBlob_(const volatile void *array, u64 *length, bool inPl
       } else {
         rbTree->keyType = keyType;
       }
+      rbTreeBuildLinked(rbTree);
       return rbTree;
     }
     
-    node = rbTreeAddEntry(rbTree, key, value, valueTypeNoCopy);
+    // Blobs are written in key order, so the tree can be built in one pass.
+    node = rbTreeAppendSorted(rbTree, key, value, valueTypeNoCopy);
     if (node != NULL) {
       if (inPlaceData) {
         // Optimize for this case.
@@ -1442,6 +2472,7 @@ RedBlackTree *rbTreeFromBlob_(const volatile void *array, u64 *length, bool inPl
       printLog(ERR, "Failed to add node to rbTree.\n");
     }
   }
+  rbTreeBuildLinked(rbTree);
   if (rbTree->size < size) {
     printLog(ERR, "Expected %llu entries, but only found %llu.\n",
       llu(size), llu(rbTree->size));
@@ -1453,6 +2484,10 @@ RedBlackTree *rbTreeFromBlob_(const volatile void *array, u64 *length, bool inPl
   }
   
   *length = index;
+  if (indexOffset > 0) {
+    // Consume the index too so that the caller's next read starts after it.
+    *length = indexOffset + (size * DS_INDEX_ENTRY_SIZE);
+  }
   if (inPlaceData) {
     // Optimize for this case.
     if (keyTypeIndex >= rbTreeIndex) {
@@ -1494,14 +2529,16 @@ RedBlackTree* listToRbTree(const List *list) {
   
   i64 listIndex = getIndexFromTypeDescriptor(typeList);
   for (ListNode *node = list->head; node != NULL; node = node->next) {
+    // Lists that are already sorted by key are built in one pass.
     if (getIndexFromTypeDescriptor(node->type) < listIndex) {
       // The usual case, so put it first.
-      rbInsert(tree, node->key, node->value, node->type);
+      rbTreeAppendSorted(tree, node->key, node->value, node->type);
     } else {
-      rbInsert(tree, node->key, listToRbTree((List*) node->value),
+      rbTreeAppendSorted(tree, node->key, listToRbTree((List*) node->value),
         typeRedBlackTreeNoCopy)->type = typeRedBlackTree;
     }
   }
+  rbTreeBuildLinked(tree);
   
   if (list->lock != NULL) {
     mtx_unlock(list->lock);
@@ -1538,183 +2575,109 @@ void *rbTreeGetValue(const RedBlackTree *tree, const volatile void *key) {
   return x;
 }
 
-/// @fn RedBlackTree *xmlToRedBlackTree(const char *inputData)
+// jsonToRedBlackTree implementation from generic macro.
+JSON_TO_DATA_STRUCTURE(RedBlackTree, rbTree)
+
+// xmlToRedBlackTree implementation from generic macro.
+XML_TO_DATA_STRUCTURE(RedBlackTree, rbTree)
+
+/// @fn Bytes rbTreeToBlob(const RedBlackTree *tree)
 ///
-/// @brief Take SOAP data and return a hash table of key-value objects.
+/// @brief Convert a RedBlackTree to a single array of bytes that
+/// rbTreeBlobGetValue can search in place.  The tree's nodes are already in
+/// key order, so its index is written without sorting.
 ///
-/// @param inputData is the full data string from a POST call.
+/// @param tree The RedBlackTree to convert.
 ///
-/// @return Returns a RedBlackTree containing the data parsed.
-RedBlackTree *xmlToRedBlackTree(const char *inputData) {
-  char *separatorAt = NULL;
-  char *rbTreeString = NULL, *indentedRedBlackTreeString = NULL;
-  RedBlackTree *rbTree= NULL;
-  char *key = NULL;
-  Bytes value = NULL;
-  char *xmlString = NULL;
-  
-  printLog(TRACE, "ENTER xmlToRedBlackTree(inputData=\"%s\")\n", inputData);
-  
-  if (inputData == NULL) {
-    printLog(ERR, "NULL inputData provided.\n");
-    printLog(TRACE, "EXIT xmlToRedBlackTree(inputData=NULL) = {NULL}\n");
-    return NULL;
-  }
-  
-  const char *startAt = &(inputData[strspn(inputData, " \t\n")]);
-  if (*startAt != '<') {
-    printLog(DEBUG, "No XML provided.\n");
-    printLog(TRACE, "EXIT xmlToRedBlackTree(inputData=NULL) = {NULL}\n");
-    return NULL;
-  }
-  straddstr(&xmlString, startAt);
-  
-  rbTree = rbTreeCreate(typeString);
-  
-  separatorAt = strstr(xmlString, "Request");
-  if (separatorAt == NULL) {
-    // Might be response data we're parsing instead of request data.  Try that.
-    separatorAt = strstr(xmlString, "Response");
-  }
-  if (separatorAt == NULL) {
-    // See if it's just generic XML, maybe.
-    printLog(DEBUG, "Looking for generic XML data.\n");
-    separatorAt = strchr(xmlString, '>');
-    if (separatorAt != NULL && separatorAt != xmlString) {
-      printLog(DEBUG, "Generic XML data found.\n");
-      separatorAt--;
-    }
-  }
-  if (separatorAt != NULL) {
-    separatorAt = strchr(separatorAt, '>'); // Skip over the request header
-    if (separatorAt != NULL) {
-      separatorAt = strchr(separatorAt, '<');
-      // We're now either at the first field or the close of the request
-    }
-  }
-  
-  while (separatorAt != NULL && *(separatorAt + 1) != '/') {
-    char *endOfLine = strchr(separatorAt, '\n');
-    // separatorAt should point to a '<'
-    char *endOfTag = strchr((++separatorAt), ' ');
-    printLog(DEBUG, "In separatorAt while.\n");
-    
-    if (endOfLine == NULL) {
-      // XML is all on one line
-      endOfLine = separatorAt + strlen(separatorAt);
-    }
-    
-    if (endOfTag != NULL && strchr(separatorAt, '>') &&
-      strchr(separatorAt, '>') < endOfTag) {
-      endOfTag = strchr((separatorAt), '>');
-    }
-    
-    if (endOfTag == NULL || endOfTag > endOfLine) {
-      endOfTag = strchr((separatorAt), '>');
-    }
-    
-    if (endOfTag != NULL) {
-      char *valueAt = NULL;
-      char *closeTag = NULL;
-      
-      if (*endOfTag == '>' && *(endOfTag - 1) == '/') {
-        // There is no value for this key
-        valueAt = NULL;
-      } else if (*endOfTag == '>') {
-        valueAt = endOfTag + 1;
-      } else { // endOfTag is ' '
-        valueAt = strchr((separatorAt + 1), '>');
-        if (valueAt) {
-          valueAt = valueAt + 1;
-        }
-      }
-      *endOfTag = '\0';
-      key = (char *) malloc(strlen(separatorAt) + 1);
-      strcpy(key, separatorAt);
-      straddstr(&closeTag, "</");
-      straddstr(&closeTag, key);
-      if (valueAt) {
-        endOfTag = strstr(valueAt, closeTag);
-      } else {
-        endOfTag = NULL;
-      }
-      if (endOfTag != NULL) {
-        *endOfTag = '\0';
-        value = NULL;
-        bytesAddStr(&value, valueAt);
-      } else {
-        // No value but there WAS a tag so we can't just leave the value
-        // NULL.  Make it an empty string.
-        value = NULL;
-        bytesAddData(&value, "", 1);
-      }
-      closeTag = stringDestroy(closeTag);
-      
-      // OK.  We're parsing XML data.  It's possible that what we just parsed
-      // is really just more XML.  If so, it should be added to a subordinate
-      // List.  Try to detect this case and act intelligently.
-      if (strstr(str(value), "<") != NULL &&
-        strrchr(str(value), '>') != NULL &&
-        strstr(str(value), "<") < strrchr(str(value), '>')) {
-        // Probably more XML.  Make it look like XML and parse again.
-        char *xmlValue = NULL;
-        straddstr(&xmlValue, "<");
-        straddstr(&xmlValue, key);
-        straddstr(&xmlValue, ">\n");
-        straddstr(&xmlValue, str(value));
-        straddstr(&xmlValue, "</");
-        straddstr(&xmlValue, key);
-        straddstr(&xmlValue, ">\n");
-        value = bytesDestroy(value);
-        RedBlackTree *subTable = xmlToRedBlackTree(xmlValue);
-        xmlValue = stringDestroy(xmlValue);
-        HashNode *node = rbTreeAddEntry(rbTree, key, subTable,
-          typeRedBlackTreeNoCopy);
-        if (node == NULL) {
-          printLog(ERR, "rbTreeAddEntry failed when adding key/table pair.\n");
-        } else {
-          node->type = typeRedBlackTree;
-        }
-      }
-    } else {
-      // No end of tag?  Is this possible?
-    }
-    
-    if (value != NULL) {
-      HashNode *node = rbTreeAddEntry(rbTree, key, value, typeBytesNoCopy);
-      if (node != NULL) {
-        node->type = typeBytes;
-      } else {
-        printLog(ERR, "rbTreeAddEntry failed when adding key/value pair.\n");
-      }
-    }
-    key = stringDestroy(key);
-    
-    // separatorAt should now be at the beginning of the value
-    // endOfTag should now be at the '<' of the closing tag but set to '\0'
-    if (endOfTag != NULL) {
-      separatorAt = strchr((endOfTag + 1), '<');
-    } else {
-      separatorAt = separatorAt + 1;
-      separatorAt = strchr(separatorAt, '<');
-    }
-    // separatorAt should now be at the '<' of the opening tag of the next value
-  }
-  
-  xmlString = stringDestroy(xmlString);
-  if (logThreshold <= TRACE) {
-    rbTreeString = rbTreeToString(rbTree);
-    indentedRedBlackTreeString = indentText(rbTreeString, 2);
-    rbTreeString = stringDestroy(rbTreeString);
-  }
-  printLog(TRACE, "EXIT xmlToRedBlackTree(inputData=\"%s\") = {%s}\n",
-    inputData, indentedRedBlackTreeString);
-  indentedRedBlackTreeString = stringDestroy(indentedRedBlackTreeString);
-  return rbTree;
+/// @return Returns a Bytes object with the encoded tree on success,
+/// NULL on failure.
+Bytes rbTreeToBlob(const RedBlackTree *tree) {
+  return listToKeyedBlob((const List*) rbTreeLinkNodes(tree), true);
 }
 
-// jsonToRedBlackTree implementation from generic macro.
-JSON_TO_DATA_STRUCTURE(RedBlackTree, rbTree)
+/// @fn u64 rbTreeToBlobBuffer(const RedBlackTree *tree, void *buffer, u64 bufferSize)
+///
+/// @brief Encode a RedBlackTree the way rbTreeToBlob does, directly into a
+/// buffer.
+///
+/// @param tree The RedBlackTree to encode.
+/// @param buffer The memory to encode the tree into.
+/// @param bufferSize The number of bytes available at buffer.
+///   rbTreeToBlobSize gives the number of bytes needed.
+///
+/// @return Returns the number of bytes written on success, 0 on failure or if
+/// the tree does not fit.
+u64 rbTreeToBlobBuffer(const RedBlackTree *tree, void *buffer,
+  u64 bufferSize
+) {
+  return listToKeyedBlobBuffer((const List*) rbTreeLinkNodes(tree), true,
+    buffer, bufferSize);
+}
+
+/// @fn static char* rbTreeToStringLinked(const RedBlackTree *tree)
+///
+/// @brief Wrapper around listToString that links the nodes of unlinked trees
+///   first.  The List functions below are wrapped the same way so that
+///   typeRbTree can serialize any tree.
+///
+/// @return Returns the value of listToString.
+static char* rbTreeToStringLinked(const RedBlackTree *tree) {
+  return rbTreeToString(tree);
+}
+
+/// @fn static Bytes rbTreeToBytesLinked(const RedBlackTree *tree)
+///
+/// @brief Wrapper around listToBytes that links the nodes of unlinked trees
+///   first.
+///
+/// @return Returns the value of listToBytes.
+static Bytes rbTreeToBytesLinked(const RedBlackTree *tree) {
+  return listToBytes((const List*) rbTreeLinkNodes(tree));
+}
+
+/// @fn static Bytes rbTreeToXmlLinked(const RedBlackTree *tree, const char *elementName, bool indent, ...)
+///
+/// @brief Wrapper around listToXml_ that links the nodes of unlinked trees
+///   first.
+///
+/// @return Returns the value of listToXml_.
+static Bytes rbTreeToXmlLinked(const RedBlackTree *tree,
+  const char *elementName, bool indent, ...
+) {
+  return listToXml_((const List*) rbTreeLinkNodes(tree), elementName, indent);
+}
+
+/// @fn static Bytes rbTreeToJsonLinked(const RedBlackTree *tree)
+///
+/// @brief Wrapper around listToJson that links the nodes of unlinked trees
+///   first.
+///
+/// @return Returns the value of listToJson.
+static Bytes rbTreeToJsonLinked(const RedBlackTree *tree) {
+  return rbTreeToJson(tree);
+}
+
+/// @fn static bool rbTreeToJsonStreamLinked(const RedBlackTree *tree, JsonWriter *writer)
+///
+/// @brief Wrapper around listToJsonStream that links the nodes of unlinked
+///   trees first.
+///
+/// @return Returns the value of listToJsonStream.
+static bool rbTreeToJsonStreamLinked(const RedBlackTree *tree,
+  JsonWriter *writer
+) {
+  return rbTreeToJsonStream(tree, writer);
+}
+
+/// @fn static u64 rbTreeToBlobSizeLinked(const RedBlackTree *tree)
+///
+/// @brief Wrapper around listToBlobSize that links the nodes of unlinked
+///   trees first.
+///
+/// @return Returns the value of listToBlobSize.
+static u64 rbTreeToBlobSizeLinked(const RedBlackTree *tree) {
+  return rbTreeToBlobSize(tree);
+}
 
 /// @var typeRbTree
 ///
@@ -1724,19 +2687,22 @@ TypeDescriptor _typeRbTree = {
   .name          = "RbTree",
   .xmlName       = NULL,
   .dataIsPointer = true,
-  .toString      = (char* (*)(const volatile void*)) listToString,
-  .toBytes       = (Bytes (*)(const volatile void*)) listToBytes,
+  .toString      = (char* (*)(const volatile void*)) rbTreeToStringLinked,
+  .toBytes       = (Bytes (*)(const volatile void*)) rbTreeToBytesLinked,
   .compare       = (int (*)(const volatile void*, const volatile void*)) rbTreeCompare,
   .create        = (void* (*)(const volatile void*, ...)) rbTreeCreate_,
   .copy          = (void* (*)(const volatile void*)) rbTreeCopy,
   .destroy       = (void* (*)(volatile void*)) rbTreeDestroy,
   .size          = rbTreeSize,
-  .toBlob        = (Bytes (*)(const volatile void*)) listToBlob,
+  .toBlob        = (Bytes (*)(const volatile void*)) rbTreeToBlob,
   .fromBlob      = (void* (*)(const volatile void*, u64*, bool, bool)) rbTreeFromBlob_,
   .hashFunction  = NULL,
   .clear         = (i32 (*)(volatile void*)) rbTreeClear,
-  .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) listToXml_,
-  .toJson        = (Bytes (*)(const volatile void*)) listToJson,
+  .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) rbTreeToXmlLinked,
+  .toJson        = (Bytes (*)(const volatile void*)) rbTreeToJsonLinked,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) rbTreeToJsonStreamLinked,
+  .blobSize      = (u64 (*)(const volatile void*)) rbTreeToBlobSizeLinked,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) rbTreeToBlobBuffer,
 };
 TypeDescriptor *typeRbTree = &_typeRbTree;
 
@@ -1755,22 +2721,37 @@ TypeDescriptor _typeRbTreeNoCopy = {
   .name          = "RbTree",
   .xmlName       = NULL,
   .dataIsPointer = true,
-  .toString      = (char* (*)(const volatile void*)) listToString,
-  .toBytes       = (Bytes (*)(const volatile void*)) listToBytes,
+  .toString      = (char* (*)(const volatile void*)) rbTreeToStringLinked,
+  .toBytes       = (Bytes (*)(const volatile void*)) rbTreeToBytesLinked,
   .compare       = (int (*)(const volatile void*, const volatile void*)) rbTreeCompare,
   .create        = (void* (*)(const volatile void*, ...)) rbTreeCreate_,
   .copy          = (void* (*)(const volatile void*)) shallowCopy,
   .destroy       = (void* (*)(volatile void*)) nullFunction,
   .size          = rbTreeSize,
-  .toBlob        = (Bytes (*)(const volatile void*)) listToBlob,
+  .toBlob        = (Bytes (*)(const volatile void*)) rbTreeToBlob,
   .fromBlob      = (void* (*)(const volatile void*, u64*, bool, bool)) rbTreeFromBlob_,
   .hashFunction  = NULL,
   .clear         = (i32 (*)(volatile void*)) rbTreeClear,
-  .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) listToXml_,
-  .toJson        = (Bytes (*)(const volatile void*)) listToJson,
+  .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) rbTreeToXmlLinked,
+  .toJson        = (Bytes (*)(const volatile void*)) rbTreeToJsonLinked,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) rbTreeToJsonStreamLinked,
+  .blobSize      = (u64 (*)(const volatile void*)) rbTreeToBlobSizeLinked,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) rbTreeToBlobBuffer,
 };
 TypeDescriptor *typeRbTreeNoCopy = &_typeRbTreeNoCopy;
 
+/// @fn static bool rbTreeRangeTestFunction(RedBlackNode *node, void *context)
+///
+/// @brief RedBlackTreeRangeFunction used by the unit test.  Adds the node's
+///   i32 key to the i64 sum in context and stops once the sum passes 1000.
+///
+/// @return Returns true to continue the walk, false to stop it.
+static bool rbTreeRangeTestFunction(RedBlackNode *node, void *context) {
+  i64 *sum = (i64*) context;
+  *sum += *((i32*) node->key);
+  return (*sum <= 1000);
+}
+
 /// @def RED_BLACK_TREE_UNIT_TEST
 ///
 /// @brief Unit test for red-black tree functionality.
@@ -2166,6 +3147,137 @@ bool redBlackTreeUnitTest() { \
   } \
   listDestroy(list); list = NULL; \
   tree = (RedBlackTree*) rbTreeDestroy(tree); \
+ \
+  i32 sortedKeys[1000]; \
+  const volatile void *sortedKeyPointers[1000]; \
+  for (int ii = 0; ii < 1000; ii++) { \
+    sortedKeys[ii] = ii * 2; \
+    sortedKeyPointers[ii] = &sortedKeys[ii]; \
+  } \
+  tree = rbTreeBuildSorted(typeI32, sortedKeyPointers, NULL, 1000); \
+  if ((tree == NULL) || (tree->size != 1000) \
+    || (tree->root->left->red == true) \
+  ) { \
+    printLog(ERR, "rbTreeBuildSorted did not build a 1000 element tree.\n"); \
+    return false; \
+  } \
+  node = tree->head; \
+  for (int ii = 0; ii < 1000; ii++) { \
+    if ((node == NULL) || (*((i32*) node->key) != ii * 2) \
+      || (rbQuery(tree, &sortedKeys[ii]) != node) \
+    ) { \
+      printLog(ERR, "rbTreeBuildSorted node %d is wrong.\n", ii); \
+      return false; \
+    } \
+    node = node->next; \
+  } \
+  for (int ii = 1; ii < 2000; ii += 2) { \
+    rbInsert(tree, &ii, &ii); \
+  } \
+  for (int ii = 0; ii < 2000; ii += 4) { \
+    rbTreeRemove(tree, &ii); \
+  } \
+  node = tree->head; \
+  for (int ii = 0; ii < 2000; ii++) { \
+    if ((ii % 4) == 0) { \
+      continue; \
+    } \
+    if ((node == NULL) || (*((i32*) node->key) != ii)) { \
+      printLog(ERR, "Built tree is out of order after updates at %d.\n", ii); \
+      return false; \
+    } \
+    node = node->next; \
+  } \
+  tree = (RedBlackTree*) rbTreeDestroy(tree); \
+  sortedKeyPointers[500] = &sortedKeys[10]; \
+  tree = rbTreeBuildSorted(typeI32, sortedKeyPointers, NULL, 1000); \
+  if ((tree == NULL) || (tree->size != 1000) \
+    || (*((i32*) tree->head->next->next->next->next->next->next->next->next \
+      ->next->next->next->key) != 20) \
+  ) { \
+    printLog(ERR, "rbTreeBuildSorted mishandled unsorted input.\n"); \
+    return false; \
+  } \
+  tree = (RedBlackTree*) rbTreeDestroy(tree); \
+ \
+  tree = rbTreeCreate(typeI32); \
+  for (int ii = 0; ii < 100; ii += 2) { \
+    rbInsert(tree, &ii, &ii); \
+  } \
+  int boundKey = 41; \
+  node = rbTreeLowerBound(tree, &boundKey); \
+  RedBlackNode *upperNode = rbTreeUpperBound(tree, &boundKey); \
+  if ((node == NULL) || (*((i32*) node->key) != 42) || (upperNode != node)) { \
+    printLog(ERR, "Wrong bounds for a key that is not in the tree.\n"); \
+    return false; \
+  } \
+  boundKey = 42; \
+  node = rbTreeLowerBound(tree, &boundKey); \
+  upperNode = rbTreeUpperBound(tree, &boundKey); \
+  if ((node == NULL) || (*((i32*) node->key) != 42) \
+    || (upperNode == NULL) || (*((i32*) upperNode->key) != 44) \
+  ) { \
+    printLog(ERR, "Wrong bounds for a key that is in the tree.\n"); \
+    return false; \
+  } \
+  boundKey = 98; \
+  if ((rbTreeUpperBound(tree, &boundKey) != NULL) \
+    || (rbTreeLowerBound(tree, NULL) != NULL) \
+  ) { \
+    printLog(ERR, "Expected NULL bounds past the end of the tree.\n"); \
+    return false; \
+  } \
+  int lowKey = 9, highKey = 20; \
+  i64 rangeSum = 0; \
+  if ((rbTreeRange(tree, &lowKey, &highKey, rbTreeRangeTestFunction, \
+      &rangeSum) != 6) || (rangeSum != 10 + 12 + 14 + 16 + 18 + 20) \
+  ) { \
+    printLog(ERR, "rbTreeRange visited the wrong nodes.\n"); \
+    return false; \
+  } \
+  rangeSum = 0; \
+  if ((rbTreeRange(tree, NULL, NULL, rbTreeRangeTestFunction, &rangeSum) \
+      != 33) || (rangeSum != 1056) \
+  ) { \
+    printLog(ERR, "rbTreeRange did not stop when asked to.\n"); \
+    return false; \
+  } \
+  rbInsert(tree, &highKey, &highKey); \
+  rbInsert(tree, &highKey, &highKey); \
+  RedBlackTreeCursor cursor; \
+  RedBlackNode *cursorNodes[4]; \
+  rbTreeCursorInit(&cursor, tree, &lowKey, NULL); \
+  int expectedKey = 10, numDuplicates = 0; \
+  u64 numCursorNodes = 0, totalCursorNodes = 0; \
+  while ((numCursorNodes = rbTreeCursorNext(&cursor, cursorNodes, 4)) > 0) { \
+    for (u64 ii = 0; ii < numCursorNodes; ii++) { \
+      if (*((i32*) cursorNodes[ii]->key) != expectedKey) { \
+        printLog(ERR, "Cursor returned %d, expected %d.\n", \
+          *((i32*) cursorNodes[ii]->key), expectedKey); \
+        return false; \
+      } \
+      if ((expectedKey == 20) && (numDuplicates < 2)) { \
+        numDuplicates++; \
+      } else { \
+        expectedKey += 2; \
+      } \
+    } \
+    totalCursorNodes += numCursorNodes; \
+    if (totalCursorNodes == 8) { \
+      /* Removing nodes between batches must not confuse the cursor. */ \
+      rbTreeRemove(tree, &highKey); \
+      boundKey = 22; \
+      rbTreeRemove(tree, &boundKey); \
+      expectedKey = 24; \
+    } \
+  } \
+  rbTreeCursorDestroy(&cursor); \
+  if ((totalCursorNodes != 46) || (expectedKey != 100)) { \
+    printLog(ERR, "Cursor returned %llu nodes, expected 46.\n", \
+      llu(totalCursorNodes)); \
+    return false; \
+  } \
+  tree = (RedBlackTree*) rbTreeDestroy(tree); \
  \
   const char *jsonString = "{\n" \
     "  \"myRedBlackTree1\": {\n" \
@@ -2194,6 +3306,32 @@ bool redBlackTreeUnitTest() { \
   } \
   Bytes byteArray = typeRedBlackTree->toBlob(tree); \
   u64 length = bytesLength(byteArray); \
+  TypeDescriptor *blobType = NULL; \
+  u64 blobLength = 0; \
+  const void *blobValue = rbTreeBlobGetValue(byteArray, length, "key3", \
+    &blobType, &blobLength); \
+  if ((blobValue == NULL) || (blobType != typeDouble) \
+    || (*((double*) blobValue) != -1E3) \
+  ) { \
+    printLog(ERR, "rbTreeBlobGetValue did not find key3 in place.\n"); \
+    return false; \
+  } \
+  blobValue = rbTreeBlobGetValue(byteArray, length, "myRedBlackTree1", \
+    &blobType, &blobLength); \
+  if ((blobValue == NULL) || (blobType != typeRedBlackTree)) { \
+    printLog(ERR, "rbTreeBlobGetValue did not find myRedBlackTree1.\n"); \
+    return false; \
+  } \
+  blobValue = rbTreeBlobGetValue(blobValue, blobLength, "key1", \
+    &blobType, &blobLength); \
+  if ((blobValue == NULL) || (*((i64*) blobValue) != 1)) { \
+    printLog(ERR, "rbTreeBlobGetValue did not find nested key1.\n"); \
+    return false; \
+  } \
+  if (rbTreeBlobGetValue(byteArray, length, "key0", NULL, NULL) != NULL) { \
+    printLog(ERR, "rbTreeBlobGetValue found a key that is not there.\n"); \
+    return false; \
+  } \
   tree = rbTreeDestroy(tree); \
   tree = rbTreeFromBlob(byteArray, &length, true); \
   stringValue = rbTreeToString(tree); \
@@ -2310,6 +3448,89 @@ bool redBlackTreeUnitTest() { \
   } \
   byteArray = bytesDestroy(byteArray); \
   tree = rbTreeDestroy(tree); \
+ \
+  tree = rbTreeCreate(typeI32, false, true); \
+  if ((tree == NULL) || (tree->rwLock == NULL)) { \
+    printLog(ERR, "Could not create tree with shared locking.\n"); \
+    return false; \
+  } \
+  for (i32 i = 0; i < 1000; i++) { \
+    rbInsert(tree, &i, &i); \
+  } \
+  for (i32 i = 0; i < 1000; i += 2) { \
+    if (rbTreeRemove(tree, &i) != 0) { \
+      printLog(ERR, "Could not remove %d from shared-locking tree.\n", i); \
+      return false; \
+    } \
+  } \
+  for (i32 i = 0; i < 1000; i++) { \
+    if ((rbQuery(tree, &i) != NULL) != ((i & 1) == 1)) { \
+      printLog(ERR, "Wrong query result for %d in shared-locking tree.\n", \
+        i); \
+      return false; \
+    } \
+  } \
+  tree2 = rbTreeCopy(tree); \
+  if ((tree2 == NULL) || (tree2->rwLock == NULL) \
+    || (rbTreeCompare(tree, tree2) != 0) \
+  ) { \
+    printLog(ERR, "Copy of shared-locking tree is not equivalent.\n"); \
+    return false; \
+  } \
+  tree2 = rbTreeDestroy(tree2); \
+  tree = rbTreeDestroy(tree); \
+ \
+  tree = rbTreeCreate(typeI32, false, false, false, true); \
+  for (i32 i = 0; i < 1000; i++) { \
+    i32 key = (i * 7919) % 1000; \
+    rbInsert(tree, &key, &key); \
+  } \
+  for (i32 i = 0; i < 1000; i += 2) { \
+    rbTreeRemove(tree, &i); \
+  } \
+  if ((tree->head != NULL) || (tree->size != 500)) { \
+    printLog(ERR, "Unlinked tree maintained its list.\n"); \
+    return false; \
+  } \
+  if ((rbTreeFirst(tree) == NULL) || (*((i32*) rbTreeFirst(tree)->key) != 1) \
+    || (rbTreeLast(tree) == NULL) \
+    || (*((i32*) rbTreeLast(tree)->key) != 999) \
+  ) { \
+    printLog(ERR, "Wrong first or last node in unlinked tree.\n"); \
+    return false; \
+  } \
+  i64 unlinkedSum = 0; \
+  if ((rbTreeRange(tree, NULL, NULL, rbTreeRangeTestFunction, &unlinkedSum) \
+      != 32) \
+    || (unlinkedSum != 1024) \
+  ) { \
+    printLog(ERR, "rbTreeRange walked unlinked tree incorrectly.\n"); \
+    return false; \
+  } \
+  list = rbTreeToList(tree); \
+  i32 expected = 1; \
+  for (ListNode *listNode = (list != NULL) ? list->head : NULL; \
+    listNode != NULL; listNode = listNode->next \
+  ) { \
+    if (*((i32*) listNode->key) != expected) { \
+      break; \
+    } \
+    expected += 2; \
+  } \
+  if ((list == NULL) || (list->size != 500) || (expected != 1001)) { \
+    printLog(ERR, "rbTreeToList did not list unlinked tree in order.\n"); \
+    return false; \
+  } \
+  list = listDestroy(list); \
+  tree2 = rbTreeCopy(tree); \
+  if ((tree2 == NULL) || (tree2->unlinked == false) \
+    || (rbTreeCompare(tree, tree2) != 0) \
+  ) { \
+    printLog(ERR, "Copy of unlinked tree is not equivalent.\n"); \
+    return false; \
+  } \
+  tree2 = rbTreeDestroy(tree2); \
+  tree = rbTreeDestroy(tree); \
  \
   return true; \
 }
@@ -25,6 +25,7 @@
  */
 
 #include "Regex.h"
+#include "LoggingLib.h"
 
 #define END_LINE '\0'
 #define MAX_QUANTIFICATION_VALUE  1024  // Max in {M,N} - Denotes the minimum M and the maximum N regexMatch count.
@@ -69,6 +70,9 @@ static bool matchCharClass(unsigned char character, const unsigned char *metaCha
 static inline bool isMatchingRange(unsigned char character, const unsigned char *string);
 static bool isMatchingMetaChar(unsigned char character, const unsigned char *metaCharString);
 
+static void prepareDfaProgram(Regex *regex);
+static bool regexMatchDfa(Regex *regex, const char *text, Matcher *matcher);
+
 
 static inline void setCompilerChar(RegexCompiler *regexCompiler, const char *pattern, char charInPattern) {
     switch (charInPattern) {
@@ -108,6 +112,7 @@ void regexCompileLength(Regex *regex, const char *pattern, size_t patternLength)
     if (regex == NULL) return;
     regex->isPatternValid = true;
     regex->errorMessage = "Success";
+    regex->dfaProgram.isPrepared = false;
     RegexCompiler regexCompiler;
     regexCompiler.classCharIndex = 0;
     regexCompiler.patternIndex = 0;
@@ -175,7 +180,21 @@ bool regexMatchMatcher(Regex *regex, const char *text, Matcher *matcher) {
         return matcher->isFound;
     }
 
+    // Trying every starting offset with the backtracking matcher is quadratic
+    // (or worse) in the length of the text, so screen long texts first.
+    if (strnlen(text, REGEX_DFA_MIN_TEXT_LENGTH) == REGEX_DFA_MIN_TEXT_LENGTH) {
+        if (!regex->dfaProgram.isPrepared) {
+            prepareDfaProgram(regex);
+        }
+        if (regex->dfaProgram.isUsable && regexMatchDfa(regex, text, matcher)) {
+            return matcher->isFound;
+        }
+    }
+
     do {
+        // Each starting offset is an independent attempt.  Don't let the
+        // length left over from a failed attempt leak into the next one.
+        matcher->matchLength = 0;
         if (matchPattern(regex->compiledRegexArray, matcher, text)) {
             if (*text == END_LINE) {
                 matcher->isFound = false;
@@ -291,6 +310,10 @@ static void resolveEscapedCharacterClasses(RegexCompiler *regexCompiler, const c
             setRegexPatternType(REGEX_REGULAR_CHAR, regexCompiler); // Escaped character, e.g. '.' or '$'
             regexCompiler->regex->compiledRegexArray[regexCompiler->regexIndex].regexChar = pattern[regexCompiler->patternIndex];
         }
+    } else {
+        // A trailing backslash escapes nothing.  Don't leave its node unset.
+        regexCompiler->regex->isPatternValid = false;
+        regexCompiler->regex->errorMessage = "Incomplete pattern, missing non-zero char after '\\'";
     }
 }
 
@@ -383,6 +406,7 @@ static void resolveQuantification(RegexCompiler *regexCompiler, const char *patt
         return;
     }
     regexCompiler->regex->compiledRegexArray[regexCompiler->regexIndex].minMaxQuantifiers[0] = minQuantifierValue;
+    regexCompiler->regex->compiledRegexArray[regexCompiler->regexIndex].minMaxQuantifiers[1] = minQuantifierValue;   // {n} means exactly n
 
     if (pattern[regexCompiler->patternIndex] == ',') {
         regexCompiler->patternIndex++;  // Skip ','
@@ -647,17 +671,365 @@ static bool isMatchingMetaChar(unsigned char character, const unsigned char *met
     }
 }
 
+// Bit used in automaton state keys to mark unanchored states, which restart
+// the pattern at every byte.
+#define REGEX_DFA_UNANCHORED (1ULL << 63)
+#define REGEX_DFA_UNBOUNDED UINT16_MAX
+#define REGEX_DFA_INITIAL_STATES 16
+
+typedef struct RegexDfa {
+    const RegexDfaProgram *program;
+    uint64_t *states;       // State keys:  position sets plus the accept and mode bits.
+    int16_t *transitions;   // numClasses entries per state, -1 if not built yet.
+    uint16_t numStates;
+    uint16_t capacity;
+} RegexDfa;
+
+static void prepareDfaProgram(Regex *regex) {
+    RegexDfaProgram *program = &regex->dfaProgram;
+    RegexNode *nodes = regex->compiledRegexArray;
+    program->isPrepared = true;
+    program->isUsable = false;
+    if (!regex->isPatternValid) {
+        // Every node is fed every byte below, so only build over patterns
+        // that compiled completely.
+        return;
+    }
+    program->anchoredEnd = false;
+    program->numPositions = 0;
+    program->numClasses = 0;
+    program->firstByte = -1;
+    program->repeatMask = 0;
+    program->literalLength = 0;
+
+    uint16_t numAtoms = 0;
+    for (uint16_t ii = 0; nodes[ii].patternType != REGEX_END_OF_PATTERN; ii++) {
+        if ((nodes[ii].patternType < REGEX_QUESTION_MARK) || (nodes[ii].patternType > REGEX_LAZY_PLUS)) {
+            if (nodes[ii].patternType != REGEX_QUANTIFIER) {
+                numAtoms++;
+            }
+        }
+    }
+
+    uint64_t byteMask[256];
+    memset(byteMask, 0, sizeof(byteMask));
+    uint64_t optionalMask = 0;
+    unsigned char literal[MAX_REGEXP_OBJECTS];
+    uint8_t literalLength = 0;
+    uint8_t numPositions = 0;
+
+    for (uint16_t ii = 0; nodes[ii].patternType != REGEX_END_OF_PATTERN; ii++) {
+        RegexNode *atom = &nodes[ii];
+        if ((ii == 0) && (atom->patternType == REGEX_BEGIN)) {
+            numAtoms--;
+            continue;
+        } else if ((atom->patternType == REGEX_DOLLAR_END) && (nodes[ii + 1].patternType == REGEX_END_OF_PATTERN)) {
+            program->anchoredEnd = true;
+            break;
+        }
+        numAtoms--;
+
+        uint16_t minCount = 1;
+        uint16_t maxCount = 1;
+        switch (nodes[ii + 1].patternType) {
+            case REGEX_QUESTION_MARK:
+                minCount = 0;
+                ii++;
+                break;
+            case REGEX_STAR:
+            case REGEX_LAZY_STAR:
+                minCount = 0;
+                maxCount = REGEX_DFA_UNBOUNDED;
+                ii++;
+                break;
+            case REGEX_PLUS:
+            case REGEX_LAZY_PLUS:
+                maxCount = REGEX_DFA_UNBOUNDED;
+                ii++;
+                break;
+            case REGEX_QUANTIFIER:
+                minCount = nodes[ii + 1].minMaxQuantifiers[0];
+                maxCount = nodes[ii + 1].minMaxQuantifiers[1];
+                if (maxCount == MAX_QUANTIFICATION_VALUE) {
+                    maxCount = REGEX_DFA_UNBOUNDED;
+                }
+                ii++;
+                break;
+            default:
+                break;
+        }
+
+        // Keep the longest run of unquantified characters as the required literal.
+        if ((atom->patternType == REGEX_REGULAR_CHAR) && (minCount == 1) && (maxCount == 1)) {
+            literal[literalLength++] = atom->regexChar;
+            if (literalLength > program->literalLength) {
+                memcpy(program->literal, literal, literalLength);
+                program->literalLength = literalLength;
+            }
+        } else {
+            literalLength = 0;
+        }
+
+        // Expand the repetition into positions.  If that won't leave room for
+        // the atoms that follow, settle for x+ or x*, which accept more.
+        uint16_t needed = (maxCount == REGEX_DFA_UNBOUNDED) ? ((minCount > 0) ? minCount : 1) : maxCount;
+        if (numPositions + needed + numAtoms > REGEX_DFA_MAX_POSITIONS) {
+            needed = 1;
+            minCount = (minCount > 0) ? 1 : 0;
+            maxCount = REGEX_DFA_UNBOUNDED;
+        }
+        if (numPositions + needed + numAtoms > REGEX_DFA_MAX_POSITIONS) {
+            return;
+        }
+
+        uint64_t atomMask = 0;
+        for (uint16_t jj = 0; jj < needed; jj++) {
+            uint64_t position = 1ULL << (numPositions + jj);
+            atomMask |= position;
+            if ((jj >= minCount) || ((maxCount == REGEX_DFA_UNBOUNDED) && (minCount == 0))) {
+                optionalMask |= position;
+            }
+            if ((maxCount == REGEX_DFA_UNBOUNDED) && (jj == needed - 1)) {
+                program->repeatMask |= position;
+            }
+        }
+        numPositions += needed;
+        if (atomMask != 0) {
+            for (int byte = 1; byte < 256; byte++) {
+                if (matchOne(atom, (char) byte)) {
+                    byteMask[byte] |= atomMask;
+                }
+            }
+        }
+    }
+    program->literal[program->literalLength] = END_LINE;
+
+    program->numPositions = numPositions;
+    program->closure[numPositions] = 1ULL << numPositions;
+    for (int position = numPositions - 1; position >= 0; position--) {
+        program->closure[position] = 1ULL << position;
+        if (optionalMask & (1ULL << position)) {
+            program->closure[position] |= program->closure[position + 1];
+        }
+    }
+
+    // Group the bytes that no position can tell apart so that each state's
+    // transition table only needs one entry per group.
+    for (int byte = 0; byte < 256; byte++) {
+        uint16_t byteClass = 0;
+        while ((byteClass < program->numClasses) && (program->classMask[byteClass] != byteMask[byte])) {
+            byteClass++;
+        }
+        if (byteClass == program->numClasses) {
+            program->classMask[byteClass] = byteMask[byte];
+            program->numClasses++;
+        }
+        program->byteClass[byte] = (uint8_t) byteClass;
+    }
+
+    // If only one byte can start a match, candidate starting points can be
+    // found with strchr.
+    uint64_t acceptBit = 1ULL << numPositions;
+    if ((program->closure[0] & acceptBit) == 0) {
+        for (int byte = 1; byte < 256; byte++) {
+            if (byteMask[byte] & program->closure[0]) {
+                if (program->firstByte >= 0) {
+                    program->firstByte = -1;
+                    break;
+                }
+                program->firstByte = (int16_t) byte;
+            }
+        }
+    }
+
+    program->isUsable = true;
+}
+
+static int16_t addDfaState(RegexDfa *dfa, uint64_t key, bool *flushed) {
+    for (uint16_t ii = 0; ii < dfa->numStates; ii++) {
+        if (dfa->states[ii] == key) {
+            return (int16_t) ii;
+        }
+    }
+
+    uint16_t numClasses = dfa->program->numClasses;
+    if (dfa->numStates == dfa->capacity) {
+        if (dfa->capacity < REGEX_DFA_MAX_STATES) {
+            uint16_t capacity = (dfa->capacity > 0) ? (2 * dfa->capacity) : REGEX_DFA_INITIAL_STATES;
+            uint64_t *states = (uint64_t*) realloc(dfa->states, capacity * sizeof(uint64_t));
+            if (states == NULL) {
+                return -1;
+            }
+            dfa->states = states;
+            int16_t *transitions = (int16_t*) realloc(dfa->transitions, capacity * numClasses * sizeof(int16_t));
+            if (transitions == NULL) {
+                return -1;
+            }
+            dfa->transitions = transitions;
+            dfa->capacity = capacity;
+        } else {
+            // Start over rather than grow without bound.
+            dfa->numStates = 0;
+            *flushed = true;
+        }
+    }
+
+    int16_t index = (int16_t) dfa->numStates++;
+    dfa->states[index] = key;
+    memset(&dfa->transitions[index * numClasses], -1, numClasses * sizeof(int16_t));
+    return index;
+}
+
+static int16_t nextDfaState(RegexDfa *dfa, int16_t stateIndex, unsigned char character) {
+    const RegexDfaProgram *program = dfa->program;
+    uint8_t byteClass = program->byteClass[character];
+    int16_t *transition = &dfa->transitions[stateIndex * program->numClasses + byteClass];
+    if (*transition >= 0) {
+        return *transition;
+    }
+
+    uint64_t state = dfa->states[stateIndex];
+    uint64_t matched = state & program->classMask[byteClass];
+    uint64_t key = 0;
+    for (uint8_t position = 0; matched != 0; position++, matched >>= 1) {
+        if (matched & 1) {
+            key |= program->closure[position + 1];
+            if (program->repeatMask & (1ULL << position)) {
+                key |= 1ULL << position;
+            }
+        }
+    }
+    if (state & REGEX_DFA_UNANCHORED) {
+        key |= program->closure[0] | REGEX_DFA_UNANCHORED;
+    }
+
+    bool flushed = false;
+    int16_t nextIndex = addDfaState(dfa, key, &flushed);
+    if ((nextIndex >= 0) && !flushed) {
+        dfa->transitions[stateIndex * program->numClasses + byteClass] = nextIndex;
+    }
+    return nextIndex;
+}
+
+// Returns 1 if some match starting at text (or, if unanchored, anywhere in
+// text) is accepted by the automaton, 0 if none is, -1 on allocation failure.
+static int runDfa(RegexDfa *dfa, const char *text, bool unanchored) {
+    const RegexDfaProgram *program = dfa->program;
+    uint64_t acceptBit = 1ULL << program->numPositions;
+    bool flushed = false;
+    int16_t state = addDfaState(dfa, program->closure[0] | (unanchored ? REGEX_DFA_UNANCHORED : 0), &flushed);
+    if (state < 0) {
+        return -1;
+    }
+
+    for (; ; text++) {
+        uint64_t key = dfa->states[state];
+        if (program->anchoredEnd) {
+            if (*text == END_LINE) {
+                return (key & acceptBit) ? 1 : 0;
+            }
+        } else if (key & acceptBit) {
+            return 1;
+        } else if (*text == END_LINE) {
+            return 0;
+        }
+        if (key == 0) {
+            return 0;   // Dead state.
+        }
+
+        state = nextDfaState(dfa, state, (unsigned char) *text);
+        if (state < 0) {
+            return -1;
+        }
+    }
+}
+
+// Find the first match by running the backtracking matcher only where the
+// automaton says a match can start.  Returns false if the automaton couldn't
+// be used, in which case the caller has to do the search itself.
+static bool regexMatchDfa(Regex *regex, const char *text, Matcher *matcher) {
+    RegexDfaProgram *program = &regex->dfaProgram;
+    if ((program->literalLength > 0) && (strstr(text, (const char*) program->literal) == NULL)) {
+        matcher->isFound = false;
+        return true;
+    }
+
+    RegexDfa dfa = { program, NULL, NULL, 0, 0 };
+    bool usedDfa = true;
+    matcher->isFound = false;
+
+    int status = runDfa(&dfa, text, true);
+    if (status > 0) {
+        const char *start = text;
+        for (; *text != END_LINE; text++) {
+            if (program->firstByte >= 0) {
+                text = strchr(text, program->firstByte);
+                if (text == NULL) {
+                    break;
+                }
+            }
+
+            status = runDfa(&dfa, text, false);
+            if (status < 0) {
+                break;
+            }
+            matcher->matchLength = 0;
+            if ((status > 0) && matchPattern(regex->compiledRegexArray, matcher, text)) {
+                matcher->foundAtIndex = (int32_t) (text - start);
+                matcher->isFound = true;
+                break;
+            }
+        }
+    }
+    if (status < 0) {
+        usedDfa = false;
+    }
+
+    free(dfa.states);
+    free(dfa.transitions);
+    return usedDfa;
+}
+
+void regexPrepareSearch(Regex *regex) {
+    if ((regex != NULL) && regex->isPatternValid && !regex->dfaProgram.isPrepared) {
+        prepareDfaProgram(regex);
+    }
+}
+
 uint64_t substitute_(const char *haystack, const char *pattern,
     const char *replacement, bool greedy,
     char *buffer, uint64_t bufferLength,
     bool *successful, const char **errorMessage, ...
+) {
+    if ((haystack == NULL) || (pattern == NULL)
+        || (replacement == NULL) || (buffer == NULL)
+    ) {
+        if (successful != NULL) {
+            *successful = false;
+        }
+        if (errorMessage != NULL) {
+            *errorMessage = "One or more NULL parameters to substitute.\n";
+        }
+        return 0;
+    }
+
+    Regex regex;
+    regexCompileLength(&regex, pattern, 0);
+    return substituteRegex_(haystack, &regex, replacement, greedy,
+        buffer, bufferLength, successful, errorMessage);
+}
+
+uint64_t substituteRegex_(const char *haystack, Regex *regex,
+    const char *replacement, bool greedy,
+    char *buffer, uint64_t bufferLength,
+    bool *successful, const char **errorMessage, ...
 ) {
     uint64_t bufferPosition = 0;
     uint64_t haystackPosition = 0;
     uint64_t replacementLength = 0;
     uint64_t copyLength = 0;
 
-    if ((haystack == NULL) || (pattern == NULL)
+    if ((haystack == NULL) || (regex == NULL)
         || (replacement == NULL) || (buffer == NULL)
     ) {
         if (successful != NULL) {
@@ -676,20 +1048,18 @@ uint64_t substitute_(const char *haystack, const char *pattern,
         *errorMessage = NULL;
     }
 
-    Regex regex;
-    regexCompileLength(&regex, pattern, 0);
-    if (!regex.isPatternValid) {
+    if (!regex->isPatternValid) {
         if (successful != NULL) {
             *successful = false;
         }
         if (errorMessage != NULL) {
-            *errorMessage = regex.errorMessage;
+            *errorMessage = regex->errorMessage;
         }
         goto final;
     }
 
     Matcher matcher;
-    regexMatchMatcher(&regex, &haystack[haystackPosition], &matcher);
+    regexMatchMatcher(regex, &haystack[haystackPosition], &matcher);
     while (matcher.isFound) {
         copyLength = (haystackPosition + matcher.foundAtIndex) - haystackPosition;
         if ((bufferPosition + copyLength) < bufferLength) {
@@ -725,7 +1095,7 @@ uint64_t substitute_(const char *haystack, const char *pattern,
         haystackPosition += matcher.matchLength;
 
         if (greedy == true) {
-            regexMatchMatcher(&regex, &haystack[haystackPosition], &matcher);
+            regexMatchMatcher(regex, &haystack[haystackPosition], &matcher);
         } else {
             break;
         }
@@ -833,6 +1203,214 @@ uint64_t substituteMultiple_(const char *haystack, Substitution *substitutions,
     return maxReplacementLength;
 }
 
+SubstitutionSet* substitutionSetCreate(const Substitution *substitutions, const char **errorMessage) {
+    if (errorMessage != NULL) {
+        *errorMessage = NULL;
+    }
+    if (substitutions == NULL) {
+        if (errorMessage != NULL) {
+            *errorMessage = "NULL substitutions provided to substitutionSetCreate.\n";
+        }
+        return NULL;
+    }
+
+    uint64_t numSubstitutions = 0;
+    while ((substitutions[numSubstitutions].pattern != NULL)
+        && (substitutions[numSubstitutions].replacement != NULL)
+    ) {
+        numSubstitutions++;
+    }
+
+    SubstitutionSet *substitutionSet = (SubstitutionSet*) calloc(1, sizeof(SubstitutionSet));
+    if (substitutionSet == NULL) {
+        goto allocationFailure;
+    }
+    substitutionSet->numSubstitutions = numSubstitutions;
+    if (numSubstitutions == 0) {
+        return substitutionSet;
+    }
+
+    substitutionSet->regexes = (Regex*) malloc(numSubstitutions * sizeof(Regex));
+    substitutionSet->replacements = (const char**) malloc(numSubstitutions * sizeof(const char*));
+    substitutionSet->replacementLengths = (uint64_t*) malloc(numSubstitutions * sizeof(uint64_t));
+    if ((substitutionSet->regexes == NULL) || (substitutionSet->replacements == NULL)
+        || (substitutionSet->replacementLengths == NULL)
+    ) {
+        goto allocationFailure;
+    }
+
+    for (uint64_t ii = 0; ii < numSubstitutions; ii++) {
+        Regex *regex = &substitutionSet->regexes[ii];
+        regexCompile(regex, substitutions[ii].pattern);
+        if (!regex->isPatternValid) {
+            if (errorMessage != NULL) {
+                *errorMessage = regex->errorMessage;
+            }
+            return substitutionSetDestroy(substitutionSet);
+        }
+        // Prepare the automaton now so that applying the set never modifies it.
+        prepareDfaProgram(regex);
+        substitutionSet->replacements[ii] = substitutions[ii].replacement;
+        substitutionSet->replacementLengths[ii] = (uint64_t) strlen(substitutions[ii].replacement);
+    }
+
+    return substitutionSet;
+
+allocationFailure:
+    if (errorMessage != NULL) {
+        *errorMessage = "Could not allocate memory for substitution set.\n";
+    }
+    return substitutionSetDestroy(substitutionSet);
+}
+
+SubstitutionSet* substitutionSetDestroy(SubstitutionSet *substitutionSet) {
+    if (substitutionSet != NULL) {
+        free(substitutionSet->regexes);
+        free(substitutionSet->replacements);
+        free(substitutionSet->replacementLengths);
+        free(substitutionSet);
+    }
+    return NULL;
+}
+
+// The next match of one pattern of a substitution set.  A match is only
+// searched for again once the output has moved past where it starts.
+typedef struct SubstitutionSetMatch {
+    uint64_t index;
+    uint64_t length;
+    bool isFound;
+    bool isDone;
+} SubstitutionSetMatch;
+
+static inline void appendSubstitutionOutput(char *buffer, uint64_t bufferLength,
+    uint64_t *bufferPosition, uint64_t *writtenLength, const char *source, uint64_t length
+) {
+    // Once something doesn't fit, nothing after it is written either.
+    if ((*writtenLength == *bufferPosition) && (*bufferPosition + length < bufferLength)) {
+        memcpy(&buffer[*bufferPosition], source, length);
+        *writtenLength += length;
+    }
+    *bufferPosition += length;
+}
+
+uint64_t substitutionSetApply_(const SubstitutionSet *substitutionSet,
+    const char *haystack, bool greedy, char *buffer, uint64_t bufferLength,
+    bool *successful, const char **errorMessage, ...
+) {
+    uint64_t bufferPosition = 0;
+    uint64_t writtenLength = 0;
+    uint64_t haystackPosition = 0;
+    uint64_t haystackLength = 0;
+    SubstitutionSetMatch *matches = NULL;
+
+    if ((substitutionSet == NULL) || (haystack == NULL)
+        || (buffer == NULL) || (bufferLength == 0)
+    ) {
+        if (successful != NULL) {
+            *successful = false;
+        }
+        if (errorMessage != NULL) {
+            *errorMessage = "One or more NULL parameters to substitutionSetApply.\n";
+        }
+        return bufferPosition; // 0
+    }
+    haystackLength = (uint64_t) strlen(haystack);
+
+    if (errorMessage != NULL) {
+        *errorMessage = NULL;
+    }
+    if (successful != NULL) {
+        *successful = true;
+    }
+
+    if (substitutionSet->numSubstitutions > 0) {
+        matches = (SubstitutionSetMatch*) calloc(substitutionSet->numSubstitutions, sizeof(SubstitutionSetMatch));
+        if (matches == NULL) {
+            if (successful != NULL) {
+                *successful = false;
+            }
+            if (errorMessage != NULL) {
+                *errorMessage = "Could not allocate memory for substitutionSetApply.\n";
+            }
+            goto final;
+        }
+    }
+
+    while (haystackPosition < haystackLength) {
+        SubstitutionSetMatch *first = NULL;
+        uint64_t firstIndex = 0;
+        for (uint64_t ii = 0; ii < substitutionSet->numSubstitutions; ii++) {
+            SubstitutionSetMatch *match = &matches[ii];
+            if (match->isDone) {
+                continue;
+            }
+
+            if (!match->isFound || (match->index < haystackPosition)) {
+                // Patterns anchored with '^' can only match at the very start.
+                Regex *regex = &substitutionSet->regexes[ii];
+                if ((regex->compiledRegexArray[0].patternType == REGEX_BEGIN) && (haystackPosition > 0)) {
+                    match->isDone = true;
+                    continue;
+                }
+
+                Matcher matcher;
+                regexMatchMatcher(regex, &haystack[haystackPosition], &matcher);
+                if (!matcher.isFound) {
+                    match->isDone = true;
+                    continue;
+                }
+                match->index = haystackPosition + (uint64_t) matcher.foundAtIndex;
+                match->length = (matcher.matchLength > 0) ? (uint64_t) matcher.matchLength : 0;
+                match->isFound = true;
+            }
+
+            if ((first == NULL) || (match->index < first->index)) {
+                first = match;
+                firstIndex = ii;
+            }
+        }
+        if (first == NULL) {
+            break;
+        }
+
+        appendSubstitutionOutput(buffer, bufferLength, &bufferPosition, &writtenLength,
+            &haystack[haystackPosition], first->index - haystackPosition);
+        appendSubstitutionOutput(buffer, bufferLength, &bufferPosition, &writtenLength,
+            substitutionSet->replacements[firstIndex], substitutionSet->replacementLengths[firstIndex]);
+        haystackPosition = first->index + first->length;
+        if (first->length == 0) {
+            // Always make progress past an empty match.
+            appendSubstitutionOutput(buffer, bufferLength, &bufferPosition, &writtenLength,
+                &haystack[haystackPosition], 1);
+            haystackPosition++;
+        }
+
+        first->isFound = false;
+        if (greedy == false) {
+            first->isDone = true;
+        }
+    }
+
+final:
+    // Take care of the last of the string.
+    appendSubstitutionOutput(buffer, bufferLength, &bufferPosition, &writtenLength,
+        &haystack[haystackPosition], haystackLength - haystackPosition);
+    buffer[writtenLength] = '\0';
+
+    if (writtenLength < bufferPosition) {
+        if (successful != NULL) {
+            *successful = false;
+        }
+        if ((errorMessage != NULL) && (*errorMessage == NULL)) {
+            *errorMessage
+                = "Provided output buffer too small for replaced output.";
+        }
+    }
+
+    free(matches);
+    return bufferPosition;
+}
+
 typedef struct Subexpression {
     char value[MAX_CHAR_CLASS_LENGTH];
     uint64_t length;
@@ -916,10 +1494,84 @@ static inline int getReplacements(const char *replacementString,
     return numReplacements;
 }
 
+void subexpressionRegexCompile(SubexpressionRegex *subexpressionRegex, const char *pattern) {
+    if (subexpressionRegex == NULL) return;
+    subexpressionRegex->numSubexpressions = 0;
+    subexpressionRegex->isPatternValid = true;
+    subexpressionRegex->errorMessage = "Success";
+    if (pattern == NULL) {
+        subexpressionRegex->isPatternValid = false;
+        subexpressionRegex->errorMessage = "NULL pattern string";
+        return;
+    }
+
+    Subexpression subexpressions[MAX_SUBEXPRESSIONS];
+    int numSubexpressions = getSubexpressions(pattern, subexpressions);
+    for (int ii = 0; ii < numSubexpressions; ii++) {
+        const char *pattern = subexpressions[ii].value; // shadows input parameter
+        size_t patternLength = subexpressions[ii].length;
+        bool storeMatch = false;
+        if ((pattern[0] == '\\') && (pattern[1] == '(')) {
+          pattern += 2;
+          patternLength -= 4;
+          storeMatch = true;
+        }
+
+        Regex *regex = &subexpressionRegex->regexes[ii];
+        regexCompileLength(regex, pattern, patternLength);
+        if (!regex->isPatternValid) {
+            subexpressionRegex->isPatternValid = false;
+            subexpressionRegex->errorMessage = regex->errorMessage;
+            return;
+        }
+        subexpressionRegex->storeMatch[ii] = storeMatch;
+    }
+    subexpressionRegex->numSubexpressions = numSubexpressions;
+}
+
 uint64_t substituteMatch_(const char *haystack, const char *pattern,
     const char *replacement, bool greedy,
     char *buffer, uint64_t bufferLength,
     bool *successful, const char **errorMessage, ...
+) {
+    if ((haystack == NULL) || (pattern == NULL)
+        || (replacement == NULL) || (buffer == NULL)
+    ) {
+        if (successful != NULL) {
+            *successful = false;
+        }
+        if (errorMessage != NULL) {
+            *errorMessage = "One or more NULL parameters to substituteMatch.\n";
+        }
+        return 0;
+    }
+
+    // A SubexpressionRegex is too big to put on the stack.
+    SubexpressionRegex *subexpressionRegex
+        = (SubexpressionRegex*) malloc(sizeof(SubexpressionRegex));
+    if (subexpressionRegex == NULL) {
+        if (successful != NULL) {
+            *successful = false;
+        }
+        if (errorMessage != NULL) {
+            *errorMessage = "Could not allocate memory for substituteMatch.\n";
+        }
+        return 0;
+    }
+    subexpressionRegexCompile(subexpressionRegex, pattern);
+    uint64_t bufferPosition = substituteSubexpressionRegex_(haystack,
+        subexpressionRegex, replacement, greedy, buffer, bufferLength,
+        successful, errorMessage);
+    free(subexpressionRegex);
+
+    return bufferPosition;
+}
+
+uint64_t substituteSubexpressionRegex_(const char *haystack,
+    SubexpressionRegex *subexpressionRegex,
+    const char *replacement, bool greedy,
+    char *buffer, uint64_t bufferLength,
+    bool *successful, const char **errorMessage, ...
 ) {
     uint64_t bufferPosition = 0;
     uint64_t haystackPosition = 0;
@@ -927,10 +1579,9 @@ uint64_t substituteMatch_(const char *haystack, const char *pattern,
     uint64_t copyLength = 0;
     uint64_t numIterations = 0;
     uint64_t lastMatchPosition = 0;
-    Regex regex;
     Matcher matcher;
 
-    if ((haystack == NULL) || (pattern == NULL)
+    if ((haystack == NULL) || (subexpressionRegex == NULL)
         || (replacement == NULL) || (buffer == NULL)
     ) {
         if (successful != NULL) {
@@ -943,8 +1594,7 @@ uint64_t substituteMatch_(const char *haystack, const char *pattern,
     }
     haystackLength = (uint64_t) strlen(haystack);
 
-    Subexpression subexpressions[MAX_SUBEXPRESSIONS];
-    int numSubexpressions = getSubexpressions(pattern, subexpressions);
+    int numSubexpressions = subexpressionRegex->numSubexpressions;
 
     char replacements[MAX_SUBEXPRESSIONS][MAX_CHAR_CLASS_LENGTH];
     int numReplacements = getReplacements(replacement, replacements);
@@ -955,6 +1605,16 @@ uint64_t substituteMatch_(const char *haystack, const char *pattern,
         *errorMessage = NULL;
     }
 
+    if (!subexpressionRegex->isPatternValid) {
+        if (successful != NULL) {
+            *successful = false;
+        }
+        if (errorMessage != NULL) {
+            *errorMessage = subexpressionRegex->errorMessage;
+        }
+        goto final;
+    }
+
     while ((numIterations < 1) || ((greedy == true) && (haystackPosition < haystackLength))) {
         // matches[0] will hold the entire match, so we need one more than MAX_SUBEXPRESSIONS.
         char matches[MAX_SUBEXPRESSIONS + 1][MAX_CHAR_CLASS_LENGTH];
@@ -964,27 +1624,8 @@ uint64_t substituteMatch_(const char *haystack, const char *pattern,
         // First, we need to find all the matches.
         uint64_t firstMatchPosition = 0;
         for (int ii = 0; ii < numSubexpressions; ii++) {
-            const char *pattern = subexpressions[ii].value; // shadows input parameter
-            size_t patternLength = subexpressions[ii].length;
-            bool storeMatch = false;
-            if ((pattern[0] == '\\') && (pattern[1] == '(')) {
-              pattern += 2;
-              patternLength -= 4;
-              storeMatch = true;
-            }
-
-            regexCompileLength(&regex, pattern, patternLength);
-            if (!regex.isPatternValid) {
-                if (successful != NULL) {
-                    *successful = false;
-                }
-                if (errorMessage != NULL) {
-                    *errorMessage = regex.errorMessage;
-                }
-                goto final;
-            }
-
-            regexMatchMatcher(&regex, &haystack[lastMatchPosition], &matcher);
+            bool storeMatch = subexpressionRegex->storeMatch[ii];
+            regexMatchMatcher(&subexpressionRegex->regexes[ii], &haystack[lastMatchPosition], &matcher);
             if (matcher.isFound) {
                 matcher.foundAtIndex += lastMatchPosition;
                 if (ii == 0) {
@@ -1171,3 +1812,68 @@ final:
     return bufferPosition;
 }
 
+/// @def REGEX_UNIT_TEST
+///
+/// @brief Unit tests for regex functionality.
+/// @details Implementing this as a macro instead of raw code allows this to
+/// be skipped by the code coverage metrics.
+///
+/// @return Returns true on success, false on failure.
+#define REGEX_UNIT_TEST \
+bool regexUnitTest() { \
+    Regex regex; \
+    Matcher matcher; \
+    char text[REGEX_DFA_MIN_TEXT_LENGTH * 4]; \
+    memset(text, 'a', sizeof(text) - 1); \
+    text[sizeof(text) - 1] = END_LINE; \
+ \
+    /* A trailing backslash used to leave its node unset, which the */ \
+    /* automaton for long texts then read.  Compile something with a */ \
+    /* character class first so the stale node isn't all zeros. */ \
+    const char *trailingBackslashes[] = { "a\\", "]+\\", ".wsc?2a\\", "\\" }; \
+    for (size_t ii = 0; ii < sizeof(trailingBackslashes) / sizeof(trailingBackslashes[0]); ii++) { \
+        regexCompile(&regex, "a[bc]d[ef]"); \
+        regexCompile(&regex, trailingBackslashes[ii]); \
+        if (regex.isPatternValid) { \
+            printLog(ERR, "Pattern \"%s\" with trailing backslash accepted.\n", trailingBackslashes[ii]); \
+            return false; \
+        } \
+        regexPrepareSearch(&regex); \
+        matcher = regexMatch(&regex, text); \
+        if (matcher.isFound) { \
+            printLog(ERR, "Invalid pattern \"%s\" matched.\n", trailingBackslashes[ii]); \
+            return false; \
+        } \
+    } \
+ \
+    /* Escapes that aren't at the end still work, in short and long texts. */ \
+    regexCompile(&regex, "a\\.b"); \
+    matcher = regexMatch(&regex, "xxa.b"); \
+    if (!regex.isPatternValid || !matcher.isFound || (matcher.foundAtIndex != 2) || (matcher.matchLength != 3)) { \
+        printLog(ERR, "Escaped '.' not matched in short text.\n"); \
+        return false; \
+    } \
+    memcpy(&text[sizeof(text) - 4], "a.b", 3); \
+    matcher = regexMatch(&regex, text); \
+    if (!matcher.isFound || (matcher.foundAtIndex != (int32_t) sizeof(text) - 4) || (matcher.matchLength != 3)) { \
+        printLog(ERR, "Escaped '.' not matched in long text.\n"); \
+        return false; \
+    } \
+ \
+    /* Long texts give the same results as short ones. */ \
+    regexCompile(&regex, "b\\d+$"); \
+    memcpy(&text[sizeof(text) - 4], "b12", 3); \
+    matcher = regexMatch(&regex, text); \
+    if (!matcher.isFound || (matcher.foundAtIndex != (int32_t) sizeof(text) - 4) || (matcher.matchLength != 3)) { \
+        printLog(ERR, "\"b\\d+$\" not matched at the end of a long text.\n"); \
+        return false; \
+    } \
+    matcher = regexMatch(&regex, &text[sizeof(text) - 8]); \
+    if (!matcher.isFound || (matcher.foundAtIndex != 4) || (matcher.matchLength != 3)) { \
+        printLog(ERR, "\"b\\d+$\" not matched at the end of a short text.\n"); \
+        return false; \
+    } \
+ \
+    return true; \
+}
+REGEX_UNIT_TEST
@@ -29,7 +29,10 @@
 /// @file
 
 #include "Scope.h"
+#include "CThreads.h"
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 
 #ifdef DS_LOGGING_ENABLED
 #include "LoggingLib.h"
@@ -56,6 +59,537 @@ typedef union FuncData {
   void *data;
 } FuncData;
 
+/// @def ARENA_ALIGNMENT
+///
+/// @brief The alignment of every allocation made from an Arena.
+#define ARENA_ALIGNMENT 16
+
+/// @def ARENA_CHUNK_HEADER_SIZE
+///
+/// @brief The space at the start of each chunk reserved for its ArenaChunk.
+#define ARENA_CHUNK_HEADER_SIZE \
+  ((sizeof(ArenaChunk) + ARENA_ALIGNMENT - 1) & ~((u64) ARENA_ALIGNMENT - 1))
+
+/// @var _arenaSetup
+///
+/// @brief once_flag for creating _arenaKey.
+static once_flag _arenaSetup = ONCE_FLAG_INIT;
+
+/// @var _arenaKey
+///
+/// @brief Thread-specific storage for the Arena most recently pushed on the
+/// calling thread.
+ZEROINIT(static tss_t _arenaKey);
+
+/// @var _arenaKeyValid
+///
+/// @brief Whether or not _arenaKey was successfully created.
+static bool _arenaKeyValid = false;
+
+/// @var _arenasActive
+///
+/// @brief The number of Arenas pushed on any thread.  While it is zero,
+/// arenaCurrent and arenaFind return without touching thread-specific storage,
+/// so code that never uses Arenas pays almost nothing for them.
+static u64 _arenasActive = 0;
+
+/// @fn static void arenaSetupMetadata(void)
+///
+/// @brief Create the thread-specific storage key for the active Arena.
+///
+/// @return This function returns no value.
+static void arenaSetupMetadata(void) {
+  if (tss_create(&_arenaKey, NULL) == thrd_success) {
+    _arenaKeyValid = true;
+  } else {
+    printLog(ERR, "Could not create _arenaKey.\n");
+  }
+}
+
+/// @fn static ArenaChunk* arenaAddChunk(Arena *arena, u64 minimumSize)
+///
+/// @brief Allocate a new chunk for an Arena and make it the one allocated from.
+///
+/// @param arena The Arena to add the chunk to.
+/// @param minimumSize The number of usable bytes the chunk must have.
+///
+/// @return Returns the new ArenaChunk on success, NULL on failure.
+static ArenaChunk* arenaAddChunk(Arena *arena, u64 minimumSize) {
+  u64 chunkSize = arena->chunkSize;
+  while (chunkSize < minimumSize) {
+    chunkSize <<= 1;
+  }
+  
+  ArenaChunk *chunk
+    = (ArenaChunk*) malloc(ARENA_CHUNK_HEADER_SIZE + chunkSize);
+  if (chunk == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  chunk->next = arena->chunks;
+  chunk->end = ((u8*) chunk) + ARENA_CHUNK_HEADER_SIZE + chunkSize;
+  arena->chunks = chunk;
+  arena->current = ((u8*) chunk) + ARENA_CHUNK_HEADER_SIZE;
+  // Grow geometrically so that big workloads need only a few chunks.
+  arena->chunkSize = chunkSize << 1;
+  
+  return chunk;
+}
+
+/// @fn Arena* arenaCreate(u64 initialSize)
+///
+/// @brief Create a region allocator.  Memory allocated from it is bumped off
+/// of large chunks and released all at once by arenaDestroy.
+///
+/// @param initialSize The number of bytes in the first chunk.  If 0,
+///   ARENA_DEFAULT_SIZE is used.
+///
+/// @return Returns a new Arena on success, NULL on failure.
+Arena* arenaCreate(u64 initialSize) {
+  printLog(TRACE, "ENTER arenaCreate(initialSize=%llu)\n", llu(initialSize));
+  
+  Arena *arena = (Arena*) calloc(1, sizeof(Arena));
+  if (arena == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  arena->chunkSize = (initialSize > 0) ? initialSize : ARENA_DEFAULT_SIZE;
+  if (arenaAddChunk(arena, 0) == NULL) {
+    free(arena); arena = NULL;
+  }
+  
+  printLog(TRACE, "EXIT arenaCreate(initialSize=%llu) = {%p}\n",
+    llu(initialSize), arena);
+  return arena;
+}
+
+/// @fn Arena* arenaDestroy(Arena *arena)
+///
+/// @brief Release an Arena and everything that was allocated from it.
+///
+/// @param arena The Arena to destroy.  If it is still pushed on the calling
+///   thread, it is popped first.
+///
+/// @return This function always returns NULL.
+Arena* arenaDestroy(Arena *arena) {
+  printLog(TRACE, "ENTER arenaDestroy(arena=%p)\n", arena);
+  
+  if (arena != NULL) {
+    if (arenaCurrent() == arena) {
+      arenaPop(arena);
+    }
+    ArenaChunk *chunk = arena->chunks;
+    while (chunk != NULL) {
+      ArenaChunk *next = chunk->next;
+      free(chunk);
+      chunk = next;
+    }
+    free(arena); arena = NULL;
+  }
+  
+  printLog(TRACE, "EXIT arenaDestroy(arena=%p) = {NULL}\n", arena);
+  return NULL;
+}
+
+/// @fn void* arenaAlloc(Arena *arena, u64 size)
+///
+/// @brief Allocate memory from an Arena.  The memory is aligned to
+/// ARENA_ALIGNMENT bytes and must not be passed to free.
+///
+/// @param arena The Arena to allocate from.
+/// @param size The number of bytes to allocate.
+///
+/// @return Returns a pointer to the memory on success, NULL on failure.
+void* arenaAlloc(Arena *arena, u64 size) {
+  if (arena == NULL) {
+    return NULL;
+  }
+  
+  size = (size + ARENA_ALIGNMENT - 1) & ~((u64) ARENA_ALIGNMENT - 1);
+  if ((u64) (arena->chunks->end - arena->current) < size) {
+    if (arenaAddChunk(arena, size) == NULL) {
+      return NULL;
+    }
+  }
+  
+  void *returnValue = arena->current;
+  arena->current += size;
+  return returnValue;
+}
+
+/// @fn void* arenaRealloc(Arena *arena, void *pointer, u64 oldSize, u64 newSize)
+///
+/// @brief Grow a block allocated from an Arena.  If the block is the most
+/// recent allocation and there is room, it is extended in place.  Otherwise
+/// its content is copied to a new block and the old one is reclaimed with the
+/// Arena.
+///
+/// @param arena The Arena the block was allocated from.
+/// @param pointer The block to grow.
+/// @param oldSize The size the block was allocated with.
+/// @param newSize The size the block needs to be.
+///
+/// @return Returns a pointer to the grown block on success, NULL on failure.
+void* arenaRealloc(Arena *arena, void *pointer, u64 oldSize, u64 newSize) {
+  if ((arena == NULL) || (pointer == NULL)) {
+    return arenaAlloc(arena, newSize);
+  }
+  
+  oldSize = (oldSize + ARENA_ALIGNMENT - 1) & ~((u64) ARENA_ALIGNMENT - 1);
+  u64 alignedNewSize
+    = (newSize + ARENA_ALIGNMENT - 1) & ~((u64) ARENA_ALIGNMENT - 1);
+  if ((((u8*) pointer) + oldSize == arena->current)
+    && ((u64) (arena->chunks->end - (u8*) pointer) >= alignedNewSize)
+  ) {
+    arena->current = ((u8*) pointer) + alignedNewSize;
+    return pointer;
+  }
+  
+  void *returnValue = arenaAlloc(arena, newSize);
+  if (returnValue != NULL) {
+    memcpy(returnValue, pointer, (oldSize < newSize) ? oldSize : newSize);
+  }
+  return returnValue;
+}
+
+/// @fn bool arenaOwns(const Arena *arena, const volatile void *pointer)
+///
+/// @brief Determine whether a pointer was allocated from an Arena.
+///
+/// @param arena The Arena to check.
+/// @param pointer The pointer to look for.
+///
+/// @return Returns true if pointer is inside one of arena's chunks, false if
+/// not.
+bool arenaOwns(const Arena *arena, const volatile void *pointer) {
+  if ((arena == NULL) || (pointer == NULL)) {
+    return false;
+  }
+  
+  const u8 *address = (const u8*) pointer;
+  for (const ArenaChunk *chunk = arena->chunks; chunk != NULL;
+    chunk = chunk->next
+  ) {
+    if ((address >= (const u8*) chunk) && (address < chunk->end)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// @fn Arena* arenaPush(Arena *arena)
+///
+/// @brief Make an Arena the one that Bytes objects created on the calling
+/// thread are allocated from.
+///
+/// @param arena The Arena to push.
+///
+/// @return Returns the pushed Arena on success, NULL on failure.
+Arena* arenaPush(Arena *arena) {
+  call_once(&_arenaSetup, arenaSetupMetadata);
+  if ((arena == NULL) || (_arenaKeyValid == false)) {
+    return NULL;
+  }
+  
+  arena->previous = (Arena*) tss_get(_arenaKey);
+  if (tss_set(_arenaKey, arena) != thrd_success) {
+    arena->previous = NULL;
+    return NULL;
+  }
+  __atomic_add_fetch(&_arenasActive, 1, __ATOMIC_SEQ_CST);
+  
+  return arena;
+}
+
+/// @fn Arena* arenaPop(Arena *arena)
+///
+/// @brief Restore the Arena that was active before arena was pushed.
+///
+/// @param arena The Arena to pop.  Must be the calling thread's current
+///   Arena.
+///
+/// @return Returns the Arena that is now current (possibly NULL).
+Arena* arenaPop(Arena *arena) {
+  Arena *current = arenaCurrent();
+  if ((arena == NULL) || (current != arena)) {
+    printLog(ERR, "Arena %p is not the current Arena.\n", arena);
+    return current;
+  }
+  
+  tss_set(_arenaKey, arena->previous);
+  arena->previous = NULL;
+  __atomic_sub_fetch(&_arenasActive, 1, __ATOMIC_SEQ_CST);
+  
+  return arenaCurrent();
+}
+
+/// @fn Arena* arenaCurrent(void)
+///
+/// @brief Get the calling thread's current Arena.
+///
+/// @return Returns the Arena most recently pushed on this thread, NULL if
+/// there is none.
+Arena* arenaCurrent(void) {
+  if (__atomic_load_n(&_arenasActive, __ATOMIC_RELAXED) == 0) {
+    return NULL;
+  }
+  
+  return (Arena*) tss_get(_arenaKey);
+}
+
+/// @fn Arena* arenaFind(const volatile void *pointer)
+///
+/// @brief Find which of the calling thread's pushed Arenas owns a pointer.
+///
+/// @param pointer The pointer to look for.
+///
+/// @return Returns the owning Arena if there is one, NULL otherwise.
+Arena* arenaFind(const volatile void *pointer) {
+  for (Arena *arena = arenaCurrent(); arena != NULL; arena = arena->previous) {
+    if (arenaOwns(arena, pointer)) {
+      return arena;
+    }
+  }
+  
+  return NULL;
+}
+
+/// @fn static u64 scopeSlotMapHome(const Scope *scope, const volatile void *pointer)
+///
+/// @brief Get the first slotMap bucket to probe for a pointer.
+///
+/// @param scope A pointer to a Scope object with a slotMap.
+/// @param pointer The tracked pointer to look up.
+///
+/// @return Returns the index of the pointer's home bucket.
+static inline u64 scopeSlotMapHome(const Scope *scope,
+  const volatile void *pointer
+) {
+  // Fibonacci hashing.  The low bits of heap pointers are mostly zero.
+  return ((((u64) (uintptr_t) pointer) * 0x9E3779B97F4A7C15ULL) >> 32)
+    & (scope->slotMapSize - 1);
+}
+
+/// @fn static void scopeSlotMapInsert(Scope *scope, u64 index)
+///
+/// @brief Add an entry's index to a Scope's slotMap.
+///
+/// @param scope A pointer to a Scope object with a slotMap.
+/// @param index The index of the entry in scope->entries.
+///
+/// @return This function returns no value.
+static void scopeSlotMapInsert(Scope *scope, u64 index) {
+  u64 mask = scope->slotMapSize - 1;
+  u64 bucket = scopeSlotMapHome(scope, scope->entries[index].variable);
+  while (scope->slotMap[bucket] != 0) {
+    bucket = (bucket + 1) & mask;
+  }
+  scope->slotMap[bucket] = index + 1;
+}
+
+/// @fn static u64 scopeSlotMapFind(const Scope *scope, const volatile void *pointer)
+///
+/// @brief Look up a tracked pointer in a Scope's slotMap.
+///
+/// @param scope A pointer to a Scope object with a slotMap.
+/// @param pointer The tracked pointer to look up.
+///
+/// @return Returns the index of the entry that tracks pointer, scope->numVars
+/// if it's not in the map.
+static u64 scopeSlotMapFind(const Scope *scope,
+  const volatile void *pointer
+) {
+  u64 mask = scope->slotMapSize - 1;
+  for (u64 bucket = scopeSlotMapHome(scope, pointer);
+    scope->slotMap[bucket] != 0;
+    bucket = (bucket + 1) & mask
+  ) {
+    u64 index = scope->slotMap[bucket] - 1;
+    if (scope->entries[index].variable == pointer) {
+      return index;
+    }
+  }
+  
+  return scope->numVars;
+}
+
+/// @fn static void scopeSlotMapRemove(Scope *scope, u64 index)
+///
+/// @brief Remove an entry's index from a Scope's slotMap, if it has one.
+///
+/// @details This must be called while the entry still holds the variable it
+/// was mapped under.  Uses backward-shift deletion so that no tombstones are
+/// needed in the map itself.
+///
+/// @param scope A pointer to a Scope object.
+/// @param index The index of the entry in scope->entries.
+///
+/// @return This function returns no value.
+static void scopeSlotMapRemove(Scope *scope, u64 index) {
+  if ((scope->slotMap == NULL) || (scope->entries[index].variable == NULL)) {
+    return;
+  }
+  
+  u64 mask = scope->slotMapSize - 1;
+  u64 bucket = scopeSlotMapHome(scope, scope->entries[index].variable);
+  while (scope->slotMap[bucket] != index + 1) {
+    if (scope->slotMap[bucket] == 0) {
+      // Not mapped.
+      return;
+    }
+    bucket = (bucket + 1) & mask;
+  }
+  
+  u64 next = (bucket + 1) & mask;
+  while (scope->slotMap[next] != 0) {
+    u64 home = scopeSlotMapHome(scope,
+      scope->entries[scope->slotMap[next] - 1].variable);
+    // Move the entry back into the hole unless its home lies cyclically in
+    // (bucket, next].
+    if (((next - home) & mask) >= ((next - bucket) & mask)) {
+      scope->slotMap[bucket] = scope->slotMap[next];
+      bucket = next;
+    }
+    next = (next + 1) & mask;
+  }
+  scope->slotMap[bucket] = 0;
+}
+
+/// @fn static bool scopeSlotMapRebuild(Scope *scope)
+///
+/// @brief Size a compact Scope's slotMap for its current entries and rehash
+/// them into it.
+///
+/// @param scope A pointer to a growable Scope object.
+///
+/// @return Returns true on success, false on memory allocation failure.
+static bool scopeSlotMapRebuild(Scope *scope) {
+  u64 slotMapSize = (scope->slotMapSize > 0)
+    ? scope->slotMapSize : (SCOPE_SLOT_MAP_THRESHOLD << 1);
+  while (slotMapSize < (scope->maxVars << 1)) {
+    slotMapSize <<= 1;
+  }
+  
+  u64 *slotMap = (u64*) calloc(slotMapSize, sizeof(u64));
+  if (slotMap == NULL) {
+    LOG_MALLOC_FAILURE();
+    return false;
+  }
+  free(scope->slotMap);
+  scope->slotMap = slotMap;
+  scope->slotMapSize = slotMapSize;
+  
+  for (u64 ii = 0; ii < scope->numVars; ii++) {
+    if (scope->entries[ii].variable != NULL) {
+      scopeSlotMapInsert(scope, ii);
+    }
+  }
+  
+  return true;
+}
+
+/// @fn static bool scopeGrow(Scope *scope)
+///
+/// @brief Double the capacity of a compact Scope, moving its entries from the
+/// stack to the heap the first time.
+///
+/// @param scope A pointer to a growable Scope object that is full.
+///
+/// @return Returns true on success, false on memory allocation failure.
+static bool scopeGrow(Scope *scope) {
+  u64 maxVars = scope->maxVars << 1;
+  VariableAndDestructor *entries = NULL;
+  if (scope->entries == scope->variablesAndDestructors) {
+    entries = (VariableAndDestructor*) malloc(
+      maxVars * sizeof(VariableAndDestructor));
+    if (entries != NULL) {
+      memcpy(entries, scope->entries,
+        scope->numVars * sizeof(VariableAndDestructor));
+    }
+  } else {
+    entries = (VariableAndDestructor*) realloc(scope->entries,
+      maxVars * sizeof(VariableAndDestructor));
+  }
+  if (entries == NULL) {
+    LOG_MALLOC_FAILURE();
+    return false;
+  }
+  scope->entries = entries;
+  scope->maxVars = maxVars;
+  
+  if ((scope->slotMap != NULL)
+    || (scope->numVars >= SCOPE_SLOT_MAP_THRESHOLD)
+  ) {
+    // Keep the map at most half full.  If it can't be built, fall back to
+    // scanning.
+    if (scopeSlotMapRebuild(scope) == false) {
+      free(scope->slotMap); scope->slotMap = NULL;
+      scope->slotMapSize = 0;
+    }
+  }
+  
+  return true;
+}
+
+/// @fn static u64 scopeFindIndex(const Scope *scope, const volatile void *pointer)
+///
+/// @brief Find the entry that tracks a pointer.
+///
+/// @param scope A pointer to a Scope object.
+/// @param pointer The tracked pointer to look for.
+///
+/// @return Returns the index of the entry on success, scope->numVars if the
+/// pointer is not tracked.
+static u64 scopeFindIndex(const Scope *scope, const volatile void *pointer) {
+  if (scope->slotMap != NULL) {
+    // Every non-NULL entry is mapped, so a miss means it's not tracked.
+    return scopeSlotMapFind(scope, pointer);
+  }
+  
+  u64 index = 0;
+  for (; index < scope->numVars; index++) {
+    if (scope->entries[index].variable == pointer) {
+      break;
+    }
+  }
+  return index;
+}
+
+/// @fn static void scopeRemoveIndex(Scope *scope, u64 index)
+///
+/// @brief Stop tracking the entry at an index.
+///
+/// @details Without a slotMap, the entries above the index are scooted down.
+/// With one, the entry is left as a tombstone (NULL variable and destructor)
+/// so that removal doesn't have to touch any other entry.  Tombstones at the
+/// top of the Scope are trimmed right away and the rest are skipped when the
+/// Scope is popped.
+///
+/// @param scope A pointer to a Scope object.
+/// @param index The index of the entry to remove.
+///
+/// @return This function returns no value.
+static void scopeRemoveIndex(Scope *scope, u64 index) {
+  if (scope->slotMap == NULL) {
+    // Scoot everything down.
+    u64 numVars = scope->numVars - 1; // Stop one before the last index.
+    for (; index < numVars; index++) {
+      scope->entries[index] = scope->entries[index + 1];
+    }
+    scope->numVars = numVars;
+    return;
+  }
+  
+  scopeSlotMapRemove(scope, index);
+  scope->entries[index].variable = NULL;
+  scope->entries[index].destructor = NULL;
+  while ((scope->numVars > 0)
+    && (scope->entries[scope->numVars - 1].destructor == NULL)
+  ) {
+    scope->numVars--;
+  }
+}
+
 /// @fn void* scopeAdd_(Scope *scope, volatile void *pointer, Destructor destructor, ...)
 ///
 /// @brief Add an entry to the Scope object.
@@ -102,7 +636,9 @@ void* scopeAdd_(Scope *scope, volatile void *pointer, ...) {
     return (void*) pointer;
   }
   
-  if (scope->numVars == scope->maxVars) {
+  if ((scope->numVars == scope->maxVars)
+    && ((scope->growable == false) || (scopeGrow(scope) == false))
+  ) {
     printLog(ERR, "Maximum number of variables in scope reached.\n");
     // pointer is non-NULL.  We can't track the memory, so we have to free it.
     destructor((void*) pointer); pointer = NULL;
@@ -112,9 +648,20 @@ void* scopeAdd_(Scope *scope, volatile void *pointer, ...) {
     return (void*) pointer;
   }
   
-  scope->variablesAndDestructors[scope->numVars].variable = pointer;
-  scope->variablesAndDestructors[scope->numVars].destructor = destructor;
+  scope->entries[scope->numVars].variable = pointer;
+  scope->entries[scope->numVars].destructor = destructor;
   scope->numVars++;
+  if (scope->slotMap != NULL) {
+    if (pointer != NULL) {
+      scopeSlotMapInsert(scope, scope->numVars - 1);
+    }
+  } else if ((scope->growable == true)
+    && (scope->numVars == SCOPE_SLOT_MAP_THRESHOLD)
+  ) {
+    // Big enough that scanning on removal starts to hurt.  If the map can't be
+    // built, we just keep scanning.
+    scopeSlotMapRebuild(scope);
+  }
   
   printLog(TRACE, "EXIT scopeAdd(scope=%p, pointer=%p, destructor=%p) = {%p}\n",
     scope, pointer, destructor, pointer);
@@ -145,22 +692,28 @@ void scopePop_(Scope *scope, u64 numEntries) {
     numEntries = scope->numVars;
   }
   
-  // If scope->numVars is 0, this will underflow.  However, the for loop below
-  // only iterates to a maximum of scope->numVars because of the else if above.
-  u64 maxIndex = scope->numVars - 1;
-  
-  // We bound numEntries to the size of the stack above, so no need to check for
-  // NULL nodes, just the number of iterations.
-  for (u64 iteration = 0; iteration < numEntries; iteration++) {
-    u64 index = maxIndex - iteration;
-    void *variable = (void*) scope->variablesAndDestructors[index].variable;
-    Destructor destructor = scope->variablesAndDestructors[index].destructor;
+  // numEntries is bounded by the size of the stack above, so no need to check
+  // for NULL nodes, just the number of iterations.  Tombstones left by
+  // scopeRemoveIndex aren't entries, so they're skipped without being counted.
+  u64 numVars = scope->numVars;
+  for (u64 iteration = 0; (iteration < numEntries) && (numVars > 0);) {
+    numVars--;
+    void *variable = (void*) scope->entries[numVars].variable;
+    Destructor destructor = scope->entries[numVars].destructor;
+    if (destructor == NULL) {
+      continue;
+    }
+    iteration++;
     if (variable != NULL) {
+      scopeSlotMapRemove(scope, numVars);
       destructor(variable);
     }
   }
+  while ((numVars > 0) && (scope->entries[numVars - 1].destructor == NULL)) {
+    numVars--;
+  }
   
-  scope->numVars -= numEntries;
+  scope->numVars = numVars;
   
   printLog(TRACE, "EXIT scopePop(scope=%p, numEntries=%llu)\n",
      scope, llu(numEntries));
@@ -186,16 +739,8 @@ void* scopeDestroy_(Scope *scope, volatile void *pointer) {
     return (void*) pointer;
   }
   
-  u64 numVars = scope->numVars;
-  u64 index = 0;
-  void *variable = NULL;
-  for (; index < numVars; index++) {
-    variable = (void*) scope->variablesAndDestructors[index].variable;
-    if (variable == pointer) {
-      break;
-    }
-  }
-  if (index == numVars) {
+  u64 index = scopeFindIndex(scope, pointer);
+  if (index == scope->numVars) {
     // Someone is trying to remove an entry that's not tracked by this object.
     printLog(ERR, "Removal of untracked pointer attempted.\n");
     printLog(TRACE, "EXIT scopeDestroy(scope=%p, pointer=%p) = {%p}\n",
@@ -203,19 +748,13 @@ void* scopeDestroy_(Scope *scope, volatile void *pointer) {
     return (void*) pointer;
   }
   
-  // Call the destructor.
-  Destructor destructor = scope->variablesAndDestructors[index].destructor;
+  // Stop tracking the entry, then call the destructor.
+  void *variable = (void*) scope->entries[index].variable;
+  Destructor destructor = scope->entries[index].destructor;
+  scopeRemoveIndex(scope, index);
   destructor(variable);
   pointer = NULL;
   
-  // Scoot everything down.
-  numVars--; // Stop one before the last index.
-  for (; index < numVars; index++) {
-    scope->variablesAndDestructors[index]
-      = scope->variablesAndDestructors[index + 1];
-  }
-  scope->numVars = numVars;
-  
   printLog(TRACE, "EXIT scopeDestroy(scope=%p, pointer=%p) = {NULL}\n",
     scope, pointer);
   return (void*) pointer;
@@ -251,16 +790,8 @@ void* scopeUpdate_(Scope *scope, volatile void *oldPointer, volatile void *newPo
     return (void*) oldPointer;
   }
   
-  u64 numVars = scope->numVars;
-  u64 index = 0;
-  void *variable = NULL;
-  for (; index < numVars; index++) {
-    variable = (void*) scope->variablesAndDestructors[index].variable;
-    if (variable == oldPointer) {
-      break;
-    }
-  }
-  if (index == numVars) {
+  u64 index = scopeFindIndex(scope, oldPointer);
+  if (index == scope->numVars) {
     // Someone is trying to remove an entry that's not tracked by this object.
     printLog(ERR, "Removal of untracked pointer attempted.\n");
     printLog(TRACE,
@@ -271,17 +802,15 @@ void* scopeUpdate_(Scope *scope, volatile void *oldPointer, volatile void *newPo
   
   // *DO NOT* call the destructor.
   
-  // Update the pointer the node tracks.
-  scope->variablesAndDestructors[index].variable = newPointer;
-  
   if (newPointer == NULL) {
-    // Scoot everything down.
-    numVars--; // Stop one before the last index.
-    for (; index < numVars; index++) {
-      scope->variablesAndDestructors[index]
-        = scope->variablesAndDestructors[index + 1];
+    scopeRemoveIndex(scope, index);
+  } else {
+    // Update the pointer the node tracks.
+    scopeSlotMapRemove(scope, index);
+    scope->entries[index].variable = newPointer;
+    if (scope->slotMap != NULL) {
+      scopeSlotMapInsert(scope, index);
     }
-    scope->numVars = numVars;
   }
   
   printLog(TRACE,
@@ -290,6 +819,52 @@ void* scopeUpdate_(Scope *scope, volatile void *oldPointer, volatile void *newPo
   return (void*) newPointer;
 }
 
+/// @fn Arena* scopeArena_(Scope *scope, u64 initialSize, ...)
+///
+/// @brief Attach an Arena to a Scope object.  Until the Scope ends, Bytes
+/// objects created on this thread are bump-allocated from the Arena and
+/// bytesDestroy on them is a no-op.  All of their memory is released in one
+/// shot by scopeEnd.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides ARENA_DEFAULT_SIZE if no
+/// initial size is given.
+///
+/// @note Bytes objects created while the Arena is attached must not be stored
+/// anywhere that outlives the Scope or be destroyed on another thread.
+///
+/// @param scope A pointer to the Scope object to attach the Arena to.
+/// @param initialSize The number of bytes in the Arena's first chunk.
+/// @param ... All further parameters are ignored.
+///
+/// @return Returns the Scope's Arena on success, NULL on failure.
+Arena* scopeArena_(Scope *scope, u64 initialSize, ...) {
+  printLog(TRACE, "ENTER scopeArena(scope=%p, initialSize=%llu)\n",
+    scope, llu(initialSize));
+  
+  if (scope == NULL) {
+    printLog(ERR, "Invalid Scope object.\n");
+    printLog(TRACE, "EXIT scopeArena(scope=%p, initialSize=%llu) = {NULL}\n",
+      scope, llu(initialSize));
+    return NULL;
+  } else if (scope->arena != NULL) {
+    // Already attached.
+    printLog(TRACE, "EXIT scopeArena(scope=%p, initialSize=%llu) = {%p}\n",
+      scope, llu(initialSize), scope->arena);
+    return scope->arena;
+  }
+  
+  Arena *arena = arenaCreate(initialSize);
+  if ((arena != NULL) && (arenaPush(arena) == NULL)) {
+    arena = arenaDestroy(arena);
+  }
+  scope->arena = arena;
+  
+  printLog(TRACE, "EXIT scopeArena(scope=%p, initialSize=%llu) = {%p}\n",
+    scope, llu(initialSize), arena);
+  return arena;
+}
+
 /// @fn int scopeEnd_(Scope *scope)
 ///
 /// @brief Remove all entries from the Scope object and free its resources.
@@ -307,6 +882,17 @@ int scopeEnd_(Scope *scope) {
   }
   
   scopePop_(scope, scope->numVars);
+  if (scope->entries != scope->variablesAndDestructors) {
+    free(scope->entries);
+    scope->entries = scope->variablesAndDestructors;
+  }
+  free(scope->slotMap); scope->slotMap = NULL;
+  scope->slotMapSize = 0;
+  if (scope->arena != NULL) {
+    // Everything allocated from the Arena goes away at once.
+    arenaPop(scope->arena);
+    scope->arena = arenaDestroy(scope->arena);
+  }
   
   printLog(TRACE, "EXIT scopeEnd(scope=%p) = {0}\n", scope);
   scope = NULL;
@@ -316,6 +902,109 @@ int scopeEnd_(Scope *scope) {
 #include <stdlib.h>
 #include "StringLib.h"
 
+/// @var _scopeTestDestroyed
+///
+/// @brief The number of times scopeTestDestructor has been called.
+static u64 _scopeTestDestroyed = 0;
+
+/// @fn static void scopeTestDestructor(void *pointer)
+///
+/// @brief Counting destructor used by the compact Scope tests.
+///
+/// @param pointer The pointer to free.
+///
+/// @return This function returns no value.
+static void scopeTestDestructor(void *pointer) {
+  _scopeTestDestroyed++;
+  free(pointer);
+}
+
+/// @fn static bool scopeCompactUnitTest(void)
+///
+/// @brief Exercise a compact Scope through growth, slotMap removal, updates,
+/// and pops.
+///
+/// @return Returns true on success, false on failure.
+static bool scopeCompactUnitTest(void) {
+  bool returnValue = true;
+  _scopeTestDestroyed = 0;
+  
+  scopeBeginCompact();
+  if (sizeof(_scope_) >= 1024) {
+    printLog(ERR, "Compact Scope uses %llu bytes of stack.\n",
+      llu(sizeof(_scope_)));
+    returnValue = false;
+  }
+  
+  int *pointers[1000];
+  for (int ii = 0; ii < 1000; ii++) {
+    pointers[ii] = (int*) scopeAdd(malloc(sizeof(int)), scopeTestDestructor);
+    *pointers[ii] = ii;
+  }
+  if ((_scope_.numVars != 1000) || (_scopeTestDestroyed != 0)
+    || (_scope_.slotMap == NULL)
+  ) {
+    printLog(ERR, "Compact Scope did not grow.  numVars=%llu, destroyed=%llu.\n",
+      llu(_scope_.numVars), llu(_scopeTestDestroyed));
+    returnValue = false;
+  }
+  
+  // Destroy every third pointer, working from the bottom up.
+  u64 numDestroyed = 0;
+  for (int ii = 0; ii < 1000; ii += 3) {
+    if (scopeDestroy(pointers[ii]) != NULL) {
+      printLog(ERR, "scopeDestroy(pointers[%d]) failed.\n", ii);
+      returnValue = false;
+    }
+    pointers[ii] = NULL;
+    numDestroyed++;
+  }
+  if (_scopeTestDestroyed != numDestroyed) {
+    printLog(ERR, "Expected %llu destroyed pointers, found %llu.\n",
+      llu(numDestroyed), llu(_scopeTestDestroyed));
+    returnValue = false;
+  }
+  
+  // Replace and remove some of the survivors.
+  int *replacement = (int*) malloc(sizeof(int));
+  // scopeUpdate overwrites pointers[1] and doesn't destroy what it held.
+  int *original = pointers[1];
+  scopeUpdate(pointers[1], replacement);
+  free(original); original = NULL;
+  if (scopeDestroy(replacement) != NULL) {
+    printLog(ERR, "Could not destroy an updated pointer.\n");
+    returnValue = false;
+  }
+  pointers[1] = NULL;
+  numDestroyed++;
+  scopeRemove(pointers[2]);
+  if (scopeDestroy(pointers[2]) == NULL) {
+    printLog(ERR, "Destroyed a pointer that was not tracked.\n");
+    returnValue = false;
+  }
+  free(pointers[2]); pointers[2] = NULL;
+  
+  // Pop 10 live entries.  The top entry (999) was destroyed above, so this
+  // has to skip it.
+  scopePop(10);
+  numDestroyed += 10;
+  if (_scopeTestDestroyed != numDestroyed) {
+    printLog(ERR, "Expected %llu destroyed pointers, found %llu.\n",
+      llu(numDestroyed), llu(_scopeTestDestroyed));
+    returnValue = false;
+  }
+  
+  scopeEnd();
+  // 1000 allocations, one of which was removed and freed by hand.
+  if (_scopeTestDestroyed != 999) {
+    printLog(ERR, "Expected 999 destroyed pointers, found %llu.\n",
+      llu(_scopeTestDestroyed));
+    returnValue = false;
+  }
+  
+  return returnValue;
+}
+
 bool scopeUnitTest() {
   bool returnValue = true;
   
@@ -402,7 +1091,44 @@ bool scopeUnitTest() {
   scopeRemove(myString2);
   myString2 = stringDestroy(myString2);
   
+  // Test Bytes allocation from an attached Arena.
+  Arena *arena = scopeArena(64);
+  if ((arena == NULL) || (arenaCurrent() != arena)) {
+    printLog(ERR, "scopeArena() did not make a current Arena.\n");
+    returnValue = false;
+    SCOPE_EXIT("", "%s", (returnValue == true) ? "true" : "false");
+    return returnValue;
+  }
+  
+  Bytes arenaBytes = NULL;
+  for (int ii = 0; ii < 100; ii++) {
+    bytesAddStr(&arenaBytes, "0123456789");
+  }
+  if ((bytesLength(arenaBytes) != 1000)
+    || (arenaOwns(arena, arenaBytes) == false)
+    || (strncmp((char*) &arenaBytes[990], "0123456789", 11) != 0)
+  ) {
+    printLog(ERR, "Arena Bytes object is wrong.  length=%llu.\n",
+      llu(bytesLength(arenaBytes)));
+    returnValue = false;
+    SCOPE_EXIT("", "%s", (returnValue == true) ? "true" : "false");
+    return returnValue;
+  }
+  // Destroying an Arena Bytes object is a no-op until the Scope ends.
+  arenaBytes = bytesDestroy(arenaBytes);
+  
+  if (scopeCompactUnitTest() == false) {
+    printLog(ERR, "Compact Scope test failed.\n");
+    returnValue = false;
+    SCOPE_EXIT("", "%s", (returnValue == true) ? "true" : "false");
+    return returnValue;
+  }
+  
   SCOPE_EXIT("", "%s", (returnValue == true) ? "true" : "false");
+  if (arenaCurrent() != NULL) {
+    printLog(ERR, "Arena still current after scopeEnd.\n");
+    returnValue = false;
+  }
   
   return returnValue;
 }
@@ -39,8 +39,53 @@
 #endif
 
 #include "Sockets.h"
+#include "Coroutines.h"
+#include "TimeUtils.h"
+#include "AsyncIo.h"
 #ifdef TLS_SOCKETS_ENABLED
 #include "RsaLib.h"
+#if defined(__linux__) && defined(SSL_OP_ENABLE_KTLS) \
+  && !defined(OPENSSL_NO_KTLS)
+#define TLS_KERNEL_OFFLOAD_SUPPORTED
+#endif
+#endif
+
+#ifdef _WIN32
+#include <mswsock.h>
+#include <io.h>
+#ifdef _MSC_VER
+#pragma comment (lib, "Mswsock.lib")
+#endif // _MSC_VER
+#else // POSIX
+#include <sys/uio.h>
+#include <limits.h>
+#endif // _WIN32
+
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#if defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY)
+#define SOCKET_ZEROCOPY_SUPPORTED
+#include <linux/errqueue.h>
+#endif
+#if defined(_GNU_SOURCE) && defined(MSG_WAITFORONE)
+#define SOCKET_MMSG_SUPPORTED
+#endif
+#if defined(_GNU_SOURCE) && defined(SOCK_NONBLOCK)
+#define SOCKET_ACCEPT4_SUPPORTED
+#endif
+#endif // __linux__
+
+#if defined(__linux__)
+#define SOCKET_REACTOR_EPOLL
+#define SOCKET_REACTOR_IO_URING
+#include <sys/epoll.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) \
+  || defined(__NetBSD__)
+#define SOCKET_REACTOR_KQUEUE
+#include <sys/event.h>
+#else
+// Everything else, including Windows (where poll is WSAPoll), uses poll.
+#define SOCKET_REACTOR_POLL
 #endif
 
 const char *SocketTypeNames[NUM_SOCKET_TYPES] = {
@@ -532,6 +577,369 @@ char* sslGetLastError() {
   return error;
 }
 
+// TLS context and session caches
+
+/// @def TLS_SERVER_CONTEXT_CACHE_SIZE
+///
+/// @brief The number of distinct certificate and key pairs whose server
+/// SSL_CTX objects are kept for reuse.
+#define TLS_SERVER_CONTEXT_CACHE_SIZE 16
+
+/// @def TLS_SESSION_CACHE_SIZE
+///
+/// @brief The number of remote addresses whose most recent client TLS session
+/// is kept for resumption.
+#define TLS_SESSION_CACHE_SIZE 64
+
+/// @struct TlsServerContextCacheEntry
+///
+/// @brief A server SSL_CTX that already has a certificate and key loaded.
+///
+/// @param certificate A copy of the PEM certificate the context was built from.
+/// @param key A copy of the PEM key the context was built from.
+/// @param context The configured SSL_CTX.  The cache holds one reference.
+typedef struct TlsServerContextCacheEntry {
+  char *certificate;
+  char *key;
+  SSL_CTX *context;
+} TlsServerContextCacheEntry;
+
+/// @struct TlsSessionCacheEntry
+///
+/// @brief The most recent resumable TLS session with a remote address.
+///
+/// @param address The "host:port" address the session was established with.
+/// @param session The SSL_SESSION.  The cache holds one reference.
+typedef struct TlsSessionCacheEntry {
+  char *address;
+  SSL_SESSION *session;
+} TlsSessionCacheEntry;
+
+/// @var _tlsCacheOnce
+///
+/// @brief Guard for the one-time initialization of _tlsCacheLock.
+static once_flag _tlsCacheOnce = ONCE_FLAG_INIT;
+
+/// @var _tlsCacheLock
+///
+/// @brief Lock that protects all of the TLS caches below.
+static mtx_t _tlsCacheLock;
+
+/// @var _tlsClientContext
+///
+/// @brief The SSL_CTX shared by all client sockets in the process.
+static SSL_CTX *_tlsClientContext = NULL;
+
+/// @var _tlsServerContextCache
+///
+/// @brief Server SSL_CTX objects keyed by certificate and key.
+static TlsServerContextCacheEntry
+  _tlsServerContextCache[TLS_SERVER_CONTEXT_CACHE_SIZE];
+
+/// @var _tlsServerContextCacheNext
+///
+/// @brief The next _tlsServerContextCache slot to evict when the cache is full.
+static size_t _tlsServerContextCacheNext = 0;
+
+/// @var _tlsSessionCache
+///
+/// @brief Client sessions keyed by remote address.
+static TlsSessionCacheEntry _tlsSessionCache[TLS_SESSION_CACHE_SIZE];
+
+/// @var _tlsSessionCacheNext
+///
+/// @brief The next _tlsSessionCache slot to evict when the cache is full.
+static size_t _tlsSessionCacheNext = 0;
+
+/// @fn static void tlsCacheInit(void)
+///
+/// @brief Initialize _tlsCacheLock.  Called exactly once via call_once.
+///
+/// @return This function returns no value.
+static void tlsCacheInit(void) {
+  mtx_init(&_tlsCacheLock, mtx_plain);
+}
+
+/// @fn static int tlsSessionCacheNewSession(SSL *ssl, SSL_SESSION *session)
+///
+/// @brief OpenSSL callback that's called whenever a client connection receives
+/// a new resumable session (including TLS 1.3 tickets that arrive after the
+/// handshake).  Stores the session under the connection's address.
+///
+/// @param ssl The client connection.  Its app data is the address string.
+/// @param session The new session.
+///
+/// @return Returns 1 if the cache took the reference to session, 0 otherwise.
+static int tlsSessionCacheNewSession(SSL *ssl, SSL_SESSION *session) {
+  const char *address = (const char*) SSL_get_app_data(ssl);
+  if (address == NULL) {
+    return 0;
+  }
+  
+  mtx_lock(&_tlsCacheLock);
+  TlsSessionCacheEntry *entry = NULL;
+  for (size_t ii = 0; ii < TLS_SESSION_CACHE_SIZE; ii++) {
+    if ((_tlsSessionCache[ii].address != NULL)
+      && (strcmp(_tlsSessionCache[ii].address, address) == 0)
+    ) {
+      entry = &_tlsSessionCache[ii];
+      break;
+    }
+  }
+  if (entry == NULL) {
+    char *addressCopy = strdup(address);
+    if (addressCopy == NULL) {
+      mtx_unlock(&_tlsCacheLock);
+      LOG_MALLOC_FAILURE();
+      return 0;
+    }
+    entry = &_tlsSessionCache[_tlsSessionCacheNext];
+    _tlsSessionCacheNext
+      = (_tlsSessionCacheNext + 1) % TLS_SESSION_CACHE_SIZE;
+    free(entry->address); entry->address = addressCopy;
+  }
+  if (entry->session != NULL) {
+    SSL_SESSION_free(entry->session);
+  }
+  entry->session = session;
+  mtx_unlock(&_tlsCacheLock);
+  
+  return 1;
+}
+
+/// @fn static void tlsSessionCacheApply(BIO *bio, const char *address)
+///
+/// @brief Prepare a client connection for session resumption:  Tag it with
+/// its address so that new sessions are cached, and offer the cached session
+/// for the address, if any, in the upcoming handshake.
+///
+/// @param bio The SSL BIO of the client connection.
+/// @param address The "host:port" address being connected to.  Must remain
+///   valid for the lifetime of the connection.
+///
+/// @return This function returns no value.
+static void tlsSessionCacheApply(BIO *bio, const char *address) {
+  SSL *ssl = NULL;
+  BIO_get_ssl(bio, &ssl);
+  if (ssl == NULL) {
+    return;
+  }
+  SSL_set_app_data(ssl, (void*) address);
+  
+  mtx_lock(&_tlsCacheLock);
+  for (size_t ii = 0; ii < TLS_SESSION_CACHE_SIZE; ii++) {
+    if ((_tlsSessionCache[ii].address != NULL)
+      && (strcmp(_tlsSessionCache[ii].address, address) == 0)
+    ) {
+      // SSL_set_session takes its own reference.
+      SSL_set_session(ssl, _tlsSessionCache[ii].session);
+      break;
+    }
+  }
+  mtx_unlock(&_tlsCacheLock);
+  
+  return;
+}
+
+/// @fn static SSL_CTX* tlsClientContextGet(const SSL_METHOD *method)
+///
+/// @brief Get the process-wide client SSL_CTX, creating it on first use.
+///
+/// @param method The TLS method to create the context with, if it has to be
+///   created.
+///
+/// @return Returns a new reference to the shared client context, which the
+/// caller must release with SSL_CTX_free, on success.  Returns NULL on
+/// failure.
+static SSL_CTX* tlsClientContextGet(const SSL_METHOD *method) {
+  call_once(&_tlsCacheOnce, tlsCacheInit);
+  
+  mtx_lock(&_tlsCacheLock);
+  if (_tlsClientContext == NULL) {
+    _tlsClientContext = SSL_CTX_new(method);
+    if (_tlsClientContext != NULL) {
+      SSL_CTX_set_session_cache_mode(_tlsClientContext,
+        SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+      SSL_CTX_sess_set_new_cb(_tlsClientContext, tlsSessionCacheNewSession);
+    }
+  }
+  SSL_CTX *sslContext = _tlsClientContext;
+  if (sslContext != NULL) {
+    SSL_CTX_up_ref(sslContext);
+  }
+  mtx_unlock(&_tlsCacheLock);
+  
+  return sslContext;
+}
+
+/// @fn static SSL_CTX* tlsServerContextCacheGet(const char *certificate, const char *key)
+///
+/// @brief Look up a cached server SSL_CTX for a certificate and key pair.
+///
+/// @param certificate The content of a PEM file for an X509 certificate.
+/// @param key The content of a PEM file for an RSA private key.
+///
+/// @return Returns a new reference to the cached context, which the caller
+/// must release with SSL_CTX_free, if it's found.  Returns NULL otherwise.
+static SSL_CTX* tlsServerContextCacheGet(const char *certificate,
+  const char *key
+) {
+  call_once(&_tlsCacheOnce, tlsCacheInit);
+  
+  SSL_CTX *sslContext = NULL;
+  mtx_lock(&_tlsCacheLock);
+  for (size_t ii = 0; ii < TLS_SERVER_CONTEXT_CACHE_SIZE; ii++) {
+    TlsServerContextCacheEntry *entry = &_tlsServerContextCache[ii];
+    if ((entry->context != NULL) && (strcmp(entry->key, key) == 0)
+      && (strcmp(entry->certificate, certificate) == 0)
+    ) {
+      sslContext = entry->context;
+      SSL_CTX_up_ref(sslContext);
+      break;
+    }
+  }
+  mtx_unlock(&_tlsCacheLock);
+  
+  return sslContext;
+}
+
+/// @fn static void tlsServerContextCacheAdd(const char *certificate, const char *key, SSL_CTX *sslContext)
+///
+/// @brief Add a configured server SSL_CTX to the cache.  The cache takes its
+/// own reference; the caller keeps theirs.
+///
+/// @param certificate The content of the PEM certificate loaded in sslContext.
+/// @param key The content of the PEM key loaded in sslContext.
+/// @param sslContext The configured SSL_CTX.
+///
+/// @return This function returns no value.
+static void tlsServerContextCacheAdd(const char *certificate, const char *key,
+  SSL_CTX *sslContext
+) {
+  char *certificateCopy = strdup(certificate);
+  char *keyCopy = strdup(key);
+  if ((certificateCopy == NULL) || (keyCopy == NULL)) {
+    LOG_MALLOC_FAILURE();
+    free(certificateCopy); certificateCopy = NULL;
+    free(keyCopy); keyCopy = NULL;
+    return;
+  }
+  
+  // Sessions are only resumed with contexts that have the same ID context.
+  SSL_CTX_set_session_id_context(sslContext,
+    (const unsigned char*) "Sockets", 7);
+  SSL_CTX_up_ref(sslContext);
+  
+  mtx_lock(&_tlsCacheLock);
+  TlsServerContextCacheEntry *entry
+    = &_tlsServerContextCache[_tlsServerContextCacheNext];
+  _tlsServerContextCacheNext
+    = (_tlsServerContextCacheNext + 1) % TLS_SERVER_CONTEXT_CACHE_SIZE;
+  SSL_CTX *evictedContext = entry->context;
+  free(entry->certificate); entry->certificate = certificateCopy;
+  free(entry->key); entry->key = keyCopy;
+  entry->context = sslContext;
+  mtx_unlock(&_tlsCacheLock);
+  
+  if (evictedContext != NULL) {
+    // Sockets still using it hold their own references.
+    SSL_CTX_free(evictedContext);
+  }
+  
+  return;
+}
+
+/// @fn void tlsContextCacheClear(void)
+///
+/// @brief Release all cached TLS contexts and sessions.  Sockets that are
+/// already configured keep working since they hold their own references.
+/// Use this when certificates are rotated or upstream sessions should not be
+/// resumed.
+///
+/// @return This function returns no value.
+void tlsContextCacheClear(void) {
+  printLog(TRACE, "ENTER tlsContextCacheClear()\n");
+  
+  call_once(&_tlsCacheOnce, tlsCacheInit);
+  
+  mtx_lock(&_tlsCacheLock);
+  for (size_t ii = 0; ii < TLS_SERVER_CONTEXT_CACHE_SIZE; ii++) {
+    TlsServerContextCacheEntry *entry = &_tlsServerContextCache[ii];
+    free(entry->certificate); entry->certificate = NULL;
+    free(entry->key); entry->key = NULL;
+    if (entry->context != NULL) {
+      SSL_CTX_free(entry->context); entry->context = NULL;
+    }
+  }
+  _tlsServerContextCacheNext = 0;
+  for (size_t ii = 0; ii < TLS_SESSION_CACHE_SIZE; ii++) {
+    TlsSessionCacheEntry *entry = &_tlsSessionCache[ii];
+    free(entry->address); entry->address = NULL;
+    if (entry->session != NULL) {
+      SSL_SESSION_free(entry->session); entry->session = NULL;
+    }
+  }
+  _tlsSessionCacheNext = 0;
+  if (_tlsClientContext != NULL) {
+    SSL_CTX_free(_tlsClientContext); _tlsClientContext = NULL;
+  }
+  mtx_unlock(&_tlsCacheLock);
+  
+  printLog(TRACE, "EXIT tlsContextCacheClear()\n");
+  return;
+}
+
+/// @var _tlsKernelOffload
+///
+/// @brief Whether or not new TLS connections ask OpenSSL to hand record
+/// encryption to the kernel (kTLS) after the handshake.
+static bool _tlsKernelOffload = false;
+
+/// @fn void tlsSetKernelOffload(bool enabled)
+///
+/// @brief Enable or disable kernel TLS offload for TLS connections created
+/// after this call.  When enabled and supported by both OpenSSL and the
+/// kernel, the symmetric keys are installed in the socket once the handshake
+/// completes, so socketSend and socketReceive no longer copy data through
+/// OpenSSL's buffers and socketSendFile sends encrypted files without reading
+/// them into user space.  Connections silently stay in user space when
+/// offload isn't available for the negotiated cipher.
+///
+/// @param enabled Whether or not to request kernel TLS offload.
+///
+/// @return This function returns no value.
+void tlsSetKernelOffload(bool enabled) {
+  _tlsKernelOffload = enabled;
+}
+
+/// @fn bool tlsKernelOffload(void)
+///
+/// @brief Determine whether or not kernel TLS offload is requested for new
+/// TLS connections.
+///
+/// @return Returns the value last passed to tlsSetKernelOffload.
+bool tlsKernelOffload(void) {
+  return _tlsKernelOffload;
+}
+
+/// @fn static void tlsApplyKernelOffload(SSL *ssl)
+///
+/// @brief Request kernel TLS offload on a connection that hasn't completed its
+/// handshake yet, if it's enabled.
+///
+/// @param ssl The connection to configure.
+///
+/// @return This function returns no value.
+static void tlsApplyKernelOffload(SSL *ssl) {
+#ifdef TLS_KERNEL_OFFLOAD_SUPPORTED
+  if ((ssl != NULL) && (_tlsKernelOffload == true)) {
+    SSL_set_options(ssl, SSL_OP_ENABLE_KTLS);
+  }
+#else
+  (void) ssl;
+#endif // TLS_KERNEL_OFFLOAD_SUPPORTED
+}
+
 /// @fn int configureTlsServerSocket(Socket *sock, const char *certificate, const char *key)
 ///
 /// @brief Configure a SERVER socket for use with TLS.
@@ -561,8 +969,19 @@ int configureTlsServerSocket(Socket *sock,
     printLog(DEBUG, "key = \"%s\"\n", key);
   }
   
+  SSL_CTX *sslContext = tlsServerContextCacheGet(certificate, key);
+  if (sslContext != NULL) {
+    // Already parsed and validated.
+    sock->sslContext = sslContext;
+    _tlsSocketsEnabled = true;
+    printLog(TRACE,
+      "EXIT configureTlsServerSocket(sock=%s, certificate=%s, key=%s) = {%d}\n",
+      socketToString(sock), certificate, key, 0);
+    return 0;
+  }
+  
   const SSL_METHOD *method = TLS_server_method();
-  SSL_CTX *sslContext = SSL_CTX_new(method);
+  sslContext = SSL_CTX_new(method);
   if (sslContext == NULL) {
     // SSL is completely unconfigured, so we can't use sslGetLastError here.
     printLog(ERR, "Unable to create SSL context.\n");
@@ -627,6 +1046,7 @@ int configureTlsServerSocket(Socket *sock,
   }
   EVP_PKEY_free(rsaKey); rsaKey = NULL;
   
+  tlsServerContextCacheAdd(certificate, key, sslContext);
   sock->sslContext = sslContext;
   _tlsSocketsEnabled = true;
   
@@ -666,8 +1086,18 @@ bool tlsKeyAndCertificateValid(const char *certificate, const char *key) {
     return returnValue; // false
   }
   
+  SSL_CTX *sslContext = tlsServerContextCacheGet(certificate, key);
+  if (sslContext != NULL) {
+    // This pair was already parsed and validated.
+    SSL_CTX_free(sslContext); sslContext = NULL;
+    printLog(TRACE,
+      "EXIT tlsKeyAndCertificateValid(certificate=%s, key=%s) = {%s}\n",
+      certificate, key, boolNames[returnValue]);
+    return returnValue; // true
+  }
+  
   const SSL_METHOD *method = TLS_server_method();
-  SSL_CTX *sslContext = SSL_CTX_new(method);
+  sslContext = SSL_CTX_new(method);
   if (sslContext == NULL) {
     // SSL is completely unconfigured, so we can't use sslGetLastError here.
     printLog(ERR, "Unable to create SSL context.\n");
@@ -735,6 +1165,9 @@ bool tlsKeyAndCertificateValid(const char *certificate, const char *key) {
     return returnValue; // false
   }
   EVP_PKEY_free(rsaKey); rsaKey = NULL;
+  // Keep the validated context so that configuring a socket with this pair
+  // doesn't have to parse it again.
+  tlsServerContextCacheAdd(certificate, key, sslContext);
   SSL_CTX_free(sslContext); sslContext = NULL;
   
   _tlsSocketsEnabled = true;
@@ -749,7 +1182,7 @@ bool tlsKeyAndCertificateValid(const char *certificate, const char *key) {
 
 // SocketType helper functions.
 
-/// @fn Socket* createServerSocket(SocketProtocol socketProtocol, const char *address, SocketMode socketMode, const char *certificate, const char *key)
+/// @fn Socket* createServerSocket(SocketProtocol socketProtocol, const char *address, SocketMode socketMode, const char *certificate, const char *key, bool reusePort)
 ///
 /// @brief Create a server socket with the specified mode.
 ///
@@ -760,11 +1193,15 @@ bool tlsKeyAndCertificateValid(const char *certificate, const char *key) {
 ///   socketMode is SECURE, NULL otherwise.
 /// @param key The content of a PEM file for an RSA private key if socketMode
 ///   is SECURE, NULL otherwise.
+/// @param reusePort Whether or not to set SO_REUSEPORT on a TCP socket so that
+///   other sockets can listen on the same address.  The socket is made
+///   non-blocking in this case.
 ///
 /// @return Returns a newly allocated and opened socket on success,
 /// NULL on failure.
 Socket* createServerSocket(SocketProtocol socketProtocol, const char *address,
-  SocketMode socketMode, const char *certificate, const char *key
+  SocketMode socketMode, const char *certificate, const char *key,
+  bool reusePort
 ) {
   (void) certificate; // In case logging isn't enabled.
   (void) key; // In case logging isn't enabled.
@@ -859,6 +1296,20 @@ Socket* createServerSocket(SocketProtocol socketProtocol, const char *address,
     ) {
       printLog(WARN, "Could not set socket to allow for reusing address.\n");
     }
+    if (reusePort == true) {
+#ifdef SO_REUSEPORT
+      if (setsockopt(sockfd, SOL_SOCKET, SO_REUSEPORT, (char*) &optionValue,
+        sizeof(optionValue)) < 0
+      ) {
+        printLog(ERR, "Could not set socket to allow for reusing port: %s\n",
+          strerror(errno));
+        rawSocketClose(sockfd); sockfd = -1;
+      }
+#else
+      printLog(ERR, "SO_REUSEPORT is not supported on this system.\n");
+      rawSocketClose(sockfd); sockfd = -1;
+#endif // SO_REUSEPORT
+    }
   } else if (socketProtocol == UDP) {
     sockfd = socket(AF_INET, SOCK_DGRAM, 0);
   }
@@ -885,6 +1336,7 @@ Socket* createServerSocket(SocketProtocol socketProtocol, const char *address,
     sizeof(returnValue->sockaddr)) < 0
   ) {
     printLog(ERR, "Error binding socket.  (Are you root?)\n");
+    rawSocketClose(sockfd);
     mtx_destroy(&returnValue->lock);
     returnValue->address = stringDestroy(returnValue->address);
     returnValue = (Socket*) pointerDestroy(returnValue);
@@ -943,6 +1395,12 @@ Socket* createServerSocket(SocketProtocol socketProtocol, const char *address,
   returnValue->address = stringDestroy(returnValue->address);
   straddstr(&returnValue->address, address);
   
+  if (reusePort == true) {
+    // Listeners that share a port are drained with socketAcceptBatch, which
+    // must never block.
+    socketSetNonblocking(returnValue);
+  }
+  
   printLog(TRACE,
     "EXIT createServerSocket(socketProtocol=%s, address=%s, socketMode=%s, "
     "certificate=%p, key=%p) = {%p}\n",
@@ -1018,7 +1476,7 @@ int configureTlsClientSocket(Socket *sock, int timeoutMilliseconds) {
     return -2;
   }
   
-  SSL_CTX *sslContext = SSL_CTX_new(method);
+  SSL_CTX *sslContext = tlsClientContextGet(method);
   if (sslContext == NULL) {
     printLog(ERR, "Could not get SSL context.\n");
     char* error = sslGetLastError();
@@ -1112,6 +1570,10 @@ int configureTlsClientSocket(Socket *sock, int timeoutMilliseconds) {
     bio = BIO_push(sslBio, socketBio);
   }
   SSL_CTX_free(sslContext);
+  tlsSessionCacheApply(bio, sock->address);
+  SSL *ssl = NULL;
+  BIO_get_ssl(bio, &ssl);
+  tlsApplyKernelOffload(ssl);
   
   if (sock->socketProtocol == TCP) {
     SslBioHandshakeWatchArgs *sslBioHandshakeWatchArgs
@@ -1495,7 +1957,7 @@ Socket* socketCreate_(SocketType socketType, SocketProtocol socketProtocol,
   Socket *socket = NULL;
   if (socketType == SERVER) {
     socket = createServerSocket(socketProtocol, address,
-      (SocketMode) socketMode, certificate, key);
+      (SocketMode) socketMode, certificate, key, false);
   } else if (socketType == CLIENT) {
     socket = createClientSocket(socketProtocol, address,
       (SocketMode) socketMode,
@@ -1544,6 +2006,58 @@ Socket* socketCreate_(SocketType socketType, SocketProtocol socketProtocol,
   return socket;
 }
 
+/// @fn Socket* socketCreateReusePort_(const char *address, int socketMode, const char *certificate, const char *key, ...)
+///
+/// @brief Create a non-blocking TCP server socket that shares its address with
+/// other sockets created the same way.  The intended use is one listener per
+/// worker thread:  The kernel spreads incoming connections across the
+/// listeners, so each worker accepts (with socketAcceptBatch) and serves its
+/// own connections without contending on a single accept queue.
+///
+/// @param address The IP address and port to bind to.
+/// @param socketMode Either PLAIN or TLS.
+/// @param certificate The content of a PEM file for an X509 certificate if
+///   socketMode is TLS, NULL otherwise.
+/// @param key The content of a PEM file for an RSA private key if socketMode
+///   is TLS, NULL otherwise.
+/// @param ... Any addtional parameters (provided by the wrapper macro) are
+///   ignored.
+///
+/// @note SO_REUSEPORT only spreads connections across listeners on Linux.
+/// Elsewhere the listeners may still be created but one of them may get every
+/// connection.  Creation fails where SO_REUSEPORT doesn't exist (Windows).
+///
+/// @return Returns a new instance of a Socket type on success, NULL on failure.
+Socket* socketCreateReusePort_(const char *address, int socketMode,
+  const char *certificate, const char *key, ...
+) {
+  printLog(TRACE,
+    "ENTER socketCreateReusePort(address=%s, socketMode=%d, certificate=%p, "
+    "key=%p)\n", (address != NULL) ? address : "NULL", socketMode,
+    (void*) certificate, (void*) key);
+  
+  Socket *socket = NULL;
+  if (rawSocketsInit() != 0) {
+    printLog(ERR, "rawSocketsInit failed.  Cannot create socket.\n");
+  } else if ((address == NULL) || (socketMode < 0)
+    || (socketMode >= NUM_SOCKET_MODES)
+  ) {
+    printLog(ERR, "Invalid address or socketMode.\n");
+  } else {
+    socket = createServerSocket(TCP, address, (SocketMode) socketMode,
+      certificate, key, true);
+  }
+  if (socket != NULL) {
+    updateSocketString(socket);
+  }
+  
+  printLog(TRACE,
+    "EXIT socketCreateReusePort(address=%s, socketMode=%d, certificate=%p, "
+    "key=%p) = {%p}\n", (address != NULL) ? address : "NULL", socketMode,
+    (void*) certificate, (void*) key, (void*) socket);
+  return socket;
+}
+
 /// @fn void getIpAddress(char **address)
 ///
 /// @brief If the user provides us a host name then we need to convert it to an
@@ -1785,6 +2299,61 @@ Socket* socketDestroy(Socket *sock) {
   return NULL;
 }
 
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+/// @fn static void socketZeroCopyWait(Socket *sock, uint32_t numSends)
+///
+/// @brief Wait for the kernel to report that it's done with the buffers of
+/// the last numSends MSG_ZEROCOPY sends on a socket.  Must be called with the
+/// socket's lock held.
+///
+/// @param sock The Socket the sends were made on.
+/// @param numSends The number of successful MSG_ZEROCOPY sends to wait for.
+///
+/// @return This function returns no value.
+static void socketZeroCopyWait(Socket *sock, uint32_t numSends) {
+  uint32_t numCompleted = 0;
+  while (numCompleted < numSends) {
+    // Completions are reported on the socket's error queue, which poll reports
+    // as POLLERR regardless of the requested events.
+    ZEROINIT(struct pollfd pollDescriptor);
+    pollDescriptor.fd = sock->sockfd;
+    if ((poll(&pollDescriptor, 1, -1) < 0) && (errno != EINTR)) {
+      break;
+    }
+    
+    char control[128];
+    ZEROINIT(struct msghdr message);
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    if (recvmsg(sock->sockfd, &message, MSG_ERRQUEUE) < 0) {
+      if (((errno == EAGAIN) || (errno == EINTR))
+        && ((pollDescriptor.revents & (POLLHUP | POLLNVAL)) == 0)
+      ) {
+        continue;
+      }
+      printLog(WARN, "Gave up waiting for zero-copy completions: %s\n",
+        strerror(errno));
+      break;
+    }
+    
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&message); cmsg != NULL;
+      cmsg = CMSG_NXTHDR(&message, cmsg)
+    ) {
+      struct sock_extended_err *error
+        = (struct sock_extended_err*) CMSG_DATA(cmsg);
+      if ((error->ee_errno == 0)
+        && (error->ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+      ) {
+        // ee_info through ee_data is the inclusive range of completed sends.
+        numCompleted += error->ee_data - error->ee_info + 1;
+      }
+    }
+  }
+  
+  return;
+}
+#endif // SOCKET_ZEROCOPY_SUPPORTED
+
 /// @fn int socketSend(Socket *sock, const volatile void *buf, int len)
 ///
 /// @brief Send the provided data to the specified socket.
@@ -1828,11 +2397,24 @@ int socketSend(Socket *sock, const volatile void *buf, int len) {
     printLog(ERR, "Could not put socket in blocking mode.\n");
   }
   
+  int sendFlags = flags;
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+  uint32_t numZeroCopySends = 0;
+  if ((sock->zeroCopy == true) && (len >= SOCKET_ZEROCOPY_MIN_LENGTH)) {
+    sendFlags |= MSG_ZEROCOPY;
+  }
+#endif // SOCKET_ZEROCOPY_SUPPORTED
+
   mtx_lock(&sock->lock);
   if ((sock->socketProtocol == TCP) && (sock->tcpConnected == true)) {
     while (len > 0) {
         if (sock->socketMode == PLAIN) {
-          bytesSent = send(sock->sockfd, bufferPointer, len, flags);
+          bytesSent = send(sock->sockfd, bufferPointer, len, sendFlags);
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+          if ((bytesSent > 0) && (sendFlags & MSG_ZEROCOPY)) {
+            numZeroCopySends++;
+          }
+#endif // SOCKET_ZEROCOPY_SUPPORTED
 #ifdef TLS_SOCKETS_ENABLED
         } else if ((sock->socketMode == TLS)
           && (sock->socketType == CLIENT) && (sock->sslBio != NULL)
@@ -1877,6 +2459,10 @@ int socketSend(Socket *sock, const volatile void *buf, int len) {
         len -= bytesSent;
     }
   }
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+  // The caller owns buf again as soon as we return.
+  socketZeroCopyWait(sock, numZeroCopySends);
+#endif // SOCKET_ZEROCOPY_SUPPORTED
   mtx_unlock(&sock->lock);
   
   if (bytesSent > 0) {
@@ -1927,6 +2513,50 @@ typedef struct SslAcceptWatchArgs {
   int timeoutMilliseconds;
 } SslAcceptWatchArgs;
 
+/// @fn bool socketJsonWriterSink(void *sock, const volatile void *data, u64 length)
+///
+/// @brief JsonWriterSink that sends a JsonWriter's output over a Socket.  Use
+/// jsonWriterInitSocket to set one up.
+///
+/// @param sock The Socket to send to, cast to a void*.
+/// @param data The data to send.
+/// @param length The number of bytes at data.
+///
+/// @return Returns true if all of the data was sent, false otherwise.
+bool socketJsonWriterSink(void *sock, const volatile void *data, u64 length) {
+  const char *bufferPointer = (const char*) data;
+  while (length > 0) {
+    // socketSend takes an int, so send very large runs in pieces.
+    int chunkLength = (length > (1U << 30)) ? (1 << 30) : (int) length;
+    if (socketSend((Socket*) sock, bufferPointer, chunkLength)
+      != chunkLength
+    ) {
+      return false;
+    }
+    bufferPointer += chunkLength;
+    length -= chunkLength;
+  }
+  
+  return true;
+}
+
+/// @fn i64 socketXmlReaderSource(void *sock, void *buffer, u64 length)
+///
+/// @brief XmlReaderSource that reads an XmlReader's input from a Socket.  Use
+/// xmlReaderInitSocket to set one up.  Blocks until data arrives.
+///
+/// @param sock The Socket to receive from, cast to a void*.
+/// @param buffer The buffer to receive into.
+/// @param length The number of bytes available at buffer.
+///
+/// @return Returns the number of bytes received, 0 if the connection was
+/// closed, or a negative value on error.
+i64 socketXmlReaderSource(void *sock, void *buffer, u64 length) {
+  // socketReceive takes an int, so receive very large buffers in pieces.
+  int chunkLength = (length > (1U << 30)) ? (1 << 30) : (int) length;
+  return socketReceive((Socket*) sock, buffer, chunkLength);
+}
+
 /// @fn int sslAcceptWatch(void *args)
 ///
 /// @brief Thread that watches for a connection to be established.  Forcibly
@@ -2195,224 +2825,3023 @@ int socketReceive_(Socket *sock, volatile void *buf, int len,
   return bytesReceived;
 }
 
-/// @fn Socket* socketAccept_(Socket *serverSocket, void *buf, int len, ...)
+/// @def SOCKET_IOV_MAX
 ///
-/// @brief Accept an incoming TCP client connection on a SERVER socket.
+/// @brief The maximum number of buffers passed to the operating system in one
+/// scatter/gather call.  Longer arrays are sent in multiple calls.
+#define SOCKET_IOV_MAX 64
+
+#ifdef _WIN32
+typedef WSABUF SocketRawIoVector;
+#define socketRawIoVectorSet(rawVector, pointer, size) \
+  ((rawVector)->buf = (CHAR*) (pointer), (rawVector)->len = (ULONG) (size))
+#else // POSIX
+typedef struct iovec SocketRawIoVector;
+#define socketRawIoVectorSet(rawVector, pointer, size) \
+  ((rawVector)->iov_base = (void*) (pointer), (rawVector)->iov_len = (size))
+#endif // _WIN32
+
+/// @fn static int socketFillRawIoVectors(SocketRawIoVector *rawVectors, const SocketIoVector *vectors, int numVectors, size_t offset)
 ///
-/// @param serverSocket The Socket to accept a connection from.
+/// @brief Convert up to SOCKET_IOV_MAX SocketIoVectors into the operating
+/// system's representation, skipping bytes that have already been handled.
 ///
-/// @param Returns a Socket of the client connection on success,
-/// NULL on failure.
-Socket* socketAccept_(Socket *serverSocket, void *buf, int len, ...) {
-  printLog(TRACE, "ENTER socketAccept(serverSocket=%s, buf=%p, len=%d)\n",
-    socketToString(serverSocket), (void*) buf, len);
-  
-  if (serverSocket == NULL) {
-    printLog(ERR, "serverSocket is NULL.\n");
-    printLog(TRACE,
-      "EXIT socketAccept(serverSocket=NULL, buf=%p, len=%d) = {NULL}\n",
-      (void*) buf, len);
-    return NULL;
-  } else if (serverSocket->socketType != SERVER) {
-    printLog(ERR, "Socket is not a SERVER socket.\n");
-    printLog(TRACE,
-      "EXIT socketAccept(serverSocket=%s, buf=%p, len=%d) = {NULL}\n",
-      socketToString(serverSocket), (void*) buf, len);
-    return NULL;
-  } else if ((serverSocket->socketProtocol == UDP) 
-    && ((buf == NULL) || (len == 0))
+/// @param rawVectors The array of SOCKET_IOV_MAX operating system vectors to
+///   fill in.
+/// @param vectors The array of SocketIoVectors to convert.
+/// @param numVectors The number of elements in vectors.
+/// @param offset The number of bytes at the start of vectors to skip.
+///
+/// @return Returns the number of elements of rawVectors filled in.
+static int socketFillRawIoVectors(SocketRawIoVector *rawVectors,
+  const SocketIoVector *vectors, int numVectors, size_t offset
+) {
+  int numRawVectors = 0;
+  for (int ii = 0; (ii < numVectors) && (numRawVectors < SOCKET_IOV_MAX);
+    ii++
   ) {
-    printLog(ERR, "Socket is a UDP socket and extra parameters are missing.\n");
-    printLog(TRACE,
-      "EXIT socketAccept(serverSocket=%s, buf=%p, len=%d) = {NULL}\n",
-      socketToString(serverSocket), (void*) buf, len);
-    return NULL;
+    if (offset >= vectors[ii].length) {
+      offset -= vectors[ii].length;
+      continue;
+    }
+    socketRawIoVectorSet(&rawVectors[numRawVectors],
+      ((char*) vectors[ii].base) + offset, vectors[ii].length - offset);
+    offset = 0;
+    numRawVectors++;
   }
   
-  SocketType socketType = serverSocket->socketType;
-  SocketProtocol socketProtocol = serverSocket->socketProtocol;
-  SocketMode socketMode = serverSocket->socketMode;
-  int sockfd = serverSocket->sockfd;
-#ifdef TLS_SOCKETS_ENABLED
-  SSL *clientSsl = NULL;
-  if ((socketMode == TLS) && (tlsSocketsEnabled() == true)) {
-    // We want to avoid segfaults.  At this point in the function, we're pretty
-    // much guaranteed that the socket still exists, as does its sslContext.
-    // However, after the accept() call, that may no longer be true because the
-    // expected use model is that to end an acccept, the socket is destroyed.
-    // So, we can't create a client's SSL object after the accept, we have to
-    // go ahead and create it now.  If we don't need it, we'll delete it, but
-    // if we do, we can just attach it to the client socket when it's created
-    // after the accept().
-    clientSsl = SSL_new(serverSocket->sslContext);
-    if (clientSsl == NULL) {
-      // Out of memory.
-      printLog(TRACE,
-        "EXIT socketAccept(serverSocket=%s, buf=%p, len=%d) = {NULL}\n",
-        socketToString(serverSocket), (void*) buf, len);
-      return NULL;
+  return numRawVectors;
+}
+
+/// @fn int socketSendv(Socket *sock, const SocketIoVector *vectors, int numVectors)
+///
+/// @brief Send the data in an array of buffers to the specified socket as
+/// though it were one contiguous buffer.  Plain sockets hand the whole array
+/// to the operating system, so there's no need to concatenate the buffers
+/// first.  UDP sockets send the array as a single datagram.  TLS sockets send
+/// each buffer in turn.
+///
+/// @param sock The Socket created by a prior call to socketCreate.
+/// @param vectors The array of buffers to send.
+/// @param numVectors The number of elements in vectors.
+///
+/// @return Returns the number of bytes sent on success,
+/// negative value on error.
+int socketSendv(Socket *sock, const SocketIoVector *vectors, int numVectors) {
+  printLog(TRACE, "ENTER socketSendv(sock=%s, vectors=%p, numVectors=%d)\n",
+    socketToString(sock), (void*) vectors, numVectors);
+  
+  if ((sock == NULL) || ((vectors == NULL) && (numVectors > 0))) {
+    printLog(ERR, "NULL Socket or vectors provided.\n");
+    printLog(TRACE, "EXIT socketSendv(sock=%s, vectors=%p, numVectors=%d) "
+      "= {%d}\n", socketToString(sock), (void*) vectors, numVectors, -1);
+    return -1;
+  }
+  
+  size_t totalLength = 0;
+  for (int ii = 0; ii < numVectors; ii++) {
+    totalLength += vectors[ii].length;
+  }
+  if (totalLength > INT_MAX) {
+    printLog(ERR, "Cannot send %llu bytes in one call.\n", llu(totalLength));
+    printLog(TRACE, "EXIT socketSendv(sock=%s, vectors=%p, numVectors=%d) "
+      "= {%d}\n", socketToString(sock), (void*) vectors, numVectors, -1);
+    return -1;
+  }
+  
+  if (sock->socketMode != PLAIN) {
+    // There's no scatter/gather for encrypted records.
+    int returnValue = 0;
+    for (int ii = 0; ii < numVectors; ii++) {
+      if (vectors[ii].length == 0) {
+        continue;
+      }
+      int bytesSent = socketSend(sock, vectors[ii].base,
+        (int) vectors[ii].length);
+      if (bytesSent < 0) {
+        returnValue = (returnValue > 0) ? returnValue : bytesSent;
+        break;
+      }
+      returnValue += bytesSent;
+      if (bytesSent < (int) vectors[ii].length) {
+        break;
+      }
     }
-  } else if (socketMode == TLS) {
-    printLog(WARN, "Local system does not support TLS.  Using plaintext.\n");
-    socketMode = PLAIN;
+    printLog(TRACE, "EXIT socketSendv(sock=%s, vectors=%p, numVectors=%d) "
+      "= {%d}\n", socketToString(sock), (void*) vectors, numVectors,
+      returnValue);
+    return returnValue;
   }
-#endif // TLS_SOCKETS_ENABLED
   
-  ZEROINIT(struct sockaddr_in clientAddress);
-  socklen_t clientAddressLength = sizeof(clientAddress);
-  int clientSockfd = 0;
-  if (socketProtocol == TCP) {
-    while (clientSockfd == 0) {
-      // Call listen to drop connections beyond the end of our connection queue.
+  bool wasBlocking = sock->blocking;
+  if (socketSetBlocking(sock) != NO_ERROR) {
+    printLog(ERR, "Could not put socket in blocking mode.\n");
+  }
+  
+  int flags = 0;
+#ifndef _WIN32
+  // Ignore sigpipe errors on the POSIX send command
+  flags = MSG_NOSIGNAL;
+#endif
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+  uint32_t numZeroCopySends = 0;
+  if ((sock->zeroCopy == true) && (sock->socketProtocol == TCP)
+    && (totalLength >= SOCKET_ZEROCOPY_MIN_LENGTH)
+  ) {
+    flags |= MSG_ZEROCOPY;
+  }
+#endif // SOCKET_ZEROCOPY_SUPPORTED
+
+  SocketRawIoVector rawVectors[SOCKET_IOV_MAX];
+  size_t totalBytesSent = 0;
+  int64_t bytesSent = 0;
+  mtx_lock(&sock->lock);
+  while (totalBytesSent < totalLength) {
+    int numRawVectors = socketFillRawIoVectors(rawVectors,
+      vectors, numVectors, totalBytesSent);
+    if ((sock->socketProtocol == TCP) && (sock->tcpConnected == true)) {
+#ifdef _WIN32
+      DWORD windowsBytesSent = 0;
+      bytesSent = (WSASend(sock->sockfd, rawVectors, numRawVectors,
+        &windowsBytesSent, 0, NULL, NULL) == 0) ? windowsBytesSent : -1;
+#else // POSIX
+      ZEROINIT(struct msghdr message);
+      message.msg_iov = rawVectors;
+      message.msg_iovlen = numRawVectors;
+      bytesSent = sendmsg(sock->sockfd, &message, flags);
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+      if ((bytesSent > 0) && (flags & MSG_ZEROCOPY)) {
+        numZeroCopySends++;
+      }
+#endif // SOCKET_ZEROCOPY_SUPPORTED
+#endif // _WIN32
+    } else if ((sock->socketProtocol == UDP)
+      && (numRawVectors == numVectors)
+    ) {
+#ifdef _WIN32
+      DWORD windowsBytesSent = 0;
+      bytesSent = (WSASendTo(sock->sockfd, rawVectors, numRawVectors,
+        &windowsBytesSent, 0, (struct sockaddr*) &sock->sockaddr,
+        sizeof(sock->sockaddr), NULL, NULL) == 0) ? windowsBytesSent : -1;
+#else // POSIX
+      ZEROINIT(struct msghdr message);
+      message.msg_name = &sock->sockaddr;
+      message.msg_namelen = sizeof(sock->sockaddr);
+      message.msg_iov = rawVectors;
+      message.msg_iovlen = numRawVectors;
+      bytesSent = sendmsg(sock->sockfd, &message, flags);
+#endif // _WIN32
+      if (bytesSent > 0) {
+        // A datagram is all or nothing.
+        totalBytesSent = totalLength;
+        break;
+      }
+    } else {
+      // Invalid state of socket, or a datagram with too many pieces.
+      printLog(ERR, "Invalid socket in socketSendv.\n");
+      printLog(ERR, "%s\n", socketToString(sock));
+      bytesSent = -1;
+    }
+    if (bytesSent <= 0) {
+      break;
+    }
+    totalBytesSent += (size_t) bytesSent;
+  }
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+  socketZeroCopyWait(sock, numZeroCopySends);
+#endif // SOCKET_ZEROCOPY_SUPPORTED
+  mtx_unlock(&sock->lock);
+  
+  int returnValue = (int) totalBytesSent;
+  if ((bytesSent < 0) && (totalBytesSent == 0)) {
+    returnValue = -1;
+    if (sock->socketProtocol == TCP) {
+      // Same as socketSend:  There is a problem with the socket.  Close it to
+      // force any in-progress recvs to exit.
+      sock->tcpConnected = false;
+      rawSocketClose(sock->sockfd);
+      sock->sockfd = -1;
+      updateSocketString(sock);
+    }
+  }
+  
+  if (wasBlocking == false) {
+    if (socketSetNonblocking(sock) != NO_ERROR) {
+      printLog(ERR, "Could not return socket to non-blocking mode.\n");
+    }
+  }
+  
+  printLog(TRACE, "EXIT socketSendv(sock=%s, vectors=%p, numVectors=%d) "
+    "= {%d}\n", socketToString(sock), (void*) vectors, numVectors,
+    returnValue);
+  return returnValue;
+}
+
+/// @fn int socketReceivev_(Socket *sock, SocketIoVector *vectors, int numVectors, int timeoutMilliseconds, ...)
+///
+/// @brief Receive data from the specified socket into an array of buffers,
+/// filling each buffer before moving on to the next.  Plain sockets read into
+/// the whole array in one call.  TLS sockets read into the first non-empty
+/// buffer only.
+///
+/// @param sock The Socket created by a prior call to socketCreate.
+/// @param vectors The array of buffers to receive data into.
+/// @param numVectors The number of elements in vectors.
+/// @param timeoutMilliseconds The number of milliseconds to wait for data if
+///   the socket is blocking.  If the socket is blocking and this value is -1,
+///   this function blocks indefinitely.  If the socket is non-blocking, this
+///   value is ignored.
+///
+/// @return Returns the number of bytes received on success, 0 if no data was
+/// available without blocking, negative value on error or timeout.
+int socketReceivev_(Socket *sock, SocketIoVector *vectors, int numVectors,
+  int timeoutMilliseconds, ...
+) {
+  printLog(FLOOD, "ENTER socketReceivev(sock=%s, vectors=%p, numVectors=%d, "
+    "timeoutMilliseconds=%d)\n", socketToString(sock), (void*) vectors,
+    numVectors, timeoutMilliseconds);
+  
+  if ((sock == NULL) || ((vectors == NULL) && (numVectors > 0))) {
+    printLog(ERR, "NULL Socket or vectors provided.\n");
+    printLog(FLOOD, "EXIT socketReceivev(sock=%s, vectors=%p, numVectors=%d, "
+      "timeoutMilliseconds=%d) = {%d}\n", socketToString(sock),
+      (void*) vectors, numVectors, timeoutMilliseconds, -1);
+    return -1;
+  }
+  
+  int bytesReceived = 0;
+  if (sock->socketMode != PLAIN) {
+    for (int ii = 0; ii < numVectors; ii++) {
+      if (vectors[ii].length > 0) {
+        bytesReceived = socketReceive_(sock, vectors[ii].base,
+          (int) vectors[ii].length, timeoutMilliseconds);
+        break;
+      }
+    }
+    printLog(FLOOD, "EXIT socketReceivev(sock=%s, vectors=%p, numVectors=%d, "
+      "timeoutMilliseconds=%d) = {%d}\n", socketToString(sock),
+      (void*) vectors, numVectors, timeoutMilliseconds, bytesReceived);
+    return bytesReceived;
+  }
+  
+  if (sock->blocking == true) {
+    // Honor the timeout.
+    ZEROINIT(struct pollfd pollDescriptor);
+    pollDescriptor.fd = sock->sockfd;
+    pollDescriptor.events = POLLRDNORM;
+    int pollReturnValue = poll(&pollDescriptor, 1,
+      (timeoutMilliseconds < 0) ? -1 : timeoutMilliseconds);
+    if (pollReturnValue <= 0) {
+      bytesReceived = ((pollReturnValue == 0) && (timeoutMilliseconds == 0))
+        ? 0 : -1;
+      printLog(FLOOD, "EXIT socketReceivev(sock=%s, vectors=%p, "
+        "numVectors=%d, timeoutMilliseconds=%d) = {%d}\n",
+        socketToString(sock), (void*) vectors, numVectors,
+        timeoutMilliseconds, bytesReceived);
+      return bytesReceived;
+    }
+  }
+  
+  SocketRawIoVector rawVectors[SOCKET_IOV_MAX];
+  int numRawVectors = socketFillRawIoVectors(rawVectors,
+    vectors, numVectors, 0);
+  mtx_lock(&sock->lock);
+  if (((sock->socketProtocol == TCP) && (sock->tcpConnected == true))
+    || (sock->socketProtocol == UDP)
+  ) {
+    struct sockaddr_in srcAddr = sock->sockaddr;
+#ifdef _WIN32
+    DWORD windowsBytesReceived = 0;
+    DWORD windowsFlags = 0;
+    int srcAddrLen = sizeof(srcAddr);
+    bytesReceived = (WSARecvFrom(sock->sockfd, rawVectors, numRawVectors,
+      &windowsBytesReceived, &windowsFlags, (struct sockaddr*) &srcAddr,
+      (sock->socketProtocol == UDP) ? &srcAddrLen : NULL, NULL, NULL) == 0)
+      ? (int) windowsBytesReceived : -1;
+#else // POSIX
+    ZEROINIT(struct msghdr message);
+    if (sock->socketProtocol == UDP) {
+      message.msg_name = &srcAddr;
+      message.msg_namelen = sizeof(srcAddr);
+    }
+    message.msg_iov = rawVectors;
+    message.msg_iovlen = numRawVectors;
+    bytesReceived = (int) recvmsg(sock->sockfd, &message, 0);
+#endif // _WIN32
+  } else {
+    // Invalid state of socket.
+    printLog(ERR, "Invalid socket in socketReceivev.\n");
+    printLog(ERR, "%s\n", socketToString(sock));
+    bytesReceived = -1;
+  }
+  mtx_unlock(&sock->lock);
+  
+  if ((bytesReceived < 0) && (sock->blocking == false)) {
+    // This may not actually be an error.  Correct if not.
+#ifndef _WIN32
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+#else // _WIN32 defined
+    if (WSAGetLastError() == WSAEWOULDBLOCK)
+#endif
+    {
+      bytesReceived = 0;
+    }
+  }
+  
+  printLog(FLOOD, "EXIT socketReceivev(sock=%s, vectors=%p, numVectors=%d, "
+    "timeoutMilliseconds=%d) = {%d}\n", socketToString(sock),
+    (void*) vectors, numVectors, timeoutMilliseconds, bytesReceived);
+  return bytesReceived;
+}
+
+/// @def SOCKET_BATCH_MAX
+///
+/// @brief The maximum number of datagrams passed to the operating system in one
+/// batched send or receive.  Longer arrays are sent in multiple calls.
+#define SOCKET_BATCH_MAX 64
+
+/// @fn int socketSendBatch(Socket *sock, const SocketDatagram *datagrams, int numDatagrams)
+///
+/// @brief Send a batch of datagrams on a UDP socket.  Where sendmmsg is
+/// available, up to SOCKET_BATCH_MAX datagrams go out per system call.
+/// Elsewhere they're sent one at a time.
+///
+/// @param sock The UDP Socket created by a prior call to socketCreate.
+/// @param datagrams The array of datagrams to send.
+/// @param numDatagrams The number of elements in datagrams.
+///
+/// @return Returns the number of datagrams sent, which is less than
+/// numDatagrams if a send failed part way through, or a negative value if none
+/// could be sent.
+int socketSendBatch(Socket *sock, const SocketDatagram *datagrams,
+  int numDatagrams
+) {
+  printLog(TRACE, "ENTER socketSendBatch(sock=%s, datagrams=%p, "
+    "numDatagrams=%d)\n", socketToString(sock), (void*) datagrams,
+    numDatagrams);
+  
+  if ((sock == NULL) || ((datagrams == NULL) && (numDatagrams > 0))) {
+    printLog(ERR, "NULL Socket or datagrams provided.\n");
+    printLog(TRACE, "EXIT socketSendBatch(sock=%s, datagrams=%p, "
+      "numDatagrams=%d) = {%d}\n", socketToString(sock), (void*) datagrams,
+      numDatagrams, -1);
+    return -1;
+  } else if ((sock->socketProtocol != UDP) || (sock->socketMode != PLAIN)) {
+    printLog(ERR, "Batched sends are only supported on plain UDP sockets.\n");
+    printLog(TRACE, "EXIT socketSendBatch(sock=%s, datagrams=%p, "
+      "numDatagrams=%d) = {%d}\n", socketToString(sock), (void*) datagrams,
+      numDatagrams, -1);
+    return -1;
+  }
+  
+  int flags = 0;
+#ifndef _WIN32
+  flags = MSG_NOSIGNAL;
+#endif
+  
+  int numSent = 0;
+  mtx_lock(&sock->lock);
+#ifdef SOCKET_MMSG_SUPPORTED
+  struct mmsghdr messages[SOCKET_BATCH_MAX];
+  struct iovec rawVectors[SOCKET_BATCH_MAX];
+  while (numSent < numDatagrams) {
+    int batchSize = numDatagrams - numSent;
+    if (batchSize > SOCKET_BATCH_MAX) {
+      batchSize = SOCKET_BATCH_MAX;
+    }
+    memset(messages, 0, batchSize * sizeof(struct mmsghdr));
+    for (int ii = 0; ii < batchSize; ii++) {
+      const SocketDatagram *datagram = &datagrams[numSent + ii];
+      socketRawIoVectorSet(&rawVectors[ii], datagram->base, datagram->length);
+      messages[ii].msg_hdr.msg_name = (datagram->address.sin_family != 0)
+        ? (void*) &datagram->address : (void*) &sock->sockaddr;
+      messages[ii].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+      messages[ii].msg_hdr.msg_iov = &rawVectors[ii];
+      messages[ii].msg_hdr.msg_iovlen = 1;
+    }
+    int batchSent = sendmmsg(sock->sockfd, messages, batchSize, flags);
+    if (batchSent <= 0) {
+      break;
+    }
+    numSent += batchSent;
+    if (batchSent < batchSize) {
+      break;
+    }
+  }
+#else
+  for (; numSent < numDatagrams; numSent++) {
+    const SocketDatagram *datagram = &datagrams[numSent];
+    const struct sockaddr_in *address = (datagram->address.sin_family != 0)
+      ? &datagram->address : &sock->sockaddr;
+    if (sendto(sock->sockfd, (const char*) datagram->base,
+      (int) datagram->length, flags, (const struct sockaddr*) address,
+      sizeof(*address)) < 0
+    ) {
+      break;
+    }
+  }
+#endif // SOCKET_MMSG_SUPPORTED
+  mtx_unlock(&sock->lock);
+  
+  if ((numSent == 0) && (numDatagrams > 0)) {
+    numSent = -1;
+  }
+  
+  printLog(TRACE, "EXIT socketSendBatch(sock=%s, datagrams=%p, "
+    "numDatagrams=%d) = {%d}\n", socketToString(sock), (void*) datagrams,
+    numDatagrams, numSent);
+  return numSent;
+}
+
+/// @fn int socketReceiveBatch_(Socket *sock, SocketDatagram *datagrams, int numDatagrams, int timeoutMilliseconds, ...)
+///
+/// @brief Receive as many datagrams as are available, up to numDatagrams, on a
+/// UDP socket.  Only the first datagram is waited for.  Where recvmmsg is
+/// available, up to SOCKET_BATCH_MAX datagrams are received per system call.
+/// Elsewhere they're received one at a time.
+///
+/// @param sock The UDP Socket created by a prior call to socketCreate.
+/// @param datagrams The array of datagrams to receive into.  The base and
+///   length of each must describe the buffer to receive into.
+/// @param numDatagrams The number of elements in datagrams.
+/// @param timeoutMilliseconds The number of milliseconds to wait for the first
+///   datagram if the socket is blocking.  If the socket is blocking and this
+///   value is -1, this function blocks indefinitely.  If the socket is
+///   non-blocking, this value is ignored.
+///
+/// @return Returns the number of datagrams received on success, 0 if none
+/// were available without blocking, negative value on error or timeout.
+int socketReceiveBatch_(Socket *sock, SocketDatagram *datagrams,
+  int numDatagrams, int timeoutMilliseconds, ...
+) {
+  printLog(FLOOD, "ENTER socketReceiveBatch(sock=%s, datagrams=%p, "
+    "numDatagrams=%d, timeoutMilliseconds=%d)\n", socketToString(sock),
+    (void*) datagrams, numDatagrams, timeoutMilliseconds);
+  
+  if ((sock == NULL) || ((datagrams == NULL) && (numDatagrams > 0))) {
+    printLog(ERR, "NULL Socket or datagrams provided.\n");
+    printLog(FLOOD, "EXIT socketReceiveBatch(sock=%s, datagrams=%p, "
+      "numDatagrams=%d, timeoutMilliseconds=%d) = {%d}\n",
+      socketToString(sock), (void*) datagrams, numDatagrams,
+      timeoutMilliseconds, -1);
+    return -1;
+  } else if ((sock->socketProtocol != UDP) || (sock->socketMode != PLAIN)) {
+    printLog(ERR,
+      "Batched receives are only supported on plain UDP sockets.\n");
+    printLog(FLOOD, "EXIT socketReceiveBatch(sock=%s, datagrams=%p, "
+      "numDatagrams=%d, timeoutMilliseconds=%d) = {%d}\n",
+      socketToString(sock), (void*) datagrams, numDatagrams,
+      timeoutMilliseconds, -1);
+    return -1;
+  }
+  
+  if (sock->blocking == true) {
+    // Honor the timeout.
+    ZEROINIT(struct pollfd pollDescriptor);
+    pollDescriptor.fd = sock->sockfd;
+    pollDescriptor.events = POLLRDNORM;
+    int pollReturnValue = poll(&pollDescriptor, 1,
+      (timeoutMilliseconds < 0) ? -1 : timeoutMilliseconds);
+    if (pollReturnValue <= 0) {
+      int returnValue = ((pollReturnValue == 0) && (timeoutMilliseconds == 0))
+        ? 0 : -1;
+      printLog(FLOOD, "EXIT socketReceiveBatch(sock=%s, datagrams=%p, "
+        "numDatagrams=%d, timeoutMilliseconds=%d) = {%d}\n",
+        socketToString(sock), (void*) datagrams, numDatagrams,
+        timeoutMilliseconds, returnValue);
+      return returnValue;
+    }
+  }
+  
+  int numReceived = 0;
+  bool failed = false;
+  mtx_lock(&sock->lock);
+#ifdef SOCKET_MMSG_SUPPORTED
+  struct mmsghdr messages[SOCKET_BATCH_MAX];
+  struct iovec rawVectors[SOCKET_BATCH_MAX];
+  while (numReceived < numDatagrams) {
+    int batchSize = numDatagrams - numReceived;
+    if (batchSize > SOCKET_BATCH_MAX) {
+      batchSize = SOCKET_BATCH_MAX;
+    }
+    memset(messages, 0, batchSize * sizeof(struct mmsghdr));
+    for (int ii = 0; ii < batchSize; ii++) {
+      SocketDatagram *datagram = &datagrams[numReceived + ii];
+      socketRawIoVectorSet(&rawVectors[ii], datagram->base, datagram->length);
+      messages[ii].msg_hdr.msg_name = &datagram->address;
+      messages[ii].msg_hdr.msg_namelen = sizeof(datagram->address);
+      messages[ii].msg_hdr.msg_iov = &rawVectors[ii];
+      messages[ii].msg_hdr.msg_iovlen = 1;
+    }
+    // Only the first datagram of the first batch may block.
+    int batchReceived = recvmmsg(sock->sockfd, messages, batchSize,
+      (numReceived == 0) ? MSG_WAITFORONE : MSG_DONTWAIT, NULL);
+    if (batchReceived <= 0) {
+      failed = (numReceived == 0);
+      break;
+    }
+    for (int ii = 0; ii < batchReceived; ii++) {
+      SocketDatagram *datagram = &datagrams[numReceived + ii];
+      datagram->length = messages[ii].msg_len;
+      datagram->truncated = ((messages[ii].msg_hdr.msg_flags & MSG_TRUNC) != 0);
+    }
+    numReceived += batchReceived;
+    if (batchReceived < batchSize) {
+      break;
+    }
+  }
+#else
+  for (; numReceived < numDatagrams; numReceived++) {
+    if (numReceived > 0) {
+      // Only the first datagram may block.
       ZEROINIT(struct pollfd pollDescriptor);
-      pollDescriptor.fd = sockfd;
+      pollDescriptor.fd = sock->sockfd;
       pollDescriptor.events = POLLRDNORM;
-      int pollReturnValue = poll(&pollDescriptor, 1, -1);
-      if (pollReturnValue == 0) {
+      if (poll(&pollDescriptor, 1, 0) <= 0) {
         break;
-      } else if (pollReturnValue < 0) {
-        clientSockfd = -1;
-        
+      }
+    }
+    SocketDatagram *datagram = &datagrams[numReceived];
+#ifdef _WIN32
+    int addressLength = sizeof(datagram->address);
+#else // POSIX
+    socklen_t addressLength = sizeof(datagram->address);
+#endif // _WIN32
+    int bytesReceived = (int) recvfrom(sock->sockfd, (char*) datagram->base,
+      (int) datagram->length, 0, (struct sockaddr*) &datagram->address,
+      &addressLength);
+    if (bytesReceived < 0) {
+      failed = (numReceived == 0);
+      break;
+    }
+    // recvfrom doesn't report truncation portably, so a full buffer is the
+    // best indication available.
+    datagram->truncated = ((size_t) bytesReceived == datagram->length);
+    datagram->length = (size_t) bytesReceived;
+  }
+#endif // SOCKET_MMSG_SUPPORTED
+  mtx_unlock(&sock->lock);
+  
+  if (failed == true) {
+    numReceived = -1;
+    if (sock->blocking == false) {
+      // This may not actually be an error.  Correct if not.
 #ifndef _WIN32
-        // On POSIX, errno is either EAGAIN or EWOULDBLOCK.
-        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+      if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
 #else // _WIN32 defined
-        // On Windows, the non-blocking socket should make WSAGetLastError
-        // return WSAEWOULDBLOCK.
-        if (WSAGetLastError() == WSAEWOULDBLOCK)
+      if (WSAGetLastError() == WSAEWOULDBLOCK)
 #endif
-        {
-          clientSockfd = 0;
-          socketsMsleep(1);
-        } else {
-          printLog(ERR, "Unexpected error: %s\n", strerror(errno));
-          break;
-        }
+      {
+        numReceived = 0;
+      }
+    }
+  }
+  
+  printLog(FLOOD, "EXIT socketReceiveBatch(sock=%s, datagrams=%p, "
+    "numDatagrams=%d, timeoutMilliseconds=%d) = {%d}\n",
+    socketToString(sock), (void*) datagrams, numDatagrams,
+    timeoutMilliseconds, numReceived);
+  return numReceived;
+}
+
+/// @fn SocketDatagramRing* socketDatagramRingCreate(u32 capacity, size_t bufferSize)
+///
+/// @brief Create a ring of datagram buffers for socketReceiveRing.  All of the
+/// buffers are allocated up front in a single block.
+///
+/// @param capacity The number of datagrams the ring can hold.
+/// @param bufferSize The size, in bytes, of each datagram's buffer.
+///
+/// @return Returns a pointer to the new SocketDatagramRing on success, NULL on
+/// failure.
+SocketDatagramRing* socketDatagramRingCreate(u32 capacity, size_t bufferSize) {
+  if ((capacity == 0) || (bufferSize == 0)) {
+    printLog(ERR, "Invalid parameters to socketDatagramRingCreate.\n");
+    return NULL;
+  }
+  
+  SocketDatagramRing *ring
+    = (SocketDatagramRing*) calloc(1, sizeof(SocketDatagramRing));
+  if (ring == NULL) {
+    LOG_MALLOC_FAILURE();
+    return ring; // NULL
+  }
+  ring->datagrams
+    = (SocketDatagram*) calloc(capacity, sizeof(SocketDatagram));
+  ring->buffers = (char*) malloc(capacity * bufferSize);
+  if ((ring->datagrams == NULL) || (ring->buffers == NULL)) {
+    LOG_MALLOC_FAILURE();
+    ring = socketDatagramRingDestroy(ring);
+    return ring; // NULL
+  }
+  ring->bufferSize = bufferSize;
+  ring->capacity = capacity;
+  for (u32 ii = 0; ii < capacity; ii++) {
+    ring->datagrams[ii].base = &ring->buffers[ii * bufferSize];
+  }
+  
+  return ring;
+}
+
+/// @fn SocketDatagramRing* socketDatagramRingDestroy(SocketDatagramRing *ring)
+///
+/// @brief Free a SocketDatagramRing and all of its buffers.
+///
+/// @param ring The SocketDatagramRing to destroy.
+///
+/// @return Always returns NULL.
+SocketDatagramRing* socketDatagramRingDestroy(SocketDatagramRing *ring) {
+  if (ring != NULL) {
+    free(ring->datagrams); ring->datagrams = NULL;
+    free(ring->buffers); ring->buffers = NULL;
+    free(ring); ring = NULL;
+  }
+  
+  return ring;
+}
+
+/// @fn SocketDatagram* socketDatagramRingPeek(SocketDatagramRing *ring)
+///
+/// @brief Get the oldest datagram received into a ring without consuming it.
+/// The datagram's buffer belongs to the ring and stays valid until the
+/// datagram is popped.
+///
+/// @param ring The SocketDatagramRing to look at.
+///
+/// @return Returns a pointer to the oldest received datagram, NULL if the ring
+/// is empty.
+SocketDatagram* socketDatagramRingPeek(SocketDatagramRing *ring) {
+  if ((ring == NULL) || (ring->count == 0)) {
+    return NULL;
+  }
+  
+  return &ring->datagrams[ring->head];
+}
+
+/// @fn int socketDatagramRingPop(SocketDatagramRing *ring)
+///
+/// @brief Consume the oldest datagram received into a ring, making its buffer
+/// available to receive into again.
+///
+/// @param ring The SocketDatagramRing to pop from.
+///
+/// @return Returns 0 on success, -1 if the ring is empty.
+int socketDatagramRingPop(SocketDatagramRing *ring) {
+  if ((ring == NULL) || (ring->count == 0)) {
+    return -1;
+  }
+  
+  ring->head = (ring->head + 1) % ring->capacity;
+  ring->count--;
+  
+  return 0;
+}
+
+/// @fn int socketReceiveRing_(Socket *sock, SocketDatagramRing *ring, int timeoutMilliseconds, ...)
+///
+/// @brief Receive datagrams from a UDP socket straight into the free buffers of
+/// a ring.  Datagrams are not copied after the kernel writes them.
+///
+/// @param sock The UDP Socket created by a prior call to socketCreate.
+/// @param ring The SocketDatagramRing to receive into.
+/// @param timeoutMilliseconds The number of milliseconds to wait for the first
+///   datagram if the socket is blocking.  If the socket is blocking and this
+///   value is -1, this function blocks indefinitely.  If the socket is
+///   non-blocking, this value is ignored.
+///
+/// @return Returns the number of datagrams added to the ring on success, 0 if
+/// the ring is full or no datagrams were available without blocking, negative
+/// value on error or timeout.
+int socketReceiveRing_(Socket *sock, SocketDatagramRing *ring,
+  int timeoutMilliseconds, ...
+) {
+  if (ring == NULL) {
+    printLog(ERR, "NULL ring provided.\n");
+    return -1;
+  }
+  
+  int numReceived = 0;
+  while (ring->count < ring->capacity) {
+    // Receive into the free slots up to the end of the array, then wrap
+    // around for the ones at the beginning.
+    u32 tail = (ring->head + ring->count) % ring->capacity;
+    u32 numFree = ring->capacity - ring->count;
+    if (numFree > ring->capacity - tail) {
+      numFree = ring->capacity - tail;
+    }
+    if (numFree > INT_MAX) {
+      numFree = INT_MAX;
+    }
+    for (u32 ii = tail; ii < tail + numFree; ii++) {
+      ring->datagrams[ii].length = ring->bufferSize;
+      ring->datagrams[ii].truncated = false;
+    }
+    
+    int batchReceived = socketReceiveBatch_(sock, &ring->datagrams[tail],
+      (int) numFree, (numReceived == 0) ? timeoutMilliseconds : 0);
+    if (batchReceived <= 0) {
+      if (numReceived == 0) {
+        numReceived = batchReceived;
+      }
+      break;
+    }
+    ring->count += (u32) batchReceived;
+    numReceived += batchReceived;
+    if ((u32) batchReceived < numFree) {
+      break;
+    }
+  }
+  
+  return numReceived;
+}
+
+/// @def SOCKET_SEND_FILE_CHUNK_SIZE
+///
+/// @brief The size, in bytes, of the buffer used to copy a file to a socket
+/// when the kernel can't send it directly.
+#define SOCKET_SEND_FILE_CHUNK_SIZE 65536
+
+/// @fn static int64_t socketSendFileCopy(Socket *sock, int fd, int64_t offset, int64_t count)
+///
+/// @brief Send part of a file to a socket by reading it into a buffer and
+/// calling socketSend.  Used for TLS sockets and wherever the kernel can't
+/// send a file directly.
+///
+/// @param sock The Socket to send to.
+/// @param fd The file descriptor of the file to send.
+/// @param offset The offset, in bytes, in the file to start sending from.
+/// @param count The number of bytes to send.
+///
+/// @return Returns the number of bytes sent on success (which may be less
+/// than count if the end of the file is reached), negative value on error.
+static int64_t socketSendFileCopy(Socket *sock, int fd, int64_t offset,
+  int64_t count
+) {
+  char *buffer = (char*) malloc(SOCKET_SEND_FILE_CHUNK_SIZE);
+  if (buffer == NULL) {
+    LOG_MALLOC_FAILURE();
+    return -1;
+  }
+  
+  int64_t totalBytesSent = 0;
+  while (totalBytesSent < count) {
+    int64_t chunkSize = count - totalBytesSent;
+    if (chunkSize > SOCKET_SEND_FILE_CHUNK_SIZE) {
+      chunkSize = SOCKET_SEND_FILE_CHUNK_SIZE;
+    }
+#ifdef _WIN32
+    int bytesRead = -1;
+    if (_lseeki64(fd, offset + totalBytesSent, SEEK_SET) >= 0) {
+      bytesRead = _read(fd, buffer, (unsigned int) chunkSize);
+    }
+#else // POSIX
+    int bytesRead = (int) pread(fd, buffer, (size_t) chunkSize,
+      (off_t) (offset + totalBytesSent));
+#endif // _WIN32
+    if (bytesRead <= 0) {
+      if (bytesRead < 0) {
+        printLog(ERR, "Could not read file descriptor %d: %s\n",
+          fd, strerror(errno));
+        if (totalBytesSent == 0) {
+          totalBytesSent = -1;
+        }
+      }
+      break;
+    }
+    
+    int bytesSent = socketSend(sock, buffer, bytesRead);
+    if (bytesSent < 0) {
+      if (totalBytesSent == 0) {
+        totalBytesSent = -1;
+      }
+      break;
+    }
+    totalBytesSent += bytesSent;
+    if (bytesSent < bytesRead) {
+      break;
+    }
+  }
+  
+  free(buffer); buffer = NULL;
+  return totalBytesSent;
+}
+
+/// @fn int64_t socketSendFile(Socket *sock, int fd, int64_t offset, int64_t count)
+///
+/// @brief Send part of a file to a connected TCP socket.  For plain sockets,
+/// the kernel copies the file directly to the socket (sendfile on POSIX,
+/// TransmitFile on Windows) without passing it through user space.  TLS
+/// sockets read the file into a buffer and encrypt it as usual.
+///
+/// @param sock The Socket created by a prior call to socketCreate or
+///   socketAccept.
+/// @param fd The file descriptor of the file to send.
+/// @param offset The offset, in bytes, in the file to start sending from.
+///   The file descriptor's own offset is not used.
+/// @param count The number of bytes to send.
+///
+/// @return Returns the number of bytes sent on success (which may be less
+/// than count if the end of the file is reached), negative value on error.
+int64_t socketSendFile(Socket *sock, int fd, int64_t offset, int64_t count) {
+  printLog(TRACE, "ENTER socketSendFile(sock=%s, fd=%d, offset=%lld, "
+    "count=%lld)\n", socketToString(sock), fd, lld(offset), lld(count));
+  
+  if ((sock == NULL) || (fd < 0) || (offset < 0) || (count < 0)
+    || (sock->socketProtocol != TCP) || (sock->tcpConnected == false)
+  ) {
+    printLog(ERR, "Invalid arguments to socketSendFile.\n");
+    printLog(TRACE, "EXIT socketSendFile(sock=%s, fd=%d, offset=%lld, "
+      "count=%lld) = {-1}\n", socketToString(sock), fd, lld(offset),
+      lld(count));
+    return -1;
+  }
+  
+  int64_t totalBytesSent = 0;
+#ifdef TLS_KERNEL_OFFLOAD_SUPPORTED
+  if ((sock->socketMode == TLS) && (socketKernelTlsActive(sock) == true)) {
+    // The kernel encrypts, so it can still send straight from the file.
+    SSL *ssl = sock->ssl;
+    if (ssl == NULL) {
+      BIO_get_ssl(sock->sslBio, &ssl);
+    }
+    mtx_lock(&sock->lock);
+    while (totalBytesSent < count) {
+      ossl_ssize_t bytesSent = SSL_sendfile(ssl, fd,
+        (off_t) (offset + totalBytesSent), (size_t) (count - totalBytesSent),
+        0);
+      if (bytesSent <= 0) {
+        break;
+      }
+      totalBytesSent += bytesSent;
+    }
+    mtx_unlock(&sock->lock);
+    if (totalBytesSent < count) {
+      // End of file, an error, or SSL_sendfile refused the file.  Let the copy
+      // path sort out which.
+      int64_t bytesSent = socketSendFileCopy(sock, fd,
+        offset + totalBytesSent, count - totalBytesSent);
+      if (bytesSent > 0) {
+        totalBytesSent += bytesSent;
+      } else if ((bytesSent < 0) && (totalBytesSent == 0)) {
+        totalBytesSent = -1;
+      }
+    }
+    printLog(TRACE, "EXIT socketSendFile(sock=%s, fd=%d, offset=%lld, "
+      "count=%lld) = {%lld}\n", socketToString(sock), fd, lld(offset),
+      lld(count), lld(totalBytesSent));
+    return totalBytesSent;
+  }
+#endif // TLS_KERNEL_OFFLOAD_SUPPORTED
+  if (sock->socketMode != PLAIN) {
+    totalBytesSent = socketSendFileCopy(sock, fd, offset, count);
+    printLog(TRACE, "EXIT socketSendFile(sock=%s, fd=%d, offset=%lld, "
+      "count=%lld) = {%lld}\n", socketToString(sock), fd, lld(offset),
+      lld(count), lld(totalBytesSent));
+    return totalBytesSent;
+  }
+  
+  bool wasBlocking = sock->blocking;
+  if (socketSetBlocking(sock) != NO_ERROR) {
+    printLog(ERR, "Could not put socket in blocking mode.\n");
+  }
+  
+  bool useCopy = false;
+  bool endOfFile = false;
+  mtx_lock(&sock->lock);
+  while (totalBytesSent < count) {
+    int64_t chunkSize = count - totalBytesSent;
+    if (chunkSize > INT_MAX) {
+      chunkSize = INT_MAX;
+    }
+    int64_t bytesSent = -1;
+#if defined(__linux__)
+    off_t fileOffset = (off_t) (offset + totalBytesSent);
+    bytesSent = sendfile(sock->sockfd, fd, &fileOffset, (size_t) chunkSize);
+    if ((bytesSent < 0) && ((errno == EINVAL) || (errno == ENOSYS))) {
+      // Not a file the kernel can send from (a pipe, for example).
+      useCopy = true;
+    }
+#elif defined(__APPLE__)
+    off_t length = (off_t) chunkSize;
+    if ((sendfile(fd, sock->sockfd, (off_t) (offset + totalBytesSent),
+      &length, NULL, 0) == 0) || (length > 0)
+    ) {
+      bytesSent = length;
+    } else if ((errno == ENOTSUP) || (errno == ENOTSOCK)
+      || (errno == EOPNOTSUPP)
+    ) {
+      useCopy = true;
+    }
+#elif defined(__FreeBSD__)
+    off_t length = 0;
+    if ((sendfile(fd, sock->sockfd, (off_t) (offset + totalBytesSent),
+      (size_t) chunkSize, NULL, &length, 0) == 0) || (length > 0)
+    ) {
+      bytesSent = length;
+    } else if ((errno == EINVAL) || (errno == EOPNOTSUPP)) {
+      useCopy = true;
+    }
+#elif defined(_WIN32)
+    HANDLE fileHandle = (HANDLE) _get_osfhandle(fd);
+    LARGE_INTEGER fileOffset;
+    fileOffset.QuadPart = offset + totalBytesSent;
+    LARGE_INTEGER fileSize;
+    if ((fileHandle == INVALID_HANDLE_VALUE)
+      || (GetFileSizeEx(fileHandle, &fileSize) == FALSE)
+    ) {
+      useCopy = true;
+    } else {
+      if (chunkSize > fileSize.QuadPart - fileOffset.QuadPart) {
+        chunkSize = fileSize.QuadPart - fileOffset.QuadPart;
+      }
+      if (chunkSize <= 0) {
+        bytesSent = 0;
+      } else if ((SetFilePointerEx(fileHandle, fileOffset, NULL, FILE_BEGIN))
+        && (TransmitFile(sock->sockfd, fileHandle, (DWORD) chunkSize,
+          0, NULL, NULL, 0))
+      ) {
+        bytesSent = chunkSize;
+      }
+    }
+#else
+    useCopy = true;
+#endif
+    if (bytesSent <= 0) {
+      endOfFile = (bytesSent == 0);
+      break;
+    }
+    totalBytesSent += bytesSent;
+  }
+  mtx_unlock(&sock->lock);
+  
+  if (useCopy == true) {
+    int64_t bytesSent = socketSendFileCopy(sock, fd, offset + totalBytesSent,
+      count - totalBytesSent);
+    if (bytesSent > 0) {
+      totalBytesSent += bytesSent;
+    } else if ((bytesSent < 0) && (totalBytesSent == 0)) {
+      totalBytesSent = -1;
+    }
+  } else if ((totalBytesSent == 0) && (count > 0) && (endOfFile == false)) {
+    printLog(ERR, "Could not send file descriptor %d: %s\n",
+      fd, strerror(errno));
+    totalBytesSent = -1;
+  }
+  
+  if (wasBlocking == false) {
+    if (socketSetNonblocking(sock) != NO_ERROR) {
+      printLog(ERR, "Could not return socket to non-blocking mode.\n");
+    }
+  }
+  
+  printLog(TRACE, "EXIT socketSendFile(sock=%s, fd=%d, offset=%lld, "
+    "count=%lld) = {%lld}\n", socketToString(sock), fd, lld(offset),
+    lld(count), lld(totalBytesSent));
+  return totalBytesSent;
+}
+
+/// @fn bool socketKernelTlsActive(Socket *sock)
+///
+/// @brief Determine whether or not the kernel is encrypting a TLS socket's
+/// outgoing records.  See tlsSetKernelOffload.
+///
+/// @param sock The Socket to examine.
+///
+/// @return Returns true if the socket has completed its handshake and its
+/// send path is offloaded to the kernel, false otherwise.
+bool socketKernelTlsActive(Socket *sock) {
+  bool returnValue = false;
+
+#ifdef TLS_KERNEL_OFFLOAD_SUPPORTED
+  if ((sock != NULL) && (sock->socketMode == TLS)) {
+    SSL *ssl = sock->ssl;
+    if ((ssl == NULL) && (sock->sslBio != NULL)) {
+      BIO_get_ssl(sock->sslBio, &ssl);
+    }
+    if ((ssl != NULL) && (SSL_is_init_finished(ssl))) {
+      returnValue = (BIO_get_ktls_send(SSL_get_wbio(ssl)) != 0);
+    }
+  }
+#else
+  (void) sock;
+#endif // TLS_KERNEL_OFFLOAD_SUPPORTED
+
+  return returnValue;
+}
+
+/// @fn int socketSetZeroCopy(Socket *sock, bool enabled)
+///
+/// @brief Enable or disable MSG_ZEROCOPY sends on a plain TCP socket.  When
+/// enabled, sends of at least SOCKET_ZEROCOPY_MIN_LENGTH bytes made by
+/// socketSend and socketSendv pin the caller's pages instead of copying them
+/// into the kernel.  Those calls still don't return until the kernel is done
+/// with the buffer, so callers may reuse it immediately.
+///
+/// @param sock The Socket to configure.
+/// @param enabled Whether or not to use zero-copy sends.
+///
+/// @return Returns 0 on success, -1 if zero-copy is not supported for this
+/// socket or this platform.
+int socketSetZeroCopy(Socket *sock, bool enabled) {
+  printLog(TRACE, "ENTER socketSetZeroCopy(sock=%s, enabled=%s)\n",
+    socketToString(sock), (enabled == true) ? "true" : "false");
+  
+  int returnValue = -1;
+  if ((sock != NULL) && (enabled == false)) {
+    sock->zeroCopy = false;
+    returnValue = 0;
+  }
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+  else if ((sock != NULL) && (sock->socketMode == PLAIN)
+    && (sock->socketProtocol == TCP)
+  ) {
+    int one = 1;
+    if (setsockopt(sock->sockfd, SOL_SOCKET, SO_ZEROCOPY,
+      &one, sizeof(one)) == 0
+    ) {
+      sock->zeroCopy = true;
+      returnValue = 0;
+    } else {
+      printLog(WARN, "Could not enable SO_ZEROCOPY: %s\n", strerror(errno));
+    }
+  }
+#endif // SOCKET_ZEROCOPY_SUPPORTED
+
+  printLog(TRACE, "EXIT socketSetZeroCopy(sock=%s, enabled=%s) = {%d}\n",
+    socketToString(sock), (enabled == true) ? "true" : "false", returnValue);
+  return returnValue;
+}
+
+/// @fn static Socket* socketCreateAccepted(SocketType socketType, SocketProtocol socketProtocol, SocketMode socketMode, int clientSockfd, const struct sockaddr_in *clientAddress)
+///
+/// @brief Wrap the descriptor of an accepted connection in a Socket.  The
+/// server socket's fields are passed in rather than the server socket itself
+/// because the server socket may be destroyed while an accept is blocked.
+///
+/// @param socketType The type of the Socket the connection was accepted on.
+/// @param socketProtocol The protocol of the Socket the connection was
+///   accepted on.
+/// @param socketMode The mode of the new Socket.
+/// @param clientSockfd The descriptor of the accepted connection.  It's closed
+///   on failure.
+/// @param clientAddress The address of the peer.
+///
+/// @return Returns a new Socket on success, NULL on failure.
+static Socket* socketCreateAccepted(SocketType socketType,
+  SocketProtocol socketProtocol, SocketMode socketMode, int clientSockfd,
+  const struct sockaddr_in *clientAddress
+) {
+  Socket *clientSocket = (Socket*) calloc(1, sizeof(Socket));
+  if (clientSocket == NULL) {
+    LOG_MALLOC_FAILURE();
+    rawSocketClose(clientSockfd);
+    return NULL;
+  }
+  if (mtx_init(&clientSocket->lock, mtx_recursive) != thrd_success) {
+    printLog(ERR, "Could initialize Socket lock.\n");
+    free(clientSocket); clientSocket = NULL;
+    rawSocketClose(clientSockfd);
+    return NULL;
+  }
+  clientSocket->socketType = socketType;
+  clientSocket->socketProtocol = socketProtocol;
+  clientSocket->socketMode = socketMode;
+  clientSocket->sockfd = clientSockfd;
+  clientSocket->blocking = true;
+  clientSocket->sockaddr = *clientAddress;
+  clientSocket->tcpConnected
+    = (clientSocket->socketProtocol == TCP) ? true : false;
+  
+  char ipAddressString[INET_ADDRSTRLEN];
+  struct in_addr ipAddress = clientAddress->sin_addr;
+  inet_ntop(AF_INET, &ipAddress, ipAddressString, INET_ADDRSTRLEN);
+  if (asprintf(&clientSocket->address, "%s:%d", ipAddressString,
+    ntohs(clientAddress->sin_port)) < 0
+  ) {
+    clientSocket->address = NULL;
+  }
+  
+  // For ipv6:
+  // struct sockaddr_in6* pV6Address = (struct sockaddr_in6*) &clientAddress;
+  // struct in6_addr ipAddress = pV6Address->sin6_addr;
+  // char ipAddressString[INET6_ADDRSTRLEN];
+  // inet_ntop(AF_INET6, &ipAddress, ipAddressString, INET6_ADDRSTRLEN);
+  
+  return clientSocket;
+}
+
+/// @fn Socket* socketAccept_(Socket *serverSocket, void *buf, int len, ...)
+///
+/// @brief Accept an incoming TCP client connection on a SERVER socket.
+///
+/// @param serverSocket The Socket to accept a connection from.
+///
+/// @param Returns a Socket of the client connection on success,
+/// NULL on failure.
+Socket* socketAccept_(Socket *serverSocket, void *buf, int len, ...) {
+  printLog(TRACE, "ENTER socketAccept(serverSocket=%s, buf=%p, len=%d)\n",
+    socketToString(serverSocket), (void*) buf, len);
+  
+  if (serverSocket == NULL) {
+    printLog(ERR, "serverSocket is NULL.\n");
+    printLog(TRACE,
+      "EXIT socketAccept(serverSocket=NULL, buf=%p, len=%d) = {NULL}\n",
+      (void*) buf, len);
+    return NULL;
+  } else if (serverSocket->socketType != SERVER) {
+    printLog(ERR, "Socket is not a SERVER socket.\n");
+    printLog(TRACE,
+      "EXIT socketAccept(serverSocket=%s, buf=%p, len=%d) = {NULL}\n",
+      socketToString(serverSocket), (void*) buf, len);
+    return NULL;
+  } else if ((serverSocket->socketProtocol == UDP) 
+    && ((buf == NULL) || (len == 0))
+  ) {
+    printLog(ERR, "Socket is a UDP socket and extra parameters are missing.\n");
+    printLog(TRACE,
+      "EXIT socketAccept(serverSocket=%s, buf=%p, len=%d) = {NULL}\n",
+      socketToString(serverSocket), (void*) buf, len);
+    return NULL;
+  }
+  
+  SocketType socketType = serverSocket->socketType;
+  SocketProtocol socketProtocol = serverSocket->socketProtocol;
+  SocketMode socketMode = serverSocket->socketMode;
+  int sockfd = serverSocket->sockfd;
+#ifdef TLS_SOCKETS_ENABLED
+  SSL *clientSsl = NULL;
+  if ((socketMode == TLS) && (tlsSocketsEnabled() == true)) {
+    // We want to avoid segfaults.  At this point in the function, we're pretty
+    // much guaranteed that the socket still exists, as does its sslContext.
+    // However, after the accept() call, that may no longer be true because the
+    // expected use model is that to end an acccept, the socket is destroyed.
+    // So, we can't create a client's SSL object after the accept, we have to
+    // go ahead and create it now.  If we don't need it, we'll delete it, but
+    // if we do, we can just attach it to the client socket when it's created
+    // after the accept().
+    clientSsl = SSL_new(serverSocket->sslContext);
+    if (clientSsl == NULL) {
+      // Out of memory.
+      printLog(TRACE,
+        "EXIT socketAccept(serverSocket=%s, buf=%p, len=%d) = {NULL}\n",
+        socketToString(serverSocket), (void*) buf, len);
+      return NULL;
+    }
+    tlsApplyKernelOffload(clientSsl);
+  } else if (socketMode == TLS) {
+    printLog(WARN, "Local system does not support TLS.  Using plaintext.\n");
+    socketMode = PLAIN;
+  }
+#endif // TLS_SOCKETS_ENABLED
+  
+  ZEROINIT(struct sockaddr_in clientAddress);
+  socklen_t clientAddressLength = sizeof(clientAddress);
+  int clientSockfd = 0;
+  if (socketProtocol == TCP) {
+    while (clientSockfd == 0) {
+      // Call listen to drop connections beyond the end of our connection queue.
+      ZEROINIT(struct pollfd pollDescriptor);
+      pollDescriptor.fd = sockfd;
+      pollDescriptor.events = POLLRDNORM;
+      int pollReturnValue = poll(&pollDescriptor, 1, -1);
+      if (pollReturnValue == 0) {
+        break;
+      } else if (pollReturnValue < 0) {
+        clientSockfd = -1;
+        
+#ifndef _WIN32
+        // On POSIX, errno is either EAGAIN or EWOULDBLOCK.
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+#else // _WIN32 defined
+        // On Windows, the non-blocking socket should make WSAGetLastError
+        // return WSAEWOULDBLOCK.
+        if (WSAGetLastError() == WSAEWOULDBLOCK)
+#endif
+        {
+          clientSockfd = 0;
+          socketsMsleep(1);
+        } else {
+          printLog(ERR, "Unexpected error: %s\n", strerror(errno));
+          break;
+        }
+      }
+      clientSockfd = accept(sockfd,
+        (struct sockaddr *) &clientAddress, &clientAddressLength);
+    }
+    if (clientSockfd < 0) {
+      printLog(ERR, "Could not accept client connection.\n");
+      // We may be in this state because the socket was destroyed.
+      // Don't call socketToString.
+#ifdef TLS_SOCKETS_ENABLED
+      SSL_free(clientSsl); clientSsl = NULL;
+#endif
+      printLog(TRACE,
+        "EXIT socketAccept(serverSocket=%p, buf=%p, len=%d) = {NULL}\n",
+        (void*) serverSocket, (void*) buf, len);
+      return NULL;
+    }
+  } else { // serverSocket->socketProtocol == UDP
+    recvfrom(sockfd, buf, (size_t) len, 0,
+      (struct sockaddr*) &clientAddress, &clientAddressLength);
+    clientSockfd = socket(AF_INET, SOCK_DGRAM, 0);
+  }
+  
+  Socket *clientSocket = socketCreateAccepted(socketType, socketProtocol,
+    socketMode, clientSockfd, &clientAddress);
+  if (clientSocket == NULL) {
+#ifdef TLS_SOCKETS_ENABLED
+    SSL_free(clientSsl); clientSsl = NULL;
+#endif
+    printLog(TRACE,
+      "EXIT socketAccept(serverSocket=%p, buf=%p, len=%d) = {NULL}\n",
+      (void*) serverSocket, (void*) buf, len);
+    return NULL;
+  }
+  
+#ifdef TLS_SOCKETS_ENABLED
+  if ((socketMode == TLS) && (tlsSocketsEnabled() == true)) {
+    clientSocket->ssl = clientSsl;
+    SSL_set_fd(clientSocket->ssl, clientSocket->sockfd);
+  } // else the clientSsl object was never created.
+#endif // TLS_SOCKETS_ENABLED
+  
+  // Update the string representation of the socket.
+  updateSocketString(clientSocket);
+  
+  printLog(TRACE, "EXIT socketAccept(serverSocket=%s, buf=%p, len=%d) = {%s}\n",
+    socketToString(serverSocket), (void*) buf, len,
+    socketToString(clientSocket));
+  return clientSocket;
+}
+
+/// @fn int socketAcceptBatch(Socket *serverSocket, Socket **clientSockets, int maxSockets, int timeoutMilliseconds)
+///
+/// @brief Accept every pending TCP connection on a SERVER socket, up to a
+/// limit, after waiting for at least one to arrive.  The accepted sockets are
+/// non-blocking.  TLS handshakes are not performed here.  They complete on
+/// the first socketReceive or socketReactorReceive, so they run on whichever
+/// thread or coroutine serves the connection instead of holding up the
+/// accepting one.  Serve the sockets with the SocketReactor functions, or
+/// call socketSetBlocking first, since socketReceive doesn't wait on a
+/// non-blocking socket.
+///
+/// @param serverSocket The Socket to accept connections from, normally one
+///   created with socketCreateReusePort.
+/// @param clientSockets The array to store the accepted Sockets in.
+/// @param maxSockets The maximum number of connections to accept.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait for a
+///   connection, 0 to not wait at all, or a negative value to wait
+///   indefinitely.
+///
+/// @return Returns the number of connections accepted (0 if none arrived
+/// before the timeout) on success, -1 on failure.
+int socketAcceptBatch(Socket *serverSocket, Socket **clientSockets,
+  int maxSockets, int timeoutMilliseconds
+) {
+  printLog(TRACE,
+    "ENTER socketAcceptBatch(serverSocket=%s, clientSockets=%p, "
+    "maxSockets=%d, timeoutMilliseconds=%d)\n", socketToString(serverSocket),
+    (void*) clientSockets, maxSockets, timeoutMilliseconds);
+  
+  if ((serverSocket == NULL) || (serverSocket->socketType != SERVER)
+    || (serverSocket->socketProtocol != TCP) || (clientSockets == NULL)
+    || (maxSockets <= 0)
+  ) {
+    printLog(ERR, "Invalid parameters.\n");
+    return -1;
+  }
+  
+  SocketMode socketMode = serverSocket->socketMode;
+#ifdef TLS_SOCKETS_ENABLED
+  if ((socketMode == TLS) && (tlsSocketsEnabled() == false)) {
+    printLog(WARN, "Local system does not support TLS.  Using plaintext.\n");
+    socketMode = PLAIN;
+  }
+#else
+  socketMode = PLAIN;
+#endif // TLS_SOCKETS_ENABLED
+  
+  if (timeoutMilliseconds != 0) {
+    ZEROINIT(struct pollfd pollDescriptor);
+    pollDescriptor.fd = serverSocket->sockfd;
+    pollDescriptor.events = POLLRDNORM;
+    int pollReturnValue = poll(&pollDescriptor, 1,
+      (timeoutMilliseconds < 0) ? -1 : timeoutMilliseconds);
+    if (pollReturnValue <= 0) {
+      return ((pollReturnValue < 0) && (errno != EINTR)) ? -1 : 0;
+    }
+  }
+  
+  int numAccepted = 0;
+  while (numAccepted < maxSockets) {
+    ZEROINIT(struct sockaddr_in clientAddress);
+    socklen_t clientAddressLength = sizeof(clientAddress);
+#ifdef SOCKET_ACCEPT4_SUPPORTED
+    int clientSockfd = accept4(serverSocket->sockfd,
+      (struct sockaddr*) &clientAddress, &clientAddressLength,
+      SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+    int clientSockfd = (int) accept(serverSocket->sockfd,
+      (struct sockaddr*) &clientAddress, &clientAddressLength);
+#endif // SOCKET_ACCEPT4_SUPPORTED
+    if (clientSockfd < 0) {
+#ifdef _WIN32
+      int error = WSAGetLastError();
+      bool retry = (error == WSAECONNRESET);
+      bool drained = (error == WSAEWOULDBLOCK);
+#else // POSIX
+      // A connection that was reset while it sat in the queue fails the
+      // accept but the ones behind it are still there.
+      bool retry = ((errno == ECONNABORTED) || (errno == EINTR));
+      bool drained = ((errno == EAGAIN) || (errno == EWOULDBLOCK));
+#endif // _WIN32
+      if (retry == true) {
+        continue;
+      } else if (drained == false) {
+        printLog(ERR, "Could not accept client connection: %s\n",
+          strerror(errno));
+        if (numAccepted == 0) {
+          numAccepted = -1;
+        }
+      }
+      break;
+    }
+    
+    Socket *clientSocket = socketCreateAccepted(serverSocket->socketType,
+      TCP, socketMode, clientSockfd, &clientAddress);
+    if (clientSocket == NULL) {
+      break;
+    }
+#ifdef SOCKET_ACCEPT4_SUPPORTED
+    clientSocket->blocking = false;
+#else
+    socketSetNonblocking(clientSocket);
+#endif // SOCKET_ACCEPT4_SUPPORTED
+#ifdef TLS_SOCKETS_ENABLED
+    if (socketMode == TLS) {
+      clientSocket->ssl = SSL_new(serverSocket->sslContext);
+      if (clientSocket->ssl == NULL) {
+        printLog(ERR, "Could not create SSL object for client.\n");
+        clientSocket = socketDestroy(clientSocket);
+        break;
+      }
+      tlsApplyKernelOffload(clientSocket->ssl);
+      SSL_set_fd(clientSocket->ssl, clientSocket->sockfd);
+    }
+#endif // TLS_SOCKETS_ENABLED
+    updateSocketString(clientSocket);
+    clientSockets[numAccepted] = clientSocket;
+    numAccepted++;
+  }
+  
+  printLog(TRACE,
+    "EXIT socketAcceptBatch(serverSocket=%s, clientSockets=%p, "
+    "maxSockets=%d, timeoutMilliseconds=%d) = {%d}\n",
+    socketToString(serverSocket), (void*) clientSockets, maxSockets,
+    timeoutMilliseconds, numAccepted);
+  return numAccepted;
+}
+
+/// @fn const char* socketAddress(Socket *sock)
+///
+/// @brief Get the address associated with a socket.
+///
+/// @param sock The socket to get the address from.
+///
+/// @return Returns a string representation of the address of the socket.
+const char* socketAddress(Socket *sock) {
+  printLog(TRACE, "ENTER socketAddress(sock=%s)\n", socketToString(sock));
+  
+  const char *returnValue = "";
+  if ((sock != NULL) && (sock->address != NULL)) {
+    returnValue = sock->address;
+  }
+  
+  printLog(TRACE, "EXIT socketAddress(sock=%s) = {%s}\n", socketToString(sock),
+    returnValue);
+  return returnValue;
+}
+
+/// @var _emptySocketString
+///
+/// @brief The function socketToString below does not allocate a new string.
+/// In the event that the Socket passed in is NULL, it has to return a static
+/// empty string.  This variable provides that vaule.
+static const char *_emptySocketString = "";
+
+/// @fn const char* socketToString(Socket *sock)
+///
+/// @brief Get a string representation of a Socket.
+///
+/// @param sock The socket to get the representation of.
+///
+/// @return Returns a string representation of the socket.
+const char* socketToString(Socket *sock) {
+  printLog(FLOOD, "ENTER socketToString(sock=%p)\n", (void*) sock);
+  
+  const char *returnValue = _emptySocketString;
+  if ((sock != NULL) && (sock->_str != NULL)) {
+    returnValue = sock->_str;
+  }
+  
+  printLog(FLOOD, "EXIT socketToString(sock=%p) = {%s}\n", (void*) sock,
+    returnValue);
+  return returnValue;
+}
+
+// Client connection pool.
+
+/// @struct SocketPoolEntry
+///
+/// @brief One connection to a SocketPool destination.
+///
+/// @param sock The connected Socket.
+/// @param idle Whether the socket is waiting in the pool (true) or checked
+///   out (false).
+/// @param idleSince When the socket was last released to the pool, in
+///   nanoseconds (see getMonotonicNanoseconds).
+typedef struct SocketPoolEntry {
+  Socket *sock;
+  bool idle;
+  int64_t idleSince;
+} SocketPoolEntry;
+
+/// @struct SocketPoolDestination
+///
+/// @brief The connections a SocketPool has open to one destination.
+///
+/// @param socketProtocol The protocol of the connections.
+/// @param socketMode The mode the connections were requested with.
+/// @param address The "host:port" address of the destination.
+/// @param entries The open connections.  Has room for the pool's
+///   maxSocketsPerDestination.
+/// @param numEntries The number of elements of entries in use.
+/// @param numConnecting The number of connections being established outside
+///   of the pool's lock.  They count against the cap.
+/// @param next The next destination in the pool's list.
+typedef struct SocketPoolDestination {
+  SocketProtocol socketProtocol;
+  int socketMode;
+  char *address;
+  SocketPoolEntry *entries;
+  u32 numEntries;
+  u32 numConnecting;
+  struct SocketPoolDestination *next;
+} SocketPoolDestination;
+
+/// @struct SocketPool
+///
+/// @brief A set of connected client sockets that are handed out for reuse.
+///
+/// @param lock The mutex that guards the rest of the pool.
+/// @param condition Signalled when a connection is released or closed.
+/// @param maxSocketsPerDestination The maximum number of connections, idle or
+///   checked out, to any one destination.
+/// @param idleTimeoutMilliseconds How long a connection may sit idle before
+///   it's closed instead of reused, or 0 for no limit.
+/// @param head The first destination in the list.
+struct SocketPool {
+  mtx_t lock;
+  cnd_t condition;
+  u32 maxSocketsPerDestination;
+  int idleTimeoutMilliseconds;
+  SocketPoolDestination *head;
+};
+
+/// @fn SocketPool* socketPoolCreate(u32 maxSocketsPerDestination, int idleTimeoutMilliseconds)
+///
+/// @brief Create a pool of client connections that are kept open between
+/// uses, so that repeated requests to the same destination don't pay for a
+/// new TCP connection and TLS handshake each time.  A pool may be shared by
+/// multiple threads.
+///
+/// @param maxSocketsPerDestination The maximum number of connections, idle or
+///   checked out, to any one destination.
+/// @param idleTimeoutMilliseconds How long a connection may sit idle before
+///   it's closed instead of reused.  This should be shorter than the idle
+///   timeout of the servers.  0 means no limit.
+///
+/// @return Returns a new SocketPool on success, NULL on failure.
+SocketPool* socketPoolCreate(u32 maxSocketsPerDestination,
+  int idleTimeoutMilliseconds
+) {
+  if (maxSocketsPerDestination == 0) {
+    printLog(ERR, "maxSocketsPerDestination must be at least 1.\n");
+    return NULL;
+  }
+  
+  SocketPool *pool = (SocketPool*) calloc(1, sizeof(SocketPool));
+  if (pool == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  if (mtx_init(&pool->lock, mtx_plain) != thrd_success) {
+    printLog(ERR, "Could not initialize SocketPool lock.\n");
+    free(pool); pool = NULL;
+    return NULL;
+  }
+  if (cnd_init(&pool->condition) != thrd_success) {
+    printLog(ERR, "Could not initialize SocketPool condition.\n");
+    mtx_destroy(&pool->lock);
+    free(pool); pool = NULL;
+    return NULL;
+  }
+  pool->maxSocketsPerDestination = maxSocketsPerDestination;
+  pool->idleTimeoutMilliseconds
+    = (idleTimeoutMilliseconds > 0) ? idleTimeoutMilliseconds : 0;
+  
+  return pool;
+}
+
+/// @fn SocketPool* socketPoolDestroy(SocketPool *pool)
+///
+/// @brief Close a pool's idle connections and free the pool.  Connections
+/// that are still checked out are not closed and must not be released to the
+/// pool afterward.  Destroy them with socketDestroy instead.
+///
+/// @param pool The SocketPool to destroy.
+///
+/// @return Always returns NULL.
+SocketPool* socketPoolDestroy(SocketPool *pool) {
+  if (pool == NULL) {
+    return NULL;
+  }
+  
+  SocketPoolDestination *destination = pool->head;
+  while (destination != NULL) {
+    SocketPoolDestination *next = destination->next;
+    for (u32 ii = 0; ii < destination->numEntries; ii++) {
+      if (destination->entries[ii].idle == true) {
+        socketDestroy(destination->entries[ii].sock);
+      }
+    }
+    free(destination->entries);
+    free(destination->address);
+    free(destination);
+    destination = next;
+  }
+  cnd_destroy(&pool->condition);
+  mtx_destroy(&pool->lock);
+  free(pool); pool = NULL;
+  
+  return NULL;
+}
+
+/// @fn static bool socketPoolSocketAlive(Socket *sock)
+///
+/// @brief Cheaply check whether an idle pooled connection can still be used.
+/// An idle connection should have nothing to read, so if it's readable the
+/// peer has closed it, reset it, or sent something unexpected, and in every
+/// one of those cases it can't be reused.
+///
+/// @param sock The idle Socket to check.
+///
+/// @return Returns true if the connection looks usable, false otherwise.
+static bool socketPoolSocketAlive(Socket *sock) {
+  if (sock->sockfd < 0) {
+    return false;
+  } else if (sock->socketProtocol == UDP) {
+    return true;
+  }
+#ifdef TLS_SOCKETS_ENABLED
+  if ((sock->ssl != NULL) && (SSL_pending(sock->ssl) > 0)) {
+    return false;
+  }
+#endif // TLS_SOCKETS_ENABLED
+  
+  ZEROINIT(struct pollfd pollDescriptor);
+  pollDescriptor.fd = sock->sockfd;
+  pollDescriptor.events = POLLRDNORM;
+  return (poll(&pollDescriptor, 1, 0) == 0);
+}
+
+/// @fn static SocketPoolDestination* socketPoolGetDestination(SocketPool *pool, SocketProtocol socketProtocol, const char *address, int socketMode)
+///
+/// @brief Find a pool's entry for a destination, adding it if it's not there.
+/// Must be called with the pool's lock held.
+///
+/// @param pool The SocketPool to search.
+/// @param socketProtocol The protocol of the destination.
+/// @param address The "host:port" address of the destination.
+/// @param socketMode The mode of the destination.
+///
+/// @return Returns the destination on success, NULL on failure.
+static SocketPoolDestination* socketPoolGetDestination(SocketPool *pool,
+  SocketProtocol socketProtocol, const char *address, int socketMode
+) {
+  for (SocketPoolDestination *destination = pool->head; destination != NULL;
+    destination = destination->next
+  ) {
+    if ((destination->socketProtocol == socketProtocol)
+      && (destination->socketMode == socketMode)
+      && (strcmp(destination->address, address) == 0)
+    ) {
+      return destination;
+    }
+  }
+  
+  SocketPoolDestination *destination = (SocketPoolDestination*) calloc(1,
+    sizeof(SocketPoolDestination));
+  if (destination == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  destination->address = strdup(address);
+  destination->entries = (SocketPoolEntry*) calloc(
+    pool->maxSocketsPerDestination, sizeof(SocketPoolEntry));
+  if ((destination->address == NULL) || (destination->entries == NULL)) {
+    LOG_MALLOC_FAILURE();
+    free(destination->address);
+    free(destination->entries);
+    free(destination); destination = NULL;
+    return NULL;
+  }
+  destination->socketProtocol = socketProtocol;
+  destination->socketMode = socketMode;
+  destination->next = pool->head;
+  pool->head = destination;
+  
+  return destination;
+}
+
+/// @fn Socket* socketPoolAcquire_(SocketPool *pool, SocketProtocol socketProtocol, const char *address, int socketMode, int timeoutMilliseconds, ...)
+///
+/// @brief Get a connected client socket to a destination from a pool.  The
+/// most recently released idle connection that's still usable is handed out.
+/// If there isn't one, a new connection is made unless the destination is
+/// already at the pool's cap, in which case this waits for one to be
+/// released.  Return the socket with socketPoolRelease when done with it.
+///
+/// @param pool The SocketPool to get the socket from.
+/// @param socketProtocol Either TCP or UDP.
+/// @param address The "host:port" address to connect to.
+/// @param socketMode Either PLAIN or TLS.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait for a
+///   connection to be released and, separately, for a new connection to be
+///   established.  A value <= 0 uses socketCreate's default of 30 seconds.
+/// @param ... Any addtional parameters (provided by the wrapper macro) are
+///   ignored.
+///
+/// @return Returns a connected Socket on success, NULL on failure or timeout.
+Socket* socketPoolAcquire_(SocketPool *pool, SocketProtocol socketProtocol,
+  const char *address, int socketMode, int timeoutMilliseconds, ...
+) {
+  printLog(TRACE,
+    "ENTER socketPoolAcquire(pool=%p, socketProtocol=%d, address=%s, "
+    "socketMode=%d, timeoutMilliseconds=%d)\n", (void*) pool, socketProtocol,
+    (address != NULL) ? address : "NULL", socketMode, timeoutMilliseconds);
+  
+  if ((pool == NULL) || (address == NULL)) {
+    printLog(ERR, "NULL pool or address provided.\n");
+    return NULL;
+  }
+  if (timeoutMilliseconds <= 0) {
+    // Same default as socketCreate.
+    timeoutMilliseconds = 30000;
+  }
+  
+  ZEROINIT(struct timespec deadline);
+  timespec_get(&deadline, TIME_UTC);
+  deadline.tv_sec += timeoutMilliseconds / 1000;
+  deadline.tv_nsec += (timeoutMilliseconds % 1000) * 1000000L;
+  if (deadline.tv_nsec >= 1000000000L) {
+    deadline.tv_sec++;
+    deadline.tv_nsec -= 1000000000L;
+  }
+  
+  Socket *sock = NULL;
+  mtx_lock(&pool->lock);
+  SocketPoolDestination *destination = socketPoolGetDestination(pool,
+    socketProtocol, address, socketMode);
+  while ((destination != NULL) && (sock == NULL)) {
+    int64_t now = getMonotonicNanoseconds();
+    int64_t idleTimeout
+      = ((int64_t) pool->idleTimeoutMilliseconds) * ((int64_t) 1000000);
+    // Scan from the end so that the warmest connection is reused first.
+    // Removing an entry moves the last one into its place, which has already
+    // been looked at.
+    for (u32 ii = destination->numEntries; (ii > 0) && (sock == NULL); ii--) {
+      SocketPoolEntry *entry = &destination->entries[ii - 1];
+      if (entry->idle == false) {
+        continue;
+      }
+      if (((idleTimeout == 0) || (now - entry->idleSince < idleTimeout))
+        && (socketPoolSocketAlive(entry->sock) == true)
+      ) {
+        entry->idle = false;
+        sock = entry->sock;
+      } else {
+        socketDestroy(entry->sock);
+        *entry = destination->entries[destination->numEntries - 1];
+        destination->numEntries--;
+      }
+    }
+    if (sock != NULL) {
+      break;
+    }
+    
+    if (destination->numEntries + destination->numConnecting
+      < pool->maxSocketsPerDestination
+    ) {
+      // Connect without holding the lock so that other destinations aren't
+      // held up.  The connection counts against the cap in the meantime.
+      destination->numConnecting++;
+      mtx_unlock(&pool->lock);
+      sock = socketCreate(CLIENT, socketProtocol, address, socketMode,
+        NULL, NULL, timeoutMilliseconds);
+      mtx_lock(&pool->lock);
+      destination->numConnecting--;
+      if (sock != NULL) {
+        SocketPoolEntry *entry
+          = &destination->entries[destination->numEntries];
+        entry->sock = sock;
+        entry->idle = false;
+        destination->numEntries++;
+      } else {
+        // Let a waiter try its luck.
+        cnd_signal(&pool->condition);
+      }
+      break;
+    }
+    
+    if (cnd_timedwait(&pool->condition, &pool->lock, &deadline)
+      != thrd_success
+    ) {
+      printLog(ERR, "Timed out waiting for a connection to %s.\n", address);
+      break;
+    }
+  }
+  mtx_unlock(&pool->lock);
+  
+  printLog(TRACE,
+    "EXIT socketPoolAcquire(pool=%p, socketProtocol=%d, address=%s, "
+    "socketMode=%d, timeoutMilliseconds=%d) = {%p}\n", (void*) pool,
+    socketProtocol, address, socketMode, timeoutMilliseconds, (void*) sock);
+  return sock;
+}
+
+/// @fn int socketPoolRelease(SocketPool *pool, Socket *sock, bool reusable)
+///
+/// @brief Return a socket obtained from socketPoolAcquire to its pool.
+///
+/// @param pool The SocketPool the socket came from.
+/// @param sock The Socket to return.
+/// @param reusable Whether or not the connection can be used for another
+///   request.  Pass false if the last exchange failed or didn't finish
+///   cleanly (for example, part of a response was left unread), and the
+///   connection is closed instead of kept.
+///
+/// @return Returns 0 on success, -1 if the socket doesn't belong to the pool.
+int socketPoolRelease(SocketPool *pool, Socket *sock, bool reusable) {
+  if ((pool == NULL) || (sock == NULL)) {
+    printLog(ERR, "NULL pool or socket provided.\n");
+    return -1;
+  }
+  
+  Socket *toDestroy = NULL;
+  int returnValue = -1;
+  mtx_lock(&pool->lock);
+  for (SocketPoolDestination *destination = pool->head;
+    (destination != NULL) && (returnValue != 0);
+    destination = destination->next
+  ) {
+    if (destination->socketProtocol != sock->socketProtocol) {
+      continue;
+    }
+    for (u32 ii = 0; ii < destination->numEntries; ii++) {
+      SocketPoolEntry *entry = &destination->entries[ii];
+      if (entry->sock != sock) {
+        continue;
+      }
+      if ((reusable == true) && (sock->sockfd >= 0)) {
+        entry->idle = true;
+        entry->idleSince = getMonotonicNanoseconds();
+      } else {
+        toDestroy = sock;
+        *entry = destination->entries[destination->numEntries - 1];
+        destination->numEntries--;
+      }
+      cnd_signal(&pool->condition);
+      returnValue = 0;
+      break;
+    }
+  }
+  mtx_unlock(&pool->lock);
+  
+  if (returnValue != 0) {
+    printLog(ERR, "Socket %p does not belong to pool %p.\n",
+      (void*) sock, (void*) pool);
+  }
+  socketDestroy(toDestroy);
+  
+  return returnValue;
+}
+
+/// @fn u32 socketPoolNumIdle(SocketPool *pool)
+///
+/// @brief Get the number of idle connections held by a pool across all of its
+/// destinations.
+///
+/// @param pool The SocketPool to examine.
+///
+/// @return Returns the number of idle connections, 0 if pool is NULL.
+u32 socketPoolNumIdle(SocketPool *pool) {
+  if (pool == NULL) {
+    return 0;
+  }
+  
+  u32 numIdle = 0;
+  mtx_lock(&pool->lock);
+  for (SocketPoolDestination *destination = pool->head; destination != NULL;
+    destination = destination->next
+  ) {
+    for (u32 ii = 0; ii < destination->numEntries; ii++) {
+      numIdle += (destination->entries[ii].idle == true) ? 1 : 0;
+    }
+  }
+  mtx_unlock(&pool->lock);
+  
+  return numIdle;
+}
+
+// Reactor support.
+
+/// @def SOCKET_REACTOR_MAX_EVENTS
+///
+/// @brief The maximum number of readiness events to collect from the kernel in
+/// one call in socketReactorRun.
+#define SOCKET_REACTOR_MAX_EVENTS 64
+
+#ifdef SOCKET_REACTOR_IO_URING
+/// @def SOCKET_REACTOR_RING_ENTRIES
+///
+/// @brief The number of submission queue entries of a reactor's io_uring.  A
+/// reactor with more waits than this outstanding submits them in batches of
+/// this size.
+#define SOCKET_REACTOR_RING_ENTRIES 256
+
+/// @def SOCKET_REACTOR_NO_SLOT
+///
+/// @brief The slot of a SocketReactorWaiter that has no wait armed in the
+/// reactor's io_uring.
+#define SOCKET_REACTOR_NO_SLOT UINT32_MAX
+
+/// @def SOCKET_REACTOR_IGNORE
+///
+/// @brief The user data of io_uring operations whose completions the reactor
+/// ignores.
+#define SOCKET_REACTOR_IGNORE UINT64_MAX
+
+/// @struct SocketReactorSlot
+///
+/// @brief Maps the user data of an io_uring poll back to its waiter.  Waiters
+/// live on coroutine stacks, so a completion that arrives after its waiter
+/// has gone must not be traced back to it.  The generation changes every time
+/// the slot is freed, so stale completions don't match.
+///
+/// @param waiter The waiter using the slot, or NULL if the slot is free.
+/// @param generation The generation of the slot's current use.
+/// @param nextFree The index of the next free slot if this one is free.
+typedef struct SocketReactorSlot {
+  struct SocketReactorWaiter *waiter;
+  u32 generation;
+  u32 nextFree;
+} SocketReactorSlot;
+#endif // SOCKET_REACTOR_IO_URING
+
+/// @struct SocketReactorWaiter
+///
+/// @brief A Coroutine parked in socketReactorWait.  Lives on the parked
+/// coroutine's stack for as long as it waits.
+///
+/// @param fd The socket file descriptor being waited on.
+/// @param events The SOCKET_READABLE and/or SOCKET_WRITABLE events of
+///   interest.
+/// @param revents The events that were reported ready.
+/// @param coroutine The Coroutine to resume when the wait is over.
+/// @param deadline The time (in nanoseconds, see getMonotonicNanoseconds) at
+///   which to give up, or -1 for no timeout.
+/// @param done Whether or not the wait is over, either because the socket is
+///   ready or because the deadline has passed.
+/// @param linked Whether or not this waiter is on the reactor's list.
+/// @param slot The index of the waiter's SocketReactorSlot when the reactor
+///   uses io_uring.
+/// @param prev The previous waiter in the reactor's list.
+/// @param next The next waiter in the reactor's list.
+typedef struct SocketReactorWaiter {
+  int fd;
+  int events;
+  int revents;
+  Coroutine *coroutine;
+  int64_t deadline;
+  bool done;
+  bool linked;
+  u32 slot;
+  struct SocketReactorWaiter *prev;
+  struct SocketReactorWaiter *next;
+} SocketReactorWaiter;
+
+/// @struct SocketReactor
+///
+/// @brief An event loop that resumes Coroutines parked on sockets.  A reactor
+/// must only be used from the thread that created it.
+///
+/// @param fd The epoll or kqueue file descriptor.
+/// @param ring The io_uring the reactor uses instead of epoll, if any.
+/// @param slots The table that maps io_uring user data to waiters.
+/// @param numSlots The allocated number of elements of slots.
+/// @param freeSlot The index of the first free slot, or
+///   SOCKET_REACTOR_NO_SLOT if there are none.
+/// @param pollDescriptors Scratch array of pollfds for the poll backend.
+/// @param pollWaiters The waiter that corresponds to each pollDescriptor.
+/// @param pollCapacity The allocated number of elements of the two arrays
+///   above.
+/// @param head The first waiter in the list of parked coroutines.
+/// @param numWaiters The number of waiters in the list.
+struct SocketReactor {
+#if defined(SOCKET_REACTOR_EPOLL) || defined(SOCKET_REACTOR_KQUEUE)
+  int fd;
+#else
+  struct pollfd *pollDescriptors;
+  SocketReactorWaiter **pollWaiters;
+  size_t pollCapacity;
+#endif
+#ifdef SOCKET_REACTOR_IO_URING
+  IoUring *ring;
+  SocketReactorSlot *slots;
+  u32 numSlots;
+  u32 freeSlot;
+#endif // SOCKET_REACTOR_IO_URING
+  SocketReactorWaiter *head;
+  size_t numWaiters;
+};
+
+/// @fn static bool socketReactorWouldBlock(void)
+///
+/// @brief Determine whether the last socket call failed only because it would
+/// have blocked.
+///
+/// @return Returns true if the operation should be retried once the socket is
+/// ready, false otherwise.
+static bool socketReactorWouldBlock(void) {
+#ifdef _WIN32
+  int error = WSAGetLastError();
+  return ((error == WSAEWOULDBLOCK) || (error == WSAEINPROGRESS));
+#else // POSIX
+  return ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR));
+#endif // _WIN32
+}
+
+/// @fn static int socketReactorPollEvents(int events)
+///
+/// @brief Convert SOCKET_READABLE and SOCKET_WRITABLE flags to poll events.
+///
+/// @param events The SOCKET_READABLE and/or SOCKET_WRITABLE flags to convert.
+///
+/// @return Returns the equivalent poll event flags.
+static int socketReactorPollEvents(int events) {
+  int pollEvents = 0;
+  if (events & SOCKET_READABLE) {
+    pollEvents |= POLLRDNORM;
+  }
+  if (events & SOCKET_WRITABLE) {
+    pollEvents |= POLLWRNORM;
+  }
+  
+  return pollEvents;
+}
+
+/// @fn static int socketReactorPollRevents(int events, int pollRevents)
+///
+/// @brief Convert the poll revents of a descriptor into SOCKET_READABLE and
+/// SOCKET_WRITABLE flags.  Errors and hangups report every requested event as
+/// ready so that the caller's next I/O call sees the error.
+///
+/// @param events The SOCKET_READABLE and/or SOCKET_WRITABLE flags requested.
+/// @param pollRevents The revents reported by poll.
+///
+/// @return Returns the ready SOCKET_READABLE and SOCKET_WRITABLE flags.
+static int socketReactorPollRevents(int events, int pollRevents) {
+  int revents = 0;
+  if (pollRevents & (POLLERR | POLLHUP | POLLNVAL)) {
+    revents = events;
+  }
+  if (pollRevents & POLLRDNORM) {
+    revents |= SOCKET_READABLE;
+  }
+  if (pollRevents & POLLWRNORM) {
+    revents |= SOCKET_WRITABLE;
+  }
+  
+  return revents & events;
+}
+
+/// @fn static int socketReactorPollFd(int fd, int events, int timeoutMilliseconds)
+///
+/// @brief Wait for a socket to become ready by blocking the calling thread in
+/// poll.  Used when there's no coroutine to park.
+///
+/// @param fd The socket file descriptor to wait on.
+/// @param events The SOCKET_READABLE and/or SOCKET_WRITABLE events to wait for.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait, 0 to
+///   not wait at all, or a negative value to wait indefinitely.
+///
+/// @return Returns the ready events on success, 0 on timeout, -1 on error.
+static int socketReactorPollFd(int fd, int events, int timeoutMilliseconds) {
+  ZEROINIT(struct pollfd pollDescriptor);
+  pollDescriptor.fd = fd;
+  pollDescriptor.events = (short) socketReactorPollEvents(events);
+  int pollReturnValue = poll(&pollDescriptor, 1,
+    (timeoutMilliseconds < 0) ? -1 : timeoutMilliseconds);
+  if (pollReturnValue <= 0) {
+    return pollReturnValue;
+  }
+  
+  return socketReactorPollRevents(events, pollDescriptor.revents);
+}
+
+/// @var _socketIoUring
+///
+/// @brief Whether or not new reactors use io_uring instead of epoll.
+static bool _socketIoUring = false;
+
+/// @fn void socketSetIoUring(bool enabled)
+///
+/// @brief Enable or disable io_uring for SocketReactors created after this
+/// call.  With io_uring, the readiness waits that parked coroutines register
+/// are queued in shared memory and handed to the kernel together, along with
+/// the wait for their completions, in one system call per socketReactorRun
+/// instead of one epoll_ctl call per wait.  Reactors silently use epoll when
+/// io_uring isn't available.  Only has an effect on Linux.
+///
+/// @param enabled Whether or not to use io_uring.
+///
+/// @return This function returns no value.
+void socketSetIoUring(bool enabled) {
+  _socketIoUring = enabled;
+}
+
+/// @fn bool socketIoUring(void)
+///
+/// @brief Determine whether or not io_uring is requested for new
+/// SocketReactors.
+///
+/// @return Returns the value last passed to socketSetIoUring.
+bool socketIoUring(void) {
+  return _socketIoUring;
+}
+
+/// @fn bool socketReactorUsesIoUring(SocketReactor *reactor)
+///
+/// @brief Determine whether or not a reactor uses io_uring.
+///
+/// @param reactor The SocketReactor to examine.
+///
+/// @return Returns true if the reactor uses io_uring, false otherwise.
+bool socketReactorUsesIoUring(SocketReactor *reactor) {
+#ifdef SOCKET_REACTOR_IO_URING
+  return (reactor != NULL) && (reactor->ring != NULL);
+#else
+  (void) reactor;
+  return false;
+#endif // SOCKET_REACTOR_IO_URING
+}
+
+#ifdef SOCKET_REACTOR_IO_URING
+/// @fn static int socketReactorRingLink(SocketReactor *reactor, SocketReactorWaiter *waiter)
+///
+/// @brief Give a waiter a slot and queue a one-shot poll for it on the
+/// reactor's io_uring.  The poll is submitted by the next socketReactorRun.
+///
+/// @param reactor The SocketReactor to queue the poll on.
+/// @param waiter The SocketReactorWaiter to queue the poll for.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int socketReactorRingLink(SocketReactor *reactor,
+  SocketReactorWaiter *waiter
+) {
+  if (reactor->freeSlot == SOCKET_REACTOR_NO_SLOT) {
+    u32 numSlots = (reactor->numSlots > 0) ? reactor->numSlots * 2 : 64;
+    SocketReactorSlot *slots = (SocketReactorSlot*) realloc(reactor->slots,
+      numSlots * sizeof(SocketReactorSlot));
+    if (slots == NULL) {
+      LOG_MALLOC_FAILURE();
+      return -1;
+    }
+    for (u32 ii = reactor->numSlots; ii < numSlots; ii++) {
+      slots[ii].waiter = NULL;
+      slots[ii].generation = 0;
+      slots[ii].nextFree
+        = (ii + 1 < numSlots) ? ii + 1 : SOCKET_REACTOR_NO_SLOT;
+    }
+    reactor->freeSlot = reactor->numSlots;
+    reactor->slots = slots;
+    reactor->numSlots = numSlots;
+  }
+  
+  u32 slot = reactor->freeSlot;
+  u64 userData = (((u64) reactor->slots[slot].generation) << 32) | slot;
+  if (ioUringQueuePoll(reactor->ring, waiter->fd,
+    (u32) socketReactorPollEvents(waiter->events), userData) != 0
+  ) {
+    printLog(ERR, "Could not queue poll of socket %d.\n", waiter->fd);
+    return -1;
+  }
+  reactor->freeSlot = reactor->slots[slot].nextFree;
+  reactor->slots[slot].waiter = waiter;
+  waiter->slot = slot;
+  
+  return 0;
+}
+
+/// @fn static void socketReactorRingFreeSlot(SocketReactor *reactor, SocketReactorWaiter *waiter)
+///
+/// @brief Free a waiter's slot so that completions for it are ignored.
+///
+/// @param reactor The SocketReactor that owns the slot.
+/// @param waiter The SocketReactorWaiter to free the slot of.
+///
+/// @return This function returns no value.
+static void socketReactorRingFreeSlot(SocketReactor *reactor,
+  SocketReactorWaiter *waiter
+) {
+  SocketReactorSlot *slot = &reactor->slots[waiter->slot];
+  slot->waiter = NULL;
+  slot->generation++;
+  slot->nextFree = reactor->freeSlot;
+  reactor->freeSlot = waiter->slot;
+  waiter->slot = SOCKET_REACTOR_NO_SLOT;
+  
+  return;
+}
+#endif // SOCKET_REACTOR_IO_URING
+
+/// @fn static int socketReactorLink(SocketReactor *reactor, SocketReactorWaiter *waiter)
+///
+/// @brief Add a waiter to a reactor's list and register its interest with the
+/// kernel.
+///
+/// @param reactor The SocketReactor to add the waiter to.
+/// @param waiter The SocketReactorWaiter to add.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int socketReactorLink(SocketReactor *reactor,
+  SocketReactorWaiter *waiter
+) {
+#if defined(SOCKET_REACTOR_EPOLL)
+  if (reactor->ring != NULL) {
+    if (socketReactorRingLink(reactor, waiter) != 0) {
+      return -1;
+    }
+  } else {
+    ZEROINIT(struct epoll_event event);
+    event.events = EPOLLONESHOT;
+    if (waiter->events & SOCKET_READABLE) {
+      event.events |= EPOLLIN;
+    }
+    if (waiter->events & SOCKET_WRITABLE) {
+      event.events |= EPOLLOUT;
+    }
+    event.data.ptr = waiter;
+    if (epoll_ctl(reactor->fd, EPOLL_CTL_ADD, waiter->fd, &event) != 0) {
+      printLog(ERR, "Could not add socket %d to epoll: %s\n",
+        waiter->fd, strerror(errno));
+      return -1;
+    }
+  }
+#elif defined(SOCKET_REACTOR_KQUEUE)
+  struct kevent changes[2];
+  int numChanges = 0;
+  if (waiter->events & SOCKET_READABLE) {
+    EV_SET(&changes[numChanges], waiter->fd, EVFILT_READ,
+      EV_ADD | EV_ONESHOT, 0, 0, waiter);
+    numChanges++;
+  }
+  if (waiter->events & SOCKET_WRITABLE) {
+    EV_SET(&changes[numChanges], waiter->fd, EVFILT_WRITE,
+      EV_ADD | EV_ONESHOT, 0, 0, waiter);
+    numChanges++;
+  }
+  if (kevent(reactor->fd, changes, numChanges, NULL, 0, NULL) != 0) {
+    printLog(ERR, "Could not add socket %d to kqueue: %s\n",
+      waiter->fd, strerror(errno));
+    return -1;
+  }
+#endif // SOCKET_REACTOR_EPOLL
+
+  waiter->prev = NULL;
+  waiter->next = reactor->head;
+  if (reactor->head != NULL) {
+    reactor->head->prev = waiter;
+  }
+  reactor->head = waiter;
+  reactor->numWaiters++;
+  waiter->linked = true;
+  
+  return 0;
+}
+
+/// @fn static void socketReactorUnlink(SocketReactor *reactor, SocketReactorWaiter *waiter)
+///
+/// @brief Remove a waiter from a reactor's list and withdraw its interest from
+/// the kernel.  Does nothing if the waiter isn't on the list.
+///
+/// @param reactor The SocketReactor to remove the waiter from.
+/// @param waiter The SocketReactorWaiter to remove.
+///
+/// @return This function returns no value.
+static void socketReactorUnlink(SocketReactor *reactor,
+  SocketReactorWaiter *waiter
+) {
+  if (waiter->linked == false) {
+    return;
+  }
+
+#if defined(SOCKET_REACTOR_EPOLL)
+  if (reactor->ring != NULL) {
+    if (waiter->slot != SOCKET_REACTOR_NO_SLOT) {
+      // The poll is still armed.  Withdraw it with the next submission.  Its
+      // completion, if any, won't match the freed slot.
+      ioUringQueuePollRemove(reactor->ring,
+        (((u64) reactor->slots[waiter->slot].generation) << 32)
+          | waiter->slot,
+        SOCKET_REACTOR_IGNORE);
+      socketReactorRingFreeSlot(reactor, waiter);
+    }
+  } else {
+    // The descriptor may already have been closed, which removes it from the
+    // epoll set for us, so failure here is fine.
+    ZEROINIT(struct epoll_event event);
+    epoll_ctl(reactor->fd, EPOLL_CTL_DEL, waiter->fd, &event);
+  }
+#elif defined(SOCKET_REACTOR_KQUEUE)
+  // One-shot filters that fired are already gone, so failure here is fine.
+  struct kevent change;
+  if (waiter->events & SOCKET_READABLE) {
+    EV_SET(&change, waiter->fd, EVFILT_READ, EV_DELETE, 0, 0, NULL);
+    kevent(reactor->fd, &change, 1, NULL, 0, NULL);
+  }
+  if (waiter->events & SOCKET_WRITABLE) {
+    EV_SET(&change, waiter->fd, EVFILT_WRITE, EV_DELETE, 0, 0, NULL);
+    kevent(reactor->fd, &change, 1, NULL, 0, NULL);
+  }
+#endif // SOCKET_REACTOR_EPOLL
+
+  if (waiter->prev != NULL) {
+    waiter->prev->next = waiter->next;
+  } else {
+    reactor->head = waiter->next;
+  }
+  if (waiter->next != NULL) {
+    waiter->next->prev = waiter->prev;
+  }
+  waiter->prev = NULL;
+  waiter->next = NULL;
+  reactor->numWaiters--;
+  waiter->linked = false;
+  
+  return;
+}
+
+/// @fn static int socketReactorWaitFd(SocketReactor *reactor, int fd, int events, int timeoutMilliseconds)
+///
+/// @brief Park the running Coroutine until a socket is ready or a timeout
+/// expires.  If there's no running coroutine (or no reactor), block the
+/// calling thread in poll instead.
+///
+/// @param reactor The SocketReactor that will resume the coroutine.
+/// @param fd The socket file descriptor to wait on.
+/// @param events The SOCKET_READABLE and/or SOCKET_WRITABLE events to wait for.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait, 0 to
+///   not wait at all, or a negative value to wait indefinitely.
+///
+/// @return Returns the ready events on success, 0 on timeout, -1 on error.
+static int socketReactorWaitFd(SocketReactor *reactor, int fd, int events,
+  int timeoutMilliseconds
+) {
+  if ((fd < 0) || ((events & (SOCKET_READABLE | SOCKET_WRITABLE)) == 0)) {
+    return -1;
+  }
+  
+  // The first (main) coroutine of a thread is the only one on the running list
+  // that has no next coroutine.  It can't yield, so it has to block.
+  Coroutine *running = getRunningCoroutine();
+  if ((reactor == NULL) || (running == NULL) || (running->nextInList == NULL)
+    || (timeoutMilliseconds == 0)
+  ) {
+    return socketReactorPollFd(fd, events, timeoutMilliseconds);
+  }
+  
+  ZEROINIT(SocketReactorWaiter waiter);
+  waiter.fd = fd;
+  waiter.events = events;
+  waiter.coroutine = running;
+  waiter.deadline = -1;
+  if (timeoutMilliseconds > 0) {
+    waiter.deadline = getMonotonicNanoseconds()
+      + (((int64_t) timeoutMilliseconds) * ((int64_t) 1000000));
+  }
+  if (socketReactorLink(reactor, &waiter) != 0) {
+    return -1;
+  }
+  
+  while (waiter.done == false) {
+    coroutineYield(
+      (waiter.deadline >= 0) ? COROUTINE_TIMEDWAIT : COROUTINE_WAIT);
+    if (waiter.done == false) {
+      // Something other than the reactor resumed us (another scheduling loop,
+      // for example).  Check for ourselves so that we still make progress.
+      int revents = socketReactorPollFd(fd, events, 0);
+      if (revents != 0) {
+        waiter.revents = (revents > 0) ? revents : events;
+        waiter.done = true;
+      } else if ((waiter.deadline >= 0)
+        && (getMonotonicNanoseconds() >= waiter.deadline)
+      ) {
+        waiter.done = true;
+      }
+    }
+  }
+  socketReactorUnlink(reactor, &waiter);
+  
+  return waiter.revents;
+}
+
+/// @fn SocketReactor* socketReactorCreate(void)
+///
+/// @brief Create a SocketReactor backed by epoll on Linux (or io_uring, see
+/// socketSetIoUring), kqueue on the BSDs and macOS, and poll everywhere else.
+///
+/// @return Returns a pointer to the new SocketReactor on success, NULL on
+/// failure.
+SocketReactor* socketReactorCreate(void) {
+  printLog(TRACE, "ENTER socketReactorCreate()\n");
+  
+  SocketReactor *reactor = (SocketReactor*) calloc(1, sizeof(SocketReactor));
+  if (reactor == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+
+#if defined(SOCKET_REACTOR_EPOLL)
+  reactor->freeSlot = SOCKET_REACTOR_NO_SLOT;
+  if (_socketIoUring == true) {
+    reactor->ring = ioUringCreate(SOCKET_REACTOR_RING_ENTRIES);
+  }
+  // The epoll descriptor goes unused with io_uring, but it's cheap and having
+  // it either way keeps setup and teardown in one place.
+  reactor->fd = epoll_create1(EPOLL_CLOEXEC);
+#elif defined(SOCKET_REACTOR_KQUEUE)
+  reactor->fd = kqueue();
+#endif // SOCKET_REACTOR_EPOLL
+#if defined(SOCKET_REACTOR_EPOLL) || defined(SOCKET_REACTOR_KQUEUE)
+  if (reactor->fd < 0) {
+    printLog(ERR, "Could not create reactor descriptor: %s\n",
+      strerror(errno));
+#ifdef SOCKET_REACTOR_IO_URING
+    reactor->ring = ioUringDestroy(reactor->ring);
+#endif // SOCKET_REACTOR_IO_URING
+    free(reactor); reactor = NULL;
+    printLog(TRACE, "EXIT socketReactorCreate() = {NULL}\n");
+    return NULL;
+  }
+#endif
+
+  printLog(TRACE, "EXIT socketReactorCreate() = {%p}\n", (void*) reactor);
+  return reactor;
+}
+
+/// @fn SocketReactor* socketReactorDestroy(SocketReactor *reactor)
+///
+/// @brief Free a SocketReactor.  Any coroutines still parked on it are resumed
+/// first and see their waits time out.
+///
+/// @param reactor The SocketReactor to destroy.
+///
+/// @return Always returns NULL.
+SocketReactor* socketReactorDestroy(SocketReactor *reactor) {
+  printLog(TRACE, "ENTER socketReactorDestroy(reactor=%p)\n", (void*) reactor);
+  
+  if (reactor == NULL) {
+    printLog(TRACE, "EXIT socketReactorDestroy(reactor=NULL) = {NULL}\n");
+    return NULL;
+  }
+  
+  while (reactor->head != NULL) {
+    SocketReactorWaiter *waiter = reactor->head;
+    Coroutine *coroutine = waiter->coroutine;
+    waiter->done = true;
+    socketReactorUnlink(reactor, waiter);
+    coroutineResume(coroutine, NULL);
+  }
+
+#ifdef SOCKET_REACTOR_IO_URING
+  reactor->ring = ioUringDestroy(reactor->ring);
+  free(reactor->slots); reactor->slots = NULL;
+#endif // SOCKET_REACTOR_IO_URING
+#if defined(SOCKET_REACTOR_EPOLL) || defined(SOCKET_REACTOR_KQUEUE)
+  close(reactor->fd);
+#else
+  free(reactor->pollDescriptors);
+  free(reactor->pollWaiters);
+#endif
+  free(reactor); reactor = NULL;
+  
+  printLog(TRACE, "EXIT socketReactorDestroy(reactor=%p) = {NULL}\n",
+    (void*) reactor);
+  return NULL;
+}
+
+/// @fn size_t socketReactorNumWaiters(SocketReactor *reactor)
+///
+/// @brief Get the number of coroutines parked on a reactor.
+///
+/// @param reactor The SocketReactor to examine.
+///
+/// @return Returns the number of parked coroutines, 0 if reactor is NULL.
+size_t socketReactorNumWaiters(SocketReactor *reactor) {
+  return (reactor != NULL) ? reactor->numWaiters : 0;
+}
+
+/// @fn int socketReactorRun(SocketReactor *reactor, int timeoutMilliseconds)
+///
+/// @brief Wait for parked sockets to become ready and resume the coroutines
+/// that were waiting on them, along with any whose timeouts have expired.
+/// This must be called from outside of the parked coroutines, normally as the
+/// main loop of the thread's first coroutine.
+///
+/// @param reactor The SocketReactor to run.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait for
+///   an event, 0 to not wait at all, or a negative value to wait until at
+///   least one parked coroutine can be resumed.
+///
+/// @return Returns the number of coroutines resumed on success (0 if none were
+/// parked or the timeout expired), -1 on error.
+int socketReactorRun(SocketReactor *reactor, int timeoutMilliseconds) {
+  printLog(FLOOD, "ENTER socketReactorRun(reactor=%p, timeoutMilliseconds=%d)\n",
+    (void*) reactor, timeoutMilliseconds);
+  
+  if (reactor == NULL) {
+    printLog(ERR, "NULL reactor provided.\n");
+    return -1;
+  } else if (reactor->head == NULL) {
+    // Nothing to wait for.
+    return 0;
+  }
+  
+  // Don't sleep past the earliest deadline.
+  int64_t now = getMonotonicNanoseconds();
+  for (SocketReactorWaiter *cur = reactor->head; cur != NULL; cur = cur->next) {
+    if (cur->deadline >= 0) {
+      int64_t untilDeadline = (cur->deadline - now + 999999) / 1000000;
+      if (untilDeadline < 0) {
+        untilDeadline = 0;
+      }
+      if ((timeoutMilliseconds < 0)
+        || (untilDeadline < (int64_t) timeoutMilliseconds)
+      ) {
+        timeoutMilliseconds = (int) untilDeadline;
+      }
+    }
+  }
+  
+  // Collect the waiters that are done on a separate list before resuming any
+  // of them.  A resumed coroutine may park again and change the reactor's list
+  // out from under us.
+  SocketReactorWaiter *ready = NULL;
+  int numEvents = 0;
+#if defined(SOCKET_REACTOR_EPOLL)
+  if (reactor->ring != NULL) {
+    // Submitting the polls queued since the last run and waiting for
+    // completions is a single system call.
+    numEvents = ioUringSubmitAndWait(reactor->ring, timeoutMilliseconds);
+    IoUringCompletion completion;
+    while (ioUringPeekCompletion(reactor->ring, &completion) == true) {
+      u32 slot = (u32) (completion.userData & 0xffffffff);
+      if ((completion.userData == SOCKET_REACTOR_IGNORE)
+        || (slot >= reactor->numSlots)
+        || (reactor->slots[slot].waiter == NULL)
+        || (reactor->slots[slot].generation
+          != (u32) (completion.userData >> 32))
+      ) {
+        // Stale completion for a waiter that's already gone.
+        continue;
+      }
+      SocketReactorWaiter *waiter = reactor->slots[slot].waiter;
+      socketReactorRingFreeSlot(reactor, waiter);
+      waiter->revents = (completion.result < 0) ? waiter->events
+        : socketReactorPollRevents(waiter->events, completion.result);
+      waiter->done = true;
+      socketReactorUnlink(reactor, waiter);
+      waiter->next = ready;
+      ready = waiter;
+    }
+  } else {
+    struct epoll_event events[SOCKET_REACTOR_MAX_EVENTS];
+    numEvents = epoll_wait(reactor->fd, events, SOCKET_REACTOR_MAX_EVENTS,
+      timeoutMilliseconds);
+    for (int ii = 0; ii < numEvents; ii++) {
+      SocketReactorWaiter *waiter
+        = (SocketReactorWaiter*) events[ii].data.ptr;
+      int revents = 0;
+      if (events[ii].events & (EPOLLERR | EPOLLHUP)) {
+        revents = waiter->events;
       }
-      clientSockfd = accept(sockfd,
-        (struct sockaddr *) &clientAddress, &clientAddressLength);
+      if (events[ii].events & EPOLLIN) {
+        revents |= SOCKET_READABLE;
+      }
+      if (events[ii].events & EPOLLOUT) {
+        revents |= SOCKET_WRITABLE;
+      }
+      waiter->revents = revents & waiter->events;
+      waiter->done = true;
+      socketReactorUnlink(reactor, waiter);
+      waiter->next = ready;
+      ready = waiter;
     }
-    if (clientSockfd < 0) {
-      printLog(ERR, "Could not accept client connection.\n");
-      // We may be in this state because the socket was destroyed.
-      // Don't call socketToString.
-#ifdef TLS_SOCKETS_ENABLED
-      SSL_free(clientSsl); clientSsl = NULL;
-#endif
-      printLog(TRACE,
-        "EXIT socketAccept(serverSocket=%p, buf=%p, len=%d) = {NULL}\n",
-        (void*) serverSocket, (void*) buf, len);
-      return NULL;
+  }
+#elif defined(SOCKET_REACTOR_KQUEUE)
+  struct kevent events[SOCKET_REACTOR_MAX_EVENTS];
+  struct timespec timeout;
+  timeout.tv_sec = timeoutMilliseconds / 1000;
+  timeout.tv_nsec = (timeoutMilliseconds % 1000) * 1000000;
+  numEvents = kevent(reactor->fd, NULL, 0, events, SOCKET_REACTOR_MAX_EVENTS,
+    (timeoutMilliseconds < 0) ? NULL : &timeout);
+  for (int ii = 0; ii < numEvents; ii++) {
+    SocketReactorWaiter *waiter = (SocketReactorWaiter*) events[ii].udata;
+    if (waiter->done == true) {
+      // Both of its filters fired.
+      waiter->revents |= (events[ii].filter == EVFILT_READ)
+        ? SOCKET_READABLE : SOCKET_WRITABLE;
+      continue;
     }
-  } else { // serverSocket->socketProtocol == UDP
-    recvfrom(sockfd, buf, (size_t) len, 0,
-      (struct sockaddr*) &clientAddress, &clientAddressLength);
-    clientSockfd = socket(AF_INET, SOCK_DGRAM, 0);
+    waiter->revents = (events[ii].flags & EV_EOF) ? waiter->events : 0;
+    waiter->revents |= (events[ii].filter == EVFILT_READ)
+      ? SOCKET_READABLE : SOCKET_WRITABLE;
+    waiter->revents &= waiter->events;
+    waiter->done = true;
+    socketReactorUnlink(reactor, waiter);
+    waiter->next = ready;
+    ready = waiter;
   }
-  
-  Socket *clientSocket = (Socket*) calloc(1, sizeof(Socket));
-  if (clientSocket == NULL) {
-    // Out of memory.  Don't attempt to log our exit.
-    LOG_MALLOC_FAILURE();
-    rawSocketClose(clientSockfd);
-    return NULL;
+#else // SOCKET_REACTOR_POLL
+  if (reactor->pollCapacity < reactor->numWaiters) {
+    size_t pollCapacity = reactor->numWaiters * 2;
+    struct pollfd *pollDescriptors = (struct pollfd*) realloc(
+      reactor->pollDescriptors, pollCapacity * sizeof(struct pollfd));
+    if (pollDescriptors == NULL) {
+      LOG_MALLOC_FAILURE();
+      return -1;
+    }
+    reactor->pollDescriptors = pollDescriptors;
+    SocketReactorWaiter **pollWaiters = (SocketReactorWaiter**) realloc(
+      reactor->pollWaiters, pollCapacity * sizeof(SocketReactorWaiter*));
+    if (pollWaiters == NULL) {
+      LOG_MALLOC_FAILURE();
+      return -1;
+    }
+    reactor->pollWaiters = pollWaiters;
+    reactor->pollCapacity = pollCapacity;
   }
-  if (mtx_init(&clientSocket->lock, mtx_recursive) != thrd_success) {
-    printLog(ERR, "Could initialize Socket lock.\n");
-    free(clientSocket); clientSocket = NULL;
-#ifdef TLS_SOCKETS_ENABLED
-    SSL_free(clientSsl); clientSsl = NULL;
-#endif
-    rawSocketClose(clientSockfd);
-    printLog(TRACE,
-      "EXIT socketAccept(serverSocket=%p, buf=%p, len=%d) = {NULL}\n",
-      (void*) serverSocket, (void*) buf, len);
-    return NULL;
+  size_t numDescriptors = 0;
+  for (SocketReactorWaiter *cur = reactor->head; cur != NULL; cur = cur->next) {
+    reactor->pollDescriptors[numDescriptors].fd = cur->fd;
+    reactor->pollDescriptors[numDescriptors].events
+      = (short) socketReactorPollEvents(cur->events);
+    reactor->pollDescriptors[numDescriptors].revents = 0;
+    reactor->pollWaiters[numDescriptors] = cur;
+    numDescriptors++;
+  }
+  numEvents = poll(reactor->pollDescriptors, numDescriptors,
+    timeoutMilliseconds);
+  for (size_t ii = 0; (numEvents > 0) && (ii < numDescriptors); ii++) {
+    if (reactor->pollDescriptors[ii].revents == 0) {
+      continue;
+    }
+    SocketReactorWaiter *waiter = reactor->pollWaiters[ii];
+    waiter->revents = socketReactorPollRevents(waiter->events,
+      reactor->pollDescriptors[ii].revents);
+    waiter->done = true;
+    socketReactorUnlink(reactor, waiter);
+    waiter->next = ready;
+    ready = waiter;
+  }
+#endif // SOCKET_REACTOR_EPOLL
+  if ((numEvents < 0) && (socketReactorWouldBlock() == false)) {
+    printLog(ERR, "Waiting for socket events failed: %s\n", strerror(errno));
+    return -1;
   }
-  clientSocket->socketType = socketType;
-  clientSocket->socketProtocol = socketProtocol;
-  clientSocket->socketMode = socketMode;
-  clientSocket->sockfd = clientSockfd;
-  clientSocket->blocking = true;
-  clientSocket->sockaddr = clientAddress;
-  clientSocket->tcpConnected
-    = (clientSocket->socketProtocol == TCP) ? true : false;
   
-  char ipAddressString[INET_ADDRSTRLEN];
-  struct in_addr ipAddress = clientAddress.sin_addr;
-  inet_ntop(AF_INET, &ipAddress, ipAddressString, INET_ADDRSTRLEN);
-  if (asprintf(&clientSocket->address, "%s:%d", ipAddressString,
-    ntohs(clientAddress.sin_port)) < 0
-  ) {
-    clientSocket->address = NULL;
+  now = getMonotonicNanoseconds();
+  SocketReactorWaiter *cur = reactor->head;
+  while (cur != NULL) {
+    SocketReactorWaiter *next = cur->next;
+    if ((cur->deadline >= 0) && (now >= cur->deadline)) {
+      cur->revents = 0;
+      cur->done = true;
+      socketReactorUnlink(reactor, cur);
+      cur->next = ready;
+      ready = cur;
+    }
+    cur = next;
   }
   
-  // For ipv6:
-  // struct sockaddr_in6* pV6Address = (struct sockaddr_in6*) &clientAddress;
-  // struct in6_addr ipAddress = pV6Address->sin6_addr;
-  // char ipAddressString[INET6_ADDRSTRLEN];
-  // inet_ntop(AF_INET6, &ipAddress, ipAddressString, INET6_ADDRSTRLEN);
+  int numResumed = 0;
+  while (ready != NULL) {
+    // The waiter lives on the coroutine's stack and is gone once it resumes.
+    SocketReactorWaiter *next = ready->next;
+    coroutineResume(ready->coroutine, NULL);
+    numResumed++;
+    ready = next;
+  }
   
-#ifdef TLS_SOCKETS_ENABLED
-  if ((socketMode == TLS) && (tlsSocketsEnabled() == true)) {
-    clientSocket->ssl = clientSsl;
-    SSL_set_fd(clientSocket->ssl, clientSocket->sockfd);
-  } // else the clientSsl object was never created.
-#endif // TLS_SOCKETS_ENABLED
+  printLog(FLOOD, "EXIT socketReactorRun(reactor=%p, timeoutMilliseconds=%d) "
+    "= {%d}\n", (void*) reactor, timeoutMilliseconds, numResumed);
+  return numResumed;
+}
+
+/// @fn int socketReactorWait(SocketReactor *reactor, Socket *sock, int events, int timeoutMilliseconds)
+///
+/// @brief Park the running Coroutine until a socket is ready or a timeout
+/// expires.  Called outside of a coroutine, this blocks the thread instead.
+/// Only one coroutine at a time may wait on a given socket.
+///
+/// @param reactor The SocketReactor that will resume the coroutine.
+/// @param sock The Socket to wait on.
+/// @param events The SOCKET_READABLE and/or SOCKET_WRITABLE events to wait for.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait, 0 to
+///   not wait at all, or a negative value to wait indefinitely.
+///
+/// @return Returns the ready events on success, 0 on timeout, -1 on error.
+int socketReactorWait(SocketReactor *reactor, Socket *sock, int events,
+  int timeoutMilliseconds
+) {
+  if (sock == NULL) {
+    printLog(ERR, "NULL Socket provided.\n");
+    return -1;
+  }
   
-  // Update the string representation of the socket.
-  updateSocketString(clientSocket);
+  return socketReactorWaitFd(reactor, sock->sockfd, events,
+    timeoutMilliseconds);
+}
+
+/// @fn int socketReactorConnect(SocketReactor *reactor, int sockfd, const struct sockaddr *address, int addressLength, int timeoutMilliseconds)
+///
+/// @brief Connect a socket to an address, parking the running Coroutine
+/// instead of blocking the thread (or starting a watch thread like
+/// rawSocketConnect) while the connection is in progress.
+///
+/// @param reactor The SocketReactor that will resume the coroutine.
+/// @param sockfd The socket file descriptor to connect.  Its blocking mode is
+///   restored before returning.
+/// @param address A sockaddr structure describing the address to connect to.
+/// @param addressLength The size, in bytes, of the sockaddr pointed to by
+///   address.
+/// @param timeoutMilliseconds The number of milliseconds to wait for the
+///   connection to be established, or a negative value to wait until the
+///   operating system gives up.
+///
+/// @return Returns 0 on success, -1 on failure.
+int socketReactorConnect(SocketReactor *reactor, int sockfd,
+  const struct sockaddr *address, int addressLength, int timeoutMilliseconds
+) {
+  printLog(TRACE,
+    "ENTER socketReactorConnect(reactor=%p, sockfd=%d, address=%p, "
+    "addressLength=%d, timeoutMilliseconds=%d)\n", (void*) reactor, sockfd,
+    (void*) address, addressLength, timeoutMilliseconds);
+
+#ifdef _WIN32
+  u_long nonblocking = 1;
+  ioctlsocket(sockfd, FIONBIO, &nonblocking);
+#else // POSIX
+  int flags = fcntl(sockfd, F_GETFL);
+  fcntl(sockfd, F_SETFL, flags | O_NONBLOCK);
+#endif // _WIN32
+
+  int returnValue = connect(sockfd, address, addressLength);
+#ifdef _WIN32
+  bool inProgress = (returnValue < 0) && socketReactorWouldBlock();
+#else // POSIX
+  bool inProgress = (returnValue < 0) && (errno == EINPROGRESS);
+#endif // _WIN32
+  if (inProgress == true) {
+    returnValue = -1;
+    if (socketReactorWaitFd(reactor, sockfd, SOCKET_WRITABLE,
+      (timeoutMilliseconds == 0) ? -1 : timeoutMilliseconds) > 0
+    ) {
+      int error = 0;
+      socklen_t errorLength = sizeof(error);
+      if ((getsockopt(sockfd, SOL_SOCKET, SO_ERROR, (char*) &error,
+        &errorLength) == 0) && (error == 0)
+      ) {
+        returnValue = 0;
+      } else {
+        printLog(ERR, "Connect failed: %s\n", strerror(error));
+      }
+    } else {
+      printLog(WARN, "Connection timed out after %d milliseconds.\n",
+        timeoutMilliseconds);
+    }
+  } else if (returnValue < 0) {
+    printLog(ERR, "%s", strerror(errno));
+  }
+
+#ifdef _WIN32
+  nonblocking = 0;
+  ioctlsocket(sockfd, FIONBIO, &nonblocking);
+#else // POSIX
+  fcntl(sockfd, F_SETFL, flags);
+#endif // _WIN32
+
+  printLog(TRACE,
+    "EXIT socketReactorConnect(reactor=%p, sockfd=%d, address=%p, "
+    "addressLength=%d, timeoutMilliseconds=%d) = {%d}\n", (void*) reactor,
+    sockfd, (void*) address, addressLength, timeoutMilliseconds, returnValue);
+  return returnValue;
+}
+
+/// @fn Socket* socketReactorAccept(SocketReactor *reactor, Socket *serverSocket, int timeoutMilliseconds)
+///
+/// @brief Accept an incoming TCP client connection on a SERVER socket, parking
+/// the running Coroutine until a connection arrives.
+///
+/// @param reactor The SocketReactor that will resume the coroutine.
+/// @param serverSocket The Socket to accept a connection from.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait for a
+///   connection, or a negative value to wait indefinitely.
+///
+/// @return Returns a Socket of the client connection on success, NULL on
+/// failure or timeout.
+Socket* socketReactorAccept(SocketReactor *reactor, Socket *serverSocket,
+  int timeoutMilliseconds
+) {
+  printLog(TRACE,
+    "ENTER socketReactorAccept(reactor=%p, serverSocket=%s, "
+    "timeoutMilliseconds=%d)\n", (void*) reactor,
+    socketToString(serverSocket), timeoutMilliseconds);
+  
+  Socket *clientSocket = NULL;
+  if ((serverSocket != NULL) && (serverSocket->socketProtocol == TCP)
+    && (socketReactorWait(reactor, serverSocket, SOCKET_READABLE,
+      timeoutMilliseconds) > 0)
+  ) {
+    // The connection is ready, so socketAccept won't block.
+    clientSocket = socketAccept(serverSocket);
+  }
   
-  printLog(TRACE, "EXIT socketAccept(serverSocket=%s, buf=%p, len=%d) = {%s}\n",
-    socketToString(serverSocket), (void*) buf, len,
+  printLog(TRACE,
+    "EXIT socketReactorAccept(reactor=%p, serverSocket=%s, "
+    "timeoutMilliseconds=%d) = {%s}\n", (void*) reactor,
+    socketToString(serverSocket), timeoutMilliseconds,
     socketToString(clientSocket));
   return clientSocket;
 }
 
-/// @fn const char* socketAddress(Socket *sock)
+/// @fn static int socketReactorRetryEvents(Socket *sock, int ioReturnValue, int defaultEvents)
 ///
-/// @brief Get the address associated with a socket.
+/// @brief Determine what a socket needs to be ready for before a failed
+/// non-blocking I/O call can be retried.
 ///
-/// @param sock The socket to get the address from.
+/// @param sock The Socket the I/O call was made on.
+/// @param ioReturnValue The value returned by the I/O call.
+/// @param defaultEvents The events to wait for on a plain socket.
 ///
-/// @return Returns a string representation of the address of the socket.
-const char* socketAddress(Socket *sock) {
-  printLog(TRACE, "ENTER socketAddress(sock=%s)\n", socketToString(sock));
+/// @return Returns the SOCKET_READABLE and/or SOCKET_WRITABLE events to wait
+/// for, 0 if the failure is not retryable.
+static int socketReactorRetryEvents(Socket *sock, int ioReturnValue,
+  int defaultEvents
+) {
+#ifdef TLS_SOCKETS_ENABLED
+  if ((sock->socketMode == TLS) && (sock->socketType == SERVER)
+    && (sock->ssl != NULL)
+  ) {
+    int error = SSL_get_error(sock->ssl, ioReturnValue);
+    if (error == SSL_ERROR_WANT_READ) {
+      return SOCKET_READABLE;
+    } else if (error == SSL_ERROR_WANT_WRITE) {
+      return SOCKET_WRITABLE;
+    }
+    return 0;
+  } else if ((sock->socketMode == TLS) && (sock->socketType == CLIENT)
+    && (sock->sslBio != NULL)
+  ) {
+    if (BIO_should_retry(sock->sslBio) == 0) {
+      return 0;
+    } else if (BIO_should_write(sock->sslBio)) {
+      return SOCKET_WRITABLE;
+    }
+    return SOCKET_READABLE;
+  }
+#else
+  (void) sock;
+  (void) ioReturnValue;
+#endif // TLS_SOCKETS_ENABLED
+
+  return (socketReactorWouldBlock() == true) ? defaultEvents : 0;
+}
+
+/// @fn int socketReactorSend(SocketReactor *reactor, Socket *sock, const volatile void *buf, int len, int timeoutMilliseconds)
+///
+/// @brief Send the provided data to the specified socket, parking the running
+/// Coroutine whenever the socket's send buffer is full.  The socket is left in
+/// non-blocking mode.
+///
+/// @param reactor The SocketReactor that will resume the coroutine.
+/// @param sock The Socket created by a prior call to socketCreate.
+/// @param buf A pointer to the buffer to send.
+/// @param len The length, in bytes, of the data pointed to by buf.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait each
+///   time the socket isn't ready, or a negative value to wait indefinitely.
+///
+/// @return Returns the number of bytes sent on success (which may be less than
+/// len if a timeout expired or an error occurred after a partial send),
+/// negative value on error.
+int socketReactorSend(SocketReactor *reactor, Socket *sock,
+  const volatile void *buf, int len, int timeoutMilliseconds
+) {
+  printLog(TRACE,
+    "ENTER socketReactorSend(reactor=%p, sock=%s, buf=%p, len=%d, "
+    "timeoutMilliseconds=%d)\n", (void*) reactor, socketToString(sock),
+    (void*) buf, len, timeoutMilliseconds);
   
-  const char *returnValue = "";
-  if ((sock != NULL) && (sock->address != NULL)) {
-    returnValue = sock->address;
+  if ((sock == NULL) || (buf == NULL)) {
+    printLog(ERR, "NULL Socket or buf provided.\n");
+    return -1;
   }
   
-  printLog(TRACE, "EXIT socketAddress(sock=%s) = {%s}\n", socketToString(sock),
-    returnValue);
+  int flags = 0;
+#ifndef _WIN32
+  // Ignore sigpipe errors on the POSIX send command
+  flags = MSG_NOSIGNAL;
+#endif
+  socketSetNonblocking(sock);
+  
+  const char *bufferPointer = (const char*) buf;
+  int totalBytesSent = 0;
+  int bytesSent = 0;
+  while (len > 0) {
+    mtx_lock(&sock->lock);
+    if ((sock->socketMode == PLAIN) && (sock->socketProtocol == TCP)
+      && (sock->tcpConnected == true)
+    ) {
+      bytesSent = (int) send(sock->sockfd, bufferPointer, len, flags);
+    } else if ((sock->socketMode == PLAIN) && (sock->socketProtocol == UDP)) {
+      bytesSent = (int) sendto(sock->sockfd, bufferPointer, len, flags,
+        (struct sockaddr*) &sock->sockaddr, sizeof(sock->sockaddr));
+#ifdef TLS_SOCKETS_ENABLED
+    } else if ((sock->socketMode == TLS)
+      && (sock->socketType == CLIENT) && (sock->sslBio != NULL)
+    ) {
+      bytesSent = BIO_write(sock->sslBio, bufferPointer, len);
+    } else if ((sock->socketMode == TLS)
+      && (sock->socketType == SERVER) && (sock->ssl != NULL)
+    ) {
+      bytesSent = SSL_write(sock->ssl, bufferPointer, len);
+#endif // TLS_SOCKETS_ENABLED
+    } else {
+      printLog(ERR, "Invalid socket in socketReactorSend.\n");
+      printLog(ERR, "%s\n", socketToString(sock));
+      mtx_unlock(&sock->lock);
+      bytesSent = -1;
+      break;
+    }
+    int retryEvents = (bytesSent > 0)
+      ? 0 : socketReactorRetryEvents(sock, bytesSent, SOCKET_WRITABLE);
+    mtx_unlock(&sock->lock);
+    
+    if (bytesSent > 0) {
+      totalBytesSent += bytesSent;
+      bufferPointer += bytesSent;
+      len -= bytesSent;
+    } else if ((retryEvents == 0)
+      || (socketReactorWait(reactor, sock, retryEvents,
+        timeoutMilliseconds) <= 0)
+    ) {
+      break;
+    }
+  }
+  
+  int returnValue = (totalBytesSent > 0) ? totalBytesSent : -1;
+  
+  printLog(TRACE,
+    "EXIT socketReactorSend(reactor=%p, sock=%s, buf=%p, len=%d, "
+    "timeoutMilliseconds=%d) = {%d}\n", (void*) reactor, socketToString(sock),
+    (void*) buf, len, timeoutMilliseconds, returnValue);
   return returnValue;
 }
 
-/// @var _emptySocketString
-///
-/// @brief The function socketToString below does not allocate a new string.
-/// In the event that the Socket passed in is NULL, it has to return a static
-/// empty string.  This variable provides that vaule.
-static const char *_emptySocketString = "";
-
-/// @fn const char* socketToString(Socket *sock)
+/// @fn int socketReactorReceive(SocketReactor *reactor, Socket *sock, volatile void *buf, int len, int timeoutMilliseconds)
 ///
-/// @brief Get a string representation of a Socket.
+/// @brief Receive data from the specified socket, parking the running
+/// Coroutine until data arrives.  Completes any pending server-side TLS accept
+/// first.  The socket is left in non-blocking mode.
 ///
-/// @param sock The socket to get the representation of.
+/// @param reactor The SocketReactor that will resume the coroutine.
+/// @param sock The Socket created by a prior call to socketCreate or
+///   socketAccept.
+/// @param buf A pointer to the buffer to receive data into.
+/// @param len The length, in bytes, of the buffer pointed to by buf.
+/// @param timeoutMilliseconds The maximum number of milliseconds to wait for
+///   data, or a negative value to wait indefinitely.
 ///
-/// @return Returns a string representation of the socket.
-const char* socketToString(Socket *sock) {
-  printLog(FLOOD, "ENTER socketToString(sock=%p)\n", (void*) sock);
+/// @return Returns the number of bytes received on success, 0 if the peer
+/// closed the connection, negative value on error or timeout.
+int socketReactorReceive(SocketReactor *reactor, Socket *sock,
+  volatile void *buf, int len, int timeoutMilliseconds
+) {
+  printLog(FLOOD,
+    "ENTER socketReactorReceive(reactor=%p, sock=%s, buf=%p, len=%d, "
+    "timeoutMilliseconds=%d)\n", (void*) reactor, socketToString(sock),
+    (void*) buf, len, timeoutMilliseconds);
   
-  const char *returnValue = _emptySocketString;
-  if ((sock != NULL) && (sock->_str != NULL)) {
-    returnValue = sock->_str;
+  if ((sock == NULL) || (buf == NULL)) {
+    printLog(ERR, "NULL Socket or buf provided.\n");
+    return -1;
   }
   
-  printLog(FLOOD, "EXIT socketToString(sock=%p) = {%s}\n", (void*) sock,
-    returnValue);
-  return returnValue;
+  socketSetNonblocking(sock);
+  
+  int bytesReceived = -1;
+  while (1) {
+    mtx_lock(&sock->lock);
+    int retryEvents = 0;
+#ifdef TLS_SOCKETS_ENABLED
+    if ((sock->socketMode == TLS) && (sock->socketType == SERVER)
+      && (sock->ssl != NULL) && (sock->sslAccepted == false)
+    ) {
+      int acceptReturnValue = SSL_accept(sock->ssl);
+      if (acceptReturnValue > 0) {
+        sock->sslAccepted = true;
+        updateSocketString(sock);
+      } else {
+        retryEvents
+          = socketReactorRetryEvents(sock, acceptReturnValue, SOCKET_READABLE);
+        mtx_unlock(&sock->lock);
+        if ((retryEvents == 0)
+          || (socketReactorWait(reactor, sock, retryEvents,
+            timeoutMilliseconds) <= 0)
+        ) {
+          printLog(ERR, "Could not accept from SSL.\n");
+          break;
+        }
+        continue;
+      }
+    }
+#endif // TLS_SOCKETS_ENABLED
+
+    if ((sock->socketMode == PLAIN) && (sock->socketProtocol == TCP)
+      && (sock->tcpConnected == true)
+    ) {
+      bytesReceived = (int) recv(sock->sockfd, (char*) buf, len, 0);
+    } else if ((sock->socketMode == PLAIN) && (sock->socketProtocol == UDP)) {
+      struct sockaddr_in srcAddr = sock->sockaddr;
+      socklen_t srcAddrLen = sizeof(srcAddr);
+      bytesReceived = (int) recvfrom(sock->sockfd, (char*) buf, len, 0,
+        (struct sockaddr*) &srcAddr, &srcAddrLen);
+#ifdef TLS_SOCKETS_ENABLED
+    } else if ((sock->socketMode == TLS)
+      && (sock->socketType == CLIENT) && (sock->sslBio != NULL)
+    ) {
+      bytesReceived = BIO_read(sock->sslBio, (void*) buf, len);
+    } else if ((sock->socketMode == TLS)
+      && (sock->socketType == SERVER) && (sock->ssl != NULL)
+    ) {
+      bytesReceived = SSL_read(sock->ssl, (void*) buf, len);
+#endif // TLS_SOCKETS_ENABLED
+    } else {
+      printLog(ERR, "Invalid socket in socketReactorReceive.\n");
+      printLog(ERR, "%s\n", socketToString(sock));
+      mtx_unlock(&sock->lock);
+      bytesReceived = -1;
+      break;
+    }
+    if (bytesReceived < 0) {
+      retryEvents
+        = socketReactorRetryEvents(sock, bytesReceived, SOCKET_READABLE);
+#ifdef TLS_SOCKETS_ENABLED
+    } else if ((bytesReceived == 0) && (sock->socketMode == TLS)) {
+      // TLS reports "try again" as 0 too.
+      retryEvents
+        = socketReactorRetryEvents(sock, bytesReceived, SOCKET_READABLE);
+#endif // TLS_SOCKETS_ENABLED
+    }
+    mtx_unlock(&sock->lock);
+    
+    if (retryEvents == 0) {
+      break;
+    }
+    bytesReceived = -1;
+    if (socketReactorWait(reactor, sock, retryEvents, timeoutMilliseconds)
+      <= 0
+    ) {
+      break;
+    }
+  }
+  
+  printLog(FLOOD,
+    "EXIT socketReactorReceive(reactor=%p, sock=%s, buf=%p, len=%d, "
+    "timeoutMilliseconds=%d) = {%d}\n", (void*) reactor, socketToString(sock),
+    (void*) buf, len, timeoutMilliseconds, bytesReceived);
+  return bytesReceived;
 }
 
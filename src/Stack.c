@@ -37,19 +37,26 @@
 #define logFile stderr
 #endif
 
-/// @fn Stack *stackCreate(TypeDescriptor *dataType)
+#include "LockStats.h"
+
+/// @fn Stack *stackCreate_(TypeDescriptor *dataType, bool pooledNodes, ...)
 ///
 /// @brief Create and initialize a newly-allocated Stack.
 ///
 /// @param dataType TypeDescriptor describing the type of data in the Stack.
+/// @param pooledNodes Whether or not to allocate the Stack's nodes from a
+///   NodePool owned by the Stack instead of with a malloc per push.
 ///
 /// @return Returns a pointer to a newly-allocated and initialized Stack.
 ///
 /// @note This implementation uses List as the underlying infrastructure.
-Stack *stackCreate(TypeDescriptor *dataType) {
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides false for pooledNodes.
+Stack *stackCreate_(TypeDescriptor *dataType, bool pooledNodes, ...) {
   printLog(TRACE, "ENTER stackCreate(dataType=%s)\n", (dataType == NULL) ? "NULL" : dataType->name);
   
-  Stack *stack = (Stack*) listCreate(dataType);
+  Stack *stack = (Stack*) listCreate(dataType, false, pooledNodes);
   
   printLog(TRACE, "EXIT stackCreate(dataType=%s) = {%p}\n", (dataType == NULL) ? "NULL" : dataType->name, stack);
   return stack;
@@ -165,7 +172,7 @@ TypeDescriptor _typeStack = {
   .toString      = (char* (*)(const volatile void*)) listToString,
   .toBytes       = (Bytes (*)(const volatile void*)) listToBytes,
   .compare       = (int (*)(const volatile void*, const volatile void*)) listCompare,
-  .create        = (void* (*)(const volatile void*, ...)) stackCreate,
+  .create        = (void* (*)(const volatile void*, ...)) stackCreate_,
   .copy          = (void* (*)(const volatile void*)) listCopy,
   .destroy       = (void* (*)(volatile void*)) stackDestroy,
   .size          = listSize,
@@ -175,6 +182,9 @@ TypeDescriptor _typeStack = {
   .clear         = (i32 (*)(volatile void *)) listClear,
   .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) listToXml_,
   .toJson        = (Bytes (*)(const volatile void*)) listToJson,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) listToJsonStream,
+  .blobSize      = (u64 (*)(const volatile void*)) listToBlobSize,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) listToBlobBuffer,
 };
 TypeDescriptor *typeStack = &_typeStack;
 
@@ -196,7 +206,7 @@ TypeDescriptor _typeStackNoCopy = {
   .toString      = (char* (*)(const volatile void*)) listToString,
   .toBytes       = (Bytes (*)(const volatile void*)) listToBytes,
   .compare       = (int (*)(const volatile void*, const volatile void*)) listCompare,
-  .create        = (void* (*)(const volatile void*, ...)) stackCreate,
+  .create        = (void* (*)(const volatile void*, ...)) stackCreate_,
   .copy          = (void* (*)(const volatile void*)) shallowCopy,
   .destroy       = (void* (*)(volatile void*)) nullFunction,
   .size          = listSize,
@@ -206,6 +216,9 @@ TypeDescriptor _typeStackNoCopy = {
   .clear         = (i32 (*)(volatile void *)) listClear,
   .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) listToXml_,
   .toJson        = (Bytes (*)(const volatile void*)) listToJson,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) listToJsonStream,
+  .blobSize      = (u64 (*)(const volatile void*)) listToBlobSize,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) listToBlobBuffer,
 };
 TypeDescriptor *typeStackNoCopy = &_typeStackNoCopy;
 
@@ -30,6 +30,21 @@
 
 #include "StringLib.h"
 #include "OsApi.h"
+#include "Scope.h"
+#include <errno.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+#if defined(__GNUC__) && defined(__SSE2__)
+#define STRING_LIB_SSE2
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_NEON)
+#define STRING_LIB_NEON
+#include <arm_neon.h>
+#endif
 #ifdef DS_LOGGING_ENABLED
 #include "LoggingLib.h"
 #else
@@ -60,6 +75,546 @@ const char *fieldDelim = "`";
 /// @brief The common delimiter used to separate records of data in a string.
 const char *recordDelim = "\n";
 
+/// @fn static inline u8 findDataFoldMask(u8 c, bool caseInsensitive)
+///
+/// @brief Get the bits to OR into a byte before comparing it to c.
+///
+/// @details For an ASCII letter, OR-ing in 0x20 maps both cases to the
+/// lowercase letter and nothing else to it, so (b | mask) == (c | mask)
+/// matches exactly the two cases of c.  Anything else is compared as-is.
+///
+/// @param c The needle byte that will be compared against.
+/// @param caseInsensitive Whether or not the search ignores case.
+///
+/// @return Returns 0x20 if c is a letter and case is ignored, 0 otherwise.
+static inline u8 findDataFoldMask(u8 c, bool caseInsensitive) {
+  return (caseInsensitive && (((c | 0x20) >= 'a') && ((c | 0x20) <= 'z')))
+    ? 0x20 : 0x00;
+}
+
+/// @fn static inline bool findDataEqual(const u8 *a, const u8 *b, u64 length, bool caseInsensitive)
+///
+/// @brief Verify a candidate match found by one of the findData functions.
+///
+/// @param a The candidate position in the haystack.
+/// @param b The needle.
+/// @param length The number of bytes to compare.
+/// @param caseInsensitive Whether or not ASCII case is ignored.
+///
+/// @return Returns true if the two ranges match, false if not.
+static inline bool findDataEqual(const u8 *a, const u8 *b, u64 length,
+  bool caseInsensitive
+) {
+  if (caseInsensitive == false) {
+    return memcmp(a, b, length) == 0;
+  }
+  
+  for (u64 ii = 0; ii < length; ii++) {
+    u8 mask = findDataFoldMask(b[ii], true);
+    if ((a[ii] | mask) != (b[ii] | mask)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @fn static const u8* findDataScalar(const u8 *haystack, u64 haystackLength, const u8 *needle, u64 needleLength, bool caseInsensitive)
+///
+/// @brief Portable substring search.  Also finishes the tails left over by the
+/// vectorized versions.
+///
+/// @param haystack The data to search.
+/// @param haystackLength The number of bytes at haystack.
+/// @param needle The data to search for.
+/// @param needleLength The number of bytes at needle.  Must be at least 1 and
+///   no more than haystackLength.
+/// @param caseInsensitive Whether or not ASCII case is ignored.
+///
+/// @return Returns a pointer to the first match in haystack, NULL if there is
+/// none.
+static const u8* findDataScalar(const u8 *haystack, u64 haystackLength,
+  const u8 *needle, u64 needleLength, bool caseInsensitive
+) {
+  const u8 *last = haystack + (haystackLength - needleLength);
+  u8 firstMask = findDataFoldMask(needle[0], caseInsensitive);
+  u8 first = needle[0] | firstMask;
+  
+  while (haystack <= last) {
+    if (firstMask == 0) {
+      // memchr is already vectorized by the C library.
+      haystack = (const u8*) memchr(haystack, first, (last - haystack) + 1);
+      if (haystack == NULL) {
+        break;
+      }
+    } else if ((*haystack | firstMask) != first) {
+      haystack++;
+      continue;
+    }
+    
+    if (findDataEqual(haystack + 1, needle + 1, needleLength - 1,
+      caseInsensitive)
+    ) {
+      return haystack;
+    }
+    haystack++;
+  }
+  
+  return NULL;
+}
+
+#if defined(STRING_LIB_SSE2)
+/// @fn static const u8* findDataSse2(const u8 *haystack, u64 haystackLength, const u8 *needle, u64 needleLength, bool caseInsensitive)
+///
+/// @brief SSE2 substring search.  Compares the first and last bytes of needle
+/// against 16 candidate positions at a time and only verifies positions where
+/// both match.
+///
+/// @param haystack The data to search.
+/// @param haystackLength The number of bytes at haystack.
+/// @param needle The data to search for.
+/// @param needleLength The number of bytes at needle.  Must be at least 1 and
+///   no more than haystackLength.
+/// @param caseInsensitive Whether or not ASCII case is ignored.
+///
+/// @return Returns a pointer to the first match in haystack, NULL if there is
+/// none.
+static const u8* findDataSse2(const u8 *haystack, u64 haystackLength,
+  const u8 *needle, u64 needleLength, bool caseInsensitive
+) {
+  u8 firstMask = findDataFoldMask(needle[0], caseInsensitive);
+  u8 lastMask = findDataFoldMask(needle[needleLength - 1], caseInsensitive);
+  const __m128i firstFold = _mm_set1_epi8((char) firstMask);
+  const __m128i lastFold = _mm_set1_epi8((char) lastMask);
+  const __m128i first = _mm_set1_epi8((char) (needle[0] | firstMask));
+  const __m128i last
+    = _mm_set1_epi8((char) (needle[needleLength - 1] | lastMask));
+  
+  u64 ii = 0;
+  for (; ii + needleLength + 15 <= haystackLength; ii += 16) {
+    __m128i blockFirst = _mm_or_si128(firstFold,
+      _mm_loadu_si128((const __m128i*) (haystack + ii)));
+    __m128i blockLast = _mm_or_si128(lastFold,
+      _mm_loadu_si128((const __m128i*) (haystack + ii + needleLength - 1)));
+    u32 mask = (u32) _mm_movemask_epi8(_mm_and_si128(
+      _mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast)));
+    while (mask != 0) {
+      const u8 *candidate = haystack + ii + __builtin_ctz(mask);
+      if ((needleLength <= 2) || findDataEqual(candidate + 1, needle + 1,
+        needleLength - 2, caseInsensitive)
+      ) {
+        return candidate;
+      }
+      mask &= mask - 1;
+    }
+  }
+  
+  if (ii + needleLength <= haystackLength) {
+    return findDataScalar(haystack + ii, haystackLength - ii,
+      needle, needleLength, caseInsensitive);
+  }
+  return NULL;
+}
+
+/// @fn static const u8* findDataAvx2(const u8 *haystack, u64 haystackLength, const u8 *needle, u64 needleLength, bool caseInsensitive)
+///
+/// @brief AVX2 version of findDataSse2 that checks 32 positions at a time.
+///
+/// @param haystack The data to search.
+/// @param haystackLength The number of bytes at haystack.
+/// @param needle The data to search for.
+/// @param needleLength The number of bytes at needle.  Must be at least 1 and
+///   no more than haystackLength.
+/// @param caseInsensitive Whether or not ASCII case is ignored.
+///
+/// @return Returns a pointer to the first match in haystack, NULL if there is
+/// none.
+__attribute__((target("avx2")))
+static const u8* findDataAvx2(const u8 *haystack, u64 haystackLength,
+  const u8 *needle, u64 needleLength, bool caseInsensitive
+) {
+  u8 firstMask = findDataFoldMask(needle[0], caseInsensitive);
+  u8 lastMask = findDataFoldMask(needle[needleLength - 1], caseInsensitive);
+  const __m256i firstFold = _mm256_set1_epi8((char) firstMask);
+  const __m256i lastFold = _mm256_set1_epi8((char) lastMask);
+  const __m256i first = _mm256_set1_epi8((char) (needle[0] | firstMask));
+  const __m256i last
+    = _mm256_set1_epi8((char) (needle[needleLength - 1] | lastMask));
+  
+  u64 ii = 0;
+  for (; ii + needleLength + 31 <= haystackLength; ii += 32) {
+    __m256i blockFirst = _mm256_or_si256(firstFold,
+      _mm256_loadu_si256((const __m256i*) (haystack + ii)));
+    __m256i blockLast = _mm256_or_si256(lastFold,
+      _mm256_loadu_si256((const __m256i*) (haystack + ii + needleLength - 1)));
+    u32 mask = (u32) _mm256_movemask_epi8(_mm256_and_si256(
+      _mm256_cmpeq_epi8(first, blockFirst),
+      _mm256_cmpeq_epi8(last, blockLast)));
+    while (mask != 0) {
+      const u8 *candidate = haystack + ii + __builtin_ctz(mask);
+      if ((needleLength <= 2) || findDataEqual(candidate + 1, needle + 1,
+        needleLength - 2, caseInsensitive)
+      ) {
+        return candidate;
+      }
+      mask &= mask - 1;
+    }
+  }
+  
+  if (ii + needleLength <= haystackLength) {
+    return findDataSse2(haystack + ii, haystackLength - ii,
+      needle, needleLength, caseInsensitive);
+  }
+  return NULL;
+}
+#elif defined(STRING_LIB_NEON)
+/// @fn static const u8* findDataNeon(const u8 *haystack, u64 haystackLength, const u8 *needle, u64 needleLength, bool caseInsensitive)
+///
+/// @brief NEON substring search.  Compares the first and last bytes of needle
+/// against 16 candidate positions at a time and only verifies positions where
+/// both match.
+///
+/// @param haystack The data to search.
+/// @param haystackLength The number of bytes at haystack.
+/// @param needle The data to search for.
+/// @param needleLength The number of bytes at needle.  Must be at least 1 and
+///   no more than haystackLength.
+/// @param caseInsensitive Whether or not ASCII case is ignored.
+///
+/// @return Returns a pointer to the first match in haystack, NULL if there is
+/// none.
+static const u8* findDataNeon(const u8 *haystack, u64 haystackLength,
+  const u8 *needle, u64 needleLength, bool caseInsensitive
+) {
+  u8 firstMask = findDataFoldMask(needle[0], caseInsensitive);
+  u8 lastMask = findDataFoldMask(needle[needleLength - 1], caseInsensitive);
+  const uint8x16_t firstFold = vdupq_n_u8(firstMask);
+  const uint8x16_t lastFold = vdupq_n_u8(lastMask);
+  const uint8x16_t first = vdupq_n_u8(needle[0] | firstMask);
+  const uint8x16_t last = vdupq_n_u8(needle[needleLength - 1] | lastMask);
+  
+  u64 ii = 0;
+  for (; ii + needleLength + 15 <= haystackLength; ii += 16) {
+    uint8x16_t blockFirst = vorrq_u8(firstFold, vld1q_u8(haystack + ii));
+    uint8x16_t blockLast
+      = vorrq_u8(lastFold, vld1q_u8(haystack + ii + needleLength - 1));
+    uint8x16_t matches
+      = vandq_u8(vceqq_u8(first, blockFirst), vceqq_u8(last, blockLast));
+    // Narrow to four bits per byte so the result fits in a 64-bit mask.
+    u64 mask = vget_lane_u64(vreinterpret_u64_u8(
+      vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+    while (mask != 0) {
+      const u8 *candidate = haystack + ii + (__builtin_ctzll(mask) >> 2);
+      if ((needleLength <= 2) || findDataEqual(candidate + 1, needle + 1,
+        needleLength - 2, caseInsensitive)
+      ) {
+        return candidate;
+      }
+      mask &= ~(0xfULL << (__builtin_ctzll(mask) & ~3));
+    }
+  }
+  
+  if (ii + needleLength <= haystackLength) {
+    return findDataScalar(haystack + ii, haystackLength - ii,
+      needle, needleLength, caseInsensitive);
+  }
+  return NULL;
+}
+#endif
+
+/// @typedef FindDataFunction
+///
+/// @brief Signature shared by the findData implementions.
+typedef const u8* (*FindDataFunction)(const u8 *haystack, u64 haystackLength,
+  const u8 *needle, u64 needleLength, bool caseInsensitive);
+
+/// @var _findDataFunction
+///
+/// @brief The best findData implementation for this CPU.  Selected on first
+/// use.
+static FindDataFunction _findDataFunction = NULL;
+
+/// @fn static inline const u8* findData(const u8 *haystack, u64 haystackLength, const u8 *needle, u64 needleLength, bool caseInsensitive)
+///
+/// @brief Find needle in haystack with the fastest implementation the CPU
+/// supports.
+///
+/// @param haystack The data to search.
+/// @param haystackLength The number of bytes at haystack.
+/// @param needle The data to search for.
+/// @param needleLength The number of bytes at needle.  Must be at least 1 and
+///   no more than haystackLength.
+/// @param caseInsensitive Whether or not ASCII case is ignored.
+///
+/// @return Returns a pointer to the first match in haystack, NULL if there is
+/// none.
+static inline const u8* findData(const u8 *haystack, u64 haystackLength,
+  const u8 *needle, u64 needleLength, bool caseInsensitive
+) {
+  FindDataFunction function = _findDataFunction;
+  if (function == NULL) {
+    // Every thread that races here picks the same function, so there's no
+    // need for a lock.
+#if defined(STRING_LIB_SSE2)
+    function = (__builtin_cpu_supports("avx2")) ? findDataAvx2 : findDataSse2;
+#elif defined(STRING_LIB_NEON)
+    function = findDataNeon;
+#else
+    function = findDataScalar;
+#endif
+    _findDataFunction = function;
+  }
+  
+  return function(haystack, haystackLength, needle, needleLength,
+    caseInsensitive);
+}
+
+/// @var _escapeBitmap
+///
+/// @brief One bit per byte value, set for the bytes that escapeData encodes as
+/// %XX:  everything outside of printable ASCII plus the characters that are
+/// special in URLs, JSON, XML, and our own field delimiters.
+static const u64 _escapeBitmap[4] = {
+  0x50000b65ffffffffULL, // 0-63:  Controls, space, "%&()+
+  0x8000000110000000ULL, // 64-127:  \ ` and delete
+  0xffffffffffffffffULL, // 128-191
+  0xffffffffffffffffULL  // 192-255
+};
+
+/// @fn static inline bool escapeNeeded(u8 c)
+///
+/// @brief Determine whether or not escapeData encodes a byte.
+///
+/// @param c The byte to check.
+///
+/// @return Returns true if c must be escaped, false if it is copied as-is.
+static inline bool escapeNeeded(u8 c) {
+  return ((_escapeBitmap[c >> 6] >> (c & 63)) & 1) != 0;
+}
+
+/// @fn static inline bool unescapeNeeded(u8 c)
+///
+/// @brief Determine whether or not a byte starts a sequence that the unescape
+/// functions translate.
+///
+/// @param c The byte to check.
+///
+/// @return Returns true if c is '%', '&', or '+', false otherwise.
+static inline bool unescapeNeeded(u8 c) {
+  return (c == '%') || (c == '&') || (c == '+');
+}
+
+#if defined(STRING_LIB_SSE2)
+/// @fn static inline u32 escapeMaskSse2(__m128i block)
+///
+/// @brief Get a bit mask of the bytes in a block that escapeData encodes.
+///
+/// @param block The 16 bytes to check.
+///
+/// @return Returns a mask with bit N set if byte N must be escaped.
+static inline u32 escapeMaskSse2(__m128i block) {
+  // Anything outside of 32 - 126 is unsafe.  Space is in the list below.
+  __m128i shifted = _mm_sub_epi8(block, _mm_set1_epi8(32));
+  __m128i unsafe = _mm_cmpeq_epi8(
+    _mm_max_epu8(shifted, _mm_set1_epi8(95)), shifted);
+  static const char specials[] = " \"%&()+<>\\`";
+  for (u64 ii = 0; ii < sizeof(specials) - 1; ii++) {
+    unsafe = _mm_or_si128(unsafe,
+      _mm_cmpeq_epi8(block, _mm_set1_epi8(specials[ii])));
+  }
+  
+  return (u32) _mm_movemask_epi8(unsafe);
+}
+
+/// @fn static inline u32 unescapeMaskSse2(__m128i block)
+///
+/// @brief Get a bit mask of the bytes in a block that are '%', '&', or '+'.
+///
+/// @param block The 16 bytes to check.
+///
+/// @return Returns a mask with bit N set if byte N starts an escape sequence.
+static inline u32 unescapeMaskSse2(__m128i block) {
+  return (u32) _mm_movemask_epi8(_mm_or_si128(
+    _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('%')),
+      _mm_cmpeq_epi8(block, _mm_set1_epi8('&'))),
+    _mm_cmpeq_epi8(block, _mm_set1_epi8('+'))));
+}
+#elif defined(STRING_LIB_NEON)
+/// @fn static inline u64 neonMask(uint8x16_t matches)
+///
+/// @brief Narrow a NEON comparison result to a 64-bit mask with four bits per
+/// byte.
+///
+/// @param matches The comparison result (0x00 or 0xff per lane).
+///
+/// @return Returns a mask with bits 4N - 4N+3 set if lane N matched.
+static inline u64 neonMask(uint8x16_t matches) {
+  return vget_lane_u64(vreinterpret_u64_u8(
+    vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+}
+
+/// @fn static inline u64 escapeMaskNeon(uint8x16_t block)
+///
+/// @brief Get a mask of the bytes in a block that escapeData encodes.
+///
+/// @param block The 16 bytes to check.
+///
+/// @return Returns a mask with four bits set for each byte that must be
+/// escaped.
+static inline u64 escapeMaskNeon(uint8x16_t block) {
+  // Anything outside of 32 - 126 is unsafe.  Space is in the list below.
+  uint8x16_t unsafe = vcgtq_u8(vsubq_u8(block, vdupq_n_u8(32)),
+    vdupq_n_u8(94));
+  static const char specials[] = " \"%&()+<>\\`";
+  for (u64 ii = 0; ii < sizeof(specials) - 1; ii++) {
+    unsafe = vorrq_u8(unsafe, vceqq_u8(block, vdupq_n_u8(specials[ii])));
+  }
+  
+  return neonMask(unsafe);
+}
+
+/// @fn static inline u64 unescapeMaskNeon(uint8x16_t block)
+///
+/// @brief Get a mask of the bytes in a block that are '%', '&', or '+'.
+///
+/// @param block The 16 bytes to check.
+///
+/// @return Returns a mask with four bits set for each byte that starts an
+/// escape sequence.
+static inline u64 unescapeMaskNeon(uint8x16_t block) {
+  return neonMask(vorrq_u8(vorrq_u8(
+    vceqq_u8(block, vdupq_n_u8('%')), vceqq_u8(block, vdupq_n_u8('&'))),
+    vceqq_u8(block, vdupq_n_u8('+'))));
+}
+#endif
+
+/// @fn static u64 escapeSafeLength(const u8 *input, u64 length)
+///
+/// @brief Get the length of the run of bytes at the start of input that
+/// escapeData copies as-is.
+///
+/// @param input The data to scan.
+/// @param length The number of bytes at input.
+///
+/// @return Returns the offset of the first byte that must be escaped, length
+/// if there is none.
+static u64 escapeSafeLength(const u8 *input, u64 length) {
+  u64 ii = 0;
+#if defined(STRING_LIB_SSE2)
+  for (; ii + 16 <= length; ii += 16) {
+    u32 mask = escapeMaskSse2(_mm_loadu_si128((const __m128i*) (input + ii)));
+    if (mask != 0) {
+      return ii + __builtin_ctz(mask);
+    }
+  }
+#elif defined(STRING_LIB_NEON)
+  for (; ii + 16 <= length; ii += 16) {
+    u64 mask = escapeMaskNeon(vld1q_u8(input + ii));
+    if (mask != 0) {
+      return ii + (__builtin_ctzll(mask) >> 2);
+    }
+  }
+#endif
+
+  for (; (ii < length) && (escapeNeeded(input[ii]) == false); ii++);
+  return ii;
+}
+
+/// @fn static u64 escapeCount(const u8 *input, u64 length)
+///
+/// @brief Count the bytes that escapeData encodes so that the output can be
+/// sized exactly.
+///
+/// @param input The data to scan.
+/// @param length The number of bytes at input.
+///
+/// @return Returns the number of bytes in input that must be escaped.
+static u64 escapeCount(const u8 *input, u64 length) {
+  u64 count = 0;
+  u64 ii = 0;
+#if defined(STRING_LIB_SSE2)
+  for (; ii + 16 <= length; ii += 16) {
+    count += __builtin_popcount(
+      escapeMaskSse2(_mm_loadu_si128((const __m128i*) (input + ii))));
+  }
+#elif defined(STRING_LIB_NEON)
+  for (; ii + 16 <= length; ii += 16) {
+    count += __builtin_popcountll(escapeMaskNeon(vld1q_u8(input + ii))) >> 2;
+  }
+#endif
+
+  for (; ii < length; ii++) {
+    count += escapeNeeded(input[ii]);
+  }
+  return count;
+}
+
+/// @fn static u64 unescapeSafeLength(const u8 *input, u64 length)
+///
+/// @brief Get the length of the run of bytes at the start of input that the
+/// unescape functions leave alone.
+///
+/// @param input The data to scan.
+/// @param length The number of bytes at input.
+///
+/// @return Returns the offset of the first '%', '&', or '+', length if there
+/// is none.
+static u64 unescapeSafeLength(const u8 *input, u64 length) {
+  u64 ii = 0;
+#if defined(STRING_LIB_SSE2)
+  for (; ii + 16 <= length; ii += 16) {
+    u32 mask
+      = unescapeMaskSse2(_mm_loadu_si128((const __m128i*) (input + ii)));
+    if (mask != 0) {
+      return ii + __builtin_ctz(mask);
+    }
+  }
+#elif defined(STRING_LIB_NEON)
+  for (; ii + 16 <= length; ii += 16) {
+    u64 mask = unescapeMaskNeon(vld1q_u8(input + ii));
+    if (mask != 0) {
+      return ii + (__builtin_ctzll(mask) >> 2);
+    }
+  }
+#endif
+
+  for (; (ii < length) && (unescapeNeeded(input[ii]) == false); ii++);
+  return ii;
+}
+
+/// @fn static u64 escapeDataTo(char *output, const u8 *input, u64 length)
+///
+/// @brief Write the escaped form of input to output, copying each run of safe
+/// bytes in one go.
+///
+/// @param output The buffer to write to.  Must have room for
+///   length + (2 * escapeCount(input, length)) + 1 bytes.
+/// @param input The data to escape.
+/// @param length The number of bytes at input.
+///
+/// @return Returns the number of bytes written, not counting the NULL
+/// terminator.
+static u64 escapeDataTo(char *output, const u8 *input, u64 length) {
+  static const char hexDigits[] = "0123456789ABCDEF";
+  u64 outputIndex = 0;
+  
+  for (u64 ii = 0; ii < length; ii++) {
+    u64 run = escapeSafeLength(input + ii, length - ii);
+    memcpy(output + outputIndex, input + ii, run);
+    outputIndex += run;
+    ii += run;
+    if (ii == length) {
+      break;
+    }
+    
+    output[outputIndex++] = '%';
+    output[outputIndex++] = hexDigits[input[ii] >> 4];
+    output[outputIndex++] = hexDigits[input[ii] & 0x0f];
+  }
+  output[outputIndex] = '\0';
+  
+  return outputIndex;
+}
+
 /// @fn char *indentText(const char *inputText, u32 columns)
 ///
 /// @brief Indents each line in a body of text.
@@ -140,6 +695,20 @@ void unescapeString(char *inputString) {
       && (inputString[j] != '\0');
     i++, j++
   ) {
+    // Move the run of characters that need no translation in one go.
+    size_t run = unescapeSafeLength((u8*) &inputString[j],
+      inputStringLength - j);
+    if (run > 0) {
+      if (i != j) {
+        memmove(&inputString[i], &inputString[j], run);
+      }
+      i += run;
+      j += run;
+      if (j == inputStringLength) {
+        break;
+      }
+    }
+    
     inputString[i] = inputString[j];
     if (inputString[j] == '%') {
       char tempChar = hexToChar(&inputString[j + 1]);
@@ -522,6 +1091,191 @@ Bytes getFileContent_(const char *fullPath, i64 start, i64 length, ...) {
   return returnValue;
 }
 
+#ifndef _WIN32
+/// @struct FileMappingHeader
+///
+/// @brief Metadata kept at the start of the region reserved for a file
+/// mapping.
+///
+/// @param totalLength The total number of bytes reserved, including the
+///   leading metadata page and the trailing zero page.
+typedef struct FileMappingHeader {
+  size_t totalLength;
+} FileMappingHeader;
+
+/// @fn static int fileMappingProtect(u8 *address, size_t length, int protection)
+///
+/// @brief Change the protection of the pages spanning a range of a mapping.
+///
+/// @param address The first byte of the range.
+/// @param length The number of bytes in the range.
+/// @param protection The PROT_* flags to apply.
+///
+/// @return Returns 0 on success, -1 on failure.
+static int fileMappingProtect(u8 *address, size_t length, int protection) {
+  uintptr_t pageSize = (uintptr_t) sysconf(_SC_PAGESIZE);
+  uintptr_t first = ((uintptr_t) address) & ~(pageSize - 1);
+  uintptr_t last = (((uintptr_t) address) + length + pageSize - 1)
+    & ~(pageSize - 1);
+  return mprotect((void*) first, (size_t) (last - first), protection);
+}
+#endif // _WIN32
+
+/// @fn Bytes getFileMapping_(const char *fullPath, i64 start, i64 length, ...)
+///
+/// @brief Maps the content of a file into memory read-only.
+///
+/// @param fullPath The full path to the file to map.
+/// @param start If non-negative, start is the number of bytes from the start of
+///   the file to begin the view at.  If negative, start is the number of
+///   bytes from the end of the file to begin the view at.
+/// @param length The number of bytes to map.  If 0, file contents from
+///   start to the end of the file are mapped.
+/// @param ... All further parameters are ignored.
+///
+/// @details The returned value can be read like any other Bytes object:
+/// bytesLength works on it and it is NULL terminated, so the string and
+/// dataFindData helpers can run over it directly without copying the file.
+/// Only the page(s) holding the length metadata and the terminator are ever
+/// copied.  The view is private, so changes to the file after the call may or
+/// may not be visible through it.
+///
+/// @note This function is wrapped with a macro of the same name, without the
+/// leading underscore, that automatically provieds 0 for the values of start
+/// and length.
+///
+/// @note The view must not be modified, grown, or passed to bytesDestroy.  It
+/// must be released with fileMappingDestroy.
+///
+/// @return Returns a read-only Bytes view of the file content on success,
+/// NULL on failure.
+Bytes getFileMapping_(const char *fullPath, i64 start, i64 length, ...) {
+#ifdef _WIN32
+  // No mapping support here.  Read the file in instead.
+  return getFileContent_(fullPath, start, length);
+#else
+  printLog(TRACE,
+    "ENTER getFileMapping(fullPath=\"%s\", start=%lld, length=%lld)\n",
+    (fullPath != NULL) ? fullPath : "NULL", lli(start), lli(length));
+  
+  int fd = -1;
+  if (fullPath != NULL) {
+    fd = open(fullPath, O_RDONLY);
+  }
+  struct stat fileStat;
+  if ((fd < 0) || (fstat(fd, &fileStat) != 0)) {
+    printLog(DEBUG, "Could not open file \"%s\" in getFileMapping.\n",
+      (fullPath != NULL) ? fullPath : "NULL");
+    if (fd >= 0) {
+      close(fd); fd = -1;
+    }
+    printLog(TRACE,
+      "EXIT getFileMapping(fullPath=\"%s\", start=%lld, length=%lld) = {NULL}\n",
+      (fullPath != NULL) ? fullPath : "NULL", lli(start), lli(length));
+    return NULL;
+  }
+  
+  // Adjust the start and length the same way getFileContent does.
+  i64 fileSize = (i64) fileStat.st_size;
+  if (start < 0) {
+    start += fileSize;
+  }
+  if (length == 0) {
+    length = fileSize - start;
+  }
+  if ((start < 0) || (length <= 0) || (start + length > fileSize)) {
+    // Nothing to map.
+    close(fd); fd = -1;
+    printLog(TRACE,
+      "EXIT getFileMapping(fullPath=\"%s\", start=%lld, length=%lld) = {NULL}\n",
+      (fullPath != NULL) ? fullPath : "NULL", lli(start), lli(length));
+    return NULL;
+  }
+  
+  // Reserve one page for our metadata, the file pages, and one trailing page
+  // of zeros so that the view is always NULL terminated.  The file pages are
+  // then mapped over the middle of the reservation.
+  size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+  i64 alignedStart = start - (start % (i64) pageSize);
+  size_t pageOffset = (size_t) (start - alignedStart);
+  size_t fileMapLength = pageOffset + (size_t) length;
+  size_t totalLength = pageSize
+    + ((fileMapLength + pageSize - 1) & ~(pageSize - 1))
+    + pageSize;
+  u8 *base = (u8*) mmap(NULL, totalLength, PROT_READ,
+    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (base == MAP_FAILED) {
+    close(fd); fd = -1;
+    printLog(ERR, "Could not reserve %llu bytes for \"%s\".\n",
+      llu(totalLength), fullPath);
+    printLog(TRACE,
+      "EXIT getFileMapping(fullPath=\"%s\", start=%lld, length=%lld) = {NULL}\n",
+      (fullPath != NULL) ? fullPath : "NULL", lli(start), lli(length));
+    return NULL;
+  }
+  if (mmap(base + pageSize, fileMapLength, PROT_READ, MAP_PRIVATE | MAP_FIXED,
+    fd, (off_t) alignedStart) == MAP_FAILED
+  ) {
+    munmap(base, totalLength); base = NULL;
+    close(fd); fd = -1;
+    printLog(ERR, "Could not map %lld bytes of \"%s\".\n",
+      lld(length), fullPath);
+    printLog(TRACE,
+      "EXIT getFileMapping(fullPath=\"%s\", start=%lld, length=%lld) = {NULL}\n",
+      (fullPath != NULL) ? fullPath : "NULL", lli(start), lli(length));
+    return NULL;
+  }
+  close(fd); fd = -1;
+  
+  // Write the metadata.  This copies at most the first file page (when the
+  // BytesHeader lands in it) and the page holding the terminator (only when
+  // the view ends before the end of the file).
+  Bytes returnValue = base + pageSize + pageOffset;
+  fileMappingProtect(base, pageSize + pageOffset, PROT_READ | PROT_WRITE);
+  ((FileMappingHeader*) base)->totalLength = totalLength;
+  bytesSetLength(returnValue, length);
+  bytesSetSize(returnValue, length + 1);
+  fileMappingProtect(base, pageSize + pageOffset, PROT_READ);
+  if (returnValue[length] != '\0') {
+    fileMappingProtect(&returnValue[length], 1, PROT_READ | PROT_WRITE);
+    returnValue[length] = '\0';
+    fileMappingProtect(&returnValue[length], 1, PROT_READ);
+  }
+  
+  printLog(TRACE,
+    "EXIT getFileMapping(fullPath=\"%s\", start=%lld, length=%lld) = {%p}\n",
+    (fullPath != NULL) ? fullPath : "NULL", lli(start), lli(length), returnValue);
+  return returnValue;
+#endif // _WIN32
+}
+
+/// @fn Bytes fileMappingDestroy(Bytes fileMapping)
+///
+/// @brief Releases a view returned by getFileMapping.
+///
+/// @param fileMapping The view to release.  NULL is allowed.
+///
+/// @return This function always returns NULL.
+Bytes fileMappingDestroy(Bytes fileMapping) {
+  printLog(TRACE, "ENTER fileMappingDestroy(fileMapping=%p)\n", fileMapping);
+  
+  if (fileMapping != NULL) {
+#ifdef _WIN32
+    bytesDestroy(fileMapping);
+#else
+    // The view always starts in the page after the metadata page.
+    uintptr_t pageSize = (uintptr_t) sysconf(_SC_PAGESIZE);
+    u8 *base = (u8*) ((((uintptr_t) fileMapping) & ~(pageSize - 1))
+      - pageSize);
+    munmap(base, ((FileMappingHeader*) base)->totalLength);
+#endif // _WIN32
+  }
+  
+  printLog(TRACE, "EXIT fileMappingDestroy(fileMapping=%p) = {NULL}\n",
+    fileMapping);
+  return NULL;
+}
+
 /// @fn i64 putFileContent_(const char *fullPath, const volatile void *dataBuffer, i64 dataLength, i64 start, ...)
 ///
 /// @brief Writes the content of a buffer to a file (overwrites existing
@@ -624,6 +1378,8 @@ i64 putFileContent_(
 /// @param dataBuffer is a double-pointer to the string to append to.
 ///
 /// @return Returns the length of the contents read in.
+///
+/// @note For reading many lines from a large file, use a LineReader instead.
 u64 getFileLine(FILE *requestedFile, char **dataBuffer) {
   u64 returnValue = 0;
   
@@ -674,7 +1430,211 @@ u64 getFileLine(FILE *requestedFile, char **dataBuffer) {
   return returnValue;
 }
 
-/// @fn char unampersand(const char *inputString)
+/// @fn LineReader* lineReaderCreate(FILE *file, u64 bufferSize)
+///
+/// @brief Create a LineReader for an open file.
+///
+/// @param file The file to read from, opened in "rb" mode.  The LineReader
+///   does not take ownership of it.
+/// @param bufferSize The number of bytes to read at a time.  If 0,
+///   LINE_READER_BUFFER_SIZE is used.  The buffer grows as needed to hold
+///   lines longer than this.
+///
+/// @return Returns a newly-allocated LineReader on success, NULL on failure.
+LineReader* lineReaderCreate(FILE *file, u64 bufferSize) {
+  printLog(TRACE, "ENTER lineReaderCreate(file=%p, bufferSize=%llu)\n",
+    file, llu(bufferSize));
+  
+  if (file == NULL) {
+    printLog(TRACE, "No valid file passed in.\n");
+    printLog(TRACE, "EXIT lineReaderCreate(file=%p, bufferSize=%llu) = {NULL}\n",
+      file, llu(bufferSize));
+    return NULL;
+  }
+  if (bufferSize == 0) {
+    bufferSize = LINE_READER_BUFFER_SIZE;
+  }
+  
+  LineReader *lineReader = (LineReader*) calloc(1, sizeof(LineReader));
+  if (lineReader == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  // One extra byte so that there is always room to NULL terminate a line.
+  lineReader->buffer = (char*) malloc(bufferSize + 1);
+  if (lineReader->buffer == NULL) {
+    lineReader = (LineReader*) pointerDestroy(lineReader);
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  lineReader->file = file;
+  lineReader->bufferSize = bufferSize + 1;
+  
+  printLog(TRACE, "EXIT lineReaderCreate(file=%p, bufferSize=%llu) = {%p}\n",
+    file, llu(bufferSize), lineReader);
+  return lineReader;
+}
+
+/// @fn LineReader* lineReaderDestroy(LineReader *lineReader)
+///
+/// @brief Destroy a LineReader.  The underlying file is not closed.
+///
+/// @param lineReader The LineReader to destroy.
+///
+/// @return This function always returns NULL.
+LineReader* lineReaderDestroy(LineReader *lineReader) {
+  printLog(TRACE, "ENTER lineReaderDestroy(lineReader=%p)\n", lineReader);
+  
+  if (lineReader != NULL) {
+    lineReader->buffer = (char*) pointerDestroy(lineReader->buffer);
+    lineReader = (LineReader*) pointerDestroy(lineReader);
+  }
+  
+  printLog(TRACE, "EXIT lineReaderDestroy(lineReader=%p) = {NULL}\n",
+    lineReader);
+  return NULL;
+}
+
+/// @fn const char* lineReaderNext(LineReader *lineReader, u64 *length)
+///
+/// @brief Get the next line from a LineReader without copying it.
+///
+/// @param lineReader The LineReader to read from.
+/// @param length A pointer to where the length of the line, not including the
+///   trailing \n, is stored.  May be NULL.
+///
+/// @details Lines are located with memchr over the buffered data, and the file
+/// is only read in blocks of the LineReader's buffer size.  The returned line
+/// is NULL terminated in place of its \n.
+///
+/// @return Returns a pointer to the line inside the LineReader's buffer on
+/// success, NULL at end of file or on failure.  The pointer is only valid
+/// until the next call on the same LineReader.
+const char* lineReaderNext(LineReader *lineReader, u64 *length) {
+  printLog(FLOOD, "ENTER lineReaderNext(lineReader=%p)\n", lineReader);
+  
+  if (length != NULL) {
+    *length = 0;
+  }
+  if (lineReader == NULL) {
+    printLog(FLOOD, "EXIT lineReaderNext(lineReader=%p) = {NULL}\n",
+      lineReader);
+    return NULL;
+  }
+  
+  char *buffer = lineReader->buffer;
+  char *newline = NULL;
+  while (1) {
+    newline = (char*) memchr(&buffer[lineReader->searched], '\n',
+      lineReader->end - lineReader->searched);
+    if (newline != NULL) {
+      break;
+    }
+    lineReader->searched = lineReader->end;
+    if (lineReader->eof) {
+      break;
+    }
+    
+    // Need more data.  Move what's left of the current line to the front of
+    // the buffer, growing the buffer only if the line fills it.
+    if (lineReader->start > 0) {
+      lineReader->end -= lineReader->start;
+      lineReader->searched -= lineReader->start;
+      memmove(buffer, &buffer[lineReader->start], lineReader->end);
+      lineReader->start = 0;
+    }
+    if (lineReader->end == lineReader->bufferSize - 1) {
+      u64 bufferSize = ((lineReader->bufferSize - 1) << 1) + 1;
+      char *check = (char*) realloc(buffer, bufferSize);
+      if (check == NULL) {
+        LOG_MALLOC_FAILURE();
+        return NULL;
+      }
+      buffer = lineReader->buffer = check;
+      lineReader->bufferSize = bufferSize;
+    }
+    
+    size_t bytesRead = fread(&buffer[lineReader->end], 1,
+      (size_t) (lineReader->bufferSize - 1 - lineReader->end),
+      lineReader->file);
+    if (bytesRead == 0) {
+      lineReader->eof = true;
+    }
+    lineReader->end += bytesRead;
+  }
+  
+  if (lineReader->start == lineReader->end) {
+    // Nothing left.
+    printLog(FLOOD, "EXIT lineReaderNext(lineReader=%p) = {NULL}\n",
+      lineReader);
+    return NULL;
+  }
+  
+  char *line = &buffer[lineReader->start];
+  u64 lineEnd = (newline != NULL) ? (u64) (newline - buffer) : lineReader->end;
+  buffer[lineEnd] = '\0';
+  if (length != NULL) {
+    *length = lineEnd - lineReader->start;
+  }
+  lineReader->start = (newline != NULL) ? lineEnd + 1 : lineEnd;
+  lineReader->searched = lineReader->start;
+  
+  printLog(FLOOD, "EXIT lineReaderNext(lineReader=%p) = {%p}\n",
+    lineReader, line);
+  return line;
+}
+
+/// @fn Bytes lineReaderNextBytes(LineReader *lineReader)
+///
+/// @brief Get a copy of the next line from a LineReader.
+///
+/// @param lineReader The LineReader to read from.
+///
+/// @return Returns a newly-allocated Bytes object with the line, not including
+/// the trailing \n, on success, NULL at end of file or on failure.
+Bytes lineReaderNextBytes(LineReader *lineReader) {
+  u64 length = 0;
+  const char *line = lineReaderNext(lineReader, &length);
+  if (line == NULL) {
+    return NULL;
+  }
+  
+  Bytes returnValue = NULL;
+  bytesAddData(&returnValue, line, length);
+  return returnValue;
+}
+
+/// @fn Bytes* lineReaderNextFields_(LineReader *lineReader, ...)
+///
+/// @brief Get the next line from a LineReader split into fields.
+///
+/// @param lineReader The LineReader to read from.
+/// @param ... The field delimiter to split on.  If NULL, fieldDelim is used.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that makes the field delimiter optional.
+///
+/// @details Reading a file with recordDelim set to "\n" this way yields the
+/// same rows that stringToBytesTable would for the file's whole content,
+/// except that empty lines come back as a single empty field.
+///
+/// @return Returns a null-terminated array of Bytes objects, as from
+/// stringToBytesArray, on success, NULL at end of file or on failure.
+Bytes* lineReaderNextFields_(LineReader *lineReader, ...) {
+  va_list args;
+  va_start(args, lineReader);
+  const char *fieldDelimiter = va_arg(args, char*);
+  va_end(args);
+  
+  const char *line = lineReaderNext(lineReader, NULL);
+  if (line == NULL) {
+    return NULL;
+  }
+  
+  return stringToBytesArray(line, fieldDelimiter);
+}
+
+/// @fn char unampersand(const char *inputString)
 ///
 /// @brief This function converts HTML ampersand syntax to standard ASCII.
 ///
@@ -853,6 +1813,49 @@ char *strReplaceOneStr(
   return returnValue;
 }
 
+/// @fn static Bytes replaceData(const char *input, u64 inputLength, const char *findWhat, u64 findWhatLength, bool replaceToEnd, const char *replaceText)
+///
+/// @brief Common implementation of strReplaceStr and bytesReplaceStr.
+///
+/// @param input The data to examine.
+/// @param inputLength The number of bytes at input.
+/// @param findWhat The text to find, with any trailing '*' already removed.
+/// @param findWhatLength The length of findWhat.
+/// @param replaceToEnd Whether the first match and everything after it is
+///   replaced rather than every match.
+/// @param replaceText The text to put in place of each match.
+///
+/// @return Returns a new Bytes object with the replacements made on success,
+/// NULL on failure.
+static Bytes replaceData(const char *input, u64 inputLength,
+  const char *findWhat, u64 findWhatLength, bool replaceToEnd,
+  const char *replaceText
+) {
+  Bytes returnValue = NULL;
+  u64 replaceTextLength = strlen(replaceText);
+  const char *end = input + inputLength;
+  
+  // Track the remaining length instead of rescanning the input and output
+  // with strlen on every match.
+  bytesAllocate(&returnValue, inputLength);
+  const char *match = NULL;
+  while ((findWhatLength > 0)
+    && ((match = (const char*) dataFindData(input, end - input,
+      findWhat, findWhatLength)) != NULL)
+  ) {
+    bytesAddData(&returnValue, input, match - input);
+    bytesAddData(&returnValue, replaceText, replaceTextLength);
+    input = match + findWhatLength;
+    if (replaceToEnd) {
+      input = end;
+      break;
+    }
+  }
+  bytesAddData(&returnValue, input, end - input);
+  
+  return returnValue;
+}
+
 /// @fn char *strReplaceStr(const char *inputString, const char *findWhat, const char *replaceText)
 ///
 /// @brief Replace every occurrance of findWhat in inputString with replaceText.
@@ -909,23 +1912,18 @@ char *strReplaceStr(
     }
   }
   
-  const char *currentString = inputString;
-  do {
-    Bytes nonReplacedBytes = getBytesBetween(currentString, "", findWhatCopy);
-    if (nonReplacedBytes == NULL) {
-      // findWhat not found.
-      nonReplacedBytes = bytesDestroy(nonReplacedBytes);
-      straddstr(&returnValue, currentString);
-      break;
-    }
-    
-    straddstr(&returnValue, str(nonReplacedBytes));
-    currentString += bytesLength(nonReplacedBytes);
-    currentString += findWhatLength;
-    nonReplacedBytes = bytesDestroy(nonReplacedBytes);
-    straddstr(&returnValue, replaceText);
-  } while ((replaceToEnd == false) && (*currentString != '\0'));
+  Bytes replaced = replaceData(inputString, strlen(inputString),
+    findWhatCopy, findWhatLength, replaceToEnd, replaceText);
   findWhatCopy = stringDestroy(findWhatCopy);
+  if (replaced != NULL) {
+    returnValue = (char*) malloc(bytesLength(replaced) + 1);
+    if (returnValue != NULL) {
+      memcpy(returnValue, replaced, bytesLength(replaced) + 1);
+    } else {
+      LOG_MALLOC_FAILURE();
+    }
+    replaced = bytesDestroy(replaced);
+  }
   
   printLog(FLOOD,
     "EXIT strReplaceStr(inputString=\"%s\", findWhat=\"%s\", "
@@ -978,57 +1976,20 @@ char *escapeData(const volatile void *data, u64 length) {
     data, llu(length));
   
   if (data != NULL) {
-    const char *input = (const char*) data;
-    char escapedValue[4];
+    const u8 *input = (const u8*) data;
     
-    // Allocate the maximum amount of space we'll use.
-    returnValue = (char*) malloc((length * 3) + 1);
+    // Count the escapes first so that the output is allocated exactly once
+    // at exactly the right size.
+    returnValue
+      = (char*) malloc(length + (escapeCount(input, length) << 1) + 1);
     if (returnValue == NULL) {
       LOG_MALLOC_FAILURE();
       printLog(FLOOD, "EXIT escapeData(data=%p, length=%llu) = {NULL}\n",
         data, llu(length));
       return returnValue; // NULL
     }
-    u64 returnValueIndex = 0;
-    
-    for (u64 i = 0; i < length ; i++) {
-      u64 escapedValueLength = 3; // default
-      
-      if (input[i] < 32 || input[i] > 126) {
-        sprintf(escapedValue, "%%%02X", (u8) input[i]);
-      } else if (input[i] == '%') {
-        strcpy(escapedValue, "%25");
-      } else if (input[i] == '`') {
-        strcpy(escapedValue, "%60");
-      } else if (input[i] == '(') {
-        strcpy(escapedValue, "%28");
-      } else if (input[i] == ')') {
-        strcpy(escapedValue, "%29");
-      } else if (input[i] == '\\') {
-        strcpy(escapedValue, "%5C");
-      } else if (input[i] == '&') {
-        strcpy(escapedValue, "%26");
-      } else if (input[i] == '"') {
-        strcpy(escapedValue, "%22");
-      } else if (input[i] == '<') {
-        strcpy(escapedValue, "%3C");
-      } else if (input[i] == '>') {
-        strcpy(escapedValue, "%3E");
-      } else if (input[i] == '+') {
-        strcpy(escapedValue, "%2B");
-      } else if (input[i] == ' ') {
-        strcpy(escapedValue, "%20");
-      } else {
-        escapedValue[0] = input[i];
-        escapedValue[1] = '\0';
-        escapedValueLength = 1;
-      }
-      
-      strcpy(&returnValue[returnValueIndex], escapedValue);
-      returnValueIndex += escapedValueLength;
-    }
     
-    returnValue[returnValueIndex] = '\0';
+    escapeDataTo(returnValue, input, length);
   }
   
   printLog(FLOOD, "EXIT escapeData(data=%p, length=%llu) = {\"%s\"}\n",
@@ -1053,57 +2014,20 @@ Bytes escapeDataToBytes(const volatile void *data, u64 length) {
     data, llu(length));
   
   if (data != NULL) {
-    const char *input = (const char*) data;
-    char escapedValue[4];
+    const u8 *input = (const u8*) data;
     
-    // Allocate the maximum amount of space we'll use.
-    bytesAllocate(&returnValue, length * 3);
+    // Count the escapes first so that the output is allocated exactly once
+    // at exactly the right size.
+    bytesAllocate(&returnValue, length + (escapeCount(input, length) << 1));
     if (returnValue == NULL) {
       LOG_MALLOC_FAILURE();
       printLog(FLOOD, "EXIT escapeDataToBytes(data=%p, length=%llu) = {NULL}\n",
         data, llu(length));
       return returnValue; // NULL
     }
-    u64 returnValueIndex = 0;
-    
-    for (u64 i = 0; i < length ; i++) {
-      u64 escapedValueLength = 3; // default
-      
-      if (input[i] < 32 || input[i] > 126) {
-        sprintf(escapedValue, "%%%02X", (u8) input[i]);
-      } else if (input[i] == '%') {
-        strcpy(escapedValue, "%25");
-      } else if (input[i] == '`') {
-        strcpy(escapedValue, "%60");
-      } else if (input[i] == '(') {
-        strcpy(escapedValue, "%28");
-      } else if (input[i] == ')') {
-        strcpy(escapedValue, "%29");
-      } else if (input[i] == '\\') {
-        strcpy(escapedValue, "%5C");
-      } else if (input[i] == '&') {
-        strcpy(escapedValue, "%26");
-      } else if (input[i] == '"') {
-        strcpy(escapedValue, "%22");
-      } else if (input[i] == '<') {
-        strcpy(escapedValue, "%3C");
-      } else if (input[i] == '>') {
-        strcpy(escapedValue, "%3E");
-      } else if (input[i] == '+') {
-        strcpy(escapedValue, "%2B");
-      } else if (input[i] == ' ') {
-        strcpy(escapedValue, "%20");
-      } else {
-        escapedValue[0] = input[i];
-        escapedValue[1] = '\0';
-        escapedValueLength = 1;
-      }
-      
-      strcpy(str(&returnValue[returnValueIndex]), escapedValue);
-      returnValueIndex += escapedValueLength;
-    }
     
-    returnValue[returnValueIndex] = '\0';
+    bytesSetLength(returnValue,
+      escapeDataTo(str(returnValue), input, length));
   }
   
   printLog(FLOOD, "EXIT escapeDataToBytes(data=%p, length=%llu) = {\"%s\"}\n",
@@ -1153,19 +2077,23 @@ const char *strrstr(const char *haystack, const char *needle) {
       return NULL;
     }
     
-    const char *searchString = &haystack[haystackLen - needleLen];
-    while (searchString != haystack) {
-      if (strncmp(searchString, needle, needleLen) == 0) {
-        returnValue = searchString;
-        break;
-      }
-      searchString--;
+    if (needleLen == 0) {
+      // Everything matches an empty needle.  The last match is the end.
+      returnValue = &haystack[haystackLen];
     }
-    if ((returnValue == NULL) && (searchString == haystack)) {
-      // Check to see if the very beginning of the string matches.
-      if (strncmp(searchString, needle, needleLen) == 0) {
-        returnValue = searchString;
+    
+    // Walk the matches forward.  Each search is vectorized, which beats
+    // comparing at every position backward from the end.
+    const u8 *searchString = (const u8*) haystack;
+    const u8 *end = (const u8*) &haystack[haystackLen];
+    while ((needleLen > 0) && ((u64) (end - searchString) >= needleLen)) {
+      const u8 *match = findData(searchString, end - searchString,
+        (const u8*) needle, needleLen, false);
+      if (match == NULL) {
+        break;
       }
+      returnValue = (const char*) match;
+      searchString = match + 1;
     }
   }
   
@@ -1685,8 +2613,14 @@ Bytes bytesAllocate(Bytes *buffer, u64 size) {
       if (*buffer == NULL) {
         // Initial allocation.  Assume the user got it right and allocate
         // exactly as much space as requested (plus space for the header).
+        // If the thread has an Arena active, bump-allocate from it instead.
         bufferSize = size;
-        *buffer = (Bytes) malloc(bufferSize + sizeof(BytesHeader));
+        Arena *arena = arenaCurrent();
+        if (arena != NULL) {
+          *buffer = (Bytes) arenaAlloc(arena, bufferSize + sizeof(BytesHeader));
+        } else {
+          *buffer = (Bytes) malloc(bufferSize + sizeof(BytesHeader));
+        }
         if (*buffer == NULL) {
           LOG_MALLOC_FAILURE();
           return *buffer;
@@ -1704,11 +2638,21 @@ Bytes bytesAllocate(Bytes *buffer, u64 size) {
         // enough space, allocate twice the amount of requested space.  This
         // will reduce the need to resize this buffer in the future.
         bufferSize = size << 1;
-        BytesHeader *check = (BytesHeader*) realloc(bytesHeader,
-          bufferSize + sizeof(BytesHeader));
+        BytesHeader *check = NULL;
+        Arena *arena = arenaFind(bytesHeader);
+        if (arena != NULL) {
+          check = (BytesHeader*) arenaRealloc(arena, bytesHeader,
+            bytesSize(*buffer) + sizeof(BytesHeader),
+            bufferSize + sizeof(BytesHeader));
+        } else {
+          check = (BytesHeader*) realloc(bytesHeader,
+            bufferSize + sizeof(BytesHeader));
+        }
         if (check == NULL) {
           LOG_MALLOC_FAILURE();
-          bytesHeader = (BytesHeader*) pointerDestroy(bytesHeader);
+          if (arena == NULL) {
+            bytesHeader = (BytesHeader*) pointerDestroy(bytesHeader);
+          }
           *buffer = NULL;
           return *buffer;
         } else if (check != bytesHeader) {
@@ -1939,7 +2883,9 @@ Bytes bytesDestroy(Bytes value) {
   
   if (value != NULL) {
     BytesHeader *bytesHeader = &(((BytesHeader*) value)[-1]);
-    bytesHeader = (BytesHeader*) pointerDestroy(bytesHeader);
+    if (arenaFind(bytesHeader) == NULL) {
+      bytesHeader = (BytesHeader*) pointerDestroy(bytesHeader);
+    } // else the memory is released with its Arena.
     value = NULL;
   }
   
@@ -1947,6 +2893,226 @@ Bytes bytesDestroy(Bytes value) {
   return value;
 }
 
+/// @fn BytesView bytesViewFind(BytesView haystack, BytesView needle)
+///
+/// @brief Find the first occurrence of one view within another.
+///
+/// @param haystack The view to search.
+/// @param needle The view to search for.
+///
+/// @return Returns a view of the match inside haystack, a view with a NULL
+/// data pointer if needle is not found.
+BytesView bytesViewFind(BytesView haystack, BytesView needle) {
+  const Byte *match = (const Byte*) dataFindData(
+    haystack.data, haystack.length, needle.data, needle.length);
+  return bytesViewFromData(match, needle.length);
+}
+
+/// @fn int bytesViewCompare(BytesView valueA, BytesView valueB)
+///
+/// @brief Compare two views byte by byte.  A NULL view sorts before all others
+/// and a view that is a prefix of another sorts before it.
+///
+/// @param valueA The first view to compare.
+/// @param valueB The second view to compare.
+///
+/// @return Returns less than, equal to, or greater than zero if valueA is less
+/// than, equal to, or greater than valueB, respectively.
+int bytesViewCompare(BytesView valueA, BytesView valueB) {
+  if ((valueA.data == NULL) || (valueB.data == NULL)) {
+    return (valueA.data != NULL) - (valueB.data != NULL);
+  }
+  
+  u64 length = (valueA.length < valueB.length) ? valueA.length : valueB.length;
+  int returnValue = memcmp(valueA.data, valueB.data, length);
+  if (returnValue == 0) {
+    returnValue = (valueA.length > valueB.length)
+      - (valueA.length < valueB.length);
+  }
+  
+  return returnValue;
+}
+
+/// @fn int bytesViewCompareCi(BytesView valueA, BytesView valueB)
+///
+/// @brief Case-insensitive version of bytesViewCompare.  Only ASCII letters
+/// are folded.
+///
+/// @param valueA The first view to compare.
+/// @param valueB The second view to compare.
+///
+/// @return Returns less than, equal to, or greater than zero if valueA is less
+/// than, equal to, or greater than valueB, respectively.
+int bytesViewCompareCi(BytesView valueA, BytesView valueB) {
+  if ((valueA.data == NULL) || (valueB.data == NULL)) {
+    return (valueA.data != NULL) - (valueB.data != NULL);
+  }
+  
+  u64 length = (valueA.length < valueB.length) ? valueA.length : valueB.length;
+  for (u64 ii = 0; ii < length; ii++) {
+    int c1 = valueA.data[ii];
+    int c2 = valueB.data[ii];
+    if ((c1 >= 'A') && (c1 <= 'Z')) {
+      c1 += 32;
+    }
+    if ((c2 >= 'A') && (c2 <= 'Z')) {
+      c2 += 32;
+    }
+    if (c1 != c2) {
+      return c1 - c2;
+    }
+  }
+  
+  return (valueA.length > valueB.length) - (valueA.length < valueB.length);
+}
+
+/// @fn u64 bytesViewHash(BytesView view, u64 seed)
+///
+/// @brief Hash a view the same way hashMemory hashes the same bytes.
+///
+/// @param view The view to hash.
+/// @param seed The seed for the hash.
+///
+/// @return Returns the 64-bit hash of the view's bytes.
+u64 bytesViewHash(BytesView view, u64 seed) {
+  return hashMemory(view.data, view.length, seed);
+}
+
+/// @fn u64 bytesViewHashCi(BytesView view, u64 seed)
+///
+/// @brief Hash a view the same way hashMemoryCi hashes the same bytes.
+///
+/// @param view The view to hash.
+/// @param seed The seed for the hash.
+///
+/// @return Returns the 64-bit case-insensitive hash of the view's bytes.
+u64 bytesViewHashCi(BytesView view, u64 seed) {
+  return hashMemoryCi(view.data, view.length, seed);
+}
+
+/// @fn Bytes bytesAddView(Bytes *buffer, BytesView view)
+///
+/// @brief Append the bytes of a view to a Bytes object.
+///
+/// @param buffer A pointer to an allocated Bytes object or NULL.
+/// @param view The view to append.
+///
+/// @return Returns the updated Bytes object (also stored in *buffer).
+Bytes bytesAddView(Bytes *buffer, BytesView view) {
+  return bytesAddData(buffer, view.data, view.length);
+}
+
+/// @fn char* bytesViewToString(BytesView view)
+///
+/// @brief Copy a view into a new NULL-terminated string.
+///
+/// @param view The view to copy.
+///
+/// @return Returns a newly-allocated string on success, NULL on failure or if
+/// the view's data pointer is NULL.
+char* bytesViewToString(BytesView view) {
+  if (view.data == NULL) {
+    return NULL;
+  }
+  
+  char *returnValue = (char*) malloc(view.length + 1);
+  if (returnValue == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  memcpy(returnValue, view.data, view.length);
+  returnValue[view.length] = '\0';
+  
+  return returnValue;
+}
+
+/// @fn Bytes smallBytesSet(SmallBytes *smallBytes, const volatile void *data, u64 length)
+///
+/// @brief Set the value of a SmallBytes object.  Values of up to
+/// SMALL_BYTES_CAPACITY bytes are stored inside the object with no allocation.
+///
+/// @param smallBytes The SmallBytes object to set.  Must have been initialized
+///   with SMALL_BYTES_INITIALIZER or a previous call to this function.
+/// @param data The new value.  May point into the current value.
+/// @param length The number of bytes at data.
+///
+/// @return Returns the value as a read-only Bytes object on success, NULL on
+/// failure.  It must not be grown or destroyed; use smallBytesDestroy.
+Bytes smallBytesSet(SmallBytes *smallBytes, const volatile void *data,
+  u64 length
+) {
+  if (smallBytes == NULL) {
+    return NULL;
+  } else if (data == NULL) {
+    length = 0;
+  }
+  
+  if (length <= SMALL_BYTES_CAPACITY) {
+    // memmove in case data is part of the current inline value.
+    if (length > 0) {
+      memmove(smallBytes->data, (const void*) data, length);
+    }
+    smallBytes->data[length] = '\0';
+    smallBytes->header.length = length;
+    smallBytes->header.size = SMALL_BYTES_CAPACITY + 1;
+    smallBytes->heap = bytesDestroy(smallBytes->heap);
+  } else {
+    Bytes heap = NULL;
+    if (bytesAddData(&heap, data, length) == NULL) {
+      return NULL;
+    }
+    bytesDestroy(smallBytes->heap);
+    smallBytes->heap = heap;
+  }
+  
+  return smallBytesGet(smallBytes);
+}
+
+/// @fn Bytes smallBytesGet(SmallBytes *smallBytes)
+///
+/// @brief Get the value of a SmallBytes object as a Bytes object.
+///
+/// @param smallBytes The SmallBytes object to read.
+///
+/// @return Returns a read-only Bytes object that remains valid until the
+/// SmallBytes is set again or destroyed, NULL if smallBytes is NULL.
+Bytes smallBytesGet(SmallBytes *smallBytes) {
+  if (smallBytes == NULL) {
+    return NULL;
+  } else if (smallBytes->heap != NULL) {
+    return smallBytes->heap;
+  }
+  
+  return smallBytes->data;
+}
+
+/// @fn BytesView smallBytesView(SmallBytes *smallBytes)
+///
+/// @brief Get the value of a SmallBytes object as a BytesView.
+///
+/// @param smallBytes The SmallBytes object to read.
+///
+/// @return Returns a view of the value.
+BytesView smallBytesView(SmallBytes *smallBytes) {
+  return bytesViewFromBytes(smallBytesGet(smallBytes));
+}
+
+/// @fn void smallBytesDestroy(SmallBytes *smallBytes)
+///
+/// @brief Release any heap storage held by a SmallBytes object and reset it to
+/// empty.
+///
+/// @param smallBytes The SmallBytes object to clear.
+///
+/// @return This function returns no value.
+void smallBytesDestroy(SmallBytes *smallBytes) {
+  if (smallBytes != NULL) {
+    smallBytes->heap = bytesDestroy(smallBytes->heap);
+    smallBytes->header.length = 0;
+    smallBytes->data[0] = '\0';
+  }
+}
+
 /// @fn int arrayFindValueIndex(const char **array, const char *value)
 ///
 /// @brief Find the index of a value in a string array.
@@ -2073,23 +3239,12 @@ char *strstrci(const char *haystack, const char *needle) {
   }
   
   size_t needleLength = strlen(needle);
-  
-  char firstChar = *needle;
-  if ((firstChar >= 'A') && (firstChar <= 'Z')) {
-    firstChar += 32;
-  }
+  size_t haystackLength = strlen(haystack);
   
   const char *returnValue = NULL;
-  for (const char *where = haystack; *where != '\0'; where++) {
-    char c = *where;
-    if ((c >= 'A') && (c <= 'Z')) {
-      c += 32;
-    }
-    
-    if ((c == firstChar) && (strncmpci(where, needle, needleLength) == 0)) {
-      returnValue = where;
-      break;
-    }
+  if ((needleLength > 0) && (needleLength <= haystackLength)) {
+    returnValue = (const char*) findData((const u8*) haystack, haystackLength,
+      (const u8*) needle, needleLength, true);
   }
   
   printLog(TRACE, "EXIT strstrci(haystack=\"%s\", needle=\"%s\") = {%p}\n",
@@ -2211,36 +3366,15 @@ Bytes getBytesBetweenCi(const char *haystack, const char *start, const char *end
     return NULL;
   }
   
-  unsigned char *startAt = (unsigned char*) haystack;
-  if (*start != '\0') {
-    startAt = (unsigned char*) strstrci(haystack, start);
-    if (startAt == NULL) {
-      printLog(TRACE,
-        "EXIT getBytesBetweenCi(haystack=%s, start=%s, end=%s) = {NULL}\n",
-        haystack, start, end);
-      return NULL;
-    }
-    startAt += strlen(start);
-  }
-  
-  u64 length = 0;
-  if (*end != '\0') {
-    unsigned char *endAt = (unsigned char*) strstrci(
-      (char*) startAt, end);
-    if (endAt != NULL) {
-      length = endAt - startAt;
-    } else {
-      printLog(TRACE,
-        "EXIT getBytesBetweenCi(haystack=%s, start=%s, end=%s) = {NULL}\n",
-        haystack, start, end);
-      return NULL;
-    }
-  } else {
-    // We copy until the end of the haystack.
-    length = (u64) strlen(start);
+  BytesView view = getBytesBetweenCiView(haystack, start, end);
+  if (view.data == NULL) {
+    printLog(TRACE,
+      "EXIT getBytesBetweenCi(haystack=%s, start=%s, end=%s) = {NULL}\n",
+      haystack, start, end);
+    return NULL;
   }
   
-  Bytes returnValue = (Bytes) malloc(sizeof(BytesHeader) + length + 1);
+  Bytes returnValue = (Bytes) malloc(sizeof(BytesHeader) + view.length + 1);
   if (returnValue == NULL) {
     LOG_MALLOC_FAILURE();
     printLog(NEVER,
@@ -2249,10 +3383,10 @@ Bytes getBytesBetweenCi(const char *haystack, const char *start, const char *end
     return NULL;
   }
   returnValue += sizeof(BytesHeader);
-  bytesSetLength(returnValue, length);
-  bytesSetSize(returnValue, length + 1);
-  memcpy((void*) returnValue, startAt, length);
-  returnValue[length] = '\0';
+  bytesSetLength(returnValue, view.length);
+  bytesSetSize(returnValue, view.length + 1);
+  memcpy((void*) returnValue, view.data, view.length);
+  returnValue[view.length] = '\0';
   
   printLog(TRACE,
     "EXIT getBytesBetweenCi(haystack=%s, start=%s, end=%s) = {%s}\n",
@@ -2260,7 +3394,50 @@ Bytes getBytesBetweenCi(const char *haystack, const char *start, const char *end
   return returnValue;
 }
 
-/// @fn void unescapeBytes(Bytes input)
+/// @fn BytesView getBytesBetweenCiView(const char *haystack, const char *start, const char *end)
+///
+/// @brief Non-allocating version of getBytesBetweenCi.
+///
+/// @param haystack The string to search.
+/// @param start The starting string string to look for within haystack.  If
+///   this is an empty string, the view starts at the beginning of haystack.
+/// @param end The ending string to look for within haystack.  If this is an
+///   empty string, the view runs to the end of haystack.
+///
+/// @return Returns a view into haystack on success, a view with a NULL data
+/// pointer on failure.
+BytesView getBytesBetweenCiView(
+  const char *haystack, const char *start, const char *end
+) {
+  if ((haystack == NULL) || (start == NULL) || (end == NULL)) {
+    return bytesViewFromData(NULL, 0);
+  }
+  
+  const char *startAt = haystack;
+  if (*start != '\0') {
+    startAt = strstrci(haystack, start);
+    if (startAt == NULL) {
+      return bytesViewFromData(NULL, 0);
+    }
+    startAt += strlen(start);
+  }
+  
+  u64 length = 0;
+  if (*end != '\0') {
+    const char *endAt = strstrci(startAt, end);
+    if (endAt == NULL) {
+      return bytesViewFromData(NULL, 0);
+    }
+    length = endAt - startAt;
+  } else {
+    // The view runs to the end of the haystack.
+    length = (u64) strlen(startAt);
+  }
+  
+  return bytesViewFromData(startAt, length);
+}
+
+/// @fn void unescapeBytes(Bytes input)
 ///
 /// @brief This function unescapes URL-encoded bytes.  The bytes are
 ///   modified in place.
@@ -2280,6 +3457,19 @@ void unescapeBytes(Bytes input) {
         && (j < inputLength);
       i++, j++
     ) {
+      // Move the run of bytes that need no translation in one go.
+      u64 run = unescapeSafeLength(&input[j], inputLength - j);
+      if (run > 0) {
+        if (i != j) {
+          memmove(&input[i], &input[j], run);
+        }
+        i += run;
+        j += run;
+        if (j == inputLength) {
+          break;
+        }
+      }
+      
       input[i] = input[j];
       if (input[j] == '%') {
         char tempChar = hexToChar((char*) &input[j + 1]);
@@ -2447,22 +3637,8 @@ Bytes bytesReplaceStr(
     }
   }
   
-  const char *currentString = inputString;
-  do {
-    Bytes nonReplacedBytes = getBytesBetween(currentString, "", findWhatCopy);
-    if (nonReplacedBytes == NULL) {
-      // findWhat not found.
-      nonReplacedBytes = bytesDestroy(nonReplacedBytes);
-      bytesAddStr(&returnValue, currentString);
-      break;
-    }
-    
-    bytesAddBytes(&returnValue, nonReplacedBytes);
-    currentString += bytesLength(nonReplacedBytes);
-    currentString += findWhatLength;
-    nonReplacedBytes = bytesDestroy(nonReplacedBytes);
-    bytesAddStr(&returnValue, replaceText);
-  } while ((replaceToEnd == false) && (*currentString != '\0'));
+  returnValue = replaceData(inputString, strlen(inputString),
+    findWhatCopy, findWhatLength, replaceToEnd, replaceText);
   findWhatCopy = stringDestroy(findWhatCopy);
   
   printLog(TRACE,
@@ -2634,28 +3810,8 @@ void *dataFindData(const volatile void *vHaystack, u64 haystackLength,
     return NULL;
   }
   
-  void *returnValue = NULL;
-  const unsigned char *haystack = (unsigned char*) vHaystack;
-  const unsigned char *needle = (unsigned char*) vNeedle;
-  unsigned char firstNeedleChar = *needle;
-  u64 maxIndex = haystackLength - needleLength;
-  
-  // We'll only be comparing from the second character of needle onward, so
-  // adjust accordingly;
-  ++needle;
-  --needleLength;
-  
-  for (u64 i = 0; i <= maxIndex; ++i, ++haystack) {
-    if (*haystack == firstNeedleChar) {
-      // No need to compare the first character a second time.
-      if ((needleLength == 0)
-        || (memcmp((haystack + 1), needle, needleLength) == 0)
-      ) {
-        returnValue = (void*) haystack;
-        break;
-      }
-    }
-  }
+  void *returnValue = (void*) findData((const u8*) vHaystack, haystackLength,
+    (const u8*) vNeedle, needleLength, false);
   
   printLog(TRACE,
     "EXIT dataFindData(vHaystack=%p, haystackLength=%llu, "
@@ -2687,76 +3843,96 @@ Bytes getDataBetween(const volatile void *vHaystack, u64 haystackLength,
   const volatile void *start, u64 startLength,
   const volatile void *end, u64 endLength
 ) {
-  const unsigned char *haystack = (const unsigned char*) vHaystack;
-  
   printLog(TRACE,
     "ENTER getDataBetween(haystack=%p, haystackLength=%llu, "
     "start=%p, startLength=%llu, end=%p, endLength=%llu)\n",
-    haystack, llu(haystackLength), start, llu(startLength), end, llu(endLength));
+    vHaystack, llu(haystackLength), start, llu(startLength), end, llu(endLength));
   
-  // If the haystack is NULL then we have to return NULL.  It's not valid to
-  // return any data, including empty data, if we don't have a haystack.  All
-  // other combinations of parameters, including zero-length haystacks, are
-  // valid.
-  if (haystack == NULL) {
+  BytesView view = getDataBetweenView(vHaystack, haystackLength,
+    start, startLength, end, endLength);
+  if (view.data == NULL) {
     printLog(TRACE,
       "EXIT getDataBetween(haystack=%p, haystackLength=%llu, "
       "start=%p, startLength=%llu, end=%p, endLength=%llu) = {NULL}\n",
-      haystack, llu(haystackLength), start, llu(startLength), end, llu(endLength));
+      vHaystack, llu(haystackLength), start, llu(startLength), end, llu(endLength));
     return NULL;
   }
   
-  unsigned char *startAt = (unsigned char*) haystack;
-  if (startLength != 0) {
-    startAt = (unsigned char*) dataFindData(
-      haystack, haystackLength, start, startLength);
-    if (startAt == NULL) {
-      printLog(TRACE,
-        "EXIT getDataBetween(haystack=%p, haystackLength=%llu, "
-        "start=%p, startLength=%llu, end=%p, endLength=%llu) = {NULL}\n",
-        haystack, llu(haystackLength), start, llu(startLength), end, llu(endLength));
-      return NULL;
-    }
-    startAt += startLength;
-  }
-  
-  u64 length = haystackLength - (startAt - haystack);
-  if (endLength != 0) {
-    unsigned char *endAt = (unsigned char*) dataFindData(
-      startAt, length, end, endLength);
-    if (endAt != NULL) {
-      length = endAt - startAt;
-    } else {
-      printLog(TRACE,
-        "EXIT getDataBetween(haystack=%p, haystackLength=%llu, "
-        "start=%p, startLength=%llu, end=%p, endLength=%llu) = {NULL}\n",
-        haystack, llu(haystackLength), start, llu(startLength), end, llu(endLength));
-      return NULL;
-    }
-  } // else we copy until the end of the haystack.
-  
-  Bytes returnValue = (Bytes) malloc(sizeof(BytesHeader) + length + 1);
+  Bytes returnValue = (Bytes) malloc(sizeof(BytesHeader) + view.length + 1);
   if (returnValue == NULL) {
     LOG_MALLOC_FAILURE();
     printLog(NEVER,
       "EXIT getDataBetween(haystack=%p, haystackLength=%llu, "
       "start=%p, startLength=%llu, end=%p, endLength=%llu) = {NULL}\n",
-      haystack, llu(haystackLength), start, llu(startLength), end, llu(endLength));
+      vHaystack, llu(haystackLength), start, llu(startLength), end, llu(endLength));
     return NULL;
   }
   returnValue += sizeof(BytesHeader);
-  bytesSetLength(returnValue, length);
-  bytesSetSize(returnValue, length + 1);
-  memcpy((void*) returnValue, startAt, length);
-  returnValue[length] = '\0';
+  bytesSetLength(returnValue, view.length);
+  bytesSetSize(returnValue, view.length + 1);
+  memcpy((void*) returnValue, view.data, view.length);
+  returnValue[view.length] = '\0';
   
   printLog(TRACE,
     "EXIT getDataBetween(haystack=%p, haystackLength=%llu, "
     "start=%p, startLength=%llu, end=%p, endLength=%llu) = {%p}\n",
-    haystack, llu(haystackLength), start, llu(startLength), end, llu(endLength), returnValue);
+    vHaystack, llu(haystackLength), start, llu(startLength), end, llu(endLength), returnValue);
   return returnValue;
 }
 
+/// @fn BytesView getDataBetweenView(const volatile void *vHaystack, u64 haystackLength, const volatile void *start, u64 startLength, const volatile void *end, u64 endLength)
+///
+/// @brief Non-allocating version of getDataBetween.  Finds the data within a
+/// haystack between a starting piece of data and an ending piece of data.
+///
+/// @param vHaystack A pointer to the data to search.
+/// @param haystackLength The length of the data at haystack.
+/// @param start The starting data string to look for within haystack.
+/// @param startLength The length of the data at start.  If the length is zero,
+///   the view starts at the beginning of the haystack.
+/// @param end The ending data to look for within haystack.
+/// @param endLength The length of the data at end.  If the length is zero, the
+///   view runs to the end of haystack.
+///
+/// @return Returns a view into haystack on success, a view with a NULL data
+/// pointer if start or end is not found.
+BytesView getDataBetweenView(const volatile void *vHaystack, u64 haystackLength,
+  const volatile void *start, u64 startLength,
+  const volatile void *end, u64 endLength
+) {
+  const unsigned char *haystack = (const unsigned char*) vHaystack;
+  
+  // If the haystack is NULL then we have to return nothing.  It's not valid to
+  // return any data, including empty data, if we don't have a haystack.  All
+  // other combinations of parameters, including zero-length haystacks, are
+  // valid.
+  if (haystack == NULL) {
+    return bytesViewFromData(NULL, 0);
+  }
+  
+  const unsigned char *startAt = haystack;
+  if (startLength != 0) {
+    startAt = (const unsigned char*) dataFindData(
+      haystack, haystackLength, start, startLength);
+    if (startAt == NULL) {
+      return bytesViewFromData(NULL, 0);
+    }
+    startAt += startLength;
+  }
+  
+  u64 length = haystackLength - (startAt - haystack);
+  if (endLength != 0) {
+    const unsigned char *endAt = (const unsigned char*) dataFindData(
+      startAt, length, end, endLength);
+    if (endAt == NULL) {
+      return bytesViewFromData(NULL, 0);
+    }
+    length = endAt - startAt;
+  } // else the view runs until the end of the haystack.
+  
+  return bytesViewFromData(startAt, length);
+}
+
 /// @fn int vabprintf(Bytes *buffer, const char *formatString, va_list args)
 ///
 /// @brief Allocate a buffer for a string and print a formatted string to the
@@ -3136,392 +4312,1382 @@ bool bytesTableAddField(Bytes ***table, u64 beforeIndex) {
   return successful;
 }
 
-/// @fn Bytes dataToHexBytes(const volatile void *data, u64 length)
+extern char base64Characters[64];
+extern u32 base64Values[128];
+
+/// @var _hexDigits
 ///
-/// @brief Convert a data blob to a Bytes object containing the data's
-/// hexadecimal representation.
+/// @brief Lowercase hexadecimal digits indexed by nibble value.
+static const char _hexDigits[17] = "0123456789abcdef";
+
+/// @var _base64Decode
+///
+/// @brief Mapping of every byte value to its Base64 value.  Bytes that are not
+/// part of the Base64 alphabet (including '=') map to 0xff.
+static const u8 _base64Decode[256] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+  0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+  0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+  0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+  0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+  0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+  0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+  0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+/// @fn static inline u8 hexNibble(u8 c)
 ///
-/// @param data A pointer to the data to convert.
-/// @param length The number of bytes that make up the data.
+/// @brief Get the value of a single hexadecimal digit.
 ///
-/// @return Returns a newly-allocated Bytes object with the encoded data on
-/// success, NULL on failure.
-Bytes dataToHexBytes(const volatile void *data, u64 length) {
-  printLog(TRACE, "ENTER dataToHexBytes(data=%p, length=%llu)\n",
-    data, llu(length));
-  
-  Bytes returnValue = NULL;
-  if ((data == NULL) || (length == 0)) {
-    printLog(TRACE, "EXIT dataToHexBytes(data=%p, length=%llu) = {%p}\n",
-      data, llu(length), returnValue);
-    return returnValue;
+/// @param c The character to convert.
+///
+/// @return Returns the value of the digit (0-15), 0xff if c is not a
+/// hexadecimal digit.
+static inline u8 hexNibble(u8 c) {
+  u8 digit = c - '0';
+  if (digit < 10) {
+    return digit;
   }
-  
-  u64 returnValueLength = length << 1;
-  if (bytesAllocate(&returnValue, returnValueLength) == NULL) {
-    LOG_MALLOC_FAILURE();
-    return NULL;
+  u8 letter = (c | 0x20) - 'a';
+  if (letter < 6) {
+    return letter + 10;
   }
-  
-  char *characters = (char*) data;
-  
-  for (u64 i = 0, j = 0; i < length; i++, j += 2) {
-    // charToHex always returns 0, so there's no point in checking the return
-    // value here.
-    (void) charToHex(characters[i], false, str(&returnValue[j]));
+  return 0xff;
+}
+
+/// @fn static u64 hexEncodeScalar(char *output, const u8 *input, u64 length)
+///
+/// @brief Write the lowercase hexadecimal representation of input to output.
+///
+/// @param output The buffer to write to.  Must have room for 2 * length bytes.
+/// @param input The data to encode.
+/// @param length The number of bytes at input.
+///
+/// @return Returns the number of input bytes encoded, which is always length.
+static u64 hexEncodeScalar(char *output, const u8 *input, u64 length) {
+  for (u64 ii = 0; ii < length; ii++) {
+    output[0] = _hexDigits[input[ii] >> 4];
+    output[1] = _hexDigits[input[ii] & 0x0f];
+    output += 2;
   }
-  bytesSetLength(returnValue, returnValueLength);
-  returnValue[returnValueLength] = '\0';
   
-  printLog(TRACE, "EXIT dataToHexBytes(data=%p, length=%llu) = {%p}\n",
-    data, llu(length), returnValue);
-  return returnValue;
+  return length;
 }
 
-/// @fn Bytes hexStringToBytes(const char *hexString, u64 length)
+/// @fn static u64 hexDecodeScalar(u8 *output, const char *input, u64 length)
 ///
-/// @brief Convert a string of hexadecimal characters to its raw data equivalent
-/// in bytes form.
+/// @brief Decode pairs of hexadecimal digits.  A pair that contains anything
+/// other than a hexadecimal digit decodes to 0, the same as hexToChar.
 ///
-/// @param hexString A pointer to a string of purely-hexadecimal characters.
-/// @param length The number of bytes that make up the hexString.
+/// @param output The buffer to write to.  Must have room for length bytes.
+/// @param input The hexadecimal characters to decode.
+/// @param length The number of pairs at input.
 ///
-/// @return Returns a newly-allocated Bytes object with the decoded data on
-/// success, NULL on failure.
-Bytes hexStringToBytes(const char *hexString, u64 length) {
-  printLog(TRACE, "ENTER hexStringToBytes(hexString=%p, length=%llu)\n",
-    hexString, llu(length));
-  
-  Bytes returnValue = NULL;
-  if ((hexString == NULL) || (length == 0)) {
-    // Nothing to do.
-    printLog(TRACE, "EXIT hexStringToBytes(hexString=%p, length=%llu) = {%p}\n",
-      hexString, llu(length), returnValue);
-    return returnValue;
+/// @return Returns the number of pairs decoded, which is always length.
+static u64 hexDecodeScalar(u8 *output, const char *input, u64 length) {
+  for (u64 ii = 0; ii < length; ii++) {
+    u8 high = hexNibble((u8) input[0]);
+    u8 low = hexNibble((u8) input[1]);
+    output[ii] = (((high | low) & 0xf0) == 0) ? (u8) ((high << 4) | low) : 0;
+    input += 2;
   }
   
-  u64 returnValueLength = length >> 1;
-  if (bytesAllocate(&returnValue, returnValueLength) == NULL) {
-    LOG_MALLOC_FAILURE();
-    return NULL;
+  return length;
+}
+
+/// @fn static u64 base64EncodeScalar(char *output, const u8 *input, u64 length)
+///
+/// @brief Encode every complete three-byte group at input as four Base64
+/// characters.
+///
+/// @param output The buffer to write to.  Must have room for
+///   (length / 3) * 4 bytes.
+/// @param input The data to encode.
+/// @param length The number of bytes at input.
+///
+/// @return Returns the number of input bytes encoded, which is length rounded
+/// down to a multiple of 3.
+static u64 base64EncodeScalar(char *output, const u8 *input, u64 length) {
+  u64 numBytesInLoop = (length / 3) * 3;
+  for (u64 ii = 0; ii < numBytesInLoop; ii += 3) {
+    u32 numberToEncode
+      = (((u32) input[ii    ]) << 16)
+      | (((u32) input[ii + 1]) <<  8)
+      | (((u32) input[ii + 2])      );
+    
+    output[0] = base64Characters[(numberToEncode >> 18) & 0x3f];
+    output[1] = base64Characters[(numberToEncode >> 12) & 0x3f];
+    output[2] = base64Characters[(numberToEncode >>  6) & 0x3f];
+    output[3] = base64Characters[(numberToEncode      ) & 0x3f];
+    output += 4;
   }
   
-  for (u64 i = 0, j = 0; i < returnValueLength; i++, j += 2) {
-    returnValue[i] = hexToChar(&hexString[j]);
+  return numBytesInLoop;
+}
+
+/// @fn static u64 base64DecodeScalar(u8 *output, const char *input, u64 length)
+///
+/// @brief Decode complete groups of four Base64 characters, stopping at the
+/// first group that contains a character outside of the Base64 alphabet
+/// (padding, whitespace, or garbage).
+///
+/// @param output The buffer to write to.  Must have room for
+///   (length / 4) * 3 bytes.
+/// @param input The Base64 characters to decode.
+/// @param length The number of characters at input.
+///
+/// @return Returns the number of input characters decoded, which is always a
+/// multiple of 4.
+static u64 base64DecodeScalar(u8 *output, const char *input, u64 length) {
+  const u8 *characters = (const u8*) input;
+  u64 ii = 0;
+  for (; ii + 4 <= length; ii += 4) {
+    u8 a = _base64Decode[characters[ii    ]];
+    u8 b = _base64Decode[characters[ii + 1]];
+    u8 c = _base64Decode[characters[ii + 2]];
+    u8 d = _base64Decode[characters[ii + 3]];
+    if (((a | b | c | d) & 0x80) != 0) {
+      break;
+    }
+    
+    u32 numberToDecode = (a << 18) | (b << 12) | (c << 6) | d;
+    output[0] = (numberToDecode >> 16) & 0xff;
+    output[1] = (numberToDecode >>  8) & 0xff;
+    output[2] = (numberToDecode      ) & 0xff;
+    output += 3;
   }
-  bytesSetLength(returnValue, returnValueLength);
-  returnValue[returnValueLength] = '\0';
   
-  printLog(TRACE, "EXIT hexStringToBytes(hexString=%p, length=%llu) = {%p}\n",
-    hexString, llu(length), returnValue);
-  return returnValue;
+  return ii;
 }
 
-/// @fn bool dataIsString(const volatile void *data, u64 dataLength)
+#if defined(STRING_LIB_SSE2)
+/// @fn static inline __m128i hexNibblesSse2(__m128i characters, __m128i *invalid)
+///
+/// @brief Convert 16 hexadecimal digits to their values.
+///
+/// @param characters The characters to convert.
+/// @param invalid Accumulator that gets 0xff OR-ed into every lane that did
+///   not hold a hexadecimal digit.
+///
+/// @return Returns the nibble values of the valid lanes.
+static inline __m128i hexNibblesSse2(__m128i characters, __m128i *invalid) {
+  __m128i digit = _mm_sub_epi8(characters, _mm_set1_epi8('0'));
+  __m128i letter = _mm_sub_epi8(
+    _mm_or_si128(characters, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+  __m128i isDigit
+    = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+  __m128i isLetter
+    = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+  *invalid = _mm_or_si128(*invalid, _mm_andnot_si128(
+    _mm_or_si128(isDigit, isLetter), _mm_set1_epi8((char) 0xff)));
+  
+  return _mm_or_si128(_mm_and_si128(isDigit, digit),
+    _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+}
+
+/// @fn static u64 hexEncodeSsse3(char *output, const u8 *input, u64 length)
 ///
-/// @brief Determine whether or not a block of arbitrary data constitutes a
-/// C string.
+/// @brief SSSE3 version of hexEncodeScalar that encodes 16 bytes at a time.
 ///
-/// @param data A pointer to an arbitrary block of memory (cast to a void*).
-/// @param dataLength The number of bytes pointed to by the data pointer.
+/// @param output The buffer to write to.  Must have room for 2 * length bytes.
+/// @param input The data to encode.
+/// @param length The number of bytes at input.
 ///
-/// @return Returns true if the data provided constitutes a C string, false
-/// if not.
-bool dataIsString(const volatile void *data, u64 dataLength) {
-  printLog(TRACE, "ENTER dataIsString(data=%p, dataLength=%llu)\n",
-    data, llu(dataLength));
+/// @return Returns the number of input bytes encoded, which is always length.
+__attribute__((target("ssse3")))
+static u64 hexEncodeSsse3(char *output, const u8 *input, u64 length) {
+  const __m128i digits = _mm_loadu_si128((const __m128i*) _hexDigits);
+  const __m128i lowNibble = _mm_set1_epi8(0x0f);
   
-  u8 *dataBytes = (u8*) data;
-  bool returnValue = true;
-  u64 lastCharIndex = 0;
-  if (dataLength > 0) {
-    lastCharIndex = dataLength - 1;
+  u64 ii = 0;
+  for (; ii + 16 <= length; ii += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*) (input + ii));
+    __m128i high = _mm_shuffle_epi8(digits,
+      _mm_and_si128(_mm_srli_epi16(block, 4), lowNibble));
+    __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(block, lowNibble));
+    _mm_storeu_si128((__m128i*) (output + (ii << 1)),
+      _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128((__m128i*) (output + (ii << 1) + 16),
+      _mm_unpackhi_epi8(high, low));
+  }
+  
+  return ii + hexEncodeScalar(output + (ii << 1), input + ii, length - ii);
+}
+
+/// @fn static u64 hexDecodeSsse3(u8 *output, const char *input, u64 length)
+///
+/// @brief SSSE3 version of hexDecodeScalar that decodes 16 pairs at a time.
+/// Blocks that contain a non-hexadecimal character are left to the scalar
+/// code.
+///
+/// @param output The buffer to write to.  Must have room for length bytes.
+/// @param input The hexadecimal characters to decode.
+/// @param length The number of pairs at input.
+///
+/// @return Returns the number of pairs decoded, which is always length.
+__attribute__((target("ssse3")))
+static u64 hexDecodeSsse3(u8 *output, const char *input, u64 length) {
+  // Multiplying the high nibble by 16 and the low nibble by 1 and adding the
+  // products merges each pair of characters into one 16-bit lane.
+  const __m128i weights = _mm_set1_epi16(0x0110);
+  
+  u64 ii = 0;
+  for (; ii + 16 <= length; ii += 16) {
+    __m128i invalid = _mm_setzero_si128();
+    __m128i first = hexNibblesSse2(
+      _mm_loadu_si128((const __m128i*) (input + (ii << 1))), &invalid);
+    __m128i second = hexNibblesSse2(
+      _mm_loadu_si128((const __m128i*) (input + (ii << 1) + 16)), &invalid);
+    if (_mm_movemask_epi8(invalid) != 0) {
+      break;
+    }
+    
+    _mm_storeu_si128((__m128i*) (output + ii), _mm_packus_epi16(
+      _mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights)));
   }
   
-  if (data == NULL) {
-    // NULL data is not a string.
-    returnValue = false;
-    printLog(TRACE, "EXIT dataIsString(data=%p, dataLength=%llu) = {%s}\n",
-      data, llu(dataLength), boolNames[returnValue]);
-    return returnValue;
+  return ii + hexDecodeScalar(output + ii, input + (ii << 1), length - ii);
+}
+
+/// @fn static u64 base64EncodeSsse3(char *output, const u8 *input, u64 length)
+///
+/// @brief SSSE3 version of base64EncodeScalar that encodes 12 bytes at a time.
+///
+/// @details Each block is shuffled so that every 32-bit lane holds one
+/// three-byte group, the multiplies shift the four 6-bit indexes of each group
+/// into their own bytes, and a 16-entry table of offsets maps each index range
+/// (A-Z, a-z, 0-9, '+', '/') to its ASCII character.
+///
+/// @param output The buffer to write to.  Must have room for
+///   (length / 3) * 4 bytes.
+/// @param input The data to encode.
+/// @param length The number of bytes at input.
+///
+/// @return Returns the number of input bytes encoded, which is length rounded
+/// down to a multiple of 3.
+__attribute__((target("ssse3")))
+static u64 base64EncodeSsse3(char *output, const u8 *input, u64 length) {
+  const __m128i shuffle = _mm_set_epi8(
+    10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+  const __m128i offsets = _mm_setr_epi8(
+    'A', 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 0, 0);
+  
+  // Each iteration reads 16 bytes but only consumes 12.
+  u64 ii = 0;
+  for (; ii + 16 <= length; ii += 12) {
+    __m128i block = _mm_shuffle_epi8(
+      _mm_loadu_si128((const __m128i*) (input + ii)), shuffle);
+    __m128i indexes = _mm_or_si128(
+      _mm_mulhi_epu16(_mm_and_si128(block, _mm_set1_epi32(0x0fc0fc00)),
+        _mm_set1_epi32(0x04000040)),
+      _mm_mullo_epi16(_mm_and_si128(block, _mm_set1_epi32(0x003f03f0)),
+        _mm_set1_epi32(0x01000010)));
+    
+    // 0-25 -> 0, 26-51 -> 1, 52-61 -> 2-11, 62 -> 12, 63 -> 13.
+    __m128i range = _mm_sub_epi8(
+      _mm_subs_epu8(indexes, _mm_set1_epi8(51)),
+      _mm_cmpgt_epi8(indexes, _mm_set1_epi8(25)));
+    _mm_storeu_si128((__m128i*) (output + (ii / 3) * 4),
+      _mm_add_epi8(indexes, _mm_shuffle_epi8(offsets, range)));
   }
   
-  u64 i = 0;
-  for (i = 0; i < lastCharIndex; i++) {
-    if (((dataBytes[i] < 32) || (dataBytes[i] > 126))
-      && (dataBytes[i] != '\r') && (dataBytes[i] != '\n')
-      && (dataBytes[i] != '\0')
+  return ii + base64EncodeScalar(output + (ii / 3) * 4,
+    input + ii, length - ii);
+}
+
+/// @fn static u64 base64DecodeSsse3(u8 *output, const char *input, u64 length)
+///
+/// @brief SSSE3 version of base64DecodeScalar that decodes 16 characters at a
+/// time.
+///
+/// @details Two 16-entry tables indexed by the low and high nibbles of each
+/// character flag everything outside of the Base64 alphabet, a third table
+/// indexed by the high nibble gives the offset from ASCII to the 6-bit value,
+/// and the multiplies pack four 6-bit values into each three-byte group.
+///
+/// @param output The buffer to write to.  Must have room for
+///   (length / 4) * 3 bytes.
+/// @param input The Base64 characters to decode.
+/// @param length The number of characters at input.
+///
+/// @return Returns the number of input characters decoded, which is always a
+/// multiple of 4.
+__attribute__((target("ssse3")))
+static u64 base64DecodeSsse3(u8 *output, const char *input, u64 length) {
+  const __m128i lowFlags = _mm_setr_epi8(
+    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+  const __m128i highFlags = _mm_setr_epi8(
+    0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m128i offsets = _mm_setr_epi8(
+    0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i slash = _mm_set1_epi8(0x2f);
+  const __m128i shuffle = _mm_setr_epi8(
+    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  
+  u64 ii = 0;
+  for (; ii + 16 <= length; ii += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*) (input + ii));
+    __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(block, 4), slash);
+    __m128i flags = _mm_and_si128(
+      _mm_shuffle_epi8(lowFlags, _mm_and_si128(block, slash)),
+      _mm_shuffle_epi8(highFlags, highNibbles));
+    if (_mm_movemask_epi8(
+      _mm_cmpgt_epi8(flags, _mm_setzero_si128())) != 0
     ) {
-      returnValue = false;
       break;
     }
+    
+    // '/' shares its high nibble with '+', so it gets its own table entry.
+    block = _mm_add_epi8(block, _mm_shuffle_epi8(offsets,
+      _mm_add_epi8(_mm_cmpeq_epi8(block, slash), highNibbles)));
+    block = _mm_madd_epi16(
+      _mm_maddubs_epi16(block, _mm_set1_epi32(0x01400140)),
+      _mm_set1_epi32(0x00011000));
+    block = _mm_shuffle_epi8(block, shuffle);
+    
+    u8 *decoded = output + (ii >> 2) * 3;
+    u32 tail = (u32) _mm_cvtsi128_si32(_mm_srli_si128(block, 8));
+    _mm_storel_epi64((__m128i*) decoded, block);
+    memcpy(decoded + 8, &tail, sizeof(tail));
   }
   
-  if (dataBytes[i] != '\0') {
-    returnValue = false;
-  }
-  
-  printLog(TRACE, "EXIT dataIsString(data=%p, dataLength=%llu) = {%s}\n",
-    data, llu(dataLength), boolNames[returnValue]);
-  return returnValue;
+  return ii + base64DecodeScalar(output + (ii >> 2) * 3,
+    input + ii, length - ii);
+}
+#elif defined(STRING_LIB_NEON)
+/// @fn static inline uint8x16_t hexNibblesNeon(uint8x16_t characters, uint8x16_t *valid)
+///
+/// @brief Convert 16 hexadecimal digits to their values.
+///
+/// @param characters The characters to convert.
+/// @param valid Accumulator that gets every lane that did not hold a
+///   hexadecimal digit cleared.
+///
+/// @return Returns the nibble values of the valid lanes.
+static inline uint8x16_t hexNibblesNeon(uint8x16_t characters,
+  uint8x16_t *valid
+) {
+  uint8x16_t digit = vsubq_u8(characters, vdupq_n_u8('0'));
+  uint8x16_t letter
+    = vsubq_u8(vorrq_u8(characters, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+  uint8x16_t isDigit = vcltq_u8(digit, vdupq_n_u8(10));
+  *valid = vandq_u8(*valid,
+    vorrq_u8(isDigit, vcltq_u8(letter, vdupq_n_u8(6))));
+  
+  return vbslq_u8(isDigit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
 }
 
-/// @fn bool dataIsAscii(const volatile void *data, u64 dataLength)
+/// @fn static u64 hexEncodeNeon(char *output, const u8 *input, u64 length)
 ///
-/// @brief Determine whether or not a block of arbitrary data constitutes a
-/// C string.
+/// @brief NEON version of hexEncodeScalar that encodes 16 bytes at a time.
 ///
-/// @param data A pointer to an arbitrary block of memory (cast to a void*).
-/// @param dataLength The number of bytes pointed to by the data pointer.
+/// @param output The buffer to write to.  Must have room for 2 * length bytes.
+/// @param input The data to encode.
+/// @param length The number of bytes at input.
 ///
-/// @return Returns true if the data provided constitutes a C string, false
-/// if not.
-bool dataIsAscii(const volatile void *data, u64 dataLength) {
-  printLog(TRACE, "ENTER dataIsAscii(data=%p, dataLength=%llu)\n",
-    data, llu(dataLength));
+/// @return Returns the number of input bytes encoded, which is always length.
+static u64 hexEncodeNeon(char *output, const u8 *input, u64 length) {
+  const uint8x16_t digits = vld1q_u8((const u8*) _hexDigits);
   
-  u8 *dataBytes = (u8*) data;
-  bool returnValue = true;
-  u64 lastCharIndex = 0;
-  if (dataLength > 0) {
-    lastCharIndex = dataLength - 1;
+  u64 ii = 0;
+  for (; ii + 16 <= length; ii += 16) {
+    uint8x16_t block = vld1q_u8(input + ii);
+    uint8x16x2_t pairs;
+    pairs.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(block, 4));
+    pairs.val[1] = vqtbl1q_u8(digits, vandq_u8(block, vdupq_n_u8(0x0f)));
+    vst2q_u8((u8*) output + (ii << 1), pairs);
   }
   
-  if (data == NULL) {
-    // NULL data is not a string.
-    returnValue = false;
-    printLog(TRACE, "EXIT dataIsAscii(data=%p, dataLength=%llu) = {%s}\n",
-      data, llu(dataLength), boolNames[returnValue]);
-    return returnValue;
+  return ii + hexEncodeScalar(output + (ii << 1), input + ii, length - ii);
+}
+
+/// @fn static u64 hexDecodeNeon(u8 *output, const char *input, u64 length)
+///
+/// @brief NEON version of hexDecodeScalar that decodes 16 pairs at a time.
+/// Blocks that contain a non-hexadecimal character are left to the scalar
+/// code.
+///
+/// @param output The buffer to write to.  Must have room for length bytes.
+/// @param input The hexadecimal characters to decode.
+/// @param length The number of pairs at input.
+///
+/// @return Returns the number of pairs decoded, which is always length.
+static u64 hexDecodeNeon(u8 *output, const char *input, u64 length) {
+  u64 ii = 0;
+  for (; ii + 16 <= length; ii += 16) {
+    uint8x16x2_t pairs = vld2q_u8((const u8*) input + (ii << 1));
+    uint8x16_t valid = vdupq_n_u8(0xff);
+    uint8x16_t high = hexNibblesNeon(pairs.val[0], &valid);
+    uint8x16_t low = hexNibblesNeon(pairs.val[1], &valid);
+    if (vminvq_u8(valid) == 0) {
+      break;
+    }
+    
+    vst1q_u8(output + ii, vorrq_u8(vshlq_n_u8(high, 4), low));
   }
   
-  u64 i = 0;
-  for (i = 0; i < lastCharIndex; i++) {
-    if (dataBytes[i] > 127) {
-      returnValue = false;
+  return ii + hexDecodeScalar(output + ii, input + (ii << 1), length - ii);
+}
+
+/// @fn static u64 base64EncodeNeon(char *output, const u8 *input, u64 length)
+///
+/// @brief NEON version of base64EncodeScalar that encodes 48 bytes at a time.
+///
+/// @param output The buffer to write to.  Must have room for
+///   (length / 3) * 4 bytes.
+/// @param input The data to encode.
+/// @param length The number of bytes at input.
+///
+/// @return Returns the number of input bytes encoded, which is length rounded
+/// down to a multiple of 3.
+static u64 base64EncodeNeon(char *output, const u8 *input, u64 length) {
+  const u8 *alphabet = (const u8*) base64Characters;
+  uint8x16x4_t table;
+  table.val[0] = vld1q_u8(alphabet);
+  table.val[1] = vld1q_u8(alphabet + 16);
+  table.val[2] = vld1q_u8(alphabet + 32);
+  table.val[3] = vld1q_u8(alphabet + 48);
+  const uint8x16_t sixBits = vdupq_n_u8(0x3f);
+  
+  u64 ii = 0;
+  for (; ii + 48 <= length; ii += 48) {
+    // vld3q splits the block into the first, second, and third bytes of each
+    // group.
+    uint8x16x3_t block = vld3q_u8(input + ii);
+    uint8x16x4_t encoded;
+    encoded.val[0] = vshrq_n_u8(block.val[0], 2);
+    encoded.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(block.val[0], 4),
+      vshrq_n_u8(block.val[1], 4)), sixBits);
+    encoded.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(block.val[1], 2),
+      vshrq_n_u8(block.val[2], 6)), sixBits);
+    encoded.val[3] = vandq_u8(block.val[2], sixBits);
+    for (int jj = 0; jj < 4; jj++) {
+      encoded.val[jj] = vqtbl4q_u8(table, encoded.val[jj]);
+    }
+    vst4q_u8((u8*) output + (ii / 3) * 4, encoded);
+  }
+  
+  return ii + base64EncodeScalar(output + (ii / 3) * 4,
+    input + ii, length - ii);
+}
+
+/// @fn static u64 base64DecodeNeon(u8 *output, const char *input, u64 length)
+///
+/// @brief NEON version of base64DecodeScalar that decodes 64 characters at a
+/// time.
+///
+/// @param output The buffer to write to.  Must have room for
+///   (length / 4) * 3 bytes.
+/// @param input The Base64 characters to decode.
+/// @param length The number of characters at input.
+///
+/// @return Returns the number of input characters decoded, which is always a
+/// multiple of 4.
+static u64 base64DecodeNeon(u8 *output, const char *input, u64 length) {
+  // Out-of-range table indexes produce 0, so characters 0-63 are looked up in
+  // the first table, 64-127 in the second, and 128-255 are flagged separately.
+  uint8x16x4_t lowTable, highTable;
+  for (int jj = 0; jj < 4; jj++) {
+    lowTable.val[jj] = vld1q_u8(_base64Decode + (jj << 4));
+    highTable.val[jj] = vld1q_u8(_base64Decode + 64 + (jj << 4));
+  }
+  
+  u64 ii = 0;
+  for (; ii + 64 <= length; ii += 64) {
+    uint8x16x4_t block = vld4q_u8((const u8*) input + ii);
+    uint8x16_t errors = vdupq_n_u8(0);
+    for (int jj = 0; jj < 4; jj++) {
+      uint8x16_t characters = block.val[jj];
+      block.val[jj] = vorrq_u8(vorrq_u8(
+        vqtbl4q_u8(lowTable, characters),
+        vqtbl4q_u8(highTable, veorq_u8(characters, vdupq_n_u8(0x40)))),
+        vtstq_u8(characters, vdupq_n_u8(0x80)));
+      errors = vorrq_u8(errors, block.val[jj]);
+    }
+    if (vmaxvq_u8(errors) > 0x3f) {
       break;
     }
+    
+    uint8x16x3_t decoded;
+    decoded.val[0] = vorrq_u8(vshlq_n_u8(block.val[0], 2),
+      vshrq_n_u8(block.val[1], 4));
+    decoded.val[1] = vorrq_u8(vshlq_n_u8(block.val[1], 4),
+      vshrq_n_u8(block.val[2], 2));
+    decoded.val[2] = vorrq_u8(vshlq_n_u8(block.val[2], 6), block.val[3]);
+    vst3q_u8(output + (ii >> 2) * 3, decoded);
   }
   
-  printLog(TRACE, "EXIT dataIsAscii(data=%p, dataLength=%llu) = {%s}\n",
-    data, llu(dataLength), boolNames[returnValue]);
-  return returnValue;
+  return ii + base64DecodeScalar(output + (ii >> 2) * 3,
+    input + ii, length - ii);
 }
+#endif
 
-/// @fn bool nonPrintableToWhitespace(const volatile void *data, u64 dataLength)
+/// @struct CodecKernels
+///
+/// @brief The set of hex and Base64 kernels to use on this CPU.
+typedef struct CodecKernels {
+  u64 (*hexEncode)(char *output, const u8 *input, u64 length);
+  u64 (*hexDecode)(u8 *output, const char *input, u64 length);
+  u64 (*base64Encode)(char *output, const u8 *input, u64 length);
+  u64 (*base64Decode)(u8 *output, const char *input, u64 length);
+} CodecKernels;
+
+/// @var _scalarCodecKernels
+///
+/// @brief Portable kernels used when no vector unit is available.
+static const CodecKernels _scalarCodecKernels = {
+  hexEncodeScalar,
+  hexDecodeScalar,
+  base64EncodeScalar,
+  base64DecodeScalar
+};
+
+#if defined(STRING_LIB_SSE2)
+/// @var _ssse3CodecKernels
+///
+/// @brief Kernels for x86 CPUs with SSSE3 (every CPU with AVX2 has it).
+static const CodecKernels _ssse3CodecKernels = {
+  hexEncodeSsse3,
+  hexDecodeSsse3,
+  base64EncodeSsse3,
+  base64DecodeSsse3
+};
+#elif defined(STRING_LIB_NEON)
+/// @var _neonCodecKernels
+///
+/// @brief Kernels for ARM CPUs with NEON.
+static const CodecKernels _neonCodecKernels = {
+  hexEncodeNeon,
+  hexDecodeNeon,
+  base64EncodeNeon,
+  base64DecodeNeon
+};
+#endif
+
+/// @var _codecKernels
 ///
-/// @brief Determine whether or not a block of arbitrary data constitutes a
-/// C string.
+/// @brief The best codec kernels for this CPU.  Selected on first use.
+static const CodecKernels *_codecKernels = NULL;
+
+/// @fn static inline const CodecKernels* codecKernels(void)
+///
+/// @brief Get the fastest hex and Base64 kernels the CPU supports.
+///
+/// @return Returns a pointer to a static CodecKernels.
+static inline const CodecKernels* codecKernels(void) {
+  const CodecKernels *kernels = _codecKernels;
+  if (kernels == NULL) {
+    // Every thread that races here picks the same kernels, so there's no
+    // need for a lock.
+#if defined(STRING_LIB_SSE2)
+    kernels = (__builtin_cpu_supports("ssse3"))
+      ? &_ssse3CodecKernels : &_scalarCodecKernels;
+#elif defined(STRING_LIB_NEON)
+    kernels = &_neonCodecKernels;
+#else
+    kernels = &_scalarCodecKernels;
+#endif
+    _codecKernels = kernels;
+  }
+  
+  return kernels;
+}
+
+/// @fn static u64 base64EncodeTail(char *output, const u8 *input, u64 length)
 ///
-/// @param data A pointer to an arbitrary block of memory (cast to a void*).
-/// @param dataLength The number of bytes pointed to by the data pointer.
+/// @brief Encode the final one or two bytes of a Base64 stream, padding the
+/// output with '='.
 ///
-/// @return Returns true if the data provided constitutes a C string, false
-/// if not.
-bool nonPrintableToWhitespace(const volatile void *data, u64 dataLength) {
-  printLog(TRACE, "ENTER nonPrintableToWhitespace(data=%p, dataLength=%llu)\n",
-    data, llu(dataLength));
+/// @param output The buffer to write to.  Must have room for 4 bytes.
+/// @param input The data to encode.
+/// @param length The number of bytes at input.  Must be 1 or 2.
+///
+/// @return Returns the number of characters written, which is always 4.
+static u64 base64EncodeTail(char *output, const u8 *input, u64 length) {
+  u32 numberToEncode
+    = (((u32) input[0]) << 16)
+    | ((length > 1) ? (((u32) input[1]) << 8) : 0);
   
-  u8 *dataBytes = (u8*) data;
-  bool returnValue = true;
+  output[0] = base64Characters[(numberToEncode >> 18) & 0x3f];
+  output[1] = base64Characters[(numberToEncode >> 12) & 0x3f];
+  output[2] = (length > 1)
+    ? base64Characters[(numberToEncode >> 6) & 0x3f]
+    : '=';
+  output[3] = '=';
   
-  if (data == NULL) {
-    // NULL data is not a string.
-    returnValue = false;
-    printLog(TRACE,
-      "EXIT nonPrintableToWhitespace(data=%p, dataLength=%llu) = {%s}\n",
-      data, llu(dataLength), boolNames[returnValue]);
-    return returnValue;
+  return 4;
+}
+
+/// @fn static u64 base64DecodeQuad(u8 *output, const u8 *input)
+///
+/// @brief Decode one group of four Base64 characters that the vector kernels
+/// rejected.  Trailing '=' padding shortens the output and any other
+/// character outside of the alphabet decodes as 0, the same as base64ToBytes
+/// always has.
+///
+/// @param output The buffer to write to.  Must have room for 3 bytes.
+/// @param input The four characters to decode.
+///
+/// @return Returns the number of bytes written (1 - 3).
+static u64 base64DecodeQuad(u8 *output, const u8 *input) {
+  u32 numberToDecode
+    = (base64Values[input[0] & 0x7f] << 18)
+    | (base64Values[input[1] & 0x7f] << 12)
+    | (base64Values[input[2] & 0x7f] <<  6)
+    | (base64Values[input[3] & 0x7f]      );
+  u64 numBytes = (input[3] != '=') ? 3 : (input[2] != '=') ? 2 : 1;
+  
+  output[0] = (numberToDecode >> 16) & 0xff;
+  if (numBytes > 1) {
+    output[1] = (numberToDecode >> 8) & 0xff;
+  }
+  if (numBytes > 2) {
+    output[2] = numberToDecode & 0xff;
   }
   
-  for (u64 i = 0; i < dataLength; i++) {
-    if (((dataBytes[i] < 32) || (dataBytes[i] > 126))
-      && (dataBytes[i] != '\r') && (dataBytes[i] != '\n')
-      && (dataBytes[i] != '\0')
-    ) {
-      dataBytes[i] = ' ';
+  return numBytes;
+}
+
+/// @fn u64 base64EncodedLength(u64 dataLength)
+///
+/// @brief Get the length of the padded Base64 encoding of a block of data.
+///
+/// @param dataLength The number of bytes to be encoded.
+///
+/// @return Returns the number of characters dataToBase64 will produce.
+u64 base64EncodedLength(u64 dataLength) {
+  return ((dataLength + 2) / 3) << 2;
+}
+
+/// @fn u64 base64DecodedLength(const char *base64String, u64 base64StringLength)
+///
+/// @brief Get the number of bytes a padded Base64 string decodes to.
+///
+/// @param base64String The Base64 string that will be decoded.
+/// @param base64StringLength The number of characters at base64String.  Must
+///   be a multiple of 4.
+///
+/// @return Returns the number of bytes base64ToBytes will produce.
+u64 base64DecodedLength(const char *base64String, u64 base64StringLength) {
+  if ((base64String == NULL) || (base64StringLength < 4)) {
+    return 0;
+  }
+  
+  u64 outputLength = (base64StringLength >> 2) * 3;
+  if (base64String[base64StringLength - 1] == '=') {
+    outputLength--;
+    if (base64String[base64StringLength - 2] == '=') {
+      outputLength--;
     }
   }
   
-  printLog(TRACE,
-    "EXIT nonPrintableToWhitespace(data=%s, dataLength=%llu) = {%s}\n",
-    str(data), llu(dataLength), boolNames[returnValue]);
-  return returnValue;
+  return outputLength;
 }
 
-extern char base64Characters[64];
-extern u32 base64Values[128];
+/// @fn Bytes hexEncodeChunk(Bytes *output, const volatile void *data, u64 dataLength)
+///
+/// @brief Append the lowercase hexadecimal representation of a chunk of data
+/// to a Bytes object.  Hex has no state between chunks, so a large input can
+/// be encoded chunk by chunk just by calling this repeatedly.
+///
+/// @param output A pointer to the Bytes object to append to.  *output may be
+///   NULL, in which case a new Bytes object is allocated.
+/// @param data A pointer to the data to encode.
+/// @param dataLength The number of bytes at data.
+///
+/// @return Returns the updated *output on success, NULL on failure.
+Bytes hexEncodeChunk(Bytes *output, const volatile void *data,
+  u64 dataLength
+) {
+  printLog(TRACE, "ENTER hexEncodeChunk(output=%p, data=%p, dataLength=%llu)\n",
+    output, data, llu(dataLength));
+  
+  if ((output == NULL) || ((data == NULL) && (dataLength > 0))) {
+    printLog(ERR, "Invalid parameters.\n");
+    printLog(TRACE, "EXIT hexEncodeChunk(output=%p, data=%p, "
+      "dataLength=%llu) = {NULL}\n", output, data, llu(dataLength));
+    return NULL;
+  }
+  
+  u64 outputLength = bytesLength(*output);
+  if (bytesAllocate(output, outputLength + (dataLength << 1)) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  
+  codecKernels()->hexEncode((char*) *output + outputLength,
+    (const u8*) data, dataLength);
+  outputLength += dataLength << 1;
+  bytesSetLength(*output, outputLength);
+  (*output)[outputLength] = '\0';
+  
+  printLog(TRACE, "EXIT hexEncodeChunk(output=%p, data=%p, dataLength=%llu) "
+    "= {%p}\n", output, data, llu(dataLength), *output);
+  return *output;
+}
 
-/// @fn Bytes dataToBase64(const volatile void *data, u64 dataLength)
+/// @fn Bytes hexDecodeChunk(CodecStream *stream, Bytes *output, const char *hexString, u64 hexStringLength)
+///
+/// @brief Decode a chunk of a hexadecimal string and append the result to a
+/// Bytes object.  A digit left over at the end of the chunk is carried in the
+/// stream and paired with the first digit of the next chunk.
+///
+/// @param stream The CodecStream that tracks the state between chunks.  Must
+///   be initialized with CODEC_STREAM_INITIALIZER before the first chunk.
+/// @param output A pointer to the Bytes object to append to.  *output may be
+///   NULL, in which case a new Bytes object is allocated.
+/// @param hexString A pointer to the hexadecimal characters to decode.
+/// @param hexStringLength The number of characters at hexString.
+///
+/// @return Returns the updated *output on success, NULL on failure.
+Bytes hexDecodeChunk(CodecStream *stream, Bytes *output,
+  const char *hexString, u64 hexStringLength
+) {
+  printLog(TRACE, "ENTER hexDecodeChunk(stream=%p, output=%p, hexString=%p, "
+    "hexStringLength=%llu)\n",
+    stream, output, hexString, llu(hexStringLength));
+  
+  if ((stream == NULL) || (output == NULL)
+    || ((hexString == NULL) && (hexStringLength > 0))
+  ) {
+    printLog(ERR, "Invalid parameters.\n");
+    printLog(TRACE, "EXIT hexDecodeChunk(stream=%p, output=%p, hexString=%p, "
+      "hexStringLength=%llu) = {NULL}\n",
+      stream, output, hexString, llu(hexStringLength));
+    return NULL;
+  }
+  
+  // Size the output once for everything this chunk can produce.
+  u64 outputLength = bytesLength(*output);
+  u64 numPairs = (stream->numPending + hexStringLength) >> 1;
+  if (bytesAllocate(output, outputLength + numPairs) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  
+  u8 *outputChars = *output + outputLength;
+  if ((stream->numPending > 0) && (hexStringLength > 0)) {
+    stream->pending[1] = (u8) *hexString++;
+    hexStringLength--;
+    hexDecodeScalar(outputChars++, (const char*) stream->pending, 1);
+    stream->numPending = 0;
+  }
+  
+  u64 chunkPairs = hexStringLength >> 1;
+  codecKernels()->hexDecode(outputChars, hexString, chunkPairs);
+  outputChars += chunkPairs;
+  if ((hexStringLength & 1) != 0) {
+    stream->pending[0] = (u8) hexString[hexStringLength - 1];
+    stream->numPending = 1;
+  }
+  
+  outputLength = (u64) (outputChars - *output);
+  bytesSetLength(*output, outputLength);
+  (*output)[outputLength] = '\0';
+  
+  printLog(TRACE, "EXIT hexDecodeChunk(stream=%p, output=%p, hexString=%p, "
+    "hexStringLength=%llu) = {%p}\n",
+    stream, output, hexString, llu(hexStringLength), *output);
+  return *output;
+}
+
+/// @fn Bytes base64EncodeChunk(CodecStream *stream, Bytes *output, const volatile void *data, u64 dataLength)
 ///
-/// @brief Convert an arbitrary blob of data to its base64 representation.
+/// @brief Base64-encode a chunk of data and append the result to a Bytes
+/// object.  Up to two bytes that don't make a complete group are carried in
+/// the stream until the next chunk or base64EncodeFinish.
 ///
+/// @param stream The CodecStream that tracks the state between chunks.  Must
+///   be initialized with CODEC_STREAM_INITIALIZER before the first chunk.
+/// @param output A pointer to the Bytes object to append to.  *output may be
+///   NULL, in which case a new Bytes object is allocated.
 /// @param data A pointer to the data to encode.
-/// @param dataLength The number of bytes to encode at the data pointer.
+/// @param dataLength The number of bytes at data.
 ///
-/// @return Returns a new Bytes object with the base64-encoded string on
-/// success, NULL on failure.
-Bytes dataToBase64(const volatile void *data, u64 dataLength) {
-  printLog(TRACE, "ENTER dataToBase64(data=%p, dataLength=%llu)\n",
-    data, llu(dataLength));
+/// @return Returns the updated *output on success, NULL on failure.
+Bytes base64EncodeChunk(CodecStream *stream, Bytes *output,
+  const volatile void *data, u64 dataLength
+) {
+  printLog(TRACE, "ENTER base64EncodeChunk(stream=%p, output=%p, data=%p, "
+    "dataLength=%llu)\n", stream, output, data, llu(dataLength));
   
-  Bytes output = NULL;
-  if ((data == NULL) || (dataLength == 0)) {
-    // Nothing to do.
-    return output;
+  if ((stream == NULL) || (output == NULL)
+    || ((data == NULL) && (dataLength > 0))
+  ) {
+    printLog(ERR, "Invalid parameters.\n");
+    printLog(TRACE, "EXIT base64EncodeChunk(stream=%p, output=%p, data=%p, "
+      "dataLength=%llu) = {NULL}\n", stream, output, data, llu(dataLength));
+    return NULL;
   }
   
-  u64 outputLength = (dataLength << 2) / 3;
-  u64 remainder = dataLength % 3;
-  if (remainder == 1) {
-    outputLength += 3;
-  } else if (remainder == 2) {
-    outputLength += 2;
+  // Size the output once for every complete group in this chunk.
+  u64 outputLength = bytesLength(*output);
+  u64 numGroups = (stream->numPending + dataLength) / 3;
+  if (bytesAllocate(output, outputLength + (numGroups << 2)) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
   }
-  bytesAllocate(&output, outputLength);
-  bytesSetLength(output, outputLength);
   
-  unsigned char *dataChars = (unsigned char*) data;
-  char *outputChars = (char*) output;
-  u64 numBytesInLoop = (dataLength / 3) * 3;
-  u32 numberToEncode = 0;
-  u64 ii = 0;
-  for (ii = 0; ii < numBytesInLoop; ii += 3) {
-    // First, convert three characters to a 24-bit number stored in a 32-bit
-    // number.
-    numberToEncode
-      = (((u32) dataChars[0]) << 16)
-      | (((u32) dataChars[1]) <<  8)
-      | (((u32) dataChars[2])      );
-    dataChars += 3;
-    
-    // Next, map the numbers to their corrsponding Base64 ASCII characters.
-    outputChars[0] = base64Characters[(numberToEncode >> 18) & 0x3f];
-    outputChars[1] = base64Characters[(numberToEncode >> 12) & 0x3f];
-    outputChars[2] = base64Characters[(numberToEncode >>  6) & 0x3f];
-    outputChars[3] = base64Characters[(numberToEncode      ) & 0x3f];
-    outputChars += 4;
+  const u8 *input = (const u8*) data;
+  char *outputChars = (char*) *output + outputLength;
+  if (stream->numPending > 0) {
+    while ((stream->numPending < 3) && (dataLength > 0)) {
+      stream->pending[stream->numPending++] = *input++;
+      dataLength--;
+    }
+    if (stream->numPending == 3) {
+      outputChars += base64EncodeScalar(outputChars, stream->pending, 3) / 3 * 4;
+      stream->numPending = 0;
+    }
   }
-  if (ii < dataLength) {
-    numberToEncode
-      = (((u32) dataChars[0]) << 16)
-      | (((dataLength - ii) > 1) ? (((u32) dataChars[1]) <<  8) : 0)
-      | (((dataLength - ii) > 2) ? (((u32) dataChars[2])      ) : 0);
-    dataChars += 3;
-    
-    outputChars[0] = base64Characters[(numberToEncode >> 18) & 0x3f];
-    outputChars[1] = base64Characters[(numberToEncode >> 12) & 0x3f];
-    outputChars[2] = ((dataLength - ii) > 1)
-      ? base64Characters[(numberToEncode >> 6) & 0x3f]
-      : '=';
-    outputChars[3] = ((dataLength - ii) > 2)
-      ? base64Characters[numberToEncode & 0x3f]
-      : '=';
-    outputChars += 4;
+  
+  u64 numEncoded = codecKernels()->base64Encode(outputChars, input, dataLength);
+  outputChars += (numEncoded / 3) << 2;
+  while (numEncoded < dataLength) {
+    stream->pending[stream->numPending++] = input[numEncoded++];
   }
-  *outputChars = '\0';
   
-  printLog(TRACE, "EXIT dataToBase64(data=%p, dataLength=%llu) = {%p}\n",
-    data, llu(dataLength), output);
-  return output;
+  outputLength = (u64) (outputChars - (char*) *output);
+  bytesSetLength(*output, outputLength);
+  (*output)[outputLength] = '\0';
+  
+  printLog(TRACE, "EXIT base64EncodeChunk(stream=%p, output=%p, data=%p, "
+    "dataLength=%llu) = {%p}\n", stream, output, data, llu(dataLength),
+    *output);
+  return *output;
 }
 
-/// @fn Bytes base64ToBytes(const char *base64String, u64 base64StringLength)
+/// @fn Bytes base64EncodeFinish(CodecStream *stream, Bytes *output)
 ///
-/// @brief Convert a base64-encoded string back to its binary representation.
+/// @brief Flush the bytes carried in a Base64 encoding stream, with padding,
+/// and reset the stream so that it can be reused.
 ///
-/// @param base64String The base64-encoded string to decode.
-/// @param base64StringLength The number of bytes that make up the base64String.
+/// @param stream The CodecStream passed to base64EncodeChunk.
+/// @param output A pointer to the Bytes object to append to.
 ///
-/// @return Returns a Bytes object with the decoded content on success, NULL on
-/// failure.
-Bytes base64ToBytes(const char *base64String, u64 base64StringLength) {
-  printLog(TRACE,
-    "ENTER base64ToBytes(base64String=%p, base64StringLength=%llu)\n",
-    base64String, llu(base64StringLength));
+/// @return Returns the updated *output on success, NULL on failure.
+Bytes base64EncodeFinish(CodecStream *stream, Bytes *output) {
+  printLog(TRACE, "ENTER base64EncodeFinish(stream=%p, output=%p)\n",
+    stream, output);
   
-  Bytes output = NULL;
-  if ((base64String == NULL) || (((base64StringLength * 3) % 4) > 0)) {
-    printLog(ERR, "Invalid base64StringLength %llu.\n",
-      llu(base64StringLength));
+  if ((stream == NULL) || (output == NULL)) {
+    printLog(ERR, "Invalid parameters.\n");
     printLog(TRACE,
-      "EXIT base64ToBytes(base64String=%p, base64StringLength=%llu) = {%p}\n",
-      base64String, llu(base64StringLength), output);
-    return output; // NULL
+      "EXIT base64EncodeFinish(stream=%p, output=%p) = {NULL}\n",
+      stream, output);
+    return NULL;
+  }
+  
+  u64 outputLength = bytesLength(*output);
+  if (bytesAllocate(output, outputLength + 4) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
   }
   
-  u64 outputLength = (base64StringLength * 3) >> 2;
-  bytesAllocate(&output, outputLength);
-  unsigned char *outputChars = output;
+  if (stream->numPending > 0) {
+    outputLength += base64EncodeTail((char*) *output + outputLength,
+      stream->pending, stream->numPending);
+    stream->numPending = 0;
+  }
+  bytesSetLength(*output, outputLength);
+  (*output)[outputLength] = '\0';
   
-  for (u64 ii = 0; ii < base64StringLength; ii += 4) {
-    // C doesn't like it when array indexes are chars, so cast them to size_t.
-    u32 numberToDecode
-      = (base64Values[(size_t) base64String[0]] << 18)
-      | (base64Values[(size_t) base64String[1]] << 12)
-      | (base64Values[(size_t) base64String[2]] <<  6)
-      | (base64Values[(size_t) base64String[3]]      );
-    base64String += 4;
+  printLog(TRACE, "EXIT base64EncodeFinish(stream=%p, output=%p) = {%p}\n",
+    stream, output, *output);
+  return *output;
+}
 
-    outputChars[0] = numberToDecode >> 16 & 0xff;
-    outputChars[1] = numberToDecode >>  8 & 0xff;
-    outputChars[2] = numberToDecode       & 0xff;
-    outputChars += 3;
+/// @fn Bytes base64DecodeChunk(CodecStream *stream, Bytes *output, const char *base64String, u64 base64StringLength)
+///
+/// @brief Decode a chunk of Base64 text and append the result to a Bytes
+/// object.  Whitespace (e.g. the line breaks in MIME bodies) is skipped and
+/// characters that don't make a complete group are carried in the stream
+/// until the next chunk or base64DecodeFinish.
+///
+/// @param stream The CodecStream that tracks the state between chunks.  Must
+///   be initialized with CODEC_STREAM_INITIALIZER before the first chunk.
+/// @param output A pointer to the Bytes object to append to.  *output may be
+///   NULL, in which case a new Bytes object is allocated.
+/// @param base64String A pointer to the Base64 characters to decode.
+/// @param base64StringLength The number of characters at base64String.
+///
+/// @return Returns the updated *output on success, NULL on failure.
+Bytes base64DecodeChunk(CodecStream *stream, Bytes *output,
+  const char *base64String, u64 base64StringLength
+) {
+  printLog(TRACE, "ENTER base64DecodeChunk(stream=%p, output=%p, "
+    "base64String=%p, base64StringLength=%llu)\n",
+    stream, output, base64String, llu(base64StringLength));
+  
+  if ((stream == NULL) || (output == NULL)
+    || ((base64String == NULL) && (base64StringLength > 0))
+  ) {
+    printLog(ERR, "Invalid parameters.\n");
+    printLog(TRACE, "EXIT base64DecodeChunk(stream=%p, output=%p, "
+      "base64String=%p, base64StringLength=%llu) = {NULL}\n",
+      stream, output, base64String, llu(base64StringLength));
+    return NULL;
   }
-  if (outputLength > 0) {
-    for (base64String--; *base64String == '='; base64String--, outputLength--);
+  
+  // Size the output once for the most this chunk can produce.  Skipped
+  // whitespace and padding only make the real output shorter.
+  u64 outputLength = bytesLength(*output);
+  u64 numGroups = (stream->numPending + base64StringLength) >> 2;
+  if (bytesAllocate(output, outputLength + (numGroups * 3)) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
   }
-  bytesSetLength(output, outputLength);
   
-  printLog(TRACE,
-    "EXIT base64ToBytes(base64String=%p, base64StringLength=%llu) = {%p}\n",
-    base64String, llu(base64StringLength), output);
-  return output;
+  const CodecKernels *kernels = codecKernels();
+  u8 *outputChars = *output + outputLength;
+  u64 ii = 0;
+  while (ii < base64StringLength) {
+    if (stream->numPending == 0) {
+      u64 numDecoded = kernels->base64Decode(outputChars,
+        base64String + ii, base64StringLength - ii);
+      outputChars += (numDecoded >> 2) * 3;
+      ii += numDecoded;
+      if (ii == base64StringLength) {
+        break;
+      }
+    }
+    
+    // Anything the kernel stopped at goes through the stream one character
+    // at a time.
+    u8 character = (u8) base64String[ii++];
+    if (isspace(character)) {
+      continue;
+    }
+    stream->pending[stream->numPending++] = character;
+    if (stream->numPending == 4) {
+      outputChars += base64DecodeQuad(outputChars, stream->pending);
+      stream->numPending = 0;
+    }
+  }
+  
+  outputLength = (u64) (outputChars - *output);
+  bytesSetLength(*output, outputLength);
+  (*output)[outputLength] = '\0';
+  
+  printLog(TRACE, "EXIT base64DecodeChunk(stream=%p, output=%p, "
+    "base64String=%p, base64StringLength=%llu) = {%p}\n",
+    stream, output, base64String, llu(base64StringLength), *output);
+  return *output;
 }
 
-/// @var base64Characters
+/// @fn Bytes base64DecodeFinish(CodecStream *stream, Bytes *output)
 ///
-/// @brief Mapping of Base64 values to their corresponding characters.
-char base64Characters[64] = {
-  'A',
-  'B',
-  'C',
-  'D',
-  'E',
-  'F',
-  'G',
-  'H',
-  'I',
-  'J',
-  'K',
-  'L',
-  'M',
-  'N',
-  'O',
-  'P',
-  'Q',
-  'R',
-  'S',
-  'T',
-  'U',
-  'V',
-  'W',
-  'X',
-  'Y',
-  'Z',
-  'a',
-  'b',
-  'c',
-  'd',
-  'e',
-  'f',
-  'g',
-  'h',
-  'i',
-  'j',
-  'k',
-  'l',
-  'm',
+/// @brief Flush the characters carried in a Base64 decoding stream and reset
+/// the stream so that it can be reused.  This allows input with the trailing
+/// padding left off.  A single leftover character can't encode a byte and is
+/// dropped.
+///
+/// @param stream The CodecStream passed to base64DecodeChunk.
+/// @param output A pointer to the Bytes object to append to.
+///
+/// @return Returns the updated *output on success, NULL on failure.
+Bytes base64DecodeFinish(CodecStream *stream, Bytes *output) {
+  printLog(TRACE, "ENTER base64DecodeFinish(stream=%p, output=%p)\n",
+    stream, output);
+  
+  if ((stream == NULL) || (output == NULL)) {
+    printLog(ERR, "Invalid parameters.\n");
+    printLog(TRACE,
+      "EXIT base64DecodeFinish(stream=%p, output=%p) = {NULL}\n",
+      stream, output);
+    return NULL;
+  }
+  
+  u64 outputLength = bytesLength(*output);
+  if (bytesAllocate(output, outputLength + 3) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  
+  if (stream->numPending > 1) {
+    while (stream->numPending < 4) {
+      stream->pending[stream->numPending++] = '=';
+    }
+    outputLength += base64DecodeQuad(*output + outputLength, stream->pending);
+  }
+  stream->numPending = 0;
+  bytesSetLength(*output, outputLength);
+  (*output)[outputLength] = '\0';
+  
+  printLog(TRACE, "EXIT base64DecodeFinish(stream=%p, output=%p) = {%p}\n",
+    stream, output, *output);
+  return *output;
+}
+
+/// @fn Bytes dataToHexBytes(const volatile void *data, u64 length)
+///
+/// @brief Convert a data blob to a Bytes object containing the data's
+/// hexadecimal representation.
+///
+/// @param data A pointer to the data to convert.
+/// @param length The number of bytes that make up the data.
+///
+/// @return Returns a newly-allocated Bytes object with the encoded data on
+/// success, NULL on failure.
+Bytes dataToHexBytes(const volatile void *data, u64 length) {
+  printLog(TRACE, "ENTER dataToHexBytes(data=%p, length=%llu)\n",
+    data, llu(length));
+  
+  Bytes returnValue = NULL;
+  if ((data == NULL) || (length == 0)) {
+    printLog(TRACE, "EXIT dataToHexBytes(data=%p, length=%llu) = {%p}\n",
+      data, llu(length), returnValue);
+    return returnValue;
+  }
+  
+  if (hexEncodeChunk(&returnValue, data, length) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  
+  printLog(TRACE, "EXIT dataToHexBytes(data=%p, length=%llu) = {%p}\n",
+    data, llu(length), returnValue);
+  return returnValue;
+}
+
+/// @fn Bytes hexStringToBytes(const char *hexString, u64 length)
+///
+/// @brief Convert a string of hexadecimal characters to its raw data equivalent
+/// in bytes form.
+///
+/// @param hexString A pointer to a string of purely-hexadecimal characters.
+/// @param length The number of bytes that make up the hexString.
+///
+/// @return Returns a newly-allocated Bytes object with the decoded data on
+/// success, NULL on failure.
+Bytes hexStringToBytes(const char *hexString, u64 length) {
+  printLog(TRACE, "ENTER hexStringToBytes(hexString=%p, length=%llu)\n",
+    hexString, llu(length));
+  
+  Bytes returnValue = NULL;
+  if ((hexString == NULL) || (length == 0)) {
+    // Nothing to do.
+    printLog(TRACE, "EXIT hexStringToBytes(hexString=%p, length=%llu) = {%p}\n",
+      hexString, llu(length), returnValue);
+    return returnValue;
+  }
+  
+  u64 returnValueLength = length >> 1;
+  if (bytesAllocate(&returnValue, returnValueLength) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  
+  codecKernels()->hexDecode(returnValue, hexString, returnValueLength);
+  bytesSetLength(returnValue, returnValueLength);
+  returnValue[returnValueLength] = '\0';
+  
+  printLog(TRACE, "EXIT hexStringToBytes(hexString=%p, length=%llu) = {%p}\n",
+    hexString, llu(length), returnValue);
+  return returnValue;
+}
+
+/// @fn bool dataIsString(const volatile void *data, u64 dataLength)
+///
+/// @brief Determine whether or not a block of arbitrary data constitutes a
+/// C string.
+///
+/// @param data A pointer to an arbitrary block of memory (cast to a void*).
+/// @param dataLength The number of bytes pointed to by the data pointer.
+///
+/// @return Returns true if the data provided constitutes a C string, false
+/// if not.
+bool dataIsString(const volatile void *data, u64 dataLength) {
+  printLog(TRACE, "ENTER dataIsString(data=%p, dataLength=%llu)\n",
+    data, llu(dataLength));
+  
+  u8 *dataBytes = (u8*) data;
+  bool returnValue = true;
+  u64 lastCharIndex = 0;
+  if (dataLength > 0) {
+    lastCharIndex = dataLength - 1;
+  }
+  
+  if (data == NULL) {
+    // NULL data is not a string.
+    returnValue = false;
+    printLog(TRACE, "EXIT dataIsString(data=%p, dataLength=%llu) = {%s}\n",
+      data, llu(dataLength), boolNames[returnValue]);
+    return returnValue;
+  }
+  
+  u64 i = 0;
+  for (i = 0; i < lastCharIndex; i++) {
+    if (((dataBytes[i] < 32) || (dataBytes[i] > 126))
+      && (dataBytes[i] != '\r') && (dataBytes[i] != '\n')
+      && (dataBytes[i] != '\0')
+    ) {
+      returnValue = false;
+      break;
+    }
+  }
+  
+  if (dataBytes[i] != '\0') {
+    returnValue = false;
+  }
+  
+  printLog(TRACE, "EXIT dataIsString(data=%p, dataLength=%llu) = {%s}\n",
+    data, llu(dataLength), boolNames[returnValue]);
+  return returnValue;
+}
+
+/// @fn bool dataIsAscii(const volatile void *data, u64 dataLength)
+///
+/// @brief Determine whether or not a block of arbitrary data constitutes a
+/// C string.
+///
+/// @param data A pointer to an arbitrary block of memory (cast to a void*).
+/// @param dataLength The number of bytes pointed to by the data pointer.
+///
+/// @return Returns true if the data provided constitutes a C string, false
+/// if not.
+bool dataIsAscii(const volatile void *data, u64 dataLength) {
+  printLog(TRACE, "ENTER dataIsAscii(data=%p, dataLength=%llu)\n",
+    data, llu(dataLength));
+  
+  u8 *dataBytes = (u8*) data;
+  bool returnValue = true;
+  u64 lastCharIndex = 0;
+  if (dataLength > 0) {
+    lastCharIndex = dataLength - 1;
+  }
+  
+  if (data == NULL) {
+    // NULL data is not a string.
+    returnValue = false;
+    printLog(TRACE, "EXIT dataIsAscii(data=%p, dataLength=%llu) = {%s}\n",
+      data, llu(dataLength), boolNames[returnValue]);
+    return returnValue;
+  }
+  
+  u64 i = 0;
+  for (i = 0; i < lastCharIndex; i++) {
+    if (dataBytes[i] > 127) {
+      returnValue = false;
+      break;
+    }
+  }
+  
+  printLog(TRACE, "EXIT dataIsAscii(data=%p, dataLength=%llu) = {%s}\n",
+    data, llu(dataLength), boolNames[returnValue]);
+  return returnValue;
+}
+
+/// @fn bool nonPrintableToWhitespace(const volatile void *data, u64 dataLength)
+///
+/// @brief Determine whether or not a block of arbitrary data constitutes a
+/// C string.
+///
+/// @param data A pointer to an arbitrary block of memory (cast to a void*).
+/// @param dataLength The number of bytes pointed to by the data pointer.
+///
+/// @return Returns true if the data provided constitutes a C string, false
+/// if not.
+bool nonPrintableToWhitespace(const volatile void *data, u64 dataLength) {
+  printLog(TRACE, "ENTER nonPrintableToWhitespace(data=%p, dataLength=%llu)\n",
+    data, llu(dataLength));
+  
+  u8 *dataBytes = (u8*) data;
+  bool returnValue = true;
+  
+  if (data == NULL) {
+    // NULL data is not a string.
+    returnValue = false;
+    printLog(TRACE,
+      "EXIT nonPrintableToWhitespace(data=%p, dataLength=%llu) = {%s}\n",
+      data, llu(dataLength), boolNames[returnValue]);
+    return returnValue;
+  }
+  
+  for (u64 i = 0; i < dataLength; i++) {
+    if (((dataBytes[i] < 32) || (dataBytes[i] > 126))
+      && (dataBytes[i] != '\r') && (dataBytes[i] != '\n')
+      && (dataBytes[i] != '\0')
+    ) {
+      dataBytes[i] = ' ';
+    }
+  }
+  
+  printLog(TRACE,
+    "EXIT nonPrintableToWhitespace(data=%s, dataLength=%llu) = {%s}\n",
+    str(data), llu(dataLength), boolNames[returnValue]);
+  return returnValue;
+}
+
+/// @fn Bytes dataToBase64(const volatile void *data, u64 dataLength)
+///
+/// @brief Convert an arbitrary blob of data to its base64 representation.
+///
+/// @param data A pointer to the data to encode.
+/// @param dataLength The number of bytes to encode at the data pointer.
+///
+/// @return Returns a new Bytes object with the base64-encoded string on
+/// success, NULL on failure.
+Bytes dataToBase64(const volatile void *data, u64 dataLength) {
+  printLog(TRACE, "ENTER dataToBase64(data=%p, dataLength=%llu)\n",
+    data, llu(dataLength));
+  
+  Bytes output = NULL;
+  if ((data == NULL) || (dataLength == 0)) {
+    // Nothing to do.
+    return output;
+  }
+  
+  // The output is sized exactly once up front and written in place.
+  u64 outputLength = base64EncodedLength(dataLength);
+  if (bytesAllocate(&output, outputLength) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  
+  const u8 *dataChars = (const u8*) data;
+  char *outputChars = (char*) output;
+  u64 ii = codecKernels()->base64Encode(outputChars, dataChars, dataLength);
+  outputChars += (ii / 3) << 2;
+  if (ii < dataLength) {
+    outputChars += base64EncodeTail(outputChars, dataChars + ii,
+      dataLength - ii);
+  }
+  *outputChars = '\0';
+  bytesSetLength(output, outputLength);
+  
+  printLog(TRACE, "EXIT dataToBase64(data=%p, dataLength=%llu) = {%p}\n",
+    data, llu(dataLength), output);
+  return output;
+}
+
+/// @fn Bytes base64ToBytes(const char *base64String, u64 base64StringLength)
+///
+/// @brief Convert a base64-encoded string back to its binary representation.
+///
+/// @param base64String The base64-encoded string to decode.
+/// @param base64StringLength The number of bytes that make up the base64String.
+///
+/// @return Returns a Bytes object with the decoded content on success, NULL on
+/// failure.
+Bytes base64ToBytes(const char *base64String, u64 base64StringLength) {
+  printLog(TRACE,
+    "ENTER base64ToBytes(base64String=%p, base64StringLength=%llu)\n",
+    base64String, llu(base64StringLength));
+  
+  Bytes output = NULL;
+  if ((base64String == NULL) || (((base64StringLength * 3) % 4) > 0)) {
+    printLog(ERR, "Invalid base64StringLength %llu.\n",
+      llu(base64StringLength));
+    printLog(TRACE,
+      "EXIT base64ToBytes(base64String=%p, base64StringLength=%llu) = {%p}\n",
+      base64String, llu(base64StringLength), output);
+    return output; // NULL
+  }
+  
+  // Padding is accounted for up front so the output is allocated exactly
+  // once.
+  u64 outputLength = base64DecodedLength(base64String, base64StringLength);
+  if (bytesAllocate(&output, outputLength) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  
+  const CodecKernels *kernels = codecKernels();
+  u8 *outputChars = output;
+  u64 ii = 0;
+  while (ii < base64StringLength) {
+    u64 numDecoded = kernels->base64Decode(outputChars,
+      base64String + ii, base64StringLength - ii);
+    outputChars += (numDecoded >> 2) * 3;
+    ii += numDecoded;
+    if (ii < base64StringLength) {
+      // Padding or a character outside of the alphabet.
+      outputChars += base64DecodeQuad(outputChars,
+        (const u8*) base64String + ii);
+      ii += 4;
+    }
+  }
+  outputLength = (u64) (outputChars - output);
+  *outputChars = '\0';
+  bytesSetLength(output, outputLength);
+  
+  printLog(TRACE,
+    "EXIT base64ToBytes(base64String=%p, base64StringLength=%llu) = {%p}\n",
+    base64String, llu(base64StringLength), output);
+  return output;
+}
+
+/// @var base64Characters
+///
+/// @brief Mapping of Base64 values to their corresponding characters.
+char base64Characters[64] = {
+  'A',
+  'B',
+  'C',
+  'D',
+  'E',
+  'F',
+  'G',
+  'H',
+  'I',
+  'J',
+  'K',
+  'L',
+  'M',
+  'N',
+  'O',
+  'P',
+  'Q',
+  'R',
+  'S',
+  'T',
+  'U',
+  'V',
+  'W',
+  'X',
+  'Y',
+  'Z',
+  'a',
+  'b',
+  'c',
+  'd',
+  'e',
+  'f',
+  'g',
+  'h',
+  'i',
+  'j',
+  'k',
+  'l',
+  'm',
   'n',
   'o',
   'p',
@@ -3549,195 +5715,1743 @@ char base64Characters[64] = {
   '/'
 };
 
-/// @var base64Values
+/// @var base64Values
+///
+/// @brief Mapping of Base64 characters to their corresponding values.
+u32 base64Values[128] = {
+  0,  // 0
+  0,  // 1
+  0,  // 2
+  0,  // 3
+  0,  // 4
+  0,  // 5
+  0,  // 6
+  0,  // 7
+  0,  // 8
+  0,  // 9
+  0,  // 10
+  0,  // 11
+  0,  // 12
+  0,  // 13
+  0,  // 14
+  0,  // 15
+  0,  // 16
+  0,  // 17
+  0,  // 18
+  0,  // 19
+  0,  // 20
+  0,  // 21
+  0,  // 22
+  0,  // 23
+  0,  // 24
+  0,  // 25
+  0,  // 26
+  0,  // 27
+  0,  // 28
+  0,  // 29
+  0,  // 30
+  0,  // 31
+  0,  // space
+  0,  // !
+  0,  // "
+  0,  // #
+  0,  // $
+  0,  // %
+  0,  // &
+  0,  // '
+  0,  // (
+  0,  // )
+  0,  // *
+  62, // +
+  0,  // ,
+  0,  // -
+  0,  // .
+  63, // /
+  52, // 0
+  53, // 1
+  54, // 2
+  55, // 3
+  56, // 4
+  57, // 5
+  58, // 6
+  59, // 7
+  60, // 8
+  61, // 9
+  0,  // :
+  0,  // ;
+  0,  // <
+  0,  // =
+  0,  // >
+  0,  // ?
+  0,  // @
+  0,  // A
+  1,  // B
+  2,  // C
+  3,  // D
+  4,  // E
+  5,  // F
+  6,  // G
+  7,  // H
+  8,  // I
+  9,  // J
+  10, // K
+  11, // L
+  12, // M
+  13, // N
+  14, // O
+  15, // P
+  16, // Q
+  17, // R
+  18, // S
+  19, // T
+  20, // U
+  21, // V
+  22, // W
+  23, // X
+  24, // Y
+  25, // Z
+  0,  // [
+  0,  // backslash
+  0,  // ]
+  0,  // ^
+  0,  // _
+  0,  // `
+  26, // a
+  27, // b
+  28, // c
+  29, // d
+  30, // e
+  31, // f
+  32, // g
+  33, // h
+  34, // i
+  35, // j
+  36, // k
+  37, // l
+  38, // m
+  39, // n
+  40, // o
+  41, // p
+  42, // q
+  43, // r
+  44, // s
+  45, // t
+  46, // u
+  47, // v
+  48, // w
+  49, // x
+  50, // y
+  51, // z
+  0,  // {
+  0,  // |
+  0,  // }
+  0,  // ~
+  0   // delete
+};
+
+/// @fn bool dataEndsWith(const volatile void *haystack, u64 haystackLength, const volatile void *needle, u64 needleLength)
+///
+/// @brief Determine if a block of data ends with a another specified block of
+/// data.
+///
+/// @param haystack A pointer to the block of data to check the end of.
+/// @param haystackLength The number of bytes at haystack.
+/// @param needle A pointer to the data to search for.
+/// @param needleLength The number of bytes at needle.
+///
+/// @return Returns true if the last needleLength bytes of haystack end with
+/// needle, false otherwise.
+bool dataEndsWith(const volatile void *haystack, u64 haystackLength,
+  const volatile void *needle, u64 needleLength
+) {
+  printLog(TRACE, "ENTER dataEndsWith(haystack=%p, haystackLength=%llu, "
+    "needle=%p, needleLength=%llu)\n", haystack, llu(haystackLength),
+    needle, llu(needleLength));
+  
+  bool returnValue = false;
+  if ((haystack == NULL) != (needle == NULL)) {
+    printLog(ERR, "Mismatch in NULL pointer values.\n");
+    printLog(TRACE, "EXIT dataEndsWith(haystack=%p, haystackLength=%llu, "
+      "needle=%p, needleLength=%llu) = {%s}\n", haystack, llu(haystackLength),
+      needle, llu(needleLength), boolNames[returnValue]);
+    return returnValue; // false
+  } else if (needleLength > haystackLength) {
+    printLog(ERR, "needleLength exceeds haystackLength.\n");
+    printLog(TRACE, "EXIT dataEndsWith(haystack=%p, haystackLength=%llu, "
+      "needle=%p, needleLength=%llu) = {%s}\n", haystack, llu(haystackLength),
+      needle, llu(needleLength), boolNames[returnValue]);
+    return returnValue; // false
+  }
+  
+  if (((haystack == NULL) && (needle == NULL))
+    || ((haystackLength == 0) && (needleLength == 0))
+  ) {
+    // Both values are empty.  Return true.
+    returnValue = true;
+    printLog(ERR, "Mismatch in NULL pointer values.\n");
+    printLog(TRACE, "EXIT dataEndsWith(haystack=%p, haystackLength=%llu, "
+      "needle=%p, needleLength=%llu) = {%s}\n", haystack, llu(haystackLength),
+      needle, llu(needleLength), boolNames[returnValue]);
+    return returnValue; // false
+  }
+  
+  u64 startIndex = haystackLength - needleLength;
+  unsigned char *haystackChars = ustr(haystack);
+  if (memcmp(&haystackChars[startIndex], (void*) needle, needleLength) == 0) {
+    returnValue = true;
+  }
+  
+  printLog(TRACE, "EXIT dataEndsWith(haystack=%p, haystackLength=%llu, "
+    "needle=%p, needleLength=%llu) = {%s}\n", haystack, llu(haystackLength),
+    needle, llu(needleLength), boolNames[returnValue]);
+  return returnValue;
+}
+
+
+/// @fn static bool jsonWriterFileSink(void *context, const volatile void *data, u64 length)
+///
+/// @brief JsonWriterSink that writes to a FILE*.
+///
+/// @param context The FILE* to write to.
+/// @param data The data to write.
+/// @param length The number of bytes at data.
+///
+/// @return Returns true if all of the data was written, false otherwise.
+static bool jsonWriterFileSink(void *context,
+  const volatile void *data, u64 length
+) {
+  return fwrite((const void*) data, 1, length, (FILE*) context) == length;
+}
+
+/// @fn static bool jsonWriterBytesSink(void *context, const volatile void *data, u64 length)
+///
+/// @brief JsonWriterSink that appends to a Bytes object.
+///
+/// @param context A pointer to the Bytes object to append to.
+/// @param data The data to write.
+/// @param length The number of bytes at data.
+///
+/// @return Returns true on success, false if the Bytes could not be grown.
+static bool jsonWriterBytesSink(void *context,
+  const volatile void *data, u64 length
+) {
+  return bytesAddData((Bytes*) context, data, length) != NULL;
+}
+
+/// @fn void jsonWriterInit(JsonWriter *writer, JsonWriterSink sink, void *context)
+///
+/// @brief Initialize a JsonWriter that sends its output to an arbitrary sink.
+///
+/// @param writer The JsonWriter to initialize.
+/// @param sink The function that will receive the output.
+/// @param context The first parameter passed to sink.
+///
+/// @return This function returns no value.
+void jsonWriterInit(JsonWriter *writer, JsonWriterSink sink, void *context) {
+  printLog(TRACE, "ENTER jsonWriterInit(writer=%p, sink=%p, context=%p)\n",
+    writer, (void*) sink, context);
+  
+  if (writer != NULL) {
+    writer->sink = sink;
+    writer->context = context;
+    writer->indent = 0;
+    writer->indentPending = false;
+    writer->failed = (sink == NULL);
+    writer->bufferLength = 0;
+  }
+  
+  printLog(TRACE, "EXIT jsonWriterInit(writer=%p, sink=%p, context=%p)\n",
+    writer, (void*) sink, context);
+}
+
+/// @fn void jsonWriterInitFile(JsonWriter *writer, FILE *file)
+///
+/// @brief Initialize a JsonWriter that writes to a file.
+///
+/// @param writer The JsonWriter to initialize.
+/// @param file The FILE* to write to.  Not owned by the JsonWriter.
+///
+/// @return This function returns no value.
+void jsonWriterInitFile(JsonWriter *writer, FILE *file) {
+  jsonWriterInit(writer, (file != NULL) ? jsonWriterFileSink : NULL, file);
+}
+
+/// @fn void jsonWriterInitBytes(JsonWriter *writer, Bytes *output)
+///
+/// @brief Initialize a JsonWriter that appends to a Bytes object.
+///
+/// @param writer The JsonWriter to initialize.
+/// @param output A pointer to the Bytes object to append to.  *output may be
+///   NULL, in which case a new Bytes object is allocated on the first flush.
+///
+/// @return This function returns no value.
+void jsonWriterInitBytes(JsonWriter *writer, Bytes *output) {
+  jsonWriterInit(writer, (output != NULL) ? jsonWriterBytesSink : NULL,
+    output);
+}
+
+/// @fn bool jsonWriterFlush(JsonWriter *writer)
+///
+/// @brief Hand everything buffered in a JsonWriter to its sink.  This must be
+/// called once the document is complete.
+///
+/// @param writer The JsonWriter to flush.
+///
+/// @return Returns true if every write so far succeeded, false otherwise.
+bool jsonWriterFlush(JsonWriter *writer) {
+  if ((writer == NULL) || (writer->failed == true)) {
+    return false;
+  }
+  
+  if (writer->bufferLength > 0) {
+    if (writer->sink(writer->context, writer->buffer, writer->bufferLength)
+      == false
+    ) {
+      printLog(ERR, "JsonWriter sink failed.\n");
+      writer->failed = true;
+    }
+    writer->bufferLength = 0;
+  }
+  
+  return !writer->failed;
+}
+
+/// @fn static bool jsonWriterBuffer(JsonWriter *writer, const char *data, u64 length)
+///
+/// @brief Add raw data to a JsonWriter's buffer without any indenting.  Data
+/// that is larger than the buffer is passed straight to the sink.
+///
+/// @param writer The JsonWriter to write to.
+/// @param data The data to write.
+/// @param length The number of bytes at data.
+///
+/// @return Returns true on success, false if the sink has failed.
+static bool jsonWriterBuffer(JsonWriter *writer, const char *data,
+  u64 length
+) {
+  if (writer->bufferLength + length > JSON_WRITER_BUFFER_SIZE) {
+    if (jsonWriterFlush(writer) == false) {
+      return false;
+    }
+    if (length >= JSON_WRITER_BUFFER_SIZE) {
+      if (writer->sink(writer->context, data, length) == false) {
+        printLog(ERR, "JsonWriter sink failed.\n");
+        writer->failed = true;
+      }
+      return !writer->failed;
+    }
+  }
+  
+  memcpy(writer->buffer + writer->bufferLength, data, length);
+  writer->bufferLength += length;
+  return true;
+}
+
+/// @fn bool jsonWriterWrite(JsonWriter *writer, const volatile void *data, u64 length)
+///
+/// @brief Write text to a JsonWriter.  Every newline in the text is followed
+/// by the writer's current indent, the same as indentText would produce, but
+/// the indent is held back until something follows the newline.
+///
+/// @param writer The JsonWriter to write to.
+/// @param data The text to write.
+/// @param length The number of bytes at data.
+///
+/// @return Returns true on success, false if the sink has failed.
+bool jsonWriterWrite(JsonWriter *writer, const volatile void *data,
+  u64 length
+) {
+  if ((writer == NULL) || (writer->failed == true)) {
+    return false;
+  } else if ((data == NULL) || (length == 0)) {
+    return true;
+  }
+  
+  static const char spaces[] = "                                ";
+  const char *input = (const char*) data;
+  while (length > 0) {
+    if (writer->indentPending == true) {
+      for (u64 remaining = writer->indent; remaining > 0;) {
+        u64 run = (remaining < sizeof(spaces) - 1)
+          ? remaining : sizeof(spaces) - 1;
+        jsonWriterBuffer(writer, spaces, run);
+        remaining -= run;
+      }
+      writer->indentPending = false;
+    }
+    
+    const char *newline = (const char*) memchr(input, '\n', length);
+    u64 run = (newline != NULL) ? (u64) (newline - input) + 1 : length;
+    if (jsonWriterBuffer(writer, input, run) == false) {
+      return false;
+    }
+    writer->indentPending = (newline != NULL);
+    input += run;
+    length -= run;
+  }
+  
+  return true;
+}
+
+/// @fn bool jsonWriterWriteEscaped(JsonWriter *writer, const volatile void *data, u64 length)
+///
+/// @brief Write data to a JsonWriter in the same escaped form escapeData
+/// produces, without allocating an intermediate string.
+///
+/// @param writer The JsonWriter to write to.
+/// @param data The data to escape and write.
+/// @param length The number of bytes at data.
+///
+/// @return Returns true on success, false if the sink has failed.
+bool jsonWriterWriteEscaped(JsonWriter *writer, const volatile void *data,
+  u64 length
+) {
+  static const char hexDigits[] = "0123456789ABCDEF";
+  const u8 *input = (const u8*) data;
+  
+  for (u64 ii = 0; ii < length; ii++) {
+    u64 run = escapeSafeLength(input + ii, length - ii);
+    if (jsonWriterWrite(writer, input + ii, run) == false) {
+      return false;
+    }
+    ii += run;
+    if (ii == length) {
+      break;
+    }
+    
+    char escapedValue[3] = {
+      '%', hexDigits[input[ii] >> 4], hexDigits[input[ii] & 0x0f]
+    };
+    if (jsonWriterWrite(writer, escapedValue, sizeof(escapedValue)) == false) {
+      return false;
+    }
+  }
+  
+  return (writer != NULL) && (writer->failed == false);
+}
+
+/// @fn bool jsonWriterWriteValue(JsonWriter *writer, TypeDescriptor *type, const volatile void *value)
+///
+/// @brief Write the JSON form of a data structure value to a JsonWriter.  The
+/// type's toJsonStream function is used if it has one.  Otherwise the output
+/// of its toJson (or, failing that, toString) function is copied in.
+///
+/// @param writer The JsonWriter to write to.
+/// @param type The TypeDescriptor that describes value.
+/// @param value The value to write.
+///
+/// @return Returns true on success, false on failure.
+bool jsonWriterWriteValue(JsonWriter *writer, TypeDescriptor *type,
+  const volatile void *value
+) {
+  if ((writer == NULL) || (type == NULL)) {
+    return false;
+  }
+  
+  if (type->toJsonStream != NULL) {
+    return type->toJsonStream(value, writer);
+  } else if (type->toJson != NULL) {
+    Bytes json = type->toJson(value);
+    bool returnValue = jsonWriterWrite(writer, json, bytesLength(json));
+    json = bytesDestroy(json);
+    return returnValue;
+  }
+  
+  char *string = (type->toString != NULL) ? type->toString(value) : NULL;
+  bool returnValue = jsonWriterWriteStr(writer, string);
+  string = stringDestroy(string);
+  return returnValue;
+}
+
+/// @fn void jsonWriterIndent(JsonWriter *writer, u64 columns)
+///
+/// @brief Increase the indent that a JsonWriter writes after each newline.
+///
+/// @param writer The JsonWriter to modify.
+/// @param columns The number of spaces to add.
+///
+/// @return This function returns no value.
+void jsonWriterIndent(JsonWriter *writer, u64 columns) {
+  if (writer != NULL) {
+    writer->indent += columns;
+  }
+}
+
+/// @fn void jsonWriterUnindent(JsonWriter *writer, u64 columns)
+///
+/// @brief Undo a previous call to jsonWriterIndent.
+///
+/// @param writer The JsonWriter to modify.
+/// @param columns The number of spaces to remove.
+///
+/// @return This function returns no value.
+void jsonWriterUnindent(JsonWriter *writer, u64 columns) {
+  if (writer != NULL) {
+    writer->indent = (writer->indent > columns) ? writer->indent - columns : 0;
+  }
+}
+
+/// @def JSON_INDEX_WINDOW_SIZE
+///
+/// @brief The number of bytes of input that stage 1 of jsonSaxParse indexes at
+/// a time.  Must be a multiple of 64 and no more than 65536.
+#define JSON_INDEX_WINDOW_SIZE 1024
+
+/// @struct JsonIndex
+///
+/// @brief Stage 1 of jsonSaxParse:  the offsets of the structural characters
+/// ('{', '}', '[', ']', ':', ',', and unescaped quotes) that lie outside of
+/// strings in a window of the input.  The window slides forward as the parser
+/// consumes it, so memory use does not depend on the size of the document.
+///
+/// @param text The start of the input.
+/// @param length The number of bytes of input.  Lowered to the offset of the
+///   first NUL byte once one is found.
+/// @param windowStart The offset of the current window from text.
+/// @param windowLength The number of bytes in the current window.
+/// @param inString All ones if the last byte indexed was inside of a string,
+///   zero otherwise.
+/// @param escaped 1 if the first byte of the next window is escaped by a
+///   backslash at the end of this one, zero otherwise.
+/// @param count The number of offsets in the current window.
+/// @param next The index of the next offset to hand to stage 2.
+/// @param offsets The offsets of the structural characters, relative to
+///   windowStart.
+typedef struct JsonIndex {
+  const char *text;
+  u64 length;
+  u64 windowStart;
+  u64 windowLength;
+  u64 inString;
+  u64 escaped;
+  u32 count;
+  u32 next;
+  u16 offsets[JSON_INDEX_WINDOW_SIZE];
+} JsonIndex;
+
+/// @enum JsonSaxState
+///
+/// @brief What stage 2 of jsonSaxParse expects the next token to be.
+typedef enum JsonSaxState {
+  JSON_SAX_VALUE,       // A value.
+  JSON_SAX_FIRST_VALUE, // A value or the ']' of an empty array.
+  JSON_SAX_KEY,         // An object key.
+  JSON_SAX_FIRST_KEY,   // An object key or the '}' of an empty object.
+  JSON_SAX_COLON,       // The ':' after a key.
+  JSON_SAX_NEXT,        // A ',' or the end of the enclosing object or array.
+} JsonSaxState;
+
+/// @fn static inline void jsonClassifyScalar(const u8 *block, u64 *backslashes, u64 *quotes, u64 *operators)
+///
+/// @brief Find the backslashes, quotes, and structural operators in a block of
+/// 64 bytes.
+///
+/// @param block The 64 bytes to classify.
+/// @param backslashes Receives a mask with bit N set if byte N is '\\'.
+/// @param quotes Receives a mask with bit N set if byte N is '"'.
+/// @param operators Receives a mask with bit N set if byte N is one of
+///   '{', '}', '[', ']', ':', or ','.
+///
+/// @return This function returns no value.
+static inline void jsonClassifyScalar(const u8 *block, u64 *backslashes,
+  u64 *quotes, u64 *operators
+) {
+  u64 backslashMask = 0, quoteMask = 0, operatorMask = 0;
+  for (u64 ii = 0; ii < 64; ii++) {
+    u64 bit = ((u64) 1) << ii;
+    switch (block[ii]) {
+      case '\\':
+        backslashMask |= bit;
+        break;
+      case '"':
+        quoteMask |= bit;
+        break;
+      case '{': case '}': case '[': case ']': case ':': case ',':
+        operatorMask |= bit;
+        break;
+      default:
+        break;
+    }
+  }
+  
+  *backslashes = backslashMask;
+  *quotes = quoteMask;
+  *operators = operatorMask;
+}
+
+#if defined(STRING_LIB_SSE2)
+/// @fn static inline void jsonClassifySse2(const u8 *block, u64 *backslashes, u64 *quotes, u64 *operators)
+///
+/// @brief SSE2 version of jsonClassifyScalar that classifies 16 bytes at a
+/// time.
+///
+/// @param block The 64 bytes to classify.
+/// @param backslashes Receives a mask with bit N set if byte N is '\\'.
+/// @param quotes Receives a mask with bit N set if byte N is '"'.
+/// @param operators Receives a mask with bit N set if byte N is one of
+///   '{', '}', '[', ']', ':', or ','.
+///
+/// @return This function returns no value.
+static inline void jsonClassifySse2(const u8 *block, u64 *backslashes,
+  u64 *quotes, u64 *operators
+) {
+  u64 backslashMask = 0, quoteMask = 0, operatorMask = 0;
+  for (u64 ii = 0; ii < 64; ii += 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i*) (block + ii));
+    // Setting bit 5 turns '[' into '{' and ']' into '}' and leaves no other
+    // byte equal to either brace.
+    __m128i folded = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+    __m128i isOperator = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+        _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(':')),
+        _mm_cmpeq_epi8(chunk, _mm_set1_epi8(','))));
+    
+    backslashMask |= ((u64) (u32) _mm_movemask_epi8(
+      _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')))) << ii;
+    quoteMask |= ((u64) (u32) _mm_movemask_epi8(
+      _mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')))) << ii;
+    operatorMask |= ((u64) (u32) _mm_movemask_epi8(isOperator)) << ii;
+  }
+  
+  *backslashes = backslashMask;
+  *quotes = quoteMask;
+  *operators = operatorMask;
+}
+#elif defined(STRING_LIB_NEON)
+/// @fn static inline u64 jsonMaskNeon(uint8x16_t m0, uint8x16_t m1, uint8x16_t m2, uint8x16_t m3)
+///
+/// @brief Narrow four NEON comparison results to a 64-bit mask with one bit
+/// per byte.
+///
+/// @param m0 The comparison result for bytes 0 - 15 (0x00 or 0xff per lane).
+/// @param m1 The comparison result for bytes 16 - 31.
+/// @param m2 The comparison result for bytes 32 - 47.
+/// @param m3 The comparison result for bytes 48 - 63.
+///
+/// @return Returns a mask with bit N set if byte N matched.
+static inline u64 jsonMaskNeon(uint8x16_t m0, uint8x16_t m1,
+  uint8x16_t m2, uint8x16_t m3
+) {
+  static const u8 weights[16] = {
+    1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128
+  };
+  const uint8x16_t bitWeights = vld1q_u8(weights);
+  uint8x16_t sum0 = vpaddq_u8(vandq_u8(m0, bitWeights),
+    vandq_u8(m1, bitWeights));
+  uint8x16_t sum1 = vpaddq_u8(vandq_u8(m2, bitWeights),
+    vandq_u8(m3, bitWeights));
+  sum0 = vpaddq_u8(sum0, sum1);
+  sum0 = vpaddq_u8(sum0, sum0);
+  
+  return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+}
+
+/// @fn static inline uint8x16_t jsonOperatorsNeon(uint8x16_t chunk)
+///
+/// @brief Find the structural operators in 16 bytes.
+///
+/// @param chunk The bytes to check.
+///
+/// @return Returns 0xff in every lane that holds '{', '}', '[', ']', ':', or
+/// ',' and 0x00 in every other lane.
+static inline uint8x16_t jsonOperatorsNeon(uint8x16_t chunk) {
+  // Setting bit 5 turns '[' into '{' and ']' into '}' and leaves no other
+  // byte equal to either brace.
+  uint8x16_t folded = vorrq_u8(chunk, vdupq_n_u8(0x20));
+  return vorrq_u8(
+    vorrq_u8(vceqq_u8(folded, vdupq_n_u8('{')),
+      vceqq_u8(folded, vdupq_n_u8('}'))),
+    vorrq_u8(vceqq_u8(chunk, vdupq_n_u8(':')),
+      vceqq_u8(chunk, vdupq_n_u8(','))));
+}
+
+/// @fn static inline void jsonClassifyNeon(const u8 *block, u64 *backslashes, u64 *quotes, u64 *operators)
+///
+/// @brief NEON version of jsonClassifyScalar that classifies 16 bytes at a
+/// time.
+///
+/// @param block The 64 bytes to classify.
+/// @param backslashes Receives a mask with bit N set if byte N is '\\'.
+/// @param quotes Receives a mask with bit N set if byte N is '"'.
+/// @param operators Receives a mask with bit N set if byte N is one of
+///   '{', '}', '[', ']', ':', or ','.
+///
+/// @return This function returns no value.
+static inline void jsonClassifyNeon(const u8 *block, u64 *backslashes,
+  u64 *quotes, u64 *operators
+) {
+  uint8x16_t chunk0 = vld1q_u8(block);
+  uint8x16_t chunk1 = vld1q_u8(block + 16);
+  uint8x16_t chunk2 = vld1q_u8(block + 32);
+  uint8x16_t chunk3 = vld1q_u8(block + 48);
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  const uint8x16_t quote = vdupq_n_u8('"');
+  
+  *backslashes = jsonMaskNeon(
+    vceqq_u8(chunk0, backslash), vceqq_u8(chunk1, backslash),
+    vceqq_u8(chunk2, backslash), vceqq_u8(chunk3, backslash));
+  *quotes = jsonMaskNeon(
+    vceqq_u8(chunk0, quote), vceqq_u8(chunk1, quote),
+    vceqq_u8(chunk2, quote), vceqq_u8(chunk3, quote));
+  *operators = jsonMaskNeon(
+    jsonOperatorsNeon(chunk0), jsonOperatorsNeon(chunk1),
+    jsonOperatorsNeon(chunk2), jsonOperatorsNeon(chunk3));
+}
+#endif
+
+/// @fn static inline u64 jsonEscapedMask(u64 backslashes, u64 *escaped)
+///
+/// @brief Find the bytes in a block that are escaped by a backslash.  Only the
+/// odd backslashes of a run escape anything, so "\\\\\"" is an escaped
+/// backslash followed by a quote that ends the string.
+///
+/// @param backslashes A mask with bit N set if byte N is a backslash.
+/// @param escaped On input, 1 if the first byte of the block is escaped by the
+///   end of the previous block.  On output, 1 if the first byte of the next
+///   block is escaped by the end of this one.
+///
+/// @return Returns a mask with bit N set if byte N is escaped.
+static inline u64 jsonEscapedMask(u64 backslashes, u64 *escaped) {
+  u64 escapedBytes = *escaped;
+  // An escaped backslash doesn't escape anything itself.
+  backslashes &= ~escapedBytes;
+  *escaped = 0;
+  
+  // Backslashes are rare outside of escape-heavy strings, so walking the
+  // escaping ones is cheaper than doing the carry arithmetic on every block.
+  while (backslashes != 0) {
+    u64 bit = backslashes & (~backslashes + 1);
+    if (bit == (((u64) 1) << 63)) {
+      *escaped = 1;
+      break;
+    }
+    escapedBytes |= bit << 1;
+    backslashes &= ~(bit | (bit << 1));
+  }
+  
+  return escapedBytes;
+}
+
+/// @fn static inline u64 jsonPrefixXor(u64 mask)
+///
+/// @brief Turn a mask of quote positions into a mask of the bytes that lie
+/// between them.  Bit N of the result is the XOR of bits 0 - N of the input.
+///
+/// @param mask The mask of unescaped quotes.
+///
+/// @return Returns a mask with the opening quote and the contents of every
+/// string set.
+static inline u64 jsonPrefixXor(u64 mask) {
+  mask ^= mask << 1;
+  mask ^= mask << 2;
+  mask ^= mask << 4;
+  mask ^= mask << 8;
+  mask ^= mask << 16;
+  mask ^= mask << 32;
+  
+  return mask;
+}
+
+/// @fn static void jsonIndexInit(JsonIndex *index, const char *text, u64 length)
+///
+/// @brief Initialize a JsonIndex.  Nothing is indexed until the first call
+/// to jsonIndexPeek.
+///
+/// @param index The JsonIndex to initialize.
+/// @param text The input to index.
+/// @param length The maximum number of bytes of input.  Indexing also stops
+///   at the first NUL byte.
+///
+/// @return This function returns no value.
+static void jsonIndexInit(JsonIndex *index, const char *text, u64 length) {
+  index->text = text;
+  index->length = length;
+  index->windowStart = 0;
+  index->windowLength = 0;
+  index->inString = 0;
+  index->escaped = 0;
+  index->count = 0;
+  index->next = 0;
+}
+
+/// @fn static bool jsonIndexFill(JsonIndex *index)
+///
+/// @brief Index the window of input that follows the current one.
+///
+/// @param index The JsonIndex to advance.
+///
+/// @return Returns true if any input was indexed, false at the end of the
+/// input.
+static bool jsonIndexFill(JsonIndex *index) {
+  u64 start = index->windowStart + index->windowLength;
+  if (start >= index->length) {
+    return false;
+  }
+  
+  u64 windowLength = index->length - start;
+  if (windowLength > JSON_INDEX_WINDOW_SIZE) {
+    windowLength = JSON_INDEX_WINDOW_SIZE;
+  }
+  // The text may be NUL-terminated well before length.  strnlen won't read
+  // past the terminator, so only the bytes it counts are loaded below.
+  u64 available = strnlen(index->text + start, windowLength);
+  if (available < windowLength) {
+    index->length = start + available;
+  }
+  if (available == 0) {
+    return false;
+  }
+  
+  index->windowStart = start;
+  index->windowLength = available;
+  index->count = 0;
+  index->next = 0;
+  
+  const u8 *window = (const u8*) index->text + start;
+  u8 padded[64];
+  for (u64 blockStart = 0; blockStart < available; blockStart += 64) {
+    const u8 *block = window + blockStart;
+    if (available - blockStart < 64) {
+      // Pad the final block with whitespace so it can be classified whole.
+      memset(padded, ' ', sizeof(padded));
+      memcpy(padded, block, available - blockStart);
+      block = padded;
+    }
+    
+    u64 backslashes = 0, quotes = 0, operators = 0;
+#if defined(STRING_LIB_SSE2)
+    jsonClassifySse2(block, &backslashes, &quotes, &operators);
+#elif defined(STRING_LIB_NEON)
+    jsonClassifyNeon(block, &backslashes, &quotes, &operators);
+#else
+    jsonClassifyScalar(block, &backslashes, &quotes, &operators);
+#endif
+    quotes &= ~jsonEscapedMask(backslashes, &index->escaped);
+    u64 inString = jsonPrefixXor(quotes) ^ index->inString;
+    index->inString = (u64) (((i64) inString) >> 63);
+    
+    u64 structurals = (operators & ~inString) | quotes;
+    while (structurals != 0) {
+      index->offsets[index->count++]
+        = (u16) (blockStart + __builtin_ctzll(structurals));
+      structurals &= structurals - 1;
+    }
+  }
+  
+  return true;
+}
+
+/// @fn static inline bool jsonIndexPeek(JsonIndex *index, u64 *offset)
+///
+/// @brief Get the offset of the next structural character without consuming
+/// it.
+///
+/// @param index The JsonIndex to read.
+/// @param offset Receives the offset of the character from the start of the
+///   input.
+///
+/// @return Returns true on success, false if there are no more structural
+/// characters.
+static inline bool jsonIndexPeek(JsonIndex *index, u64 *offset) {
+  while (index->next == index->count) {
+    if (jsonIndexFill(index) == false) {
+      return false;
+    }
+  }
+  
+  *offset = index->windowStart + index->offsets[index->next];
+  return true;
+}
+
+/// @fn static inline bool jsonIsSpace(char c)
+///
+/// @brief Determine whether or not a character is JSON whitespace.
+///
+/// @param c The character to check.
+///
+/// @return Returns true for space, tab, carriage return, and newline.
+static inline bool jsonIsSpace(char c) {
+  return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+}
+
+/// @fn static char jsonNextToken(JsonIndex *index, u64 *cursor, u64 *start, u64 *end)
+///
+/// @brief Get the next token of the input.  Tokens are read from the
+/// structural index, so the contents of strings are never scanned here.
+///
+/// @param index The JsonIndex of the input.
+/// @param cursor The offset just past the previous token.  Moved past the
+///   token that is returned.
+/// @param start Receives the offset of the token.  For a string, this is the
+///   offset just past the opening quote.
+/// @param end Receives the offset just past the end of a string's contents or
+///   an atom.  Not set for other tokens.
+///
+/// @return Returns the structural character for an operator, '"' for a
+/// string, 'a' for an atom (a number, true, false, or null), '\0' at the end
+/// of the input, or '!' for a string that is never closed.
+static char jsonNextToken(JsonIndex *index, u64 *cursor, u64 *start,
+  u64 *end
+) {
+  const char *text = index->text;
+  u64 next = 0;
+  bool found = jsonIndexPeek(index, &next);
+  u64 limit = (found == true) ? next : index->length;
+  
+  u64 ii = *cursor;
+  while ((ii < limit) && (jsonIsSpace(text[ii]) == true)) {
+    ii++;
+  }
+  if (ii < limit) {
+    // Everything up to the next structural character is one atom.
+    u64 atomEnd = limit;
+    while (jsonIsSpace(text[atomEnd - 1]) == true) {
+      atomEnd--;
+    }
+    *start = ii;
+    *end = atomEnd;
+    *cursor = limit;
+    return 'a';
+  } else if (found == false) {
+    *start = limit;
+    *cursor = limit;
+    return '\0';
+  }
+  
+  index->next++;
+  *start = next;
+  *cursor = next + 1;
+  char token = text[next];
+  if (token == '"') {
+    // Nothing inside of a string is indexed, so the next offset is the
+    // closing quote.
+    u64 closingQuote = 0;
+    if (jsonIndexPeek(index, &closingQuote) == false) {
+      return '!';
+    }
+    index->next++;
+    *start = next + 1;
+    *end = closingQuote;
+    *cursor = closingQuote + 1;
+  }
+  
+  return token;
+}
+
+/// @fn static bool jsonParseAtom(const char *atom, u64 length, const JsonSaxHandler *handler, void *context)
+///
+/// @brief Parse a number, true, false, or null and make the matching
+/// callback.
+///
+/// @param atom The text of the atom.
+/// @param length The number of bytes at atom.
+/// @param handler The callbacks to make.
+/// @param context The first parameter to pass to the callback.
+///
+/// @return Returns false if the atom is malformed or the callback failed,
+/// true otherwise.
+static bool jsonParseAtom(const char *atom, u64 length,
+  const JsonSaxHandler *handler, void *context
+) {
+  if ((length == 4) && (memcmp(atom, "true", 4) == 0)) {
+    return (handler->boolean == NULL) || handler->boolean(context, true);
+  } else if ((length == 5) && (memcmp(atom, "false", 5) == 0)) {
+    return (handler->boolean == NULL) || handler->boolean(context, false);
+  } else if ((length == 4) && (memcmp(atom, "null", 4) == 0)) {
+    return (handler->null == NULL) || handler->null(context);
+  }
+  
+  // The atom isn't terminated, so copy it before handing it to strtoll or
+  // strtod.  No reasonable number comes anywhere near this long.
+  char number[128];
+  if ((length >= sizeof(number))
+    || ((*atom != '-') && ((*atom < '0') || (*atom > '9')))
+  ) {
+    printLog(ERR, "Invalid JSON value \"%.*s\".\n",
+      (int) ((length < 64) ? length : 64), atom);
+    return false;
+  }
+  memcpy(number, atom, length);
+  number[length] = '\0';
+  
+  char *endpos = NULL;
+  if (strpbrk(number, ".eE") == NULL) {
+    errno = 0;
+    i64 integer = (i64) strtoll(number, &endpos, 10);
+    if (endpos != &number[length]) {
+      printLog(ERR, "Invalid JSON number \"%s\".\n", number);
+      return false;
+    } else if (errno == 0) {
+      return (handler->integer == NULL) || handler->integer(context, integer);
+    }
+    // Too large for an i64.  Fall back to a double.
+  }
+  
+  double floatingPoint = strtod(number, &endpos);
+  if (endpos != &number[length]) {
+    printLog(ERR, "Invalid JSON number \"%s\".\n", number);
+    return false;
+  }
+  
+  return (handler->floatingPoint == NULL)
+    || handler->floatingPoint(context, floatingPoint);
+}
+
+/// @fn bool jsonSaxParse(const char *jsonText, u64 length, const JsonSaxHandler *handler, void *context, u64 *position)
+///
+/// @brief Parse one JSON value and report its contents to a set of callbacks.
+/// Parsing works the same way simdjson's does:  stage 1 uses vector
+/// instructions to find every structural character in a window of the input
+/// and stage 2 walks those offsets instead of the text, so the contents of
+/// strings are never looked at byte by byte.  Nothing is allocated and stack
+/// use is fixed regardless of the size or depth of the document.
+///
+/// @param jsonText The text to parse.
+/// @param length The maximum number of bytes of jsonText to read.  Parsing
+///   also stops at a NUL byte, so NUL-terminated text may be passed with a
+///   length of (u64) -1.
+/// @param handler The callbacks to make.
+/// @param context The first parameter to pass to every callback.
+/// @param position On input, the offset in jsonText to start parsing at.  On
+///   success, updated to the offset just past the end of the value.  On
+///   failure, updated to the offset of the token that could not be handled.
+///
+/// @return Returns true if a complete value was parsed and every callback
+/// succeeded, false otherwise.
+bool jsonSaxParse(const char *jsonText, u64 length,
+  const JsonSaxHandler *handler, void *context, u64 *position
+) {
+  printLog(TRACE,
+    "ENTER jsonSaxParse(jsonText=%p, length=%llu, handler=%p, context=%p, "
+    "position=%p)\n",
+    jsonText, llu(length), handler, context, position);
+  
+  if ((jsonText == NULL) || (handler == NULL) || (position == NULL)
+    || (*position >= length)
+  ) {
+    printLog(ERR, "Invalid parameters.\n");
+    printLog(TRACE, "EXIT jsonSaxParse(jsonText=%p) = {false}\n", jsonText);
+    return false;
+  }
+  
+  JsonIndex index;
+  jsonIndexInit(&index, &jsonText[*position], length - *position);
+  // Bit N is set if the container at depth N is an object, clear if it's an
+  // array.
+  u64 objectBits[JSON_SAX_MAX_DEPTH / 64];
+  u64 depth = 0;
+  u64 cursor = 0, start = 0, end = 0;
+  JsonSaxState state = JSON_SAX_VALUE;
+  bool returnValue = false;
+  
+  while (true) {
+    char token = jsonNextToken(&index, &cursor, &start, &end);
+    bool inObject = (depth > 0)
+      && (((objectBits[(depth - 1) >> 6] >> ((depth - 1) & 63)) & 1) != 0);
+    bool valueComplete = false;
+    bool ok = true;
+    
+    if (((token == '}') || (token == ']'))
+      && ((state == JSON_SAX_FIRST_KEY) || (state == JSON_SAX_FIRST_VALUE)
+        || (state == JSON_SAX_NEXT))
+    ) {
+      // End of an object or array.
+      if ((depth == 0) || ((token == '}') != inObject)
+        || ((state == JSON_SAX_FIRST_KEY) && (token != '}'))
+        || ((state == JSON_SAX_FIRST_VALUE) && (token != ']'))
+      ) {
+        printLog(ERR, "Unexpected '%c' at offset %llu.\n",
+          token, llu(*position + start));
+        break;
+      }
+      depth--;
+      if (token == '}') {
+        ok = (handler->endObject == NULL) || handler->endObject(context);
+      } else {
+        ok = (handler->endArray == NULL) || handler->endArray(context);
+      }
+      valueComplete = true;
+    } else if ((state == JSON_SAX_VALUE) || (state == JSON_SAX_FIRST_VALUE)) {
+      if ((token == '{') || (token == '[')) {
+        if (depth == JSON_SAX_MAX_DEPTH) {
+          printLog(ERR, "JSON nested more than %d levels deep.\n",
+            JSON_SAX_MAX_DEPTH);
+          break;
+        }
+        u64 bit = ((u64) 1) << (depth & 63);
+        if (token == '{') {
+          objectBits[depth >> 6] |= bit;
+          ok = (handler->startObject == NULL) || handler->startObject(context);
+          state = JSON_SAX_FIRST_KEY;
+        } else {
+          objectBits[depth >> 6] &= ~bit;
+          ok = (handler->startArray == NULL) || handler->startArray(context);
+          state = JSON_SAX_FIRST_VALUE;
+        }
+        depth++;
+      } else if (token == '"') {
+        ok = (handler->string == NULL)
+          || handler->string(context, &index.text[start], end - start);
+        valueComplete = true;
+      } else if (token == 'a') {
+        ok = jsonParseAtom(&index.text[start], end - start, handler, context);
+        valueComplete = true;
+      } else {
+        printLog(ERR, "Expected a value at offset %llu.\n",
+          llu(*position + start));
+        break;
+      }
+    } else if ((state == JSON_SAX_KEY) || (state == JSON_SAX_FIRST_KEY)) {
+      if (token != '"') {
+        printLog(ERR, "Expected a key at offset %llu.\n",
+          llu(*position + start));
+        break;
+      }
+      ok = (handler->key == NULL)
+        || handler->key(context, &index.text[start], end - start);
+      state = JSON_SAX_COLON;
+    } else if (state == JSON_SAX_COLON) {
+      if (token != ':') {
+        printLog(ERR, "Expected ':' at offset %llu.\n",
+          llu(*position + start));
+        break;
+      }
+      state = JSON_SAX_VALUE;
+    } else { // state == JSON_SAX_NEXT
+      if (token != ',') {
+        printLog(ERR, "Expected ',' at offset %llu.\n",
+          llu(*position + start));
+        break;
+      }
+      state = (inObject == true) ? JSON_SAX_KEY : JSON_SAX_VALUE;
+    }
+    
+    if (ok == false) {
+      printLog(DEBUG, "JSON callback stopped the parse at offset %llu.\n",
+        llu(*position + start));
+      break;
+    } else if (valueComplete == true) {
+      if (depth == 0) {
+        returnValue = true;
+        break;
+      }
+      state = JSON_SAX_NEXT;
+    }
+  }
+  
+  *position += (returnValue == true) ? cursor : start;
+  
+  printLog(TRACE, "EXIT jsonSaxParse(jsonText=%p, position=%llu) = {%s}\n",
+    jsonText, llu(*position), boolNames[returnValue]);
+  return returnValue;
+}
+
+/// @fn static i64 xmlReaderFileSource(void *context, void *buffer, u64 length)
+///
+/// @brief XmlReaderSource that reads from a FILE*.
+///
+/// @param context The FILE* to read from.
+/// @param buffer The buffer to read into.
+/// @param length The number of bytes available at buffer.
+///
+/// @return Returns the number of bytes read, 0 at the end of the file, or -1
+/// on error.
+static i64 xmlReaderFileSource(void *context, void *buffer, u64 length) {
+  size_t bytesRead = fread(buffer, 1, length, (FILE*) context);
+  if ((bytesRead == 0) && (ferror((FILE*) context) != 0)) {
+    return -1;
+  }
+  
+  return (i64) bytesRead;
+}
+
+/// @fn void xmlReaderInit(XmlReader *reader, XmlReaderSource source, void *context)
+///
+/// @brief Initialize an XmlReader that reads its input from an arbitrary
+/// source a buffer at a time.  The reader must be destroyed with
+/// xmlReaderDestroy when it is no longer needed.
+///
+/// @param reader The XmlReader to initialize.
+/// @param source The function that will supply the input.
+/// @param context The first parameter passed to source.
+///
+/// @return This function returns no value.
+void xmlReaderInit(XmlReader *reader, XmlReaderSource source, void *context) {
+  printLog(TRACE, "ENTER xmlReaderInit(reader=%p, source=%p, context=%p)\n",
+    reader, (void*) source, context);
+  
+  if (reader != NULL) {
+    reader->source = source;
+    reader->context = context;
+    reader->buffer = NULL;
+    reader->bufferSize = 0;
+    reader->start = 0;
+    reader->end = 0;
+    reader->position = 0;
+    reader->endOfInput = (source == NULL);
+    reader->inCData = false;
+    reader->endPending = false;
+    reader->data = bytesViewFromData(NULL, 0);
+  }
+  
+  printLog(TRACE, "EXIT xmlReaderInit(reader=%p, source=%p, context=%p)\n",
+    reader, (void*) source, context);
+}
+
+/// @fn void xmlReaderInitString(XmlReader *reader, const char *xmlText, u64 length)
+///
+/// @brief Initialize an XmlReader that reads XML that is already in memory.
+/// The text is tokenized in place and is not copied, so it must remain valid
+/// for as long as the reader is in use.
+///
+/// @param reader The XmlReader to initialize.
+/// @param xmlText The text to read.
+/// @param length The number of bytes at xmlText.
+///
+/// @return This function returns no value.
+void xmlReaderInitString(XmlReader *reader, const char *xmlText, u64 length) {
+  xmlReaderInit(reader, NULL, NULL);
+  if ((reader != NULL) && (xmlText != NULL)) {
+    // The buffer is never written to when there is no source.
+    reader->buffer = (char*) xmlText;
+    reader->bufferSize = length;
+    reader->end = length;
+  }
+}
+
+/// @fn void xmlReaderInitFile(XmlReader *reader, FILE *file)
+///
+/// @brief Initialize an XmlReader that reads from a file.
+///
+/// @param reader The XmlReader to initialize.
+/// @param file The FILE* to read from.  Not owned by the XmlReader.
+///
+/// @return This function returns no value.
+void xmlReaderInitFile(XmlReader *reader, FILE *file) {
+  xmlReaderInit(reader, (file != NULL) ? xmlReaderFileSource : NULL, file);
+}
+
+/// @fn void xmlReaderDestroy(XmlReader *reader)
+///
+/// @brief Release the resources held by an XmlReader.  Does not close the
+/// reader's source.
+///
+/// @param reader The XmlReader to destroy.
+///
+/// @return This function returns no value.
+void xmlReaderDestroy(XmlReader *reader) {
+  if (reader == NULL) {
+    return;
+  }
+  
+  if (reader->source != NULL) {
+    free(reader->buffer);
+  }
+  xmlReaderInit(reader, NULL, NULL);
+}
+
+/// @fn static bool xmlReaderFill(XmlReader *reader, bool grow)
+///
+/// @brief Read more input into an XmlReader's buffer.  The bytes before start
+/// have already been tokenized and are discarded first to make room.
+///
+/// @param reader The XmlReader to read into.
+/// @param grow Whether or not the buffer may be enlarged if it is full of
+///   bytes that have not been tokenized yet.
+///
+/// @return Returns true if more input was read, false at the end of the input,
+/// on error, or if the buffer is full and grow is false.
+static bool xmlReaderFill(XmlReader *reader, bool grow) {
+  if (reader->endOfInput == true) {
+    return false;
+  }
+  
+  if (reader->start > 0) {
+    memmove(reader->buffer, &reader->buffer[reader->start],
+      reader->end - reader->start);
+    reader->end -= reader->start;
+    reader->position += reader->start;
+    reader->start = 0;
+  }
+  
+  if ((reader->end == reader->bufferSize)
+    && ((grow == true) || (reader->buffer == NULL))
+  ) {
+    u64 bufferSize = (reader->bufferSize > 0)
+      ? reader->bufferSize << 1 : XML_READER_BUFFER_SIZE;
+    char *buffer = (char*) realloc(reader->buffer, bufferSize);
+    if (buffer == NULL) {
+      LOG_MALLOC_FAILURE();
+      return false;
+    }
+    reader->buffer = buffer;
+    reader->bufferSize = bufferSize;
+  } else if (reader->end == reader->bufferSize) {
+    return false;
+  }
+  
+  i64 bytesRead = reader->source(reader->context,
+    &reader->buffer[reader->end], reader->bufferSize - reader->end);
+  if (bytesRead <= 0) {
+    if (bytesRead < 0) {
+      printLog(ERR, "Could not read XML input at offset %llu.\n",
+        llu(reader->position + reader->end));
+    }
+    reader->endOfInput = true;
+    return false;
+  }
+  reader->end += (u64) bytesRead;
+  
+  return true;
+}
+
+/// @fn static bool xmlReaderRequire(XmlReader *reader, u64 length)
+///
+/// @brief Make sure that at least length bytes that have not been tokenized
+/// yet are in an XmlReader's buffer.
+///
+/// @param reader The XmlReader to read into.
+/// @param length The number of bytes needed.
+///
+/// @return Returns true if the bytes are available, false otherwise.
+static bool xmlReaderRequire(XmlReader *reader, u64 length) {
+  while (reader->end - reader->start < length) {
+    if (xmlReaderFill(reader, true) == false) {
+      return false;
+    }
+  }
+  
+  return true;
+}
+
+/// @fn static bool xmlReaderFind(XmlReader *reader, u64 offset, const char *delimiter, u64 delimiterLength, bool grow, u64 *found)
+///
+/// @brief Find a delimiter in the input of an XmlReader, reading more input
+/// as needed.
+///
+/// @param reader The XmlReader to search.
+/// @param offset The offset from start to begin searching at.
+/// @param delimiter The bytes to search for.
+/// @param delimiterLength The number of bytes at delimiter.
+/// @param grow Whether or not the buffer may be enlarged to find the
+///   delimiter.
+/// @param found Set to the offset from start of the delimiter if it is found,
+///   or to the number of bytes after start that were searched if it is not.
+///
+/// @return Returns true if the delimiter was found, false otherwise.
+static bool xmlReaderFind(XmlReader *reader, u64 offset,
+  const char *delimiter, u64 delimiterLength, bool grow, u64 *found
+) {
+  while (true) {
+    const char *buffer = &reader->buffer[reader->start];
+    u64 length = reader->end - reader->start;
+    while (offset + delimiterLength <= length) {
+      const char *match = (const char*) memchr(&buffer[offset], delimiter[0],
+        length - offset - delimiterLength + 1);
+      if (match == NULL) {
+        break;
+      }
+      offset = (u64) (match - buffer);
+      if (memcmp(match, delimiter, delimiterLength) == 0) {
+        *found = offset;
+        return true;
+      }
+      offset++;
+    }
+    // Only the last delimiterLength - 1 bytes can be the start of a match.
+    if (offset + delimiterLength < length + 1) {
+      offset = length + 1 - delimiterLength;
+    }
+    
+    if (xmlReaderFill(reader, grow) == false) {
+      *found = reader->end - reader->start;
+      return false;
+    }
+  }
+}
+
+/// @fn static bool xmlReaderFindTagEnd(XmlReader *reader, u64 *found)
+///
+/// @brief Find the '>' that ends the tag at the start of an XmlReader's
+/// unread input.  A '>' inside a quoted attribute value or inside the
+/// brackets of a DOCTYPE's internal subset does not end the tag.
+///
+/// @param reader The XmlReader to search.
+/// @param found Set to the offset from start of the '>'.
+///
+/// @return Returns true if the end of the tag was found, false otherwise.
+static bool xmlReaderFindTagEnd(XmlReader *reader, u64 *found) {
+  u64 offset = 1;
+  u64 brackets = 0;
+  char quote = '\0';
+  
+  while (true) {
+    const char *buffer = &reader->buffer[reader->start];
+    u64 length = reader->end - reader->start;
+    for (; offset < length; offset++) {
+      char c = buffer[offset];
+      if (quote != '\0') {
+        if (c == quote) {
+          quote = '\0';
+        }
+      } else if ((c == '"') || (c == '\'')) {
+        quote = c;
+      } else if (c == '[') {
+        brackets++;
+      } else if ((c == ']') && (brackets > 0)) {
+        brackets--;
+      } else if ((c == '>') && (brackets == 0)) {
+        *found = offset;
+        return true;
+      }
+    }
+    
+    if (xmlReaderFill(reader, true) == false) {
+      return false;
+    }
+  }
+}
+
+/// @fn static inline bool xmlIsNameEnd(char c)
+///
+/// @brief Determine whether or not a character ends an element name.
+///
+/// @param c The character to check.
+///
+/// @return Returns true if c is whitespace, '/', or '>', false otherwise.
+static inline bool xmlIsNameEnd(char c) {
+  return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n')
+    || (c == '/') || (c == '>');
+}
+
+/// @fn XmlToken xmlReaderNext(XmlReader *reader)
 ///
-/// @brief Mapping of Base64 characters to their corresponding values.
-u32 base64Values[128] = {
-  0,  // 0
-  0,  // 1
-  0,  // 2
-  0,  // 3
-  0,  // 4
-  0,  // 5
-  0,  // 6
-  0,  // 7
-  0,  // 8
-  0,  // 9
-  0,  // 10
-  0,  // 11
-  0,  // 12
-  0,  // 13
-  0,  // 14
-  0,  // 15
-  0,  // 16
-  0,  // 17
-  0,  // 18
-  0,  // 19
-  0,  // 20
-  0,  // 21
-  0,  // 22
-  0,  // 23
-  0,  // 24
-  0,  // 25
-  0,  // 26
-  0,  // 27
-  0,  // 28
-  0,  // 29
-  0,  // 30
-  0,  // 31
-  0,  // space
-  0,  // !
-  0,  // "
-  0,  // #
-  0,  // $
-  0,  // %
-  0,  // &
-  0,  // '
-  0,  // (
-  0,  // )
-  0,  // *
-  62, // +
-  0,  // ,
-  0,  // -
-  0,  // .
-  63, // /
-  52, // 0
-  53, // 1
-  54, // 2
-  55, // 3
-  56, // 4
-  57, // 5
-  58, // 6
-  59, // 7
-  60, // 8
-  61, // 9
-  0,  // :
-  0,  // ;
-  0,  // <
-  0,  // =
-  0,  // >
-  0,  // ?
-  0,  // @
-  0,  // A
-  1,  // B
-  2,  // C
-  3,  // D
-  4,  // E
-  5,  // F
-  6,  // G
-  7,  // H
-  8,  // I
-  9,  // J
-  10, // K
-  11, // L
-  12, // M
-  13, // N
-  14, // O
-  15, // P
-  16, // Q
-  17, // R
-  18, // S
-  19, // T
-  20, // U
-  21, // V
-  22, // W
-  23, // X
-  24, // Y
-  25, // Z
-  0,  // [
-  0,  // backslash
-  0,  // ]
-  0,  // ^
-  0,  // _
-  0,  // `
-  26, // a
-  27, // b
-  28, // c
-  29, // d
-  30, // e
-  31, // f
-  32, // g
-  33, // h
-  34, // i
-  35, // j
-  36, // k
-  37, // l
-  38, // m
-  39, // n
-  40, // o
-  41, // p
-  42, // q
-  43, // r
-  44, // s
-  45, // t
-  46, // u
-  47, // v
-  48, // w
-  49, // x
-  50, // y
-  51, // z
-  0,  // {
-  0,  // |
-  0,  // }
-  0,  // ~
-  0   // delete
-};
+/// @brief Read the next token from an XmlReader.  reader->data is set to the
+/// element name or text of the token.
+///
+/// @param reader The XmlReader to read from.
+///
+/// @return Returns the kind of token that was read, XML_TOKEN_END at the end
+/// of the input, or XML_TOKEN_ERROR if the input is malformed.
+XmlToken xmlReaderNext(XmlReader *reader) {
+  if (reader == NULL) {
+    printLog(ERR, "NULL reader provided.\n");
+    return XML_TOKEN_ERROR;
+  }
+  
+  if (reader->endPending == true) {
+    // reader->data still holds the name from the self-closing tag.
+    reader->endPending = false;
+    return XML_TOKEN_END_ELEMENT;
+  }
+  
+  while (true) {
+    u64 found = 0;
+    
+    if (reader->inCData == true) {
+      if (xmlReaderFind(reader, 0, "]]>", 3, false, &found) == true) {
+        reader->inCData = false;
+        reader->data = bytesViewFromData(&reader->buffer[reader->start], found);
+        reader->start += found + 3;
+        if (found == 0) {
+          continue;
+        }
+        return XML_TOKEN_TEXT;
+      } else if (reader->endOfInput == true) {
+        printLog(ERR, "Unterminated CDATA section at offset %llu.\n",
+          llu(reader->position + reader->start));
+        return XML_TOKEN_ERROR;
+      }
+      // The buffer is full.  Return all of it except for the bytes that may
+      // be the start of the "]]>".
+      found -= 2;
+      reader->data = bytesViewFromData(&reader->buffer[reader->start], found);
+      reader->start += found;
+      return XML_TOKEN_TEXT;
+    }
+    
+    if ((reader->start == reader->end)
+      && (xmlReaderFill(reader, false) == false)
+    ) {
+      reader->data = bytesViewFromData(NULL, 0);
+      return XML_TOKEN_END;
+    }
+    
+    const char *buffer = &reader->buffer[reader->start];
+    if (*buffer != '<') {
+      // Text runs to the next tag or until the buffer is full, whichever
+      // comes first.
+      xmlReaderFind(reader, 0, "<", 1, false, &found);
+      reader->data = bytesViewFromData(&reader->buffer[reader->start], found);
+      reader->start += found;
+      return XML_TOKEN_TEXT;
+    }
+    
+    xmlReaderRequire(reader, 2);
+    buffer = &reader->buffer[reader->start];
+    char kind = (reader->end - reader->start >= 2) ? buffer[1] : '\0';
+    if (kind == '!') {
+      if ((xmlReaderRequire(reader, 4) == true)
+        && (strncmp(&reader->buffer[reader->start], "<!--", 4) == 0)
+      ) {
+        if (xmlReaderFind(reader, 4, "-->", 3, true, &found) == false) {
+          printLog(ERR, "Unterminated comment at offset %llu.\n",
+            llu(reader->position + reader->start));
+          return XML_TOKEN_ERROR;
+        }
+        reader->start += found + 3;
+        continue;
+      } else if ((xmlReaderRequire(reader, 9) == true)
+        && (strncmp(&reader->buffer[reader->start], "<![CDATA[", 9) == 0)
+      ) {
+        reader->start += 9;
+        reader->inCData = true;
+        continue;
+      }
+      // DOCTYPE or another declaration.
+      if (xmlReaderFindTagEnd(reader, &found) == false) {
+        printLog(ERR, "Unterminated declaration at offset %llu.\n",
+          llu(reader->position + reader->start));
+        return XML_TOKEN_ERROR;
+      }
+      reader->start += found + 1;
+      continue;
+    } else if (kind == '?') {
+      if (xmlReaderFind(reader, 2, "?>", 2, true, &found) == false) {
+        printLog(ERR,
+          "Unterminated processing instruction at offset %llu.\n",
+          llu(reader->position + reader->start));
+        return XML_TOKEN_ERROR;
+      }
+      reader->start += found + 2;
+      continue;
+    }
+    
+    if (xmlReaderFindTagEnd(reader, &found) == false) {
+      printLog(ERR, "Unterminated tag at offset %llu.\n",
+        llu(reader->position + reader->start));
+      return XML_TOKEN_ERROR;
+    }
+    buffer = &reader->buffer[reader->start];
+    u64 nameStart = (kind == '/') ? 2 : 1;
+    u64 nameEnd = nameStart;
+    while (xmlIsNameEnd(buffer[nameEnd]) == false) {
+      nameEnd++;
+    }
+    if (nameEnd == nameStart) {
+      printLog(ERR, "Missing element name at offset %llu.\n",
+        llu(reader->position + reader->start));
+      return XML_TOKEN_ERROR;
+    }
+    reader->data = bytesViewFromData(&buffer[nameStart], nameEnd - nameStart);
+    reader->start += found + 1;
+    if (kind == '/') {
+      return XML_TOKEN_END_ELEMENT;
+    }
+    reader->endPending = (buffer[found - 1] == '/');
+    return XML_TOKEN_START_ELEMENT;
+  }
+}
 
-/// @fn bool dataEndsWith(const volatile void *haystack, u64 haystackLength, const volatile void *needle, u64 needleLength)
+/// @struct XmlBuilderFrame
+///
+/// @brief An element that xmlToDataStructure has started but not yet
+/// finished.
+///
+/// @param key The name of the element.
+/// @param container The data structure that holds the element's children.
+///   NULL until the first child element is seen.
+/// @param text The text of the element if it has no child elements.
+typedef struct XmlBuilderFrame {
+  Bytes key;
+  void *container;
+  Bytes text;
+} XmlBuilderFrame;
+
+/// @fn static void xmlBuilderFrameDestroy(XmlBuilderFrame *frame, const JsonContainerOps *ops)
 ///
-/// @brief Determine if a block of data ends with a another specified block of
-/// data.
+/// @brief Release everything held by an XmlBuilderFrame.
 ///
-/// @param haystack A pointer to the block of data to check the end of.
-/// @param haystackLength The number of bytes at haystack.
-/// @param needle A pointer to the data to search for.
-/// @param needleLength The number of bytes at needle.
+/// @param frame The XmlBuilderFrame to clear.
+/// @param ops The operations for the frame's container.
 ///
-/// @return Returns true if the last needleLength bytes of haystack end with
-/// needle, false otherwise.
-bool dataEndsWith(const volatile void *haystack, u64 haystackLength,
-  const volatile void *needle, u64 needleLength
+/// @return This function returns no value.
+static void xmlBuilderFrameDestroy(XmlBuilderFrame *frame,
+  const JsonContainerOps *ops
 ) {
-  printLog(TRACE, "ENTER dataEndsWith(haystack=%p, haystackLength=%llu, "
-    "needle=%p, needleLength=%llu)\n", haystack, llu(haystackLength),
-    needle, llu(needleLength));
-  
-  bool returnValue = false;
-  if ((haystack == NULL) != (needle == NULL)) {
-    printLog(ERR, "Mismatch in NULL pointer values.\n");
-    printLog(TRACE, "EXIT dataEndsWith(haystack=%p, haystackLength=%llu, "
-      "needle=%p, needleLength=%llu) = {%s}\n", haystack, llu(haystackLength),
-      needle, llu(needleLength), boolNames[returnValue]);
-    return returnValue; // false
-  } else if (needleLength > haystackLength) {
-    printLog(ERR, "needleLength exceeds haystackLength.\n");
-    printLog(TRACE, "EXIT dataEndsWith(haystack=%p, haystackLength=%llu, "
-      "needle=%p, needleLength=%llu) = {%s}\n", haystack, llu(haystackLength),
-      needle, llu(needleLength), boolNames[returnValue]);
-    return returnValue; // false
+  frame->key = bytesDestroy(frame->key);
+  frame->text = bytesDestroy(frame->text);
+  if (frame->container != NULL) {
+    frame->container = ops->destroy(frame->container);
   }
+}
+
+/// @fn static bool xmlBuilderAdd(XmlBuilderFrame *parent, XmlBuilderFrame *child, const JsonContainerOps *ops)
+///
+/// @brief Add a finished element to the data structure of the element that
+/// contains it.  An element with child elements is added as a nested data
+/// structure and any other element is added as the Bytes of its text.
+///
+/// @param parent The frame of the containing element.
+/// @param child The frame of the finished element.  Ownership of its
+///   container or text passes to parent.
+/// @param ops The operations for the data structures being built.
+///
+/// @return Returns true on success, false on failure.
+static bool xmlBuilderAdd(XmlBuilderFrame *parent, XmlBuilderFrame *child,
+  const JsonContainerOps *ops
+) {
+  const volatile void *value = child->container;
+  TypeDescriptor *addType = *ops->typeNoCopy;
+  TypeDescriptor *type = *ops->type;
+  if (value == NULL) {
+    if (child->text == NULL) {
+      // Empty element.  There was still a tag, so the value is an empty
+      // string rather than nothing.
+      bytesAddStr(&child->text, "");
+    }
+    value = child->text;
+    addType = typeBytesNoCopy;
+    type = typeBytes;
+  }
+  child->container = NULL;
+  child->text = NULL;
   
-  if (((haystack == NULL) && (needle == NULL))
-    || ((haystackLength == 0) && (needleLength == 0))
+  if (ops->addEntry(parent->container, str(child->key), value, addType, type)
+    == false
   ) {
-    // Both values are empty.  Return true.
-    returnValue = true;
-    printLog(ERR, "Mismatch in NULL pointer values.\n");
-    printLog(TRACE, "EXIT dataEndsWith(haystack=%p, haystackLength=%llu, "
-      "needle=%p, needleLength=%llu) = {%s}\n", haystack, llu(haystackLength),
-      needle, llu(needleLength), boolNames[returnValue]);
-    return returnValue; // false
+    printLog(ERR, "Could not add value for key \"%s\".\n", str(child->key));
+    type->destroy((volatile void*) value);
+    return false;
   }
   
-  u64 startIndex = haystackLength - needleLength;
-  unsigned char *haystackChars = ustr(haystack);
-  if (memcmp(&haystackChars[startIndex], (void*) needle, needleLength) == 0) {
-    returnValue = true;
+  return true;
+}
+
+/// @fn void* xmlToDataStructure(XmlReader *reader, const JsonContainerOps *ops)
+///
+/// @brief Build a data structure from the XML an XmlReader reads.  This is the
+/// implementation of the xmlTo* functions generated by XML_TO_DATA_STRUCTURE.
+/// The children of the outermost element become the entries of the data
+/// structure, keyed by element name.  If an element whose name contains
+/// "Request" or "Response" is found, as in a SOAP message, that element is
+/// used as the outermost one instead and reading stops at its closing tag.
+/// Elements that have child elements become nested data structures built
+/// with the same operations and all other elements become the Bytes of their
+/// text.
+///
+/// @param reader The XmlReader to read from.
+/// @param ops The operations for the data structures to build.
+///
+/// @return Returns a pointer to a new data structure on success, NULL on
+/// failure.
+void* xmlToDataStructure(XmlReader *reader, const JsonContainerOps *ops) {
+  printLog(TRACE, "ENTER xmlToDataStructure(reader=%p, ops=%p)\n",
+    reader, ops);
+  
+  if ((reader == NULL) || (ops == NULL)) {
+    printLog(ERR, "Invalid parameters.\n");
+    printLog(TRACE, "EXIT xmlToDataStructure(reader=%p, ops=%p) = {NULL}\n",
+      reader, ops);
+    return NULL;
   }
   
-  printLog(TRACE, "EXIT dataEndsWith(haystack=%p, haystackLength=%llu, "
-    "needle=%p, needleLength=%llu) = {%s}\n", haystack, llu(haystackLength),
-    needle, llu(needleLength), boolNames[returnValue]);
+  XmlBuilderFrame *frames = NULL;
+  u64 depth = 0, capacity = 0;
+  bool foundMessage = false;
+  bool done = false;
+  void *returnValue = NULL;
+  
+  while (done == false) {
+    XmlToken token = xmlReaderNext(reader);
+    BytesView data = reader->data;
+    XmlBuilderFrame *frame = (depth > 0) ? &frames[depth - 1] : NULL;
+    
+    if (token == XML_TOKEN_START_ELEMENT) {
+      if ((foundMessage == false)
+        && ((bytesViewFind(data, bytesViewFromStr("Request")).data != NULL)
+          || (bytesViewFind(data, bytesViewFromStr("Response")).data
+            != NULL))
+      ) {
+        // Everything read so far is the envelope around the message.
+        foundMessage = true;
+        for (; depth > 0; depth--) {
+          xmlBuilderFrameDestroy(&frames[depth - 1], ops);
+        }
+        frame = NULL;
+      }
+      
+      if ((frame != NULL) && (frame->container == NULL)) {
+        frame->text = bytesDestroy(frame->text);
+        frame->container = ops->create();
+        if (frame->container == NULL) {
+          LOG_MALLOC_FAILURE();
+          break;
+        }
+      }
+      
+      if (depth == capacity) {
+        u64 newCapacity = (capacity > 0) ? capacity << 1 : 8;
+        XmlBuilderFrame *newFrames = (XmlBuilderFrame*) realloc(frames,
+          newCapacity * sizeof(XmlBuilderFrame));
+        if (newFrames == NULL) {
+          LOG_MALLOC_FAILURE();
+          break;
+        }
+        frames = newFrames;
+        capacity = newCapacity;
+      }
+      frame = &frames[depth++];
+      frame->key = NULL;
+      frame->container = NULL;
+      frame->text = NULL;
+      bytesAddView(&frame->key, data);
+    } else if (token == XML_TOKEN_TEXT) {
+      // Text outside of the outermost element and text mixed in with child
+      // elements is ignored.
+      if ((frame != NULL) && (frame->container == NULL)) {
+        bytesAddView(&frame->text, data);
+      }
+    } else if (token == XML_TOKEN_END_ELEMENT) {
+      if ((frame == NULL)
+        || (bytesViewCompare(data, bytesViewFromBytes(frame->key)) != 0)
+      ) {
+        printLog(ERR, "Unexpected closing tag \"%.*s\" at offset %llu.\n",
+          (int) data.length, (const char*) data.data,
+          llu(reader->position + reader->start));
+        break;
+      }
+      
+      if (depth == 1) {
+        returnValue = (frame->container != NULL)
+          ? frame->container : ops->create();
+        frame->container = NULL;
+        done = true;
+      } else if (xmlBuilderAdd(&frames[depth - 2], frame, ops) == false) {
+        break;
+      }
+      xmlBuilderFrameDestroy(frame, ops);
+      depth--;
+    } else {
+      if (token == XML_TOKEN_END) {
+        if (frame != NULL) {
+          printLog(ERR, "XML ended before the closing tag of \"%s\".\n",
+            str(frame->key));
+        } else {
+          printLog(DEBUG, "No XML elements found.\n");
+        }
+      }
+      break;
+    }
+  }
+  
+  for (; depth > 0; depth--) {
+    xmlBuilderFrameDestroy(&frames[depth - 1], ops);
+  }
+  free(frames); frames = NULL;
+  
+  printLog(TRACE, "EXIT xmlToDataStructure(reader=%p, ops=%p) = {%p}\n",
+    reader, ops, returnValue);
   return returnValue;
 }
-
@@ -0,0 +1,924 @@
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+//                     Copyright (c) 2012-2024 James Card                     //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included    //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+//                                                                            //
+//                                 James Card                                 //
+//                          http://www.jamescard.org                          //
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+// Doxygen marker
+/// @file
+
+#ifdef DS_LOGGING_ENABLED
+#include "LoggingLib.h"
+#else
+#undef printLog
+#define printLog(...) {}
+#define logFile stderr
+#define LOG_MALLOC_FAILURE(...) {}
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif // _WIN32
+
+#include "CThreads.h"
+#include "ThreadPool.h"
+
+/// @def THREAD_POOL_MIN_QUEUE_CAPACITY
+///
+/// @brief The number of tasks a worker's queue can hold before it first has to
+/// grow.
+#define THREAD_POOL_MIN_QUEUE_CAPACITY 64
+
+/// @struct ThreadPoolFuture
+///
+/// @brief A task submitted to a ThreadPool and, once it has run, its result.
+///
+/// @param function The function to run.
+/// @param argument The argument to pass to function.
+/// @param result The value function returned.  Only valid once done is set.
+/// @param lock The mutex that guards done.
+/// @param condition The condition signalled when done is set.
+/// @param done Whether or not function has returned.
+/// @param references The number of owners of the future:  One for the
+///   submitter until it calls threadPoolFutureDestroy and one for the pool
+///   until the task has run.  The last one to let go frees it.
+struct ThreadPoolFuture {
+  ThreadPoolFunction function;
+  void *argument;
+  void *result;
+  lmtx_t lock;
+  lcnd_t condition;
+  bool done;
+  int references;
+};
+
+/// @struct ThreadPoolWorker
+///
+/// @brief The state of one worker thread of a ThreadPool.
+///
+/// @param threadPool The pool the worker belongs to.
+/// @param index The index of the worker in its pool's workers array.
+/// @param thread The worker's thread.
+/// @param lock The mutex that guards the worker's queue.
+/// @param tasks The worker's queue, a ring buffer of capacity elements.  The
+///   worker takes tasks from the back and other workers steal from the front.
+/// @param head The index of the front of the queue.
+/// @param numTasks The number of tasks in the queue.
+/// @param capacity The number of elements in tasks.
+typedef struct ThreadPoolWorker {
+  struct ThreadPool *threadPool;
+  u32 index;
+  thrd_t thread;
+  lmtx_t lock;
+  ThreadPoolFuture **tasks;
+  u64 head;
+  u64 numTasks;
+  u64 capacity;
+} ThreadPoolWorker;
+
+/// @struct ThreadPool
+///
+/// @brief A pool of worker threads that run submitted tasks.
+///
+/// @param numWorkers The number of workers whose threads are running.
+/// @param workers The array of worker states.
+/// @param lock The mutex that guards the members below it.
+/// @param condition The condition idle workers wait on for new tasks.
+/// @param pending The number of tasks that have been queued but not yet taken
+///   off of a queue.  It can briefly go negative when a task is taken before
+///   its submitter counts it.
+/// @param numIdle The number of workers waiting on the condition.
+/// @param nextWorker The worker to queue the next external submission on.
+/// @param shuttingDown Whether or not threadPoolDestroy has been called.
+struct ThreadPool {
+  u32 numWorkers;
+  ThreadPoolWorker *workers;
+  lmtx_t lock;
+  lcnd_t condition;
+  i64 pending;
+  u32 numIdle;
+  u32 nextWorker;
+  bool shuttingDown;
+};
+
+/// @struct ThreadPoolLoop
+///
+/// @brief The shared state of one parallelFor or parallelReduce call.
+///
+/// @param function The function to call for each chunk of a parallelFor.
+/// @param reduce The function to call for each chunk of a parallelReduce.
+/// @param context The context to pass to function or reduce.
+/// @param begin The beginning of the range.
+/// @param end The end of the range.
+/// @param grainSize The size of each chunk but the last.
+/// @param numChunks The number of chunks the range is split into.
+/// @param nextChunk The next chunk to hand out.
+/// @param chunksDone The number of chunks that have been finished.
+/// @param partials The partial result of each chunk of a parallelReduce.
+/// @param resultSize The size of each partial result.
+/// @param lock The mutex that guards the condition.
+/// @param condition The condition signalled when the last chunk is done.
+/// @param references The number of threads that still use the loop:  One for
+///   the caller and one for each helper task.  The last one to let go frees
+///   it.
+typedef struct ThreadPoolLoop {
+  ParallelForFunction function;
+  ParallelReduceFunction reduce;
+  void *context;
+  u64 begin;
+  u64 end;
+  u64 grainSize;
+  u64 numChunks;
+  u64 nextChunk;
+  u64 chunksDone;
+  char *partials;
+  size_t resultSize;
+  lmtx_t lock;
+  lcnd_t condition;
+  int references;
+} ThreadPoolLoop;
+
+/// @var static tss_t _threadPoolCurrentWorker
+///
+/// @brief The ThreadPoolWorker of the current thread, if it's a worker.
+static tss_t _threadPoolCurrentWorker;
+
+/// @var static once_flag _threadPoolSetupFlag
+///
+/// @brief once_flag to make sure _threadPoolCurrentWorker is only created once.
+static once_flag _threadPoolSetupFlag = ONCE_FLAG_INIT;
+
+/// @var static ThreadPool *_defaultThreadPool
+///
+/// @brief The pool returned by threadPoolGetDefault.
+static ThreadPool *_defaultThreadPool = NULL;
+
+/// @var static once_flag _defaultThreadPoolFlag
+///
+/// @brief once_flag to make sure the default pool is only created once.
+static once_flag _defaultThreadPoolFlag = ONCE_FLAG_INIT;
+
+/// @fn static void threadPoolSetup(void)
+///
+/// @brief Create the thread-specific storage that identifies worker threads.
+///
+/// @return This function returns no value.
+static void threadPoolSetup(void) {
+  if (tss_create(&_threadPoolCurrentWorker, NULL) != thrd_success) {
+    printLog(ERR, "Could not create _threadPoolCurrentWorker.\n");
+  }
+}
+
+/// @fn static u32 threadPoolNumCpus(void)
+///
+/// @brief Get the number of online CPUs.
+///
+/// @return Returns the number of online CPUs, at least 1.
+static u32 threadPoolNumCpus(void) {
+#ifdef _WIN32
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  return (systemInfo.dwNumberOfProcessors > 0)
+    ? (u32) systemInfo.dwNumberOfProcessors : 1;
+#else
+  long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+  return (numCpus > 0) ? (u32) numCpus : 1;
+#endif // _WIN32
+}
+
+/// @fn static void threadPoolFutureRelease(ThreadPoolFuture *future)
+///
+/// @brief Let go of one reference to a future, freeing it if it was the last.
+///
+/// @param future The future to release.
+///
+/// @return This function returns no value.
+static void threadPoolFutureRelease(ThreadPoolFuture *future) {
+  if (__atomic_sub_fetch(&future->references, 1, __ATOMIC_ACQ_REL) == 0) {
+    lcnd_destroy(&future->condition);
+    lmtx_destroy(&future->lock);
+    free(future);
+  }
+}
+
+/// @fn static void threadPoolRunTask(ThreadPoolFuture *future)
+///
+/// @brief Run a task, wake anything waiting for it, and release the pool's
+/// reference to it.
+///
+/// @param future The task to run.
+///
+/// @return This function returns no value.
+static void threadPoolRunTask(ThreadPoolFuture *future) {
+  void *result = future->function(future->argument);
+  
+  lmtx_lock(&future->lock);
+  future->result = result;
+  __atomic_store_n(&future->done, true, __ATOMIC_RELEASE);
+  lcnd_broadcast(&future->condition);
+  lmtx_unlock(&future->lock);
+  
+  threadPoolFutureRelease(future);
+}
+
+/// @fn static bool threadPoolWorkerPush(ThreadPoolWorker *worker, ThreadPoolFuture *future)
+///
+/// @brief Add a task to the back of a worker's queue, growing it if needed.
+///
+/// @param worker The worker to queue the task on.
+/// @param future The task to queue.
+///
+/// @return Returns true on success, false on memory allocation failure.
+static bool threadPoolWorkerPush(ThreadPoolWorker *worker,
+  ThreadPoolFuture *future
+) {
+  lmtx_lock(&worker->lock);
+  if (worker->numTasks == worker->capacity) {
+    u64 capacity = (worker->capacity > 0)
+      ? (2 * worker->capacity) : THREAD_POOL_MIN_QUEUE_CAPACITY;
+    ThreadPoolFuture **tasks
+      = (ThreadPoolFuture**) malloc(capacity * sizeof(ThreadPoolFuture*));
+    if (tasks == NULL) {
+      lmtx_unlock(&worker->lock);
+      LOG_MALLOC_FAILURE();
+      return false;
+    }
+    for (u64 ii = 0; ii < worker->numTasks; ii++) {
+      tasks[ii] = worker->tasks[(worker->head + ii) % worker->capacity];
+    }
+    free(worker->tasks);
+    worker->tasks = tasks;
+    worker->head = 0;
+    worker->capacity = capacity;
+  }
+  
+  worker->tasks[(worker->head + worker->numTasks) % worker->capacity] = future;
+  __atomic_store_n(&worker->numTasks, worker->numTasks + 1, __ATOMIC_RELEASE);
+  lmtx_unlock(&worker->lock);
+  
+  return true;
+}
+
+/// @fn static ThreadPoolFuture* threadPoolWorkerPop(ThreadPoolWorker *worker, bool fromBack)
+///
+/// @brief Take a task off of a worker's queue.
+///
+/// @param worker The worker whose queue to take from.
+/// @param fromBack Whether to take the newest task, which is what a worker
+///   does with its own queue, or the oldest, which is what thieves do.
+///
+/// @return Returns the task taken or NULL if the queue was empty.
+static ThreadPoolFuture* threadPoolWorkerPop(ThreadPoolWorker *worker,
+  bool fromBack
+) {
+  ThreadPoolFuture *future = NULL;
+  if (__atomic_load_n(&worker->numTasks, __ATOMIC_ACQUIRE) == 0) {
+    // Don't bother with the lock.
+    return future; // NULL
+  }
+  
+  lmtx_lock(&worker->lock);
+  if (worker->numTasks > 0) {
+    u64 numTasks = worker->numTasks - 1;
+    if (fromBack == true) {
+      future = worker->tasks[(worker->head + numTasks) % worker->capacity];
+    } else {
+      future = worker->tasks[worker->head];
+      worker->head = (worker->head + 1) % worker->capacity;
+    }
+    __atomic_store_n(&worker->numTasks, numTasks, __ATOMIC_RELEASE);
+  }
+  lmtx_unlock(&worker->lock);
+  
+  return future;
+}
+
+/// @fn static ThreadPoolFuture* threadPoolTake(ThreadPool *threadPool, ThreadPoolWorker *worker)
+///
+/// @brief Take the next task to run, trying the worker's own queue first and
+/// then stealing from the other workers in turn.
+///
+/// @param threadPool The pool to take a task from.
+/// @param worker The worker taking the task or NULL if it's not a worker of
+///   threadPool.
+///
+/// @return Returns the task taken or NULL if every queue was empty.
+static ThreadPoolFuture* threadPoolTake(ThreadPool *threadPool,
+  ThreadPoolWorker *worker
+) {
+  ThreadPoolFuture *future = NULL;
+  u32 start = 0;
+  if (worker != NULL) {
+    future = threadPoolWorkerPop(worker, true);
+    start = worker->index + 1;
+  }
+  
+  for (u32 ii = 0; (future == NULL) && (ii < threadPool->numWorkers); ii++) {
+    ThreadPoolWorker *victim
+      = &threadPool->workers[(start + ii) % threadPool->numWorkers];
+    if (victim != worker) {
+      future = threadPoolWorkerPop(victim, false);
+    }
+  }
+  
+  if (future != NULL) {
+    __atomic_sub_fetch(&threadPool->pending, 1, __ATOMIC_RELAXED);
+  }
+  return future;
+}
+
+/// @fn static ThreadPoolWorker* threadPoolCurrentWorker(ThreadPool *threadPool)
+///
+/// @brief Get the worker state of the current thread.
+///
+/// @param threadPool The pool the worker has to belong to.
+///
+/// @return Returns the current thread's ThreadPoolWorker if it's a worker of
+/// threadPool, NULL otherwise.
+static ThreadPoolWorker* threadPoolCurrentWorker(ThreadPool *threadPool) {
+  call_once(&_threadPoolSetupFlag, threadPoolSetup);
+  ThreadPoolWorker *worker
+    = (ThreadPoolWorker*) tss_get(_threadPoolCurrentWorker);
+  if ((worker != NULL) && (worker->threadPool != threadPool)) {
+    worker = NULL;
+  }
+  
+  return worker;
+}
+
+/// @fn static int threadPoolWorkerMain(void *arg)
+///
+/// @brief Entry point of the worker threads of a ThreadPool.  Runs tasks until
+/// the pool is shut down and every queue is empty.
+///
+/// @param arg The ThreadPoolWorker of the thread.
+///
+/// @return Always returns 0.
+static int threadPoolWorkerMain(void *arg) {
+  ThreadPoolWorker *worker = (ThreadPoolWorker*) arg;
+  ThreadPool *threadPool = worker->threadPool;
+  tss_set(_threadPoolCurrentWorker, worker);
+  
+  while (1) {
+    ThreadPoolFuture *future = threadPoolTake(threadPool, worker);
+    if (future != NULL) {
+      threadPoolRunTask(future);
+      continue;
+    }
+    
+    lmtx_lock(&threadPool->lock);
+    if (__atomic_load_n(&threadPool->pending, __ATOMIC_RELAXED) <= 0) {
+      if (threadPool->shuttingDown == true) {
+        lmtx_unlock(&threadPool->lock);
+        break;
+      }
+      threadPool->numIdle++;
+      lcnd_wait(&threadPool->condition, &threadPool->lock);
+      threadPool->numIdle--;
+    }
+    lmtx_unlock(&threadPool->lock);
+  }
+  
+  tss_set(_threadPoolCurrentWorker, NULL);
+  return 0;
+}
+
+/// @fn ThreadPool* threadPoolCreate(u32 numThreads)
+///
+/// @brief Create a pool of worker threads.
+///
+/// @param numThreads The number of worker threads to start.  0 means one per
+///   online CPU.
+///
+/// @return Returns a pointer to the new ThreadPool on success, NULL on
+/// failure.  The pool may have fewer threads than requested if some of them
+/// could not be started.
+ThreadPool* threadPoolCreate(u32 numThreads) {
+  printLog(TRACE, "ENTER threadPoolCreate(numThreads=%u)\n", numThreads);
+  
+  call_once(&_threadPoolSetupFlag, threadPoolSetup);
+  if (numThreads == 0) {
+    numThreads = threadPoolNumCpus();
+  }
+  
+  ThreadPool *threadPool = (ThreadPool*) calloc(1, sizeof(ThreadPool));
+  if (threadPool == NULL) {
+    LOG_MALLOC_FAILURE();
+    printLog(TRACE, "EXIT threadPoolCreate(numThreads=%u) = {%p}\n",
+      numThreads, (void*) threadPool);
+    return threadPool; // NULL
+  }
+  threadPool->workers
+    = (ThreadPoolWorker*) calloc(numThreads, sizeof(ThreadPoolWorker));
+  if (threadPool->workers == NULL) {
+    LOG_MALLOC_FAILURE();
+    free(threadPool); threadPool = NULL;
+    printLog(TRACE, "EXIT threadPoolCreate(numThreads=%u) = {%p}\n",
+      numThreads, (void*) threadPool);
+    return threadPool; // NULL
+  }
+  lmtx_init(&threadPool->lock);
+  lcnd_init(&threadPool->condition);
+  
+  for (u32 ii = 0; ii < numThreads; ii++) {
+    ThreadPoolWorker *worker = &threadPool->workers[ii];
+    worker->threadPool = threadPool;
+    worker->index = ii;
+    lmtx_init(&worker->lock);
+  }
+  
+  // Workers steal from every worker in workers, so numWorkers has to be set
+  // before any of them start.  Shrink it if some threads can't be started.
+  threadPool->numWorkers = numThreads;
+  for (u32 ii = 0; ii < numThreads; ii++) {
+    if (thrd_create(&threadPool->workers[ii].thread, threadPoolWorkerMain,
+      &threadPool->workers[ii]) != thrd_success
+    ) {
+      printLog(ERR, "Could not start thread pool worker %u.\n", ii);
+      __atomic_store_n(&threadPool->numWorkers, ii, __ATOMIC_RELEASE);
+      break;
+    }
+  }
+  
+  printLog(TRACE, "EXIT threadPoolCreate(numThreads=%u) = {%p}\n",
+    numThreads, (void*) threadPool);
+  return threadPool;
+}
+
+/// @fn ThreadPool* threadPoolDestroy(ThreadPool *threadPool)
+///
+/// @brief Run every task still queued on a ThreadPool, stop its threads, and
+/// free it.  The default pool can't be destroyed.
+///
+/// @param threadPool The ThreadPool to destroy.
+///
+/// @return Returns NULL on success, threadPool if it's the default pool.
+ThreadPool* threadPoolDestroy(ThreadPool *threadPool) {
+  if ((threadPool == NULL) || (threadPool == _defaultThreadPool)) {
+    return threadPool;
+  }
+  
+  lmtx_lock(&threadPool->lock);
+  threadPool->shuttingDown = true;
+  lcnd_broadcast(&threadPool->condition);
+  lmtx_unlock(&threadPool->lock);
+  
+  for (u32 ii = 0; ii < threadPool->numWorkers; ii++) {
+    thrd_join(threadPool->workers[ii].thread, NULL);
+  }
+  for (u32 ii = 0; ii < threadPool->numWorkers; ii++) {
+    ThreadPoolWorker *worker = &threadPool->workers[ii];
+    // Tasks may have been queued after every worker that could steal them
+    // had already stopped.
+    ThreadPoolFuture *future = NULL;
+    while ((future = threadPoolWorkerPop(worker, false)) != NULL) {
+      threadPoolRunTask(future);
+    }
+  }
+  for (u32 ii = 0; ii < threadPool->numWorkers; ii++) {
+    lmtx_destroy(&threadPool->workers[ii].lock);
+    free(threadPool->workers[ii].tasks);
+  }
+  
+  lcnd_destroy(&threadPool->condition);
+  lmtx_destroy(&threadPool->lock);
+  free(threadPool->workers);
+  free(threadPool);
+  
+  return NULL;
+}
+
+/// @fn static void threadPoolSetupDefault(void)
+///
+/// @brief Create the default pool.
+///
+/// @return This function returns no value.
+static void threadPoolSetupDefault(void) {
+  _defaultThreadPool = threadPoolCreate(0);
+}
+
+/// @fn ThreadPool* threadPoolGetDefault(void)
+///
+/// @brief Get the pool shared by the library, which has one thread per online
+/// CPU and is created the first time it's asked for.  It lasts for the life of
+/// the process.
+///
+/// @return Returns a pointer to the default ThreadPool or NULL if it could not
+/// be created.
+ThreadPool* threadPoolGetDefault(void) {
+  call_once(&_defaultThreadPoolFlag, threadPoolSetupDefault);
+  return _defaultThreadPool;
+}
+
+/// @fn u32 threadPoolNumThreads(ThreadPool *threadPool)
+///
+/// @brief Get the number of worker threads in a pool.
+///
+/// @param threadPool The ThreadPool to inspect.
+///
+/// @return Returns the number of worker threads, 0 if threadPool is NULL.
+u32 threadPoolNumThreads(ThreadPool *threadPool) {
+  return (threadPool != NULL)
+    ? __atomic_load_n(&threadPool->numWorkers, __ATOMIC_ACQUIRE) : 0;
+}
+
+/// @fn ThreadPoolFuture* threadPoolSubmit(ThreadPool *threadPool, ThreadPoolFunction function, void *argument)
+///
+/// @brief Queue a task to run on a ThreadPool.  If the pool has no threads,
+/// the task is run before this function returns.
+///
+/// @param threadPool The ThreadPool to run the task on.
+/// @param function The function to run.
+/// @param argument The argument to pass to function.
+///
+/// @return Returns a future for the task's result on success, NULL on
+/// failure.  The future must be released with threadPoolFutureDestroy whether
+/// or not the caller waits for it.
+ThreadPoolFuture* threadPoolSubmit(ThreadPool *threadPool,
+  ThreadPoolFunction function, void *argument
+) {
+  if ((threadPool == NULL) || (function == NULL)) {
+    printLog(ERR, "Invalid parameters to threadPoolSubmit.\n");
+    return NULL;
+  }
+  
+  ThreadPoolFuture *future
+    = (ThreadPoolFuture*) calloc(1, sizeof(ThreadPoolFuture));
+  if (future == NULL) {
+    LOG_MALLOC_FAILURE();
+    return future; // NULL
+  }
+  future->function = function;
+  future->argument = argument;
+  future->references = 2;
+  lmtx_init(&future->lock);
+  lcnd_init(&future->condition);
+  
+  u32 numWorkers = threadPoolNumThreads(threadPool);
+  if (numWorkers == 0) {
+    threadPoolRunTask(future);
+    return future;
+  }
+  
+  ThreadPoolWorker *worker = threadPoolCurrentWorker(threadPool);
+  if (worker == NULL) {
+    u32 index
+      = __atomic_fetch_add(&threadPool->nextWorker, 1, __ATOMIC_RELAXED);
+    worker = &threadPool->workers[index % numWorkers];
+  }
+  if (threadPoolWorkerPush(worker, future) == false) {
+    threadPoolFutureRelease(future);
+    threadPoolFutureRelease(future);
+    return NULL;
+  }
+  
+  lmtx_lock(&threadPool->lock);
+  __atomic_add_fetch(&threadPool->pending, 1, __ATOMIC_RELAXED);
+  if (threadPool->numIdle > 0) {
+    lcnd_signal(&threadPool->condition);
+  }
+  lmtx_unlock(&threadPool->lock);
+  
+  return future;
+}
+
+/// @fn bool threadPoolFutureIsDone(ThreadPoolFuture *future)
+///
+/// @brief Find out whether a task has finished without waiting for it.
+///
+/// @param future The future returned by threadPoolSubmit.
+///
+/// @return Returns true if the task has finished, false otherwise.
+bool threadPoolFutureIsDone(ThreadPoolFuture *future) {
+  return (future != NULL)
+    && (__atomic_load_n(&future->done, __ATOMIC_ACQUIRE) == true);
+}
+
+/// @fn void* threadPoolFutureWait(ThreadPoolFuture *future)
+///
+/// @brief Wait for a task to finish.  A worker thread waiting on a task of its
+/// own pool runs other queued tasks in the meantime so that tasks can wait on
+/// the tasks they submit without tying up the pool.
+///
+/// @param future The future returned by threadPoolSubmit.
+///
+/// @return Returns the value the task's function returned.
+void* threadPoolFutureWait(ThreadPoolFuture *future) {
+  if (future == NULL) {
+    return NULL;
+  }
+  
+  ThreadPoolWorker *worker = (ThreadPoolWorker*) tss_get(_threadPoolCurrentWorker);
+  while (threadPoolFutureIsDone(future) == false) {
+    if (worker != NULL) {
+      ThreadPoolFuture *other = threadPoolTake(worker->threadPool, worker);
+      if (other != NULL) {
+        threadPoolRunTask(other);
+        continue;
+      }
+    }
+    
+    // Nothing else to do.  Whatever's left of the task is running on another
+    // thread, so it's safe to sleep.
+    lmtx_lock(&future->lock);
+    while (future->done == false) {
+      lcnd_wait(&future->condition, &future->lock);
+    }
+    lmtx_unlock(&future->lock);
+  }
+  
+  return future->result;
+}
+
+/// @fn ThreadPoolFuture* threadPoolFutureDestroy(ThreadPoolFuture *future)
+///
+/// @brief Release a future.  The task still runs if it hasn't yet.
+///
+/// @param future The future returned by threadPoolSubmit.
+///
+/// @return Always returns NULL.
+ThreadPoolFuture* threadPoolFutureDestroy(ThreadPoolFuture *future) {
+  if (future != NULL) {
+    threadPoolFutureRelease(future);
+  }
+  
+  return NULL;
+}
+
+/// @fn static void threadPoolLoopRelease(ThreadPoolLoop *loop)
+///
+/// @brief Let go of one reference to a loop, freeing it if it was the last.
+///
+/// @param loop The loop to release.
+///
+/// @return This function returns no value.
+static void threadPoolLoopRelease(ThreadPoolLoop *loop) {
+  if (__atomic_sub_fetch(&loop->references, 1, __ATOMIC_ACQ_REL) == 0) {
+    lcnd_destroy(&loop->condition);
+    lmtx_destroy(&loop->lock);
+    free(loop->partials);
+    free(loop);
+  }
+}
+
+/// @fn static void threadPoolLoopRunChunks(ThreadPoolLoop *loop)
+///
+/// @brief Take chunks of a loop one at a time and run them until there are
+/// none left.
+///
+/// @param loop The loop to work on.
+///
+/// @return This function returns no value.
+static void threadPoolLoopRunChunks(ThreadPoolLoop *loop) {
+  while (1) {
+    u64 chunk = __atomic_fetch_add(&loop->nextChunk, 1, __ATOMIC_RELAXED);
+    if (chunk >= loop->numChunks) {
+      break;
+    }
+    
+    u64 chunkBegin = loop->begin + (chunk * loop->grainSize);
+    u64 chunkEnd = ((loop->end - chunkBegin) > loop->grainSize)
+      ? (chunkBegin + loop->grainSize) : loop->end;
+    if (loop->reduce != NULL) {
+      loop->reduce(chunkBegin, chunkEnd,
+        &loop->partials[chunk * loop->resultSize], loop->context);
+    } else {
+      loop->function(chunkBegin, chunkEnd, loop->context);
+    }
+    
+    if (__atomic_add_fetch(&loop->chunksDone, 1, __ATOMIC_ACQ_REL)
+      == loop->numChunks
+    ) {
+      lmtx_lock(&loop->lock);
+      lcnd_broadcast(&loop->condition);
+      lmtx_unlock(&loop->lock);
+    }
+  }
+}
+
+/// @fn static void* threadPoolLoopHelper(void *argument)
+///
+/// @brief Task that helps the caller of parallelFor or parallelReduce with its
+/// chunks.
+///
+/// @param argument The ThreadPoolLoop to help with.
+///
+/// @return Always returns NULL.
+static void* threadPoolLoopHelper(void *argument) {
+  ThreadPoolLoop *loop = (ThreadPoolLoop*) argument;
+  threadPoolLoopRunChunks(loop);
+  threadPoolLoopRelease(loop);
+  return NULL;
+}
+
+/// @fn static ThreadPoolLoop* threadPoolLoopStart(ThreadPool *threadPool, u64 begin, u64 end, u64 grainSize, size_t resultSize, const void *result)
+///
+/// @brief Set up a loop and submit the tasks that help with it.
+///
+/// @param threadPool The pool to run the loop on.
+/// @param begin The beginning of the range.
+/// @param end The end of the range.
+/// @param grainSize The requested chunk size.  0 picks one.
+/// @param resultSize The size of each partial result, 0 for parallelFor.
+/// @param result The initial result to copy into each partial result.
+///
+/// @return Returns the new loop on success, NULL if the range should just be
+/// run on the calling thread.
+static ThreadPoolLoop* threadPoolLoopStart(ThreadPool *threadPool,
+  u64 begin, u64 end, u64 grainSize, size_t resultSize, const void *result
+) {
+  u32 numWorkers = threadPoolNumThreads(threadPool);
+  u64 size = end - begin;
+  if (grainSize == 0) {
+    u64 numChunks
+      = ((u64) numWorkers + 1) * THREAD_POOL_CHUNKS_PER_THREAD;
+    grainSize = (size + numChunks - 1) / numChunks;
+  }
+  u64 numChunks = (size + grainSize - 1) / grainSize;
+  if ((numWorkers == 0) || (numChunks < 2)) {
+    return NULL;
+  }
+  
+  ThreadPoolLoop *loop = (ThreadPoolLoop*) calloc(1, sizeof(ThreadPoolLoop));
+  if (loop == NULL) {
+    LOG_MALLOC_FAILURE();
+    return loop; // NULL
+  }
+  if (resultSize > 0) {
+    loop->partials = (char*) malloc(numChunks * resultSize);
+    if (loop->partials == NULL) {
+      LOG_MALLOC_FAILURE();
+      free(loop); loop = NULL;
+      return loop; // NULL
+    }
+    for (u64 ii = 0; ii < numChunks; ii++) {
+      memcpy(&loop->partials[ii * resultSize], result, resultSize);
+    }
+  }
+  loop->begin = begin;
+  loop->end = end;
+  loop->grainSize = grainSize;
+  loop->numChunks = numChunks;
+  loop->resultSize = resultSize;
+  loop->references = 1;
+  lmtx_init(&loop->lock);
+  lcnd_init(&loop->condition);
+  
+  return loop;
+}
+
+/// @fn static void threadPoolLoopRun(ThreadPool *threadPool, ThreadPoolLoop *loop)
+///
+/// @brief Submit the helper tasks for a loop, work on it from the calling
+/// thread, and wait for every chunk to finish.
+///
+/// @param threadPool The pool to run the loop on.
+/// @param loop The loop to run.
+///
+/// @return This function returns no value.
+static void threadPoolLoopRun(ThreadPool *threadPool, ThreadPoolLoop *loop) {
+  u64 numHelpers = threadPoolNumThreads(threadPool);
+  if (numHelpers > loop->numChunks - 1) {
+    numHelpers = loop->numChunks - 1;
+  }
+  for (u64 ii = 0; ii < numHelpers; ii++) {
+    __atomic_add_fetch(&loop->references, 1, __ATOMIC_RELAXED);
+    ThreadPoolFuture *future
+      = threadPoolSubmit(threadPool, threadPoolLoopHelper, loop);
+    if (future == NULL) {
+      // The calling thread will pick up the slack.
+      __atomic_sub_fetch(&loop->references, 1, __ATOMIC_RELAXED);
+      break;
+    }
+    threadPoolFutureDestroy(future);
+  }
+  
+  threadPoolLoopRunChunks(loop);
+  
+  // Helpers that haven't started yet will find no chunks left, so only the
+  // chunks that are already running have to be waited for.
+  lmtx_lock(&loop->lock);
+  while (__atomic_load_n(&loop->chunksDone, __ATOMIC_ACQUIRE)
+    < loop->numChunks
+  ) {
+    lcnd_wait(&loop->condition, &loop->lock);
+  }
+  lmtx_unlock(&loop->lock);
+}
+
+/// @fn int parallelFor(ThreadPool *threadPool, u64 begin, u64 end, u64 grainSize, ParallelForFunction function, void *context)
+///
+/// @brief Call a function on every chunk of a range, spreading the chunks
+/// across the calling thread and a pool's workers, and wait for them all to
+/// finish.
+///
+/// @param threadPool The pool to use.  If this is NULL or has no threads, the
+///   whole range is run on the calling thread.
+/// @param begin The beginning of the range.
+/// @param end The end of the range, exclusive.
+/// @param grainSize The size of each chunk.  0 splits the range into
+///   THREAD_POOL_CHUNKS_PER_THREAD chunks per thread.
+/// @param function The function to call for each chunk.
+/// @param context The context to pass to function.
+///
+/// @return Returns 0 on success, -1 on invalid parameters.
+int parallelFor(ThreadPool *threadPool, u64 begin, u64 end, u64 grainSize,
+  ParallelForFunction function, void *context
+) {
+  if ((function == NULL) || (end < begin)) {
+    printLog(ERR, "Invalid parameters to parallelFor.\n");
+    return -1;
+  } else if (end == begin) {
+    return 0;
+  }
+  
+  ThreadPoolLoop *loop
+    = threadPoolLoopStart(threadPool, begin, end, grainSize, 0, NULL);
+  if (loop == NULL) {
+    function(begin, end, context);
+    return 0;
+  }
+  loop->function = function;
+  loop->context = context;
+  
+  threadPoolLoopRun(threadPool, loop);
+  threadPoolLoopRelease(loop);
+  
+  return 0;
+}
+
+/// @fn int parallelReduce(ThreadPool *threadPool, u64 begin, u64 end, u64 grainSize, void *result, size_t resultSize, ParallelReduceFunction reduce, ParallelCombineFunction combine, void *context)
+///
+/// @brief Fold every chunk of a range into a partial result, spreading the
+/// chunks across the calling thread and a pool's workers, then combine the
+/// partial results in order.
+///
+/// @param threadPool The pool to use.  If this is NULL or has no threads, the
+///   whole range is folded straight into result on the calling thread.
+/// @param begin The beginning of the range.
+/// @param end The end of the range, exclusive.
+/// @param grainSize The size of each chunk.  0 splits the range into
+///   THREAD_POOL_CHUNKS_PER_THREAD chunks per thread.
+/// @param result On input, the identity value each partial result starts
+///   from.  On output, the combined result.
+/// @param resultSize The size of the value at result.
+/// @param reduce The function to call for each chunk.
+/// @param combine The function that folds a partial result into result.
+/// @param context The context to pass to reduce and combine.
+///
+/// @return Returns 0 on success, -1 on invalid parameters.
+int parallelReduce(ThreadPool *threadPool, u64 begin, u64 end,
+  u64 grainSize, void *result, size_t resultSize,
+  ParallelReduceFunction reduce, ParallelCombineFunction combine,
+  void *context
+) {
+  if ((result == NULL) || (resultSize == 0) || (reduce == NULL)
+    || (combine == NULL) || (end < begin)
+  ) {
+    printLog(ERR, "Invalid parameters to parallelReduce.\n");
+    return -1;
+  } else if (end == begin) {
+    return 0;
+  }
+  
+  ThreadPoolLoop *loop = threadPoolLoopStart(threadPool, begin, end,
+    grainSize, resultSize, result);
+  if (loop == NULL) {
+    reduce(begin, end, result, context);
+    return 0;
+  }
+  loop->reduce = reduce;
+  loop->context = context;
+  
+  threadPoolLoopRun(threadPool, loop);
+  for (u64 ii = 0; ii < loop->numChunks; ii++) {
+    combine(result, &loop->partials[ii * resultSize], context);
+  }
+  threadPoolLoopRelease(loop);
+  
+  return 0;
+}
+
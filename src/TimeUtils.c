@@ -29,6 +29,9 @@
 /// @file
 
 #include "TimeUtils.h"
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(_MSC_VER)
+#include <cpuid.h>
+#endif
 
 static const char *_weekdays[] = {
   "Sunday",
@@ -57,3 +60,274 @@ const char *weekdayToString(int weekday) {
   return _weekdays[weekday];
 }
 
+/// @struct TimestampCache
+///
+/// @brief The most recent timestamp formatted on a thread.
+///
+/// @param seconds The whole seconds the text was formatted for.
+/// @param text The formatted timestamp.  Only the first
+///   TIMESTAMP_SECONDS_LENGTH characters are reused.
+typedef struct TimestampCache {
+  i64  seconds;
+  char text[TIMESTAMP_SIZE];
+} TimestampCache;
+
+/// @def TIMESTAMP_SECONDS_LENGTH
+///
+/// @brief The length of the "YYYY-MM-DD hh:mm:ss." prefix of a timestamp for
+/// a year with four digits.
+#define TIMESTAMP_SECONDS_LENGTH 20
+
+/// @var _timestampCacheSetup
+///
+/// @brief once_flag for creating _timestampCacheKey.
+static once_flag _timestampCacheSetup = ONCE_FLAG_INIT;
+
+/// @var _timestampCacheKey
+///
+/// @brief Thread-specific storage for each thread's TimestampCache.
+ZEROINIT(static tss_t _timestampCacheKey);
+
+/// @var _timestampCacheKeyValid
+///
+/// @brief Whether or not _timestampCacheKey was successfully created.
+static bool _timestampCacheKeyValid = false;
+
+/// @fn static void timestampCacheSetup(void)
+///
+/// @brief Create the thread-specific storage key for the TimestampCaches.
+///
+/// @return This function returns no value.
+static void timestampCacheSetup(void) {
+  if (tss_create(&_timestampCacheKey, free) == thrd_success) {
+    _timestampCacheKeyValid = true;
+  }
+}
+
+/// @fn char* formatTimestamp(i64 seconds, long nanoseconds, char *timestamp)
+///
+/// @brief Format a UTC time as a timestamp in the form
+/// YYYY-MM-DD hh:mm:ss.nnnnnnnnn.
+///
+/// @details Each thread caches the date and time portion of the last
+/// timestamp it formatted.  While the second doesn't change, only the
+/// nanoseconds are formatted, which avoids gmtime_r and snprintf for nearly
+/// every log line.
+///
+/// @param seconds The number of seconds since midnight, Jan 1, 1970 UTC.
+/// @param nanoseconds The nanoseconds past seconds.
+/// @param timestamp Character buffer of at least TIMESTAMP_SIZE bytes to hold
+///   the output timestamp.  This parameter may be NULL.  A buffer will be
+///   allocated if it is not provided.
+///
+/// @return Returns the timestamp on success, NULL on memory allocation
+/// failure.
+char* formatTimestamp(i64 seconds, long nanoseconds, char *timestamp) {
+  if (timestamp == NULL) {
+    // No buffer provided, so allocate one.
+    timestamp = (char*) malloc(TIMESTAMP_SIZE);
+    if (timestamp == NULL) {
+      return NULL;
+    }
+  }
+  
+  call_once(&_timestampCacheSetup, timestampCacheSetup);
+  TimestampCache *cache = NULL;
+  if (_timestampCacheKeyValid == true) {
+    cache = (TimestampCache*) tss_get(_timestampCacheKey);
+    if (cache == NULL) {
+      // The zeroed text can't match below, so the first lookup misses.
+      cache = (TimestampCache*) calloc(1, sizeof(TimestampCache));
+      if ((cache != NULL)
+        && (tss_set(_timestampCacheKey, cache) != thrd_success)
+      ) {
+        free(cache); cache = NULL;
+      }
+    }
+  }
+  
+  if ((cache == NULL) || (nanoseconds < 0) || (nanoseconds >= 1000000000)) {
+    // Nothing to cache into or nothing we can format quickly.
+    ZEROINIT(struct tm timestampStruct);
+    time_t timeValue = (time_t) seconds;
+    gmtime_r(&timeValue, &timestampStruct);
+    snprintf(timestamp, TIMESTAMP_SIZE, "%4d-%02d-%02d %02d:%02d:%02d.%09ld",
+      timestampStruct.tm_year + 1900,
+      timestampStruct.tm_mon + 1,
+      timestampStruct.tm_mday,
+      timestampStruct.tm_hour,
+      timestampStruct.tm_min,
+      timestampStruct.tm_sec,
+      nanoseconds);
+    return timestamp;
+  }
+  
+  if ((cache->seconds != seconds)
+    || (cache->text[TIMESTAMP_SECONDS_LENGTH - 1] != '.')
+  ) {
+    ZEROINIT(struct tm timestampStruct);
+    time_t timeValue = (time_t) seconds;
+    gmtime_r(&timeValue, &timestampStruct);
+    snprintf(cache->text, TIMESTAMP_SIZE, "%4d-%02d-%02d %02d:%02d:%02d.",
+      timestampStruct.tm_year + 1900,
+      timestampStruct.tm_mon + 1,
+      timestampStruct.tm_mday,
+      timestampStruct.tm_hour,
+      timestampStruct.tm_min,
+      timestampStruct.tm_sec);
+    cache->seconds = seconds;
+    if (cache->text[TIMESTAMP_SECONDS_LENGTH - 1] != '.') {
+      // Not a four-digit year.  Don't try to reuse this one.
+      snprintf(timestamp, TIMESTAMP_SIZE, "%s%09ld", cache->text, nanoseconds);
+      return timestamp;
+    }
+  }
+  
+  memcpy(timestamp, cache->text, TIMESTAMP_SECONDS_LENGTH);
+  for (int ii = TIMESTAMP_SECONDS_LENGTH + 8;
+    ii >= TIMESTAMP_SECONDS_LENGTH;
+    ii--
+  ) {
+    timestamp[ii] = (char) ('0' + (nanoseconds % 10));
+    nanoseconds /= 10;
+  }
+  timestamp[TIMESTAMP_SECONDS_LENGTH + 9] = '\0';
+  
+  return timestamp;
+}
+
+/// @var _cpuTicksSetup
+///
+/// @brief once_flag for calibrating the CPU tick counter.
+static once_flag _cpuTicksSetup = ONCE_FLAG_INIT;
+
+/// @var _cpuTicksUsable
+///
+/// @brief Whether or not getCpuTicks runs at a constant rate that can be
+/// converted to time.
+static bool _cpuTicksUsable = false;
+
+/// @var _cpuTicksFrequency
+///
+/// @brief The number of ticks per second counted by getCpuTicks.
+static u64 _cpuTicksFrequency = 1000000000;
+
+/// @var _cpuTicksMultiplier
+///
+/// @brief Nanoseconds per tick as a 32.32 fixed-point number.
+static u64 _cpuTicksMultiplier = ((u64) 1) << 32;
+
+/// @var _cpuTicksBase
+///
+/// @brief The tick count at which _cpuTicksBaseNanoseconds was read.
+static u64 _cpuTicksBase = 0;
+
+/// @var _cpuTicksBaseNanoseconds
+///
+/// @brief getMonotonicNanoseconds at the time _cpuTicksBase was read, so that
+/// getCpuTicksNanoseconds and getMonotonicNanoseconds share an epoch.
+static i64 _cpuTicksBaseNanoseconds = 0;
+
+/// @fn static void cpuTicksCalibrate(void)
+///
+/// @brief Determine the frequency of the counter read by getCpuTicks.  On x86,
+/// the TSC is only used if the CPU reports it as invariant (constant rate
+/// across power states) and its frequency is measured against the monotonic
+/// clock over 10 milliseconds.  On 64-bit ARM, the frequency is read from the
+/// system.
+///
+/// @return This function returns no value.
+static void cpuTicksCalibrate(void) {
+#if defined(__x86_64__) || defined(__i386__) \
+  || defined(_M_X64) || defined(_M_IX86)
+  unsigned int registers[4] = { 0, 0, 0, 0 };
+#ifdef _MSC_VER
+  __cpuid((int*) registers, 0x80000000);
+  if (registers[0] >= 0x80000007) {
+    __cpuid((int*) registers, 0x80000007);
+  } else {
+    registers[3] = 0;
+  }
+#else
+  if (__get_cpuid(0x80000007, &registers[0], &registers[1], &registers[2],
+    &registers[3]) == 0
+  ) {
+    registers[3] = 0;
+  }
+#endif // _MSC_VER
+  // EDX bit 8 is the invariant TSC flag.
+  if ((registers[3] & (1 << 8)) != 0) {
+    i64 startNanoseconds = getMonotonicNanoseconds();
+    u64 startTicks = getCpuTicks();
+    struct timespec delay = { 0, 10000000 };
+    thrd_sleep(&delay, NULL);
+    u64 endTicks = getCpuTicks();
+    i64 endNanoseconds = getMonotonicNanoseconds();
+    if ((endNanoseconds > startNanoseconds) && (endTicks > startTicks)) {
+      _cpuTicksFrequency = ((endTicks - startTicks) * ((u64) 1000000000))
+        / ((u64) (endNanoseconds - startNanoseconds));
+      _cpuTicksBase = endTicks;
+      _cpuTicksBaseNanoseconds = endNanoseconds;
+      _cpuTicksUsable = (_cpuTicksFrequency > 0);
+    }
+  }
+#elif defined(__aarch64__)
+  u64 frequency = 0;
+  __asm__ __volatile__ ("mrs %0, cntfrq_el0" : "=r" (frequency));
+  if (frequency > 0) {
+    _cpuTicksFrequency = frequency;
+    _cpuTicksBase = getCpuTicks();
+    _cpuTicksBaseNanoseconds = getMonotonicNanoseconds();
+    _cpuTicksUsable = true;
+  }
+#endif
+  
+  if (_cpuTicksUsable == false) {
+    // getCpuTicks can't be trusted as a clock.  getCpuTicksNanoseconds will
+    // read the monotonic clock instead.
+    _cpuTicksFrequency = 1000000000;
+  }
+  _cpuTicksMultiplier
+    = (((u64) 1000000000) << 32) / _cpuTicksFrequency;
+}
+
+/// @fn u64 getCpuTicksFrequency(void)
+///
+/// @brief Get the number of ticks per second counted by getCpuTicks.  The
+/// first call on x86 takes about 10 milliseconds to calibrate the TSC.
+///
+/// @return Returns the calibrated tick frequency in Hz.  If the counter can't
+/// be used as a clock, returns 1000000000.
+u64 getCpuTicksFrequency(void) {
+  call_once(&_cpuTicksSetup, cpuTicksCalibrate);
+  return _cpuTicksFrequency;
+}
+
+/// @fn i64 getCpuTicksNanoseconds(void)
+///
+/// @brief Get the monotonic time from the CPU's tick counter.  This costs a
+/// few nanoseconds instead of a clock_gettime call and shares its epoch with
+/// getMonotonicNanoseconds.  The first call on x86 takes about 10
+/// milliseconds to calibrate the TSC.
+///
+/// @return Returns the number of nanoseconds since the same point in the past
+/// used by getMonotonicNanoseconds.  If the tick counter can't be used as a
+/// clock, returns getMonotonicNanoseconds.
+i64 getCpuTicksNanoseconds(void) {
+  call_once(&_cpuTicksSetup, cpuTicksCalibrate);
+  if (_cpuTicksUsable == false) {
+    return getMonotonicNanoseconds();
+  }
+  
+  u64 ticks = getCpuTicks() - _cpuTicksBase;
+#ifdef __SIZEOF_INT128__
+  return _cpuTicksBaseNanoseconds
+    + (i64) ((((unsigned __int128) ticks) * _cpuTicksMultiplier) >> 32);
+#else
+  return _cpuTicksBaseNanoseconds
+    + (i64) ((ticks / _cpuTicksFrequency) * ((u64) 1000000000))
+    + (i64) (((ticks % _cpuTicksFrequency) * ((u64) 1000000000))
+      / _cpuTicksFrequency);
+#endif // __SIZEOF_INT128__
+}
+
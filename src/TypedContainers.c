@@ -0,0 +1,235 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @author            James Card
+/// @date              10.15.2026
+///
+/// @file              TypedContainers.c
+///
+/// @brief             This library contains the unit tests for the typed
+///                    container generators.
+///
+/// @details           The containers themselves are defined entirely in
+///                    TypedContainers.h so that they can be inlined where
+///                    they're used.
+///
+/// @copyright
+///                   Copyright (c) 2012-2024 James Card
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///                                James Card
+///                         http://www.jamescard.org
+///
+///////////////////////////////////////////////////////////////////////////////
+
+// Doxygen marker
+/// @file
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "TypedContainers.h"
+#include "LoggingLib.h"
+
+/// @fn static inline u64 typedContainersHashString(const char *key, u64 seed)
+///
+/// @brief Hash a C string for the string-keyed table in the unit test.
+///
+/// @param key The string to hash.
+/// @param seed The seed of the table.
+///
+/// @return Returns the hash of the string.
+static inline u64 typedContainersHashString(const char *key, u64 seed) {
+  u64 hash = 0xcbf29ce484222325ULL ^ seed;
+  for (; *key != '\0'; key++) {
+    hash = (hash ^ (u8) *key) * 0x100000001b3ULL;
+  }
+
+  return typedHashInteger(hash, seed);
+}
+
+/// @def TYPED_CONTAINERS_STRING_EQUALS
+///
+/// @brief Compare the keys of the string-keyed table in the unit test.
+#define TYPED_CONTAINERS_STRING_EQUALS(keyA, keyB) (strcmp(keyA, keyB) == 0)
+
+DEFINE_TYPED_HASH_TABLE(I64DoubleMap, i64DoubleMap, i64, double)
+DEFINE_TYPED_HASH_TABLE_WITH(StringI32Map, stringI32Map, const char*, i32,
+  typedContainersHashString, TYPED_CONTAINERS_STRING_EQUALS)
+DEFINE_TYPED_VECTOR(I64Vector, i64Vector, i64)
+
+/// @def TYPED_CONTAINERS_UNIT_TEST
+///
+/// @brief Unit tests for typed container functionality.
+/// @details Implementing this as a macro instead of raw code allows this to
+/// be skipped by the code coverage metrics.
+///
+/// @return Returns true on success, false on failure.
+#define TYPED_CONTAINERS_UNIT_TEST \
+bool typedContainersUnitTest() { \
+  I64DoubleMap *map = i64DoubleMapCreate(0); \
+  if ((map == NULL) || (map->capacity != TYPED_HASH_TABLE_MIN_CAPACITY)) { \
+    printLog(ERR, "Could not create typed hash table.\n"); \
+    return false; \
+  } \
+  \
+  /* Enough entries to force several resizes. */ \
+  for (i64 ii = 0; ii < 10000; ii++) { \
+    if (i64DoubleMapPut(map, ii, ((double) ii) / 2.0) == NULL) { \
+      printLog(ERR, "Could not put key %lld.\n", lld(ii)); \
+      return false; \
+    } \
+  } \
+  if ((map->size != 10000) \
+    || ((map->size * 100) > \
+      (map->capacity * TYPED_HASH_TABLE_MAX_LOAD_PERCENTAGE)) \
+  ) { \
+    printLog(ERR, "Typed hash table has size %llu and capacity %llu.\n", \
+      llu(map->size), llu(map->capacity)); \
+    return false; \
+  } \
+  for (i64 ii = 0; ii < 10000; ii++) { \
+    double *value = i64DoubleMapGet(map, ii); \
+    if ((value == NULL) || (*value != ((double) ii) / 2.0)) { \
+      printLog(ERR, "Wrong value for key %lld.\n", lld(ii)); \
+      return false; \
+    } \
+  } \
+  if (i64DoubleMapGet(map, 10000) != NULL) { \
+    printLog(ERR, "Found a key that was never put.\n"); \
+    return false; \
+  } \
+  \
+  /* Replacing a value doesn't add an entry. */ \
+  if ((i64DoubleMapPut(map, 7, -1.0) == NULL) || (map->size != 10000) \
+    || (*i64DoubleMapGet(map, 7) != -1.0) \
+  ) { \
+    printLog(ERR, "Replacing a value failed.\n"); \
+    return false; \
+  } \
+  \
+  /* Remove the even keys and make sure the odd ones survive the shifts. */ \
+  for (i64 ii = 0; ii < 10000; ii += 2) { \
+    if (i64DoubleMapRemove(map, ii) != 0) { \
+      printLog(ERR, "Could not remove key %lld.\n", lld(ii)); \
+      return false; \
+    } \
+  } \
+  if ((map->size != 5000) || (i64DoubleMapRemove(map, 0) != -1)) { \
+    printLog(ERR, "Typed hash table has wrong size after removes.\n"); \
+    return false; \
+  } \
+  for (i64 ii = 0; ii < 10000; ii++) { \
+    double *value = i64DoubleMapGet(map, ii); \
+    if ((ii & 1) != ((value != NULL) ? 1 : 0)) { \
+      printLog(ERR, "Wrong presence of key %lld after removes.\n", lld(ii)); \
+      return false; \
+    } \
+  } \
+  \
+  /* Iteration visits every entry exactly once. */ \
+  u64 count = 0; \
+  i64 sum = 0; \
+  for (I64DoubleMapEntry *entry = i64DoubleMapNext(map, NULL); \
+    entry != NULL; entry = i64DoubleMapNext(map, entry) \
+  ) { \
+    count++; \
+    sum += entry->key; \
+  } \
+  if ((count != 5000) || (sum != 25000000)) { \
+    printLog(ERR, "Iteration visited %llu entries with key sum %lld.\n", \
+      llu(count), lld(sum)); \
+    return false; \
+  } \
+  \
+  i64DoubleMapClear(map); \
+  if ((map->size != 0) || (i64DoubleMapNext(map, NULL) != NULL) \
+    || (i64DoubleMapGet(map, 1) != NULL) \
+  ) { \
+    printLog(ERR, "Clearing the typed hash table failed.\n"); \
+    return false; \
+  } \
+  map = i64DoubleMapDestroy(map); \
+  if ((map != NULL) || (i64DoubleMapGet(NULL, 1) != NULL) \
+    || (i64DoubleMapPut(NULL, 1, 1.0) != NULL) \
+  ) { \
+    printLog(ERR, "NULL typed hash table not handled.\n"); \
+    return false; \
+  } \
+  \
+  /* Custom hash and comparison. */ \
+  StringI32Map *stringMap = stringI32MapCreate(100); \
+  if ((stringMap == NULL) || (stringMap->capacity < 128)) { \
+    printLog(ERR, "Could not create presized typed hash table.\n"); \
+    return false; \
+  } \
+  char keyA[] = "alpha"; \
+  char keyB[] = "alpha"; \
+  stringI32MapPut(stringMap, keyA, 1); \
+  stringI32MapPut(stringMap, "beta", 2); \
+  stringI32MapPut(stringMap, keyB, 3); \
+  if ((stringMap->size != 2) || (*stringI32MapGet(stringMap, "alpha") != 3) \
+    || (*stringI32MapGet(stringMap, "beta") != 2) \
+  ) { \
+    printLog(ERR, "String keys not compared by value.\n"); \
+    return false; \
+  } \
+  stringMap = stringI32MapDestroy(stringMap); \
+  \
+  /* Vectors. */ \
+  I64Vector *vector = i64VectorCreate(0); \
+  if ((vector == NULL) || (i64VectorPop(vector, NULL) != -1) \
+    || (i64VectorAt(vector, 0) != NULL) \
+  ) { \
+    printLog(ERR, "Could not create empty typed vector.\n"); \
+    return false; \
+  } \
+  for (i64 ii = 0; ii < 1000; ii++) { \
+    if (i64VectorPush(vector, ii * ii) == NULL) { \
+      printLog(ERR, "Could not push %lld.\n", lld(ii)); \
+      return false; \
+    } \
+  } \
+  if ((vector->size != 1000) || (*i64VectorAt(vector, 30) != 900) \
+    || (i64VectorAt(vector, 1000) != NULL) \
+  ) { \
+    printLog(ERR, "Typed vector has wrong contents.\n"); \
+    return false; \
+  } \
+  i64 popped = 0; \
+  if ((i64VectorPop(vector, &popped) != 0) || (popped != 999 * 999) \
+    || (vector->size != 999) \
+  ) { \
+    printLog(ERR, "Popping from typed vector failed.\n"); \
+    return false; \
+  } \
+  i64VectorClear(vector); \
+  if ((vector->size != 0) || (i64VectorReserve(vector, 5000) != 0) \
+    || (vector->capacity < 5000) \
+  ) { \
+    printLog(ERR, "Clearing or reserving typed vector failed.\n"); \
+    return false; \
+  } \
+  vector = i64VectorDestroy(vector); \
+  \
+  return true; \
+}
+TYPED_CONTAINERS_UNIT_TEST
+
@@ -43,6 +43,11 @@
 #endif
 
 #include "StringLib.h"
+#include "ThreadPool.h"
+#include "LockStats.h"
+#ifndef _WIN32
+#include <unistd.h>
+#endif // _WIN32
 
 /// @fn Vector *vectorCreate_(TypeDescriptor *keyType, TypeDescriptor *valueType, bool disableThreadSafety, u64 size, ...)
 ///
@@ -78,7 +83,8 @@ Vector *vectorCreate_(TypeDescriptor *keyType, TypeDescriptor *valueType,
     return returnValue; // NULL
   }
   
-  returnValue = (Vector*) calloc(1, sizeof(Vector));
+  returnValue = (Vector*)
+    allocatorCalloc(ALLOCATOR_VECTOR, NULL, 1, sizeof(Vector));
   if (returnValue == NULL) {
     LOG_MALLOC_FAILURE();
     printLog(NEVER, "EXIT vectorCreate(keyType=%s, valueType=%s) = {%p}\n",
@@ -93,7 +99,8 @@ Vector *vectorCreate_(TypeDescriptor *keyType, TypeDescriptor *valueType,
   returnValue->valueType = valueType;
   if (disableThreadSafety == false) {
     // The lock mtx_t member variable has to be zeored, so use calloc.
-    returnValue->lock = (mtx_t*) calloc(1, sizeof(mtx_t));
+    returnValue->lock = (mtx_t*)
+      allocatorCalloc(ALLOCATOR_VECTOR, NULL, 1, sizeof(mtx_t));
     if (mtx_init(returnValue->lock, mtx_plain | mtx_recursive) != thrd_success) {
       printLog(ERR, "Could not initialize vector mutex lock.\n");
     }
@@ -105,10 +112,12 @@ Vector *vectorCreate_(TypeDescriptor *keyType, TypeDescriptor *valueType,
   }
   
   if (size > 0) {
-    VectorNode *array = (VectorNode*) malloc(size * sizeof(VectorNode));
+    VectorNode *array = (VectorNode*)
+      allocatorMalloc(ALLOCATOR_VECTOR, NULL, size * sizeof(VectorNode));
     if (array == NULL) {
       LOG_MALLOC_FAILURE();
-      returnValue = (Vector*) pointerDestroy(returnValue);
+      returnValue = (Vector*)
+        allocatorFree(ALLOCATOR_VECTOR, NULL, returnValue);
       printLog(NEVER, "EXIT vectorCreate(keyType=%s, valueType=%s) = {%p}\n",
         (keyType != NULL) ? keyType->name : "NULL",
         (valueType != NULL) ? valueType->name : "NULL",
@@ -126,10 +135,11 @@ Vector *vectorCreate_(TypeDescriptor *keyType, TypeDescriptor *valueType,
         elementSize = valueType->size(VOID_POINTER_TRUE);
       }
       
-      data = (char*) malloc(size * elementSize);
+      data = (char*)
+        allocatorMalloc(ALLOCATOR_VECTOR, valueType, size * elementSize);
       if (data == NULL) {
         LOG_MALLOC_FAILURE();
-        array = (VectorNode*) pointerDestroy(array);
+        array = (VectorNode*) allocatorFree(ALLOCATOR_VECTOR, NULL, array);
         printLog(NEVER, "EXIT vectorCreate(keyType=%s) = {%p}\n",
           keyType->name, returnValue);
         return NULL;
@@ -273,7 +283,8 @@ VectorNode *kvVectorSetEntry_(Vector *vector, u64 index,
     // initialize all the node pointers.
     vector->valueType = type;
     
-    char *data = (char*) malloc(vector->arraySize * elementSize);
+    char *data = (char*) allocatorMalloc(ALLOCATOR_VECTOR, vector->valueType,
+      vector->arraySize * elementSize);
     if (data == NULL) {
       LOG_MALLOC_FAILURE();
       
@@ -302,7 +313,7 @@ VectorNode *kvVectorSetEntry_(Vector *vector, u64 index,
     u64 newSize = (index + 1) << 1;
     printLog(DEBUG, "Allocating new array of size %llu.\n", llu(newSize));
     printLog(DEBUG, "Old size was %llu.\n", llu(vector->arraySize));
-    VectorNode *array = (VectorNode*) realloc(
+    VectorNode *array = (VectorNode*) allocatorRealloc(ALLOCATOR_VECTOR, NULL,
       vector->array, newSize * sizeof(VectorNode));
     if (array == NULL) {
       LOG_MALLOC_FAILURE();
@@ -317,7 +328,8 @@ VectorNode *kvVectorSetEntry_(Vector *vector, u64 index,
       return NULL;
     }
     
-    char *data = (char*) realloc(vector->data, newSize * elementSize);
+    char *data = (char*) allocatorRealloc(ALLOCATOR_VECTOR, vector->valueType,
+      vector->data, newSize * elementSize);
     if (data == NULL) {
       vector->array = array;
       LOG_MALLOC_FAILURE();
@@ -533,6 +545,134 @@ void* vectorGetValue(Vector *vector, u64 index) {
   return returnValue;
 }
 
+/// @fn void* vectorData(Vector *vector, TypeDescriptor *type)
+///
+/// @brief Get the contiguous array of raw values that backs a Vector of a
+/// primitive type.  Element ii of the array is the value at index ii of the
+/// vector, so a loop over the array touches nothing but the values and can be
+/// vectorized by the compiler.
+///
+/// @param vector A pointer to a previously-created Vector object.
+/// @param type The type the caller expects the values to be.  This must be
+///   the value type of the vector and must not be a pointer type.
+///
+/// @note The array is owned by the vector and is only valid until the next
+/// call that adds to, removes from, sorts, or destroys the vector.  Elements
+/// at indexes that have never been set read as zero.
+///
+/// @return Returns a pointer to the first element of the array on success,
+/// NULL if the vector has no storage or does not hold values of type.
+void* vectorData(Vector *vector, TypeDescriptor *type) {
+  printLog(TRACE, "ENTER vectorData(vector=%p, type=%s)\n",
+    vector, (type != NULL) ? type->name : "NULL");
+  
+  void *returnValue = NULL;
+  if ((vector != NULL) && (type != NULL) && (vector->valueType == type)
+    && (type->dataIsPointer == false)
+  ) {
+    returnValue = vector->data;
+  }
+  
+  printLog(TRACE, "EXIT vectorData(vector=%p, type=%s) = {%p}\n",
+    vector, (type != NULL) ? type->name : "NULL", returnValue);
+  return returnValue;
+}
+
+/// @fn i32 vectorSetRange(Vector *vector, u64 index, const volatile void *values, u64 count, TypeDescriptor *type)
+///
+/// @brief Set a run of consecutive indexes of a Vector of a primitive type
+/// from a contiguous array of raw values.  This is equivalent to calling
+/// vectorSetEntry once per value, but copies the values with a single memcpy
+/// and grows the vector at most once.
+///
+/// @param vector The vector to modify.
+/// @param index The index of the vector to set values[0] at.
+/// @param values The array of count raw values of type.
+/// @param count The number of values to set.
+/// @param type The type of the values.  This must not be a pointer type and
+///   must match the vector's value type, if it has one.
+///
+/// @note Any keys held at the affected indexes are destroyed.
+///
+/// @return Returns 0 on success, -1 on failure.
+i32 vectorSetRange(Vector *vector, u64 index, const volatile void *values,
+  u64 count, TypeDescriptor *type
+) {
+  printLog(TRACE,
+    "ENTER vectorSetRange(vector=%p, index=%llu, values=%p, count=%llu, "
+    "type=%s)\n", vector, llu(index), values, llu(count),
+    (type != NULL) ? type->name : "NULL");
+  
+  i32 returnValue = -1;
+  if ((vector == NULL) || (type == NULL) || ((values == NULL) && (count > 0))) {
+    printLog(ERR, "vector, type, or values is NULL.\n");
+    printLog(TRACE,
+      "EXIT vectorSetRange(vector=%p, index=%llu, values=%p, count=%llu, "
+      "type=%s) = {%d}\n", vector, llu(index), values, llu(count),
+      (type != NULL) ? type->name : "NULL", returnValue);
+    return returnValue;
+  } else if ((type->dataIsPointer == true)
+    || ((vector->valueType != NULL) && (vector->valueType != type))
+  ) {
+    printLog(ERR, "Cannot set a range of %s values in a vector of %s.\n",
+      type->name,
+      (vector->valueType != NULL) ? vector->valueType->name : "NULL");
+    printLog(TRACE,
+      "EXIT vectorSetRange(vector=%p, index=%llu, values=%p, count=%llu, "
+      "type=%s) = {%d}\n", vector, llu(index), values, llu(count),
+      type->name, returnValue);
+    return returnValue;
+  } else if (count == 0) {
+    returnValue = 0;
+    printLog(TRACE,
+      "EXIT vectorSetRange(vector=%p, index=%llu, values=%p, count=%llu, "
+      "type=%s) = {%d}\n", vector, llu(index), values, llu(count),
+      type->name, returnValue);
+    return returnValue;
+  }
+  
+  // Need to provide a non-NULL value to type->size().
+  size_t elementSize = type->size(VOID_POINTER_TRUE);
+  const char *source = (const char*) values;
+  
+  if ((vector->lock != NULL) && (mtx_lock(vector->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock vector mutex.\n");
+  }
+  
+  // Setting the last value first grows the storage, sets the value type if
+  // this is the first set, and updates the size, all in one step.
+  u64 last = index + count - 1;
+  if (kvVectorSetEntry_(vector, last, NULL,
+    source + ((count - 1) * elementSize), type) != NULL
+  ) {
+    VectorNode *array = vector->array;
+    TypeDescriptor *keyType = vector->keyType;
+    memcpy((char*) vector->data + (index * elementSize), (void*) source,
+      (count - 1) * elementSize);
+    for (u64 ii = index; ii < last; ii++) {
+      if (array[ii].allocated == true) {
+        array[ii].key = keyType->destroy(array[ii].key);
+      } else {
+        array[ii].key = NULL;
+      }
+      array[ii].type = type;
+      array[ii].byteOffset = 0;
+      array[ii].allocated = true;
+    }
+    returnValue = 0;
+  }
+  
+  if (vector->lock != NULL) {
+    mtx_unlock(vector->lock);
+  }
+  
+  printLog(TRACE,
+    "EXIT vectorSetRange(vector=%p, index=%llu, values=%p, count=%llu, "
+    "type=%s) = {%d}\n", vector, llu(index), values, llu(count),
+    type->name, returnValue);
+  return returnValue;
+}
+
 /// @fn VectorNode* kvVectorGetEntry(Vector *vector, const volatile void *key)
 ///
 /// @brief Get a node from a Vector given its key.  This performs a linear
@@ -824,11 +964,13 @@ Vector* vectorDestroy(Vector *vector) {
   if (vector->lock != NULL) {
     mtx_destroy(vector->lock);
   }
-  vector->lock = (mtx_t*) pointerDestroy(vector->lock);
-  vector->array = (VectorNode*) pointerDestroy(vector->array);
-  vector->data = pointerDestroy(vector->data);
+  vector->lock = (mtx_t*) allocatorFree(ALLOCATOR_VECTOR, NULL, vector->lock);
+  vector->array = (VectorNode*)
+    allocatorFree(ALLOCATOR_VECTOR, NULL, vector->array);
+  vector->data
+    = allocatorFree(ALLOCATOR_VECTOR, vector->valueType, vector->data);
   
-  vector = (Vector*) pointerDestroy(vector);
+  vector = (Vector*) allocatorFree(ALLOCATOR_VECTOR, NULL, vector);
   
   printLog(TRACE, "EXIT vectorDestroy(vector=%p) = {%p}\n",
     vector, returnValue);
@@ -855,6 +997,244 @@ Bytes vectorToXml_(const Vector *vector, const char *elementName, bool indent, .
   return returnValue;
 }
 
+/// @def VECTOR_PARALLEL_MIN_CHUNK
+///
+/// @brief The fewest nodes worth giving a thread of their own in a parallel
+/// Vector operation.  Smaller vectors use fewer threads.
+#define VECTOR_PARALLEL_MIN_CHUNK 16384
+
+/// @typedef VectorTaskFunction
+///
+/// @brief Function that does one of the numTasks equal shares of a parallel
+/// Vector operation.
+typedef void (*VectorTaskFunction)(void *job, u64 task, u64 numTasks);
+
+/// @struct VectorTaskRange
+///
+/// @brief The context passed to vectorRunRange.
+///
+/// @param function The function that does each task.
+/// @param job The job to pass to function.
+/// @param numTasks The total number of tasks.
+typedef struct VectorTaskRange {
+  VectorTaskFunction function;
+  void *job;
+  u64 numTasks;
+} VectorTaskRange;
+
+/// @fn static void vectorRunRange(u64 begin, u64 end, void *context)
+///
+/// @brief ParallelForFunction that runs tasks [begin, end) of a parallel
+/// operation.
+///
+/// @param begin The first task to run.
+/// @param end One past the last task to run.
+/// @param context The VectorTaskRange of the operation.
+///
+/// @return This function returns no value.
+static void vectorRunRange(u64 begin, u64 end, void *context) {
+  VectorTaskRange *taskRange = (VectorTaskRange*) context;
+  for (u64 task = begin; task < end; task++) {
+    taskRange->function(taskRange->job, task, taskRange->numTasks);
+  }
+}
+
+/// @fn static void vectorRunTasks(VectorTaskFunction function, void *job, u64 numTasks)
+///
+/// @brief Run every task of a parallel operation and wait for them all to
+/// finish.  The tasks are spread across the calling thread and the default
+/// ThreadPool, so no threads are started or stopped here.  If the pool is
+/// not available, the tasks are run on the calling thread.
+///
+/// @param function The function that does each task.
+/// @param job The job to pass to function.
+/// @param numTasks The number of tasks to run.
+///
+/// @return This function returns no value.
+static void vectorRunTasks(VectorTaskFunction function, void *job,
+  u64 numTasks
+) {
+  VectorTaskRange taskRange = {
+    .function = function,
+    .job = job,
+    .numTasks = numTasks,
+  };
+  parallelFor(threadPoolGetDefault(), 0, numTasks, 1, vectorRunRange,
+    &taskRange);
+}
+
+/// @fn static u64 vectorNumTasks(u32 numThreads, u64 numNodes)
+///
+/// @brief Decide how many threads a parallel Vector operation should use.
+///
+/// @param numThreads The number of threads requested.  0 means one per
+///   online CPU.
+/// @param numNodes The number of nodes the operation covers.
+///
+/// @return Returns the number of threads to use, at least 1.
+static u64 vectorNumTasks(u32 numThreads, u64 numNodes) {
+  u64 numTasks = numThreads;
+  if (numTasks == 0) {
+#ifdef _WIN32
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    numTasks = systemInfo.dwNumberOfProcessors;
+#else
+    long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    numTasks = (numCpus > 0) ? (u64) numCpus : 1;
+#endif // _WIN32
+  }
+  
+  u64 maxTasks = numNodes / VECTOR_PARALLEL_MIN_CHUNK;
+  if (numTasks > maxTasks) {
+    numTasks = maxTasks;
+  }
+  
+  return (numTasks > 0) ? numTasks : 1;
+}
+
+/// @fn static inline u64 vectorTaskStart(u64 size, u64 task, u64 numTasks)
+///
+/// @brief Get the first index of a task's share of a range.  Shares differ in
+/// size by at most one.
+///
+/// @param size The number of items in the range.
+/// @param task The task number.  numTasks gives the end of the last share.
+/// @param numTasks The number of tasks sharing the range.
+///
+/// @return Returns the index of the first item in the task's share.
+static inline u64 vectorTaskStart(u64 size, u64 task, u64 numTasks) {
+  u64 remainder = size % numTasks;
+  return ((size / numTasks) * task)
+    + ((task < remainder) ? task : remainder);
+}
+
+/// @struct VectorCompareJob
+///
+/// @brief The parameters of a vectorCompareParallel call.
+///
+/// @param vectorA The Vector on the left of the inequality.
+/// @param vectorB The Vector on the right of the inequality.
+/// @param results The result of the first differing pair of nodes in each
+///   task's share, 0 if there was none.
+typedef struct VectorCompareJob {
+  Vector *vectorA;
+  Vector *vectorB;
+  int *results;
+} VectorCompareJob;
+
+/// @fn static void vectorCompareTask(void *job, u64 task, u64 numTasks)
+///
+/// @brief Compare one share of the nodes of two Vectors the same way
+/// listCompare does.
+///
+/// @param job The VectorCompareJob.
+/// @param task The task number.
+/// @param numTasks The number of tasks.
+///
+/// @return This function returns no value.
+static void vectorCompareTask(void *job, u64 task, u64 numTasks) {
+  VectorCompareJob *compareJob = (VectorCompareJob*) job;
+  VectorNode *arrayA = compareJob->vectorA->array;
+  VectorNode *arrayB = compareJob->vectorB->array;
+  u64 size = compareJob->vectorA->size;
+  u64 end = vectorTaskStart(size, task + 1, numTasks);
+  int returnValue = 0;
+  
+  for (u64 ii = vectorTaskStart(size, task, numTasks);
+    (returnValue == 0) && (ii < end); ii++
+  ) {
+    VectorNode *nodeA = &arrayA[ii];
+    VectorNode *nodeB = &arrayB[ii];
+    if ((nodeA->allocated == false) || (nodeB->allocated == false)) {
+      // An empty slot sorts before any value.
+      returnValue = ((int) nodeA->allocated) - ((int) nodeB->allocated);
+    } else if (nodeA->type != nodeB->type) {
+      returnValue = getIndexFromTypeDescriptor(nodeA->type)
+        - getIndexFromTypeDescriptor(nodeB->type);
+      if (returnValue == 0) {
+        // Two unknown types.  Use the value of strcmp on the names.
+        returnValue = strcmp(nodeA->type->name, nodeB->type->name);
+      }
+    } else {
+      returnValue = nodeA->type->compare(nodeA->value, nodeB->value);
+    }
+  }
+  
+  compareJob->results[task] = returnValue;
+}
+
+/// @fn int vectorCompareParallel(Vector *vectorA, Vector *vectorB, u32 numThreads)
+///
+/// @brief Compare the contents of two Vectors, splitting the work across
+/// threads.  The result is the same as vectorCompare's.
+///
+/// @param vectorA The Vector on the left of the inequality.
+/// @param vectorB The Vector on the right of the inequality.
+/// @param numThreads The number of threads to use.  0 means one per online
+///   CPU.  Fewer are used for small vectors.
+///
+/// @return Returns 0 if the two Vectors evaluate as equal, <0 if vectorA
+/// evaluates as being logically less than vectorB, >0 if vectorA evaluates as
+/// being logically greater than vectorB.
+int vectorCompareParallel(Vector *vectorA, Vector *vectorB, u32 numThreads) {
+  printLog(TRACE,
+    "ENTER vectorCompareParallel(vectorA=%p, vectorB=%p, numThreads=%u)\n",
+    vectorA, vectorB, numThreads);
+  
+  int returnValue = 0;
+  u64 numTasks = 1;
+  if ((vectorA != NULL) && (vectorB != NULL)
+    && (vectorA->keyType == vectorB->keyType)
+    && (vectorA->size == vectorB->size)
+  ) {
+    numTasks = vectorNumTasks(numThreads, vectorA->size);
+  }
+  
+  int *results = NULL;
+  if (numTasks > 1) {
+    results = (int*) calloc(numTasks, sizeof(int));
+    if (results == NULL) {
+      LOG_MALLOC_FAILURE();
+    }
+  }
+  if (results == NULL) {
+    // Mismatched types or sizes, a small vector, or one thread.  listCompare
+    // handles all of those.
+    returnValue = listCompare((List*) vectorA, (List*) vectorB);
+    printLog(TRACE,
+      "EXIT vectorCompareParallel(vectorA=%p, vectorB=%p, numThreads=%u) "
+      "= {%d}\n", vectorA, vectorB, numThreads, returnValue);
+    return returnValue;
+  }
+  
+  if ((vectorA->lock != NULL) && (mtx_lock(vectorA->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock vectorA mutex.\n");
+  }
+  if ((vectorB->lock != NULL) && (mtx_lock(vectorB->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock vectorB mutex.\n");
+  }
+  
+  VectorCompareJob job = { vectorA, vectorB, results };
+  vectorRunTasks(vectorCompareTask, &job, numTasks);
+  for (u64 task = 0; (returnValue == 0) && (task < numTasks); task++) {
+    returnValue = results[task];
+  }
+  free(results);
+  
+  if (vectorA->lock != NULL) {
+    mtx_unlock(vectorA->lock);
+  }
+  if (vectorB->lock != NULL) {
+    mtx_unlock(vectorB->lock);
+  }
+  
+  printLog(TRACE,
+    "EXIT vectorCompareParallel(vectorA=%p, vectorB=%p, numThreads=%u) "
+    "= {%d}\n", vectorA, vectorB, numThreads, returnValue);
+  return returnValue;
+}
+
 /// @fn int vectorCompare(Vector *vectorA, Vector *vectorB)
 ///
 /// @brief Compare the contents of two Vectors.
@@ -874,19 +1254,79 @@ int vectorCompare(Vector *vectorA, Vector *vectorB) {
   return returnValue;
 }
 
-/// @fn Vector *vectorCopy(Vector *vector)
+/// @struct VectorCopyJob
 ///
-/// @brief Create a copy of a previously-allocated Vector.
+/// @brief The parameters of a vectorCopyParallel call.
+///
+/// @param source The Vector being copied.
+/// @param destination The Vector being filled.
+/// @param elementSize The size of one element of the data arrays.
+typedef struct VectorCopyJob {
+  Vector *source;
+  Vector *destination;
+  size_t elementSize;
+} VectorCopyJob;
+
+/// @fn static void vectorCopyTask(void *job, u64 task, u64 numTasks)
+///
+/// @brief Copy one share of the nodes of a Vector into a new Vector the same
+/// way kvVectorSetEntry does.
+///
+/// @param job The VectorCopyJob.
+/// @param task The task number.
+/// @param numTasks The number of tasks.
+///
+/// @return This function returns no value.
+static void vectorCopyTask(void *job, u64 task, u64 numTasks) {
+  VectorCopyJob *copyJob = (VectorCopyJob*) job;
+  VectorNode *sourceArray = copyJob->source->array;
+  VectorNode *destinationArray = copyJob->destination->array;
+  char *data = (char*) copyJob->destination->data;
+  TypeDescriptor *keyType = copyJob->destination->keyType;
+  bool dataIsPointer = copyJob->destination->valueType->dataIsPointer;
+  size_t elementSize = copyJob->elementSize;
+  u64 size = copyJob->source->size;
+  u64 end = vectorTaskStart(size, task + 1, numTasks);
+  
+  for (u64 ii = vectorTaskStart(size, task, numTasks); ii < end; ii++) {
+    VectorNode *source = &sourceArray[ii];
+    if (source->allocated == false) {
+      continue;
+    }
+    
+    VectorNode *destination = &destinationArray[ii];
+    if (dataIsPointer == false) {
+      memcpy((void*) destination->value, (void*) source->value, elementSize);
+    } else {
+      destination->value = source->type->copy(source->value);
+      memcpy(data + (ii * elementSize), &destination->value, elementSize);
+    }
+    destination->type = source->type;
+    destination->key = keyType->copy(source->key);
+    destination->byteOffset = 0;
+    destination->allocated = true;
+  }
+}
+
+/// @fn Vector *vectorCopyParallel(Vector *vector, u32 numThreads)
+///
+/// @brief Create a copy of a previously-allocated Vector, splitting the work
+/// across threads.
 ///
 /// @param vector The Vector to copy.
+/// @param numThreads The number of threads to use.  0 means one per online
+///   CPU.  Fewer are used for small vectors.
 ///
 /// @return Returns a pointer to a new Vector, which is a copy of the provided
 /// Vector, on success, NULL on failure.
-Vector *vectorCopy(Vector *vector) {
-  printLog(TRACE, "ENTER vectorCopy(vector=%p)\n", vector);
+Vector *vectorCopyParallel(Vector *vector, u32 numThreads) {
+  printLog(TRACE, "ENTER vectorCopyParallel(vector=%p, numThreads=%u)\n",
+    vector, numThreads);
   if (vector == NULL) {
     printLog(ERR, "vector is NULL\n");
-    printLog(TRACE, "EXIT vectorCopy(vector=%p) = {NULL}\n", vector);
+    printLog(TRACE,
+      "EXIT vectorCopyParallel(vector=%p, numThreads=%u) = {NULL}\n",
+      vector, numThreads);
     return NULL;
   }
   
@@ -894,155 +1334,740 @@ Vector *vectorCopy(Vector *vector) {
     (vector->lock == NULL), vector->arraySize);
   if (returnValue == NULL) {
     LOG_MALLOC_FAILURE();
-    printLog(NEVER, "EXIT vectorCopy(vector=%p) = {%p}\n", vector, returnValue);
+    printLog(NEVER,
+      "EXIT vectorCopyParallel(vector=%p, numThreads=%u) = {%p}\n",
+      vector, numThreads, returnValue);
     return returnValue; // NULL
   }
   
-  VectorNode *array = vector->array;
-  u64 arraySize = vector->arraySize;
-  for (u64 ii = 0; ii < arraySize; ii++) {
-    if (array[ii].allocated == false) {
-      continue;
+  if ((vector->lock != NULL) && (mtx_lock(vector->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock vector mutex.\n");
+  }
+  
+  u64 numTasks = 1;
+  if (vector->valueType != NULL) {
+    numTasks = vectorNumTasks(numThreads, vector->size);
+  }
+  
+  if (numTasks > 1) {
+    VectorCopyJob job = {
+      vector, returnValue, sizeof(void*)
+    };
+    if (vector->valueType->dataIsPointer == false) {
+      // Need to provide a non-NULL value to size().
+      job.elementSize = vector->valueType->size(VOID_POINTER_TRUE);
     }
+    vectorRunTasks(vectorCopyTask, &job, numTasks);
     
-    if (kvVectorSetEntry_(returnValue, ii,
-      array[ii].key, array[ii].value, array[ii].type) == NULL
-    ) {
-      printLog(ERR, "Could not set element %llu of return value vector.\n",
-        llu(ii));
-      returnValue = vectorDestroy(returnValue);
-      printLog(TRACE, "EXIT vectorCopy(vector=%p) = {%p}\n", vector, returnValue);
-      return returnValue; // NULL
+    if (vector->size > 0) {
+      returnValue->size = vector->size;
+      returnValue->head = &returnValue->array[0];
+      returnValue->tail = &returnValue->array[returnValue->size - 1];
+    }
+  } else {
+    VectorNode *array = vector->array;
+    u64 arraySize = vector->arraySize;
+    for (u64 ii = 0; ii < arraySize; ii++) {
+      if (array[ii].allocated == false) {
+        continue;
+      }
+      
+      if (kvVectorSetEntry_(returnValue, ii,
+        array[ii].key, array[ii].value, array[ii].type) == NULL
+      ) {
+        printLog(ERR, "Could not set element %llu of return value vector.\n",
+          llu(ii));
+        returnValue = vectorDestroy(returnValue);
+        break;
+      }
     }
   }
   
+  if (vector->lock != NULL) {
+    mtx_unlock(vector->lock);
+  }
+  
+  printLog(TRACE, "EXIT vectorCopyParallel(vector=%p, numThreads=%u) = {%p}\n",
+    vector, numThreads, returnValue);
+  return returnValue;
+}
+
+/// @fn Vector *vectorCopy(Vector *vector)
+///
+/// @brief Create a copy of a previously-allocated Vector.
+///
+/// @param vector The Vector to copy.
+///
+/// @return Returns a pointer to a new Vector, which is a copy of the provided
+/// Vector, on success, NULL on failure.
+Vector *vectorCopy(Vector *vector) {
+  printLog(TRACE, "ENTER vectorCopy(vector=%p)\n", vector);
+  
+  Vector *returnValue = vectorCopyParallel(vector, 1);
+  
   printLog(TRACE, "EXIT vectorCopy(vector=%p) = {%p}\n", vector, returnValue);
   return returnValue;
 }
 
-/// @var _sortType
+/// @enum VectorRadixKind
 ///
-/// @brief The thread-specific storage that holds a pointer to a TypeDescriptor
-/// that describes the keys of a vector for a sort operation.
-static ZEROINIT(tss_t _sortType);
+/// @brief The kinds of primitive values vectorSort can sort with a radix sort
+/// instead of comparisons.
+typedef enum VectorRadixKind {
+  VECTOR_RADIX_NONE = 0,
+  VECTOR_RADIX_BOOL,
+  VECTOR_RADIX_U8,
+  VECTOR_RADIX_U16,
+  VECTOR_RADIX_U32,
+  VECTOR_RADIX_U64,
+  VECTOR_RADIX_I8,
+  VECTOR_RADIX_I16,
+  VECTOR_RADIX_I32,
+  VECTOR_RADIX_I64,
+  VECTOR_RADIX_FLOAT,
+  VECTOR_RADIX_DOUBLE,
+} VectorRadixKind;
 
-/// @var _sortOrder
-/// @brief The thread-specific storage holding the order to sort in.
-/// 1 = Ascending, -1 = Descending.
-static ZEROINIT(tss_t _sortOrder);
+/// @struct VectorSortContext
+///
+/// @brief The parameters of a vectorSort call that every comparison needs.
+/// This is passed down the sort explicitly so that sorts on different threads
+/// never share state.
+///
+/// @param compare The compare function of the type being sorted.
+/// @param order The sort order to use.  1 = Ascending, -1 = Descending.
+/// @param sortValues Whether to sort by the values (true) or keys (false) of
+///   the nodes.
+typedef struct VectorSortContext {
+  int (*compare)(const volatile void *valueA, const volatile void *valueB);
+  i32 order;
+  bool sortValues;
+} VectorSortContext;
 
-/// @var _sortValues
-/// @brief The thread-specific storage holding whether or not to sort values.
-/// This holds a boolean of true or false.
-static ZEROINIT(tss_t _sortValues);
+/// @struct VectorRadixEntry
+///
+/// @brief One node of a Vector being radix sorted.
+///
+/// @param key The node's sort field mapped to an unsigned integer that sorts
+///   in the desired order.
+/// @param index The index of the node in the vector's array before the sort.
+typedef struct VectorRadixEntry {
+  u64 key;
+  u64 index;
+} VectorRadixEntry;
 
-/// @var _sortMetadataSetup
+/// @def VECTOR_INSERTION_SORT_SIZE
 ///
-/// @brief A once_flag variable to guarantee that setupVectorSortMetadata is only
-/// called once per program execution.
-static once_flag _sortMetadataSetup = ONCE_FLAG_INIT;
+/// @brief The size at or below which vectorIntroSort switches to an insertion
+/// sort.
+#define VECTOR_INSERTION_SORT_SIZE 16
 
-/// @fn void setupVectorSortMetadata(void)
+/// @fn static VectorRadixKind vectorRadixKind(TypeDescriptor *type)
 ///
-/// @brief Setup the thread-specific storage for the sort operation variables.
+/// @brief Determine whether or not the values of a type can be radix sorted.
+/// NoCopy types share a compare function with their copying types, so the
+/// compare function is what's checked.
 ///
-/// @return This function returns no value.
-void setupVectorSortMetadata(void) {
-  int status = tss_create(&_sortType, NULL);
-  if (status != thrd_success) {
-    fprintf(stderr, "Could not initialze _sortType thread-specific storage.\n");
-  }
-  
-  status = tss_create(&_sortOrder, NULL);
-  if (status != thrd_success) {
-    fprintf(stderr,
-      "Could not initialze _sortOrder thread-specific storage.\n");
+/// @param type The TypeDescriptor of the values to sort.
+///
+/// @return Returns the VectorRadixKind for the type, VECTOR_RADIX_NONE if the
+/// type must be sorted with its compare function.
+static VectorRadixKind vectorRadixKind(TypeDescriptor *type) {
+  if (type->compare == typeBool->compare) {
+    return VECTOR_RADIX_BOOL;
+  } else if (type->compare == typeU8->compare) {
+    return VECTOR_RADIX_U8;
+  } else if (type->compare == typeU16->compare) {
+    return VECTOR_RADIX_U16;
+  } else if (type->compare == typeU32->compare) {
+    return VECTOR_RADIX_U32;
+  } else if (type->compare == typeU64->compare) {
+    return VECTOR_RADIX_U64;
+  } else if (type->compare == typeI8->compare) {
+    return VECTOR_RADIX_I8;
+  } else if (type->compare == typeI16->compare) {
+    return VECTOR_RADIX_I16;
+  } else if (type->compare == typeI32->compare) {
+    return VECTOR_RADIX_I32;
+  } else if (type->compare == typeI64->compare) {
+    return VECTOR_RADIX_I64;
+  } else if (type->compare == typeFloat->compare) {
+    return VECTOR_RADIX_FLOAT;
+  } else if (type->compare == typeDouble->compare) {
+    return VECTOR_RADIX_DOUBLE;
   }
   
-  status = tss_create(&_sortValues, NULL);
-  if (status != thrd_success) {
-    fprintf(stderr,
-      "Could not initialze _sortValues thread-specific storage.\n");
-  }
+  return VECTOR_RADIX_NONE;
 }
 
-/// @fn int vectorNodeCompare(const void *nodeAPointer, const void *nodeBPointer)
+/// @fn static inline u64 vectorRadixKey(VectorRadixKind kind, const volatile void *value)
 ///
-/// @brief Compare two values in a vector.
+/// @brief Map a primitive value to an unsigned integer with the same
+/// ordering.  Signed integers have their sign bit flipped.  Floating point
+/// values have their sign bit flipped if positive or all their bits flipped
+/// if negative.
+///
+/// @param kind The kind of value.
+/// @param value A pointer to the value.
+///
+/// @return Returns the mapped value.
+static inline u64 vectorRadixKey(VectorRadixKind kind,
+  const volatile void *value
+) {
+  switch (kind) {
+    case VECTOR_RADIX_BOOL:
+      return *((bool*) value);
+    case VECTOR_RADIX_U8:
+      return *((u8*) value);
+    case VECTOR_RADIX_U16:
+      return *((u16*) value);
+    case VECTOR_RADIX_U32:
+      return *((u32*) value);
+    case VECTOR_RADIX_U64:
+      return *((u64*) value);
+    case VECTOR_RADIX_I8:
+      return ((u64) *((i8*) value)) ^ (((u64) 1) << 63);
+    case VECTOR_RADIX_I16:
+      return ((u64) *((i16*) value)) ^ (((u64) 1) << 63);
+    case VECTOR_RADIX_I32:
+      return ((u64) *((i32*) value)) ^ (((u64) 1) << 63);
+    case VECTOR_RADIX_I64:
+      return ((u64) *((i64*) value)) ^ (((u64) 1) << 63);
+    case VECTOR_RADIX_FLOAT:
+      {
+        u32 bits = 0;
+        memcpy(&bits, (void*) value, sizeof(bits));
+        bits ^= ((bits >> 31) != 0) ? 0xffffffff : 0x80000000;
+        return bits;
+      }
+    case VECTOR_RADIX_DOUBLE:
+      {
+        u64 bits = 0;
+        memcpy(&bits, (void*) value, sizeof(bits));
+        bits ^= ((bits >> 63) != 0) ? ~((u64) 0) : (((u64) 1) << 63);
+        return bits;
+      }
+    default:
+      return 0;
+  }
+}
+
+/// @fn static bool vectorRadixSort(VectorNode *array, u64 size, VectorRadixKind kind, const VectorSortContext *context)
 ///
-/// @note This has to be passed to qsort as its __compar_fn_t parameter, so the
-/// function signature is dictated by that typedef.
+/// @brief Sort an array of VectorNodes whose sort fields are primitive values
+/// with an LSD radix sort on their mapped values.  Byte positions where every
+/// value is the same are skipped.  Nodes without a value sort before all
+/// others, the same as in the types' compare functions.
 ///
-/// @param nodeAPointer A pointer to a node in a vector.
-/// @param nodeBPointer A pointer to a node in the same vector as nodeAPointer.
+/// @param array The array of VectorNodes to sort.
+/// @param size The number of nodes in the array.
+/// @param kind The kind of value being sorted.
+/// @param context The parameters of the sort.
 ///
-/// @return If sortOrder is 1, returns a value less than 0 if nodeAPointer is less
-/// than nodeBPointer, 0 if nodeBPointer is equal to nodeBPointer, a value greater than 0 if
-/// nodeAPointer is greater than nodeBPointer.  If sortOrder is -1, the return values
-/// are inverted.
-int vectorNodeCompare(const void *nodeAPointer, const void *nodeBPointer) {
-  printLog(FLOOD, "ENTER vectorNodeCompare(nodeAPointer=%p, nodeBPointer=%p)\n",
-    nodeAPointer, nodeBPointer);
-  VectorNode *nodeA = (VectorNode*) nodeAPointer;
-  VectorNode *nodeB = (VectorNode*) nodeBPointer;
+/// @return Returns true on success, false if memory could not be allocated.
+/// The array is unmodified on failure.
+static bool vectorRadixSort(VectorNode *array, u64 size, VectorRadixKind kind,
+  const VectorSortContext *context
+) {
+  VectorRadixEntry *buffer
+    = (VectorRadixEntry*) malloc(2 * size * sizeof(VectorRadixEntry));
+  u64 *counts = (u64*) calloc(8 * 256, sizeof(u64));
+  u64 *sources = (u64*) malloc(size * sizeof(u64));
+  if ((buffer == NULL) || (counts == NULL) || (sources == NULL)) {
+    LOG_MALLOC_FAILURE();
+    free(buffer); free(counts); free(sources);
+    return false;
+  }
+  VectorRadixEntry *entries = buffer;
+  VectorRadixEntry *scratch = &buffer[size];
   
-  TypeDescriptor *sortType = (TypeDescriptor*) tss_get(_sortType);
-  i32 *sortOrder = (i32*) tss_get(_sortOrder);
-  bool *sortValues = (bool*) tss_get(_sortValues);
-  int returnValue = 0;
+  // Nodes without values are kept out of the radix sort.  They go at the
+  // front of an ascending sort and at the back of a descending one.
+  u64 numEntries = 0, numNull = 0;
+  u64 flip = (context->order == DESCENDING) ? ~((u64) 0) : 0;
+  for (u64 ii = 0; ii < size; ii++) {
+    const volatile void *value = (context->sortValues == true)
+      ? array[ii].value : array[ii].key;
+    if (value == NULL) {
+      sources[numNull++] = ii;
+      continue;
+    }
+    u64 key = vectorRadixKey(kind, value) ^ flip;
+    entries[numEntries].key = key;
+    entries[numEntries].index = ii;
+    numEntries++;
+    for (int byte = 0; byte < 8; byte++) {
+      counts[(byte << 8) + ((key >> (byte << 3)) & 0xff)]++;
+    }
+  }
   
-  if ((sortType == NULL) || (sortOrder == NULL) || (sortValues == NULL)) {
-    printLog(ERR, "sortType, sortOrder, or sortValues not defined.\n");
-    printLog(FLOOD,
-      "EXIT vectorNodeCompare(nodeAPointer=%p, nodeBPointer=%p) = {%d}\n",
-      nodeAPointer, nodeBPointer, returnValue);
-    return returnValue;
+  for (int byte = 0; byte < 8; byte++) {
+    u64 *byteCounts = &counts[byte << 8];
+    u64 total = 0;
+    bool allSame = false;
+    for (int bucket = 0; bucket < 256; bucket++) {
+      u64 count = byteCounts[bucket];
+      if (count == numEntries) {
+        allSame = true;
+        break;
+      }
+      byteCounts[bucket] = total;
+      total += count;
+    }
+    if (allSame == true) {
+      continue;
+    }
+  
+    int shift = byte << 3;
+    for (u64 ii = 0; ii < numEntries; ii++) {
+      scratch[byteCounts[(entries[ii].key >> shift) & 0xff]++] = entries[ii];
+    }
+    VectorRadixEntry *temp = entries;
+    entries = scratch;
+    scratch = temp;
   }
+  free(counts); counts = NULL;
   
-  if (*sortValues == true) {
-    // This is the expected case.
-    returnValue = (*sortOrder) * sortType->compare(nodeA->value, nodeB->value);
-  } else {
-    // Sort the keys.
-    returnValue = (*sortOrder) * sortType->compare(nodeA->key, nodeB->key);
+  // sources[ii] becomes the index of the node that belongs at position ii.
+  // The NULL indexes are at the front of sources already, so move them to the
+  // back first if that's where they belong.
+  u64 entryStart = numNull;
+  if (context->order == DESCENDING) {
+    memmove(&sources[numEntries], sources, numNull * sizeof(u64));
+    entryStart = 0;
+  }
+  for (u64 ii = 0; ii < numEntries; ii++) {
+    sources[entryStart + ii] = entries[ii].index;
   }
+  free(buffer); buffer = NULL;
   
-  printLog(FLOOD,
-    "EXIT vectorNodeCompare(nodeAPointer=%p, nodeBPointer=%p) = {%d}\n",
-    nodeAPointer, nodeBPointer, returnValue);
-  return returnValue;
+  // Move the nodes into place one permutation cycle at a time.
+  for (u64 ii = 0; ii < size; ii++) {
+    if (sources[ii] == ii) {
+      continue;
+    }
+    VectorNode node = array[ii];
+    u64 jj = ii;
+    while (sources[jj] != ii) {
+      u64 source = sources[jj];
+      array[jj] = array[source];
+      sources[jj] = jj;
+      jj = source;
+    }
+    array[jj] = node;
+    sources[jj] = jj;
+  }
+  free(sources);
+  
+  return true;
 }
 
-/// @fn void* vectorSort(Vector *vector, i32 order, bool sortValues)
+/// @fn static inline int vectorSortCompare(const VectorSortContext *context, const VectorNode *nodeA, const VectorNode *nodeB)
 ///
-/// @brief Sort the contents of a vector.  The contents of the vector are
-/// modified in place.
+/// @brief Compare two nodes of a vector being sorted.
 ///
-/// @param vector The Vector to sort.
-/// @param order The sort order to use.  1 = Ascending, -1 = Descending.
-/// @param sortValues Whether or not to sort the values.  If false, the keys
-///   will be used to sort instead.
+/// @param context The parameters of the sort.
+/// @param nodeA A node in the vector.
+/// @param nodeB Another node in the same vector.
 ///
-/// @return Returns a pointer to a sorted data of on success, NULL on failure.
-void* vectorSort(Vector *vector, i32 order, bool sortValues) {
-  printLog(TRACE, "ENTER vectorSort(vector=%p, order=%d, sortValues=%s)\n",
-    vector, order, boolNames[sortValues]);
-  call_once(&_sortMetadataSetup, setupVectorSortMetadata);
+/// @return Returns a value less than 0 if nodeA sorts before nodeB, 0 if they
+/// are equal, and a value greater than 0 if nodeA sorts after nodeB.
+static inline int vectorSortCompare(const VectorSortContext *context,
+  const VectorNode *nodeA, const VectorNode *nodeB
+) {
+  if (context->sortValues == true) {
+    return context->order * context->compare(nodeA->value, nodeB->value);
+  }
+  
+  return context->order * context->compare(nodeA->key, nodeB->key);
+}
+
+/// @fn static inline void vectorSwapNodes(VectorNode *nodeA, VectorNode *nodeB)
+///
+/// @brief Swap the contents of two VectorNodes.
+///
+/// @param nodeA, nodeB The nodes to swap.
+///
+/// @return This function returns no value.
+static inline void vectorSwapNodes(VectorNode *nodeA, VectorNode *nodeB) {
+  VectorNode temp = *nodeA;
+  *nodeA = *nodeB;
+  *nodeB = temp;
+}
+
+/// @fn static void vectorHeapSort(VectorNode *array, u64 size, const VectorSortContext *context)
+///
+/// @brief Heap sort an array of VectorNodes.  Used by vectorIntroSort when
+/// partitioning goes badly.
+///
+/// @param array The array of VectorNodes to sort.
+/// @param size The number of nodes in the array.
+/// @param context The parameters of the sort.
+///
+/// @return This function returns no value.
+static void vectorHeapSort(VectorNode *array, u64 size,
+  const VectorSortContext *context
+) {
+  for (u64 end = size, start = size >> 1; end > 1; ) {
+    u64 root = 0;
+    if (start > 0) {
+      // Still building the heap.
+      root = --start;
+    } else {
+      // Move the largest remaining node to the end.
+      vectorSwapNodes(&array[0], &array[--end]);
+    }
+  
+    u64 child = 0;
+    while ((child = (root << 1) + 1) < end) {
+      if ((child + 1 < end)
+        && (vectorSortCompare(context, &array[child], &array[child + 1]) < 0)
+      ) {
+        child++;
+      }
+      if (vectorSortCompare(context, &array[root], &array[child]) >= 0) {
+        break;
+      }
+      vectorSwapNodes(&array[root], &array[child]);
+      root = child;
+    }
+  }
+}
+
+/// @fn static void vectorIntroSort(VectorNode *array, u64 size, const VectorSortContext *context, u64 depthLimit)
+///
+/// @brief Introsort an array of VectorNodes:  quicksort with a median-of-three
+/// pivot, falling back to a heap sort when partitioning goes too deep and
+/// finishing small ranges with an insertion sort.
+///
+/// @param array The array of VectorNodes to sort.
+/// @param size The number of nodes in the array.
+/// @param context The parameters of the sort.
+/// @param depthLimit The number of partitioning rounds left before switching
+///   to a heap sort.
+///
+/// @return This function returns no value.
+static void vectorIntroSort(VectorNode *array, u64 size,
+  const VectorSortContext *context, u64 depthLimit
+) {
+  while (size > VECTOR_INSERTION_SORT_SIZE) {
+    if (depthLimit == 0) {
+      vectorHeapSort(array, size, context);
+      return;
+    }
+    depthLimit--;
+  
+    // Order the first, middle, and last nodes, then use the middle one as the
+    // pivot, parked at the front.
+    u64 middle = size >> 1;
+    if (vectorSortCompare(context, &array[middle], &array[0]) < 0) {
+      vectorSwapNodes(&array[middle], &array[0]);
+    }
+    if (vectorSortCompare(context, &array[size - 1], &array[0]) < 0) {
+      vectorSwapNodes(&array[size - 1], &array[0]);
+    }
+    if (vectorSortCompare(context, &array[size - 1], &array[middle]) < 0) {
+      vectorSwapNodes(&array[size - 1], &array[middle]);
+    }
+    vectorSwapNodes(&array[0], &array[middle]);
+  
+    u64 ii = 0, jj = size;
+    while (true) {
+      do {
+        ii++;
+      } while ((ii < size)
+        && (vectorSortCompare(context, &array[ii], &array[0]) < 0));
+      do {
+        jj--;
+      } while (vectorSortCompare(context, &array[jj], &array[0]) > 0);
+      if (ii >= jj) {
+        break;
+      }
+      vectorSwapNodes(&array[ii], &array[jj]);
+    }
+    vectorSwapNodes(&array[0], &array[jj]);
+  
+    // Recurse into the smaller side and loop on the larger one so that the
+    // stack depth stays logarithmic.
+    if (jj < size - jj - 1) {
+      vectorIntroSort(array, jj, context, depthLimit);
+      array += jj + 1;
+      size -= jj + 1;
+    } else {
+      vectorIntroSort(&array[jj + 1], size - jj - 1, context, depthLimit);
+      size = jj;
+    }
+  }
+  
+  for (u64 ii = 1; ii < size; ii++) {
+    if (vectorSortCompare(context, &array[ii], &array[ii - 1]) >= 0) {
+      continue;
+    }
+    VectorNode node = array[ii];
+    u64 jj = ii;
+    do {
+      array[jj] = array[jj - 1];
+      jj--;
+    } while ((jj > 0)
+      && (vectorSortCompare(context, &node, &array[jj - 1]) < 0));
+    array[jj] = node;
+  }
+}
+
+/// @fn static void vectorSortRun(VectorNode *array, u64 size, VectorRadixKind radixKind, const VectorSortContext *context)
+///
+/// @brief Sort a contiguous run of VectorNodes.  Primitive types are radix
+/// sorted on their raw values.  Everything else, or a primitive type if the
+/// radix sort can't get its memory, is sorted with the type's compare
+/// function.
+///
+/// @param array The first node of the run.
+/// @param size The number of nodes in the run.
+/// @param radixKind The kind of radix sort the values support, if any.
+/// @param context The parameters of the sort.
+///
+/// @return This function returns no value.
+static void vectorSortRun(VectorNode *array, u64 size,
+  VectorRadixKind radixKind, const VectorSortContext *context
+) {
+  if ((radixKind == VECTOR_RADIX_NONE)
+    || (vectorRadixSort(array, size, radixKind, context) == false)
+  ) {
+    u64 depthLimit = 0;
+    for (u64 ii = size; ii > 1; ii >>= 1) {
+      depthLimit += 2;
+    }
+    vectorIntroSort(array, size, context, depthLimit);
+  }
+}
+
+/// @struct VectorSortJob
+///
+/// @brief The state of a vectorSortParallel call shared by all of its tasks.
+///
+/// @param context The parameters of the sort.
+/// @param radixKind The kind of radix sort the values support, if any.
+/// @param size The number of nodes being sorted.
+/// @param numRuns The number of runs sorted independently before merging.
+/// @param runWidth The number of original runs in each input of the current
+///   merge round.
+/// @param source The nodes being read by the current round.
+/// @param destination The nodes being written by the current round.
+/// @param vector The vector being sorted.
+/// @param data The data array the nodes' values are being moved into.
+/// @param elementSize The size of one element of the data array.
+/// @param dataIsPointer Whether or not the data array holds pointers.
+typedef struct VectorSortJob {
+  VectorSortContext context;
+  VectorRadixKind radixKind;
+  u64 size;
+  u64 numRuns;
+  u64 runWidth;
+  VectorNode *source;
+  VectorNode *destination;
+  Vector *vector;
+  char *data;
+  size_t elementSize;
+  bool dataIsPointer;
+} VectorSortJob;
+
+/// @fn static void vectorSortRunTask(void *job, u64 task, u64 numTasks)
+///
+/// @brief Sort one of the runs of a parallel sort.
+///
+/// @param job The VectorSortJob.
+/// @param task The task number, which is also the run number.
+/// @param numTasks The number of tasks.
+///
+/// @return This function returns no value.
+static void vectorSortRunTask(void *job, u64 task, u64 numTasks) {
+  VectorSortJob *sortJob = (VectorSortJob*) job;
+  u64 start = vectorTaskStart(sortJob->size, task, numTasks);
+  u64 end = vectorTaskStart(sortJob->size, task + 1, numTasks);
+  vectorSortRun(&sortJob->source[start], end - start, sortJob->radixKind,
+    &sortJob->context);
+}
+
+/// @fn static u64 vectorMergeSplit(const VectorSortContext *context, const VectorNode *runA, u64 sizeA, const VectorNode *runB, u64 sizeB, u64 diagonal)
+///
+/// @brief Find how many nodes of runA are among the first diagonal nodes of
+/// the stable merge of runA and runB.  This lets each task of a merge start
+/// in the middle of a pair of runs without merging everything before it.
+///
+/// @param context The parameters of the sort.
+/// @param runA The first sorted run.  It wins ties.
+/// @param sizeA The number of nodes in runA.
+/// @param runB The second sorted run.
+/// @param sizeB The number of nodes in runB.
+/// @param diagonal The number of merged nodes to split.
+///
+/// @return Returns the number of nodes taken from runA.
+static u64 vectorMergeSplit(const VectorSortContext *context,
+  const VectorNode *runA, u64 sizeA, const VectorNode *runB, u64 sizeB,
+  u64 diagonal
+) {
+  u64 low = (diagonal > sizeB) ? diagonal - sizeB : 0;
+  u64 high = (diagonal < sizeA) ? diagonal : sizeA;
+  while (low < high) {
+    u64 middle = low + ((high - low) >> 1);
+    if (vectorSortCompare(context,
+      &runA[middle], &runB[diagonal - middle - 1]) <= 0
+    ) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  
+  return low;
+}
+
+/// @fn static void vectorSortMergeTask(void *job, u64 task, u64 numTasks)
+///
+/// @brief Write one share of the output of a merge round of a parallel sort.
+/// The share may cover the ends of several pairs of runs.
+///
+/// @param job The VectorSortJob.
+/// @param task The task number.
+/// @param numTasks The number of tasks.
+///
+/// @return This function returns no value.
+static void vectorSortMergeTask(void *job, u64 task, u64 numTasks) {
+  VectorSortJob *sortJob = (VectorSortJob*) job;
+  const VectorSortContext *context = &sortJob->context;
+  u64 size = sortJob->size;
+  u64 numRuns = sortJob->numRuns;
+  u64 runWidth = sortJob->runWidth;
+  u64 outputStart = vectorTaskStart(size, task, numTasks);
+  u64 outputEnd = vectorTaskStart(size, task + 1, numTasks);
+  
+  for (u64 run = 0; run < numRuns; run += runWidth << 1) {
+    u64 pairStart = vectorTaskStart(size, run, numRuns);
+    u64 middleRun = run + runWidth;
+    u64 endRun = middleRun + runWidth;
+    u64 pairMiddle = vectorTaskStart(size,
+      (middleRun < numRuns) ? middleRun : numRuns, numRuns);
+    u64 pairEnd = vectorTaskStart(size,
+      (endRun < numRuns) ? endRun : numRuns, numRuns);
+    if ((pairEnd <= outputStart) || (pairStart >= outputEnd)) {
+      continue;
+    }
+    
+    const VectorNode *runA = &sortJob->source[pairStart];
+    const VectorNode *runB = &sortJob->source[pairMiddle];
+    u64 sizeA = pairMiddle - pairStart;
+    u64 sizeB = pairEnd - pairMiddle;
+    u64 first = ((outputStart > pairStart) ? outputStart : pairStart)
+      - pairStart;
+    u64 last = ((outputEnd < pairEnd) ? outputEnd : pairEnd) - pairStart;
+    VectorNode *output = &sortJob->destination[pairStart];
+    
+    u64 ii = vectorMergeSplit(context, runA, sizeA, runB, sizeB, first);
+    u64 jj = first - ii;
+    for (u64 kk = first; kk < last; kk++) {
+      if ((jj >= sizeB) || ((ii < sizeA)
+        && (vectorSortCompare(context, &runA[ii], &runB[jj]) <= 0))
+      ) {
+        output[kk] = runA[ii++];
+      } else {
+        output[kk] = runB[jj++];
+      }
+    }
+  }
+}
+
+/// @fn static void vectorSortCopyTask(void *job, u64 task, u64 numTasks)
+///
+/// @brief Copy one share of the merged nodes of a parallel sort back into the
+/// vector's node array.
+///
+/// @param job The VectorSortJob.
+/// @param task The task number.
+/// @param numTasks The number of tasks.
+///
+/// @return This function returns no value.
+static void vectorSortCopyTask(void *job, u64 task, u64 numTasks) {
+  VectorSortJob *sortJob = (VectorSortJob*) job;
+  u64 start = vectorTaskStart(sortJob->size, task, numTasks);
+  u64 end = vectorTaskStart(sortJob->size, task + 1, numTasks);
+  memcpy(&sortJob->destination[start], &sortJob->source[start],
+    (end - start) * sizeof(VectorNode));
+}
+
+/// @fn static void vectorSortRelinkTask(void *job, u64 task, u64 numTasks)
+///
+/// @brief Fix the links and indexes of one share of a sorted vector's nodes
+/// and move their values into the matching slots of the data array.
+///
+/// @param job The VectorSortJob.
+/// @param task The task number.
+/// @param numTasks The number of tasks.
+///
+/// @return This function returns no value.
+static void vectorSortRelinkTask(void *job, u64 task, u64 numTasks) {
+  VectorSortJob *sortJob = (VectorSortJob*) job;
+  VectorNode *array = sortJob->vector->array;
+  char *data = sortJob->data;
+  size_t elementSize = sortJob->elementSize;
+  u64 start = vectorTaskStart(sortJob->size, task, numTasks);
+  u64 end = vectorTaskStart(sortJob->size, task + 1, numTasks);
+  
+  for (u64 ii = start; ii < end; ii++) {
+    array[ii].prev = (ii > 0) ? &array[ii - 1] : NULL;
+    array[ii].next = &array[ii + 1];
+    array[ii].index = ii;
+    
+    if (sortJob->dataIsPointer == false) {
+      // Set the data and the pointer.
+      memcpy(data + (ii * elementSize), (void*) array[ii].value, elementSize);
+      array[ii].value = data + (ii * elementSize);
+    } else {
+      // Set the data.
+      memcpy(data + (ii * elementSize), &array[ii].value, elementSize);
+    }
+    // else the pointers were already swapped as part of the node swap.
+    // *DO NOT* swap again.
+  }
+}
+
+/// @fn void* vectorSortParallel(Vector *vector, i32 order, bool sortValues, u32 numThreads)
+///
+/// @brief Sort the contents of a vector, splitting the work across threads.
+/// Each thread sorts one run of the vector, then the runs are merged pairwise
+/// with every thread writing an equal share of each round's output.  The
+/// contents of the vector are modified in place.
+///
+/// @param vector The Vector to sort.
+/// @param order The sort order to use.  1 = Ascending, -1 = Descending.
+/// @param sortValues Whether or not to sort the values.  If false, the keys
+///   will be used to sort instead.
+/// @param numThreads The number of threads to use.  0 means one per online
+///   CPU.  Fewer are used for small vectors.
+///
+/// @return Returns a pointer to a sorted data of on success, NULL on failure.
+void* vectorSortParallel(Vector *vector, i32 order, bool sortValues,
+  u32 numThreads
+) {
+  printLog(TRACE,
+    "ENTER vectorSortParallel(vector=%p, order=%d, sortValues=%s, "
+    "numThreads=%u)\n", vector, order, boolNames[sortValues], numThreads);
   
   void *returnValue = NULL;
   
   if ((vector == NULL) || (vector->array == NULL)) {
     printLog(ERR, "vector or vector->array is NULL.\n");
     printLog(TRACE,
-      "EXIT vectorSort(vector=%p, order=%d, sortValues=%s) = {%p}\n",
-      vector, order, boolNames[sortValues], returnValue);
+      "EXIT vectorSortParallel(vector=%p, order=%d, sortValues=%s, "
+      "numThreads=%u) = {%p}\n",
+      vector, order, boolNames[sortValues], numThreads, returnValue);
     return returnValue; // NULL
   } else if ((order != ASCENDING) && (order != DESCENDING)) {
     printLog(ERR, "Invalid order %d received.\n", order);
     printLog(ERR, "Order must be ASCENDING or DESCENDING.");
     printLog(TRACE,
-      "EXIT vectorSort(vector=%p, order=%d, sortValues=%s) = {%p}\n",
-      vector, order, boolNames[sortValues], returnValue);
+      "EXIT vectorSortParallel(vector=%p, order=%d, sortValues=%s, "
+      "numThreads=%u) = {%p}\n",
+      vector, order, boolNames[sortValues], numThreads, returnValue);
     return returnValue; // NULL
   }
   
@@ -1052,22 +2077,20 @@ void* vectorSort(Vector *vector, i32 order, bool sortValues) {
     if (valueType == NULL) {
       printLog(ERR, "Cannot sort Vector with no type.\n");
       printLog(TRACE,
-        "EXIT vectorSort(vector=%p, order=%d, sortValues=%s) = {%p}\n",
-        vector, order, boolNames[sortValues], returnValue);
+        "EXIT vectorSortParallel(vector=%p, order=%d, sortValues=%s, "
+        "numThreads=%u) = {%p}\n",
+        vector, order, boolNames[sortValues], numThreads, returnValue);
       return returnValue; // NULL
     }
   } else if (valueType == NULL) {
     printLog(ERR, "Cannot sort vector by value.  No value type defined.\n");
     printLog(TRACE,
-      "EXIT vectorSort(vector=%p, order=%d, sortValues=%s) = {%p}\n",
-      vector, order, boolNames[sortValues], returnValue);
+      "EXIT vectorSortParallel(vector=%p, order=%d, sortValues=%s, "
+      "numThreads=%u) = {%p}\n",
+      vector, order, boolNames[sortValues], numThreads, returnValue);
     return returnValue; // NULL
   }
   
-  tss_set(_sortType, valueType);
-  tss_set(_sortOrder, &order);
-  tss_set(_sortValues, &sortValues);
-  
   // We will have to sort the data portion of the vector once we sort the
   // VectorNode array.  To do that, we'll need some temporary stoarge.  We need
   // to allocate that before we do the sort so that if the memory allocation
@@ -1075,55 +2098,79 @@ void* vectorSort(Vector *vector, i32 order, bool sortValues) {
   
   size_t elementSize = sizeof(void*);
   bool dataIsPointer = vector->valueType->dataIsPointer;
+  char *data = (char*) vector->data;
   if (dataIsPointer == false) {
     // Need to provide a non-NULL value to valueType->size().
     elementSize = vector->valueType->size(VOID_POINTER_TRUE);
+    data = (char*) allocatorMalloc(ALLOCATOR_VECTOR, vector->valueType,
+      vector->arraySize * elementSize);
+    if (data == NULL) {
+      LOG_MALLOC_FAILURE();
+      printLog(TRACE,
+        "EXIT vectorSortParallel(vector=%p, order=%d, sortValues=%s, "
+        "numThreads=%u) = {%p}\n",
+        vector, order, boolNames[sortValues], numThreads, returnValue);
+      return returnValue; // NULL
+    }
   }
   
-  
   if ((vector->lock != NULL) && (mtx_lock(vector->lock) != thrd_success)) {
     printLog(WARN, "Could not lock vector mutex.\n");
   }
   
-  qsort(vector->array, vector->size, sizeof(VectorNode),
-    vectorNodeCompare);
-  
-  // vector->array, which is the array of VectorNodes, is now sorted.  We need
-  // to sort the data array and update all the pointers as well.
-  VectorNode *array = vector->array;
-  char *data = (char*) vector->data;
-  if (dataIsPointer == false) {
-    data = (char*) malloc(vector->arraySize * elementSize);
-    if (data == NULL) {
+  VectorSortJob job = {
+    { valueType->compare, order, sortValues },
+    vectorRadixKind(valueType),
+    vector->size,
+    0, 0,
+    vector->array,
+    NULL,
+    vector,
+    data,
+    elementSize,
+    dataIsPointer
+  };
+  u64 numTasks = vectorNumTasks(numThreads, vector->size);
+  VectorNode *buffer = NULL;
+  if (numTasks > 1) {
+    // The merge rounds need somewhere to put their output.  Without that,
+    // sort on this thread alone.
+    buffer = (VectorNode*) malloc(vector->size * sizeof(VectorNode));
+    if (buffer == NULL) {
       LOG_MALLOC_FAILURE();
-      printLog(TRACE,
-        "EXIT vectorSort(vector=%p, order=%d, sortValues=%s) = {%p}\n",
-        vector, order, boolNames[sortValues], returnValue);
-      return returnValue; // NULL
+      numTasks = 1;
     }
   }
-  u64 arraySize = vector->size;
-  VectorNode *prev = NULL;
-  for (u64 ii = 0; ii < arraySize; ii++) {
-    array[ii].prev = prev;
-    prev = &array[ii];
-    array[ii].next = &array[ii + 1];
-    array[ii].index = ii;
+  
+  if (numTasks > 1) {
+    job.numRuns = numTasks;
+    vectorRunTasks(vectorSortRunTask, &job, numTasks);
     
-    if (dataIsPointer == false) {
-      // Set the data and the pointer.
-      memcpy(data + (ii * elementSize), (void*) array[ii].value, elementSize);
-      array[ii].value = data + (ii * elementSize);
-    } else {
-      // Set the data.
-      memcpy(data + (ii * elementSize), &array[ii].value, elementSize);
+    job.destination = buffer;
+    for (job.runWidth = 1; job.runWidth < job.numRuns; job.runWidth <<= 1) {
+      vectorRunTasks(vectorSortMergeTask, &job, numTasks);
+      VectorNode *source = job.source;
+      job.source = job.destination;
+      job.destination = source;
     }
-    // else the pointers were already swapped as part of the node swap.
-    // *DO NOT* swap again.
+    if (job.source != vector->array) {
+      job.destination = vector->array;
+      vectorRunTasks(vectorSortCopyTask, &job, numTasks);
+    }
+    buffer = (VectorNode*) pointerDestroy(buffer);
+  } else {
+    vectorSortRun(vector->array, vector->size, job.radixKind, &job.context);
   }
+  
+  // vector->array, which is the array of VectorNodes, is now sorted.  We need
+  // to sort the data array and update all the pointers as well.
+  vectorRunTasks(vectorSortRelinkTask, &job, numTasks);
+  VectorNode *array = vector->array;
+  u64 arraySize = vector->size;
   // Fix the pointer values.
   if (dataIsPointer == false) {
-    vector->data = pointerDestroy(vector->data);
+    vector->data
+      = allocatorFree(ALLOCATOR_VECTOR, vector->valueType, vector->data);
     vector->data = data;
   }
   vector->head = &array[0];
@@ -1136,6 +2183,30 @@ void* vectorSort(Vector *vector, i32 order, bool sortValues) {
     mtx_unlock(vector->lock);
   }
   
+  printLog(TRACE,
+    "EXIT vectorSortParallel(vector=%p, order=%d, sortValues=%s, "
+    "numThreads=%u) = {%p}\n",
+    vector, order, boolNames[sortValues], numThreads, returnValue);
+  return returnValue;
+}
+
+/// @fn void* vectorSort(Vector *vector, i32 order, bool sortValues)
+///
+/// @brief Sort the contents of a vector.  The contents of the vector are
+/// modified in place.
+///
+/// @param vector The Vector to sort.
+/// @param order The sort order to use.  1 = Ascending, -1 = Descending.
+/// @param sortValues Whether or not to sort the values.  If false, the keys
+///   will be used to sort instead.
+///
+/// @return Returns a pointer to a sorted data of on success, NULL on failure.
+void* vectorSort(Vector *vector, i32 order, bool sortValues) {
+  printLog(TRACE, "ENTER vectorSort(vector=%p, order=%d, sortValues=%s)\n",
+    vector, order, boolNames[sortValues]);
+  
+  void *returnValue = vectorSortParallel(vector, order, sortValues, 1);
+  
   printLog(TRACE,
     "EXIT vectorSort(vector=%p, order=%d, sortValues=%s) = {%p}\n",
     vector, order, boolNames[sortValues], returnValue);
@@ -1208,7 +2279,7 @@ Vector* vectorFromBlob_(const volatile void *array, u64 *length, bool inPlaceDat
   
   u32 dsVersion = *((u32*) &byteArray[index]);
   littleEndianToHost(&dsVersion, sizeof(dsVersion));
-  if (dsVersion != 10) {
+  if ((dsVersion < 10) || (dsVersion > DsVersion)) {
     printLog(ERR, "Don't know how to parse version %u of input byte array.\n",
       dsVersion);
     printLog(ERR, "If this input came from this library, please "
@@ -1235,6 +2306,26 @@ Vector* vectorFromBlob_(const volatile void *array, u64 *length, bool inPlaceDat
   size = *((u64*) &byteArray[index]);
   littleEndianToHost(&size, sizeof(size));
   index += sizeof(size);
+  u64 indexOffset = 0;
+  if (dsVersion > 10) {
+    // Version 11 follows the size with the offset and order of the entry
+    // index.  The entries themselves are encoded the same way as in version
+    // 10, so they are parsed the same way and the index is just skipped.
+    if (arrayLength >= index + sizeof(indexOffset) + sizeof(u8)) {
+      indexOffset = *((u64*) &byteArray[index]);
+      littleEndianToHost(&indexOffset, sizeof(indexOffset));
+      index += sizeof(indexOffset) + sizeof(u8);
+    }
+    if ((indexOffset < index) || (indexOffset > arrayLength)
+      || (size > (arrayLength - indexOffset) / DS_INDEX_ENTRY_SIZE)
+    ) {
+      printLog(ERR, "Improperly formatted byte array.  Invalid index.\n");
+      printLog(ERR, "If this input came from this library, please "
+        "report this as a bug.\n");
+      return NULL;
+    }
+    arrayLength = indexOffset;
+  }
   vector = vectorCreate(keyTypeNoCopy, disableThreadSafety, size);
   if (vector == NULL) {
     LOG_MALLOC_FAILURE();
@@ -1353,6 +2444,10 @@ Vector* vectorFromBlob_(const volatile void *array, u64 *length, bool inPlaceDat
   }
   
   *length = index;
+  if (indexOffset > 0) {
+    // Consume the index too so that the caller's next read starts after it.
+    *length = indexOffset + (size * DS_INDEX_ENTRY_SIZE);
+  }
   if (inPlaceData) {
     // Optimize for this case.
     if (keyTypeIndex >= listIndex) {
@@ -1370,274 +2465,979 @@ Vector* vectorFromBlob_(const volatile void *array, u64 *length, bool inPlaceDat
   return vector;
 }
 
-/// @fn Bytes vectorToJson(const Vector *vector)
+/// @fn bool vectorToJsonStream(const Vector *vector, JsonWriter *writer)
+///
+/// @brief Writes a Vector to a JsonWriter in JSON format.  Nested data
+///   structures are written directly to the writer, so no part of the document
+///   is built in memory.
+///
+/// @param vector is the Vector to convert.
+/// @param writer is the JsonWriter to write to.
+///
+/// @return Returns true on success, false on failure.
+bool vectorToJsonStream(const Vector *vector, JsonWriter *writer) {
+  printLog(TRACE, "ENTER vectorToJsonStream(vector=%p, writer=%p)\n",
+    vector, writer);
+  
+  VectorNode *node = NULL;
+  
+  if (vector == NULL) {
+    printLog(ERR, "Vector provided was NULL.\n");
+    bool returnValue = (writer != NULL) && (writer->failed == false);
+    printLog(TRACE,
+      "EXIT vectorToJsonStream(vector=NULL, writer=%p) = {%s}\n",
+      writer, boolNames[returnValue]);
+    return returnValue;
+  }
+  
+  if ((vector->lock != NULL) && (mtx_lock(vector->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock vector mutex.\n");
+  }
+  
+  int listTypeIndex = getIndexFromTypeDescriptor(typeList);
+  jsonWriterWriteStr(writer, "[\n");
+  for (node = vector->head; node != NULL; node = node->next) {
+    if (getIndexFromTypeDescriptor(node->type) < listTypeIndex) {
+      // Append end of key, start of value.
+      jsonWriterWriteStr(writer, "  ");
+      if ((node->type == typeString) || (node->type == typeStringNoCopy)
+        || (node->type == typeBytes) || (node->type == typeBytesNoCopy)
+      ) {
+        jsonWriterWriteStr(writer, "\"");
+      }
+      char *valueString = node->type->toString(node->value);
+      jsonWriterWriteStr(writer, valueString);
+      valueString = stringDestroy(valueString);
+      if ((node->type == typeString) || (node->type == typeStringNoCopy)
+        || (node->type == typeBytes) || (node->type == typeBytesNoCopy)
+      ) {
+        jsonWriterWriteStr(writer, "\"");
+      }
+    } else if ((node->type == typePointer) && (node->value == NULL)) {
+      // NULL value.
+      jsonWriterWriteStr(writer, "  null");
+    } else {
+      // Value's type is a data structure, not a primitive.  Everything that
+      // isn't a vector is written as a list.
+      jsonWriterWriteStr(writer, "  ");
+      jsonWriterIndent(writer, 2);
+      if (node->type == typeVector) {
+        vectorToJsonStream((Vector*) node->value, writer);
+      } else {
+        listToJsonStream((List*) node->value, writer);
+      }
+      jsonWriterUnindent(writer, 2);
+    }
+    
+    if (node->next != NULL) {
+      // End of the vector
+      jsonWriterWriteStr(writer, ",\n");
+    }
+  }
+  jsonWriterWriteStr(writer, "\n]");
+  
+  if (vector->lock != NULL) {
+    mtx_unlock(vector->lock);
+  }
+  
+  bool returnValue = (writer != NULL) && (writer->failed == false);
+  printLog(TRACE, "EXIT vectorToJsonStream(vector=%p, writer=%p) = {%s}\n",
+    vector, writer, boolNames[returnValue]);
+  return returnValue;
+}
+
+/// @fn Bytes vectorToJson(const Vector *vector)
+///
+/// @brief Converts a Vector to a JSON-formatted string.  This function will
+///   always return an allocated string, even if it's a zero-length (one null
+///   byte) string.
+///
+/// @param vector is the Vector to convert.
+///
+/// @return Returns a JSON-formatted Bytes object representation of the vector.
+Bytes vectorToJson(const Vector *vector) {
+  printLog(TRACE, "ENTER vectorToJson(vector=%p)\n", vector);
+  
+  Bytes returnValue = NULL;
+  bytesAllocate(&returnValue, 0);
+  
+  JsonWriter writer;
+  jsonWriterInitBytes(&writer, &returnValue);
+  vectorToJsonStream(vector, &writer);
+  jsonWriterFlush(&writer);
+  
+  printLog(TRACE, "EXIT vectorToJson(vector=%p) = {%s}\n", vector, returnValue);
+  return returnValue;
+}
+
+// Operations for the HashTables that objects inside of JSON arrays become.
+JSON_CONTAINER_OPS(HashTable, ht)
+
+/// @fn static void* vectorJsonCreate(void)
+///
+/// @brief Create an empty Vector for jsonToDataStructure.  JSON arrays may
+/// mix types, so the Vector is not given a value type.
+///
+/// @return Returns a new Vector on success, NULL on failure.
+static void* vectorJsonCreate(void) {
+  return kvVectorCreate(typeString);
+}
+
+/// @fn static void* vectorJsonDestroy(void *container)
+///
+/// @brief Destroy a Vector made by vectorJsonCreate.
+///
+/// @param container The Vector to destroy.
+///
+/// @return Returns NULL.
+static void* vectorJsonDestroy(void *container) {
+  return vectorDestroy((Vector*) container);
+}
+
+/// @fn static bool vectorJsonAddEntry(void *container, const char *key, const volatile void *value, TypeDescriptor *addType, TypeDescriptor *type)
+///
+/// @brief Append a parsed value to a Vector for jsonToDataStructure.
+///
+/// @param container The Vector to append to.
+/// @param key Ignored.  Array elements have no keys.
+/// @param value The value to append.
+/// @param addType The type to add the value as.
+/// @param type The type to give the new node.
+///
+/// @return Returns true on success, false on failure.
+static bool vectorJsonAddEntry(void *container, const char *key,
+  const volatile void *value, TypeDescriptor *addType, TypeDescriptor *type
+) {
+  (void) key;
+  Vector *vector = (Vector*) container;
+  VectorNode *node = vectorSetEntry(vector, vector->size, value, addType);
+  if (node == NULL) {
+    return false;
+  }
+  node->type = type;
+  return true;
+}
+
+/// @var vectorJsonContainerOps
+///
+/// @brief The operations jsonToDataStructure uses to build the Vectors that
+/// JSON arrays become.
+static const JsonContainerOps vectorJsonContainerOps = {
+  vectorJsonCreate,
+  vectorJsonDestroy,
+  vectorJsonAddEntry,
+  &typeVector,
+  &typeVectorNoCopy,
+  true
+};
+
+/// @struct JsonBuilderFrame
+///
+/// @brief A data structure that jsonToDataStructure has started but not yet
+/// finished.
+///
+/// @param container The data structure.
+/// @param ops The operations for the data structure.
+/// @param key The key of the next value to add to an object.
+typedef struct JsonBuilderFrame {
+  void *container;
+  const JsonContainerOps *ops;
+  Bytes key;
+} JsonBuilderFrame;
+
+/// @struct JsonBuilder
+///
+/// @brief The context jsonToDataStructure passes to its jsonSaxParse
+/// callbacks.
+///
+/// @param topOps The operations for the outermost data structure.
+/// @param frames The unfinished data structures, outermost first.
+/// @param depth The number of frames in use.
+/// @param capacity The number of frames allocated.
+/// @param result The finished outermost data structure.
+typedef struct JsonBuilder {
+  const JsonContainerOps *topOps;
+  JsonBuilderFrame *frames;
+  u64 depth;
+  u64 capacity;
+  void *result;
+} JsonBuilder;
+
+/// @fn static bool jsonBuilderAdd(JsonBuilder *builder, const volatile void *value, TypeDescriptor *addType, TypeDescriptor *type)
+///
+/// @brief Add a value to the innermost unfinished data structure under the
+/// last key that was parsed.  A value the data structure rejects (a Vector
+/// holds only one kind of non-pointer value) is logged and dropped, the same
+/// as the original parsers did.
+///
+/// @param builder The JsonBuilder to add to.
+/// @param value The value to add.  If addType is not type, the builder takes
+///   ownership of value and destroys it if it is not added.
+/// @param addType The type to add the value as.
+/// @param type The type to give the new node.
+///
+/// @return Returns true on success, false if there is no data structure to
+/// add to.
+static bool jsonBuilderAdd(JsonBuilder *builder, const volatile void *value,
+  TypeDescriptor *addType, TypeDescriptor *type
+) {
+  bool returnValue = false;
+  if (builder->depth == 0) {
+    printLog(ERR, "JSON value is not an object or array.\n");
+  } else {
+    JsonBuilderFrame *frame = &builder->frames[builder->depth - 1];
+    if (frame->ops->addEntry(frame->container, str(frame->key),
+      value, addType, type) == false
+    ) {
+      printLog(WARN, "Could not add %s value for key \"%s\".  Dropping it.\n",
+        type->name, (frame->key != NULL) ? str(frame->key) : "");
+    } else {
+      value = NULL;
+    }
+    frame->key = bytesDestroy(frame->key);
+    returnValue = true;
+  }
+  
+  if ((value != NULL) && (addType != type)) {
+    type->destroy((volatile void*) value);
+  }
+  
+  return returnValue;
+}
+
+/// @fn static bool jsonBuilderStart(JsonBuilder *builder, bool isArray)
+///
+/// @brief Start a new data structure for a JSON object or array.
+///
+/// @param builder The JsonBuilder that is parsing.
+/// @param isArray Whether the new value is an array (true) or an object
+///   (false).
+///
+/// @return Returns true on success, false on failure.
+static bool jsonBuilderStart(JsonBuilder *builder, bool isArray) {
+  const JsonContainerOps *ops = NULL;
+  if (builder->depth == 0) {
+    ops = builder->topOps;
+    if (ops->isArray != isArray) {
+      printLog(ERR, "No opening %s in jsonText.  Malformed JSON input.\n",
+        (ops->isArray == true) ? "bracket" : "brace");
+      return false;
+    }
+  } else if (isArray == true) {
+    ops = &vectorJsonContainerOps;
+  } else {
+    const JsonContainerOps *parentOps
+      = builder->frames[builder->depth - 1].ops;
+    ops = (parentOps->isArray == true) ? &htJsonContainerOps : parentOps;
+  }
+  
+  if (builder->depth == builder->capacity) {
+    u64 capacity = (builder->capacity > 0) ? builder->capacity << 1 : 8;
+    JsonBuilderFrame *frames = (JsonBuilderFrame*) realloc(
+      builder->frames, capacity * sizeof(JsonBuilderFrame));
+    if (frames == NULL) {
+      LOG_MALLOC_FAILURE();
+      return false;
+    }
+    builder->frames = frames;
+    builder->capacity = capacity;
+  }
+  
+  void *container = ops->create();
+  if (container == NULL) {
+    LOG_MALLOC_FAILURE();
+    return false;
+  }
+  JsonBuilderFrame *frame = &builder->frames[builder->depth++];
+  frame->container = container;
+  frame->ops = ops;
+  frame->key = NULL;
+  
+  return true;
+}
+
+/// @fn static bool jsonBuilderStartObject(void *context)
+///
+/// @brief JsonSaxHandler callback for the start of an object.
+///
+/// @param context The JsonBuilder that is parsing.
+///
+/// @return Returns true on success, false on failure.
+static bool jsonBuilderStartObject(void *context) {
+  return jsonBuilderStart((JsonBuilder*) context, false);
+}
+
+/// @fn static bool jsonBuilderStartArray(void *context)
+///
+/// @brief JsonSaxHandler callback for the start of an array.
+///
+/// @param context The JsonBuilder that is parsing.
+///
+/// @return Returns true on success, false on failure.
+static bool jsonBuilderStartArray(void *context) {
+  return jsonBuilderStart((JsonBuilder*) context, true);
+}
+
+/// @fn static bool jsonBuilderEnd(void *context)
+///
+/// @brief JsonSaxHandler callback for the end of an object or array.  The
+/// finished data structure is handed to the one that contains it.
+///
+/// @param context The JsonBuilder that is parsing.
+///
+/// @return Returns true on success, false on failure.
+static bool jsonBuilderEnd(void *context) {
+  JsonBuilder *builder = (JsonBuilder*) context;
+  JsonBuilderFrame *frame = &builder->frames[--builder->depth];
+  void *container = frame->container;
+  const JsonContainerOps *ops = frame->ops;
+  frame->key = bytesDestroy(frame->key);
+  
+  if (builder->depth == 0) {
+    builder->result = container;
+    return true;
+  }
+  
+  return jsonBuilderAdd(builder, container, *ops->typeNoCopy, *ops->type);
+}
+
+/// @fn static bool jsonBuilderKey(void *context, const char *key, u64 keyLength)
+///
+/// @brief JsonSaxHandler callback for an object key.  Keys are stored as they
+/// appear in the input.
+///
+/// @param context The JsonBuilder that is parsing.
+/// @param key The text of the key.
+/// @param keyLength The number of bytes at key.
+///
+/// @return Returns true on success, false on failure.
+static bool jsonBuilderKey(void *context, const char *key, u64 keyLength) {
+  JsonBuilder *builder = (JsonBuilder*) context;
+  JsonBuilderFrame *frame = &builder->frames[builder->depth - 1];
+  frame->key = bytesDestroy(frame->key);
+  if (bytesAllocate(&frame->key, keyLength) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return false;
+  }
+  bytesAddData(&frame->key, key, keyLength);
+  
+  return true;
+}
+
+/// @fn static bool jsonBuilderString(void *context, const char *value, u64 valueLength)
+///
+/// @brief JsonSaxHandler callback for a string value.  Strings in arrays are
+/// stored as they appear in the input.  Strings in objects have the escapes
+/// that listToJson adds removed and are stored as Bytes.
+///
+/// @param context The JsonBuilder that is parsing.
+/// @param value The text of the string.
+/// @param valueLength The number of bytes at value.
+///
+/// @return Returns true on success, false on failure.
+static bool jsonBuilderString(void *context, const char *value,
+  u64 valueLength
+) {
+  JsonBuilder *builder = (JsonBuilder*) context;
+  Bytes stringValue = NULL;
+  if (bytesAllocate(&stringValue, valueLength) == NULL) {
+    LOG_MALLOC_FAILURE();
+    return false;
+  }
+  bytesAddData(&stringValue, value, valueLength);
+  
+  if ((builder->depth > 0)
+    && (builder->frames[builder->depth - 1].ops->isArray == true)
+  ) {
+    bool returnValue
+      = jsonBuilderAdd(builder, stringValue, typeString, typeString);
+    stringValue = bytesDestroy(stringValue);
+    return returnValue;
+  }
+  
+  // Remove any backslash escapes that were injected by the protocol.
+  u64 ii = 0;
+  for (u64 jj = 0; jj < valueLength; ii++, jj++) {
+    if (stringValue[jj] == '\\') {
+      jj++;
+      if (stringValue[jj] == 'n') {
+        stringValue[ii] = '\n';
+        continue;
+      }
+    }
+    stringValue[ii] = stringValue[jj];
+  }
+  stringValue[ii] = '\0';
+  bytesSetLength(stringValue, ii);
+  unescapeBytes(stringValue);
+  
+  return jsonBuilderAdd(builder, stringValue, typeBytesNoCopy, typeBytes);
+}
+
+/// @fn static bool jsonBuilderInteger(void *context, i64 value)
+///
+/// @brief JsonSaxHandler callback for an integer value.
+///
+/// @param context The JsonBuilder that is parsing.
+/// @param value The value parsed.
+///
+/// @return Returns true on success, false on failure.
+static bool jsonBuilderInteger(void *context, i64 value) {
+  return jsonBuilderAdd((JsonBuilder*) context, &value, typeI64, typeI64);
+}
+
+/// @fn static bool jsonBuilderDouble(void *context, double value)
+///
+/// @brief JsonSaxHandler callback for a floating-point value.
+///
+/// @param context The JsonBuilder that is parsing.
+/// @param value The value parsed.
+///
+/// @return Returns true on success, false on failure.
+static bool jsonBuilderDouble(void *context, double value) {
+  return jsonBuilderAdd((JsonBuilder*) context, &value,
+    typeDouble, typeDouble);
+}
+
+/// @fn static bool jsonBuilderBoolean(void *context, bool value)
+///
+/// @brief JsonSaxHandler callback for true or false.
+///
+/// @param context The JsonBuilder that is parsing.
+/// @param value The value parsed.
+///
+/// @return Returns true on success, false on failure.
+static bool jsonBuilderBoolean(void *context, bool value) {
+  return jsonBuilderAdd((JsonBuilder*) context, &value, typeBool, typeBool);
+}
+
+/// @fn static bool jsonBuilderNull(void *context)
+///
+/// @brief JsonSaxHandler callback for null.
+///
+/// @param context The JsonBuilder that is parsing.
+///
+/// @return Returns true on success, false on failure.
+static bool jsonBuilderNull(void *context) {
+  return jsonBuilderAdd((JsonBuilder*) context, NULL,
+    typePointer, typePointer);
+}
+
+/// @var jsonBuilderHandler
+///
+/// @brief The callbacks jsonToDataStructure gives to jsonSaxParse.
+static const JsonSaxHandler jsonBuilderHandler = {
+  jsonBuilderStartObject,
+  jsonBuilderEnd,
+  jsonBuilderStartArray,
+  jsonBuilderEnd,
+  jsonBuilderKey,
+  jsonBuilderString,
+  jsonBuilderInteger,
+  jsonBuilderDouble,
+  jsonBuilderBoolean,
+  jsonBuilderNull
+};
+
+/// @fn void* jsonToDataStructure(const char *jsonText, long long int *position, const JsonContainerOps *ops)
+///
+/// @brief Build a data structure from JSON text with jsonSaxParse.  This is
+/// the implementation of jsonToVector and of the jsonTo* functions generated
+/// by JSON_TO_DATA_STRUCTURE.  Nested objects are built with the same
+/// operations as the object that holds them, arrays become Vectors, and
+/// objects within arrays become HashTables.
+///
+/// @param jsonText The text to convert.
+/// @param position A pointer to the current byte postion within the jsonText.
+///   Moved past the end of the parsed value on success.
+/// @param ops The operations for the outermost data structure.  ops->isArray
+///   determines whether the text must hold an array or an object.
+///
+/// @return Returns a pointer to a new data structure on success, NULL on
+/// failure.
+void* jsonToDataStructure(const char *jsonText, long long int *position,
+  const JsonContainerOps *ops
+) {
+  if (jsonText == NULL) {
+    printLog(ERR, "jsonText parameter is NULL.\n");
+    return NULL;
+  } else if ((position == NULL) || (*position < 0)) {
+    printLog(ERR, "position parameter is invalid.\n");
+    return NULL;
+  } else if (ops == NULL) {
+    printLog(ERR, "ops parameter is NULL.\n");
+    return NULL;
+  }
+  
+  JsonBuilder builder = { ops, NULL, 0, 0, NULL };
+  u64 offset = (u64) *position;
+  if (jsonSaxParse(jsonText, (u64) -1, &jsonBuilderHandler, &builder, &offset)
+    == true
+  ) {
+    *position = (long long int) offset;
+  } else {
+    printLog(ERR, "Malformed JSON input.\n");
+    // Destroy whatever was partially built, innermost first.
+    while (builder.depth > 0) {
+      JsonBuilderFrame *frame = &builder.frames[--builder.depth];
+      frame->key = bytesDestroy(frame->key);
+      frame->ops->destroy(frame->container);
+    }
+  }
+  free(builder.frames);
+  
+  return builder.result;
+}
+
+/// @fn Vector* jsonToVector(const char *jsonText, long long int *position)
+///
+/// @brief Converts a JSON-formatted array to a Vector.  Objects within the
+/// array become HashTables.
+///
+/// @param jsonText The text to convert.
+/// @param position A pointer to the current byte postion within the jsonText.
+///
+/// @return Returns a pointer to a new Vector on success, NULL on failure.
+Vector* jsonToVector(const char *jsonText, long long int *position) {
+  printLog(TRACE, "ENTER jsonToVector(jsonText=\"%s\", position=%p)\n",
+    (jsonText != NULL) ? jsonText : "NULL", position);
+  
+  Vector *returnValue = (Vector*) jsonToDataStructure(jsonText, position,
+    &vectorJsonContainerOps);
+  
+  printLog(TRACE, "EXIT jsonToVector(jsonText=\"%s\", position=%lld) = {%p}\n",
+    (jsonText != NULL) ? jsonText : "NULL",
+    lli((position != NULL) ? *position : -1), returnValue);
+  return returnValue;
+}
+
+/// @struct VectorClearJob
+///
+/// @brief The parameters of a vectorClearParallel call.
+///
+/// @param vector The Vector being cleared.
+/// @param keyType The type to destroy the keys with.
+typedef struct VectorClearJob {
+  Vector *vector;
+  TypeDescriptor *keyType;
+} VectorClearJob;
+
+/// @fn static void vectorClearTask(void *job, u64 task, u64 numTasks)
+///
+/// @brief Destroy the contents of one share of the nodes of a Vector.
+///
+/// @param job The VectorClearJob.
+/// @param task The task number.
+/// @param numTasks The number of tasks.
+///
+/// @return This function returns no value.
+static void vectorClearTask(void *job, u64 task, u64 numTasks) {
+  VectorClearJob *clearJob = (VectorClearJob*) job;
+  VectorNode *array = clearJob->vector->array;
+  TypeDescriptor *keyType = clearJob->keyType;
+  u64 arraySize = clearJob->vector->arraySize;
+  u64 end = vectorTaskStart(arraySize, task + 1, numTasks);
+  
+  for (u64 ii = vectorTaskStart(arraySize, task, numTasks); ii < end; ii++) {
+    VectorNode *node = &array[ii];
+    if (node->allocated == false) {
+      continue;
+    }
+    
+    node->key = keyType->destroy(node->key);
+    // Values of non-pointer types live in the data array and are not ours to
+    // free.
+    if (node->type->dataIsPointer == true) {
+      node->value = node->type->destroy(node->value);
+    }
+    node->allocated = false;
+  }
+}
+
+/// @fn i32 vectorClearParallel(Vector *vector, u32 numThreads)
+///
+/// @brief Clear and deallocate the contents of a previously-allocated Vector,
+/// but do not deallocate the Vector object itself, splitting the work across
+/// threads.
+///
+/// @param vector The Vector to clear.
+/// @param numThreads The number of threads to use.  0 means one per online
+///   CPU.  Fewer are used for small vectors.
+///
+/// @return Returns 0 on success, -1 on failure.
+i32 vectorClearParallel(Vector *vector, u32 numThreads) {
+  printLog(TRACE, "ENTER vectorClearParallel(vector=%p, numThreads=%u)\n",
+    vector, numThreads);
+  
+  i32 returnValue = 0;
+  if (vector == NULL) {
+    printLog(ERR, "NULL vector provided.\n");
+    printLog(TRACE,
+      "EXIT vectorClearParallel(vector=NULL, numThreads=%u) = {-1}\n",
+      numThreads);
+    return -1;
+  }
+  
+  if ((vector->lock != NULL) && (mtx_lock(vector->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock vector mutex.\n");
+  }
+  
+  VectorClearJob job = { vector, vector->keyType };
+  if (job.keyType == NULL) {
+    job.keyType = typePointerNoOwn;
+  }
+  vectorRunTasks(vectorClearTask, &job,
+    vectorNumTasks(numThreads, vector->arraySize));
+  
+  vector->size = 0;
+  vector->head = NULL;
+  vector->tail = NULL;
+  
+  if (vector->filePointer != NULL) {
+    fclose(vector->filePointer); vector->filePointer = NULL;
+  }
+  
+  // Do *NOT* alter the storage of the array or change the arraySize.  The only
+  // time we ever actually shrink the array is when we destroy the Vector.
+  
+  if (vector->lock != NULL) {
+    mtx_unlock(vector->lock);
+  }
+  
+  printLog(TRACE, "EXIT vectorClearParallel(vector=%p, numThreads=%u) = {%d}\n",
+    vector, numThreads, returnValue);
+  return returnValue;
+}
+
+/// @fn i32 vectorClear(Vector *vector)
+///
+/// @brief Clear and deallocate the contents of a previously-allocated Vector,
+/// but do not deallocate the Vector object itself.
+///
+/// @param vector The Vector to clear.
+///
+/// @return Returns 0 on success, -1 on failure.
+i32 vectorClear(Vector *vector) {
+  printLog(TRACE, "ENTER vectorClear(vector=%p)\n", vector);
+  
+  i32 returnValue = vectorClearParallel(vector, 1);
+  
+  printLog(TRACE, "EXIT vectorClear(vector=%p) = {%d}\n", vector, returnValue);
+  return returnValue;
+}
+
+/// @fn int vectorStats(Vector *vector, VectorStats *stats)
 ///
-/// @brief Converts a Vector to a JSON-formatted string.  This function will
-///   always return an allocated string, even if it's a zero-length (one null
-///   byte) string.
+/// @brief Get the occupancy and approximate memory footprint of a Vector.
 ///
-/// @param vector is the Vector to convert.
+/// @param vector The Vector of interest.
+/// @param stats The VectorStats to fill in.
 ///
-/// @return Returns a JSON-formatted Bytes object representation of the vector.
-Bytes vectorToJson(const Vector *vector) {
-  printLog(TRACE, "ENTER vectorToJson(vector=%p)\n", vector);
-  
-  Bytes returnValue = NULL;
-  VectorNode *node = NULL;
+/// @return Returns 0 on success, -1 on failure.
+int vectorStats(Vector *vector, VectorStats *stats) {
+  printLog(TRACE, "ENTER vectorStats(vector=%p, stats=%p)\n", vector, stats);
   
-  if (vector == NULL) {
-    printLog(ERR, "Vector provided was NULL.\n");
-    bytesAllocate(&returnValue, 0);
-    
-    printLog(TRACE, "EXIT vectorToJson(vector=%p) = {%s}\n", vector, returnValue);
-    return returnValue;
+  if ((vector == NULL) || (stats == NULL)) {
+    printLog(ERR, "NULL parameter provided.\n");
+    printLog(TRACE, "EXIT vectorStats(vector=%p, stats=%p) = {-1}\n",
+      vector, stats);
+    return -1;
   }
+  memset(stats, 0, sizeof(*stats));
   
   if ((vector->lock != NULL) && (mtx_lock(vector->lock) != thrd_success)) {
     printLog(WARN, "Could not lock vector mutex.\n");
   }
   
-  int listTypeIndex = getIndexFromTypeDescriptor(typeList);
-  bytesAddStr(&returnValue, "[\n");
-  for (node = vector->head; node != NULL; node = node->next) {
-    if (getIndexFromTypeDescriptor(node->type) < listTypeIndex) {
-      // Append end of key, start of value.
-      bytesAddStr(&returnValue, "  ");
-      if ((node->type == typeString) || (node->type == typeStringNoCopy)
-        || (node->type == typeBytes) || (node->type == typeBytesNoCopy)
-      ) {
-        bytesAddStr(&returnValue, "\"");
-      }
-      char *valueString = node->type->toString(node->value);
-      bytesAddStr(&returnValue, valueString);
-      valueString = stringDestroy(valueString);
-      if ((node->type == typeString) || (node->type == typeStringNoCopy)
-        || (node->type == typeBytes) || (node->type == typeBytesNoCopy)
-      ) {
-        bytesAddStr(&returnValue, "\"");
-      }
-    } else if ((node->type == typePointer) && (node->value == NULL)) {
-      // NULL value.
-      bytesAddStr(&returnValue, "  null");
-    } else if (node->type == typeVector) {
-      // Value's type is a vector data structure, not a primitive.
-      Bytes valueString = vectorToJson((Vector*) node->value);
-      char *indentedValue = indentText(str(valueString), 2);
-      valueString = bytesDestroy(valueString);
-      bytesAddStr(&returnValue, indentedValue);
-      indentedValue = stringDestroy(indentedValue);
-    } else {
-      // Value's type is a non-vector data structure, not a primitive.
-      Bytes valueString = listToJson((List*) node->value);
-      char *indentedValue = indentText(str(valueString), 2);
-      valueString = bytesDestroy(valueString);
-      bytesAddStr(&returnValue, indentedValue);
-      indentedValue = stringDestroy(indentedValue);
+  bool dataIsPointer = false;
+  if (vector->valueType != NULL) {
+    dataIsPointer = vector->valueType->dataIsPointer;
+    stats->elementSize = sizeof(void*);
+    if (dataIsPointer == false) {
+      // Need to provide a non-NULL value to valueType->size().
+      stats->elementSize = vector->valueType->size(VOID_POINTER_TRUE);
     }
-    
-    if (node->next != NULL) {
-      // End of the vector
-      bytesAddStr(&returnValue, ",\n");
+  }
+  
+  stats->size = vector->size;
+  stats->arraySize = vector->arraySize;
+  stats->memoryBytes = sizeof(Vector)
+    + (vector->arraySize * sizeof(VectorNode));
+  if (vector->lock != NULL) {
+    stats->memoryBytes += sizeof(mtx_t);
+  }
+  if (vector->data != NULL) {
+    stats->memoryBytes += vector->arraySize * stats->elementSize;
+  }
+  
+  VectorNode *array = vector->array;
+  for (u64 ii = 0; ii < vector->size; ii++) {
+    if (array[ii].allocated == false) {
+      continue;
     }
+    stats->allocatedEntries++;
+    if (array[ii].key != NULL) {
+      stats->memoryBytes += vector->keyType->size(array[ii].key);
+    }
+    if ((dataIsPointer == true) && (array[ii].value != NULL)) {
+      stats->memoryBytes += array[ii].type->size(array[ii].value);
+    }
+  }
+  
+  if (vector->arraySize > 0) {
+    stats->fillRatio = ((double) stats->allocatedEntries)
+      / ((double) vector->arraySize);
   }
-  bytesAddStr(&returnValue, "\n]");
+  stats->unusedBytes = (vector->arraySize - stats->allocatedEntries)
+    * (sizeof(VectorNode) + ((vector->data != NULL) ? stats->elementSize : 0));
   
   if (vector->lock != NULL) {
     mtx_unlock(vector->lock);
   }
   
-  printLog(TRACE, "EXIT vectorToJson(vector=%p) = {%s}\n", vector, returnValue);
-  return returnValue;
+  printLog(TRACE, "EXIT vectorStats(vector=%p, stats=%p) = {0}\n",
+    vector, stats);
+  return 0;
 }
 
-/// @fn Vector* jsonToVector(const char *jsonText, long long int *position)
+/// @struct VectorForEachJob
 ///
-/// @brief Converts a JSON-formatted string to a list.
+/// @brief The parameters of a vectorForEach call.
 ///
-/// @param jsonText The text to convert.
-/// @param position A pointer to the current byte postion within the jsonText.
+/// @param vector The Vector being visited.
+/// @param function The function to call on each node.
+/// @param context The context to pass to function.
+typedef struct VectorForEachJob {
+  Vector *vector;
+  VectorForEachFunction function;
+  void *context;
+} VectorForEachJob;
+
+/// @fn static void vectorForEachTask(void *job, u64 task, u64 numTasks)
 ///
-/// @return Returns a pointer to a new Vector on success, NULL on failure.
-Vector* jsonToVector(const char *jsonText, long long int *position) {
-  printLog(TRACE, "ENTER jsonToVector(jsonText=\"%s\", position=%p)\n",
-    (jsonText != NULL) ? jsonText : "NULL", position);
-  Vector *returnValue = NULL;
+/// @brief Call a vectorForEach function on one share of a Vector's nodes.
+///
+/// @param job The VectorForEachJob.
+/// @param task The task number.
+/// @param numTasks The number of tasks.
+///
+/// @return This function returns no value.
+static void vectorForEachTask(void *job, u64 task, u64 numTasks) {
+  VectorForEachJob *forEachJob = (VectorForEachJob*) job;
+  VectorNode *array = forEachJob->vector->array;
+  u64 size = forEachJob->vector->size;
+  u64 end = vectorTaskStart(size, task + 1, numTasks);
   
-  if (jsonText == NULL) {
-    printLog(ERR, "jsonText parameter is NULL.\n");
-    printLog(TRACE, "EXIT jsonToVector(jsonText=NULL, position=%p) = {NULL}\n",
-      position);
-    return NULL;
-  } else if (position == NULL) {
-    printLog(ERR, "position parameter is NULL.\n");
-    printLog(TRACE,
-      "EXIT jsonToVector(jsonText=\"%s\", position=NULL) = {NULL}\n",
-      jsonText);
+  for (u64 ii = vectorTaskStart(size, task, numTasks); ii < end; ii++) {
+    if (array[ii].allocated == true) {
+      forEachJob->function(&array[ii], forEachJob->context);
+    }
   }
+}
+
+/// @fn i32 vectorForEach_(Vector *vector, VectorForEachFunction function, void *context, u32 numThreads, ...)
+///
+/// @brief Call a function on every allocated node of a Vector.  When more
+/// than one thread is used, each thread visits its own contiguous share of
+/// the nodes in index order, so function must be safe to call concurrently
+/// on different nodes with the same context.
+///
+/// @param vector The Vector to visit.
+/// @param function The function to call on each node.
+/// @param context The context to pass to function.
+/// @param numThreads The number of threads to use.  0 means one per online
+///   CPU.  Fewer are used for small vectors.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides 1 for numThreads.
+///
+/// @return Returns 0 on success, -1 on failure.
+i32 vectorForEach_(Vector *vector, VectorForEachFunction function,
+  void *context, u32 numThreads, ...
+) {
+  printLog(TRACE,
+    "ENTER vectorForEach(vector=%p, function=%p, context=%p, numThreads=%u)\n",
+    vector, function, context, numThreads);
   
-  const char *charAt
-    = &(jsonText[*position + strspn(&jsonText[*position], " \t\r\n")]);
-  if (*charAt != '[') {
-    printLog(ERR, "No opening bracket in jsonText.  Malformed JSON input.\n");
+  if ((vector == NULL) || (function == NULL)) {
+    printLog(ERR, "vector or function is NULL.\n");
     printLog(TRACE,
-      "EXIT jsonToVector(jsonText=\"%s\", position=%lld) = {NULL}\n",
-      jsonText, lli(*position));
-    return NULL;
+      "EXIT vectorForEach(vector=%p, function=%p, context=%p, numThreads=%u) "
+      "= {-1}\n", vector, function, context, numThreads);
+    return -1;
+  }
+  
+  if ((vector->lock != NULL) && (mtx_lock(vector->lock) != thrd_success)) {
+    printLog(WARN, "Could not lock vector mutex.\n");
+  }
+  
+  VectorForEachJob job = { vector, function, context };
+  vectorRunTasks(vectorForEachTask, &job,
+    vectorNumTasks(numThreads, vector->size));
+  
+  if (vector->lock != NULL) {
+    mtx_unlock(vector->lock);
   }
   
-  returnValue = vectorCreate(typeString);
-  int i = 0;
+  printLog(TRACE,
+    "EXIT vectorForEach(vector=%p, function=%p, context=%p, numThreads=%u) "
+    "= {0}\n", vector, function, context, numThreads);
+  return 0;
+}
+
+/// @struct VectorMapJob
+///
+/// @brief The parameters of a vectorMap call.
+///
+/// @param source The Vector being mapped.
+/// @param destination The Vector receiving the mapped values.
+/// @param function The function that produces each mapped value.
+/// @param context The context to pass to function.
+/// @param copyKeys Whether or not the source keys are copied to the
+///   destination.
+/// @param failed Set by any task whose function call fails.
+typedef struct VectorMapJob {
+  Vector *source;
+  Vector *destination;
+  VectorMapFunction function;
+  void *context;
+  bool copyKeys;
+  bool failed;
+} VectorMapJob;
+
+/// @fn static void vectorMapTask(void *job, u64 task, u64 numTasks)
+///
+/// @brief Map one share of the nodes of a Vector into a new Vector.
+///
+/// @param job The VectorMapJob.
+/// @param task The task number.
+/// @param numTasks The number of tasks.
+///
+/// @return This function returns no value.
+static void vectorMapTask(void *job, u64 task, u64 numTasks) {
+  VectorMapJob *mapJob = (VectorMapJob*) job;
+  VectorNode *sourceArray = mapJob->source->array;
+  VectorNode *destinationArray = mapJob->destination->array;
+  TypeDescriptor *valueType = mapJob->destination->valueType;
+  TypeDescriptor *keyType = mapJob->destination->keyType;
+  void **data = (void**) mapJob->destination->data;
+  u64 size = mapJob->source->size;
+  u64 end = vectorTaskStart(size, task + 1, numTasks);
   
-  *position += ((long long int) ((intptr_t) charAt))
-    - ((long long int) ((intptr_t) &jsonText[*position]));
-  (*position)++;
-  while ((*position >= 0) && (jsonText[*position] != '\0')) {
-    *position += strspn(&jsonText[*position], " \t\r\n");
-    char charAtPosition = jsonText[*position];
-    if (charAtPosition == ']') {
-      // End of vector.
-      (*position)++;
-      break;
+  for (u64 ii = vectorTaskStart(size, task, numTasks); ii < end; ii++) {
+    if (__atomic_load_n(&mapJob->failed, __ATOMIC_RELAXED) == true) {
+      return;
     }
     
-    if ((charAtPosition != '"') && (charAtPosition != '{')
-      && (charAtPosition != '[') && !stringIsNumber(&jsonText[*position])
-      && !stringIsBoolean(&jsonText[*position])
-      && (strncmp(&jsonText[*position], "null", 4) != 0)
-    ) {
-      printLog(ERR, "Malformed JSON input.\n");
-      returnValue = vectorDestroy(returnValue);
-      printLog(TRACE,
-        "EXIT jsonToVector(jsonText=\"%s\", position=%lld) = {NULL}\n", jsonText,
-        lli(*position));
-      return NULL;
+    VectorNode *source = &sourceArray[ii];
+    if (source->allocated == false) {
+      continue;
     }
-    if (charAtPosition == '"') {
-      // Get the string between the quotes.
-      Bytes stringValue = getBytesBetween(&jsonText[*position], "\"", "\"");
-      vectorSetEntry(returnValue, i++, stringValue, typeString);
-      *position += bytesLength(stringValue) + 2;
-      stringValue = bytesDestroy(stringValue);
-    } else if (stringIsNumber(&jsonText[*position])) {
-      // Parse the number.
-      char *endpos = NULL;
-      if (stringIsInteger(&jsonText[*position])) {
-        i64 longLongValue = (i64) strtoll(&jsonText[*position], &endpos, 10);
-        vectorSetEntry(returnValue, i++, &longLongValue, typeI64);
-      } else { // stringIsFloat(&jsonText[*position])
-        double doubleValue = strtod(&jsonText[*position], &endpos);
-        vectorSetEntry(returnValue, i++, &doubleValue, typeDouble);
-      }
-      *position
-        += ((long long int) ((intptr_t) endpos))
-        - ((long long int) ((intptr_t) &jsonText[*position]));
-    } else if (stringIsBoolean(&jsonText[*position])) {
-      // Parse the boolean.
-      char *endpos = NULL;
-      bool boolValue = strtobool(&jsonText[*position], &endpos);
-      vectorSetEntry(returnValue, i++, &boolValue, typeBool);
-      *position
-        += ((long long int) ((intptr_t) endpos))
-        - ((long long int) ((intptr_t) &jsonText[*position]));
-    } else if (charAtPosition == '{') {
-      // Parse the key-value data structure (list).
-      HashTable *dataStructure = jsonToHashTable(jsonText, position);
-      if (dataStructure == NULL) {
-        printLog(ERR, "Malformed JSON input.\n");
-        returnValue = vectorDestroy(returnValue);
-        printLog(TRACE,
-          "EXIT jsonToVector(jsonText=\"%s\", position=%lld) = {NULL}\n",
-          jsonText, lli(*position));
-        return returnValue;
-      }
-      VectorNode *node = vectorSetEntry(returnValue, i++, dataStructure,
-        typeHashTableNoCopy);
-      node->type = typeHashTable;
-      // position is automatically updated in this case.
-    } else if (charAtPosition == '[') {
-      // Parse the vector.
-      Vector *vector = jsonToVector(jsonText, position);
-      if (vector == NULL) {
-        printLog(ERR, "Malformed JSON input.\n");
-        returnValue = vectorDestroy(returnValue);
-        printLog(TRACE,
-          "EXIT jsonToVector(jsonText=\"%s\", position=%lld) = {NULL}\n",
-          jsonText, lli(*position));
-        return returnValue;
-      }
-      VectorNode *node = vectorSetEntry(returnValue, i++, vector, typeVectorNoCopy);
-      node->type = typeVector;
-      // position is automatically updated in this case.
-    } else { // (strncmp(&jsonText[*position], "null", 4) != 0)
-      vectorSetEntry(returnValue, i++, NULL, typePointer);
-      *position += 4;
+    
+    VectorNode *destination = &destinationArray[ii];
+    void *value = (void*) destination->value;
+    if (valueType->dataIsPointer == true) {
+      destination->value = NULL;
+      value = (void*) &destination->value;
+    }
+    if (mapJob->function(source, value, mapJob->context) == false) {
+      __atomic_store_n(&mapJob->failed, true, __ATOMIC_RELAXED);
+      return;
+    }
+    if (valueType->dataIsPointer == true) {
+      data[ii] = (void*) destination->value;
     }
-    *position += strspn(&jsonText[*position], " \t\r\n");;
-    if (jsonText[*position] == ',') {
-      (*position)++;
+    
+    destination->type = valueType;
+    if (mapJob->copyKeys == true) {
+      destination->key = keyType->copy(source->key);
     }
+    destination->byteOffset = 0;
+    destination->allocated = true;
   }
-  
-  printLog(TRACE, "EXIT jsonToVector(jsonText=\"%s\", position=%lld) = {%p}\n",
-    jsonText, lli(*position), returnValue);
-  return returnValue;
 }
 
-/// @fn i32 vectorClear(Vector *vector)
+/// @fn Vector* vectorMap_(Vector *vector, TypeDescriptor *valueType, VectorMapFunction function, void *context, u32 numThreads, ...)
 ///
-/// @brief Clear and deallocate the contents of a previously-allocated Vector,
-/// but do not deallocate the Vector object itself.
+/// @brief Create a new Vector holding the result of calling a function on
+/// every allocated node of a Vector.  Mapped values keep the indexes of the
+/// nodes they came from and keys are copied across.  When more than one
+/// thread is used, function must be safe to call concurrently on different
+/// nodes with the same context.
 ///
-/// @param vector The Vector to clear.
+/// @param vector The Vector to map.
+/// @param valueType The type of the mapped values.
+/// @param function The function that produces each mapped value.  It is
+///   passed the source node, a pointer to the storage for the mapped value,
+///   and context.  For types whose dataIsPointer is true, the storage is a
+///   pointer that function sets to a value the new Vector will own.  For all
+///   other types, it is valueType->size() bytes that function fills in.  It
+///   returns true on success and false on failure.
+/// @param context The context to pass to function.
+/// @param numThreads The number of threads to use.  0 means one per online
+///   CPU.  Fewer are used for small vectors.
 ///
-/// @return This function returns no value.
-i32 vectorClear(Vector *vector) {
-  printLog(TRACE, "ENTER vectorClear(vector=%p)\n", vector);
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides 1 for numThreads.
+///
+/// @return Returns a new Vector on success, NULL on failure, including the
+/// failure of any call to function.
+Vector* vectorMap_(Vector *vector, TypeDescriptor *valueType,
+  VectorMapFunction function, void *context, u32 numThreads, ...
+) {
+  printLog(TRACE,
+    "ENTER vectorMap(vector=%p, valueType=%s, function=%p, context=%p, "
+    "numThreads=%u)\n", vector,
+    (valueType != NULL) ? valueType->name : "NULL",
+    function, context, numThreads);
   
-  i32 returnValue = 0;
-  if (vector == NULL) {
-    printLog(ERR, "NULL vector provided.\n");
-    printLog(TRACE, "EXIT vectorClear(vector=NULL) = {-1}\n");
-    return -1;
+  Vector *returnValue = NULL;
+  if ((vector == NULL) || (valueType == NULL) || (function == NULL)) {
+    printLog(ERR, "vector, valueType, or function is NULL.\n");
+    printLog(TRACE,
+      "EXIT vectorMap(vector=%p, valueType=%s, function=%p, context=%p, "
+      "numThreads=%u) = {%p}\n", vector,
+      (valueType != NULL) ? valueType->name : "NULL",
+      function, context, numThreads, returnValue);
+    return returnValue; // NULL
   }
   
   if ((vector->lock != NULL) && (mtx_lock(vector->lock) != thrd_success)) {
     printLog(WARN, "Could not lock vector mutex.\n");
   }
   
-  VectorNode *node = vector->head;
-  TypeDescriptor *keyType = vector->keyType;
-  if (keyType == NULL) {
-    keyType = typePointerNoOwn;
-  }
-  while (node != NULL) {
-    VectorNode *nextNode = node->next;
+  // A plain vector uses its value type as its key type, so the new vector
+  // does too.  A key-value vector keeps its keys.
+  bool copyKeys = (vector->keyType != vector->valueType);
+  returnValue = vectorCreate_(
+    (copyKeys == true) ? vector->keyType : valueType, valueType,
+    (vector->lock == NULL), vector->size);
+  if (returnValue == NULL) {
+    LOG_MALLOC_FAILURE();
+  } else if (vector->size > 0) {
+    VectorMapJob job = {
+      vector, returnValue, function, context, copyKeys, false
+    };
+    vectorRunTasks(vectorMapTask, &job,
+      vectorNumTasks(numThreads, vector->size));
     
-    keyType->destroy(node->key);
-    if (node->type != NULL) {
-      node->type->destroy(node->value);
+    returnValue->size = vector->size;
+    returnValue->head = &returnValue->array[0];
+    returnValue->tail = &returnValue->array[returnValue->size - 1];
+    if (job.failed == true) {
+      printLog(ERR, "Could not map a value of the vector.\n");
+      returnValue = vectorDestroy(returnValue);
     }
-    node->allocated = false;
-    
-    node = nextNode;
-  }
-  
-  vector->size = 0;
-  vector->head = NULL;
-  vector->tail = NULL;
-  
-  if (vector->filePointer != NULL) {
-    fclose(vector->filePointer); vector->filePointer = NULL;
   }
   
-  // Do *NOT* alter the storage of the array or change the arraySize.  The only
-  // time we ever actually shrink the array is when we destroy the Vector.
-  
   if (vector->lock != NULL) {
     mtx_unlock(vector->lock);
   }
   
-  printLog(TRACE, "EXIT vectorClear(vector=%p) = {%d}\n", vector, returnValue);
+  printLog(TRACE,
+    "EXIT vectorMap(vector=%p, valueType=%s, function=%p, context=%p, "
+    "numThreads=%u) = {%p}\n", vector, valueType->name,
+    function, context, numThreads, returnValue);
   return returnValue;
 }
 
@@ -1751,6 +3551,9 @@ TypeDescriptor _typeVector = {
   .clear         = (i32 (*)(volatile void*)) vectorClear,
   .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) vectorToXml_,
   .toJson        = (Bytes (*)(const volatile void*)) vectorToJson,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) vectorToJsonStream,
+  .blobSize      = (u64 (*)(const volatile void*)) listToBlobSize,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) listToBlobBuffer,
 };
 TypeDescriptor *typeVector = &_typeVector;
 
@@ -1782,9 +3585,47 @@ TypeDescriptor _typeVectorNoCopy = {
   .clear         = (i32 (*)(volatile void*)) vectorClear,
   .toXml         = (Bytes (*)(const volatile void*, const char *elementName, bool indent, ...)) vectorToXml_,
   .toJson        = (Bytes (*)(const volatile void*)) vectorToJson,
+  .toJsonStream  = (bool (*)(const volatile void*, JsonWriter*)) vectorToJsonStream,
+  .blobSize      = (u64 (*)(const volatile void*)) listToBlobSize,
+  .toBlobBuffer  = (u64 (*)(const volatile void*, void*, u64)) listToBlobBuffer,
 };
 TypeDescriptor *typeVectorNoCopy = &_typeVectorNoCopy;
 
+/// @fn static void vectorTestSum(VectorNode *node, void *context)
+///
+/// @brief VectorForEachFunction for vectorUnitTest that adds an i64 value to
+/// the u64 pointed to by context.
+///
+/// @param node The node being visited.
+/// @param context A pointer to the running sum.
+///
+/// @return This function returns no value.
+static void vectorTestSum(VectorNode *node, void *context) {
+  __atomic_add_fetch((u64*) context, (u64) *((i64*) node->value),
+    __ATOMIC_SEQ_CST);
+}
+
+/// @fn static bool vectorTestDouble(const VectorNode *node, void *value, void *context)
+///
+/// @brief VectorMapFunction for vectorUnitTest that doubles an i64 value.
+///
+/// @param node The source node.
+/// @param value The storage for the mapped i64.
+/// @param context A pointer to an i64 value that fails the mapping, or NULL.
+///
+/// @return Returns false if the source value is the one in context, true
+/// otherwise.
+static bool vectorTestDouble(const VectorNode *node, void *value,
+  void *context
+) {
+  i64 sourceValue = *((i64*) node->value);
+  if ((context != NULL) && (sourceValue == *((i64*) context))) {
+    return false;
+  }
+  *((i64*) value) = sourceValue * 2;
+  return true;
+}
+
 //// /// @def VECTOR_UNIT_TEST
 //// ///
 //// /// @brief Unit test functionality for vector data structure.
@@ -2242,6 +4083,21 @@ bool vectorUnitTest() {
   } 
   vector = vectorDestroy(vector); 
   
+  // Braces and escaped quotes inside of strings must not end the array, and
+  // objects within arrays become HashTables.
+  jsonPosition = 0;
+  vector = jsonToVector(
+    " [\"}]\\\"{\", {\"key\": \"value\"}, [ ]] trailing", &jsonPosition);
+  if ((vector == NULL) || (vector->size != 3) || (jsonPosition != 33)
+    || (strcmp((char*) vectorGetValue(vector, 0), "}]\\\"{") != 0)
+    || (vectorGetEntry(vector, 1)->type != typeHashTable)
+    || (vectorGetEntry(vector, 2)->type != typeVector)
+  ) {
+    printLog(ERR, "Nested JSON array was not parsed correctly.\n");
+    return false;
+  }
+  vector = vectorDestroy(vector);
+  
   const char *jsonString = "{\n" 
     "  \"myVector1\": {\n" 
     "    \"key1\": \"value1\",\n" 
@@ -2389,6 +4245,209 @@ bool vectorUnitTest() {
   } 
   byteArray = bytesDestroy(byteArray); 
   vector = vectorDestroy(vector); 
+   
+  vector = vectorCreate(typeI64); 
+  i64 rangeValues[1000]; 
+  for (i64 ii = 0; ii < 1000; ii++) { 
+    rangeValues[ii] = 1000 - ii; 
+  } 
+  if (vectorSetI64Range(vector, 0, rangeValues, 1000) != 0) { 
+    printLog(ERR, "vectorSetI64Range on empty vector failed.\n"); 
+    return false; 
+  } 
+  if (vectorSetRange(vector, 0, rangeValues, 1000, typeI32) == 0) { 
+    printLog(ERR, "vectorSetRange with mismatched type succeeded.\n"); 
+    return false; 
+  } 
+  if (vectorSetI64Range(vector, 990, rangeValues, 20) != 0) { 
+    printLog(ERR, "vectorSetI64Range past end of vector failed.\n"); 
+    return false; 
+  } 
+  if ((vector->size != 1010) || (vectorGetI64(vector, 995) != 995) 
+    || (vectorGetI64(vector, 1009) != 981) 
+    || (*((i64*) vectorGetValue(vector, 500)) != 500) 
+    || (vectorGetI64(vector, 1010) != 0) 
+  ) { 
+    printLog(ERR, "Unexpected contents after vectorSetI64Range.\n"); 
+    return false; 
+  } 
+  vectorSort(vector, ASCENDING, true); 
+  i64 *rangeData = vectorI64Data(vector); 
+  if ((rangeData == NULL) || (vectorDoubleData(vector) != NULL)) { 
+    printLog(ERR, "vectorI64Data returned unexpected array.\n"); 
+    return false; 
+  } 
+  for (u64 ii = 1; ii < vector->size; ii++) { 
+    if (rangeData[ii - 1] > rangeData[ii]) { 
+      printLog(ERR, "vectorI64Data not sorted at index %llu.\n", llu(ii)); 
+      return false; 
+    } 
+  } 
+  vector = vectorDestroy(vector); 
+   
+  // The parallel functions only split vectors of more than
+  // VECTOR_PARALLEL_MIN_CHUNK nodes, so use enough for four shares. 
+  const u64 numParallel = 4 * VECTOR_PARALLEL_MIN_CHUNK + 4464; 
+  vector = kvVectorCreate(typeU64, typeI64); 
+  for (u64 ii = 0; ii < numParallel; ii++) { 
+    i64 sortValue = (i64) ((ii * 7919) % 97); 
+    if (kvVectorAddEntry(vector, &ii, &sortValue) == NULL) { 
+      printLog(ERR, "Could not add entry %llu to key-value vector.\n", 
+        llu(ii)); 
+      return false; 
+    } 
+  } 
+  vector2 = vectorCopy(vector); 
+  if (vectorSort(vector, ASCENDING, true) == NULL) { 
+    printLog(ERR, "vectorSort of key-value vector failed.\n"); 
+    return false; 
+  } 
+  if (vectorSortParallel(vector2, ASCENDING, true, 4) == NULL) { 
+    printLog(ERR, "vectorSortParallel of key-value vector failed.\n"); 
+    return false; 
+  } 
+  for (u64 ii = 0; ii < numParallel; ii++) { 
+    VectorNode *serialNode = vectorGetEntry(vector, ii); 
+    VectorNode *parallelNode = vectorGetEntry(vector2, ii); 
+    if ((*((i64*) serialNode->value) != *((i64*) parallelNode->value)) 
+      || (*((u64*) serialNode->key) != *((u64*) parallelNode->key)) 
+    ) { 
+      printLog(ERR, "vectorSortParallel differs from vectorSort at index " 
+        "%llu.\n", llu(ii)); 
+      return false; 
+    } 
+    if (ii == 0) { 
+      continue; 
+    } 
+    VectorNode *previousNode = vectorGetEntry(vector2, ii - 1); 
+    if ((*((i64*) previousNode->value) > *((i64*) parallelNode->value)) 
+      || ((*((i64*) previousNode->value) == *((i64*) parallelNode->value)) 
+        && (*((u64*) previousNode->key) > *((u64*) parallelNode->key))) 
+    ) { 
+      printLog(ERR, "vectorSortParallel not stably sorted at index %llu.\n", 
+        llu(ii)); 
+      return false; 
+    } 
+  } 
+  vector2 = vectorDestroy(vector2); 
+  vector = vectorDestroy(vector); 
+   
+  vector = vectorCreate(typeI64); 
+  for (u64 ii = 0; ii < numParallel; ii++) { 
+    i64 parallelValue = (i64) ii; 
+    if (vectorSetI64Range(vector, ii, &parallelValue, 1) != 0) { 
+      printLog(ERR, "Could not set index %llu of i64 vector.\n", llu(ii)); 
+      return false; 
+    } 
+  } 
+  vector2 = vectorCopyParallel(vector, 4); 
+  if ((vector2 == NULL) || (vector2->size != numParallel)) { 
+    printLog(ERR, "vectorCopyParallel did not copy every node.\n"); 
+    return false; 
+  } 
+  for (u64 ii = 0; ii < numParallel; ii++) { 
+    if (vectorGetI64(vector2, ii) != (i64) ii) { 
+      printLog(ERR, "vectorCopyParallel copy differs at index %llu.\n", 
+        llu(ii)); 
+      return false; 
+    } 
+  } 
+  if ((vectorCompareParallel(vector, vector2, 4) != 0) 
+    || (vectorCompare(vector, vector2) != 0) 
+  ) { 
+    printLog(ERR, "Parallel copy did not compare equal to its source.\n"); 
+    return false; 
+  } 
+  // A difference in the last share only. 
+  i64 lowValue = -1; 
+  vectorSetI64Range(vector2, numParallel - 10, &lowValue, 1); 
+  if ((vectorCompareParallel(vector, vector2, 4) <= 0) 
+    || (vectorCompare(vector, vector2) <= 0) 
+  ) { 
+    printLog(ERR, "Difference in the last share was not found.\n"); 
+    return false; 
+  } 
+  // An earlier difference in the other direction has to win. 
+  i64 highValue = (i64) numParallel; 
+  vectorSetI64Range(vector2, 2 * VECTOR_PARALLEL_MIN_CHUNK, &highValue, 1); 
+  if ((vectorCompareParallel(vector, vector2, 4) >= 0) 
+    || (vectorCompare(vector, vector2) >= 0) 
+  ) { 
+    printLog(ERR, "First difference did not decide vectorCompareParallel.\n"); 
+    return false; 
+  } 
+  vector2 = vectorDestroy(vector2); 
+   
+  u64 parallelSum = 0; 
+  if (vectorForEach(vector, vectorTestSum, &parallelSum, 4) != 0) { 
+    printLog(ERR, "Parallel vectorForEach failed.\n"); 
+    return false; 
+  } 
+  if (parallelSum != ((numParallel * (numParallel - 1)) / 2)) { 
+    printLog(ERR, "Parallel vectorForEach summed to %llu.\n", 
+      llu(parallelSum)); 
+    return false; 
+  } 
+  parallelSum = 0; 
+  vectorForEach(vector, vectorTestSum, &parallelSum); 
+  if (parallelSum != ((numParallel * (numParallel - 1)) / 2)) { 
+    printLog(ERR, "Serial vectorForEach summed to %llu.\n", llu(parallelSum)); 
+    return false; 
+  } 
+   
+  vector2 = vectorMap(vector, typeI64, vectorTestDouble, NULL, 4); 
+  if ((vector2 == NULL) || (vector2->size != numParallel)) { 
+    printLog(ERR, "Parallel vectorMap did not map every node.\n"); 
+    return false; 
+  } 
+  for (u64 ii = 0; ii < numParallel; ii++) { 
+    if (vectorGetI64(vector2, ii) != (i64) (2 * ii)) { 
+      printLog(ERR, "Parallel vectorMap yielded %lld at index %llu.\n", 
+        lli(vectorGetI64(vector2, ii)), llu(ii)); 
+      return false; 
+    } 
+  } 
+  vector2 = vectorDestroy(vector2); 
+  i64 failValue = (i64) (numParallel - 5); 
+  vector2 = vectorMap(vector, typeI64, vectorTestDouble, &failValue, 4); 
+  if (vector2 != NULL) { 
+    printLog(ERR, "vectorMap with a failing function did not fail.\n"); 
+    return false; 
+  } 
+   
+  // Inline values live in the data array and must not be destroyed. 
+  if ((vectorClearParallel(vector, 4) != 0) || (vector->size != 0)) { 
+    printLog(ERR, "vectorClearParallel of i64 vector failed.\n"); 
+    return false; 
+  } 
+  vector = vectorDestroy(vector); 
+   
+  vector = kvVectorCreate(typeString, typeString); 
+  for (u64 ii = 0; ii < numParallel; ii++) { 
+    char keyString[32]; 
+    char valueString[32]; 
+    snprintf(keyString, sizeof(keyString), "key%llu", llu(ii)); 
+    snprintf(valueString, sizeof(valueString), "value%llu", llu(ii)); 
+    if (kvVectorAddEntry(vector, keyString, valueString) == NULL) { 
+      printLog(ERR, "Could not add entry %llu to string vector.\n", llu(ii)); 
+      return false; 
+    } 
+  } 
+  if ((vectorClearParallel(vector, 4) != 0) || (vector->size != 0)) { 
+    printLog(ERR, "vectorClearParallel of string vector failed.\n"); 
+    return false; 
+  } 
+  for (u64 ii = 0; ii < numParallel; ii++) { 
+    if ((vector->array[ii].allocated == true) 
+      || (vector->array[ii].key != NULL) 
+    ) { 
+      printLog(ERR, "vectorClearParallel left node %llu populated.\n", 
+        llu(ii)); 
+      return false; 
+    } 
+  } 
+  // Destroying the cleared vector must not free anything a second time. 
+  vector = vectorDestroy(vector); 
   
   return true; 
 }
@@ -425,6 +425,133 @@ void mtx_destroy(mtx_t* mtx) {
 }
 
 
+// Reader/writer lock support.
+int rwl_init(rwl_t* rwl) {
+    if (rwl == NULL) {
+        return thrd_error;
+    }
+
+    InitializeSRWLock(rwl);
+    return thrd_success;
+}
+
+int rwl_rdlock(rwl_t* rwl) {
+    AcquireSRWLockShared(rwl);
+    return thrd_success;
+}
+
+int rwl_tryrdlock(rwl_t* rwl) {
+    return (TryAcquireSRWLockShared(rwl) != 0) ? thrd_success : thrd_busy;
+}
+
+int rwl_rdunlock(rwl_t* rwl) {
+    ReleaseSRWLockShared(rwl);
+    return thrd_success;
+}
+
+int rwl_wrlock(rwl_t* rwl) {
+    AcquireSRWLockExclusive(rwl);
+    return thrd_success;
+}
+
+int rwl_trywrlock(rwl_t* rwl) {
+    return (TryAcquireSRWLockExclusive(rwl) != 0) ? thrd_success : thrd_busy;
+}
+
+int rwl_wrunlock(rwl_t* rwl) {
+    ReleaseSRWLockExclusive(rwl);
+    return thrd_success;
+}
+
+void rwl_destroy(rwl_t* rwl) {
+    (void) rwl;
+    // No-op.  SRW locks hold no resources.
+}
+
+
+// Light mutex and condition support.  An exclusive-only SRW lock is already
+// the lightweight, non-recursive lock that light mutexes are meant to be.
+int lmtx_init(lmtx_t* lmtx) {
+    if (lmtx == NULL) {
+        return thrd_error;
+    }
+
+    InitializeSRWLock(lmtx);
+    return thrd_success;
+}
+
+int lmtx_lock(lmtx_t* lmtx) {
+    AcquireSRWLockExclusive(lmtx);
+    return thrd_success;
+}
+
+int lmtx_trylock(lmtx_t* lmtx) {
+    return (TryAcquireSRWLockExclusive(lmtx) != 0) ? thrd_success : thrd_busy;
+}
+
+int lmtx_unlock(lmtx_t* lmtx) {
+    ReleaseSRWLockExclusive(lmtx);
+    return thrd_success;
+}
+
+void lmtx_destroy(lmtx_t* lmtx) {
+    (void) lmtx;
+    // No-op.  SRW locks hold no resources.
+}
+
+int lcnd_init(lcnd_t* cond) {
+    if (cond == NULL) {
+        return thrd_error;
+    }
+
+    InitializeConditionVariable(cond);
+    return thrd_success;
+}
+
+int lcnd_signal(lcnd_t* cond) {
+    WakeConditionVariable(cond);
+    return thrd_success;
+}
+
+int lcnd_broadcast(lcnd_t* cond) {
+    WakeAllConditionVariable(cond);
+    return thrd_success;
+}
+
+int lcnd_wait(lcnd_t* cond, lmtx_t* lmtx) {
+    if (SleepConditionVariableSRW(cond, lmtx, INFINITE, 0) == 0) {
+        return thrd_error;
+    }
+
+    return thrd_success;
+}
+
+int lcnd_timedwait(lcnd_t* cond, lmtx_t* lmtx, const struct timespec* ts) {
+    struct timespec now;
+    DWORD waitms = 0;
+
+    // ts is an absolute time but SleepConditionVariableSRW wants a duration.
+    if (timespec_get(&now, TIME_UTC) != 0) {
+        int64_t nowns = (((int64_t) now.tv_sec) * 1000000000) + now.tv_nsec;
+        int64_t tsns = (((int64_t) ts->tv_sec) * 1000000000) + ts->tv_nsec;
+        if (tsns > nowns) {
+            waitms = (DWORD) ((tsns - nowns) / 1000000);
+        }
+    }
+
+    if (SleepConditionVariableSRW(cond, lmtx, waitms, 0) == 0) {
+        return (GetLastError() == ERROR_TIMEOUT) ? thrd_timedout : thrd_error;
+    }
+
+    return thrd_success;
+}
+
+void lcnd_destroy(lcnd_t* cond) {
+    (void) cond;
+    // No-op.  Condition variables hold no resources.
+}
+
+
 // Condition support.
 int cnd_broadcast(cnd_t* cond) {
     WakeAllConditionVariable(cond);
@@ -637,12 +764,79 @@ DWORD __stdcall windows_create_wrapper(LPVOID wrapper_args) {
 }
 
 int thrd_create(thrd_t* thr, thrd_start_t func, void* arg) {
-    printLog(TRACE, "ENTER thrd_create(thr=%p, func=%p, arg=%p)\n",
-        thr, func, arg);
+    return thrd_create_ex(thr, NULL, func, arg);
+}
+
+void thrd_attr_init(thrd_attr_t* attr) {
+    if (attr != NULL) {
+        attr->cpus = NULL;
+        attr->num_cpus = 0;
+        attr->numa_node = -1;
+        attr->stack_size = 0;
+        attr->name = NULL;
+    }
+}
+
+/// @fn static int windows_apply_thrd_attr(HANDLE threadHandle, const thrd_attr_t* attr)
+///
+/// @brief Apply the placement and name in a thrd_attr_t to a suspended thread.
+///
+/// @param threadHandle The HANDLE of the thread.
+/// @param attr The attributes to apply.
+///
+/// @return Returns thrd_success on success, thrd_error on failure.
+static int windows_apply_thrd_attr(HANDLE threadHandle, const thrd_attr_t* attr) {
+    if ((attr->cpus != NULL) && (attr->num_cpus > 0)) {
+        DWORD_PTR mask = 0;
+        for (size_t ii = 0; ii < attr->num_cpus; ii++) {
+            if ((attr->cpus[ii] < 0)
+                || (attr->cpus[ii] >= (int) (8 * sizeof(DWORD_PTR)))
+            ) {
+                return thrd_error;
+            }
+            mask |= ((DWORD_PTR) 1) << attr->cpus[ii];
+        }
+        if (SetThreadAffinityMask(threadHandle, mask) == 0) {
+            return thrd_error;
+        }
+    } else if (attr->numa_node >= 0) {
+        GROUP_AFFINITY groupAffinity;
+        ZeroMemory(&groupAffinity, sizeof(groupAffinity));
+        if ((attr->numa_node > 0xffff)
+            || (!GetNumaNodeProcessorMaskEx(
+                (USHORT) attr->numa_node, &groupAffinity))
+            || (groupAffinity.Mask == 0)
+            || (!SetThreadGroupAffinity(threadHandle, &groupAffinity, NULL))
+        ) {
+            return thrd_error;
+        }
+    }
+
+#if defined(NTDDI_WIN10_RS1) && (NTDDI_VERSION >= NTDDI_WIN10_RS1)
+    if (attr->name != NULL) {
+        wchar_t name[16];
+        char narrowName[16];
+        strncpy(narrowName, attr->name, sizeof(narrowName) - 1);
+        narrowName[sizeof(narrowName) - 1] = '\0';
+        if (MultiByteToWideChar(CP_UTF8, 0, narrowName, -1, name, 16) > 0) {
+            SetThreadDescription(threadHandle, name);
+        }
+    }
+#endif // NTDDI_WIN10_RS1
+
+    return thrd_success;
+}
+
+int thrd_create_ex(thrd_t* thr, const thrd_attr_t* attr,
+    thrd_start_t func, void* arg
+) {
+    printLog(TRACE, "ENTER thrd_create_ex(thr=%p, attr=%p, func=%p, arg=%p)\n",
+        thr, attr, func, arg);
 
     if (thr == NULL) {
-        printLog(TRACE, "EXIT thrd_create(thr=%p, func=%p, arg=%p) = {%d}\n",
-            thr, func, arg, thrd_error);
+        printLog(TRACE,
+            "EXIT thrd_create_ex(thr=%p, attr=%p, func=%p, arg=%p) = {%d}\n",
+            thr, attr, func, arg, thrd_error);
         return thrd_error;
     }
 
@@ -656,25 +850,50 @@ int thrd_create(thrd_t* thr, thrd_start_t func, void* arg) {
         // Can't allocate enough memory to start the thread.
         LOG_MALLOC_FAILURE();
         exit(1);
-        printLog(TRACE, "EXIT thrd_create(thr=%p, func=%p, arg=%p) = {%d}\n",
-            thr, func, arg, thrd_error);
+        printLog(TRACE,
+            "EXIT thrd_create_ex(thr=%p, attr=%p, func=%p, arg=%p) = {%d}\n",
+            thr, attr, func, arg, thrd_error);
         return thrd_error;
     }
     wrapper_args->func = func;
     wrapper_args->arg = arg;
 
+    SIZE_T stackSize = 0;
+    DWORD creationFlags = 0;
+    if (attr != NULL) {
+        stackSize = (SIZE_T) attr->stack_size;
+        if (stackSize > 0) {
+            creationFlags |= STACK_SIZE_PARAM_IS_A_RESERVATION;
+        }
+        // Don't let the thread run until its placement has been applied so
+        // that everything it allocates, starting with its message queue, is
+        // local to where it runs.
+        creationFlags |= CREATE_SUSPENDED;
+    }
+
     HANDLE threadHandle = NULL;
     if (func != NULL) {
         threadHandle = CreateThread(
             NULL,                         //lpThreadAttributes - NULL indicates the handle returned cannot be inherited by child processes
-            0,                            // dwStackSize - 0 is default stack size
+            stackSize,                    // dwStackSize - 0 is default stack size
             windows_create_wrapper,       // lpStartAddress
             wrapper_args,                 // lpParameter
-            0,                            // dwCreationFlags - A value of 0 means the thread starts immediately
+            creationFlags,                // dwCreationFlags - A value of 0 means the thread starts immediately
             thr                           // lpThreadId
         );
     }
 
+    if ((threadHandle != NULL) && (attr != NULL)) {
+        if (windows_apply_thrd_attr(threadHandle, attr) == thrd_success) {
+            ResumeThread(threadHandle);
+        } else {
+            // The thread never ran, so its arguments are still ours.
+            TerminateThread(threadHandle, thrd_error);
+            CloseHandle(threadHandle);
+            threadHandle = NULL;
+        }
+    }
+
     if (threadHandle != NULL) {
         if (attachedThreads == NULL) {
             attachedThreads
@@ -689,11 +908,13 @@ int thrd_create(thrd_t* thr, thrd_start_t func, void* arg) {
         radixTreeSetValue(
             attachedThreads, thr, sizeof(*thr), threadHandle);
     } else {
+        free(wrapper_args); wrapper_args = NULL;
         returnValue = thrd_error;
     }
 
-    printLog(TRACE, "EXIT thrd_create(thr=%p, func=%p, arg=%p) = {%d}\n",
-        thr, func, arg, returnValue);
+    printLog(TRACE,
+        "EXIT thrd_create_ex(thr=%p, attr=%p, func=%p, arg=%p) = {%d}\n",
+        thr, attr, func, arg, returnValue);
     return returnValue;
 }
 
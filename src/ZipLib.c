@@ -29,6 +29,13 @@
 /// @file
 
 #include "ZipLib.h"
+#include "ThreadPool.h"
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
 #ifdef LOGGING_ENABLED
 #include "LoggingLib.h"
 #else
@@ -40,26 +47,85 @@
 #endif
 
 
-/// @fn CompressedData* compressData(const volatile void *data, i64 dataLength)
+/// @fn static bool compressDataLooksIncompressible(const u8 *data, u64 dataLength)
+///
+/// @brief Estimate whether or not a payload is worth running through deflate.
+/// Up to COMPRESS_DATA_ENTROPY_SAMPLE_SIZE bytes are sampled in 16 evenly
+/// spaced slices and the collision entropy of their byte histogram is
+/// computed without floating point.  Payloads whose samples are within a few
+/// tenths of a bit of 8 bits per byte (already compressed or encrypted data)
+/// are reported as incompressible.
+///
+/// @param data The payload to check.
+/// @param dataLength The number of bytes at data.
+///
+/// @return Returns true if compressing the payload is very unlikely to make it
+/// smaller, false otherwise.
+static bool compressDataLooksIncompressible(const u8 *data, u64 dataLength) {
+  if (dataLength <= COMPRESS_DATA_ENTROPY_SAMPLE_SIZE) {
+    // Small payloads are cheap to compress, so just try.
+    return false;
+  }
+  
+  u32 histogram[256] = { 0 };
+  u64 sliceLength = COMPRESS_DATA_ENTROPY_SAMPLE_SIZE / 16;
+  u64 stride = dataLength / 16;
+  for (u64 slice = 0; slice < 16; slice++) {
+    const u8 *sample = data + (slice * stride);
+    for (u64 ii = 0; ii < sliceLength; ii++) {
+      histogram[sample[ii]]++;
+    }
+  }
+  
+  // The collision entropy is -log2(sum(p^2)).  More than 7.8 bits per byte
+  // means sum(count^2) * 223 < sampleSize^2.
+  u64 sumOfSquares = 0;
+  for (int ii = 0; ii < 256; ii++) {
+    sumOfSquares += ((u64) histogram[ii]) * histogram[ii];
+  }
+  u64 sampleSize = sliceLength * 16;
+  
+  return (sumOfSquares * 223) < (sampleSize * sampleSize);
+}
+
+/// @fn CompressedData* compressData_(const volatile void *data, i64 dataLength, int level, int strategy, ...)
 ///
 /// @brief Compress arbitrary in-memory data to a CompressedData object.  The
-/// output data is guaranteed to be no larger than the input data.
+/// output data is guaranteed to be no larger than the input data.  Payloads
+/// that look incompressible, and all payloads at level 0, are stored raw
+/// without running deflate on them.
+///
+/// @note This function is wrapped by a macro of the same name (without the
+/// trailing underscore) that automatically provides COMPRESS_DATA_DEFAULT for
+/// the level and strategy if they are not provided.
 ///
 /// @param data A pointer to the data to compress.
 /// @param dataLength The length, in bytes, of the data parameter.
+/// @param level The compression level, 0 (store) through 10 (best), or
+///   COMPRESS_DATA_DEFAULT.  Levels 1 through 3 use miniz's greedy parser and
+///   are meant for latency-sensitive payloads.  Level 1 with the default
+///   strategy uses miniz's dedicated fast compressor and is the fastest
+///   setting that still compresses.
+/// @param strategy One of miniz's MZ_DEFAULT_STRATEGY, MZ_FILTERED,
+///   MZ_HUFFMAN_ONLY, MZ_RLE, or MZ_FIXED, or COMPRESS_DATA_DEFAULT.
+///   MZ_HUFFMAN_ONLY skips the match search and only entropy codes the
+///   input.
+/// @param ... All further parameters are ignored.
 ///
 /// @return Returns a pointer to an allocated CompressedData object on success,
 /// NULL on failure.
-CompressedData* compressData(const volatile void *data, i64 dataLength) {
+CompressedData* compressData_(const volatile void *data, i64 dataLength,
+  int level, int strategy, ...
+) {
   printLog(TRACE,
-    "ENTER compressData(data=%p, dataLength=%llu)\n",
-    data, llu(dataLength));
+    "ENTER compressData(data=%p, dataLength=%llu, level=%d, strategy=%d)\n",
+    data, llu(dataLength), level, strategy);
   
   if ((data == NULL) || (dataLength == 0)) {
     // Not an error, but nothing to do.
     printLog(TRACE,
-      "EXIT compressData(data=%p, dataLength=%llu) = {NULL}\n",
-      data, llu(dataLength));
+      "EXIT compressData(data=%p, dataLength=%llu, level=%d, strategy=%d) "
+      "= {NULL}\n", data, llu(dataLength), level, strategy);
     return NULL;
   }
   
@@ -69,29 +135,44 @@ CompressedData* compressData(const volatile void *data, i64 dataLength) {
     // Nothing more we can do.
     LOG_MALLOC_FAILURE();
     printLog(TRACE,
-      "EXIT compressData(data=%p, dataLength=%llu) = {NULL}\n",
-      data, llu(dataLength));
+      "EXIT compressData(data=%p, dataLength=%llu, level=%d, strategy=%d) "
+      "= {NULL}\n", data, llu(dataLength), level, strategy);
     return NULL;
   }
   
   size_t sourceLength = (size_t) dataLength;
   size_t destinationLength = 0;
-  compressedData->data = tdefl_compress_mem_to_heap((void*) data, sourceLength,
-    &destinationLength, TDEFL_MAX_PROBES_MASK);
+  if ((level != 0) && (!compressDataLooksIncompressible(
+    (const u8*) data, (u64) dataLength))
+  ) {
+    int flags = TDEFL_MAX_PROBES_MASK;
+    if ((level != COMPRESS_DATA_DEFAULT)
+      || (strategy != COMPRESS_DATA_DEFAULT)
+    ) {
+      flags = (int) tdefl_create_comp_flags_from_zip_params(
+        (level == COMPRESS_DATA_DEFAULT) ? 10 : level,
+        -MZ_DEFAULT_WINDOW_BITS,
+        (strategy == COMPRESS_DATA_DEFAULT) ? MZ_DEFAULT_STRATEGY : strategy);
+    }
+    compressedData->data = tdefl_compress_mem_to_heap((void*) data,
+      sourceLength, &destinationLength, flags);
+  }
   
   if ((compressedData->data == NULL) || (destinationLength > sourceLength)) {
-    // Most likely, the data was not compressible and we've wound up with output
-    // larger than the input.  This is not acceptable.  Do a raw copy of the
+    // Either we chose not to compress or the data was not compressible and
+    // we've wound up with output larger than the input.  Do a raw copy of the
     // input to the output and set the flag so we know not to decompress this.
-    printLog(DEBUG, "Invalid return from tdefl_compress_mem_to_heap.\n");
+    printLog(DEBUG, "Storing %llu bytes without compression.\n",
+      llu(dataLength));
     compressedData->data = pointerDestroy(compressedData->data);
     
     compressedData->data = malloc(dataLength);
-    if (compressedData == NULL) {
+    if (compressedData->data == NULL) {
       LOG_MALLOC_FAILURE();
+      compressedData = (CompressedData*) pointerDestroy(compressedData);
       printLog(TRACE,
-        "EXIT compressData(data=%p, dataLength=%llu) = {NULL}\n",
-        data, llu(dataLength));
+        "EXIT compressData(data=%p, dataLength=%llu, level=%d, strategy=%d) "
+        "= {NULL}\n", data, llu(dataLength), level, strategy);
       return NULL;
     }
     
@@ -100,15 +181,15 @@ CompressedData* compressData(const volatile void *data, i64 dataLength) {
     compressedData->dataIsRaw = true;
     
     printLog(TRACE,
-      "EXIT compressData(data=%p, dataLength=%llu) = {%p}\n",
-      data, llu(dataLength), compressedData);
+      "EXIT compressData(data=%p, dataLength=%llu, level=%d, strategy=%d) "
+      "= {%p}\n", data, llu(dataLength), level, strategy, compressedData);
     return compressedData;
   }
   compressedData->dataLength = (i64) destinationLength;
   
   printLog(TRACE,
-    "EXIT compressData(data=%p, dataLength=%llu) = {%p}\n",
-    data, llu(dataLength), compressedData);
+    "EXIT compressData(data=%p, dataLength=%llu, level=%d, strategy=%d) "
+    "= {%p}\n", data, llu(dataLength), level, strategy, compressedData);
   return compressedData;
 }
 
@@ -539,9 +620,337 @@ CompressedData* compressedDataFromBlob(const volatile void *array, i64 *length)
   return compressedData;
 }
 
+/// @fn static mz_bool compressDataStreamPutBuf(const void *buffer, int length, void *stream)
+///
+/// @brief tdefl output callback that hands compressed data to a
+/// CompressDataStream's writer.
+///
+/// @param buffer The compressed output.
+/// @param length The number of bytes at buffer.
+/// @param stream The CompressDataStream.
+///
+/// @return Returns MZ_TRUE on success, MZ_FALSE if the writer failed.
+static mz_bool compressDataStreamPutBuf(const void *buffer, int length,
+  void *stream
+) {
+  CompressDataStream *compressDataStream = (CompressDataStream*) stream;
+  if (compressDataStream->writer(buffer, (i64) length,
+    compressDataStream->context) == false
+  ) {
+    return MZ_FALSE;
+  }
+  compressDataStream->outputLength += (i64) length;
+  
+  return MZ_TRUE;
+}
+
+/// @fn CompressDataStream* compressDataStreamCreate_(CompressDataStreamWriter writer, void *context, int level, ...)
+///
+/// @brief Start compressing data that will be supplied in chunks by
+/// compressDataStream.  Only the compressor's window is held in memory, not
+/// the input or the output.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides
+/// ZIP_DEFAULT_COMPRESSION_LEVEL as the compression level.
+///
+/// @param writer The function to call with each piece of compressed output.
+/// @param context The context to pass to writer.
+/// @param level The compression level (0 to 10, inclusive).
+/// @param ... All further parameters are ignored.
+///
+/// @return Returns a new CompressDataStream on success, NULL on failure.
+CompressDataStream* compressDataStreamCreate_(CompressDataStreamWriter writer,
+  void *context, int level, ...
+) {
+  printLog(TRACE,
+    "ENTER compressDataStreamCreate(writer=%p, context=%p, level=%d)\n",
+    (void*) writer, context, level);
+  
+  if ((writer == NULL) || (level < 0) || (level > MZ_UBER_COMPRESSION)) {
+    printLog(ERR, "Invalid parameters.\n");
+    printLog(TRACE,
+      "EXIT compressDataStreamCreate(writer=%p, context=%p, level=%d) = "
+      "{NULL}\n", (void*) writer, context, level);
+    return NULL;
+  }
+  
+  CompressDataStream *stream
+    = (CompressDataStream*) calloc(1, sizeof(CompressDataStream));
+  if (stream != NULL) {
+    stream->compressor
+      = (tdefl_compressor*) malloc(sizeof(tdefl_compressor));
+  }
+  if ((stream == NULL) || (stream->compressor == NULL)) {
+    LOG_MALLOC_FAILURE();
+    if (stream != NULL) {
+      stream = (CompressDataStream*) pointerDestroy(stream);
+    }
+    printLog(TRACE,
+      "EXIT compressDataStreamCreate(writer=%p, context=%p, level=%d) = "
+      "{NULL}\n", (void*) writer, context, level);
+    return NULL;
+  }
+  stream->writer = writer;
+  stream->context = context;
+  
+  // Negative window bits means raw deflate, the same as compressData.
+  if (tdefl_init(stream->compressor, compressDataStreamPutBuf, stream,
+    (int) tdefl_create_comp_flags_from_zip_params(level,
+      -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY)) != TDEFL_STATUS_OKAY
+  ) {
+    printLog(ERR, "Could not initialize compressor.\n");
+    stream = compressDataStreamDestroy(stream);
+  }
+  
+  printLog(TRACE,
+    "EXIT compressDataStreamCreate(writer=%p, context=%p, level=%d) = {%p}\n",
+    (void*) writer, context, level, stream);
+  return stream;
+}
+
+/// @fn i32 compressDataStream(CompressDataStream *stream, const volatile void *data, i64 dataLength)
+///
+/// @brief Compress the next chunk of a stream's input.  Compressed output is
+/// passed to the stream's writer as the compressor produces it.
+///
+/// @param stream The CompressDataStream to add input to.
+/// @param data The next chunk of input.
+/// @param dataLength The number of bytes at data.
+///
+/// @return Returns 0 on success, -1 on failure.
+i32 compressDataStream(CompressDataStream *stream,
+  const volatile void *data, i64 dataLength
+) {
+  printLog(TRACE,
+    "ENTER compressDataStream(stream=%p, data=%p, dataLength=%lld)\n",
+    stream, data, lld(dataLength));
+  
+  if ((stream == NULL) || (stream->failed == true)
+    || (stream->finished == true) || (dataLength < 0)
+    || ((data == NULL) && (dataLength > 0))
+  ) {
+    printLog(ERR, "Invalid parameters or stream state.\n");
+    printLog(TRACE,
+      "EXIT compressDataStream(stream=%p, data=%p, dataLength=%lld) = {-1}\n",
+      stream, data, lld(dataLength));
+    return -1;
+  } else if (dataLength == 0) {
+    // Not an error, but nothing to do.
+    printLog(TRACE,
+      "EXIT compressDataStream(stream=%p, data=%p, dataLength=%lld) = {0}\n",
+      stream, data, lld(dataLength));
+    return 0;
+  }
+  
+  if (tdefl_compress_buffer(stream->compressor, (const void*) data,
+    (size_t) dataLength, TDEFL_NO_FLUSH) != TDEFL_STATUS_OKAY
+  ) {
+    printLog(ERR, "Compression failed.\n");
+    stream->failed = true;
+    printLog(TRACE,
+      "EXIT compressDataStream(stream=%p, data=%p, dataLength=%lld) = {-1}\n",
+      stream, data, lld(dataLength));
+    return -1;
+  }
+  stream->inputLength += dataLength;
+  
+  printLog(TRACE,
+    "EXIT compressDataStream(stream=%p, data=%p, dataLength=%lld) = {0}\n",
+    stream, data, lld(dataLength));
+  return 0;
+}
+
+/// @fn i32 compressDataStreamFinish(CompressDataStream *stream)
+///
+/// @brief Flush the rest of a stream's compressed output to its writer and
+/// end the deflate stream.  No more input may be added afterward.
+///
+/// @param stream The CompressDataStream to finish.
+///
+/// @return Returns 0 on success, -1 on failure.
+i32 compressDataStreamFinish(CompressDataStream *stream) {
+  printLog(TRACE, "ENTER compressDataStreamFinish(stream=%p)\n", stream);
+  
+  if ((stream == NULL) || (stream->failed == true)
+    || (stream->finished == true)
+  ) {
+    printLog(ERR, "Invalid stream state.\n");
+    printLog(TRACE, "EXIT compressDataStreamFinish(stream=%p) = {-1}\n",
+      stream);
+    return -1;
+  }
+  
+  stream->finished = true;
+  if (tdefl_compress_buffer(stream->compressor, NULL, 0, TDEFL_FINISH)
+    != TDEFL_STATUS_DONE
+  ) {
+    printLog(ERR, "Could not finish compression.\n");
+    stream->failed = true;
+    printLog(TRACE, "EXIT compressDataStreamFinish(stream=%p) = {-1}\n",
+      stream);
+    return -1;
+  }
+  
+  printLog(TRACE, "EXIT compressDataStreamFinish(stream=%p) = {0}\n", stream);
+  return 0;
+}
+
+/// @fn CompressDataStream* compressDataStreamDestroy(CompressDataStream *stream)
+///
+/// @brief Release a CompressDataStream.  Any output that has not been
+/// finished with compressDataStreamFinish is discarded.
+///
+/// @param stream The CompressDataStream to destroy.
+///
+/// @return This function always returns NULL.
+CompressDataStream* compressDataStreamDestroy(CompressDataStream *stream) {
+  printLog(TRACE, "ENTER compressDataStreamDestroy(stream=%p)\n", stream);
+  
+  if (stream != NULL) {
+    stream->compressor
+      = (tdefl_compressor*) pointerDestroy(stream->compressor);
+    stream = (CompressDataStream*) pointerDestroy(stream);
+  }
+  
+  printLog(TRACE, "EXIT compressDataStreamDestroy(stream=%p) = {NULL}\n",
+    stream);
+  return NULL;
+}
+
 
 // Formal zip support functions.
 
+/// @fn static bool zipMapFile(Zip *zip)
+///
+/// @brief Map a file-based Zip archive into memory so that miniz can read its
+/// central directory and entries straight out of the page cache instead of
+/// through stdio.
+///
+/// @param zip A pointer to the Zip whose fileName is to be mapped.
+///
+/// @return Returns true if the file was mapped, false if it could not be (in
+/// which case the caller should fall back to reading it as a file).
+static bool zipMapFile(Zip *zip) {
+#ifndef _WIN32
+  int fd = open(zip->fileName, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  
+  struct stat statBuffer;
+  if ((fstat(fd, &statBuffer) != 0) || (statBuffer.st_size <= 0)) {
+    close(fd);
+    return false;
+  }
+  
+  void *mappedData
+    = mmap(NULL, (size_t) statBuffer.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mappedData == MAP_FAILED) {
+    return false;
+  }
+  
+  zip->mappedData = mappedData;
+  zip->mappedLength = (i64) statBuffer.st_size;
+  return true;
+#else
+  (void) zip;
+  return false;
+#endif // _WIN32
+}
+
+/// @fn static void zipUnmapFile(Zip *zip)
+///
+/// @brief Release the memory mapping made by zipMapFile, if any.
+///
+/// @param zip A pointer to the Zip to unmap.
+///
+/// @return This function returns no value.
+static void zipUnmapFile(Zip *zip) {
+#ifndef _WIN32
+  if (zip->mappedData != NULL) {
+    munmap(zip->mappedData, (size_t) zip->mappedLength);
+  }
+#endif // _WIN32
+  zip->mappedData = NULL;
+  zip->mappedLength = 0;
+}
+
+/// @fn static void zipBuildEntryIndex(Zip *zip)
+///
+/// @brief Build the hash index over a Zip's entryNames so that entries can be
+/// found by name without a search of the central directory.  The index is
+/// sized to a power of two at least twice the number of entries so that
+/// probe sequences stay short.
+///
+/// @note If the index can't be allocated, lookups fall back to miniz.
+///
+/// @param zip A pointer to the Zip whose entryNames are to be indexed.
+///
+/// @return This function returns no value.
+static void zipBuildEntryIndex(Zip *zip) {
+  zip->entryIndex = (u32*) pointerDestroy(zip->entryIndex);
+  zip->entryIndexMask = 0;
+  if (zip->numEntries <= 0) {
+    return;
+  }
+  
+  u64 numSlots = 8;
+  while (numSlots < 2 * ((u64) zip->numEntries)) {
+    numSlots <<= 1;
+  }
+  zip->entryIndex = (u32*) calloc(numSlots, sizeof(u32));
+  if (zip->entryIndex == NULL) {
+    LOG_MALLOC_FAILURE();
+    return;
+  }
+  zip->entryIndexMask = numSlots - 1;
+  if (zip->entryIndexSeed == 0) {
+    zip->entryIndexSeed = hashCreateSeed();
+  }
+  
+  for (i64 index = 0; index < zip->numEntries; index++) {
+    const char *entryName = zip->entryNames[index];
+    u64 slot = hashMemory(entryName, strlen(entryName), zip->entryIndexSeed)
+      & zip->entryIndexMask;
+    while (zip->entryIndex[slot] != 0) {
+      slot = (slot + 1) & zip->entryIndexMask;
+    }
+    zip->entryIndex[slot] = (u32) (index + 1);
+  }
+}
+
+/// @fn static i64 zipFindEntry(const Zip *zip, const char *entryName)
+///
+/// @brief Find the index of a named entry in a readable Zip.
+///
+/// @note The caller must hold the Zip's lock and must have made it readable.
+///
+/// @param zip A pointer to the Zip to search.
+/// @param entryName The name of the entry to find.
+///
+/// @return Returns the index of the entry on success, -1 if there is no
+/// entry by that name.
+static i64 zipFindEntry(const Zip *zip, const char *entryName) {
+  if (zip->entryIndex == NULL) {
+    return (i64) mz_zip_reader_locate_file(zip->archive, entryName,
+      NULL, MZ_ZIP_FLAG_CASE_SENSITIVE);
+  }
+  
+  u64 slot = hashMemory(entryName, strlen(entryName), zip->entryIndexSeed)
+    & zip->entryIndexMask;
+  while (zip->entryIndex[slot] != 0) {
+    i64 index = (i64) zip->entryIndex[slot] - 1;
+    if (strcmp(zip->entryNames[index], entryName) == 0) {
+      return index;
+    }
+    slot = (slot + 1) & zip->entryIndexMask;
+  }
+  
+  return -1;
+}
+
 /// @fn bool _zipEnsureReadable(Zip *zip)
 ///
 /// @brief Ensure that a Zip archive is readable or return bad status.
@@ -578,9 +987,17 @@ bool _zipEnsureReadable(Zip *zip) {
   
   // Zip is ready for reading.
   if ((zip->zipLocation == ZIP_LOCATION_FILE) && (zip->fileName != NULL)) {
-    // Zip is a file-based archive.
-    if (!mz_zip_reader_init_file(zip->archive, zip->fileName,
-      MZ_ZIP_FLAG_CASE_SENSITIVE)
+    // Zip is a file-based archive.  Read it through a memory map when we
+    // can.
+    if ((zipMapFile(zip) == true)
+      && (!mz_zip_reader_init_mem(zip->archive, zip->mappedData,
+        (size_t) zip->mappedLength, MZ_ZIP_FLAG_CASE_SENSITIVE))
+    ) {
+      zipUnmapFile(zip);
+    }
+    if ((zip->mappedData == NULL)
+      && (!mz_zip_reader_init_file(zip->archive, zip->fileName,
+        MZ_ZIP_FLAG_CASE_SENSITIVE))
     ) {
       printLog(ERR, "Cannot open Zip file \"%s\" for reading.\n",
         zip->fileName);
@@ -616,6 +1033,7 @@ bool _zipEnsureReadable(Zip *zip) {
     }
     zip->entryNames = (char**) pointerDestroy(zip->entryNames);
     zip->entrySizes = (i64*) pointerDestroy(zip->entrySizes);
+    zip->entryIndex = (u32*) pointerDestroy(zip->entryIndex);
   }
   
   // Rebuild the entryNames and entrySizes arrays.
@@ -625,6 +1043,7 @@ bool _zipEnsureReadable(Zip *zip) {
   if ((zip->entryNames == NULL) || (zip->entrySizes == NULL)) {
     zip->entryNames = (char**) pointerDestroy(zip->entryNames);
     zip->entrySizes = (i64*) pointerDestroy(zip->entrySizes);
+    zip->entryIndex = (u32*) pointerDestroy(zip->entryIndex);
     LOG_MALLOC_FAILURE();
     printLog(TRACE,
       "EXIT _zipEnsureReadable(zip=%p) = {NOT successful}\n",
@@ -646,6 +1065,8 @@ bool _zipEnsureReadable(Zip *zip) {
     zip->entrySizes[index] = stat.m_uncomp_size;
   }
   
+  zipBuildEntryIndex(zip);
+  
   printLog(TRACE, "EXIT _zipEnsureReadable(zip=%p) = {successful}\n", zip);
   return true;
 }
@@ -675,6 +1096,22 @@ bool _zipEnsureWritable(Zip *zip) {
   }
   
   if (zip->zipMode == ZIP_MODE_READ) {
+    if (zip->mappedData != NULL) {
+      // miniz can only turn a file reader into a writer, not a read-only
+      // mapping, so reopen the archive as a file first.
+      mz_zip_reader_end(zip->archive);
+      zipUnmapFile(zip);
+      if (!mz_zip_reader_init_file(zip->archive, zip->fileName,
+        MZ_ZIP_FLAG_CASE_SENSITIVE)
+      ) {
+        printLog(ERR, "Could not reopen Zip file \"%s\".\n", zip->fileName);
+        zip->zipMode = ZIP_MODE_NOT_OPEN;
+        printLog(TRACE,
+          "EXIT _zipEnsureWritable(zip=%p) = {NOT successful}\n",
+          zip);
+        return false;
+      }
+    }
     if (!mz_zip_writer_init_from_reader(zip->archive, zip->fileName)) {
       printLog(ERR, "Could not convert readable Zip archive to writeable.\n");
       printLog(TRACE,
@@ -720,6 +1157,7 @@ bool _zipEnsureWritable(Zip *zip) {
     }
     zip->entryNames = (char**) pointerDestroy(zip->entryNames);
     zip->entrySizes = (i64*) pointerDestroy(zip->entrySizes);
+    zip->entryIndex = (u32*) pointerDestroy(zip->entryIndex);
   }
   
   printLog(TRACE, "EXIT _zipEnsureWritable(zip=%p) = {successful}\n", zip);
@@ -1141,8 +1579,12 @@ void* zipReadEntryByName(const Zip *zip, const char *entryName,
   }
   
   size_t size = 0;
-  void *decompressedData = mz_zip_reader_extract_file_to_heap(zip->archive,
-    entryName, &size, MZ_ZIP_FLAG_CASE_SENSITIVE);
+  void *decompressedData = NULL;
+  i64 entryIndex = zipFindEntry(zip, entryName);
+  if (entryIndex >= 0) {
+    decompressedData = mz_zip_reader_extract_to_heap(zip->archive,
+      (mz_uint) entryIndex, &size, MZ_ZIP_FLAG_CASE_SENSITIVE);
+  }
   if (entryLength != NULL) {
     *entryLength = (i64) size;
   }
@@ -1192,20 +1634,473 @@ void* zipReadEntryByIndex(const Zip *zip, i64 entryIndex, i64 *entryLength) {
     zipUnlock((Zip*) zip);
     return NULL;
   }
-  
-  size_t size = 0;
-  void *decompressedData = mz_zip_reader_extract_to_heap(zip->archive,
-    entryIndex, &size, MZ_ZIP_FLAG_CASE_SENSITIVE);
-  if (entryLength != NULL) {
-    *entryLength = (i64) size;
+  
+  size_t size = 0;
+  void *decompressedData = mz_zip_reader_extract_to_heap(zip->archive,
+    entryIndex, &size, MZ_ZIP_FLAG_CASE_SENSITIVE);
+  if (entryLength != NULL) {
+    *entryLength = (i64) size;
+  }
+  
+  zipUnlock((Zip*) zip);
+  
+  printLog(TRACE,
+    "EXIT zipReadEntryByIndex(zip=%p, entryIndex=%llu, entryLength=%p) "
+    "= {%p}\n", zip, llu(entryIndex), entryLength, decompressedData);
+  return decompressedData;
+}
+
+/// @fn static ZipEntryReader* zipEntryReaderCreate(const Zip *zip, i64 entryIndex)
+///
+/// @brief Create a ZipEntryReader for an entry that has already been located.
+///
+/// @note The caller must hold the Zip's lock and must have made it readable.
+///
+/// @param zip A pointer to the Zip object the entry is in.
+/// @param entryIndex The index of the entry in the Zip table of contents.
+///
+/// @return Returns a newly-allocated ZipEntryReader on success, NULL on
+/// failure.
+static ZipEntryReader* zipEntryReaderCreate(const Zip *zip, i64 entryIndex) {
+  ZEROINIT(mz_zip_archive_file_stat stat);
+  if ((entryIndex < 0)
+    || (!mz_zip_reader_file_stat(zip->archive, (mz_uint) entryIndex, &stat))
+  ) {
+    printLog(ERR, "Could not retrieve metadata for entry %lld.\n",
+      lld(entryIndex));
+    return NULL;
+  }
+  if (((stat.m_bit_flag & 0x1) != 0)
+    || ((stat.m_method != 0) && (stat.m_method != MZ_DEFLATED))
+  ) {
+    printLog(ERR, "Entry %lld is encrypted or uses an unsupported method.\n",
+      lld(entryIndex));
+    return NULL;
+  }
+  
+  // The entry's data follows its local header, whose name and extra field
+  // lengths may differ from the ones in the central directory.
+  mz_uint8 localHeader[30];
+  if ((zip->archive->m_pRead(zip->archive->m_pIO_opaque,
+      stat.m_local_header_ofs, localHeader, sizeof(localHeader))
+      != sizeof(localHeader))
+    || (localHeader[0] != 'P') || (localHeader[1] != 'K')
+    || (localHeader[2] != 3) || (localHeader[3] != 4)
+  ) {
+    printLog(ERR, "Could not read local header for entry %lld.\n",
+      lld(entryIndex));
+    return NULL;
+  }
+  u64 nameLength = localHeader[26] | (localHeader[27] << 8);
+  u64 extraLength = localHeader[28] | (localHeader[29] << 8);
+  
+  ZipEntryReader *reader
+    = (ZipEntryReader*) calloc(1, sizeof(ZipEntryReader));
+  if (reader == NULL) {
+    LOG_MALLOC_FAILURE();
+    return NULL;
+  }
+  reader->zip = (Zip*) zip;
+  reader->archiveOffset = stat.m_local_header_ofs + sizeof(localHeader)
+    + nameLength + extraLength;
+  reader->compressedRemaining = stat.m_comp_size;
+  reader->expectedLength = stat.m_uncomp_size;
+  reader->crc32 = MZ_CRC32_INIT;
+  reader->expectedCrc32 = stat.m_crc32;
+  reader->stored = (stat.m_method == 0);
+  
+  reader->input = (u8*) malloc(ZIP_READ_BUFFER_SIZE);
+  if (reader->stored == false) {
+    reader->dictionary = (u8*) malloc(TINFL_LZ_DICT_SIZE);
+    tinfl_init(&reader->decompressor);
+  }
+  if ((reader->input == NULL)
+    || ((reader->stored == false) && (reader->dictionary == NULL))
+  ) {
+    LOG_MALLOC_FAILURE();
+    reader = zipEntryReaderDestroy(reader);
+  }
+  
+  return reader;
+}
+
+/// @fn ZipEntryReader* zipEntryReaderCreateByName(const Zip *zip, const char *entryName)
+///
+/// @brief Create an object that reads an entry's decompressed data a chunk at
+/// a time so that large entries never have to be held in memory all at once.
+///
+/// @param zip A pointer to the Zip object to read the entry from.
+/// @param entryName The name of the entry in the Zip archive.
+///
+/// @return Returns a newly-allocated ZipEntryReader on success, NULL on
+/// failure.  The reader must be destroyed with zipEntryReaderDestroy.
+ZipEntryReader* zipEntryReaderCreateByName(const Zip *zip,
+  const char *entryName
+) {
+  printLog(TRACE,
+    "ENTER zipEntryReaderCreateByName(zip=%p, entryName=\"%s\")\n",
+    zip, entryName);
+  
+  if ((zip == NULL) || (entryName == NULL)) {
+    printLog(ERR, "NULL parameter provided.\n");
+    printLog(TRACE,
+      "EXIT zipEntryReaderCreateByName(zip=%p, entryName=\"%s\") = {NULL}\n",
+      zip, entryName);
+    return NULL;
+  }
+  
+  zipLock((Zip*) zip);
+  
+  ZipEntryReader *reader = NULL;
+  if (!_zipEnsureReadable((Zip*) zip)) {
+    printLog(ERR, "Could not read Zip.\n");
+  } else {
+    i64 entryIndex = zipFindEntry(zip, entryName);
+    if (entryIndex < 0) {
+      printLog(ERR, "No entry named \"%s\" in Zip.\n", entryName);
+    } else {
+      reader = zipEntryReaderCreate(zip, entryIndex);
+    }
+  }
+  
+  zipUnlock((Zip*) zip);
+  
+  printLog(TRACE,
+    "EXIT zipEntryReaderCreateByName(zip=%p, entryName=\"%s\") = {%p}\n",
+    zip, entryName, reader);
+  return reader;
+}
+
+/// @fn ZipEntryReader* zipEntryReaderCreateByIndex(const Zip *zip, i64 entryIndex)
+///
+/// @brief Create an object that reads an entry's decompressed data a chunk at
+/// a time so that large entries never have to be held in memory all at once.
+///
+/// @param zip A pointer to the Zip object to read the entry from.
+/// @param entryIndex The index of the entry in the Zip table of contents.
+///
+/// @return Returns a newly-allocated ZipEntryReader on success, NULL on
+/// failure.  The reader must be destroyed with zipEntryReaderDestroy.
+ZipEntryReader* zipEntryReaderCreateByIndex(const Zip *zip, i64 entryIndex) {
+  printLog(TRACE,
+    "ENTER zipEntryReaderCreateByIndex(zip=%p, entryIndex=%lld)\n",
+    zip, lld(entryIndex));
+  
+  if (zip == NULL) {
+    printLog(ERR, "NULL parameter provided.\n");
+    printLog(TRACE,
+      "EXIT zipEntryReaderCreateByIndex(zip=%p, entryIndex=%lld) = {NULL}\n",
+      zip, lld(entryIndex));
+    return NULL;
+  }
+  
+  zipLock((Zip*) zip);
+  
+  ZipEntryReader *reader = NULL;
+  if (!_zipEnsureReadable((Zip*) zip)) {
+    printLog(ERR, "Could not read Zip.\n");
+  } else {
+    reader = zipEntryReaderCreate(zip, entryIndex);
+  }
+  
+  zipUnlock((Zip*) zip);
+  
+  printLog(TRACE,
+    "EXIT zipEntryReaderCreateByIndex(zip=%p, entryIndex=%lld) = {%p}\n",
+    zip, lld(entryIndex), reader);
+  return reader;
+}
+
+/// @fn static bool zipEntryReaderFill(ZipEntryReader *reader)
+///
+/// @brief Read the next ZIP_READ_BUFFER_SIZE (or fewer) compressed bytes of
+/// an entry into the reader's input buffer.
+///
+/// @param reader The ZipEntryReader to fill.
+///
+/// @return Returns true on success, false on failure.
+static bool zipEntryReaderFill(ZipEntryReader *reader) {
+  size_t length = (reader->compressedRemaining < ZIP_READ_BUFFER_SIZE)
+    ? (size_t) reader->compressedRemaining : ZIP_READ_BUFFER_SIZE;
+  
+  // Another thread may have added entries since the last read, so make sure
+  // the archive is readable again.  Existing entries never move.
+  zipLock(reader->zip);
+  bool returnValue = _zipEnsureReadable(reader->zip)
+    && (reader->zip->archive->m_pRead(reader->zip->archive->m_pIO_opaque,
+      reader->archiveOffset, reader->input, length) == length);
+  zipUnlock(reader->zip);
+  
+  if (returnValue == true) {
+    reader->archiveOffset += length;
+    reader->compressedRemaining -= length;
+    reader->inputOffset = 0;
+    reader->inputLength = length;
+  }
+  
+  return returnValue;
+}
+
+/// @fn static i64 zipEntryReaderFinish(ZipEntryReader *reader, const u8 *chunk, i64 chunkLength)
+///
+/// @brief Account for a chunk of decompressed data and, once the whole entry
+/// has been produced, check it against the size and CRC-32 in the archive.
+///
+/// @param reader The ZipEntryReader that produced the chunk.
+/// @param chunk The decompressed data.
+/// @param chunkLength The number of bytes at chunk.
+///
+/// @return Returns chunkLength on success, -1 if the entry failed
+/// verification.
+static i64 zipEntryReaderFinish(ZipEntryReader *reader, const u8 *chunk,
+  i64 chunkLength
+) {
+  reader->crc32 = (mz_uint32) mz_crc32(reader->crc32, chunk,
+    (size_t) chunkLength);
+  reader->uncompressedLength += (u64) chunkLength;
+  if (reader->uncompressedLength > reader->expectedLength) {
+    reader->done = true;
+  }
+  
+  if ((reader->done == true)
+    && ((reader->uncompressedLength != reader->expectedLength)
+      || (reader->crc32 != reader->expectedCrc32))
+  ) {
+    printLog(ERR, "Zip entry failed size or CRC-32 verification.\n");
+    reader->failed = true;
+    return -1;
+  }
+  
+  return chunkLength;
+}
+
+/// @fn i64 zipEntryReaderRead(ZipEntryReader *reader, const void **chunk)
+///
+/// @brief Get the next piece of an entry's decompressed data.  The entry is
+/// read from the archive and inflated ZIP_READ_BUFFER_SIZE compressed bytes
+/// at a time into a buffer owned by the reader, so memory use does not depend
+/// on the size of the entry.  The size and CRC-32 of the entry are verified
+/// when the last chunk is produced.
+///
+/// @param reader The ZipEntryReader to read from.
+/// @param chunk Output parameter that is set to point to the data.  The data
+///   is only valid until the next call on the reader.
+///
+/// @return Returns the number of bytes at *chunk, 0 once the entry has been
+/// read completely, or -1 on failure.
+i64 zipEntryReaderRead(ZipEntryReader *reader, const void **chunk) {
+  if ((reader == NULL) || (chunk == NULL) || (reader->failed == true)) {
+    return -1;
+  } else if (reader->done == true) {
+    return 0;
+  }
+  
+  if (reader->stored == true) {
+    if (reader->compressedRemaining == 0) {
+      reader->done = true;
+      return zipEntryReaderFinish(reader, reader->input, 0);
+    } else if (!zipEntryReaderFill(reader)) {
+      printLog(ERR, "Could not read stored Zip entry data.\n");
+      reader->failed = true;
+      return -1;
+    }
+    reader->done = (reader->compressedRemaining == 0);
+    *chunk = reader->input;
+    return zipEntryReaderFinish(reader, reader->input,
+      (i64) reader->inputLength);
+  }
+  
+  while (true) {
+    if ((reader->inputOffset == reader->inputLength)
+      && (reader->compressedRemaining > 0)
+      && (!zipEntryReaderFill(reader))
+    ) {
+      printLog(ERR, "Could not read compressed Zip entry data.\n");
+      reader->failed = true;
+      return -1;
+    }
+    
+    size_t inputLength = reader->inputLength - reader->inputOffset;
+    size_t outputLength = TINFL_LZ_DICT_SIZE - reader->dictionaryOffset;
+    u8 *output = reader->dictionary + reader->dictionaryOffset;
+    tinfl_status status = tinfl_decompress(&reader->decompressor,
+      reader->input + reader->inputOffset, &inputLength,
+      reader->dictionary, output, &outputLength,
+      (reader->compressedRemaining > 0) ? TINFL_FLAG_HAS_MORE_INPUT : 0);
+    reader->inputOffset += inputLength;
+    reader->dictionaryOffset
+      = (reader->dictionaryOffset + outputLength) & (TINFL_LZ_DICT_SIZE - 1);
+    
+    if ((status < TINFL_STATUS_DONE)
+      || ((status == TINFL_STATUS_NEEDS_MORE_INPUT)
+        && (reader->compressedRemaining == 0)
+        && (reader->inputOffset == reader->inputLength))
+    ) {
+      printLog(ERR, "Could not inflate Zip entry data.\n");
+      reader->failed = true;
+      return -1;
+    }
+    reader->done = (status == TINFL_STATUS_DONE);
+    
+    if ((outputLength > 0) || (reader->done == true)) {
+      *chunk = output;
+      return zipEntryReaderFinish(reader, output, (i64) outputLength);
+    }
+  }
+}
+
+/// @fn ZipEntryReader* zipEntryReaderDestroy(ZipEntryReader *reader)
+///
+/// @brief Destroy a ZipEntryReader.
+///
+/// @param reader The ZipEntryReader to destroy.
+///
+/// @return Always returns NULL.
+ZipEntryReader* zipEntryReaderDestroy(ZipEntryReader *reader) {
+  if (reader != NULL) {
+    reader->input = (u8*) pointerDestroy(reader->input);
+    reader->dictionary = (u8*) pointerDestroy(reader->dictionary);
+    reader = (ZipEntryReader*) pointerDestroy(reader);
+  }
+  
+  return NULL;
+}
+
+/// @fn static i32 zipEntryReaderDrain(ZipEntryReader *reader, ZipEntryChunkHandler handler, void *context)
+///
+/// @brief Pass every chunk of a ZipEntryReader to a handler and destroy the
+/// reader.
+///
+/// @param reader The ZipEntryReader to read from.
+/// @param handler The function to call with each chunk.
+/// @param context The context to pass to handler.
+///
+/// @return Returns 0 if the whole entry was read, -1 otherwise.
+static i32 zipEntryReaderDrain(ZipEntryReader *reader,
+  ZipEntryChunkHandler handler, void *context
+) {
+  if (reader == NULL) {
+    return -1;
+  }
+  
+  const void *chunk = NULL;
+  i64 chunkLength = 0;
+  i32 returnValue = 0;
+  while ((chunkLength = zipEntryReaderRead(reader, &chunk)) != 0) {
+    if ((chunkLength < 0) || (!handler(chunk, chunkLength, context))) {
+      returnValue = -1;
+      break;
+    }
+  }
+  
+  reader = zipEntryReaderDestroy(reader);
+  return returnValue;
+}
+
+/// @fn i32 zipReadEntryToCallbackByName(const Zip *zip, const char *entryName, ZipEntryChunkHandler handler, void *context)
+///
+/// @brief Read an entry from the Zip selected by its file name, passing its
+/// decompressed data to a handler a chunk at a time instead of returning it
+/// in one allocation.
+///
+/// @param zip A pointer to the Zip object to read the entry from.
+/// @param entryName The name of the entry in the Zip archive.
+/// @param handler The function to call with each chunk of data.
+/// @param context The context to pass to handler.
+///
+/// @return Returns 0 if the whole entry was read and verified, -1 on failure
+/// or if the handler returned false.
+i32 zipReadEntryToCallbackByName(const Zip *zip, const char *entryName,
+  ZipEntryChunkHandler handler, void *context
+) {
+  printLog(TRACE,
+    "ENTER zipReadEntryToCallbackByName(zip=%p, entryName=\"%s\", "
+    "handler=%p, context=%p)\n", zip, entryName, handler, context);
+  
+  i32 returnValue = -1;
+  if (handler == NULL) {
+    printLog(ERR, "NULL handler provided.\n");
+  } else {
+    returnValue = zipEntryReaderDrain(
+      zipEntryReaderCreateByName(zip, entryName), handler, context);
+  }
+  
+  printLog(TRACE,
+    "EXIT zipReadEntryToCallbackByName(zip=%p, entryName=\"%s\", "
+    "handler=%p, context=%p) = {%d}\n", zip, entryName, handler, context,
+    returnValue);
+  return returnValue;
+}
+
+/// @fn i32 zipReadEntryToCallbackByIndex(const Zip *zip, i64 entryIndex, ZipEntryChunkHandler handler, void *context)
+///
+/// @brief Read an entry from the Zip selected by its index, passing its
+/// decompressed data to a handler a chunk at a time instead of returning it
+/// in one allocation.
+///
+/// @param zip A pointer to the Zip object to read the entry from.
+/// @param entryIndex The index of the entry in the Zip table of contents.
+/// @param handler The function to call with each chunk of data.
+/// @param context The context to pass to handler.
+///
+/// @return Returns 0 if the whole entry was read and verified, -1 on failure
+/// or if the handler returned false.
+i32 zipReadEntryToCallbackByIndex(const Zip *zip, i64 entryIndex,
+  ZipEntryChunkHandler handler, void *context
+) {
+  printLog(TRACE,
+    "ENTER zipReadEntryToCallbackByIndex(zip=%p, entryIndex=%lld, "
+    "handler=%p, context=%p)\n", zip, lld(entryIndex), handler, context);
+  
+  i32 returnValue = -1;
+  if (handler == NULL) {
+    printLog(ERR, "NULL handler provided.\n");
+  } else {
+    returnValue = zipEntryReaderDrain(
+      zipEntryReaderCreateByIndex(zip, entryIndex), handler, context);
+  }
+  
+  printLog(TRACE,
+    "EXIT zipReadEntryToCallbackByIndex(zip=%p, entryIndex=%lld, "
+    "handler=%p, context=%p) = {%d}\n", zip, lld(entryIndex), handler,
+    context, returnValue);
+  return returnValue;
+}
+
+/// @fn static bool zipEntryNameIsValid(const char *entryName)
+///
+/// @brief Determine whether or not a name can be used for a new Zip entry.
+///
+/// @param entryName The proposed name of the entry.
+///
+/// @return Returns true if the name does not start with '/' and does not
+/// contain '\\' or ':', false otherwise.
+static bool zipEntryNameIsValid(const char *entryName) {
+  return ((*entryName != '/') && (strchr(entryName, '\\') == NULL)
+    && (strchr(entryName, ':') == NULL));
+}
+
+/// @fn static mz_uint32 zipEntryAttributes(const char *entryName)
+///
+/// @brief Get the external file attributes for a new Zip entry.
+///
+/// @param entryName The name of the entry.  Names ending in '/' are
+///   directories.
+///
+/// @return Returns the attributes to store with the entry.
+static mz_uint32 zipEntryAttributes(const char *entryName) {
+  mz_uint32 attributes = MINIZ_ATTRIBUTE_UNIX_PERMISSIONS(00600); // owner RW
+  size_t entryNameLength = strlen(entryName);
+  if ((entryNameLength > 0) && (entryName[entryNameLength - 1] != '/')) {
+    attributes |= MINIZ_ATTRIBUTE_NORMAL;
+  }
+  const char *fileExtension = strrchr(entryName, '.');
+  if ((fileExtension != NULL) && (strcmp(fileExtension, ".exe") == 0)) {
+    // Make it executable for the owner on UNIX systems.
+    attributes |= MINIZ_ATTRIBUTE_UNIX_PERMISSIONS(00100);
   }
   
-  zipUnlock((Zip*) zip);
-  
-  printLog(TRACE,
-    "EXIT zipReadEntryByIndex(zip=%p, entryIndex=%llu, entryLength=%p) "
-    "= {%p}\n", zip, llu(entryIndex), entryLength, decompressedData);
-  return decompressedData;
+  return attributes;
 }
 
 /// @fn i32 zipAddEntry_(Zip *zip, const char *entryName, const volatile void *data, i64 dataLength, int level, ...)
@@ -1238,9 +2133,7 @@ i32 zipAddEntry_(Zip *zip, const char *entryName,
       "EXIT zipAddEntry(zip=%p, entryName=\"%s\", data=%p, dataLength=%llu, "
       "level=%d) = {-1}\n", zip, entryName, data, llu(dataLength), level);
     return -1;
-  } else if ((*entryName == '/') || (strchr(entryName, '\\'))
-    || (strchr(entryName, ':'))
-  ) {
+  } else if (zipEntryNameIsValid(entryName) == false) {
     printLog(ERR, "entryName cannot start with '/' or contain '\\' or ':'.\n");
     printLog(TRACE,
       "EXIT zipAddEntry(zip=%p, entryName=\"%s\", data=%p, dataLength=%llu, "
@@ -1264,16 +2157,7 @@ i32 zipAddEntry_(Zip *zip, const char *entryName,
   
   size_t size = (size_t) dataLength;
   mz_uint flags = level | MZ_ZIP_FLAG_CASE_SENSITIVE;
-  mz_uint32 attributes = MINIZ_ATTRIBUTE_UNIX_PERMISSIONS(00600); // owner RW
-  size_t entryNameLength = strlen(entryName);
-  if ((entryNameLength > 0) && (entryName[entryNameLength - 1] != '/')) {
-    attributes |= MINIZ_ATTRIBUTE_NORMAL;
-  }
-  const char *fileExtension = strrchr(entryName, '.');
-  if ((fileExtension != NULL) && (strcmp(fileExtension, ".exe") == 0)) {
-    // Make it executable for the owner on UNIX systems.
-    attributes |= MINIZ_ATTRIBUTE_UNIX_PERMISSIONS(00100);
-  }
+  mz_uint32 attributes = zipEntryAttributes(entryName);
 
   if (!mz_zip_writer_add_mem_ex(zip->archive, entryName, (void*) data, size,
     NULL /*comment*/, 0 /*comment_size*/,
@@ -1299,6 +2183,467 @@ i32 zipAddEntry_(Zip *zip, const char *entryName,
   return 0;
 }
 
+/// @struct ZipCompressBlock
+///
+/// @brief One independently-compressed piece of an entry being added by
+/// zipAddEntriesParallel.
+///
+/// @param input The uncompressed data for the block.
+/// @param inputLength The number of bytes at input.
+/// @param last Whether or not this is the entry's last block.  Other blocks
+///   end with a full flush instead of the end of the deflate stream so that
+///   the blocks of an entry can simply be concatenated.
+/// @param output The raw deflate output for the block.
+/// @param crc32 The CRC-32 of the block's input.
+/// @param failed Whether or not compressing the block failed.
+typedef struct ZipCompressBlock {
+  const u8 *input;
+  size_t    inputLength;
+  bool      last;
+  Bytes     output;
+  mz_uint32 crc32;
+  bool      failed;
+} ZipCompressBlock;
+
+/// @struct ZipCompressJob
+///
+/// @brief The parameters of a zipAddEntriesParallel compression pass.
+///
+/// @param blocks The blocks of all the entries, in order.
+/// @param numBlocks The number of elements in blocks.
+/// @param nextBlock The index of the next block for a task to claim.
+/// @param flags The tdefl flags to compress with.
+typedef struct ZipCompressJob {
+  ZipCompressBlock *blocks;
+  i64               numBlocks;
+  i64               nextBlock;
+  int               flags;
+} ZipCompressJob;
+
+/// @typedef ZipTaskFunction
+///
+/// @brief Function that performs one task of a parallel Zip operation.
+typedef void (*ZipTaskFunction)(void *job, u64 task, u64 numTasks);
+
+/// @struct ZipTaskRange
+///
+/// @brief The context passed to zipRunRange.
+///
+/// @param function The function that does each task.
+/// @param job The job to pass to function.
+/// @param numTasks The total number of tasks.
+typedef struct ZipTaskRange {
+  ZipTaskFunction function;
+  void *job;
+  u64 numTasks;
+} ZipTaskRange;
+
+/// @fn static void zipRunRange(u64 begin, u64 end, void *context)
+///
+/// @brief ParallelForFunction that runs tasks [begin, end) of a parallel
+/// operation.
+///
+/// @param begin The first task to run.
+/// @param end One past the last task to run.
+/// @param context The ZipTaskRange of the operation.
+///
+/// @return This function returns no value.
+static void zipRunRange(u64 begin, u64 end, void *context) {
+  ZipTaskRange *taskRange = (ZipTaskRange*) context;
+  for (u64 task = begin; task < end; task++) {
+    taskRange->function(taskRange->job, task, taskRange->numTasks);
+  }
+}
+
+/// @fn static void zipRunTasks(ZipTaskFunction function, void *job, u64 numTasks)
+///
+/// @brief Run every task of a parallel operation and wait for them all to
+/// finish.  The tasks are spread across the calling thread and the default
+/// ThreadPool, so no threads are started or stopped here.  If the pool is
+/// not available, the tasks are run on the calling thread.
+///
+/// @param function The function that does each task.
+/// @param job The job to pass to function.
+/// @param numTasks The number of tasks to run.
+///
+/// @return This function returns no value.
+static void zipRunTasks(ZipTaskFunction function, void *job,
+  u64 numTasks
+) {
+  ZipTaskRange taskRange = {
+    .function = function,
+    .job = job,
+    .numTasks = numTasks,
+  };
+  parallelFor(threadPoolGetDefault(), 0, numTasks, 1, zipRunRange,
+    &taskRange);
+}
+
+/// @fn static mz_bool zipCompressBlockPutBuf(const void *buffer, int length, void *output)
+///
+/// @brief tdefl output callback that appends to a block's output.
+///
+/// @param buffer The compressed output.
+/// @param length The number of bytes at buffer.
+/// @param output A pointer to the block's output Bytes.
+///
+/// @return Returns MZ_TRUE on success, MZ_FALSE on memory allocation failure.
+static mz_bool zipCompressBlockPutBuf(const void *buffer, int length,
+  void *output
+) {
+  return (bytesAddData((Bytes*) output, buffer, (u64) length) != NULL)
+    ? MZ_TRUE : MZ_FALSE;
+}
+
+/// @fn static void zipCompressTask(void *job, u64 task, u64 numTasks)
+///
+/// @brief Compress blocks of a ZipCompressJob until there are none left.
+/// Blocks are claimed one at a time so that tasks stay busy even when entry
+/// sizes vary widely.
+///
+/// @param job The ZipCompressJob.
+/// @param task The task number.  Unused.
+/// @param numTasks The number of tasks.  Unused.
+///
+/// @return This function returns no value.
+static void zipCompressTask(void *job, u64 task, u64 numTasks) {
+  (void) task;
+  (void) numTasks;
+  ZipCompressJob *compressJob = (ZipCompressJob*) job;
+  tdefl_compressor *compressor
+    = (tdefl_compressor*) malloc(sizeof(tdefl_compressor));
+  
+  while (true) {
+    i64 blockIndex
+      = __atomic_fetch_add(&compressJob->nextBlock, 1, __ATOMIC_RELAXED);
+    if (blockIndex >= compressJob->numBlocks) {
+      break;
+    }
+    ZipCompressBlock *block = &compressJob->blocks[blockIndex];
+    
+    block->crc32 = (mz_uint32) mz_crc32(MZ_CRC32_INIT, block->input,
+      block->inputLength);
+    if ((compressor == NULL)
+      || (tdefl_init(compressor, zipCompressBlockPutBuf, &block->output,
+        compressJob->flags) != TDEFL_STATUS_OKAY)
+    ) {
+      block->failed = true;
+      continue;
+    }
+    tdefl_status status = tdefl_compress_buffer(compressor, block->input,
+      block->inputLength, (block->last == true) ? TDEFL_FINISH : TDEFL_FULL_FLUSH);
+    block->failed = (block->last == true)
+      ? (status != TDEFL_STATUS_DONE) : (status != TDEFL_STATUS_OKAY);
+  }
+  
+  free(compressor);
+}
+
+/// @fn static void zipGf2MatrixSquare(mz_uint32 *square, const mz_uint32 *matrix)
+///
+/// @brief Square a 32x32 matrix over GF(2).  Used by zipCrc32Combine.
+///
+/// @param square The 32-element array to hold the result.
+/// @param matrix The 32-element matrix to square.
+///
+/// @return This function returns no value.
+static void zipGf2MatrixSquare(mz_uint32 *square, const mz_uint32 *matrix) {
+  for (int ii = 0; ii < 32; ii++) {
+    mz_uint32 vector = matrix[ii];
+    mz_uint32 sum = 0;
+    for (const mz_uint32 *row = matrix; vector != 0; vector >>= 1, row++) {
+      if ((vector & 1) != 0) {
+        sum ^= *row;
+      }
+    }
+    square[ii] = sum;
+  }
+}
+
+/// @fn static mz_uint32 zipGf2MatrixTimes(const mz_uint32 *matrix, mz_uint32 vector)
+///
+/// @brief Multiply a 32x32 matrix over GF(2) by a vector.  Used by
+/// zipCrc32Combine.
+///
+/// @param matrix The 32-element matrix.
+/// @param vector The vector to multiply.
+///
+/// @return Returns the product.
+static mz_uint32 zipGf2MatrixTimes(const mz_uint32 *matrix, mz_uint32 vector) {
+  mz_uint32 sum = 0;
+  for (; vector != 0; vector >>= 1, matrix++) {
+    if ((vector & 1) != 0) {
+      sum ^= *matrix;
+    }
+  }
+  return sum;
+}
+
+/// @fn static mz_uint32 zipCrc32Combine(mz_uint32 crc1, mz_uint32 crc2, u64 length2)
+///
+/// @brief Compute the CRC-32 of two pieces of data laid end to end from the
+/// CRC-32s of the pieces, the same way zlib's crc32_combine does.
+///
+/// @param crc1 The CRC-32 of the first piece.
+/// @param crc2 The CRC-32 of the second piece.
+/// @param length2 The length, in bytes, of the second piece.
+///
+/// @return Returns the CRC-32 of the combined data.
+static mz_uint32 zipCrc32Combine(mz_uint32 crc1, mz_uint32 crc2,
+  u64 length2
+) {
+  if (length2 == 0) {
+    return crc1;
+  }
+  
+  // odd is the operator for one zero bit, even for two.
+  mz_uint32 even[32];
+  mz_uint32 odd[32];
+  odd[0] = 0xedb88320UL; // The CRC-32 polynomial.
+  mz_uint32 row = 1;
+  for (int ii = 1; ii < 32; ii++) {
+    odd[ii] = row;
+    row <<= 1;
+  }
+  zipGf2MatrixSquare(even, odd); // Two zero bits.
+  zipGf2MatrixSquare(odd, even); // Four zero bits.
+  
+  // Apply length2 zero bytes to crc1.  The first square below gives the
+  // operator for one zero byte.
+  do {
+    zipGf2MatrixSquare(even, odd);
+    if ((length2 & 1) != 0) {
+      crc1 = zipGf2MatrixTimes(even, crc1);
+    }
+    length2 >>= 1;
+    if (length2 == 0) {
+      break;
+    }
+    
+    zipGf2MatrixSquare(odd, even);
+    if ((length2 & 1) != 0) {
+      crc1 = zipGf2MatrixTimes(odd, crc1);
+    }
+    length2 >>= 1;
+  } while (length2 != 0);
+  
+  return crc1 ^ crc2;
+}
+
+/// @fn static u64 zipNumTasks(u32 numThreads, i64 numBlocks)
+///
+/// @brief Decide how many threads zipAddEntriesParallel should use.
+///
+/// @param numThreads The number of threads requested.  0 means one per
+///   online CPU.
+/// @param numBlocks The number of blocks to compress.
+///
+/// @return Returns the number of threads to use, at least 1.
+static u64 zipNumTasks(u32 numThreads, i64 numBlocks) {
+  u64 numTasks = numThreads;
+  if (numTasks == 0) {
+#ifdef _WIN32
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    numTasks = systemInfo.dwNumberOfProcessors;
+#else
+    long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    numTasks = (numCpus > 0) ? (u64) numCpus : 1;
+#endif // _WIN32
+  }
+  
+  if (numTasks > (u64) numBlocks) {
+    numTasks = (u64) numBlocks;
+  }
+  
+  return (numTasks > 0) ? numTasks : 1;
+}
+
+/// @fn i32 zipAddEntriesParallel_(Zip *zip, const char *const *entryNames, const volatile void *const *data, const i64 *dataLengths, i64 numEntries, u32 numThreads, int level, ...)
+///
+/// @brief Add several entries to a Zip object, compressing them on multiple
+/// threads.  Entries larger than ZIP_PARALLEL_BLOCK_SIZE are split into
+/// blocks that are compressed independently, so a single large entry is
+/// spread across threads too.  The entries are written to the archive in the
+/// order given.
+///
+/// @note This function is wrapped by a macro of the same name (minus the
+/// trailing underscore) that automatically provides
+/// ZIP_DEFAULT_COMPRESSION_LEVEL as the compression level.
+///
+/// @param zip A pointer to the Zip object to add the entries to.
+/// @param entryNames The names of the entries.  See zipAddEntry.
+/// @param data The data for each entry.
+/// @param dataLengths The number of bytes of each element of data.
+/// @param numEntries The number of entries to add.
+/// @param numThreads The number of threads to use.  0 means one per online
+///   CPU.
+/// @param level The compression level for all of the entries (0 to 9,
+///   inclusive).
+/// @param ... All further parameters are ignored.
+///
+/// @return Returns 0 on success, -1 on failure.  On failure, some of the
+/// entries may have been added.
+i32 zipAddEntriesParallel_(Zip *zip, const char *const *entryNames,
+  const volatile void *const *data, const i64 *dataLengths, i64 numEntries,
+  u32 numThreads, int level, ...
+) {
+  printLog(TRACE,
+    "ENTER zipAddEntriesParallel(zip=%p, numEntries=%lld, numThreads=%u, "
+    "level=%d)\n", zip, lld(numEntries), numThreads, level);
+  
+  if ((zip == NULL) || (entryNames == NULL) || (numEntries < 0)
+    || ((numEntries > 0) && ((data == NULL) || (dataLengths == NULL)))
+    || (level < 0) || (level > 9)
+  ) {
+    printLog(ERR, "Invalid parameters.\n");
+    printLog(TRACE,
+      "EXIT zipAddEntriesParallel(zip=%p, numEntries=%lld, numThreads=%u, "
+      "level=%d) = {-1}\n", zip, lld(numEntries), numThreads, level);
+    return -1;
+  }
+  for (i64 ii = 0; ii < numEntries; ii++) {
+    if ((entryNames[ii] == NULL) || (zipEntryNameIsValid(entryNames[ii]) == false)
+      || (dataLengths[ii] < 0) || ((dataLengths[ii] > 0) && (data[ii] == NULL))
+    ) {
+      printLog(ERR, "Entry %lld is not valid.\n", lld(ii));
+      printLog(TRACE,
+        "EXIT zipAddEntriesParallel(zip=%p, numEntries=%lld, numThreads=%u, "
+        "level=%d) = {-1}\n", zip, lld(numEntries), numThreads, level);
+      return -1;
+    }
+  }
+  
+  // Split everything that needs compressing into blocks.
+  i64 *firstBlocks = (i64*) calloc(numEntries + 1, sizeof(i64));
+  if (firstBlocks == NULL) {
+    LOG_MALLOC_FAILURE();
+    printLog(TRACE,
+      "EXIT zipAddEntriesParallel(zip=%p, numEntries=%lld, numThreads=%u, "
+      "level=%d) = {-1}\n", zip, lld(numEntries), numThreads, level);
+    return -1;
+  }
+  i64 numBlocks = 0;
+  for (i64 ii = 0; ii < numEntries; ii++) {
+    firstBlocks[ii] = numBlocks;
+    if ((level > 0) && (dataLengths[ii] > 3)) {
+      // miniz stores anything of 3 bytes or less, so leave those to it.
+      numBlocks += (dataLengths[ii] + ZIP_PARALLEL_BLOCK_SIZE - 1)
+        / ZIP_PARALLEL_BLOCK_SIZE;
+    }
+  }
+  firstBlocks[numEntries] = numBlocks;
+  
+  ZipCompressBlock *blocks = NULL;
+  if (numBlocks > 0) {
+    blocks = (ZipCompressBlock*) calloc(numBlocks, sizeof(ZipCompressBlock));
+    if (blocks == NULL) {
+      LOG_MALLOC_FAILURE();
+      free(firstBlocks);
+      printLog(TRACE,
+        "EXIT zipAddEntriesParallel(zip=%p, numEntries=%lld, numThreads=%u, "
+        "level=%d) = {-1}\n", zip, lld(numEntries), numThreads, level);
+      return -1;
+    }
+  }
+  for (i64 ii = 0; ii < numEntries; ii++) {
+    const u8 *input = (const u8*) data[ii];
+    i64 remaining = dataLengths[ii];
+    for (i64 jj = firstBlocks[ii]; jj < firstBlocks[ii + 1]; jj++) {
+      blocks[jj].input = input;
+      blocks[jj].inputLength = (size_t) ((remaining > ZIP_PARALLEL_BLOCK_SIZE)
+        ? ZIP_PARALLEL_BLOCK_SIZE : remaining);
+      blocks[jj].last = (jj == firstBlocks[ii + 1] - 1);
+      input += blocks[jj].inputLength;
+      remaining -= (i64) blocks[jj].inputLength;
+    }
+  }
+  
+  // Compress without holding the lock.
+  ZipCompressJob job = { blocks, numBlocks, 0,
+    (int) tdefl_create_comp_flags_from_zip_params(level,
+      -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY) };
+  if (numBlocks > 0) {
+    zipRunTasks(zipCompressTask, &job, zipNumTasks(numThreads, numBlocks));
+  }
+  
+  // Write the entries in order.
+  i32 returnValue = 0;
+  zipLock(zip);
+  if (!_zipEnsureWritable(zip)) {
+    printLog(ERR, "Could not make Zip writable.\n");
+    returnValue = -1;
+  }
+  for (i64 ii = 0; (returnValue == 0) && (ii < numEntries); ii++) {
+    mz_uint32 attributes = zipEntryAttributes(entryNames[ii]);
+    
+    // Put the blocks of the entry back together.
+    Bytes compressed = NULL;
+    mz_uint32 crc32 = MZ_CRC32_INIT;
+    bool useCompressed = (firstBlocks[ii] < firstBlocks[ii + 1]);
+    for (i64 jj = firstBlocks[ii];
+      (useCompressed == true) && (jj < firstBlocks[ii + 1]); jj++
+    ) {
+      if (blocks[jj].failed == true) {
+        useCompressed = false;
+      } else if (jj == firstBlocks[ii]) {
+        // Take the first block's output rather than copying it.
+        compressed = blocks[jj].output;
+        blocks[jj].output = NULL;
+        crc32 = blocks[jj].crc32;
+      } else {
+        bytesAddBytes(&compressed, blocks[jj].output);
+        blocks[jj].output = bytesDestroy(blocks[jj].output);
+        crc32 = zipCrc32Combine(crc32, blocks[jj].crc32,
+          (u64) blocks[jj].inputLength);
+      }
+    }
+    if ((useCompressed == true)
+      && (bytesLength(compressed) >= (u64) dataLengths[ii])
+    ) {
+      // Not compressible.  Store it instead.
+      useCompressed = false;
+    }
+    
+    mz_bool added = MZ_FALSE;
+    if (useCompressed == true) {
+      added = mz_zip_writer_add_mem_ex(zip->archive, entryNames[ii],
+        compressed, (size_t) bytesLength(compressed),
+        NULL /*comment*/, 0 /*comment_size*/,
+        level | MZ_ZIP_FLAG_CASE_SENSITIVE | MZ_ZIP_FLAG_COMPRESSED_DATA,
+        (mz_uint64) dataLengths[ii], crc32, attributes);
+    } else {
+      added = mz_zip_writer_add_mem_ex(zip->archive, entryNames[ii],
+        (const void*) data[ii], (size_t) dataLengths[ii],
+        NULL /*comment*/, 0 /*comment_size*/,
+        ((dataLengths[ii] > 3) ? 0 : level) | MZ_ZIP_FLAG_CASE_SENSITIVE,
+        0 /*uncomp_size*/, 0 /*uncomp_crc32*/, attributes);
+    }
+    compressed = bytesDestroy(compressed);
+    
+    if (!added) {
+      printLog(ERR, "Could not add entry \"%s\" to Zip archive.\n",
+        entryNames[ii]);
+      returnValue = -1;
+    } else {
+      zip->numEntries++;
+    }
+  }
+  zipUnlock(zip);
+  
+  for (i64 jj = 0; jj < numBlocks; jj++) {
+    blocks[jj].output = bytesDestroy(blocks[jj].output);
+  }
+  free(blocks);
+  free(firstBlocks);
+  
+  printLog(TRACE,
+    "EXIT zipAddEntriesParallel(zip=%p, numEntries=%lld, numThreads=%u, "
+    "level=%d) = {%d}\n", zip, lld(numEntries), numThreads, level,
+    returnValue);
+  return returnValue;
+}
+
 /// @fn i64 zipGetNumEntries(Zip *zip)
 ///
 /// @brief Get the number of entries in a Zip archive.
@@ -1496,13 +2841,7 @@ bool zipHasEntry(Zip *zip, const char *entryName) {
     return entryFound; // false
   }
   
-  for (i64 index = 0; index < zip->numEntries; index++) {
-    char **entryNames = zip->entryNames;
-    if (strcmp(entryNames[index], entryName) == 0) {
-      entryFound = true;
-      break;
-    }
-  }
+  entryFound = (zipFindEntry(zip, entryName) >= 0);
   
   zipUnlock(zip);
   
@@ -1537,6 +2876,7 @@ i32 zipClose(Zip *zip) {
       printLog(TRACE, "EXIT zipClose(zip=%p) = {-1}\n", zip);
       return -1;
     }
+    zipUnmapFile(zip);
   } else { // zip->zipMode == ZIP_MODE_WRITE
     // Close everything out for the write.
     if (zip->zipLocation == ZIP_LOCATION_MEMORY) {
@@ -1731,6 +3071,7 @@ Zip* zipDestroy(Zip *zip) {
   }
   
   zip->entrySizes = (i64*) pointerDestroy(zip->entrySizes);
+  zip->entryIndex = (u32*) pointerDestroy(zip->entryIndex);
   
   // No need to free zip->numEntries
   // No need to free zip->zipMode (we need it to close the Zip anyway)
@@ -1754,6 +3095,22 @@ Zip* zipDestroy(Zip *zip) {
 }
 
 
+/// @fn bool compressedDataUnitTestWriter(const void *data, i64 length, void *context)
+///
+/// @brief CompressDataStreamWriter for compressedDataUnitTest that appends
+/// the compressed output to a Bytes object.
+///
+/// @param data The compressed output.
+/// @param length The number of bytes at data.
+/// @param context A pointer to the Bytes to append to.
+///
+/// @return Returns true on success, false on failure.
+static bool compressedDataUnitTestWriter(const void *data, i64 length,
+  void *context
+) {
+  return (bytesAddData((Bytes*) context, data, (u64) length) != NULL);
+}
+
 /// @def COMPRESSED_DATA_UNIT_TEST
 ///
 /// @brief Unit test for compressed data functionality.
@@ -2128,6 +3485,102 @@ bool compressedDataUnitTest() { \
     outputData = stringDestroy(outputData); \
     return false; \
   } \
+  outputData = stringDestroy(outputData); \
+   \
+  /* Every level and strategy must round trip. */ \
+  char *repeatedData = (char*) malloc(100 * (inputDataLength - 1)); \
+  for (int ii = 0; ii < 100; ii++) { \
+    memcpy(&repeatedData[ii * (inputDataLength - 1)], inputData, \
+      inputDataLength - 1); \
+  } \
+  int levels[] = { 0, 1, 3, 6, 10, COMPRESS_DATA_DEFAULT }; \
+  int strategies[] = { \
+    MZ_DEFAULT_STRATEGY, MZ_FILTERED, MZ_HUFFMAN_ONLY, MZ_RLE, MZ_FIXED, \
+    COMPRESS_DATA_DEFAULT \
+  }; \
+  for (int ii = 0; ii < 6; ii++) { \
+    for (int jj = 0; jj < 6; jj++) { \
+      compressedData = compressData(repeatedData, \
+        100 * (inputDataLength - 1), levels[ii], strategies[jj]); \
+      outputData = (char*) decompressData(compressedData, &outputDataLength); \
+      bool matched = (outputDataLength == 100 * (inputDataLength - 1)) \
+        && (memcmp(outputData, repeatedData, outputDataLength) == 0) \
+        && (compressedData->dataIsRaw == (levels[ii] == 0)); \
+      compressedData = compressedDataDestroy(compressedData); \
+      outputData = stringDestroy(outputData); \
+      if (matched == false) { \
+        printLog(ERR, "Level %d, strategy %d did not round trip.\n", \
+          levels[ii], strategies[jj]); \
+        free(repeatedData); \
+        return false; \
+      } \
+    } \
+  } \
+  free(repeatedData); \
+   \
+  /* Noise must be stored without compression. */ \
+  u8 *noise = (u8*) malloc(65536); \
+  u32 noiseState = 2463534242U; \
+  for (int ii = 0; ii < 65536; ii++) { \
+    noiseState ^= noiseState << 13; \
+    noiseState ^= noiseState >> 17; \
+    noiseState ^= noiseState << 5; \
+    noise[ii] = (u8) noiseState; \
+  } \
+  compressedData = compressData(noise, 65536); \
+  free(noise); \
+  if ((compressedData == NULL) || (compressedData->dataIsRaw == false)) { \
+    printLog(ERR, "Noise was not stored raw.\n"); \
+    compressedData = compressedDataDestroy(compressedData); \
+    return false; \
+  } \
+  compressedData = compressedDataDestroy(compressedData); \
+   \
+  Bytes streamBytes = NULL; \
+  CompressDataStream *stream \
+    = compressDataStreamCreate(compressedDataUnitTestWriter, &streamBytes); \
+  if (stream == NULL) { \
+    printLog(ERR, "compressDataStreamCreate returned NULL.\n"); \
+    return false; \
+  } \
+  for (int ii = 0; ii < 1000; ii++) { \
+    /* Feed everything but the terminating NUL in small pieces. */ \
+    if (compressDataStream(stream, inputData, inputDataLength - 1) != 0) { \
+      printLog(ERR, "compressDataStream failed on chunk %d.\n", ii); \
+      stream = compressDataStreamDestroy(stream); \
+      streamBytes = bytesDestroy(streamBytes); \
+      return false; \
+    } \
+  } \
+  if (compressDataStreamFinish(stream) != 0) { \
+    printLog(ERR, "compressDataStreamFinish failed.\n"); \
+    stream = compressDataStreamDestroy(stream); \
+    streamBytes = bytesDestroy(streamBytes); \
+    return false; \
+  } \
+  stream = compressDataStreamDestroy(stream); \
+  compressedData = compressedDataCreate(streamBytes, bytesLength(streamBytes), \
+    false, true); \
+  outputData = (char*) decompressData(compressedData, &outputDataLength); \
+  compressedData = compressedDataDestroy(compressedData); \
+  streamBytes = bytesDestroy(streamBytes); \
+  if ((outputData == NULL) \
+    || (outputDataLength != 1000 * (inputDataLength - 1)) \
+  ) { \
+    printLog(ERR, "Streamed data decompressed to %lld bytes.\n", \
+      lld(outputDataLength)); \
+    outputData = stringDestroy(outputData); \
+    return false; \
+  } \
+  for (int ii = 0; ii < 1000; ii++) { \
+    if (memcmp(&outputData[ii * (inputDataLength - 1)], inputData, \
+      inputDataLength - 1) != 0 \
+    ) { \
+      printLog(ERR, "Streamed data did not match at chunk %d.\n", ii); \
+      outputData = stringDestroy(outputData); \
+      return false; \
+    } \
+  } \
   outputData = stringDestroy(outputData); \
    \
   return true; \
@@ -2608,6 +4061,118 @@ bool zipUnitTest() {
   
   newZip = zipDestroy(newZip);
   
+  newZip = zipOpenMemory(NULL, 0); // Open for writing.
+  if (newZip == NULL) {
+    printLog(ERR, "Could not open new memory-based Zip for writing.\n");
+    return false;
+  }
+  // One entry big enough to be split into several blocks plus a few small
+  // ones, a directory, and one that is too small to compress.
+  i64 bigLength = (5 * ZIP_PARALLEL_BLOCK_SIZE) / 2;
+  char *bigData = (char*) malloc(bigLength);
+  if (bigData == NULL) {
+    LOG_MALLOC_FAILURE();
+    newZip = zipDestroy(newZip);
+    return false;
+  }
+  for (i64 ii = 0; ii < bigLength; ii++) {
+    bigData[ii] = "0123456789abcdef"[(ii * 7 + ii / 1000) & 0xf];
+  }
+  const char *smallData = "The quick brown fox jumped over the lazy dogs.";
+  const char *parallelNames[] = {
+    "parallel/", "parallel/big", "parallel/small", "parallel/tiny",
+    "parallel/empty",
+  };
+  const volatile void *parallelData[] = {
+    NULL, bigData, smallData, "ab", NULL,
+  };
+  i64 parallelLengths[] = {
+    0, bigLength, (i64) strlen(smallData), 2, 0,
+  };
+  if (zipAddEntriesParallel(newZip, parallelNames, parallelData,
+    parallelLengths, 5, 4) != 0
+  ) {
+    printLog(ERR, "zipAddEntriesParallel failed.\n");
+    free(bigData);
+    newZip = zipDestroy(newZip);
+    return false;
+  }
+  if (zipGetNumEntries(newZip) != 5) {
+    printLog(ERR, "Expected 5 entries after zipAddEntriesParallel, got %lld.\n",
+      lld(zipGetNumEntries(newZip)));
+    free(bigData);
+    newZip = zipDestroy(newZip);
+    return false;
+  }
+  for (int ii = 1; ii < 5; ii++) {
+    i64 entryLength = -1;
+    void *entryData = zipReadEntryByName(newZip, parallelNames[ii],
+      &entryLength);
+    if ((entryLength != parallelLengths[ii])
+      || ((entryLength > 0) && ((entryData == NULL)
+        || (memcmp(entryData, (const void*) parallelData[ii],
+          entryLength) != 0)))
+    ) {
+      printLog(ERR, "Entry \"%s\" did not read back correctly.\n",
+        parallelNames[ii]);
+      entryData = pointerDestroy(entryData);
+      free(bigData);
+      newZip = zipDestroy(newZip);
+      return false;
+    }
+    entryData = pointerDestroy(entryData);
+  }
+  
+  // Stream the big entry back out a chunk at a time.
+  ZipEntryReader *reader = zipEntryReaderCreateByName(newZip, "parallel/big");
+  if (reader == NULL) {
+    printLog(ERR, "zipEntryReaderCreateByName returned NULL.\n");
+    free(bigData);
+    newZip = zipDestroy(newZip);
+    return false;
+  }
+  const void *chunk = NULL;
+  i64 chunkLength = 0;
+  i64 streamedLength = 0;
+  while ((chunkLength = zipEntryReaderRead(reader, &chunk)) > 0) {
+    if ((streamedLength + chunkLength > bigLength)
+      || (memcmp(chunk, &bigData[streamedLength], chunkLength) != 0)
+    ) {
+      break;
+    }
+    streamedLength += chunkLength;
+  }
+  reader = zipEntryReaderDestroy(reader);
+  if ((chunkLength != 0) || (streamedLength != bigLength)) {
+    printLog(ERR, "zipEntryReaderRead returned %lld of %lld bytes.\n",
+      lld(streamedLength), lld(bigLength));
+    free(bigData);
+    newZip = zipDestroy(newZip);
+    return false;
+  }
+  Bytes streamedBytes = NULL;
+  if ((zipReadEntryToCallbackByIndex(newZip, 2, compressedDataUnitTestWriter,
+      &streamedBytes) != 0)
+    || (bytesLength(streamedBytes) != strlen(smallData))
+    || (memcmp(streamedBytes, smallData, strlen(smallData)) != 0)
+  ) {
+    printLog(ERR, "zipReadEntryToCallbackByIndex did not read entry 2.\n");
+    streamedBytes = bytesDestroy(streamedBytes);
+    free(bigData);
+    newZip = zipDestroy(newZip);
+    return false;
+  }
+  streamedBytes = bytesDestroy(streamedBytes);
+  
+  if ((u64) zipGetLength(newZip) >= (u64) bigLength) {
+    printLog(ERR, "Parallel compression did not compress.\n");
+    free(bigData);
+    newZip = zipDestroy(newZip);
+    return false;
+  }
+  free(bigData);
+  newZip = zipDestroy(newZip);
+  
   const char *badData
     = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
   zip = zipOpenMemory(badData, strlen(badData), NULL, true);